@@ -37,6 +37,16 @@ extern const int16_t twiddleCoef_1024_q16[1536];
 extern const int16_t twiddleCoef_2048_q16[3072];
 extern const int16_t twiddleCoef_4096_q16[6144];
 
+extern const int32_t twiddleCoef_16_q32[24];
+extern const int32_t twiddleCoef_32_q32[48];
+extern const int32_t twiddleCoef_64_q32[96];
+extern const int32_t twiddleCoef_128_q32[192];
+extern const int32_t twiddleCoef_256_q32[384];
+extern const int32_t twiddleCoef_512_q32[768];
+extern const int32_t twiddleCoef_1024_q32[1536];
+extern const int32_t twiddleCoef_2048_q32[3072];
+extern const int32_t twiddleCoef_4096_q32[6144];
+
 #define PLPBITREVINDEXTABLE_FIXED_16_TABLE_LENGTH ((uint16_t)12)
 #define PLPBITREVINDEXTABLE_FIXED_32_TABLE_LENGTH ((uint16_t)24)
 #define PLPBITREVINDEXTABLE_FIXED_64_TABLE_LENGTH ((uint16_t)56)
@@ -65,4 +75,43 @@ extern const Complex_type_f32 twiddleCoef_rfft_2048[1024];
 
 extern short bit_rev_radix2_LUT[2048];
 
+extern const float32_t twiddleCoef_mixed_10_f32[20];
+extern const float32_t twiddleCoef_mixed_12_f32[24];
+extern const float32_t twiddleCoef_mixed_16_f32[32];
+extern const float32_t twiddleCoef_mixed_20_f32[40];
+extern const float32_t twiddleCoef_mixed_64_f32[128];
+extern const float32_t twiddleCoef_mixed_128_f32[256];
+extern const float32_t twiddleCoef_mixed_256_f32[512];
+
+extern const int16_t twiddleCoef_mixed_10_q16[20];
+extern const int16_t twiddleCoef_mixed_12_q16[24];
+extern const int16_t twiddleCoef_mixed_16_q16[32];
+extern const int16_t twiddleCoef_mixed_20_q16[40];
+extern const int16_t twiddleCoef_mixed_64_q16[128];
+extern const int16_t twiddleCoef_mixed_128_q16[256];
+extern const int16_t twiddleCoef_mixed_256_q16[512];
+
+extern const float32_t twiddleCoef_dct2_20_f32[44];
+extern const float32_t twiddleCoef_dct2_24_f32[52];
+extern const float32_t twiddleCoef_dct2_32_f32[68];
+extern const float32_t twiddleCoef_dct2_40_f32[84];
+
+extern const int16_t twiddleCoef_dct2_20_q16[44];
+extern const int16_t twiddleCoef_dct2_24_q16[52];
+extern const int16_t twiddleCoef_dct2_32_q16[68];
+extern const int16_t twiddleCoef_dct2_40_q16[84];
+
+extern const float32_t twiddleCoef_dct4_128_f32[256];
+extern const float32_t twiddleCoef_dct4_256_f32[512];
+extern const float32_t twiddleCoef_dct4_512_f32[1024];
+
+extern const int16_t twiddleCoef_dct4_128_q16[256];
+extern const int16_t twiddleCoef_dct4_256_q16[512];
+extern const int16_t twiddleCoef_dct4_512_q16[1024];
+
+extern const uint16_t melBandStart_512_40[40];
+extern const uint16_t melBandEnd_512_40[40];
+extern const float32_t melWeights_512_40_f32[492];
+extern const int16_t melWeights_512_40_q16[492];
+
 #endif // PLP_COMMON_TABLES_H
\ No newline at end of file
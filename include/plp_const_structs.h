@@ -38,6 +38,106 @@ extern const plp_cfft_instance_q16 plp_cfft_sR_q16_len1024;
 extern const plp_cfft_instance_q16 plp_cfft_sR_q16_len2048;
 extern const plp_cfft_instance_q16 plp_cfft_sR_q16_len4096;
 
+extern const plp_cfft_instance_q32 plp_cfft_sR_q32_len16;
+extern const plp_cfft_instance_q32 plp_cfft_sR_q32_len32;
+extern const plp_cfft_instance_q32 plp_cfft_sR_q32_len64;
+extern const plp_cfft_instance_q32 plp_cfft_sR_q32_len128;
+extern const plp_cfft_instance_q32 plp_cfft_sR_q32_len256;
+extern const plp_cfft_instance_q32 plp_cfft_sR_q32_len512;
+extern const plp_cfft_instance_q32 plp_cfft_sR_q32_len1024;
+extern const plp_cfft_instance_q32 plp_cfft_sR_q32_len2048;
+extern const plp_cfft_instance_q32 plp_cfft_sR_q32_len4096;
+
+extern const plp_rfft_instance_q16 plp_rfft_sR_q16_len32;
+extern const plp_rfft_instance_q16 plp_rfft_sR_q16_len64;
+extern const plp_rfft_instance_q16 plp_rfft_sR_q16_len128;
+extern const plp_rfft_instance_q16 plp_rfft_sR_q16_len256;
+extern const plp_rfft_instance_q16 plp_rfft_sR_q16_len512;
+extern const plp_rfft_instance_q16 plp_rfft_sR_q16_len1024;
+extern const plp_rfft_instance_q16 plp_rfft_sR_q16_len2048;
+extern const plp_rfft_instance_q16 plp_rfft_sR_q16_len4096;
+
+extern const plp_rfft_instance_q32 plp_rfft_sR_q32_len32;
+extern const plp_rfft_instance_q32 plp_rfft_sR_q32_len64;
+extern const plp_rfft_instance_q32 plp_rfft_sR_q32_len128;
+extern const plp_rfft_instance_q32 plp_rfft_sR_q32_len256;
+extern const plp_rfft_instance_q32 plp_rfft_sR_q32_len512;
+extern const plp_rfft_instance_q32 plp_rfft_sR_q32_len1024;
+extern const plp_rfft_instance_q32 plp_rfft_sR_q32_len2048;
+extern const plp_rfft_instance_q32 plp_rfft_sR_q32_len4096;
+
 extern const plp_rfft_instance_f32 plp_rfft_sR_f32_len2048;
 
+extern const plp_cfft_mixed_instance_f32 plp_cfft_mixed_sR_f32_len10;
+extern const plp_cfft_mixed_instance_f32 plp_cfft_mixed_sR_f32_len12;
+extern const plp_cfft_mixed_instance_f32 plp_cfft_mixed_sR_f32_len16;
+extern const plp_cfft_mixed_instance_f32 plp_cfft_mixed_sR_f32_len20;
+extern const plp_cfft_mixed_instance_f32 plp_cfft_mixed_sR_f32_len64;
+extern const plp_cfft_mixed_instance_f32 plp_cfft_mixed_sR_f32_len128;
+extern const plp_cfft_mixed_instance_f32 plp_cfft_mixed_sR_f32_len256;
+
+extern const plp_cfft_mixed_instance_q16 plp_cfft_mixed_sR_q16_len10;
+extern const plp_cfft_mixed_instance_q16 plp_cfft_mixed_sR_q16_len12;
+extern const plp_cfft_mixed_instance_q16 plp_cfft_mixed_sR_q16_len16;
+extern const plp_cfft_mixed_instance_q16 plp_cfft_mixed_sR_q16_len20;
+extern const plp_cfft_mixed_instance_q16 plp_cfft_mixed_sR_q16_len64;
+extern const plp_cfft_mixed_instance_q16 plp_cfft_mixed_sR_q16_len128;
+extern const plp_cfft_mixed_instance_q16 plp_cfft_mixed_sR_q16_len256;
+
+extern const plp_dct2_instance_f32 plp_dct2_sR_f32_len20;
+extern const plp_dct2_instance_f32 plp_dct2_sR_f32_len24;
+extern const plp_dct2_instance_f32 plp_dct2_sR_f32_len32;
+extern const plp_dct2_instance_f32 plp_dct2_sR_f32_len40;
+
+extern const plp_dct2_instance_q16 plp_dct2_sR_q16_len20;
+extern const plp_dct2_instance_q16 plp_dct2_sR_q16_len24;
+extern const plp_dct2_instance_q16 plp_dct2_sR_q16_len32;
+extern const plp_dct2_instance_q16 plp_dct2_sR_q16_len40;
+
+extern const plp_dct4_instance_f32 plp_dct4_sR_f32_len128;
+extern const plp_dct4_instance_f32 plp_dct4_sR_f32_len256;
+extern const plp_dct4_instance_f32 plp_dct4_sR_f32_len512;
+
+extern const plp_dct4_instance_q16 plp_dct4_sR_q16_len128;
+extern const plp_dct4_instance_q16 plp_dct4_sR_q16_len256;
+extern const plp_dct4_instance_q16 plp_dct4_sR_q16_len512;
+
+extern const plp_mdct_instance_f32 plp_mdct_sR_f32_len128;
+extern const plp_mdct_instance_f32 plp_mdct_sR_f32_len256;
+extern const plp_mdct_instance_f32 plp_mdct_sR_f32_len512;
+
+extern const plp_mdct_instance_q16 plp_mdct_sR_q16_len128;
+extern const plp_mdct_instance_q16 plp_mdct_sR_q16_len256;
+extern const plp_mdct_instance_q16 plp_mdct_sR_q16_len512;
+
+extern const plp_mfcc_instance_f32 plp_mfcc_sR_f32_len512;
+extern const plp_mfcc_instance_q16 plp_mfcc_sR_q16_len512;
+
+extern const plp_stream_op plp_stream_add_i32;
+extern const plp_stream_op plp_stream_add_i16;
+extern const plp_stream_op plp_stream_add_i8;
+extern const plp_stream_op plp_stream_mult_i32;
+extern const plp_stream_op plp_stream_mult_i16;
+extern const plp_stream_op plp_stream_mult_i8;
+extern const plp_stream_op plp_stream_abs_i32;
+extern const plp_stream_op plp_stream_abs_i16;
+extern const plp_stream_op plp_stream_abs_i8;
+extern const plp_stream_op plp_stream_dot_prod_i32;
+extern const plp_stream_op plp_stream_dot_prod_i16;
+extern const plp_stream_op plp_stream_dot_prod_i8;
+
+extern const plp_stream_op plp_stream_max_i32;
+extern const plp_stream_op plp_stream_max_i16;
+extern const plp_stream_op plp_stream_max_i8;
+extern const plp_stream_op plp_stream_min_i32;
+extern const plp_stream_op plp_stream_min_i16;
+extern const plp_stream_op plp_stream_min_i8;
+extern const plp_stream_op plp_stream_power_i32;
+extern const plp_stream_op plp_stream_power_i16;
+extern const plp_stream_op plp_stream_power_i8;
+
+extern const plp_stream_op plp_stream_conv_valid_i32;
+extern const plp_stream_op plp_stream_conv_valid_i16;
+extern const plp_stream_op plp_stream_conv_valid_i8;
+
 #endif // PLP_CONST_STRUCTS_H
\ No newline at end of file
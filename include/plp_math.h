@@ -123,6 +123,8 @@ typedef float float32_t;
 #define PLP_MATH_IBEX // previously called zero-riscy
 //#define PLP_MATH_RISCY
 #define PLP_MATH_LOOPUNROLL
+#define PLP_MATH_FFT_RADIX4 // mixed radix-4/2 floating-point FFT, comment out for radix-2 only
+//#define PLP_PROFILE // per-function performance counters of the glue code, see plp_profile_dump
 
 /** -------------------------------------------------------
     @struct plp_dot_prod_instance_i32
@@ -253,7 +255,8 @@ typedef struct {
  * @brief Instance structure for the fixed-point CFFT/CIFFT function.
  * @param[in]   fftLen              length of the FFT
  * @param[in]   pTwiddle            points to the Twiddle factor table
- * @param[in]   pBitRevTable        points to the bit reversal table
+ * @param[in]   pBitRevTable        points to the bit reversal table. The CFFT kernels compute the
+ *                                   bit-reversed indices at runtime and do not read it
  * @param[in]   bitRevTableLength   bit reversal table length
  */
 typedef struct {
@@ -266,17 +269,17 @@ typedef struct {
 /** -------------------------------------------------------
     @struct plp_rfft_instance_f32
     @brief Instance structure for floating-point FFT
-    @param[in]  length data length of the FFT
-    @param[in]  bitReverseFlag  flag that enables (bitReverseFlagR=1) or disables
-    (bitReverseFlagR=0) bit reversal of output
+    @param[in]  length data length of the FFT, a power of 2 of at least 2
+    @param[in]  bitReverseFlag  unused by the real FFT. The real FFT computes a packed complex FFT
+    of length N/2 and reads it in bit-reversed order during the split stage, hence the output is
+    always in natural order.
     @param[in]  pTwiddleFactors pointer to the twiddle factors.
     These values must be computed using this formula:
     \f$W_N^k =   e^{-j \frac{\pi}{N} k}\f$,
     where \f$N\f$ is the data length and \f$k\f$ is the index.
     The user must provide \f$\frac{N}{2}\f$ values (\f$k = 0 .. \frac{N}{2}-1\f$).
-    @param[in]  pBitReverseLUT  pointer to the lookup table used for the bit reversal of output.
-    This table must include \f$N\f$ elements in the range \f$0 .. N-1\f$,
-    where each location \f$k\f$ contains the value \f$bitreverse(k)\f$.
+    @param[in]  pBitReverseLUT  unused, kept for compatibility. The bit-reversed indices are
+    computed at runtime, may be NULL.
 */
 typedef struct {
     uint32_t FFTLength;
@@ -286,453 +289,1117 @@ typedef struct {
 } plp_rfft_instance_f32;
 
 typedef struct {
-    plp_rfft_instance_f32 *S;
+    const plp_rfft_instance_f32 *S;
     const float32_t *pSrc;
-    const uint32_t nPE;
+    uint32_t nPE;
     float32_t *pDst;
 } plp_rfft_parallel_arg_f32;
 
 typedef struct {
-    float32_t re;
-    float32_t im;
-} Complex_type_f32;
+    const plp_rfft_instance_f32 *S;
+    const float32_t *pSrc;
+    uint32_t nPE;
+    float32_t *pDst;
+} plp_rifft_parallel_arg_f32;
 
-/** -------------------------------------------------------
- * @brief Instance structure for integer parallel matrix multiplication.
+/**
+ * @param[in,out] pSrc        points to the in-place buffer of complex 16-bit or 32-bit values
+ * @param[in]     bitRevLen   bit reversal table length
+ * @param[in]     pBitRevTab  points to the bit reversal table
+ * @param[in]     nPE         number of parallel processing units
  */
 typedef struct {
-    const int8_t *__restrict__ pSrcA;
-    const int8_t *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
-    uint32_t O;
+    void *pSrc;
+    uint16_t bitRevLen;
+    const uint16_t *pBitRevTab;
     uint32_t nPE;
-    int32_t *__restrict__ pDstC;
-} plp_mat_mult_instance_i8;
+} plp_bitreversal_parallel_arg;
 
-/** -------------------------------------------------------
- * @brief Instance structure for integer parallel matrix multiplication.
+/**
+ * @param[in,out] pSrc        points to the in-place buffer of fftLen complex 16 or 32-bit values
+ * @param[in]     fftLen      length of the FFT, a power of 2
+ * @param[in]     nPE         number of parallel processing units
  */
 typedef struct {
-    const int16_t *__restrict__ pSrcA;
-    const int16_t *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
-    uint32_t O;
+    void *pSrc;
+    uint32_t fftLen;
     uint32_t nPE;
-    int32_t *__restrict__ pDstC;
-} plp_mat_mult_instance_i16;
+} plp_bitreversal_nolut_parallel_arg;
 
-/** -------------------------------------------------------
- * @brief Instance structure for integer parallel matrix multiplication.
+/**
+ * @brief Instance structure for the 32 bit fixed-point CFFT/CIFFT function.
+ * @param[in]   fftLen              length of the FFT
+ * @param[in]   pTwiddle            points to the Twiddle factor table (Q1.31)
+ * @param[in]   pBitRevTable        points to the bit reversal table. The CFFT kernels compute the
+ *                                   bit-reversed indices at runtime and do not read it
+ * @param[in]   bitRevTableLength   bit reversal table length
  */
 typedef struct {
-    const int32_t *__restrict__ pSrcA;
-    const int32_t *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
-    uint32_t O;
-    uint32_t nPE;
-    int32_t *__restrict__ pDstC;
-} plp_mat_mult_instance_i32;
+    uint16_t fftLen;              /*< length of the FFT. */
+    const int32_t *pTwiddle;      /*< points to the Twiddle factor table. */
+    const uint16_t *pBitRevTable; /*< points to the bit reversal table. */
+    uint16_t bitRevLength;        /*< bit reversal table length. */
+} plp_cfft_instance_q32;
 
-/** -------------------------------------------------------
- * @brief Instance structure for floating-point parallel matrix multiplication.
+/**
+ * @brief Instance structure for the 16 bit fixed-point real FFT function.
+ * @param[in]   fftLenReal          length of the real FFT
+ * @param[in]   pCfft               points to the instance of the complex FFT of length
+ *                                  fftLenReal/2
+ * @param[in]   pTwiddleRFFT        points to the Twiddle factor table of a complex FFT of length
+ *                                  fftLenReal, used by the split stage
  */
 typedef struct {
-    const float *__restrict__ pSrcA;
-    const float *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
-    uint32_t O;
-    uint32_t nPE;
-    float *__restrict__ pDstC;
-} plp_mat_mult_instance_f32;
+    uint32_t fftLenReal;                /*< length of the real FFT. */
+    const plp_cfft_instance_q16 *pCfft; /*< points to the complex FFT of half length. */
+    const int16_t *pTwiddleRFFT;        /*< points to the Twiddle factor table. */
+} plp_rfft_instance_q16;
 
-/** -------------------------------------------------------
- * @brief Instance structure for 8-bit fix-point parallel matrix multiplication.
+/**
+ * @brief Instance structure for the 32 bit fixed-point real FFT function.
+ * @param[in]   fftLenReal          length of the real FFT
+ * @param[in]   pCfft               points to the instance of the complex FFT of length
+ *                                  fftLenReal/2
+ * @param[in]   pTwiddleRFFT        points to the Twiddle factor table of a complex FFT of length
+ *                                  fftLenReal, used by the split stage
  */
 typedef struct {
-    const int8_t *__restrict__ pSrcA;
-    const int8_t *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
-    uint32_t O;
-    uint32_t shift;
-    uint32_t nPE;
-    int8_t *__restrict__ pDstC;
-} plp_mat_mult_instance_q8;
+    uint32_t fftLenReal;                /*< length of the real FFT. */
+    const plp_cfft_instance_q32 *pCfft; /*< points to the complex FFT of half length. */
+    const int32_t *pTwiddleRFFT;        /*< points to the Twiddle factor table. */
+} plp_rfft_instance_q32;
 
-/** -------------------------------------------------------
- * @brief Instance structure for 16-bit fix-point parallel matrix multiplication.
+/**
+ * @brief Instance structure for the parallel 16 bit fixed-point CFFT function.
+ * @param[in]     S               points to an instance of the 16bit quantized CFFT structure
+ * @param[in,out] p1              points to the complex data buffer of size <code>2*fftLen</code>
+ * @param[in]     ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ * @param[in]     bitReverseFlag  flag that enables (bitReverseFlag=1) bit reversal of output
+ * @param[in]     deciPoint       decimal point for right shift
+ * @param[in]     nPE             number of parallel processing units
  */
 typedef struct {
-    const int16_t *__restrict__ pSrcA;
-    const int16_t *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
-    uint32_t O;
-    uint32_t shift;
+    const plp_cfft_instance_q16 *S;
+    int16_t *p1;
+    uint8_t ifftFlag;
+    uint8_t bitReverseFlag;
+    uint32_t deciPoint;
     uint32_t nPE;
-    int16_t *__restrict__ pDstC;
-} plp_mat_mult_instance_q16;
+} plp_cfft_parallel_arg_q16;
 
-/** -------------------------------------------------------
- * @brief Instance structure for 32-bit fix-point parallel matrix multiplication.
+/**
+ * @brief Instance structure for the parallel 32 bit fixed-point CFFT function.
+ * @param[in]     S               points to an instance of the 32bit quantized CFFT structure
+ * @param[in,out] p1              points to the complex data buffer of size <code>2*fftLen</code>
+ * @param[in]     ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ * @param[in]     bitReverseFlag  flag that enables (bitReverseFlag=1) bit reversal of output
+ * @param[in]     deciPoint       decimal point for right shift
+ * @param[in]     nPE             number of parallel processing units
  */
 typedef struct {
-    const int32_t *__restrict__ pSrcA;
-    const int32_t *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
-    uint32_t O;
-    uint32_t shift;
+    const plp_cfft_instance_q32 *S;
+    int32_t *p1;
+    uint8_t ifftFlag;
+    uint8_t bitReverseFlag;
+    uint32_t deciPoint;
     uint32_t nPE;
-    int32_t *__restrict__ pDstC;
-} plp_mat_mult_instance_q32;
+} plp_cfft_parallel_arg_q32;
 
-/** -------------------------------------------------------
- * @brief Instance structure for integer parallel complex matrix matrix multiplication.
+/**
+ * @brief Instance structure for the parallel 16 bit fixed-point real FFT function.
+ * @param[in]   S           points to an instance of the 16bit quantized RFFT structure
+ * @param[in]   pSrc        points to the input buffer (real data)
+ * @param[in]   deciPoint   decimal point for right shift
+ * @param[in]   nPE         number of parallel processing units
+ * @param[out]  pDst        points to the output buffer (complex data)
  */
 typedef struct {
-    const int8_t *__restrict__ pSrcA;
-    const int8_t *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
-    uint32_t O;
+    const plp_rfft_instance_q16 *S;
+    const int16_t *pSrc;
+    uint32_t deciPoint;
     uint32_t nPE;
-    int32_t *__restrict__ pDstC;
-} plp_mat_mult_cmplx_instance_i8;
+    int16_t *pDst;
+} plp_rfft_parallel_arg_q16;
 
-/** -------------------------------------------------------
- * @brief Instance structure for integer parallel complex matrix matrix multiplication.
+/**
+ * @brief Instance structure for the parallel 32 bit fixed-point real FFT function.
+ * @param[in]   S           points to an instance of the 32bit quantized RFFT structure
+ * @param[in]   pSrc        points to the input buffer (real data)
+ * @param[in]   deciPoint   decimal point for right shift
+ * @param[in]   nPE         number of parallel processing units
+ * @param[out]  pDst        points to the output buffer (complex data)
  */
 typedef struct {
-    const int16_t *__restrict__ pSrcA;
-    const int16_t *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
-    uint32_t O;
+    const plp_rfft_instance_q32 *S;
+    const int32_t *pSrc;
+    uint32_t deciPoint;
     uint32_t nPE;
-    int32_t *__restrict__ pDstC;
-} plp_mat_mult_cmplx_instance_i16;
+    int32_t *pDst;
+} plp_rfft_parallel_arg_q32;
 
-/** -------------------------------------------------------
- * @brief Instance structure for integer parallel complex matrix matrix multiplication.
+/**
+ * @brief Maximum number of stages of the mixed-radix FFT plan.
+ */
+#define PLP_CFFT_MIXED_MAX_STAGES 16
+
+/**
+ * @brief Instance structure for the floating-point mixed-radix CFFT function.
+ * @param[in]  fftLen      length of the FFT, product of the factors 2, 3, 4 and 5
+ * @param[in]  numStages   number of stages of the plan
+ * @param[in]  factors     radix of each stage, the first one is computed last
+ * @param[in]  pTwiddle    points to the fftLen twiddle factors {cos(2*pi*k/N), sin(2*pi*k/N)}
  */
 typedef struct {
-    const int32_t *__restrict__ pSrcA;
-    const int32_t *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
-    uint32_t O;
-    uint32_t nPE;
-    int32_t *__restrict__ pDstC;
-} plp_mat_mult_cmplx_instance_i32;
+    uint16_t fftLen;
+    uint16_t numStages;
+    uint16_t factors[PLP_CFFT_MIXED_MAX_STAGES];
+    const float32_t *pTwiddle;
+} plp_cfft_mixed_instance_f32;
 
-/** -------------------------------------------------------
- * @brief Instance structure for floating-point parallel complex matrix matrix multiplication.
+/**
+ * @brief Instance structure for the 16 bit fixed-point mixed-radix CFFT function.
+ * @param[in]  fftLen      length of the FFT, product of the factors 2, 3, 4 and 5
+ * @param[in]  numStages   number of stages of the plan
+ * @param[in]  factors     radix of each stage, the first one is computed last
+ * @param[in]  pTwiddle    points to the fftLen Q1.15 twiddle factors {cos, sin}
  */
 typedef struct {
-    const float *__restrict__ pSrcA;
-    const float *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
-    uint32_t O;
-    uint32_t nPE;
-    float *__restrict__ pDstC;
-} plp_mat_mult_cmplx_instance_f32;
+    uint16_t fftLen;
+    uint16_t numStages;
+    uint16_t factors[PLP_CFFT_MIXED_MAX_STAGES];
+    const int16_t *pTwiddle;
+} plp_cfft_mixed_instance_q16;
 
-/** -------------------------------------------------------
- * @brief Instance structure for 8-bit fix-point parallel complex matrix matrix multiplication.
+/**
+ * @brief Instance structure for the parallel floating-point mixed-radix CFFT function.
+ * @param[in]   S       points to an instance of the floating-point mixed-radix CFFT structure
+ * @param[in]   pSrc    points to the input buffer (complex data)
+ * @param[in]   nPE     number of parallel processing units
+ * @param[out]  pDst    points to the output buffer (complex data)
  */
 typedef struct {
-    const int8_t *__restrict__ pSrcA;
-    const int8_t *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
-    uint32_t O;
-    uint32_t shift;
+    const plp_cfft_mixed_instance_f32 *S;
+    const float32_t *pSrc;
     uint32_t nPE;
-    int8_t *__restrict__ pDstC;
-} plp_mat_mult_cmplx_instance_q8;
+    float32_t *pDst;
+} plp_cfft_mixed_parallel_arg_f32;
 
-/** -------------------------------------------------------
- * @brief Instance structure for 16-bit fix-point parallel complex matrix matrix multiplication.
+/**
+ * @brief Instance structure for the parallel 16 bit fixed-point mixed-radix CFFT function.
+ * @param[in]   S           points to an instance of the 16bit mixed-radix CFFT structure
+ * @param[in]   pSrc        points to the input buffer (complex data)
+ * @param[in]   deciPoint   decimal point for right shift
+ * @param[in]   nPE         number of parallel processing units
+ * @param[out]  pDst        points to the output buffer (complex data)
  */
 typedef struct {
-    const int16_t *__restrict__ pSrcA;
-    const int16_t *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
-    uint32_t O;
-    uint32_t shift;
+    const plp_cfft_mixed_instance_q16 *S;
+    const int16_t *pSrc;
+    uint32_t deciPoint;
     uint32_t nPE;
-    int16_t *__restrict__ pDstC;
-} plp_mat_mult_cmplx_instance_q16;
+    int16_t *pDst;
+} plp_cfft_mixed_parallel_arg_q16;
 
-/** -------------------------------------------------------
- * @brief Instance structure for 32-bit fix-point parallel complex matrix matrix multiplication.
+/**
+ * @brief Instance structure for the floating-point DCT-II function.
+ * @param[in]  N           length of the DCT, must be even
+ * @param[in]  pCfft       points to the instance of the N/2 point mixed-radix CFFT
+ * @param[in]  pTwiddle    points to the N/2+1 post twiddle factors {cos(pi*k/(2N)),
+ *                         sin(pi*k/(2N))}, followed by the N/2+1 split twiddle factors
+ *                         {cos(2*pi*k/N), sin(2*pi*k/N)}
  */
 typedef struct {
-    const int32_t *__restrict__ pSrcA;
-    const int32_t *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
-    uint32_t O;
-    uint32_t shift;
-    uint32_t nPE;
-    int32_t *__restrict__ pDstC;
-} plp_mat_mult_cmplx_instance_q32;
+    uint16_t N;
+    const plp_cfft_mixed_instance_f32 *pCfft;
+    const float32_t *pTwiddle;
+} plp_dct2_instance_f32;
 
-/** -------------------------------------------------------
- * @brief Instance structure for integer parallel matrix addition.
+/**
+ * @brief Instance structure for the 16 bit fixed-point DCT-II function.
+ * @param[in]  N           length of the DCT, must be even
+ * @param[in]  pCfft       points to the instance of the N/2 point mixed-radix CFFT
+ * @param[in]  pTwiddle    points to the Q1.15 post and split twiddle factors, see
+ *                         plp_dct2_instance_f32
  */
 typedef struct {
-    const int8_t *__restrict__ pSrcA;
-    const int8_t *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
-    uint32_t nPE;
-    int8_t *__restrict__ pDst;
-} plp_mat_add_instance_i8;
+    uint16_t N;
+    const plp_cfft_mixed_instance_q16 *pCfft;
+    const int16_t *pTwiddle;
+} plp_dct2_instance_q16;
 
-/** -------------------------------------------------------
- * @brief Instance structure for integer parallel matrix addition.
+/**
+ * @brief Instance structure for the floating-point DCT-IV function.
+ * @param[in]  N           length of the DCT, must be even
+ * @param[in]  pCfft       points to the instance of the N/2 point mixed-radix CFFT
+ * @param[in]  pTwiddle    points to the N/2 pre twiddle factors {cos(pi*(4n+1)/(4N)),
+ *                         sin(pi*(4n+1)/(4N))}, followed by the N/2 post twiddle factors
+ *                         {cos(pi*k/N), sin(pi*k/N)}
  */
 typedef struct {
-    const int16_t *__restrict__ pSrcA;
-    const int16_t *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
-    uint32_t nPE;
-    int16_t *__restrict__ pDst;
-} plp_mat_add_instance_i16;
+    uint16_t N;
+    const plp_cfft_mixed_instance_f32 *pCfft;
+    const float32_t *pTwiddle;
+} plp_dct4_instance_f32;
 
-/** -------------------------------------------------------
- * @brief Instance structure for integer parallel matrix addition.
+/**
+ * @brief Instance structure for the 16 bit fixed-point DCT-IV function.
+ * @param[in]  N           length of the DCT, must be even
+ * @param[in]  pCfft       points to the instance of the N/2 point mixed-radix CFFT
+ * @param[in]  pTwiddle    points to the Q1.15 pre and post twiddle factors, see
+ *                         plp_dct4_instance_f32
  */
 typedef struct {
-    const int32_t *__restrict__ pSrcA;
-    const int32_t *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
-    uint32_t nPE;
-    int32_t *__restrict__ pDst;
-} plp_mat_add_instance_i32;
+    uint16_t N;
+    const plp_cfft_mixed_instance_q16 *pCfft;
+    const int16_t *pTwiddle;
+} plp_dct4_instance_q16;
 
-/** -------------------------------------------------------
- * @brief Instance structure for floating-point parallel matrix addition.
+/**
+ * @brief Instance structure for the floating-point MDCT function.
+ * @param[in]  N           number of output coefficients, the input has 2N samples. N must be a
+ *                         multiple of 4.
+ * @param[in]  pDct4       points to the instance of the N point DCT-IV
  */
 typedef struct {
-    const float *__restrict__ pSrcA;
-    const float *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
-    uint32_t nPE;
-    float *__restrict__ pDst;
-} plp_mat_add_instance_f32;
+    uint16_t N;
+    const plp_dct4_instance_f32 *pDct4;
+} plp_mdct_instance_f32;
 
-/** -------------------------------------------------------
- * @brief Instance structure for integer parallel matrix subtraction.
+/**
+ * @brief Instance structure for the 16 bit fixed-point MDCT function.
+ * @param[in]  N           number of output coefficients, the input has 2N samples. N must be a
+ *                         multiple of 4.
+ * @param[in]  pDct4       points to the instance of the N point DCT-IV
  */
 typedef struct {
-    const int8_t *__restrict__ pSrcA;
-    const int8_t *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
+    uint16_t N;
+    const plp_dct4_instance_q16 *pDct4;
+} plp_mdct_instance_q16;
+
+/**
+ * @brief Instance structure for the parallel floating-point DCT-II function.
+ * @param[in]   S           points to an instance of the floating-point DCT-II structure
+ * @param[in]   pSrc        points to the input buffer of N samples
+ * @param[in]   nPE         number of parallel processing units
+ * @param[in]   pBuf        points to a temporary buffer of N values
+ * @param[out]  pDst        points to the output buffer of N values
+ */
+typedef struct {
+    const plp_dct2_instance_f32 *S;
+    const float32_t *pSrc;
     uint32_t nPE;
-    int8_t *__restrict__ pDst;
-} plp_mat_sub_instance_i8;
+    float32_t *pBuf;
+    float32_t *pDst;
+} plp_dct2_parallel_arg_f32;
 
-/** -------------------------------------------------------
- * @brief Instance structure for integer parallel matrix subtraction.
+/**
+ * @brief Instance structure for the parallel 16 bit fixed-point DCT-II function.
+ * @param[in]   S           points to an instance of the 16 bit fixed-point DCT-II structure
+ * @param[in]   pSrc        points to the input buffer of N samples
+ * @param[in]   deciPoint   decimal point for right shift
+ * @param[in]   nPE         number of parallel processing units
+ * @param[in]   pBuf        points to a temporary buffer of N values
+ * @param[out]  pDst        points to the output buffer of N values
  */
 typedef struct {
-    const int16_t *__restrict__ pSrcA;
-    const int16_t *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
+    const plp_dct2_instance_q16 *S;
+    const int16_t *pSrc;
+    uint32_t deciPoint;
     uint32_t nPE;
-    int16_t *__restrict__ pDst;
-} plp_mat_sub_instance_i16;
+    int16_t *pBuf;
+    int16_t *pDst;
+} plp_dct2_parallel_arg_q16;
 
-/** -------------------------------------------------------
- * @brief Instance structure for integer parallel matrix subtraction.
+/**
+ * @brief Instance structure for the parallel floating-point DCT-IV function.
+ * @param[in]   S           points to an instance of the floating-point DCT-IV structure
+ * @param[in]   pSrc        points to the input buffer of N samples
+ * @param[in]   nPE         number of parallel processing units
+ * @param[in]   pBuf        points to a temporary buffer of N values
+ * @param[out]  pDst        points to the output buffer of N values
  */
 typedef struct {
-    const int32_t *__restrict__ pSrcA;
-    const int32_t *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
+    const plp_dct4_instance_f32 *S;
+    const float32_t *pSrc;
     uint32_t nPE;
-    int32_t *__restrict__ pDst;
-} plp_mat_sub_instance_i32;
+    float32_t *pBuf;
+    float32_t *pDst;
+} plp_dct4_parallel_arg_f32;
 
-/** -------------------------------------------------------
- * @brief Instance structure for floating-point parallel matrix subtraction.
+/**
+ * @brief Instance structure for the parallel 16 bit fixed-point DCT-IV function.
+ * @param[in]   S           points to an instance of the 16 bit fixed-point DCT-IV structure
+ * @param[in]   pSrc        points to the input buffer of N samples
+ * @param[in]   deciPoint   decimal point for right shift
+ * @param[in]   nPE         number of parallel processing units
+ * @param[in]   pBuf        points to a temporary buffer of N values
+ * @param[out]  pDst        points to the output buffer of N values
  */
 typedef struct {
-    const float *__restrict__ pSrcA;
-    const float *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
+    const plp_dct4_instance_q16 *S;
+    const int16_t *pSrc;
+    uint32_t deciPoint;
     uint32_t nPE;
-    float *__restrict__ pDst;
-} plp_mat_sub_instance_f32;
+    int16_t *pBuf;
+    int16_t *pDst;
+} plp_dct4_parallel_arg_q16;
 
-/** -------------------------------------------------------
- * @brief Instance structure for integer parallel matrix scale.
+/**
+ * @brief Instance structure for the parallel floating-point MDCT function.
+ * @param[in]   S           points to an instance of the floating-point MDCT structure
+ * @param[in]   pSrc        points to the input buffer of 2N samples
+ * @param[in]   nPE         number of parallel processing units
+ * @param[in]   pBuf        points to a temporary buffer of N values
+ * @param[out]  pDst        points to the output buffer of N values
  */
 typedef struct {
-    const int8_t *__restrict__ pSrc;
-    uint32_t M;
-    uint32_t N;
-    int8_t scaleFactor;
-    int32_t shift;
+    const plp_mdct_instance_f32 *S;
+    const float32_t *pSrc;
     uint32_t nPE;
-    int8_t *__restrict__ pDst;
-} plp_mat_scale_instance_i8;
+    float32_t *pBuf;
+    float32_t *pDst;
+} plp_mdct_parallel_arg_f32;
 
-/** -------------------------------------------------------
- * @brief Instance structure for integer parallel matrix scale.
+/**
+ * @brief Instance structure for the parallel 16 bit fixed-point MDCT function.
+ * @param[in]   S           points to an instance of the 16 bit fixed-point MDCT structure
+ * @param[in]   pSrc        points to the input buffer of 2N samples
+ * @param[in]   deciPoint   decimal point for right shift
+ * @param[in]   nPE         number of parallel processing units
+ * @param[in]   pBuf        points to a temporary buffer of N values
+ * @param[out]  pDst        points to the output buffer of N values
  */
 typedef struct {
-    const int16_t *__restrict__ pSrc;
-    uint32_t M;
-    uint32_t N;
-    int16_t scaleFactor;
-    int32_t shift;
+    const plp_mdct_instance_q16 *S;
+    const int16_t *pSrc;
+    uint32_t deciPoint;
     uint32_t nPE;
-    int16_t *__restrict__ pDst;
-} plp_mat_scale_instance_i16;
+    int16_t *pBuf;
+    int16_t *pDst;
+} plp_mdct_parallel_arg_q16;
 
-/** -------------------------------------------------------
- * @brief Instance structure for integer parallel matrix scale.
+/**
+ * @brief Instance structure for the floating-point STFT function.
+ * @param[in]     pRfft       points to the instance of the real FFT, its length is the frame
+ *                            length N
+ * @param[in]     pWindow     points to the analysis window of N values
+ * @param[in]     hopLen      number of new samples per frame, 0 < hopLen <= N
+ * @param[in,out] statePos    position of the oldest sample in the ring buffer
+ * @param[in,out] pState      points to the ring buffer of the last N - hopLen input samples. It
+ *                            is mirrored, i.e. it holds <code>2*(N-hopLen)</code> values.
  */
 typedef struct {
-    const int32_t *__restrict__ pSrc;
-    uint32_t M;
-    uint32_t N;
-    int32_t scaleFactor;
-    int32_t shift;
+    const plp_rfft_instance_f32 *pRfft;
+    const float32_t *pWindow;
+    uint16_t hopLen;
+    uint16_t statePos;
+    float32_t *pState;
+} plp_stft_instance_f32;
+
+/**
+ * @brief Instance structure for the 16 bit fixed-point STFT function.
+ * @param[in]     pRfft       points to the instance of the 16 bit real FFT, its length is the
+ *                            frame length N
+ * @param[in]     pWindow     points to the Q1.15 analysis window of N values
+ * @param[in]     hopLen      number of new samples per frame, 0 < hopLen <= N
+ * @param[in,out] statePos    position of the oldest sample in the ring buffer
+ * @param[in,out] pState      points to the mirrored ring buffer of <code>2*(N-hopLen)</code>
+ *                            values, see plp_stft_instance_f32
+ */
+typedef struct {
+    const plp_rfft_instance_q16 *pRfft;
+    const int16_t *pWindow;
+    uint16_t hopLen;
+    uint16_t statePos;
+    int16_t *pState;
+} plp_stft_instance_q16;
+
+/**
+ * @brief Instance structure for the parallel floating-point STFT function.
+ * @param[in,out] S           points to an instance of the floating-point STFT structure
+ * @param[in]     pSrc        points to the input buffer of numFrames*hopLen samples
+ * @param[in]     numFrames   number of frames
+ * @param[in]     nPE         number of parallel processing units
+ * @param[in]     pBuf        points to a temporary buffer of nPE*N values
+ * @param[out]    pDst        points to the output buffer of numFrames*(N/2+1) values
+ */
+typedef struct {
+    plp_stft_instance_f32 *S;
+    const float32_t *pSrc;
+    uint32_t numFrames;
     uint32_t nPE;
-    int32_t *__restrict__ pDst;
-} plp_mat_scale_instance_i32;
+    float32_t *pBuf;
+    float32_t *pDst;
+} plp_stft_parallel_arg_f32;
 
-/** -------------------------------------------------------
- * @brief Instance structure for floating-point parallel matrix scale.
+/**
+ * @brief Instance structure for the parallel 16 bit fixed-point STFT function.
+ * @param[in,out] S           points to an instance of the 16 bit fixed-point STFT structure
+ * @param[in]     pSrc        points to the input buffer of numFrames*hopLen samples
+ * @param[in]     numFrames   number of frames
+ * @param[in]     deciPoint   decimal point for right shift
+ * @param[in]     nPE         number of parallel processing units
+ * @param[in]     pBuf        points to a temporary buffer of nPE*N values
+ * @param[out]    pDst        points to the output buffer of numFrames*(N/2+1) values
  */
 typedef struct {
-    const float *__restrict__ pSrc;
-    uint32_t M;
-    uint32_t N;
-    float scaleFactor;
+    plp_stft_instance_q16 *S;
+    const int16_t *pSrc;
+    uint32_t numFrames;
+    uint32_t deciPoint;
     uint32_t nPE;
-    float *__restrict__ pDst;
-} plp_mat_scale_instance_f32;
+    int16_t *pBuf;
+    int32_t *pDst;
+} plp_stft_parallel_arg_q16;
 
-/** -------------------------------------------------------
- * @brief Instance structure for integer parallel matrix transpose.
+/**
+ * @brief Instance structure for the floating-point MFCC function.
+ * @param[in]  numBands    number of mel bands
+ * @param[in]  numCoeffs   number of cepstral coefficients, numCoeffs <= numBands
+ * @param[in]  pBandStart  points to the first FFT bin of each band
+ * @param[in]  pBandEnd    points to the last FFT bin of each band
+ * @param[in]  pWeights    points to the nonzero weights of the triangular bands, band by band
+ * @param[in]  pDct        points to the instance of the numBands point DCT-II. If NULL, the log-mel
+ *                         energies are written instead of the cepstral coefficients.
  */
 typedef struct {
-    const int8_t *__restrict__ pSrc;
-    uint32_t M;
-    uint32_t N;
+    uint16_t numBands;
+    uint16_t numCoeffs;
+    const uint16_t *pBandStart;
+    const uint16_t *pBandEnd;
+    const float32_t *pWeights;
+    const plp_dct2_instance_f32 *pDct;
+} plp_mfcc_instance_f32;
+
+/**
+ * @brief Instance structure for the 16 bit fixed-point MFCC function.
+ * @param[in]  numBands    number of mel bands
+ * @param[in]  numCoeffs   number of cepstral coefficients, numCoeffs <= numBands
+ * @param[in]  pBandStart  points to the first FFT bin of each band
+ * @param[in]  pBandEnd    points to the last FFT bin of each band
+ * @param[in]  pWeights    points to the nonzero Q1.15 weights of the triangular bands
+ * @param[in]  pDct        points to the instance of the numBands point DCT-II, or NULL for the
+ *                         log-mel energies
+ */
+typedef struct {
+    uint16_t numBands;
+    uint16_t numCoeffs;
+    const uint16_t *pBandStart;
+    const uint16_t *pBandEnd;
+    const int16_t *pWeights;
+    const plp_dct2_instance_q16 *pDct;
+} plp_mfcc_instance_q16;
+
+/**
+ * @brief Instance structure for the parallel floating-point MFCC function.
+ * @param[in]     S           points to an instance of the floating-point MFCC structure
+ * @param[in,out] pStft       points to an instance of the floating-point STFT structure
+ * @param[in]     pSrc        points to the input buffer of numFrames*hopLen samples
+ * @param[in]     numFrames   number of frames
+ * @param[in]     nPE         number of parallel processing units
+ * @param[in]     pBuf        points to a temporary buffer of nPE*(2N+2+3*numBands) values
+ * @param[out]    pDst        points to the output buffer of numFrames*numCoeffs values
+ */
+typedef struct {
+    const plp_mfcc_instance_f32 *S;
+    plp_stft_instance_f32 *pStft;
+    const float32_t *pSrc;
+    uint32_t numFrames;
     uint32_t nPE;
-    int8_t *__restrict__ pDst;
-} plp_mat_trans_instance_i8;
+    float32_t *pBuf;
+    float32_t *pDst;
+} plp_mfcc_parallel_arg_f32;
 
-/** -------------------------------------------------------
- * @brief Instance structure for integer parallel matrix transpose.
+/**
+ * @brief Instance structure for the parallel 16 bit fixed-point MFCC function.
+ * @param[in]     S           points to an instance of the 16 bit fixed-point MFCC structure
+ * @param[in,out] pStft       points to an instance of the 16 bit fixed-point STFT structure
+ * @param[in]     pSrc        points to the input buffer of numFrames*hopLen samples
+ * @param[in]     numFrames   number of frames
+ * @param[in]     deciPoint   decimal point for right shift
+ * @param[in]     nPE         number of parallel processing units
+ * @param[in]     pBuf        points to a temporary buffer of nPE*(2N+2+3*numBands) values
+ * @param[out]    pDst        points to the output buffer of numFrames*numCoeffs values
  */
 typedef struct {
-    const int16_t *__restrict__ pSrc;
-    uint32_t M;
-    uint32_t N;
+    const plp_mfcc_instance_q16 *S;
+    plp_stft_instance_q16 *pStft;
+    const int16_t *pSrc;
+    uint32_t numFrames;
+    uint32_t deciPoint;
     uint32_t nPE;
-    int16_t *__restrict__ pDst;
-} plp_mat_trans_instance_i16;
+    int16_t *pBuf;
+    int16_t *pDst;
+} plp_mfcc_parallel_arg_q16;
 
-/** -------------------------------------------------------
- * @brief Instance structure for integer parallel matrix transpose.
+/**
+ * @brief Instance structure for the floating-point Welch PSD and CSD functions.
+ * @param[in]  pRfft       points to the instance of the real FFT, its length is the frame length N
+ * @param[in]  pWindow     points to the analysis window of N values
+ * @param[in]  hopLen      distance of the frames, i.e. N minus the overlap
+ * @param[in]  scale       factor of the averaged spectra, plp_welch_init_f32 sets it to
+ *                         1/sum(w[n]^2). Multiply with 1/fs for a density in units^2/Hz.
  */
 typedef struct {
-    const int32_t *__restrict__ pSrc;
-    uint32_t M;
-    uint32_t N;
+    const plp_rfft_instance_f32 *pRfft;
+    const float32_t *pWindow;
+    uint16_t hopLen;
+    float32_t scale;
+} plp_welch_instance_f32;
+
+/**
+ * @brief Instance structure for the 16 bit fixed-point Welch PSD and CSD functions.
+ * @param[in]  pRfft       points to the instance of the real FFT, its length is the frame length N
+ * @param[in]  pWindow     points to the analysis window of N values in Q1.15
+ * @param[in]  hopLen      distance of the frames, i.e. N minus the overlap
+ */
+typedef struct {
+    const plp_rfft_instance_q16 *pRfft;
+    const int16_t *pWindow;
+    uint16_t hopLen;
+} plp_welch_instance_q16;
+
+/**
+ * @brief Instance structure for the parallel floating-point Welch PSD function.
+ * @param[in]     S           points to an instance of the floating-point Welch structure
+ * @param[in]     pSrc        points to the input buffer of (numFrames-1)*hopLen+N values
+ * @param[in]     numFrames   number of averaged frames
+ * @param[in]     nPE         number of parallel processing units
+ * @param[in]     pBuf        points to a temporary buffer of nPE*N + (nPE-1)*(N/2+1) values
+ * @param[out]    pDst        points to the output buffer of N/2+1 values
+ */
+typedef struct {
+    const plp_welch_instance_f32 *S;
+    const float32_t *pSrc;
+    uint32_t numFrames;
     uint32_t nPE;
-    int32_t *__restrict__ pDst;
-} plp_mat_trans_instance_i32;
+    float32_t *pBuf;
+    float32_t *pDst;
+} plp_psd_welch_parallel_arg_f32;
 
-/** -------------------------------------------------------
- * @brief Instance structure for integer parallel identity matrix creation.
+/**
+ * @brief Instance structure for the parallel floating-point Welch CSD function.
+ * @param[in]     S           points to an instance of the floating-point Welch structure
+ * @param[in]     pSrcA       points to the first input buffer
+ * @param[in]     pSrcB       points to the second input buffer
+ * @param[in]     numFrames   number of averaged frames
+ * @param[in]     nPE         number of parallel processing units
+ * @param[in]     pBuf        points to a temporary buffer of 2*nPE*N + (nPE-1)*(N+2) values
+ * @param[out]    pDst        points to the output buffer of N/2+1 complex values
  */
 typedef struct {
-    uint32_t N;
+    const plp_welch_instance_f32 *S;
+    const float32_t *pSrcA;
+    const float32_t *pSrcB;
+    uint32_t numFrames;
     uint32_t nPE;
-    int8_t *__restrict__ pDst;
-} plp_mat_fill_I_instance_i8;
+    float32_t *pBuf;
+    float32_t *pDst;
+} plp_csd_welch_parallel_arg_f32;
 
-/** -------------------------------------------------------
- * @brief Instance structure for integer parallel identity matrix creation.
+/**
+ * @brief Instance structure for the parallel 16 bit fixed-point Welch PSD function.
+ * @param[in]     S           points to an instance of the 16 bit fixed-point Welch structure
+ * @param[in]     pSrc        points to the input buffer of (numFrames-1)*hopLen+N values
+ * @param[in]     numFrames   number of averaged frames
+ * @param[in]     deciPoint   decimal point for right shift
+ * @param[in]     nPE         number of parallel processing units
+ * @param[in]     pBuf        points to a temporary buffer of nPE*N + (nPE-1)*(N+2) values
+ * @param[out]    pDst        points to the output buffer of N/2+1 values
  */
 typedef struct {
-    uint32_t N;
+    const plp_welch_instance_q16 *S;
+    const int16_t *pSrc;
+    uint32_t numFrames;
+    uint32_t deciPoint;
     uint32_t nPE;
-    int16_t *__restrict__ pDst;
-} plp_mat_fill_I_instance_i16;
+    int16_t *pBuf;
+    int32_t *pDst;
+} plp_psd_welch_parallel_arg_q16;
 
-/** -------------------------------------------------------
- * @brief Instance structure for integer parallel identity matrix creation.
+/**
+ * @brief Instance structure for the parallel 16 bit fixed-point Welch CSD function.
+ * @param[in]     S           points to an instance of the 16 bit fixed-point Welch structure
+ * @param[in]     pSrcA       points to the first input buffer
+ * @param[in]     pSrcB       points to the second input buffer
+ * @param[in]     numFrames   number of averaged frames
+ * @param[in]     deciPoint   decimal point for right shift
+ * @param[in]     nPE         number of parallel processing units
+ * @param[in]     pBuf        points to a temporary buffer of 2*nPE*N + 2*(nPE-1)*(N+2) values
+ * @param[out]    pDst        points to the output buffer of N/2+1 complex values
  */
 typedef struct {
-    uint32_t N;
+    const plp_welch_instance_q16 *S;
+    const int16_t *pSrcA;
+    const int16_t *pSrcB;
+    uint32_t numFrames;
+    uint32_t deciPoint;
     uint32_t nPE;
-    int32_t *__restrict__ pDst;
-} plp_mat_fill_I_instance_i32;
+    int16_t *pBuf;
+    int32_t *pDst;
+} plp_csd_welch_parallel_arg_q16;
 
-/** -------------------------------------------------------
- * @brief Instance structure for floating-point parallel identity matrix creation.
+/**
+ * @brief Instance structure for the parallel 16 bit fixed-point batched CFFT function.
+ * @param[in]     S                points to an instance of the 16bit quantized CFFT structure
+ * @param[in,out] pSrc             points to the complex data of all transforms
+ * @param[in]     numTransforms    number of transforms
+ * @param[in]     transformStride  distance in complex values between two transforms
+ * @param[in]     sampleStride     distance in complex values between two samples of a transform
+ * @param[in]     ifftFlag         flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ * @param[in]     bitReverseFlag   flag that enables (bitReverseFlag=1) bit reversal of output
+ * @param[in]     deciPoint        decimal point for right shift
+ * @param[in]     nPE              number of parallel processing units
+ * @param[in]     pBuf             points to a temporary buffer of 2*nPE*fftLen values
  */
 typedef struct {
-    uint32_t N;
+    const plp_cfft_instance_q16 *S;
+    int16_t *pSrc;
+    uint32_t numTransforms;
+    uint32_t transformStride;
+    uint32_t sampleStride;
+    uint8_t ifftFlag;
+    uint8_t bitReverseFlag;
+    uint32_t deciPoint;
     uint32_t nPE;
-    float *__restrict__ pDst;
-} plp_mat_fill_I_instance_f32;
+    int16_t *pBuf;
+} plp_cfft_batch_parallel_arg_q16;
 
-/** -------------------------------------------------------
- * @brief Instance structure for fix-point parallel identity matrix creation.
+/**
+ * @brief Instance structure for the parallel floating-point batched CFFT function.
+ * @param[in]     S                points to an instance of the floating-point mixed-radix CFFT
+ *                                 structure
+ * @param[in]     pSrc             points to the input data of all transforms
+ * @param[in]     numTransforms    number of transforms
+ * @param[in]     transformStride  distance in complex values between two transforms
+ * @param[in]     sampleStride     distance in complex values between two samples of a transform
+ * @param[in]     nPE              number of parallel processing units
+ * @param[in]     pBuf             points to a temporary buffer of 4*nPE*fftLen values
+ * @param[out]    pDst             points to the output data of all transforms, may be pSrc
  */
 typedef struct {
-    uint32_t N;
-    int32_t fracBits;
+    const plp_cfft_mixed_instance_f32 *S;
+    const float32_t *pSrc;
+    uint32_t numTransforms;
+    uint32_t transformStride;
+    uint32_t sampleStride;
     uint32_t nPE;
-    int8_t *__restrict__ pDst;
-} plp_mat_fill_I_instance_q8;
+    float32_t *pBuf;
+    float32_t *pDst;
+} plp_cfft_batch_parallel_arg_f32;
 
-/** -------------------------------------------------------
- * @brief Instance structure for fix-point parallel identity matrix creation.
+/**
+ * @brief Instance structure for the parallel 16 bit fixed-point 2D CFFT function.
+ * @param[in]     SRows       points to the CFFT instance of the rows, of length numCols
+ * @param[in]     SCols       points to the CFFT instance of the columns, of length numRows
+ * @param[in,out] pSrc        points to the numRows x numCols complex matrix
+ * @param[in]     deciPoint   decimal point for right shift
+ * @param[in]     nPE         number of parallel processing units
+ * @param[in]     pBuf        points to a temporary buffer of 2*numRows*numCols values
  */
 typedef struct {
-    uint32_t N;
-    uint32_t fracBits;
+    const plp_cfft_instance_q16 *SRows;
+    const plp_cfft_instance_q16 *SCols;
+    int16_t *pSrc;
+    uint32_t deciPoint;
     uint32_t nPE;
-    int16_t *__restrict__ pDst;
-} plp_mat_fill_I_instance_q16;
+    int16_t *pBuf;
+} plp_cfft2d_parallel_arg_q16;
 
-/** -------------------------------------------------------
- * @brief Instance structure for fix-point parallel identity matrix creation.
+/**
+ * @brief Instance structure for the parallel floating-point 2D CFFT function.
+ * @param[in]     SRows       points to the mixed-radix CFFT instance of the rows, of length
+ *                            numCols
+ * @param[in]     SCols       points to the mixed-radix CFFT instance of the columns, of length
+ *                            numRows
+ * @param[in]     pSrc        points to the numRows x numCols complex input matrix
+ * @param[in]     nPE         number of parallel processing units
+ * @param[in]     pBuf        points to a temporary buffer of 2*numRows*numCols values
+ * @param[out]    pDst        points to the numRows x numCols complex output matrix
  */
 typedef struct {
-    uint32_t N;
-    uint32_t fracBits;
+    const plp_cfft_mixed_instance_f32 *SRows;
+    const plp_cfft_mixed_instance_f32 *SCols;
+    const float32_t *pSrc;
     uint32_t nPE;
-    int32_t *__restrict__ pDst;
-} plp_mat_fill_I_instance_q32;
+    float32_t *pBuf;
+    float32_t *pDst;
+} plp_cfft2d_parallel_arg_f32;
+
+/**
+ * @brief Step of a chain executed by plp_team_run.
+ * @param[in]     kernel      per-core entry point, e.g. plp_mat_add_f32p_xpulpv2. Every core of
+ *                            the team calls it with args, like after rt_team_fork.
+ * @param[in]     args        points to the argument structure of the kernel. Its nPE must be equal
+ *                            to the number of cores of the team.
+ * @param[in]     masterOnly  if set, only core 0 calls the kernel, e.g. for the serial reduction
+ *                            which the glue code does after the fork. The kernel must not call
+ *                            rt_team_barrier.
+ */
+typedef struct {
+    void (*kernel)(void *args);
+    void *args;
+    uint8_t masterOnly;
+} plp_team_step;
+
+/**
+ * @brief Arguments of the persistent team, executed by plp_team_run_xpulpv2.
+ * @param[in]     pSteps    points to the chain of numSteps steps
+ * @param[in]     numSteps  number of steps
+ * @param[in]     nPE       number of parallel processing units
+ */
+typedef struct {
+    const plp_team_step *pSteps;
+    uint32_t numSteps;
+    uint32_t nPE;
+} plp_team_instance;
+
+#define PLP_SCRATCH_ALIGNMENT 4U
+#define PLP_SCRATCH_ALIGN(size)                                                                    \
+    (((size) + PLP_SCRATCH_ALIGNMENT - 1U) & ~(PLP_SCRATCH_ALIGNMENT - 1U))
+
+/**
+ * @brief Scratch arena for the temporary buffers of the glue code.
+ * @param[in]     pBase  points to the caller-provided buffer
+ * @param[in]     size   size of the buffer in bytes
+ * @param[in,out] used   number of bytes in use, the top of the stack
+ * @param[out]    peak   largest number of bytes in use since plp_scratch_init
+ */
+typedef struct {
+    uint8_t *pBase;
+    uint32_t size;
+    uint32_t used;
+    uint32_t peak;
+} plp_scratch_instance;
+
+#define PLP_STREAM_MAP 0U
+#define PLP_STREAM_REDUCE 1U
+#define PLP_STREAM_WINDOW 2U
+#define PLP_STREAM_PARTIAL_SIZE 16U
+
+/**
+ * @brief Operation applied by plp_stream to each tile of the signal.
+ * @param[in]     kernel   computes len results of a tile on one core. For PLP_STREAM_MAP, the
+ *                         element i of pDst is computed from the element i of pSrcA and pSrcB.
+ *                         For PLP_STREAM_WINDOW, it is computed from the elements i to i + halo
+ *                         of pSrcA. For PLP_STREAM_REDUCE, pDst is the partial result of the
+ *                         len elements. pSrcB is NULL for unary operations.
+ * @param[in]     combine  folds the partial result pPartial into pRes, only for PLP_STREAM_REDUCE
+ * @param[in]     kind     PLP_STREAM_MAP, PLP_STREAM_REDUCE or PLP_STREAM_WINDOW
+ * @param[in]     srcSize  size of an input element in bytes
+ * @param[in]     dstSize  size of an output element in bytes, or of the result of a reduction
+ *                         (at most 8 bytes)
+ */
+typedef struct {
+    void (*kernel)(
+        const void *pSrcA, const void *pSrcB, uint32_t len, void *pDst, const void *args);
+    void (*combine)(void *pRes, const void *pPartial);
+    uint8_t kind;
+    uint8_t srcSize;
+    uint8_t dstSize;
+} plp_stream_op;
+
+/**
+ * @brief Streaming of a signal in L2 through L1 tiles, executed by plp_stream.
+ * @param[in]     pOp      points to the operation, e.g. &plp_stream_add_i16
+ * @param[in]     args     points to the arguments of the operation, passed to the kernel
+ * @param[in]     pSrcA    points to the first input signal in L2
+ * @param[in]     pSrcB    points to the second input signal in L2, NULL for unary operations
+ * @param[in]     srcLen   number of elements of the input signals
+ * @param[in]     halo     number of input elements by which consecutive tiles overlap, only for
+ *                         PLP_STREAM_WINDOW. The output has srcLen - halo elements.
+ * @param[in]     tileLen  number of output elements per tile, or input elements per tile for
+ *                         PLP_STREAM_REDUCE
+ * @param[out]    pDst     points to the output signal in L2, or to the result of a reduction
+ */
+typedef struct {
+    const plp_stream_op *pOp;
+    const void *args;
+    const void *pSrcA;
+    const void *pSrcB;
+    uint32_t srcLen;
+    uint32_t halo;
+    uint32_t tileLen;
+    void *pDst;
+} plp_stream_instance;
+
+/**
+ * @brief Arguments of the streaming team, executed by plp_stream_xpulpv2.
+ * @param[in]     S         points to the streaming instance
+ * @param[in]     nPE       number of parallel processing units
+ * @param[in]     pInA      ping-pong buffers in L1 for the tiles of pSrcA
+ * @param[in]     pInB      ping-pong buffers in L1 for the tiles of pSrcB
+ * @param[in]     pOut      ping-pong buffers in L1 for the output tiles
+ * @param[in]     pPartial  partial results of the cores for PLP_STREAM_REDUCE,
+ *                          PLP_STREAM_PARTIAL_SIZE bytes per core
+ */
+typedef struct {
+    const plp_stream_instance *S;
+    uint32_t nPE;
+    uint8_t *pInA[2];
+    uint8_t *pInB[2];
+    uint8_t *pOut[2];
+    uint8_t *pPartial;
+} plp_stream_arg;
+
+/**
+ * @brief Arguments of the PLP_STREAM_WINDOW convolution operations, e.g. plp_stream_conv_valid_i16.
+ * @param[in]     pCoeffs    points to the filter coefficients, preferably in L1
+ * @param[in]     numCoeffs  number of coefficients, at least 2. The halo is numCoeffs - 1.
+ */
+typedef struct {
+    const void *pCoeffs;
+    uint32_t numCoeffs;
+} plp_stream_conv_args;
+
+#define PLP_GRAPH_MAX_BUFFERS 32U
+#define PLP_GRAPH_NONE 0xFFU
+#define PLP_GRAPH_UNPLANNED 0xFFFFFFFFU
+#define PLP_GRAPH_FUSE_BLOCK 64U
+
+/**
+ * @brief Buffer of a processing graph, the edge between the node which writes it and the nodes
+ *        which read it.
+ * @param[in]     size    size in bytes
+ * @param[in]     pData   points to an external buffer, e.g. the input or the output of the graph.
+ *                        NULL for an intermediate buffer, which plp_graph_run places in L1.
+ * @param[out]    offset  offset of an intermediate buffer in the planned L1 region, set by
+ *                        plp_graph_plan. PLP_GRAPH_UNPLANNED for external and fused buffers.
+ */
+typedef struct {
+    uint32_t size;
+    void *pData;
+    uint32_t offset;
+} plp_graph_buffer;
+
+/**
+ * @brief Node of a processing graph, a call of a library function.
+ * @param[in]     pOp         PLP_STREAM_MAP or PLP_STREAM_REDUCE operation on len elements, e.g.
+ *                            &plp_stream_abs_i16. NULL for a kernel node.
+ * @param[in]     kernel      per-core entry point of a kernel node, e.g. plp_cfft_q16p_xpulpv2,
+ *                            called like a step of plp_team_run. Its nPE must be the one of the
+ *                            graph.
+ * @param[in]     bind        writes the addresses of the buffers srcA, srcB and dst into args
+ *                            before the fork, only for kernel nodes. NULL if args does not
+ *                            reference intermediate buffers.
+ * @param[in]     args        arguments of the operation or of the kernel
+ * @param[in]     len         number of elements, only for operation nodes
+ * @param[in]     srcA        index of the first input buffer
+ * @param[in]     srcB        index of the second input buffer, PLP_GRAPH_NONE if unused
+ * @param[in]     dst         index of the output buffer, PLP_GRAPH_NONE if unused
+ * @param[in]     masterOnly  only core 0 calls the kernel, see plp_team_step
+ * @param[out]    fused       set by plp_graph_plan if the output is passed to the next node block
+ *                            by block instead of being written to dst
+ */
+typedef struct {
+    const plp_stream_op *pOp;
+    void (*kernel)(void *args);
+    void (*bind)(void *args, void *pSrcA, void *pSrcB, void *pDst);
+    void *args;
+    uint32_t len;
+    uint8_t srcA;
+    uint8_t srcB;
+    uint8_t dst;
+    uint8_t masterOnly;
+    uint8_t fused;
+} plp_graph_node;
+
+/**
+ * @brief Processing graph, executed by plp_graph_run.
+ * @param[in]     pNodes      points to the nodes, in the order of execution
+ * @param[in]     numNodes    number of nodes
+ * @param[in]     pBuffers    points to the buffers
+ * @param[in]     numBuffers  number of buffers, at most PLP_GRAPH_MAX_BUFFERS
+ * @param[in]     fuse        if set, plp_graph_plan fuses chains of operation nodes. If not, every
+ *                            node is executed like a call of the library function.
+ * @param[out]    footprint   size of the planned L1 region in bytes, set by plp_graph_plan
+ */
+typedef struct {
+    plp_graph_node *pNodes;
+    uint32_t numNodes;
+    plp_graph_buffer *pBuffers;
+    uint32_t numBuffers;
+    uint8_t fuse;
+    uint32_t footprint;
+} plp_graph_instance;
+
+/**
+ * @brief Arguments of the graph team, executed by plp_graph_run_xpulpv2.
+ * @param[in]     G         points to the planned graph
+ * @param[in]     nPE       number of parallel processing units
+ * @param[in]     ppData    addresses of the buffers, NULL for fused buffers
+ * @param[in]     pBlocks   two blocks of PLP_GRAPH_FUSE_BLOCK elements per core for the fused
+ *                          chains, blockSize bytes per core
+ * @param[in]     blockSize size of the two blocks of a core in bytes
+ * @param[in]     pPartial  partial results of the cores for PLP_STREAM_REDUCE,
+ *                          PLP_STREAM_PARTIAL_SIZE bytes per core
+ */
+typedef struct {
+    const plp_graph_instance *G;
+    uint32_t nPE;
+    void *ppData[PLP_GRAPH_MAX_BUFFERS];
+    uint8_t *pBlocks;
+    uint32_t blockSize;
+    uint8_t *pPartial;
+} plp_graph_arg;
+
+/**
+ * @brief Frame descriptor of the FC/cluster pipeline.
+ * @param[in]     pData   points to the frame buffer, preferably in L2
+ * @param[out]    index   number of the frame, set by plp_pipeline_run
+ * @param[out]    tStart  time in us at which the FC stage started the frame
+ */
+typedef struct {
+    void *pData;
+    uint32_t index;
+    uint32_t tStart;
+} plp_pipeline_frame;
+
+/**
+ * @brief Statistics of the FC/cluster pipeline, times in us.
+ * @param[out]    numFrames    number of frames which passed both stages
+ * @param[out]    total        duration of the run
+ * @param[out]    busyFc       time spent in the FC stage
+ * @param[out]    busyCluster  time spent in the cluster stage
+ * @param[out]    latencySum   sum of the latencies of the frames, from the start of the FC stage to
+ *                             the end of the cluster stage
+ * @param[out]    latencyMin   minimum latency of a frame
+ * @param[out]    latencyMax   maximum latency of a frame
+ * @param[out]    fullWaits    number of frames for which the FC waited for a free descriptor
+ * @param[out]    emptyWaits   number of frames for which the cluster waited for the FC
+ */
+typedef struct {
+    uint32_t numFrames;
+    uint32_t total;
+    uint32_t busyFc;
+    uint32_t busyCluster;
+    uint32_t latencySum;
+    uint32_t latencyMin;
+    uint32_t latencyMax;
+    uint32_t fullWaits;
+    uint32_t emptyWaits;
+} plp_pipeline_stats;
+
+/**
+ * @brief Software pipeline of a stage on the FC and a stage on the cluster, executed by
+ *        plp_pipeline_run. The stages communicate through a bounded queue of frame descriptors.
+ * @param[in]     fcStage       computes a frame on the FC, e.g. with the rv32im kernels
+ * @param[in]     fcArgs        passed to fcStage
+ * @param[in]     clusterStage  computes a frame on the cluster, called by core 0 of the cluster.
+ *                              It can call the _parallel glue functions.
+ * @param[in]     clusterArgs   passed to clusterStage
+ * @param[in]     pFrames       points to the ring of depth frame descriptors, in L2
+ * @param[in]     depth         capacity of the queue, 2 for double buffering
+ * @param[in,out] head          number of frames finished by the cluster
+ * @param[in,out] tail          number of frames finished by the FC
+ * @param[out]    stats         statistics of the last run
+ */
+typedef struct {
+    void (*fcStage)(plp_pipeline_frame *pFrame, void *args);
+    void *fcArgs;
+    void (*clusterStage)(plp_pipeline_frame *pFrame, void *args);
+    void *clusterArgs;
+    plp_pipeline_frame *pFrames;
+    uint32_t depth;
+    volatile uint32_t head;
+    volatile uint32_t tail;
+    plp_pipeline_stats stats;
+} plp_pipeline_instance;
+
+/**
+ * @brief Arguments of the cluster stage of the pipeline, executed by plp_pipeline_xpulpv2.
+ * @param[in]     S          points to the pipeline
+ * @param[in]     numFrames  number of frames to compute
+ */
+typedef struct {
+    plp_pipeline_instance *S;
+    uint32_t numFrames;
+} plp_pipeline_arg;
+
+#define PLP_DISPATCH_CONV_I32 0U
+#define PLP_DISPATCH_CONV_I16 1U
+#define PLP_DISPATCH_CONV_I8 2U
+#define PLP_DISPATCH_DOT_PROD_I32 3U
+#define PLP_DISPATCH_DOT_PROD_Q32 4U
+#define PLP_DISPATCH_DOT_PROD_F32 5U
+#define PLP_DISPATCH_NUM_FUNCS 6U
+
+#define PLP_DISPATCH_DEFAULT 0U
+#define PLP_DISPATCH_OLA 1U
+#define PLP_DISPATCH_SEQUENTIAL 2U
+
+/**
+ * @brief Entry of a dispatch table, selected for the lengths up to maxLen. The entries of a table
+ *        are sorted by maxLen, the last entry is also used for longer lengths.
+ * @param[in]     maxLen   largest length for which the entry is selected
+ * @param[in]     nPE      number of cores to use, at most the nPE passed to the glue code
+ * @param[in]     variant  PLP_DISPATCH_DEFAULT, or the variant of the function, e.g.
+ *                         PLP_DISPATCH_OLA or PLP_DISPATCH_SEQUENTIAL for the convolution
+ */
+typedef struct {
+    uint32_t maxLen;
+    uint8_t nPE;
+    uint8_t variant;
+} plp_dispatch_entry;
+
+#ifndef PLP_PROFILE_NUM_ENTRIES
+#define PLP_PROFILE_NUM_ENTRIES 32U
+#endif
+#ifndef PLP_PROFILE_NUM_CORES
+#define PLP_PROFILE_NUM_CORES 8U
+#endif
+#ifndef PLP_PROFILE_EVENTS
+#define PLP_PROFILE_EVENTS                                                                         \
+    ((1 << RT_PERF_CYCLES) | (1 << RT_PERF_INSTR) | (1 << RT_PERF_LD_STALL) |                     \
+     (1 << RT_PERF_TCDM_CONT) | (1 << RT_PERF_IMISS))
+#endif
+
+/**
+ * @brief Profile of a glue function, declared by PLP_PROFILE_FUNC.
+ * @param[in]     name      name of the function
+ */
+typedef struct {
+    const char *name;
+} plp_profile_record;
+
+/**
+ * @brief Performance counters at the start of a call, taken by plp_profile_begin.
+ */
+typedef struct {
+    const plp_profile_record *pRecord;
+    uint32_t cycles;
+    uint32_t instr;
+    uint32_t ldStall;
+    uint32_t tcdmCont;
+    uint32_t imiss;
+} plp_profile_sample;
+
+plp_profile_sample plp_profile_begin(const plp_profile_record *pRecord);
+
+void plp_profile_end(plp_profile_sample *pSample);
+
+/**
+ * @brief First statement of a glue function. In a PLP_PROFILE build, the calls of the function
+ *        are recorded on every return path. Otherwise, it expands to nothing.
+ */
+#if defined(PLP_PROFILE)
+#define PLP_PROFILE_FUNC()                                                                         \
+    static const plp_profile_record plp_profile_record_ = { __func__ };                            \
+    plp_profile_sample plp_profile_sample_ __attribute__((cleanup(plp_profile_end))) =             \
+        plp_profile_begin(&plp_profile_record_)
+#else
+#define PLP_PROFILE_FUNC()                                                                         \
+    do {                                                                                           \
+    } while (0)
+#endif
+
+typedef struct {
+    float32_t re;
+    float32_t im;
+} Complex_type_f32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for strided integer parallel matrix multiplication.
+ * @brief Instance structure for integer parallel matrix multiplication.
  */
 typedef struct {
     const int8_t *__restrict__ pSrcA;
@@ -740,15 +1407,12 @@ typedef struct {
     uint32_t M;
     uint32_t N;
     uint32_t O;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideC;
     uint32_t nPE;
     int32_t *__restrict__ pDstC;
-} plp_mat_mult_stride_instance_i8;
+} plp_mat_mult_instance_i8;
 
 /** -------------------------------------------------------
- * @brief Instance structure for strided integer parallel matrix multiplication.
+ * @brief Instance structure for integer parallel matrix multiplication.
  */
 typedef struct {
     const int16_t *__restrict__ pSrcA;
@@ -756,15 +1420,12 @@ typedef struct {
     uint32_t M;
     uint32_t N;
     uint32_t O;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideC;
     uint32_t nPE;
     int32_t *__restrict__ pDstC;
-} plp_mat_mult_stride_instance_i16;
+} plp_mat_mult_instance_i16;
 
 /** -------------------------------------------------------
- * @brief Instance structure for strided integer parallel matrix multiplication.
+ * @brief Instance structure for integer parallel matrix multiplication.
  */
 typedef struct {
     const int32_t *__restrict__ pSrcA;
@@ -772,15 +1433,12 @@ typedef struct {
     uint32_t M;
     uint32_t N;
     uint32_t O;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideC;
     uint32_t nPE;
     int32_t *__restrict__ pDstC;
-} plp_mat_mult_stride_instance_i32;
+} plp_mat_mult_instance_i32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for strided floating-point parallel matrix multiplication.
+ * @brief Instance structure for floating-point parallel matrix multiplication.
  */
 typedef struct {
     const float *__restrict__ pSrcA;
@@ -788,15 +1446,12 @@ typedef struct {
     uint32_t M;
     uint32_t N;
     uint32_t O;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideC;
     uint32_t nPE;
     float *__restrict__ pDstC;
-} plp_mat_mult_stride_instance_f32;
+} plp_mat_mult_instance_f32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for strided 8-bit fix-point parallel matrix multiplication.
+ * @brief Instance structure for 8-bit fix-point parallel matrix multiplication.
  */
 typedef struct {
     const int8_t *__restrict__ pSrcA;
@@ -804,16 +1459,13 @@ typedef struct {
     uint32_t M;
     uint32_t N;
     uint32_t O;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideC;
     uint32_t shift;
     uint32_t nPE;
     int8_t *__restrict__ pDstC;
-} plp_mat_mult_stride_instance_q8;
+} plp_mat_mult_instance_q8;
 
 /** -------------------------------------------------------
- * @brief Instance structure for strided 16-bit fix-point parallel matrix multiplication.
+ * @brief Instance structure for 16-bit fix-point parallel matrix multiplication.
  */
 typedef struct {
     const int16_t *__restrict__ pSrcA;
@@ -821,16 +1473,13 @@ typedef struct {
     uint32_t M;
     uint32_t N;
     uint32_t O;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideC;
     uint32_t shift;
     uint32_t nPE;
     int16_t *__restrict__ pDstC;
-} plp_mat_mult_stride_instance_q16;
+} plp_mat_mult_instance_q16;
 
 /** -------------------------------------------------------
- * @brief Instance structure for strided 32-bit fix-point parallel matrix multiplication.
+ * @brief Instance structure for 32-bit fix-point parallel matrix multiplication.
  */
 typedef struct {
     const int32_t *__restrict__ pSrcA;
@@ -838,16 +1487,13 @@ typedef struct {
     uint32_t M;
     uint32_t N;
     uint32_t O;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideC;
     uint32_t shift;
     uint32_t nPE;
     int32_t *__restrict__ pDstC;
-} plp_mat_mult_stride_instance_q32;
+} plp_mat_mult_instance_q32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel complex strided matrix matrix multiplication.
+ * @brief Instance structure for integer parallel complex matrix matrix multiplication.
  */
 typedef struct {
     const int8_t *__restrict__ pSrcA;
@@ -855,15 +1501,12 @@ typedef struct {
     uint32_t M;
     uint32_t N;
     uint32_t O;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideC;
     uint32_t nPE;
     int32_t *__restrict__ pDstC;
-} plp_mat_mult_cmplx_stride_instance_i8;
+} plp_mat_mult_cmplx_instance_i8;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel complex strided matrix matrix multiplication.
+ * @brief Instance structure for integer parallel complex matrix matrix multiplication.
  */
 typedef struct {
     const int16_t *__restrict__ pSrcA;
@@ -871,15 +1514,12 @@ typedef struct {
     uint32_t M;
     uint32_t N;
     uint32_t O;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideC;
     uint32_t nPE;
     int32_t *__restrict__ pDstC;
-} plp_mat_mult_cmplx_stride_instance_i16;
+} plp_mat_mult_cmplx_instance_i16;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel complex strided matrix matrix multiplication.
+ * @brief Instance structure for integer parallel complex matrix matrix multiplication.
  */
 typedef struct {
     const int32_t *__restrict__ pSrcA;
@@ -887,16 +1527,12 @@ typedef struct {
     uint32_t M;
     uint32_t N;
     uint32_t O;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideC;
     uint32_t nPE;
     int32_t *__restrict__ pDstC;
-} plp_mat_mult_cmplx_stride_instance_i32;
+} plp_mat_mult_cmplx_instance_i32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for floating-point parallel complex strided matrix matrix
- * multiplication.
+ * @brief Instance structure for floating-point parallel complex matrix matrix multiplication.
  */
 typedef struct {
     const float *__restrict__ pSrcA;
@@ -904,16 +1540,12 @@ typedef struct {
     uint32_t M;
     uint32_t N;
     uint32_t O;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideC;
     uint32_t nPE;
     float *__restrict__ pDstC;
-} plp_mat_mult_cmplx_stride_instance_f32;
+} plp_mat_mult_cmplx_instance_f32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for 8-bit fix-point parallel complex strided matrix matrix
- * multiplication.
+ * @brief Instance structure for 8-bit fix-point parallel complex matrix matrix multiplication.
  */
 typedef struct {
     const int8_t *__restrict__ pSrcA;
@@ -921,17 +1553,13 @@ typedef struct {
     uint32_t M;
     uint32_t N;
     uint32_t O;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideC;
     uint32_t shift;
     uint32_t nPE;
     int8_t *__restrict__ pDstC;
-} plp_mat_mult_cmplx_stride_instance_q8;
+} plp_mat_mult_cmplx_instance_q8;
 
 /** -------------------------------------------------------
- * @brief Instance structure for 16-bit fix-point parallel complex strided matrix matrix
- * multiplication.
+ * @brief Instance structure for 16-bit fix-point parallel complex matrix matrix multiplication.
  */
 typedef struct {
     const int16_t *__restrict__ pSrcA;
@@ -939,17 +1567,13 @@ typedef struct {
     uint32_t M;
     uint32_t N;
     uint32_t O;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideC;
     uint32_t shift;
     uint32_t nPE;
     int16_t *__restrict__ pDstC;
-} plp_mat_mult_cmplx_stride_instance_q16;
+} plp_mat_mult_cmplx_instance_q16;
 
 /** -------------------------------------------------------
- * @brief Instance structure for 32-bit fix-point parallel complex strided matrix matrix
- * multiplication.
+ * @brief Instance structure for 32-bit fix-point parallel complex matrix matrix multiplication.
  */
 typedef struct {
     const int32_t *__restrict__ pSrcA;
@@ -957,6141 +1581,12524 @@ typedef struct {
     uint32_t M;
     uint32_t N;
     uint32_t O;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideC;
     uint32_t shift;
     uint32_t nPE;
     int32_t *__restrict__ pDstC;
-} plp_mat_mult_cmplx_stride_instance_q32;
+} plp_mat_mult_cmplx_instance_q32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for strided integer parallel matrix addition.
+ * @brief Sparse 8-bit integer matrix of shape MxN in compressed sparse row (CSR) format. The
+ * nonzero values of row m are pValues[pRowPtr[m]] to pValues[pRowPtr[m + 1] - 1], and pColIdx holds
+ * their columns.
  */
 typedef struct {
-    const int8_t *__restrict__ pSrcA;
-    const int8_t *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideY;
-    uint32_t nPE;
-    int8_t *__restrict__ pDst;
-} plp_mat_add_stride_instance_i8;
+    uint32_t M;              // number of rows
+    uint32_t N;              // number of columns
+    const int8_t *pValues;   // nonzero values, row by row
+    const uint16_t *pColIdx; // column of every nonzero value
+    const uint32_t *pRowPtr; // index of the first nonzero value of every row, M + 1 entries
+} plp_spmat_csr_i8;
 
 /** -------------------------------------------------------
- * @brief Instance structure for strided integer parallel matrix addition.
+ * @brief Sparse 16-bit integer matrix of shape MxN in compressed sparse row (CSR) format. The
+ * nonzero values of row m are pValues[pRowPtr[m]] to pValues[pRowPtr[m + 1] - 1], and pColIdx holds
+ * their columns.
  */
 typedef struct {
-    const int16_t *__restrict__ pSrcA;
-    const int16_t *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideY;
+    uint32_t M;              // number of rows
+    uint32_t N;              // number of columns
+    const int16_t *pValues;  // nonzero values, row by row
+    const uint16_t *pColIdx; // column of every nonzero value
+    const uint32_t *pRowPtr; // index of the first nonzero value of every row, M + 1 entries
+} plp_spmat_csr_i16;
+
+/** -------------------------------------------------------
+ * @brief Sparse 32-bit floating-point matrix of shape MxN in compressed sparse row (CSR) format.
+ * The nonzero values of row m are pValues[pRowPtr[m]] to pValues[pRowPtr[m + 1] - 1], and pColIdx
+ * holds their columns.
+ */
+typedef struct {
+    uint32_t M;              // number of rows
+    uint32_t N;              // number of columns
+    const float *pValues;    // nonzero values, row by row
+    const uint16_t *pColIdx; // column of every nonzero value
+    const uint32_t *pRowPtr; // index of the first nonzero value of every row, M + 1 entries
+} plp_spmat_csr_f32;
+
+/** -------------------------------------------------------
+ * @brief Sparse 8-bit integer matrix of shape MxN in block compressed sparse row (BCSR) format. The
+ * matrix is split into blocks of blkRows x 4 elements, and only the blocks with a nonzero value are
+ * stored. Block b holds the blkRows * 4 values from pValues[b * blkRows * 4] on, row by row. The
+ * blocks of block row r are pRowPtr[r] to pRowPtr[r + 1] - 1.
+ */
+typedef struct {
+    uint32_t M;              // number of rows, a multiple of blkRows
+    uint32_t N;              // number of columns, a multiple of 4
+    uint32_t blkRows;        // number of rows of a block, 1 or 4
+    const int8_t *pValues;   // values of the blocks, block by block
+    const uint16_t *pColIdx; // block column (first column / 4) of every block
+    const uint32_t *pRowPtr; // index of the first block of every block row, M / blkRows + 1 entries
+} plp_spmat_bcsr_i8;
+
+/** -------------------------------------------------------
+ * @brief Sparse 16-bit integer matrix of shape MxN in block compressed sparse row (BCSR) format.
+ * The matrix is split into blocks of blkRows x 4 elements, and only the blocks with a nonzero value
+ * are stored. Block b holds the blkRows * 4 values from pValues[b * blkRows * 4] on, row by row.
+ * The blocks of block row r are pRowPtr[r] to pRowPtr[r + 1] - 1.
+ */
+typedef struct {
+    uint32_t M;              // number of rows, a multiple of blkRows
+    uint32_t N;              // number of columns, a multiple of 4
+    uint32_t blkRows;        // number of rows of a block, 1 or 4
+    const int16_t *pValues;  // values of the blocks, block by block
+    const uint16_t *pColIdx; // block column (first column / 4) of every block
+    const uint32_t *pRowPtr; // index of the first block of every block row, M / blkRows + 1 entries
+} plp_spmat_bcsr_i16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for the parallel products of a sparse 8-bit integer matrix in CSR
+ * format with a dense vector (O = 1) or matrix.
+ */
+typedef struct {
+    const plp_spmat_csr_i8 *pSrcA;
+    const int8_t *__restrict__ pSrcB;
+    uint32_t O;
     uint32_t nPE;
-    int16_t *__restrict__ pDst;
-} plp_mat_add_stride_instance_i16;
+    int32_t *__restrict__ pDstC;
+} plp_spmat_csr_mult_instance_i8;
 
 /** -------------------------------------------------------
- * @brief Instance structure for strided integer parallel matrix addition.
+ * @brief Instance structure for the parallel products of a sparse 16-bit integer matrix in CSR
+ * format with a dense vector (O = 1) or matrix.
  */
 typedef struct {
-    const int32_t *__restrict__ pSrcA;
-    const int32_t *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideY;
+    const plp_spmat_csr_i16 *pSrcA;
+    const int16_t *__restrict__ pSrcB;
+    uint32_t O;
     uint32_t nPE;
-    int32_t *__restrict__ pDst;
-} plp_mat_add_stride_instance_i32;
+    int32_t *__restrict__ pDstC;
+} plp_spmat_csr_mult_instance_i16;
 
 /** -------------------------------------------------------
- * @brief Instance structure for strided floating-point parallel matrix addition.
+ * @brief Instance structure for the parallel products of a sparse 32-bit floating-point matrix in
+ * CSR format with a dense vector (O = 1) or matrix.
  */
 typedef struct {
-    const float *__restrict__ pSrcA;
+    const plp_spmat_csr_f32 *pSrcA;
     const float *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideY;
+    uint32_t O;
     uint32_t nPE;
-    float *__restrict__ pDst;
-} plp_mat_add_stride_instance_f32;
+    float *__restrict__ pDstC;
+} plp_spmat_csr_mult_instance_f32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for strided integer parallel matrix subtraction.
+ * @brief Instance structure for the parallel products of a sparse 8-bit integer matrix in BCSR
+ * format with a dense vector (O = 1) or matrix.
  */
 typedef struct {
-    const int8_t *__restrict__ pSrcA;
+    const plp_spmat_bcsr_i8 *pSrcA;
     const int8_t *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideY;
+    uint32_t O;
     uint32_t nPE;
-    int8_t *__restrict__ pDst;
-} plp_mat_sub_stride_instance_i8;
+    int32_t *__restrict__ pDstC;
+} plp_spmat_bcsr_mult_instance_i8;
 
 /** -------------------------------------------------------
- * @brief Instance structure for strided integer parallel matrix subtraction.
+ * @brief Instance structure for the parallel products of a sparse 16-bit integer matrix in BCSR
+ * format with a dense vector (O = 1) or matrix.
  */
 typedef struct {
-    const int16_t *__restrict__ pSrcA;
+    const plp_spmat_bcsr_i16 *pSrcA;
     const int16_t *__restrict__ pSrcB;
-    uint32_t M;
+    uint32_t O;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+} plp_spmat_bcsr_mult_instance_i16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 32-bit floating-point parallel symmetric matrix multiplication.
+ */
+typedef struct {
+    const float *__restrict__ pSrcA;
+    const float *__restrict__ pSrcB;
     uint32_t N;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideY;
+    uint32_t O;
     uint32_t nPE;
-    int16_t *__restrict__ pDst;
-} plp_mat_sub_stride_instance_i16;
+    float *__restrict__ pDstC;
+} plp_mat_mult_sym_instance_f32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for strided integer parallel matrix subtraction.
+ * @brief Instance structure for 16-bit fix-point parallel symmetric matrix multiplication.
  */
 typedef struct {
-    const int32_t *__restrict__ pSrcA;
-    const int32_t *__restrict__ pSrcB;
-    uint32_t M;
+    const int16_t *__restrict__ pSrcA;
+    const int16_t *__restrict__ pSrcB;
     uint32_t N;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideY;
+    uint32_t O;
+    uint32_t shift;
     uint32_t nPE;
-    int32_t *__restrict__ pDst;
-} plp_mat_sub_stride_instance_i32;
+    int16_t *__restrict__ pDstC;
+} plp_mat_mult_sym_instance_q16;
 
 /** -------------------------------------------------------
- * @brief Instance structure for strided floating-point parallel matrix subtraction.
+ * @brief Instance structure for 32-bit floating-point parallel triangular matrix multiplication.
  */
 typedef struct {
     const float *__restrict__ pSrcA;
     const float *__restrict__ pSrcB;
-    uint32_t M;
     uint32_t N;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideY;
+    uint32_t O;
+    uint8_t upperFlag;
     uint32_t nPE;
-    float *__restrict__ pDst;
-} plp_mat_sub_stride_instance_f32;
+    float *__restrict__ pDstC;
+} plp_mat_mult_tri_instance_f32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for strided integer parallel matrix scale.
+ * @brief Instance structure for 16-bit fix-point parallel triangular matrix multiplication.
  */
 typedef struct {
-    const int8_t *__restrict__ pSrc;
-    uint32_t M;
+    const int16_t *__restrict__ pSrcA;
+    const int16_t *__restrict__ pSrcB;
     uint32_t N;
-    uint32_t strideSrc;
-    uint32_t strideDst;
-    int8_t scaleFactor;
-    int32_t shift;
+    uint32_t O;
+    uint8_t upperFlag;
+    uint32_t shift;
     uint32_t nPE;
-    int8_t *__restrict__ pDst;
-} plp_mat_scale_stride_instance_i8;
+    int16_t *__restrict__ pDstC;
+} plp_mat_mult_tri_instance_q16;
 
 /** -------------------------------------------------------
- * @brief Instance structure for strided integer parallel matrix scale.
+ * @brief Instance structure for 32-bit floating-point parallel triangular solve.
  */
 typedef struct {
-    const int16_t *__restrict__ pSrc;
-    uint32_t M;
+    const float *__restrict__ pSrcA;
+    const float *pSrcB;
     uint32_t N;
-    uint32_t strideSrc;
-    uint32_t strideDst;
-    int16_t scaleFactor;
-    int32_t shift;
+    uint32_t O;
+    uint8_t upperFlag;
     uint32_t nPE;
-    int16_t *__restrict__ pDst;
-} plp_mat_scale_stride_instance_i16;
+    float *pDstX;
+} plp_mat_solve_tri_instance_f32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for strided integer parallel matrix scale.
+ * @brief Instance structure for 32-bit floating-point parallel Toeplitz matrix-vector
+ * multiplication.
  */
 typedef struct {
-    const int32_t *__restrict__ pSrc;
+    const float *__restrict__ pSrcT;
+    const float *__restrict__ pSrcX;
     uint32_t M;
     uint32_t N;
-    uint32_t strideSrc;
-    uint32_t strideDst;
-    int32_t scaleFactor;
-    int32_t shift;
     uint32_t nPE;
-    int32_t *__restrict__ pDst;
-} plp_mat_scale_stride_instance_i32;
+    float *__restrict__ pDstY;
+} plp_mat_vec_toeplitz_instance_f32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for strided floating-point parallel matrix scale.
+ * @brief Instance structure for 16-bit fix-point parallel Toeplitz matrix-vector multiplication.
  */
 typedef struct {
-    const float *__restrict__ pSrc;
+    const int16_t *__restrict__ pSrcT;
+    const int16_t *__restrict__ pSrcX;
     uint32_t M;
     uint32_t N;
-    uint32_t strideSrc;
-    uint32_t strideDst;
-    float scaleFactor;
+    uint32_t shift;
     uint32_t nPE;
-    float *__restrict__ pDst;
-} plp_mat_scale_stride_instance_f32;
+    int16_t *__restrict__ pDstY;
+} plp_mat_vec_toeplitz_instance_q16;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel strided identity matrix creation.
+ * @brief Instance structure for 32-bit floating-point parallel diagonal scaled matrix
+ * multiplication.
  */
 typedef struct {
+    const float *__restrict__ pSrcA;
+    const float *__restrict__ pSrcB;
+    const float *__restrict__ pDiagRow;
+    const float *__restrict__ pDiagCol;
+    uint32_t M;
     uint32_t N;
-    uint32_t stride;
+    uint32_t O;
     uint32_t nPE;
-    int8_t *__restrict__ pDst;
-} plp_mat_fill_I_stride_instance_i8;
+    float *__restrict__ pDstC;
+} plp_mat_mult_diag_instance_f32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel strided identity matrix creation.
+ * @brief Instance structure for 16-bit fix-point parallel diagonal scaled matrix multiplication.
  */
 typedef struct {
+    const int16_t *__restrict__ pSrcA;
+    const int16_t *__restrict__ pSrcB;
+    const int16_t *__restrict__ pDiagRow;
+    const int16_t *__restrict__ pDiagCol;
+    uint32_t M;
     uint32_t N;
-    uint32_t stride;
+    uint32_t O;
+    uint32_t shift;
     uint32_t nPE;
-    int16_t *__restrict__ pDst;
-} plp_mat_fill_I_stride_instance_i16;
+    int16_t *__restrict__ pDstC;
+} plp_mat_mult_diag_instance_q16;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel strided identity matrix creation.
+ * @brief Instance structure for parallel 8-bit x 16-bit integer matrix multiplication.
  */
 typedef struct {
+    const int8_t *__restrict__ pSrcA;
+    const int16_t *__restrict__ pSrcB;
+    uint32_t M;
     uint32_t N;
-    uint32_t stride;
+    uint32_t O;
     uint32_t nPE;
-    int32_t *__restrict__ pDst;
-} plp_mat_fill_I_stride_instance_i32;
+    int32_t *__restrict__ pDstC;
+} plp_mat_mult_instance_i8i16;
 
 /** -------------------------------------------------------
- * @brief Instance structure for floating-point parallel strided identity matrix creation.
+ * @brief Instance structure for parallel 4-bit x 8-bit integer matrix multiplication.
  */
 typedef struct {
+    const int8_t *__restrict__ pSrcA;
+    const int8_t *__restrict__ pSrcB;
+    uint32_t M;
     uint32_t N;
-    uint32_t stride;
+    uint32_t O;
     uint32_t nPE;
-    float *__restrict__ pDst;
-} plp_mat_fill_I_stride_instance_f32;
+    int32_t *__restrict__ pDstC;
+} plp_mat_mult_instance_i4i8;
 
 /** -------------------------------------------------------
- * @brief Instance structure for 8-bit fix-point parallel strided identity matrix creation.
+ * @brief Instance structure for parallel 8-bit x 16-bit integer requantized matrix multiplication.
  */
 typedef struct {
+    const int8_t *__restrict__ pSrcA;
+    const int16_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    const int32_t *__restrict__ pMult;
+    const int32_t *__restrict__ pBias;
+    uint32_t shift;
+    uint32_t nPE;
+    int16_t *__restrict__ pDstC;
+} plp_mat_mult_requant_instance_i8i16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for parallel 4-bit x 8-bit integer requantized matrix multiplication.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrcA;
+    const int8_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    const int32_t *__restrict__ pMult;
+    const int32_t *__restrict__ pBias;
+    uint32_t shift;
+    uint32_t nPE;
+    int8_t *__restrict__ pDstC;
+} plp_mat_mult_requant_instance_i4i8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for parallel 8-bit x 16-bit integer matrix-vector multiplication.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrcA;
+    const int16_t *__restrict__ pSrcX;
+    uint32_t M;
+    uint32_t N;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstY;
+} plp_mat_vec_instance_i8i16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for parallel 4-bit x 8-bit integer matrix-vector multiplication.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrcA;
+    const int8_t *__restrict__ pSrcX;
+    uint32_t M;
+    uint32_t N;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstY;
+} plp_mat_vec_instance_i4i8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for parallel 8-bit x 16-bit integer requantized matrix-vector
+ * multiplication.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrcA;
+    const int16_t *__restrict__ pSrcX;
+    uint32_t M;
+    uint32_t N;
+    const int32_t *__restrict__ pMult;
+    const int32_t *__restrict__ pBias;
+    uint32_t shift;
+    uint32_t nPE;
+    int16_t *__restrict__ pDstY;
+} plp_mat_vec_requant_instance_i8i16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for parallel 4-bit x 8-bit integer requantized matrix-vector
+ * multiplication.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrcA;
+    const int8_t *__restrict__ pSrcX;
+    uint32_t M;
+    uint32_t N;
+    const int32_t *__restrict__ pMult;
+    const int32_t *__restrict__ pBias;
+    uint32_t shift;
+    uint32_t nPE;
+    int8_t *__restrict__ pDstY;
+} plp_mat_vec_requant_instance_i4i8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel matrix addition.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrcA;
+    const int8_t *__restrict__ pSrcB;
+    uint32_t M;
     uint32_t N;
-    uint32_t stride;
     uint32_t nPE;
-    int32_t fracBits;
     int8_t *__restrict__ pDst;
-} plp_mat_fill_I_stride_instance_q8;
+} plp_mat_add_instance_i8;
 
 /** -------------------------------------------------------
- * @brief Instance structure for 16-bit fix-point parallel strided identity matrix creation.
+ * @brief Instance structure for integer parallel matrix addition.
  */
 typedef struct {
+    const int16_t *__restrict__ pSrcA;
+    const int16_t *__restrict__ pSrcB;
+    uint32_t M;
     uint32_t N;
-    uint32_t stride;
     uint32_t nPE;
-    int32_t fracBits;
     int16_t *__restrict__ pDst;
-} plp_mat_fill_I_stride_instance_q16;
+} plp_mat_add_instance_i16;
 
 /** -------------------------------------------------------
- * @brief Instance structure for 32-bit fix-point parallel strided identity matrix creation.
+ * @brief Instance structure for integer parallel matrix addition.
  */
 typedef struct {
+    const int32_t *__restrict__ pSrcA;
+    const int32_t *__restrict__ pSrcB;
+    uint32_t M;
     uint32_t N;
-    uint32_t stride;
     uint32_t nPE;
-    int32_t fracBits;
     int32_t *__restrict__ pDst;
-} plp_mat_fill_I_stride_instance_q32;
+} plp_mat_add_instance_i32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for filling an integer matrix in parallel.
+ * @brief Instance structure for floating-point parallel matrix addition.
  */
 typedef struct {
+    const float *__restrict__ pSrcA;
+    const float *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t nPE;
+    float *__restrict__ pDst;
+} plp_mat_add_instance_f32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel matrix subtraction.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrcA;
+    const int8_t *__restrict__ pSrcB;
     uint32_t M;
     uint32_t N;
-    uint32_t stride;
-    int8_t value;
     uint32_t nPE;
     int8_t *__restrict__ pDst;
-} plp_mat_fill_stride_instance_i8;
+} plp_mat_sub_instance_i8;
 
 /** -------------------------------------------------------
- * @brief Instance structure for filling an integer matrix in parallel.
+ * @brief Instance structure for integer parallel matrix subtraction.
  */
 typedef struct {
+    const int16_t *__restrict__ pSrcA;
+    const int16_t *__restrict__ pSrcB;
     uint32_t M;
     uint32_t N;
-    uint32_t stride;
-    int16_t value;
     uint32_t nPE;
     int16_t *__restrict__ pDst;
-} plp_mat_fill_stride_instance_i16;
+} plp_mat_sub_instance_i16;
 
 /** -------------------------------------------------------
- * @brief Instance structure for filling an integer matrix in parallel.
+ * @brief Instance structure for integer parallel matrix subtraction.
  */
 typedef struct {
+    const int32_t *__restrict__ pSrcA;
+    const int32_t *__restrict__ pSrcB;
     uint32_t M;
     uint32_t N;
-    uint32_t stride;
-    int32_t value;
     uint32_t nPE;
     int32_t *__restrict__ pDst;
-} plp_mat_fill_stride_instance_i32;
+} plp_mat_sub_instance_i32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for filling a floating-point matrix in parallel.
+ * @brief Instance structure for floating-point parallel matrix subtraction.
  */
 typedef struct {
+    const float *__restrict__ pSrcA;
+    const float *__restrict__ pSrcB;
     uint32_t M;
     uint32_t N;
-    uint32_t stride;
-    float value;
     uint32_t nPE;
     float *__restrict__ pDst;
-} plp_mat_fill_stride_instance_f32;
+} plp_mat_sub_instance_f32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel strided matrix copy.
+ * @brief Instance structure for integer parallel matrix scale.
  */
 typedef struct {
     const int8_t *__restrict__ pSrc;
     uint32_t M;
     uint32_t N;
-    uint32_t strideSrc;
-    uint32_t strideDst;
+    int8_t scaleFactor;
+    int32_t shift;
     uint32_t nPE;
     int8_t *__restrict__ pDst;
-} plp_mat_copy_stride_instance_i8;
+} plp_mat_scale_instance_i8;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel strided matrix copy.
+ * @brief Instance structure for integer parallel matrix scale.
  */
 typedef struct {
     const int16_t *__restrict__ pSrc;
     uint32_t M;
     uint32_t N;
-    uint32_t strideSrc;
-    uint32_t strideDst;
+    int16_t scaleFactor;
+    int32_t shift;
     uint32_t nPE;
     int16_t *__restrict__ pDst;
-} plp_mat_copy_stride_instance_i16;
+} plp_mat_scale_instance_i16;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel strided matrix copy.
+ * @brief Instance structure for integer parallel matrix scale.
  */
 typedef struct {
     const int32_t *__restrict__ pSrc;
     uint32_t M;
     uint32_t N;
-    uint32_t strideSrc;
-    uint32_t strideDst;
+    int32_t scaleFactor;
+    int32_t shift;
     uint32_t nPE;
     int32_t *__restrict__ pDst;
-} plp_mat_copy_stride_instance_i32;
+} plp_mat_scale_instance_i32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for floating-point parallel strided matrix copy.
+ * @brief Instance structure for floating-point parallel matrix scale.
  */
 typedef struct {
     const float *__restrict__ pSrc;
     uint32_t M;
     uint32_t N;
-    uint32_t strideSrc;
-    uint32_t strideDst;
+    float scaleFactor;
     uint32_t nPE;
     float *__restrict__ pDst;
-} plp_mat_copy_stride_instance_f32;
+} plp_mat_scale_instance_f32;
 
 /** -------------------------------------------------------
-    @brief Glue code for parallel dot product of 32-bit integer vectors.
-    @param[in]  pSrcA      points to the first input vector
-    @param[in]  pSrcB      points to the second input vector
-    @param[in]  blockSize  number of samples in each vector
-    @param[in]  nPE        number of parallel processing units
-    @param[out] pRes     output result returned here
-    @return     none
-*/
-
-void plp_dot_prod_i32_parallel(const int32_t *__restrict__ pSrcA,
-                               const int32_t *__restrict__ pSrcB,
-                               uint32_t blockSize,
-                               uint32_t nPE,
-                               int32_t *__restrict__ pRes);
+ * @brief Instance structure for integer parallel matrix transpose.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrc;
+    uint32_t M;
+    uint32_t N;
+    uint32_t nPE;
+    int8_t *__restrict__ pDst;
+} plp_mat_trans_instance_i8;
 
 /** -------------------------------------------------------
-    @brief Glue code for parallel dot product of 32-bit fixed point vectors.
-    @param[in]  pSrcA      points to the first input vector
-    @param[in]  pSrcB      points to the second input vector
-    @param[in]  blockSize  number of samples in each vector
-    @param[in]  deciPoint  decimal point for right shift
-    @param[in]  nPE        number of parallel processing units
-    @param[out] pRes     output result returned here
-    @return     none
-*/
+ * @brief Instance structure for integer parallel matrix transpose.
+ */
+typedef struct {
+    const int16_t *__restrict__ pSrc;
+    uint32_t M;
+    uint32_t N;
+    uint32_t nPE;
+    int16_t *__restrict__ pDst;
+} plp_mat_trans_instance_i16;
 
-void plp_dot_prod_q32_parallel(const int32_t *__restrict__ pSrcA,
-                               const int32_t *__restrict__ pSrcB,
-                               uint32_t blockSize,
-                               uint32_t deciPoint,
-                               uint32_t nPE,
-                               int32_t *__restrict__ pRes);
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel matrix transpose.
+ */
+typedef struct {
+    const int32_t *__restrict__ pSrc;
+    uint32_t M;
+    uint32_t N;
+    uint32_t nPE;
+    int32_t *__restrict__ pDst;
+} plp_mat_trans_instance_i32;
 
 /** -------------------------------------------------------
-    @brief Glue code for parallel dot product of 32-bit float vectors.
-    @param[in]  pSrcA      points to the first input vector
-    @param[in]  pSrcB      points to the second input vector
-    @param[in]  blockSize  number of samples in each vector
-    @param[in]  nPE        number of parallel processing units
-    @param[out] pRes     output result returned here
-    @return     none
-*/
+ * @brief Instance structure for integer parallel in-place matrix transpose.
+ */
+typedef struct {
+    int8_t *__restrict__ pSrcDst;
+    uint32_t N;
+    uint32_t nPE;
+} plp_mat_trans_in_place_instance_i8;
 
-void plp_dot_prod_f32_parallel(const float32_t *__restrict__ pSrcA,
-                               const float32_t *__restrict__ pSrcB,
-                               uint32_t blockSize,
-                               uint32_t nPE,
-                               float32_t *__restrict__ pRes);
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel in-place matrix transpose.
+ */
+typedef struct {
+    int16_t *__restrict__ pSrcDst;
+    uint32_t N;
+    uint32_t nPE;
+} plp_mat_trans_in_place_instance_i16;
 
 /** -------------------------------------------------------
-    @brief Parallel dot product with interleaved access of 32-bit integer vectors kernel for XPULPV2
-    extension.
+ * @brief Instance structure for integer parallel in-place matrix transpose.
+ */
+typedef struct {
+    int32_t *__restrict__ pSrcDst;
+    uint32_t N;
+    uint32_t nPE;
+} plp_mat_trans_in_place_instance_i32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel identity matrix creation.
+ */
+typedef struct {
+    uint32_t N;
+    uint32_t nPE;
+    int8_t *__restrict__ pDst;
+} plp_mat_fill_I_instance_i8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel identity matrix creation.
+ */
+typedef struct {
+    uint32_t N;
+    uint32_t nPE;
+    int16_t *__restrict__ pDst;
+} plp_mat_fill_I_instance_i16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel identity matrix creation.
+ */
+typedef struct {
+    uint32_t N;
+    uint32_t nPE;
+    int32_t *__restrict__ pDst;
+} plp_mat_fill_I_instance_i32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for floating-point parallel identity matrix creation.
+ */
+typedef struct {
+    uint32_t N;
+    uint32_t nPE;
+    float *__restrict__ pDst;
+} plp_mat_fill_I_instance_f32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for fix-point parallel identity matrix creation.
+ */
+typedef struct {
+    uint32_t N;
+    int32_t fracBits;
+    uint32_t nPE;
+    int8_t *__restrict__ pDst;
+} plp_mat_fill_I_instance_q8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for fix-point parallel identity matrix creation.
+ */
+typedef struct {
+    uint32_t N;
+    uint32_t fracBits;
+    uint32_t nPE;
+    int16_t *__restrict__ pDst;
+} plp_mat_fill_I_instance_q16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for fix-point parallel identity matrix creation.
+ */
+typedef struct {
+    uint32_t N;
+    uint32_t fracBits;
+    uint32_t nPE;
+    int32_t *__restrict__ pDst;
+} plp_mat_fill_I_instance_q32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided integer parallel matrix multiplication.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrcA;
+    const int8_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+} plp_mat_mult_stride_instance_i8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided integer parallel matrix multiplication.
+ */
+typedef struct {
+    const int16_t *__restrict__ pSrcA;
+    const int16_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+} plp_mat_mult_stride_instance_i16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided integer parallel matrix multiplication.
+ */
+typedef struct {
+    const int32_t *__restrict__ pSrcA;
+    const int32_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+} plp_mat_mult_stride_instance_i32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided floating-point parallel matrix multiplication.
+ */
+typedef struct {
+    const float *__restrict__ pSrcA;
+    const float *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t nPE;
+    float *__restrict__ pDstC;
+} plp_mat_mult_stride_instance_f32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided 8-bit fix-point parallel matrix multiplication.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrcA;
+    const int8_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t shift;
+    uint32_t nPE;
+    int8_t *__restrict__ pDstC;
+} plp_mat_mult_stride_instance_q8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided 16-bit fix-point parallel matrix multiplication.
+ */
+typedef struct {
+    const int16_t *__restrict__ pSrcA;
+    const int16_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t shift;
+    uint32_t nPE;
+    int16_t *__restrict__ pDstC;
+} plp_mat_mult_stride_instance_q16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided 32-bit fix-point parallel matrix multiplication.
+ */
+typedef struct {
+    const int32_t *__restrict__ pSrcA;
+    const int32_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t shift;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+} plp_mat_mult_stride_instance_q32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel complex strided matrix matrix multiplication.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrcA;
+    const int8_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+} plp_mat_mult_cmplx_stride_instance_i8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel complex strided matrix matrix multiplication.
+ */
+typedef struct {
+    const int16_t *__restrict__ pSrcA;
+    const int16_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+} plp_mat_mult_cmplx_stride_instance_i16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel complex strided matrix matrix multiplication.
+ */
+typedef struct {
+    const int32_t *__restrict__ pSrcA;
+    const int32_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+} plp_mat_mult_cmplx_stride_instance_i32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for floating-point parallel complex strided matrix matrix
+ * multiplication.
+ */
+typedef struct {
+    const float *__restrict__ pSrcA;
+    const float *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t nPE;
+    float *__restrict__ pDstC;
+} plp_mat_mult_cmplx_stride_instance_f32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 8-bit fix-point parallel complex strided matrix matrix
+ * multiplication.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrcA;
+    const int8_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t shift;
+    uint32_t nPE;
+    int8_t *__restrict__ pDstC;
+} plp_mat_mult_cmplx_stride_instance_q8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 16-bit fix-point parallel complex strided matrix matrix
+ * multiplication.
+ */
+typedef struct {
+    const int16_t *__restrict__ pSrcA;
+    const int16_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t shift;
+    uint32_t nPE;
+    int16_t *__restrict__ pDstC;
+} plp_mat_mult_cmplx_stride_instance_q16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 32-bit fix-point parallel complex strided matrix matrix
+ * multiplication.
+ */
+typedef struct {
+    const int32_t *__restrict__ pSrcA;
+    const int32_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t shift;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+} plp_mat_mult_cmplx_stride_instance_q32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided integer parallel matrix addition.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrcA;
+    const int8_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideY;
+    uint32_t nPE;
+    int8_t *__restrict__ pDst;
+} plp_mat_add_stride_instance_i8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided integer parallel matrix addition.
+ */
+typedef struct {
+    const int16_t *__restrict__ pSrcA;
+    const int16_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideY;
+    uint32_t nPE;
+    int16_t *__restrict__ pDst;
+} plp_mat_add_stride_instance_i16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided integer parallel matrix addition.
+ */
+typedef struct {
+    const int32_t *__restrict__ pSrcA;
+    const int32_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideY;
+    uint32_t nPE;
+    int32_t *__restrict__ pDst;
+} plp_mat_add_stride_instance_i32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided floating-point parallel matrix addition.
+ */
+typedef struct {
+    const float *__restrict__ pSrcA;
+    const float *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideY;
+    uint32_t nPE;
+    float *__restrict__ pDst;
+} plp_mat_add_stride_instance_f32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided integer parallel matrix subtraction.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrcA;
+    const int8_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideY;
+    uint32_t nPE;
+    int8_t *__restrict__ pDst;
+} plp_mat_sub_stride_instance_i8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided integer parallel matrix subtraction.
+ */
+typedef struct {
+    const int16_t *__restrict__ pSrcA;
+    const int16_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideY;
+    uint32_t nPE;
+    int16_t *__restrict__ pDst;
+} plp_mat_sub_stride_instance_i16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided integer parallel matrix subtraction.
+ */
+typedef struct {
+    const int32_t *__restrict__ pSrcA;
+    const int32_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideY;
+    uint32_t nPE;
+    int32_t *__restrict__ pDst;
+} plp_mat_sub_stride_instance_i32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided floating-point parallel matrix subtraction.
+ */
+typedef struct {
+    const float *__restrict__ pSrcA;
+    const float *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideY;
+    uint32_t nPE;
+    float *__restrict__ pDst;
+} plp_mat_sub_stride_instance_f32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided integer parallel matrix scale.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrc;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideSrc;
+    uint32_t strideDst;
+    int8_t scaleFactor;
+    int32_t shift;
+    uint32_t nPE;
+    int8_t *__restrict__ pDst;
+} plp_mat_scale_stride_instance_i8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided integer parallel matrix scale.
+ */
+typedef struct {
+    const int16_t *__restrict__ pSrc;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideSrc;
+    uint32_t strideDst;
+    int16_t scaleFactor;
+    int32_t shift;
+    uint32_t nPE;
+    int16_t *__restrict__ pDst;
+} plp_mat_scale_stride_instance_i16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided integer parallel matrix scale.
+ */
+typedef struct {
+    const int32_t *__restrict__ pSrc;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideSrc;
+    uint32_t strideDst;
+    int32_t scaleFactor;
+    int32_t shift;
+    uint32_t nPE;
+    int32_t *__restrict__ pDst;
+} plp_mat_scale_stride_instance_i32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided floating-point parallel matrix scale.
+ */
+typedef struct {
+    const float *__restrict__ pSrc;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideSrc;
+    uint32_t strideDst;
+    float scaleFactor;
+    uint32_t nPE;
+    float *__restrict__ pDst;
+} plp_mat_scale_stride_instance_f32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel strided identity matrix creation.
+ */
+typedef struct {
+    uint32_t N;
+    uint32_t stride;
+    uint32_t nPE;
+    int8_t *__restrict__ pDst;
+} plp_mat_fill_I_stride_instance_i8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel strided identity matrix creation.
+ */
+typedef struct {
+    uint32_t N;
+    uint32_t stride;
+    uint32_t nPE;
+    int16_t *__restrict__ pDst;
+} plp_mat_fill_I_stride_instance_i16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel strided identity matrix creation.
+ */
+typedef struct {
+    uint32_t N;
+    uint32_t stride;
+    uint32_t nPE;
+    int32_t *__restrict__ pDst;
+} plp_mat_fill_I_stride_instance_i32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for floating-point parallel strided identity matrix creation.
+ */
+typedef struct {
+    uint32_t N;
+    uint32_t stride;
+    uint32_t nPE;
+    float *__restrict__ pDst;
+} plp_mat_fill_I_stride_instance_f32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 8-bit fix-point parallel strided identity matrix creation.
+ */
+typedef struct {
+    uint32_t N;
+    uint32_t stride;
+    uint32_t nPE;
+    int32_t fracBits;
+    int8_t *__restrict__ pDst;
+} plp_mat_fill_I_stride_instance_q8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 16-bit fix-point parallel strided identity matrix creation.
+ */
+typedef struct {
+    uint32_t N;
+    uint32_t stride;
+    uint32_t nPE;
+    int32_t fracBits;
+    int16_t *__restrict__ pDst;
+} plp_mat_fill_I_stride_instance_q16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 32-bit fix-point parallel strided identity matrix creation.
+ */
+typedef struct {
+    uint32_t N;
+    uint32_t stride;
+    uint32_t nPE;
+    int32_t fracBits;
+    int32_t *__restrict__ pDst;
+} plp_mat_fill_I_stride_instance_q32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for filling an integer matrix in parallel.
+ */
+typedef struct {
+    uint32_t M;
+    uint32_t N;
+    uint32_t stride;
+    int8_t value;
+    uint32_t nPE;
+    int8_t *__restrict__ pDst;
+} plp_mat_fill_stride_instance_i8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for filling an integer matrix in parallel.
+ */
+typedef struct {
+    uint32_t M;
+    uint32_t N;
+    uint32_t stride;
+    int16_t value;
+    uint32_t nPE;
+    int16_t *__restrict__ pDst;
+} plp_mat_fill_stride_instance_i16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for filling an integer matrix in parallel.
+ */
+typedef struct {
+    uint32_t M;
+    uint32_t N;
+    uint32_t stride;
+    int32_t value;
+    uint32_t nPE;
+    int32_t *__restrict__ pDst;
+} plp_mat_fill_stride_instance_i32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for filling a floating-point matrix in parallel.
+ */
+typedef struct {
+    uint32_t M;
+    uint32_t N;
+    uint32_t stride;
+    float value;
+    uint32_t nPE;
+    float *__restrict__ pDst;
+} plp_mat_fill_stride_instance_f32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel strided matrix copy.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrc;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideSrc;
+    uint32_t strideDst;
+    uint32_t nPE;
+    int8_t *__restrict__ pDst;
+} plp_mat_copy_stride_instance_i8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel strided matrix copy.
+ */
+typedef struct {
+    const int16_t *__restrict__ pSrc;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideSrc;
+    uint32_t strideDst;
+    uint32_t nPE;
+    int16_t *__restrict__ pDst;
+} plp_mat_copy_stride_instance_i16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel strided matrix copy.
+ */
+typedef struct {
+    const int32_t *__restrict__ pSrc;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideSrc;
+    uint32_t strideDst;
+    uint32_t nPE;
+    int32_t *__restrict__ pDst;
+} plp_mat_copy_stride_instance_i32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for floating-point parallel strided matrix copy.
+ */
+typedef struct {
+    const float *__restrict__ pSrc;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideSrc;
+    uint32_t strideDst;
+    uint32_t nPE;
+    float *__restrict__ pDst;
+} plp_mat_copy_stride_instance_f32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel strided matrix transpose.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrc;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideSrc;
+    uint32_t strideDst;
+    uint32_t nPE;
+    int8_t *__restrict__ pDst;
+} plp_mat_trans_stride_instance_i8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel strided matrix transpose.
+ */
+typedef struct {
+    const int16_t *__restrict__ pSrc;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideSrc;
+    uint32_t strideDst;
+    uint32_t nPE;
+    int16_t *__restrict__ pDst;
+} plp_mat_trans_stride_instance_i16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel strided matrix transpose.
+ */
+typedef struct {
+    const int32_t *__restrict__ pSrc;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideSrc;
+    uint32_t strideDst;
+    uint32_t nPE;
+    int32_t *__restrict__ pDst;
+} plp_mat_trans_stride_instance_i32;
+
+/** -------------------------------------------------------
+    @brief Glue code for parallel dot product of 32-bit integer vectors.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes     output result returned here
+    @return     none
+*/
+
+void plp_dot_prod_i32_parallel(const int32_t *__restrict__ pSrcA,
+                               const int32_t *__restrict__ pSrcB,
+                               uint32_t blockSize,
+                               uint32_t nPE,
+                               int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Glue code for parallel dot product of 32-bit fixed point vectors.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  deciPoint  decimal point for right shift
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes     output result returned here
+    @return     none
+*/
+
+void plp_dot_prod_q32_parallel(const int32_t *__restrict__ pSrcA,
+                               const int32_t *__restrict__ pSrcB,
+                               uint32_t blockSize,
+                               uint32_t deciPoint,
+                               uint32_t nPE,
+                               int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Glue code for parallel dot product of 32-bit float vectors.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes     output result returned here
+    @return     none
+*/
+
+void plp_dot_prod_f32_parallel(const float32_t *__restrict__ pSrcA,
+                               const float32_t *__restrict__ pSrcB,
+                               uint32_t blockSize,
+                               uint32_t nPE,
+                               float32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Parallel dot product with interleaved access of 32-bit integer vectors kernel for XPULPV2
+    extension.
     @param[in]  S     points to the instance structure for integer parallel dot product
     @return     none
 */
 
-void plp_dot_prod_i32p_xpulpv2(void *S);
+void plp_dot_prod_i32p_xpulpv2(void *S);
+
+/** -------------------------------------------------------
+    @brief Parallel dot product with interleaved access of 32-bit fixed point vectors kernel for
+    XPULPV2 extension.
+    @param[in]  S     points to the instance structure for fixed point parallel dot product
+    @return     none
+*/
+
+void plp_dot_prod_q32p_xpulpv2(void *S);
+
+/** -------------------------------------------------------
+    @brief Parallel dot product with interleaved access of 32-bit float vectors kernel for XPULPV2
+    extension.
+    @param[in]  S     points to the instance structure for float parallel dot product
+    @return     none
+*/
+
+void plp_dot_prod_f32p_xpulpv2(void *S);
+
+/** -------------------------------------------------------
+    @brief Glue code for dot product of 32-bit integer vectors.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here
+*/
+void plp_dot_prod_i32(const int32_t *__restrict__ pSrcA,
+                      const int32_t *__restrict__ pSrcB,
+                      uint32_t blockSize,
+                      int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Scalar dot product of 32-bit integer vectors kernel for RV32IM extension.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here
+*/
+void plp_dot_prod_i32s_rv32im(const int32_t *__restrict__ pSrcA,
+                              const int32_t *__restrict__ pSrcB,
+                              uint32_t blockSize,
+                              int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Scalar dot product of 32-bit integer vectors kernel for XPULPV2 extension.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here
+*/
+void plp_dot_prod_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                               const int32_t *__restrict__ pSrcB,
+                               uint32_t blockSize,
+                               int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Glue code for dot product of 32-bit fixed point vectors.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  deciPoint  decimal point for right shift
+    @param[out] pRes       output result returned here
+    @return     none
+*/
+
+void plp_dot_prod_q32(const int32_t *__restrict__ pSrcA,
+                      const int32_t *__restrict__ pSrcB,
+                      uint32_t blockSize,
+                      uint32_t deciPoint,
+                      int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Scalar dot product of 32-bit fixed point vectors kernel for RV32IM extension.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  deciPoint  decimal point for right shift
+    @param[out] pRes       output result returned here
+    @return     none
+*/
+
+void plp_dot_prod_q32s_rv32im(const int32_t *__restrict__ pSrcA,
+                              const int32_t *__restrict__ pSrcB,
+                              uint32_t blockSize,
+                              uint32_t deciPoint,
+                              int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Scalar dot product of 32-bit fixed point vectors kernel for XPULPV2 extension.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  deciPoint  decimal point for right shift
+    @param[out] pRes       output result returned here
+    @return     none
+*/
+
+void plp_dot_prod_q32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                               const int32_t *__restrict__ pSrcB,
+                               uint32_t blockSize,
+                               uint32_t deciPoint,
+                               int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Glue code for dot product of 32-bit float vectors.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here
+    @return     none
+*/
+
+void plp_dot_prod_f32(const float32_t *__restrict__ pSrcA,
+                      const float32_t *__restrict__ pSrcB,
+                      uint32_t blockSize,
+                      float32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Glue code for dot product of 32-bit float vectors.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here
+    @return     none
+*/
+
+void plp_dot_prod_f32s_xpulpv2(const float32_t *__restrict__ pSrcA,
+                               const float32_t *__restrict__ pSrcB,
+                               uint32_t blockSize,
+                               float32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Glue code for dot product of 16-bit integer vectors.
+    @param[in]  pSrcA      points to the first input vector [16 bit]
+    @param[in]  pSrcB      points to the second input vector [16 bit]
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here [32 bit]
+
+    @par Exploiting SIMD instructions
+    When the ISA supports, the 16 bit values are packed two by two into 32 bit vectors and then the
+    two dot products are performed simultaneously on 32 bit vectors, with 32 bit accumulator.
+*/
+void plp_dot_prod_i16(const int16_t *pSrcA,
+                      const int16_t *pSrcB,
+                      uint32_t blockSize,
+                      int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Vectorized dot product of 16-bit integer vectors kernel for RV32IM extension.
+    @param[in]  pSrcA      points to the first input vector [16 bit]
+    @param[in]  pSrcB      points to the second input vector [16 bit]
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here [32 bit]
+    @return     none
+
+    @par Exploiting SIMD instructions
+    When the ISA supports, the 16 bit values are packed two by two into 32 bit vectors and then the
+    two dot products are performed simultaneously on 32 bit vectors, with 32 bit accumulator. RV32IM
+    doesn't support SIMD. For SIMD, check out other ISA extensions (e.g. XPULPV2).
+*/
+
+void plp_dot_prod_i16s_rv32im(const int16_t *__restrict__ pSrcA,
+                              const int16_t *__restrict__ pSrcB,
+                              uint32_t blockSize,
+                              int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Vectorized dot product of 16-bit integer vectors kernel singlecore for XPULPV2 extension.
+    @param[in]  pSrcA      points to the first input vector [16 bit]
+    @param[in]  pSrcB      points to the second input vector [16 bit]
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here [32 bit]
+    @return     none
+
+    @par Exploiting SIMD instructions
+    The 16 bit values are packed two by two into 32 bit vectors and then the two dot products are
+    performed simultaneously on 32 bit vectors.
+*/
+
+void plp_dot_prod_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                               const int16_t *__restrict__ pSrcB,
+                               uint32_t blockSize,
+                               int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Glue code for dot product of 16-bit fixed point vectors.
+    @param[in]  pSrcA      points to the first input vector [16 bit]
+    @param[in]  pSrcB      points to the second input vector [16 bit]
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  deciPoint  decimal point for right shift
+    @param[out] pRes       output result returned here [32 bit]
+    @return     none
+
+    @par Exploiting SIMD instructions
+    The 16 bit values are packed two by two into 32 bit vectors and then the two dot products are
+    performed simultaneously on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_dot_prod_q16(const int16_t *__restrict__ pSrcA,
+                      const int16_t *__restrict__ pSrcB,
+                      uint32_t blockSize,
+                      uint32_t deciPoint,
+                      int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Scalar dot product of 16-bit fixed point vectors kernel for RV32IM extension.
+    @param[in]  pSrcA      points to the first input vector [16 bit]
+    @param[in]  pSrcB      points to the second input vector [16 bit]
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  deciPoint  decimal point for right shift
+    @param[out] pRes       output result returned here [32 bit]
+    @return     none
+
+    @par Exploiting SIMD instructions
+    When the ISA supports, the 16 bit values are packed two by two into 32 bit vectors and then the
+    two dot products are performed simultaneously on 32 bit vectors, with 32 bit accumulator. RV32IM
+    doesn't support SIMD. For SIMD, check out other ISA extensions (e.g. XPULPV2).
+*/
+
+void plp_dot_prod_q16s_rv32im(const int16_t *__restrict__ pSrcA,
+                              const int16_t *__restrict__ pSrcB,
+                              uint32_t blockSize,
+                              uint32_t deciPoint,
+                              int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Vectorized dot product of 16-bit fixed point vectors singlecore kernel for XPULPV2
+   extension.
+    @param[in]  pSrcA      points to the first input vector [16 bit]
+    @param[in]  pSrcB      points to the second input vector [16 bit]
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  deciPoint  decimal point for right shift
+    @param[out] pRes       output result returned here [32 bit]
+    @return     none
+
+    @par Exploiting SIMD instructions
+    The 16 bit values are packed two by two into 32 bit vectors and then the two dot products are
+    performed simultaneously on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_dot_prod_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                               const int16_t *__restrict__ pSrcB,
+                               uint32_t blockSize,
+                               uint32_t deciPoint,
+                               int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Glue code for dot product of 8-bit integer vectors.
+    @param[in]  pSrcA      points to the first input vector [8 bit]
+    @param[in]  pSrcB      points to the second input vector [8 bit]
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here [32 bit]
+    @return     none
+
+    @par Exploiting SIMD instructions
+    When the ISA supports, the 8 bit values are packed four by four into 32 bit vectors and then the
+    four dot products are performed simultaneously on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_dot_prod_i8(const int8_t *__restrict__ pSrcA,
+                     const int8_t *__restrict__ pSrcB,
+                     uint32_t blockSize,
+                     int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Vectorized dot product of 8-bit integer vectors kernel for RV32IM extension.
+    @param[in]  pSrcA      points to the first input vector [8] bit]
+    @param[in]  pSrcB      points to the second input vector [8 bit]
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here [32 bit]
+    @return     none
+
+    @par Exploiting SIMD instructions
+    When the ISA supports, the 8 bit values are packed four by four into 32 bit vectors and then the
+    four dot products are performed simultaneously on 32 bit vectors, with 32 bit accumulator.
+    RV32IM doesn't support SIMD. For SIMD, check out other ISA extensions (e.g. XPULPV2).
+*/
+
+void plp_dot_prod_i8s_rv32im(const int8_t *__restrict__ pSrcA,
+                             const int8_t *__restrict__ pSrcB,
+                             uint32_t blockSize,
+                             int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Vectorized dot product of 8-bit integer vectors singlecore kernel for XPULPV2 extension.
+    @param[in]  pSrcA      points to the first input vector [8 bit]
+    @param[in]  pSrcB      points to the second input vector [8 bit]
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here [32 bit]
+    @return     none
+
+    @par Exploiting SIMD instructions
+    The 8 bit values are packed four by four into 32 bit vectors and then the four dot products are
+    performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_dot_prod_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                              const int8_t *__restrict__ pSrcB,
+                              uint32_t blockSize,
+                              int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Glue code for dot product of 8-bit fixed point vectors.
+    @param[in]  pSrcA      points to the first input vector [8 bit]
+    @param[in]  pSrcB      points to the second input vector [8 bit]
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  deciPoint  decimal point for right shift
+    @param[out] pRes       output result returned here [32 bit]
+    @return     none
+
+    @par Exploiting SIMD instructions
+    When the ISA supports, the 8 bit values are packed four by four into 32 bit vectors and then the
+    four dot products are performed simultaneously on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_dot_prod_q8(const int8_t *__restrict__ pSrcA,
+                     const int8_t *__restrict__ pSrcB,
+                     uint32_t blockSize,
+                     uint32_t deciPoint,
+                     int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Scalar dot product of 8-bit fixed point vectors kernel for RV32IM extension.
+    @param[in]  pSrcA      points to the first input vector [8 bit]
+    @param[in]  pSrcB      points to the second input vector [8 bit]
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  deciPoint  decimal point for right shift
+    @param[out] pRes       output result returned here [32 bit]
+    @return     none
+
+    @par Exploiting SIMD instructions
+    When the ISA supports, the 8 bit values are packed four by four into 32 bit vectors and then the
+    four dot products are performed simultaneously on 32 bit vectors, with 32 bit accumulator.
+    RV32IM doesn't support SIMD. For SIMD, check out other ISA extensions (e.g. XPULPV2).
+*/
+
+void plp_dot_prod_q8s_rv32im(const int8_t *__restrict__ pSrcA,
+                             const int8_t *__restrict__ pSrcB,
+                             uint32_t blockSize,
+                             uint32_t deciPoint,
+                             int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Scalar dot product of 8-bit fixed point vectors singlecore kernel for XPULPV2 extension.
+    @param[in]  pSrcA      points to the first input vector [8 bit]
+    @param[in]  pSrcB      points to the second input vector [8 bit]
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  deciPoint  decimal point for right shift
+    @param[out] pRes       output result returned here [32 bit]
+    @return     none
+
+    @par Exploiting SIMD instructions
+    The 8 bit values are packed four by four into 32 bit vectors and then the four dot products are
+    performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_dot_prod_q8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                              const int8_t *__restrict__ pSrcB,
+                              uint32_t blockSize,
+                              uint32_t deciPoint,
+                              int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+   @brief Glue code for absolute value of 32-bit integer vectors.
+   @param[in]     pSrc       points to the input vector
+   @param[out]    pDst       points to the output vector
+   @param[in]     blockSize  number of samples in each vector
+   @return        none
+*/
+
+void plp_abs_i32(const int32_t * pSrc,
+                 int32_t * pDst,
+                 uint32_t blockSize);
+
+/** -------------------------------------------------------
+   @brief Element-by-element absolute value of 32-bit integer vectors kernel for RV32IM extension.
+   @param[in]     pSrc       points to the input vector
+   @param[out]    pDst       points to the output vector
+   @param[in]     blockSize  number of samples in each vector
+   @return        none
+*/
+
+void plp_abs_i32s_rv32im(const int32_t * pSrc,
+                         int32_t * pDst,
+                         uint32_t blockSize);
+
+/** -------------------------------------------------------
+   @brief Element-by-element absolute value of 32-bit integer vectors kernel for XPULPV2 extension.
+   @param[in]     pSrc       points to the input vector
+   @param[out]    pDst       points to the output vector
+   @param[in]     blockSize  number of samples in each vector
+   @return        none
+*/
+
+void plp_abs_i32s_xpulpv2(const int32_t * pSrc,
+                          int32_t * pDst,
+                          uint32_t blockSize);
+
+/** -------------------------------------------------------
+   @brief Glue code for absolute value of 16-bit integer vectors.
+   @param[in]     pSrc       points to the input vector
+   @param[out]    pDst       points to the output vector
+   @param[in]     blockSize  number of samples in each vector
+   @return        none
+*/
+
+void plp_abs_i16(const int16_t * pSrc,
+                 int16_t * pDst,
+                 uint32_t blockSize);
+
+/** -------------------------------------------------------
+   @brief Element-by-element absolute value of 16-bit integer vectors kernel for RV32IM extension.
+   @param[in]     pSrc       points to the input vector
+   @param[out]    pDst       points to the output vector
+   @param[in]     blockSize  number of samples in each vector
+   @return        none
+*/
+
+void plp_abs_i16s_rv32im(const int16_t * pSrc,
+                         int16_t * pDst,
+                         uint32_t blockSize);
+
+/** -------------------------------------------------------
+   @brief Element-by-element absolute value of 16-bit integer vectors kernel for XPULPV2 extension.
+   @param[in]     pSrc       points to the input vector
+   @param[out]    pDst       points to the output vector
+   @param[in]     blockSize  number of samples in each vector
+   @return        none
+*/
+
+void plp_abs_i16s_xpulpv2(const int16_t * pSrc,
+                          int16_t * pDst,
+                          uint32_t blockSize);
+
+/** -------------------------------------------------------
+   @brief Glue code for absolute value of 8-bit integer vectors.
+   @param[in]     pSrc       points to the input vector
+   @param[out]    pDst       points to the output vector
+   @param[in]     blockSize  number of samples in each vector
+   @return        none
+*/
+
+void plp_abs_i8(const int8_t * pSrc,
+                 int8_t * pDst,
+                 uint32_t blockSize);
+
+/** -------------------------------------------------------
+   @brief Element-by-element absolute value of 8-bit integer vectors kernel for RV32IM extension.
+   @param[in]     pSrc       points to the input vector
+   @param[out]    pDst       points to the output vector
+   @param[in]     blockSize  number of samples in each vector
+   @return        none
+*/
+
+void plp_abs_i8s_rv32im(const int8_t * pSrc,
+                         int8_t * pDst,
+                         uint32_t blockSize);
+
+/** -------------------------------------------------------
+   @brief Element-by-element absolute value of 8-bit integer vectors kernel for XPULPV2 extension.
+   @param[in]     pSrc       points to the input vector
+   @param[out]    pDst       points to the output vector
+   @param[in]     blockSize  number of samples in each vector
+   @return        none
+*/
+
+void plp_abs_i8s_xpulpv2(const int8_t * pSrc,
+                          int8_t * pDst,
+                          uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for element-by-element addition of 32-bit integer vectors.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_add_i32(const int32_t * pSrcA,
+                 const int32_t * pSrcB,
+                 int32_t * pDst,
+                 uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element addition of 32-bit integer vectors kernel for RV32IM extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_add_i32s_rv32im(const int32_t * pSrcA,
+                         const int32_t * pSrcB,
+                         int32_t * pDst,
+                         uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element addition of 32-bit integer vectors kernel for XPULPV2 extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_add_i32s_xpulpv2(const int32_t * pSrcA,
+                          const int32_t * pSrcB,
+                          int32_t * pDst,
+                          uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for element-by-element addition of 16-bit integer vectors.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_add_i16(const int16_t * pSrcA,
+                 const int16_t * pSrcB,
+                 int32_t * pDst,
+                 uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element addition of 16-bit integer vectors kernel for RV32IM extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_add_i16s_rv32im(const int16_t * pSrcA,
+                         const int16_t * pSrcB,
+                         int32_t * pDst,
+                         uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element addition of 16-bit integer vectors kernel for XPULPV2 extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_add_i16s_xpulpv2(const int16_t * pSrcA,
+                          const int16_t * pSrcB,
+                          int32_t * pDst,
+                          uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for element-by-element addition of 8-bit integer vectors.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_add_i8(const int8_t * pSrcA,
+                 const int8_t * pSrcB,
+                 int32_t * pDst,
+                 uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element addition of 8-bit integer vectors kernel for RV32IM extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_add_i8s_rv32im(const int8_t * pSrcA,
+                         const int8_t * pSrcB,
+                         int32_t * pDst,
+                         uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element addition of 8-bit integer vectors kernel for XPULPV2 extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_add_i8s_xpulpv2(const int8_t * pSrcA,
+                          const int8_t * pSrcB,
+                          int32_t * pDst,
+                          uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for element-by-element multiplication of 32-bit integer vectors.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_mult_i32(const int32_t * pSrcA,
+                 const int32_t * pSrcB,
+                 int32_t * pDst,
+                 uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element multiplication of 32-bit integer vectors kernel for RV32IM extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_mult_i32s_rv32im(const int32_t * pSrcA,
+                         const int32_t * pSrcB,
+                         int32_t * pDst,
+                         uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element multiplication of 32-bit integer vectors kernel for XPULPV2 extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_mult_i32s_xpulpv2(const int32_t * pSrcA,
+                          const int32_t * pSrcB,
+                          int32_t * pDst,
+                          uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for element-by-element multiplication of 16-bit integer vectors.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_mult_i16(const int16_t * pSrcA,
+                 const int16_t * pSrcB,
+                 int32_t * pDst,
+                 uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element multiplication of 16-bit integer vectors kernel for RV32IM extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_mult_i16s_rv32im(const int16_t * pSrcA,
+                         const int16_t * pSrcB,
+                         int32_t * pDst,
+                         uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element multiplication of 16-bit integer vectors kernel for XPULPV2 extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_mult_i16s_xpulpv2(const int16_t * pSrcA,
+                          const int16_t * pSrcB,
+                          int32_t * pDst,
+                          uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for element-by-element multiplication of 8-bit integer vectors.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_mult_i8(const int8_t * pSrcA,
+                 const int8_t * pSrcB,
+                 int32_t * pDst,
+                 uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element multiplication of 8-bit integer vectors kernel for RV32IM extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_mult_i8s_rv32im(const int8_t * pSrcA,
+                         const int8_t * pSrcB,
+                         int32_t * pDst,
+                         uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element multiplication of 8-bit integer vectors kernel for XPULPV2 extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_mult_i8s_xpulpv2(const int8_t * pSrcA,
+                          const int8_t * pSrcB,
+                          int32_t * pDst,
+                          uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief      Glue code for filling a constant value into a 32-bit integer vector.
+    @param[in]  value      input value to be filled
+    @param[out] pDst       points to output vector
+    @param[in]  blockSize  number of samples in each vector
+    @return     none
+*/
+
+void plp_fill_i32(int32_t value, int32_t *__restrict__ pDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief      Fills a constant value into a 32-bit integer vector for RV32IM extension.
+    @param[in]  value      input value to be filled
+    @param[out] pDst       points to output vector
+    @param[in]  blockSize  number of samples in each vector
+    @return     none
+*/
+
+void plp_fill_i32s_rv32im(int32_t value, int32_t *__restrict__ pDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief      Fills a constant value into a 32-bit integer vector for XPULPV2 extension.
+    @param[in]  value      input value to be filled
+    @param[out] pDst       points to output vector
+    @param[in]  blockSize  number of samples in each vector
+    @return     none
+*/
+
+void plp_fill_i32s_xpulpv2(int32_t value, int32_t *__restrict__ pDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief      Glue code for copying the elements of a 32-bit integer vector
+    @param[in]  pSrc       points to input vector
+    @param[out] pDst       points to output vector
+    @param[in]  blockSize  number of samples in each vector
+    @return     none
+*/
+
+void plp_copy_i32(int32_t *__restrict__ pSrc, int32_t *__restrict__ pDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief      Copies the elements of a 32-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to input vector
+    @param[out] pDst       points to output vector
+    @param[in]  blockSize  number of samples in each vector
+    @return     none
+*/
+
+void plp_copy_i32s_rv32im(int32_t *__restrict__ pSrc,
+                          int32_t *__restrict__ pDst,
+                          uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief      Copies the elements of a 32-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to input vector
+    @param[out] pDst       points to output vector
+    @param[in]  blockSize  number of samples in each vector
+    @return     none
+*/
+
+void plp_copy_i32s_xpulpv2(int32_t *__restrict__ pSrc,
+                           int32_t *__restrict__ pDst,
+                           uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief      Glue code for copying the elements of a 32-bit float vector
+    @param[in]  pSrc       points to input vector
+    @param[out] pDst       points to output vector
+    @param[in]  blockSize  number of samples in each vector
+    @return     none
+*/
+
+void plp_copy_f32(float32_t *__restrict__ pSrc, float32_t *__restrict__ pDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief      Copies the elements of a 32-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to input vector
+    @param[out] pDst       points to output vector
+    @param[in]  blockSize  number of samples in each vector
+    @return     none
+*/
+
+void plp_copy_f32s_xpulpv2(float32_t *__restrict__ pSrc,
+                           float32_t *__restrict__ pDst,
+                           uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief      Glue code for executing a chain of parallel kernels on a persistent team. The team
+                is forked once, the steps are separated by rt_team_barrier.
+    @param[in]  pSteps     points to the chain of steps
+    @param[in]  numSteps   number of steps
+    @param[in]  nPE        number of parallel processing units
+    @return     none
+*/
+
+void plp_team_run(const plp_team_step *pSteps, uint32_t numSteps, uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief      Executes a chain of parallel kernels, called by every core of the team.
+    @param[in]  args  points to the plp_team_instance
+    @return     none
+*/
+
+void plp_team_run_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Initializes a scratch arena on a caller-provided buffer.
+    @param[out] S     points to the scratch arena
+    @param[in]  pBuf  points to the buffer, aligned to PLP_SCRATCH_ALIGNMENT bytes
+    @param[in]  size  size of the buffer in bytes
+    @return     none
+*/
+
+void plp_scratch_init(plp_scratch_instance *S, void *pBuf, uint32_t size);
+
+/** -------------------------------------------------------
+    @brief      Sets the scratch arena used by the glue functions for their temporaries.
+    @param[in]  S  points to an initialized scratch arena, NULL to use rt_alloc again
+    @return     none
+*/
+
+void plp_scratch_set(plp_scratch_instance *S);
+
+/** -------------------------------------------------------
+    @brief      Allocates a temporary buffer from the scratch arena, with rt_alloc as fallback.
+    @param[in]  flags  memory kind of rt_alloc, used by the fallback
+    @param[in]  size   size of the buffer in bytes
+    @return     pointer to the buffer, NULL if the fallback fails
+*/
+
+void *plp_scratch_alloc(int flags, uint32_t size);
+
+/** -------------------------------------------------------
+    @brief      Releases a buffer of plp_scratch_alloc, in the reverse order of allocation.
+    @param[in]  flags  memory kind of rt_alloc, used if the buffer was allocated by the fallback
+    @param[in]  p      points to the buffer
+    @param[in]  size   size of the buffer in bytes
+    @return     none
+*/
+
+void plp_scratch_free(int flags, void *p, uint32_t size);
+
+/** -------------------------------------------------------
+    @brief      Glue code for streaming a signal in L2 through double-buffered L1 tiles.
+    @param[in]  S    points to the streaming instance
+    @param[in]  nPE  number of parallel processing units
+    @return     none
+*/
+
+void plp_stream(const plp_stream_instance *S, uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief      Scratch memory of plp_stream.
+    @param[in]  S    points to the streaming instance
+    @param[in]  nPE  number of parallel processing units
+    @return     number of bytes which plp_stream takes from the scratch arena
+*/
+
+uint32_t plp_stream_scratch_size(const plp_stream_instance *S, uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief      Streams the tiles through L1 and computes them, called by every core of the team.
+    @param[in]  args  points to the plp_stream_arg
+    @return     none
+*/
+
+void plp_stream_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Combine function of the PLP_STREAM_REDUCE operations whose result is a 32-bit sum.
+    @param[in,out] pRes      points to the int32_t result
+    @param[in]     pPartial  points to the int32_t partial result of a tile
+    @return     none
+*/
+
+void plp_stream_sum_i32(void *pRes, const void *pPartial);
+
+/** -------------------------------------------------------
+    @brief      Plans a processing graph: fuses the chains of operation nodes and places the
+                intermediate buffers in L1 according to their liveness.
+    @param[in,out] G  points to the graph, fused, offset and footprint are set
+    @return     0: Success, 1: Invalid graph
+*/
+
+int plp_graph_plan(plp_graph_instance *G);
+
+/** -------------------------------------------------------
+    @brief      Scratch memory of plp_graph_run.
+    @param[in]  G    points to the planned graph
+    @param[in]  nPE  number of parallel processing units
+    @return     number of bytes which plp_graph_run takes from the scratch arena
+*/
+
+uint32_t plp_graph_scratch_size(const plp_graph_instance *G, uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief      Glue code for executing a planned processing graph inside one cluster fork.
+    @param[in]  G    points to the planned graph
+    @param[in]  nPE  number of parallel processing units
+    @return     none
+*/
+
+void plp_graph_run(const plp_graph_instance *G, uint32_t nPE);
+
+/** -------------------------------------------------------
+    @brief      Executes the nodes of a processing graph, called by every core of the team.
+    @param[in]  args  points to the plp_graph_arg
+    @return     none
+*/
+
+void plp_graph_run_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for the software pipeline of a FC and a cluster stage. Runs the FC stage
+                of frame n + 1 while the cluster computes frame n.
+    @param[in,out] S          points to the pipeline, the statistics are updated
+    @param[in]     numFrames  number of frames to compute
+    @return     none
+*/
+
+void plp_pipeline_run(plp_pipeline_instance *S, uint32_t numFrames);
+
+/** -------------------------------------------------------
+    @brief      Prints the utilization of the stages and the latency of the last run.
+    @param[in]  S  points to the pipeline
+    @return     none
+*/
+
+void plp_pipeline_print(const plp_pipeline_instance *S);
+
+/** -------------------------------------------------------
+    @brief      Consumes the frames of the pipeline on the cluster, called by core 0 of the cluster.
+    @param[in]  args  points to the plp_pipeline_arg
+    @return     none
+*/
+
+void plp_pipeline_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Sets the dispatch table of a function, e.g. a stored profile of plp_dispatch_tune.
+    @param[in]  func        function, e.g. PLP_DISPATCH_CONV_I16
+    @param[in]  pEntries    points to the entries sorted by maxLen, NULL to remove the table
+    @param[in]  numEntries  number of entries
+    @return     none
+*/
+
+void plp_dispatch_set(uint32_t func, const plp_dispatch_entry *pEntries, uint32_t numEntries);
+
+/** -------------------------------------------------------
+    @brief      Selects the number of cores and the variant of a function for a length.
+    @param[in]     func      function, e.g. PLP_DISPATCH_CONV_I16
+    @param[in]     len       length of the problem
+    @param[in,out] pNPE      number of cores requested by the caller, reduced to the selected one
+    @param[in,out] pVariant  default variant of the caller, replaced by the selected one. Can be
+                             NULL for functions without variants.
+    @return     none
+*/
+
+void plp_dispatch_select(uint32_t func, uint32_t len, uint32_t *pNPE, uint32_t *pVariant);
+
+/** -------------------------------------------------------
+    @brief      Measures the candidates of a function with rt_perf and sets its dispatch table.
+    @param[in]  func      function, e.g. PLP_DISPATCH_CONV_I16
+    @param[in]  pLens     points to the lengths to measure, in ascending order
+    @param[in]  numLens   number of lengths
+    @param[in]  maxPE     largest number of cores to try
+    @param[in]  run       calls the function once for a length with nPE cores
+    @param[in]  args      passed to run, e.g. the buffers
+    @param[out] pEntries  numLens entries of the dispatch table, must stay valid while it is used
+    @return     none
+*/
+
+void plp_dispatch_tune(uint32_t func,
+                       const uint32_t *pLens,
+                       uint32_t numLens,
+                       uint32_t maxPE,
+                       void (*run)(uint32_t len, uint32_t nPE, void *args),
+                       void *args,
+                       plp_dispatch_entry *pEntries);
+
+/** -------------------------------------------------------
+    @brief      Prints the profile of the glue functions as CSV, in the format of the benchmark
+                files of test/mrWolf/bench.py. Each line holds the average of a function on a core.
+    @return     none
+*/
+
+void plp_profile_dump(void);
+
+/** -------------------------------------------------------
+    @brief      Prints the number of calls and the minimum, average and maximum cycles of the glue
+                functions on each core.
+    @return     none
+*/
+
+void plp_profile_print(void);
+
+/** -------------------------------------------------------
+    @brief      Clears the statistics of all glue functions.
+    @return     none
+*/
+
+void plp_profile_reset(void);
+
+/** -------------------------------------------------------
+    @brief      Glue code for mean value of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    mean value returned here
+    @return     none
+*/
+
+void plp_mean_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for mean value of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    mean value returned here
+    @return     none
+*/
+
+void plp_mean_f32s_xpulpv2(const float *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for mean value of a 32-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    mean value returned here
+    @return     none
+*/
+
+void plp_mean_i32(const int32_t *__restrict__ pSrc, uint32_t blockSize, int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Mean value of a 32-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    mean value returned here
+    @return     none
+*/
+
+void plp_mean_i32s_rv32im(const int32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Mean value of a 32-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes    mean value returned here
+    @return     none
+*/
+
+void plp_mean_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for mean value of a 16-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    mean value returned here
+    @return     none
+*/
+
+void plp_mean_i16(const int16_t *__restrict__ pSrc, uint32_t blockSize, int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Mean value of a 16-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    mean value returned here
+    @return     none
+*/
+
+void plp_mean_i16s_rv32im(const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Mean value of a 16-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes    mean value returned here
+    @return     none
+*/
+
+void plp_mean_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for mean value of a 8-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    mean value returned here
+    @return     none
+*/
+
+void plp_mean_i8(const int8_t *__restrict__ pSrc, uint32_t blockSize, int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Mean value of a 8-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    mean value returned here
+    @return     none
+*/
+
+void plp_mean_i8s_rv32im(const int8_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Mean value of a 8-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes    mean value returned here
+    @return     none
+*/
+
+void plp_mean_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for max value of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    max value returned here
+    @return     none
+*/
+
+void plp_max_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Kernel for max value of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    max value returned here
+    @return     none
+*/
+
+void plp_max_f32s_xpulpv2(const float *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for max value of a 32-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    max value returned here
+    @return     none
+*/
+
+void plp_max_i32(const int32_t *__restrict__ pSrc, uint32_t blockSize, int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Max value of a 32-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    max value returned here
+    @return     none
+*/
+
+void plp_max_i32s_rv32im(const int32_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Max value of a 32-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes    max value returned here
+    @return     none
+*/
+
+void plp_max_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for max value of a 16-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    max value returned here
+    @return     none
+*/
+
+void plp_max_i16(const int16_t *__restrict__ pSrc, uint32_t blockSize, int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Max value of a 16-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    max value returned here
+    @return     none
+*/
+
+void plp_max_i16s_rv32im(const int16_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Max value of a 16-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes    max value returned here
+    @return     none
+*/
+
+void plp_max_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for max value of a 8-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    max value returned here
+    @return     none
+*/
+
+void plp_max_i8(const int8_t *__restrict__ pSrc, uint32_t blockSize, int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Max value of a 8-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    max value returned here
+    @return     none
+*/
+
+void plp_max_i8s_rv32im(const int8_t *__restrict__ pSrc,
+                        uint32_t blockSize,
+                        int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Max value of a 8-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes    max value returned here
+    @return     none
+*/
+
+void plp_max_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for min value of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    min value returned here
+    @return     none
+*/
+
+void plp_min_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Kernel for min value of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    min value returned here
+    @return     none
+*/
+
+void plp_min_f32s_xpulpv2(const float *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for min value of a 32-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    min value returned here
+    @return     none
+*/
+
+void plp_min_i32(const int32_t *__restrict__ pSrc, uint32_t blockSize, int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Min value of a 32-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    min value returned here
+    @return     none
+*/
+
+void plp_min_i32s_rv32im(const int32_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Min value of a 32-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes    min value returned here
+    @return     none
+*/
+
+void plp_min_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for min value of a 16-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    min value returned here
+    @return     none
+*/
+
+void plp_min_i16(const int16_t *__restrict__ pSrc, uint32_t blockSize, int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Min value of a 16-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    min value returned here
+    @return     none
+*/
+
+void plp_min_i16s_rv32im(const int16_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Min value of a 16-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes    min value returned here
+    @return     none
+*/
+
+void plp_min_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for min value of a 8-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    min value returned here
+    @return     none
+*/
+
+void plp_min_i8(const int8_t *__restrict__ pSrc, uint32_t blockSize, int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Min value of a 8-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    min value returned here
+    @return     none
+*/
+
+void plp_min_i8s_rv32im(const int8_t *__restrict__ pSrc,
+                        uint32_t blockSize,
+                        int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Min value of a 8-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes    min value returned here
+    @return     none
+*/
+
+void plp_min_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for Sum of squares of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Kernel for Sum of squares of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_f32_xpulpv2(const float *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for Sum of squares of a 32-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_i32(const int32_t *__restrict__ pSrc,
+                   uint32_t blockSize,
+                   int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Sum of squares of a 32-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_i32s_rv32im(const int32_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Sum of squares of a 32-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes    Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for Sum of squares of a 16-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_i16(const int16_t *__restrict__ pSrc,
+                   uint32_t blockSize,
+                   int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Sum of squares of a 16-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_i16s_rv32im(const int16_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Sum of squares of a 16-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes    Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for Sum of squares of a 8-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_i8(const int8_t *__restrict__ pSrc, uint32_t blockSize, int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Sum of squares of a 8-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_i8s_rv32im(const int8_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Sum of squares of a 8-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes    Sum of squares value returned here
+    @return     none
+*/
+
+void plp_power_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for Sum of squares of a 32-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_q32(const int32_t *__restrict__ pSrc,
+                   uint32_t blockSize,
+                   uint32_t fracBits,
+                   int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Sum of squares of a 32-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Sum of squares value returned here
+    @return     none
+*/
+
+void plp_power_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           uint32_t fracBits,
+                           int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Sum of squares of a 32-bit fixed point vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            uint32_t fracBits,
+                            int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for Sum of squares of a 16-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_q16(const int16_t *__restrict__ pSrc,
+                   uint32_t blockSize,
+                   uint32_t fracBits,
+                   int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Sum of squares of a 16-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           uint32_t fracBits,
+                           int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Sum of squares of a 16-bit fixed point vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            uint32_t fracBits,
+                            int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for Sum of squares of a 8-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_q8(const int8_t *__restrict__ pSrc,
+                  uint32_t blockSize,
+                  uint32_t fracBits,
+                  int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Sum of squares of a 8-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_q8s_rv32im(const int8_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t fracBits,
+                          int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Sum of squares of a 8-bit fixed point vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       Sum of squares value returned here
+    @return     none
+*/
+
+void plp_power_q8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           uint32_t fracBits,
+                           int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for Statisical variance of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical variance returned here
+    @return     none
+*/
+
+void plp_var_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Kernel for Statisical variance of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical variance returned here
+    @return     none
+*/
+
+void plp_var_f32_xpulpv2(const float *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for Statisical variance of a 32-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical variance returned here
+    @return     none
+*/
+
+void plp_var_q32(const int32_t *__restrict__ pSrc,
+                 uint32_t blockSize,
+                 uint32_t fracBits,
+                 int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Statisical variance of a 32-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical variance value returned here
+    @return     none
+*/
+
+void plp_var_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         uint32_t fracBits,
+                         int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Statisical variance of a 32-bit fixed point vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       Statisical variance returned here
+    @return     none
+*/
+
+void plp_var_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t fracBits,
+                          int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for Statisical variance of a 16-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical variance returned here
+    @return     none
+*/
+
+void plp_var_q16(const int16_t *__restrict__ pSrc,
+                 uint32_t blockSize,
+                 uint32_t fracBits,
+                 int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Statisical variance of a 16-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical variance returned here
+    @return     none
+*/
+
+void plp_var_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         uint32_t fracBits,
+                         int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Statisical variance of a 16-bit fixed point vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       Statisical variance returned here
+    @return     none
+*/
+
+void plp_var_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t fracBits,
+                          int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for Statisical variance of a 8-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical variance returned here
+    @return     none
+*/
+
+void plp_var_q8(const int8_t *__restrict__ pSrc,
+                uint32_t blockSize,
+                uint32_t fracBits,
+                int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Statisical variance of a 8-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical variance returned here
+    @return     none
+*/
+
+void plp_var_q8s_rv32im(const int8_t *__restrict__ pSrc,
+                        uint32_t blockSize,
+                        uint32_t fracBits,
+                        int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Statisical variance of a 8-bit fixed point vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       Statisical variance value returned here
+    @return     none
+*/
+
+void plp_var_q8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         uint32_t fracBits,
+                         int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for Statisical standard deviation of a 32-bit floating point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
+    @return     none
+*/
+
+void plp_std_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Kernel for Statisical standard deviation of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
+    @return     none
+*/
+
+void plp_std_f32_xpulpv2(const float *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for Statisical standard deviation of a 32-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
+    @return     none
+*/
+
+void plp_std_q32(const int32_t *__restrict__ pSrc,
+                 uint32_t blockSize,
+                 uint32_t fracBits,
+                 int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Statisical standard deviation of a 32-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation value returned here
+    @return     none
+*/
+
+void plp_std_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         uint32_t fracBits,
+                         int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Statisical standard deviation of a 32-bit fixed point vector for XPULPV2
+    extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       Statisical standard deviation returned here
+    @return     none
+*/
+
+void plp_std_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t fracBits,
+                          int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for Statisical standard deviation of a 16-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
+    @return     none
+*/
+
+void plp_std_q16(const int16_t *__restrict__ pSrc,
+                 uint32_t blockSize,
+                 uint32_t fracBits,
+                 int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Statisical standard deviation of a 16-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
+    @return     none
+*/
+
+void plp_std_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         uint32_t fracBits,
+                         int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Statisical standard deviation of a 16-bit fixed point vector for XPULPV2
+    extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       Statisical standard deviation returned here
+    @return     none
+*/
+
+void plp_std_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t fracBits,
+                          int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for Statisical standard deviation of a 8-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
+    @return     none
+*/
+
+void plp_std_q8(const int8_t *__restrict__ pSrc,
+                uint32_t blockSize,
+                uint32_t fracBits,
+                int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Statisical standard deviation of a 8-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
+    @return     none
+*/
+
+void plp_std_q8s_rv32im(const int8_t *__restrict__ pSrc,
+                        uint32_t blockSize,
+                        uint32_t fracBits,
+                        int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Statisical standard deviation of a 8-bit fixed point vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       Statisical standard deviation value returned here
+    @return     none
+*/
+
+void plp_std_q8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         uint32_t fracBits,
+                         int8_t *__restrict__ pRes);
+/** -------------------------------------------------------
+    @brief      Glue code for Statisical standard deviation of a 32-bit floating point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
+    @return     none
+*/
+
+void plp_rms_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Kernel for Statisical standard deviation of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
+    @return     none
+*/
+
+void plp_rms_f32_xpulpv2(const float *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for Statisical standard deviation of a 32-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
+    @return     none
+*/
+
+void plp_rms_q32(const int32_t *__restrict__ pSrc,
+                 uint32_t blockSize,
+                 uint32_t fracBits,
+                 int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Statisical standard deviation of a 32-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation value returned here
+    @return     none
+*/
+
+void plp_rms_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         uint32_t fracBits,
+                         int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Statisical standard deviation of a 32-bit fixed point vector for XPULPV2
+    extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       Statisical standard deviation returned here
+    @return     none
+*/
+
+void plp_rms_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t fracBits,
+                          int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for Statisical standard deviation of a 16-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
+    @return     none
+*/
+
+void plp_rms_q16(const int16_t *__restrict__ pSrc,
+                 uint32_t blockSize,
+                 uint32_t fracBits,
+                 int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Statisical standard deviation of a 16-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
+    @return     none
+*/
+
+void plp_rms_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         uint32_t fracBits,
+                         int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Statisical standard deviation of a 16-bit fixed point vector for XPULPV2
+    extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       Statisical standard deviation returned here
+    @return     none
+*/
+
+void plp_rms_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t fracBits,
+                          int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for Statisical standard deviation of a 8-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
+    @return     none
+*/
+
+void plp_rms_q8(const int8_t *__restrict__ pSrc,
+                uint32_t blockSize,
+                uint32_t fracBits,
+                int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Statisical standard deviation of a 8-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
+    @return     none
+*/
+
+void plp_rms_q8s_rv32im(const int8_t *__restrict__ pSrc,
+                        uint32_t blockSize,
+                        uint32_t fracBits,
+                        int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Statisical standard deviation of a 8-bit fixed point vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       Statisical standard deviation value returned here
+    @return     none
+*/
+
+void plp_rms_q8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         uint32_t fracBits,
+                         int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for square root of a 32-bit fixed point number.
+    @param[in]  in   32-Bit input integer
+    @param[out] out  Square root of the input
+    @return     none
+*/
+
+void plp_sqrt_q32(const int32_t *__restrict__ pSrc,
+                  const uint32_t fracBits,
+                  int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Square root of a 32-bit fixed point number for XPULPV2 extension.
+    @param[in]  in   32-Bit input integer
+    @param[out] out  Square root of the input
+    @return     none
+*/
+
+void plp_sqrt_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                          const uint32_t fracBits,
+                          int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Square root of a 32-bit fixed point number for XPULPV2 extension.
+    @param[in]  in   32-Bit input integer
+    @param[out] out  Square root of the input
+    @return     none
+*/
+
+void plp_sqrt_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                           const uint32_t fracBits,
+                           int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for square root of a 16-bit fixed point number.
+    @param[in]  in   16-Bit input integer
+    @param[out] out  Square root of the input
+    @return     none
+*/
+
+void plp_sqrt_q16(const int16_t *__restrict__ pSrc,
+                  const uint32_t fracBits,
+                  int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Square root of a 16-bit fixed point number for XPULPV2 extension.
+    @param[in]  in   16-Bit input integer
+    @param[out] out  Square root of the input
+    @return     none
+*/
+
+void plp_sqrt_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                          const uint32_t fracBits,
+                          int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Square root of a 16-bit fixed point number for XPULPV2 extension.
+    @param[in]  in   16-Bit input integer
+    @param[out] out  Square root of the input
+    @return     none
+*/
+
+void plp_sqrt_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                           const uint32_t fracBits,
+                           int16_t *__restrict__ pRes);
+
+/**
+ * @brief Macros required for SINE and COSINE Fast math approximations
+ */
+
+#define FAST_MATH_TABLE_SIZE 512
+#define FAST_MATH_Q32_SHIFT (32 - 10)
+#define FAST_MATH_Q16_SHIFT (16 - 10)
+#define CONTROLLER_Q32_SHIFT (32 - 9)
+#define TABLE_SPACING_Q32 0x400000
+#define TABLE_SPACING_Q16 0x80
+
+/**
+ * @brief      Glue code for q32 cosine function
+ *
+ * @param[in]  x     Scaled input value: Q1.31 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     cos(x)
+ */
+
+int32_t plp_cos_q32(int32_t x);
+
+/**
+ * @brief      q32 cosine function for RV32IM
+ *
+ * @param[in]  x     Scaled input value: Q1.31 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     cos(x)
+ */
+
+int32_t plp_cos_q32s_rv32im(int32_t x);
+
+/**
+ * @brief      q32 cosine function for XPULPV2
+ *
+ * @param[in]  x     Scaled input value: Q1.31 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     cos(x)
+ */
+
+int32_t plp_cos_q32s_xpulpv2(int32_t x);
+
+/**
+ * @brief      Glue code for q16 cosine function
+ *
+ * @param[in]  x     Scaled input value: Q1.15 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     cos(x)
+ */
+
+int16_t plp_cos_q16(int16_t x);
+
+/**
+ * @brief      q16 cosine function for RV32IM
+ *
+ * @param[in]  x     Scaled input value: Q1.15 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     cos(x)
+ */
+
+int16_t plp_cos_q16s_rv32im(int16_t x);
+
+/**
+ * @brief      q16 cosine function for XPULPV2
+ *
+ * @param[in]  x     Scaled input value: Q1.15 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     cos(x)
+ */
+
+int16_t plp_cos_q16s_xpulpv2(int16_t x);
+
+/**
+ * @brief      Glue code for f32 cosine function
+ *
+ * @param[in]  x     input value in radians
+ *
+ * @return     cos(x)
+ */
+
+float32_t plp_cos_f32(float32_t x);
+
+/**
+ * @brief      F32 cosine function for XPULPV2
+ *
+ * @param[in]  x     input value in radians
+ *
+ * @return     cos(x)
+ */
+
+float32_t plp_cos_f32s_xpulpv2(float32_t x);
+
+/**
+ * @brief      Glue code for q32 sine function
+ *
+ * @param[in]  x     Scaled input value: Q1.31 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     sin(x)
+ */
+
+int32_t plp_sin_q32(int32_t x);
+
+/**
+ * @brief      q32 sine function for RV32IM
+ *
+ * @param[in]  x     Scaled input value: Q1.31 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     sin(x)
+ */
+
+int32_t plp_sin_q32s_rv32im(int32_t x);
+
+/**
+ * @brief      q32 sine function for XPULPV2
+ *
+ * @param[in]  x     Scaled input value: Q1.31 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     sin(x)
+ */
+
+int32_t plp_sin_q32s_xpulpv2(int32_t x);
+
+/**
+ * @brief      Glue code for q16 sine function
+ *
+ * @param[in]  x     Scaled input value: Q1.15 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     sin(x)
+ */
+
+int16_t plp_sin_q16(int16_t x);
+
+/**
+ * @brief      q16 sine function for RV32IM
+ *
+ * @param[in]  x     Scaled input value: Q1.15 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     sin(x)
+ */
+
+int16_t plp_sin_q16s_rv32im(int16_t x);
+
+/**
+ * @brief      q16 sine function for XPULPV2
+ *
+ * @param[in]  x     Scaled input value: Q1.15 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     sin(x)
+ */
+
+int16_t plp_sin_q16s_xpulpv2(int16_t x);
+
+/**
+ * @brief      Glue code for f32 sine function
+ *
+ * @param[in]  x     input value in radians
+ *
+ * @return     sin(x)
+ */
+
+float32_t plp_sin_f32(float32_t x);
+
+/**
+ * @brief      F32 sine function for XPULPV2
+ *
+ * @param[in]  x     input value in radians
+ *
+ * @return     sin(x)
+ */
+
+float32_t plp_sin_f32s_xpulpv2(float32_t x);
+
+/** -------------------------------------------------------
+    @brief Glue code for correlation of 32-bit integer vectors.
+    @param[in]  pSrcA   points to the first input vector
+    @param[in]  srcALen Length of the first input vector
+    @param[in]  pSrcB   points to the second input vector
+    @param[in]  srcBLen Length of the second input vector
+    @param[out] pRes    output result returned here
+    @return     none
+*/
+
+void plp_correlate_i32(const int32_t *pSrcA,
+                       const uint32_t srcALen,
+                       const int32_t *pSrcB,
+                       const uint32_t srcBLen,
+                       int32_t *pRes);
+
+/** -------------------------------------------------------
+    @brief Correlation of 32-bit integer vectors kernel for RV32IM extension.
+    @param[in]  pSrcA   points to the first input vector
+    @param[in]  srcALen Length of the first input vector
+    @param[in]  pSrcB   points to the second input vector
+    @param[in]  srcBLen Length of the second input vector
+    @param[out] pRes    output result returned here
+    @return     none
+*/
+
+void plp_correlate_i32s_rv32im(const int32_t *pSrcA,
+                               const uint32_t srcALen,
+                               const int32_t *pSrcB,
+                               const uint32_t srcBLen,
+                               int32_t *pRes);
+
+/** -------------------------------------------------------
+    @brief Correlation of 32-bit integer vectors kernel for XPULPV2 extension.
+    @param[in]  pSrcA   points to the first input vector
+    @param[in]  srcALen Length of the first input vector
+    @param[in]  pSrcB   points to the second input vector
+    @param[in]  srcBLen Length of the second input vector
+    @param[out] pRes    output result returned here
+    @return     none */
+
+void plp_correlate_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                const uint32_t srcALen,
+                                const int32_t *__restrict__ pSrcB,
+                                const uint32_t srcBLen,
+                                int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+  @brief Glue code for correlation of 16-bit integer vectors.
+  @param[in]  pSrcA   points to the first input vector
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector
+  @param[in]  srcBLen Length of the second input vector
+  @param[out] pRes    result returned here
+  @return     none
+ */
+
+void plp_correlate_i16(const int16_t *pSrcA,
+                       const uint32_t srcALen,
+                       const int16_t *pSrcB,
+                       const uint32_t srcBLen,
+                       int32_t *pRes);
+
+/** -------------------------------------------------------
+   @brief Correlation of 16-bit integer vectors kernel for XPULPV2 extension.
+   @param[in]  pSrcA   points to the first input vector
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
+   @return     none
+*/
+
+void plp_correlate_i16s_xpulpv2(const int16_t *pSrcA,
+                                const uint32_t srcALen,
+                                const int16_t *pSrcB,
+                                const uint32_t srcBLen,
+                                int32_t *pRes);
+
+/** -------------------------------------------------------
+   @brief Correlation of 16-bit integer vectors kernel for RV32IM extension.
+   @param[in]  pSrcA   points to the first input vector
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
+   @return     none
+*/
+
+void plp_correlate_i16s_rv32im(const int16_t *pSrcA,
+                               const uint32_t srcALen,
+                               const int16_t *pSrcB,
+                               const uint32_t srcBLen,
+                               int32_t *pRes);
+
+/** -------------------------------------------------------
+  @brief Glue code for correlation of 8-bit integer vectors.
+  @param[in]  pSrcA   points to the first input vector
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector
+  @param[in]  srcBLen Length of the second input vector
+  @param[out] pRes    output result returned here
+  @return     none
+ */
+
+void plp_correlate_i8(const int8_t *pSrcA,
+                      const uint32_t srcALen,
+                      const int8_t *pSrcB,
+                      const uint32_t srcBLen,
+                      int32_t *pRes);
+
+/** -------------------------------------------------------
+  @brief Glue code for correlation (valid) of 8-bit integer vectors.
+  @param[in]  pSrcA   points to the first input vector
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector
+  @param[in]  srcBLen Length of the second input vector
+  @param[out] pRes    output result returned here
+  @return     none
+ */
+
+void plp_correlate_valid_i8(const int8_t *pSrcA,
+                            const uint32_t srcALen,
+                            const int8_t *pSrcB,
+                            const uint32_t srcBLen,
+                            int32_t *pRes);
+
+/** -------------------------------------------------------
+   @brief Correlation of 8-bit integer vectors kernel for XPULPV2 extension.
+   @param[in]  pSrcA   points to the first input vector
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
+   @return     none
+*/
+
+void plp_correlate_i8s_xpulpv2(const int8_t *pSrcA,
+                               const uint32_t srcALen,
+                               const int8_t *pSrcB,
+                               const uint32_t srcBLen,
+                               int32_t *pRes);
+
+/** -------------------------------------------------------
+   @brief Correlation of 8-bit integer vectors kernel for RV32IM extension.
+   @param[in]  pSrcA   points to the first input vector
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
+   @return     none
+*/
+
+void plp_correlate_i8s_rv32im(const int8_t *pSrcA,
+                              const uint32_t srcALen,
+                              const int8_t *pSrcB,
+                              const uint32_t srcBLen,
+                              int32_t *pRes);
+
+/** -------------------------------------------------------
+  @brief Glue code for convolution of 32-bit integer vectors.
+  @param[in]  pSrcA    points to the first input vector
+  @param[in]  srcALen  Length of the first input vector
+  @param[in]  pSrcB    points to the second input vector
+  @param[in]  srcBLen  Length of the second input vector
+  @param[out] pRes     result returned here
+  @return     none
+ */
+
+void plp_conv_i32(const int32_t *pSrcA,
+                  const uint32_t srcALen,
+                  const int32_t *pSrcB,
+                  const uint32_t srcBLen,
+                  int32_t *pRes);
+
+/** -------------------------------------------------------
+  @brief Worst-case scratch memory of plp_conv_i32.
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  srcBLen Length of the second input vector
+  @return     number of bytes which plp_conv_i32 takes from the scratch arena
+ */
+
+uint32_t plp_conv_i32_scratch_size(const uint32_t srcALen, const uint32_t srcBLen);
+
+/** -------------------------------------------------------
+  @brief Glue code for convolution (valid) of 32-bit integer vectors.
+  @param[in]  pSrcA   points to the first input vector
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector
+  @param[in]  srcBLen Length of the second input vector
+  @param[out] pRes    output result returned here
+  @return     none
+ */
+
+void plp_conv_valid_i32(const int32_t *pSrcA,
+                        const uint32_t srcALen,
+                        const int32_t *pSrcB,
+                        const uint32_t srcBLen,
+                        int32_t *pRes);
+
+/** -------------------------------------------------------
+   @brief Convolution of 32-bit integer vectors kernel for RV32IM extension.
+   @param[in]  pSrcA   points to the first input vector
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
+   @return     none
+*/
+
+void plp_conv_i32s_rv32im(const int32_t *pSrcA,
+                          const uint32_t srcALen,
+                          const int32_t *pSrcB,
+                          const uint32_t srcBLen,
+                          int32_t *pRes);
+
+/** -------------------------------------------------------
+   @brief Convolution of 32-bit integer vectors kernel for XPULPV2 extension.
+   @param[in]  pSrcA   points to the first input vector
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
+   @return     none
+*/
+
+void plp_conv_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                           const uint32_t srcALen,
+                           const int32_t *__restrict__ pSrcB,
+                           const uint32_t srcBLen,
+                           int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+   @brief Convolution (valid) of 32-bit integer vectors kernel for XPULPV2 extension.
+   @param[in]  pSrcA   points to the first input vector
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
+   @return     none */
+
+void plp_conv_valid_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                 const uint32_t srcALen,
+                                 const int32_t *__restrict__ pSrcB,
+                                 const uint32_t srcBLen,
+                                 int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+  @brief Glue code for convolution of 16-bit integer vectors.
+  @param[in]  pSrcA   points to the first input vector
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector
+  @param[in]  srcBLen Length of the second input vector
+  @param[out] pRes    output result returned here
+  @return     none
+ */
+
+void plp_conv_i16(const int16_t *pSrcA,
+                  const uint32_t srcALen,
+                  const int16_t *pSrcB,
+                  const uint32_t srcBLen,
+                  int32_t *pRes);
+
+/** -------------------------------------------------------
+  @brief Worst-case scratch memory of plp_conv_i16.
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  srcBLen Length of the second input vector
+  @return     number of bytes which plp_conv_i16 takes from the scratch arena
+ */
+
+uint32_t plp_conv_i16_scratch_size(const uint32_t srcALen, const uint32_t srcBLen);
+
+/** -------------------------------------------------------
+  @brief Glue code for convolution (valid) of 16-bit integer vectors.
+  @param[in]  pSrcA   points to the first input vector
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector
+  @param[in]  srcBLen Length of the second input vector
+  @param[out] pRes    output result returned here
+  @return     none
+ */
+
+void plp_conv_valid_i16(const int16_t *pSrcA,
+                        const uint32_t srcALen,
+                        const int16_t *pSrcB,
+                        const uint32_t srcBLen,
+                        int32_t *pRes);
+
+/** -------------------------------------------------------
+  @brief Glue code for convolution (valid with replication) of 16-bit integer vectors.
+  @param[in]  pSrcA   points to the first input vector
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector
+  @param[in]  srcBLen Length of the second input vector
+  @param[out] pRes    output result returned here
+  @return     none
+ */
+
+void plp_conv_valid_rep_i16(const int16_t *pSrcA,
+                            const uint32_t srcALen,
+                            const int16_t *pSrcB,
+                            const uint32_t srcBLen,
+                            int32_t *pRes);
+
+/** -------------------------------------------------------
+  @brief Worst-case scratch memory of plp_conv_valid_rep_i16.
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  srcBLen Length of the second input vector
+  @return     number of bytes which plp_conv_valid_rep_i16 takes from the scratch arena
+ */
+
+uint32_t plp_conv_valid_rep_i16_scratch_size(const uint32_t srcALen, const uint32_t srcBLen);
+
+/** -------------------------------------------------------
+   @brief Convolution of 16-bit integer vectors kernel for XPULPV2 extension.
+   @param[in]  pSrcA   points to the first input vector
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
+   @return     none
+*/
+
+void plp_conv_i16s_xpulpv2(const int16_t *pSrcA,
+                           const uint32_t srcALen,
+                           const int16_t *pSrcB,
+                           const uint32_t srcBLen,
+                           int32_t *pRes);
+
+/** -------------------------------------------------------
+   @brief Convolution (valid) of 16-bit integer vectors kernel for XPULPV2 extension.
+   @param[in]  pSrcA   points to the first input vector
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
+   @return     none
+*/
+
+void plp_conv_valid_i16s_xpulpv2(const int16_t *pSrcA,
+                                 const uint32_t srcALen,
+                                 const int16_t *pSrcB,
+                                 const uint32_t srcBLen,
+                                 int32_t *pRes);
+
+/** -------------------------------------------------------
+   @brief Convolution (valid with data replication) of 16-bit integer vectors kernel for XPULPV2
+   extension.
+   @param[in]  pSrcA   points to the first input vector of the replicated data
+   @param[in]  srcALen Number of elements in (unreplicated) vector a
+   @param[in]  srcAMem Number of elements between each replication
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
+   @return     none
+*/
+
+void plp_conv_valid_rep_i16s_xpulpv2(const int16_t *pSrcA,
+                                     const uint32_t srcALen,
+                                     const uint32_t srcAMem,
+                                     const int16_t *pSrcB,
+                                     const uint32_t srcBLen,
+                                     int32_t *pRes);
+
+/** -------------------------------------------------------
+   @brief Convolution of 16-bit integer vectors kernel for RV32IM extension.
+   @param[in]  pSrcA   points to the first input vector
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
+   @return     none
+*/
+
+void plp_conv_i16s_rv32im(const int16_t *pSrcA,
+                          const uint32_t srcALen,
+                          const int16_t *pSrcB,
+                          const uint32_t srcBLen,
+                          int32_t *pRes);
+
+/** -------------------------------------------------------
+  @brief Glue code for convolution of 8-bit integer vectors.
+  @param[in]  pSrcA   points to the first input vector
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector
+  @param[in]  srcBLen Length of the second input vector
+  @param[out] pRes    output result returned here
+  @return     none
+ */
+
+void plp_conv_i8(const int8_t *pSrcA,
+                 const uint32_t srcALen,
+                 const int8_t *pSrcB,
+                 const uint32_t srcBLen,
+                 int32_t *pRes);
+
+/** -------------------------------------------------------
+  @brief Worst-case scratch memory of plp_conv_i8.
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  srcBLen Length of the second input vector
+  @return     number of bytes which plp_conv_i8 takes from the scratch arena
+ */
+
+uint32_t plp_conv_i8_scratch_size(const uint32_t srcALen, const uint32_t srcBLen);
+
+/** -------------------------------------------------------
+  @brief Glue code for convolution (valid) of 8-bit integer vectors.
+  @param[in]  pSrcA   points to the first input vector
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector
+  @param[in]  srcBLen Length of the second input vector
+  @param[out] pRes    output result returned here
+  @return     none
+ */
+
+void plp_conv_valid_i8(const int8_t *pSrcA,
+                       const uint32_t srcALen,
+                       const int8_t *pSrcB,
+                       const uint32_t srcBLen,
+                       int32_t *pRes);
+
+/** -------------------------------------------------------
+  @brief Glue code for convolution (valid with data replication) of 8-bit integer vectors.
+  @param[in]  pSrcA   points to the first input vector (in L2)
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector (in L2)
+  @param[in]  srcBLen Length of the second input vector
+  @param[out] pRes    output result returned here (preferably in L1)
+  @return     none
+ */
+
+void plp_conv_valid_rep_i8(const int8_t *pSrcA,
+                           const uint32_t srcALen,
+                           const int8_t *pSrcB,
+                           const uint32_t srcBLen,
+                           int32_t *pRes);
+
+/** -------------------------------------------------------
+  @brief Worst-case scratch memory of plp_conv_valid_rep_i8.
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  srcBLen Length of the second input vector
+  @return     number of bytes which plp_conv_valid_rep_i8 takes from the scratch arena
+ */
+
+uint32_t plp_conv_valid_rep_i8_scratch_size(const uint32_t srcALen, const uint32_t srcBLen);
+
+/** -------------------------------------------------------
+   @brief Convolution of 8-bit integer vectors kernel for XPULPV2 extension.
+   @param[in]  pSrcA   points to the first input vector
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
+   @return     none
+*/
+
+void plp_conv_i8s_xpulpv2(const int8_t *pSrcA,
+                          const uint32_t srcALen,
+                          const int8_t *pSrcB,
+                          const uint32_t srcBLen,
+                          int32_t *pRes);
+
+/** -------------------------------------------------------
+   @brief Convolution (valid) of 8-bit integer vectors kernel for XPULPV2 extension.
+   @param[in]  pSrcA   points to the first input vector
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
+   @return     none
+*/
+
+void plp_conv_valid_i8s_xpulpv2(const int8_t *pSrcA,
+                                const uint32_t srcALen,
+                                const int8_t *pSrcB,
+                                const uint32_t srcBLen,
+                                int32_t *pRes);
+
+/** -------------------------------------------------------
+   @brief Convolution (valid with data replication) of 8-bit integer vectors kernel for XPULPV2
+   extension.
+   @param[in]  pSrcA   points to the first input vector of the replicated data
+   @param[in]  srcALen Number of elements in (unreplicated) vector a
+   @param[in]  srcAMem Number of elements between each replication
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
+   @return     none
+*/
+
+void plp_conv_valid_rep_i8s_xpulpv2(const int8_t *pSrcA,
+                                    const uint32_t srcALen,
+                                    const uint32_t srcAMem,
+                                    const int8_t *pSrcB,
+                                    const uint32_t srcBLen,
+                                    int32_t *pRes);
+
+/** -------------------------------------------------------
+   @brief Convolution of 8-bit integer vectors kernel for RV32IM extension.
+   @param[in]  pSrcA   points to the first input vector
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
+   @return     none
+*/
+
+void plp_conv_i8s_rv32im(const int8_t *pSrcA,
+                         const uint32_t srcALen,
+                         const int8_t *pSrcB,
+                         const uint32_t srcBLen,
+                         int32_t *pRes);
+
+/** -------------------------------------------------------
+  @brief Glue code for parallel convolution of 32-bit integer vectors.
+  @param[in]  pSrcA   points to the first input vector
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector
+  @param[in]  srcBLen Length of the second input vector
+  @param[in]  nPE     Number of cores to compute on
+  @param[out] pRes    output result returned here
+  @return     none
+ */
+
+void plp_conv_i32_parallel(const int32_t *pSrcA,
+                           const uint32_t srcALen,
+                           const int32_t *pSrcB,
+                           const uint32_t srcBLen,
+                           const uint8_t nPE,
+                           int32_t *pRes);
+
+/** -------------------------------------------------------
+  @brief Worst-case scratch memory of plp_conv_i32_parallel.
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  srcBLen Length of the second input vector
+  @param[in]  nPE     Number of cores to compute on
+  @return     number of bytes which plp_conv_i32_parallel takes from the scratch arena
+ */
+
+uint32_t plp_conv_i32_parallel_scratch_size(const uint32_t srcALen,
+                                            const uint32_t srcBLen,
+                                            const uint8_t nPE);
+
+/** -------------------------------------------------------
+  @brief Setup code for parallel convolution of 32-bit integer vectors.
+  @param[in]  task_args      pointer to plp_conv_instance_i32 struct initialized by
+                             plp_conv_i32_parallel
+  @return     none
+ */
+
+void plp_conv_i32p_xpulpv2(void *task_args);
+
+/** -------------------------------------------------------
+  @brief Glue code for parallel convolution of 16-bit integer vectors.
+  @param[in]  pSrcA   points to the first input vector
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector
+  @param[in]  srcBLen Length of the second input vector
+  @param[in]  nPE     Number of cores to compute on
+  @param[out] pRes    output result returned here
+  @return     none
+ */
+
+void plp_conv_i16_parallel(const int16_t *pSrcA,
+                           const uint32_t srcALen,
+                           const int16_t *pSrcB,
+                           const uint32_t srcBLen,
+                           const uint8_t nPE,
+                           int32_t *pRes);
+
+/** -------------------------------------------------------
+  @brief Worst-case scratch memory of plp_conv_i16_parallel.
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  srcBLen Length of the second input vector
+  @param[in]  nPE     Number of cores to compute on
+  @return     number of bytes which plp_conv_i16_parallel takes from the scratch arena
+ */
+
+uint32_t plp_conv_i16_parallel_scratch_size(const uint32_t srcALen,
+                                            const uint32_t srcBLen,
+                                            const uint8_t nPE);
+/** -------------------------------------------------------
+  @brief Setup code for parallel convolution of 16-bit integer vectors.
+  @param[in]  task_args  pointer to plp_conv_instance_i16 struct initialized by
+                         plp_conv_i16_parallel
+  @return     none
+ */
+
+void plp_conv_i16p_xpulpv2(void *task_args);
+
+/** -------------------------------------------------------
+  @brief Glue code for parallel convolution of 8-bit integer vectors.
+  @param[in]  pSrcA   points to the first input vector
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector
+  @param[in]  srcBLen Length of the second input vector
+  @param[in]  nPE     Number of cores to compute on
+  @param[out] pRes    output result returned here
+  @return     none
+ */
+
+void plp_conv_i8_parallel(const int8_t *pSrcA,
+                          const uint32_t srcALen,
+                          const int8_t *pSrcB,
+                          const uint32_t srcBLen,
+                          const uint8_t nPE,
+                          int32_t *pRes);
+
+/** -------------------------------------------------------
+  @brief Worst-case scratch memory of plp_conv_i8_parallel.
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  srcBLen Length of the second input vector
+  @param[in]  nPE     Number of cores to compute on
+  @return     number of bytes which plp_conv_i8_parallel takes from the scratch arena
+ */
+
+uint32_t plp_conv_i8_parallel_scratch_size(const uint32_t srcALen,
+                                           const uint32_t srcBLen,
+                                           const uint8_t nPE);
+/** -------------------------------------------------------
+  @brief Setup code for parallel convolution of 8-bit integer vectors.
+  @param[in]  task_args  pointer to plp_conv_instance_i8 struct initialized by
+                         plp_conv_i8_parallel
+  @return     none
+ */
+
+void plp_conv_i8p_xpulpv2(void *task_args);
+
+/** -------------------------------------------------------
+   @brief Helper function for parallelized overlap-adding of partial convolution results
+   @param[in] nPE Number of processing cores
+   @param[in] srcALen Length of the first original input vector
+   @param[in] srcBLen Length of the second original input vector
+   @param[in] resultsBuffer resultsBuffer array from plp_conv_i[XX]_parallel
+   @return none
+*/
+
+void plp_conv_parallel_OLA(uint32_t nPE,
+                           uint32_t srcALen,
+                           uint32_t srcBLen,
+                           int32_t *resultsBuffer);
+
+/** -------------------------------------------------------
+   @brief Helper function for parallelized overlap-adding of partial convolution results
+   @param[in] task_args  Holds the plp_conv_tree_add_instance that describes the vector parameters
+   @return none
+*/
+void plp_conv_parallel_OLA_kernel(void *task_args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for matrix matrix multiplication of a 32-bit integer matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_i32(const int32_t *__restrict__ pSrcA,
+                      const int32_t *__restrict__ pSrcB,
+                      uint32_t M,
+                      uint32_t N,
+                      uint32_t O,
+                      int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Matrix matrix multiplication of a 32-bit integer matrices for RV32IM extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_i32s_rv32im(const int32_t *__restrict__ pSrcA,
+                              const int32_t *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t O,
+                              int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Matrix matrix multiplication of a 32-bit integer matrices for XPULPV2 extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                               const int32_t *__restrict__ pSrcB,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t O,
+                               int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for matrix matrix multiplication of a 16-bit integer matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_i16(const int16_t *__restrict__ pSrcA,
+                      const int16_t *__restrict__ pSrcB,
+                      uint32_t M,
+                      uint32_t N,
+                      uint32_t O,
+                      int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Matrix matrix multiplication of a 16-bit integer matrices for RV32IM extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_i16s_rv32im(const int16_t *__restrict__ pSrcA,
+                              const int16_t *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t O,
+                              int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Matrix matrix multiplication of a 16-bit integer matrices for XPULPV2 extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Exploiting SIMD instructions
+   The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+   performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                               const int16_t *__restrict__ pSrcB,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t O,
+                               int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for matrix matrix multiplication of a 8-bit integer matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_i8(const int8_t *__restrict__ pSrcA,
+                     const int8_t *__restrict__ pSrcB,
+                     uint32_t M,
+                     uint32_t N,
+                     uint32_t O,
+                     int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Matrix matrix multiplication of a 8-bit integer matrices for RV32IM extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_i8s_rv32im(const int8_t *__restrict__ pSrcA,
+                             const int8_t *__restrict__ pSrcB,
+                             uint32_t M,
+                             uint32_t N,
+                             uint32_t O,
+                             int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Matrix matrix multiplication of a 8-bit integer matrices for XPULPV2 extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Exploiting SIMD instructions
+   The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+   performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                              const int8_t *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t O,
+                              int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel matrix matrix multiplication of a 32-bit integer matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  nPE   Number of cores to use
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_i32_parallel(const int32_t *__restrict__ pSrcA,
+                               const int32_t *__restrict__ pSrcB,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t O,
+                               uint32_t nPE,
+                               int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Parallel matrix matrix multiplication of a 32-bit integer matrices for XPULPV2
+               extension.
+   @param[in]  args  pointer to plp_mat_mult_instance_i32 struct initialized by
+                     plp_mat_mult_i32_parallel
+   @return     none
+*/
+
+void plp_mat_mult_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel matrix matrix multiplication of a 16-bit integer matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  nPE   Number of cores to use
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_i16_parallel(const int16_t *__restrict__ pSrcA,
+                               const int16_t *__restrict__ pSrcB,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t O,
+                               uint32_t nPE,
+                               int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+    @brief Parallel matrix multiplication of 16-bit integer matrices kernel for XPULPV2 extension.
+    @param[in]  args  pointer to plp_mat_mult_instance_i16 struct initialized by
+                      plp_mat_mult_i16_parallel
+    @return     none
+
+    @par Exploiting SIMD instructions
+    The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+    performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel matrix matrix multiplication of a 8-bit integer matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  nPE   Number of cores to use
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_i8_parallel(const int8_t *__restrict__ pSrcA,
+                              const int8_t *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t O,
+                              uint32_t nPE,
+                              int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for matrix matrix multiplication of a 32-bit floating-point matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_f32(const float *__restrict__ pSrcA,
+                      const float *__restrict__ pSrcB,
+                      uint32_t M,
+                      uint32_t N,
+                      uint32_t O,
+                      float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Matrix matrix multiplication of a 32-bit floating-point matrices for XPULPV2
+               extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                               const float *__restrict__ pSrcB,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t O,
+                               float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel matrix matrix multiplication of a 32-bit floating-point
+   matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  nPE   Number of cores to use
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_f32_parallel(const float *__restrict__ pSrcA,
+                               const float *__restrict__ pSrcB,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t O,
+                               uint32_t nPE,
+                               float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+    @brief      Parallel matrix multiplication of 32-bit floating-point matrices kernel for XPULPV2
+                extension.
+    @param[in]  args  pointer to plp_mat_mult_instance_f32 struct initialized by
+                      plp_mat_mult_f32_parallel
+    @return     none
+*/
+
+void plp_mat_mult_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Parallel matrix multiplication of 8-bit integer matrices kernel for XPULPV2
+               extension.
+   @param[in]  args  pointer to plp_mat_mult_instance_i8 struct initialized by
+                     plp_mat_mult_i8_parallel
+   @return     none
+
+   @par Exploiting SIMD instructions
+   The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+   performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for matrix matrix multiplication of a 32-bit fix-point matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+ */
+
+void plp_mat_mult_q32(const int32_t *__restrict__ pSrcA,
+                      const int32_t *__restrict__ pSrcB,
+                      uint32_t M,
+                      uint32_t N,
+                      uint32_t O,
+                      uint32_t shift,
+                      int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel matrix matrix multiplication of a 32-bit fix-point
+               matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[in]  nPE   Number of cores to use
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+ */
+
+void plp_mat_mult_q32_parallel(const int32_t *__restrict__ pSrcA,
+                               const int32_t *__restrict__ pSrcB,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t O,
+                               uint32_t shift,
+                               uint32_t nPE,
+                               int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Matrix matrix multiplication of a 32-bit fix-point matrices for RV32IM extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+*/
+
+void plp_mat_mult_q32s_rv32im(const int32_t *__restrict__ pSrcA,
+                              const int32_t *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t O,
+                              uint32_t shift,
+                              int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Matrix matrix multiplication of a 32-bit fix-point matrices for XPULPV2 extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+*/
+
+void plp_mat_mult_q32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                               const int32_t *__restrict__ pSrcB,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t O,
+                               uint32_t shift,
+                               int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+    @brief Parallel matrix multiplication of 32-bit fix-point matrices kernel for XPULPV2 extension.
+    @param[in]  args  pointer to plp_mat_mult_instance_q32 struct initialized by
+                      plp_mat_mult_q32_parallel
+    @return     none
+*/
+
+void plp_mat_mult_q32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for matrix matrix multiplication of a 16-bit fix-point matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+   The output of the matrix multiplication will also be stored as an 16-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+ */
+
+void plp_mat_mult_q16(const int16_t *__restrict__ pSrcA,
+                      const int16_t *__restrict__ pSrcB,
+                      uint32_t M,
+                      uint32_t N,
+                      uint32_t O,
+                      uint32_t shift,
+                      int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel matrix matrix multiplication of a 16-bit fix-point
+  matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[in]  nPE   Number of cores to use
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+   The output of the matrix multiplication will also be stored as an 16-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+ */
+
+void plp_mat_mult_q16_parallel(const int16_t *__restrict__ pSrcA,
+                               const int16_t *__restrict__ pSrcB,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t O,
+                               uint32_t shift,
+                               uint32_t nPE,
+                               int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Matrix matrix multiplication of a 16-bit fix-point matrices for RV32IM extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+   The output of the matrix multiplication will also be stored as an 16-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+*/
+
+void plp_mat_mult_q16s_rv32im(const int16_t *__restrict__ pSrcA,
+                              const int16_t *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t O,
+                              uint32_t shift,
+                              int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Matrix matrix multiplication of a 16-bit fix-point matrices for XPULPV2 extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+   The output of the matrix multiplication will also be stored as an 16-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+*/
+
+void plp_mat_mult_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                               const int16_t *__restrict__ pSrcB,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t O,
+                               uint32_t shift,
+                               int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+    @brief Parallel matrix multiplication of 16-bit fix-point matrices kernel for XPULPV2 extension.
+    @param[in]  args  pointer to plp_mat_mult_instance_q16 struct initialized by
+                      plp_mat_mult_q16_parallel
+    @return     none
+*/
+
+void plp_mat_mult_q16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for matrix matrix multiplication of a 8-bit fix-point matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+   The output of the matrix multiplication will also be stored as an 8-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+ */
+
+void plp_mat_mult_q8(const int8_t *__restrict__ pSrcA,
+                     const int8_t *__restrict__ pSrcB,
+                     uint32_t M,
+                     uint32_t N,
+                     uint32_t O,
+                     uint32_t shift,
+                     int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel matrix matrix multiplication of a 8-bit fix-point matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[in]  nPE   Number of cores to use
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+   The output of the matrix multiplication will also be stored as an 8-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+ */
+
+void plp_mat_mult_q8_parallel(const int8_t *__restrict__ pSrcA,
+                              const int8_t *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t O,
+                              uint32_t shift,
+                              uint32_t nPE,
+                              int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Matrix matrix multiplication of a 8-bit fix-point matrices for RV32IM extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+   The output of the matrix multiplication will also be stored as an 8-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+*/
+
+void plp_mat_mult_q8s_rv32im(const int8_t *__restrict__ pSrcA,
+                             const int8_t *__restrict__ pSrcB,
+                             uint32_t M,
+                             uint32_t N,
+                             uint32_t O,
+                             uint32_t shift,
+                             int8_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief Parallel dot product with interleaved access of 32-bit fixed point vectors kernel for
-    XPULPV2 extension.
-    @param[in]  S     points to the instance structure for fixed point parallel dot product
-    @return     none
-*/
+   @brief      Matrix matrix multiplication of a 8-bit fix-point matrices for XPULPV2 extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
 
-void plp_dot_prod_q32p_xpulpv2(void *S);
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
 
-/** -------------------------------------------------------
-    @brief Parallel dot product with interleaved access of 32-bit float vectors kernel for XPULPV2
-    extension.
-    @param[in]  S     points to the instance structure for float parallel dot product
-    @return     none
+   The output of the matrix multiplication will also be stored as an 8-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
 */
 
-void plp_dot_prod_f32p_xpulpv2(void *S);
+void plp_mat_mult_q8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                              const int8_t *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t O,
+                              uint32_t shift,
+                              int8_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief Glue code for dot product of 32-bit integer vectors.
-    @param[in]  pSrcA      points to the first input vector
-    @param[in]  pSrcB      points to the second input vector
-    @param[in]  blockSize  number of samples in each vector
-    @param[out] pRes       output result returned here
+    @brief Parallel matrix multiplication of 8-bit fix-point matrices kernel for XPULPV2 extension.
+    @param[in]  args  pointer to plp_mat_mult_instance_q8 struct initialized by
+                      plp_mat_mult_q8_parallel
+    @return     none
 */
-void plp_dot_prod_i32(const int32_t *__restrict__ pSrcA,
-                      const int32_t *__restrict__ pSrcB,
-                      uint32_t blockSize,
-                      int32_t *__restrict__ pRes);
 
-/** -------------------------------------------------------
-    @brief Scalar dot product of 32-bit integer vectors kernel for RV32IM extension.
-    @param[in]  pSrcA      points to the first input vector
-    @param[in]  pSrcB      points to the second input vector
-    @param[in]  blockSize  number of samples in each vector
-    @param[out] pRes       output result returned here
-*/
-void plp_dot_prod_i32s_rv32im(const int32_t *__restrict__ pSrcA,
-                              const int32_t *__restrict__ pSrcB,
-                              uint32_t blockSize,
-                              int32_t *__restrict__ pRes);
+void plp_mat_mult_q8p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-    @brief Scalar dot product of 32-bit integer vectors kernel for XPULPV2 extension.
-    @param[in]  pSrcA      points to the first input vector
-    @param[in]  pSrcB      points to the second input vector
-    @param[in]  blockSize  number of samples in each vector
-    @param[out] pRes       output result returned here
+  @brief      Glue code of matrix matrix multiplication for complex 32-bit integers
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
 */
-void plp_dot_prod_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
-                               const int32_t *__restrict__ pSrcB,
-                               uint32_t blockSize,
-                               int32_t *__restrict__ pRes);
+
+void plp_mat_mult_cmplx_i32(const int32_t *__restrict__ pSrcA,
+                            const int32_t *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t O,
+                            int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief Glue code for dot product of 32-bit fixed point vectors.
-    @param[in]  pSrcA      points to the first input vector
-    @param[in]  pSrcB      points to the second input vector
-    @param[in]  blockSize  number of samples in each vector
-    @param[in]  deciPoint  decimal point for right shift
-    @param[out] pRes       output result returned here
-    @return     none
+  @brief      Matrix matrix multiplication for complex 32-bit integers on RV32IM
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
 */
 
-void plp_dot_prod_q32(const int32_t *__restrict__ pSrcA,
-                      const int32_t *__restrict__ pSrcB,
-                      uint32_t blockSize,
-                      uint32_t deciPoint,
-                      int32_t *__restrict__ pRes);
+void plp_mat_mult_cmplx_i32s_rv32im(const int32_t *__restrict__ pSrcA,
+                                    const int32_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief Scalar dot product of 32-bit fixed point vectors kernel for RV32IM extension.
-    @param[in]  pSrcA      points to the first input vector
-    @param[in]  pSrcB      points to the second input vector
-    @param[in]  blockSize  number of samples in each vector
-    @param[in]  deciPoint  decimal point for right shift
-    @param[out] pRes       output result returned here
-    @return     none
+  @brief      Matrix matrix multiplication for complex 32-bit integers on XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
 */
 
-void plp_dot_prod_q32s_rv32im(const int32_t *__restrict__ pSrcA,
-                              const int32_t *__restrict__ pSrcB,
-                              uint32_t blockSize,
-                              uint32_t deciPoint,
-                              int32_t *__restrict__ pRes);
+void plp_mat_mult_cmplx_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                     const int32_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief Scalar dot product of 32-bit fixed point vectors kernel for XPULPV2 extension.
-    @param[in]  pSrcA      points to the first input vector
-    @param[in]  pSrcB      points to the second input vector
-    @param[in]  blockSize  number of samples in each vector
-    @param[in]  deciPoint  decimal point for right shift
-    @param[out] pRes       output result returned here
-    @return     none
+  @brief      Glue code of parallel matrix matrix multiplication for complex 32-bit integers
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
 */
 
-void plp_dot_prod_q32s_xpulpv2(const int32_t *__restrict__ pSrcA,
-                               const int32_t *__restrict__ pSrcB,
-                               uint32_t blockSize,
-                               uint32_t deciPoint,
-                               int32_t *__restrict__ pRes);
+void plp_mat_mult_cmplx_i32_parallel(const int32_t *__restrict__ pSrcA,
+                                     const int32_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t nPE,
+                                     int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief Glue code for dot product of 32-bit float vectors.
-    @param[in]  pSrcA      points to the first input vector
-    @param[in]  pSrcB      points to the second input vector
-    @param[in]  blockSize  number of samples in each vector
-    @param[out] pRes       output result returned here
-    @return     none
+  @brief      parallel matrix matrix multiplication for complex 32-bit integers on XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_i32 struct initialized by
+                    plp_mat_mult_cmplx_i32_parallel
+  @return     none
 */
 
-void plp_dot_prod_f32(const float32_t *__restrict__ pSrcA,
-                      const float32_t *__restrict__ pSrcB,
-                      uint32_t blockSize,
-                      float32_t *__restrict__ pRes);
+void plp_mat_mult_cmplx_i32p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-    @brief Glue code for dot product of 32-bit float vectors.
-    @param[in]  pSrcA      points to the first input vector
-    @param[in]  pSrcB      points to the second input vector
-    @param[in]  blockSize  number of samples in each vector
-    @param[out] pRes       output result returned here
-    @return     none
+  @brief      Glue code of matrix matrix multiplication for complex 16-bit integers
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
 */
 
-void plp_dot_prod_f32s_xpulpv2(const float32_t *__restrict__ pSrcA,
-                               const float32_t *__restrict__ pSrcB,
-                               uint32_t blockSize,
-                               float32_t *__restrict__ pRes);
+void plp_mat_mult_cmplx_i16(const int16_t *__restrict__ pSrcA,
+                            const int16_t *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t O,
+                            int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief Glue code for dot product of 16-bit integer vectors.
-    @param[in]  pSrcA      points to the first input vector [16 bit]
-    @param[in]  pSrcB      points to the second input vector [16 bit]
-    @param[in]  blockSize  number of samples in each vector
-    @param[out] pRes       output result returned here [32 bit]
-
-    @par Exploiting SIMD instructions
-    When the ISA supports, the 16 bit values are packed two by two into 32 bit vectors and then the
-    two dot products are performed simultaneously on 32 bit vectors, with 32 bit accumulator.
+  @brief      Matrix matrix multiplication for complex 16-bit integers on RV32IM
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
 */
-void plp_dot_prod_i16(const int16_t *pSrcA,
-                      const int16_t *pSrcB,
-                      uint32_t blockSize,
-                      int32_t *__restrict__ pRes);
 
-/** -------------------------------------------------------
-    @brief Vectorized dot product of 16-bit integer vectors kernel for RV32IM extension.
-    @param[in]  pSrcA      points to the first input vector [16 bit]
-    @param[in]  pSrcB      points to the second input vector [16 bit]
-    @param[in]  blockSize  number of samples in each vector
-    @param[out] pRes       output result returned here [32 bit]
-    @return     none
+void plp_mat_mult_cmplx_i16s_rv32im(const int16_t *__restrict__ pSrcA,
+                                    const int16_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    int32_t *__restrict__ pDstC);
 
-    @par Exploiting SIMD instructions
-    When the ISA supports, the 16 bit values are packed two by two into 32 bit vectors and then the
-    two dot products are performed simultaneously on 32 bit vectors, with 32 bit accumulator. RV32IM
-    doesn't support SIMD. For SIMD, check out other ISA extensions (e.g. XPULPV2).
+/** -------------------------------------------------------
+  @brief      Matrix matrix multiplication for complex 16-bit integers on XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Blocking
+  Uses the kernel plp_mat_mult_cmplx_stride_i16s_xpulpv2, which computes blocks of 2x2 output
+  elements.
 */
 
-void plp_dot_prod_i16s_rv32im(const int16_t *__restrict__ pSrcA,
-                              const int16_t *__restrict__ pSrcB,
-                              uint32_t blockSize,
-                              int32_t *__restrict__ pRes);
+void plp_mat_mult_cmplx_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                     const int16_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief Vectorized dot product of 16-bit integer vectors kernel singlecore for XPULPV2 extension.
-    @param[in]  pSrcA      points to the first input vector [16 bit]
-    @param[in]  pSrcB      points to the second input vector [16 bit]
-    @param[in]  blockSize  number of samples in each vector
-    @param[out] pRes       output result returned here [32 bit]
-    @return     none
-
-    @par Exploiting SIMD instructions
-    The 16 bit values are packed two by two into 32 bit vectors and then the two dot products are
-    performed simultaneously on 32 bit vectors.
+  @brief      Glue code of parallel matrix matrix multiplication for complex 16-bit integers
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
 */
 
-void plp_dot_prod_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
-                               const int16_t *__restrict__ pSrcB,
-                               uint32_t blockSize,
-                               int32_t *__restrict__ pRes);
+void plp_mat_mult_cmplx_i16_parallel(const int16_t *__restrict__ pSrcA,
+                                     const int16_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t nPE,
+                                     int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief Glue code for dot product of 16-bit fixed point vectors.
-    @param[in]  pSrcA      points to the first input vector [16 bit]
-    @param[in]  pSrcB      points to the second input vector [16 bit]
-    @param[in]  blockSize  number of samples in each vector
-    @param[in]  deciPoint  decimal point for right shift
-    @param[out] pRes       output result returned here [32 bit]
-    @return     none
+  @brief      parallel matrix matrix multiplication for complex 16-bit integers on XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_i16 struct initialized by
+                    plp_mat_mult_cmplx_i16_parallel
+  @return     none
 
-    @par Exploiting SIMD instructions
-    The 16 bit values are packed two by two into 32 bit vectors and then the two dot products are
-    performed simultaneously on 32 bit vectors, with 32 bit accumulator.
+  @par Blocking
+  Uses the kernel plp_mat_mult_cmplx_stride_i16p_xpulpv2, which computes blocks of 2x2 output
+  elements.
 */
 
-void plp_dot_prod_q16(const int16_t *__restrict__ pSrcA,
-                      const int16_t *__restrict__ pSrcB,
-                      uint32_t blockSize,
-                      uint32_t deciPoint,
-                      int32_t *__restrict__ pRes);
+void plp_mat_mult_cmplx_i16p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-    @brief Scalar dot product of 16-bit fixed point vectors kernel for RV32IM extension.
-    @param[in]  pSrcA      points to the first input vector [16 bit]
-    @param[in]  pSrcB      points to the second input vector [16 bit]
-    @param[in]  blockSize  number of samples in each vector
-    @param[in]  deciPoint  decimal point for right shift
-    @param[out] pRes       output result returned here [32 bit]
-    @return     none
-
-    @par Exploiting SIMD instructions
-    When the ISA supports, the 16 bit values are packed two by two into 32 bit vectors and then the
-    two dot products are performed simultaneously on 32 bit vectors, with 32 bit accumulator. RV32IM
-    doesn't support SIMD. For SIMD, check out other ISA extensions (e.g. XPULPV2).
+  @brief      Glue code of matrix matrix multiplication for complex 8-bit integers
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
 */
 
-void plp_dot_prod_q16s_rv32im(const int16_t *__restrict__ pSrcA,
-                              const int16_t *__restrict__ pSrcB,
-                              uint32_t blockSize,
-                              uint32_t deciPoint,
-                              int32_t *__restrict__ pRes);
+void plp_mat_mult_cmplx_i8(const int8_t *__restrict__ pSrcA,
+                           const int8_t *__restrict__ pSrcB,
+                           uint32_t M,
+                           uint32_t N,
+                           uint32_t O,
+                           int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief Vectorized dot product of 16-bit fixed point vectors singlecore kernel for XPULPV2
-   extension.
-    @param[in]  pSrcA      points to the first input vector [16 bit]
-    @param[in]  pSrcB      points to the second input vector [16 bit]
-    @param[in]  blockSize  number of samples in each vector
-    @param[in]  deciPoint  decimal point for right shift
-    @param[out] pRes       output result returned here [32 bit]
-    @return     none
-
-    @par Exploiting SIMD instructions
-    The 16 bit values are packed two by two into 32 bit vectors and then the two dot products are
-    performed simultaneously on 32 bit vectors, with 32 bit accumulator.
+  @brief      Matrix matrix multiplication for complex 8-bit integers on RV32IM
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
 */
 
-void plp_dot_prod_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
-                               const int16_t *__restrict__ pSrcB,
-                               uint32_t blockSize,
-                               uint32_t deciPoint,
-                               int32_t *__restrict__ pRes);
+void plp_mat_mult_cmplx_i8s_rv32im(const int8_t *__restrict__ pSrcA,
+                                   const int8_t *__restrict__ pSrcB,
+                                   uint32_t M,
+                                   uint32_t N,
+                                   uint32_t O,
+                                   int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief Glue code for dot product of 8-bit integer vectors.
-    @param[in]  pSrcA      points to the first input vector [8 bit]
-    @param[in]  pSrcB      points to the second input vector [8 bit]
-    @param[in]  blockSize  number of samples in each vector
-    @param[out] pRes       output result returned here [32 bit]
-    @return     none
+  @brief      Matrix matrix multiplication for complex 8-bit integers on XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
 
-    @par Exploiting SIMD instructions
-    When the ISA supports, the 8 bit values are packed four by four into 32 bit vectors and then the
-    four dot products are performed simultaneously on 32 bit vectors, with 32 bit accumulator.
+  @par Blocking
+  Uses the kernel plp_mat_mult_cmplx_stride_i8s_xpulpv2, which computes blocks of 2x2 output
+  elements.
 */
 
-void plp_dot_prod_i8(const int8_t *__restrict__ pSrcA,
-                     const int8_t *__restrict__ pSrcB,
-                     uint32_t blockSize,
-                     int32_t *__restrict__ pRes);
+void plp_mat_mult_cmplx_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                    const int8_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief Vectorized dot product of 8-bit integer vectors kernel for RV32IM extension.
-    @param[in]  pSrcA      points to the first input vector [8] bit]
-    @param[in]  pSrcB      points to the second input vector [8 bit]
-    @param[in]  blockSize  number of samples in each vector
-    @param[out] pRes       output result returned here [32 bit]
-    @return     none
-
-    @par Exploiting SIMD instructions
-    When the ISA supports, the 8 bit values are packed four by four into 32 bit vectors and then the
-    four dot products are performed simultaneously on 32 bit vectors, with 32 bit accumulator.
-    RV32IM doesn't support SIMD. For SIMD, check out other ISA extensions (e.g. XPULPV2).
+  @brief      Glue code of parallel matrix matrix multiplication for complex 8-bit integers
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
 */
 
-void plp_dot_prod_i8s_rv32im(const int8_t *__restrict__ pSrcA,
-                             const int8_t *__restrict__ pSrcB,
-                             uint32_t blockSize,
-                             int32_t *__restrict__ pRes);
+void plp_mat_mult_cmplx_i8_parallel(const int8_t *__restrict__ pSrcA,
+                                    const int8_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    uint32_t nPE,
+                                    int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief Vectorized dot product of 8-bit integer vectors singlecore kernel for XPULPV2 extension.
-    @param[in]  pSrcA      points to the first input vector [8 bit]
-    @param[in]  pSrcB      points to the second input vector [8 bit]
-    @param[in]  blockSize  number of samples in each vector
-    @param[out] pRes       output result returned here [32 bit]
-    @return     none
+  @brief      parallel matrix matrix multiplication for complex 8-bit integers on XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_i8 struct initialized by
+                    plp_mat_mult_cmplx_i8_parallel
+  @return     none
 
-    @par Exploiting SIMD instructions
-    The 8 bit values are packed four by four into 32 bit vectors and then the four dot products are
-    performed on 32 bit vectors, with 32 bit accumulator.
+  @par Blocking
+  Uses the kernel plp_mat_mult_cmplx_stride_i8p_xpulpv2, which computes blocks of 2x2 output
+  elements.
 */
 
-void plp_dot_prod_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
-                              const int8_t *__restrict__ pSrcB,
-                              uint32_t blockSize,
-                              int32_t *__restrict__ pRes);
+void plp_mat_mult_cmplx_i8p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-    @brief Glue code for dot product of 8-bit fixed point vectors.
-    @param[in]  pSrcA      points to the first input vector [8 bit]
-    @param[in]  pSrcB      points to the second input vector [8 bit]
-    @param[in]  blockSize  number of samples in each vector
-    @param[in]  deciPoint  decimal point for right shift
-    @param[out] pRes       output result returned here [32 bit]
-    @return     none
-
-    @par Exploiting SIMD instructions
-    When the ISA supports, the 8 bit values are packed four by four into 32 bit vectors and then the
-    four dot products are performed simultaneously on 32 bit vectors, with 32 bit accumulator.
+  @brief      Glue code of matrix matrix multiplication for complex 32-bit floats
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
 */
 
-void plp_dot_prod_q8(const int8_t *__restrict__ pSrcA,
-                     const int8_t *__restrict__ pSrcB,
-                     uint32_t blockSize,
-                     uint32_t deciPoint,
-                     int32_t *__restrict__ pRes);
+void plp_mat_mult_cmplx_f32(const float *__restrict__ pSrcA,
+                            const float *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t O,
+                            float *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief Scalar dot product of 8-bit fixed point vectors kernel for RV32IM extension.
-    @param[in]  pSrcA      points to the first input vector [8 bit]
-    @param[in]  pSrcB      points to the second input vector [8 bit]
-    @param[in]  blockSize  number of samples in each vector
-    @param[in]  deciPoint  decimal point for right shift
-    @param[out] pRes       output result returned here [32 bit]
-    @return     none
+  @brief      Matrix matrix multiplication for complex 32-bit floats on XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
 
-    @par Exploiting SIMD instructions
-    When the ISA supports, the 8 bit values are packed four by four into 32 bit vectors and then the
-    four dot products are performed simultaneously on 32 bit vectors, with 32 bit accumulator.
-    RV32IM doesn't support SIMD. For SIMD, check out other ISA extensions (e.g. XPULPV2).
+  @par Blocking
+  Uses the kernel plp_mat_mult_cmplx_stride_f32s_xpulpv2, which computes blocks of 2x2 output
+  elements.
+*/
+
+void plp_mat_mult_cmplx_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                                     const float *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Glue code of parallel matrix matrix multiplication for complex 32-bit floats
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
 */
 
-void plp_dot_prod_q8s_rv32im(const int8_t *__restrict__ pSrcA,
-                             const int8_t *__restrict__ pSrcB,
-                             uint32_t blockSize,
-                             uint32_t deciPoint,
-                             int32_t *__restrict__ pRes);
+void plp_mat_mult_cmplx_f32_parallel(const float *__restrict__ pSrcA,
+                                     const float *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t nPE,
+                                     float *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief Scalar dot product of 8-bit fixed point vectors singlecore kernel for XPULPV2 extension.
-    @param[in]  pSrcA      points to the first input vector [8 bit]
-    @param[in]  pSrcB      points to the second input vector [8 bit]
-    @param[in]  blockSize  number of samples in each vector
-    @param[in]  deciPoint  decimal point for right shift
-    @param[out] pRes       output result returned here [32 bit]
-    @return     none
+  @brief      parallel matrix matrix multiplication for complex 32-bit floats on XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_f32 struct initialized by
+                    plp_mat_mult_cmplx_f32_parallel
+  @return     none
 
-    @par Exploiting SIMD instructions
-    The 8 bit values are packed four by four into 32 bit vectors and then the four dot products are
-    performed on 32 bit vectors, with 32 bit accumulator.
+  @par Blocking
+  Uses the kernel plp_mat_mult_cmplx_stride_f32p_xpulpv2, which computes blocks of 2x2 output
+  elements.
 */
 
-void plp_dot_prod_q8s_xpulpv2(const int8_t *__restrict__ pSrcA,
-                              const int8_t *__restrict__ pSrcB,
-                              uint32_t blockSize,
-                              uint32_t deciPoint,
-                              int32_t *__restrict__ pRes);
+void plp_mat_mult_cmplx_f32p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-   @brief Glue code for absolute value of 32-bit integer vectors.
-   @param[in]     pSrc       points to the input vector
-   @param[out]    pDst       points to the output vector
-   @param[in]     blockSize  number of samples in each vector
-   @return        none
+  @brief      Glue code of matrix matrix multiplication for complex 32-bit fix-point
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
 */
 
-void plp_abs_i32(const int32_t * pSrc,
-                 int32_t * pDst,
-                 uint32_t blockSize);
+void plp_mat_mult_cmplx_q32(const int32_t *__restrict__ pSrcA,
+                            const int32_t *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t O,
+                            uint32_t shift,
+                            int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief Element-by-element absolute value of 32-bit integer vectors kernel for RV32IM extension.
-   @param[in]     pSrc       points to the input vector
-   @param[out]    pDst       points to the output vector
-   @param[in]     blockSize  number of samples in each vector
-   @return        none
+  @brief      Matrix matrix multiplication for complex 32-bit fix-point on RV32IM
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
 */
 
-void plp_abs_i32s_rv32im(const int32_t * pSrc,
-                         int32_t * pDst,
-                         uint32_t blockSize);
+void plp_mat_mult_cmplx_q32s_rv32im(const int32_t *__restrict__ pSrcA,
+                                    const int32_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    uint32_t shift,
+                                    int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief Element-by-element absolute value of 32-bit integer vectors kernel for XPULPV2 extension.
-   @param[in]     pSrc       points to the input vector
-   @param[out]    pDst       points to the output vector
-   @param[in]     blockSize  number of samples in each vector
-   @return        none
+  @brief      Matrix matrix multiplication for complex 32-bit fix-point on XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
 */
 
-void plp_abs_i32s_xpulpv2(const int32_t * pSrc,
-                          int32_t * pDst,
-                          uint32_t blockSize);
+void plp_mat_mult_cmplx_q32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                     const int32_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t shift,
+                                     int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief Glue code for absolute value of 16-bit integer vectors.
-   @param[in]     pSrc       points to the input vector
-   @param[out]    pDst       points to the output vector
-   @param[in]     blockSize  number of samples in each vector
-   @return        none
+  @brief      Glue code of parallel matrix matrix multiplication for complex 32-bit fix-point
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
 */
 
-void plp_abs_i16(const int16_t * pSrc,
-                 int16_t * pDst,
-                 uint32_t blockSize);
+void plp_mat_mult_cmplx_q32_parallel(const int32_t *__restrict__ pSrcA,
+                                     const int32_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t shift,
+                                     uint32_t nPE,
+                                     int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief Element-by-element absolute value of 16-bit integer vectors kernel for RV32IM extension.
-   @param[in]     pSrc       points to the input vector
-   @param[out]    pDst       points to the output vector
-   @param[in]     blockSize  number of samples in each vector
-   @return        none
+  @brief      parallel matrix matrix multiplication for complex 32-bit fix-point on XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_q32 struct initialized by
+                    plp_mat_mult_cmplx_q32_parallel
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
 */
 
-void plp_abs_i16s_rv32im(const int16_t * pSrc,
-                         int16_t * pDst,
-                         uint32_t blockSize);
+void plp_mat_mult_cmplx_q32p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-   @brief Element-by-element absolute value of 16-bit integer vectors kernel for XPULPV2 extension.
-   @param[in]     pSrc       points to the input vector
-   @param[out]    pDst       points to the output vector
-   @param[in]     blockSize  number of samples in each vector
-   @return        none
+  @brief      Glue code of matrix matrix multiplication for complex 16-bit fix-point
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
 */
 
-void plp_abs_i16s_xpulpv2(const int16_t * pSrc,
-                          int16_t * pDst,
-                          uint32_t blockSize);
+void plp_mat_mult_cmplx_q16(const int16_t *__restrict__ pSrcA,
+                            const int16_t *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t O,
+                            uint32_t shift,
+                            int16_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief Glue code for absolute value of 8-bit integer vectors.
-   @param[in]     pSrc       points to the input vector
-   @param[out]    pDst       points to the output vector
-   @param[in]     blockSize  number of samples in each vector
-   @return        none
+  @brief      Matrix matrix multiplication for complex 16-bit fix-point on RV32IM
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
 */
 
-void plp_abs_i8(const int8_t * pSrc,
-                 int8_t * pDst,
-                 uint32_t blockSize);
+void plp_mat_mult_cmplx_q16s_rv32im(const int16_t *__restrict__ pSrcA,
+                                    const int16_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    uint32_t shift,
+                                    int16_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief Element-by-element absolute value of 8-bit integer vectors kernel for RV32IM extension.
-   @param[in]     pSrc       points to the input vector
-   @param[out]    pDst       points to the output vector
-   @param[in]     blockSize  number of samples in each vector
-   @return        none
-*/
+  @brief      Matrix matrix multiplication for complex 16-bit fix-point on XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
 
-void plp_abs_i8s_rv32im(const int8_t * pSrc,
-                         int8_t * pDst,
-                         uint32_t blockSize);
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
 
-/** -------------------------------------------------------
-   @brief Element-by-element absolute value of 8-bit integer vectors kernel for XPULPV2 extension.
-   @param[in]     pSrc       points to the input vector
-   @param[out]    pDst       points to the output vector
-   @param[in]     blockSize  number of samples in each vector
-   @return        none
+  @par Blocking
+  Uses the kernel plp_mat_mult_cmplx_stride_q16s_xpulpv2, which computes blocks of 2x2 output
+  elements.
 */
 
-void plp_abs_i8s_xpulpv2(const int8_t * pSrc,
-                          int8_t * pDst,
-                          uint32_t blockSize);
+void plp_mat_mult_cmplx_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                     const int16_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t shift,
+                                     int16_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief Glue code for element-by-element addition of 32-bit integer vectors.
-    @param[in]     pSrcA      points to first input vector
-    @param[in]     pSrcB      points to second input vector
-    @param[out]    pDst       points to output vector
-    @param[in]     blockSize  number of samples in each vector
-    @return        none
+  @brief      Glue code of parallel matrix matrix multiplication for complex 16-bit fix-point
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
 */
 
-void plp_add_i32(const int32_t * pSrcA,
-                 const int32_t * pSrcB,
-                 int32_t * pDst,
-                 uint32_t blockSize);
+void plp_mat_mult_cmplx_q16_parallel(const int16_t *__restrict__ pSrcA,
+                                     const int16_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t shift,
+                                     uint32_t nPE,
+                                     int16_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief Element-by-element addition of 32-bit integer vectors kernel for RV32IM extension.
-    @param[in]     pSrcA      points to first input vector
-    @param[in]     pSrcB      points to second input vector
-    @param[out]    pDst       points to output vector
-    @param[in]     blockSize  number of samples in each vector
-    @return        none
-*/
+  @brief      parallel matrix matrix multiplication for complex 16-bit fix-point on XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_q16 struct initialized by
+                    plp_mat_mult_cmplx_q16_parallel
+  @return     none
 
-void plp_add_i32s_rv32im(const int32_t * pSrcA,
-                         const int32_t * pSrcB,
-                         int32_t * pDst,
-                         uint32_t blockSize);
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
 
-/** -------------------------------------------------------
-    @brief Element-by-element addition of 32-bit integer vectors kernel for XPULPV2 extension.
-    @param[in]     pSrcA      points to first input vector
-    @param[in]     pSrcB      points to second input vector
-    @param[out]    pDst       points to output vector
-    @param[in]     blockSize  number of samples in each vector
-    @return        none
+  @par Blocking
+  Uses the kernel plp_mat_mult_cmplx_stride_q16p_xpulpv2, which computes blocks of 2x2 output
+  elements.
 */
 
-void plp_add_i32s_xpulpv2(const int32_t * pSrcA,
-                          const int32_t * pSrcB,
-                          int32_t * pDst,
-                          uint32_t blockSize);
+void plp_mat_mult_cmplx_q16p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-    @brief Glue code for element-by-element addition of 16-bit integer vectors.
-    @param[in]     pSrcA      points to first input vector
-    @param[in]     pSrcB      points to second input vector
-    @param[out]    pDst       points to output vector
-    @param[in]     blockSize  number of samples in each vector
-    @return        none
+  @brief      Glue code of matrix matrix multiplication for complex 8-bit fix-point
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
 */
 
-void plp_add_i16(const int16_t * pSrcA,
-                 const int16_t * pSrcB,
-                 int32_t * pDst,
-                 uint32_t blockSize);
+void plp_mat_mult_cmplx_q8(const int8_t *__restrict__ pSrcA,
+                           const int8_t *__restrict__ pSrcB,
+                           uint32_t M,
+                           uint32_t N,
+                           uint32_t O,
+                           uint32_t shift,
+                           int8_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief Element-by-element addition of 16-bit integer vectors kernel for RV32IM extension.
-    @param[in]     pSrcA      points to first input vector
-    @param[in]     pSrcB      points to second input vector
-    @param[out]    pDst       points to output vector
-    @param[in]     blockSize  number of samples in each vector
-    @return        none
+  @brief      Matrix matrix multiplication for complex 8-bit fix-point on RV32IM
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
 */
 
-void plp_add_i16s_rv32im(const int16_t * pSrcA,
-                         const int16_t * pSrcB,
-                         int32_t * pDst,
-                         uint32_t blockSize);
+void plp_mat_mult_cmplx_q8s_rv32im(const int8_t *__restrict__ pSrcA,
+                                   const int8_t *__restrict__ pSrcB,
+                                   uint32_t M,
+                                   uint32_t N,
+                                   uint32_t O,
+                                   uint32_t shift,
+                                   int8_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief Element-by-element addition of 16-bit integer vectors kernel for XPULPV2 extension.
-    @param[in]     pSrcA      points to first input vector
-    @param[in]     pSrcB      points to second input vector
-    @param[out]    pDst       points to output vector
-    @param[in]     blockSize  number of samples in each vector
-    @return        none
+  @brief      Matrix matrix multiplication for complex 8-bit fix-point on XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
 */
 
-void plp_add_i16s_xpulpv2(const int16_t * pSrcA,
-                          const int16_t * pSrcB,
-                          int32_t * pDst,
-                          uint32_t blockSize);
+void plp_mat_mult_cmplx_q8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                    const int8_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    uint32_t shift,
+                                    int8_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief Glue code for element-by-element addition of 8-bit integer vectors.
-    @param[in]     pSrcA      points to first input vector
-    @param[in]     pSrcB      points to second input vector
-    @param[out]    pDst       points to output vector
-    @param[in]     blockSize  number of samples in each vector
-    @return        none
+  @brief      Glue code of parallel matrix matrix multiplication for complex 8-bit fix-point
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
 */
 
-void plp_add_i8(const int8_t * pSrcA,
-                 const int8_t * pSrcB,
-                 int32_t * pDst,
-                 uint32_t blockSize);
+void plp_mat_mult_cmplx_q8_parallel(const int8_t *__restrict__ pSrcA,
+                                    const int8_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    uint32_t shift,
+                                    uint32_t nPE,
+                                    int8_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief Element-by-element addition of 8-bit integer vectors kernel for RV32IM extension.
-    @param[in]     pSrcA      points to first input vector
-    @param[in]     pSrcB      points to second input vector
-    @param[out]    pDst       points to output vector
-    @param[in]     blockSize  number of samples in each vector
-    @return        none
+  @brief      parallel matrix matrix multiplication for complex 8-bit fix-point on XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_q8 struct initialized by
+                    plp_mat_mult_cmplx_q8_parallel
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
 */
 
-void plp_add_i8s_rv32im(const int8_t * pSrcA,
-                         const int8_t * pSrcB,
-                         int32_t * pDst,
-                         uint32_t blockSize);
+void plp_mat_mult_cmplx_q8p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-    @brief Element-by-element addition of 8-bit integer vectors kernel for XPULPV2 extension.
-    @param[in]     pSrcA      points to first input vector
-    @param[in]     pSrcB      points to second input vector
-    @param[out]    pDst       points to output vector
-    @param[in]     blockSize  number of samples in each vector
-    @return        none
+   @brief      Glue code for matrix transposed matrix multiplication of a 32-bit integer
+               matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
 */
 
-void plp_add_i8s_xpulpv2(const int8_t * pSrcA,
-                          const int8_t * pSrcB,
-                          int32_t * pDst,
-                          uint32_t blockSize);
+void plp_mat_mult_trans_i32(const int32_t *__restrict__ pSrcA,
+                            const int32_t *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t O,
+                            int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief Glue code for element-by-element multiplication of 32-bit integer vectors.
-    @param[in]     pSrcA      points to first input vector
-    @param[in]     pSrcB      points to second input vector
-    @param[out]    pDst       points to output vector
-    @param[in]     blockSize  number of samples in each vector
-    @return        none
+   @brief      Matrix transposed matrix multiplication of a 32-bit integer matrices for RV32IM
+               extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
 */
 
-void plp_mult_i32(const int32_t * pSrcA,
-                 const int32_t * pSrcB,
-                 int32_t * pDst,
-                 uint32_t blockSize);
+void plp_mat_mult_trans_i32s_rv32im(const int32_t *__restrict__ pSrcA,
+                                    const int32_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief Element-by-element multiplication of 32-bit integer vectors kernel for RV32IM extension.
-    @param[in]     pSrcA      points to first input vector
-    @param[in]     pSrcB      points to second input vector
-    @param[out]    pDst       points to output vector
-    @param[in]     blockSize  number of samples in each vector
-    @return        none
+   @brief      Matrix transposed matrix multiplication of a 32-bit integer matrices for XPULPV2
+               extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
 */
 
-void plp_mult_i32s_rv32im(const int32_t * pSrcA,
-                         const int32_t * pSrcB,
-                         int32_t * pDst,
-                         uint32_t blockSize);
+void plp_mat_mult_trans_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                     const int32_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief Element-by-element multiplication of 32-bit integer vectors kernel for XPULPV2 extension.
-    @param[in]     pSrcA      points to first input vector
-    @param[in]     pSrcB      points to second input vector
-    @param[out]    pDst       points to output vector
-    @param[in]     blockSize  number of samples in each vector
-    @return        none
+   @brief      Glue code for matrix transposed matrix multiplication of a 16-bit integer
+               matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
 */
 
-void plp_mult_i32s_xpulpv2(const int32_t * pSrcA,
-                          const int32_t * pSrcB,
-                          int32_t * pDst,
-                          uint32_t blockSize);
+void plp_mat_mult_trans_i16(const int16_t *__restrict__ pSrcA,
+                            const int16_t *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t O,
+                            int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief Glue code for element-by-element multiplication of 16-bit integer vectors.
-    @param[in]     pSrcA      points to first input vector
-    @param[in]     pSrcB      points to second input vector
-    @param[out]    pDst       points to output vector
-    @param[in]     blockSize  number of samples in each vector
-    @return        none
+   @brief      Matrix transposed matrix multiplication of a 16-bit integer matrices for RV32IM
+               extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
 */
 
-void plp_mult_i16(const int16_t * pSrcA,
-                 const int16_t * pSrcB,
-                 int32_t * pDst,
-                 uint32_t blockSize);
+void plp_mat_mult_trans_i16s_rv32im(const int16_t *__restrict__ pSrcA,
+                                    const int16_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief Element-by-element multiplication of 16-bit integer vectors kernel for RV32IM extension.
-    @param[in]     pSrcA      points to first input vector
-    @param[in]     pSrcB      points to second input vector
-    @param[out]    pDst       points to output vector
-    @param[in]     blockSize  number of samples in each vector
-    @return        none
+   @brief      Matrix transposed matrix multiplication of a 16-bit integer matrices for XPULPV2
+               extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Exploiting SIMD instructions
+   The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+   performed on 32 bit vectors, with 32 bit accumulator.
 */
 
-void plp_mult_i16s_rv32im(const int16_t * pSrcA,
-                         const int16_t * pSrcB,
-                         int32_t * pDst,
-                         uint32_t blockSize);
+void plp_mat_mult_trans_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                     const int16_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief Element-by-element multiplication of 16-bit integer vectors kernel for XPULPV2 extension.
-    @param[in]     pSrcA      points to first input vector
-    @param[in]     pSrcB      points to second input vector
-    @param[out]    pDst       points to output vector
-    @param[in]     blockSize  number of samples in each vector
-    @return        none
+   @brief      Glue code for matrix transposed matrix multiplication of a 8-bit integer matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
 */
 
-void plp_mult_i16s_xpulpv2(const int16_t * pSrcA,
-                          const int16_t * pSrcB,
-                          int32_t * pDst,
-                          uint32_t blockSize);
+void plp_mat_mult_trans_i8(const int8_t *__restrict__ pSrcA,
+                           const int8_t *__restrict__ pSrcB,
+                           uint32_t M,
+                           uint32_t N,
+                           uint32_t O,
+                           int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief Glue code for element-by-element multiplication of 8-bit integer vectors.
-    @param[in]     pSrcA      points to first input vector
-    @param[in]     pSrcB      points to second input vector
-    @param[out]    pDst       points to output vector
-    @param[in]     blockSize  number of samples in each vector
-    @return        none
+   @brief      Matrix transposed matrix multiplication of a 8-bit integer matrices for RV32IM
+   extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
 */
 
-void plp_mult_i8(const int8_t * pSrcA,
-                 const int8_t * pSrcB,
-                 int32_t * pDst,
-                 uint32_t blockSize);
+void plp_mat_mult_trans_i8s_rv32im(const int8_t *__restrict__ pSrcA,
+                                   const int8_t *__restrict__ pSrcB,
+                                   uint32_t M,
+                                   uint32_t N,
+                                   uint32_t O,
+                                   int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Matrix transposed matrix multiplication of a 8-bit integer matrices for XPULPV2
+   extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
 
-/** -------------------------------------------------------
-    @brief Element-by-element multiplication of 8-bit integer vectors kernel for RV32IM extension.
-    @param[in]     pSrcA      points to first input vector
-    @param[in]     pSrcB      points to second input vector
-    @param[out]    pDst       points to output vector
-    @param[in]     blockSize  number of samples in each vector
-    @return        none
+   @par Exploiting SIMD instructions
+   The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+   performed on 32 bit vectors, with 32 bit accumulator.
 */
 
-void plp_mult_i8s_rv32im(const int8_t * pSrcA,
-                         const int8_t * pSrcB,
-                         int32_t * pDst,
-                         uint32_t blockSize);
+void plp_mat_mult_trans_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                    const int8_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief Element-by-element multiplication of 8-bit integer vectors kernel for XPULPV2 extension.
-    @param[in]     pSrcA      points to first input vector
-    @param[in]     pSrcB      points to second input vector
-    @param[out]    pDst       points to output vector
-    @param[in]     blockSize  number of samples in each vector
-    @return        none
+   @brief      Glue code for parallel matrix matrix multiplication of a 32-bit integer matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  nPE   Number of cores to use
+   @param[out] pDstC Output is written here
+   @return     none
 */
 
-void plp_mult_i8s_xpulpv2(const int8_t * pSrcA,
-                          const int8_t * pSrcB,
-                          int32_t * pDst,
-                          uint32_t blockSize);
+void plp_mat_mult_trans_i32_parallel(const int32_t *__restrict__ pSrcA,
+                                     const int32_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t nPE,
+                                     int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief      Glue code for filling a constant value into a 32-bit integer vector.
-    @param[in]  value      input value to be filled
-    @param[out] pDst       points to output vector
-    @param[in]  blockSize  number of samples in each vector
-    @return     none
+   @brief      Parallel matrix transposed matrix multiplication of a 32-bit integer matrices for
+               RV32IM extension.
+   @param[in]  args  pointer to plp_mat_mult_instance_i32 struct initialized by
+                     plp_mat_mult_i32_parallel
+   @return     none
 */
 
-void plp_fill_i32(int32_t value, int32_t *__restrict__ pDst, uint32_t blockSize);
+void plp_mat_mult_trans_i32p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-    @brief      Fills a constant value into a 32-bit integer vector for RV32IM extension.
-    @param[in]  value      input value to be filled
-    @param[out] pDst       points to output vector
-    @param[in]  blockSize  number of samples in each vector
-    @return     none
+   @brief      Glue code for parallel matrix transposed matrix multiplication of a 16-bit integer
+               matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  nPE   Number of cores to use
+   @param[out] pDstC Output is written here
+   @return     none
 */
 
-void plp_fill_i32s_rv32im(int32_t value, int32_t *__restrict__ pDst, uint32_t blockSize);
+void plp_mat_mult_trans_i16_parallel(const int16_t *__restrict__ pSrcA,
+                                     const int16_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t nPE,
+                                     int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief      Fills a constant value into a 32-bit integer vector for XPULPV2 extension.
-    @param[in]  value      input value to be filled
-    @param[out] pDst       points to output vector
-    @param[in]  blockSize  number of samples in each vector
-    @return     none
+   @brief      Parallel matrix transposed matrix multiplication of a 16-bit integer matrices for
+               XPULPV2 extension.
+   @param[in]  args  pointer to plp_mat_mult_instance_i16 struct initialized by
+                     plp_mat_mult_i16_parallel
+   @return     none
+
+   @par Exploiting SIMD instructions
+   The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+   performed on 32 bit vectors, with 32 bit accumulator.
 */
 
-void plp_fill_i32s_xpulpv2(int32_t value, int32_t *__restrict__ pDst, uint32_t blockSize);
+void plp_mat_mult_trans_i16p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-    @brief      Glue code for copying the elements of a 32-bit integer vector
-    @param[in]  pSrc       points to input vector
-    @param[out] pDst       points to output vector
-    @param[in]  blockSize  number of samples in each vector
-    @return     none
+   @brief      Glue code for parallel matrix transposed matrix multiplication of a 8-bit integer
+               matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  nPE   Number of cores to use
+   @param[out] pDstC Output is written here
+   @return     none
 */
 
-void plp_copy_i32(int32_t *__restrict__ pSrc, int32_t *__restrict__ pDst, uint32_t blockSize);
+void plp_mat_mult_trans_i8_parallel(const int8_t *__restrict__ pSrcA,
+                                    const int8_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    uint32_t nPE,
+                                    int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief      Copies the elements of a 32-bit integer vector for RV32IM extension.
-    @param[in]  pSrc       points to input vector
-    @param[out] pDst       points to output vector
-    @param[in]  blockSize  number of samples in each vector
-    @return     none
+   @brief      Parallel matrix transposed matrix multiplication of a 8-bit integer matrices for
+               XPULPV2 extension.
+   @param[in]  args  pointer to plp_mat_mult_instance_i8 struct initialized by
+                     plp_mat_mult_i8_parallel
+   @return     none
+
+   @par Exploiting SIMD instructions
+   The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+   performed on 32 bit vectors, with 32 bit accumulator.
 */
 
-void plp_copy_i32s_rv32im(int32_t *__restrict__ pSrc,
-                          int32_t *__restrict__ pDst,
-                          uint32_t blockSize);
+void plp_mat_mult_trans_i8p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-    @brief      Copies the elements of a 32-bit integer vector for XPULPV2 extension.
-    @param[in]  pSrc       points to input vector
-    @param[out] pDst       points to output vector
-    @param[in]  blockSize  number of samples in each vector
-    @return     none
-*/
+   @brief      Glue code for matrix transposed matrix multiplication of a 32-bit fix-point
+               matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
 
-void plp_copy_i32s_xpulpv2(int32_t *__restrict__ pSrc,
-                           int32_t *__restrict__ pDst,
-                           uint32_t blockSize);
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+ */
+
+void plp_mat_mult_trans_q32(const int32_t *__restrict__ pSrcA,
+                            const int32_t *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t O,
+                            uint32_t shift,
+                            int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief      Glue code for copying the elements of a 32-bit float vector
-    @param[in]  pSrc       points to input vector
-    @param[out] pDst       points to output vector
-    @param[in]  blockSize  number of samples in each vector
-    @return     none
-*/
+   @brief      Glue code for parallel matrix transposed matrix multiplication of a 32-bit
+               fix-point matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[in]  nPE   Number of cores to use
+   @param[out] pDstC Output is written here
+   @return     none
 
-void plp_copy_f32(float32_t *__restrict__ pSrc, float32_t *__restrict__ pDst, uint32_t blockSize);
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+ */
+
+void plp_mat_mult_trans_q32_parallel(const int32_t *__restrict__ pSrcA,
+                                     const int32_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t shift,
+                                     uint32_t nPE,
+                                     int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief      Copies the elements of a 32-bit integer vector for XPULPV2 extension.
-    @param[in]  pSrc       points to input vector
-    @param[out] pDst       points to output vector
-    @param[in]  blockSize  number of samples in each vector
-    @return     none
+   @brief      matrix transposed matrix multiplication of a 32-bit fix-point matrices for RV32IM
+               extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
 */
 
-void plp_copy_f32s_xpulpv2(float32_t *__restrict__ pSrc,
-                           float32_t *__restrict__ pDst,
-                           uint32_t blockSize);
+void plp_mat_mult_trans_q32s_rv32im(const int32_t *__restrict__ pSrcA,
+                                    const int32_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    uint32_t shift,
+                                    int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief      Glue code for mean value of a 32-bit float vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    mean value returned here
-    @return     none
+   @brief      matrix transposed matrix multiplication of a 32-bit fix-point matrices for XPULPV2
+               extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
 */
 
-void plp_mean_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes);
+void plp_mat_mult_trans_q32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                     const int32_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t shift,
+                                     int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief      Glue code for mean value of a 32-bit float vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    mean value returned here
+    @brief      Parallel matrix transposed matrix multiplication of 32-bit fix-point matrices kernel
+                for XPULPV2 extension.
+    @param[in]  args  pointer to plp_mat_mult_instance_q32 struct initialized by
+                      plp_mat_mult_trans_q32_parallel
     @return     none
 */
 
-void plp_mean_f32s_xpulpv2(const float *__restrict__ pSrc,
-                           uint32_t blockSize,
-                           float *__restrict__ pRes);
+void plp_mat_mult_trans_q32p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-    @brief      Glue code for mean value of a 32-bit integer vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    mean value returned here
-    @return     none
-*/
+   @brief      Glue code for matrix transposed matrix multiplication of a 16-bit fix-point
+               matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
 
-void plp_mean_i32(const int32_t *__restrict__ pSrc, uint32_t blockSize, int32_t *__restrict__ pRes);
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
 
-/** -------------------------------------------------------
-    @brief      Mean value of a 32-bit integer vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    mean value returned here
-    @return     none
-*/
+   The output of the matrix multiplication will also be stored as an 16-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+ */
 
-void plp_mean_i32s_rv32im(const int32_t *__restrict__ pSrc,
-                          uint32_t blockSize,
-                          int32_t *__restrict__ pRes);
+void plp_mat_mult_trans_q16(const int16_t *__restrict__ pSrcA,
+                            const int16_t *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t O,
+                            uint32_t shift,
+                            int16_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief      Mean value of a 32-bit integer vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes    mean value returned here
-    @return     none
-*/
+   @brief      Glue code for parallel matrix transposed matrix multiplication of a 16-bit
+               fix-point matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[in]  nPE   Number of cores to use
+   @param[out] pDstC Output is written here
+   @return     none
 
-void plp_mean_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
-                           uint32_t blockSize,
-                           int32_t *__restrict__ pRes);
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
 
-/** -------------------------------------------------------
-    @brief      Glue code for mean value of a 16-bit integer vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    mean value returned here
-    @return     none
-*/
+   The output of the matrix multiplication will also be stored as an 16-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+ */
 
-void plp_mean_i16(const int16_t *__restrict__ pSrc, uint32_t blockSize, int16_t *__restrict__ pRes);
+void plp_mat_mult_trans_q16_parallel(const int16_t *__restrict__ pSrcA,
+                                     const int16_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t shift,
+                                     uint32_t nPE,
+                                     int16_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief      Mean value of a 16-bit integer vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    mean value returned here
-    @return     none
-*/
+   @brief      matrix transposed matrix multiplication of a 16-bit fix-point matrices for RV32IM
+               extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
 
-void plp_mean_i16s_rv32im(const int16_t *__restrict__ pSrc,
-                          uint32_t blockSize,
-                          int16_t *__restrict__ pRes);
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
 
-/** -------------------------------------------------------
-    @brief      Mean value of a 16-bit integer vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes    mean value returned here
-    @return     none
+   The output of the matrix multiplication will also be stored as an 16-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
 */
 
-void plp_mean_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
-                           uint32_t blockSize,
-                           int16_t *__restrict__ pRes);
+void plp_mat_mult_trans_q16s_rv32im(const int16_t *__restrict__ pSrcA,
+                                    const int16_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    uint32_t shift,
+                                    int16_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief      Glue code for mean value of a 8-bit integer vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    mean value returned here
-    @return     none
-*/
+   @brief      matrix transposed matrix multiplication of a 16-bit fix-point matrices for XPULPV2
+               extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
 
-void plp_mean_i8(const int8_t *__restrict__ pSrc, uint32_t blockSize, int8_t *__restrict__ pRes);
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
 
-/** -------------------------------------------------------
-    @brief      Mean value of a 8-bit integer vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    mean value returned here
-    @return     none
+   The output of the matrix multiplication will also be stored as an 16-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
 */
 
-void plp_mean_i8s_rv32im(const int8_t *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         int8_t *__restrict__ pRes);
+void plp_mat_mult_trans_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                     const int16_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t shift,
+                                     int16_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief      Mean value of a 8-bit integer vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes    mean value returned here
+    @brief      Parallel matrix transposed matrix multiplication of 16-bit fix-point matrices kernel
+                for XPULPV2 extension.
+    @param[in]  args  pointer to plp_mat_mult_instance_q16 struct initialized by
+                      plp_mat_mult_trans_q16_parallel
     @return     none
 */
 
-void plp_mean_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
-                          uint32_t blockSize,
-                          int8_t *__restrict__ pRes);
+void plp_mat_mult_trans_q16p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-    @brief      Glue code for max value of a 32-bit float vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    max value returned here
-    @return     none
-*/
+   @brief      Glue code for matrix transposed matrix multiplication of a 8-bit fix-point
+               matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
 
-void plp_max_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes);
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+   The output of the matrix multiplication will also be stored as an 8-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+ */
+
+void plp_mat_mult_trans_q8(const int8_t *__restrict__ pSrcA,
+                           const int8_t *__restrict__ pSrcB,
+                           uint32_t M,
+                           uint32_t N,
+                           uint32_t O,
+                           uint32_t shift,
+                           int8_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief      Kernel for max value of a 32-bit float vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    max value returned here
-    @return     none
-*/
+   @brief      Glue code for parallel matrix transposed matrix multiplication of a 8-bit
+               fix-point matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[in]  nPE   Number of cores to use
+   @param[out] pDstC Output is written here
+   @return     none
 
-void plp_max_f32s_xpulpv2(const float *__restrict__ pSrc,
-                          uint32_t blockSize,
-                          float *__restrict__ pRes);
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
 
-/** -------------------------------------------------------
-    @brief      Glue code for max value of a 32-bit integer vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    max value returned here
-    @return     none
-*/
+   The output of the matrix multiplication will also be stored as an 8-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+ */
 
-void plp_max_i32(const int32_t *__restrict__ pSrc, uint32_t blockSize, int32_t *__restrict__ pRes);
+void plp_mat_mult_trans_q8_parallel(const int8_t *__restrict__ pSrcA,
+                                    const int8_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    uint32_t shift,
+                                    uint32_t nPE,
+                                    int8_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief      Max value of a 32-bit integer vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    max value returned here
-    @return     none
-*/
+   @brief      matrix transposed matrix multiplication of a 8-bit fix-point matrices for RV32IM
+               extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
 
-void plp_max_i32s_rv32im(const int32_t *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         int32_t *__restrict__ pRes);
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
 
-/** -------------------------------------------------------
-    @brief      Max value of a 32-bit integer vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes    max value returned here
-    @return     none
+   The output of the matrix multiplication will also be stored as an 8-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
 */
 
-void plp_max_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
-                          uint32_t blockSize,
-                          int32_t *__restrict__ pRes);
+void plp_mat_mult_trans_q8s_rv32im(const int8_t *__restrict__ pSrcA,
+                                   const int8_t *__restrict__ pSrcB,
+                                   uint32_t M,
+                                   uint32_t N,
+                                   uint32_t O,
+                                   uint32_t shift,
+                                   int8_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief      Glue code for max value of a 16-bit integer vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    max value returned here
-    @return     none
-*/
+   @brief      matrix transposed matrix multiplication of a 8-bit fix-point matrices for XPULPV2
+               extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
 
-void plp_max_i16(const int16_t *__restrict__ pSrc, uint32_t blockSize, int16_t *__restrict__ pRes);
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
 
-/** -------------------------------------------------------
-    @brief      Max value of a 16-bit integer vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    max value returned here
-    @return     none
+   The output of the matrix multiplication will also be stored as an 8-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
 */
 
-void plp_max_i16s_rv32im(const int16_t *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         int16_t *__restrict__ pRes);
+void plp_mat_mult_trans_q8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                    const int8_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    uint32_t shift,
+                                    int8_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief      Max value of a 16-bit integer vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes    max value returned here
+    @brief      Parallel matrix transposed matrix multiplication of 8-bit fix-point matrices kernel
+                for XPULPV2 extension.
+    @param[in]  args  pointer to plp_mat_mult_instance_q8 struct initialized by
+                      plp_mat_mult_trans_q8_parallel
     @return     none
 */
 
-void plp_max_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
-                          uint32_t blockSize,
-                          int16_t *__restrict__ pRes);
+void plp_mat_mult_trans_q8p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-    @brief      Glue code for max value of a 8-bit integer vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    max value returned here
-    @return     none
+   @brief      Glue code for matrix transposed matrix multiplication of a 32-bit floating-point
+               matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
 */
 
-void plp_max_i8(const int8_t *__restrict__ pSrc, uint32_t blockSize, int8_t *__restrict__ pRes);
+void plp_mat_mult_trans_f32(const float *__restrict__ pSrcA,
+                            const float *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t O,
+                            float *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief      Max value of a 8-bit integer vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    max value returned here
-    @return     none
+   @brief      matrix transposed matrix multiplication of a 32-bit floating-point matrices for
+               XPULPV2 extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
 */
 
-void plp_max_i8s_rv32im(const int8_t *__restrict__ pSrc,
-                        uint32_t blockSize,
-                        int8_t *__restrict__ pRes);
+void plp_mat_mult_trans_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                                     const float *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     float *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief      Max value of a 8-bit integer vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes    max value returned here
-    @return     none
+   @brief      Glue code for parallel matrix transposed matrix multiplication of a 32-bit
+               floating-point matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  nPE   Number of cores to use
+   @param[out] pDstC Output is written here
+   @return     none
 */
 
-void plp_max_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         int8_t *__restrict__ pRes);
+void plp_mat_mult_trans_f32_parallel(const float *__restrict__ pSrcA,
+                                     const float *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t nPE,
+                                     float *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief      Glue code for min value of a 32-bit float vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    min value returned here
+    @brief      Parallel matrix transposed matrix multiplication of 32-bit floating-point matrices
+                kernel for XPULPV2 extension.
+    @param[in]  args  pointer to plp_mat_mult_instance_f32 struct initialized by
+                      plp_mat_mult_trans_f32_parallel
     @return     none
 */
 
-void plp_min_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes);
+void plp_mat_mult_trans_f32p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-    @brief      Kernel for min value of a 32-bit float vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    min value returned here
-    @return     none
+  @brief      Glue code of matrix transpose matrix multiplication for complex 32-bit integers
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
 */
 
-void plp_min_f32s_xpulpv2(const float *__restrict__ pSrc,
-                          uint32_t blockSize,
-                          float *__restrict__ pRes);
+void plp_mat_mult_trans_cmplx_i32(const int32_t *__restrict__ pSrcA,
+                                  const int32_t *__restrict__ pSrcB,
+                                  uint32_t M,
+                                  uint32_t N,
+                                  uint32_t O,
+                                  int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief      Glue code for min value of a 32-bit integer vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    min value returned here
-    @return     none
+  @brief      matrix transpose matrix multiplication for complex 32-bit integers on RV32IM
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
 */
 
-void plp_min_i32(const int32_t *__restrict__ pSrc, uint32_t blockSize, int32_t *__restrict__ pRes);
+void plp_mat_mult_trans_cmplx_i32s_rv32im(const int32_t *__restrict__ pSrcA,
+                                          const int32_t *__restrict__ pSrcB,
+                                          uint32_t M,
+                                          uint32_t N,
+                                          uint32_t O,
+                                          int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief      Min value of a 32-bit integer vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    min value returned here
-    @return     none
+  @brief      matrix transpose matrix multiplication for complex 32-bit integers on XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
 */
 
-void plp_min_i32s_rv32im(const int32_t *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         int32_t *__restrict__ pRes);
+void plp_mat_mult_trans_cmplx_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                           const int32_t *__restrict__ pSrcB,
+                                           uint32_t M,
+                                           uint32_t N,
+                                           uint32_t O,
+                                           int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief      Min value of a 32-bit integer vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes    min value returned here
-    @return     none
+  @brief      Glue code of parallel matrix transpose matrix multiplication for complex 32-bit
+              integers
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
 */
 
-void plp_min_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
-                          uint32_t blockSize,
-                          int32_t *__restrict__ pRes);
+void plp_mat_mult_trans_cmplx_i32_parallel(const int32_t *__restrict__ pSrcA,
+                                           const int32_t *__restrict__ pSrcB,
+                                           uint32_t M,
+                                           uint32_t N,
+                                           uint32_t O,
+                                           uint32_t nPE,
+                                           int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief      Glue code for min value of a 16-bit integer vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    min value returned here
-    @return     none
+  @brief      parallel matrix transpose matrix multiplication for complex 32-bit integers on XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_i32 struct initialized by
+                    plp_mat_mult_trans_cmplx_i32_parallel
+  @return     none
 */
 
-void plp_min_i16(const int16_t *__restrict__ pSrc, uint32_t blockSize, int16_t *__restrict__ pRes);
+void plp_mat_mult_trans_cmplx_i32p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-    @brief      Min value of a 16-bit integer vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    min value returned here
-    @return     none
+  @brief      Glue code of matrix transpose matrix multiplication for complex 16-bit integers
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
 */
 
-void plp_min_i16s_rv32im(const int16_t *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         int16_t *__restrict__ pRes);
+void plp_mat_mult_trans_cmplx_i16(const int16_t *__restrict__ pSrcA,
+                                  const int16_t *__restrict__ pSrcB,
+                                  uint32_t M,
+                                  uint32_t N,
+                                  uint32_t O,
+                                  int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief      Min value of a 16-bit integer vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes    min value returned here
-    @return     none
+  @brief      matrix transpose matrix multiplication for complex 16-bit integers on RV32IM
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
 */
 
-void plp_min_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
-                          uint32_t blockSize,
-                          int16_t *__restrict__ pRes);
+void plp_mat_mult_trans_cmplx_i16s_rv32im(const int16_t *__restrict__ pSrcA,
+                                          const int16_t *__restrict__ pSrcB,
+                                          uint32_t M,
+                                          uint32_t N,
+                                          uint32_t O,
+                                          int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief      Glue code for min value of a 8-bit integer vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    min value returned here
-    @return     none
+  @brief      matrix transpose matrix multiplication for complex 16-bit integers on XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Blocking
+  Uses the kernel plp_mat_mult_trans_cmplx_stride_i16s_xpulpv2, which computes blocks of 2x2 output
+  elements.
 */
 
-void plp_min_i8(const int8_t *__restrict__ pSrc, uint32_t blockSize, int8_t *__restrict__ pRes);
+void plp_mat_mult_trans_cmplx_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                           const int16_t *__restrict__ pSrcB,
+                                           uint32_t M,
+                                           uint32_t N,
+                                           uint32_t O,
+                                           int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief      Min value of a 8-bit integer vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    min value returned here
-    @return     none
+  @brief      Glue code of parallel matrix transpose matrix multiplication for complex 16-bit
+              integers
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
 */
 
-void plp_min_i8s_rv32im(const int8_t *__restrict__ pSrc,
-                        uint32_t blockSize,
-                        int8_t *__restrict__ pRes);
+void plp_mat_mult_trans_cmplx_i16_parallel(const int16_t *__restrict__ pSrcA,
+                                           const int16_t *__restrict__ pSrcB,
+                                           uint32_t M,
+                                           uint32_t N,
+                                           uint32_t O,
+                                           uint32_t nPE,
+                                           int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief      Min value of a 8-bit integer vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes    min value returned here
-    @return     none
+  @brief      parallel matrix transpose matrix multiplication for complex 16-bit integers on XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_i16 struct initialized by
+                    plp_mat_mult_trans_cmplx_i16_parallel
+  @return     none
+
+  @par Blocking
+  Uses the kernel plp_mat_mult_trans_cmplx_stride_i16p_xpulpv2, which computes blocks of 2x2 output
+  elements.
 */
 
-void plp_min_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         int8_t *__restrict__ pRes);
+void plp_mat_mult_trans_cmplx_i16p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Sum of squares of a 32-bit float vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Sum of squares returned here
-    @return     none
+  @brief      Glue code of matrix transpose matrix multiplication for complex 8-bit integers
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
 */
 
-void plp_power_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes);
+void plp_mat_mult_trans_cmplx_i8(const int8_t *__restrict__ pSrcA,
+                                 const int8_t *__restrict__ pSrcB,
+                                 uint32_t M,
+                                 uint32_t N,
+                                 uint32_t O,
+                                 int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief      Kernel for Sum of squares of a 32-bit float vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Sum of squares returned here
-    @return     none
+  @brief      matrix transpose matrix multiplication for complex 8-bit integers on RV32IM
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
 */
 
-void plp_power_f32_xpulpv2(const float *__restrict__ pSrc,
-                           uint32_t blockSize,
-                           float *__restrict__ pRes);
+void plp_mat_mult_trans_cmplx_i8s_rv32im(const int8_t *__restrict__ pSrcA,
+                                         const int8_t *__restrict__ pSrcB,
+                                         uint32_t M,
+                                         uint32_t N,
+                                         uint32_t O,
+                                         int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Sum of squares of a 32-bit integer vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Sum of squares returned here
-    @return     none
+  @brief      matrix transpose matrix multiplication for complex 8-bit integers on XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Blocking
+  Uses the kernel plp_mat_mult_trans_cmplx_stride_i8s_xpulpv2, which computes blocks of 2x2 output
+  elements.
 */
 
-void plp_power_i32(const int32_t *__restrict__ pSrc,
-                   uint32_t blockSize,
-                   int32_t *__restrict__ pRes);
+void plp_mat_mult_trans_cmplx_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                          const int8_t *__restrict__ pSrcB,
+                                          uint32_t M,
+                                          uint32_t N,
+                                          uint32_t O,
+                                          int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief      Sum of squares of a 32-bit integer vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Sum of squares returned here
-    @return     none
+  @brief      Glue code of parallel matrix transpose matrix multiplication for complex 8-bit
+              integers
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
 */
 
-void plp_power_i32s_rv32im(const int32_t *__restrict__ pSrc,
-                           uint32_t blockSize,
-                           int32_t *__restrict__ pRes);
+void plp_mat_mult_trans_cmplx_i8_parallel(const int8_t *__restrict__ pSrcA,
+                                          const int8_t *__restrict__ pSrcB,
+                                          uint32_t M,
+                                          uint32_t N,
+                                          uint32_t O,
+                                          uint32_t nPE,
+                                          int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief      Sum of squares of a 32-bit integer vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes    Sum of squares returned here
-    @return     none
+  @brief      parallel matrix transpose matrix multiplication for complex 8-bit integers on XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_i8 struct initialized by
+                    plp_mat_mult_trans_cmplx_i8_parallel
+  @return     none
+
+  @par Blocking
+  Uses the kernel plp_mat_mult_trans_cmplx_stride_i8p_xpulpv2, which computes blocks of 2x2 output
+  elements.
 */
 
-void plp_power_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
-                            uint32_t blockSize,
-                            int32_t *__restrict__ pRes);
+void plp_mat_mult_trans_cmplx_i8p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Sum of squares of a 16-bit integer vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Sum of squares returned here
-    @return     none
+  @brief      Glue code of matrix transpose matrix multiplication for complex 32-bit floats
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
 */
 
-void plp_power_i16(const int16_t *__restrict__ pSrc,
-                   uint32_t blockSize,
-                   int32_t *__restrict__ pRes);
+void plp_mat_mult_trans_cmplx_f32(const float *__restrict__ pSrcA,
+                                  const float *__restrict__ pSrcB,
+                                  uint32_t M,
+                                  uint32_t N,
+                                  uint32_t O,
+                                  float *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief      Sum of squares of a 16-bit integer vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Sum of squares returned here
-    @return     none
+  @brief      matrix transpose matrix multiplication for complex 32-bit floats on XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Blocking
+  Uses the kernel plp_mat_mult_trans_cmplx_stride_f32s_xpulpv2, which computes blocks of 2x2 output
+  elements.
 */
 
-void plp_power_i16s_rv32im(const int16_t *__restrict__ pSrc,
-                           uint32_t blockSize,
-                           int32_t *__restrict__ pRes);
+void plp_mat_mult_trans_cmplx_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                                           const float *__restrict__ pSrcB,
+                                           uint32_t M,
+                                           uint32_t N,
+                                           uint32_t O,
+                                           float *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief      Sum of squares of a 16-bit integer vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes    Sum of squares returned here
-    @return     none
+  @brief      Glue code of parallel matrix transpose matrix multiplication for complex 32-bit floats
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
 */
 
-void plp_power_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
-                            uint32_t blockSize,
-                            int32_t *__restrict__ pRes);
+void plp_mat_mult_trans_cmplx_f32_parallel(const float *__restrict__ pSrcA,
+                                           const float *__restrict__ pSrcB,
+                                           uint32_t M,
+                                           uint32_t N,
+                                           uint32_t O,
+                                           uint32_t nPE,
+                                           float *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Sum of squares of a 8-bit integer vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Sum of squares returned here
-    @return     none
+  @brief      parallel matrix transpose matrix multiplication for complex 32-bit floats on XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_f32 struct initialized by
+                    plp_mat_mult_trans_cmplx_f32_parallel
+  @return     none
+
+  @par Blocking
+  Uses the kernel plp_mat_mult_trans_cmplx_stride_f32p_xpulpv2, which computes blocks of 2x2 output
+  elements.
 */
 
-void plp_power_i8(const int8_t *__restrict__ pSrc, uint32_t blockSize, int32_t *__restrict__ pRes);
+void plp_mat_mult_trans_cmplx_f32p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-    @brief      Sum of squares of a 8-bit integer vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Sum of squares returned here
-    @return     none
+  @brief      Glue code of matrix transpose matrix multiplication for complex 32-bit fix-point
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
 */
 
-void plp_power_i8s_rv32im(const int8_t *__restrict__ pSrc,
-                          uint32_t blockSize,
-                          int32_t *__restrict__ pRes);
+void plp_mat_mult_trans_cmplx_q32(const int32_t *__restrict__ pSrcA,
+                                  const int32_t *__restrict__ pSrcB,
+                                  uint32_t M,
+                                  uint32_t N,
+                                  uint32_t O,
+                                  uint32_t shift,
+                                  int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief      Sum of squares of a 8-bit integer vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes    Sum of squares value returned here
-    @return     none
+  @brief      matrix transpose matrix multiplication for complex 32-bit fix-point on RV32IM
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
 */
 
-void plp_power_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
-                           uint32_t blockSize,
-                           int32_t *__restrict__ pRes);
+void plp_mat_mult_trans_cmplx_q32s_rv32im(const int32_t *__restrict__ pSrcA,
+                                          const int32_t *__restrict__ pSrcB,
+                                          uint32_t M,
+                                          uint32_t N,
+                                          uint32_t O,
+                                          uint32_t shift,
+                                          int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Sum of squares of a 32-bit fixed point vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Sum of squares returned here
-    @return     none
+  @brief      matrix transpose matrix multiplication for complex 32-bit fix-point on XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
 */
 
-void plp_power_q32(const int32_t *__restrict__ pSrc,
-                   uint32_t blockSize,
-                   uint32_t fracBits,
-                   int32_t *__restrict__ pRes);
+void plp_mat_mult_trans_cmplx_q32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                           const int32_t *__restrict__ pSrcB,
+                                           uint32_t M,
+                                           uint32_t N,
+                                           uint32_t O,
+                                           uint32_t shift,
+                                           int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief      Sum of squares of a 32-bit fixed point vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Sum of squares value returned here
-    @return     none
+  @brief      Glue code of parallel matrix transpose matrix multiplication for complex 32-bit
+              fix-point
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
 */
 
-void plp_power_q32s_rv32im(const int32_t *__restrict__ pSrc,
-                           uint32_t blockSize,
-                           uint32_t fracBits,
-                           int32_t *__restrict__ pRes);
+void plp_mat_mult_trans_cmplx_q32_parallel(const int32_t *__restrict__ pSrcA,
+                                           const int32_t *__restrict__ pSrcB,
+                                           uint32_t M,
+                                           uint32_t N,
+                                           uint32_t O,
+                                           uint32_t shift,
+                                           uint32_t nPE,
+                                           int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief      Sum of squares of a 32-bit fixed point vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes       Sum of squares returned here
-    @return     none
+  @brief      parallel matrix transpose matrix multiplication for complex 32-bit fix-point on
+              XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_q32 struct initialized by
+                    plp_mat_mult_trans_cmplx_q32_parallel
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
 */
 
-void plp_power_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
-                            uint32_t blockSize,
-                            uint32_t fracBits,
-                            int32_t *__restrict__ pRes);
+void plp_mat_mult_trans_cmplx_q32p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Sum of squares of a 16-bit fixed point vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Sum of squares returned here
-    @return     none
+  @brief      Glue code of matrix transpose matrix multiplication for complex 16-bit fix-point
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
 */
 
-void plp_power_q16(const int16_t *__restrict__ pSrc,
-                   uint32_t blockSize,
-                   uint32_t fracBits,
-                   int32_t *__restrict__ pRes);
+void plp_mat_mult_trans_cmplx_q16(const int16_t *__restrict__ pSrcA,
+                                  const int16_t *__restrict__ pSrcB,
+                                  uint32_t M,
+                                  uint32_t N,
+                                  uint32_t O,
+                                  uint32_t shift,
+                                  int16_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief      Sum of squares of a 16-bit fixed point vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Sum of squares returned here
-    @return     none
-*/
-
-void plp_power_q16s_rv32im(const int16_t *__restrict__ pSrc,
-                           uint32_t blockSize,
-                           uint32_t fracBits,
-                           int32_t *__restrict__ pRes);
+  @brief      matrix transpose matrix multiplication for complex 16-bit fix-point on RV32IM
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
 
-/** -------------------------------------------------------
-    @brief      Sum of squares of a 16-bit fixed point vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes       Sum of squares returned here
-    @return     none
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
 */
 
-void plp_power_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
-                            uint32_t blockSize,
-                            uint32_t fracBits,
-                            int32_t *__restrict__ pRes);
+void plp_mat_mult_trans_cmplx_q16s_rv32im(const int16_t *__restrict__ pSrcA,
+                                          const int16_t *__restrict__ pSrcB,
+                                          uint32_t M,
+                                          uint32_t N,
+                                          uint32_t O,
+                                          uint32_t shift,
+                                          int16_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Sum of squares of a 8-bit fixed point vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Sum of squares returned here
-    @return     none
-*/
+  @brief      matrix transpose matrix multiplication for complex 16-bit fix-point on XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
 
-void plp_power_q8(const int8_t *__restrict__ pSrc,
-                  uint32_t blockSize,
-                  uint32_t fracBits,
-                  int32_t *__restrict__ pRes);
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
 
-/** -------------------------------------------------------
-    @brief      Sum of squares of a 8-bit fixed point vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Sum of squares returned here
-    @return     none
+  @par Blocking
+  Uses the kernel plp_mat_mult_trans_cmplx_stride_q16s_xpulpv2, which computes blocks of 2x2 output
+  elements.
 */
 
-void plp_power_q8s_rv32im(const int8_t *__restrict__ pSrc,
-                          uint32_t blockSize,
-                          uint32_t fracBits,
-                          int32_t *__restrict__ pRes);
+void plp_mat_mult_trans_cmplx_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                           const int16_t *__restrict__ pSrcB,
+                                           uint32_t M,
+                                           uint32_t N,
+                                           uint32_t O,
+                                           uint32_t shift,
+                                           int16_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief      Sum of squares of a 8-bit fixed point vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes       Sum of squares value returned here
-    @return     none
+  @brief      Glue code of parallel matrix transpose matrix multiplication for complex 16-bit
+              fix-point
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
 */
 
-void plp_power_q8s_xpulpv2(const int8_t *__restrict__ pSrc,
-                           uint32_t blockSize,
-                           uint32_t fracBits,
-                           int32_t *__restrict__ pRes);
+void plp_mat_mult_trans_cmplx_q16_parallel(const int16_t *__restrict__ pSrcA,
+                                           const int16_t *__restrict__ pSrcB,
+                                           uint32_t M,
+                                           uint32_t N,
+                                           uint32_t O,
+                                           uint32_t shift,
+                                           uint32_t nPE,
+                                           int16_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Statisical variance of a 32-bit float vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical variance returned here
-    @return     none
-*/
+  @brief      parallel matrix transpose matrix multiplication for complex 16-bit fix-point on
+              XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_q16 struct initialized by
+                    plp_mat_mult_trans_cmplx_q16_parallel
+  @return     none
 
-void plp_var_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes);
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
 
-/** -------------------------------------------------------
-    @brief      Kernel for Statisical variance of a 32-bit float vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical variance returned here
-    @return     none
+  @par Blocking
+  Uses the kernel plp_mat_mult_trans_cmplx_stride_q16p_xpulpv2, which computes blocks of 2x2 output
+  elements.
 */
 
-void plp_var_f32_xpulpv2(const float *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         float *__restrict__ pRes);
+void plp_mat_mult_trans_cmplx_q16p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Statisical variance of a 32-bit fixed point vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical variance returned here
-    @return     none
+  @brief      Glue code of matrix transpose matrix multiplication for complex 8-bit fix-point
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
 */
 
-void plp_var_q32(const int32_t *__restrict__ pSrc,
-                 uint32_t blockSize,
-                 uint32_t fracBits,
-                 int32_t *__restrict__ pRes);
+void plp_mat_mult_trans_cmplx_q8(const int8_t *__restrict__ pSrcA,
+                                 const int8_t *__restrict__ pSrcB,
+                                 uint32_t M,
+                                 uint32_t N,
+                                 uint32_t O,
+                                 uint32_t shift,
+                                 int8_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief      Statisical variance of a 32-bit fixed point vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical variance value returned here
-    @return     none
+  @brief      matrix transpose matrix multiplication for complex 8-bit fix-point on RV32IM
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
 */
 
-void plp_var_q32s_rv32im(const int32_t *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         uint32_t fracBits,
-                         int32_t *__restrict__ pRes);
+void plp_mat_mult_trans_cmplx_q8s_rv32im(const int8_t *__restrict__ pSrcA,
+                                         const int8_t *__restrict__ pSrcB,
+                                         uint32_t M,
+                                         uint32_t N,
+                                         uint32_t O,
+                                         uint32_t shift,
+                                         int8_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief      Statisical variance of a 32-bit fixed point vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes       Statisical variance returned here
-    @return     none
-*/
-
-void plp_var_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
-                          uint32_t blockSize,
-                          uint32_t fracBits,
-                          int32_t *__restrict__ pRes);
+  @brief      matrix transpose matrix multiplication for complex 8-bit fix-point on XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
 
-/** -------------------------------------------------------
-    @brief      Glue code for Statisical variance of a 16-bit fixed point vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical variance returned here
-    @return     none
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
 */
 
-void plp_var_q16(const int16_t *__restrict__ pSrc,
-                 uint32_t blockSize,
-                 uint32_t fracBits,
-                 int16_t *__restrict__ pRes);
+void plp_mat_mult_trans_cmplx_q8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                          const int8_t *__restrict__ pSrcB,
+                                          uint32_t M,
+                                          uint32_t N,
+                                          uint32_t O,
+                                          uint32_t shift,
+                                          int8_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief      Statisical variance of a 16-bit fixed point vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical variance returned here
-    @return     none
+  @brief      Glue code of parallel matrix transpose matrix multiplication for complex 8-bit
+              fix-point
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
 */
 
-void plp_var_q16s_rv32im(const int16_t *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         uint32_t fracBits,
-                         int16_t *__restrict__ pRes);
+void plp_mat_mult_trans_cmplx_q8_parallel(const int8_t *__restrict__ pSrcA,
+                                          const int8_t *__restrict__ pSrcB,
+                                          uint32_t M,
+                                          uint32_t N,
+                                          uint32_t O,
+                                          uint32_t shift,
+                                          uint32_t nPE,
+                                          int8_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief      Statisical variance of a 16-bit fixed point vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes       Statisical variance returned here
-    @return     none
-*/
+  @brief      parallel matrix transpose matrix multiplication for complex 8-bit fix-point on XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_q8 struct initialized by
+                    plp_mat_mult_trans_cmplx_q8_parallel
+  @return     none
 
-void plp_var_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
-                          uint32_t blockSize,
-                          uint32_t fracBits,
-                          int16_t *__restrict__ pRes);
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
 
-/** -------------------------------------------------------
-    @brief      Glue code for Statisical variance of a 8-bit fixed point vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical variance returned here
-    @return     none
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
 */
 
-void plp_var_q8(const int8_t *__restrict__ pSrc,
-                uint32_t blockSize,
-                uint32_t fracBits,
-                int8_t *__restrict__ pRes);
+void plp_mat_mult_trans_cmplx_q8p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-    @brief      Statisical variance of a 8-bit fixed point vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical variance returned here
-    @return     none
+  @brief      Glue code of matrix conjugate transpose matrix multiplication for complex 16-bit
+              integers
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
 */
 
-void plp_var_q8s_rv32im(const int8_t *__restrict__ pSrc,
-                        uint32_t blockSize,
-                        uint32_t fracBits,
-                        int8_t *__restrict__ pRes);
+void plp_mat_mult_trans_conj_cmplx_i16(const int16_t *__restrict__ pSrcA,
+                                       const int16_t *__restrict__ pSrcB,
+                                       uint32_t M,
+                                       uint32_t N,
+                                       uint32_t O,
+                                       int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief      Statisical variance of a 8-bit fixed point vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes       Statisical variance value returned here
-    @return     none
+  @brief      Matrix conjugate transpose matrix multiplication for complex 16-bit integers on RV32IM
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
 */
 
-void plp_var_q8s_xpulpv2(const int8_t *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         uint32_t fracBits,
-                         int8_t *__restrict__ pRes);
+void plp_mat_mult_trans_conj_cmplx_i16s_rv32im(const int16_t *__restrict__ pSrcA,
+                                               const int16_t *__restrict__ pSrcB,
+                                               uint32_t M,
+                                               uint32_t N,
+                                               uint32_t O,
+                                               int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Statisical standard deviation of a 32-bit floating point vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical standard deviation returned here
-    @return     none
+  @brief      Matrix conjugate transpose matrix multiplication for complex 16-bit integers on
+              XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Exploiting SIMD instructions
+  Every complex value is packed into one 32 bit vector {re, im}. The real part of a * conj(b) is the
+  dot product of a and b. For the imaginary part, the real part of a is inverted (~re = -re - 1,
+  which cannot overflow) and the dot product with the swapped b yields the imaginary part minus the
+  imaginary part of b. The imaginary parts of b are accumulated with one more dot product per
+  column. The kernel computes blocks of 2x2 output elements, such that every loaded vector is used
+  twice. The inner loop takes 18 instructions for 4 complex multiply-accumulates.
 */
 
-void plp_std_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes);
+void plp_mat_mult_trans_conj_cmplx_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                                const int16_t *__restrict__ pSrcB,
+                                                uint32_t M,
+                                                uint32_t N,
+                                                uint32_t O,
+                                                int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief      Kernel for Statisical standard deviation of a 32-bit float vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical standard deviation returned here
-    @return     none
+  @brief      Glue code of parallel matrix conjugate transpose matrix multiplication for complex
+              16-bit integers
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
 */
 
-void plp_std_f32_xpulpv2(const float *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         float *__restrict__ pRes);
+void plp_mat_mult_trans_conj_cmplx_i16_parallel(const int16_t *__restrict__ pSrcA,
+                                                const int16_t *__restrict__ pSrcB,
+                                                uint32_t M,
+                                                uint32_t N,
+                                                uint32_t O,
+                                                uint32_t nPE,
+                                                int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Statisical standard deviation of a 32-bit fixed point vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical standard deviation returned here
-    @return     none
-*/
+  @brief      Parallel matrix conjugate transpose matrix multiplication for complex 16-bit integers
+              on XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_i16 struct initialized by
+                    plp_mat_mult_trans_conj_cmplx_i16_parallel
+  @return     none
 
-void plp_std_q32(const int32_t *__restrict__ pSrc,
-                 uint32_t blockSize,
-                 uint32_t fracBits,
-                 int32_t *__restrict__ pRes);
+  @par Exploiting SIMD instructions
+  Every complex value is packed into one 32 bit vector {re, im}. The real part of a * conj(b) is the
+  dot product of a and b. For the imaginary part, the real part of a is inverted (~re = -re - 1,
+  which cannot overflow) and the dot product with the swapped b yields the imaginary part minus the
+  imaginary part of b. The imaginary parts of b are accumulated with one more dot product per
+  column. The kernel computes blocks of 2x2 output elements, such that every loaded vector is used
+  twice. The inner loop takes 18 instructions for 4 complex multiply-accumulates.
 
-/** -------------------------------------------------------
-    @brief      Statisical standard deviation of a 32-bit fixed point vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical standard deviation value returned here
-    @return     none
+  @par Parallelization
+  Every core computes every nPE-th block of two rows. The columns of a remaining odd row are split
+  over the cores.
 */
 
-void plp_std_q32s_rv32im(const int32_t *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         uint32_t fracBits,
-                         int32_t *__restrict__ pRes);
+void plp_mat_mult_trans_conj_cmplx_i16p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-    @brief      Statisical standard deviation of a 32-bit fixed point vector for XPULPV2
-    extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes       Statisical standard deviation returned here
-    @return     none
+  @brief      Glue code of matrix conjugate transpose matrix multiplication for complex 8-bit
+              integers
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
 */
 
-void plp_std_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
-                          uint32_t blockSize,
-                          uint32_t fracBits,
-                          int32_t *__restrict__ pRes);
+void plp_mat_mult_trans_conj_cmplx_i8(const int8_t *__restrict__ pSrcA,
+                                      const int8_t *__restrict__ pSrcB,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t O,
+                                      int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Statisical standard deviation of a 16-bit fixed point vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical standard deviation returned here
-    @return     none
+  @brief      Matrix conjugate transpose matrix multiplication for complex 8-bit integers on RV32IM
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
 */
 
-void plp_std_q16(const int16_t *__restrict__ pSrc,
-                 uint32_t blockSize,
-                 uint32_t fracBits,
-                 int16_t *__restrict__ pRes);
+void plp_mat_mult_trans_conj_cmplx_i8s_rv32im(const int8_t *__restrict__ pSrcA,
+                                              const int8_t *__restrict__ pSrcB,
+                                              uint32_t M,
+                                              uint32_t N,
+                                              uint32_t O,
+                                              int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief      Statisical standard deviation of a 16-bit fixed point vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical standard deviation returned here
-    @return     none
+  @brief      Matrix conjugate transpose matrix multiplication for complex 8-bit integers on XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Exploiting SIMD instructions
+  Two complex values are packed into one 32 bit vector {re0, im0, re1, im1}, such that every dot
+  product accumulates two complex products. The real part of a * conj(b) is the dot product of a and
+  b. For the imaginary part, the real part of a is inverted (~re = -re - 1, which cannot overflow)
+  and the dot product with the swapped b yields the imaginary part minus the imaginary part of b.
+  The imaginary parts of b are accumulated with one more dot product per column. The kernel computes
+  blocks of 2x2 output elements, such that every loaded vector is used twice. The inner loop takes
+  18 instructions for 8 complex multiply-accumulates. Rows starting at word boundaries (even
+  strides) avoid misaligned loads.
+*/
+
+void plp_mat_mult_trans_conj_cmplx_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                               const int8_t *__restrict__ pSrcB,
+                                               uint32_t M,
+                                               uint32_t N,
+                                               uint32_t O,
+                                               int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Glue code of parallel matrix conjugate transpose matrix multiplication for complex
+              8-bit integers
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
 */
 
-void plp_std_q16s_rv32im(const int16_t *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         uint32_t fracBits,
-                         int16_t *__restrict__ pRes);
+void plp_mat_mult_trans_conj_cmplx_i8_parallel(const int8_t *__restrict__ pSrcA,
+                                               const int8_t *__restrict__ pSrcB,
+                                               uint32_t M,
+                                               uint32_t N,
+                                               uint32_t O,
+                                               uint32_t nPE,
+                                               int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief      Statisical standard deviation of a 16-bit fixed point vector for XPULPV2
-    extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes       Statisical standard deviation returned here
-    @return     none
-*/
+  @brief      Parallel matrix conjugate transpose matrix multiplication for complex 8-bit integers
+              on XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_i8 struct initialized by
+                    plp_mat_mult_trans_conj_cmplx_i8_parallel
+  @return     none
 
-void plp_std_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
-                          uint32_t blockSize,
-                          uint32_t fracBits,
-                          int16_t *__restrict__ pRes);
+  @par Exploiting SIMD instructions
+  Two complex values are packed into one 32 bit vector {re0, im0, re1, im1}, such that every dot
+  product accumulates two complex products. The real part of a * conj(b) is the dot product of a and
+  b. For the imaginary part, the real part of a is inverted (~re = -re - 1, which cannot overflow)
+  and the dot product with the swapped b yields the imaginary part minus the imaginary part of b.
+  The imaginary parts of b are accumulated with one more dot product per column. The kernel computes
+  blocks of 2x2 output elements, such that every loaded vector is used twice. The inner loop takes
+  18 instructions for 8 complex multiply-accumulates. Rows starting at word boundaries (even
+  strides) avoid misaligned loads.
 
-/** -------------------------------------------------------
-    @brief      Glue code for Statisical standard deviation of a 8-bit fixed point vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical standard deviation returned here
-    @return     none
+  @par Parallelization
+  Every core computes every nPE-th block of two rows. The columns of a remaining odd row are split
+  over the cores.
 */
 
-void plp_std_q8(const int8_t *__restrict__ pSrc,
-                uint32_t blockSize,
-                uint32_t fracBits,
-                int8_t *__restrict__ pRes);
+void plp_mat_mult_trans_conj_cmplx_i8p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-    @brief      Statisical standard deviation of a 8-bit fixed point vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical standard deviation returned here
-    @return     none
+  @brief      Glue code of matrix conjugate transpose matrix multiplication for complex 32-bit
+              floats
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
 */
 
-void plp_std_q8s_rv32im(const int8_t *__restrict__ pSrc,
-                        uint32_t blockSize,
-                        uint32_t fracBits,
-                        int8_t *__restrict__ pRes);
+void plp_mat_mult_trans_conj_cmplx_f32(const float *__restrict__ pSrcA,
+                                       const float *__restrict__ pSrcB,
+                                       uint32_t M,
+                                       uint32_t N,
+                                       uint32_t O,
+                                       float *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief      Statisical standard deviation of a 8-bit fixed point vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes       Statisical standard deviation value returned here
-    @return     none
-*/
+  @brief      Matrix conjugate transpose matrix multiplication for complex 32-bit floats on XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
 
-void plp_std_q8s_xpulpv2(const int8_t *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         uint32_t fracBits,
-                         int8_t *__restrict__ pRes);
-/** -------------------------------------------------------
-    @brief      Glue code for Statisical standard deviation of a 32-bit floating point vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical standard deviation returned here
-    @return     none
+  @par Blocking
+  The kernel computes blocks of 2x2 output elements, such that every loaded complex value is used
+  twice. This halves the loads per complex multiply-accumulate.
 */
 
-void plp_rms_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes);
+void plp_mat_mult_trans_conj_cmplx_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                                                const float *__restrict__ pSrcB,
+                                                uint32_t M,
+                                                uint32_t N,
+                                                uint32_t O,
+                                                float *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief      Kernel for Statisical standard deviation of a 32-bit float vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical standard deviation returned here
-    @return     none
+  @brief      Glue code of parallel matrix conjugate transpose matrix multiplication for complex
+              32-bit floats
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
 */
 
-void plp_rms_f32_xpulpv2(const float *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         float *__restrict__ pRes);
+void plp_mat_mult_trans_conj_cmplx_f32_parallel(const float *__restrict__ pSrcA,
+                                                const float *__restrict__ pSrcB,
+                                                uint32_t M,
+                                                uint32_t N,
+                                                uint32_t O,
+                                                uint32_t nPE,
+                                                float *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Statisical standard deviation of a 32-bit fixed point vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical standard deviation returned here
-    @return     none
-*/
+  @brief      Parallel matrix conjugate transpose matrix multiplication for complex 32-bit floats on
+              XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_f32 struct initialized by
+                    plp_mat_mult_trans_conj_cmplx_f32_parallel
+  @return     none
 
-void plp_rms_q32(const int32_t *__restrict__ pSrc,
-                 uint32_t blockSize,
-                 uint32_t fracBits,
-                 int32_t *__restrict__ pRes);
+  @par Blocking
+  The kernel computes blocks of 2x2 output elements, such that every loaded complex value is used
+  twice. This halves the loads per complex multiply-accumulate.
 
-/** -------------------------------------------------------
-    @brief      Statisical standard deviation of a 32-bit fixed point vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical standard deviation value returned here
-    @return     none
+  @par Parallelization
+  Every core computes every nPE-th block of two rows. The columns of a remaining odd row are split
+  over the cores.
 */
 
-void plp_rms_q32s_rv32im(const int32_t *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         uint32_t fracBits,
-                         int32_t *__restrict__ pRes);
+void plp_mat_mult_trans_conj_cmplx_f32p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-    @brief      Statisical standard deviation of a 32-bit fixed point vector for XPULPV2
-    extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes       Statisical standard deviation returned here
-    @return     none
+  @brief      Glue code of matrix conjugate transpose matrix multiplication for complex 16-bit
+              fix-point
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`. The output matrix is also
+  stored with the same number of bits as the inputs. Set the `shift` parameter such that no overflow
+  occurrs.
 */
 
-void plp_rms_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
-                          uint32_t blockSize,
-                          uint32_t fracBits,
-                          int32_t *__restrict__ pRes);
+void plp_mat_mult_trans_conj_cmplx_q16(const int16_t *__restrict__ pSrcA,
+                                       const int16_t *__restrict__ pSrcB,
+                                       uint32_t M,
+                                       uint32_t N,
+                                       uint32_t O,
+                                       uint32_t shift,
+                                       int16_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Statisical standard deviation of a 16-bit fixed point vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical standard deviation returned here
-    @return     none
+  @brief      Matrix conjugate transpose matrix multiplication for complex 16-bit fix-point on
+              RV32IM
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`. The output matrix is also
+  stored with the same number of bits as the inputs. Set the `shift` parameter such that no overflow
+  occurrs.
 */
 
-void plp_rms_q16(const int16_t *__restrict__ pSrc,
-                 uint32_t blockSize,
-                 uint32_t fracBits,
-                 int16_t *__restrict__ pRes);
+void plp_mat_mult_trans_conj_cmplx_q16s_rv32im(const int16_t *__restrict__ pSrcA,
+                                               const int16_t *__restrict__ pSrcB,
+                                               uint32_t M,
+                                               uint32_t N,
+                                               uint32_t O,
+                                               uint32_t shift,
+                                               int16_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief      Statisical standard deviation of a 16-bit fixed point vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical standard deviation returned here
-    @return     none
-*/
+  @brief      Matrix conjugate transpose matrix multiplication for complex 16-bit fix-point on
+              XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
 
-void plp_rms_q16s_rv32im(const int16_t *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         uint32_t fracBits,
-                         int16_t *__restrict__ pRes);
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`. The output matrix is also
+  stored with the same number of bits as the inputs. Set the `shift` parameter such that no overflow
+  occurrs.
 
-/** -------------------------------------------------------
-    @brief      Statisical standard deviation of a 16-bit fixed point vector for XPULPV2
-    extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes       Statisical standard deviation returned here
-    @return     none
+  @par Exploiting SIMD instructions
+  Every complex value is packed into one 32 bit vector {re, im}. The real part of a * conj(b) is the
+  dot product of a and b. For the imaginary part, the real part of a is inverted (~re = -re - 1,
+  which cannot overflow) and the dot product with the swapped b yields the imaginary part minus the
+  imaginary part of b. The imaginary part of b is added back with __ADDROUNDNORM_REG, such that
+  every product is rounded and shifted before it is accumulated, as on RV32IM. The kernel computes
+  blocks of 2x2 output elements, such that every loaded vector is used twice. The inner loop takes
+  34 instructions for 4 complex multiply-accumulates.
 */
 
-void plp_rms_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
-                          uint32_t blockSize,
-                          uint32_t fracBits,
-                          int16_t *__restrict__ pRes);
+void plp_mat_mult_trans_conj_cmplx_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                                const int16_t *__restrict__ pSrcB,
+                                                uint32_t M,
+                                                uint32_t N,
+                                                uint32_t O,
+                                                uint32_t shift,
+                                                int16_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Statisical standard deviation of a 8-bit fixed point vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical standard deviation returned here
-    @return     none
+  @brief      Glue code of parallel matrix conjugate transpose matrix multiplication for complex
+              16-bit fix-point
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`. The output matrix is also
+  stored with the same number of bits as the inputs. Set the `shift` parameter such that no overflow
+  occurrs.
 */
 
-void plp_rms_q8(const int8_t *__restrict__ pSrc,
-                uint32_t blockSize,
-                uint32_t fracBits,
-                int8_t *__restrict__ pRes);
+void plp_mat_mult_trans_conj_cmplx_q16_parallel(const int16_t *__restrict__ pSrcA,
+                                                const int16_t *__restrict__ pSrcB,
+                                                uint32_t M,
+                                                uint32_t N,
+                                                uint32_t O,
+                                                uint32_t shift,
+                                                uint32_t nPE,
+                                                int16_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief      Statisical standard deviation of a 8-bit fixed point vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical standard deviation returned here
-    @return     none
+  @brief      Parallel matrix conjugate transpose matrix multiplication for complex 16-bit fix-point
+              on XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_q16 struct initialized by
+                    plp_mat_mult_trans_conj_cmplx_q16_parallel
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`. The output matrix is also
+  stored with the same number of bits as the inputs. Set the `shift` parameter such that no overflow
+  occurrs.
+
+  @par Exploiting SIMD instructions
+  Every complex value is packed into one 32 bit vector {re, im}. The real part of a * conj(b) is the
+  dot product of a and b. For the imaginary part, the real part of a is inverted (~re = -re - 1,
+  which cannot overflow) and the dot product with the swapped b yields the imaginary part minus the
+  imaginary part of b. The imaginary part of b is added back with __ADDROUNDNORM_REG, such that
+  every product is rounded and shifted before it is accumulated, as on RV32IM. The kernel computes
+  blocks of 2x2 output elements, such that every loaded vector is used twice. The inner loop takes
+  34 instructions for 4 complex multiply-accumulates.
+
+  @par Parallelization
+  Every core computes every nPE-th block of two rows. The columns of a remaining odd row are split
+  over the cores.
 */
 
-void plp_rms_q8s_rv32im(const int8_t *__restrict__ pSrc,
-                        uint32_t blockSize,
-                        uint32_t fracBits,
-                        int8_t *__restrict__ pRes);
+void plp_mat_mult_trans_conj_cmplx_q16p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-    @brief      Statisical standard deviation of a 8-bit fixed point vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes       Statisical standard deviation value returned here
-    @return     none
+  @brief      Conversion of a dense 8-bit integer matrix to the CSR format
+  @param[in]  pSrc    Points to the dense input matrix of shape MxN
+  @param[in]  M       Height of the matrix
+  @param[in]  N       Width of the matrix, at most 65536
+  @param[in]  maxNnz  Number of values pValues and pColIdx can hold
+  @param[out] pValues Points to the buffer for the nonzero values
+  @param[out] pColIdx Points to the buffer for the column indices
+  @param[out] pRowPtr Points to the buffer for the M + 1 row pointers
+  @param[out] pDst    Points to the sparse matrix, which refers to the buffers
+  @return     0: Success, 1: N is too large or there are more than maxNnz nonzero values
+
+  pRowPtr is always filled completely, so after a failure pRowPtr[M] is the
+  number of nonzero values, i.e. the size the buffers need.
 */
 
-void plp_rms_q8s_xpulpv2(const int8_t *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         uint32_t fracBits,
-                         int8_t *__restrict__ pRes);
+int plp_spmat_csr_from_dense_i8(const int8_t *__restrict__ pSrc,
+                                uint32_t M,
+                                uint32_t N,
+                                uint32_t maxNnz,
+                                int8_t *__restrict__ pValues,
+                                uint16_t *__restrict__ pColIdx,
+                                uint32_t *__restrict__ pRowPtr,
+                                plp_spmat_csr_i8 *pDst);
 
 /** -------------------------------------------------------
-    @brief      Glue code for square root of a 32-bit fixed point number.
-    @param[in]  in   32-Bit input integer
-    @param[out] out  Square root of the input
-    @return     none
+  @brief      Conversion of a dense 16-bit integer matrix to the CSR format
+  @param[in]  pSrc    Points to the dense input matrix of shape MxN
+  @param[in]  M       Height of the matrix
+  @param[in]  N       Width of the matrix, at most 65536
+  @param[in]  maxNnz  Number of values pValues and pColIdx can hold
+  @param[out] pValues Points to the buffer for the nonzero values
+  @param[out] pColIdx Points to the buffer for the column indices
+  @param[out] pRowPtr Points to the buffer for the M + 1 row pointers
+  @param[out] pDst    Points to the sparse matrix, which refers to the buffers
+  @return     0: Success, 1: N is too large or there are more than maxNnz nonzero values
+
+  pRowPtr is always filled completely, so after a failure pRowPtr[M] is the
+  number of nonzero values, i.e. the size the buffers need.
 */
 
-void plp_sqrt_q32(const int32_t *__restrict__ pSrc,
-                  const uint32_t fracBits,
-                  int32_t *__restrict__ pRes);
+int plp_spmat_csr_from_dense_i16(const int16_t *__restrict__ pSrc,
+                                 uint32_t M,
+                                 uint32_t N,
+                                 uint32_t maxNnz,
+                                 int16_t *__restrict__ pValues,
+                                 uint16_t *__restrict__ pColIdx,
+                                 uint32_t *__restrict__ pRowPtr,
+                                 plp_spmat_csr_i16 *pDst);
 
 /** -------------------------------------------------------
-    @brief      Square root of a 32-bit fixed point number for XPULPV2 extension.
-    @param[in]  in   32-Bit input integer
-    @param[out] out  Square root of the input
-    @return     none
+  @brief      Conversion of a dense 32-bit floating-point matrix to the CSR format
+  @param[in]  pSrc    Points to the dense input matrix of shape MxN
+  @param[in]  M       Height of the matrix
+  @param[in]  N       Width of the matrix, at most 65536
+  @param[in]  maxNnz  Number of values pValues and pColIdx can hold
+  @param[out] pValues Points to the buffer for the nonzero values
+  @param[out] pColIdx Points to the buffer for the column indices
+  @param[out] pRowPtr Points to the buffer for the M + 1 row pointers
+  @param[out] pDst    Points to the sparse matrix, which refers to the buffers
+  @return     0: Success, 1: N is too large or there are more than maxNnz nonzero values
+
+  pRowPtr is always filled completely, so after a failure pRowPtr[M] is the
+  number of nonzero values, i.e. the size the buffers need.
 */
 
-void plp_sqrt_q32s_rv32im(const int32_t *__restrict__ pSrc,
-                          const uint32_t fracBits,
-                          int32_t *__restrict__ pRes);
+int plp_spmat_csr_from_dense_f32(const float *__restrict__ pSrc,
+                                 uint32_t M,
+                                 uint32_t N,
+                                 uint32_t maxNnz,
+                                 float *__restrict__ pValues,
+                                 uint16_t *__restrict__ pColIdx,
+                                 uint32_t *__restrict__ pRowPtr,
+                                 plp_spmat_csr_f32 *pDst);
+
+/** -------------------------------------------------------
+  @brief      Conversion of a dense 8-bit integer matrix to the BCSR format
+  @param[in]  pSrc      Points to the dense input matrix of shape MxN
+  @param[in]  M         Height of the matrix, a multiple of blkRows
+  @param[in]  N         Width of the matrix, a multiple of 4
+  @param[in]  blkRows   Number of rows of a block, 1 or 4
+  @param[in]  maxBlocks Number of blocks pValues and pColIdx can hold
+  @param[out] pValues   Points to the buffer for the values of the blocks
+  @param[out] pColIdx   Points to the buffer for the block columns
+  @param[out] pRowPtr   Points to the buffer for the M / blkRows + 1 row pointers
+  @param[out] pDst      Points to the sparse matrix, which refers to the buffers
+  @return     0: Success, 1: Unsupported shape or more than maxBlocks nonzero blocks
+
+  pValues must hold blkRows * 4 values per block. For a supported shape, pRowPtr is
+  always filled completely, so after a failure pRowPtr[M / blkRows] is the number of
+  nonzero blocks.
+*/
+
+int plp_spmat_bcsr_from_dense_i8(const int8_t *__restrict__ pSrc,
+                                 uint32_t M,
+                                 uint32_t N,
+                                 uint32_t blkRows,
+                                 uint32_t maxBlocks,
+                                 int8_t *__restrict__ pValues,
+                                 uint16_t *__restrict__ pColIdx,
+                                 uint32_t *__restrict__ pRowPtr,
+                                 plp_spmat_bcsr_i8 *pDst);
+
+/** -------------------------------------------------------
+  @brief      Conversion of a dense 16-bit integer matrix to the BCSR format
+  @param[in]  pSrc      Points to the dense input matrix of shape MxN
+  @param[in]  M         Height of the matrix, a multiple of blkRows
+  @param[in]  N         Width of the matrix, a multiple of 4
+  @param[in]  blkRows   Number of rows of a block, 1 or 4
+  @param[in]  maxBlocks Number of blocks pValues and pColIdx can hold
+  @param[out] pValues   Points to the buffer for the values of the blocks
+  @param[out] pColIdx   Points to the buffer for the block columns
+  @param[out] pRowPtr   Points to the buffer for the M / blkRows + 1 row pointers
+  @param[out] pDst      Points to the sparse matrix, which refers to the buffers
+  @return     0: Success, 1: Unsupported shape or more than maxBlocks nonzero blocks
+
+  pValues must hold blkRows * 4 values per block. For a supported shape, pRowPtr is
+  always filled completely, so after a failure pRowPtr[M / blkRows] is the number of
+  nonzero blocks.
+*/
+
+int plp_spmat_bcsr_from_dense_i16(const int16_t *__restrict__ pSrc,
+                                  uint32_t M,
+                                  uint32_t N,
+                                  uint32_t blkRows,
+                                  uint32_t maxBlocks,
+                                  int16_t *__restrict__ pValues,
+                                  uint16_t *__restrict__ pColIdx,
+                                  uint32_t *__restrict__ pRowPtr,
+                                  plp_spmat_bcsr_i16 *pDst);
 
 /** -------------------------------------------------------
-    @brief      Square root of a 32-bit fixed point number for XPULPV2 extension.
-    @param[in]  in   32-Bit input integer
-    @param[out] out  Square root of the input
-    @return     none
+  @brief      Split of the rows of a sparse matrix into parts with the same amount of work
+  @param[in]  pRowPtr Points to the M + 1 row pointers of a CSR or BCSR matrix
+  @param[in]  M       Number of (block) rows
+  @param[in]  nPE     Number of parts, i.e. cores
+  @param[in]  k       Index of the part, 0 to nPE
+  @return     First row of part k. Part k has the rows plp_spmat_row_split(.., k) to
+              plp_spmat_row_split(.., k + 1) - 1, part nPE starts at row M.
+
+  The work of a row is its number of nonzero values (or blocks) plus one for the row
+  itself. The parts are found with a binary search on pRowPtr, such that every core
+  can compute its own rows at the start of a parallel kernel.
 */
 
-void plp_sqrt_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
-                           const uint32_t fracBits,
-                           int32_t *__restrict__ pRes);
+uint32_t plp_spmat_row_split(const uint32_t *__restrict__ pRowPtr,
+                             uint32_t M,
+                             uint32_t nPE,
+                             uint32_t k);
 
 /** -------------------------------------------------------
-    @brief      Glue code for square root of a 16-bit fixed point number.
-    @param[in]  in   16-Bit input integer
-    @param[out] out  Square root of the input
-    @return     none
+  @brief      Glue code of sparse matrix-vector multiplication for 8-bit integers in CSR format
+  @param[in]  pSrcA Points to the sparse matrix of shape MxN
+  @param[in]  pSrcX Points to the input vector of length N
+  @param[out] pDstY Points to the output vector of length M
+  @return     none
 */
 
-void plp_sqrt_q16(const int16_t *__restrict__ pSrc,
-                  const uint32_t fracBits,
-                  int16_t *__restrict__ pRes);
+void plp_spmv_csr_i8(const plp_spmat_csr_i8 *__restrict__ pSrcA,
+                     const int8_t *__restrict__ pSrcX,
+                     int32_t *__restrict__ pDstY);
 
 /** -------------------------------------------------------
-    @brief      Square root of a 16-bit fixed point number for XPULPV2 extension.
-    @param[in]  in   16-Bit input integer
-    @param[out] out  Square root of the input
-    @return     none
+  @brief      Sparse matrix-vector multiplication for 8-bit integers in CSR format kernel for RV32IM
+              extension
+  @param[in]  pSrcA Points to the sparse matrix of shape MxN
+  @param[in]  pSrcX Points to the input vector of length N
+  @param[out] pDstY Points to the output vector of length M
+  @return     none
 */
 
-void plp_sqrt_q16s_rv32im(const int16_t *__restrict__ pSrc,
-                          const uint32_t fracBits,
-                          int16_t *__restrict__ pRes);
+void plp_spmv_csr_i8s_rv32im(const plp_spmat_csr_i8 *__restrict__ pSrcA,
+                             const int8_t *__restrict__ pSrcX,
+                             int32_t *__restrict__ pDstY);
 
 /** -------------------------------------------------------
-    @brief      Square root of a 16-bit fixed point number for XPULPV2 extension.
-    @param[in]  in   16-Bit input integer
-    @param[out] out  Square root of the input
-    @return     none
-*/
+  @brief      Sparse matrix-vector multiplication for 8-bit integers in CSR format kernel for
+              XPULPV2 extension
+  @param[in]  pSrcA Points to the sparse matrix of shape MxN
+  @param[in]  pSrcX Points to the input vector of length N
+  @param[out] pDstY Points to the output vector of length M
+  @return     none
 
-void plp_sqrt_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
-                           const uint32_t fracBits,
-                           int16_t *__restrict__ pRes);
+  @par Loop unrolling
+  Two nonzero values are processed per iteration with independent accumulators, such
+  that the gathered loads of the vector do not stall the multiply-accumulate.
+*/
 
-/**
- * @brief Macros required for SINE and COSINE Fast math approximations
- */
+void plp_spmv_csr_i8s_xpulpv2(const plp_spmat_csr_i8 *__restrict__ pSrcA,
+                              const int8_t *__restrict__ pSrcX,
+                              int32_t *__restrict__ pDstY);
 
-#define FAST_MATH_TABLE_SIZE 512
-#define FAST_MATH_Q32_SHIFT (32 - 10)
-#define FAST_MATH_Q16_SHIFT (16 - 10)
-#define CONTROLLER_Q32_SHIFT (32 - 9)
-#define TABLE_SPACING_Q32 0x400000
-#define TABLE_SPACING_Q16 0x80
+/** -------------------------------------------------------
+  @brief      Glue code of parallel sparse matrix-vector multiplication for 8-bit integers in CSR
+              format
+  @param[in]  pSrcA Points to the sparse matrix of shape MxN
+  @param[in]  pSrcX Points to the input vector of length N
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstY Points to the output vector of length M
+  @return     none
 
-/**
- * @brief      Glue code for q32 cosine function
- *
- * @param[in]  x     Scaled input value: Q1.31 value in range [0, +0.9999] and is mapped to [0,
- * 2*PI)
- *
- * @return     cos(x)
- */
+  @par Parallelization
+  The rows are split with plp_spmat_row_split, such that every core gets about the same
+  number of nonzero values instead of the same number of rows.
+*/
 
-int32_t plp_cos_q32(int32_t x);
+void plp_spmv_csr_i8_parallel(const plp_spmat_csr_i8 *__restrict__ pSrcA,
+                              const int8_t *__restrict__ pSrcX,
+                              uint32_t nPE,
+                              int32_t *__restrict__ pDstY);
 
-/**
- * @brief      q32 cosine function for RV32IM
- *
- * @param[in]  x     Scaled input value: Q1.31 value in range [0, +0.9999] and is mapped to [0,
- * 2*PI)
- *
- * @return     cos(x)
- */
+/** -------------------------------------------------------
+  @brief      Parallel sparse matrix-vector multiplication for 8-bit integers in CSR format kernel
+              for XPULPV2 extension
+  @param[in]  args  pointer to plp_spmat_csr_mult_instance_i8 struct initialized by
+                    plp_spmv_csr_i8_parallel
+  @return     none
 
-int32_t plp_cos_q32s_rv32im(int32_t x);
+  @par Loop unrolling
+  Two nonzero values are processed per iteration with independent accumulators, such
+  that the gathered loads of the vector do not stall the multiply-accumulate.
 
-/**
- * @brief      q32 cosine function for XPULPV2
- *
- * @param[in]  x     Scaled input value: Q1.31 value in range [0, +0.9999] and is mapped to [0,
- * 2*PI)
- *
- * @return     cos(x)
- */
+  @par Parallelization
+  The rows are split with plp_spmat_row_split, such that every core gets about the same
+  number of nonzero values instead of the same number of rows.
+*/
 
-int32_t plp_cos_q32s_xpulpv2(int32_t x);
+void plp_spmv_csr_i8p_xpulpv2(void *args);
 
-/**
- * @brief      Glue code for q16 cosine function
- *
- * @param[in]  x     Scaled input value: Q1.15 value in range [0, +0.9999] and is mapped to [0,
- * 2*PI)
- *
- * @return     cos(x)
- */
+/** -------------------------------------------------------
+  @brief      Glue code of sparse matrix-vector multiplication for 16-bit integers in CSR format
+  @param[in]  pSrcA Points to the sparse matrix of shape MxN
+  @param[in]  pSrcX Points to the input vector of length N
+  @param[out] pDstY Points to the output vector of length M
+  @return     none
+*/
 
-int16_t plp_cos_q16(int16_t x);
+void plp_spmv_csr_i16(const plp_spmat_csr_i16 *__restrict__ pSrcA,
+                      const int16_t *__restrict__ pSrcX,
+                      int32_t *__restrict__ pDstY);
 
-/**
- * @brief      q16 cosine function for RV32IM
- *
- * @param[in]  x     Scaled input value: Q1.15 value in range [0, +0.9999] and is mapped to [0,
- * 2*PI)
- *
- * @return     cos(x)
- */
+/** -------------------------------------------------------
+  @brief      Sparse matrix-vector multiplication for 16-bit integers in CSR format kernel for
+              RV32IM extension
+  @param[in]  pSrcA Points to the sparse matrix of shape MxN
+  @param[in]  pSrcX Points to the input vector of length N
+  @param[out] pDstY Points to the output vector of length M
+  @return     none
+*/
 
-int16_t plp_cos_q16s_rv32im(int16_t x);
+void plp_spmv_csr_i16s_rv32im(const plp_spmat_csr_i16 *__restrict__ pSrcA,
+                              const int16_t *__restrict__ pSrcX,
+                              int32_t *__restrict__ pDstY);
 
-/**
- * @brief      q16 cosine function for XPULPV2
- *
- * @param[in]  x     Scaled input value: Q1.15 value in range [0, +0.9999] and is mapped to [0,
- * 2*PI)
- *
- * @return     cos(x)
- */
+/** -------------------------------------------------------
+  @brief      Sparse matrix-vector multiplication for 16-bit integers in CSR format kernel for
+              XPULPV2 extension
+  @param[in]  pSrcA Points to the sparse matrix of shape MxN
+  @param[in]  pSrcX Points to the input vector of length N
+  @param[out] pDstY Points to the output vector of length M
+  @return     none
 
-int16_t plp_cos_q16s_xpulpv2(int16_t x);
+  @par Loop unrolling
+  Two nonzero values are processed per iteration with independent accumulators, such
+  that the gathered loads of the vector do not stall the multiply-accumulate.
+*/
 
-/**
- * @brief      Glue code for f32 cosine function
- *
- * @param[in]  x     input value in radians
- *
- * @return     cos(x)
- */
+void plp_spmv_csr_i16s_xpulpv2(const plp_spmat_csr_i16 *__restrict__ pSrcA,
+                               const int16_t *__restrict__ pSrcX,
+                               int32_t *__restrict__ pDstY);
 
-float32_t plp_cos_f32(float32_t x);
+/** -------------------------------------------------------
+  @brief      Glue code of parallel sparse matrix-vector multiplication for 16-bit integers in CSR
+              format
+  @param[in]  pSrcA Points to the sparse matrix of shape MxN
+  @param[in]  pSrcX Points to the input vector of length N
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstY Points to the output vector of length M
+  @return     none
 
-/**
- * @brief      F32 cosine function for XPULPV2
- *
- * @param[in]  x     input value in radians
- *
- * @return     cos(x)
- */
+  @par Parallelization
+  The rows are split with plp_spmat_row_split, such that every core gets about the same
+  number of nonzero values instead of the same number of rows.
+*/
 
-float32_t plp_cos_f32s_xpulpv2(float32_t x);
+void plp_spmv_csr_i16_parallel(const plp_spmat_csr_i16 *__restrict__ pSrcA,
+                               const int16_t *__restrict__ pSrcX,
+                               uint32_t nPE,
+                               int32_t *__restrict__ pDstY);
 
-/**
- * @brief      Glue code for q32 sine function
- *
- * @param[in]  x     Scaled input value: Q1.31 value in range [0, +0.9999] and is mapped to [0,
- * 2*PI)
- *
- * @return     sin(x)
- */
+/** -------------------------------------------------------
+  @brief      Parallel sparse matrix-vector multiplication for 16-bit integers in CSR format kernel
+              for XPULPV2 extension
+  @param[in]  args  pointer to plp_spmat_csr_mult_instance_i16 struct initialized by
+                    plp_spmv_csr_i16_parallel
+  @return     none
 
-int32_t plp_sin_q32(int32_t x);
+  @par Loop unrolling
+  Two nonzero values are processed per iteration with independent accumulators, such
+  that the gathered loads of the vector do not stall the multiply-accumulate.
 
-/**
- * @brief      q32 sine function for RV32IM
- *
- * @param[in]  x     Scaled input value: Q1.31 value in range [0, +0.9999] and is mapped to [0,
- * 2*PI)
- *
- * @return     sin(x)
- */
+  @par Parallelization
+  The rows are split with plp_spmat_row_split, such that every core gets about the same
+  number of nonzero values instead of the same number of rows.
+*/
 
-int32_t plp_sin_q32s_rv32im(int32_t x);
+void plp_spmv_csr_i16p_xpulpv2(void *args);
 
-/**
- * @brief      q32 sine function for XPULPV2
- *
- * @param[in]  x     Scaled input value: Q1.31 value in range [0, +0.9999] and is mapped to [0,
- * 2*PI)
- *
- * @return     sin(x)
- */
+/** -------------------------------------------------------
+  @brief      Glue code of sparse matrix-vector multiplication for 32-bit floats in CSR format
+  @param[in]  pSrcA Points to the sparse matrix of shape MxN
+  @param[in]  pSrcX Points to the input vector of length N
+  @param[out] pDstY Points to the output vector of length M
+  @return     none
+*/
 
-int32_t plp_sin_q32s_xpulpv2(int32_t x);
+void plp_spmv_csr_f32(const plp_spmat_csr_f32 *__restrict__ pSrcA,
+                      const float *__restrict__ pSrcX,
+                      float *__restrict__ pDstY);
 
-/**
- * @brief      Glue code for q16 sine function
- *
- * @param[in]  x     Scaled input value: Q1.15 value in range [0, +0.9999] and is mapped to [0,
- * 2*PI)
- *
- * @return     sin(x)
- */
+/** -------------------------------------------------------
+  @brief      Sparse matrix-vector multiplication for 32-bit floats in CSR format kernel for XPULPV2
+              extension
+  @param[in]  pSrcA Points to the sparse matrix of shape MxN
+  @param[in]  pSrcX Points to the input vector of length N
+  @param[out] pDstY Points to the output vector of length M
+  @return     none
 
-int16_t plp_sin_q16(int16_t x);
+  @par Loop unrolling
+  Two nonzero values are processed per iteration with independent accumulators, such
+  that the gathered loads of the vector do not stall the multiply-accumulate.
+*/
 
-/**
- * @brief      q16 sine function for RV32IM
- *
- * @param[in]  x     Scaled input value: Q1.15 value in range [0, +0.9999] and is mapped to [0,
- * 2*PI)
- *
- * @return     sin(x)
- */
+void plp_spmv_csr_f32s_xpulpv2(const plp_spmat_csr_f32 *__restrict__ pSrcA,
+                               const float *__restrict__ pSrcX,
+                               float *__restrict__ pDstY);
 
-int16_t plp_sin_q16s_rv32im(int16_t x);
+/** -------------------------------------------------------
+  @brief      Glue code of parallel sparse matrix-vector multiplication for 32-bit floats in CSR
+              format
+  @param[in]  pSrcA Points to the sparse matrix of shape MxN
+  @param[in]  pSrcX Points to the input vector of length N
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstY Points to the output vector of length M
+  @return     none
 
-/**
- * @brief      q16 sine function for XPULPV2
- *
- * @param[in]  x     Scaled input value: Q1.15 value in range [0, +0.9999] and is mapped to [0,
- * 2*PI)
- *
- * @return     sin(x)
- */
+  @par Parallelization
+  The rows are split with plp_spmat_row_split, such that every core gets about the same
+  number of nonzero values instead of the same number of rows.
+*/
 
-int16_t plp_sin_q16s_xpulpv2(int16_t x);
+void plp_spmv_csr_f32_parallel(const plp_spmat_csr_f32 *__restrict__ pSrcA,
+                               const float *__restrict__ pSrcX,
+                               uint32_t nPE,
+                               float *__restrict__ pDstY);
 
-/**
- * @brief      Glue code for f32 sine function
- *
- * @param[in]  x     input value in radians
- *
- * @return     sin(x)
- */
+/** -------------------------------------------------------
+  @brief      Parallel sparse matrix-vector multiplication for 32-bit floats in CSR format kernel
+              for XPULPV2 extension
+  @param[in]  args  pointer to plp_spmat_csr_mult_instance_f32 struct initialized by
+                    plp_spmv_csr_f32_parallel
+  @return     none
 
-float32_t plp_sin_f32(float32_t x);
+  @par Loop unrolling
+  Two nonzero values are processed per iteration with independent accumulators, such
+  that the gathered loads of the vector do not stall the multiply-accumulate.
 
-/**
- * @brief      F32 sine function for XPULPV2
- *
- * @param[in]  x     input value in radians
- *
- * @return     sin(x)
- */
+  @par Parallelization
+  The rows are split with plp_spmat_row_split, such that every core gets about the same
+  number of nonzero values instead of the same number of rows.
+*/
 
-float32_t plp_sin_f32s_xpulpv2(float32_t x);
+void plp_spmv_csr_f32p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-    @brief Glue code for correlation of 32-bit integer vectors.
-    @param[in]  pSrcA   points to the first input vector
-    @param[in]  srcALen Length of the first input vector
-    @param[in]  pSrcB   points to the second input vector
-    @param[in]  srcBLen Length of the second input vector
-    @param[out] pRes    output result returned here
-    @return     none
+  @brief      Glue code of sparse matrix-vector multiplication for 8-bit integers in BCSR format
+  @param[in]  pSrcA Points to the sparse matrix of shape MxN
+  @param[in]  pSrcX Points to the input vector of length N
+  @param[out] pDstY Points to the output vector of length M
+  @return     none
 */
 
-void plp_correlate_i32(const int32_t *pSrcA,
-                       const uint32_t srcALen,
-                       const int32_t *pSrcB,
-                       const uint32_t srcBLen,
-                       int32_t *pRes);
+void plp_spmv_bcsr_i8(const plp_spmat_bcsr_i8 *__restrict__ pSrcA,
+                      const int8_t *__restrict__ pSrcX,
+                      int32_t *__restrict__ pDstY);
 
 /** -------------------------------------------------------
-    @brief Correlation of 32-bit integer vectors kernel for RV32IM extension.
-    @param[in]  pSrcA   points to the first input vector
-    @param[in]  srcALen Length of the first input vector
-    @param[in]  pSrcB   points to the second input vector
-    @param[in]  srcBLen Length of the second input vector
-    @param[out] pRes    output result returned here
-    @return     none
+  @brief      Sparse matrix-vector multiplication for 8-bit integers in BCSR format kernel for
+              RV32IM extension
+  @param[in]  pSrcA Points to the sparse matrix of shape MxN
+  @param[in]  pSrcX Points to the input vector of length N
+  @param[out] pDstY Points to the output vector of length M
+  @return     none
 */
 
-void plp_correlate_i32s_rv32im(const int32_t *pSrcA,
-                               const uint32_t srcALen,
-                               const int32_t *pSrcB,
-                               const uint32_t srcBLen,
-                               int32_t *pRes);
+void plp_spmv_bcsr_i8s_rv32im(const plp_spmat_bcsr_i8 *__restrict__ pSrcA,
+                              const int8_t *__restrict__ pSrcX,
+                              int32_t *__restrict__ pDstY);
 
 /** -------------------------------------------------------
-    @brief Correlation of 32-bit integer vectors kernel for XPULPV2 extension.
-    @param[in]  pSrcA   points to the first input vector
-    @param[in]  srcALen Length of the first input vector
-    @param[in]  pSrcB   points to the second input vector
-    @param[in]  srcBLen Length of the second input vector
-    @param[out] pRes    output result returned here
-    @return     none */
+  @brief      Sparse matrix-vector multiplication for 8-bit integers in BCSR format kernel for
+              XPULPV2 extension
+  @param[in]  pSrcA Points to the sparse matrix of shape MxN
+  @param[in]  pSrcX Points to the input vector of length N
+  @param[out] pDstY Points to the output vector of length M
+  @return     none
 
-void plp_correlate_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
-                                const uint32_t srcALen,
-                                const int32_t *__restrict__ pSrcB,
-                                const uint32_t srcBLen,
-                                int32_t *__restrict__ pRes);
+  @par Exploiting SIMD instructions
+  Every row of a block is multiplied with one __SUMDOTP4. For blocks of 4x4 values,
+  the loaded part of x is used for all four rows.
+*/
+
+void plp_spmv_bcsr_i8s_xpulpv2(const plp_spmat_bcsr_i8 *__restrict__ pSrcA,
+                               const int8_t *__restrict__ pSrcX,
+                               int32_t *__restrict__ pDstY);
 
 /** -------------------------------------------------------
-  @brief Glue code for correlation of 16-bit integer vectors.
-  @param[in]  pSrcA   points to the first input vector
-  @param[in]  srcALen Length of the first input vector
-  @param[in]  pSrcB   points to the second input vector
-  @param[in]  srcBLen Length of the second input vector
-  @param[out] pRes    result returned here
+  @brief      Glue code of parallel sparse matrix-vector multiplication for 8-bit integers in BCSR
+              format
+  @param[in]  pSrcA Points to the sparse matrix of shape MxN
+  @param[in]  pSrcX Points to the input vector of length N
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstY Points to the output vector of length M
   @return     none
- */
 
-void plp_correlate_i16(const int16_t *pSrcA,
-                       const uint32_t srcALen,
-                       const int16_t *pSrcB,
-                       const uint32_t srcBLen,
-                       int32_t *pRes);
+  @par Parallelization
+  The block rows are split with plp_spmat_row_split, such that every core gets about the
+  same number of blocks instead of the same number of rows.
+*/
+
+void plp_spmv_bcsr_i8_parallel(const plp_spmat_bcsr_i8 *__restrict__ pSrcA,
+                               const int8_t *__restrict__ pSrcX,
+                               uint32_t nPE,
+                               int32_t *__restrict__ pDstY);
 
 /** -------------------------------------------------------
-   @brief Correlation of 16-bit integer vectors kernel for XPULPV2 extension.
-   @param[in]  pSrcA   points to the first input vector
-   @param[in]  srcALen Length of the first input vector
-   @param[in]  pSrcB   points to the second input vector
-   @param[in]  srcBLen Length of the second input vector
-   @param[out] pRes    output result returned here
-   @return     none
+  @brief      Parallel sparse matrix-vector multiplication for 8-bit integers in BCSR format kernel
+              for XPULPV2 extension
+  @param[in]  args  pointer to plp_spmat_bcsr_mult_instance_i8 struct initialized by
+                    plp_spmv_bcsr_i8_parallel
+  @return     none
+
+  @par Exploiting SIMD instructions
+  Every row of a block is multiplied with one __SUMDOTP4. For blocks of 4x4 values,
+  the loaded part of x is used for all four rows.
+
+  @par Parallelization
+  The block rows are split with plp_spmat_row_split, such that every core gets about the
+  same number of blocks instead of the same number of rows.
 */
 
-void plp_correlate_i16s_xpulpv2(const int16_t *pSrcA,
-                                const uint32_t srcALen,
-                                const int16_t *pSrcB,
-                                const uint32_t srcBLen,
-                                int32_t *pRes);
+void plp_spmv_bcsr_i8p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-   @brief Correlation of 16-bit integer vectors kernel for RV32IM extension.
-   @param[in]  pSrcA   points to the first input vector
-   @param[in]  srcALen Length of the first input vector
-   @param[in]  pSrcB   points to the second input vector
-   @param[in]  srcBLen Length of the second input vector
-   @param[out] pRes    output result returned here
-   @return     none
+  @brief      Glue code of sparse matrix-vector multiplication for 16-bit integers in BCSR format
+  @param[in]  pSrcA Points to the sparse matrix of shape MxN
+  @param[in]  pSrcX Points to the input vector of length N
+  @param[out] pDstY Points to the output vector of length M
+  @return     none
 */
 
-void plp_correlate_i16s_rv32im(const int16_t *pSrcA,
-                               const uint32_t srcALen,
-                               const int16_t *pSrcB,
-                               const uint32_t srcBLen,
-                               int32_t *pRes);
+void plp_spmv_bcsr_i16(const plp_spmat_bcsr_i16 *__restrict__ pSrcA,
+                       const int16_t *__restrict__ pSrcX,
+                       int32_t *__restrict__ pDstY);
 
 /** -------------------------------------------------------
-  @brief Glue code for correlation of 8-bit integer vectors.
-  @param[in]  pSrcA   points to the first input vector
-  @param[in]  srcALen Length of the first input vector
-  @param[in]  pSrcB   points to the second input vector
-  @param[in]  srcBLen Length of the second input vector
-  @param[out] pRes    output result returned here
+  @brief      Sparse matrix-vector multiplication for 16-bit integers in BCSR format kernel for
+              RV32IM extension
+  @param[in]  pSrcA Points to the sparse matrix of shape MxN
+  @param[in]  pSrcX Points to the input vector of length N
+  @param[out] pDstY Points to the output vector of length M
   @return     none
- */
+*/
 
-void plp_correlate_i8(const int8_t *pSrcA,
-                      const uint32_t srcALen,
-                      const int8_t *pSrcB,
-                      const uint32_t srcBLen,
-                      int32_t *pRes);
+void plp_spmv_bcsr_i16s_rv32im(const plp_spmat_bcsr_i16 *__restrict__ pSrcA,
+                               const int16_t *__restrict__ pSrcX,
+                               int32_t *__restrict__ pDstY);
 
 /** -------------------------------------------------------
-  @brief Glue code for correlation (valid) of 8-bit integer vectors.
-  @param[in]  pSrcA   points to the first input vector
-  @param[in]  srcALen Length of the first input vector
-  @param[in]  pSrcB   points to the second input vector
-  @param[in]  srcBLen Length of the second input vector
-  @param[out] pRes    output result returned here
+  @brief      Sparse matrix-vector multiplication for 16-bit integers in BCSR format kernel for
+              XPULPV2 extension
+  @param[in]  pSrcA Points to the sparse matrix of shape MxN
+  @param[in]  pSrcX Points to the input vector of length N
+  @param[out] pDstY Points to the output vector of length M
   @return     none
- */
 
-void plp_correlate_valid_i8(const int8_t *pSrcA,
-                            const uint32_t srcALen,
-                            const int8_t *pSrcB,
-                            const uint32_t srcBLen,
-                            int32_t *pRes);
+  @par Exploiting SIMD instructions
+  Every row of a block is multiplied with two __SUMDOTP2. For blocks of 4x4 values, the
+  loaded part of x is used for all four rows.
+*/
+
+void plp_spmv_bcsr_i16s_xpulpv2(const plp_spmat_bcsr_i16 *__restrict__ pSrcA,
+                                const int16_t *__restrict__ pSrcX,
+                                int32_t *__restrict__ pDstY);
 
 /** -------------------------------------------------------
-   @brief Correlation of 8-bit integer vectors kernel for XPULPV2 extension.
-   @param[in]  pSrcA   points to the first input vector
-   @param[in]  srcALen Length of the first input vector
-   @param[in]  pSrcB   points to the second input vector
-   @param[in]  srcBLen Length of the second input vector
-   @param[out] pRes    output result returned here
-   @return     none
+  @brief      Glue code of parallel sparse matrix-vector multiplication for 16-bit integers in BCSR
+              format
+  @param[in]  pSrcA Points to the sparse matrix of shape MxN
+  @param[in]  pSrcX Points to the input vector of length N
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstY Points to the output vector of length M
+  @return     none
+
+  @par Parallelization
+  The block rows are split with plp_spmat_row_split, such that every core gets about the
+  same number of blocks instead of the same number of rows.
 */
 
-void plp_correlate_i8s_xpulpv2(const int8_t *pSrcA,
-                               const uint32_t srcALen,
-                               const int8_t *pSrcB,
-                               const uint32_t srcBLen,
-                               int32_t *pRes);
+void plp_spmv_bcsr_i16_parallel(const plp_spmat_bcsr_i16 *__restrict__ pSrcA,
+                                const int16_t *__restrict__ pSrcX,
+                                uint32_t nPE,
+                                int32_t *__restrict__ pDstY);
 
 /** -------------------------------------------------------
-   @brief Correlation of 8-bit integer vectors kernel for RV32IM extension.
-   @param[in]  pSrcA   points to the first input vector
-   @param[in]  srcALen Length of the first input vector
-   @param[in]  pSrcB   points to the second input vector
-   @param[in]  srcBLen Length of the second input vector
-   @param[out] pRes    output result returned here
-   @return     none
+  @brief      Parallel sparse matrix-vector multiplication for 16-bit integers in BCSR format kernel
+              for XPULPV2 extension
+  @param[in]  args  pointer to plp_spmat_bcsr_mult_instance_i16 struct initialized by
+                    plp_spmv_bcsr_i16_parallel
+  @return     none
+
+  @par Exploiting SIMD instructions
+  Every row of a block is multiplied with two __SUMDOTP2. For blocks of 4x4 values, the
+  loaded part of x is used for all four rows.
+
+  @par Parallelization
+  The block rows are split with plp_spmat_row_split, such that every core gets about the
+  same number of blocks instead of the same number of rows.
 */
 
-void plp_correlate_i8s_rv32im(const int8_t *pSrcA,
-                              const uint32_t srcALen,
-                              const int8_t *pSrcB,
-                              const uint32_t srcBLen,
-                              int32_t *pRes);
+void plp_spmv_bcsr_i16p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-  @brief Glue code for convolution of 32-bit integer vectors.
-  @param[in]  pSrcA    points to the first input vector
-  @param[in]  srcALen  Length of the first input vector
-  @param[in]  pSrcB    points to the second input vector
-  @param[in]  srcBLen  Length of the second input vector
-  @param[out] pRes     result returned here
+  @brief      Glue code of sparse matrix-dense matrix multiplication for 8-bit integers in CSR
+              format
+  @param[in]  pSrcA Points to the sparse matrix of shape MxN
+  @param[in]  pSrcB Points to the dense matrix of shape NxO
+  @param[in]  O     Width of the matrices SrcB and DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
   @return     none
- */
+*/
 
-void plp_conv_i32(const int32_t *pSrcA,
-                  const uint32_t srcALen,
-                  const int32_t *pSrcB,
-                  const uint32_t srcBLen,
-                  int32_t *pRes);
+void plp_spmm_csr_i8(const plp_spmat_csr_i8 *__restrict__ pSrcA,
+                     const int8_t *__restrict__ pSrcB,
+                     uint32_t O,
+                     int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-  @brief Glue code for convolution (valid) of 32-bit integer vectors.
-  @param[in]  pSrcA   points to the first input vector
-  @param[in]  srcALen Length of the first input vector
-  @param[in]  pSrcB   points to the second input vector
-  @param[in]  srcBLen Length of the second input vector
-  @param[out] pRes    output result returned here
+  @brief      Sparse matrix-dense matrix multiplication for 8-bit integers in CSR format kernel for
+              RV32IM extension
+  @param[in]  pSrcA Points to the sparse matrix of shape MxN
+  @param[in]  pSrcB Points to the dense matrix of shape NxO
+  @param[in]  O     Width of the matrices SrcB and DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
   @return     none
- */
+*/
 
-void plp_conv_valid_i32(const int32_t *pSrcA,
-                        const uint32_t srcALen,
-                        const int32_t *pSrcB,
-                        const uint32_t srcBLen,
-                        int32_t *pRes);
+void plp_spmm_csr_i8s_rv32im(const plp_spmat_csr_i8 *__restrict__ pSrcA,
+                             const int8_t *__restrict__ pSrcB,
+                             uint32_t O,
+                             int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief Convolution of 32-bit integer vectors kernel for RV32IM extension.
-   @param[in]  pSrcA   points to the first input vector
-   @param[in]  srcALen Length of the first input vector
-   @param[in]  pSrcB   points to the second input vector
-   @param[in]  srcBLen Length of the second input vector
-   @param[out] pRes    output result returned here
-   @return     none
+  @brief      Sparse matrix-dense matrix multiplication for 8-bit integers in CSR format kernel for
+              XPULPV2 extension
+  @param[in]  pSrcA Points to the sparse matrix of shape MxN
+  @param[in]  pSrcB Points to the dense matrix of shape NxO
+  @param[in]  O     Width of the matrices SrcB and DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Exploiting SIMD instructions
+  Four consecutive nonzero values of a row are loaded as one vector. The rows of B
+  they select are loaded for four columns of C and transposed with eight shuffles,
+  such that every __SUMDOTP4 computes four multiply-accumulates of one output.
 */
 
-void plp_conv_i32s_rv32im(const int32_t *pSrcA,
-                          const uint32_t srcALen,
-                          const int32_t *pSrcB,
-                          const uint32_t srcBLen,
-                          int32_t *pRes);
+void plp_spmm_csr_i8s_xpulpv2(const plp_spmat_csr_i8 *__restrict__ pSrcA,
+                              const int8_t *__restrict__ pSrcB,
+                              uint32_t O,
+                              int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief Convolution of 32-bit integer vectors kernel for XPULPV2 extension.
-   @param[in]  pSrcA   points to the first input vector
-   @param[in]  srcALen Length of the first input vector
-   @param[in]  pSrcB   points to the second input vector
-   @param[in]  srcBLen Length of the second input vector
-   @param[out] pRes    output result returned here
-   @return     none
+  @brief      Glue code of parallel sparse matrix-dense matrix multiplication for 8-bit integers in
+              CSR format
+  @param[in]  pSrcA Points to the sparse matrix of shape MxN
+  @param[in]  pSrcB Points to the dense matrix of shape NxO
+  @param[in]  O     Width of the matrices SrcB and DstC
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Parallelization
+  The rows are split with plp_spmat_row_split, such that every core gets about the same
+  number of nonzero values instead of the same number of rows.
 */
 
-void plp_conv_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
-                           const uint32_t srcALen,
-                           const int32_t *__restrict__ pSrcB,
-                           const uint32_t srcBLen,
-                           int32_t *__restrict__ pRes);
+void plp_spmm_csr_i8_parallel(const plp_spmat_csr_i8 *__restrict__ pSrcA,
+                              const int8_t *__restrict__ pSrcB,
+                              uint32_t O,
+                              uint32_t nPE,
+                              int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief Convolution (valid) of 32-bit integer vectors kernel for XPULPV2 extension.
-   @param[in]  pSrcA   points to the first input vector
-   @param[in]  srcALen Length of the first input vector
-   @param[in]  pSrcB   points to the second input vector
-   @param[in]  srcBLen Length of the second input vector
-   @param[out] pRes    output result returned here
-   @return     none */
+  @brief      Parallel sparse matrix-dense matrix multiplication for 8-bit integers in CSR format
+              kernel for XPULPV2 extension
+  @param[in]  args  pointer to plp_spmat_csr_mult_instance_i8 struct initialized by
+                    plp_spmm_csr_i8_parallel
+  @return     none
 
-void plp_conv_valid_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
-                                 const uint32_t srcALen,
-                                 const int32_t *__restrict__ pSrcB,
-                                 const uint32_t srcBLen,
-                                 int32_t *__restrict__ pRes);
+  @par Exploiting SIMD instructions
+  Four consecutive nonzero values of a row are loaded as one vector. The rows of B
+  they select are loaded for four columns of C and transposed with eight shuffles,
+  such that every __SUMDOTP4 computes four multiply-accumulates of one output.
+
+  @par Parallelization
+  The rows are split with plp_spmat_row_split, such that every core gets about the same
+  number of nonzero values instead of the same number of rows.
+*/
+
+void plp_spmm_csr_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code of sparse matrix-dense matrix multiplication for 16-bit integers in CSR
+              format
+  @param[in]  pSrcA Points to the sparse matrix of shape MxN
+  @param[in]  pSrcB Points to the dense matrix of shape NxO
+  @param[in]  O     Width of the matrices SrcB and DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_spmm_csr_i16(const plp_spmat_csr_i16 *__restrict__ pSrcA,
+                      const int16_t *__restrict__ pSrcB,
+                      uint32_t O,
+                      int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-  @brief Glue code for convolution of 16-bit integer vectors.
-  @param[in]  pSrcA   points to the first input vector
-  @param[in]  srcALen Length of the first input vector
-  @param[in]  pSrcB   points to the second input vector
-  @param[in]  srcBLen Length of the second input vector
-  @param[out] pRes    output result returned here
+  @brief      Sparse matrix-dense matrix multiplication for 16-bit integers in CSR format kernel for
+              RV32IM extension
+  @param[in]  pSrcA Points to the sparse matrix of shape MxN
+  @param[in]  pSrcB Points to the dense matrix of shape NxO
+  @param[in]  O     Width of the matrices SrcB and DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
   @return     none
- */
+*/
 
-void plp_conv_i16(const int16_t *pSrcA,
-                  const uint32_t srcALen,
-                  const int16_t *pSrcB,
-                  const uint32_t srcBLen,
-                  int32_t *pRes);
+void plp_spmm_csr_i16s_rv32im(const plp_spmat_csr_i16 *__restrict__ pSrcA,
+                              const int16_t *__restrict__ pSrcB,
+                              uint32_t O,
+                              int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-  @brief Glue code for convolution (valid) of 16-bit integer vectors.
-  @param[in]  pSrcA   points to the first input vector
-  @param[in]  srcALen Length of the first input vector
-  @param[in]  pSrcB   points to the second input vector
-  @param[in]  srcBLen Length of the second input vector
-  @param[out] pRes    output result returned here
+  @brief      Sparse matrix-dense matrix multiplication for 16-bit integers in CSR format kernel for
+              XPULPV2 extension
+  @param[in]  pSrcA Points to the sparse matrix of shape MxN
+  @param[in]  pSrcB Points to the dense matrix of shape NxO
+  @param[in]  O     Width of the matrices SrcB and DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
   @return     none
- */
 
-void plp_conv_valid_i16(const int16_t *pSrcA,
-                        const uint32_t srcALen,
-                        const int16_t *pSrcB,
-                        const uint32_t srcBLen,
-                        int32_t *pRes);
+  @par Exploiting SIMD instructions
+  Two consecutive nonzero values of a row are loaded as one vector. The rows of B they
+  select are loaded for four columns of C and transposed with four shuffles, such that
+  every __SUMDOTP2 computes two multiply-accumulates of one output.
+*/
+
+void plp_spmm_csr_i16s_xpulpv2(const plp_spmat_csr_i16 *__restrict__ pSrcA,
+                               const int16_t *__restrict__ pSrcB,
+                               uint32_t O,
+                               int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-  @brief Glue code for convolution (valid with replication) of 16-bit integer vectors.
-  @param[in]  pSrcA   points to the first input vector
-  @param[in]  srcALen Length of the first input vector
-  @param[in]  pSrcB   points to the second input vector
-  @param[in]  srcBLen Length of the second input vector
-  @param[out] pRes    output result returned here
+  @brief      Glue code of parallel sparse matrix-dense matrix multiplication for 16-bit integers in
+              CSR format
+  @param[in]  pSrcA Points to the sparse matrix of shape MxN
+  @param[in]  pSrcB Points to the dense matrix of shape NxO
+  @param[in]  O     Width of the matrices SrcB and DstC
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstC Points to the output matrix of shape MxO
   @return     none
- */
 
-void plp_conv_valid_rep_i16(const int16_t *pSrcA,
-                            const uint32_t srcALen,
-                            const int16_t *pSrcB,
-                            const uint32_t srcBLen,
-                            int32_t *pRes);
+  @par Parallelization
+  The rows are split with plp_spmat_row_split, such that every core gets about the same
+  number of nonzero values instead of the same number of rows.
+*/
+
+void plp_spmm_csr_i16_parallel(const plp_spmat_csr_i16 *__restrict__ pSrcA,
+                               const int16_t *__restrict__ pSrcB,
+                               uint32_t O,
+                               uint32_t nPE,
+                               int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief Convolution of 16-bit integer vectors kernel for XPULPV2 extension.
-   @param[in]  pSrcA   points to the first input vector
-   @param[in]  srcALen Length of the first input vector
-   @param[in]  pSrcB   points to the second input vector
-   @param[in]  srcBLen Length of the second input vector
-   @param[out] pRes    output result returned here
-   @return     none
+  @brief      Parallel sparse matrix-dense matrix multiplication for 16-bit integers in CSR format
+              kernel for XPULPV2 extension
+  @param[in]  args  pointer to plp_spmat_csr_mult_instance_i16 struct initialized by
+                    plp_spmm_csr_i16_parallel
+  @return     none
+
+  @par Exploiting SIMD instructions
+  Two consecutive nonzero values of a row are loaded as one vector. The rows of B they
+  select are loaded for four columns of C and transposed with four shuffles, such that
+  every __SUMDOTP2 computes two multiply-accumulates of one output.
+
+  @par Parallelization
+  The rows are split with plp_spmat_row_split, such that every core gets about the same
+  number of nonzero values instead of the same number of rows.
 */
 
-void plp_conv_i16s_xpulpv2(const int16_t *pSrcA,
-                           const uint32_t srcALen,
-                           const int16_t *pSrcB,
-                           const uint32_t srcBLen,
-                           int32_t *pRes);
+void plp_spmm_csr_i16p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-   @brief Convolution (valid) of 16-bit integer vectors kernel for XPULPV2 extension.
-   @param[in]  pSrcA   points to the first input vector
-   @param[in]  srcALen Length of the first input vector
-   @param[in]  pSrcB   points to the second input vector
-   @param[in]  srcBLen Length of the second input vector
-   @param[out] pRes    output result returned here
-   @return     none
+  @brief      Glue code of sparse matrix-dense matrix multiplication for 32-bit floats in CSR format
+  @param[in]  pSrcA Points to the sparse matrix of shape MxN
+  @param[in]  pSrcB Points to the dense matrix of shape NxO
+  @param[in]  O     Width of the matrices SrcB and DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
 */
 
-void plp_conv_valid_i16s_xpulpv2(const int16_t *pSrcA,
-                                 const uint32_t srcALen,
-                                 const int16_t *pSrcB,
-                                 const uint32_t srcBLen,
-                                 int32_t *pRes);
+void plp_spmm_csr_f32(const plp_spmat_csr_f32 *__restrict__ pSrcA,
+                      const float *__restrict__ pSrcB,
+                      uint32_t O,
+                      float *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief Convolution (valid with data replication) of 16-bit integer vectors kernel for XPULPV2
-   extension.
-   @param[in]  pSrcA   points to the first input vector of the replicated data
-   @param[in]  srcALen Number of elements in (unreplicated) vector a
-   @param[in]  srcAMem Number of elements between each replication
-   @param[in]  pSrcB   points to the second input vector
-   @param[in]  srcBLen Length of the second input vector
-   @param[out] pRes    output result returned here
-   @return     none
+  @brief      Sparse matrix-dense matrix multiplication for 32-bit floats in CSR format kernel for
+              XPULPV2 extension
+  @param[in]  pSrcA Points to the sparse matrix of shape MxN
+  @param[in]  pSrcB Points to the dense matrix of shape NxO
+  @param[in]  O     Width of the matrices SrcB and DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Blocking
+  Four columns of C are computed at once, such that the value and the column index
+  of every nonzero value are loaded once for four multiply-accumulates.
 */
 
-void plp_conv_valid_rep_i16s_xpulpv2(const int16_t *pSrcA,
-                                     const uint32_t srcALen,
-                                     const uint32_t srcAMem,
-                                     const int16_t *pSrcB,
-                                     const uint32_t srcBLen,
-                                     int32_t *pRes);
+void plp_spmm_csr_f32s_xpulpv2(const plp_spmat_csr_f32 *__restrict__ pSrcA,
+                               const float *__restrict__ pSrcB,
+                               uint32_t O,
+                               float *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief Convolution of 16-bit integer vectors kernel for RV32IM extension.
-   @param[in]  pSrcA   points to the first input vector
-   @param[in]  srcALen Length of the first input vector
-   @param[in]  pSrcB   points to the second input vector
-   @param[in]  srcBLen Length of the second input vector
-   @param[out] pRes    output result returned here
-   @return     none
+  @brief      Glue code of parallel sparse matrix-dense matrix multiplication for 32-bit floats in
+              CSR format
+  @param[in]  pSrcA Points to the sparse matrix of shape MxN
+  @param[in]  pSrcB Points to the dense matrix of shape NxO
+  @param[in]  O     Width of the matrices SrcB and DstC
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Parallelization
+  The rows are split with plp_spmat_row_split, such that every core gets about the same
+  number of nonzero values instead of the same number of rows.
 */
 
-void plp_conv_i16s_rv32im(const int16_t *pSrcA,
-                          const uint32_t srcALen,
-                          const int16_t *pSrcB,
-                          const uint32_t srcBLen,
-                          int32_t *pRes);
+void plp_spmm_csr_f32_parallel(const plp_spmat_csr_f32 *__restrict__ pSrcA,
+                               const float *__restrict__ pSrcB,
+                               uint32_t O,
+                               uint32_t nPE,
+                               float *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-  @brief Glue code for convolution of 8-bit integer vectors.
-  @param[in]  pSrcA   points to the first input vector
-  @param[in]  srcALen Length of the first input vector
-  @param[in]  pSrcB   points to the second input vector
-  @param[in]  srcBLen Length of the second input vector
-  @param[out] pRes    output result returned here
+  @brief      Parallel sparse matrix-dense matrix multiplication for 32-bit floats in CSR format
+              kernel for XPULPV2 extension
+  @param[in]  args  pointer to plp_spmat_csr_mult_instance_f32 struct initialized by
+                    plp_spmm_csr_f32_parallel
   @return     none
- */
 
-void plp_conv_i8(const int8_t *pSrcA,
-                 const uint32_t srcALen,
-                 const int8_t *pSrcB,
-                 const uint32_t srcBLen,
-                 int32_t *pRes);
+  @par Blocking
+  Four columns of C are computed at once, such that the value and the column index
+  of every nonzero value are loaded once for four multiply-accumulates.
+
+  @par Parallelization
+  The rows are split with plp_spmat_row_split, such that every core gets about the same
+  number of nonzero values instead of the same number of rows.
+*/
+
+void plp_spmm_csr_f32p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-  @brief Glue code for convolution (valid) of 8-bit integer vectors.
-  @param[in]  pSrcA   points to the first input vector
-  @param[in]  srcALen Length of the first input vector
-  @param[in]  pSrcB   points to the second input vector
-  @param[in]  srcBLen Length of the second input vector
-  @param[out] pRes    output result returned here
+  @brief      Glue code of sparse matrix-dense matrix multiplication for 8-bit integers in BCSR
+              format
+  @param[in]  pSrcA Points to the sparse matrix of shape MxN
+  @param[in]  pSrcB Points to the dense matrix of shape NxO
+  @param[in]  O     Width of the matrices SrcB and DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
   @return     none
- */
+*/
 
-void plp_conv_valid_i8(const int8_t *pSrcA,
-                       const uint32_t srcALen,
-                       const int8_t *pSrcB,
-                       const uint32_t srcBLen,
-                       int32_t *pRes);
+void plp_spmm_bcsr_i8(const plp_spmat_bcsr_i8 *__restrict__ pSrcA,
+                      const int8_t *__restrict__ pSrcB,
+                      uint32_t O,
+                      int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-  @brief Glue code for convolution (valid with data replication) of 8-bit integer vectors.
-  @param[in]  pSrcA   points to the first input vector (in L2)
-  @param[in]  srcALen Length of the first input vector
-  @param[in]  pSrcB   points to the second input vector (in L2)
-  @param[in]  srcBLen Length of the second input vector
-  @param[out] pRes    output result returned here (preferably in L1)
+  @brief      Sparse matrix-dense matrix multiplication for 8-bit integers in BCSR format kernel for
+              RV32IM extension
+  @param[in]  pSrcA Points to the sparse matrix of shape MxN
+  @param[in]  pSrcB Points to the dense matrix of shape NxO
+  @param[in]  O     Width of the matrices SrcB and DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
   @return     none
- */
+*/
 
-void plp_conv_valid_rep_i8(const int8_t *pSrcA,
-                           const uint32_t srcALen,
-                           const int8_t *pSrcB,
-                           const uint32_t srcBLen,
-                           int32_t *pRes);
+void plp_spmm_bcsr_i8s_rv32im(const plp_spmat_bcsr_i8 *__restrict__ pSrcA,
+                              const int8_t *__restrict__ pSrcB,
+                              uint32_t O,
+                              int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief Convolution of 8-bit integer vectors kernel for XPULPV2 extension.
-   @param[in]  pSrcA   points to the first input vector
-   @param[in]  srcALen Length of the first input vector
-   @param[in]  pSrcB   points to the second input vector
-   @param[in]  srcBLen Length of the second input vector
-   @param[out] pRes    output result returned here
-   @return     none
+  @brief      Sparse matrix-dense matrix multiplication for 8-bit integers in BCSR format kernel for
+              XPULPV2 extension
+  @param[in]  pSrcA Points to the sparse matrix of shape MxN
+  @param[in]  pSrcB Points to the dense matrix of shape NxO
+  @param[in]  O     Width of the matrices SrcB and DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The four rows of B selected by a block are loaded for four columns of C and transposed
+  with eight shuffles. Every row of the block then takes one __SUMDOTP4 per column, and
+  for blocks of 4x4 values the transposed columns are used for all four rows.
 */
 
-void plp_conv_i8s_xpulpv2(const int8_t *pSrcA,
-                          const uint32_t srcALen,
-                          const int8_t *pSrcB,
-                          const uint32_t srcBLen,
-                          int32_t *pRes);
+void plp_spmm_bcsr_i8s_xpulpv2(const plp_spmat_bcsr_i8 *__restrict__ pSrcA,
+                               const int8_t *__restrict__ pSrcB,
+                               uint32_t O,
+                               int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief Convolution (valid) of 8-bit integer vectors kernel for XPULPV2 extension.
-   @param[in]  pSrcA   points to the first input vector
-   @param[in]  srcALen Length of the first input vector
-   @param[in]  pSrcB   points to the second input vector
-   @param[in]  srcBLen Length of the second input vector
-   @param[out] pRes    output result returned here
-   @return     none
+  @brief      Glue code of parallel sparse matrix-dense matrix multiplication for 8-bit integers in
+              BCSR format
+  @param[in]  pSrcA Points to the sparse matrix of shape MxN
+  @param[in]  pSrcB Points to the dense matrix of shape NxO
+  @param[in]  O     Width of the matrices SrcB and DstC
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Parallelization
+  The block rows are split with plp_spmat_row_split, such that every core gets about the
+  same number of blocks instead of the same number of rows.
 */
 
-void plp_conv_valid_i8s_xpulpv2(const int8_t *pSrcA,
-                                const uint32_t srcALen,
-                                const int8_t *pSrcB,
-                                const uint32_t srcBLen,
-                                int32_t *pRes);
+void plp_spmm_bcsr_i8_parallel(const plp_spmat_bcsr_i8 *__restrict__ pSrcA,
+                               const int8_t *__restrict__ pSrcB,
+                               uint32_t O,
+                               uint32_t nPE,
+                               int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief Convolution (valid with data replication) of 8-bit integer vectors kernel for XPULPV2
-   extension.
-   @param[in]  pSrcA   points to the first input vector of the replicated data
-   @param[in]  srcALen Number of elements in (unreplicated) vector a
-   @param[in]  srcAMem Number of elements between each replication
-   @param[in]  pSrcB   points to the second input vector
-   @param[in]  srcBLen Length of the second input vector
-   @param[out] pRes    output result returned here
-   @return     none
+  @brief      Parallel sparse matrix-dense matrix multiplication for 8-bit integers in BCSR format
+              kernel for XPULPV2 extension
+  @param[in]  args  pointer to plp_spmat_bcsr_mult_instance_i8 struct initialized by
+                    plp_spmm_bcsr_i8_parallel
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The four rows of B selected by a block are loaded for four columns of C and transposed
+  with eight shuffles. Every row of the block then takes one __SUMDOTP4 per column, and
+  for blocks of 4x4 values the transposed columns are used for all four rows.
+
+  @par Parallelization
+  The block rows are split with plp_spmat_row_split, such that every core gets about the
+  same number of blocks instead of the same number of rows.
 */
 
-void plp_conv_valid_rep_i8s_xpulpv2(const int8_t *pSrcA,
-                                    const uint32_t srcALen,
-                                    const uint32_t srcAMem,
-                                    const int8_t *pSrcB,
-                                    const uint32_t srcBLen,
-                                    int32_t *pRes);
+void plp_spmm_bcsr_i8p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-   @brief Convolution of 8-bit integer vectors kernel for RV32IM extension.
-   @param[in]  pSrcA   points to the first input vector
-   @param[in]  srcALen Length of the first input vector
-   @param[in]  pSrcB   points to the second input vector
-   @param[in]  srcBLen Length of the second input vector
-   @param[out] pRes    output result returned here
-   @return     none
+  @brief      Glue code of sparse matrix-dense matrix multiplication for 16-bit integers in BCSR
+              format
+  @param[in]  pSrcA Points to the sparse matrix of shape MxN
+  @param[in]  pSrcB Points to the dense matrix of shape NxO
+  @param[in]  O     Width of the matrices SrcB and DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
 */
 
-void plp_conv_i8s_rv32im(const int8_t *pSrcA,
-                         const uint32_t srcALen,
-                         const int8_t *pSrcB,
-                         const uint32_t srcBLen,
-                         int32_t *pRes);
+void plp_spmm_bcsr_i16(const plp_spmat_bcsr_i16 *__restrict__ pSrcA,
+                       const int16_t *__restrict__ pSrcB,
+                       uint32_t O,
+                       int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-  @brief Glue code for parallel convolution of 32-bit integer vectors.
-  @param[in]  pSrcA   points to the first input vector
-  @param[in]  srcALen Length of the first input vector
-  @param[in]  pSrcB   points to the second input vector
-  @param[in]  srcBLen Length of the second input vector
-  @param[in]  nPE     Number of cores to compute on
-  @param[out] pRes    output result returned here
+  @brief      Sparse matrix-dense matrix multiplication for 16-bit integers in BCSR format kernel
+              for RV32IM extension
+  @param[in]  pSrcA Points to the sparse matrix of shape MxN
+  @param[in]  pSrcB Points to the dense matrix of shape NxO
+  @param[in]  O     Width of the matrices SrcB and DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
   @return     none
- */
+*/
 
-void plp_conv_i32_parallel(const int32_t *pSrcA,
-                           const uint32_t srcALen,
-                           const int32_t *pSrcB,
-                           const uint32_t srcBLen,
-                           const uint8_t nPE,
-                           int32_t *pRes);
+void plp_spmm_bcsr_i16s_rv32im(const plp_spmat_bcsr_i16 *__restrict__ pSrcA,
+                               const int16_t *__restrict__ pSrcB,
+                               uint32_t O,
+                               int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-  @brief Setup code for parallel convolution of 32-bit integer vectors.
-  @param[in]  task_args      pointer to plp_conv_instance_i32 struct initialized by
-                             plp_conv_i32_parallel
+  @brief      Sparse matrix-dense matrix multiplication for 16-bit integers in BCSR format kernel
+              for XPULPV2 extension
+  @param[in]  pSrcA Points to the sparse matrix of shape MxN
+  @param[in]  pSrcB Points to the dense matrix of shape NxO
+  @param[in]  O     Width of the matrices SrcB and DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
   @return     none
- */
 
-void plp_conv_i32p_xpulpv2(void *task_args);
+  @par Exploiting SIMD instructions
+  The four rows of B selected by a block are loaded for two columns of C and transposed
+  with four shuffles. Every row of the block then takes two __SUMDOTP2 per column, and for
+  blocks of 4x4 values the transposed columns are used for all four rows.
+*/
+
+void plp_spmm_bcsr_i16s_xpulpv2(const plp_spmat_bcsr_i16 *__restrict__ pSrcA,
+                                const int16_t *__restrict__ pSrcB,
+                                uint32_t O,
+                                int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-  @brief Glue code for parallel convolution of 16-bit integer vectors.
-  @param[in]  pSrcA   points to the first input vector
-  @param[in]  srcALen Length of the first input vector
-  @param[in]  pSrcB   points to the second input vector
-  @param[in]  srcBLen Length of the second input vector
-  @param[in]  nPE     Number of cores to compute on
-  @param[out] pRes    output result returned here
+  @brief      Glue code of parallel sparse matrix-dense matrix multiplication for 16-bit integers in
+              BCSR format
+  @param[in]  pSrcA Points to the sparse matrix of shape MxN
+  @param[in]  pSrcB Points to the dense matrix of shape NxO
+  @param[in]  O     Width of the matrices SrcB and DstC
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstC Points to the output matrix of shape MxO
   @return     none
- */
 
-void plp_conv_i16_parallel(const int16_t *pSrcA,
-                           const uint32_t srcALen,
-                           const int16_t *pSrcB,
-                           const uint32_t srcBLen,
-                           const uint8_t nPE,
-                           int32_t *pRes);
+  @par Parallelization
+  The block rows are split with plp_spmat_row_split, such that every core gets about the
+  same number of blocks instead of the same number of rows.
+*/
+
+void plp_spmm_bcsr_i16_parallel(const plp_spmat_bcsr_i16 *__restrict__ pSrcA,
+                                const int16_t *__restrict__ pSrcB,
+                                uint32_t O,
+                                uint32_t nPE,
+                                int32_t *__restrict__ pDstC);
+
 /** -------------------------------------------------------
-  @brief Setup code for parallel convolution of 16-bit integer vectors.
-  @param[in]  task_args  pointer to plp_conv_instance_i16 struct initialized by
-                         plp_conv_i16_parallel
+  @brief      Parallel sparse matrix-dense matrix multiplication for 16-bit integers in BCSR format
+              kernel for XPULPV2 extension
+  @param[in]  args  pointer to plp_spmat_bcsr_mult_instance_i16 struct initialized by
+                    plp_spmm_bcsr_i16_parallel
   @return     none
- */
 
-void plp_conv_i16p_xpulpv2(void *task_args);
+  @par Exploiting SIMD instructions
+  The four rows of B selected by a block are loaded for two columns of C and transposed
+  with four shuffles. Every row of the block then takes two __SUMDOTP2 per column, and for
+  blocks of 4x4 values the transposed columns are used for all four rows.
+
+  @par Parallelization
+  The block rows are split with plp_spmat_row_split, such that every core gets about the
+  same number of blocks instead of the same number of rows.
+*/
+
+void plp_spmm_bcsr_i16p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-  @brief Glue code for parallel convolution of 8-bit integer vectors.
-  @param[in]  pSrcA   points to the first input vector
-  @param[in]  srcALen Length of the first input vector
-  @param[in]  pSrcB   points to the second input vector
-  @param[in]  srcBLen Length of the second input vector
-  @param[in]  nPE     Number of cores to compute on
-  @param[out] pRes    output result returned here
+  @brief      Glue code for symmetric matrix multiplication of 32-bit floats
+  @param[in]  pSrcA Points to the lower triangle of the symmetric NxN matrix A, packed row by row
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  N     Height and width of A, height of B
+  @param[in]  O     Width of B and C
+  @param[out] pDstC Points to the output matrix of shape NxO
   @return     none
- */
+*/
+
+void plp_mat_mult_sym_f32(const float *__restrict__ pSrcA,
+                          const float *__restrict__ pSrcB,
+                          uint32_t N,
+                          uint32_t O,
+                          float *__restrict__ pDstC);
 
-void plp_conv_i8_parallel(const int8_t *pSrcA,
-                          const uint32_t srcALen,
-                          const int8_t *pSrcB,
-                          const uint32_t srcBLen,
-                          const uint8_t nPE,
-                          int32_t *pRes);
 /** -------------------------------------------------------
-  @brief Setup code for parallel convolution of 8-bit integer vectors.
-  @param[in]  task_args  pointer to plp_conv_instance_i8 struct initialized by
-                         plp_conv_i8_parallel
+  @brief      Symmetric matrix multiplication of 32-bit floats kernel for XPULPV2 extension
+  @param[in]  pSrcA Points to the lower triangle of the symmetric NxN matrix A, packed row by row
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  N     Height and width of A, height of B
+  @param[in]  O     Width of B and C
+  @param[out] pDstC Points to the output matrix of shape NxO
   @return     none
- */
 
-void plp_conv_i8p_xpulpv2(void *task_args);
+  @par Blocking
+  Four columns of C are computed at once, such that every value of A is loaded once for
+  four multiply-accumulates.
+*/
+
+void plp_mat_mult_sym_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                                   const float *__restrict__ pSrcB,
+                                   uint32_t N,
+                                   uint32_t O,
+                                   float *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief Helper function for parallelized overlap-adding of partial convolution results
-   @param[in] nPE Number of processing cores
-   @param[in] srcALen Length of the first original input vector
-   @param[in] srcBLen Length of the second original input vector
-   @param[in] resultsBuffer resultsBuffer array from plp_conv_i[XX]_parallel
-   @return none
+  @brief      Glue code for parallel symmetric matrix multiplication of 32-bit floats
+  @param[in]  pSrcA Points to the lower triangle of the symmetric NxN matrix A, packed row by row
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  N     Height and width of A, height of B
+  @param[in]  O     Width of B and C
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstC Points to the output matrix of shape NxO
+  @return     none
 */
 
-void plp_conv_parallel_OLA(uint32_t nPE,
-                           uint32_t srcALen,
-                           uint32_t srcBLen,
-                           int32_t *resultsBuffer);
+void plp_mat_mult_sym_f32_parallel(const float *__restrict__ pSrcA,
+                                   const float *__restrict__ pSrcB,
+                                   uint32_t N,
+                                   uint32_t O,
+                                   uint32_t nPE,
+                                   float *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief Helper function for parallelized overlap-adding of partial convolution results
-   @param[in] task_args  Holds the plp_conv_tree_add_instance that describes the vector parameters
-   @return none
+  @brief      Parallel symmetric matrix multiplication of 32-bit floats kernel for XPULPV2 extension
+  @param[in]  args  pointer to plp_mat_mult_sym_instance_f32 struct initialized by
+                    plp_mat_mult_sym_f32_parallel
+  @return     none
+
+  @par Blocking
+  Four columns of C are computed at once, such that every value of A is loaded once for
+  four multiply-accumulates.
+
+  @par Parallelization
+  Every core computes every nPE-th row.
 */
-void plp_conv_parallel_OLA_kernel(void *task_args);
+
+void plp_mat_mult_sym_f32p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-   @brief      Glue code for matrix matrix multiplication of a 32-bit integer matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[out] pDstC Output is written here
-   @return     none
+  @brief      Glue code for symmetric matrix multiplication of 16-bit fix-point numbers
+  @param[in]  pSrcA Points to the lower triangle of the symmetric NxN matrix A, packed row by row
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  N     Height and width of A, height of B
+  @param[in]  O     Width of B and C
+  @param[in]  shift Amount to shift the result of each multiplication
+  @param[out] pDstC Points to the output matrix of shape NxO
+  @return     none
+
+  @par Fix-Point and Shifting
+  Every product is shifted by `shift` to the right with rounding and the sum is stored
+  with 16 bits, exactly like in plp_mat_mult_q16. If A is represented as `pSrcA * 2^-x`
+  and B as `pSrcB * 2^-y`, C is represented as `pDstC * 2^-(x + y - shift)`. Set `shift`
+  such that no overflow occurs.
 */
 
-void plp_mat_mult_i32(const int32_t *__restrict__ pSrcA,
-                      const int32_t *__restrict__ pSrcB,
-                      uint32_t M,
-                      uint32_t N,
-                      uint32_t O,
-                      int32_t *__restrict__ pDstC);
+void plp_mat_mult_sym_q16(const int16_t *__restrict__ pSrcA,
+                          const int16_t *__restrict__ pSrcB,
+                          uint32_t N,
+                          uint32_t O,
+                          uint32_t shift,
+                          int16_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief      Matrix matrix multiplication of a 32-bit integer matrices for RV32IM extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[out] pDstC Output is written here
-   @return     none
+  @brief      Symmetric matrix multiplication of 16-bit fix-point numbers kernel for RV32IM
+              extension
+  @param[in]  pSrcA Points to the lower triangle of the symmetric NxN matrix A, packed row by row
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  N     Height and width of A, height of B
+  @param[in]  O     Width of B and C
+  @param[in]  shift Amount to shift the result of each multiplication
+  @param[out] pDstC Points to the output matrix of shape NxO
+  @return     none
+
+  @par Blocking
+  Four columns of C are computed at once, such that every value of A is loaded once for
+  four multiply-accumulates.
+
+  @par Fix-Point and Shifting
+  Every product is shifted by `shift` to the right with rounding and the sum is stored
+  with 16 bits, exactly like in plp_mat_mult_q16. If A is represented as `pSrcA * 2^-x`
+  and B as `pSrcB * 2^-y`, C is represented as `pDstC * 2^-(x + y - shift)`. Set `shift`
+  such that no overflow occurs.
 */
 
-void plp_mat_mult_i32s_rv32im(const int32_t *__restrict__ pSrcA,
-                              const int32_t *__restrict__ pSrcB,
-                              uint32_t M,
-                              uint32_t N,
-                              uint32_t O,
-                              int32_t *__restrict__ pDstC);
+void plp_mat_mult_sym_q16s_rv32im(const int16_t *__restrict__ pSrcA,
+                                  const int16_t *__restrict__ pSrcB,
+                                  uint32_t N,
+                                  uint32_t O,
+                                  uint32_t shift,
+                                  int16_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief      Matrix matrix multiplication of a 32-bit integer matrices for XPULPV2 extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[out] pDstC Output is written here
-   @return     none
+  @brief      Symmetric matrix multiplication of 16-bit fix-point numbers kernel for XPULPV2
+              extension
+  @param[in]  pSrcA Points to the lower triangle of the symmetric NxN matrix A, packed row by row
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  N     Height and width of A, height of B
+  @param[in]  O     Width of B and C
+  @param[in]  shift Amount to shift the result of each multiplication
+  @param[out] pDstC Points to the output matrix of shape NxO
+  @return     none
+
+  @par Blocking
+  Four columns of C are computed at once, such that every value of A is loaded once for
+  four multiply-accumulates.
+
+  @par Fix-Point and Shifting
+  Every product is shifted by `shift` to the right with rounding and the sum is stored
+  with 16 bits, exactly like in plp_mat_mult_q16. If A is represented as `pSrcA * 2^-x`
+  and B as `pSrcB * 2^-y`, C is represented as `pDstC * 2^-(x + y - shift)`. Set `shift`
+  such that no overflow occurs.
 */
 
-void plp_mat_mult_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
-                               const int32_t *__restrict__ pSrcB,
-                               uint32_t M,
-                               uint32_t N,
-                               uint32_t O,
-                               int32_t *__restrict__ pDstC);
+void plp_mat_mult_sym_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                   const int16_t *__restrict__ pSrcB,
+                                   uint32_t N,
+                                   uint32_t O,
+                                   uint32_t shift,
+                                   int16_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief      Glue code for matrix matrix multiplication of a 16-bit integer matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[out] pDstC Output is written here
-   @return     none
+  @brief      Glue code for parallel symmetric matrix multiplication of 16-bit fix-point numbers
+  @param[in]  pSrcA Points to the lower triangle of the symmetric NxN matrix A, packed row by row
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  N     Height and width of A, height of B
+  @param[in]  O     Width of B and C
+  @param[in]  shift Amount to shift the result of each multiplication
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstC Points to the output matrix of shape NxO
+  @return     none
+
+  @par Fix-Point and Shifting
+  Every product is shifted by `shift` to the right with rounding and the sum is stored
+  with 16 bits, exactly like in plp_mat_mult_q16. If A is represented as `pSrcA * 2^-x`
+  and B as `pSrcB * 2^-y`, C is represented as `pDstC * 2^-(x + y - shift)`. Set `shift`
+  such that no overflow occurs.
 */
 
-void plp_mat_mult_i16(const int16_t *__restrict__ pSrcA,
-                      const int16_t *__restrict__ pSrcB,
-                      uint32_t M,
-                      uint32_t N,
-                      uint32_t O,
-                      int32_t *__restrict__ pDstC);
+void plp_mat_mult_sym_q16_parallel(const int16_t *__restrict__ pSrcA,
+                                   const int16_t *__restrict__ pSrcB,
+                                   uint32_t N,
+                                   uint32_t O,
+                                   uint32_t shift,
+                                   uint32_t nPE,
+                                   int16_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief      Matrix matrix multiplication of a 16-bit integer matrices for RV32IM extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[out] pDstC Output is written here
-   @return     none
+  @brief      Parallel symmetric matrix multiplication of 16-bit fix-point numbers kernel for
+              XPULPV2 extension
+  @param[in]  args  pointer to plp_mat_mult_sym_instance_q16 struct initialized by
+                    plp_mat_mult_sym_q16_parallel
+  @return     none
+
+  @par Blocking
+  Four columns of C are computed at once, such that every value of A is loaded once for
+  four multiply-accumulates.
+
+  @par Parallelization
+  Every core computes every nPE-th row.
+
+  @par Fix-Point and Shifting
+  Every product is shifted by `shift` to the right with rounding and the sum is stored
+  with 16 bits, exactly like in plp_mat_mult_q16. If A is represented as `pSrcA * 2^-x`
+  and B as `pSrcB * 2^-y`, C is represented as `pDstC * 2^-(x + y - shift)`. Set `shift`
+  such that no overflow occurs.
 */
 
-void plp_mat_mult_i16s_rv32im(const int16_t *__restrict__ pSrcA,
-                              const int16_t *__restrict__ pSrcB,
-                              uint32_t M,
-                              uint32_t N,
-                              uint32_t O,
-                              int32_t *__restrict__ pDstC);
+void plp_mat_mult_sym_q16p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-   @brief      Matrix matrix multiplication of a 16-bit integer matrices for XPULPV2 extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[out] pDstC Output is written here
-   @return     none
-
-   @par Exploiting SIMD instructions
-   The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
-   performed on 32 bit vectors, with 32 bit accumulator.
+  @brief      Glue code for triangular matrix multiplication of 32-bit floats
+  @param[in]  pSrcA     Points to the triangle of the NxN matrix A, packed row by row
+  @param[in]  pSrcB     Points to the second input matrix of shape NxO
+  @param[in]  N         Height and width of A, height of B
+  @param[in]  O         Width of B and C
+  @param[in]  upperFlag 0: A is lower triangular, 1: A is upper triangular
+  @param[out] pDstC     Points to the output matrix of shape NxO
+  @return     none
 */
 
-void plp_mat_mult_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
-                               const int16_t *__restrict__ pSrcB,
-                               uint32_t M,
-                               uint32_t N,
-                               uint32_t O,
-                               int32_t *__restrict__ pDstC);
+void plp_mat_mult_tri_f32(const float *__restrict__ pSrcA,
+                          const float *__restrict__ pSrcB,
+                          uint32_t N,
+                          uint32_t O,
+                          uint8_t upperFlag,
+                          float *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief      Glue code for matrix matrix multiplication of a 8-bit integer matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[out] pDstC Output is written here
-   @return     none
+  @brief      Triangular matrix multiplication of 32-bit floats kernel for XPULPV2 extension
+  @param[in]  pSrcA     Points to the triangle of the NxN matrix A, packed row by row
+  @param[in]  pSrcB     Points to the second input matrix of shape NxO
+  @param[in]  N         Height and width of A, height of B
+  @param[in]  O         Width of B and C
+  @param[in]  upperFlag 0: A is lower triangular, 1: A is upper triangular
+  @param[out] pDstC     Points to the output matrix of shape NxO
+  @return     none
+
+  @par Blocking
+  Four columns of C are computed at once, such that every value of A is loaded once for
+  four multiply-accumulates.
 */
 
-void plp_mat_mult_i8(const int8_t *__restrict__ pSrcA,
-                     const int8_t *__restrict__ pSrcB,
-                     uint32_t M,
-                     uint32_t N,
-                     uint32_t O,
-                     int32_t *__restrict__ pDstC);
+void plp_mat_mult_tri_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                                   const float *__restrict__ pSrcB,
+                                   uint32_t N,
+                                   uint32_t O,
+                                   uint8_t upperFlag,
+                                   float *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief      Matrix matrix multiplication of a 8-bit integer matrices for RV32IM extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[out] pDstC Output is written here
-   @return     none
+  @brief      Glue code for parallel triangular matrix multiplication of 32-bit floats
+  @param[in]  pSrcA     Points to the triangle of the NxN matrix A, packed row by row
+  @param[in]  pSrcB     Points to the second input matrix of shape NxO
+  @param[in]  N         Height and width of A, height of B
+  @param[in]  O         Width of B and C
+  @param[in]  upperFlag 0: A is lower triangular, 1: A is upper triangular
+  @param[in]  nPE       Number of cores to use for computation
+  @param[out] pDstC     Points to the output matrix of shape NxO
+  @return     none
 */
 
-void plp_mat_mult_i8s_rv32im(const int8_t *__restrict__ pSrcA,
-                             const int8_t *__restrict__ pSrcB,
-                             uint32_t M,
-                             uint32_t N,
-                             uint32_t O,
-                             int32_t *__restrict__ pDstC);
+void plp_mat_mult_tri_f32_parallel(const float *__restrict__ pSrcA,
+                                   const float *__restrict__ pSrcB,
+                                   uint32_t N,
+                                   uint32_t O,
+                                   uint8_t upperFlag,
+                                   uint32_t nPE,
+                                   float *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief      Matrix matrix multiplication of a 8-bit integer matrices for XPULPV2 extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[out] pDstC Output is written here
-   @return     none
+  @brief      Parallel triangular matrix multiplication of 32-bit floats kernel for XPULPV2
+              extension
+  @param[in]  args  pointer to plp_mat_mult_tri_instance_f32 struct initialized by
+                    plp_mat_mult_tri_f32_parallel
+  @return     none
 
-   @par Exploiting SIMD instructions
-   The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
-   performed on 32 bit vectors, with 32 bit accumulator.
+  @par Blocking
+  Four columns of C are computed at once, such that every value of A is loaded once for
+  four multiply-accumulates.
+
+  @par Parallelization
+  Every core computes every nPE-th row. The rows of a triangle have different
+  lengths, and interleaving them gives every core about the same number of short
+  and long rows.
 */
 
-void plp_mat_mult_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
-                              const int8_t *__restrict__ pSrcB,
-                              uint32_t M,
-                              uint32_t N,
-                              uint32_t O,
-                              int32_t *__restrict__ pDstC);
+void plp_mat_mult_tri_f32p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-   @brief      Glue code for parallel matrix matrix multiplication of a 32-bit integer matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  nPE   Number of cores to use
-   @param[out] pDstC Output is written here
-   @return     none
+  @brief      Glue code for triangular matrix multiplication of 16-bit fix-point numbers
+  @param[in]  pSrcA     Points to the triangle of the NxN matrix A, packed row by row
+  @param[in]  pSrcB     Points to the second input matrix of shape NxO
+  @param[in]  N         Height and width of A, height of B
+  @param[in]  O         Width of B and C
+  @param[in]  upperFlag 0: A is lower triangular, 1: A is upper triangular
+  @param[in]  shift     Amount to shift the result of each multiplication
+  @param[out] pDstC     Points to the output matrix of shape NxO
+  @return     none
+
+  @par Fix-Point and Shifting
+  Every product is shifted by `shift` to the right with rounding and the sum is stored
+  with 16 bits, exactly like in plp_mat_mult_q16. If A is represented as `pSrcA * 2^-x`
+  and B as `pSrcB * 2^-y`, C is represented as `pDstC * 2^-(x + y - shift)`. Set `shift`
+  such that no overflow occurs.
 */
 
-void plp_mat_mult_i32_parallel(const int32_t *__restrict__ pSrcA,
-                               const int32_t *__restrict__ pSrcB,
-                               uint32_t M,
-                               uint32_t N,
-                               uint32_t O,
-                               uint32_t nPE,
-                               int32_t *__restrict__ pDstC);
+void plp_mat_mult_tri_q16(const int16_t *__restrict__ pSrcA,
+                          const int16_t *__restrict__ pSrcB,
+                          uint32_t N,
+                          uint32_t O,
+                          uint8_t upperFlag,
+                          uint32_t shift,
+                          int16_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief      Parallel matrix matrix multiplication of a 32-bit integer matrices for XPULPV2
-               extension.
-   @param[in]  args  pointer to plp_mat_mult_instance_i32 struct initialized by
-                     plp_mat_mult_i32_parallel
-   @return     none
+  @brief      Triangular matrix multiplication of 16-bit fix-point numbers kernel for RV32IM
+              extension
+  @param[in]  pSrcA     Points to the triangle of the NxN matrix A, packed row by row
+  @param[in]  pSrcB     Points to the second input matrix of shape NxO
+  @param[in]  N         Height and width of A, height of B
+  @param[in]  O         Width of B and C
+  @param[in]  upperFlag 0: A is lower triangular, 1: A is upper triangular
+  @param[in]  shift     Amount to shift the result of each multiplication
+  @param[out] pDstC     Points to the output matrix of shape NxO
+  @return     none
+
+  @par Blocking
+  Four columns of C are computed at once, such that every value of A is loaded once for
+  four multiply-accumulates.
+
+  @par Fix-Point and Shifting
+  Every product is shifted by `shift` to the right with rounding and the sum is stored
+  with 16 bits, exactly like in plp_mat_mult_q16. If A is represented as `pSrcA * 2^-x`
+  and B as `pSrcB * 2^-y`, C is represented as `pDstC * 2^-(x + y - shift)`. Set `shift`
+  such that no overflow occurs.
 */
 
-void plp_mat_mult_i32p_xpulpv2(void *args);
+void plp_mat_mult_tri_q16s_rv32im(const int16_t *__restrict__ pSrcA,
+                                  const int16_t *__restrict__ pSrcB,
+                                  uint32_t N,
+                                  uint32_t O,
+                                  uint8_t upperFlag,
+                                  uint32_t shift,
+                                  int16_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief      Glue code for parallel matrix matrix multiplication of a 16-bit integer matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  nPE   Number of cores to use
-   @param[out] pDstC Output is written here
-   @return     none
+  @brief      Triangular matrix multiplication of 16-bit fix-point numbers kernel for XPULPV2
+              extension
+  @param[in]  pSrcA     Points to the triangle of the NxN matrix A, packed row by row
+  @param[in]  pSrcB     Points to the second input matrix of shape NxO
+  @param[in]  N         Height and width of A, height of B
+  @param[in]  O         Width of B and C
+  @param[in]  upperFlag 0: A is lower triangular, 1: A is upper triangular
+  @param[in]  shift     Amount to shift the result of each multiplication
+  @param[out] pDstC     Points to the output matrix of shape NxO
+  @return     none
+
+  @par Blocking
+  Four columns of C are computed at once, such that every value of A is loaded once for
+  four multiply-accumulates.
+
+  @par Fix-Point and Shifting
+  Every product is shifted by `shift` to the right with rounding and the sum is stored
+  with 16 bits, exactly like in plp_mat_mult_q16. If A is represented as `pSrcA * 2^-x`
+  and B as `pSrcB * 2^-y`, C is represented as `pDstC * 2^-(x + y - shift)`. Set `shift`
+  such that no overflow occurs.
 */
 
-void plp_mat_mult_i16_parallel(const int16_t *__restrict__ pSrcA,
-                               const int16_t *__restrict__ pSrcB,
-                               uint32_t M,
-                               uint32_t N,
-                               uint32_t O,
-                               uint32_t nPE,
-                               int32_t *__restrict__ pDstC);
+void plp_mat_mult_tri_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                   const int16_t *__restrict__ pSrcB,
+                                   uint32_t N,
+                                   uint32_t O,
+                                   uint8_t upperFlag,
+                                   uint32_t shift,
+                                   int16_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief Parallel matrix multiplication of 16-bit integer matrices kernel for XPULPV2 extension.
-    @param[in]  args  pointer to plp_mat_mult_instance_i16 struct initialized by
-                      plp_mat_mult_i16_parallel
-    @return     none
+  @brief      Glue code for parallel triangular matrix multiplication of 16-bit fix-point numbers
+  @param[in]  pSrcA     Points to the triangle of the NxN matrix A, packed row by row
+  @param[in]  pSrcB     Points to the second input matrix of shape NxO
+  @param[in]  N         Height and width of A, height of B
+  @param[in]  O         Width of B and C
+  @param[in]  upperFlag 0: A is lower triangular, 1: A is upper triangular
+  @param[in]  shift     Amount to shift the result of each multiplication
+  @param[in]  nPE       Number of cores to use for computation
+  @param[out] pDstC     Points to the output matrix of shape NxO
+  @return     none
 
-    @par Exploiting SIMD instructions
-    The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
-    performed on 32 bit vectors, with 32 bit accumulator.
+  @par Fix-Point and Shifting
+  Every product is shifted by `shift` to the right with rounding and the sum is stored
+  with 16 bits, exactly like in plp_mat_mult_q16. If A is represented as `pSrcA * 2^-x`
+  and B as `pSrcB * 2^-y`, C is represented as `pDstC * 2^-(x + y - shift)`. Set `shift`
+  such that no overflow occurs.
 */
 
-void plp_mat_mult_i16p_xpulpv2(void *args);
+void plp_mat_mult_tri_q16_parallel(const int16_t *__restrict__ pSrcA,
+                                   const int16_t *__restrict__ pSrcB,
+                                   uint32_t N,
+                                   uint32_t O,
+                                   uint8_t upperFlag,
+                                   uint32_t shift,
+                                   uint32_t nPE,
+                                   int16_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief      Glue code for parallel matrix matrix multiplication of a 8-bit integer matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  nPE   Number of cores to use
-   @param[out] pDstC Output is written here
-   @return     none
+  @brief      Parallel triangular matrix multiplication of 16-bit fix-point numbers kernel for
+              XPULPV2 extension
+  @param[in]  args  pointer to plp_mat_mult_tri_instance_q16 struct initialized by
+                    plp_mat_mult_tri_q16_parallel
+  @return     none
+
+  @par Blocking
+  Four columns of C are computed at once, such that every value of A is loaded once for
+  four multiply-accumulates.
+
+  @par Parallelization
+  Every core computes every nPE-th row. The rows of a triangle have different
+  lengths, and interleaving them gives every core about the same number of short
+  and long rows.
+
+  @par Fix-Point and Shifting
+  Every product is shifted by `shift` to the right with rounding and the sum is stored
+  with 16 bits, exactly like in plp_mat_mult_q16. If A is represented as `pSrcA * 2^-x`
+  and B as `pSrcB * 2^-y`, C is represented as `pDstC * 2^-(x + y - shift)`. Set `shift`
+  such that no overflow occurs.
 */
 
-void plp_mat_mult_i8_parallel(const int8_t *__restrict__ pSrcA,
-                              const int8_t *__restrict__ pSrcB,
-                              uint32_t M,
-                              uint32_t N,
-                              uint32_t O,
-                              uint32_t nPE,
-                              int32_t *__restrict__ pDstC);
+void plp_mat_mult_tri_q16p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-   @brief      Glue code for matrix matrix multiplication of a 32-bit floating-point matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[out] pDstC Output is written here
-   @return     none
+  @brief      Glue code for triangular solve of 32-bit floats
+  @param[in]  pSrcA     Points to the triangle of the NxN matrix A, packed row by row
+  @param[in]  pSrcB     Points to the right-hand sides B of shape NxO
+  @param[in]  N         Height and width of A, height of B
+  @param[in]  O         Number of right-hand sides, width of B and X
+  @param[in]  upperFlag 0: A is lower triangular, 1: A is upper triangular
+  @param[out] pDstX     Points to the solution X of shape NxO, may be equal to pSrcB
+  @return     0: Success, 1: A diagonal value of A is zero, 2: operation not supported
 */
 
-void plp_mat_mult_f32(const float *__restrict__ pSrcA,
-                      const float *__restrict__ pSrcB,
-                      uint32_t M,
-                      uint32_t N,
-                      uint32_t O,
-                      float *__restrict__ pDstC);
+int plp_mat_solve_tri_f32(const float *__restrict__ pSrcA,
+                          const float *pSrcB,
+                          uint32_t N,
+                          uint32_t O,
+                          uint8_t upperFlag,
+                          float *pDstX);
 
 /** -------------------------------------------------------
-   @brief      Matrix matrix multiplication of a 32-bit floating-point matrices for XPULPV2
-               extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[out] pDstC Output is written here
-   @return     none
+  @brief      Triangular solve of 32-bit floats kernel for XPULPV2 extension
+  @param[in]  pSrcA     Points to the triangle of the NxN matrix A, packed row by row
+  @param[in]  pSrcB     Points to the right-hand sides B of shape NxO
+  @param[in]  N         Height and width of A, height of B
+  @param[in]  O         Number of right-hand sides, width of B and X
+  @param[in]  upperFlag 0: A is lower triangular, 1: A is upper triangular
+  @param[out] pDstX     Points to the solution X of shape NxO, may be equal to pSrcB
+  @return     none
+
+  The diagonal values of A must not be zero, plp_mat_solve_tri_f32 checks them.
+
+  @par Blocking
+  Four columns of X are solved at once, such that every value of A is loaded once for
+  four multiply-accumulates. The division by the diagonal value is replaced by one
+  reciprocal per row and block.
 */
 
-void plp_mat_mult_f32s_xpulpv2(const float *__restrict__ pSrcA,
-                               const float *__restrict__ pSrcB,
-                               uint32_t M,
-                               uint32_t N,
-                               uint32_t O,
-                               float *__restrict__ pDstC);
+void plp_mat_solve_tri_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                                    const float *pSrcB,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    uint8_t upperFlag,
+                                    float *pDstX);
 
 /** -------------------------------------------------------
-   @brief      Glue code for parallel matrix matrix multiplication of a 32-bit floating-point
-   matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  nPE   Number of cores to use
-   @param[out] pDstC Output is written here
-   @return     none
+  @brief      Glue code for parallel triangular solve of 32-bit floats
+  @param[in]  pSrcA     Points to the triangle of the NxN matrix A, packed row by row
+  @param[in]  pSrcB     Points to the right-hand sides B of shape NxO
+  @param[in]  N         Height and width of A, height of B
+  @param[in]  O         Number of right-hand sides, width of B and X
+  @param[in]  upperFlag 0: A is lower triangular, 1: A is upper triangular
+  @param[in]  nPE       Number of cores to use for computation
+  @param[out] pDstX     Points to the solution X of shape NxO, may be equal to pSrcB
+  @return     0: Success, 1: A diagonal value of A is zero, 2: operation not supported
 */
 
-void plp_mat_mult_f32_parallel(const float *__restrict__ pSrcA,
-                               const float *__restrict__ pSrcB,
-                               uint32_t M,
-                               uint32_t N,
-                               uint32_t O,
-                               uint32_t nPE,
-                               float *__restrict__ pDstC);
+int plp_mat_solve_tri_f32_parallel(const float *__restrict__ pSrcA,
+                                   const float *pSrcB,
+                                   uint32_t N,
+                                   uint32_t O,
+                                   uint8_t upperFlag,
+                                   uint32_t nPE,
+                                   float *pDstX);
 
 /** -------------------------------------------------------
-    @brief      Parallel matrix multiplication of 32-bit floating-point matrices kernel for XPULPV2
-                extension.
-    @param[in]  args  pointer to plp_mat_mult_instance_f32 struct initialized by
-                      plp_mat_mult_f32_parallel
-    @return     none
+  @brief      Parallel triangular solve of 32-bit floats kernel for XPULPV2 extension
+  @param[in]  args  pointer to plp_mat_solve_tri_instance_f32 struct initialized by
+                    plp_mat_solve_tri_f32_parallel
+  @return     none
+
+  @par Blocking
+  Four columns of X are solved at once, such that every value of A is loaded once for
+  four multiply-accumulates. The division by the diagonal value is replaced by one
+  reciprocal per row and block.
+
+  @par Parallelization
+  The columns of X are independent. Every core solves every nPE-th block of four
+  columns, and the remaining columns are split over the cores. With fewer than
+  4 * nPE columns, some cores stay idle.
 */
 
-void plp_mat_mult_f32p_xpulpv2(void *args);
+void plp_mat_solve_tri_f32p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-   @brief      Parallel matrix multiplication of 8-bit integer matrices kernel for XPULPV2
-               extension.
-   @param[in]  args  pointer to plp_mat_mult_instance_i8 struct initialized by
-                     plp_mat_mult_i8_parallel
-   @return     none
-
-   @par Exploiting SIMD instructions
-   The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
-   performed on 32 bit vectors, with 32 bit accumulator.
+  @brief      Glue code for Toeplitz matrix-vector multiplication of 32-bit floats
+  @param[in]  pSrcT Points to the M + N - 1 values of the diagonals, T[m, n] = pSrcT[m - n + N - 1]
+  @param[in]  pSrcX Points to the input vector of length N
+  @param[in]  M     Height of the Toeplitz matrix
+  @param[in]  N     Width of the Toeplitz matrix
+  @param[out] pDstY Points to the output vector of length M
+  @return     none
 */
 
-void plp_mat_mult_i8p_xpulpv2(void *args);
+void plp_mat_vec_toeplitz_f32(const float *__restrict__ pSrcT,
+                              const float *__restrict__ pSrcX,
+                              uint32_t M,
+                              uint32_t N,
+                              float *__restrict__ pDstY);
 
 /** -------------------------------------------------------
-   @brief      Glue code for matrix matrix multiplication of a 32-bit fix-point matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[out] pDstC Output is written here
-   @return     none
+  @brief      Toeplitz matrix-vector multiplication of 32-bit floats kernel for XPULPV2 extension
+  @param[in]  pSrcT Points to the M + N - 1 values of the diagonals, T[m, n] = pSrcT[m - n + N - 1]
+  @param[in]  pSrcX Points to the input vector of length N
+  @param[in]  M     Height of the Toeplitz matrix
+  @param[in]  N     Width of the Toeplitz matrix
+  @param[out] pDstY Points to the output vector of length M
+  @return     none
 
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
- */
+  @par Blocking
+  Four rows are computed at once. The values of the four rows in one column are a
+  window of pSrcT, which moves by one value per column, so every column needs one load
+  of the Toeplitz values and one of x for four multiply-accumulates.
+*/
 
-void plp_mat_mult_q32(const int32_t *__restrict__ pSrcA,
-                      const int32_t *__restrict__ pSrcB,
-                      uint32_t M,
-                      uint32_t N,
-                      uint32_t O,
-                      uint32_t shift,
-                      int32_t *__restrict__ pDstC);
+void plp_mat_vec_toeplitz_f32s_xpulpv2(const float *__restrict__ pSrcT,
+                                       const float *__restrict__ pSrcX,
+                                       uint32_t M,
+                                       uint32_t N,
+                                       float *__restrict__ pDstY);
 
 /** -------------------------------------------------------
-   @brief      Glue code for parallel matrix matrix multiplication of a 32-bit fix-point
-               matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[in]  nPE   Number of cores to use
-   @param[out] pDstC Output is written here
-   @return     none
+  @brief      Glue code for parallel Toeplitz matrix-vector multiplication of 32-bit floats
+  @param[in]  pSrcT Points to the M + N - 1 values of the diagonals, T[m, n] = pSrcT[m - n + N - 1]
+  @param[in]  pSrcX Points to the input vector of length N
+  @param[in]  M     Height of the Toeplitz matrix
+  @param[in]  N     Width of the Toeplitz matrix
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstY Points to the output vector of length M
+  @return     none
+*/
 
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
- */
+void plp_mat_vec_toeplitz_f32_parallel(const float *__restrict__ pSrcT,
+                                       const float *__restrict__ pSrcX,
+                                       uint32_t M,
+                                       uint32_t N,
+                                       uint32_t nPE,
+                                       float *__restrict__ pDstY);
 
-void plp_mat_mult_q32_parallel(const int32_t *__restrict__ pSrcA,
-                               const int32_t *__restrict__ pSrcB,
-                               uint32_t M,
-                               uint32_t N,
-                               uint32_t O,
-                               uint32_t shift,
-                               uint32_t nPE,
-                               int32_t *__restrict__ pDstC);
+/** -------------------------------------------------------
+  @brief      Parallel Toeplitz matrix-vector multiplication of 32-bit floats kernel for XPULPV2
+              extension
+  @param[in]  args  pointer to plp_mat_vec_toeplitz_instance_f32 struct initialized by
+                    plp_mat_vec_toeplitz_f32_parallel
+  @return     none
+
+  @par Blocking
+  Four rows are computed at once. The values of the four rows in one column are a
+  window of pSrcT, which moves by one value per column, so every column needs one load
+  of the Toeplitz values and one of x for four multiply-accumulates.
+
+  @par Parallelization
+  Every core computes a contiguous range of rows, a multiple of four, such that the
+  window of the Toeplitz values can be used for the whole range.
+*/
+
+void plp_mat_vec_toeplitz_f32p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-   @brief      Matrix matrix multiplication of a 32-bit fix-point matrices for RV32IM extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[out] pDstC Output is written here
-   @return     none
+  @brief      Glue code for Toeplitz matrix-vector multiplication of 16-bit fix-point numbers
+  @param[in]  pSrcT Points to the M + N - 1 values of the diagonals, T[m, n] = pSrcT[m - n + N - 1]
+  @param[in]  pSrcX Points to the input vector of length N
+  @param[in]  M     Height of the Toeplitz matrix
+  @param[in]  N     Width of the Toeplitz matrix
+  @param[in]  shift Amount to shift the result of each multiplication
+  @param[out] pDstY Points to the output vector of length M
+  @return     none
 
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+  @par Fix-Point and Shifting
+  Every product is shifted by `shift` to the right with rounding and the sum is stored
+  with 16 bits, exactly like in plp_mat_mult_q16. If A is represented as `pSrcA * 2^-x`
+  and B as `pSrcB * 2^-y`, C is represented as `pDstC * 2^-(x + y - shift)`. Set `shift`
+  such that no overflow occurs.
 */
 
-void plp_mat_mult_q32s_rv32im(const int32_t *__restrict__ pSrcA,
-                              const int32_t *__restrict__ pSrcB,
+void plp_mat_vec_toeplitz_q16(const int16_t *__restrict__ pSrcT,
+                              const int16_t *__restrict__ pSrcX,
                               uint32_t M,
                               uint32_t N,
-                              uint32_t O,
                               uint32_t shift,
-                              int32_t *__restrict__ pDstC);
+                              int16_t *__restrict__ pDstY);
 
 /** -------------------------------------------------------
-   @brief      Matrix matrix multiplication of a 32-bit fix-point matrices for XPULPV2 extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[out] pDstC Output is written here
-   @return     none
+  @brief      Toeplitz matrix-vector multiplication of 16-bit fix-point numbers kernel for RV32IM
+              extension
+  @param[in]  pSrcT Points to the M + N - 1 values of the diagonals, T[m, n] = pSrcT[m - n + N - 1]
+  @param[in]  pSrcX Points to the input vector of length N
+  @param[in]  M     Height of the Toeplitz matrix
+  @param[in]  N     Width of the Toeplitz matrix
+  @param[in]  shift Amount to shift the result of each multiplication
+  @param[out] pDstY Points to the output vector of length M
+  @return     none
 
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+  @par Blocking
+  Four rows are computed at once. The values of the four rows in one column are a
+  window of pSrcT, which moves by one value per column, so every column needs one load
+  of the Toeplitz values and one of x for four multiply-accumulates.
+
+  @par Fix-Point and Shifting
+  Every product is shifted by `shift` to the right with rounding and the sum is stored
+  with 16 bits, exactly like in plp_mat_mult_q16. If A is represented as `pSrcA * 2^-x`
+  and B as `pSrcB * 2^-y`, C is represented as `pDstC * 2^-(x + y - shift)`. Set `shift`
+  such that no overflow occurs.
 */
 
-void plp_mat_mult_q32s_xpulpv2(const int32_t *__restrict__ pSrcA,
-                               const int32_t *__restrict__ pSrcB,
-                               uint32_t M,
-                               uint32_t N,
-                               uint32_t O,
-                               uint32_t shift,
-                               int32_t *__restrict__ pDstC);
+void plp_mat_vec_toeplitz_q16s_rv32im(const int16_t *__restrict__ pSrcT,
+                                      const int16_t *__restrict__ pSrcX,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t shift,
+                                      int16_t *__restrict__ pDstY);
 
 /** -------------------------------------------------------
-    @brief Parallel matrix multiplication of 32-bit fix-point matrices kernel for XPULPV2 extension.
-    @param[in]  args  pointer to plp_mat_mult_instance_q32 struct initialized by
-                      plp_mat_mult_q32_parallel
-    @return     none
+  @brief      Toeplitz matrix-vector multiplication of 16-bit fix-point numbers kernel for XPULPV2
+              extension
+  @param[in]  pSrcT Points to the M + N - 1 values of the diagonals, T[m, n] = pSrcT[m - n + N - 1]
+  @param[in]  pSrcX Points to the input vector of length N
+  @param[in]  M     Height of the Toeplitz matrix
+  @param[in]  N     Width of the Toeplitz matrix
+  @param[in]  shift Amount to shift the result of each multiplication
+  @param[out] pDstY Points to the output vector of length M
+  @return     none
+
+  @par Blocking
+  Four rows are computed at once. The values of the four rows in one column are a
+  window of pSrcT, which moves by one value per column, so every column needs one load
+  of the Toeplitz values and one of x for four multiply-accumulates.
+
+  @par Fix-Point and Shifting
+  Every product is shifted by `shift` to the right with rounding and the sum is stored
+  with 16 bits, exactly like in plp_mat_mult_q16. If A is represented as `pSrcA * 2^-x`
+  and B as `pSrcB * 2^-y`, C is represented as `pDstC * 2^-(x + y - shift)`. Set `shift`
+  such that no overflow occurs.
 */
 
-void plp_mat_mult_q32p_xpulpv2(void *args);
+void plp_mat_vec_toeplitz_q16s_xpulpv2(const int16_t *__restrict__ pSrcT,
+                                       const int16_t *__restrict__ pSrcX,
+                                       uint32_t M,
+                                       uint32_t N,
+                                       uint32_t shift,
+                                       int16_t *__restrict__ pDstY);
 
 /** -------------------------------------------------------
-   @brief      Glue code for matrix matrix multiplication of a 16-bit fix-point matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[out] pDstC Output is written here
-   @return     none
-
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+  @brief      Glue code for parallel Toeplitz matrix-vector multiplication of 16-bit fix-point
+              numbers
+  @param[in]  pSrcT Points to the M + N - 1 values of the diagonals, T[m, n] = pSrcT[m - n + N - 1]
+  @param[in]  pSrcX Points to the input vector of length N
+  @param[in]  M     Height of the Toeplitz matrix
+  @param[in]  N     Width of the Toeplitz matrix
+  @param[in]  shift Amount to shift the result of each multiplication
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstY Points to the output vector of length M
+  @return     none
 
-   The output of the matrix multiplication will also be stored as an 16-bit array.
-   Set the `shift` parameter such that no overflow ocurrs.
- */
+  @par Fix-Point and Shifting
+  Every product is shifted by `shift` to the right with rounding and the sum is stored
+  with 16 bits, exactly like in plp_mat_mult_q16. If A is represented as `pSrcA * 2^-x`
+  and B as `pSrcB * 2^-y`, C is represented as `pDstC * 2^-(x + y - shift)`. Set `shift`
+  such that no overflow occurs.
+*/
 
-void plp_mat_mult_q16(const int16_t *__restrict__ pSrcA,
-                      const int16_t *__restrict__ pSrcB,
-                      uint32_t M,
-                      uint32_t N,
-                      uint32_t O,
-                      uint32_t shift,
-                      int16_t *__restrict__ pDstC);
+void plp_mat_vec_toeplitz_q16_parallel(const int16_t *__restrict__ pSrcT,
+                                       const int16_t *__restrict__ pSrcX,
+                                       uint32_t M,
+                                       uint32_t N,
+                                       uint32_t shift,
+                                       uint32_t nPE,
+                                       int16_t *__restrict__ pDstY);
 
 /** -------------------------------------------------------
-   @brief      Glue code for parallel matrix matrix multiplication of a 16-bit fix-point
-  matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[in]  nPE   Number of cores to use
-   @param[out] pDstC Output is written here
-   @return     none
+  @brief      Parallel Toeplitz matrix-vector multiplication of 16-bit fix-point numbers kernel for
+              XPULPV2 extension
+  @param[in]  args  pointer to plp_mat_vec_toeplitz_instance_q16 struct initialized by
+                    plp_mat_vec_toeplitz_q16_parallel
+  @return     none
 
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+  @par Blocking
+  Four rows are computed at once. The values of the four rows in one column are a
+  window of pSrcT, which moves by one value per column, so every column needs one load
+  of the Toeplitz values and one of x for four multiply-accumulates.
 
-   The output of the matrix multiplication will also be stored as an 16-bit array.
-   Set the `shift` parameter such that no overflow ocurrs.
- */
+  @par Parallelization
+  Every core computes a contiguous range of rows, a multiple of four, such that the
+  window of the Toeplitz values can be used for the whole range.
 
-void plp_mat_mult_q16_parallel(const int16_t *__restrict__ pSrcA,
-                               const int16_t *__restrict__ pSrcB,
-                               uint32_t M,
-                               uint32_t N,
-                               uint32_t O,
-                               uint32_t shift,
-                               uint32_t nPE,
-                               int16_t *__restrict__ pDstC);
+  @par Fix-Point and Shifting
+  Every product is shifted by `shift` to the right with rounding and the sum is stored
+  with 16 bits, exactly like in plp_mat_mult_q16. If A is represented as `pSrcA * 2^-x`
+  and B as `pSrcB * 2^-y`, C is represented as `pDstC * 2^-(x + y - shift)`. Set `shift`
+  such that no overflow occurs.
+*/
+
+void plp_mat_vec_toeplitz_q16p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-   @brief      Matrix matrix multiplication of a 16-bit fix-point matrices for RV32IM extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[out] pDstC Output is written here
-   @return     none
+  @brief      Glue code for diagonal scaled matrix multiplication of 32-bit floats
+  @param[in]  pSrcA    Points to the first input matrix of shape MxN
+  @param[in]  pSrcB    Points to the second input matrix of shape NxO
+  @param[in]  pDiagRow Points to the M row factors, or NULL to skip the row scaling
+  @param[in]  pDiagCol Points to the O column factors, or NULL to skip the column scaling
+  @param[in]  M        Height of A and C
+  @param[in]  N        Width of A, height of B
+  @param[in]  O        Width of B and C
+  @param[out] pDstC    Points to the output matrix of shape MxO
+  @return     none
+*/
 
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+void plp_mat_mult_diag_f32(const float *__restrict__ pSrcA,
+                           const float *__restrict__ pSrcB,
+                           const float *__restrict__ pDiagRow,
+                           const float *__restrict__ pDiagCol,
+                           uint32_t M,
+                           uint32_t N,
+                           uint32_t O,
+                           float *__restrict__ pDstC);
 
-   The output of the matrix multiplication will also be stored as an 16-bit array.
-   Set the `shift` parameter such that no overflow ocurrs.
+/** -------------------------------------------------------
+  @brief      Diagonal scaled matrix multiplication of 32-bit floats kernel for XPULPV2 extension
+  @param[in]  pSrcA    Points to the first input matrix of shape MxN
+  @param[in]  pSrcB    Points to the second input matrix of shape NxO
+  @param[in]  pDiagRow Points to the M row factors, or NULL to skip the row scaling
+  @param[in]  pDiagCol Points to the O column factors, or NULL to skip the column scaling
+  @param[in]  M        Height of A and C
+  @param[in]  N        Width of A, height of B
+  @param[in]  O        Width of B and C
+  @param[out] pDstC    Points to the output matrix of shape MxO
+  @return     none
+
+  @par Blocking
+  Four columns of C are computed at once, such that every value of A is loaded once for
+  four multiply-accumulates.
 */
 
-void plp_mat_mult_q16s_rv32im(const int16_t *__restrict__ pSrcA,
-                              const int16_t *__restrict__ pSrcB,
-                              uint32_t M,
-                              uint32_t N,
-                              uint32_t O,
-                              uint32_t shift,
-                              int16_t *__restrict__ pDstC);
+void plp_mat_mult_diag_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                                    const float *__restrict__ pSrcB,
+                                    const float *__restrict__ pDiagRow,
+                                    const float *__restrict__ pDiagCol,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    float *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief      Matrix matrix multiplication of a 16-bit fix-point matrices for XPULPV2 extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[out] pDstC Output is written here
-   @return     none
+  @brief      Glue code for parallel diagonal scaled matrix multiplication of 32-bit floats
+  @param[in]  pSrcA    Points to the first input matrix of shape MxN
+  @param[in]  pSrcB    Points to the second input matrix of shape NxO
+  @param[in]  pDiagRow Points to the M row factors, or NULL to skip the row scaling
+  @param[in]  pDiagCol Points to the O column factors, or NULL to skip the column scaling
+  @param[in]  M        Height of A and C
+  @param[in]  N        Width of A, height of B
+  @param[in]  O        Width of B and C
+  @param[in]  nPE      Number of cores to use for computation
+  @param[out] pDstC    Points to the output matrix of shape MxO
+  @return     none
+*/
 
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+void plp_mat_mult_diag_f32_parallel(const float *__restrict__ pSrcA,
+                                    const float *__restrict__ pSrcB,
+                                    const float *__restrict__ pDiagRow,
+                                    const float *__restrict__ pDiagCol,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    uint32_t nPE,
+                                    float *__restrict__ pDstC);
 
-   The output of the matrix multiplication will also be stored as an 16-bit array.
-   Set the `shift` parameter such that no overflow ocurrs.
+/** -------------------------------------------------------
+  @brief      Parallel diagonal scaled matrix multiplication of 32-bit floats kernel for XPULPV2
+              extension
+  @param[in]  args  pointer to plp_mat_mult_diag_instance_f32 struct initialized by
+                    plp_mat_mult_diag_f32_parallel
+  @return     none
+
+  @par Blocking
+  Four columns of C are computed at once, such that every value of A is loaded once for
+  four multiply-accumulates.
+
+  @par Parallelization
+  Every core computes every nPE-th row.
 */
 
-void plp_mat_mult_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
-                               const int16_t *__restrict__ pSrcB,
-                               uint32_t M,
-                               uint32_t N,
-                               uint32_t O,
-                               uint32_t shift,
-                               int16_t *__restrict__ pDstC);
+void plp_mat_mult_diag_f32p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-    @brief Parallel matrix multiplication of 16-bit fix-point matrices kernel for XPULPV2 extension.
-    @param[in]  args  pointer to plp_mat_mult_instance_q16 struct initialized by
-                      plp_mat_mult_q16_parallel
-    @return     none
+  @brief      Glue code for diagonal scaled matrix multiplication of 16-bit fix-point numbers
+  @param[in]  pSrcA    Points to the first input matrix of shape MxN
+  @param[in]  pSrcB    Points to the second input matrix of shape NxO
+  @param[in]  pDiagRow Points to the M row factors, or NULL to skip the row scaling
+  @param[in]  pDiagCol Points to the O column factors, or NULL to skip the column scaling
+  @param[in]  M        Height of A and C
+  @param[in]  N        Width of A, height of B
+  @param[in]  O        Width of B and C
+  @param[in]  shift    Amount to shift the result of each multiplication
+  @param[out] pDstC    Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point and Shifting
+  The product A * B is computed like in plp_mat_mult_q16: every product is shifted
+  by `shift` to the right with rounding and the sum is truncated to 16 bits. It is
+  then multiplied with the row and the column factor, each followed by a rounding
+  shift by `shift`. The factors therefore have `shift` bits after the binary point,
+  and `1 << shift` does not change the value.
 */
 
-void plp_mat_mult_q16p_xpulpv2(void *args);
+void plp_mat_mult_diag_q16(const int16_t *__restrict__ pSrcA,
+                           const int16_t *__restrict__ pSrcB,
+                           const int16_t *__restrict__ pDiagRow,
+                           const int16_t *__restrict__ pDiagCol,
+                           uint32_t M,
+                           uint32_t N,
+                           uint32_t O,
+                           uint32_t shift,
+                           int16_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief      Glue code for matrix matrix multiplication of a 8-bit fix-point matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[out] pDstC Output is written here
-   @return     none
+  @brief      Diagonal scaled matrix multiplication of 16-bit fix-point numbers kernel for RV32IM
+              extension
+  @param[in]  pSrcA    Points to the first input matrix of shape MxN
+  @param[in]  pSrcB    Points to the second input matrix of shape NxO
+  @param[in]  pDiagRow Points to the M row factors, or NULL to skip the row scaling
+  @param[in]  pDiagCol Points to the O column factors, or NULL to skip the column scaling
+  @param[in]  M        Height of A and C
+  @param[in]  N        Width of A, height of B
+  @param[in]  O        Width of B and C
+  @param[in]  shift    Amount to shift the result of each multiplication
+  @param[out] pDstC    Points to the output matrix of shape MxO
+  @return     none
 
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+  @par Blocking
+  Four columns of C are computed at once, such that every value of A is loaded once for
+  four multiply-accumulates.
 
-   The output of the matrix multiplication will also be stored as an 8-bit array.
-   Set the `shift` parameter such that no overflow ocurrs.
- */
+  @par Fix-Point and Shifting
+  The product A * B is computed like in plp_mat_mult_q16: every product is shifted
+  by `shift` to the right with rounding and the sum is truncated to 16 bits. It is
+  then multiplied with the row and the column factor, each followed by a rounding
+  shift by `shift`. The factors therefore have `shift` bits after the binary point,
+  and `1 << shift` does not change the value.
+*/
 
-void plp_mat_mult_q8(const int8_t *__restrict__ pSrcA,
-                     const int8_t *__restrict__ pSrcB,
-                     uint32_t M,
-                     uint32_t N,
-                     uint32_t O,
-                     uint32_t shift,
-                     int8_t *__restrict__ pDstC);
+void plp_mat_mult_diag_q16s_rv32im(const int16_t *__restrict__ pSrcA,
+                                   const int16_t *__restrict__ pSrcB,
+                                   const int16_t *__restrict__ pDiagRow,
+                                   const int16_t *__restrict__ pDiagCol,
+                                   uint32_t M,
+                                   uint32_t N,
+                                   uint32_t O,
+                                   uint32_t shift,
+                                   int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Diagonal scaled matrix multiplication of 16-bit fix-point numbers kernel for XPULPV2
+              extension
+  @param[in]  pSrcA    Points to the first input matrix of shape MxN
+  @param[in]  pSrcB    Points to the second input matrix of shape NxO
+  @param[in]  pDiagRow Points to the M row factors, or NULL to skip the row scaling
+  @param[in]  pDiagCol Points to the O column factors, or NULL to skip the column scaling
+  @param[in]  M        Height of A and C
+  @param[in]  N        Width of A, height of B
+  @param[in]  O        Width of B and C
+  @param[in]  shift    Amount to shift the result of each multiplication
+  @param[out] pDstC    Points to the output matrix of shape MxO
+  @return     none
+
+  @par Blocking
+  Four columns of C are computed at once, such that every value of A is loaded once for
+  four multiply-accumulates.
+
+  @par Fix-Point and Shifting
+  The product A * B is computed like in plp_mat_mult_q16: every product is shifted
+  by `shift` to the right with rounding and the sum is truncated to 16 bits. It is
+  then multiplied with the row and the column factor, each followed by a rounding
+  shift by `shift`. The factors therefore have `shift` bits after the binary point,
+  and `1 << shift` does not change the value.
+*/
+
+void plp_mat_mult_diag_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                    const int16_t *__restrict__ pSrcB,
+                                    const int16_t *__restrict__ pDiagRow,
+                                    const int16_t *__restrict__ pDiagCol,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    uint32_t shift,
+                                    int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel diagonal scaled matrix multiplication of 16-bit fix-point
+              numbers
+  @param[in]  pSrcA    Points to the first input matrix of shape MxN
+  @param[in]  pSrcB    Points to the second input matrix of shape NxO
+  @param[in]  pDiagRow Points to the M row factors, or NULL to skip the row scaling
+  @param[in]  pDiagCol Points to the O column factors, or NULL to skip the column scaling
+  @param[in]  M        Height of A and C
+  @param[in]  N        Width of A, height of B
+  @param[in]  O        Width of B and C
+  @param[in]  shift    Amount to shift the result of each multiplication
+  @param[in]  nPE      Number of cores to use for computation
+  @param[out] pDstC    Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point and Shifting
+  The product A * B is computed like in plp_mat_mult_q16: every product is shifted
+  by `shift` to the right with rounding and the sum is truncated to 16 bits. It is
+  then multiplied with the row and the column factor, each followed by a rounding
+  shift by `shift`. The factors therefore have `shift` bits after the binary point,
+  and `1 << shift` does not change the value.
+*/
+
+void plp_mat_mult_diag_q16_parallel(const int16_t *__restrict__ pSrcA,
+                                    const int16_t *__restrict__ pSrcB,
+                                    const int16_t *__restrict__ pDiagRow,
+                                    const int16_t *__restrict__ pDiagCol,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    uint32_t shift,
+                                    uint32_t nPE,
+                                    int16_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief      Glue code for parallel matrix matrix multiplication of a 8-bit fix-point matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[in]  nPE   Number of cores to use
-   @param[out] pDstC Output is written here
-   @return     none
+  @brief      Parallel diagonal scaled matrix multiplication of 16-bit fix-point numbers kernel for
+              XPULPV2 extension
+  @param[in]  args  pointer to plp_mat_mult_diag_instance_q16 struct initialized by
+                    plp_mat_mult_diag_q16_parallel
+  @return     none
 
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+  @par Blocking
+  Four columns of C are computed at once, such that every value of A is loaded once for
+  four multiply-accumulates.
 
-   The output of the matrix multiplication will also be stored as an 8-bit array.
-   Set the `shift` parameter such that no overflow ocurrs.
- */
+  @par Parallelization
+  Every core computes every nPE-th row.
 
-void plp_mat_mult_q8_parallel(const int8_t *__restrict__ pSrcA,
-                              const int8_t *__restrict__ pSrcB,
-                              uint32_t M,
-                              uint32_t N,
-                              uint32_t O,
-                              uint32_t shift,
-                              uint32_t nPE,
-                              int8_t *__restrict__ pDstC);
+  @par Fix-Point and Shifting
+  The product A * B is computed like in plp_mat_mult_q16: every product is shifted
+  by `shift` to the right with rounding and the sum is truncated to 16 bits. It is
+  then multiplied with the row and the column factor, each followed by a rounding
+  shift by `shift`. The factors therefore have `shift` bits after the binary point,
+  and `1 << shift` does not change the value.
+*/
+
+void plp_mat_mult_diag_q16p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-   @brief      Matrix matrix multiplication of a 8-bit fix-point matrices for RV32IM extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[out] pDstC Output is written here
-   @return     none
+  @brief      Glue code for matrix multiplication of 8-bit integer weights and 16-bit integer
+              activations
+  @param[in]  pSrcA Points to the weights A of shape MxN
+  @param[in]  pSrcB Points to the activations B of shape NxO
+  @param[in]  M     Height of A and C, number of output channels
+  @param[in]  N     Width of A, height of B
+  @param[in]  O     Width of B and C
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
 
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+void plp_mat_mult_i8i16(const int8_t *__restrict__ pSrcA,
+                        const int16_t *__restrict__ pSrcB,
+                        uint32_t M,
+                        uint32_t N,
+                        uint32_t O,
+                        int32_t *__restrict__ pDstC);
 
-   The output of the matrix multiplication will also be stored as an 8-bit array.
-   Set the `shift` parameter such that no overflow ocurrs.
+/** -------------------------------------------------------
+  @brief      Matrix multiplication of 8-bit integer weights and 16-bit integer activations kernel
+              for RV32IM extension
+  @param[in]  pSrcA Points to the weights A of shape MxN
+  @param[in]  pSrcB Points to the activations B of shape NxO
+  @param[in]  M     Height of A and C, number of output channels
+  @param[in]  N     Width of A, height of B
+  @param[in]  O     Width of B and C
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
 */
 
-void plp_mat_mult_q8s_rv32im(const int8_t *__restrict__ pSrcA,
-                             const int8_t *__restrict__ pSrcB,
-                             uint32_t M,
-                             uint32_t N,
-                             uint32_t O,
-                             uint32_t shift,
-                             int8_t *__restrict__ pDstC);
+void plp_mat_mult_i8i16s_rv32im(const int8_t *__restrict__ pSrcA,
+                                const int16_t *__restrict__ pSrcB,
+                                uint32_t M,
+                                uint32_t N,
+                                uint32_t O,
+                                int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief      Matrix matrix multiplication of a 8-bit fix-point matrices for XPULPV2 extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[out] pDstC Output is written here
-   @return     none
+  @brief      Matrix multiplication of 8-bit integer weights and 16-bit integer activations kernel
+              for XPULPV2 extension
+  @param[in]  pSrcA Points to the weights A of shape MxN
+  @param[in]  pSrcB Points to the activations B of shape NxO
+  @param[in]  M     Height of A and C, number of output channels
+  @param[in]  N     Width of A, height of B
+  @param[in]  O     Width of B and C
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
 
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+  @par Exploiting SIMD instructions
+  The 16-bit activations are split with shuffles into their high bytes and their low bytes. Four
+  8-bit weights are then multiplied with one __SUMDOTP4 (high bytes) and one __SUMDOTPUS4 (low
+  bytes, unsigned) into 32-bit accumulators, without widening the weights. Four rows and two columns
+  of C are computed at once.
+*/
 
-   The output of the matrix multiplication will also be stored as an 8-bit array.
-   Set the `shift` parameter such that no overflow ocurrs.
+void plp_mat_mult_i8i16s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                 const int16_t *__restrict__ pSrcB,
+                                 uint32_t M,
+                                 uint32_t N,
+                                 uint32_t O,
+                                 int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel matrix multiplication of 8-bit integer weights and 16-bit
+              integer activations
+  @param[in]  pSrcA Points to the weights A of shape MxN
+  @param[in]  pSrcB Points to the activations B of shape NxO
+  @param[in]  M     Height of A and C, number of output channels
+  @param[in]  N     Width of A, height of B
+  @param[in]  O     Width of B and C
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
 */
 
-void plp_mat_mult_q8s_xpulpv2(const int8_t *__restrict__ pSrcA,
-                              const int8_t *__restrict__ pSrcB,
-                              uint32_t M,
-                              uint32_t N,
-                              uint32_t O,
-                              uint32_t shift,
-                              int8_t *__restrict__ pDstC);
+void plp_mat_mult_i8i16_parallel(const int8_t *__restrict__ pSrcA,
+                                 const int16_t *__restrict__ pSrcB,
+                                 uint32_t M,
+                                 uint32_t N,
+                                 uint32_t O,
+                                 uint32_t nPE,
+                                 int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief Parallel matrix multiplication of 8-bit fix-point matrices kernel for XPULPV2 extension.
-    @param[in]  args  pointer to plp_mat_mult_instance_q8 struct initialized by
-                      plp_mat_mult_q8_parallel
-    @return     none
+  @brief      Parallel matrix multiplication of 8-bit integer weights and 16-bit integer activations
+              kernel for XPULPV2 extension
+  @param[in]  args  pointer to plp_mat_mult_instance_i8i16 struct initialized by
+                    plp_mat_mult_i8i16_parallel
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 16-bit activations are split with shuffles into their high bytes and their low bytes. Four
+  8-bit weights are then multiplied with one __SUMDOTP4 (high bytes) and one __SUMDOTPUS4 (low
+  bytes, unsigned) into 32-bit accumulators, without widening the weights. Four rows and two columns
+  of C are computed at once.
+
+  @par Parallelization
+  Every core computes every nPE-th block of 4 rows, and the remaining rows are split
+  over the cores.
 */
 
-void plp_mat_mult_q8p_xpulpv2(void *args);
+void plp_mat_mult_i8i16p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-  @brief      Glue code of matrix matrix multiplication for complex 32-bit integers
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
+  @brief      Glue code for matrix multiplication of 4-bit integer weights and 8-bit integer
+              activations
+  @param[in]  pSrcA Points to the 4-bit weights A of shape MxN, packed two per byte
+  @param[in]  pSrcB Points to the activations B of shape NxO
+  @param[in]  M     Height of A and C, number of output channels
+  @param[in]  N     Width of A, height of B
+  @param[in]  O     Width of B and C
   @param[out] pDstC Points to the output matrix of shape MxO
   @return     none
 */
 
-void plp_mat_mult_cmplx_i32(const int32_t *__restrict__ pSrcA,
-                            const int32_t *__restrict__ pSrcB,
-                            uint32_t M,
-                            uint32_t N,
-                            uint32_t O,
-                            int32_t *__restrict__ pDstC);
+void plp_mat_mult_i4i8(const int8_t *__restrict__ pSrcA,
+                       const int8_t *__restrict__ pSrcB,
+                       uint32_t M,
+                       uint32_t N,
+                       uint32_t O,
+                       int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-  @brief      Matrix matrix multiplication for complex 32-bit integers on RV32IM
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
+  @brief      Matrix multiplication of 4-bit integer weights and 8-bit integer activations kernel
+              for RV32IM extension
+  @param[in]  pSrcA Points to the 4-bit weights A of shape MxN, packed two per byte
+  @param[in]  pSrcB Points to the activations B of shape NxO
+  @param[in]  M     Height of A and C, number of output channels
+  @param[in]  N     Width of A, height of B
+  @param[in]  O     Width of B and C
   @param[out] pDstC Points to the output matrix of shape MxO
   @return     none
 */
 
-void plp_mat_mult_cmplx_i32s_rv32im(const int32_t *__restrict__ pSrcA,
-                                    const int32_t *__restrict__ pSrcB,
-                                    uint32_t M,
-                                    uint32_t N,
-                                    uint32_t O,
-                                    int32_t *__restrict__ pDstC);
+void plp_mat_mult_i4i8s_rv32im(const int8_t *__restrict__ pSrcA,
+                               const int8_t *__restrict__ pSrcB,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t O,
+                               int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-  @brief      Matrix matrix multiplication for complex 32-bit integers on XpulpV2
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
+  @brief      Matrix multiplication of 4-bit integer weights and 8-bit integer activations kernel
+              for XPULPV2 extension
+  @param[in]  pSrcA Points to the 4-bit weights A of shape MxN, packed two per byte
+  @param[in]  pSrcB Points to the activations B of shape NxO
+  @param[in]  M     Height of A and C, number of output channels
+  @param[in]  N     Width of A, height of B
+  @param[in]  O     Width of B and C
   @param[out] pDstC Points to the output matrix of shape MxO
   @return     none
+
+  @par Exploiting SIMD instructions
+  Eight 4-bit weights are loaded with one word and unpacked with two SIMD instructions: __SLL4 gives
+  the weights of the even columns, __AND4 the weights of the odd columns, both multiplied by 16. The
+  activations are shuffled into their even and odd values and multiplied with __SUMDOTP4 into 32-bit
+  accumulators, which are divided by 16 at the end. Two rows and four columns of C are computed at
+  once.
+
+  @par Overflow
+  The SIMD accumulators hold 16 times the sum, they can only overflow for N of 131072 or more.
 */
 
-void plp_mat_mult_cmplx_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
-                                     const int32_t *__restrict__ pSrcB,
-                                     uint32_t M,
-                                     uint32_t N,
-                                     uint32_t O,
-                                     int32_t *__restrict__ pDstC);
+void plp_mat_mult_i4i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                const int8_t *__restrict__ pSrcB,
+                                uint32_t M,
+                                uint32_t N,
+                                uint32_t O,
+                                int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-  @brief      Glue code of parallel matrix matrix multiplication for complex 32-bit integers
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
+  @brief      Glue code for parallel matrix multiplication of 4-bit integer weights and 8-bit
+              integer activations
+  @param[in]  pSrcA Points to the 4-bit weights A of shape MxN, packed two per byte
+  @param[in]  pSrcB Points to the activations B of shape NxO
+  @param[in]  M     Height of A and C, number of output channels
+  @param[in]  N     Width of A, height of B
+  @param[in]  O     Width of B and C
   @param[in]  nPE   Number of cores to use for computation
   @param[out] pDstC Points to the output matrix of shape MxO
   @return     none
 */
 
-void plp_mat_mult_cmplx_i32_parallel(const int32_t *__restrict__ pSrcA,
-                                     const int32_t *__restrict__ pSrcB,
-                                     uint32_t M,
-                                     uint32_t N,
-                                     uint32_t O,
-                                     uint32_t nPE,
-                                     int32_t *__restrict__ pDstC);
+void plp_mat_mult_i4i8_parallel(const int8_t *__restrict__ pSrcA,
+                                const int8_t *__restrict__ pSrcB,
+                                uint32_t M,
+                                uint32_t N,
+                                uint32_t O,
+                                uint32_t nPE,
+                                int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-  @brief      parallel matrix matrix multiplication for complex 32-bit integers on XpulpV2
-  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_i32 struct initialized by
-                    plp_mat_mult_cmplx_i32_parallel
+  @brief      Parallel matrix multiplication of 4-bit integer weights and 8-bit integer activations
+              kernel for XPULPV2 extension
+  @param[in]  args  pointer to plp_mat_mult_instance_i4i8 struct initialized by
+                    plp_mat_mult_i4i8_parallel
   @return     none
+
+  @par Exploiting SIMD instructions
+  Eight 4-bit weights are loaded with one word and unpacked with two SIMD instructions: __SLL4 gives
+  the weights of the even columns, __AND4 the weights of the odd columns, both multiplied by 16. The
+  activations are shuffled into their even and odd values and multiplied with __SUMDOTP4 into 32-bit
+  accumulators, which are divided by 16 at the end. Two rows and four columns of C are computed at
+  once.
+
+  @par Overflow
+  The SIMD accumulators hold 16 times the sum, they can only overflow for N of 131072 or more.
+
+  @par Parallelization
+  Every core computes every nPE-th block of 2 rows, and the remaining rows are split
+  over the cores.
 */
 
-void plp_mat_mult_cmplx_i32p_xpulpv2(void *args);
+void plp_mat_mult_i4i8p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-  @brief      Glue code of matrix matrix multiplication for complex 16-bit integers
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
+  @brief      Glue code for requantized matrix multiplication of 8-bit integer weights and 16-bit
+              integer activations
+  @param[in]  pSrcA Points to the weights A of shape MxN
+  @param[in]  pSrcB Points to the activations B of shape NxO
+  @param[in]  M     Height of A and C, number of output channels
+  @param[in]  N     Width of A, height of B
+  @param[in]  O     Width of B and C
+  @param[in]  pMult Points to the M multipliers, one per output channel
+  @param[in]  pBias Points to the M biases, added after the multiplication
+  @param[in]  shift Amount to shift the requantized values to the right, at least 1
   @param[out] pDstC Points to the output matrix of shape MxO
   @return     none
+
+  @par Requantization
+  Every output of the output channel m (row m of A) is requantized to 16 bits:
+  `round((sum * pMult[m] + pBias[m]) / 2^shift)`, saturated. `sum * pMult[m] + pBias[m]`
+  must fit into 32 bits.
 */
 
-void plp_mat_mult_cmplx_i16(const int16_t *__restrict__ pSrcA,
-                            const int16_t *__restrict__ pSrcB,
-                            uint32_t M,
-                            uint32_t N,
-                            uint32_t O,
-                            int32_t *__restrict__ pDstC);
+void plp_mat_mult_requant_i8i16(const int8_t *__restrict__ pSrcA,
+                                const int16_t *__restrict__ pSrcB,
+                                uint32_t M,
+                                uint32_t N,
+                                uint32_t O,
+                                const int32_t *__restrict__ pMult,
+                                const int32_t *__restrict__ pBias,
+                                uint32_t shift,
+                                int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Requantized matrix multiplication of 8-bit integer weights and 16-bit integer
+              activations kernel for RV32IM extension
+  @param[in]  pSrcA Points to the weights A of shape MxN
+  @param[in]  pSrcB Points to the activations B of shape NxO
+  @param[in]  M     Height of A and C, number of output channels
+  @param[in]  N     Width of A, height of B
+  @param[in]  O     Width of B and C
+  @param[in]  pMult Points to the M multipliers, one per output channel
+  @param[in]  pBias Points to the M biases, added after the multiplication
+  @param[in]  shift Amount to shift the requantized values to the right, at least 1
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Requantization
+  Every output of the output channel m (row m of A) is requantized to 16 bits:
+  `round((sum * pMult[m] + pBias[m]) / 2^shift)`, saturated. `sum * pMult[m] + pBias[m]`
+  must fit into 32 bits.
+*/
+
+void plp_mat_mult_requant_i8i16s_rv32im(const int8_t *__restrict__ pSrcA,
+                                        const int16_t *__restrict__ pSrcB,
+                                        uint32_t M,
+                                        uint32_t N,
+                                        uint32_t O,
+                                        const int32_t *__restrict__ pMult,
+                                        const int32_t *__restrict__ pBias,
+                                        uint32_t shift,
+                                        int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Requantized matrix multiplication of 8-bit integer weights and 16-bit integer
+              activations kernel for XPULPV2 extension
+  @param[in]  pSrcA Points to the weights A of shape MxN
+  @param[in]  pSrcB Points to the activations B of shape NxO
+  @param[in]  M     Height of A and C, number of output channels
+  @param[in]  N     Width of A, height of B
+  @param[in]  O     Width of B and C
+  @param[in]  pMult Points to the M multipliers, one per output channel
+  @param[in]  pBias Points to the M biases, added after the multiplication
+  @param[in]  shift Amount to shift the requantized values to the right, at least 1
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 16-bit activations are split with shuffles into their high bytes and their low bytes. Four
+  8-bit weights are then multiplied with one __SUMDOTP4 (high bytes) and one __SUMDOTPUS4 (low
+  bytes, unsigned) into 32-bit accumulators, without widening the weights. Four rows and two columns
+  of C are computed at once.
+
+  @par Requantization
+  Every output of the output channel m (row m of A) is requantized to 16 bits:
+  `round((sum * pMult[m] + pBias[m]) / 2^shift)`, saturated. `sum * pMult[m] + pBias[m]`
+  must fit into 32 bits.
+*/
+
+void plp_mat_mult_requant_i8i16s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                         const int16_t *__restrict__ pSrcB,
+                                         uint32_t M,
+                                         uint32_t N,
+                                         uint32_t O,
+                                         const int32_t *__restrict__ pMult,
+                                         const int32_t *__restrict__ pBias,
+                                         uint32_t shift,
+                                         int16_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-  @brief      Matrix matrix multiplication for complex 16-bit integers on RV32IM
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
+  @brief      Glue code for parallel requantized matrix multiplication of 8-bit integer weights and
+              16-bit integer activations
+  @param[in]  pSrcA Points to the weights A of shape MxN
+  @param[in]  pSrcB Points to the activations B of shape NxO
+  @param[in]  M     Height of A and C, number of output channels
+  @param[in]  N     Width of A, height of B
+  @param[in]  O     Width of B and C
+  @param[in]  pMult Points to the M multipliers, one per output channel
+  @param[in]  pBias Points to the M biases, added after the multiplication
+  @param[in]  shift Amount to shift the requantized values to the right, at least 1
+  @param[in]  nPE   Number of cores to use for computation
   @param[out] pDstC Points to the output matrix of shape MxO
   @return     none
+
+  @par Requantization
+  Every output of the output channel m (row m of A) is requantized to 16 bits:
+  `round((sum * pMult[m] + pBias[m]) / 2^shift)`, saturated. `sum * pMult[m] + pBias[m]`
+  must fit into 32 bits.
 */
 
-void plp_mat_mult_cmplx_i16s_rv32im(const int16_t *__restrict__ pSrcA,
-                                    const int16_t *__restrict__ pSrcB,
-                                    uint32_t M,
-                                    uint32_t N,
-                                    uint32_t O,
-                                    int32_t *__restrict__ pDstC);
+void plp_mat_mult_requant_i8i16_parallel(const int8_t *__restrict__ pSrcA,
+                                         const int16_t *__restrict__ pSrcB,
+                                         uint32_t M,
+                                         uint32_t N,
+                                         uint32_t O,
+                                         const int32_t *__restrict__ pMult,
+                                         const int32_t *__restrict__ pBias,
+                                         uint32_t shift,
+                                         uint32_t nPE,
+                                         int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Parallel requantized matrix multiplication of 8-bit integer weights and 16-bit integer
+              activations kernel for XPULPV2 extension
+  @param[in]  args  pointer to plp_mat_mult_requant_instance_i8i16 struct initialized by
+                    plp_mat_mult_requant_i8i16_parallel
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 16-bit activations are split with shuffles into their high bytes and their low bytes. Four
+  8-bit weights are then multiplied with one __SUMDOTP4 (high bytes) and one __SUMDOTPUS4 (low
+  bytes, unsigned) into 32-bit accumulators, without widening the weights. Four rows and two columns
+  of C are computed at once.
+
+  @par Parallelization
+  Every core computes every nPE-th block of 4 rows, and the remaining rows are split
+  over the cores.
+
+  @par Requantization
+  Every output of the output channel m (row m of A) is requantized to 16 bits:
+  `round((sum * pMult[m] + pBias[m]) / 2^shift)`, saturated. `sum * pMult[m] + pBias[m]`
+  must fit into 32 bits.
+*/
+
+void plp_mat_mult_requant_i8i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for requantized matrix multiplication of 4-bit integer weights and 8-bit
+              integer activations
+  @param[in]  pSrcA Points to the 4-bit weights A of shape MxN, packed two per byte
+  @param[in]  pSrcB Points to the activations B of shape NxO
+  @param[in]  M     Height of A and C, number of output channels
+  @param[in]  N     Width of A, height of B
+  @param[in]  O     Width of B and C
+  @param[in]  pMult Points to the M multipliers, one per output channel
+  @param[in]  pBias Points to the M biases, added after the multiplication
+  @param[in]  shift Amount to shift the requantized values to the right, at least 1
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Requantization
+  Every output of the output channel m (row m of A) is requantized to 8 bits:
+  `round((sum * pMult[m] + pBias[m]) / 2^shift)`, saturated. `sum * pMult[m] + pBias[m]`
+  must fit into 32 bits.
+*/
+
+void plp_mat_mult_requant_i4i8(const int8_t *__restrict__ pSrcA,
+                               const int8_t *__restrict__ pSrcB,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t O,
+                               const int32_t *__restrict__ pMult,
+                               const int32_t *__restrict__ pBias,
+                               uint32_t shift,
+                               int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Requantized matrix multiplication of 4-bit integer weights and 8-bit integer
+              activations kernel for RV32IM extension
+  @param[in]  pSrcA Points to the 4-bit weights A of shape MxN, packed two per byte
+  @param[in]  pSrcB Points to the activations B of shape NxO
+  @param[in]  M     Height of A and C, number of output channels
+  @param[in]  N     Width of A, height of B
+  @param[in]  O     Width of B and C
+  @param[in]  pMult Points to the M multipliers, one per output channel
+  @param[in]  pBias Points to the M biases, added after the multiplication
+  @param[in]  shift Amount to shift the requantized values to the right, at least 1
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
 
-/** -------------------------------------------------------
-  @brief      Matrix matrix multiplication for complex 16-bit integers on XpulpV2
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
+  @par Requantization
+  Every output of the output channel m (row m of A) is requantized to 8 bits:
+  `round((sum * pMult[m] + pBias[m]) / 2^shift)`, saturated. `sum * pMult[m] + pBias[m]`
+  must fit into 32 bits.
+*/
+
+void plp_mat_mult_requant_i4i8s_rv32im(const int8_t *__restrict__ pSrcA,
+                                       const int8_t *__restrict__ pSrcB,
+                                       uint32_t M,
+                                       uint32_t N,
+                                       uint32_t O,
+                                       const int32_t *__restrict__ pMult,
+                                       const int32_t *__restrict__ pBias,
+                                       uint32_t shift,
+                                       int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Requantized matrix multiplication of 4-bit integer weights and 8-bit integer
+              activations kernel for XPULPV2 extension
+  @param[in]  pSrcA Points to the 4-bit weights A of shape MxN, packed two per byte
+  @param[in]  pSrcB Points to the activations B of shape NxO
+  @param[in]  M     Height of A and C, number of output channels
+  @param[in]  N     Width of A, height of B
+  @param[in]  O     Width of B and C
+  @param[in]  pMult Points to the M multipliers, one per output channel
+  @param[in]  pBias Points to the M biases, added after the multiplication
+  @param[in]  shift Amount to shift the requantized values to the right, at least 1
   @param[out] pDstC Points to the output matrix of shape MxO
   @return     none
 
   @par Exploiting SIMD instructions
-  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+  Eight 4-bit weights are loaded with one word and unpacked with two SIMD instructions: __SLL4 gives
+  the weights of the even columns, __AND4 the weights of the odd columns, both multiplied by 16. The
+  activations are shuffled into their even and odd values and multiplied with __SUMDOTP4 into 32-bit
+  accumulators, which are divided by 16 at the end. Two rows and four columns of C are computed at
+  once.
+
+  @par Overflow
+  The SIMD accumulators hold 16 times the sum, they can only overflow for N of 131072 or more.
+
+  @par Requantization
+  Every output of the output channel m (row m of A) is requantized to 8 bits:
+  `round((sum * pMult[m] + pBias[m]) / 2^shift)`, saturated. `sum * pMult[m] + pBias[m]`
+  must fit into 32 bits.
 */
 
-void plp_mat_mult_cmplx_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
-                                     const int16_t *__restrict__ pSrcB,
-                                     uint32_t M,
-                                     uint32_t N,
-                                     uint32_t O,
-                                     int32_t *__restrict__ pDstC);
+void plp_mat_mult_requant_i4i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                        const int8_t *__restrict__ pSrcB,
+                                        uint32_t M,
+                                        uint32_t N,
+                                        uint32_t O,
+                                        const int32_t *__restrict__ pMult,
+                                        const int32_t *__restrict__ pBias,
+                                        uint32_t shift,
+                                        int8_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-  @brief      Glue code of parallel matrix matrix multiplication for complex 16-bit integers
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
+  @brief      Glue code for parallel requantized matrix multiplication of 4-bit integer weights and
+              8-bit integer activations
+  @param[in]  pSrcA Points to the 4-bit weights A of shape MxN, packed two per byte
+  @param[in]  pSrcB Points to the activations B of shape NxO
+  @param[in]  M     Height of A and C, number of output channels
+  @param[in]  N     Width of A, height of B
+  @param[in]  O     Width of B and C
+  @param[in]  pMult Points to the M multipliers, one per output channel
+  @param[in]  pBias Points to the M biases, added after the multiplication
+  @param[in]  shift Amount to shift the requantized values to the right, at least 1
   @param[in]  nPE   Number of cores to use for computation
   @param[out] pDstC Points to the output matrix of shape MxO
   @return     none
+
+  @par Requantization
+  Every output of the output channel m (row m of A) is requantized to 8 bits:
+  `round((sum * pMult[m] + pBias[m]) / 2^shift)`, saturated. `sum * pMult[m] + pBias[m]`
+  must fit into 32 bits.
 */
 
-void plp_mat_mult_cmplx_i16_parallel(const int16_t *__restrict__ pSrcA,
-                                     const int16_t *__restrict__ pSrcB,
-                                     uint32_t M,
-                                     uint32_t N,
-                                     uint32_t O,
-                                     uint32_t nPE,
-                                     int32_t *__restrict__ pDstC);
+void plp_mat_mult_requant_i4i8_parallel(const int8_t *__restrict__ pSrcA,
+                                        const int8_t *__restrict__ pSrcB,
+                                        uint32_t M,
+                                        uint32_t N,
+                                        uint32_t O,
+                                        const int32_t *__restrict__ pMult,
+                                        const int32_t *__restrict__ pBias,
+                                        uint32_t shift,
+                                        uint32_t nPE,
+                                        int8_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-  @brief      parallel matrix matrix multiplication for complex 16-bit integers on XpulpV2
-  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_i16 struct initialized by
-                    plp_mat_mult_cmplx_i16_parallel
+  @brief      Parallel requantized matrix multiplication of 4-bit integer weights and 8-bit integer
+              activations kernel for XPULPV2 extension
+  @param[in]  args  pointer to plp_mat_mult_requant_instance_i4i8 struct initialized by
+                    plp_mat_mult_requant_i4i8_parallel
   @return     none
 
   @par Exploiting SIMD instructions
-  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+  Eight 4-bit weights are loaded with one word and unpacked with two SIMD instructions: __SLL4 gives
+  the weights of the even columns, __AND4 the weights of the odd columns, both multiplied by 16. The
+  activations are shuffled into their even and odd values and multiplied with __SUMDOTP4 into 32-bit
+  accumulators, which are divided by 16 at the end. Two rows and four columns of C are computed at
+  once.
+
+  @par Overflow
+  The SIMD accumulators hold 16 times the sum, they can only overflow for N of 131072 or more.
+
+  @par Parallelization
+  Every core computes every nPE-th block of 2 rows, and the remaining rows are split
+  over the cores.
+
+  @par Requantization
+  Every output of the output channel m (row m of A) is requantized to 8 bits:
+  `round((sum * pMult[m] + pBias[m]) / 2^shift)`, saturated. `sum * pMult[m] + pBias[m]`
+  must fit into 32 bits.
 */
 
-void plp_mat_mult_cmplx_i16p_xpulpv2(void *args);
+void plp_mat_mult_requant_i4i8p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-  @brief      Glue code of matrix matrix multiplication for complex 8-bit integers
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[out] pDstC Points to the output matrix of shape MxO
+  @brief      Glue code for matrix-vector multiplication of 8-bit integer weights and 16-bit integer
+              activations
+  @param[in]  pSrcA Points to the weights A of shape MxN
+  @param[in]  pSrcX Points to the activation vector x of length N
+  @param[in]  M     Height of A, number of output channels
+  @param[in]  N     Width of A, length of x
+  @param[out] pDstY Points to the output vector of length M
   @return     none
 */
 
-void plp_mat_mult_cmplx_i8(const int8_t *__restrict__ pSrcA,
-                           const int8_t *__restrict__ pSrcB,
-                           uint32_t M,
-                           uint32_t N,
-                           uint32_t O,
-                           int32_t *__restrict__ pDstC);
+void plp_mat_vec_i8i16(const int8_t *__restrict__ pSrcA,
+                       const int16_t *__restrict__ pSrcX,
+                       uint32_t M,
+                       uint32_t N,
+                       int32_t *__restrict__ pDstY);
 
 /** -------------------------------------------------------
-  @brief      Matrix matrix multiplication for complex 8-bit integers on RV32IM
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[out] pDstC Points to the output matrix of shape MxO
+  @brief      Matrix-vector multiplication of 8-bit integer weights and 16-bit integer activations
+              kernel for RV32IM extension
+  @param[in]  pSrcA Points to the weights A of shape MxN
+  @param[in]  pSrcX Points to the activation vector x of length N
+  @param[in]  M     Height of A, number of output channels
+  @param[in]  N     Width of A, length of x
+  @param[out] pDstY Points to the output vector of length M
   @return     none
 */
 
-void plp_mat_mult_cmplx_i8s_rv32im(const int8_t *__restrict__ pSrcA,
-                                   const int8_t *__restrict__ pSrcB,
-                                   uint32_t M,
-                                   uint32_t N,
-                                   uint32_t O,
-                                   int32_t *__restrict__ pDstC);
+void plp_mat_vec_i8i16s_rv32im(const int8_t *__restrict__ pSrcA,
+                               const int16_t *__restrict__ pSrcX,
+                               uint32_t M,
+                               uint32_t N,
+                               int32_t *__restrict__ pDstY);
 
 /** -------------------------------------------------------
-  @brief      Matrix matrix multiplication for complex 8-bit integers on XpulpV2
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[out] pDstC Points to the output matrix of shape MxO
+  @brief      Matrix-vector multiplication of 8-bit integer weights and 16-bit integer activations
+              kernel for XPULPV2 extension
+  @param[in]  pSrcA Points to the weights A of shape MxN
+  @param[in]  pSrcX Points to the activation vector x of length N
+  @param[in]  M     Height of A, number of output channels
+  @param[in]  N     Width of A, length of x
+  @param[out] pDstY Points to the output vector of length M
   @return     none
 
   @par Exploiting SIMD instructions
-  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+  The 16-bit activations are split with shuffles into their high bytes and their low bytes. Four
+  8-bit weights are then multiplied with one __SUMDOTP4 (high bytes) and one __SUMDOTPUS4 (low
+  bytes, unsigned) into 32-bit accumulators, without widening the weights. Four values of y are
+  computed at once, such that every split of x is used four times.
 */
 
-void plp_mat_mult_cmplx_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
-                                    const int8_t *__restrict__ pSrcB,
-                                    uint32_t M,
-                                    uint32_t N,
-                                    uint32_t O,
-                                    int32_t *__restrict__ pDstC);
+void plp_mat_vec_i8i16s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                const int16_t *__restrict__ pSrcX,
+                                uint32_t M,
+                                uint32_t N,
+                                int32_t *__restrict__ pDstY);
 
 /** -------------------------------------------------------
-  @brief      Glue code of parallel matrix matrix multiplication for complex 8-bit integers
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
+  @brief      Glue code for parallel matrix-vector multiplication of 8-bit integer weights and
+              16-bit integer activations
+  @param[in]  pSrcA Points to the weights A of shape MxN
+  @param[in]  pSrcX Points to the activation vector x of length N
+  @param[in]  M     Height of A, number of output channels
+  @param[in]  N     Width of A, length of x
   @param[in]  nPE   Number of cores to use for computation
-  @param[out] pDstC Points to the output matrix of shape MxO
+  @param[out] pDstY Points to the output vector of length M
   @return     none
 */
 
-void plp_mat_mult_cmplx_i8_parallel(const int8_t *__restrict__ pSrcA,
-                                    const int8_t *__restrict__ pSrcB,
-                                    uint32_t M,
-                                    uint32_t N,
-                                    uint32_t O,
-                                    uint32_t nPE,
-                                    int32_t *__restrict__ pDstC);
+void plp_mat_vec_i8i16_parallel(const int8_t *__restrict__ pSrcA,
+                                const int16_t *__restrict__ pSrcX,
+                                uint32_t M,
+                                uint32_t N,
+                                uint32_t nPE,
+                                int32_t *__restrict__ pDstY);
 
 /** -------------------------------------------------------
-  @brief      parallel matrix matrix multiplication for complex 8-bit integers on XpulpV2
-  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_i8 struct initialized by
-                    plp_mat_mult_cmplx_i8_parallel
+  @brief      Parallel matrix-vector multiplication of 8-bit integer weights and 16-bit integer
+              activations kernel for XPULPV2 extension
+  @param[in]  args  pointer to plp_mat_vec_instance_i8i16 struct initialized by
+                    plp_mat_vec_i8i16_parallel
   @return     none
 
   @par Exploiting SIMD instructions
-  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+  The 16-bit activations are split with shuffles into their high bytes and their low bytes. Four
+  8-bit weights are then multiplied with one __SUMDOTP4 (high bytes) and one __SUMDOTPUS4 (low
+  bytes, unsigned) into 32-bit accumulators, without widening the weights. Four values of y are
+  computed at once, such that every split of x is used four times.
+
+  @par Parallelization
+  Every core computes every nPE-th block of 4 rows, and the remaining rows are split
+  over the cores.
 */
 
-void plp_mat_mult_cmplx_i8p_xpulpv2(void *args);
+void plp_mat_vec_i8i16p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-  @brief      Glue code of matrix matrix multiplication for complex 32-bit floats
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[out] pDstC Points to the output matrix of shape MxO
+  @brief      Glue code for matrix-vector multiplication of 4-bit integer weights and 8-bit integer
+              activations
+  @param[in]  pSrcA Points to the 4-bit weights A of shape MxN, packed two per byte
+  @param[in]  pSrcX Points to the activation vector x of length N
+  @param[in]  M     Height of A, number of output channels
+  @param[in]  N     Width of A, length of x
+  @param[out] pDstY Points to the output vector of length M
   @return     none
 */
 
-void plp_mat_mult_cmplx_f32(const float *__restrict__ pSrcA,
-                            const float *__restrict__ pSrcB,
-                            uint32_t M,
-                            uint32_t N,
-                            uint32_t O,
-                            float *__restrict__ pDstC);
+void plp_mat_vec_i4i8(const int8_t *__restrict__ pSrcA,
+                      const int8_t *__restrict__ pSrcX,
+                      uint32_t M,
+                      uint32_t N,
+                      int32_t *__restrict__ pDstY);
 
 /** -------------------------------------------------------
-  @brief      Matrix matrix multiplication for complex 32-bit floats on XpulpV2
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[out] pDstC Points to the output matrix of shape MxO
+  @brief      Matrix-vector multiplication of 4-bit integer weights and 8-bit integer activations
+              kernel for RV32IM extension
+  @param[in]  pSrcA Points to the 4-bit weights A of shape MxN, packed two per byte
+  @param[in]  pSrcX Points to the activation vector x of length N
+  @param[in]  M     Height of A, number of output channels
+  @param[in]  N     Width of A, length of x
+  @param[out] pDstY Points to the output vector of length M
   @return     none
 */
 
-void plp_mat_mult_cmplx_f32s_xpulpv2(const float *__restrict__ pSrcA,
-                                     const float *__restrict__ pSrcB,
-                                     uint32_t M,
-                                     uint32_t N,
-                                     uint32_t O,
-                                     float *__restrict__ pDstC);
+void plp_mat_vec_i4i8s_rv32im(const int8_t *__restrict__ pSrcA,
+                              const int8_t *__restrict__ pSrcX,
+                              uint32_t M,
+                              uint32_t N,
+                              int32_t *__restrict__ pDstY);
 
 /** -------------------------------------------------------
-  @brief      Glue code of parallel matrix matrix multiplication for complex 32-bit floats
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[in]  nPE   Number of cores to use for computation
-  @param[out] pDstC Points to the output matrix of shape MxO
+  @brief      Matrix-vector multiplication of 4-bit integer weights and 8-bit integer activations
+              kernel for XPULPV2 extension
+  @param[in]  pSrcA Points to the 4-bit weights A of shape MxN, packed two per byte
+  @param[in]  pSrcX Points to the activation vector x of length N
+  @param[in]  M     Height of A, number of output channels
+  @param[in]  N     Width of A, length of x
+  @param[out] pDstY Points to the output vector of length M
   @return     none
-*/
 
-void plp_mat_mult_cmplx_f32_parallel(const float *__restrict__ pSrcA,
-                                     const float *__restrict__ pSrcB,
-                                     uint32_t M,
-                                     uint32_t N,
-                                     uint32_t O,
-                                     uint32_t nPE,
-                                     float *__restrict__ pDstC);
+  @par Exploiting SIMD instructions
+  Eight 4-bit weights are loaded with one word and unpacked with two SIMD instructions: __SLL4 gives
+  the weights of the even columns, __AND4 the weights of the odd columns, both multiplied by 16. The
+  activations are shuffled into their even and odd values and multiplied with __SUMDOTP4 into 32-bit
+  accumulators, which are divided by 16 at the end. Four values of y are computed at once, such that
+  every shuffle of x is used four times.
 
-/** -------------------------------------------------------
-  @brief      parallel matrix matrix multiplication for complex 32-bit floats on XpulpV2
-  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_f32 struct initialized by
-                    plp_mat_mult_cmplx_f32_parallel
-  @return     none
+  @par Overflow
+  The SIMD accumulators hold 16 times the sum, they can only overflow for N of 131072 or more.
 */
 
-void plp_mat_mult_cmplx_f32p_xpulpv2(void *args);
+void plp_mat_vec_i4i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                               const int8_t *__restrict__ pSrcX,
+                               uint32_t M,
+                               uint32_t N,
+                               int32_t *__restrict__ pDstY);
 
 /** -------------------------------------------------------
-  @brief      Glue code of matrix matrix multiplication for complex 32-bit fix-point
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[out] pDstC Points to the output matrix of shape MxO
+  @brief      Glue code for parallel matrix-vector multiplication of 4-bit integer weights and 8-bit
+              integer activations
+  @param[in]  pSrcA Points to the 4-bit weights A of shape MxN, packed two per byte
+  @param[in]  pSrcX Points to the activation vector x of length N
+  @param[in]  M     Height of A, number of output channels
+  @param[in]  N     Width of A, length of x
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstY Points to the output vector of length M
   @return     none
-
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
 */
 
-void plp_mat_mult_cmplx_q32(const int32_t *__restrict__ pSrcA,
-                            const int32_t *__restrict__ pSrcB,
-                            uint32_t M,
-                            uint32_t N,
-                            uint32_t O,
-                            uint32_t shift,
-                            int32_t *__restrict__ pDstC);
+void plp_mat_vec_i4i8_parallel(const int8_t *__restrict__ pSrcA,
+                               const int8_t *__restrict__ pSrcX,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t nPE,
+                               int32_t *__restrict__ pDstY);
 
 /** -------------------------------------------------------
-  @brief      Matrix matrix multiplication for complex 32-bit fix-point on RV32IM
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[out] pDstC Points to the output matrix of shape MxO
+  @brief      Parallel matrix-vector multiplication of 4-bit integer weights and 8-bit integer
+              activations kernel for XPULPV2 extension
+  @param[in]  args  pointer to plp_mat_vec_instance_i4i8 struct initialized by
+                    plp_mat_vec_i4i8_parallel
   @return     none
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
+  @par Exploiting SIMD instructions
+  Eight 4-bit weights are loaded with one word and unpacked with two SIMD instructions: __SLL4 gives
+  the weights of the even columns, __AND4 the weights of the odd columns, both multiplied by 16. The
+  activations are shuffled into their even and odd values and multiplied with __SUMDOTP4 into 32-bit
+  accumulators, which are divided by 16 at the end. Four values of y are computed at once, such that
+  every shuffle of x is used four times.
+
+  @par Overflow
+  The SIMD accumulators hold 16 times the sum, they can only overflow for N of 131072 or more.
+
+  @par Parallelization
+  Every core computes every nPE-th block of 4 rows, and the remaining rows are split
+  over the cores.
 */
 
-void plp_mat_mult_cmplx_q32s_rv32im(const int32_t *__restrict__ pSrcA,
-                                    const int32_t *__restrict__ pSrcB,
-                                    uint32_t M,
-                                    uint32_t N,
-                                    uint32_t O,
-                                    uint32_t shift,
-                                    int32_t *__restrict__ pDstC);
+void plp_mat_vec_i4i8p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-  @brief      Matrix matrix multiplication for complex 32-bit fix-point on XpulpV2
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[out] pDstC Points to the output matrix of shape MxO
+  @brief      Glue code for requantized matrix-vector multiplication of 8-bit integer weights and
+              16-bit integer activations
+  @param[in]  pSrcA Points to the weights A of shape MxN
+  @param[in]  pSrcX Points to the activation vector x of length N
+  @param[in]  M     Height of A, number of output channels
+  @param[in]  N     Width of A, length of x
+  @param[in]  pMult Points to the M multipliers, one per output channel
+  @param[in]  pBias Points to the M biases, added after the multiplication
+  @param[in]  shift Amount to shift the requantized values to the right, at least 1
+  @param[out] pDstY Points to the output vector of length M
   @return     none
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
+  @par Requantization
+  Every output of the output channel m (row m of A) is requantized to 16 bits:
+  `round((sum * pMult[m] + pBias[m]) / 2^shift)`, saturated. `sum * pMult[m] + pBias[m]`
+  must fit into 32 bits.
+*/
+
+void plp_mat_vec_requant_i8i16(const int8_t *__restrict__ pSrcA,
+                               const int16_t *__restrict__ pSrcX,
+                               uint32_t M,
+                               uint32_t N,
+                               const int32_t *__restrict__ pMult,
+                               const int32_t *__restrict__ pBias,
+                               uint32_t shift,
+                               int16_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Requantized matrix-vector multiplication of 8-bit integer weights and 16-bit integer
+              activations kernel for RV32IM extension
+  @param[in]  pSrcA Points to the weights A of shape MxN
+  @param[in]  pSrcX Points to the activation vector x of length N
+  @param[in]  M     Height of A, number of output channels
+  @param[in]  N     Width of A, length of x
+  @param[in]  pMult Points to the M multipliers, one per output channel
+  @param[in]  pBias Points to the M biases, added after the multiplication
+  @param[in]  shift Amount to shift the requantized values to the right, at least 1
+  @param[out] pDstY Points to the output vector of length M
+  @return     none
+
+  @par Requantization
+  Every output of the output channel m (row m of A) is requantized to 16 bits:
+  `round((sum * pMult[m] + pBias[m]) / 2^shift)`, saturated. `sum * pMult[m] + pBias[m]`
+  must fit into 32 bits.
 */
 
-void plp_mat_mult_cmplx_q32s_xpulpv2(const int32_t *__restrict__ pSrcA,
-                                     const int32_t *__restrict__ pSrcB,
-                                     uint32_t M,
-                                     uint32_t N,
-                                     uint32_t O,
-                                     uint32_t shift,
-                                     int32_t *__restrict__ pDstC);
+void plp_mat_vec_requant_i8i16s_rv32im(const int8_t *__restrict__ pSrcA,
+                                       const int16_t *__restrict__ pSrcX,
+                                       uint32_t M,
+                                       uint32_t N,
+                                       const int32_t *__restrict__ pMult,
+                                       const int32_t *__restrict__ pBias,
+                                       uint32_t shift,
+                                       int16_t *__restrict__ pDstY);
 
 /** -------------------------------------------------------
-  @brief      Glue code of parallel matrix matrix multiplication for complex 32-bit fix-point
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @brief      Requantized matrix-vector multiplication of 8-bit integer weights and 16-bit integer
+              activations kernel for XPULPV2 extension
+  @param[in]  pSrcA Points to the weights A of shape MxN
+  @param[in]  pSrcX Points to the activation vector x of length N
+  @param[in]  M     Height of A, number of output channels
+  @param[in]  N     Width of A, length of x
+  @param[in]  pMult Points to the M multipliers, one per output channel
+  @param[in]  pBias Points to the M biases, added after the multiplication
+  @param[in]  shift Amount to shift the requantized values to the right, at least 1
+  @param[out] pDstY Points to the output vector of length M
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 16-bit activations are split with shuffles into their high bytes and their low bytes. Four
+  8-bit weights are then multiplied with one __SUMDOTP4 (high bytes) and one __SUMDOTPUS4 (low
+  bytes, unsigned) into 32-bit accumulators, without widening the weights. Four values of y are
+  computed at once, such that every split of x is used four times.
+
+  @par Requantization
+  Every output of the output channel m (row m of A) is requantized to 16 bits:
+  `round((sum * pMult[m] + pBias[m]) / 2^shift)`, saturated. `sum * pMult[m] + pBias[m]`
+  must fit into 32 bits.
+*/
+
+void plp_mat_vec_requant_i8i16s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                        const int16_t *__restrict__ pSrcX,
+                                        uint32_t M,
+                                        uint32_t N,
+                                        const int32_t *__restrict__ pMult,
+                                        const int32_t *__restrict__ pBias,
+                                        uint32_t shift,
+                                        int16_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel requantized matrix-vector multiplication of 8-bit integer
+              weights and 16-bit integer activations
+  @param[in]  pSrcA Points to the weights A of shape MxN
+  @param[in]  pSrcX Points to the activation vector x of length N
+  @param[in]  M     Height of A, number of output channels
+  @param[in]  N     Width of A, length of x
+  @param[in]  pMult Points to the M multipliers, one per output channel
+  @param[in]  pBias Points to the M biases, added after the multiplication
+  @param[in]  shift Amount to shift the requantized values to the right, at least 1
   @param[in]  nPE   Number of cores to use for computation
-  @param[out] pDstC Points to the output matrix of shape MxO
+  @param[out] pDstY Points to the output vector of length M
   @return     none
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
+  @par Requantization
+  Every output of the output channel m (row m of A) is requantized to 16 bits:
+  `round((sum * pMult[m] + pBias[m]) / 2^shift)`, saturated. `sum * pMult[m] + pBias[m]`
+  must fit into 32 bits.
 */
 
-void plp_mat_mult_cmplx_q32_parallel(const int32_t *__restrict__ pSrcA,
-                                     const int32_t *__restrict__ pSrcB,
-                                     uint32_t M,
-                                     uint32_t N,
-                                     uint32_t O,
-                                     uint32_t shift,
-                                     uint32_t nPE,
-                                     int32_t *__restrict__ pDstC);
+void plp_mat_vec_requant_i8i16_parallel(const int8_t *__restrict__ pSrcA,
+                                        const int16_t *__restrict__ pSrcX,
+                                        uint32_t M,
+                                        uint32_t N,
+                                        const int32_t *__restrict__ pMult,
+                                        const int32_t *__restrict__ pBias,
+                                        uint32_t shift,
+                                        uint32_t nPE,
+                                        int16_t *__restrict__ pDstY);
 
 /** -------------------------------------------------------
-  @brief      parallel matrix matrix multiplication for complex 32-bit fix-point on XpulpV2
-  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_q32 struct initialized by
-                    plp_mat_mult_cmplx_q32_parallel
+  @brief      Parallel requantized matrix-vector multiplication of 8-bit integer weights and 16-bit
+              integer activations kernel for XPULPV2 extension
+  @param[in]  args  pointer to plp_mat_vec_requant_instance_i8i16 struct initialized by
+                    plp_mat_vec_requant_i8i16_parallel
   @return     none
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
+  @par Exploiting SIMD instructions
+  The 16-bit activations are split with shuffles into their high bytes and their low bytes. Four
+  8-bit weights are then multiplied with one __SUMDOTP4 (high bytes) and one __SUMDOTPUS4 (low
+  bytes, unsigned) into 32-bit accumulators, without widening the weights. Four values of y are
+  computed at once, such that every split of x is used four times.
+
+  @par Parallelization
+  Every core computes every nPE-th block of 4 rows, and the remaining rows are split
+  over the cores.
+
+  @par Requantization
+  Every output of the output channel m (row m of A) is requantized to 16 bits:
+  `round((sum * pMult[m] + pBias[m]) / 2^shift)`, saturated. `sum * pMult[m] + pBias[m]`
+  must fit into 32 bits.
 */
 
-void plp_mat_mult_cmplx_q32p_xpulpv2(void *args);
+void plp_mat_vec_requant_i8i16p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-  @brief      Glue code of matrix matrix multiplication for complex 16-bit fix-point
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[out] pDstC Points to the output matrix of shape MxO
+  @brief      Glue code for requantized matrix-vector multiplication of 4-bit integer weights and
+              8-bit integer activations
+  @param[in]  pSrcA Points to the 4-bit weights A of shape MxN, packed two per byte
+  @param[in]  pSrcX Points to the activation vector x of length N
+  @param[in]  M     Height of A, number of output channels
+  @param[in]  N     Width of A, length of x
+  @param[in]  pMult Points to the M multipliers, one per output channel
+  @param[in]  pBias Points to the M biases, added after the multiplication
+  @param[in]  shift Amount to shift the requantized values to the right, at least 1
+  @param[out] pDstY Points to the output vector of length M
   @return     none
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
+  @par Requantization
+  Every output of the output channel m (row m of A) is requantized to 8 bits:
+  `round((sum * pMult[m] + pBias[m]) / 2^shift)`, saturated. `sum * pMult[m] + pBias[m]`
+  must fit into 32 bits.
 */
 
-void plp_mat_mult_cmplx_q16(const int16_t *__restrict__ pSrcA,
-                            const int16_t *__restrict__ pSrcB,
-                            uint32_t M,
-                            uint32_t N,
-                            uint32_t O,
-                            uint32_t shift,
-                            int16_t *__restrict__ pDstC);
+void plp_mat_vec_requant_i4i8(const int8_t *__restrict__ pSrcA,
+                              const int8_t *__restrict__ pSrcX,
+                              uint32_t M,
+                              uint32_t N,
+                              const int32_t *__restrict__ pMult,
+                              const int32_t *__restrict__ pBias,
+                              uint32_t shift,
+                              int8_t *__restrict__ pDstY);
 
 /** -------------------------------------------------------
-  @brief      Matrix matrix multiplication for complex 16-bit fix-point on RV32IM
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[out] pDstC Points to the output matrix of shape MxO
+  @brief      Requantized matrix-vector multiplication of 4-bit integer weights and 8-bit integer
+              activations kernel for RV32IM extension
+  @param[in]  pSrcA Points to the 4-bit weights A of shape MxN, packed two per byte
+  @param[in]  pSrcX Points to the activation vector x of length N
+  @param[in]  M     Height of A, number of output channels
+  @param[in]  N     Width of A, length of x
+  @param[in]  pMult Points to the M multipliers, one per output channel
+  @param[in]  pBias Points to the M biases, added after the multiplication
+  @param[in]  shift Amount to shift the requantized values to the right, at least 1
+  @param[out] pDstY Points to the output vector of length M
   @return     none
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
+  @par Requantization
+  Every output of the output channel m (row m of A) is requantized to 8 bits:
+  `round((sum * pMult[m] + pBias[m]) / 2^shift)`, saturated. `sum * pMult[m] + pBias[m]`
+  must fit into 32 bits.
 */
 
-void plp_mat_mult_cmplx_q16s_rv32im(const int16_t *__restrict__ pSrcA,
-                                    const int16_t *__restrict__ pSrcB,
-                                    uint32_t M,
-                                    uint32_t N,
-                                    uint32_t O,
-                                    uint32_t shift,
-                                    int16_t *__restrict__ pDstC);
+void plp_mat_vec_requant_i4i8s_rv32im(const int8_t *__restrict__ pSrcA,
+                                      const int8_t *__restrict__ pSrcX,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      const int32_t *__restrict__ pMult,
+                                      const int32_t *__restrict__ pBias,
+                                      uint32_t shift,
+                                      int8_t *__restrict__ pDstY);
 
 /** -------------------------------------------------------
-  @brief      Matrix matrix multiplication for complex 16-bit fix-point on XpulpV2
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[out] pDstC Points to the output matrix of shape MxO
+  @brief      Requantized matrix-vector multiplication of 4-bit integer weights and 8-bit integer
+              activations kernel for XPULPV2 extension
+  @param[in]  pSrcA Points to the 4-bit weights A of shape MxN, packed two per byte
+  @param[in]  pSrcX Points to the activation vector x of length N
+  @param[in]  M     Height of A, number of output channels
+  @param[in]  N     Width of A, length of x
+  @param[in]  pMult Points to the M multipliers, one per output channel
+  @param[in]  pBias Points to the M biases, added after the multiplication
+  @param[in]  shift Amount to shift the requantized values to the right, at least 1
+  @param[out] pDstY Points to the output vector of length M
   @return     none
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
-
   @par Exploiting SIMD instructions
-  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
-*/
+  Eight 4-bit weights are loaded with one word and unpacked with two SIMD instructions: __SLL4 gives
+  the weights of the even columns, __AND4 the weights of the odd columns, both multiplied by 16. The
+  activations are shuffled into their even and odd values and multiplied with __SUMDOTP4 into 32-bit
+  accumulators, which are divided by 16 at the end. Four values of y are computed at once, such that
+  every shuffle of x is used four times.
 
-void plp_mat_mult_cmplx_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
-                                     const int16_t *__restrict__ pSrcB,
-                                     uint32_t M,
-                                     uint32_t N,
-                                     uint32_t O,
-                                     uint32_t shift,
-                                     int16_t *__restrict__ pDstC);
+  @par Overflow
+  The SIMD accumulators hold 16 times the sum, they can only overflow for N of 131072 or more.
 
-/** -------------------------------------------------------
-  @brief      Glue code of parallel matrix matrix multiplication for complex 16-bit fix-point
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @par Requantization
+  Every output of the output channel m (row m of A) is requantized to 8 bits:
+  `round((sum * pMult[m] + pBias[m]) / 2^shift)`, saturated. `sum * pMult[m] + pBias[m]`
+  must fit into 32 bits.
+*/
+
+void plp_mat_vec_requant_i4i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                       const int8_t *__restrict__ pSrcX,
+                                       uint32_t M,
+                                       uint32_t N,
+                                       const int32_t *__restrict__ pMult,
+                                       const int32_t *__restrict__ pBias,
+                                       uint32_t shift,
+                                       int8_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel requantized matrix-vector multiplication of 4-bit integer
+              weights and 8-bit integer activations
+  @param[in]  pSrcA Points to the 4-bit weights A of shape MxN, packed two per byte
+  @param[in]  pSrcX Points to the activation vector x of length N
+  @param[in]  M     Height of A, number of output channels
+  @param[in]  N     Width of A, length of x
+  @param[in]  pMult Points to the M multipliers, one per output channel
+  @param[in]  pBias Points to the M biases, added after the multiplication
+  @param[in]  shift Amount to shift the requantized values to the right, at least 1
   @param[in]  nPE   Number of cores to use for computation
-  @param[out] pDstC Points to the output matrix of shape MxO
+  @param[out] pDstY Points to the output vector of length M
   @return     none
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
+  @par Requantization
+  Every output of the output channel m (row m of A) is requantized to 8 bits:
+  `round((sum * pMult[m] + pBias[m]) / 2^shift)`, saturated. `sum * pMult[m] + pBias[m]`
+  must fit into 32 bits.
 */
 
-void plp_mat_mult_cmplx_q16_parallel(const int16_t *__restrict__ pSrcA,
-                                     const int16_t *__restrict__ pSrcB,
-                                     uint32_t M,
-                                     uint32_t N,
-                                     uint32_t O,
-                                     uint32_t shift,
-                                     uint32_t nPE,
-                                     int16_t *__restrict__ pDstC);
+void plp_mat_vec_requant_i4i8_parallel(const int8_t *__restrict__ pSrcA,
+                                       const int8_t *__restrict__ pSrcX,
+                                       uint32_t M,
+                                       uint32_t N,
+                                       const int32_t *__restrict__ pMult,
+                                       const int32_t *__restrict__ pBias,
+                                       uint32_t shift,
+                                       uint32_t nPE,
+                                       int8_t *__restrict__ pDstY);
 
 /** -------------------------------------------------------
-  @brief      parallel matrix matrix multiplication for complex 16-bit fix-point on XpulpV2
-  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_q16 struct initialized by
-                    plp_mat_mult_cmplx_q16_parallel
+  @brief      Parallel requantized matrix-vector multiplication of 4-bit integer weights and 8-bit
+              integer activations kernel for XPULPV2 extension
+  @param[in]  args  pointer to plp_mat_vec_requant_instance_i4i8 struct initialized by
+                    plp_mat_vec_requant_i4i8_parallel
   @return     none
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
-
   @par Exploiting SIMD instructions
-  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+  Eight 4-bit weights are loaded with one word and unpacked with two SIMD instructions: __SLL4 gives
+  the weights of the even columns, __AND4 the weights of the odd columns, both multiplied by 16. The
+  activations are shuffled into their even and odd values and multiplied with __SUMDOTP4 into 32-bit
+  accumulators, which are divided by 16 at the end. Four values of y are computed at once, such that
+  every shuffle of x is used four times.
+
+  @par Overflow
+  The SIMD accumulators hold 16 times the sum, they can only overflow for N of 131072 or more.
+
+  @par Parallelization
+  Every core computes every nPE-th block of 4 rows, and the remaining rows are split
+  over the cores.
+
+  @par Requantization
+  Every output of the output channel m (row m of A) is requantized to 8 bits:
+  `round((sum * pMult[m] + pBias[m]) / 2^shift)`, saturated. `sum * pMult[m] + pBias[m]`
+  must fit into 32 bits.
 */
 
-void plp_mat_mult_cmplx_q16p_xpulpv2(void *args);
+void plp_mat_vec_requant_i4i8p_xpulpv2(void *args);
 
-/** -------------------------------------------------------
-  @brief      Glue code of matrix matrix multiplication for complex 8-bit fix-point
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[out] pDstC Points to the output matrix of shape MxO
+/**
+ * @brief      calculates the complex magnitude.
+ *
+ * @param[in]  pSrc        The source
+ * @param[in]  deciPoint   The decimal point. Fromat: Q(16-deciPoint).deciPoint
+ * @param      pRes        The result
+ * @param[in]  numSamples  The number of samples
+ */
+void plp_cmplx_mag_q16(const int16_t *pSrc,
+                       const uint32_t deciPoint,
+                       int16_t *pRes,
+                       uint32_t numSamples);
+
+/**
+  @brief      In-place 16 bit reversal function for RV32IM
+  @param[in,out] pSrc        points to in-place buffer of unknown 16-bit data type
+  @param[in]  bitRevLen   bit reversal table length
+  @param[in]  pBitRevTab  points to bit reversal table
+  @return     none
+*/
+
+void plp_bitreversal_16s_rv32im(uint16_t *pSrc,
+                                const uint16_t bitRevLen,
+                                const uint16_t *pBitRevTab);
+
+/**
+  @brief      In-place 16 bit reversal function for XPULPV2
+  @param[in,out] pSrc        points to in-place buffer of unknown 16-bit data type
+  @param[in]  bitRevLen   bit reversal table length
+  @param[in]  pBitRevTab  points to bit reversal table
   @return     none
+*/
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
+void plp_bitreversal_16v_xpulpv2(uint16_t *pSrc,
+                                 const uint16_t bitRevLen,
+                                 const uint16_t *pBitRevTab);
+
+/**
+  @brief      In-place 16 bit reversal function for XPULPV2 (parallel version). Must be called
+              by all cores of the team.
+  @param[in]  args  points to the plp_bitreversal_parallel_arg
+  @return     none
+*/
+
+void plp_bitreversal_16p_xpulpv2(void *args);
+
+/**
+  @brief      In-place 32 bit reversal function for RV32IM
+  @param[in,out] pSrc        points to in-place buffer of unknown 32-bit data type
+  @param[in]  bitRevLen   bit reversal table length
+  @param[in]  pBitRevTab  points to bit reversal table
+  @return     none
 */
 
-void plp_mat_mult_cmplx_q8(const int8_t *__restrict__ pSrcA,
-                           const int8_t *__restrict__ pSrcB,
-                           uint32_t M,
-                           uint32_t N,
-                           uint32_t O,
-                           uint32_t shift,
-                           int8_t *__restrict__ pDstC);
+void plp_bitreversal_32s_rv32im(uint32_t *pSrc,
+                                const uint16_t bitRevLen,
+                                const uint16_t *pBitRevTab);
 
-/** -------------------------------------------------------
-  @brief      Matrix matrix multiplication for complex 8-bit fix-point on RV32IM
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[out] pDstC Points to the output matrix of shape MxO
+/**
+  @brief      In-place 32 bit reversal function for XPULPV2
+  @param[in,out] pSrc        points to in-place buffer of unknown 32-bit data type
+  @param[in]  bitRevLen   bit reversal table length
+  @param[in]  pBitRevTab  points to bit reversal table
   @return     none
-
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
 */
 
-void plp_mat_mult_cmplx_q8s_rv32im(const int8_t *__restrict__ pSrcA,
-                                   const int8_t *__restrict__ pSrcB,
-                                   uint32_t M,
-                                   uint32_t N,
-                                   uint32_t O,
-                                   uint32_t shift,
-                                   int8_t *__restrict__ pDstC);
+void plp_bitreversal_32s_xpulpv2(uint32_t *pSrc,
+                                 const uint16_t bitRevLen,
+                                 const uint16_t *pBitRevTab);
 
-/** -------------------------------------------------------
-  @brief      Matrix matrix multiplication for complex 8-bit fix-point on XpulpV2
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[out] pDstC Points to the output matrix of shape MxO
+/**
+  @brief      In-place 32 bit reversal function for XPULPV2 (parallel version). Must be called
+              by all cores of the team.
+  @param[in]  args  points to the plp_bitreversal_parallel_arg
   @return     none
+*/
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
+void plp_bitreversal_32p_xpulpv2(void *args);
 
-  @par Exploiting SIMD instructions
-  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+/**
+  @brief      In-place 16 bit reversal function without table for RV32IM
+  @param[in,out] pSrc        points to in-place buffer of fftLen complex 16-bit values
+  @param[in]  fftLen      length of the FFT, a power of 2
+  @return     none
 */
 
-void plp_mat_mult_cmplx_q8s_xpulpv2(const int8_t *__restrict__ pSrcA,
-                                    const int8_t *__restrict__ pSrcB,
-                                    uint32_t M,
-                                    uint32_t N,
-                                    uint32_t O,
-                                    uint32_t shift,
-                                    int8_t *__restrict__ pDstC);
+void plp_bitreversal_nolut_16s_rv32im(uint16_t *pSrc, uint32_t fftLen);
 
-/** -------------------------------------------------------
-  @brief      Glue code of parallel matrix matrix multiplication for complex 8-bit fix-point
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[in]  nPE   Number of cores to use for computation
-  @param[out] pDstC Points to the output matrix of shape MxO
+/**
+  @brief      In-place 16 bit reversal function without table for XPULPV2
+  @param[in,out] pSrc        points to in-place buffer of fftLen complex 16-bit values
+  @param[in]  fftLen      length of the FFT, a power of 2
   @return     none
+*/
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
+void plp_bitreversal_nolut_16v_xpulpv2(uint16_t *pSrc, uint32_t fftLen);
+
+/**
+  @brief      In-place 16 bit reversal function without table for XPULPV2 (parallel version).
+              Must be called by all cores of the team.
+  @param[in]  args  points to the plp_bitreversal_nolut_parallel_arg
+  @return     none
 */
 
-void plp_mat_mult_cmplx_q8_parallel(const int8_t *__restrict__ pSrcA,
-                                    const int8_t *__restrict__ pSrcB,
-                                    uint32_t M,
-                                    uint32_t N,
-                                    uint32_t O,
-                                    uint32_t shift,
-                                    uint32_t nPE,
-                                    int8_t *__restrict__ pDstC);
+void plp_bitreversal_nolut_16p_xpulpv2(void *args);
 
-/** -------------------------------------------------------
-  @brief      parallel matrix matrix multiplication for complex 8-bit fix-point on XpulpV2
-  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_q8 struct initialized by
-                    plp_mat_mult_cmplx_q8_parallel
+/**
+  @brief      In-place 32 bit reversal function without table for RV32IM
+  @param[in,out] pSrc        points to in-place buffer of fftLen complex 32-bit values
+  @param[in]  fftLen      length of the FFT, a power of 2
   @return     none
+*/
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
+void plp_bitreversal_nolut_32s_rv32im(uint32_t *pSrc, uint32_t fftLen);
 
-  @par Exploiting SIMD instructions
-  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+/**
+  @brief      In-place 32 bit reversal function without table for XPULPV2
+  @param[in,out] pSrc        points to in-place buffer of fftLen complex 32-bit values
+  @param[in]  fftLen      length of the FFT, a power of 2
+  @return     none
 */
 
-void plp_mat_mult_cmplx_q8p_xpulpv2(void *args);
+void plp_bitreversal_nolut_32s_xpulpv2(uint32_t *pSrc, uint32_t fftLen);
 
-/** -------------------------------------------------------
-   @brief      Glue code for matrix transposed matrix multiplication of a 32-bit integer
-               matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[out] pDstC Output is written here
-   @return     none
+/**
+  @brief      In-place 32 bit reversal function without table for XPULPV2 (parallel version).
+              Must be called by all cores of the team.
+  @param[in]  args  points to the plp_bitreversal_nolut_parallel_arg
+  @return     none
 */
 
-void plp_mat_mult_trans_i32(const int32_t *__restrict__ pSrcA,
-                            const int32_t *__restrict__ pSrcB,
-                            uint32_t M,
-                            uint32_t N,
-                            uint32_t O,
-                            int32_t *__restrict__ pDstC);
+void plp_bitreversal_nolut_32p_xpulpv2(void *args);
+
+/**
+ * @brief      Glue code for quantized 16 bit complex fast fourier transform
+ *
+ * Fixed point units input -> output dependent on length:
+ * len=16:    Q1.15 -> Q5.11
+ * len=32:    Q1.15 -> Q6.10
+ * len=64:    Q1.15 -> Q7.9
+ * len=128:   Q1.15 -> Q8.8
+ * len=256:   Q1.15 -> Q9.7
+ * len=512:   Q1.15 -> Q10.6
+ * len=1024:  Q1.15 -> Q11.5
+ * len=2048:  Q1.15 -> Q12.4
+ * len=4096:  Q1.15 -> Q13.3
+ *
+ * @param[in]  S               points to an instance of the 16bit quantized CFFT structure
+ * @param[in,out] p1              points to the complex data buffer of size <code>2*fftLen</code>.
+ * Processing occurs in-place.
+ * @param[in]  ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ * transform.
+ * @param[in]  bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @param[in]  deciPoint       decimal point for right shift
+ */
+
+void plp_cfft_q16(const plp_cfft_instance_q16 *S,
+                  int16_t *p1,
+                  uint8_t ifftFlag,
+                  uint8_t bitReverseFlag,
+                  uint32_t deciPoint);
+
+/**
+ * @brief      Quantized 16 bit complex fast fourier transform for RV32IM
+ * @param[in]  S               points to an instance of the 16bit quantized CFFT structure
+ * @param[in,out] p1              points to the complex data buffer of size <code>2*fftLen</code>.
+ * Processing occurs in-place.
+ * @param[in]  ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ * transform.
+ * @param[in]  bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @param[in]  deciPoint       decimal point for right shift
+ */
+
+void plp_cfft_q16s_rv32im(const plp_cfft_instance_q16 *S,
+                          int16_t *p1,
+                          uint8_t ifftFlag,
+                          uint8_t bitReverseFlag,
+                          uint32_t deciPoint);
+
+/**
+ * @brief      Quantized 16 bit complex fast fourier transform for XPULPV2
+ * @param[in]  S               points to an instance of the 16bit quantized CFFT structure
+ * @param[in,out] p1              points to the complex data buffer of size <code>2*fftLen</code>.
+ * Processing occurs in-place.
+ * @param[in]  ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ * transform.
+ * @param[in]  bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @param[in]  deciPoint       decimal point for right shift
+ */
+
+void plp_cfft_q16s_xpulpv2(const plp_cfft_instance_q16 *S,
+                           int16_t *p1,
+                           uint8_t ifftFlag,
+                           uint8_t bitReverseFlag,
+                           uint32_t deciPoint);
+
+/**
+ * @brief      Glue code for parallel quantized 16 bit complex fast fourier transform. The output
+ * format is the same as for plp_cfft_q16.
+ * @param[in]  S               points to an instance of the 16bit quantized CFFT structure
+ * @param[in]  nPE             number of parallel processing units
+ * @param[in,out] p1              points to the complex data buffer of size <code>2*fftLen</code>.
+ * Processing occurs in-place.
+ * @param[in]  ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ * transform.
+ * @param[in]  bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @param[in]  deciPoint       decimal point for right shift
+ */
+
+void plp_cfft_q16_parallel(const plp_cfft_instance_q16 *S,
+                           uint32_t nPE,
+                           int16_t *p1,
+                           uint8_t ifftFlag,
+                           uint8_t bitReverseFlag,
+                           uint32_t deciPoint);
+
+/**
+ * @brief      Parallel quantized 16 bit complex fast fourier transform for XPULPV2
+ * @param[in]  args  points to the plp_cfft_parallel_arg_q16 structure
+ */
+
+void plp_cfft_q16p_xpulpv2(void *args);
+
+/**
+ * @brief      Glue code for quantized 32 bit complex fast fourier transform
+ *
+ * Fixed point units input -> output dependent on length:
+ * len=16:    Q1.31 -> Q5.27
+ * len=32:    Q1.31 -> Q6.26
+ * len=64:    Q1.31 -> Q7.25
+ * len=128:   Q1.31 -> Q8.24
+ * len=256:   Q1.31 -> Q9.23
+ * len=512:   Q1.31 -> Q10.22
+ * len=1024:  Q1.31 -> Q11.21
+ * len=2048:  Q1.31 -> Q12.20
+ * len=4096:  Q1.31 -> Q13.19
+ *
+ * @param[in]  S               points to an instance of the 32bit quantized CFFT structure
+ * @param[in,out] p1              points to the complex data buffer of size <code>2*fftLen</code>.
+ * Processing occurs in-place.
+ * @param[in]  ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ * transform.
+ * @param[in]  bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @param[in]  deciPoint       decimal point for right shift
+ */
+
+void plp_cfft_q32(const plp_cfft_instance_q32 *S,
+                  int32_t *p1,
+                  uint8_t ifftFlag,
+                  uint8_t bitReverseFlag,
+                  uint32_t deciPoint);
+
+/**
+ * @brief      Glue code for parallel quantized 32 bit complex fast fourier transform
+ * @param[in]  S               points to an instance of the 32bit quantized CFFT structure
+ * @param[in]  nPE             number of parallel processing units
+ * @param[in,out] p1              points to the complex data buffer of size <code>2*fftLen</code>.
+ * Processing occurs in-place.
+ * @param[in]  ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ * transform.
+ * @param[in]  bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @param[in]  deciPoint       decimal point for right shift
+ */
+
+void plp_cfft_q32_parallel(const plp_cfft_instance_q32 *S,
+                           uint32_t nPE,
+                           int32_t *p1,
+                           uint8_t ifftFlag,
+                           uint8_t bitReverseFlag,
+                           uint32_t deciPoint);
+
+/**
+ * @brief      Quantized 32 bit complex fast fourier transform for RV32IM
+ * @param[in]  S               points to an instance of the 32bit quantized CFFT structure
+ * @param[in,out] p1              points to the complex data buffer of size <code>2*fftLen</code>.
+ * Processing occurs in-place.
+ * @param[in]  ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ * transform.
+ * @param[in]  bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @param[in]  deciPoint       decimal point for right shift
+ */
+
+void plp_cfft_q32s_rv32im(const plp_cfft_instance_q32 *S,
+                          int32_t *p1,
+                          uint8_t ifftFlag,
+                          uint8_t bitReverseFlag,
+                          uint32_t deciPoint);
 
-/** -------------------------------------------------------
-   @brief      Matrix transposed matrix multiplication of a 32-bit integer matrices for RV32IM
-               extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[out] pDstC Output is written here
-   @return     none
-*/
+/**
+ * @brief      Parallel quantized 32 bit complex fast fourier transform for XPULPV2
+ * @param[in]  args  points to the plp_cfft_parallel_arg_q32 structure
+ */
 
-void plp_mat_mult_trans_i32s_rv32im(const int32_t *__restrict__ pSrcA,
-                                    const int32_t *__restrict__ pSrcB,
-                                    uint32_t M,
-                                    uint32_t N,
-                                    uint32_t O,
-                                    int32_t *__restrict__ pDstC);
+void plp_cfft_q32p_xpulpv2(void *args);
 
-/** -------------------------------------------------------
-   @brief      Matrix transposed matrix multiplication of a 32-bit integer matrices for XPULPV2
-               extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[out] pDstC Output is written here
-   @return     none
-*/
+/**
+ * @brief      Glue code for quantized 16 bit real fast fourier transform
+ *
+ * The real input of length N is computed as a complex FFT of length N/2 followed by a split
+ * stage. The output contains the full spectrum of N complex values, scaled by 1/N like the
+ * output of plp_cfft_q16, i.e. Q1.15 -> Q(1+log2(N)).(15-log2(N)). Supported lengths are 32 to
+ * 4096.
+ *
+ * @param[in]  S           points to an instance of the 16bit quantized RFFT structure
+ * @param[in]  pSrc        points to the input buffer (real data) of size <code>fftLenReal</code>
+ * @param[in]  deciPoint   decimal point for right shift
+ * @param[out] pDst        points to the output buffer (complex data) of size
+ *                         <code>2*fftLenReal</code>
+ */
 
-void plp_mat_mult_trans_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
-                                     const int32_t *__restrict__ pSrcB,
-                                     uint32_t M,
-                                     uint32_t N,
-                                     uint32_t O,
-                                     int32_t *__restrict__ pDstC);
+void plp_rfft_q16(const plp_rfft_instance_q16 *S,
+                  const int16_t *__restrict__ pSrc,
+                  uint32_t deciPoint,
+                  int16_t *__restrict__ pDst);
 
-/** -------------------------------------------------------
-   @brief      Glue code for matrix transposed matrix multiplication of a 16-bit integer
-               matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[out] pDstC Output is written here
-   @return     none
-*/
+/**
+ * @brief      Glue code for parallel quantized 16 bit real fast fourier transform
+ * @param[in]  S           points to an instance of the 16bit quantized RFFT structure
+ * @param[in]  pSrc        points to the input buffer (real data) of size <code>fftLenReal</code>
+ * @param[in]  deciPoint   decimal point for right shift
+ * @param[in]  nPE         number of parallel processing units
+ * @param[out] pDst        points to the output buffer (complex data) of size
+ *                         <code>2*fftLenReal</code>
+ */
 
-void plp_mat_mult_trans_i16(const int16_t *__restrict__ pSrcA,
-                            const int16_t *__restrict__ pSrcB,
-                            uint32_t M,
-                            uint32_t N,
-                            uint32_t O,
-                            int32_t *__restrict__ pDstC);
+void plp_rfft_q16_parallel(const plp_rfft_instance_q16 *S,
+                           const int16_t *__restrict__ pSrc,
+                           uint32_t deciPoint,
+                           uint32_t nPE,
+                           int16_t *__restrict__ pDst);
 
-/** -------------------------------------------------------
-   @brief      Matrix transposed matrix multiplication of a 16-bit integer matrices for RV32IM
-               extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[out] pDstC Output is written here
-   @return     none
-*/
+/**
+ * @brief      Quantized 16 bit real fast fourier transform for RV32IM
+ * @param[in]  S           points to an instance of the 16bit quantized RFFT structure
+ * @param[in]  pSrc        points to the input buffer (real data)
+ * @param[in]  deciPoint   decimal point for right shift
+ * @param[out] pDst        points to the output buffer (complex data)
+ */
 
-void plp_mat_mult_trans_i16s_rv32im(const int16_t *__restrict__ pSrcA,
-                                    const int16_t *__restrict__ pSrcB,
-                                    uint32_t M,
-                                    uint32_t N,
-                                    uint32_t O,
-                                    int32_t *__restrict__ pDstC);
+void plp_rfft_q16s_rv32im(const plp_rfft_instance_q16 *S,
+                          const int16_t *__restrict__ pSrc,
+                          uint32_t deciPoint,
+                          int16_t *__restrict__ pDst);
 
-/** -------------------------------------------------------
-   @brief      Matrix transposed matrix multiplication of a 16-bit integer matrices for XPULPV2
-               extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[out] pDstC Output is written here
-   @return     none
+/**
+ * @brief      Quantized 16 bit real fast fourier transform for XPULPV2
+ * @param[in]  S           points to an instance of the 16bit quantized RFFT structure
+ * @param[in]  pSrc        points to the input buffer (real data)
+ * @param[in]  deciPoint   decimal point for right shift
+ * @param[out] pDst        points to the output buffer (complex data)
+ */
 
-   @par Exploiting SIMD instructions
-   The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
-   performed on 32 bit vectors, with 32 bit accumulator.
-*/
+void plp_rfft_q16s_xpulpv2(const plp_rfft_instance_q16 *S,
+                           const int16_t *__restrict__ pSrc,
+                           uint32_t deciPoint,
+                           int16_t *__restrict__ pDst);
 
-void plp_mat_mult_trans_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
-                                     const int16_t *__restrict__ pSrcB,
-                                     uint32_t M,
-                                     uint32_t N,
-                                     uint32_t O,
-                                     int32_t *__restrict__ pDstC);
+/**
+ * @brief      Parallel quantized 16 bit real fast fourier transform for XPULPV2
+ * @param[in]  args  points to the plp_rfft_parallel_arg_q16 structure
+ */
 
-/** -------------------------------------------------------
-   @brief      Glue code for matrix transposed matrix multiplication of a 8-bit integer matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[out] pDstC Output is written here
-   @return     none
-*/
+void plp_rfft_q16p_xpulpv2(void *args);
 
-void plp_mat_mult_trans_i8(const int8_t *__restrict__ pSrcA,
-                           const int8_t *__restrict__ pSrcB,
-                           uint32_t M,
-                           uint32_t N,
-                           uint32_t O,
-                           int32_t *__restrict__ pDstC);
+/**
+ * @brief      Glue code for quantized 32 bit real fast fourier transform
+ *
+ * The real input of length N is computed as a complex FFT of length N/2 followed by a split
+ * stage. The output contains the full spectrum of N complex values, scaled by 1/N like the
+ * output of plp_cfft_q32, i.e. Q1.31 -> Q(1+log2(N)).(31-log2(N)). Supported lengths are 32 to
+ * 4096.
+ *
+ * @param[in]  S           points to an instance of the 32bit quantized RFFT structure
+ * @param[in]  pSrc        points to the input buffer (real data) of size <code>fftLenReal</code>
+ * @param[in]  deciPoint   decimal point for right shift
+ * @param[out] pDst        points to the output buffer (complex data) of size
+ *                         <code>2*fftLenReal</code>
+ */
 
-/** -------------------------------------------------------
-   @brief      Matrix transposed matrix multiplication of a 8-bit integer matrices for RV32IM
-   extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[out] pDstC Output is written here
-   @return     none
-*/
+void plp_rfft_q32(const plp_rfft_instance_q32 *S,
+                  const int32_t *__restrict__ pSrc,
+                  uint32_t deciPoint,
+                  int32_t *__restrict__ pDst);
 
-void plp_mat_mult_trans_i8s_rv32im(const int8_t *__restrict__ pSrcA,
-                                   const int8_t *__restrict__ pSrcB,
-                                   uint32_t M,
-                                   uint32_t N,
-                                   uint32_t O,
-                                   int32_t *__restrict__ pDstC);
+/**
+ * @brief      Glue code for parallel quantized 32 bit real fast fourier transform
+ * @param[in]  S           points to an instance of the 32bit quantized RFFT structure
+ * @param[in]  pSrc        points to the input buffer (real data) of size <code>fftLenReal</code>
+ * @param[in]  deciPoint   decimal point for right shift
+ * @param[in]  nPE         number of parallel processing units
+ * @param[out] pDst        points to the output buffer (complex data) of size
+ *                         <code>2*fftLenReal</code>
+ */
 
-/** -------------------------------------------------------
-   @brief      Matrix transposed matrix multiplication of a 8-bit integer matrices for XPULPV2
-   extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[out] pDstC Output is written here
-   @return     none
+void plp_rfft_q32_parallel(const plp_rfft_instance_q32 *S,
+                           const int32_t *__restrict__ pSrc,
+                           uint32_t deciPoint,
+                           uint32_t nPE,
+                           int32_t *__restrict__ pDst);
 
-   @par Exploiting SIMD instructions
-   The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
-   performed on 32 bit vectors, with 32 bit accumulator.
-*/
+/**
+ * @brief      Quantized 32 bit real fast fourier transform for RV32IM
+ * @param[in]  S           points to an instance of the 32bit quantized RFFT structure
+ * @param[in]  pSrc        points to the input buffer (real data)
+ * @param[in]  deciPoint   decimal point for right shift
+ * @param[out] pDst        points to the output buffer (complex data)
+ */
 
-void plp_mat_mult_trans_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
-                                    const int8_t *__restrict__ pSrcB,
-                                    uint32_t M,
-                                    uint32_t N,
-                                    uint32_t O,
-                                    int32_t *__restrict__ pDstC);
+void plp_rfft_q32s_rv32im(const plp_rfft_instance_q32 *S,
+                          const int32_t *__restrict__ pSrc,
+                          uint32_t deciPoint,
+                          int32_t *__restrict__ pDst);
 
-/** -------------------------------------------------------
-   @brief      Glue code for parallel matrix matrix multiplication of a 32-bit integer matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  nPE   Number of cores to use
-   @param[out] pDstC Output is written here
-   @return     none
-*/
+/**
+ * @brief      Quantized 32 bit real fast fourier transform for XPULPV2
+ * @param[in]  S           points to an instance of the 32bit quantized RFFT structure
+ * @param[in]  pSrc        points to the input buffer (real data)
+ * @param[in]  deciPoint   decimal point for right shift
+ * @param[out] pDst        points to the output buffer (complex data)
+ */
 
-void plp_mat_mult_trans_i32_parallel(const int32_t *__restrict__ pSrcA,
-                                     const int32_t *__restrict__ pSrcB,
-                                     uint32_t M,
-                                     uint32_t N,
-                                     uint32_t O,
-                                     uint32_t nPE,
-                                     int32_t *__restrict__ pDstC);
+void plp_rfft_q32s_xpulpv2(const plp_rfft_instance_q32 *S,
+                           const int32_t *__restrict__ pSrc,
+                           uint32_t deciPoint,
+                           int32_t *__restrict__ pDst);
 
-/** -------------------------------------------------------
-   @brief      Parallel matrix transposed matrix multiplication of a 32-bit integer matrices for
-               RV32IM extension.
-   @param[in]  args  pointer to plp_mat_mult_instance_i32 struct initialized by
-                     plp_mat_mult_i32_parallel
-   @return     none
-*/
+/**
+ * @brief      Parallel quantized 32 bit real fast fourier transform for XPULPV2
+ * @param[in]  args  points to the plp_rfft_parallel_arg_q32 structure
+ */
 
-void plp_mat_mult_trans_i32p_xpulpv2(void *args);
+void plp_rfft_q32p_xpulpv2(void *args);
 
-/** -------------------------------------------------------
-   @brief      Glue code for parallel matrix transposed matrix multiplication of a 16-bit integer
-               matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  nPE   Number of cores to use
-   @param[out] pDstC Output is written here
-   @return     none
-*/
+/**
+ * @brief      Initialization of the floating-point mixed-radix complex fast fourier transform.
+ * Computes the plan (factorization of fftLen) and the twiddle factors.
+ * @param[out] S           points to the instance of the floating-point mixed-radix CFFT structure
+ * @param[in]  fftLen      length of the FFT, must be a product of the factors 2, 3, 4 and 5
+ * @param[out] pTwiddle    points to the twiddle buffer of size <code>2*fftLen</code>
+ * @return     0: Success, 1: Unsupported length
+ */
 
-void plp_mat_mult_trans_i16_parallel(const int16_t *__restrict__ pSrcA,
-                                     const int16_t *__restrict__ pSrcB,
-                                     uint32_t M,
-                                     uint32_t N,
-                                     uint32_t O,
-                                     uint32_t nPE,
-                                     int32_t *__restrict__ pDstC);
+int plp_cfft_mixed_init_f32(plp_cfft_mixed_instance_f32 *S, uint16_t fftLen, float32_t *pTwiddle);
 
-/** -------------------------------------------------------
-   @brief      Parallel matrix transposed matrix multiplication of a 16-bit integer matrices for
-               XPULPV2 extension.
-   @param[in]  args  pointer to plp_mat_mult_instance_i16 struct initialized by
-                     plp_mat_mult_i16_parallel
-   @return     none
+/**
+ * @brief      Initialization of the 16 bit fixed-point mixed-radix complex fast fourier
+ * transform. Computes the plan (factorization of fftLen) and the Q1.15 twiddle factors.
+ * @param[out] S           points to the instance of the 16bit mixed-radix CFFT structure
+ * @param[in]  fftLen      length of the FFT, must be a product of the factors 2, 3, 4 and 5
+ * @param[out] pTwiddle    points to the twiddle buffer of size <code>2*fftLen</code>
+ * @return     0: Success, 1: Unsupported length
+ */
 
-   @par Exploiting SIMD instructions
-   The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
-   performed on 32 bit vectors, with 32 bit accumulator.
-*/
+int plp_cfft_mixed_init_q16(plp_cfft_mixed_instance_q16 *S, uint16_t fftLen, int16_t *pTwiddle);
 
-void plp_mat_mult_trans_i16p_xpulpv2(void *args);
+/**
+ * @brief      Glue code for the floating-point mixed-radix complex fast fourier transform
+ * @param[in]  S       points to an instance of the floating-point mixed-radix CFFT structure
+ * @param[in]  pSrc    points to the input buffer (complex data) of size <code>2*fftLen</code>
+ * @param[out] pDst    points to the output buffer (complex data) of size <code>2*fftLen</code>
+ */
 
-/** -------------------------------------------------------
-   @brief      Glue code for parallel matrix transposed matrix multiplication of a 8-bit integer
-               matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  nPE   Number of cores to use
-   @param[out] pDstC Output is written here
-   @return     none
-*/
+void plp_cfft_mixed_f32(const plp_cfft_mixed_instance_f32 *S,
+                        const float32_t *__restrict__ pSrc,
+                        float32_t *__restrict__ pDst);
 
-void plp_mat_mult_trans_i8_parallel(const int8_t *__restrict__ pSrcA,
-                                    const int8_t *__restrict__ pSrcB,
-                                    uint32_t M,
-                                    uint32_t N,
-                                    uint32_t O,
-                                    uint32_t nPE,
-                                    int32_t *__restrict__ pDstC);
+/**
+ * @brief      Glue code for the parallel floating-point mixed-radix complex fast fourier transform
+ * @param[in]  S       points to an instance of the floating-point mixed-radix CFFT structure
+ * @param[in]  pSrc    points to the input buffer (complex data) of size <code>2*fftLen</code>
+ * @param[in]  nPE     number of parallel processing units
+ * @param[out] pDst    points to the output buffer (complex data) of size <code>2*fftLen</code>
+ */
 
-/** -------------------------------------------------------
-   @brief      Parallel matrix transposed matrix multiplication of a 8-bit integer matrices for
-               XPULPV2 extension.
-   @param[in]  args  pointer to plp_mat_mult_instance_i8 struct initialized by
-                     plp_mat_mult_i8_parallel
-   @return     none
+void plp_cfft_mixed_f32_parallel(const plp_cfft_mixed_instance_f32 *S,
+                                 const float32_t *__restrict__ pSrc,
+                                 const uint32_t nPE,
+                                 float32_t *__restrict__ pDst);
 
-   @par Exploiting SIMD instructions
-   The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
-   performed on 32 bit vectors, with 32 bit accumulator.
-*/
+/**
+ * @brief      Floating-point mixed-radix complex fast fourier transform for XPULPV2
+ * @param[in]  S       points to an instance of the floating-point mixed-radix CFFT structure
+ * @param[in]  pSrc    points to the input buffer (complex data)
+ * @param[out] pDst    points to the output buffer (complex data)
+ */
 
-void plp_mat_mult_trans_i8p_xpulpv2(void *args);
+void plp_cfft_mixed_f32s_xpulpv2(const plp_cfft_mixed_instance_f32 *S,
+                                 const float32_t *__restrict__ pSrc,
+                                 float32_t *__restrict__ pDst);
 
-/** -------------------------------------------------------
-   @brief      Glue code for matrix transposed matrix multiplication of a 32-bit fix-point
-               matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[out] pDstC Output is written here
-   @return     none
+/**
+ * @brief      Parallel floating-point mixed-radix complex fast fourier transform for XPULPV2
+ * @param[in]  args  points to the plp_cfft_mixed_parallel_arg_f32 structure
+ */
 
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+void plp_cfft_mixed_f32p_xpulpv2(void *args);
+
+/**
+ * @brief      Glue code for the 16 bit fixed-point mixed-radix complex fast fourier transform
+ *
+ * Every stage scales by 1/radix, the output is scaled by 1/N like the output of plp_cfft_q16.
+ *
+ * @param[in]  S           points to an instance of the 16bit mixed-radix CFFT structure
+ * @param[in]  pSrc        points to the input buffer (complex data) of size <code>2*fftLen</code>
+ * @param[in]  deciPoint   decimal point for right shift
+ * @param[out] pDst        points to the output buffer (complex data) of size
+ *                         <code>2*fftLen</code>
  */
 
-void plp_mat_mult_trans_q32(const int32_t *__restrict__ pSrcA,
-                            const int32_t *__restrict__ pSrcB,
-                            uint32_t M,
-                            uint32_t N,
-                            uint32_t O,
-                            uint32_t shift,
-                            int32_t *__restrict__ pDstC);
+void plp_cfft_mixed_q16(const plp_cfft_mixed_instance_q16 *S,
+                        const int16_t *__restrict__ pSrc,
+                        uint32_t deciPoint,
+                        int16_t *__restrict__ pDst);
 
-/** -------------------------------------------------------
-   @brief      Glue code for parallel matrix transposed matrix multiplication of a 32-bit
-               fix-point matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[in]  nPE   Number of cores to use
-   @param[out] pDstC Output is written here
-   @return     none
+/**
+ * @brief      Glue code for the parallel 16 bit fixed-point mixed-radix complex fast fourier
+ * transform
+ * @param[in]  S           points to an instance of the 16bit mixed-radix CFFT structure
+ * @param[in]  pSrc        points to the input buffer (complex data) of size <code>2*fftLen</code>
+ * @param[in]  deciPoint   decimal point for right shift
+ * @param[in]  nPE         number of parallel processing units
+ * @param[out] pDst        points to the output buffer (complex data) of size
+ *                         <code>2*fftLen</code>
+ */
 
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+void plp_cfft_mixed_q16_parallel(const plp_cfft_mixed_instance_q16 *S,
+                                 const int16_t *__restrict__ pSrc,
+                                 uint32_t deciPoint,
+                                 uint32_t nPE,
+                                 int16_t *__restrict__ pDst);
+
+/**
+ * @brief      16 bit fixed-point mixed-radix complex fast fourier transform for RV32IM
+ * @param[in]  S           points to an instance of the 16bit mixed-radix CFFT structure
+ * @param[in]  pSrc        points to the input buffer (complex data)
+ * @param[in]  deciPoint   decimal point for right shift
+ * @param[out] pDst        points to the output buffer (complex data)
  */
 
-void plp_mat_mult_trans_q32_parallel(const int32_t *__restrict__ pSrcA,
-                                     const int32_t *__restrict__ pSrcB,
-                                     uint32_t M,
-                                     uint32_t N,
-                                     uint32_t O,
-                                     uint32_t shift,
-                                     uint32_t nPE,
-                                     int32_t *__restrict__ pDstC);
+void plp_cfft_mixed_q16s_rv32im(const plp_cfft_mixed_instance_q16 *S,
+                                const int16_t *__restrict__ pSrc,
+                                uint32_t deciPoint,
+                                int16_t *__restrict__ pDst);
 
-/** -------------------------------------------------------
-   @brief      matrix transposed matrix multiplication of a 32-bit fix-point matrices for RV32IM
-               extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[out] pDstC Output is written here
-   @return     none
+/**
+ * @brief      16 bit fixed-point mixed-radix complex fast fourier transform for XPULPV2
+ * @param[in]  S           points to an instance of the 16bit mixed-radix CFFT structure
+ * @param[in]  pSrc        points to the input buffer (complex data)
+ * @param[in]  deciPoint   decimal point for right shift
+ * @param[out] pDst        points to the output buffer (complex data)
+ */
 
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
-*/
+void plp_cfft_mixed_q16s_xpulpv2(const plp_cfft_mixed_instance_q16 *S,
+                                 const int16_t *__restrict__ pSrc,
+                                 uint32_t deciPoint,
+                                 int16_t *__restrict__ pDst);
 
-void plp_mat_mult_trans_q32s_rv32im(const int32_t *__restrict__ pSrcA,
-                                    const int32_t *__restrict__ pSrcB,
-                                    uint32_t M,
-                                    uint32_t N,
-                                    uint32_t O,
-                                    uint32_t shift,
-                                    int32_t *__restrict__ pDstC);
+/**
+ * @brief      Parallel 16 bit fixed-point mixed-radix complex fast fourier transform for XPULPV2
+ * @param[in]  args  points to the plp_cfft_mixed_parallel_arg_q16 structure
+ */
 
-/** -------------------------------------------------------
-   @brief      matrix transposed matrix multiplication of a 32-bit fix-point matrices for XPULPV2
-               extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[out] pDstC Output is written here
-   @return     none
+void plp_cfft_mixed_q16p_xpulpv2(void *args);
 
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
-*/
+/**
+ * @brief      Glue code for the floating-point DCT-II
+ * @param[in]  S           points to an instance of the floating-point DCT-II structure
+ * @param[in]  pSrc        points to the input buffer of N values
+ * @param[in]  pBuf        points to a temporary buffer of N values
+ * @param[out] pDst        points to the output buffer of N values
+ */
 
-void plp_mat_mult_trans_q32s_xpulpv2(const int32_t *__restrict__ pSrcA,
-                                     const int32_t *__restrict__ pSrcB,
-                                     uint32_t M,
-                                     uint32_t N,
-                                     uint32_t O,
-                                     uint32_t shift,
-                                     int32_t *__restrict__ pDstC);
+void plp_dct2_f32(const plp_dct2_instance_f32 *S,
+                  const float32_t *__restrict__ pSrc,
+                  float32_t *__restrict__ pBuf,
+                  float32_t *__restrict__ pDst);
 
-/** -------------------------------------------------------
-    @brief      Parallel matrix transposed matrix multiplication of 32-bit fix-point matrices kernel
-                for XPULPV2 extension.
-    @param[in]  args  pointer to plp_mat_mult_instance_q32 struct initialized by
-                      plp_mat_mult_trans_q32_parallel
-    @return     none
-*/
+/**
+ * @brief      Glue code for the parallel floating-point DCT-II
+ * @param[in]  S           points to an instance of the floating-point DCT-II structure
+ * @param[in]  pSrc        points to the input buffer of N values
+ * @param[in]  nPE         number of parallel processing units
+ * @param[in]  pBuf        points to a temporary buffer of N values
+ * @param[out] pDst        points to the output buffer of N values
+ */
 
-void plp_mat_mult_trans_q32p_xpulpv2(void *args);
+void plp_dct2_f32_parallel(const plp_dct2_instance_f32 *S,
+                           const float32_t *__restrict__ pSrc,
+                           uint32_t nPE,
+                           float32_t *__restrict__ pBuf,
+                           float32_t *__restrict__ pDst);
 
-/** -------------------------------------------------------
-   @brief      Glue code for matrix transposed matrix multiplication of a 16-bit fix-point
-               matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[out] pDstC Output is written here
-   @return     none
+/**
+ * @brief      Floating-point DCT-II for XPULPV2
+ * @param[in]  S           points to an instance of the floating-point DCT-II structure
+ * @param[in]  pSrc        points to the input buffer of N values
+ * @param[in]  pBuf        points to a temporary buffer of N values
+ * @param[out] pDst        points to the output buffer of N values
+ */
 
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+void plp_dct2_f32s_xpulpv2(const plp_dct2_instance_f32 *S,
+                           const float32_t *__restrict__ pSrc,
+                           float32_t *__restrict__ pBuf,
+                           float32_t *__restrict__ pDst);
 
-   The output of the matrix multiplication will also be stored as an 16-bit array.
-   Set the `shift` parameter such that no overflow ocurrs.
+/**
+ * @brief      Parallel floating-point DCT-II for XPULPV2
+ * @param[in]  args  points to the plp_dct2_parallel_arg_f32 structure
  */
 
-void plp_mat_mult_trans_q16(const int16_t *__restrict__ pSrcA,
-                            const int16_t *__restrict__ pSrcB,
-                            uint32_t M,
-                            uint32_t N,
-                            uint32_t O,
-                            uint32_t shift,
-                            int16_t *__restrict__ pDstC);
+void plp_dct2_f32p_xpulpv2(void *args);
 
-/** -------------------------------------------------------
-   @brief      Glue code for parallel matrix transposed matrix multiplication of a 16-bit
-               fix-point matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[in]  nPE   Number of cores to use
-   @param[out] pDstC Output is written here
-   @return     none
+/**
+ * @brief      Glue code for the 16 bit fixed-point DCT-II.
+ *             The output is scaled by 1/N.
+ * @param[in]  S           points to an instance of the 16 bit fixed-point DCT-II structure
+ * @param[in]  pSrc        points to the input buffer of N values
+ * @param[in]  deciPoint   decimal point for right shift
+ * @param[in]  pBuf        points to a temporary buffer of N values
+ * @param[out] pDst        points to the output buffer of N values
+ */
 
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+void plp_dct2_q16(const plp_dct2_instance_q16 *S,
+                  const int16_t *__restrict__ pSrc,
+                  uint32_t deciPoint,
+                  int16_t *__restrict__ pBuf,
+                  int16_t *__restrict__ pDst);
 
-   The output of the matrix multiplication will also be stored as an 16-bit array.
-   Set the `shift` parameter such that no overflow ocurrs.
+/**
+ * @brief      Glue code for the parallel 16 bit fixed-point DCT-II.
+ *             The output is scaled by 1/N.
+ * @param[in]  S           points to an instance of the 16 bit fixed-point DCT-II structure
+ * @param[in]  pSrc        points to the input buffer of N values
+ * @param[in]  deciPoint   decimal point for right shift
+ * @param[in]  nPE         number of parallel processing units
+ * @param[in]  pBuf        points to a temporary buffer of N values
+ * @param[out] pDst        points to the output buffer of N values
  */
 
-void plp_mat_mult_trans_q16_parallel(const int16_t *__restrict__ pSrcA,
-                                     const int16_t *__restrict__ pSrcB,
-                                     uint32_t M,
-                                     uint32_t N,
-                                     uint32_t O,
-                                     uint32_t shift,
-                                     uint32_t nPE,
-                                     int16_t *__restrict__ pDstC);
+void plp_dct2_q16_parallel(const plp_dct2_instance_q16 *S,
+                           const int16_t *__restrict__ pSrc,
+                           uint32_t deciPoint,
+                           uint32_t nPE,
+                           int16_t *__restrict__ pBuf,
+                           int16_t *__restrict__ pDst);
 
-/** -------------------------------------------------------
-   @brief      matrix transposed matrix multiplication of a 16-bit fix-point matrices for RV32IM
-               extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[out] pDstC Output is written here
-   @return     none
+/**
+ * @brief      16 bit fixed-point DCT-II for RV32IM
+ * @param[in]  S           points to an instance of the 16 bit fixed-point DCT-II structure
+ * @param[in]  pSrc        points to the input buffer of N values
+ * @param[in]  deciPoint   decimal point for right shift
+ * @param[in]  pBuf        points to a temporary buffer of N values
+ * @param[out] pDst        points to the output buffer of N values
+ */
 
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+void plp_dct2_q16s_rv32im(const plp_dct2_instance_q16 *S,
+                          const int16_t *__restrict__ pSrc,
+                          uint32_t deciPoint,
+                          int16_t *__restrict__ pBuf,
+                          int16_t *__restrict__ pDst);
 
-   The output of the matrix multiplication will also be stored as an 16-bit array.
-   Set the `shift` parameter such that no overflow ocurrs.
-*/
+/**
+ * @brief      16 bit fixed-point DCT-II for XPULPV2
+ * @param[in]  S           points to an instance of the 16 bit fixed-point DCT-II structure
+ * @param[in]  pSrc        points to the input buffer of N values
+ * @param[in]  deciPoint   decimal point for right shift
+ * @param[in]  pBuf        points to a temporary buffer of N values
+ * @param[out] pDst        points to the output buffer of N values
+ */
 
-void plp_mat_mult_trans_q16s_rv32im(const int16_t *__restrict__ pSrcA,
-                                    const int16_t *__restrict__ pSrcB,
-                                    uint32_t M,
-                                    uint32_t N,
-                                    uint32_t O,
-                                    uint32_t shift,
-                                    int16_t *__restrict__ pDstC);
+void plp_dct2_q16s_xpulpv2(const plp_dct2_instance_q16 *S,
+                           const int16_t *__restrict__ pSrc,
+                           uint32_t deciPoint,
+                           int16_t *__restrict__ pBuf,
+                           int16_t *__restrict__ pDst);
 
-/** -------------------------------------------------------
-   @brief      matrix transposed matrix multiplication of a 16-bit fix-point matrices for XPULPV2
-               extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[out] pDstC Output is written here
-   @return     none
+/**
+ * @brief      Parallel 16 bit fixed-point DCT-II for XPULPV2
+ * @param[in]  args  points to the plp_dct2_parallel_arg_q16 structure
+ */
+
+void plp_dct2_q16p_xpulpv2(void *args);
 
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+/**
+ * @brief      Glue code for the floating-point DCT-IV
+ * @param[in]  S           points to an instance of the floating-point DCT-IV structure
+ * @param[in]  pSrc        points to the input buffer of N values
+ * @param[in]  pBuf        points to a temporary buffer of N values
+ * @param[out] pDst        points to the output buffer of N values
+ */
 
-   The output of the matrix multiplication will also be stored as an 16-bit array.
-   Set the `shift` parameter such that no overflow ocurrs.
-*/
+void plp_dct4_f32(const plp_dct4_instance_f32 *S,
+                  const float32_t *__restrict__ pSrc,
+                  float32_t *__restrict__ pBuf,
+                  float32_t *__restrict__ pDst);
 
-void plp_mat_mult_trans_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
-                                     const int16_t *__restrict__ pSrcB,
-                                     uint32_t M,
-                                     uint32_t N,
-                                     uint32_t O,
-                                     uint32_t shift,
-                                     int16_t *__restrict__ pDstC);
+/**
+ * @brief      Glue code for the parallel floating-point DCT-IV
+ * @param[in]  S           points to an instance of the floating-point DCT-IV structure
+ * @param[in]  pSrc        points to the input buffer of N values
+ * @param[in]  nPE         number of parallel processing units
+ * @param[in]  pBuf        points to a temporary buffer of N values
+ * @param[out] pDst        points to the output buffer of N values
+ */
 
-/** -------------------------------------------------------
-    @brief      Parallel matrix transposed matrix multiplication of 16-bit fix-point matrices kernel
-                for XPULPV2 extension.
-    @param[in]  args  pointer to plp_mat_mult_instance_q16 struct initialized by
-                      plp_mat_mult_trans_q16_parallel
-    @return     none
-*/
+void plp_dct4_f32_parallel(const plp_dct4_instance_f32 *S,
+                           const float32_t *__restrict__ pSrc,
+                           uint32_t nPE,
+                           float32_t *__restrict__ pBuf,
+                           float32_t *__restrict__ pDst);
 
-void plp_mat_mult_trans_q16p_xpulpv2(void *args);
+/**
+ * @brief      Floating-point DCT-IV for XPULPV2
+ * @param[in]  S           points to an instance of the floating-point DCT-IV structure
+ * @param[in]  pSrc        points to the input buffer of N values
+ * @param[in]  pBuf        points to a temporary buffer of N values
+ * @param[out] pDst        points to the output buffer of N values
+ */
 
-/** -------------------------------------------------------
-   @brief      Glue code for matrix transposed matrix multiplication of a 8-bit fix-point
-               matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[out] pDstC Output is written here
-   @return     none
+void plp_dct4_f32s_xpulpv2(const plp_dct4_instance_f32 *S,
+                           const float32_t *__restrict__ pSrc,
+                           float32_t *__restrict__ pBuf,
+                           float32_t *__restrict__ pDst);
 
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+/**
+ * @brief      Parallel floating-point DCT-IV for XPULPV2
+ * @param[in]  args  points to the plp_dct4_parallel_arg_f32 structure
+ */
 
-   The output of the matrix multiplication will also be stored as an 8-bit array.
-   Set the `shift` parameter such that no overflow ocurrs.
+void plp_dct4_f32p_xpulpv2(void *args);
+
+/**
+ * @brief      Glue code for the 16 bit fixed-point DCT-IV.
+ *             The output is scaled by 1/N.
+ * @param[in]  S           points to an instance of the 16 bit fixed-point DCT-IV structure
+ * @param[in]  pSrc        points to the input buffer of N values
+ * @param[in]  deciPoint   decimal point for right shift
+ * @param[in]  pBuf        points to a temporary buffer of N values
+ * @param[out] pDst        points to the output buffer of N values
  */
 
-void plp_mat_mult_trans_q8(const int8_t *__restrict__ pSrcA,
-                           const int8_t *__restrict__ pSrcB,
-                           uint32_t M,
-                           uint32_t N,
-                           uint32_t O,
-                           uint32_t shift,
-                           int8_t *__restrict__ pDstC);
+void plp_dct4_q16(const plp_dct4_instance_q16 *S,
+                  const int16_t *__restrict__ pSrc,
+                  uint32_t deciPoint,
+                  int16_t *__restrict__ pBuf,
+                  int16_t *__restrict__ pDst);
 
-/** -------------------------------------------------------
-   @brief      Glue code for parallel matrix transposed matrix multiplication of a 8-bit
-               fix-point matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[in]  nPE   Number of cores to use
-   @param[out] pDstC Output is written here
-   @return     none
+/**
+ * @brief      Glue code for the parallel 16 bit fixed-point DCT-IV.
+ *             The output is scaled by 1/N.
+ * @param[in]  S           points to an instance of the 16 bit fixed-point DCT-IV structure
+ * @param[in]  pSrc        points to the input buffer of N values
+ * @param[in]  deciPoint   decimal point for right shift
+ * @param[in]  nPE         number of parallel processing units
+ * @param[in]  pBuf        points to a temporary buffer of N values
+ * @param[out] pDst        points to the output buffer of N values
+ */
 
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+void plp_dct4_q16_parallel(const plp_dct4_instance_q16 *S,
+                           const int16_t *__restrict__ pSrc,
+                           uint32_t deciPoint,
+                           uint32_t nPE,
+                           int16_t *__restrict__ pBuf,
+                           int16_t *__restrict__ pDst);
 
-   The output of the matrix multiplication will also be stored as an 8-bit array.
-   Set the `shift` parameter such that no overflow ocurrs.
+/**
+ * @brief      16 bit fixed-point DCT-IV for RV32IM
+ * @param[in]  S           points to an instance of the 16 bit fixed-point DCT-IV structure
+ * @param[in]  pSrc        points to the input buffer of N values
+ * @param[in]  deciPoint   decimal point for right shift
+ * @param[in]  pBuf        points to a temporary buffer of N values
+ * @param[out] pDst        points to the output buffer of N values
  */
 
-void plp_mat_mult_trans_q8_parallel(const int8_t *__restrict__ pSrcA,
-                                    const int8_t *__restrict__ pSrcB,
-                                    uint32_t M,
-                                    uint32_t N,
-                                    uint32_t O,
-                                    uint32_t shift,
-                                    uint32_t nPE,
-                                    int8_t *__restrict__ pDstC);
+void plp_dct4_q16s_rv32im(const plp_dct4_instance_q16 *S,
+                          const int16_t *__restrict__ pSrc,
+                          uint32_t deciPoint,
+                          int16_t *__restrict__ pBuf,
+                          int16_t *__restrict__ pDst);
 
-/** -------------------------------------------------------
-   @brief      matrix transposed matrix multiplication of a 8-bit fix-point matrices for RV32IM
-               extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[out] pDstC Output is written here
-   @return     none
+/**
+ * @brief      16 bit fixed-point DCT-IV for XPULPV2
+ * @param[in]  S           points to an instance of the 16 bit fixed-point DCT-IV structure
+ * @param[in]  pSrc        points to the input buffer of N values
+ * @param[in]  deciPoint   decimal point for right shift
+ * @param[in]  pBuf        points to a temporary buffer of N values
+ * @param[out] pDst        points to the output buffer of N values
+ */
 
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+void plp_dct4_q16s_xpulpv2(const plp_dct4_instance_q16 *S,
+                           const int16_t *__restrict__ pSrc,
+                           uint32_t deciPoint,
+                           int16_t *__restrict__ pBuf,
+                           int16_t *__restrict__ pDst);
 
-   The output of the matrix multiplication will also be stored as an 8-bit array.
-   Set the `shift` parameter such that no overflow ocurrs.
-*/
+/**
+ * @brief      Parallel 16 bit fixed-point DCT-IV for XPULPV2
+ * @param[in]  args  points to the plp_dct4_parallel_arg_q16 structure
+ */
 
-void plp_mat_mult_trans_q8s_rv32im(const int8_t *__restrict__ pSrcA,
-                                   const int8_t *__restrict__ pSrcB,
-                                   uint32_t M,
-                                   uint32_t N,
-                                   uint32_t O,
-                                   uint32_t shift,
-                                   int8_t *__restrict__ pDstC);
+void plp_dct4_q16p_xpulpv2(void *args);
 
-/** -------------------------------------------------------
-   @brief      matrix transposed matrix multiplication of a 8-bit fix-point matrices for XPULPV2
-               extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[out] pDstC Output is written here
-   @return     none
+/**
+ * @brief      Glue code for the floating-point MDCT
+ * @param[in]  S           points to an instance of the floating-point MDCT structure
+ * @param[in]  pSrc        points to the input buffer of 2N values
+ * @param[in]  pBuf        points to a temporary buffer of N values
+ * @param[out] pDst        points to the output buffer of N values
+ */
 
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+void plp_mdct_f32(const plp_mdct_instance_f32 *S,
+                  const float32_t *__restrict__ pSrc,
+                  float32_t *__restrict__ pBuf,
+                  float32_t *__restrict__ pDst);
 
-   The output of the matrix multiplication will also be stored as an 8-bit array.
-   Set the `shift` parameter such that no overflow ocurrs.
-*/
+/**
+ * @brief      Glue code for the parallel floating-point MDCT
+ * @param[in]  S           points to an instance of the floating-point MDCT structure
+ * @param[in]  pSrc        points to the input buffer of 2N values
+ * @param[in]  nPE         number of parallel processing units
+ * @param[in]  pBuf        points to a temporary buffer of N values
+ * @param[out] pDst        points to the output buffer of N values
+ */
 
-void plp_mat_mult_trans_q8s_xpulpv2(const int8_t *__restrict__ pSrcA,
-                                    const int8_t *__restrict__ pSrcB,
-                                    uint32_t M,
-                                    uint32_t N,
-                                    uint32_t O,
-                                    uint32_t shift,
-                                    int8_t *__restrict__ pDstC);
+void plp_mdct_f32_parallel(const plp_mdct_instance_f32 *S,
+                           const float32_t *__restrict__ pSrc,
+                           uint32_t nPE,
+                           float32_t *__restrict__ pBuf,
+                           float32_t *__restrict__ pDst);
 
-/** -------------------------------------------------------
-    @brief      Parallel matrix transposed matrix multiplication of 8-bit fix-point matrices kernel
-                for XPULPV2 extension.
-    @param[in]  args  pointer to plp_mat_mult_instance_q8 struct initialized by
-                      plp_mat_mult_trans_q8_parallel
-    @return     none
-*/
+/**
+ * @brief      Floating-point MDCT for XPULPV2
+ * @param[in]  S           points to an instance of the floating-point MDCT structure
+ * @param[in]  pSrc        points to the input buffer of 2N values
+ * @param[in]  pBuf        points to a temporary buffer of N values
+ * @param[out] pDst        points to the output buffer of N values
+ */
 
-void plp_mat_mult_trans_q8p_xpulpv2(void *args);
+void plp_mdct_f32s_xpulpv2(const plp_mdct_instance_f32 *S,
+                           const float32_t *__restrict__ pSrc,
+                           float32_t *__restrict__ pBuf,
+                           float32_t *__restrict__ pDst);
 
-/** -------------------------------------------------------
-   @brief      Glue code for matrix transposed matrix multiplication of a 32-bit floating-point
-               matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[out] pDstC Output is written here
-   @return     none
-*/
+/**
+ * @brief      Parallel floating-point MDCT for XPULPV2
+ * @param[in]  args  points to the plp_mdct_parallel_arg_f32 structure
+ */
 
-void plp_mat_mult_trans_f32(const float *__restrict__ pSrcA,
-                            const float *__restrict__ pSrcB,
-                            uint32_t M,
-                            uint32_t N,
-                            uint32_t O,
-                            float *__restrict__ pDstC);
+void plp_mdct_f32p_xpulpv2(void *args);
 
-/** -------------------------------------------------------
-   @brief      matrix transposed matrix multiplication of a 32-bit floating-point matrices for
-               XPULPV2 extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[out] pDstC Output is written here
-   @return     none
-*/
+/**
+ * @brief      Glue code for the 16 bit fixed-point MDCT.
+ *             The output is scaled by 1/(2N).
+ * @param[in]  S           points to an instance of the 16 bit fixed-point MDCT structure
+ * @param[in]  pSrc        points to the input buffer of 2N values
+ * @param[in]  deciPoint   decimal point for right shift
+ * @param[in]  pBuf        points to a temporary buffer of N values
+ * @param[out] pDst        points to the output buffer of N values
+ */
 
-void plp_mat_mult_trans_f32s_xpulpv2(const float *__restrict__ pSrcA,
-                                     const float *__restrict__ pSrcB,
-                                     uint32_t M,
-                                     uint32_t N,
-                                     uint32_t O,
-                                     float *__restrict__ pDstC);
+void plp_mdct_q16(const plp_mdct_instance_q16 *S,
+                  const int16_t *__restrict__ pSrc,
+                  uint32_t deciPoint,
+                  int16_t *__restrict__ pBuf,
+                  int16_t *__restrict__ pDst);
 
-/** -------------------------------------------------------
-   @brief      Glue code for parallel matrix transposed matrix multiplication of a 32-bit
-               floating-point matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  nPE   Number of cores to use
-   @param[out] pDstC Output is written here
-   @return     none
-*/
+/**
+ * @brief      Glue code for the parallel 16 bit fixed-point MDCT.
+ *             The output is scaled by 1/(2N).
+ * @param[in]  S           points to an instance of the 16 bit fixed-point MDCT structure
+ * @param[in]  pSrc        points to the input buffer of 2N values
+ * @param[in]  deciPoint   decimal point for right shift
+ * @param[in]  nPE         number of parallel processing units
+ * @param[in]  pBuf        points to a temporary buffer of N values
+ * @param[out] pDst        points to the output buffer of N values
+ */
 
-void plp_mat_mult_trans_f32_parallel(const float *__restrict__ pSrcA,
-                                     const float *__restrict__ pSrcB,
-                                     uint32_t M,
-                                     uint32_t N,
-                                     uint32_t O,
-                                     uint32_t nPE,
-                                     float *__restrict__ pDstC);
+void plp_mdct_q16_parallel(const plp_mdct_instance_q16 *S,
+                           const int16_t *__restrict__ pSrc,
+                           uint32_t deciPoint,
+                           uint32_t nPE,
+                           int16_t *__restrict__ pBuf,
+                           int16_t *__restrict__ pDst);
 
-/** -------------------------------------------------------
-    @brief      Parallel matrix transposed matrix multiplication of 32-bit floating-point matrices
-                kernel for XPULPV2 extension.
-    @param[in]  args  pointer to plp_mat_mult_instance_f32 struct initialized by
-                      plp_mat_mult_trans_f32_parallel
-    @return     none
-*/
+/**
+ * @brief      16 bit fixed-point MDCT for RV32IM
+ * @param[in]  S           points to an instance of the 16 bit fixed-point MDCT structure
+ * @param[in]  pSrc        points to the input buffer of 2N values
+ * @param[in]  deciPoint   decimal point for right shift
+ * @param[in]  pBuf        points to a temporary buffer of N values
+ * @param[out] pDst        points to the output buffer of N values
+ */
 
-void plp_mat_mult_trans_f32p_xpulpv2(void *args);
+void plp_mdct_q16s_rv32im(const plp_mdct_instance_q16 *S,
+                          const int16_t *__restrict__ pSrc,
+                          uint32_t deciPoint,
+                          int16_t *__restrict__ pBuf,
+                          int16_t *__restrict__ pDst);
 
-/** -------------------------------------------------------
-  @brief      Glue code of matrix transpose matrix multiplication for complex 32-bit integers
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
-*/
+/**
+ * @brief      16 bit fixed-point MDCT for XPULPV2
+ * @param[in]  S           points to an instance of the 16 bit fixed-point MDCT structure
+ * @param[in]  pSrc        points to the input buffer of 2N values
+ * @param[in]  deciPoint   decimal point for right shift
+ * @param[in]  pBuf        points to a temporary buffer of N values
+ * @param[out] pDst        points to the output buffer of N values
+ */
+
+void plp_mdct_q16s_xpulpv2(const plp_mdct_instance_q16 *S,
+                           const int16_t *__restrict__ pSrc,
+                           uint32_t deciPoint,
+                           int16_t *__restrict__ pBuf,
+                           int16_t *__restrict__ pDst);
+
+/**
+ * @brief      Parallel 16 bit fixed-point MDCT for XPULPV2
+ * @param[in]  args  points to the plp_mdct_parallel_arg_q16 structure
+ */
+
+void plp_mdct_q16p_xpulpv2(void *args);
 
-void plp_mat_mult_trans_cmplx_i32(const int32_t *__restrict__ pSrcA,
-                                  const int32_t *__restrict__ pSrcB,
-                                  uint32_t M,
-                                  uint32_t N,
-                                  uint32_t O,
-                                  int32_t *__restrict__ pDstC);
+/**
+ * @brief      Initialization of the floating-point STFT. Clears the ring buffer.
+ * @param[out] S           points to the instance of the floating-point STFT structure
+ * @param[in]  pRfft       points to the instance of the real FFT of frame length N, N >= 8
+ * @param[in]  pWindow     points to the analysis window of N values
+ * @param[in]  hopLen      number of new samples per frame, 0 < hopLen <= N
+ * @param[in]  pState      points to the ring buffer of <code>2*(N-hopLen)</code> values
+ * @return     0: Success, 1: Unsupported frame or hop length
+ */
 
-/** -------------------------------------------------------
-  @brief      matrix transpose matrix multiplication for complex 32-bit integers on RV32IM
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
-*/
+int plp_stft_init_f32(plp_stft_instance_f32 *S,
+                      const plp_rfft_instance_f32 *pRfft,
+                      const float32_t *pWindow,
+                      uint16_t hopLen,
+                      float32_t *pState);
 
-void plp_mat_mult_trans_cmplx_i32s_rv32im(const int32_t *__restrict__ pSrcA,
-                                          const int32_t *__restrict__ pSrcB,
-                                          uint32_t M,
-                                          uint32_t N,
-                                          uint32_t O,
-                                          int32_t *__restrict__ pDstC);
+/**
+ * @brief      Initialization of the 16 bit fixed-point STFT. Clears the ring buffer.
+ * @param[out] S           points to the instance of the 16 bit fixed-point STFT structure
+ * @param[in]  pRfft       points to the instance of the 16 bit real FFT of frame length N
+ * @param[in]  pWindow     points to the Q1.15 analysis window of N values
+ * @param[in]  hopLen      number of new samples per frame, 0 < hopLen <= N
+ * @param[in]  pState      points to the ring buffer of <code>2*(N-hopLen)</code> values
+ * @return     0: Success, 1: Unsupported hop length
+ */
 
-/** -------------------------------------------------------
-  @brief      matrix transpose matrix multiplication for complex 32-bit integers on XpulpV2
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
-*/
+int plp_stft_init_q16(plp_stft_instance_q16 *S,
+                      const plp_rfft_instance_q16 *pRfft,
+                      const int16_t *pWindow,
+                      uint16_t hopLen,
+                      int16_t *pState);
 
-void plp_mat_mult_trans_cmplx_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
-                                           const int32_t *__restrict__ pSrcB,
-                                           uint32_t M,
-                                           uint32_t N,
-                                           uint32_t O,
-                                           int32_t *__restrict__ pDstC);
+/**
+ * @brief      Glue code for the floating-point STFT. Consumes numFrames*hopLen samples and
+ *             writes the power spectrum |X[k]|^2, k = 0 .. N/2, of each frame.
+ * @param[in,out] S        points to an instance of the floating-point STFT structure
+ * @param[in]  pSrc        points to the input buffer of numFrames*hopLen values
+ * @param[in]  numFrames   number of frames
+ * @param[in]  pBuf        points to a temporary buffer of N values
+ * @param[out] pDst        points to the output buffer of numFrames*(N/2+1) values
+ */
 
-/** -------------------------------------------------------
-  @brief      Glue code of parallel matrix transpose matrix multiplication for complex 32-bit
-              integers
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[in]  nPE   Number of cores to use for computation
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
-*/
+void plp_stft_f32(plp_stft_instance_f32 *S,
+                  const float32_t *__restrict__ pSrc,
+                  uint32_t numFrames,
+                  float32_t *__restrict__ pBuf,
+                  float32_t *__restrict__ pDst);
 
-void plp_mat_mult_trans_cmplx_i32_parallel(const int32_t *__restrict__ pSrcA,
-                                           const int32_t *__restrict__ pSrcB,
-                                           uint32_t M,
-                                           uint32_t N,
-                                           uint32_t O,
-                                           uint32_t nPE,
-                                           int32_t *__restrict__ pDstC);
+/**
+ * @brief      Glue code for the parallel floating-point STFT
+ * @param[in,out] S        points to an instance of the floating-point STFT structure
+ * @param[in]  pSrc        points to the input buffer of numFrames*hopLen values
+ * @param[in]  numFrames   number of frames
+ * @param[in]  nPE         number of parallel processing units
+ * @param[in]  pBuf        points to a temporary buffer of nPE*N values
+ * @param[out] pDst        points to the output buffer of numFrames*(N/2+1) values
+ */
 
-/** -------------------------------------------------------
-  @brief      parallel matrix transpose matrix multiplication for complex 32-bit integers on XpulpV2
-  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_i32 struct initialized by
-                    plp_mat_mult_trans_cmplx_i32_parallel
-  @return     none
-*/
+void plp_stft_f32_parallel(plp_stft_instance_f32 *S,
+                           const float32_t *__restrict__ pSrc,
+                           uint32_t numFrames,
+                           uint32_t nPE,
+                           float32_t *__restrict__ pBuf,
+                           float32_t *__restrict__ pDst);
 
-void plp_mat_mult_trans_cmplx_i32p_xpulpv2(void *args);
+/**
+ * @brief      Floating-point STFT for XPULPV2
+ * @param[in,out] S        points to an instance of the floating-point STFT structure
+ * @param[in]  pSrc        points to the input buffer of numFrames*hopLen values
+ * @param[in]  numFrames   number of frames
+ * @param[in]  pBuf        points to a temporary buffer of N values
+ * @param[out] pDst        points to the output buffer of numFrames*(N/2+1) values
+ */
 
-/** -------------------------------------------------------
-  @brief      Glue code of matrix transpose matrix multiplication for complex 16-bit integers
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
-*/
+void plp_stft_f32s_xpulpv2(plp_stft_instance_f32 *S,
+                           const float32_t *__restrict__ pSrc,
+                           uint32_t numFrames,
+                           float32_t *__restrict__ pBuf,
+                           float32_t *__restrict__ pDst);
 
-void plp_mat_mult_trans_cmplx_i16(const int16_t *__restrict__ pSrcA,
-                                  const int16_t *__restrict__ pSrcB,
-                                  uint32_t M,
-                                  uint32_t N,
-                                  uint32_t O,
-                                  int32_t *__restrict__ pDstC);
+/**
+ * @brief      Parallel floating-point STFT for XPULPV2
+ * @param[in]  args  points to the plp_stft_parallel_arg_f32 structure
+ */
 
-/** -------------------------------------------------------
-  @brief      matrix transpose matrix multiplication for complex 16-bit integers on RV32IM
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
-*/
+void plp_stft_f32p_xpulpv2(void *args);
 
-void plp_mat_mult_trans_cmplx_i16s_rv32im(const int16_t *__restrict__ pSrcA,
-                                          const int16_t *__restrict__ pSrcB,
-                                          uint32_t M,
-                                          uint32_t N,
-                                          uint32_t O,
-                                          int32_t *__restrict__ pDstC);
+/**
+ * @brief      Glue code for the 16 bit fixed-point STFT. Consumes numFrames*hopLen samples and
+ *             writes the power spectrum of each frame in Q2.30, computed from the spectrum
+ *             X[k]/N of the 16 bit real FFT.
+ * @param[in,out] S        points to an instance of the 16 bit fixed-point STFT structure
+ * @param[in]  pSrc        points to the input buffer of numFrames*hopLen values
+ * @param[in]  numFrames   number of frames
+ * @param[in]  deciPoint   decimal point for right shift
+ * @param[in]  pBuf        points to a temporary buffer of N values
+ * @param[out] pDst        points to the output buffer of numFrames*(N/2+1) values
+ */
 
-/** -------------------------------------------------------
-  @brief      matrix transpose matrix multiplication for complex 16-bit integers on XpulpV2
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+void plp_stft_q16(plp_stft_instance_q16 *S,
+                  const int16_t *__restrict__ pSrc,
+                  uint32_t numFrames,
+                  uint32_t deciPoint,
+                  int16_t *__restrict__ pBuf,
+                  int32_t *__restrict__ pDst);
 
-  @par Exploiting SIMD instructions
-  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
-*/
+/**
+ * @brief      Glue code for the parallel 16 bit fixed-point STFT
+ * @param[in,out] S        points to an instance of the 16 bit fixed-point STFT structure
+ * @param[in]  pSrc        points to the input buffer of numFrames*hopLen values
+ * @param[in]  numFrames   number of frames
+ * @param[in]  deciPoint   decimal point for right shift
+ * @param[in]  nPE         number of parallel processing units
+ * @param[in]  pBuf        points to a temporary buffer of nPE*N values
+ * @param[out] pDst        points to the output buffer of numFrames*(N/2+1) values
+ */
 
-void plp_mat_mult_trans_cmplx_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
-                                           const int16_t *__restrict__ pSrcB,
-                                           uint32_t M,
-                                           uint32_t N,
-                                           uint32_t O,
-                                           int32_t *__restrict__ pDstC);
+void plp_stft_q16_parallel(plp_stft_instance_q16 *S,
+                           const int16_t *__restrict__ pSrc,
+                           uint32_t numFrames,
+                           uint32_t deciPoint,
+                           uint32_t nPE,
+                           int16_t *__restrict__ pBuf,
+                           int32_t *__restrict__ pDst);
 
-/** -------------------------------------------------------
-  @brief      Glue code of parallel matrix transpose matrix multiplication for complex 16-bit
-              integers
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[in]  nPE   Number of cores to use for computation
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
-*/
+/**
+ * @brief      16 bit fixed-point STFT for RV32IM
+ * @param[in,out] S        points to an instance of the 16 bit fixed-point STFT structure
+ * @param[in]  pSrc        points to the input buffer of numFrames*hopLen values
+ * @param[in]  numFrames   number of frames
+ * @param[in]  deciPoint   decimal point for right shift
+ * @param[in]  pBuf        points to a temporary buffer of N values
+ * @param[out] pDst        points to the output buffer of numFrames*(N/2+1) values
+ */
 
-void plp_mat_mult_trans_cmplx_i16_parallel(const int16_t *__restrict__ pSrcA,
-                                           const int16_t *__restrict__ pSrcB,
-                                           uint32_t M,
-                                           uint32_t N,
-                                           uint32_t O,
-                                           uint32_t nPE,
-                                           int32_t *__restrict__ pDstC);
+void plp_stft_q16s_rv32im(plp_stft_instance_q16 *S,
+                          const int16_t *__restrict__ pSrc,
+                          uint32_t numFrames,
+                          uint32_t deciPoint,
+                          int16_t *__restrict__ pBuf,
+                          int32_t *__restrict__ pDst);
 
-/** -------------------------------------------------------
-  @brief      parallel matrix transpose matrix multiplication for complex 16-bit integers on XpulpV2
-  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_i16 struct initialized by
-                    plp_mat_mult_trans_cmplx_i16_parallel
-  @return     none
+/**
+ * @brief      16 bit fixed-point STFT for XPULPV2
+ * @param[in,out] S        points to an instance of the 16 bit fixed-point STFT structure
+ * @param[in]  pSrc        points to the input buffer of numFrames*hopLen values
+ * @param[in]  numFrames   number of frames
+ * @param[in]  deciPoint   decimal point for right shift
+ * @param[in]  pBuf        points to a temporary buffer of N values
+ * @param[out] pDst        points to the output buffer of numFrames*(N/2+1) values
+ */
 
-  @par Exploiting SIMD instructions
-  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
-*/
+void plp_stft_q16s_xpulpv2(plp_stft_instance_q16 *S,
+                           const int16_t *__restrict__ pSrc,
+                           uint32_t numFrames,
+                           uint32_t deciPoint,
+                           int16_t *__restrict__ pBuf,
+                           int32_t *__restrict__ pDst);
 
-void plp_mat_mult_trans_cmplx_i16p_xpulpv2(void *args);
+/**
+ * @brief      Parallel 16 bit fixed-point STFT for XPULPV2
+ * @param[in]  args  points to the plp_stft_parallel_arg_q16 structure
+ */
 
-/** -------------------------------------------------------
-  @brief      Glue code of matrix transpose matrix multiplication for complex 8-bit integers
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
-*/
+void plp_stft_q16p_xpulpv2(void *args);
 
-void plp_mat_mult_trans_cmplx_i8(const int8_t *__restrict__ pSrcA,
-                                 const int8_t *__restrict__ pSrcB,
-                                 uint32_t M,
-                                 uint32_t N,
-                                 uint32_t O,
-                                 int32_t *__restrict__ pDstC);
+/**
+ * @brief      Glue code for the floating-point MFCC. Computes the STFT of numFrames
+ *             frames, the log-mel energies and the first numCoeffs DCT-II coefficients of
+ *             each frame.
+ * @param[in]  S           points to an instance of the floating-point MFCC structure
+ * @param[in,out] pStft    points to an instance of the floating-point STFT structure
+ * @param[in]  pSrc        points to the input buffer of numFrames*hopLen values
+ * @param[in]  numFrames   number of frames
+ * @param[in]  pBuf        points to a temporary buffer of (2N+2+3*numBands) values
+ * @param[out] pDst        points to the output buffer of numFrames*numCoeffs values
+ */
 
-/** -------------------------------------------------------
-  @brief      matrix transpose matrix multiplication for complex 8-bit integers on RV32IM
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
-*/
+void plp_mfcc_f32(const plp_mfcc_instance_f32 *S,
+                  plp_stft_instance_f32 *pStft,
+                  const float32_t *__restrict__ pSrc,
+                  uint32_t numFrames,
+                  float32_t *__restrict__ pBuf,
+                  float32_t *__restrict__ pDst);
 
-void plp_mat_mult_trans_cmplx_i8s_rv32im(const int8_t *__restrict__ pSrcA,
-                                         const int8_t *__restrict__ pSrcB,
-                                         uint32_t M,
-                                         uint32_t N,
-                                         uint32_t O,
-                                         int32_t *__restrict__ pDstC);
+/**
+ * @brief      Glue code for the parallel floating-point MFCC
+ * @param[in]  S           points to an instance of the floating-point MFCC structure
+ * @param[in,out] pStft    points to an instance of the floating-point STFT structure
+ * @param[in]  pSrc        points to the input buffer of numFrames*hopLen values
+ * @param[in]  numFrames   number of frames
+ * @param[in]  nPE         number of parallel processing units
+ * @param[in]  pBuf        points to a temporary buffer of nPE*(2N+2+3*numBands) values
+ * @param[out] pDst        points to the output buffer of numFrames*numCoeffs values
+ */
 
-/** -------------------------------------------------------
-  @brief      matrix transpose matrix multiplication for complex 8-bit integers on XpulpV2
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+void plp_mfcc_f32_parallel(const plp_mfcc_instance_f32 *S,
+                           plp_stft_instance_f32 *pStft,
+                           const float32_t *__restrict__ pSrc,
+                           uint32_t numFrames,
+                           uint32_t nPE,
+                           float32_t *__restrict__ pBuf,
+                           float32_t *__restrict__ pDst);
 
-  @par Exploiting SIMD instructions
-  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
-*/
+/**
+ * @brief      Floating-point MFCC for XPULPV2
+ * @param[in]  S           points to an instance of the floating-point MFCC structure
+ * @param[in,out] pStft    points to an instance of the floating-point STFT structure
+ * @param[in]  pSrc        points to the input buffer of numFrames*hopLen values
+ * @param[in]  numFrames   number of frames
+ * @param[in]  pBuf        points to a temporary buffer of (2N+2+3*numBands) values
+ * @param[out] pDst        points to the output buffer of numFrames*numCoeffs values
+ */
 
-void plp_mat_mult_trans_cmplx_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
-                                          const int8_t *__restrict__ pSrcB,
-                                          uint32_t M,
-                                          uint32_t N,
-                                          uint32_t O,
-                                          int32_t *__restrict__ pDstC);
+void plp_mfcc_f32s_xpulpv2(const plp_mfcc_instance_f32 *S,
+                           plp_stft_instance_f32 *pStft,
+                           const float32_t *__restrict__ pSrc,
+                           uint32_t numFrames,
+                           float32_t *__restrict__ pBuf,
+                           float32_t *__restrict__ pDst);
 
-/** -------------------------------------------------------
-  @brief      Glue code of parallel matrix transpose matrix multiplication for complex 8-bit
-              integers
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[in]  nPE   Number of cores to use for computation
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
-*/
+/**
+ * @brief      Parallel floating-point MFCC for XPULPV2
+ * @param[in]  args  points to the plp_mfcc_parallel_arg_f32 structure
+ */
+
+void plp_mfcc_f32p_xpulpv2(void *args);
+
+/**
+ * @brief      Glue code for the 16 bit fixed-point MFCC. The log-mel energies
+ *             are in Q5.10, the cepstral coefficients are scaled by 1/numBands.
+ * @param[in]  S           points to an instance of the 16 bit fixed-point MFCC structure
+ * @param[in,out] pStft    points to an instance of the 16 bit fixed-point STFT structure
+ * @param[in]  pSrc        points to the input buffer of numFrames*hopLen values
+ * @param[in]  numFrames   number of frames
+ * @param[in]  deciPoint   decimal point for right shift
+ * @param[in]  pBuf        points to a temporary buffer of (2N+2+3*numBands) values
+ * @param[out] pDst        points to the output buffer of numFrames*numCoeffs values
+ */
+
+void plp_mfcc_q16(const plp_mfcc_instance_q16 *S,
+                  plp_stft_instance_q16 *pStft,
+                  const int16_t *__restrict__ pSrc,
+                  uint32_t numFrames,
+                  uint32_t deciPoint,
+                  int16_t *__restrict__ pBuf,
+                  int16_t *__restrict__ pDst);
+
+/**
+ * @brief      Glue code for the parallel 16 bit fixed-point MFCC
+ * @param[in]  S           points to an instance of the 16 bit fixed-point MFCC structure
+ * @param[in,out] pStft    points to an instance of the 16 bit fixed-point STFT structure
+ * @param[in]  pSrc        points to the input buffer of numFrames*hopLen values
+ * @param[in]  numFrames   number of frames
+ * @param[in]  deciPoint   decimal point for right shift
+ * @param[in]  nPE         number of parallel processing units
+ * @param[in]  pBuf        points to a temporary buffer of nPE*(2N+2+3*numBands) values
+ * @param[out] pDst        points to the output buffer of numFrames*numCoeffs values
+ */
 
-void plp_mat_mult_trans_cmplx_i8_parallel(const int8_t *__restrict__ pSrcA,
-                                          const int8_t *__restrict__ pSrcB,
-                                          uint32_t M,
-                                          uint32_t N,
-                                          uint32_t O,
-                                          uint32_t nPE,
-                                          int32_t *__restrict__ pDstC);
+void plp_mfcc_q16_parallel(const plp_mfcc_instance_q16 *S,
+                           plp_stft_instance_q16 *pStft,
+                           const int16_t *__restrict__ pSrc,
+                           uint32_t numFrames,
+                           uint32_t deciPoint,
+                           uint32_t nPE,
+                           int16_t *__restrict__ pBuf,
+                           int16_t *__restrict__ pDst);
 
-/** -------------------------------------------------------
-  @brief      parallel matrix transpose matrix multiplication for complex 8-bit integers on XpulpV2
-  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_i8 struct initialized by
-                    plp_mat_mult_trans_cmplx_i8_parallel
-  @return     none
+/**
+ * @brief      16 bit fixed-point MFCC for RV32IM
+ * @param[in]  S           points to an instance of the 16 bit fixed-point MFCC structure
+ * @param[in,out] pStft    points to an instance of the 16 bit fixed-point STFT structure
+ * @param[in]  pSrc        points to the input buffer of numFrames*hopLen values
+ * @param[in]  numFrames   number of frames
+ * @param[in]  deciPoint   decimal point for right shift
+ * @param[in]  pBuf        points to a temporary buffer of (2N+2+3*numBands) values
+ * @param[out] pDst        points to the output buffer of numFrames*numCoeffs values
+ */
 
-  @par Exploiting SIMD instructions
-  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
-*/
+void plp_mfcc_q16s_rv32im(const plp_mfcc_instance_q16 *S,
+                          plp_stft_instance_q16 *pStft,
+                          const int16_t *__restrict__ pSrc,
+                          uint32_t numFrames,
+                          uint32_t deciPoint,
+                          int16_t *__restrict__ pBuf,
+                          int16_t *__restrict__ pDst);
 
-void plp_mat_mult_trans_cmplx_i8p_xpulpv2(void *args);
+/**
+ * @brief      16 bit fixed-point MFCC for XPULPV2
+ * @param[in]  S           points to an instance of the 16 bit fixed-point MFCC structure
+ * @param[in,out] pStft    points to an instance of the 16 bit fixed-point STFT structure
+ * @param[in]  pSrc        points to the input buffer of numFrames*hopLen values
+ * @param[in]  numFrames   number of frames
+ * @param[in]  deciPoint   decimal point for right shift
+ * @param[in]  pBuf        points to a temporary buffer of (2N+2+3*numBands) values
+ * @param[out] pDst        points to the output buffer of numFrames*numCoeffs values
+ */
 
-/** -------------------------------------------------------
-  @brief      Glue code of matrix transpose matrix multiplication for complex 32-bit floats
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
-*/
+void plp_mfcc_q16s_xpulpv2(const plp_mfcc_instance_q16 *S,
+                           plp_stft_instance_q16 *pStft,
+                           const int16_t *__restrict__ pSrc,
+                           uint32_t numFrames,
+                           uint32_t deciPoint,
+                           int16_t *__restrict__ pBuf,
+                           int16_t *__restrict__ pDst);
 
-void plp_mat_mult_trans_cmplx_f32(const float *__restrict__ pSrcA,
-                                  const float *__restrict__ pSrcB,
-                                  uint32_t M,
-                                  uint32_t N,
-                                  uint32_t O,
-                                  float *__restrict__ pDstC);
+/**
+ * @brief      Parallel 16 bit fixed-point MFCC for XPULPV2
+ * @param[in]  args  points to the plp_mfcc_parallel_arg_q16 structure
+ */
 
-/** -------------------------------------------------------
-  @brief      matrix transpose matrix multiplication for complex 32-bit floats on XpulpV2
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
-*/
+void plp_mfcc_q16p_xpulpv2(void *args);
 
-void plp_mat_mult_trans_cmplx_f32s_xpulpv2(const float *__restrict__ pSrcA,
-                                           const float *__restrict__ pSrcB,
-                                           uint32_t M,
-                                           uint32_t N,
-                                           uint32_t O,
-                                           float *__restrict__ pDstC);
+/**
+ * @brief      Initialization of the floating-point Welch PSD and CSD.
+ * @param[out] S           points to the instance of the floating-point Welch structure
+ * @param[in]  pRfft       points to the instance of the real FFT of frame length N, N >= 8
+ * @param[in]  pWindow     points to the analysis window of N values
+ * @param[in]  hopLen      distance of the frames, i.e. N minus the overlap, hopLen > 0
+ * @return     0: Success, 1: Unsupported frame or hop length
+ */
 
-/** -------------------------------------------------------
-  @brief      Glue code of parallel matrix transpose matrix multiplication for complex 32-bit floats
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[in]  nPE   Number of cores to use for computation
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
-*/
+int plp_welch_init_f32(plp_welch_instance_f32 *S,
+                       const plp_rfft_instance_f32 *pRfft,
+                       const float32_t *pWindow,
+                       uint16_t hopLen);
 
-void plp_mat_mult_trans_cmplx_f32_parallel(const float *__restrict__ pSrcA,
-                                           const float *__restrict__ pSrcB,
-                                           uint32_t M,
-                                           uint32_t N,
-                                           uint32_t O,
-                                           uint32_t nPE,
-                                           float *__restrict__ pDstC);
+/**
+ * @brief      Glue code for the floating-point Welch power spectral density
+ * @param[in]  S           points to an instance of the floating-point Welch structure
+ * @param[in]  pSrc        points to the input buffer of (numFrames-1)*hopLen+N values
+ * @param[in]  numFrames   number of averaged frames
+ * @param[in]  pBuf        points to a temporary buffer of N values
+ * @param[out] pDst        points to the output buffer of N/2+1 values
+ */
 
-/** -------------------------------------------------------
-  @brief      parallel matrix transpose matrix multiplication for complex 32-bit floats on XpulpV2
-  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_f32 struct initialized by
-                    plp_mat_mult_trans_cmplx_f32_parallel
-  @return     none
-*/
+void plp_psd_welch_f32(const plp_welch_instance_f32 *S,
+                       const float32_t *__restrict__ pSrc,
+                       uint32_t numFrames,
+                       float32_t *__restrict__ pBuf,
+                       float32_t *__restrict__ pDst);
 
-void plp_mat_mult_trans_cmplx_f32p_xpulpv2(void *args);
+/**
+ * @brief      Glue code for the parallel floating-point Welch power spectral density
+ * @param[in]  S           points to an instance of the floating-point Welch structure
+ * @param[in]  pSrc        points to the input buffer of (numFrames-1)*hopLen+N values
+ * @param[in]  numFrames   number of averaged frames
+ * @param[in]  nPE         number of parallel processing units
+ * @param[in]  pBuf        points to a temporary buffer of nPE*N + (nPE-1)*(N/2+1) values
+ * @param[out] pDst        points to the output buffer of N/2+1 values
+ */
 
-/** -------------------------------------------------------
-  @brief      Glue code of matrix transpose matrix multiplication for complex 32-bit fix-point
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+void plp_psd_welch_f32_parallel(const plp_welch_instance_f32 *S,
+                                const float32_t *__restrict__ pSrc,
+                                uint32_t numFrames,
+                                uint32_t nPE,
+                                float32_t *__restrict__ pBuf,
+                                float32_t *__restrict__ pDst);
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
-*/
+/**
+ * @brief      Floating-point Welch power spectral density for XPULPV2
+ * @param[in]  S           points to an instance of the floating-point Welch structure
+ * @param[in]  pSrc        points to the input buffer of (numFrames-1)*hopLen+N values
+ * @param[in]  numFrames   number of averaged frames
+ * @param[in]  pBuf        points to a temporary buffer of N values
+ * @param[out] pDst        points to the output buffer of N/2+1 values
+ */
 
-void plp_mat_mult_trans_cmplx_q32(const int32_t *__restrict__ pSrcA,
-                                  const int32_t *__restrict__ pSrcB,
-                                  uint32_t M,
-                                  uint32_t N,
-                                  uint32_t O,
-                                  uint32_t shift,
-                                  int32_t *__restrict__ pDstC);
+void plp_psd_welch_f32s_xpulpv2(const plp_welch_instance_f32 *S,
+                                const float32_t *__restrict__ pSrc,
+                                uint32_t numFrames,
+                                float32_t *__restrict__ pBuf,
+                                float32_t *__restrict__ pDst);
 
-/** -------------------------------------------------------
-  @brief      matrix transpose matrix multiplication for complex 32-bit fix-point on RV32IM
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+/**
+ * @brief      Parallel floating-point Welch power spectral density for XPULPV2
+ * @param[in]  args  points to the plp_psd_welch_parallel_arg_f32 structure
+ */
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
-*/
+void plp_psd_welch_f32p_xpulpv2(void *args);
 
-void plp_mat_mult_trans_cmplx_q32s_rv32im(const int32_t *__restrict__ pSrcA,
-                                          const int32_t *__restrict__ pSrcB,
-                                          uint32_t M,
-                                          uint32_t N,
-                                          uint32_t O,
-                                          uint32_t shift,
-                                          int32_t *__restrict__ pDstC);
+/**
+ * @brief      Glue code for the floating-point Welch cross-spectral density
+ * @param[in]  S           points to an instance of the floating-point Welch structure
+ * @param[in]  pSrcA       points to the first input buffer of (numFrames-1)*hopLen+N values
+ * @param[in]  pSrcB       points to the second input buffer of (numFrames-1)*hopLen+N values
+ * @param[in]  numFrames   number of averaged frames
+ * @param[in]  pBuf        points to a temporary buffer of 2*N values
+ * @param[out] pDst        points to the output buffer of N/2+1 complex values
+ */
 
-/** -------------------------------------------------------
-  @brief      matrix transpose matrix multiplication for complex 32-bit fix-point on XpulpV2
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+void plp_csd_welch_f32(const plp_welch_instance_f32 *S,
+                       const float32_t *__restrict__ pSrcA,
+                       const float32_t *__restrict__ pSrcB,
+                       uint32_t numFrames,
+                       float32_t *__restrict__ pBuf,
+                       float32_t *__restrict__ pDst);
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
-*/
+/**
+ * @brief      Glue code for the parallel floating-point Welch cross-spectral density
+ * @param[in]  S           points to an instance of the floating-point Welch structure
+ * @param[in]  pSrcA       points to the first input buffer of (numFrames-1)*hopLen+N values
+ * @param[in]  pSrcB       points to the second input buffer of (numFrames-1)*hopLen+N values
+ * @param[in]  numFrames   number of averaged frames
+ * @param[in]  nPE         number of parallel processing units
+ * @param[in]  pBuf        points to a temporary buffer of 2*nPE*N + (nPE-1)*(N+2) values
+ * @param[out] pDst        points to the output buffer of N/2+1 complex values
+ */
 
-void plp_mat_mult_trans_cmplx_q32s_xpulpv2(const int32_t *__restrict__ pSrcA,
-                                           const int32_t *__restrict__ pSrcB,
-                                           uint32_t M,
-                                           uint32_t N,
-                                           uint32_t O,
-                                           uint32_t shift,
-                                           int32_t *__restrict__ pDstC);
+void plp_csd_welch_f32_parallel(const plp_welch_instance_f32 *S,
+                                const float32_t *__restrict__ pSrcA,
+                                const float32_t *__restrict__ pSrcB,
+                                uint32_t numFrames,
+                                uint32_t nPE,
+                                float32_t *__restrict__ pBuf,
+                                float32_t *__restrict__ pDst);
 
-/** -------------------------------------------------------
-  @brief      Glue code of parallel matrix transpose matrix multiplication for complex 32-bit
-              fix-point
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[in]  nPE   Number of cores to use for computation
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+/**
+ * @brief      Floating-point Welch cross-spectral density for XPULPV2
+ * @param[in]  S           points to an instance of the floating-point Welch structure
+ * @param[in]  pSrcA       points to the first input buffer of (numFrames-1)*hopLen+N values
+ * @param[in]  pSrcB       points to the second input buffer of (numFrames-1)*hopLen+N values
+ * @param[in]  numFrames   number of averaged frames
+ * @param[in]  pBuf        points to a temporary buffer of 2*N values
+ * @param[out] pDst        points to the output buffer of N/2+1 complex values
+ */
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
-*/
+void plp_csd_welch_f32s_xpulpv2(const plp_welch_instance_f32 *S,
+                                const float32_t *__restrict__ pSrcA,
+                                const float32_t *__restrict__ pSrcB,
+                                uint32_t numFrames,
+                                float32_t *__restrict__ pBuf,
+                                float32_t *__restrict__ pDst);
 
-void plp_mat_mult_trans_cmplx_q32_parallel(const int32_t *__restrict__ pSrcA,
-                                           const int32_t *__restrict__ pSrcB,
-                                           uint32_t M,
-                                           uint32_t N,
-                                           uint32_t O,
-                                           uint32_t shift,
-                                           uint32_t nPE,
-                                           int32_t *__restrict__ pDstC);
+/**
+ * @brief      Parallel floating-point Welch cross-spectral density for XPULPV2
+ * @param[in]  args  points to the plp_csd_welch_parallel_arg_f32 structure
+ */
 
-/** -------------------------------------------------------
-  @brief      parallel matrix transpose matrix multiplication for complex 32-bit fix-point on
-              XpulpV2
-  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_q32 struct initialized by
-                    plp_mat_mult_trans_cmplx_q32_parallel
-  @return     none
+void plp_csd_welch_f32p_xpulpv2(void *args);
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
-*/
+/**
+ * @brief      Initialization of the 16 bit fixed-point Welch PSD and CSD.
+ * @param[out] S           points to the instance of the 16 bit fixed-point Welch structure
+ * @param[in]  pRfft       points to the instance of the real FFT of frame length N, N >= 8
+ * @param[in]  pWindow     points to the analysis window of N values
+ * @param[in]  hopLen      distance of the frames, i.e. N minus the overlap, hopLen > 0
+ * @return     0: Success, 1: Unsupported frame or hop length
+ */
 
-void plp_mat_mult_trans_cmplx_q32p_xpulpv2(void *args);
+int plp_welch_init_q16(plp_welch_instance_q16 *S,
+                       const plp_rfft_instance_q16 *pRfft,
+                       const int16_t *pWindow,
+                       uint16_t hopLen);
 
-/** -------------------------------------------------------
-  @brief      Glue code of matrix transpose matrix multiplication for complex 16-bit fix-point
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+/**
+ * @brief      Glue code for the 16 bit fixed-point Welch power spectral density. The
+ *             output is in Q2.30.
+ * @param[in]  S           points to an instance of the 16 bit fixed-point Welch structure
+ * @param[in]  pSrc        points to the input buffer of (numFrames-1)*hopLen+N values
+ * @param[in]  numFrames   number of averaged frames
+ * @param[in]  deciPoint   decimal point for right shift
+ * @param[in]  pBuf        points to a temporary buffer of N values
+ * @param[out] pDst        points to the output buffer of N/2+1 values
+ */
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
-*/
+void plp_psd_welch_q16(const plp_welch_instance_q16 *S,
+                       const int16_t *__restrict__ pSrc,
+                       uint32_t numFrames,
+                       uint32_t deciPoint,
+                       int16_t *__restrict__ pBuf,
+                       int32_t *__restrict__ pDst);
+
+/**
+ * @brief      Glue code for the parallel 16 bit fixed-point Welch power spectral density
+ * @param[in]  S           points to an instance of the 16 bit fixed-point Welch structure
+ * @param[in]  pSrc        points to the input buffer of (numFrames-1)*hopLen+N values
+ * @param[in]  numFrames   number of averaged frames
+ * @param[in]  deciPoint   decimal point for right shift
+ * @param[in]  nPE         number of parallel processing units
+ * @param[in]  pBuf        points to a temporary buffer of nPE*N + (nPE-1)*(N+2) values
+ * @param[out] pDst        points to the output buffer of N/2+1 values
+ */
+
+void plp_psd_welch_q16_parallel(const plp_welch_instance_q16 *S,
+                                const int16_t *__restrict__ pSrc,
+                                uint32_t numFrames,
+                                uint32_t deciPoint,
+                                uint32_t nPE,
+                                int16_t *__restrict__ pBuf,
+                                int32_t *__restrict__ pDst);
+
+/**
+ * @brief      16 bit fixed-point Welch power spectral density for RV32IM
+ * @param[in]  S           points to an instance of the 16 bit fixed-point Welch structure
+ * @param[in]  pSrc        points to the input buffer of (numFrames-1)*hopLen+N values
+ * @param[in]  numFrames   number of averaged frames
+ * @param[in]  deciPoint   decimal point for right shift
+ * @param[in]  pBuf        points to a temporary buffer of N values
+ * @param[out] pDst        points to the output buffer of N/2+1 values
+ */
 
-void plp_mat_mult_trans_cmplx_q16(const int16_t *__restrict__ pSrcA,
-                                  const int16_t *__restrict__ pSrcB,
-                                  uint32_t M,
-                                  uint32_t N,
-                                  uint32_t O,
-                                  uint32_t shift,
-                                  int16_t *__restrict__ pDstC);
+void plp_psd_welch_q16s_rv32im(const plp_welch_instance_q16 *S,
+                               const int16_t *__restrict__ pSrc,
+                               uint32_t numFrames,
+                               uint32_t deciPoint,
+                               int16_t *__restrict__ pBuf,
+                               int32_t *__restrict__ pDst);
 
-/** -------------------------------------------------------
-  @brief      matrix transpose matrix multiplication for complex 16-bit fix-point on RV32IM
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+/**
+ * @brief      16 bit fixed-point Welch power spectral density for XPULPV2
+ * @param[in]  S           points to an instance of the 16 bit fixed-point Welch structure
+ * @param[in]  pSrc        points to the input buffer of (numFrames-1)*hopLen+N values
+ * @param[in]  numFrames   number of averaged frames
+ * @param[in]  deciPoint   decimal point for right shift
+ * @param[in]  pBuf        points to a temporary buffer of N values
+ * @param[out] pDst        points to the output buffer of N/2+1 values
+ */
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
-*/
+void plp_psd_welch_q16s_xpulpv2(const plp_welch_instance_q16 *S,
+                                const int16_t *__restrict__ pSrc,
+                                uint32_t numFrames,
+                                uint32_t deciPoint,
+                                int16_t *__restrict__ pBuf,
+                                int32_t *__restrict__ pDst);
 
-void plp_mat_mult_trans_cmplx_q16s_rv32im(const int16_t *__restrict__ pSrcA,
-                                          const int16_t *__restrict__ pSrcB,
-                                          uint32_t M,
-                                          uint32_t N,
-                                          uint32_t O,
-                                          uint32_t shift,
-                                          int16_t *__restrict__ pDstC);
+/**
+ * @brief      Parallel 16 bit fixed-point Welch power spectral density for XPULPV2
+ * @param[in]  args  points to the plp_psd_welch_parallel_arg_q16 structure
+ */
 
-/** -------------------------------------------------------
-  @brief      matrix transpose matrix multiplication for complex 16-bit fix-point on XpulpV2
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+void plp_psd_welch_q16p_xpulpv2(void *args);
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
+/**
+ * @brief      Glue code for the 16 bit fixed-point Welch cross-spectral density. The
+ *             output is in Q2.30.
+ * @param[in]  S           points to an instance of the 16 bit fixed-point Welch structure
+ * @param[in]  pSrcA       points to the first input buffer of (numFrames-1)*hopLen+N values
+ * @param[in]  pSrcB       points to the second input buffer of (numFrames-1)*hopLen+N values
+ * @param[in]  numFrames   number of averaged frames
+ * @param[in]  deciPoint   decimal point for right shift
+ * @param[in]  pBuf        points to a temporary buffer of 2*N values
+ * @param[out] pDst        points to the output buffer of N/2+1 complex values
+ */
 
-  @par Exploiting SIMD instructions
-  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
-*/
+void plp_csd_welch_q16(const plp_welch_instance_q16 *S,
+                       const int16_t *__restrict__ pSrcA,
+                       const int16_t *__restrict__ pSrcB,
+                       uint32_t numFrames,
+                       uint32_t deciPoint,
+                       int16_t *__restrict__ pBuf,
+                       int32_t *__restrict__ pDst);
 
-void plp_mat_mult_trans_cmplx_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
-                                           const int16_t *__restrict__ pSrcB,
-                                           uint32_t M,
-                                           uint32_t N,
-                                           uint32_t O,
-                                           uint32_t shift,
-                                           int16_t *__restrict__ pDstC);
+/**
+ * @brief      Glue code for the parallel 16 bit fixed-point Welch cross-spectral density
+ * @param[in]  S           points to an instance of the 16 bit fixed-point Welch structure
+ * @param[in]  pSrcA       points to the first input buffer of (numFrames-1)*hopLen+N values
+ * @param[in]  pSrcB       points to the second input buffer of (numFrames-1)*hopLen+N values
+ * @param[in]  numFrames   number of averaged frames
+ * @param[in]  deciPoint   decimal point for right shift
+ * @param[in]  nPE         number of parallel processing units
+ * @param[in]  pBuf        points to a temporary buffer of 2*nPE*N + 2*(nPE-1)*(N+2) values
+ * @param[out] pDst        points to the output buffer of N/2+1 complex values
+ */
 
-/** -------------------------------------------------------
-  @brief      Glue code of parallel matrix transpose matrix multiplication for complex 16-bit
-              fix-point
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[in]  nPE   Number of cores to use for computation
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+void plp_csd_welch_q16_parallel(const plp_welch_instance_q16 *S,
+                                const int16_t *__restrict__ pSrcA,
+                                const int16_t *__restrict__ pSrcB,
+                                uint32_t numFrames,
+                                uint32_t deciPoint,
+                                uint32_t nPE,
+                                int16_t *__restrict__ pBuf,
+                                int32_t *__restrict__ pDst);
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
-*/
+/**
+ * @brief      16 bit fixed-point Welch cross-spectral density for RV32IM
+ * @param[in]  S           points to an instance of the 16 bit fixed-point Welch structure
+ * @param[in]  pSrcA       points to the first input buffer of (numFrames-1)*hopLen+N values
+ * @param[in]  pSrcB       points to the second input buffer of (numFrames-1)*hopLen+N values
+ * @param[in]  numFrames   number of averaged frames
+ * @param[in]  deciPoint   decimal point for right shift
+ * @param[in]  pBuf        points to a temporary buffer of 2*N values
+ * @param[out] pDst        points to the output buffer of N/2+1 complex values
+ */
 
-void plp_mat_mult_trans_cmplx_q16_parallel(const int16_t *__restrict__ pSrcA,
-                                           const int16_t *__restrict__ pSrcB,
-                                           uint32_t M,
-                                           uint32_t N,
-                                           uint32_t O,
-                                           uint32_t shift,
-                                           uint32_t nPE,
-                                           int16_t *__restrict__ pDstC);
+void plp_csd_welch_q16s_rv32im(const plp_welch_instance_q16 *S,
+                               const int16_t *__restrict__ pSrcA,
+                               const int16_t *__restrict__ pSrcB,
+                               uint32_t numFrames,
+                               uint32_t deciPoint,
+                               int16_t *__restrict__ pBuf,
+                               int32_t *__restrict__ pDst);
 
-/** -------------------------------------------------------
-  @brief      parallel matrix transpose matrix multiplication for complex 16-bit fix-point on
-              XpulpV2
-  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_q16 struct initialized by
-                    plp_mat_mult_trans_cmplx_q16_parallel
-  @return     none
+/**
+ * @brief      16 bit fixed-point Welch cross-spectral density for XPULPV2
+ * @param[in]  S           points to an instance of the 16 bit fixed-point Welch structure
+ * @param[in]  pSrcA       points to the first input buffer of (numFrames-1)*hopLen+N values
+ * @param[in]  pSrcB       points to the second input buffer of (numFrames-1)*hopLen+N values
+ * @param[in]  numFrames   number of averaged frames
+ * @param[in]  deciPoint   decimal point for right shift
+ * @param[in]  pBuf        points to a temporary buffer of 2*N values
+ * @param[out] pDst        points to the output buffer of N/2+1 complex values
+ */
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
+void plp_csd_welch_q16s_xpulpv2(const plp_welch_instance_q16 *S,
+                                const int16_t *__restrict__ pSrcA,
+                                const int16_t *__restrict__ pSrcB,
+                                uint32_t numFrames,
+                                uint32_t deciPoint,
+                                int16_t *__restrict__ pBuf,
+                                int32_t *__restrict__ pDst);
 
-  @par Exploiting SIMD instructions
-  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
-*/
+/**
+ * @brief      Parallel 16 bit fixed-point Welch cross-spectral density for XPULPV2
+ * @param[in]  args  points to the plp_csd_welch_parallel_arg_q16 structure
+ */
 
-void plp_mat_mult_trans_cmplx_q16p_xpulpv2(void *args);
+void plp_csd_welch_q16p_xpulpv2(void *args);
 
-/** -------------------------------------------------------
-  @brief      Glue code of matrix transpose matrix multiplication for complex 8-bit fix-point
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+/**
+ * @brief      Glue code for the 16 bit fixed-point batched complex FFT
+ * @param[in]     S                points to an instance of the 16bit quantized CFFT structure
+ * @param[in,out] pSrc             points to the complex data of all transforms, processed in-place
+ * @param[in]     numTransforms    number of transforms
+ * @param[in]     transformStride  distance in complex values between two transforms
+ * @param[in]     sampleStride     distance in complex values between two samples of a transform
+ * @param[in]     ifftFlag         flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ * @param[in]     bitReverseFlag   flag that enables (bitReverseFlag=1) bit reversal of output
+ * @param[in]     deciPoint        decimal point for right shift
+ * @param[in]     pBuf             points to a temporary buffer of 2*fftLen values, unused if
+ *                                 sampleStride is 1 and pDst is not pSrc
+ */
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
-*/
+void plp_cfft_batch_q16(const plp_cfft_instance_q16 *S,
+                        int16_t *__restrict__ pSrc,
+                        uint32_t numTransforms,
+                        uint32_t transformStride,
+                        uint32_t sampleStride,
+                        uint8_t ifftFlag,
+                        uint8_t bitReverseFlag,
+                        uint32_t deciPoint,
+                        int16_t *__restrict__ pBuf);
 
-void plp_mat_mult_trans_cmplx_q8(const int8_t *__restrict__ pSrcA,
-                                 const int8_t *__restrict__ pSrcB,
-                                 uint32_t M,
-                                 uint32_t N,
-                                 uint32_t O,
-                                 uint32_t shift,
-                                 int8_t *__restrict__ pDstC);
+/**
+ * @brief      Glue code for the parallel 16 bit fixed-point batched complex FFT
+ * @param[in]     S                points to an instance of the 16bit quantized CFFT structure
+ * @param[in,out] pSrc             points to the complex data of all transforms, processed in-place
+ * @param[in]     numTransforms    number of transforms
+ * @param[in]     transformStride  distance in complex values between two transforms
+ * @param[in]     sampleStride     distance in complex values between two samples of a transform
+ * @param[in]     ifftFlag         flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ * @param[in]     bitReverseFlag   flag that enables (bitReverseFlag=1) bit reversal of output
+ * @param[in]     deciPoint        decimal point for right shift
+ * @param[in]     nPE              number of parallel processing units
+ * @param[in]     pBuf             points to a temporary buffer of 2*nPE*fftLen values, unused if
+ *                                 sampleStride is 1 and pDst is not pSrc
+ */
 
-/** -------------------------------------------------------
-  @brief      matrix transpose matrix multiplication for complex 8-bit fix-point on RV32IM
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+void plp_cfft_batch_q16_parallel(const plp_cfft_instance_q16 *S,
+                                 int16_t *__restrict__ pSrc,
+                                 uint32_t numTransforms,
+                                 uint32_t transformStride,
+                                 uint32_t sampleStride,
+                                 uint8_t ifftFlag,
+                                 uint8_t bitReverseFlag,
+                                 uint32_t deciPoint,
+                                 uint32_t nPE,
+                                 int16_t *__restrict__ pBuf);
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
-*/
+/**
+ * @brief      16 bit fixed-point batched complex FFT for RV32IM
+ * @param[in]     S                points to an instance of the 16bit quantized CFFT structure
+ * @param[in,out] pSrc             points to the complex data of all transforms, processed in-place
+ * @param[in]     numTransforms    number of transforms
+ * @param[in]     transformStride  distance in complex values between two transforms
+ * @param[in]     sampleStride     distance in complex values between two samples of a transform
+ * @param[in]     ifftFlag         flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ * @param[in]     bitReverseFlag   flag that enables (bitReverseFlag=1) bit reversal of output
+ * @param[in]     deciPoint        decimal point for right shift
+ * @param[in]     pBuf             points to a temporary buffer of 2*fftLen values, unused if
+ *                                 sampleStride is 1 and pDst is not pSrc
+ */
 
-void plp_mat_mult_trans_cmplx_q8s_rv32im(const int8_t *__restrict__ pSrcA,
-                                         const int8_t *__restrict__ pSrcB,
-                                         uint32_t M,
-                                         uint32_t N,
-                                         uint32_t O,
-                                         uint32_t shift,
-                                         int8_t *__restrict__ pDstC);
+void plp_cfft_batch_q16s_rv32im(const plp_cfft_instance_q16 *S,
+                                int16_t *__restrict__ pSrc,
+                                uint32_t numTransforms,
+                                uint32_t transformStride,
+                                uint32_t sampleStride,
+                                uint8_t ifftFlag,
+                                uint8_t bitReverseFlag,
+                                uint32_t deciPoint,
+                                int16_t *__restrict__ pBuf);
 
-/** -------------------------------------------------------
-  @brief      matrix transpose matrix multiplication for complex 8-bit fix-point on XpulpV2
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+/**
+ * @brief      16 bit fixed-point batched complex FFT for XPULPV2
+ * @param[in]     S                points to an instance of the 16bit quantized CFFT structure
+ * @param[in,out] pSrc             points to the complex data of all transforms, processed in-place
+ * @param[in]     numTransforms    number of transforms
+ * @param[in]     transformStride  distance in complex values between two transforms
+ * @param[in]     sampleStride     distance in complex values between two samples of a transform
+ * @param[in]     ifftFlag         flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ * @param[in]     bitReverseFlag   flag that enables (bitReverseFlag=1) bit reversal of output
+ * @param[in]     deciPoint        decimal point for right shift
+ * @param[in]     pBuf             points to a temporary buffer of 2*fftLen values, unused if
+ *                                 sampleStride is 1 and pDst is not pSrc
+ */
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
+void plp_cfft_batch_q16s_xpulpv2(const plp_cfft_instance_q16 *S,
+                                 int16_t *__restrict__ pSrc,
+                                 uint32_t numTransforms,
+                                 uint32_t transformStride,
+                                 uint32_t sampleStride,
+                                 uint8_t ifftFlag,
+                                 uint8_t bitReverseFlag,
+                                 uint32_t deciPoint,
+                                 int16_t *__restrict__ pBuf);
 
-  @par Exploiting SIMD instructions
-  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
-*/
+/**
+ * @brief      Parallel 16 bit fixed-point batched complex FFT for XPULPV2
+ * @param[in]  args  points to the plp_cfft_batch_parallel_arg_q16 structure
+ */
 
-void plp_mat_mult_trans_cmplx_q8s_xpulpv2(const int8_t *__restrict__ pSrcA,
-                                          const int8_t *__restrict__ pSrcB,
-                                          uint32_t M,
-                                          uint32_t N,
-                                          uint32_t O,
-                                          uint32_t shift,
-                                          int8_t *__restrict__ pDstC);
+void plp_cfft_batch_q16p_xpulpv2(void *args);
 
-/** -------------------------------------------------------
-  @brief      Glue code of parallel matrix transpose matrix multiplication for complex 8-bit
-              fix-point
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[in]  nPE   Number of cores to use for computation
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+/**
+ * @brief      Glue code for the floating-point batched complex FFT
+ * @param[in]     S                points to the floating-point mixed-radix CFFT instance
+ * @param[in]     pSrc             points to the complex input data of all transforms
+ * @param[in]     numTransforms    number of transforms
+ * @param[in]     transformStride  distance in complex values between two transforms
+ * @param[in]     sampleStride     distance in complex values between two samples of a transform
+ * @param[in]     pBuf             points to a temporary buffer of 4*fftLen values, unused if
+ *                                 sampleStride is 1 and pDst is not pSrc
+ * @param[out]    pDst             points to the complex output data, with the same strides as pSrc.
+ *                                 May be pSrc for an in-place transform.
+ */
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
-*/
+void plp_cfft_batch_f32(const plp_cfft_mixed_instance_f32 *S,
+                        const float32_t *pSrc,
+                        uint32_t numTransforms,
+                        uint32_t transformStride,
+                        uint32_t sampleStride,
+                        float32_t *__restrict__ pBuf,
+                        float32_t *pDst);
+
+/**
+ * @brief      Glue code for the parallel floating-point batched complex FFT
+ * @param[in]     S                points to the floating-point mixed-radix CFFT instance
+ * @param[in]     pSrc             points to the complex input data of all transforms
+ * @param[in]     numTransforms    number of transforms
+ * @param[in]     transformStride  distance in complex values between two transforms
+ * @param[in]     sampleStride     distance in complex values between two samples of a transform
+ * @param[in]     nPE              number of parallel processing units
+ * @param[in]     pBuf             points to a temporary buffer of 4*nPE*fftLen values, unused if
+ *                                 sampleStride is 1 and pDst is not pSrc
+ * @param[out]    pDst             points to the complex output data, with the same strides as pSrc.
+ *                                 May be pSrc for an in-place transform.
+ */
+
+void plp_cfft_batch_f32_parallel(const plp_cfft_mixed_instance_f32 *S,
+                                 const float32_t *pSrc,
+                                 uint32_t numTransforms,
+                                 uint32_t transformStride,
+                                 uint32_t sampleStride,
+                                 uint32_t nPE,
+                                 float32_t *__restrict__ pBuf,
+                                 float32_t *pDst);
+
+/**
+ * @brief      Floating-point batched complex FFT for XPULPV2
+ * @param[in]     S                points to the floating-point mixed-radix CFFT instance
+ * @param[in]     pSrc             points to the complex input data of all transforms
+ * @param[in]     numTransforms    number of transforms
+ * @param[in]     transformStride  distance in complex values between two transforms
+ * @param[in]     sampleStride     distance in complex values between two samples of a transform
+ * @param[in]     pBuf             points to a temporary buffer of 4*fftLen values, unused if
+ *                                 sampleStride is 1 and pDst is not pSrc
+ * @param[out]    pDst             points to the complex output data, with the same strides as pSrc.
+ *                                 May be pSrc for an in-place transform.
+ */
 
-void plp_mat_mult_trans_cmplx_q8_parallel(const int8_t *__restrict__ pSrcA,
-                                          const int8_t *__restrict__ pSrcB,
-                                          uint32_t M,
-                                          uint32_t N,
-                                          uint32_t O,
-                                          uint32_t shift,
-                                          uint32_t nPE,
-                                          int8_t *__restrict__ pDstC);
+void plp_cfft_batch_f32s_xpulpv2(const plp_cfft_mixed_instance_f32 *S,
+                                 const float32_t *pSrc,
+                                 uint32_t numTransforms,
+                                 uint32_t transformStride,
+                                 uint32_t sampleStride,
+                                 float32_t *__restrict__ pBuf,
+                                 float32_t *pDst);
 
-/** -------------------------------------------------------
-  @brief      parallel matrix transpose matrix multiplication for complex 8-bit fix-point on XpulpV2
-  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_q8 struct initialized by
-                    plp_mat_mult_trans_cmplx_q8_parallel
-  @return     none
+/**
+ * @brief      Parallel floating-point batched complex FFT for XPULPV2
+ * @param[in]  args  points to the plp_cfft_batch_parallel_arg_f32 structure
+ */
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
+void plp_cfft_batch_f32p_xpulpv2(void *args);
 
-  @par Exploiting SIMD instructions
-  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
-*/
+/**
+ * @brief      Glue code for the 16 bit fixed-point 2D complex FFT
+ * @param[in]     SRows     points to the CFFT instance of the rows, of length numCols
+ * @param[in]     SCols     points to the CFFT instance of the columns, of length numRows
+ * @param[in,out] pSrc      points to the numRows x numCols complex matrix, processed in-place
+ * @param[in]     deciPoint decimal point for right shift
+ * @param[in]     pBuf      points to a temporary buffer of 2*numRows*numCols values
+ */
 
-void plp_mat_mult_trans_cmplx_q8p_xpulpv2(void *args);
+void plp_cfft2d_q16(const plp_cfft_instance_q16 *SRows,
+                    const plp_cfft_instance_q16 *SCols,
+                    int16_t *__restrict__ pSrc,
+                    uint32_t deciPoint,
+                    int16_t *__restrict__ pBuf);
 
 /**
- * @brief      calculates the complex magnitude.
- *
- * @param[in]  pSrc        The source
- * @param[in]  deciPoint   The decimal point. Fromat: Q(16-deciPoint).deciPoint
- * @param      pRes        The result
- * @param[in]  numSamples  The number of samples
+ * @brief      Glue code for the parallel 16 bit fixed-point 2D complex FFT
+ * @param[in]     SRows     points to the CFFT instance of the rows, of length numCols
+ * @param[in]     SCols     points to the CFFT instance of the columns, of length numRows
+ * @param[in,out] pSrc      points to the numRows x numCols complex matrix, processed in-place
+ * @param[in]     deciPoint decimal point for right shift
+ * @param[in]     nPE       number of parallel processing units
+ * @param[in]     pBuf      points to a temporary buffer of 2*numRows*numCols values
  */
-void plp_cmplx_mag_q16(const int16_t *pSrc,
-                       const uint32_t deciPoint,
-                       int16_t *pRes,
-                       uint32_t numSamples);
+
+void plp_cfft2d_q16_parallel(const plp_cfft_instance_q16 *SRows,
+                             const plp_cfft_instance_q16 *SCols,
+                             int16_t *__restrict__ pSrc,
+                             uint32_t deciPoint,
+                             uint32_t nPE,
+                             int16_t *__restrict__ pBuf);
 
 /**
-  @brief      In-place 16 bit reversal function for RV32IM
-  @param[in,out] pSrc        points to in-place buffer of unknown 16-bit data type
-  @param[in]  bitRevLen   bit reversal table length
-  @param[in]  pBitRevTab  points to bit reversal table
-  @return     none
-*/
+ * @brief      16 bit fixed-point 2D complex FFT for RV32IM
+ * @param[in]     SRows     points to the CFFT instance of the rows, of length numCols
+ * @param[in]     SCols     points to the CFFT instance of the columns, of length numRows
+ * @param[in,out] pSrc      points to the numRows x numCols complex matrix, processed in-place
+ * @param[in]     deciPoint decimal point for right shift
+ * @param[in]     pBuf      points to a temporary buffer of 2*numRows*numCols values
+ */
 
-void plp_bitreversal_16s_rv32im(uint16_t *pSrc,
-                                const uint16_t bitRevLen,
-                                const uint16_t *pBitRevTab);
+void plp_cfft2d_q16s_rv32im(const plp_cfft_instance_q16 *SRows,
+                            const plp_cfft_instance_q16 *SCols,
+                            int16_t *__restrict__ pSrc,
+                            uint32_t deciPoint,
+                            int16_t *__restrict__ pBuf);
 
 /**
-  @brief      In-place 16 bit reversal function for XPULPV2
-  @param[in,out] pSrc        points to in-place buffer of unknown 16-bit data type
-  @param[in]  bitRevLen   bit reversal table length
-  @param[in]  pBitRevTab  points to bit reversal table
-  @return     none
-*/
+ * @brief      16 bit fixed-point 2D complex FFT for XPULPV2
+ * @param[in]     SRows     points to the CFFT instance of the rows, of length numCols
+ * @param[in]     SCols     points to the CFFT instance of the columns, of length numRows
+ * @param[in,out] pSrc      points to the numRows x numCols complex matrix, processed in-place
+ * @param[in]     deciPoint decimal point for right shift
+ * @param[in]     pBuf      points to a temporary buffer of 2*numRows*numCols values
+ */
 
-void plp_bitreversal_16v_xpulpv2(uint16_t *pSrc,
-                                 const uint16_t bitRevLen,
-                                 const uint16_t *pBitRevTab);
+void plp_cfft2d_q16s_xpulpv2(const plp_cfft_instance_q16 *SRows,
+                             const plp_cfft_instance_q16 *SCols,
+                             int16_t *__restrict__ pSrc,
+                             uint32_t deciPoint,
+                             int16_t *__restrict__ pBuf);
 
 /**
- * @brief      Glue code for quantized 16 bit complex fast fourier transform
- *
- * Fixed point units input -> output dependent on length:
- * len=16:    Q1.15 -> Q5.11
- * len=32:    Q1.15 -> Q6.10
- * len=64:    Q1.15 -> Q7.9
- * len=128:   Q1.15 -> Q8.8
- * len=256:   Q1.15 -> Q9.7
- * len=512:   Q1.15 -> Q10.6
- * len=1024:  Q1.15 -> Q11.5
- * len=2048:  Q1.15 -> Q12.4
- * len=4096:  Q1.15 -> Q13.3
- *
- * @param[in]  S               points to an instance of the 16bit quantized CFFT structure
- * @param[in,out] p1              points to the complex data buffer of size <code>2*fftLen</code>.
- * Processing occurs in-place.
- * @param[in]  ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
- * transform.
- * @param[in]  bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
- * (bitReverseFlag=0) bit reversal of output.
- * @param[in]  deciPoint       decimal point for right shift
+ * @brief      Parallel 16 bit fixed-point 2D complex FFT for XPULPV2
+ * @param[in]  args  points to the plp_cfft2d_parallel_arg_q16 structure
  */
 
-void plp_cfft_q16(const plp_cfft_instance_q16 *S,
-                  int16_t *p1,
-                  uint8_t ifftFlag,
-                  uint8_t bitReverseFlag,
-                  uint32_t deciPoint);
+void plp_cfft2d_q16p_xpulpv2(void *args);
 
 /**
- * @brief      Quantized 16 bit complex fast fourier transform for RV32IM
- * @param[in]  S               points to an instance of the 16bit quantized CFFT structure
- * @param[in,out] p1              points to the complex data buffer of size <code>2*fftLen</code>.
- * Processing occurs in-place.
- * @param[in]  ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
- * transform.
- * @param[in]  bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
- * (bitReverseFlag=0) bit reversal of output.
- * @param[in]  deciPoint       decimal point for right shift
+ * @brief      Glue code for the floating-point 2D complex FFT
+ * @param[in]     SRows     points to the mixed-radix CFFT instance of the rows (numCols)
+ * @param[in]     SCols     points to the mixed-radix CFFT instance of the columns (numRows)
+ * @param[in]     pSrc      points to the numRows x numCols complex input matrix
+ * @param[in]     pBuf      points to a temporary buffer of 2*numRows*numCols values
+ * @param[out]    pDst      points to the numRows x numCols complex output matrix
  */
 
-void plp_cfft_q16s_rv32im(const plp_cfft_instance_q16 *S,
-                          int16_t *p1,
-                          uint8_t ifftFlag,
-                          uint8_t bitReverseFlag,
-                          uint32_t deciPoint);
+void plp_cfft2d_f32(const plp_cfft_mixed_instance_f32 *SRows,
+                    const plp_cfft_mixed_instance_f32 *SCols,
+                    const float32_t *__restrict__ pSrc,
+                    float32_t *__restrict__ pBuf,
+                    float32_t *__restrict__ pDst);
 
 /**
- * @brief      Quantized 16 bit complex fast fourier transform for XPULPV2
- * @param[in]  S               points to an instance of the 16bit quantized CFFT structure
- * @param[in,out] p1              points to the complex data buffer of size <code>2*fftLen</code>.
- * Processing occurs in-place.
- * @param[in]  ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
- * transform.
- * @param[in]  bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
- * (bitReverseFlag=0) bit reversal of output.
- * @param[in]  deciPoint       decimal point for right shift
+ * @brief      Glue code for the parallel floating-point 2D complex FFT
+ * @param[in]     SRows     points to the mixed-radix CFFT instance of the rows (numCols)
+ * @param[in]     SCols     points to the mixed-radix CFFT instance of the columns (numRows)
+ * @param[in]     pSrc      points to the numRows x numCols complex input matrix
+ * @param[in]     nPE       number of parallel processing units
+ * @param[in]     pBuf      points to a temporary buffer of 2*numRows*numCols values
+ * @param[out]    pDst      points to the numRows x numCols complex output matrix
  */
 
-void plp_cfft_q16s_xpulpv2(const plp_cfft_instance_q16 *S,
-                           int16_t *p1,
-                           uint8_t ifftFlag,
-                           uint8_t bitReverseFlag,
-                           uint32_t deciPoint);
+void plp_cfft2d_f32_parallel(const plp_cfft_mixed_instance_f32 *SRows,
+                             const plp_cfft_mixed_instance_f32 *SCols,
+                             const float32_t *__restrict__ pSrc,
+                             uint32_t nPE,
+                             float32_t *__restrict__ pBuf,
+                             float32_t *__restrict__ pDst);
+
+/**
+ * @brief      Floating-point 2D complex FFT for XPULPV2
+ * @param[in]     SRows     points to the mixed-radix CFFT instance of the rows (numCols)
+ * @param[in]     SCols     points to the mixed-radix CFFT instance of the columns (numRows)
+ * @param[in]     pSrc      points to the numRows x numCols complex input matrix
+ * @param[in]     pBuf      points to a temporary buffer of 2*numRows*numCols values
+ * @param[out]    pDst      points to the numRows x numCols complex output matrix
+ */
+
+void plp_cfft2d_f32s_xpulpv2(const plp_cfft_mixed_instance_f32 *SRows,
+                             const plp_cfft_mixed_instance_f32 *SCols,
+                             const float32_t *__restrict__ pSrc,
+                             float32_t *__restrict__ pBuf,
+                             float32_t *__restrict__ pDst);
+
+/**
+ * @brief      Parallel floating-point 2D complex FFT for XPULPV2
+ * @param[in]  args  points to the plp_cfft2d_parallel_arg_f32 structure
+ */
+
+void plp_cfft2d_f32p_xpulpv2(void *args);
 
 /**
    @brief Floating-point FFT on real input data.
@@ -7130,10 +14137,55 @@ void plp_rfft_f32_xpulpv2(const plp_rfft_instance_f32 *S,
 
 /**
    @brief  Floating-point FFT on real input data for XPULPV2 extension (parallel version).
-   @param[in]   arg       points to an instance of the floating-point FFT structure
+   @param[in]   args      points to a plp_rfft_parallel_arg_f32 structure
+   @return      none
+*/
+void plp_rfft_f32_xpulpv2_parallel(void *args);
+
+/**
+   @brief Floating-point inverse FFT with real output data.
+   @param[in]   S       points to an instance of the floating-point FFT structure
+   @param[in]   pSrc    points to the input buffer (complex data in the format produced by
+                        plp_rfft_f32, only the bins 0 .. N/2 are used)
+   @param[out]  pDst    points to the output buffer (real data, N values)
+   @return      none
+*/
+void plp_rifft_f32(const plp_rfft_instance_f32 *S,
+                   const float32_t *__restrict__ pSrc,
+                   float32_t *__restrict__ pDst);
+
+/**
+   @brief Floating-point inverse FFT with real output data (parallel version).
+   @param[in]   S       points to an instance of the floating-point FFT structure
+   @param[in]   pSrc    points to the input buffer (complex data in the format produced by
+                        plp_rfft_f32, only the bins 0 .. N/2 are used)
+   @param[in]   nPE     number of parallel processing units
+   @param[out]  pDst    points to the output buffer (real data, N values)
+   @return      none
+*/
+void plp_rifft_f32_parallel(const plp_rfft_instance_f32 *S,
+                            const float32_t *__restrict__ pSrc,
+                            const uint32_t nPE,
+                            float32_t *__restrict__ pDst);
+
+/**
+   @brief  Floating-point inverse FFT with real output data for XPULPV2 extension.
+   @param[in]   S       points to an instance of the floating-point FFT structure
+   @param[in]   pSrc    points to the input buffer (complex data)
+   @param[out]  pDst    points to the output buffer (real data)
+   @return      none
+*/
+void plp_rifft_f32_xpulpv2(const plp_rfft_instance_f32 *S,
+                           const float32_t *__restrict__ pSrc,
+                           float32_t *__restrict__ pDst);
+
+/**
+   @brief  Floating-point inverse FFT with real output data for XPULPV2 extension (parallel
+   version).
+   @param[in]   args      points to a plp_rifft_parallel_arg_f32 structure
    @return      none
 */
-void plp_rfft_f32_xpulpv2_parallel(plp_rfft_parallel_arg_f32 *arg);
+void plp_rifft_f32_xpulpv2_parallel(void *args);
 
 /** -------------------------------------------------------
   @brief      Glue code for matrix addition of a 32-bit integer matrices.
@@ -8163,8 +15215,7 @@ void plp_mat_trans_i16s_rv32im(const int16_t *__restrict__ pSrc,
   @return     none
 
   @par Exploiting SIMD instructions
-  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+  The matrix is transposed in tiles of 2x2 elements, which are loaded and stored as packed words.
 */
 
 void plp_mat_trans_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
@@ -8195,8 +15246,7 @@ void plp_mat_trans_i16_parallel(const int16_t *__restrict__ pSrc,
   @return     none
 
   @par Exploiting SIMD instructions
-  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+  The matrix is transposed in tiles of 2x2 elements, which are loaded and stored as packed words.
 */
 
 void plp_mat_trans_i16p_xpulpv2(void *args);
@@ -8238,8 +15288,7 @@ void plp_mat_trans_i8s_rv32im(const int8_t *__restrict__ pSrc,
   @return     none
 
   @par Exploiting SIMD instructions
-  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+  The matrix is transposed in tiles of 4x4 elements, which are loaded and stored as packed words.
 */
 
 void plp_mat_trans_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
@@ -8270,8 +15319,7 @@ void plp_mat_trans_i8_parallel(const int8_t *__restrict__ pSrc,
   @return     none
 
   @par Exploiting SIMD instructions
-  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+  The matrix is transposed in tiles of 4x4 elements, which are loaded and stored as packed words.
 */
 
 void plp_mat_trans_i8p_xpulpv2(void *args);
@@ -8301,11 +15349,210 @@ void plp_mat_trans_f32(const float *__restrict__ pSrc,
   @param[out] pDst Points to the output matrix of shape NxM
   @return     none
 
-  @par This function will use plp_mat_trans_i32p_xpulpv2 for its computation.
+  @par This function will use plp_mat_trans_i32p_xpulpv2 for its computation.
+*/
+
+void plp_mat_trans_f32_parallel(
+    const float *__restrict__ pSrc, uint32_t M, uint32_t N, uint32_t nPE, float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief         Glue code for the in-place transpose of a square 32-bit integer matrix.
+  @param[in,out] pSrcDst Points to the square matrix of shape NxN, which is transposed in place
+  @param[in]     N       Width and height of the matrix
+  @return        none
+*/
+
+void plp_mat_trans_in_place_i32(int32_t *__restrict__ pSrcDst, uint32_t N);
+
+/** -------------------------------------------------------
+  @brief         In-place transpose of a square 32-bit integer matrix kernel for RV32IM extension.
+  @param[in,out] pSrcDst Points to the square matrix of shape NxN, which is transposed in place
+  @param[in]     N       Width and height of the matrix
+  @return        none
+*/
+
+void plp_mat_trans_in_place_i32s_rv32im(int32_t *__restrict__ pSrcDst, uint32_t N);
+
+/** -------------------------------------------------------
+  @brief         In-place transpose of a square 32-bit integer matrix kernel for XPULPV2 extension.
+  @param[in,out] pSrcDst Points to the square matrix of shape NxN, which is transposed in place
+  @param[in]     N       Width and height of the matrix
+  @return        none
+*/
+
+void plp_mat_trans_in_place_i32s_xpulpv2(int32_t *__restrict__ pSrcDst, uint32_t N);
+
+/** -------------------------------------------------------
+  @brief         Glue code for the parallel in-place transpose of a square 32-bit integer
+                 matrix.
+  @param[in,out] pSrcDst Points to the square matrix of shape NxN, which is transposed in place
+  @param[in]     N       Width and height of the matrix
+  @param[in]     nPE     Number of cores to use for computation
+  @return        none
+*/
+
+void plp_mat_trans_in_place_i32_parallel(int32_t *__restrict__ pSrcDst, uint32_t N, uint32_t nPE);
+
+/** -------------------------------------------------------
+  @brief         Parallel in-place transpose of a square 32-bit integer matrix kernel for XPULPV2
+                 extension.
+  @param[in]     args  pointer to plp_mat_trans_in_place_instance_i32 struct initialized by
+                       plp_mat_trans_in_place_i32_parallel
+  @return        none
+
+  Every core takes every nPE-th row and swaps it with the mirrored column. The pairs of
+  mirrored elements are disjoint, so the cores need no synchronization.
+*/
+
+void plp_mat_trans_in_place_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief         Glue code for the in-place transpose of a square 16-bit integer matrix.
+  @param[in,out] pSrcDst Points to the square matrix of shape NxN, which is transposed in place
+  @param[in]     N       Width and height of the matrix
+  @return        none
+*/
+
+void plp_mat_trans_in_place_i16(int16_t *__restrict__ pSrcDst, uint32_t N);
+
+/** -------------------------------------------------------
+  @brief         In-place transpose of a square 16-bit integer matrix kernel for RV32IM extension.
+  @param[in,out] pSrcDst Points to the square matrix of shape NxN, which is transposed in place
+  @param[in]     N       Width and height of the matrix
+  @return        none
+*/
+
+void plp_mat_trans_in_place_i16s_rv32im(int16_t *__restrict__ pSrcDst, uint32_t N);
+
+/** -------------------------------------------------------
+  @brief         In-place transpose of a square 16-bit integer matrix kernel for XPULPV2 extension.
+  @param[in,out] pSrcDst Points to the square matrix of shape NxN, which is transposed in place
+  @param[in]     N       Width and height of the matrix
+  @return        none
+
+  @par Exploiting SIMD instructions
+  The matrix is split into tiles of 2x2 elements, which are loaded and stored as packed words. The
+  tiles on the diagonal are transposed in registers, all other tiles are swapped with the transpose
+  of their mirrored tile. No second buffer is needed.
+*/
+
+void plp_mat_trans_in_place_i16s_xpulpv2(int16_t *__restrict__ pSrcDst, uint32_t N);
+
+/** -------------------------------------------------------
+  @brief         Glue code for the parallel in-place transpose of a square 16-bit integer
+                 matrix.
+  @param[in,out] pSrcDst Points to the square matrix of shape NxN, which is transposed in place
+  @param[in]     N       Width and height of the matrix
+  @param[in]     nPE     Number of cores to use for computation
+  @return        none
+*/
+
+void plp_mat_trans_in_place_i16_parallel(int16_t *__restrict__ pSrcDst, uint32_t N, uint32_t nPE);
+
+/** -------------------------------------------------------
+  @brief         Parallel in-place transpose of a square 16-bit integer matrix kernel for XPULPV2
+                 extension.
+  @param[in]     args  pointer to plp_mat_trans_in_place_instance_i16 struct initialized by
+                       plp_mat_trans_in_place_i16_parallel
+  @return        none
+
+  @par Exploiting SIMD instructions
+  The matrix is split into tiles of 2x2 elements, which are loaded and stored as packed words. The
+  tiles on the diagonal are transposed in registers, all other tiles are swapped with the transpose
+  of their mirrored tile. No second buffer is needed.
+
+  Every core takes every nPE-th tile row and swaps it with the mirrored column. The pairs of
+  mirrored elements are disjoint, so the cores need no synchronization.
+*/
+
+void plp_mat_trans_in_place_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief         Glue code for the in-place transpose of a square 8-bit integer matrix.
+  @param[in,out] pSrcDst Points to the square matrix of shape NxN, which is transposed in place
+  @param[in]     N       Width and height of the matrix
+  @return        none
+*/
+
+void plp_mat_trans_in_place_i8(int8_t *__restrict__ pSrcDst, uint32_t N);
+
+/** -------------------------------------------------------
+  @brief         In-place transpose of a square 8-bit integer matrix kernel for RV32IM extension.
+  @param[in,out] pSrcDst Points to the square matrix of shape NxN, which is transposed in place
+  @param[in]     N       Width and height of the matrix
+  @return        none
+*/
+
+void plp_mat_trans_in_place_i8s_rv32im(int8_t *__restrict__ pSrcDst, uint32_t N);
+
+/** -------------------------------------------------------
+  @brief         In-place transpose of a square 8-bit integer matrix kernel for XPULPV2 extension.
+  @param[in,out] pSrcDst Points to the square matrix of shape NxN, which is transposed in place
+  @param[in]     N       Width and height of the matrix
+  @return        none
+
+  @par Exploiting SIMD instructions
+  The matrix is split into tiles of 4x4 elements, which are loaded and stored as packed words. The
+  tiles on the diagonal are transposed in registers, all other tiles are swapped with the transpose
+  of their mirrored tile. No second buffer is needed.
+*/
+
+void plp_mat_trans_in_place_i8s_xpulpv2(int8_t *__restrict__ pSrcDst, uint32_t N);
+
+/** -------------------------------------------------------
+  @brief         Glue code for the parallel in-place transpose of a square 8-bit integer
+                 matrix.
+  @param[in,out] pSrcDst Points to the square matrix of shape NxN, which is transposed in place
+  @param[in]     N       Width and height of the matrix
+  @param[in]     nPE     Number of cores to use for computation
+  @return        none
+*/
+
+void plp_mat_trans_in_place_i8_parallel(int8_t *__restrict__ pSrcDst, uint32_t N, uint32_t nPE);
+
+/** -------------------------------------------------------
+  @brief         Parallel in-place transpose of a square 8-bit integer matrix kernel for XPULPV2
+                 extension.
+  @param[in]     args  pointer to plp_mat_trans_in_place_instance_i8 struct initialized by
+                       plp_mat_trans_in_place_i8_parallel
+  @return        none
+
+  @par Exploiting SIMD instructions
+  The matrix is split into tiles of 4x4 elements, which are loaded and stored as packed words. The
+  tiles on the diagonal are transposed in registers, all other tiles are swapped with the transpose
+  of their mirrored tile. No second buffer is needed.
+
+  Every core takes every nPE-th tile row and swaps it with the mirrored column. The pairs of
+  mirrored elements are disjoint, so the cores need no synchronization.
+*/
+
+void plp_mat_trans_in_place_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief         Glue code for the in-place transpose of a square 32-bit floating-point matrix.
+  @param[in,out] pSrcDst Points to the square matrix of shape NxN, which is transposed in place
+  @param[in]     N       Width and height of the matrix
+  @return        none
+
+  @par This function will use plp_mat_trans_in_place_i32s_xpulpv2 for its
+  computation.
+*/
+
+void plp_mat_trans_in_place_f32(float *__restrict__ pSrcDst, uint32_t N);
+
+/** -------------------------------------------------------
+  @brief         Glue code for the parallel in-place transpose of a square 32-bit floating-point
+                 matrix.
+  @param[in,out] pSrcDst Points to the square matrix of shape NxN, which is transposed in place
+  @param[in]     N       Width and height of the matrix
+  @param[in]     nPE     Number of cores to use for computation
+  @return        none
+
+  @par This function will use plp_mat_trans_in_place_i32p_xpulpv2 for its
+  computation.
 */
 
-void plp_mat_trans_f32_parallel(
-    const float *__restrict__ pSrc, uint32_t M, uint32_t N, uint32_t nPE, float *__restrict__ pDst);
+void plp_mat_trans_in_place_f32_parallel(float *__restrict__ pSrcDst, uint32_t N, uint32_t nPE);
 
 /** -------------------------------------------------------
   @brief      Glue code for matrix inverse of a 32-bit floating-point matrices.
@@ -10664,8 +17911,8 @@ void plp_mat_mult_cmplx_stride_i16s_rv32im(const int16_t *__restrict__ pSrcA,
   @return     none
 
   @par Exploiting SIMD instructions
-  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+  Computes blocks of 2x2 output elements. Every 32 bit vector holds one complex value, and every
+  complex multiply-accumulate takes two dot products.
 */
 
 void plp_mat_mult_cmplx_stride_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
@@ -10711,8 +17958,8 @@ void plp_mat_mult_cmplx_stride_i16_parallel(const int16_t *__restrict__ pSrcA,
   @return     none
 
   @par Exploiting SIMD instructions
-  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+  Computes blocks of 2x2 output elements. Every 32 bit vector holds one complex value, and every
+  complex multiply-accumulate takes two dot products.
 */
 
 void plp_mat_mult_cmplx_stride_i16p_xpulpv2(void *args);
@@ -10779,8 +18026,8 @@ void plp_mat_mult_cmplx_stride_i8s_rv32im(const int8_t *__restrict__ pSrcA,
   @return     none
 
   @par Exploiting SIMD instructions
-  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+  Computes blocks of 2x2 output elements. Every 32 bit vector holds two complex values, and every
+  complex multiply-accumulate takes two dot products.
 */
 
 void plp_mat_mult_cmplx_stride_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
@@ -10826,8 +18073,8 @@ void plp_mat_mult_cmplx_stride_i8_parallel(const int8_t *__restrict__ pSrcA,
   @return     none
 
   @par Exploiting SIMD instructions
-  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+  Computes blocks of 2x2 output elements. Every 32 bit vector holds two complex values, and every
+  complex multiply-accumulate takes two dot products.
 */
 
 void plp_mat_mult_cmplx_stride_i8p_xpulpv2(void *args);
@@ -10868,6 +18115,9 @@ void plp_mat_mult_cmplx_stride_f32(const float *__restrict__ pSrcA,
   @param[in]  strideC Stride of output matrix C (Elements between each row)
   @param[out] pDstC   Points to the output matrix of shape MxO
   @return     none
+
+  @par Blocking
+  Computes blocks of 2x2 output elements, such that every loaded value is used twice.
 */
 
 void plp_mat_mult_cmplx_stride_f32s_xpulpv2(const float *__restrict__ pSrcA,
@@ -10911,6 +18161,9 @@ void plp_mat_mult_cmplx_stride_f32_parallel(const float *__restrict__ pSrcA,
   @param[in]  args    pointer to plp_mat_mult_cmplx_stride_instance_f32 struct initialized by
                     plp_mat_mult_cmplx_stride_f32_parallel
   @return     none
+
+  @par Blocking
+  Computes blocks of 2x2 output elements, such that every loaded value is used twice.
 */
 
 void plp_mat_mult_cmplx_stride_f32p_xpulpv2(void *args);
@@ -11170,8 +18423,8 @@ void plp_mat_mult_cmplx_stride_q16s_rv32im(const int16_t *__restrict__ pSrcA,
   `shift` parameter such that no overflow occurrs.
 
   @par Exploiting SIMD instructions
-  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+  Computes blocks of 2x2 output elements. Every 32 bit vector holds one complex value, and every
+  complex multiply-accumulate takes two dot products.
 */
 
 void plp_mat_mult_cmplx_stride_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
@@ -11239,8 +18492,8 @@ void plp_mat_mult_cmplx_stride_q16_parallel(const int16_t *__restrict__ pSrcA,
   `shift` parameter such that no overflow occurrs.
 
   @par Exploiting SIMD instructions
-  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+  Computes blocks of 2x2 output elements. Every 32 bit vector holds one complex value, and every
+  complex multiply-accumulate takes two dot products.
 */
 
 void plp_mat_mult_cmplx_stride_q16p_xpulpv2(void *args);
@@ -11586,8 +18839,8 @@ void plp_mat_mult_trans_cmplx_stride_i16s_rv32im(const int16_t *__restrict__ pSr
   @return     none
 
   @par Exploiting SIMD instructions
-  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+  Computes blocks of 2x2 output elements. Every 32 bit vector holds one complex value, and every
+  complex multiply-accumulate takes two dot products.
 */
 
 void plp_mat_mult_trans_cmplx_stride_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
@@ -11635,8 +18888,8 @@ void plp_mat_mult_trans_cmplx_stride_i16_parallel(const int16_t *__restrict__ pS
   @return     none
 
   @par Exploiting SIMD instructions
-  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+  Computes blocks of 2x2 output elements. Every 32 bit vector holds one complex value, and every
+  complex multiply-accumulate takes two dot products.
 */
 
 void plp_mat_mult_trans_cmplx_stride_i16p_xpulpv2(void *args);
@@ -11703,8 +18956,8 @@ void plp_mat_mult_trans_cmplx_stride_i8s_rv32im(const int8_t *__restrict__ pSrcA
   @return     none
 
   @par Exploiting SIMD instructions
-  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+  Computes blocks of 2x2 output elements. Every 32 bit vector holds two complex values, and every
+  complex multiply-accumulate takes two dot products.
 */
 
 void plp_mat_mult_trans_cmplx_stride_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
@@ -11752,8 +19005,8 @@ void plp_mat_mult_trans_cmplx_stride_i8_parallel(const int8_t *__restrict__ pSrc
   @return     none
 
   @par Exploiting SIMD instructions
-  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+  Computes blocks of 2x2 output elements. Every 32 bit vector holds two complex values, and every
+  complex multiply-accumulate takes two dot products.
 */
 
 void plp_mat_mult_trans_cmplx_stride_i8p_xpulpv2(void *args);
@@ -11794,6 +19047,9 @@ void plp_mat_mult_trans_cmplx_stride_f32(const float *__restrict__ pSrcA,
   @param[in]  strideC Stride of output matrix C (Elements between each row)
   @param[out] pDstC   Points to the output matrix of shape MxO
   @return     none
+
+  @par Blocking
+  Computes blocks of 2x2 output elements, such that every loaded value is used twice.
 */
 
 void plp_mat_mult_trans_cmplx_stride_f32s_xpulpv2(const float *__restrict__ pSrcA,
@@ -11839,6 +19095,9 @@ void plp_mat_mult_trans_cmplx_stride_f32_parallel(const float *__restrict__ pSrc
   @param[in]  args    pointer to plp_mat_mult_cmplx_stride_instance_f32 struct initialized by
                     plp_mat_mult_trans_cmplx_stride_f32_parallel
   @return     none
+
+  @par Blocking
+  Computes blocks of 2x2 output elements, such that every loaded value is used twice.
 */
 
 void plp_mat_mult_trans_cmplx_stride_f32p_xpulpv2(void *args);
@@ -12101,8 +19360,8 @@ void plp_mat_mult_trans_cmplx_stride_q16s_rv32im(const int16_t *__restrict__ pSr
   `shift` parameter such that no overflow occurrs.
 
   @par Exploiting SIMD instructions
-  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+  Computes blocks of 2x2 output elements. Every 32 bit vector holds one complex value, and every
+  complex multiply-accumulate takes two dot products.
 */
 
 void plp_mat_mult_trans_cmplx_stride_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
@@ -12171,8 +19430,8 @@ void plp_mat_mult_trans_cmplx_stride_q16_parallel(const int16_t *__restrict__ pS
   `shift` parameter such that no overflow occurrs.
 
   @par Exploiting SIMD instructions
-  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+  Computes blocks of 2x2 output elements. Every 32 bit vector holds one complex value, and every
+  complex multiply-accumulate takes two dot products.
 */
 
 void plp_mat_mult_trans_cmplx_stride_q16p_xpulpv2(void *args);
@@ -14560,6 +21819,338 @@ void plp_mat_copy_stride_f32_parallel(const float *__restrict__ pSrc,
 
 void plp_mat_copy_stride_f32p_xpulpv2(void *args);
 
+/** -------------------------------------------------------
+  @brief      Glue code to transpose an MxN strided 32-bit integer matrix
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  strideSrc Stride of the input matrix (elements between each row)
+  @param[in]  strideDst Stride of the output matrix (elements between each row)
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+*/
+
+void plp_mat_trans_stride_i32(const int32_t *__restrict__ pSrc,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t strideSrc,
+                              uint32_t strideDst,
+                              int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Transpose an MxN strided 32-bit integer matrix on RV32IM
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  strideSrc Stride of the input matrix (elements between each row)
+  @param[in]  strideDst Stride of the output matrix (elements between each row)
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+*/
+
+void plp_mat_trans_stride_i32s_rv32im(const int32_t *__restrict__ pSrc,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t strideSrc,
+                                      uint32_t strideDst,
+                                      int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Transpose an MxN strided 32-bit integer matrix on XpulpV2
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  strideSrc Stride of the input matrix (elements between each row)
+  @param[in]  strideDst Stride of the output matrix (elements between each row)
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+
+  @par Tiling
+  Four rows of the input matrix are transposed at once. Every column of this tile is loaded into
+  registers and stored as four consecutive words of the output matrix, instead of four single
+  elements which are strideDst apart.
+*/
+
+void plp_mat_trans_stride_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                                       uint32_t M,
+                                       uint32_t N,
+                                       uint32_t strideSrc,
+                                       uint32_t strideDst,
+                                       int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code to transpose an MxN strided 32-bit integer matrix in parallel
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  strideSrc Stride of the input matrix (elements between each row)
+  @param[in]  strideDst Stride of the output matrix (elements between each row)
+  @param[in]  nPE       Number of cores to use for processing
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+*/
+
+void plp_mat_trans_stride_i32_parallel(const int32_t *__restrict__ pSrc,
+                                       uint32_t M,
+                                       uint32_t N,
+                                       uint32_t strideSrc,
+                                       uint32_t strideDst,
+                                       uint32_t nPE,
+                                       int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Transpose an MxN strided 32-bit integer matrix on XpulpV2 in parallel
+  @param[in]  args  pointer to plp_mat_trans_stride_instance_i32 struct initialized by
+                    plp_mat_trans_stride_i32_parallel
+  @return     none
+
+  @par Tiling
+  Four rows of the input matrix are transposed at once. Every column of this tile is loaded into
+  registers and stored as four consecutive words of the output matrix, instead of four single
+  elements which are strideDst apart.
+
+  Every core transposes every nPE-th tile row, such that the cores write to neighbouring words of
+  the output rows, which are in different banks of the TCDM.
+*/
+
+void plp_mat_trans_stride_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code to transpose an MxN strided 16-bit integer matrix
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  strideSrc Stride of the input matrix (elements between each row)
+  @param[in]  strideDst Stride of the output matrix (elements between each row)
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+*/
+
+void plp_mat_trans_stride_i16(const int16_t *__restrict__ pSrc,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t strideSrc,
+                              uint32_t strideDst,
+                              int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Transpose an MxN strided 16-bit integer matrix on RV32IM
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  strideSrc Stride of the input matrix (elements between each row)
+  @param[in]  strideDst Stride of the output matrix (elements between each row)
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+*/
+
+void plp_mat_trans_stride_i16s_rv32im(const int16_t *__restrict__ pSrc,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t strideSrc,
+                                      uint32_t strideDst,
+                                      int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Transpose an MxN strided 16-bit integer matrix on XpulpV2
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  strideSrc Stride of the input matrix (elements between each row)
+  @param[in]  strideDst Stride of the output matrix (elements between each row)
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The input matrix is split into tiles of 2x2 elements. The two rows of a tile are loaded as two
+  packed words, transposed in registers with two shuffles and stored as two packed words. All
+  accesses to the memory are words instead of single elements.
+*/
+
+void plp_mat_trans_stride_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                                       uint32_t M,
+                                       uint32_t N,
+                                       uint32_t strideSrc,
+                                       uint32_t strideDst,
+                                       int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code to transpose an MxN strided 16-bit integer matrix in parallel
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  strideSrc Stride of the input matrix (elements between each row)
+  @param[in]  strideDst Stride of the output matrix (elements between each row)
+  @param[in]  nPE       Number of cores to use for processing
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+*/
+
+void plp_mat_trans_stride_i16_parallel(const int16_t *__restrict__ pSrc,
+                                       uint32_t M,
+                                       uint32_t N,
+                                       uint32_t strideSrc,
+                                       uint32_t strideDst,
+                                       uint32_t nPE,
+                                       int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Transpose an MxN strided 16-bit integer matrix on XpulpV2 in parallel
+  @param[in]  args  pointer to plp_mat_trans_stride_instance_i16 struct initialized by
+                    plp_mat_trans_stride_i16_parallel
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The input matrix is split into tiles of 2x2 elements. The two rows of a tile are loaded as two
+  packed words, transposed in registers with two shuffles and stored as two packed words. All
+  accesses to the memory are words instead of single elements.
+
+  Every core transposes every nPE-th tile row, such that the cores write to neighbouring words of
+  the output rows, which are in different banks of the TCDM.
+*/
+
+void plp_mat_trans_stride_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code to transpose an MxN strided 8-bit integer matrix
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  strideSrc Stride of the input matrix (elements between each row)
+  @param[in]  strideDst Stride of the output matrix (elements between each row)
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+*/
+
+void plp_mat_trans_stride_i8(const int8_t *__restrict__ pSrc,
+                             uint32_t M,
+                             uint32_t N,
+                             uint32_t strideSrc,
+                             uint32_t strideDst,
+                             int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Transpose an MxN strided 8-bit integer matrix on RV32IM
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  strideSrc Stride of the input matrix (elements between each row)
+  @param[in]  strideDst Stride of the output matrix (elements between each row)
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+*/
+
+void plp_mat_trans_stride_i8s_rv32im(const int8_t *__restrict__ pSrc,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t strideSrc,
+                                     uint32_t strideDst,
+                                     int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Transpose an MxN strided 8-bit integer matrix on XpulpV2
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  strideSrc Stride of the input matrix (elements between each row)
+  @param[in]  strideDst Stride of the output matrix (elements between each row)
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The input matrix is split into tiles of 4x4 elements. The four rows of a tile are loaded as four
+  packed words, transposed in registers with eight shuffles and stored as four packed words. All
+  accesses to the memory are words instead of single elements.
+*/
+
+void plp_mat_trans_stride_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t strideSrc,
+                                      uint32_t strideDst,
+                                      int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code to transpose an MxN strided 8-bit integer matrix in parallel
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  strideSrc Stride of the input matrix (elements between each row)
+  @param[in]  strideDst Stride of the output matrix (elements between each row)
+  @param[in]  nPE       Number of cores to use for processing
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+*/
+
+void plp_mat_trans_stride_i8_parallel(const int8_t *__restrict__ pSrc,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t strideSrc,
+                                      uint32_t strideDst,
+                                      uint32_t nPE,
+                                      int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Transpose an MxN strided 8-bit integer matrix on XpulpV2 in parallel
+  @param[in]  args  pointer to plp_mat_trans_stride_instance_i8 struct initialized by
+                    plp_mat_trans_stride_i8_parallel
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The input matrix is split into tiles of 4x4 elements. The four rows of a tile are loaded as four
+  packed words, transposed in registers with eight shuffles and stored as four packed words. All
+  accesses to the memory are words instead of single elements.
+
+  Every core transposes every nPE-th tile row, such that the cores write to neighbouring words of
+  the output rows, which are in different banks of the TCDM.
+*/
+
+void plp_mat_trans_stride_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code to transpose an MxN strided 32-bit floating-point matrix
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  strideSrc Stride of the input matrix (elements between each row)
+  @param[in]  strideDst Stride of the output matrix (elements between each row)
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+
+  @par This function will use plp_mat_trans_stride_i32s_xpulpv2 for its
+  computation.
+*/
+
+void plp_mat_trans_stride_f32(const float *__restrict__ pSrc,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t strideSrc,
+                              uint32_t strideDst,
+                              float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code to transpose an MxN strided 32-bit floating-point matrix in parallel
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  strideSrc Stride of the input matrix (elements between each row)
+  @param[in]  strideDst Stride of the output matrix (elements between each row)
+  @param[in]  nPE       Number of cores to use for processing
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+
+  @par This function will use plp_mat_trans_stride_i32p_xpulpv2 for its
+  computation.
+*/
+
+void plp_mat_trans_stride_f32_parallel(const float *__restrict__ pSrc,
+                                       uint32_t M,
+                                       uint32_t N,
+                                       uint32_t strideSrc,
+                                       uint32_t strideDst,
+                                       uint32_t nPE,
+                                       float *__restrict__ pDst);
+
 /**
   @brief Glue code for complex conjugate of 32-bit float vectors.
   @param[in]     pSrc        points to the input vector
@@ -88,6 +88,8 @@ void plp_abs_i32(const int32_t * pSrc,
                  int32_t * pDst,
                  uint32_t blockSize) {
 
+    PLP_PROFILE_FUNC();
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
       plp_abs_i32s_rv32im(pSrc, pDst, blockSize);
     } else {
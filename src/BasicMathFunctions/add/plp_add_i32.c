@@ -91,6 +91,8 @@ void plp_add_i32(const int32_t * pSrcA,
                  int32_t * pDst,
                  uint32_t blockSize) {
 
+    PLP_PROFILE_FUNC();
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
       plp_add_i32s_rv32im(pSrcA, pSrcB, pDst, blockSize);
     } else {
@@ -58,6 +58,8 @@ void plp_dot_prod_f32(const float32_t *__restrict__ pSrcA,
                       uint32_t blockSize,
                       float32_t *__restrict__ pRes) {
 
+    PLP_PROFILE_FUNC();
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         printf("error: FC doesn't have FPU\n");
         return;
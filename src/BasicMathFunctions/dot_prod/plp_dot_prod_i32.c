@@ -89,6 +89,8 @@ void plp_dot_prod_i32(const int32_t *__restrict__ pSrcA,
                       uint32_t blockSize,
                       int32_t *__restrict__ pRes) {
 
+    PLP_PROFILE_FUNC();
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         plp_dot_prod_i32s_rv32im(pSrcA, pSrcB, blockSize, pRes);
     } else {
@@ -60,11 +60,15 @@ void plp_dot_prod_i32_parallel(const int32_t *__restrict__ pSrcA,
                                uint32_t nPE,
                                int32_t *__restrict__ pRes) {
 
+    PLP_PROFILE_FUNC();
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         printf("parallel processing supported only for cluster side\n");
         return;
     } else {
 
+        plp_dispatch_select(PLP_DISPATCH_DOT_PROD_I32, blockSize, &nPE, NULL);
+
         uint32_t i, tmpblkSizePE = blockSize / nPE;
         int32_t resBuffer[rt_nb_pe()];
         // initialize results buffer
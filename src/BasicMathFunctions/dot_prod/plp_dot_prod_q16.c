@@ -64,6 +64,8 @@ void plp_dot_prod_q16(const int16_t *__restrict__ pSrcA,
                       uint32_t deciPoint,
                       int32_t *__restrict__ pRes) {
 
+    PLP_PROFILE_FUNC();
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         plp_dot_prod_q16s_rv32im(pSrcA, pSrcB, blockSize, deciPoint, pRes);
     } else {
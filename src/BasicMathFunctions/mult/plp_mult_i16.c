@@ -59,6 +59,8 @@ void plp_mult_i16(const int16_t * pSrcA,
                  int32_t * pDst,
                  uint32_t blockSize) {
 
+    PLP_PROFILE_FUNC();
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
       plp_mult_i16s_rv32im(pSrcA, pSrcB, pDst, blockSize);
     } else {
@@ -0,0 +1,128 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_stream_basic_math.c
+ * Description:  Streaming adapters of the basic math functions
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_const_structs.h"
+
+/**
+  @ingroup Stream
+ */
+
+/**
+  @defgroup StreamBasicMath Streaming Adapters of the Basic Math Functions
+  Operations for plp_stream which compute a tile with the single-core XPULPV2 kernels of the basic
+  math functions. add and mult are PLP_STREAM_MAP operations with two inputs, abs has one input.
+  dot_prod is a PLP_STREAM_REDUCE operation with a 32-bit result.
+ */
+
+/**
+  @addtogroup StreamBasicMath
+  @{
+ */
+
+static void plp_stream_add_i32_kernel(
+    const void *pSrcA, const void *pSrcB, uint32_t len, void *pDst, const void *args) {
+    plp_add_i32s_xpulpv2((const int32_t *)pSrcA, (const int32_t *)pSrcB, (int32_t *)pDst, len);
+}
+
+static void plp_stream_add_i16_kernel(
+    const void *pSrcA, const void *pSrcB, uint32_t len, void *pDst, const void *args) {
+    plp_add_i16s_xpulpv2((const int16_t *)pSrcA, (const int16_t *)pSrcB, (int32_t *)pDst, len);
+}
+
+static void plp_stream_add_i8_kernel(
+    const void *pSrcA, const void *pSrcB, uint32_t len, void *pDst, const void *args) {
+    plp_add_i8s_xpulpv2((const int8_t *)pSrcA, (const int8_t *)pSrcB, (int32_t *)pDst, len);
+}
+
+static void plp_stream_mult_i32_kernel(
+    const void *pSrcA, const void *pSrcB, uint32_t len, void *pDst, const void *args) {
+    plp_mult_i32s_xpulpv2((const int32_t *)pSrcA, (const int32_t *)pSrcB, (int32_t *)pDst, len);
+}
+
+static void plp_stream_mult_i16_kernel(
+    const void *pSrcA, const void *pSrcB, uint32_t len, void *pDst, const void *args) {
+    plp_mult_i16s_xpulpv2((const int16_t *)pSrcA, (const int16_t *)pSrcB, (int32_t *)pDst, len);
+}
+
+static void plp_stream_mult_i8_kernel(
+    const void *pSrcA, const void *pSrcB, uint32_t len, void *pDst, const void *args) {
+    plp_mult_i8s_xpulpv2((const int8_t *)pSrcA, (const int8_t *)pSrcB, (int32_t *)pDst, len);
+}
+
+static void plp_stream_abs_i32_kernel(
+    const void *pSrcA, const void *pSrcB, uint32_t len, void *pDst, const void *args) {
+    plp_abs_i32s_xpulpv2((const int32_t *)pSrcA, (int32_t *)pDst, len);
+}
+
+static void plp_stream_abs_i16_kernel(
+    const void *pSrcA, const void *pSrcB, uint32_t len, void *pDst, const void *args) {
+    plp_abs_i16s_xpulpv2((const int16_t *)pSrcA, (int16_t *)pDst, len);
+}
+
+static void plp_stream_abs_i8_kernel(
+    const void *pSrcA, const void *pSrcB, uint32_t len, void *pDst, const void *args) {
+    plp_abs_i8s_xpulpv2((const int8_t *)pSrcA, (int8_t *)pDst, len);
+}
+
+static void plp_stream_dot_prod_i32_kernel(
+    const void *pSrcA, const void *pSrcB, uint32_t len, void *pDst, const void *args) {
+    plp_dot_prod_i32s_xpulpv2((const int32_t *)pSrcA, (const int32_t *)pSrcB, len, (int32_t *)pDst);
+}
+
+static void plp_stream_dot_prod_i16_kernel(
+    const void *pSrcA, const void *pSrcB, uint32_t len, void *pDst, const void *args) {
+    plp_dot_prod_i16s_xpulpv2((const int16_t *)pSrcA, (const int16_t *)pSrcB, len, (int32_t *)pDst);
+}
+
+static void plp_stream_dot_prod_i8_kernel(
+    const void *pSrcA, const void *pSrcB, uint32_t len, void *pDst, const void *args) {
+    plp_dot_prod_i8s_xpulpv2((const int8_t *)pSrcA, (const int8_t *)pSrcB, len, (int32_t *)pDst);
+}
+
+const plp_stream_op plp_stream_add_i32 = { plp_stream_add_i32_kernel, NULL, PLP_STREAM_MAP, 4, 4 };
+const plp_stream_op plp_stream_add_i16 = { plp_stream_add_i16_kernel, NULL, PLP_STREAM_MAP, 2, 4 };
+const plp_stream_op plp_stream_add_i8 = { plp_stream_add_i8_kernel, NULL, PLP_STREAM_MAP, 1, 4 };
+const plp_stream_op plp_stream_mult_i32 = { plp_stream_mult_i32_kernel, NULL,
+                                            PLP_STREAM_MAP, 4, 4 };
+const plp_stream_op plp_stream_mult_i16 = { plp_stream_mult_i16_kernel, NULL,
+                                            PLP_STREAM_MAP, 2, 4 };
+const plp_stream_op plp_stream_mult_i8 = { plp_stream_mult_i8_kernel, NULL, PLP_STREAM_MAP, 1, 4 };
+const plp_stream_op plp_stream_abs_i32 = { plp_stream_abs_i32_kernel, NULL, PLP_STREAM_MAP, 4, 4 };
+const plp_stream_op plp_stream_abs_i16 = { plp_stream_abs_i16_kernel, NULL, PLP_STREAM_MAP, 2, 2 };
+const plp_stream_op plp_stream_abs_i8 = { plp_stream_abs_i8_kernel, NULL, PLP_STREAM_MAP, 1, 1 };
+const plp_stream_op plp_stream_dot_prod_i32 = { plp_stream_dot_prod_i32_kernel, plp_stream_sum_i32,
+                                                PLP_STREAM_REDUCE, 4, 4 };
+const plp_stream_op plp_stream_dot_prod_i16 = { plp_stream_dot_prod_i16_kernel, plp_stream_sum_i32,
+                                                PLP_STREAM_REDUCE, 2, 4 };
+const plp_stream_op plp_stream_dot_prod_i8 = { plp_stream_dot_prod_i8_kernel, plp_stream_sum_i32,
+                                               PLP_STREAM_REDUCE, 1, 4 };
+
+/**
+  @} end of StreamBasicMath group
+ */
@@ -2663,6 +2663,3252 @@ const int16_t twiddleCoef_4096_q16[6144] = {
     (int16_t)0xFF9B, (int16_t)0x8000, (int16_t)0xFFCD, (int16_t)0x8000
 };
 
+/**
+  @par
+  Example code for q31 Twiddle factors Generation::
+  @par
+  <pre>for (i = 0; i< 3N/4; i++)
+  {
+     twiddleCoefq31[2*i]   = cos(i * 2*PI/(float)N);
+     twiddleCoefq31[2*i+1] = sin(i * 2*PI/(float)N);
+  } </pre>
+  @par
+  where N = 16, PI = 3.14159265358979
+  @par
+  Cos and Sin values are interleaved fashion
+  @par
+  Convert Floating point to q31(Fixed point 1.31):
+        round(twiddleCoefq31(i) * pow(2, 31))
+ */
+const int32_t twiddleCoef_16_q32[24] = {
+    (int32_t)0x7FFFFFFF, (int32_t)0x00000000, (int32_t)0x7641AF3D, (int32_t)0x30FBC54D,
+    (int32_t)0x5A82799A, (int32_t)0x5A82799A, (int32_t)0x30FBC54D, (int32_t)0x7641AF3D,
+    (int32_t)0x00000000, (int32_t)0x7FFFFFFF, (int32_t)0xCF043AB3, (int32_t)0x7641AF3D,
+    (int32_t)0xA57D8666, (int32_t)0x5A82799A, (int32_t)0x89BE50C3, (int32_t)0x30FBC54D,
+    (int32_t)0x80000000, (int32_t)0x00000000, (int32_t)0x89BE50C3, (int32_t)0xCF043AB3,
+    (int32_t)0xA57D8666, (int32_t)0xA57D8666, (int32_t)0xCF043AB3, (int32_t)0x89BE50C3
+};
+
+/**
+  @par
+  Example code for q31 Twiddle factors Generation::
+  @par
+  <pre>for (i = 0; i< 3N/4; i++)
+  {
+     twiddleCoefq31[2*i]   = cos(i * 2*PI/(float)N);
+     twiddleCoefq31[2*i+1] = sin(i * 2*PI/(float)N);
+  } </pre>
+  @par
+  where N = 32, PI = 3.14159265358979
+  @par
+  Cos and Sin values are interleaved fashion
+  @par
+  Convert Floating point to q31(Fixed point 1.31):
+        round(twiddleCoefq31(i) * pow(2, 31))
+ */
+const int32_t twiddleCoef_32_q32[48] = {
+    (int32_t)0x7FFFFFFF, (int32_t)0x00000000, (int32_t)0x7D8A5F40, (int32_t)0x18F8B83C,
+    (int32_t)0x7641AF3D, (int32_t)0x30FBC54D, (int32_t)0x6A6D98A4, (int32_t)0x471CECE7,
+    (int32_t)0x5A82799A, (int32_t)0x5A82799A, (int32_t)0x471CECE7, (int32_t)0x6A6D98A4,
+    (int32_t)0x30FBC54D, (int32_t)0x7641AF3D, (int32_t)0x18F8B83C, (int32_t)0x7D8A5F40,
+    (int32_t)0x00000000, (int32_t)0x7FFFFFFF, (int32_t)0xE70747C4, (int32_t)0x7D8A5F40,
+    (int32_t)0xCF043AB3, (int32_t)0x7641AF3D, (int32_t)0xB8E31319, (int32_t)0x6A6D98A4,
+    (int32_t)0xA57D8666, (int32_t)0x5A82799A, (int32_t)0x9592675C, (int32_t)0x471CECE7,
+    (int32_t)0x89BE50C3, (int32_t)0x30FBC54D, (int32_t)0x8275A0C0, (int32_t)0x18F8B83C,
+    (int32_t)0x80000000, (int32_t)0x00000000, (int32_t)0x8275A0C0, (int32_t)0xE70747C4,
+    (int32_t)0x89BE50C3, (int32_t)0xCF043AB3, (int32_t)0x9592675C, (int32_t)0xB8E31319,
+    (int32_t)0xA57D8666, (int32_t)0xA57D8666, (int32_t)0xB8E31319, (int32_t)0x9592675C,
+    (int32_t)0xCF043AB3, (int32_t)0x89BE50C3, (int32_t)0xE70747C4, (int32_t)0x8275A0C0
+};
+
+/**
+  @par
+  Example code for q31 Twiddle factors Generation::
+  @par
+  <pre>for (i = 0; i< 3N/4; i++)
+  {
+     twiddleCoefq31[2*i]   = cos(i * 2*PI/(float)N);
+     twiddleCoefq31[2*i+1] = sin(i * 2*PI/(float)N);
+  } </pre>
+  @par
+  where N = 64, PI = 3.14159265358979
+  @par
+  Cos and Sin values are interleaved fashion
+  @par
+  Convert Floating point to q31(Fixed point 1.31):
+        round(twiddleCoefq31(i) * pow(2, 31))
+ */
+const int32_t twiddleCoef_64_q32[96] = {
+    (int32_t)0x7FFFFFFF, (int32_t)0x00000000, (int32_t)0x7F62368F, (int32_t)0x0C8BD35E,
+    (int32_t)0x7D8A5F40, (int32_t)0x18F8B83C, (int32_t)0x7A7D055B, (int32_t)0x25280C5E,
+    (int32_t)0x7641AF3D, (int32_t)0x30FBC54D, (int32_t)0x70E2CBC6, (int32_t)0x3C56BA70,
+    (int32_t)0x6A6D98A4, (int32_t)0x471CECE7, (int32_t)0x62F201AC, (int32_t)0x5133CC94,
+    (int32_t)0x5A82799A, (int32_t)0x5A82799A, (int32_t)0x5133CC94, (int32_t)0x62F201AC,
+    (int32_t)0x471CECE7, (int32_t)0x6A6D98A4, (int32_t)0x3C56BA70, (int32_t)0x70E2CBC6,
+    (int32_t)0x30FBC54D, (int32_t)0x7641AF3D, (int32_t)0x25280C5E, (int32_t)0x7A7D055B,
+    (int32_t)0x18F8B83C, (int32_t)0x7D8A5F40, (int32_t)0x0C8BD35E, (int32_t)0x7F62368F,
+    (int32_t)0x00000000, (int32_t)0x7FFFFFFF, (int32_t)0xF3742CA2, (int32_t)0x7F62368F,
+    (int32_t)0xE70747C4, (int32_t)0x7D8A5F40, (int32_t)0xDAD7F3A2, (int32_t)0x7A7D055B,
+    (int32_t)0xCF043AB3, (int32_t)0x7641AF3D, (int32_t)0xC3A94590, (int32_t)0x70E2CBC6,
+    (int32_t)0xB8E31319, (int32_t)0x6A6D98A4, (int32_t)0xAECC336C, (int32_t)0x62F201AC,
+    (int32_t)0xA57D8666, (int32_t)0x5A82799A, (int32_t)0x9D0DFE54, (int32_t)0x5133CC94,
+    (int32_t)0x9592675C, (int32_t)0x471CECE7, (int32_t)0x8F1D343A, (int32_t)0x3C56BA70,
+    (int32_t)0x89BE50C3, (int32_t)0x30FBC54D, (int32_t)0x8582FAA5, (int32_t)0x25280C5E,
+    (int32_t)0x8275A0C0, (int32_t)0x18F8B83C, (int32_t)0x809DC971, (int32_t)0x0C8BD35E,
+    (int32_t)0x80000000, (int32_t)0x00000000, (int32_t)0x809DC971, (int32_t)0xF3742CA2,
+    (int32_t)0x8275A0C0, (int32_t)0xE70747C4, (int32_t)0x8582FAA5, (int32_t)0xDAD7F3A2,
+    (int32_t)0x89BE50C3, (int32_t)0xCF043AB3, (int32_t)0x8F1D343A, (int32_t)0xC3A94590,
+    (int32_t)0x9592675C, (int32_t)0xB8E31319, (int32_t)0x9D0DFE54, (int32_t)0xAECC336C,
+    (int32_t)0xA57D8666, (int32_t)0xA57D8666, (int32_t)0xAECC336C, (int32_t)0x9D0DFE54,
+    (int32_t)0xB8E31319, (int32_t)0x9592675C, (int32_t)0xC3A94590, (int32_t)0x8F1D343A,
+    (int32_t)0xCF043AB3, (int32_t)0x89BE50C3, (int32_t)0xDAD7F3A2, (int32_t)0x8582FAA5,
+    (int32_t)0xE70747C4, (int32_t)0x8275A0C0, (int32_t)0xF3742CA2, (int32_t)0x809DC971
+};
+
+/**
+  @par
+  Example code for q31 Twiddle factors Generation::
+  @par
+  <pre>for (i = 0; i< 3N/4; i++)
+  {
+     twiddleCoefq31[2*i]   = cos(i * 2*PI/(float)N);
+     twiddleCoefq31[2*i+1] = sin(i * 2*PI/(float)N);
+  } </pre>
+  @par
+  where N = 128, PI = 3.14159265358979
+  @par
+  Cos and Sin values are interleaved fashion
+  @par
+  Convert Floating point to q31(Fixed point 1.31):
+        round(twiddleCoefq31(i) * pow(2, 31))
+ */
+const int32_t twiddleCoef_128_q32[192] = {
+    (int32_t)0x7FFFFFFF, (int32_t)0x00000000, (int32_t)0x7FD8878E, (int32_t)0x0647D97C,
+    (int32_t)0x7F62368F, (int32_t)0x0C8BD35E, (int32_t)0x7E9D55FC, (int32_t)0x12C8106F,
+    (int32_t)0x7D8A5F40, (int32_t)0x18F8B83C, (int32_t)0x7C29FBEE, (int32_t)0x1F19F97B,
+    (int32_t)0x7A7D055B, (int32_t)0x25280C5E, (int32_t)0x78848414, (int32_t)0x2B1F34EB,
+    (int32_t)0x7641AF3D, (int32_t)0x30FBC54D, (int32_t)0x73B5EBD1, (int32_t)0x36BA2014,
+    (int32_t)0x70E2CBC6, (int32_t)0x3C56BA70, (int32_t)0x6DCA0D14, (int32_t)0x41CE1E65,
+    (int32_t)0x6A6D98A4, (int32_t)0x471CECE7, (int32_t)0x66CF8120, (int32_t)0x4C3FDFF4,
+    (int32_t)0x62F201AC, (int32_t)0x5133CC94, (int32_t)0x5ED77C8A, (int32_t)0x55F5A4D2,
+    (int32_t)0x5A82799A, (int32_t)0x5A82799A, (int32_t)0x55F5A4D2, (int32_t)0x5ED77C8A,
+    (int32_t)0x5133CC94, (int32_t)0x62F201AC, (int32_t)0x4C3FDFF4, (int32_t)0x66CF8120,
+    (int32_t)0x471CECE7, (int32_t)0x6A6D98A4, (int32_t)0x41CE1E65, (int32_t)0x6DCA0D14,
+    (int32_t)0x3C56BA70, (int32_t)0x70E2CBC6, (int32_t)0x36BA2014, (int32_t)0x73B5EBD1,
+    (int32_t)0x30FBC54D, (int32_t)0x7641AF3D, (int32_t)0x2B1F34EB, (int32_t)0x78848414,
+    (int32_t)0x25280C5E, (int32_t)0x7A7D055B, (int32_t)0x1F19F97B, (int32_t)0x7C29FBEE,
+    (int32_t)0x18F8B83C, (int32_t)0x7D8A5F40, (int32_t)0x12C8106F, (int32_t)0x7E9D55FC,
+    (int32_t)0x0C8BD35E, (int32_t)0x7F62368F, (int32_t)0x0647D97C, (int32_t)0x7FD8878E,
+    (int32_t)0x00000000, (int32_t)0x7FFFFFFF, (int32_t)0xF9B82684, (int32_t)0x7FD8878E,
+    (int32_t)0xF3742CA2, (int32_t)0x7F62368F, (int32_t)0xED37EF91, (int32_t)0x7E9D55FC,
+    (int32_t)0xE70747C4, (int32_t)0x7D8A5F40, (int32_t)0xE0E60685, (int32_t)0x7C29FBEE,
+    (int32_t)0xDAD7F3A2, (int32_t)0x7A7D055B, (int32_t)0xD4E0CB15, (int32_t)0x78848414,
+    (int32_t)0xCF043AB3, (int32_t)0x7641AF3D, (int32_t)0xC945DFEC, (int32_t)0x73B5EBD1,
+    (int32_t)0xC3A94590, (int32_t)0x70E2CBC6, (int32_t)0xBE31E19B, (int32_t)0x6DCA0D14,
+    (int32_t)0xB8E31319, (int32_t)0x6A6D98A4, (int32_t)0xB3C0200C, (int32_t)0x66CF8120,
+    (int32_t)0xAECC336C, (int32_t)0x62F201AC, (int32_t)0xAA0A5B2E, (int32_t)0x5ED77C8A,
+    (int32_t)0xA57D8666, (int32_t)0x5A82799A, (int32_t)0xA1288376, (int32_t)0x55F5A4D2,
+    (int32_t)0x9D0DFE54, (int32_t)0x5133CC94, (int32_t)0x99307EE0, (int32_t)0x4C3FDFF4,
+    (int32_t)0x9592675C, (int32_t)0x471CECE7, (int32_t)0x9235F2EC, (int32_t)0x41CE1E65,
+    (int32_t)0x8F1D343A, (int32_t)0x3C56BA70, (int32_t)0x8C4A142F, (int32_t)0x36BA2014,
+    (int32_t)0x89BE50C3, (int32_t)0x30FBC54D, (int32_t)0x877B7BEC, (int32_t)0x2B1F34EB,
+    (int32_t)0x8582FAA5, (int32_t)0x25280C5E, (int32_t)0x83D60412, (int32_t)0x1F19F97B,
+    (int32_t)0x8275A0C0, (int32_t)0x18F8B83C, (int32_t)0x8162AA04, (int32_t)0x12C8106F,
+    (int32_t)0x809DC971, (int32_t)0x0C8BD35E, (int32_t)0x80277872, (int32_t)0x0647D97C,
+    (int32_t)0x80000000, (int32_t)0x00000000, (int32_t)0x80277872, (int32_t)0xF9B82684,
+    (int32_t)0x809DC971, (int32_t)0xF3742CA2, (int32_t)0x8162AA04, (int32_t)0xED37EF91,
+    (int32_t)0x8275A0C0, (int32_t)0xE70747C4, (int32_t)0x83D60412, (int32_t)0xE0E60685,
+    (int32_t)0x8582FAA5, (int32_t)0xDAD7F3A2, (int32_t)0x877B7BEC, (int32_t)0xD4E0CB15,
+    (int32_t)0x89BE50C3, (int32_t)0xCF043AB3, (int32_t)0x8C4A142F, (int32_t)0xC945DFEC,
+    (int32_t)0x8F1D343A, (int32_t)0xC3A94590, (int32_t)0x9235F2EC, (int32_t)0xBE31E19B,
+    (int32_t)0x9592675C, (int32_t)0xB8E31319, (int32_t)0x99307EE0, (int32_t)0xB3C0200C,
+    (int32_t)0x9D0DFE54, (int32_t)0xAECC336C, (int32_t)0xA1288376, (int32_t)0xAA0A5B2E,
+    (int32_t)0xA57D8666, (int32_t)0xA57D8666, (int32_t)0xAA0A5B2E, (int32_t)0xA1288376,
+    (int32_t)0xAECC336C, (int32_t)0x9D0DFE54, (int32_t)0xB3C0200C, (int32_t)0x99307EE0,
+    (int32_t)0xB8E31319, (int32_t)0x9592675C, (int32_t)0xBE31E19B, (int32_t)0x9235F2EC,
+    (int32_t)0xC3A94590, (int32_t)0x8F1D343A, (int32_t)0xC945DFEC, (int32_t)0x8C4A142F,
+    (int32_t)0xCF043AB3, (int32_t)0x89BE50C3, (int32_t)0xD4E0CB15, (int32_t)0x877B7BEC,
+    (int32_t)0xDAD7F3A2, (int32_t)0x8582FAA5, (int32_t)0xE0E60685, (int32_t)0x83D60412,
+    (int32_t)0xE70747C4, (int32_t)0x8275A0C0, (int32_t)0xED37EF91, (int32_t)0x8162AA04,
+    (int32_t)0xF3742CA2, (int32_t)0x809DC971, (int32_t)0xF9B82684, (int32_t)0x80277872
+};
+
+/**
+  @par
+  Example code for q31 Twiddle factors Generation::
+  @par
+  <pre>for (i = 0; i< 3N/4; i++)
+  {
+     twiddleCoefq31[2*i]   = cos(i * 2*PI/(float)N);
+     twiddleCoefq31[2*i+1] = sin(i * 2*PI/(float)N);
+  } </pre>
+  @par
+  where N = 256, PI = 3.14159265358979
+  @par
+  Cos and Sin values are interleaved fashion
+  @par
+  Convert Floating point to q31(Fixed point 1.31):
+        round(twiddleCoefq31(i) * pow(2, 31))
+ */
+const int32_t twiddleCoef_256_q32[384] = {
+    (int32_t)0x7FFFFFFF, (int32_t)0x00000000, (int32_t)0x7FF62182, (int32_t)0x03242ABF,
+    (int32_t)0x7FD8878E, (int32_t)0x0647D97C, (int32_t)0x7FA736B4, (int32_t)0x096A9049,
+    (int32_t)0x7F62368F, (int32_t)0x0C8BD35E, (int32_t)0x7F0991C4, (int32_t)0x0FAB272B,
+    (int32_t)0x7E9D55FC, (int32_t)0x12C8106F, (int32_t)0x7E1D93EA, (int32_t)0x15E21445,
+    (int32_t)0x7D8A5F40, (int32_t)0x18F8B83C, (int32_t)0x7CE3CEB2, (int32_t)0x1C0B826A,
+    (int32_t)0x7C29FBEE, (int32_t)0x1F19F97B, (int32_t)0x7B5D039E, (int32_t)0x2223A4C5,
+    (int32_t)0x7A7D055B, (int32_t)0x25280C5E, (int32_t)0x798A23B1, (int32_t)0x2826B928,
+    (int32_t)0x78848414, (int32_t)0x2B1F34EB, (int32_t)0x776C4EDB, (int32_t)0x2E110A62,
+    (int32_t)0x7641AF3D, (int32_t)0x30FBC54D, (int32_t)0x7504D345, (int32_t)0x33DEF287,
+    (int32_t)0x73B5EBD1, (int32_t)0x36BA2014, (int32_t)0x72552C85, (int32_t)0x398CDD32,
+    (int32_t)0x70E2CBC6, (int32_t)0x3C56BA70, (int32_t)0x6F5F02B2, (int32_t)0x3F1749B8,
+    (int32_t)0x6DCA0D14, (int32_t)0x41CE1E65, (int32_t)0x6C242960, (int32_t)0x447ACD50,
+    (int32_t)0x6A6D98A4, (int32_t)0x471CECE7, (int32_t)0x68A69E81, (int32_t)0x49B41533,
+    (int32_t)0x66CF8120, (int32_t)0x4C3FDFF4, (int32_t)0x64E88926, (int32_t)0x4EBFE8A5,
+    (int32_t)0x62F201AC, (int32_t)0x5133CC94, (int32_t)0x60EC3830, (int32_t)0x539B2AF0,
+    (int32_t)0x5ED77C8A, (int32_t)0x55F5A4D2, (int32_t)0x5CB420E0, (int32_t)0x5842DD54,
+    (int32_t)0x5A82799A, (int32_t)0x5A82799A, (int32_t)0x5842DD54, (int32_t)0x5CB420E0,
+    (int32_t)0x55F5A4D2, (int32_t)0x5ED77C8A, (int32_t)0x539B2AF0, (int32_t)0x60EC3830,
+    (int32_t)0x5133CC94, (int32_t)0x62F201AC, (int32_t)0x4EBFE8A5, (int32_t)0x64E88926,
+    (int32_t)0x4C3FDFF4, (int32_t)0x66CF8120, (int32_t)0x49B41533, (int32_t)0x68A69E81,
+    (int32_t)0x471CECE7, (int32_t)0x6A6D98A4, (int32_t)0x447ACD50, (int32_t)0x6C242960,
+    (int32_t)0x41CE1E65, (int32_t)0x6DCA0D14, (int32_t)0x3F1749B8, (int32_t)0x6F5F02B2,
+    (int32_t)0x3C56BA70, (int32_t)0x70E2CBC6, (int32_t)0x398CDD32, (int32_t)0x72552C85,
+    (int32_t)0x36BA2014, (int32_t)0x73B5EBD1, (int32_t)0x33DEF287, (int32_t)0x7504D345,
+    (int32_t)0x30FBC54D, (int32_t)0x7641AF3D, (int32_t)0x2E110A62, (int32_t)0x776C4EDB,
+    (int32_t)0x2B1F34EB, (int32_t)0x78848414, (int32_t)0x2826B928, (int32_t)0x798A23B1,
+    (int32_t)0x25280C5E, (int32_t)0x7A7D055B, (int32_t)0x2223A4C5, (int32_t)0x7B5D039E,
+    (int32_t)0x1F19F97B, (int32_t)0x7C29FBEE, (int32_t)0x1C0B826A, (int32_t)0x7CE3CEB2,
+    (int32_t)0x18F8B83C, (int32_t)0x7D8A5F40, (int32_t)0x15E21445, (int32_t)0x7E1D93EA,
+    (int32_t)0x12C8106F, (int32_t)0x7E9D55FC, (int32_t)0x0FAB272B, (int32_t)0x7F0991C4,
+    (int32_t)0x0C8BD35E, (int32_t)0x7F62368F, (int32_t)0x096A9049, (int32_t)0x7FA736B4,
+    (int32_t)0x0647D97C, (int32_t)0x7FD8878E, (int32_t)0x03242ABF, (int32_t)0x7FF62182,
+    (int32_t)0x00000000, (int32_t)0x7FFFFFFF, (int32_t)0xFCDBD541, (int32_t)0x7FF62182,
+    (int32_t)0xF9B82684, (int32_t)0x7FD8878E, (int32_t)0xF6956FB7, (int32_t)0x7FA736B4,
+    (int32_t)0xF3742CA2, (int32_t)0x7F62368F, (int32_t)0xF054D8D5, (int32_t)0x7F0991C4,
+    (int32_t)0xED37EF91, (int32_t)0x7E9D55FC, (int32_t)0xEA1DEBBB, (int32_t)0x7E1D93EA,
+    (int32_t)0xE70747C4, (int32_t)0x7D8A5F40, (int32_t)0xE3F47D96, (int32_t)0x7CE3CEB2,
+    (int32_t)0xE0E60685, (int32_t)0x7C29FBEE, (int32_t)0xDDDC5B3B, (int32_t)0x7B5D039E,
+    (int32_t)0xDAD7F3A2, (int32_t)0x7A7D055B, (int32_t)0xD7D946D8, (int32_t)0x798A23B1,
+    (int32_t)0xD4E0CB15, (int32_t)0x78848414, (int32_t)0xD1EEF59E, (int32_t)0x776C4EDB,
+    (int32_t)0xCF043AB3, (int32_t)0x7641AF3D, (int32_t)0xCC210D79, (int32_t)0x7504D345,
+    (int32_t)0xC945DFEC, (int32_t)0x73B5EBD1, (int32_t)0xC67322CE, (int32_t)0x72552C85,
+    (int32_t)0xC3A94590, (int32_t)0x70E2CBC6, (int32_t)0xC0E8B648, (int32_t)0x6F5F02B2,
+    (int32_t)0xBE31E19B, (int32_t)0x6DCA0D14, (int32_t)0xBB8532B0, (int32_t)0x6C242960,
+    (int32_t)0xB8E31319, (int32_t)0x6A6D98A4, (int32_t)0xB64BEACD, (int32_t)0x68A69E81,
+    (int32_t)0xB3C0200C, (int32_t)0x66CF8120, (int32_t)0xB140175B, (int32_t)0x64E88926,
+    (int32_t)0xAECC336C, (int32_t)0x62F201AC, (int32_t)0xAC64D510, (int32_t)0x60EC3830,
+    (int32_t)0xAA0A5B2E, (int32_t)0x5ED77C8A, (int32_t)0xA7BD22AC, (int32_t)0x5CB420E0,
+    (int32_t)0xA57D8666, (int32_t)0x5A82799A, (int32_t)0xA34BDF20, (int32_t)0x5842DD54,
+    (int32_t)0xA1288376, (int32_t)0x55F5A4D2, (int32_t)0x9F13C7D0, (int32_t)0x539B2AF0,
+    (int32_t)0x9D0DFE54, (int32_t)0x5133CC94, (int32_t)0x9B1776DA, (int32_t)0x4EBFE8A5,
+    (int32_t)0x99307EE0, (int32_t)0x4C3FDFF4, (int32_t)0x9759617F, (int32_t)0x49B41533,
+    (int32_t)0x9592675C, (int32_t)0x471CECE7, (int32_t)0x93DBD6A0, (int32_t)0x447ACD50,
+    (int32_t)0x9235F2EC, (int32_t)0x41CE1E65, (int32_t)0x90A0FD4E, (int32_t)0x3F1749B8,
+    (int32_t)0x8F1D343A, (int32_t)0x3C56BA70, (int32_t)0x8DAAD37B, (int32_t)0x398CDD32,
+    (int32_t)0x8C4A142F, (int32_t)0x36BA2014, (int32_t)0x8AFB2CBB, (int32_t)0x33DEF287,
+    (int32_t)0x89BE50C3, (int32_t)0x30FBC54D, (int32_t)0x8893B125, (int32_t)0x2E110A62,
+    (int32_t)0x877B7BEC, (int32_t)0x2B1F34EB, (int32_t)0x8675DC4F, (int32_t)0x2826B928,
+    (int32_t)0x8582FAA5, (int32_t)0x25280C5E, (int32_t)0x84A2FC62, (int32_t)0x2223A4C5,
+    (int32_t)0x83D60412, (int32_t)0x1F19F97B, (int32_t)0x831C314E, (int32_t)0x1C0B826A,
+    (int32_t)0x8275A0C0, (int32_t)0x18F8B83C, (int32_t)0x81E26C16, (int32_t)0x15E21445,
+    (int32_t)0x8162AA04, (int32_t)0x12C8106F, (int32_t)0x80F66E3C, (int32_t)0x0FAB272B,
+    (int32_t)0x809DC971, (int32_t)0x0C8BD35E, (int32_t)0x8058C94C, (int32_t)0x096A9049,
+    (int32_t)0x80277872, (int32_t)0x0647D97C, (int32_t)0x8009DE7E, (int32_t)0x03242ABF,
+    (int32_t)0x80000000, (int32_t)0x00000000, (int32_t)0x8009DE7E, (int32_t)0xFCDBD541,
+    (int32_t)0x80277872, (int32_t)0xF9B82684, (int32_t)0x8058C94C, (int32_t)0xF6956FB7,
+    (int32_t)0x809DC971, (int32_t)0xF3742CA2, (int32_t)0x80F66E3C, (int32_t)0xF054D8D5,
+    (int32_t)0x8162AA04, (int32_t)0xED37EF91, (int32_t)0x81E26C16, (int32_t)0xEA1DEBBB,
+    (int32_t)0x8275A0C0, (int32_t)0xE70747C4, (int32_t)0x831C314E, (int32_t)0xE3F47D96,
+    (int32_t)0x83D60412, (int32_t)0xE0E60685, (int32_t)0x84A2FC62, (int32_t)0xDDDC5B3B,
+    (int32_t)0x8582FAA5, (int32_t)0xDAD7F3A2, (int32_t)0x8675DC4F, (int32_t)0xD7D946D8,
+    (int32_t)0x877B7BEC, (int32_t)0xD4E0CB15, (int32_t)0x8893B125, (int32_t)0xD1EEF59E,
+    (int32_t)0x89BE50C3, (int32_t)0xCF043AB3, (int32_t)0x8AFB2CBB, (int32_t)0xCC210D79,
+    (int32_t)0x8C4A142F, (int32_t)0xC945DFEC, (int32_t)0x8DAAD37B, (int32_t)0xC67322CE,
+    (int32_t)0x8F1D343A, (int32_t)0xC3A94590, (int32_t)0x90A0FD4E, (int32_t)0xC0E8B648,
+    (int32_t)0x9235F2EC, (int32_t)0xBE31E19B, (int32_t)0x93DBD6A0, (int32_t)0xBB8532B0,
+    (int32_t)0x9592675C, (int32_t)0xB8E31319, (int32_t)0x9759617F, (int32_t)0xB64BEACD,
+    (int32_t)0x99307EE0, (int32_t)0xB3C0200C, (int32_t)0x9B1776DA, (int32_t)0xB140175B,
+    (int32_t)0x9D0DFE54, (int32_t)0xAECC336C, (int32_t)0x9F13C7D0, (int32_t)0xAC64D510,
+    (int32_t)0xA1288376, (int32_t)0xAA0A5B2E, (int32_t)0xA34BDF20, (int32_t)0xA7BD22AC,
+    (int32_t)0xA57D8666, (int32_t)0xA57D8666, (int32_t)0xA7BD22AC, (int32_t)0xA34BDF20,
+    (int32_t)0xAA0A5B2E, (int32_t)0xA1288376, (int32_t)0xAC64D510, (int32_t)0x9F13C7D0,
+    (int32_t)0xAECC336C, (int32_t)0x9D0DFE54, (int32_t)0xB140175B, (int32_t)0x9B1776DA,
+    (int32_t)0xB3C0200C, (int32_t)0x99307EE0, (int32_t)0xB64BEACD, (int32_t)0x9759617F,
+    (int32_t)0xB8E31319, (int32_t)0x9592675C, (int32_t)0xBB8532B0, (int32_t)0x93DBD6A0,
+    (int32_t)0xBE31E19B, (int32_t)0x9235F2EC, (int32_t)0xC0E8B648, (int32_t)0x90A0FD4E,
+    (int32_t)0xC3A94590, (int32_t)0x8F1D343A, (int32_t)0xC67322CE, (int32_t)0x8DAAD37B,
+    (int32_t)0xC945DFEC, (int32_t)0x8C4A142F, (int32_t)0xCC210D79, (int32_t)0x8AFB2CBB,
+    (int32_t)0xCF043AB3, (int32_t)0x89BE50C3, (int32_t)0xD1EEF59E, (int32_t)0x8893B125,
+    (int32_t)0xD4E0CB15, (int32_t)0x877B7BEC, (int32_t)0xD7D946D8, (int32_t)0x8675DC4F,
+    (int32_t)0xDAD7F3A2, (int32_t)0x8582FAA5, (int32_t)0xDDDC5B3B, (int32_t)0x84A2FC62,
+    (int32_t)0xE0E60685, (int32_t)0x83D60412, (int32_t)0xE3F47D96, (int32_t)0x831C314E,
+    (int32_t)0xE70747C4, (int32_t)0x8275A0C0, (int32_t)0xEA1DEBBB, (int32_t)0x81E26C16,
+    (int32_t)0xED37EF91, (int32_t)0x8162AA04, (int32_t)0xF054D8D5, (int32_t)0x80F66E3C,
+    (int32_t)0xF3742CA2, (int32_t)0x809DC971, (int32_t)0xF6956FB7, (int32_t)0x8058C94C,
+    (int32_t)0xF9B82684, (int32_t)0x80277872, (int32_t)0xFCDBD541, (int32_t)0x8009DE7E
+};
+
+/**
+  @par
+  Example code for q31 Twiddle factors Generation::
+  @par
+  <pre>for (i = 0; i< 3N/4; i++)
+  {
+     twiddleCoefq31[2*i]   = cos(i * 2*PI/(float)N);
+     twiddleCoefq31[2*i+1] = sin(i * 2*PI/(float)N);
+  } </pre>
+  @par
+  where N = 512, PI = 3.14159265358979
+  @par
+  Cos and Sin values are interleaved fashion
+  @par
+  Convert Floating point to q31(Fixed point 1.31):
+        round(twiddleCoefq31(i) * pow(2, 31))
+ */
+const int32_t twiddleCoef_512_q32[768] = {
+    (int32_t)0x7FFFFFFF, (int32_t)0x00000000, (int32_t)0x7FFD885A, (int32_t)0x01921D20,
+    (int32_t)0x7FF62182, (int32_t)0x03242ABF, (int32_t)0x7FE9CBC0, (int32_t)0x04B6195D,
+    (int32_t)0x7FD8878E, (int32_t)0x0647D97C, (int32_t)0x7FC25596, (int32_t)0x07D95B9E,
+    (int32_t)0x7FA736B4, (int32_t)0x096A9049, (int32_t)0x7F872BF3, (int32_t)0x0AFB6805,
+    (int32_t)0x7F62368F, (int32_t)0x0C8BD35E, (int32_t)0x7F3857F6, (int32_t)0x0E1BC2E4,
+    (int32_t)0x7F0991C4, (int32_t)0x0FAB272B, (int32_t)0x7ED5E5C6, (int32_t)0x1139F0CF,
+    (int32_t)0x7E9D55FC, (int32_t)0x12C8106F, (int32_t)0x7E5FE493, (int32_t)0x145576B1,
+    (int32_t)0x7E1D93EA, (int32_t)0x15E21445, (int32_t)0x7DD6668F, (int32_t)0x176DD9DE,
+    (int32_t)0x7D8A5F40, (int32_t)0x18F8B83C, (int32_t)0x7D3980EC, (int32_t)0x1A82A026,
+    (int32_t)0x7CE3CEB2, (int32_t)0x1C0B826A, (int32_t)0x7C894BDE, (int32_t)0x1D934FE5,
+    (int32_t)0x7C29FBEE, (int32_t)0x1F19F97B, (int32_t)0x7BC5E290, (int32_t)0x209F701C,
+    (int32_t)0x7B5D039E, (int32_t)0x2223A4C5, (int32_t)0x7AEF6323, (int32_t)0x23A6887F,
+    (int32_t)0x7A7D055B, (int32_t)0x25280C5E, (int32_t)0x7A05EEAD, (int32_t)0x26A82186,
+    (int32_t)0x798A23B1, (int32_t)0x2826B928, (int32_t)0x7909A92D, (int32_t)0x29A3C485,
+    (int32_t)0x78848414, (int32_t)0x2B1F34EB, (int32_t)0x77FAB989, (int32_t)0x2C98FBBA,
+    (int32_t)0x776C4EDB, (int32_t)0x2E110A62, (int32_t)0x76D94989, (int32_t)0x2F875262,
+    (int32_t)0x7641AF3D, (int32_t)0x30FBC54D, (int32_t)0x75A585CF, (int32_t)0x326E54C7,
+    (int32_t)0x7504D345, (int32_t)0x33DEF287, (int32_t)0x745F9DD1, (int32_t)0x354D9057,
+    (int32_t)0x73B5EBD1, (int32_t)0x36BA2014, (int32_t)0x7307C3D0, (int32_t)0x382493B0,
+    (int32_t)0x72552C85, (int32_t)0x398CDD32, (int32_t)0x719E2CD2, (int32_t)0x3AF2EEB7,
+    (int32_t)0x70E2CBC6, (int32_t)0x3C56BA70, (int32_t)0x7023109A, (int32_t)0x3DB832A6,
+    (int32_t)0x6F5F02B2, (int32_t)0x3F1749B8, (int32_t)0x6E96A99D, (int32_t)0x4073F21D,
+    (int32_t)0x6DCA0D14, (int32_t)0x41CE1E65, (int32_t)0x6CF934FC, (int32_t)0x4325C135,
+    (int32_t)0x6C242960, (int32_t)0x447ACD50, (int32_t)0x6B4AF279, (int32_t)0x45CD358F,
+    (int32_t)0x6A6D98A4, (int32_t)0x471CECE7, (int32_t)0x698C246C, (int32_t)0x4869E665,
+    (int32_t)0x68A69E81, (int32_t)0x49B41533, (int32_t)0x67BD0FBD, (int32_t)0x4AFB6C98,
+    (int32_t)0x66CF8120, (int32_t)0x4C3FDFF4, (int32_t)0x65DDFBD3, (int32_t)0x4D8162C4,
+    (int32_t)0x64E88926, (int32_t)0x4EBFE8A5, (int32_t)0x63EF3290, (int32_t)0x4FFB654D,
+    (int32_t)0x62F201AC, (int32_t)0x5133CC94, (int32_t)0x61F1003F, (int32_t)0x5269126E,
+    (int32_t)0x60EC3830, (int32_t)0x539B2AF0, (int32_t)0x5FE3B38D, (int32_t)0x54CA0A4B,
+    (int32_t)0x5ED77C8A, (int32_t)0x55F5A4D2, (int32_t)0x5DC79D7C, (int32_t)0x571DEEFA,
+    (int32_t)0x5CB420E0, (int32_t)0x5842DD54, (int32_t)0x5B9D1154, (int32_t)0x59646498,
+    (int32_t)0x5A82799A, (int32_t)0x5A82799A, (int32_t)0x59646498, (int32_t)0x5B9D1154,
+    (int32_t)0x5842DD54, (int32_t)0x5CB420E0, (int32_t)0x571DEEFA, (int32_t)0x5DC79D7C,
+    (int32_t)0x55F5A4D2, (int32_t)0x5ED77C8A, (int32_t)0x54CA0A4B, (int32_t)0x5FE3B38D,
+    (int32_t)0x539B2AF0, (int32_t)0x60EC3830, (int32_t)0x5269126E, (int32_t)0x61F1003F,
+    (int32_t)0x5133CC94, (int32_t)0x62F201AC, (int32_t)0x4FFB654D, (int32_t)0x63EF3290,
+    (int32_t)0x4EBFE8A5, (int32_t)0x64E88926, (int32_t)0x4D8162C4, (int32_t)0x65DDFBD3,
+    (int32_t)0x4C3FDFF4, (int32_t)0x66CF8120, (int32_t)0x4AFB6C98, (int32_t)0x67BD0FBD,
+    (int32_t)0x49B41533, (int32_t)0x68A69E81, (int32_t)0x4869E665, (int32_t)0x698C246C,
+    (int32_t)0x471CECE7, (int32_t)0x6A6D98A4, (int32_t)0x45CD358F, (int32_t)0x6B4AF279,
+    (int32_t)0x447ACD50, (int32_t)0x6C242960, (int32_t)0x4325C135, (int32_t)0x6CF934FC,
+    (int32_t)0x41CE1E65, (int32_t)0x6DCA0D14, (int32_t)0x4073F21D, (int32_t)0x6E96A99D,
+    (int32_t)0x3F1749B8, (int32_t)0x6F5F02B2, (int32_t)0x3DB832A6, (int32_t)0x7023109A,
+    (int32_t)0x3C56BA70, (int32_t)0x70E2CBC6, (int32_t)0x3AF2EEB7, (int32_t)0x719E2CD2,
+    (int32_t)0x398CDD32, (int32_t)0x72552C85, (int32_t)0x382493B0, (int32_t)0x7307C3D0,
+    (int32_t)0x36BA2014, (int32_t)0x73B5EBD1, (int32_t)0x354D9057, (int32_t)0x745F9DD1,
+    (int32_t)0x33DEF287, (int32_t)0x7504D345, (int32_t)0x326E54C7, (int32_t)0x75A585CF,
+    (int32_t)0x30FBC54D, (int32_t)0x7641AF3D, (int32_t)0x2F875262, (int32_t)0x76D94989,
+    (int32_t)0x2E110A62, (int32_t)0x776C4EDB, (int32_t)0x2C98FBBA, (int32_t)0x77FAB989,
+    (int32_t)0x2B1F34EB, (int32_t)0x78848414, (int32_t)0x29A3C485, (int32_t)0x7909A92D,
+    (int32_t)0x2826B928, (int32_t)0x798A23B1, (int32_t)0x26A82186, (int32_t)0x7A05EEAD,
+    (int32_t)0x25280C5E, (int32_t)0x7A7D055B, (int32_t)0x23A6887F, (int32_t)0x7AEF6323,
+    (int32_t)0x2223A4C5, (int32_t)0x7B5D039E, (int32_t)0x209F701C, (int32_t)0x7BC5E290,
+    (int32_t)0x1F19F97B, (int32_t)0x7C29FBEE, (int32_t)0x1D934FE5, (int32_t)0x7C894BDE,
+    (int32_t)0x1C0B826A, (int32_t)0x7CE3CEB2, (int32_t)0x1A82A026, (int32_t)0x7D3980EC,
+    (int32_t)0x18F8B83C, (int32_t)0x7D8A5F40, (int32_t)0x176DD9DE, (int32_t)0x7DD6668F,
+    (int32_t)0x15E21445, (int32_t)0x7E1D93EA, (int32_t)0x145576B1, (int32_t)0x7E5FE493,
+    (int32_t)0x12C8106F, (int32_t)0x7E9D55FC, (int32_t)0x1139F0CF, (int32_t)0x7ED5E5C6,
+    (int32_t)0x0FAB272B, (int32_t)0x7F0991C4, (int32_t)0x0E1BC2E4, (int32_t)0x7F3857F6,
+    (int32_t)0x0C8BD35E, (int32_t)0x7F62368F, (int32_t)0x0AFB6805, (int32_t)0x7F872BF3,
+    (int32_t)0x096A9049, (int32_t)0x7FA736B4, (int32_t)0x07D95B9E, (int32_t)0x7FC25596,
+    (int32_t)0x0647D97C, (int32_t)0x7FD8878E, (int32_t)0x04B6195D, (int32_t)0x7FE9CBC0,
+    (int32_t)0x03242ABF, (int32_t)0x7FF62182, (int32_t)0x01921D20, (int32_t)0x7FFD885A,
+    (int32_t)0x00000000, (int32_t)0x7FFFFFFF, (int32_t)0xFE6DE2E0, (int32_t)0x7FFD885A,
+    (int32_t)0xFCDBD541, (int32_t)0x7FF62182, (int32_t)0xFB49E6A3, (int32_t)0x7FE9CBC0,
+    (int32_t)0xF9B82684, (int32_t)0x7FD8878E, (int32_t)0xF826A462, (int32_t)0x7FC25596,
+    (int32_t)0xF6956FB7, (int32_t)0x7FA736B4, (int32_t)0xF50497FB, (int32_t)0x7F872BF3,
+    (int32_t)0xF3742CA2, (int32_t)0x7F62368F, (int32_t)0xF1E43D1C, (int32_t)0x7F3857F6,
+    (int32_t)0xF054D8D5, (int32_t)0x7F0991C4, (int32_t)0xEEC60F31, (int32_t)0x7ED5E5C6,
+    (int32_t)0xED37EF91, (int32_t)0x7E9D55FC, (int32_t)0xEBAA894F, (int32_t)0x7E5FE493,
+    (int32_t)0xEA1DEBBB, (int32_t)0x7E1D93EA, (int32_t)0xE8922622, (int32_t)0x7DD6668F,
+    (int32_t)0xE70747C4, (int32_t)0x7D8A5F40, (int32_t)0xE57D5FDA, (int32_t)0x7D3980EC,
+    (int32_t)0xE3F47D96, (int32_t)0x7CE3CEB2, (int32_t)0xE26CB01B, (int32_t)0x7C894BDE,
+    (int32_t)0xE0E60685, (int32_t)0x7C29FBEE, (int32_t)0xDF608FE4, (int32_t)0x7BC5E290,
+    (int32_t)0xDDDC5B3B, (int32_t)0x7B5D039E, (int32_t)0xDC597781, (int32_t)0x7AEF6323,
+    (int32_t)0xDAD7F3A2, (int32_t)0x7A7D055B, (int32_t)0xD957DE7A, (int32_t)0x7A05EEAD,
+    (int32_t)0xD7D946D8, (int32_t)0x798A23B1, (int32_t)0xD65C3B7B, (int32_t)0x7909A92D,
+    (int32_t)0xD4E0CB15, (int32_t)0x78848414, (int32_t)0xD3670446, (int32_t)0x77FAB989,
+    (int32_t)0xD1EEF59E, (int32_t)0x776C4EDB, (int32_t)0xD078AD9E, (int32_t)0x76D94989,
+    (int32_t)0xCF043AB3, (int32_t)0x7641AF3D, (int32_t)0xCD91AB39, (int32_t)0x75A585CF,
+    (int32_t)0xCC210D79, (int32_t)0x7504D345, (int32_t)0xCAB26FA9, (int32_t)0x745F9DD1,
+    (int32_t)0xC945DFEC, (int32_t)0x73B5EBD1, (int32_t)0xC7DB6C50, (int32_t)0x7307C3D0,
+    (int32_t)0xC67322CE, (int32_t)0x72552C85, (int32_t)0xC50D1149, (int32_t)0x719E2CD2,
+    (int32_t)0xC3A94590, (int32_t)0x70E2CBC6, (int32_t)0xC247CD5A, (int32_t)0x7023109A,
+    (int32_t)0xC0E8B648, (int32_t)0x6F5F02B2, (int32_t)0xBF8C0DE3, (int32_t)0x6E96A99D,
+    (int32_t)0xBE31E19B, (int32_t)0x6DCA0D14, (int32_t)0xBCDA3ECB, (int32_t)0x6CF934FC,
+    (int32_t)0xBB8532B0, (int32_t)0x6C242960, (int32_t)0xBA32CA71, (int32_t)0x6B4AF279,
+    (int32_t)0xB8E31319, (int32_t)0x6A6D98A4, (int32_t)0xB796199B, (int32_t)0x698C246C,
+    (int32_t)0xB64BEACD, (int32_t)0x68A69E81, (int32_t)0xB5049368, (int32_t)0x67BD0FBD,
+    (int32_t)0xB3C0200C, (int32_t)0x66CF8120, (int32_t)0xB27E9D3C, (int32_t)0x65DDFBD3,
+    (int32_t)0xB140175B, (int32_t)0x64E88926, (int32_t)0xB0049AB3, (int32_t)0x63EF3290,
+    (int32_t)0xAECC336C, (int32_t)0x62F201AC, (int32_t)0xAD96ED92, (int32_t)0x61F1003F,
+    (int32_t)0xAC64D510, (int32_t)0x60EC3830, (int32_t)0xAB35F5B5, (int32_t)0x5FE3B38D,
+    (int32_t)0xAA0A5B2E, (int32_t)0x5ED77C8A, (int32_t)0xA8E21106, (int32_t)0x5DC79D7C,
+    (int32_t)0xA7BD22AC, (int32_t)0x5CB420E0, (int32_t)0xA69B9B68, (int32_t)0x5B9D1154,
+    (int32_t)0xA57D8666, (int32_t)0x5A82799A, (int32_t)0xA462EEAC, (int32_t)0x59646498,
+    (int32_t)0xA34BDF20, (int32_t)0x5842DD54, (int32_t)0xA2386284, (int32_t)0x571DEEFA,
+    (int32_t)0xA1288376, (int32_t)0x55F5A4D2, (int32_t)0xA01C4C73, (int32_t)0x54CA0A4B,
+    (int32_t)0x9F13C7D0, (int32_t)0x539B2AF0, (int32_t)0x9E0EFFC1, (int32_t)0x5269126E,
+    (int32_t)0x9D0DFE54, (int32_t)0x5133CC94, (int32_t)0x9C10CD70, (int32_t)0x4FFB654D,
+    (int32_t)0x9B1776DA, (int32_t)0x4EBFE8A5, (int32_t)0x9A22042D, (int32_t)0x4D8162C4,
+    (int32_t)0x99307EE0, (int32_t)0x4C3FDFF4, (int32_t)0x9842F043, (int32_t)0x4AFB6C98,
+    (int32_t)0x9759617F, (int32_t)0x49B41533, (int32_t)0x9673DB94, (int32_t)0x4869E665,
+    (int32_t)0x9592675C, (int32_t)0x471CECE7, (int32_t)0x94B50D87, (int32_t)0x45CD358F,
+    (int32_t)0x93DBD6A0, (int32_t)0x447ACD50, (int32_t)0x9306CB04, (int32_t)0x4325C135,
+    (int32_t)0x9235F2EC, (int32_t)0x41CE1E65, (int32_t)0x91695663, (int32_t)0x4073F21D,
+    (int32_t)0x90A0FD4E, (int32_t)0x3F1749B8, (int32_t)0x8FDCEF66, (int32_t)0x3DB832A6,
+    (int32_t)0x8F1D343A, (int32_t)0x3C56BA70, (int32_t)0x8E61D32E, (int32_t)0x3AF2EEB7,
+    (int32_t)0x8DAAD37B, (int32_t)0x398CDD32, (int32_t)0x8CF83C30, (int32_t)0x382493B0,
+    (int32_t)0x8C4A142F, (int32_t)0x36BA2014, (int32_t)0x8BA0622F, (int32_t)0x354D9057,
+    (int32_t)0x8AFB2CBB, (int32_t)0x33DEF287, (int32_t)0x8A5A7A31, (int32_t)0x326E54C7,
+    (int32_t)0x89BE50C3, (int32_t)0x30FBC54D, (int32_t)0x8926B677, (int32_t)0x2F875262,
+    (int32_t)0x8893B125, (int32_t)0x2E110A62, (int32_t)0x88054677, (int32_t)0x2C98FBBA,
+    (int32_t)0x877B7BEC, (int32_t)0x2B1F34EB, (int32_t)0x86F656D3, (int32_t)0x29A3C485,
+    (int32_t)0x8675DC4F, (int32_t)0x2826B928, (int32_t)0x85FA1153, (int32_t)0x26A82186,
+    (int32_t)0x8582FAA5, (int32_t)0x25280C5E, (int32_t)0x85109CDD, (int32_t)0x23A6887F,
+    (int32_t)0x84A2FC62, (int32_t)0x2223A4C5, (int32_t)0x843A1D70, (int32_t)0x209F701C,
+    (int32_t)0x83D60412, (int32_t)0x1F19F97B, (int32_t)0x8376B422, (int32_t)0x1D934FE5,
+    (int32_t)0x831C314E, (int32_t)0x1C0B826A, (int32_t)0x82C67F14, (int32_t)0x1A82A026,
+    (int32_t)0x8275A0C0, (int32_t)0x18F8B83C, (int32_t)0x82299971, (int32_t)0x176DD9DE,
+    (int32_t)0x81E26C16, (int32_t)0x15E21445, (int32_t)0x81A01B6D, (int32_t)0x145576B1,
+    (int32_t)0x8162AA04, (int32_t)0x12C8106F, (int32_t)0x812A1A3A, (int32_t)0x1139F0CF,
+    (int32_t)0x80F66E3C, (int32_t)0x0FAB272B, (int32_t)0x80C7A80A, (int32_t)0x0E1BC2E4,
+    (int32_t)0x809DC971, (int32_t)0x0C8BD35E, (int32_t)0x8078D40D, (int32_t)0x0AFB6805,
+    (int32_t)0x8058C94C, (int32_t)0x096A9049, (int32_t)0x803DAA6A, (int32_t)0x07D95B9E,
+    (int32_t)0x80277872, (int32_t)0x0647D97C, (int32_t)0x80163440, (int32_t)0x04B6195D,
+    (int32_t)0x8009DE7E, (int32_t)0x03242ABF, (int32_t)0x800277A6, (int32_t)0x01921D20,
+    (int32_t)0x80000000, (int32_t)0x00000000, (int32_t)0x800277A6, (int32_t)0xFE6DE2E0,
+    (int32_t)0x8009DE7E, (int32_t)0xFCDBD541, (int32_t)0x80163440, (int32_t)0xFB49E6A3,
+    (int32_t)0x80277872, (int32_t)0xF9B82684, (int32_t)0x803DAA6A, (int32_t)0xF826A462,
+    (int32_t)0x8058C94C, (int32_t)0xF6956FB7, (int32_t)0x8078D40D, (int32_t)0xF50497FB,
+    (int32_t)0x809DC971, (int32_t)0xF3742CA2, (int32_t)0x80C7A80A, (int32_t)0xF1E43D1C,
+    (int32_t)0x80F66E3C, (int32_t)0xF054D8D5, (int32_t)0x812A1A3A, (int32_t)0xEEC60F31,
+    (int32_t)0x8162AA04, (int32_t)0xED37EF91, (int32_t)0x81A01B6D, (int32_t)0xEBAA894F,
+    (int32_t)0x81E26C16, (int32_t)0xEA1DEBBB, (int32_t)0x82299971, (int32_t)0xE8922622,
+    (int32_t)0x8275A0C0, (int32_t)0xE70747C4, (int32_t)0x82C67F14, (int32_t)0xE57D5FDA,
+    (int32_t)0x831C314E, (int32_t)0xE3F47D96, (int32_t)0x8376B422, (int32_t)0xE26CB01B,
+    (int32_t)0x83D60412, (int32_t)0xE0E60685, (int32_t)0x843A1D70, (int32_t)0xDF608FE4,
+    (int32_t)0x84A2FC62, (int32_t)0xDDDC5B3B, (int32_t)0x85109CDD, (int32_t)0xDC597781,
+    (int32_t)0x8582FAA5, (int32_t)0xDAD7F3A2, (int32_t)0x85FA1153, (int32_t)0xD957DE7A,
+    (int32_t)0x8675DC4F, (int32_t)0xD7D946D8, (int32_t)0x86F656D3, (int32_t)0xD65C3B7B,
+    (int32_t)0x877B7BEC, (int32_t)0xD4E0CB15, (int32_t)0x88054677, (int32_t)0xD3670446,
+    (int32_t)0x8893B125, (int32_t)0xD1EEF59E, (int32_t)0x8926B677, (int32_t)0xD078AD9E,
+    (int32_t)0x89BE50C3, (int32_t)0xCF043AB3, (int32_t)0x8A5A7A31, (int32_t)0xCD91AB39,
+    (int32_t)0x8AFB2CBB, (int32_t)0xCC210D79, (int32_t)0x8BA0622F, (int32_t)0xCAB26FA9,
+    (int32_t)0x8C4A142F, (int32_t)0xC945DFEC, (int32_t)0x8CF83C30, (int32_t)0xC7DB6C50,
+    (int32_t)0x8DAAD37B, (int32_t)0xC67322CE, (int32_t)0x8E61D32E, (int32_t)0xC50D1149,
+    (int32_t)0x8F1D343A, (int32_t)0xC3A94590, (int32_t)0x8FDCEF66, (int32_t)0xC247CD5A,
+    (int32_t)0x90A0FD4E, (int32_t)0xC0E8B648, (int32_t)0x91695663, (int32_t)0xBF8C0DE3,
+    (int32_t)0x9235F2EC, (int32_t)0xBE31E19B, (int32_t)0x9306CB04, (int32_t)0xBCDA3ECB,
+    (int32_t)0x93DBD6A0, (int32_t)0xBB8532B0, (int32_t)0x94B50D87, (int32_t)0xBA32CA71,
+    (int32_t)0x9592675C, (int32_t)0xB8E31319, (int32_t)0x9673DB94, (int32_t)0xB796199B,
+    (int32_t)0x9759617F, (int32_t)0xB64BEACD, (int32_t)0x9842F043, (int32_t)0xB5049368,
+    (int32_t)0x99307EE0, (int32_t)0xB3C0200C, (int32_t)0x9A22042D, (int32_t)0xB27E9D3C,
+    (int32_t)0x9B1776DA, (int32_t)0xB140175B, (int32_t)0x9C10CD70, (int32_t)0xB0049AB3,
+    (int32_t)0x9D0DFE54, (int32_t)0xAECC336C, (int32_t)0x9E0EFFC1, (int32_t)0xAD96ED92,
+    (int32_t)0x9F13C7D0, (int32_t)0xAC64D510, (int32_t)0xA01C4C73, (int32_t)0xAB35F5B5,
+    (int32_t)0xA1288376, (int32_t)0xAA0A5B2E, (int32_t)0xA2386284, (int32_t)0xA8E21106,
+    (int32_t)0xA34BDF20, (int32_t)0xA7BD22AC, (int32_t)0xA462EEAC, (int32_t)0xA69B9B68,
+    (int32_t)0xA57D8666, (int32_t)0xA57D8666, (int32_t)0xA69B9B68, (int32_t)0xA462EEAC,
+    (int32_t)0xA7BD22AC, (int32_t)0xA34BDF20, (int32_t)0xA8E21106, (int32_t)0xA2386284,
+    (int32_t)0xAA0A5B2E, (int32_t)0xA1288376, (int32_t)0xAB35F5B5, (int32_t)0xA01C4C73,
+    (int32_t)0xAC64D510, (int32_t)0x9F13C7D0, (int32_t)0xAD96ED92, (int32_t)0x9E0EFFC1,
+    (int32_t)0xAECC336C, (int32_t)0x9D0DFE54, (int32_t)0xB0049AB3, (int32_t)0x9C10CD70,
+    (int32_t)0xB140175B, (int32_t)0x9B1776DA, (int32_t)0xB27E9D3C, (int32_t)0x9A22042D,
+    (int32_t)0xB3C0200C, (int32_t)0x99307EE0, (int32_t)0xB5049368, (int32_t)0x9842F043,
+    (int32_t)0xB64BEACD, (int32_t)0x9759617F, (int32_t)0xB796199B, (int32_t)0x9673DB94,
+    (int32_t)0xB8E31319, (int32_t)0x9592675C, (int32_t)0xBA32CA71, (int32_t)0x94B50D87,
+    (int32_t)0xBB8532B0, (int32_t)0x93DBD6A0, (int32_t)0xBCDA3ECB, (int32_t)0x9306CB04,
+    (int32_t)0xBE31E19B, (int32_t)0x9235F2EC, (int32_t)0xBF8C0DE3, (int32_t)0x91695663,
+    (int32_t)0xC0E8B648, (int32_t)0x90A0FD4E, (int32_t)0xC247CD5A, (int32_t)0x8FDCEF66,
+    (int32_t)0xC3A94590, (int32_t)0x8F1D343A, (int32_t)0xC50D1149, (int32_t)0x8E61D32E,
+    (int32_t)0xC67322CE, (int32_t)0x8DAAD37B, (int32_t)0xC7DB6C50, (int32_t)0x8CF83C30,
+    (int32_t)0xC945DFEC, (int32_t)0x8C4A142F, (int32_t)0xCAB26FA9, (int32_t)0x8BA0622F,
+    (int32_t)0xCC210D79, (int32_t)0x8AFB2CBB, (int32_t)0xCD91AB39, (int32_t)0x8A5A7A31,
+    (int32_t)0xCF043AB3, (int32_t)0x89BE50C3, (int32_t)0xD078AD9E, (int32_t)0x8926B677,
+    (int32_t)0xD1EEF59E, (int32_t)0x8893B125, (int32_t)0xD3670446, (int32_t)0x88054677,
+    (int32_t)0xD4E0CB15, (int32_t)0x877B7BEC, (int32_t)0xD65C3B7B, (int32_t)0x86F656D3,
+    (int32_t)0xD7D946D8, (int32_t)0x8675DC4F, (int32_t)0xD957DE7A, (int32_t)0x85FA1153,
+    (int32_t)0xDAD7F3A2, (int32_t)0x8582FAA5, (int32_t)0xDC597781, (int32_t)0x85109CDD,
+    (int32_t)0xDDDC5B3B, (int32_t)0x84A2FC62, (int32_t)0xDF608FE4, (int32_t)0x843A1D70,
+    (int32_t)0xE0E60685, (int32_t)0x83D60412, (int32_t)0xE26CB01B, (int32_t)0x8376B422,
+    (int32_t)0xE3F47D96, (int32_t)0x831C314E, (int32_t)0xE57D5FDA, (int32_t)0x82C67F14,
+    (int32_t)0xE70747C4, (int32_t)0x8275A0C0, (int32_t)0xE8922622, (int32_t)0x82299971,
+    (int32_t)0xEA1DEBBB, (int32_t)0x81E26C16, (int32_t)0xEBAA894F, (int32_t)0x81A01B6D,
+    (int32_t)0xED37EF91, (int32_t)0x8162AA04, (int32_t)0xEEC60F31, (int32_t)0x812A1A3A,
+    (int32_t)0xF054D8D5, (int32_t)0x80F66E3C, (int32_t)0xF1E43D1C, (int32_t)0x80C7A80A,
+    (int32_t)0xF3742CA2, (int32_t)0x809DC971, (int32_t)0xF50497FB, (int32_t)0x8078D40D,
+    (int32_t)0xF6956FB7, (int32_t)0x8058C94C, (int32_t)0xF826A462, (int32_t)0x803DAA6A,
+    (int32_t)0xF9B82684, (int32_t)0x80277872, (int32_t)0xFB49E6A3, (int32_t)0x80163440,
+    (int32_t)0xFCDBD541, (int32_t)0x8009DE7E, (int32_t)0xFE6DE2E0, (int32_t)0x800277A6
+};
+
+/**
+  @par
+  Example code for q31 Twiddle factors Generation::
+  @par
+  <pre>for (i = 0; i< 3N/4; i++)
+  {
+     twiddleCoefq31[2*i]   = cos(i * 2*PI/(float)N);
+     twiddleCoefq31[2*i+1] = sin(i * 2*PI/(float)N);
+  } </pre>
+  @par
+  where N = 1024, PI = 3.14159265358979
+  @par
+  Cos and Sin values are interleaved fashion
+  @par
+  Convert Floating point to q31(Fixed point 1.31):
+        round(twiddleCoefq31(i) * pow(2, 31))
+ */
+const int32_t twiddleCoef_1024_q32[1536] = {
+    (int32_t)0x7FFFFFFF, (int32_t)0x00000000, (int32_t)0x7FFF6216, (int32_t)0x00C90F88,
+    (int32_t)0x7FFD885A, (int32_t)0x01921D20, (int32_t)0x7FFA72D1, (int32_t)0x025B26D7,
+    (int32_t)0x7FF62182, (int32_t)0x03242ABF, (int32_t)0x7FF09478, (int32_t)0x03ED26E6,
+    (int32_t)0x7FE9CBC0, (int32_t)0x04B6195D, (int32_t)0x7FE1C76B, (int32_t)0x057F0035,
+    (int32_t)0x7FD8878E, (int32_t)0x0647D97C, (int32_t)0x7FCE0C3E, (int32_t)0x0710A345,
+    (int32_t)0x7FC25596, (int32_t)0x07D95B9E, (int32_t)0x7FB563B3, (int32_t)0x08A2009A,
+    (int32_t)0x7FA736B4, (int32_t)0x096A9049, (int32_t)0x7F97CEBD, (int32_t)0x0A3308BD,
+    (int32_t)0x7F872BF3, (int32_t)0x0AFB6805, (int32_t)0x7F754E80, (int32_t)0x0BC3AC35,
+    (int32_t)0x7F62368F, (int32_t)0x0C8BD35E, (int32_t)0x7F4DE451, (int32_t)0x0D53DB92,
+    (int32_t)0x7F3857F6, (int32_t)0x0E1BC2E4, (int32_t)0x7F2191B4, (int32_t)0x0EE38766,
+    (int32_t)0x7F0991C4, (int32_t)0x0FAB272B, (int32_t)0x7EF05860, (int32_t)0x1072A048,
+    (int32_t)0x7ED5E5C6, (int32_t)0x1139F0CF, (int32_t)0x7EBA3A39, (int32_t)0x120116D5,
+    (int32_t)0x7E9D55FC, (int32_t)0x12C8106F, (int32_t)0x7E7F3957, (int32_t)0x138EDBB1,
+    (int32_t)0x7E5FE493, (int32_t)0x145576B1, (int32_t)0x7E3F57FF, (int32_t)0x151BDF86,
+    (int32_t)0x7E1D93EA, (int32_t)0x15E21445, (int32_t)0x7DFA98A8, (int32_t)0x16A81305,
+    (int32_t)0x7DD6668F, (int32_t)0x176DD9DE, (int32_t)0x7DB0FDF8, (int32_t)0x183366E9,
+    (int32_t)0x7D8A5F40, (int32_t)0x18F8B83C, (int32_t)0x7D628AC6, (int32_t)0x19BDCBF3,
+    (int32_t)0x7D3980EC, (int32_t)0x1A82A026, (int32_t)0x7D0F4218, (int32_t)0x1B4732EF,
+    (int32_t)0x7CE3CEB2, (int32_t)0x1C0B826A, (int32_t)0x7CB72724, (int32_t)0x1CCF8CB3,
+    (int32_t)0x7C894BDE, (int32_t)0x1D934FE5, (int32_t)0x7C5A3D50, (int32_t)0x1E56CA1E,
+    (int32_t)0x7C29FBEE, (int32_t)0x1F19F97B, (int32_t)0x7BF88830, (int32_t)0x1FDCDC1B,
+    (int32_t)0x7BC5E290, (int32_t)0x209F701C, (int32_t)0x7B920B89, (int32_t)0x2161B3A0,
+    (int32_t)0x7B5D039E, (int32_t)0x2223A4C5, (int32_t)0x7B26CB4F, (int32_t)0x22E541AF,
+    (int32_t)0x7AEF6323, (int32_t)0x23A6887F, (int32_t)0x7AB6CBA4, (int32_t)0x24677758,
+    (int32_t)0x7A7D055B, (int32_t)0x25280C5E, (int32_t)0x7A4210D8, (int32_t)0x25E845B6,
+    (int32_t)0x7A05EEAD, (int32_t)0x26A82186, (int32_t)0x79C89F6E, (int32_t)0x27679DF4,
+    (int32_t)0x798A23B1, (int32_t)0x2826B928, (int32_t)0x794A7C12, (int32_t)0x28E5714B,
+    (int32_t)0x7909A92D, (int32_t)0x29A3C485, (int32_t)0x78C7ABA2, (int32_t)0x2A61B101,
+    (int32_t)0x78848414, (int32_t)0x2B1F34EB, (int32_t)0x78403329, (int32_t)0x2BDC4E6F,
+    (int32_t)0x77FAB989, (int32_t)0x2C98FBBA, (int32_t)0x77B417DF, (int32_t)0x2D553AFC,
+    (int32_t)0x776C4EDB, (int32_t)0x2E110A62, (int32_t)0x77235F2D, (int32_t)0x2ECC681E,
+    (int32_t)0x76D94989, (int32_t)0x2F875262, (int32_t)0x768E0EA6, (int32_t)0x3041C761,
+    (int32_t)0x7641AF3D, (int32_t)0x30FBC54D, (int32_t)0x75F42C0B, (int32_t)0x31B54A5E,
+    (int32_t)0x75A585CF, (int32_t)0x326E54C7, (int32_t)0x7555BD4C, (int32_t)0x3326E2C3,
+    (int32_t)0x7504D345, (int32_t)0x33DEF287, (int32_t)0x74B2C884, (int32_t)0x34968250,
+    (int32_t)0x745F9DD1, (int32_t)0x354D9057, (int32_t)0x740B53FB, (int32_t)0x36041AD9,
+    (int32_t)0x73B5EBD1, (int32_t)0x36BA2014, (int32_t)0x735F6626, (int32_t)0x376F9E46,
+    (int32_t)0x7307C3D0, (int32_t)0x382493B0, (int32_t)0x72AF05A7, (int32_t)0x38D8FE93,
+    (int32_t)0x72552C85, (int32_t)0x398CDD32, (int32_t)0x71FA3949, (int32_t)0x3A402DD2,
+    (int32_t)0x719E2CD2, (int32_t)0x3AF2EEB7, (int32_t)0x71410805, (int32_t)0x3BA51E29,
+    (int32_t)0x70E2CBC6, (int32_t)0x3C56BA70, (int32_t)0x708378FF, (int32_t)0x3D07C1D6,
+    (int32_t)0x7023109A, (int32_t)0x3DB832A6, (int32_t)0x6FC19385, (int32_t)0x3E680B2C,
+    (int32_t)0x6F5F02B2, (int32_t)0x3F1749B8, (int32_t)0x6EFB5F12, (int32_t)0x3FC5EC98,
+    (int32_t)0x6E96A99D, (int32_t)0x4073F21D, (int32_t)0x6E30E34A, (int32_t)0x4121589B,
+    (int32_t)0x6DCA0D14, (int32_t)0x41CE1E65, (int32_t)0x6D6227FA, (int32_t)0x427A41D0,
+    (int32_t)0x6CF934FC, (int32_t)0x4325C135, (int32_t)0x6C8F351C, (int32_t)0x43D09AED,
+    (int32_t)0x6C242960, (int32_t)0x447ACD50, (int32_t)0x6BB812D1, (int32_t)0x452456BD,
+    (int32_t)0x6B4AF279, (int32_t)0x45CD358F, (int32_t)0x6ADCC964, (int32_t)0x46756828,
+    (int32_t)0x6A6D98A4, (int32_t)0x471CECE7, (int32_t)0x69FD614A, (int32_t)0x47C3C22F,
+    (int32_t)0x698C246C, (int32_t)0x4869E665, (int32_t)0x6919E320, (int32_t)0x490F57EE,
+    (int32_t)0x68A69E81, (int32_t)0x49B41533, (int32_t)0x683257AB, (int32_t)0x4A581C9E,
+    (int32_t)0x67BD0FBD, (int32_t)0x4AFB6C98, (int32_t)0x6746C7D8, (int32_t)0x4B9E0390,
+    (int32_t)0x66CF8120, (int32_t)0x4C3FDFF4, (int32_t)0x66573CBB, (int32_t)0x4CE10034,
+    (int32_t)0x65DDFBD3, (int32_t)0x4D8162C4, (int32_t)0x6563BF92, (int32_t)0x4E210617,
+    (int32_t)0x64E88926, (int32_t)0x4EBFE8A5, (int32_t)0x646C59BF, (int32_t)0x4F5E08E3,
+    (int32_t)0x63EF3290, (int32_t)0x4FFB654D, (int32_t)0x637114CC, (int32_t)0x5097FC5E,
+    (int32_t)0x62F201AC, (int32_t)0x5133CC94, (int32_t)0x6271FA69, (int32_t)0x51CED46E,
+    (int32_t)0x61F1003F, (int32_t)0x5269126E, (int32_t)0x616F146C, (int32_t)0x53028518,
+    (int32_t)0x60EC3830, (int32_t)0x539B2AF0, (int32_t)0x60686CCF, (int32_t)0x5433027D,
+    (int32_t)0x5FE3B38D, (int32_t)0x54CA0A4B, (int32_t)0x5F5E0DB3, (int32_t)0x556040E2,
+    (int32_t)0x5ED77C8A, (int32_t)0x55F5A4D2, (int32_t)0x5E50015D, (int32_t)0x568A34A9,
+    (int32_t)0x5DC79D7C, (int32_t)0x571DEEFA, (int32_t)0x5D3E5237, (int32_t)0x57B0D256,
+    (int32_t)0x5CB420E0, (int32_t)0x5842DD54, (int32_t)0x5C290ACC, (int32_t)0x58D40E8C,
+    (int32_t)0x5B9D1154, (int32_t)0x59646498, (int32_t)0x5B1035CF, (int32_t)0x59F3DE12,
+    (int32_t)0x5A82799A, (int32_t)0x5A82799A, (int32_t)0x59F3DE12, (int32_t)0x5B1035CF,
+    (int32_t)0x59646498, (int32_t)0x5B9D1154, (int32_t)0x58D40E8C, (int32_t)0x5C290ACC,
+    (int32_t)0x5842DD54, (int32_t)0x5CB420E0, (int32_t)0x57B0D256, (int32_t)0x5D3E5237,
+    (int32_t)0x571DEEFA, (int32_t)0x5DC79D7C, (int32_t)0x568A34A9, (int32_t)0x5E50015D,
+    (int32_t)0x55F5A4D2, (int32_t)0x5ED77C8A, (int32_t)0x556040E2, (int32_t)0x5F5E0DB3,
+    (int32_t)0x54CA0A4B, (int32_t)0x5FE3B38D, (int32_t)0x5433027D, (int32_t)0x60686CCF,
+    (int32_t)0x539B2AF0, (int32_t)0x60EC3830, (int32_t)0x53028518, (int32_t)0x616F146C,
+    (int32_t)0x5269126E, (int32_t)0x61F1003F, (int32_t)0x51CED46E, (int32_t)0x6271FA69,
+    (int32_t)0x5133CC94, (int32_t)0x62F201AC, (int32_t)0x5097FC5E, (int32_t)0x637114CC,
+    (int32_t)0x4FFB654D, (int32_t)0x63EF3290, (int32_t)0x4F5E08E3, (int32_t)0x646C59BF,
+    (int32_t)0x4EBFE8A5, (int32_t)0x64E88926, (int32_t)0x4E210617, (int32_t)0x6563BF92,
+    (int32_t)0x4D8162C4, (int32_t)0x65DDFBD3, (int32_t)0x4CE10034, (int32_t)0x66573CBB,
+    (int32_t)0x4C3FDFF4, (int32_t)0x66CF8120, (int32_t)0x4B9E0390, (int32_t)0x6746C7D8,
+    (int32_t)0x4AFB6C98, (int32_t)0x67BD0FBD, (int32_t)0x4A581C9E, (int32_t)0x683257AB,
+    (int32_t)0x49B41533, (int32_t)0x68A69E81, (int32_t)0x490F57EE, (int32_t)0x6919E320,
+    (int32_t)0x4869E665, (int32_t)0x698C246C, (int32_t)0x47C3C22F, (int32_t)0x69FD614A,
+    (int32_t)0x471CECE7, (int32_t)0x6A6D98A4, (int32_t)0x46756828, (int32_t)0x6ADCC964,
+    (int32_t)0x45CD358F, (int32_t)0x6B4AF279, (int32_t)0x452456BD, (int32_t)0x6BB812D1,
+    (int32_t)0x447ACD50, (int32_t)0x6C242960, (int32_t)0x43D09AED, (int32_t)0x6C8F351C,
+    (int32_t)0x4325C135, (int32_t)0x6CF934FC, (int32_t)0x427A41D0, (int32_t)0x6D6227FA,
+    (int32_t)0x41CE1E65, (int32_t)0x6DCA0D14, (int32_t)0x4121589B, (int32_t)0x6E30E34A,
+    (int32_t)0x4073F21D, (int32_t)0x6E96A99D, (int32_t)0x3FC5EC98, (int32_t)0x6EFB5F12,
+    (int32_t)0x3F1749B8, (int32_t)0x6F5F02B2, (int32_t)0x3E680B2C, (int32_t)0x6FC19385,
+    (int32_t)0x3DB832A6, (int32_t)0x7023109A, (int32_t)0x3D07C1D6, (int32_t)0x708378FF,
+    (int32_t)0x3C56BA70, (int32_t)0x70E2CBC6, (int32_t)0x3BA51E29, (int32_t)0x71410805,
+    (int32_t)0x3AF2EEB7, (int32_t)0x719E2CD2, (int32_t)0x3A402DD2, (int32_t)0x71FA3949,
+    (int32_t)0x398CDD32, (int32_t)0x72552C85, (int32_t)0x38D8FE93, (int32_t)0x72AF05A7,
+    (int32_t)0x382493B0, (int32_t)0x7307C3D0, (int32_t)0x376F9E46, (int32_t)0x735F6626,
+    (int32_t)0x36BA2014, (int32_t)0x73B5EBD1, (int32_t)0x36041AD9, (int32_t)0x740B53FB,
+    (int32_t)0x354D9057, (int32_t)0x745F9DD1, (int32_t)0x34968250, (int32_t)0x74B2C884,
+    (int32_t)0x33DEF287, (int32_t)0x7504D345, (int32_t)0x3326E2C3, (int32_t)0x7555BD4C,
+    (int32_t)0x326E54C7, (int32_t)0x75A585CF, (int32_t)0x31B54A5E, (int32_t)0x75F42C0B,
+    (int32_t)0x30FBC54D, (int32_t)0x7641AF3D, (int32_t)0x3041C761, (int32_t)0x768E0EA6,
+    (int32_t)0x2F875262, (int32_t)0x76D94989, (int32_t)0x2ECC681E, (int32_t)0x77235F2D,
+    (int32_t)0x2E110A62, (int32_t)0x776C4EDB, (int32_t)0x2D553AFC, (int32_t)0x77B417DF,
+    (int32_t)0x2C98FBBA, (int32_t)0x77FAB989, (int32_t)0x2BDC4E6F, (int32_t)0x78403329,
+    (int32_t)0x2B1F34EB, (int32_t)0x78848414, (int32_t)0x2A61B101, (int32_t)0x78C7ABA2,
+    (int32_t)0x29A3C485, (int32_t)0x7909A92D, (int32_t)0x28E5714B, (int32_t)0x794A7C12,
+    (int32_t)0x2826B928, (int32_t)0x798A23B1, (int32_t)0x27679DF4, (int32_t)0x79C89F6E,
+    (int32_t)0x26A82186, (int32_t)0x7A05EEAD, (int32_t)0x25E845B6, (int32_t)0x7A4210D8,
+    (int32_t)0x25280C5E, (int32_t)0x7A7D055B, (int32_t)0x24677758, (int32_t)0x7AB6CBA4,
+    (int32_t)0x23A6887F, (int32_t)0x7AEF6323, (int32_t)0x22E541AF, (int32_t)0x7B26CB4F,
+    (int32_t)0x2223A4C5, (int32_t)0x7B5D039E, (int32_t)0x2161B3A0, (int32_t)0x7B920B89,
+    (int32_t)0x209F701C, (int32_t)0x7BC5E290, (int32_t)0x1FDCDC1B, (int32_t)0x7BF88830,
+    (int32_t)0x1F19F97B, (int32_t)0x7C29FBEE, (int32_t)0x1E56CA1E, (int32_t)0x7C5A3D50,
+    (int32_t)0x1D934FE5, (int32_t)0x7C894BDE, (int32_t)0x1CCF8CB3, (int32_t)0x7CB72724,
+    (int32_t)0x1C0B826A, (int32_t)0x7CE3CEB2, (int32_t)0x1B4732EF, (int32_t)0x7D0F4218,
+    (int32_t)0x1A82A026, (int32_t)0x7D3980EC, (int32_t)0x19BDCBF3, (int32_t)0x7D628AC6,
+    (int32_t)0x18F8B83C, (int32_t)0x7D8A5F40, (int32_t)0x183366E9, (int32_t)0x7DB0FDF8,
+    (int32_t)0x176DD9DE, (int32_t)0x7DD6668F, (int32_t)0x16A81305, (int32_t)0x7DFA98A8,
+    (int32_t)0x15E21445, (int32_t)0x7E1D93EA, (int32_t)0x151BDF86, (int32_t)0x7E3F57FF,
+    (int32_t)0x145576B1, (int32_t)0x7E5FE493, (int32_t)0x138EDBB1, (int32_t)0x7E7F3957,
+    (int32_t)0x12C8106F, (int32_t)0x7E9D55FC, (int32_t)0x120116D5, (int32_t)0x7EBA3A39,
+    (int32_t)0x1139F0CF, (int32_t)0x7ED5E5C6, (int32_t)0x1072A048, (int32_t)0x7EF05860,
+    (int32_t)0x0FAB272B, (int32_t)0x7F0991C4, (int32_t)0x0EE38766, (int32_t)0x7F2191B4,
+    (int32_t)0x0E1BC2E4, (int32_t)0x7F3857F6, (int32_t)0x0D53DB92, (int32_t)0x7F4DE451,
+    (int32_t)0x0C8BD35E, (int32_t)0x7F62368F, (int32_t)0x0BC3AC35, (int32_t)0x7F754E80,
+    (int32_t)0x0AFB6805, (int32_t)0x7F872BF3, (int32_t)0x0A3308BD, (int32_t)0x7F97CEBD,
+    (int32_t)0x096A9049, (int32_t)0x7FA736B4, (int32_t)0x08A2009A, (int32_t)0x7FB563B3,
+    (int32_t)0x07D95B9E, (int32_t)0x7FC25596, (int32_t)0x0710A345, (int32_t)0x7FCE0C3E,
+    (int32_t)0x0647D97C, (int32_t)0x7FD8878E, (int32_t)0x057F0035, (int32_t)0x7FE1C76B,
+    (int32_t)0x04B6195D, (int32_t)0x7FE9CBC0, (int32_t)0x03ED26E6, (int32_t)0x7FF09478,
+    (int32_t)0x03242ABF, (int32_t)0x7FF62182, (int32_t)0x025B26D7, (int32_t)0x7FFA72D1,
+    (int32_t)0x01921D20, (int32_t)0x7FFD885A, (int32_t)0x00C90F88, (int32_t)0x7FFF6216,
+    (int32_t)0x00000000, (int32_t)0x7FFFFFFF, (int32_t)0xFF36F078, (int32_t)0x7FFF6216,
+    (int32_t)0xFE6DE2E0, (int32_t)0x7FFD885A, (int32_t)0xFDA4D929, (int32_t)0x7FFA72D1,
+    (int32_t)0xFCDBD541, (int32_t)0x7FF62182, (int32_t)0xFC12D91A, (int32_t)0x7FF09478,
+    (int32_t)0xFB49E6A3, (int32_t)0x7FE9CBC0, (int32_t)0xFA80FFCB, (int32_t)0x7FE1C76B,
+    (int32_t)0xF9B82684, (int32_t)0x7FD8878E, (int32_t)0xF8EF5CBB, (int32_t)0x7FCE0C3E,
+    (int32_t)0xF826A462, (int32_t)0x7FC25596, (int32_t)0xF75DFF66, (int32_t)0x7FB563B3,
+    (int32_t)0xF6956FB7, (int32_t)0x7FA736B4, (int32_t)0xF5CCF743, (int32_t)0x7F97CEBD,
+    (int32_t)0xF50497FB, (int32_t)0x7F872BF3, (int32_t)0xF43C53CB, (int32_t)0x7F754E80,
+    (int32_t)0xF3742CA2, (int32_t)0x7F62368F, (int32_t)0xF2AC246E, (int32_t)0x7F4DE451,
+    (int32_t)0xF1E43D1C, (int32_t)0x7F3857F6, (int32_t)0xF11C789A, (int32_t)0x7F2191B4,
+    (int32_t)0xF054D8D5, (int32_t)0x7F0991C4, (int32_t)0xEF8D5FB8, (int32_t)0x7EF05860,
+    (int32_t)0xEEC60F31, (int32_t)0x7ED5E5C6, (int32_t)0xEDFEE92B, (int32_t)0x7EBA3A39,
+    (int32_t)0xED37EF91, (int32_t)0x7E9D55FC, (int32_t)0xEC71244F, (int32_t)0x7E7F3957,
+    (int32_t)0xEBAA894F, (int32_t)0x7E5FE493, (int32_t)0xEAE4207A, (int32_t)0x7E3F57FF,
+    (int32_t)0xEA1DEBBB, (int32_t)0x7E1D93EA, (int32_t)0xE957ECFB, (int32_t)0x7DFA98A8,
+    (int32_t)0xE8922622, (int32_t)0x7DD6668F, (int32_t)0xE7CC9917, (int32_t)0x7DB0FDF8,
+    (int32_t)0xE70747C4, (int32_t)0x7D8A5F40, (int32_t)0xE642340D, (int32_t)0x7D628AC6,
+    (int32_t)0xE57D5FDA, (int32_t)0x7D3980EC, (int32_t)0xE4B8CD11, (int32_t)0x7D0F4218,
+    (int32_t)0xE3F47D96, (int32_t)0x7CE3CEB2, (int32_t)0xE330734D, (int32_t)0x7CB72724,
+    (int32_t)0xE26CB01B, (int32_t)0x7C894BDE, (int32_t)0xE1A935E2, (int32_t)0x7C5A3D50,
+    (int32_t)0xE0E60685, (int32_t)0x7C29FBEE, (int32_t)0xE02323E5, (int32_t)0x7BF88830,
+    (int32_t)0xDF608FE4, (int32_t)0x7BC5E290, (int32_t)0xDE9E4C60, (int32_t)0x7B920B89,
+    (int32_t)0xDDDC5B3B, (int32_t)0x7B5D039E, (int32_t)0xDD1ABE51, (int32_t)0x7B26CB4F,
+    (int32_t)0xDC597781, (int32_t)0x7AEF6323, (int32_t)0xDB9888A8, (int32_t)0x7AB6CBA4,
+    (int32_t)0xDAD7F3A2, (int32_t)0x7A7D055B, (int32_t)0xDA17BA4A, (int32_t)0x7A4210D8,
+    (int32_t)0xD957DE7A, (int32_t)0x7A05EEAD, (int32_t)0xD898620C, (int32_t)0x79C89F6E,
+    (int32_t)0xD7D946D8, (int32_t)0x798A23B1, (int32_t)0xD71A8EB5, (int32_t)0x794A7C12,
+    (int32_t)0xD65C3B7B, (int32_t)0x7909A92D, (int32_t)0xD59E4EFF, (int32_t)0x78C7ABA2,
+    (int32_t)0xD4E0CB15, (int32_t)0x78848414, (int32_t)0xD423B191, (int32_t)0x78403329,
+    (int32_t)0xD3670446, (int32_t)0x77FAB989, (int32_t)0xD2AAC504, (int32_t)0x77B417DF,
+    (int32_t)0xD1EEF59E, (int32_t)0x776C4EDB, (int32_t)0xD13397E2, (int32_t)0x77235F2D,
+    (int32_t)0xD078AD9E, (int32_t)0x76D94989, (int32_t)0xCFBE389F, (int32_t)0x768E0EA6,
+    (int32_t)0xCF043AB3, (int32_t)0x7641AF3D, (int32_t)0xCE4AB5A2, (int32_t)0x75F42C0B,
+    (int32_t)0xCD91AB39, (int32_t)0x75A585CF, (int32_t)0xCCD91D3D, (int32_t)0x7555BD4C,
+    (int32_t)0xCC210D79, (int32_t)0x7504D345, (int32_t)0xCB697DB0, (int32_t)0x74B2C884,
+    (int32_t)0xCAB26FA9, (int32_t)0x745F9DD1, (int32_t)0xC9FBE527, (int32_t)0x740B53FB,
+    (int32_t)0xC945DFEC, (int32_t)0x73B5EBD1, (int32_t)0xC89061BA, (int32_t)0x735F6626,
+    (int32_t)0xC7DB6C50, (int32_t)0x7307C3D0, (int32_t)0xC727016D, (int32_t)0x72AF05A7,
+    (int32_t)0xC67322CE, (int32_t)0x72552C85, (int32_t)0xC5BFD22E, (int32_t)0x71FA3949,
+    (int32_t)0xC50D1149, (int32_t)0x719E2CD2, (int32_t)0xC45AE1D7, (int32_t)0x71410805,
+    (int32_t)0xC3A94590, (int32_t)0x70E2CBC6, (int32_t)0xC2F83E2A, (int32_t)0x708378FF,
+    (int32_t)0xC247CD5A, (int32_t)0x7023109A, (int32_t)0xC197F4D4, (int32_t)0x6FC19385,
+    (int32_t)0xC0E8B648, (int32_t)0x6F5F02B2, (int32_t)0xC03A1368, (int32_t)0x6EFB5F12,
+    (int32_t)0xBF8C0DE3, (int32_t)0x6E96A99D, (int32_t)0xBEDEA765, (int32_t)0x6E30E34A,
+    (int32_t)0xBE31E19B, (int32_t)0x6DCA0D14, (int32_t)0xBD85BE30, (int32_t)0x6D6227FA,
+    (int32_t)0xBCDA3ECB, (int32_t)0x6CF934FC, (int32_t)0xBC2F6513, (int32_t)0x6C8F351C,
+    (int32_t)0xBB8532B0, (int32_t)0x6C242960, (int32_t)0xBADBA943, (int32_t)0x6BB812D1,
+    (int32_t)0xBA32CA71, (int32_t)0x6B4AF279, (int32_t)0xB98A97D8, (int32_t)0x6ADCC964,
+    (int32_t)0xB8E31319, (int32_t)0x6A6D98A4, (int32_t)0xB83C3DD1, (int32_t)0x69FD614A,
+    (int32_t)0xB796199B, (int32_t)0x698C246C, (int32_t)0xB6F0A812, (int32_t)0x6919E320,
+    (int32_t)0xB64BEACD, (int32_t)0x68A69E81, (int32_t)0xB5A7E362, (int32_t)0x683257AB,
+    (int32_t)0xB5049368, (int32_t)0x67BD0FBD, (int32_t)0xB461FC70, (int32_t)0x6746C7D8,
+    (int32_t)0xB3C0200C, (int32_t)0x66CF8120, (int32_t)0xB31EFFCC, (int32_t)0x66573CBB,
+    (int32_t)0xB27E9D3C, (int32_t)0x65DDFBD3, (int32_t)0xB1DEF9E9, (int32_t)0x6563BF92,
+    (int32_t)0xB140175B, (int32_t)0x64E88926, (int32_t)0xB0A1F71D, (int32_t)0x646C59BF,
+    (int32_t)0xB0049AB3, (int32_t)0x63EF3290, (int32_t)0xAF6803A2, (int32_t)0x637114CC,
+    (int32_t)0xAECC336C, (int32_t)0x62F201AC, (int32_t)0xAE312B92, (int32_t)0x6271FA69,
+    (int32_t)0xAD96ED92, (int32_t)0x61F1003F, (int32_t)0xACFD7AE8, (int32_t)0x616F146C,
+    (int32_t)0xAC64D510, (int32_t)0x60EC3830, (int32_t)0xABCCFD83, (int32_t)0x60686CCF,
+    (int32_t)0xAB35F5B5, (int32_t)0x5FE3B38D, (int32_t)0xAA9FBF1E, (int32_t)0x5F5E0DB3,
+    (int32_t)0xAA0A5B2E, (int32_t)0x5ED77C8A, (int32_t)0xA975CB57, (int32_t)0x5E50015D,
+    (int32_t)0xA8E21106, (int32_t)0x5DC79D7C, (int32_t)0xA84F2DAA, (int32_t)0x5D3E5237,
+    (int32_t)0xA7BD22AC, (int32_t)0x5CB420E0, (int32_t)0xA72BF174, (int32_t)0x5C290ACC,
+    (int32_t)0xA69B9B68, (int32_t)0x5B9D1154, (int32_t)0xA60C21EE, (int32_t)0x5B1035CF,
+    (int32_t)0xA57D8666, (int32_t)0x5A82799A, (int32_t)0xA4EFCA31, (int32_t)0x59F3DE12,
+    (int32_t)0xA462EEAC, (int32_t)0x59646498, (int32_t)0xA3D6F534, (int32_t)0x58D40E8C,
+    (int32_t)0xA34BDF20, (int32_t)0x5842DD54, (int32_t)0xA2C1ADC9, (int32_t)0x57B0D256,
+    (int32_t)0xA2386284, (int32_t)0x571DEEFA, (int32_t)0xA1AFFEA3, (int32_t)0x568A34A9,
+    (int32_t)0xA1288376, (int32_t)0x55F5A4D2, (int32_t)0xA0A1F24D, (int32_t)0x556040E2,
+    (int32_t)0xA01C4C73, (int32_t)0x54CA0A4B, (int32_t)0x9F979331, (int32_t)0x5433027D,
+    (int32_t)0x9F13C7D0, (int32_t)0x539B2AF0, (int32_t)0x9E90EB94, (int32_t)0x53028518,
+    (int32_t)0x9E0EFFC1, (int32_t)0x5269126E, (int32_t)0x9D8E0597, (int32_t)0x51CED46E,
+    (int32_t)0x9D0DFE54, (int32_t)0x5133CC94, (int32_t)0x9C8EEB34, (int32_t)0x5097FC5E,
+    (int32_t)0x9C10CD70, (int32_t)0x4FFB654D, (int32_t)0x9B93A641, (int32_t)0x4F5E08E3,
+    (int32_t)0x9B1776DA, (int32_t)0x4EBFE8A5, (int32_t)0x9A9C406E, (int32_t)0x4E210617,
+    (int32_t)0x9A22042D, (int32_t)0x4D8162C4, (int32_t)0x99A8C345, (int32_t)0x4CE10034,
+    (int32_t)0x99307EE0, (int32_t)0x4C3FDFF4, (int32_t)0x98B93828, (int32_t)0x4B9E0390,
+    (int32_t)0x9842F043, (int32_t)0x4AFB6C98, (int32_t)0x97CDA855, (int32_t)0x4A581C9E,
+    (int32_t)0x9759617F, (int32_t)0x49B41533, (int32_t)0x96E61CE0, (int32_t)0x490F57EE,
+    (int32_t)0x9673DB94, (int32_t)0x4869E665, (int32_t)0x96029EB6, (int32_t)0x47C3C22F,
+    (int32_t)0x9592675C, (int32_t)0x471CECE7, (int32_t)0x9523369C, (int32_t)0x46756828,
+    (int32_t)0x94B50D87, (int32_t)0x45CD358F, (int32_t)0x9447ED2F, (int32_t)0x452456BD,
+    (int32_t)0x93DBD6A0, (int32_t)0x447ACD50, (int32_t)0x9370CAE4, (int32_t)0x43D09AED,
+    (int32_t)0x9306CB04, (int32_t)0x4325C135, (int32_t)0x929DD806, (int32_t)0x427A41D0,
+    (int32_t)0x9235F2EC, (int32_t)0x41CE1E65, (int32_t)0x91CF1CB6, (int32_t)0x4121589B,
+    (int32_t)0x91695663, (int32_t)0x4073F21D, (int32_t)0x9104A0EE, (int32_t)0x3FC5EC98,
+    (int32_t)0x90A0FD4E, (int32_t)0x3F1749B8, (int32_t)0x903E6C7B, (int32_t)0x3E680B2C,
+    (int32_t)0x8FDCEF66, (int32_t)0x3DB832A6, (int32_t)0x8F7C8701, (int32_t)0x3D07C1D6,
+    (int32_t)0x8F1D343A, (int32_t)0x3C56BA70, (int32_t)0x8EBEF7FB, (int32_t)0x3BA51E29,
+    (int32_t)0x8E61D32E, (int32_t)0x3AF2EEB7, (int32_t)0x8E05C6B7, (int32_t)0x3A402DD2,
+    (int32_t)0x8DAAD37B, (int32_t)0x398CDD32, (int32_t)0x8D50FA59, (int32_t)0x38D8FE93,
+    (int32_t)0x8CF83C30, (int32_t)0x382493B0, (int32_t)0x8CA099DA, (int32_t)0x376F9E46,
+    (int32_t)0x8C4A142F, (int32_t)0x36BA2014, (int32_t)0x8BF4AC05, (int32_t)0x36041AD9,
+    (int32_t)0x8BA0622F, (int32_t)0x354D9057, (int32_t)0x8B4D377C, (int32_t)0x34968250,
+    (int32_t)0x8AFB2CBB, (int32_t)0x33DEF287, (int32_t)0x8AAA42B4, (int32_t)0x3326E2C3,
+    (int32_t)0x8A5A7A31, (int32_t)0x326E54C7, (int32_t)0x8A0BD3F5, (int32_t)0x31B54A5E,
+    (int32_t)0x89BE50C3, (int32_t)0x30FBC54D, (int32_t)0x8971F15A, (int32_t)0x3041C761,
+    (int32_t)0x8926B677, (int32_t)0x2F875262, (int32_t)0x88DCA0D3, (int32_t)0x2ECC681E,
+    (int32_t)0x8893B125, (int32_t)0x2E110A62, (int32_t)0x884BE821, (int32_t)0x2D553AFC,
+    (int32_t)0x88054677, (int32_t)0x2C98FBBA, (int32_t)0x87BFCCD7, (int32_t)0x2BDC4E6F,
+    (int32_t)0x877B7BEC, (int32_t)0x2B1F34EB, (int32_t)0x8738545E, (int32_t)0x2A61B101,
+    (int32_t)0x86F656D3, (int32_t)0x29A3C485, (int32_t)0x86B583EE, (int32_t)0x28E5714B,
+    (int32_t)0x8675DC4F, (int32_t)0x2826B928, (int32_t)0x86376092, (int32_t)0x27679DF4,
+    (int32_t)0x85FA1153, (int32_t)0x26A82186, (int32_t)0x85BDEF28, (int32_t)0x25E845B6,
+    (int32_t)0x8582FAA5, (int32_t)0x25280C5E, (int32_t)0x8549345C, (int32_t)0x24677758,
+    (int32_t)0x85109CDD, (int32_t)0x23A6887F, (int32_t)0x84D934B1, (int32_t)0x22E541AF,
+    (int32_t)0x84A2FC62, (int32_t)0x2223A4C5, (int32_t)0x846DF477, (int32_t)0x2161B3A0,
+    (int32_t)0x843A1D70, (int32_t)0x209F701C, (int32_t)0x840777D0, (int32_t)0x1FDCDC1B,
+    (int32_t)0x83D60412, (int32_t)0x1F19F97B, (int32_t)0x83A5C2B0, (int32_t)0x1E56CA1E,
+    (int32_t)0x8376B422, (int32_t)0x1D934FE5, (int32_t)0x8348D8DC, (int32_t)0x1CCF8CB3,
+    (int32_t)0x831C314E, (int32_t)0x1C0B826A, (int32_t)0x82F0BDE8, (int32_t)0x1B4732EF,
+    (int32_t)0x82C67F14, (int32_t)0x1A82A026, (int32_t)0x829D753A, (int32_t)0x19BDCBF3,
+    (int32_t)0x8275A0C0, (int32_t)0x18F8B83C, (int32_t)0x824F0208, (int32_t)0x183366E9,
+    (int32_t)0x82299971, (int32_t)0x176DD9DE, (int32_t)0x82056758, (int32_t)0x16A81305,
+    (int32_t)0x81E26C16, (int32_t)0x15E21445, (int32_t)0x81C0A801, (int32_t)0x151BDF86,
+    (int32_t)0x81A01B6D, (int32_t)0x145576B1, (int32_t)0x8180C6A9, (int32_t)0x138EDBB1,
+    (int32_t)0x8162AA04, (int32_t)0x12C8106F, (int32_t)0x8145C5C7, (int32_t)0x120116D5,
+    (int32_t)0x812A1A3A, (int32_t)0x1139F0CF, (int32_t)0x810FA7A0, (int32_t)0x1072A048,
+    (int32_t)0x80F66E3C, (int32_t)0x0FAB272B, (int32_t)0x80DE6E4C, (int32_t)0x0EE38766,
+    (int32_t)0x80C7A80A, (int32_t)0x0E1BC2E4, (int32_t)0x80B21BAF, (int32_t)0x0D53DB92,
+    (int32_t)0x809DC971, (int32_t)0x0C8BD35E, (int32_t)0x808AB180, (int32_t)0x0BC3AC35,
+    (int32_t)0x8078D40D, (int32_t)0x0AFB6805, (int32_t)0x80683143, (int32_t)0x0A3308BD,
+    (int32_t)0x8058C94C, (int32_t)0x096A9049, (int32_t)0x804A9C4D, (int32_t)0x08A2009A,
+    (int32_t)0x803DAA6A, (int32_t)0x07D95B9E, (int32_t)0x8031F3C2, (int32_t)0x0710A345,
+    (int32_t)0x80277872, (int32_t)0x0647D97C, (int32_t)0x801E3895, (int32_t)0x057F0035,
+    (int32_t)0x80163440, (int32_t)0x04B6195D, (int32_t)0x800F6B88, (int32_t)0x03ED26E6,
+    (int32_t)0x8009DE7E, (int32_t)0x03242ABF, (int32_t)0x80058D2F, (int32_t)0x025B26D7,
+    (int32_t)0x800277A6, (int32_t)0x01921D20, (int32_t)0x80009DEA, (int32_t)0x00C90F88,
+    (int32_t)0x80000000, (int32_t)0x00000000, (int32_t)0x80009DEA, (int32_t)0xFF36F078,
+    (int32_t)0x800277A6, (int32_t)0xFE6DE2E0, (int32_t)0x80058D2F, (int32_t)0xFDA4D929,
+    (int32_t)0x8009DE7E, (int32_t)0xFCDBD541, (int32_t)0x800F6B88, (int32_t)0xFC12D91A,
+    (int32_t)0x80163440, (int32_t)0xFB49E6A3, (int32_t)0x801E3895, (int32_t)0xFA80FFCB,
+    (int32_t)0x80277872, (int32_t)0xF9B82684, (int32_t)0x8031F3C2, (int32_t)0xF8EF5CBB,
+    (int32_t)0x803DAA6A, (int32_t)0xF826A462, (int32_t)0x804A9C4D, (int32_t)0xF75DFF66,
+    (int32_t)0x8058C94C, (int32_t)0xF6956FB7, (int32_t)0x80683143, (int32_t)0xF5CCF743,
+    (int32_t)0x8078D40D, (int32_t)0xF50497FB, (int32_t)0x808AB180, (int32_t)0xF43C53CB,
+    (int32_t)0x809DC971, (int32_t)0xF3742CA2, (int32_t)0x80B21BAF, (int32_t)0xF2AC246E,
+    (int32_t)0x80C7A80A, (int32_t)0xF1E43D1C, (int32_t)0x80DE6E4C, (int32_t)0xF11C789A,
+    (int32_t)0x80F66E3C, (int32_t)0xF054D8D5, (int32_t)0x810FA7A0, (int32_t)0xEF8D5FB8,
+    (int32_t)0x812A1A3A, (int32_t)0xEEC60F31, (int32_t)0x8145C5C7, (int32_t)0xEDFEE92B,
+    (int32_t)0x8162AA04, (int32_t)0xED37EF91, (int32_t)0x8180C6A9, (int32_t)0xEC71244F,
+    (int32_t)0x81A01B6D, (int32_t)0xEBAA894F, (int32_t)0x81C0A801, (int32_t)0xEAE4207A,
+    (int32_t)0x81E26C16, (int32_t)0xEA1DEBBB, (int32_t)0x82056758, (int32_t)0xE957ECFB,
+    (int32_t)0x82299971, (int32_t)0xE8922622, (int32_t)0x824F0208, (int32_t)0xE7CC9917,
+    (int32_t)0x8275A0C0, (int32_t)0xE70747C4, (int32_t)0x829D753A, (int32_t)0xE642340D,
+    (int32_t)0x82C67F14, (int32_t)0xE57D5FDA, (int32_t)0x82F0BDE8, (int32_t)0xE4B8CD11,
+    (int32_t)0x831C314E, (int32_t)0xE3F47D96, (int32_t)0x8348D8DC, (int32_t)0xE330734D,
+    (int32_t)0x8376B422, (int32_t)0xE26CB01B, (int32_t)0x83A5C2B0, (int32_t)0xE1A935E2,
+    (int32_t)0x83D60412, (int32_t)0xE0E60685, (int32_t)0x840777D0, (int32_t)0xE02323E5,
+    (int32_t)0x843A1D70, (int32_t)0xDF608FE4, (int32_t)0x846DF477, (int32_t)0xDE9E4C60,
+    (int32_t)0x84A2FC62, (int32_t)0xDDDC5B3B, (int32_t)0x84D934B1, (int32_t)0xDD1ABE51,
+    (int32_t)0x85109CDD, (int32_t)0xDC597781, (int32_t)0x8549345C, (int32_t)0xDB9888A8,
+    (int32_t)0x8582FAA5, (int32_t)0xDAD7F3A2, (int32_t)0x85BDEF28, (int32_t)0xDA17BA4A,
+    (int32_t)0x85FA1153, (int32_t)0xD957DE7A, (int32_t)0x86376092, (int32_t)0xD898620C,
+    (int32_t)0x8675DC4F, (int32_t)0xD7D946D8, (int32_t)0x86B583EE, (int32_t)0xD71A8EB5,
+    (int32_t)0x86F656D3, (int32_t)0xD65C3B7B, (int32_t)0x8738545E, (int32_t)0xD59E4EFF,
+    (int32_t)0x877B7BEC, (int32_t)0xD4E0CB15, (int32_t)0x87BFCCD7, (int32_t)0xD423B191,
+    (int32_t)0x88054677, (int32_t)0xD3670446, (int32_t)0x884BE821, (int32_t)0xD2AAC504,
+    (int32_t)0x8893B125, (int32_t)0xD1EEF59E, (int32_t)0x88DCA0D3, (int32_t)0xD13397E2,
+    (int32_t)0x8926B677, (int32_t)0xD078AD9E, (int32_t)0x8971F15A, (int32_t)0xCFBE389F,
+    (int32_t)0x89BE50C3, (int32_t)0xCF043AB3, (int32_t)0x8A0BD3F5, (int32_t)0xCE4AB5A2,
+    (int32_t)0x8A5A7A31, (int32_t)0xCD91AB39, (int32_t)0x8AAA42B4, (int32_t)0xCCD91D3D,
+    (int32_t)0x8AFB2CBB, (int32_t)0xCC210D79, (int32_t)0x8B4D377C, (int32_t)0xCB697DB0,
+    (int32_t)0x8BA0622F, (int32_t)0xCAB26FA9, (int32_t)0x8BF4AC05, (int32_t)0xC9FBE527,
+    (int32_t)0x8C4A142F, (int32_t)0xC945DFEC, (int32_t)0x8CA099DA, (int32_t)0xC89061BA,
+    (int32_t)0x8CF83C30, (int32_t)0xC7DB6C50, (int32_t)0x8D50FA59, (int32_t)0xC727016D,
+    (int32_t)0x8DAAD37B, (int32_t)0xC67322CE, (int32_t)0x8E05C6B7, (int32_t)0xC5BFD22E,
+    (int32_t)0x8E61D32E, (int32_t)0xC50D1149, (int32_t)0x8EBEF7FB, (int32_t)0xC45AE1D7,
+    (int32_t)0x8F1D343A, (int32_t)0xC3A94590, (int32_t)0x8F7C8701, (int32_t)0xC2F83E2A,
+    (int32_t)0x8FDCEF66, (int32_t)0xC247CD5A, (int32_t)0x903E6C7B, (int32_t)0xC197F4D4,
+    (int32_t)0x90A0FD4E, (int32_t)0xC0E8B648, (int32_t)0x9104A0EE, (int32_t)0xC03A1368,
+    (int32_t)0x91695663, (int32_t)0xBF8C0DE3, (int32_t)0x91CF1CB6, (int32_t)0xBEDEA765,
+    (int32_t)0x9235F2EC, (int32_t)0xBE31E19B, (int32_t)0x929DD806, (int32_t)0xBD85BE30,
+    (int32_t)0x9306CB04, (int32_t)0xBCDA3ECB, (int32_t)0x9370CAE4, (int32_t)0xBC2F6513,
+    (int32_t)0x93DBD6A0, (int32_t)0xBB8532B0, (int32_t)0x9447ED2F, (int32_t)0xBADBA943,
+    (int32_t)0x94B50D87, (int32_t)0xBA32CA71, (int32_t)0x9523369C, (int32_t)0xB98A97D8,
+    (int32_t)0x9592675C, (int32_t)0xB8E31319, (int32_t)0x96029EB6, (int32_t)0xB83C3DD1,
+    (int32_t)0x9673DB94, (int32_t)0xB796199B, (int32_t)0x96E61CE0, (int32_t)0xB6F0A812,
+    (int32_t)0x9759617F, (int32_t)0xB64BEACD, (int32_t)0x97CDA855, (int32_t)0xB5A7E362,
+    (int32_t)0x9842F043, (int32_t)0xB5049368, (int32_t)0x98B93828, (int32_t)0xB461FC70,
+    (int32_t)0x99307EE0, (int32_t)0xB3C0200C, (int32_t)0x99A8C345, (int32_t)0xB31EFFCC,
+    (int32_t)0x9A22042D, (int32_t)0xB27E9D3C, (int32_t)0x9A9C406E, (int32_t)0xB1DEF9E9,
+    (int32_t)0x9B1776DA, (int32_t)0xB140175B, (int32_t)0x9B93A641, (int32_t)0xB0A1F71D,
+    (int32_t)0x9C10CD70, (int32_t)0xB0049AB3, (int32_t)0x9C8EEB34, (int32_t)0xAF6803A2,
+    (int32_t)0x9D0DFE54, (int32_t)0xAECC336C, (int32_t)0x9D8E0597, (int32_t)0xAE312B92,
+    (int32_t)0x9E0EFFC1, (int32_t)0xAD96ED92, (int32_t)0x9E90EB94, (int32_t)0xACFD7AE8,
+    (int32_t)0x9F13C7D0, (int32_t)0xAC64D510, (int32_t)0x9F979331, (int32_t)0xABCCFD83,
+    (int32_t)0xA01C4C73, (int32_t)0xAB35F5B5, (int32_t)0xA0A1F24D, (int32_t)0xAA9FBF1E,
+    (int32_t)0xA1288376, (int32_t)0xAA0A5B2E, (int32_t)0xA1AFFEA3, (int32_t)0xA975CB57,
+    (int32_t)0xA2386284, (int32_t)0xA8E21106, (int32_t)0xA2C1ADC9, (int32_t)0xA84F2DAA,
+    (int32_t)0xA34BDF20, (int32_t)0xA7BD22AC, (int32_t)0xA3D6F534, (int32_t)0xA72BF174,
+    (int32_t)0xA462EEAC, (int32_t)0xA69B9B68, (int32_t)0xA4EFCA31, (int32_t)0xA60C21EE,
+    (int32_t)0xA57D8666, (int32_t)0xA57D8666, (int32_t)0xA60C21EE, (int32_t)0xA4EFCA31,
+    (int32_t)0xA69B9B68, (int32_t)0xA462EEAC, (int32_t)0xA72BF174, (int32_t)0xA3D6F534,
+    (int32_t)0xA7BD22AC, (int32_t)0xA34BDF20, (int32_t)0xA84F2DAA, (int32_t)0xA2C1ADC9,
+    (int32_t)0xA8E21106, (int32_t)0xA2386284, (int32_t)0xA975CB57, (int32_t)0xA1AFFEA3,
+    (int32_t)0xAA0A5B2E, (int32_t)0xA1288376, (int32_t)0xAA9FBF1E, (int32_t)0xA0A1F24D,
+    (int32_t)0xAB35F5B5, (int32_t)0xA01C4C73, (int32_t)0xABCCFD83, (int32_t)0x9F979331,
+    (int32_t)0xAC64D510, (int32_t)0x9F13C7D0, (int32_t)0xACFD7AE8, (int32_t)0x9E90EB94,
+    (int32_t)0xAD96ED92, (int32_t)0x9E0EFFC1, (int32_t)0xAE312B92, (int32_t)0x9D8E0597,
+    (int32_t)0xAECC336C, (int32_t)0x9D0DFE54, (int32_t)0xAF6803A2, (int32_t)0x9C8EEB34,
+    (int32_t)0xB0049AB3, (int32_t)0x9C10CD70, (int32_t)0xB0A1F71D, (int32_t)0x9B93A641,
+    (int32_t)0xB140175B, (int32_t)0x9B1776DA, (int32_t)0xB1DEF9E9, (int32_t)0x9A9C406E,
+    (int32_t)0xB27E9D3C, (int32_t)0x9A22042D, (int32_t)0xB31EFFCC, (int32_t)0x99A8C345,
+    (int32_t)0xB3C0200C, (int32_t)0x99307EE0, (int32_t)0xB461FC70, (int32_t)0x98B93828,
+    (int32_t)0xB5049368, (int32_t)0x9842F043, (int32_t)0xB5A7E362, (int32_t)0x97CDA855,
+    (int32_t)0xB64BEACD, (int32_t)0x9759617F, (int32_t)0xB6F0A812, (int32_t)0x96E61CE0,
+    (int32_t)0xB796199B, (int32_t)0x9673DB94, (int32_t)0xB83C3DD1, (int32_t)0x96029EB6,
+    (int32_t)0xB8E31319, (int32_t)0x9592675C, (int32_t)0xB98A97D8, (int32_t)0x9523369C,
+    (int32_t)0xBA32CA71, (int32_t)0x94B50D87, (int32_t)0xBADBA943, (int32_t)0x9447ED2F,
+    (int32_t)0xBB8532B0, (int32_t)0x93DBD6A0, (int32_t)0xBC2F6513, (int32_t)0x9370CAE4,
+    (int32_t)0xBCDA3ECB, (int32_t)0x9306CB04, (int32_t)0xBD85BE30, (int32_t)0x929DD806,
+    (int32_t)0xBE31E19B, (int32_t)0x9235F2EC, (int32_t)0xBEDEA765, (int32_t)0x91CF1CB6,
+    (int32_t)0xBF8C0DE3, (int32_t)0x91695663, (int32_t)0xC03A1368, (int32_t)0x9104A0EE,
+    (int32_t)0xC0E8B648, (int32_t)0x90A0FD4E, (int32_t)0xC197F4D4, (int32_t)0x903E6C7B,
+    (int32_t)0xC247CD5A, (int32_t)0x8FDCEF66, (int32_t)0xC2F83E2A, (int32_t)0x8F7C8701,
+    (int32_t)0xC3A94590, (int32_t)0x8F1D343A, (int32_t)0xC45AE1D7, (int32_t)0x8EBEF7FB,
+    (int32_t)0xC50D1149, (int32_t)0x8E61D32E, (int32_t)0xC5BFD22E, (int32_t)0x8E05C6B7,
+    (int32_t)0xC67322CE, (int32_t)0x8DAAD37B, (int32_t)0xC727016D, (int32_t)0x8D50FA59,
+    (int32_t)0xC7DB6C50, (int32_t)0x8CF83C30, (int32_t)0xC89061BA, (int32_t)0x8CA099DA,
+    (int32_t)0xC945DFEC, (int32_t)0x8C4A142F, (int32_t)0xC9FBE527, (int32_t)0x8BF4AC05,
+    (int32_t)0xCAB26FA9, (int32_t)0x8BA0622F, (int32_t)0xCB697DB0, (int32_t)0x8B4D377C,
+    (int32_t)0xCC210D79, (int32_t)0x8AFB2CBB, (int32_t)0xCCD91D3D, (int32_t)0x8AAA42B4,
+    (int32_t)0xCD91AB39, (int32_t)0x8A5A7A31, (int32_t)0xCE4AB5A2, (int32_t)0x8A0BD3F5,
+    (int32_t)0xCF043AB3, (int32_t)0x89BE50C3, (int32_t)0xCFBE389F, (int32_t)0x8971F15A,
+    (int32_t)0xD078AD9E, (int32_t)0x8926B677, (int32_t)0xD13397E2, (int32_t)0x88DCA0D3,
+    (int32_t)0xD1EEF59E, (int32_t)0x8893B125, (int32_t)0xD2AAC504, (int32_t)0x884BE821,
+    (int32_t)0xD3670446, (int32_t)0x88054677, (int32_t)0xD423B191, (int32_t)0x87BFCCD7,
+    (int32_t)0xD4E0CB15, (int32_t)0x877B7BEC, (int32_t)0xD59E4EFF, (int32_t)0x8738545E,
+    (int32_t)0xD65C3B7B, (int32_t)0x86F656D3, (int32_t)0xD71A8EB5, (int32_t)0x86B583EE,
+    (int32_t)0xD7D946D8, (int32_t)0x8675DC4F, (int32_t)0xD898620C, (int32_t)0x86376092,
+    (int32_t)0xD957DE7A, (int32_t)0x85FA1153, (int32_t)0xDA17BA4A, (int32_t)0x85BDEF28,
+    (int32_t)0xDAD7F3A2, (int32_t)0x8582FAA5, (int32_t)0xDB9888A8, (int32_t)0x8549345C,
+    (int32_t)0xDC597781, (int32_t)0x85109CDD, (int32_t)0xDD1ABE51, (int32_t)0x84D934B1,
+    (int32_t)0xDDDC5B3B, (int32_t)0x84A2FC62, (int32_t)0xDE9E4C60, (int32_t)0x846DF477,
+    (int32_t)0xDF608FE4, (int32_t)0x843A1D70, (int32_t)0xE02323E5, (int32_t)0x840777D0,
+    (int32_t)0xE0E60685, (int32_t)0x83D60412, (int32_t)0xE1A935E2, (int32_t)0x83A5C2B0,
+    (int32_t)0xE26CB01B, (int32_t)0x8376B422, (int32_t)0xE330734D, (int32_t)0x8348D8DC,
+    (int32_t)0xE3F47D96, (int32_t)0x831C314E, (int32_t)0xE4B8CD11, (int32_t)0x82F0BDE8,
+    (int32_t)0xE57D5FDA, (int32_t)0x82C67F14, (int32_t)0xE642340D, (int32_t)0x829D753A,
+    (int32_t)0xE70747C4, (int32_t)0x8275A0C0, (int32_t)0xE7CC9917, (int32_t)0x824F0208,
+    (int32_t)0xE8922622, (int32_t)0x82299971, (int32_t)0xE957ECFB, (int32_t)0x82056758,
+    (int32_t)0xEA1DEBBB, (int32_t)0x81E26C16, (int32_t)0xEAE4207A, (int32_t)0x81C0A801,
+    (int32_t)0xEBAA894F, (int32_t)0x81A01B6D, (int32_t)0xEC71244F, (int32_t)0x8180C6A9,
+    (int32_t)0xED37EF91, (int32_t)0x8162AA04, (int32_t)0xEDFEE92B, (int32_t)0x8145C5C7,
+    (int32_t)0xEEC60F31, (int32_t)0x812A1A3A, (int32_t)0xEF8D5FB8, (int32_t)0x810FA7A0,
+    (int32_t)0xF054D8D5, (int32_t)0x80F66E3C, (int32_t)0xF11C789A, (int32_t)0x80DE6E4C,
+    (int32_t)0xF1E43D1C, (int32_t)0x80C7A80A, (int32_t)0xF2AC246E, (int32_t)0x80B21BAF,
+    (int32_t)0xF3742CA2, (int32_t)0x809DC971, (int32_t)0xF43C53CB, (int32_t)0x808AB180,
+    (int32_t)0xF50497FB, (int32_t)0x8078D40D, (int32_t)0xF5CCF743, (int32_t)0x80683143,
+    (int32_t)0xF6956FB7, (int32_t)0x8058C94C, (int32_t)0xF75DFF66, (int32_t)0x804A9C4D,
+    (int32_t)0xF826A462, (int32_t)0x803DAA6A, (int32_t)0xF8EF5CBB, (int32_t)0x8031F3C2,
+    (int32_t)0xF9B82684, (int32_t)0x80277872, (int32_t)0xFA80FFCB, (int32_t)0x801E3895,
+    (int32_t)0xFB49E6A3, (int32_t)0x80163440, (int32_t)0xFC12D91A, (int32_t)0x800F6B88,
+    (int32_t)0xFCDBD541, (int32_t)0x8009DE7E, (int32_t)0xFDA4D929, (int32_t)0x80058D2F,
+    (int32_t)0xFE6DE2E0, (int32_t)0x800277A6, (int32_t)0xFF36F078, (int32_t)0x80009DEA
+};
+
+/**
+  @par
+  Example code for q31 Twiddle factors Generation::
+  @par
+  <pre>for (i = 0; i< 3N/4; i++)
+  {
+     twiddleCoefq31[2*i]   = cos(i * 2*PI/(float)N);
+     twiddleCoefq31[2*i+1] = sin(i * 2*PI/(float)N);
+  } </pre>
+  @par
+  where N = 2048, PI = 3.14159265358979
+  @par
+  Cos and Sin values are interleaved fashion
+  @par
+  Convert Floating point to q31(Fixed point 1.31):
+        round(twiddleCoefq31(i) * pow(2, 31))
+ */
+const int32_t twiddleCoef_2048_q32[3072] = {
+    (int32_t)0x7FFFFFFF, (int32_t)0x00000000, (int32_t)0x7FFFD886, (int32_t)0x006487E3,
+    (int32_t)0x7FFF6216, (int32_t)0x00C90F88, (int32_t)0x7FFE9CB2, (int32_t)0x012D96B1,
+    (int32_t)0x7FFD885A, (int32_t)0x01921D20, (int32_t)0x7FFC250F, (int32_t)0x01F6A297,
+    (int32_t)0x7FFA72D1, (int32_t)0x025B26D7, (int32_t)0x7FF871A2, (int32_t)0x02BFA9A4,
+    (int32_t)0x7FF62182, (int32_t)0x03242ABF, (int32_t)0x7FF38274, (int32_t)0x0388A9EA,
+    (int32_t)0x7FF09478, (int32_t)0x03ED26E6, (int32_t)0x7FED5791, (int32_t)0x0451A177,
+    (int32_t)0x7FE9CBC0, (int32_t)0x04B6195D, (int32_t)0x7FE5F108, (int32_t)0x051A8E5C,
+    (int32_t)0x7FE1C76B, (int32_t)0x057F0035, (int32_t)0x7FDD4EEC, (int32_t)0x05E36EA9,
+    (int32_t)0x7FD8878E, (int32_t)0x0647D97C, (int32_t)0x7FD37153, (int32_t)0x06AC406F,
+    (int32_t)0x7FCE0C3E, (int32_t)0x0710A345, (int32_t)0x7FC85854, (int32_t)0x077501BE,
+    (int32_t)0x7FC25596, (int32_t)0x07D95B9E, (int32_t)0x7FBC040A, (int32_t)0x083DB0A7,
+    (int32_t)0x7FB563B3, (int32_t)0x08A2009A, (int32_t)0x7FAE7495, (int32_t)0x09064B3A,
+    (int32_t)0x7FA736B4, (int32_t)0x096A9049, (int32_t)0x7F9FAA15, (int32_t)0x09CECF89,
+    (int32_t)0x7F97CEBD, (int32_t)0x0A3308BD, (int32_t)0x7F8FA4B0, (int32_t)0x0A973BA5,
+    (int32_t)0x7F872BF3, (int32_t)0x0AFB6805, (int32_t)0x7F7E648C, (int32_t)0x0B5F8D9F,
+    (int32_t)0x7F754E80, (int32_t)0x0BC3AC35, (int32_t)0x7F6BE9D4, (int32_t)0x0C27C389,
+    (int32_t)0x7F62368F, (int32_t)0x0C8BD35E, (int32_t)0x7F5834B7, (int32_t)0x0CEFDB76,
+    (int32_t)0x7F4DE451, (int32_t)0x0D53DB92, (int32_t)0x7F434563, (int32_t)0x0DB7D376,
+    (int32_t)0x7F3857F6, (int32_t)0x0E1BC2E4, (int32_t)0x7F2D1C0E, (int32_t)0x0E7FA99E,
+    (int32_t)0x7F2191B4, (int32_t)0x0EE38766, (int32_t)0x7F15B8EE, (int32_t)0x0F475BFF,
+    (int32_t)0x7F0991C4, (int32_t)0x0FAB272B, (int32_t)0x7EFD1C3C, (int32_t)0x100EE8AD,
+    (int32_t)0x7EF05860, (int32_t)0x1072A048, (int32_t)0x7EE34636, (int32_t)0x10D64DBD,
+    (int32_t)0x7ED5E5C6, (int32_t)0x1139F0CF, (int32_t)0x7EC8371A, (int32_t)0x119D8941,
+    (int32_t)0x7EBA3A39, (int32_t)0x120116D5, (int32_t)0x7EABEF2C, (int32_t)0x1264994E,
+    (int32_t)0x7E9D55FC, (int32_t)0x12C8106F, (int32_t)0x7E8E6EB2, (int32_t)0x132B7BF9,
+    (int32_t)0x7E7F3957, (int32_t)0x138EDBB1, (int32_t)0x7E6FB5F4, (int32_t)0x13F22F58,
+    (int32_t)0x7E5FE493, (int32_t)0x145576B1, (int32_t)0x7E4FC53E, (int32_t)0x14B8B17F,
+    (int32_t)0x7E3F57FF, (int32_t)0x151BDF86, (int32_t)0x7E2E9CDF, (int32_t)0x157F0086,
+    (int32_t)0x7E1D93EA, (int32_t)0x15E21445, (int32_t)0x7E0C3D29, (int32_t)0x16451A83,
+    (int32_t)0x7DFA98A8, (int32_t)0x16A81305, (int32_t)0x7DE8A670, (int32_t)0x170AFD8D,
+    (int32_t)0x7DD6668F, (int32_t)0x176DD9DE, (int32_t)0x7DC3D90D, (int32_t)0x17D0A7BC,
+    (int32_t)0x7DB0FDF8, (int32_t)0x183366E9, (int32_t)0x7D9DD55A, (int32_t)0x18961728,
+    (int32_t)0x7D8A5F40, (int32_t)0x18F8B83C, (int32_t)0x7D769BB5, (int32_t)0x195B49EA,
+    (int32_t)0x7D628AC6, (int32_t)0x19BDCBF3, (int32_t)0x7D4E2C7F, (int32_t)0x1A203E1B,
+    (int32_t)0x7D3980EC, (int32_t)0x1A82A026, (int32_t)0x7D24881B, (int32_t)0x1AE4F1D6,
+    (int32_t)0x7D0F4218, (int32_t)0x1B4732EF, (int32_t)0x7CF9AEF0, (int32_t)0x1BA96335,
+    (int32_t)0x7CE3CEB2, (int32_t)0x1C0B826A, (int32_t)0x7CCDA169, (int32_t)0x1C6D9053,
+    (int32_t)0x7CB72724, (int32_t)0x1CCF8CB3, (int32_t)0x7CA05FF1, (int32_t)0x1D31774D,
+    (int32_t)0x7C894BDE, (int32_t)0x1D934FE5, (int32_t)0x7C71EAF9, (int32_t)0x1DF5163F,
+    (int32_t)0x7C5A3D50, (int32_t)0x1E56CA1E, (int32_t)0x7C4242F2, (int32_t)0x1EB86B46,
+    (int32_t)0x7C29FBEE, (int32_t)0x1F19F97B, (int32_t)0x7C116853, (int32_t)0x1F7B7481,
+    (int32_t)0x7BF88830, (int32_t)0x1FDCDC1B, (int32_t)0x7BDF5B94, (int32_t)0x203E300D,
+    (int32_t)0x7BC5E290, (int32_t)0x209F701C, (int32_t)0x7BAC1D31, (int32_t)0x21009C0C,
+    (int32_t)0x7B920B89, (int32_t)0x2161B3A0, (int32_t)0x7B77ADA8, (int32_t)0x21C2B69C,
+    (int32_t)0x7B5D039E, (int32_t)0x2223A4C5, (int32_t)0x7B420D7A, (int32_t)0x22847DE0,
+    (int32_t)0x7B26CB4F, (int32_t)0x22E541AF, (int32_t)0x7B0B3D2C, (int32_t)0x2345EFF8,
+    (int32_t)0x7AEF6323, (int32_t)0x23A6887F, (int32_t)0x7AD33D45, (int32_t)0x24070B08,
+    (int32_t)0x7AB6CBA4, (int32_t)0x24677758, (int32_t)0x7A9A0E50, (int32_t)0x24C7CD33,
+    (int32_t)0x7A7D055B, (int32_t)0x25280C5E, (int32_t)0x7A5FB0D8, (int32_t)0x2588349D,
+    (int32_t)0x7A4210D8, (int32_t)0x25E845B6, (int32_t)0x7A24256F, (int32_t)0x26483F6C,
+    (int32_t)0x7A05EEAD, (int32_t)0x26A82186, (int32_t)0x79E76CA7, (int32_t)0x2707EBC7,
+    (int32_t)0x79C89F6E, (int32_t)0x27679DF4, (int32_t)0x79A98715, (int32_t)0x27C737D3,
+    (int32_t)0x798A23B1, (int32_t)0x2826B928, (int32_t)0x796A7554, (int32_t)0x288621B9,
+    (int32_t)0x794A7C12, (int32_t)0x28E5714B, (int32_t)0x792A37FE, (int32_t)0x2944A7A2,
+    (int32_t)0x7909A92D, (int32_t)0x29A3C485, (int32_t)0x78E8CFB2, (int32_t)0x2A02C7B8,
+    (int32_t)0x78C7ABA2, (int32_t)0x2A61B101, (int32_t)0x78A63D11, (int32_t)0x2AC08026,
+    (int32_t)0x78848414, (int32_t)0x2B1F34EB, (int32_t)0x786280BF, (int32_t)0x2B7DCF17,
+    (int32_t)0x78403329, (int32_t)0x2BDC4E6F, (int32_t)0x781D9B65, (int32_t)0x2C3AB2B9,
+    (int32_t)0x77FAB989, (int32_t)0x2C98FBBA, (int32_t)0x77D78DAA, (int32_t)0x2CF72939,
+    (int32_t)0x77B417DF, (int32_t)0x2D553AFC, (int32_t)0x7790583E, (int32_t)0x2DB330C7,
+    (int32_t)0x776C4EDB, (int32_t)0x2E110A62, (int32_t)0x7747FBCE, (int32_t)0x2E6EC792,
+    (int32_t)0x77235F2D, (int32_t)0x2ECC681E, (int32_t)0x76FE790E, (int32_t)0x2F29EBCC,
+    (int32_t)0x76D94989, (int32_t)0x2F875262, (int32_t)0x76B3D0B4, (int32_t)0x2FE49BA7,
+    (int32_t)0x768E0EA6, (int32_t)0x3041C761, (int32_t)0x76680376, (int32_t)0x309ED556,
+    (int32_t)0x7641AF3D, (int32_t)0x30FBC54D, (int32_t)0x761B1211, (int32_t)0x3158970E,
+    (int32_t)0x75F42C0B, (int32_t)0x31B54A5E, (int32_t)0x75CCFD42, (int32_t)0x3211DF04,
+    (int32_t)0x75A585CF, (int32_t)0x326E54C7, (int32_t)0x757DC5CA, (int32_t)0x32CAAB6F,
+    (int32_t)0x7555BD4C, (int32_t)0x3326E2C3, (int32_t)0x752D6C6C, (int32_t)0x3382FA88,
+    (int32_t)0x7504D345, (int32_t)0x33DEF287, (int32_t)0x74DBF1EF, (int32_t)0x343ACA87,
+    (int32_t)0x74B2C884, (int32_t)0x34968250, (int32_t)0x7489571C, (int32_t)0x34F219A8,
+    (int32_t)0x745F9DD1, (int32_t)0x354D9057, (int32_t)0x74359CBD, (int32_t)0x35A8E625,
+    (int32_t)0x740B53FB, (int32_t)0x36041AD9, (int32_t)0x73E0C3A3, (int32_t)0x365F2E3B,
+    (int32_t)0x73B5EBD1, (int32_t)0x36BA2014, (int32_t)0x738ACC9E, (int32_t)0x3714F02A,
+    (int32_t)0x735F6626, (int32_t)0x376F9E46, (int32_t)0x7333B883, (int32_t)0x37CA2A30,
+    (int32_t)0x7307C3D0, (int32_t)0x382493B0, (int32_t)0x72DB8828, (int32_t)0x387EDA8E,
+    (int32_t)0x72AF05A7, (int32_t)0x38D8FE93, (int32_t)0x72823C67, (int32_t)0x3932FF87,
+    (int32_t)0x72552C85, (int32_t)0x398CDD32, (int32_t)0x7227D61C, (int32_t)0x39E6975E,
+    (int32_t)0x71FA3949, (int32_t)0x3A402DD2, (int32_t)0x71CC5626, (int32_t)0x3A99A057,
+    (int32_t)0x719E2CD2, (int32_t)0x3AF2EEB7, (int32_t)0x716FBD68, (int32_t)0x3B4C18BA,
+    (int32_t)0x71410805, (int32_t)0x3BA51E29, (int32_t)0x71120CC5, (int32_t)0x3BFDFECD,
+    (int32_t)0x70E2CBC6, (int32_t)0x3C56BA70, (int32_t)0x70B34525, (int32_t)0x3CAF50DA,
+    (int32_t)0x708378FF, (int32_t)0x3D07C1D6, (int32_t)0x70536771, (int32_t)0x3D600D2C,
+    (int32_t)0x7023109A, (int32_t)0x3DB832A6, (int32_t)0x6FF27497, (int32_t)0x3E10320D,
+    (int32_t)0x6FC19385, (int32_t)0x3E680B2C, (int32_t)0x6F906D84, (int32_t)0x3EBFBDCD,
+    (int32_t)0x6F5F02B2, (int32_t)0x3F1749B8, (int32_t)0x6F2D532C, (int32_t)0x3F6EAEB8,
+    (int32_t)0x6EFB5F12, (int32_t)0x3FC5EC98, (int32_t)0x6EC92683, (int32_t)0x401D0321,
+    (int32_t)0x6E96A99D, (int32_t)0x4073F21D, (int32_t)0x6E63E87F, (int32_t)0x40CAB958,
+    (int32_t)0x6E30E34A, (int32_t)0x4121589B, (int32_t)0x6DFD9A1C, (int32_t)0x4177CFB1,
+    (int32_t)0x6DCA0D14, (int32_t)0x41CE1E65, (int32_t)0x6D963C54, (int32_t)0x42244481,
+    (int32_t)0x6D6227FA, (int32_t)0x427A41D0, (int32_t)0x6D2DD027, (int32_t)0x42D0161E,
+    (int32_t)0x6CF934FC, (int32_t)0x4325C135, (int32_t)0x6CC45698, (int32_t)0x437B42E1,
+    (int32_t)0x6C8F351C, (int32_t)0x43D09AED, (int32_t)0x6C59D0A9, (int32_t)0x4425C923,
+    (int32_t)0x6C242960, (int32_t)0x447ACD50, (int32_t)0x6BEE3F62, (int32_t)0x44CFA740,
+    (int32_t)0x6BB812D1, (int32_t)0x452456BD, (int32_t)0x6B81A3CD, (int32_t)0x4578DB93,
+    (int32_t)0x6B4AF279, (int32_t)0x45CD358F, (int32_t)0x6B13FEF5, (int32_t)0x4621647D,
+    (int32_t)0x6ADCC964, (int32_t)0x46756828, (int32_t)0x6AA551E9, (int32_t)0x46C9405C,
+    (int32_t)0x6A6D98A4, (int32_t)0x471CECE7, (int32_t)0x6A359DB9, (int32_t)0x47706D93,
+    (int32_t)0x69FD614A, (int32_t)0x47C3C22F, (int32_t)0x69C4E37A, (int32_t)0x4816EA86,
+    (int32_t)0x698C246C, (int32_t)0x4869E665, (int32_t)0x69532442, (int32_t)0x48BCB599,
+    (int32_t)0x6919E320, (int32_t)0x490F57EE, (int32_t)0x68E06129, (int32_t)0x4961CD33,
+    (int32_t)0x68A69E81, (int32_t)0x49B41533, (int32_t)0x686C9B4B, (int32_t)0x4A062FBD,
+    (int32_t)0x683257AB, (int32_t)0x4A581C9E, (int32_t)0x67F7D3C5, (int32_t)0x4AA9DBA2,
+    (int32_t)0x67BD0FBD, (int32_t)0x4AFB6C98, (int32_t)0x67820BB7, (int32_t)0x4B4CCF4D,
+    (int32_t)0x6746C7D8, (int32_t)0x4B9E0390, (int32_t)0x670B4444, (int32_t)0x4BEF092D,
+    (int32_t)0x66CF8120, (int32_t)0x4C3FDFF4, (int32_t)0x66937E91, (int32_t)0x4C9087B1,
+    (int32_t)0x66573CBB, (int32_t)0x4CE10034, (int32_t)0x661ABBC5, (int32_t)0x4D31494B,
+    (int32_t)0x65DDFBD3, (int32_t)0x4D8162C4, (int32_t)0x65A0FD0B, (int32_t)0x4DD14C6E,
+    (int32_t)0x6563BF92, (int32_t)0x4E210617, (int32_t)0x6526438F, (int32_t)0x4E708F8F,
+    (int32_t)0x64E88926, (int32_t)0x4EBFE8A5, (int32_t)0x64AA907F, (int32_t)0x4F0F1126,
+    (int32_t)0x646C59BF, (int32_t)0x4F5E08E3, (int32_t)0x642DE50D, (int32_t)0x4FACCFAB,
+    (int32_t)0x63EF3290, (int32_t)0x4FFB654D, (int32_t)0x63B0426D, (int32_t)0x5049C999,
+    (int32_t)0x637114CC, (int32_t)0x5097FC5E, (int32_t)0x6331A9D4, (int32_t)0x50E5FD6D,
+    (int32_t)0x62F201AC, (int32_t)0x5133CC94, (int32_t)0x62B21C7B, (int32_t)0x518169A5,
+    (int32_t)0x6271FA69, (int32_t)0x51CED46E, (int32_t)0x62319B9D, (int32_t)0x521C0CC2,
+    (int32_t)0x61F1003F, (int32_t)0x5269126E, (int32_t)0x61B02876, (int32_t)0x52B5E546,
+    (int32_t)0x616F146C, (int32_t)0x53028518, (int32_t)0x612DC447, (int32_t)0x534EF1B5,
+    (int32_t)0x60EC3830, (int32_t)0x539B2AF0, (int32_t)0x60AA7050, (int32_t)0x53E73097,
+    (int32_t)0x60686CCF, (int32_t)0x5433027D, (int32_t)0x60262DD6, (int32_t)0x547EA073,
+    (int32_t)0x5FE3B38D, (int32_t)0x54CA0A4B, (int32_t)0x5FA0FE1F, (int32_t)0x55153FD4,
+    (int32_t)0x5F5E0DB3, (int32_t)0x556040E2, (int32_t)0x5F1AE274, (int32_t)0x55AB0D46,
+    (int32_t)0x5ED77C8A, (int32_t)0x55F5A4D2, (int32_t)0x5E93DC1F, (int32_t)0x56400758,
+    (int32_t)0x5E50015D, (int32_t)0x568A34A9, (int32_t)0x5E0BEC6E, (int32_t)0x56D42C99,
+    (int32_t)0x5DC79D7C, (int32_t)0x571DEEFA, (int32_t)0x5D8314B1, (int32_t)0x57677B9D,
+    (int32_t)0x5D3E5237, (int32_t)0x57B0D256, (int32_t)0x5CF95638, (int32_t)0x57F9F2F8,
+    (int32_t)0x5CB420E0, (int32_t)0x5842DD54, (int32_t)0x5C6EB258, (int32_t)0x588B9140,
+    (int32_t)0x5C290ACC, (int32_t)0x58D40E8C, (int32_t)0x5BE32A67, (int32_t)0x591C550E,
+    (int32_t)0x5B9D1154, (int32_t)0x59646498, (int32_t)0x5B56BFBD, (int32_t)0x59AC3CFD,
+    (int32_t)0x5B1035CF, (int32_t)0x59F3DE12, (int32_t)0x5AC973B5, (int32_t)0x5A3B47AB,
+    (int32_t)0x5A82799A, (int32_t)0x5A82799A, (int32_t)0x5A3B47AB, (int32_t)0x5AC973B5,
+    (int32_t)0x59F3DE12, (int32_t)0x5B1035CF, (int32_t)0x59AC3CFD, (int32_t)0x5B56BFBD,
+    (int32_t)0x59646498, (int32_t)0x5B9D1154, (int32_t)0x591C550E, (int32_t)0x5BE32A67,
+    (int32_t)0x58D40E8C, (int32_t)0x5C290ACC, (int32_t)0x588B9140, (int32_t)0x5C6EB258,
+    (int32_t)0x5842DD54, (int32_t)0x5CB420E0, (int32_t)0x57F9F2F8, (int32_t)0x5CF95638,
+    (int32_t)0x57B0D256, (int32_t)0x5D3E5237, (int32_t)0x57677B9D, (int32_t)0x5D8314B1,
+    (int32_t)0x571DEEFA, (int32_t)0x5DC79D7C, (int32_t)0x56D42C99, (int32_t)0x5E0BEC6E,
+    (int32_t)0x568A34A9, (int32_t)0x5E50015D, (int32_t)0x56400758, (int32_t)0x5E93DC1F,
+    (int32_t)0x55F5A4D2, (int32_t)0x5ED77C8A, (int32_t)0x55AB0D46, (int32_t)0x5F1AE274,
+    (int32_t)0x556040E2, (int32_t)0x5F5E0DB3, (int32_t)0x55153FD4, (int32_t)0x5FA0FE1F,
+    (int32_t)0x54CA0A4B, (int32_t)0x5FE3B38D, (int32_t)0x547EA073, (int32_t)0x60262DD6,
+    (int32_t)0x5433027D, (int32_t)0x60686CCF, (int32_t)0x53E73097, (int32_t)0x60AA7050,
+    (int32_t)0x539B2AF0, (int32_t)0x60EC3830, (int32_t)0x534EF1B5, (int32_t)0x612DC447,
+    (int32_t)0x53028518, (int32_t)0x616F146C, (int32_t)0x52B5E546, (int32_t)0x61B02876,
+    (int32_t)0x5269126E, (int32_t)0x61F1003F, (int32_t)0x521C0CC2, (int32_t)0x62319B9D,
+    (int32_t)0x51CED46E, (int32_t)0x6271FA69, (int32_t)0x518169A5, (int32_t)0x62B21C7B,
+    (int32_t)0x5133CC94, (int32_t)0x62F201AC, (int32_t)0x50E5FD6D, (int32_t)0x6331A9D4,
+    (int32_t)0x5097FC5E, (int32_t)0x637114CC, (int32_t)0x5049C999, (int32_t)0x63B0426D,
+    (int32_t)0x4FFB654D, (int32_t)0x63EF3290, (int32_t)0x4FACCFAB, (int32_t)0x642DE50D,
+    (int32_t)0x4F5E08E3, (int32_t)0x646C59BF, (int32_t)0x4F0F1126, (int32_t)0x64AA907F,
+    (int32_t)0x4EBFE8A5, (int32_t)0x64E88926, (int32_t)0x4E708F8F, (int32_t)0x6526438F,
+    (int32_t)0x4E210617, (int32_t)0x6563BF92, (int32_t)0x4DD14C6E, (int32_t)0x65A0FD0B,
+    (int32_t)0x4D8162C4, (int32_t)0x65DDFBD3, (int32_t)0x4D31494B, (int32_t)0x661ABBC5,
+    (int32_t)0x4CE10034, (int32_t)0x66573CBB, (int32_t)0x4C9087B1, (int32_t)0x66937E91,
+    (int32_t)0x4C3FDFF4, (int32_t)0x66CF8120, (int32_t)0x4BEF092D, (int32_t)0x670B4444,
+    (int32_t)0x4B9E0390, (int32_t)0x6746C7D8, (int32_t)0x4B4CCF4D, (int32_t)0x67820BB7,
+    (int32_t)0x4AFB6C98, (int32_t)0x67BD0FBD, (int32_t)0x4AA9DBA2, (int32_t)0x67F7D3C5,
+    (int32_t)0x4A581C9E, (int32_t)0x683257AB, (int32_t)0x4A062FBD, (int32_t)0x686C9B4B,
+    (int32_t)0x49B41533, (int32_t)0x68A69E81, (int32_t)0x4961CD33, (int32_t)0x68E06129,
+    (int32_t)0x490F57EE, (int32_t)0x6919E320, (int32_t)0x48BCB599, (int32_t)0x69532442,
+    (int32_t)0x4869E665, (int32_t)0x698C246C, (int32_t)0x4816EA86, (int32_t)0x69C4E37A,
+    (int32_t)0x47C3C22F, (int32_t)0x69FD614A, (int32_t)0x47706D93, (int32_t)0x6A359DB9,
+    (int32_t)0x471CECE7, (int32_t)0x6A6D98A4, (int32_t)0x46C9405C, (int32_t)0x6AA551E9,
+    (int32_t)0x46756828, (int32_t)0x6ADCC964, (int32_t)0x4621647D, (int32_t)0x6B13FEF5,
+    (int32_t)0x45CD358F, (int32_t)0x6B4AF279, (int32_t)0x4578DB93, (int32_t)0x6B81A3CD,
+    (int32_t)0x452456BD, (int32_t)0x6BB812D1, (int32_t)0x44CFA740, (int32_t)0x6BEE3F62,
+    (int32_t)0x447ACD50, (int32_t)0x6C242960, (int32_t)0x4425C923, (int32_t)0x6C59D0A9,
+    (int32_t)0x43D09AED, (int32_t)0x6C8F351C, (int32_t)0x437B42E1, (int32_t)0x6CC45698,
+    (int32_t)0x4325C135, (int32_t)0x6CF934FC, (int32_t)0x42D0161E, (int32_t)0x6D2DD027,
+    (int32_t)0x427A41D0, (int32_t)0x6D6227FA, (int32_t)0x42244481, (int32_t)0x6D963C54,
+    (int32_t)0x41CE1E65, (int32_t)0x6DCA0D14, (int32_t)0x4177CFB1, (int32_t)0x6DFD9A1C,
+    (int32_t)0x4121589B, (int32_t)0x6E30E34A, (int32_t)0x40CAB958, (int32_t)0x6E63E87F,
+    (int32_t)0x4073F21D, (int32_t)0x6E96A99D, (int32_t)0x401D0321, (int32_t)0x6EC92683,
+    (int32_t)0x3FC5EC98, (int32_t)0x6EFB5F12, (int32_t)0x3F6EAEB8, (int32_t)0x6F2D532C,
+    (int32_t)0x3F1749B8, (int32_t)0x6F5F02B2, (int32_t)0x3EBFBDCD, (int32_t)0x6F906D84,
+    (int32_t)0x3E680B2C, (int32_t)0x6FC19385, (int32_t)0x3E10320D, (int32_t)0x6FF27497,
+    (int32_t)0x3DB832A6, (int32_t)0x7023109A, (int32_t)0x3D600D2C, (int32_t)0x70536771,
+    (int32_t)0x3D07C1D6, (int32_t)0x708378FF, (int32_t)0x3CAF50DA, (int32_t)0x70B34525,
+    (int32_t)0x3C56BA70, (int32_t)0x70E2CBC6, (int32_t)0x3BFDFECD, (int32_t)0x71120CC5,
+    (int32_t)0x3BA51E29, (int32_t)0x71410805, (int32_t)0x3B4C18BA, (int32_t)0x716FBD68,
+    (int32_t)0x3AF2EEB7, (int32_t)0x719E2CD2, (int32_t)0x3A99A057, (int32_t)0x71CC5626,
+    (int32_t)0x3A402DD2, (int32_t)0x71FA3949, (int32_t)0x39E6975E, (int32_t)0x7227D61C,
+    (int32_t)0x398CDD32, (int32_t)0x72552C85, (int32_t)0x3932FF87, (int32_t)0x72823C67,
+    (int32_t)0x38D8FE93, (int32_t)0x72AF05A7, (int32_t)0x387EDA8E, (int32_t)0x72DB8828,
+    (int32_t)0x382493B0, (int32_t)0x7307C3D0, (int32_t)0x37CA2A30, (int32_t)0x7333B883,
+    (int32_t)0x376F9E46, (int32_t)0x735F6626, (int32_t)0x3714F02A, (int32_t)0x738ACC9E,
+    (int32_t)0x36BA2014, (int32_t)0x73B5EBD1, (int32_t)0x365F2E3B, (int32_t)0x73E0C3A3,
+    (int32_t)0x36041AD9, (int32_t)0x740B53FB, (int32_t)0x35A8E625, (int32_t)0x74359CBD,
+    (int32_t)0x354D9057, (int32_t)0x745F9DD1, (int32_t)0x34F219A8, (int32_t)0x7489571C,
+    (int32_t)0x34968250, (int32_t)0x74B2C884, (int32_t)0x343ACA87, (int32_t)0x74DBF1EF,
+    (int32_t)0x33DEF287, (int32_t)0x7504D345, (int32_t)0x3382FA88, (int32_t)0x752D6C6C,
+    (int32_t)0x3326E2C3, (int32_t)0x7555BD4C, (int32_t)0x32CAAB6F, (int32_t)0x757DC5CA,
+    (int32_t)0x326E54C7, (int32_t)0x75A585CF, (int32_t)0x3211DF04, (int32_t)0x75CCFD42,
+    (int32_t)0x31B54A5E, (int32_t)0x75F42C0B, (int32_t)0x3158970E, (int32_t)0x761B1211,
+    (int32_t)0x30FBC54D, (int32_t)0x7641AF3D, (int32_t)0x309ED556, (int32_t)0x76680376,
+    (int32_t)0x3041C761, (int32_t)0x768E0EA6, (int32_t)0x2FE49BA7, (int32_t)0x76B3D0B4,
+    (int32_t)0x2F875262, (int32_t)0x76D94989, (int32_t)0x2F29EBCC, (int32_t)0x76FE790E,
+    (int32_t)0x2ECC681E, (int32_t)0x77235F2D, (int32_t)0x2E6EC792, (int32_t)0x7747FBCE,
+    (int32_t)0x2E110A62, (int32_t)0x776C4EDB, (int32_t)0x2DB330C7, (int32_t)0x7790583E,
+    (int32_t)0x2D553AFC, (int32_t)0x77B417DF, (int32_t)0x2CF72939, (int32_t)0x77D78DAA,
+    (int32_t)0x2C98FBBA, (int32_t)0x77FAB989, (int32_t)0x2C3AB2B9, (int32_t)0x781D9B65,
+    (int32_t)0x2BDC4E6F, (int32_t)0x78403329, (int32_t)0x2B7DCF17, (int32_t)0x786280BF,
+    (int32_t)0x2B1F34EB, (int32_t)0x78848414, (int32_t)0x2AC08026, (int32_t)0x78A63D11,
+    (int32_t)0x2A61B101, (int32_t)0x78C7ABA2, (int32_t)0x2A02C7B8, (int32_t)0x78E8CFB2,
+    (int32_t)0x29A3C485, (int32_t)0x7909A92D, (int32_t)0x2944A7A2, (int32_t)0x792A37FE,
+    (int32_t)0x28E5714B, (int32_t)0x794A7C12, (int32_t)0x288621B9, (int32_t)0x796A7554,
+    (int32_t)0x2826B928, (int32_t)0x798A23B1, (int32_t)0x27C737D3, (int32_t)0x79A98715,
+    (int32_t)0x27679DF4, (int32_t)0x79C89F6E, (int32_t)0x2707EBC7, (int32_t)0x79E76CA7,
+    (int32_t)0x26A82186, (int32_t)0x7A05EEAD, (int32_t)0x26483F6C, (int32_t)0x7A24256F,
+    (int32_t)0x25E845B6, (int32_t)0x7A4210D8, (int32_t)0x2588349D, (int32_t)0x7A5FB0D8,
+    (int32_t)0x25280C5E, (int32_t)0x7A7D055B, (int32_t)0x24C7CD33, (int32_t)0x7A9A0E50,
+    (int32_t)0x24677758, (int32_t)0x7AB6CBA4, (int32_t)0x24070B08, (int32_t)0x7AD33D45,
+    (int32_t)0x23A6887F, (int32_t)0x7AEF6323, (int32_t)0x2345EFF8, (int32_t)0x7B0B3D2C,
+    (int32_t)0x22E541AF, (int32_t)0x7B26CB4F, (int32_t)0x22847DE0, (int32_t)0x7B420D7A,
+    (int32_t)0x2223A4C5, (int32_t)0x7B5D039E, (int32_t)0x21C2B69C, (int32_t)0x7B77ADA8,
+    (int32_t)0x2161B3A0, (int32_t)0x7B920B89, (int32_t)0x21009C0C, (int32_t)0x7BAC1D31,
+    (int32_t)0x209F701C, (int32_t)0x7BC5E290, (int32_t)0x203E300D, (int32_t)0x7BDF5B94,
+    (int32_t)0x1FDCDC1B, (int32_t)0x7BF88830, (int32_t)0x1F7B7481, (int32_t)0x7C116853,
+    (int32_t)0x1F19F97B, (int32_t)0x7C29FBEE, (int32_t)0x1EB86B46, (int32_t)0x7C4242F2,
+    (int32_t)0x1E56CA1E, (int32_t)0x7C5A3D50, (int32_t)0x1DF5163F, (int32_t)0x7C71EAF9,
+    (int32_t)0x1D934FE5, (int32_t)0x7C894BDE, (int32_t)0x1D31774D, (int32_t)0x7CA05FF1,
+    (int32_t)0x1CCF8CB3, (int32_t)0x7CB72724, (int32_t)0x1C6D9053, (int32_t)0x7CCDA169,
+    (int32_t)0x1C0B826A, (int32_t)0x7CE3CEB2, (int32_t)0x1BA96335, (int32_t)0x7CF9AEF0,
+    (int32_t)0x1B4732EF, (int32_t)0x7D0F4218, (int32_t)0x1AE4F1D6, (int32_t)0x7D24881B,
+    (int32_t)0x1A82A026, (int32_t)0x7D3980EC, (int32_t)0x1A203E1B, (int32_t)0x7D4E2C7F,
+    (int32_t)0x19BDCBF3, (int32_t)0x7D628AC6, (int32_t)0x195B49EA, (int32_t)0x7D769BB5,
+    (int32_t)0x18F8B83C, (int32_t)0x7D8A5F40, (int32_t)0x18961728, (int32_t)0x7D9DD55A,
+    (int32_t)0x183366E9, (int32_t)0x7DB0FDF8, (int32_t)0x17D0A7BC, (int32_t)0x7DC3D90D,
+    (int32_t)0x176DD9DE, (int32_t)0x7DD6668F, (int32_t)0x170AFD8D, (int32_t)0x7DE8A670,
+    (int32_t)0x16A81305, (int32_t)0x7DFA98A8, (int32_t)0x16451A83, (int32_t)0x7E0C3D29,
+    (int32_t)0x15E21445, (int32_t)0x7E1D93EA, (int32_t)0x157F0086, (int32_t)0x7E2E9CDF,
+    (int32_t)0x151BDF86, (int32_t)0x7E3F57FF, (int32_t)0x14B8B17F, (int32_t)0x7E4FC53E,
+    (int32_t)0x145576B1, (int32_t)0x7E5FE493, (int32_t)0x13F22F58, (int32_t)0x7E6FB5F4,
+    (int32_t)0x138EDBB1, (int32_t)0x7E7F3957, (int32_t)0x132B7BF9, (int32_t)0x7E8E6EB2,
+    (int32_t)0x12C8106F, (int32_t)0x7E9D55FC, (int32_t)0x1264994E, (int32_t)0x7EABEF2C,
+    (int32_t)0x120116D5, (int32_t)0x7EBA3A39, (int32_t)0x119D8941, (int32_t)0x7EC8371A,
+    (int32_t)0x1139F0CF, (int32_t)0x7ED5E5C6, (int32_t)0x10D64DBD, (int32_t)0x7EE34636,
+    (int32_t)0x1072A048, (int32_t)0x7EF05860, (int32_t)0x100EE8AD, (int32_t)0x7EFD1C3C,
+    (int32_t)0x0FAB272B, (int32_t)0x7F0991C4, (int32_t)0x0F475BFF, (int32_t)0x7F15B8EE,
+    (int32_t)0x0EE38766, (int32_t)0x7F2191B4, (int32_t)0x0E7FA99E, (int32_t)0x7F2D1C0E,
+    (int32_t)0x0E1BC2E4, (int32_t)0x7F3857F6, (int32_t)0x0DB7D376, (int32_t)0x7F434563,
+    (int32_t)0x0D53DB92, (int32_t)0x7F4DE451, (int32_t)0x0CEFDB76, (int32_t)0x7F5834B7,
+    (int32_t)0x0C8BD35E, (int32_t)0x7F62368F, (int32_t)0x0C27C389, (int32_t)0x7F6BE9D4,
+    (int32_t)0x0BC3AC35, (int32_t)0x7F754E80, (int32_t)0x0B5F8D9F, (int32_t)0x7F7E648C,
+    (int32_t)0x0AFB6805, (int32_t)0x7F872BF3, (int32_t)0x0A973BA5, (int32_t)0x7F8FA4B0,
+    (int32_t)0x0A3308BD, (int32_t)0x7F97CEBD, (int32_t)0x09CECF89, (int32_t)0x7F9FAA15,
+    (int32_t)0x096A9049, (int32_t)0x7FA736B4, (int32_t)0x09064B3A, (int32_t)0x7FAE7495,
+    (int32_t)0x08A2009A, (int32_t)0x7FB563B3, (int32_t)0x083DB0A7, (int32_t)0x7FBC040A,
+    (int32_t)0x07D95B9E, (int32_t)0x7FC25596, (int32_t)0x077501BE, (int32_t)0x7FC85854,
+    (int32_t)0x0710A345, (int32_t)0x7FCE0C3E, (int32_t)0x06AC406F, (int32_t)0x7FD37153,
+    (int32_t)0x0647D97C, (int32_t)0x7FD8878E, (int32_t)0x05E36EA9, (int32_t)0x7FDD4EEC,
+    (int32_t)0x057F0035, (int32_t)0x7FE1C76B, (int32_t)0x051A8E5C, (int32_t)0x7FE5F108,
+    (int32_t)0x04B6195D, (int32_t)0x7FE9CBC0, (int32_t)0x0451A177, (int32_t)0x7FED5791,
+    (int32_t)0x03ED26E6, (int32_t)0x7FF09478, (int32_t)0x0388A9EA, (int32_t)0x7FF38274,
+    (int32_t)0x03242ABF, (int32_t)0x7FF62182, (int32_t)0x02BFA9A4, (int32_t)0x7FF871A2,
+    (int32_t)0x025B26D7, (int32_t)0x7FFA72D1, (int32_t)0x01F6A297, (int32_t)0x7FFC250F,
+    (int32_t)0x01921D20, (int32_t)0x7FFD885A, (int32_t)0x012D96B1, (int32_t)0x7FFE9CB2,
+    (int32_t)0x00C90F88, (int32_t)0x7FFF6216, (int32_t)0x006487E3, (int32_t)0x7FFFD886,
+    (int32_t)0x00000000, (int32_t)0x7FFFFFFF, (int32_t)0xFF9B781D, (int32_t)0x7FFFD886,
+    (int32_t)0xFF36F078, (int32_t)0x7FFF6216, (int32_t)0xFED2694F, (int32_t)0x7FFE9CB2,
+    (int32_t)0xFE6DE2E0, (int32_t)0x7FFD885A, (int32_t)0xFE095D69, (int32_t)0x7FFC250F,
+    (int32_t)0xFDA4D929, (int32_t)0x7FFA72D1, (int32_t)0xFD40565C, (int32_t)0x7FF871A2,
+    (int32_t)0xFCDBD541, (int32_t)0x7FF62182, (int32_t)0xFC775616, (int32_t)0x7FF38274,
+    (int32_t)0xFC12D91A, (int32_t)0x7FF09478, (int32_t)0xFBAE5E89, (int32_t)0x7FED5791,
+    (int32_t)0xFB49E6A3, (int32_t)0x7FE9CBC0, (int32_t)0xFAE571A4, (int32_t)0x7FE5F108,
+    (int32_t)0xFA80FFCB, (int32_t)0x7FE1C76B, (int32_t)0xFA1C9157, (int32_t)0x7FDD4EEC,
+    (int32_t)0xF9B82684, (int32_t)0x7FD8878E, (int32_t)0xF953BF91, (int32_t)0x7FD37153,
+    (int32_t)0xF8EF5CBB, (int32_t)0x7FCE0C3E, (int32_t)0xF88AFE42, (int32_t)0x7FC85854,
+    (int32_t)0xF826A462, (int32_t)0x7FC25596, (int32_t)0xF7C24F59, (int32_t)0x7FBC040A,
+    (int32_t)0xF75DFF66, (int32_t)0x7FB563B3, (int32_t)0xF6F9B4C6, (int32_t)0x7FAE7495,
+    (int32_t)0xF6956FB7, (int32_t)0x7FA736B4, (int32_t)0xF6313077, (int32_t)0x7F9FAA15,
+    (int32_t)0xF5CCF743, (int32_t)0x7F97CEBD, (int32_t)0xF568C45B, (int32_t)0x7F8FA4B0,
+    (int32_t)0xF50497FB, (int32_t)0x7F872BF3, (int32_t)0xF4A07261, (int32_t)0x7F7E648C,
+    (int32_t)0xF43C53CB, (int32_t)0x7F754E80, (int32_t)0xF3D83C77, (int32_t)0x7F6BE9D4,
+    (int32_t)0xF3742CA2, (int32_t)0x7F62368F, (int32_t)0xF310248A, (int32_t)0x7F5834B7,
+    (int32_t)0xF2AC246E, (int32_t)0x7F4DE451, (int32_t)0xF2482C8A, (int32_t)0x7F434563,
+    (int32_t)0xF1E43D1C, (int32_t)0x7F3857F6, (int32_t)0xF1805662, (int32_t)0x7F2D1C0E,
+    (int32_t)0xF11C789A, (int32_t)0x7F2191B4, (int32_t)0xF0B8A401, (int32_t)0x7F15B8EE,
+    (int32_t)0xF054D8D5, (int32_t)0x7F0991C4, (int32_t)0xEFF11753, (int32_t)0x7EFD1C3C,
+    (int32_t)0xEF8D5FB8, (int32_t)0x7EF05860, (int32_t)0xEF29B243, (int32_t)0x7EE34636,
+    (int32_t)0xEEC60F31, (int32_t)0x7ED5E5C6, (int32_t)0xEE6276BF, (int32_t)0x7EC8371A,
+    (int32_t)0xEDFEE92B, (int32_t)0x7EBA3A39, (int32_t)0xED9B66B2, (int32_t)0x7EABEF2C,
+    (int32_t)0xED37EF91, (int32_t)0x7E9D55FC, (int32_t)0xECD48407, (int32_t)0x7E8E6EB2,
+    (int32_t)0xEC71244F, (int32_t)0x7E7F3957, (int32_t)0xEC0DD0A8, (int32_t)0x7E6FB5F4,
+    (int32_t)0xEBAA894F, (int32_t)0x7E5FE493, (int32_t)0xEB474E81, (int32_t)0x7E4FC53E,
+    (int32_t)0xEAE4207A, (int32_t)0x7E3F57FF, (int32_t)0xEA80FF7A, (int32_t)0x7E2E9CDF,
+    (int32_t)0xEA1DEBBB, (int32_t)0x7E1D93EA, (int32_t)0xE9BAE57D, (int32_t)0x7E0C3D29,
+    (int32_t)0xE957ECFB, (int32_t)0x7DFA98A8, (int32_t)0xE8F50273, (int32_t)0x7DE8A670,
+    (int32_t)0xE8922622, (int32_t)0x7DD6668F, (int32_t)0xE82F5844, (int32_t)0x7DC3D90D,
+    (int32_t)0xE7CC9917, (int32_t)0x7DB0FDF8, (int32_t)0xE769E8D8, (int32_t)0x7D9DD55A,
+    (int32_t)0xE70747C4, (int32_t)0x7D8A5F40, (int32_t)0xE6A4B616, (int32_t)0x7D769BB5,
+    (int32_t)0xE642340D, (int32_t)0x7D628AC6, (int32_t)0xE5DFC1E5, (int32_t)0x7D4E2C7F,
+    (int32_t)0xE57D5FDA, (int32_t)0x7D3980EC, (int32_t)0xE51B0E2A, (int32_t)0x7D24881B,
+    (int32_t)0xE4B8CD11, (int32_t)0x7D0F4218, (int32_t)0xE4569CCB, (int32_t)0x7CF9AEF0,
+    (int32_t)0xE3F47D96, (int32_t)0x7CE3CEB2, (int32_t)0xE3926FAD, (int32_t)0x7CCDA169,
+    (int32_t)0xE330734D, (int32_t)0x7CB72724, (int32_t)0xE2CE88B3, (int32_t)0x7CA05FF1,
+    (int32_t)0xE26CB01B, (int32_t)0x7C894BDE, (int32_t)0xE20AE9C1, (int32_t)0x7C71EAF9,
+    (int32_t)0xE1A935E2, (int32_t)0x7C5A3D50, (int32_t)0xE14794BA, (int32_t)0x7C4242F2,
+    (int32_t)0xE0E60685, (int32_t)0x7C29FBEE, (int32_t)0xE0848B7F, (int32_t)0x7C116853,
+    (int32_t)0xE02323E5, (int32_t)0x7BF88830, (int32_t)0xDFC1CFF3, (int32_t)0x7BDF5B94,
+    (int32_t)0xDF608FE4, (int32_t)0x7BC5E290, (int32_t)0xDEFF63F4, (int32_t)0x7BAC1D31,
+    (int32_t)0xDE9E4C60, (int32_t)0x7B920B89, (int32_t)0xDE3D4964, (int32_t)0x7B77ADA8,
+    (int32_t)0xDDDC5B3B, (int32_t)0x7B5D039E, (int32_t)0xDD7B8220, (int32_t)0x7B420D7A,
+    (int32_t)0xDD1ABE51, (int32_t)0x7B26CB4F, (int32_t)0xDCBA1008, (int32_t)0x7B0B3D2C,
+    (int32_t)0xDC597781, (int32_t)0x7AEF6323, (int32_t)0xDBF8F4F8, (int32_t)0x7AD33D45,
+    (int32_t)0xDB9888A8, (int32_t)0x7AB6CBA4, (int32_t)0xDB3832CD, (int32_t)0x7A9A0E50,
+    (int32_t)0xDAD7F3A2, (int32_t)0x7A7D055B, (int32_t)0xDA77CB63, (int32_t)0x7A5FB0D8,
+    (int32_t)0xDA17BA4A, (int32_t)0x7A4210D8, (int32_t)0xD9B7C094, (int32_t)0x7A24256F,
+    (int32_t)0xD957DE7A, (int32_t)0x7A05EEAD, (int32_t)0xD8F81439, (int32_t)0x79E76CA7,
+    (int32_t)0xD898620C, (int32_t)0x79C89F6E, (int32_t)0xD838C82D, (int32_t)0x79A98715,
+    (int32_t)0xD7D946D8, (int32_t)0x798A23B1, (int32_t)0xD779DE47, (int32_t)0x796A7554,
+    (int32_t)0xD71A8EB5, (int32_t)0x794A7C12, (int32_t)0xD6BB585E, (int32_t)0x792A37FE,
+    (int32_t)0xD65C3B7B, (int32_t)0x7909A92D, (int32_t)0xD5FD3848, (int32_t)0x78E8CFB2,
+    (int32_t)0xD59E4EFF, (int32_t)0x78C7ABA2, (int32_t)0xD53F7FDA, (int32_t)0x78A63D11,
+    (int32_t)0xD4E0CB15, (int32_t)0x78848414, (int32_t)0xD48230E9, (int32_t)0x786280BF,
+    (int32_t)0xD423B191, (int32_t)0x78403329, (int32_t)0xD3C54D47, (int32_t)0x781D9B65,
+    (int32_t)0xD3670446, (int32_t)0x77FAB989, (int32_t)0xD308D6C7, (int32_t)0x77D78DAA,
+    (int32_t)0xD2AAC504, (int32_t)0x77B417DF, (int32_t)0xD24CCF39, (int32_t)0x7790583E,
+    (int32_t)0xD1EEF59E, (int32_t)0x776C4EDB, (int32_t)0xD191386E, (int32_t)0x7747FBCE,
+    (int32_t)0xD13397E2, (int32_t)0x77235F2D, (int32_t)0xD0D61434, (int32_t)0x76FE790E,
+    (int32_t)0xD078AD9E, (int32_t)0x76D94989, (int32_t)0xD01B6459, (int32_t)0x76B3D0B4,
+    (int32_t)0xCFBE389F, (int32_t)0x768E0EA6, (int32_t)0xCF612AAA, (int32_t)0x76680376,
+    (int32_t)0xCF043AB3, (int32_t)0x7641AF3D, (int32_t)0xCEA768F2, (int32_t)0x761B1211,
+    (int32_t)0xCE4AB5A2, (int32_t)0x75F42C0B, (int32_t)0xCDEE20FC, (int32_t)0x75CCFD42,
+    (int32_t)0xCD91AB39, (int32_t)0x75A585CF, (int32_t)0xCD355491, (int32_t)0x757DC5CA,
+    (int32_t)0xCCD91D3D, (int32_t)0x7555BD4C, (int32_t)0xCC7D0578, (int32_t)0x752D6C6C,
+    (int32_t)0xCC210D79, (int32_t)0x7504D345, (int32_t)0xCBC53579, (int32_t)0x74DBF1EF,
+    (int32_t)0xCB697DB0, (int32_t)0x74B2C884, (int32_t)0xCB0DE658, (int32_t)0x7489571C,
+    (int32_t)0xCAB26FA9, (int32_t)0x745F9DD1, (int32_t)0xCA5719DB, (int32_t)0x74359CBD,
+    (int32_t)0xC9FBE527, (int32_t)0x740B53FB, (int32_t)0xC9A0D1C5, (int32_t)0x73E0C3A3,
+    (int32_t)0xC945DFEC, (int32_t)0x73B5EBD1, (int32_t)0xC8EB0FD6, (int32_t)0x738ACC9E,
+    (int32_t)0xC89061BA, (int32_t)0x735F6626, (int32_t)0xC835D5D0, (int32_t)0x7333B883,
+    (int32_t)0xC7DB6C50, (int32_t)0x7307C3D0, (int32_t)0xC7812572, (int32_t)0x72DB8828,
+    (int32_t)0xC727016D, (int32_t)0x72AF05A7, (int32_t)0xC6CD0079, (int32_t)0x72823C67,
+    (int32_t)0xC67322CE, (int32_t)0x72552C85, (int32_t)0xC61968A2, (int32_t)0x7227D61C,
+    (int32_t)0xC5BFD22E, (int32_t)0x71FA3949, (int32_t)0xC5665FA9, (int32_t)0x71CC5626,
+    (int32_t)0xC50D1149, (int32_t)0x719E2CD2, (int32_t)0xC4B3E746, (int32_t)0x716FBD68,
+    (int32_t)0xC45AE1D7, (int32_t)0x71410805, (int32_t)0xC4020133, (int32_t)0x71120CC5,
+    (int32_t)0xC3A94590, (int32_t)0x70E2CBC6, (int32_t)0xC350AF26, (int32_t)0x70B34525,
+    (int32_t)0xC2F83E2A, (int32_t)0x708378FF, (int32_t)0xC29FF2D4, (int32_t)0x70536771,
+    (int32_t)0xC247CD5A, (int32_t)0x7023109A, (int32_t)0xC1EFCDF3, (int32_t)0x6FF27497,
+    (int32_t)0xC197F4D4, (int32_t)0x6FC19385, (int32_t)0xC1404233, (int32_t)0x6F906D84,
+    (int32_t)0xC0E8B648, (int32_t)0x6F5F02B2, (int32_t)0xC0915148, (int32_t)0x6F2D532C,
+    (int32_t)0xC03A1368, (int32_t)0x6EFB5F12, (int32_t)0xBFE2FCDF, (int32_t)0x6EC92683,
+    (int32_t)0xBF8C0DE3, (int32_t)0x6E96A99D, (int32_t)0xBF3546A8, (int32_t)0x6E63E87F,
+    (int32_t)0xBEDEA765, (int32_t)0x6E30E34A, (int32_t)0xBE88304F, (int32_t)0x6DFD9A1C,
+    (int32_t)0xBE31E19B, (int32_t)0x6DCA0D14, (int32_t)0xBDDBBB7F, (int32_t)0x6D963C54,
+    (int32_t)0xBD85BE30, (int32_t)0x6D6227FA, (int32_t)0xBD2FE9E2, (int32_t)0x6D2DD027,
+    (int32_t)0xBCDA3ECB, (int32_t)0x6CF934FC, (int32_t)0xBC84BD1F, (int32_t)0x6CC45698,
+    (int32_t)0xBC2F6513, (int32_t)0x6C8F351C, (int32_t)0xBBDA36DD, (int32_t)0x6C59D0A9,
+    (int32_t)0xBB8532B0, (int32_t)0x6C242960, (int32_t)0xBB3058C0, (int32_t)0x6BEE3F62,
+    (int32_t)0xBADBA943, (int32_t)0x6BB812D1, (int32_t)0xBA87246D, (int32_t)0x6B81A3CD,
+    (int32_t)0xBA32CA71, (int32_t)0x6B4AF279, (int32_t)0xB9DE9B83, (int32_t)0x6B13FEF5,
+    (int32_t)0xB98A97D8, (int32_t)0x6ADCC964, (int32_t)0xB936BFA4, (int32_t)0x6AA551E9,
+    (int32_t)0xB8E31319, (int32_t)0x6A6D98A4, (int32_t)0xB88F926D, (int32_t)0x6A359DB9,
+    (int32_t)0xB83C3DD1, (int32_t)0x69FD614A, (int32_t)0xB7E9157A, (int32_t)0x69C4E37A,
+    (int32_t)0xB796199B, (int32_t)0x698C246C, (int32_t)0xB7434A67, (int32_t)0x69532442,
+    (int32_t)0xB6F0A812, (int32_t)0x6919E320, (int32_t)0xB69E32CD, (int32_t)0x68E06129,
+    (int32_t)0xB64BEACD, (int32_t)0x68A69E81, (int32_t)0xB5F9D043, (int32_t)0x686C9B4B,
+    (int32_t)0xB5A7E362, (int32_t)0x683257AB, (int32_t)0xB556245E, (int32_t)0x67F7D3C5,
+    (int32_t)0xB5049368, (int32_t)0x67BD0FBD, (int32_t)0xB4B330B3, (int32_t)0x67820BB7,
+    (int32_t)0xB461FC70, (int32_t)0x6746C7D8, (int32_t)0xB410F6D3, (int32_t)0x670B4444,
+    (int32_t)0xB3C0200C, (int32_t)0x66CF8120, (int32_t)0xB36F784F, (int32_t)0x66937E91,
+    (int32_t)0xB31EFFCC, (int32_t)0x66573CBB, (int32_t)0xB2CEB6B5, (int32_t)0x661ABBC5,
+    (int32_t)0xB27E9D3C, (int32_t)0x65DDFBD3, (int32_t)0xB22EB392, (int32_t)0x65A0FD0B,
+    (int32_t)0xB1DEF9E9, (int32_t)0x6563BF92, (int32_t)0xB18F7071, (int32_t)0x6526438F,
+    (int32_t)0xB140175B, (int32_t)0x64E88926, (int32_t)0xB0F0EEDA, (int32_t)0x64AA907F,
+    (int32_t)0xB0A1F71D, (int32_t)0x646C59BF, (int32_t)0xB0533055, (int32_t)0x642DE50D,
+    (int32_t)0xB0049AB3, (int32_t)0x63EF3290, (int32_t)0xAFB63667, (int32_t)0x63B0426D,
+    (int32_t)0xAF6803A2, (int32_t)0x637114CC, (int32_t)0xAF1A0293, (int32_t)0x6331A9D4,
+    (int32_t)0xAECC336C, (int32_t)0x62F201AC, (int32_t)0xAE7E965B, (int32_t)0x62B21C7B,
+    (int32_t)0xAE312B92, (int32_t)0x6271FA69, (int32_t)0xADE3F33E, (int32_t)0x62319B9D,
+    (int32_t)0xAD96ED92, (int32_t)0x61F1003F, (int32_t)0xAD4A1ABA, (int32_t)0x61B02876,
+    (int32_t)0xACFD7AE8, (int32_t)0x616F146C, (int32_t)0xACB10E4B, (int32_t)0x612DC447,
+    (int32_t)0xAC64D510, (int32_t)0x60EC3830, (int32_t)0xAC18CF69, (int32_t)0x60AA7050,
+    (int32_t)0xABCCFD83, (int32_t)0x60686CCF, (int32_t)0xAB815F8D, (int32_t)0x60262DD6,
+    (int32_t)0xAB35F5B5, (int32_t)0x5FE3B38D, (int32_t)0xAAEAC02C, (int32_t)0x5FA0FE1F,
+    (int32_t)0xAA9FBF1E, (int32_t)0x5F5E0DB3, (int32_t)0xAA54F2BA, (int32_t)0x5F1AE274,
+    (int32_t)0xAA0A5B2E, (int32_t)0x5ED77C8A, (int32_t)0xA9BFF8A8, (int32_t)0x5E93DC1F,
+    (int32_t)0xA975CB57, (int32_t)0x5E50015D, (int32_t)0xA92BD367, (int32_t)0x5E0BEC6E,
+    (int32_t)0xA8E21106, (int32_t)0x5DC79D7C, (int32_t)0xA8988463, (int32_t)0x5D8314B1,
+    (int32_t)0xA84F2DAA, (int32_t)0x5D3E5237, (int32_t)0xA8060D08, (int32_t)0x5CF95638,
+    (int32_t)0xA7BD22AC, (int32_t)0x5CB420E0, (int32_t)0xA7746EC0, (int32_t)0x5C6EB258,
+    (int32_t)0xA72BF174, (int32_t)0x5C290ACC, (int32_t)0xA6E3AAF2, (int32_t)0x5BE32A67,
+    (int32_t)0xA69B9B68, (int32_t)0x5B9D1154, (int32_t)0xA653C303, (int32_t)0x5B56BFBD,
+    (int32_t)0xA60C21EE, (int32_t)0x5B1035CF, (int32_t)0xA5C4B855, (int32_t)0x5AC973B5,
+    (int32_t)0xA57D8666, (int32_t)0x5A82799A, (int32_t)0xA5368C4B, (int32_t)0x5A3B47AB,
+    (int32_t)0xA4EFCA31, (int32_t)0x59F3DE12, (int32_t)0xA4A94043, (int32_t)0x59AC3CFD,
+    (int32_t)0xA462EEAC, (int32_t)0x59646498, (int32_t)0xA41CD599, (int32_t)0x591C550E,
+    (int32_t)0xA3D6F534, (int32_t)0x58D40E8C, (int32_t)0xA3914DA8, (int32_t)0x588B9140,
+    (int32_t)0xA34BDF20, (int32_t)0x5842DD54, (int32_t)0xA306A9C8, (int32_t)0x57F9F2F8,
+    (int32_t)0xA2C1ADC9, (int32_t)0x57B0D256, (int32_t)0xA27CEB4F, (int32_t)0x57677B9D,
+    (int32_t)0xA2386284, (int32_t)0x571DEEFA, (int32_t)0xA1F41392, (int32_t)0x56D42C99,
+    (int32_t)0xA1AFFEA3, (int32_t)0x568A34A9, (int32_t)0xA16C23E1, (int32_t)0x56400758,
+    (int32_t)0xA1288376, (int32_t)0x55F5A4D2, (int32_t)0xA0E51D8C, (int32_t)0x55AB0D46,
+    (int32_t)0xA0A1F24D, (int32_t)0x556040E2, (int32_t)0xA05F01E1, (int32_t)0x55153FD4,
+    (int32_t)0xA01C4C73, (int32_t)0x54CA0A4B, (int32_t)0x9FD9D22A, (int32_t)0x547EA073,
+    (int32_t)0x9F979331, (int32_t)0x5433027D, (int32_t)0x9F558FB0, (int32_t)0x53E73097,
+    (int32_t)0x9F13C7D0, (int32_t)0x539B2AF0, (int32_t)0x9ED23BB9, (int32_t)0x534EF1B5,
+    (int32_t)0x9E90EB94, (int32_t)0x53028518, (int32_t)0x9E4FD78A, (int32_t)0x52B5E546,
+    (int32_t)0x9E0EFFC1, (int32_t)0x5269126E, (int32_t)0x9DCE6463, (int32_t)0x521C0CC2,
+    (int32_t)0x9D8E0597, (int32_t)0x51CED46E, (int32_t)0x9D4DE385, (int32_t)0x518169A5,
+    (int32_t)0x9D0DFE54, (int32_t)0x5133CC94, (int32_t)0x9CCE562C, (int32_t)0x50E5FD6D,
+    (int32_t)0x9C8EEB34, (int32_t)0x5097FC5E, (int32_t)0x9C4FBD93, (int32_t)0x5049C999,
+    (int32_t)0x9C10CD70, (int32_t)0x4FFB654D, (int32_t)0x9BD21AF3, (int32_t)0x4FACCFAB,
+    (int32_t)0x9B93A641, (int32_t)0x4F5E08E3, (int32_t)0x9B556F81, (int32_t)0x4F0F1126,
+    (int32_t)0x9B1776DA, (int32_t)0x4EBFE8A5, (int32_t)0x9AD9BC71, (int32_t)0x4E708F8F,
+    (int32_t)0x9A9C406E, (int32_t)0x4E210617, (int32_t)0x9A5F02F5, (int32_t)0x4DD14C6E,
+    (int32_t)0x9A22042D, (int32_t)0x4D8162C4, (int32_t)0x99E5443B, (int32_t)0x4D31494B,
+    (int32_t)0x99A8C345, (int32_t)0x4CE10034, (int32_t)0x996C816F, (int32_t)0x4C9087B1,
+    (int32_t)0x99307EE0, (int32_t)0x4C3FDFF4, (int32_t)0x98F4BBBC, (int32_t)0x4BEF092D,
+    (int32_t)0x98B93828, (int32_t)0x4B9E0390, (int32_t)0x987DF449, (int32_t)0x4B4CCF4D,
+    (int32_t)0x9842F043, (int32_t)0x4AFB6C98, (int32_t)0x98082C3B, (int32_t)0x4AA9DBA2,
+    (int32_t)0x97CDA855, (int32_t)0x4A581C9E, (int32_t)0x979364B5, (int32_t)0x4A062FBD,
+    (int32_t)0x9759617F, (int32_t)0x49B41533, (int32_t)0x971F9ED7, (int32_t)0x4961CD33,
+    (int32_t)0x96E61CE0, (int32_t)0x490F57EE, (int32_t)0x96ACDBBE, (int32_t)0x48BCB599,
+    (int32_t)0x9673DB94, (int32_t)0x4869E665, (int32_t)0x963B1C86, (int32_t)0x4816EA86,
+    (int32_t)0x96029EB6, (int32_t)0x47C3C22F, (int32_t)0x95CA6247, (int32_t)0x47706D93,
+    (int32_t)0x9592675C, (int32_t)0x471CECE7, (int32_t)0x955AAE17, (int32_t)0x46C9405C,
+    (int32_t)0x9523369C, (int32_t)0x46756828, (int32_t)0x94EC010B, (int32_t)0x4621647D,
+    (int32_t)0x94B50D87, (int32_t)0x45CD358F, (int32_t)0x947E5C33, (int32_t)0x4578DB93,
+    (int32_t)0x9447ED2F, (int32_t)0x452456BD, (int32_t)0x9411C09E, (int32_t)0x44CFA740,
+    (int32_t)0x93DBD6A0, (int32_t)0x447ACD50, (int32_t)0x93A62F57, (int32_t)0x4425C923,
+    (int32_t)0x9370CAE4, (int32_t)0x43D09AED, (int32_t)0x933BA968, (int32_t)0x437B42E1,
+    (int32_t)0x9306CB04, (int32_t)0x4325C135, (int32_t)0x92D22FD9, (int32_t)0x42D0161E,
+    (int32_t)0x929DD806, (int32_t)0x427A41D0, (int32_t)0x9269C3AC, (int32_t)0x42244481,
+    (int32_t)0x9235F2EC, (int32_t)0x41CE1E65, (int32_t)0x920265E4, (int32_t)0x4177CFB1,
+    (int32_t)0x91CF1CB6, (int32_t)0x4121589B, (int32_t)0x919C1781, (int32_t)0x40CAB958,
+    (int32_t)0x91695663, (int32_t)0x4073F21D, (int32_t)0x9136D97D, (int32_t)0x401D0321,
+    (int32_t)0x9104A0EE, (int32_t)0x3FC5EC98, (int32_t)0x90D2ACD4, (int32_t)0x3F6EAEB8,
+    (int32_t)0x90A0FD4E, (int32_t)0x3F1749B8, (int32_t)0x906F927C, (int32_t)0x3EBFBDCD,
+    (int32_t)0x903E6C7B, (int32_t)0x3E680B2C, (int32_t)0x900D8B69, (int32_t)0x3E10320D,
+    (int32_t)0x8FDCEF66, (int32_t)0x3DB832A6, (int32_t)0x8FAC988F, (int32_t)0x3D600D2C,
+    (int32_t)0x8F7C8701, (int32_t)0x3D07C1D6, (int32_t)0x8F4CBADB, (int32_t)0x3CAF50DA,
+    (int32_t)0x8F1D343A, (int32_t)0x3C56BA70, (int32_t)0x8EEDF33B, (int32_t)0x3BFDFECD,
+    (int32_t)0x8EBEF7FB, (int32_t)0x3BA51E29, (int32_t)0x8E904298, (int32_t)0x3B4C18BA,
+    (int32_t)0x8E61D32E, (int32_t)0x3AF2EEB7, (int32_t)0x8E33A9DA, (int32_t)0x3A99A057,
+    (int32_t)0x8E05C6B7, (int32_t)0x3A402DD2, (int32_t)0x8DD829E4, (int32_t)0x39E6975E,
+    (int32_t)0x8DAAD37B, (int32_t)0x398CDD32, (int32_t)0x8D7DC399, (int32_t)0x3932FF87,
+    (int32_t)0x8D50FA59, (int32_t)0x38D8FE93, (int32_t)0x8D2477D8, (int32_t)0x387EDA8E,
+    (int32_t)0x8CF83C30, (int32_t)0x382493B0, (int32_t)0x8CCC477D, (int32_t)0x37CA2A30,
+    (int32_t)0x8CA099DA, (int32_t)0x376F9E46, (int32_t)0x8C753362, (int32_t)0x3714F02A,
+    (int32_t)0x8C4A142F, (int32_t)0x36BA2014, (int32_t)0x8C1F3C5D, (int32_t)0x365F2E3B,
+    (int32_t)0x8BF4AC05, (int32_t)0x36041AD9, (int32_t)0x8BCA6343, (int32_t)0x35A8E625,
+    (int32_t)0x8BA0622F, (int32_t)0x354D9057, (int32_t)0x8B76A8E4, (int32_t)0x34F219A8,
+    (int32_t)0x8B4D377C, (int32_t)0x34968250, (int32_t)0x8B240E11, (int32_t)0x343ACA87,
+    (int32_t)0x8AFB2CBB, (int32_t)0x33DEF287, (int32_t)0x8AD29394, (int32_t)0x3382FA88,
+    (int32_t)0x8AAA42B4, (int32_t)0x3326E2C3, (int32_t)0x8A823A36, (int32_t)0x32CAAB6F,
+    (int32_t)0x8A5A7A31, (int32_t)0x326E54C7, (int32_t)0x8A3302BE, (int32_t)0x3211DF04,
+    (int32_t)0x8A0BD3F5, (int32_t)0x31B54A5E, (int32_t)0x89E4EDEF, (int32_t)0x3158970E,
+    (int32_t)0x89BE50C3, (int32_t)0x30FBC54D, (int32_t)0x8997FC8A, (int32_t)0x309ED556,
+    (int32_t)0x8971F15A, (int32_t)0x3041C761, (int32_t)0x894C2F4C, (int32_t)0x2FE49BA7,
+    (int32_t)0x8926B677, (int32_t)0x2F875262, (int32_t)0x890186F2, (int32_t)0x2F29EBCC,
+    (int32_t)0x88DCA0D3, (int32_t)0x2ECC681E, (int32_t)0x88B80432, (int32_t)0x2E6EC792,
+    (int32_t)0x8893B125, (int32_t)0x2E110A62, (int32_t)0x886FA7C2, (int32_t)0x2DB330C7,
+    (int32_t)0x884BE821, (int32_t)0x2D553AFC, (int32_t)0x88287256, (int32_t)0x2CF72939,
+    (int32_t)0x88054677, (int32_t)0x2C98FBBA, (int32_t)0x87E2649B, (int32_t)0x2C3AB2B9,
+    (int32_t)0x87BFCCD7, (int32_t)0x2BDC4E6F, (int32_t)0x879D7F41, (int32_t)0x2B7DCF17,
+    (int32_t)0x877B7BEC, (int32_t)0x2B1F34EB, (int32_t)0x8759C2EF, (int32_t)0x2AC08026,
+    (int32_t)0x8738545E, (int32_t)0x2A61B101, (int32_t)0x8717304E, (int32_t)0x2A02C7B8,
+    (int32_t)0x86F656D3, (int32_t)0x29A3C485, (int32_t)0x86D5C802, (int32_t)0x2944A7A2,
+    (int32_t)0x86B583EE, (int32_t)0x28E5714B, (int32_t)0x86958AAC, (int32_t)0x288621B9,
+    (int32_t)0x8675DC4F, (int32_t)0x2826B928, (int32_t)0x865678EB, (int32_t)0x27C737D3,
+    (int32_t)0x86376092, (int32_t)0x27679DF4, (int32_t)0x86189359, (int32_t)0x2707EBC7,
+    (int32_t)0x85FA1153, (int32_t)0x26A82186, (int32_t)0x85DBDA91, (int32_t)0x26483F6C,
+    (int32_t)0x85BDEF28, (int32_t)0x25E845B6, (int32_t)0x85A04F28, (int32_t)0x2588349D,
+    (int32_t)0x8582FAA5, (int32_t)0x25280C5E, (int32_t)0x8565F1B0, (int32_t)0x24C7CD33,
+    (int32_t)0x8549345C, (int32_t)0x24677758, (int32_t)0x852CC2BB, (int32_t)0x24070B08,
+    (int32_t)0x85109CDD, (int32_t)0x23A6887F, (int32_t)0x84F4C2D4, (int32_t)0x2345EFF8,
+    (int32_t)0x84D934B1, (int32_t)0x22E541AF, (int32_t)0x84BDF286, (int32_t)0x22847DE0,
+    (int32_t)0x84A2FC62, (int32_t)0x2223A4C5, (int32_t)0x84885258, (int32_t)0x21C2B69C,
+    (int32_t)0x846DF477, (int32_t)0x2161B3A0, (int32_t)0x8453E2CF, (int32_t)0x21009C0C,
+    (int32_t)0x843A1D70, (int32_t)0x209F701C, (int32_t)0x8420A46C, (int32_t)0x203E300D,
+    (int32_t)0x840777D0, (int32_t)0x1FDCDC1B, (int32_t)0x83EE97AD, (int32_t)0x1F7B7481,
+    (int32_t)0x83D60412, (int32_t)0x1F19F97B, (int32_t)0x83BDBD0E, (int32_t)0x1EB86B46,
+    (int32_t)0x83A5C2B0, (int32_t)0x1E56CA1E, (int32_t)0x838E1507, (int32_t)0x1DF5163F,
+    (int32_t)0x8376B422, (int32_t)0x1D934FE5, (int32_t)0x835FA00F, (int32_t)0x1D31774D,
+    (int32_t)0x8348D8DC, (int32_t)0x1CCF8CB3, (int32_t)0x83325E97, (int32_t)0x1C6D9053,
+    (int32_t)0x831C314E, (int32_t)0x1C0B826A, (int32_t)0x83065110, (int32_t)0x1BA96335,
+    (int32_t)0x82F0BDE8, (int32_t)0x1B4732EF, (int32_t)0x82DB77E5, (int32_t)0x1AE4F1D6,
+    (int32_t)0x82C67F14, (int32_t)0x1A82A026, (int32_t)0x82B1D381, (int32_t)0x1A203E1B,
+    (int32_t)0x829D753A, (int32_t)0x19BDCBF3, (int32_t)0x8289644B, (int32_t)0x195B49EA,
+    (int32_t)0x8275A0C0, (int32_t)0x18F8B83C, (int32_t)0x82622AA6, (int32_t)0x18961728,
+    (int32_t)0x824F0208, (int32_t)0x183366E9, (int32_t)0x823C26F3, (int32_t)0x17D0A7BC,
+    (int32_t)0x82299971, (int32_t)0x176DD9DE, (int32_t)0x82175990, (int32_t)0x170AFD8D,
+    (int32_t)0x82056758, (int32_t)0x16A81305, (int32_t)0x81F3C2D7, (int32_t)0x16451A83,
+    (int32_t)0x81E26C16, (int32_t)0x15E21445, (int32_t)0x81D16321, (int32_t)0x157F0086,
+    (int32_t)0x81C0A801, (int32_t)0x151BDF86, (int32_t)0x81B03AC2, (int32_t)0x14B8B17F,
+    (int32_t)0x81A01B6D, (int32_t)0x145576B1, (int32_t)0x81904A0C, (int32_t)0x13F22F58,
+    (int32_t)0x8180C6A9, (int32_t)0x138EDBB1, (int32_t)0x8171914E, (int32_t)0x132B7BF9,
+    (int32_t)0x8162AA04, (int32_t)0x12C8106F, (int32_t)0x815410D4, (int32_t)0x1264994E,
+    (int32_t)0x8145C5C7, (int32_t)0x120116D5, (int32_t)0x8137C8E6, (int32_t)0x119D8941,
+    (int32_t)0x812A1A3A, (int32_t)0x1139F0CF, (int32_t)0x811CB9CA, (int32_t)0x10D64DBD,
+    (int32_t)0x810FA7A0, (int32_t)0x1072A048, (int32_t)0x8102E3C4, (int32_t)0x100EE8AD,
+    (int32_t)0x80F66E3C, (int32_t)0x0FAB272B, (int32_t)0x80EA4712, (int32_t)0x0F475BFF,
+    (int32_t)0x80DE6E4C, (int32_t)0x0EE38766, (int32_t)0x80D2E3F2, (int32_t)0x0E7FA99E,
+    (int32_t)0x80C7A80A, (int32_t)0x0E1BC2E4, (int32_t)0x80BCBA9D, (int32_t)0x0DB7D376,
+    (int32_t)0x80B21BAF, (int32_t)0x0D53DB92, (int32_t)0x80A7CB49, (int32_t)0x0CEFDB76,
+    (int32_t)0x809DC971, (int32_t)0x0C8BD35E, (int32_t)0x8094162C, (int32_t)0x0C27C389,
+    (int32_t)0x808AB180, (int32_t)0x0BC3AC35, (int32_t)0x80819B74, (int32_t)0x0B5F8D9F,
+    (int32_t)0x8078D40D, (int32_t)0x0AFB6805, (int32_t)0x80705B50, (int32_t)0x0A973BA5,
+    (int32_t)0x80683143, (int32_t)0x0A3308BD, (int32_t)0x806055EB, (int32_t)0x09CECF89,
+    (int32_t)0x8058C94C, (int32_t)0x096A9049, (int32_t)0x80518B6B, (int32_t)0x09064B3A,
+    (int32_t)0x804A9C4D, (int32_t)0x08A2009A, (int32_t)0x8043FBF6, (int32_t)0x083DB0A7,
+    (int32_t)0x803DAA6A, (int32_t)0x07D95B9E, (int32_t)0x8037A7AC, (int32_t)0x077501BE,
+    (int32_t)0x8031F3C2, (int32_t)0x0710A345, (int32_t)0x802C8EAD, (int32_t)0x06AC406F,
+    (int32_t)0x80277872, (int32_t)0x0647D97C, (int32_t)0x8022B114, (int32_t)0x05E36EA9,
+    (int32_t)0x801E3895, (int32_t)0x057F0035, (int32_t)0x801A0EF8, (int32_t)0x051A8E5C,
+    (int32_t)0x80163440, (int32_t)0x04B6195D, (int32_t)0x8012A86F, (int32_t)0x0451A177,
+    (int32_t)0x800F6B88, (int32_t)0x03ED26E6, (int32_t)0x800C7D8C, (int32_t)0x0388A9EA,
+    (int32_t)0x8009DE7E, (int32_t)0x03242ABF, (int32_t)0x80078E5E, (int32_t)0x02BFA9A4,
+    (int32_t)0x80058D2F, (int32_t)0x025B26D7, (int32_t)0x8003DAF1, (int32_t)0x01F6A297,
+    (int32_t)0x800277A6, (int32_t)0x01921D20, (int32_t)0x8001634E, (int32_t)0x012D96B1,
+    (int32_t)0x80009DEA, (int32_t)0x00C90F88, (int32_t)0x8000277A, (int32_t)0x006487E3,
+    (int32_t)0x80000000, (int32_t)0x00000000, (int32_t)0x8000277A, (int32_t)0xFF9B781D,
+    (int32_t)0x80009DEA, (int32_t)0xFF36F078, (int32_t)0x8001634E, (int32_t)0xFED2694F,
+    (int32_t)0x800277A6, (int32_t)0xFE6DE2E0, (int32_t)0x8003DAF1, (int32_t)0xFE095D69,
+    (int32_t)0x80058D2F, (int32_t)0xFDA4D929, (int32_t)0x80078E5E, (int32_t)0xFD40565C,
+    (int32_t)0x8009DE7E, (int32_t)0xFCDBD541, (int32_t)0x800C7D8C, (int32_t)0xFC775616,
+    (int32_t)0x800F6B88, (int32_t)0xFC12D91A, (int32_t)0x8012A86F, (int32_t)0xFBAE5E89,
+    (int32_t)0x80163440, (int32_t)0xFB49E6A3, (int32_t)0x801A0EF8, (int32_t)0xFAE571A4,
+    (int32_t)0x801E3895, (int32_t)0xFA80FFCB, (int32_t)0x8022B114, (int32_t)0xFA1C9157,
+    (int32_t)0x80277872, (int32_t)0xF9B82684, (int32_t)0x802C8EAD, (int32_t)0xF953BF91,
+    (int32_t)0x8031F3C2, (int32_t)0xF8EF5CBB, (int32_t)0x8037A7AC, (int32_t)0xF88AFE42,
+    (int32_t)0x803DAA6A, (int32_t)0xF826A462, (int32_t)0x8043FBF6, (int32_t)0xF7C24F59,
+    (int32_t)0x804A9C4D, (int32_t)0xF75DFF66, (int32_t)0x80518B6B, (int32_t)0xF6F9B4C6,
+    (int32_t)0x8058C94C, (int32_t)0xF6956FB7, (int32_t)0x806055EB, (int32_t)0xF6313077,
+    (int32_t)0x80683143, (int32_t)0xF5CCF743, (int32_t)0x80705B50, (int32_t)0xF568C45B,
+    (int32_t)0x8078D40D, (int32_t)0xF50497FB, (int32_t)0x80819B74, (int32_t)0xF4A07261,
+    (int32_t)0x808AB180, (int32_t)0xF43C53CB, (int32_t)0x8094162C, (int32_t)0xF3D83C77,
+    (int32_t)0x809DC971, (int32_t)0xF3742CA2, (int32_t)0x80A7CB49, (int32_t)0xF310248A,
+    (int32_t)0x80B21BAF, (int32_t)0xF2AC246E, (int32_t)0x80BCBA9D, (int32_t)0xF2482C8A,
+    (int32_t)0x80C7A80A, (int32_t)0xF1E43D1C, (int32_t)0x80D2E3F2, (int32_t)0xF1805662,
+    (int32_t)0x80DE6E4C, (int32_t)0xF11C789A, (int32_t)0x80EA4712, (int32_t)0xF0B8A401,
+    (int32_t)0x80F66E3C, (int32_t)0xF054D8D5, (int32_t)0x8102E3C4, (int32_t)0xEFF11753,
+    (int32_t)0x810FA7A0, (int32_t)0xEF8D5FB8, (int32_t)0x811CB9CA, (int32_t)0xEF29B243,
+    (int32_t)0x812A1A3A, (int32_t)0xEEC60F31, (int32_t)0x8137C8E6, (int32_t)0xEE6276BF,
+    (int32_t)0x8145C5C7, (int32_t)0xEDFEE92B, (int32_t)0x815410D4, (int32_t)0xED9B66B2,
+    (int32_t)0x8162AA04, (int32_t)0xED37EF91, (int32_t)0x8171914E, (int32_t)0xECD48407,
+    (int32_t)0x8180C6A9, (int32_t)0xEC71244F, (int32_t)0x81904A0C, (int32_t)0xEC0DD0A8,
+    (int32_t)0x81A01B6D, (int32_t)0xEBAA894F, (int32_t)0x81B03AC2, (int32_t)0xEB474E81,
+    (int32_t)0x81C0A801, (int32_t)0xEAE4207A, (int32_t)0x81D16321, (int32_t)0xEA80FF7A,
+    (int32_t)0x81E26C16, (int32_t)0xEA1DEBBB, (int32_t)0x81F3C2D7, (int32_t)0xE9BAE57D,
+    (int32_t)0x82056758, (int32_t)0xE957ECFB, (int32_t)0x82175990, (int32_t)0xE8F50273,
+    (int32_t)0x82299971, (int32_t)0xE8922622, (int32_t)0x823C26F3, (int32_t)0xE82F5844,
+    (int32_t)0x824F0208, (int32_t)0xE7CC9917, (int32_t)0x82622AA6, (int32_t)0xE769E8D8,
+    (int32_t)0x8275A0C0, (int32_t)0xE70747C4, (int32_t)0x8289644B, (int32_t)0xE6A4B616,
+    (int32_t)0x829D753A, (int32_t)0xE642340D, (int32_t)0x82B1D381, (int32_t)0xE5DFC1E5,
+    (int32_t)0x82C67F14, (int32_t)0xE57D5FDA, (int32_t)0x82DB77E5, (int32_t)0xE51B0E2A,
+    (int32_t)0x82F0BDE8, (int32_t)0xE4B8CD11, (int32_t)0x83065110, (int32_t)0xE4569CCB,
+    (int32_t)0x831C314E, (int32_t)0xE3F47D96, (int32_t)0x83325E97, (int32_t)0xE3926FAD,
+    (int32_t)0x8348D8DC, (int32_t)0xE330734D, (int32_t)0x835FA00F, (int32_t)0xE2CE88B3,
+    (int32_t)0x8376B422, (int32_t)0xE26CB01B, (int32_t)0x838E1507, (int32_t)0xE20AE9C1,
+    (int32_t)0x83A5C2B0, (int32_t)0xE1A935E2, (int32_t)0x83BDBD0E, (int32_t)0xE14794BA,
+    (int32_t)0x83D60412, (int32_t)0xE0E60685, (int32_t)0x83EE97AD, (int32_t)0xE0848B7F,
+    (int32_t)0x840777D0, (int32_t)0xE02323E5, (int32_t)0x8420A46C, (int32_t)0xDFC1CFF3,
+    (int32_t)0x843A1D70, (int32_t)0xDF608FE4, (int32_t)0x8453E2CF, (int32_t)0xDEFF63F4,
+    (int32_t)0x846DF477, (int32_t)0xDE9E4C60, (int32_t)0x84885258, (int32_t)0xDE3D4964,
+    (int32_t)0x84A2FC62, (int32_t)0xDDDC5B3B, (int32_t)0x84BDF286, (int32_t)0xDD7B8220,
+    (int32_t)0x84D934B1, (int32_t)0xDD1ABE51, (int32_t)0x84F4C2D4, (int32_t)0xDCBA1008,
+    (int32_t)0x85109CDD, (int32_t)0xDC597781, (int32_t)0x852CC2BB, (int32_t)0xDBF8F4F8,
+    (int32_t)0x8549345C, (int32_t)0xDB9888A8, (int32_t)0x8565F1B0, (int32_t)0xDB3832CD,
+    (int32_t)0x8582FAA5, (int32_t)0xDAD7F3A2, (int32_t)0x85A04F28, (int32_t)0xDA77CB63,
+    (int32_t)0x85BDEF28, (int32_t)0xDA17BA4A, (int32_t)0x85DBDA91, (int32_t)0xD9B7C094,
+    (int32_t)0x85FA1153, (int32_t)0xD957DE7A, (int32_t)0x86189359, (int32_t)0xD8F81439,
+    (int32_t)0x86376092, (int32_t)0xD898620C, (int32_t)0x865678EB, (int32_t)0xD838C82D,
+    (int32_t)0x8675DC4F, (int32_t)0xD7D946D8, (int32_t)0x86958AAC, (int32_t)0xD779DE47,
+    (int32_t)0x86B583EE, (int32_t)0xD71A8EB5, (int32_t)0x86D5C802, (int32_t)0xD6BB585E,
+    (int32_t)0x86F656D3, (int32_t)0xD65C3B7B, (int32_t)0x8717304E, (int32_t)0xD5FD3848,
+    (int32_t)0x8738545E, (int32_t)0xD59E4EFF, (int32_t)0x8759C2EF, (int32_t)0xD53F7FDA,
+    (int32_t)0x877B7BEC, (int32_t)0xD4E0CB15, (int32_t)0x879D7F41, (int32_t)0xD48230E9,
+    (int32_t)0x87BFCCD7, (int32_t)0xD423B191, (int32_t)0x87E2649B, (int32_t)0xD3C54D47,
+    (int32_t)0x88054677, (int32_t)0xD3670446, (int32_t)0x88287256, (int32_t)0xD308D6C7,
+    (int32_t)0x884BE821, (int32_t)0xD2AAC504, (int32_t)0x886FA7C2, (int32_t)0xD24CCF39,
+    (int32_t)0x8893B125, (int32_t)0xD1EEF59E, (int32_t)0x88B80432, (int32_t)0xD191386E,
+    (int32_t)0x88DCA0D3, (int32_t)0xD13397E2, (int32_t)0x890186F2, (int32_t)0xD0D61434,
+    (int32_t)0x8926B677, (int32_t)0xD078AD9E, (int32_t)0x894C2F4C, (int32_t)0xD01B6459,
+    (int32_t)0x8971F15A, (int32_t)0xCFBE389F, (int32_t)0x8997FC8A, (int32_t)0xCF612AAA,
+    (int32_t)0x89BE50C3, (int32_t)0xCF043AB3, (int32_t)0x89E4EDEF, (int32_t)0xCEA768F2,
+    (int32_t)0x8A0BD3F5, (int32_t)0xCE4AB5A2, (int32_t)0x8A3302BE, (int32_t)0xCDEE20FC,
+    (int32_t)0x8A5A7A31, (int32_t)0xCD91AB39, (int32_t)0x8A823A36, (int32_t)0xCD355491,
+    (int32_t)0x8AAA42B4, (int32_t)0xCCD91D3D, (int32_t)0x8AD29394, (int32_t)0xCC7D0578,
+    (int32_t)0x8AFB2CBB, (int32_t)0xCC210D79, (int32_t)0x8B240E11, (int32_t)0xCBC53579,
+    (int32_t)0x8B4D377C, (int32_t)0xCB697DB0, (int32_t)0x8B76A8E4, (int32_t)0xCB0DE658,
+    (int32_t)0x8BA0622F, (int32_t)0xCAB26FA9, (int32_t)0x8BCA6343, (int32_t)0xCA5719DB,
+    (int32_t)0x8BF4AC05, (int32_t)0xC9FBE527, (int32_t)0x8C1F3C5D, (int32_t)0xC9A0D1C5,
+    (int32_t)0x8C4A142F, (int32_t)0xC945DFEC, (int32_t)0x8C753362, (int32_t)0xC8EB0FD6,
+    (int32_t)0x8CA099DA, (int32_t)0xC89061BA, (int32_t)0x8CCC477D, (int32_t)0xC835D5D0,
+    (int32_t)0x8CF83C30, (int32_t)0xC7DB6C50, (int32_t)0x8D2477D8, (int32_t)0xC7812572,
+    (int32_t)0x8D50FA59, (int32_t)0xC727016D, (int32_t)0x8D7DC399, (int32_t)0xC6CD0079,
+    (int32_t)0x8DAAD37B, (int32_t)0xC67322CE, (int32_t)0x8DD829E4, (int32_t)0xC61968A2,
+    (int32_t)0x8E05C6B7, (int32_t)0xC5BFD22E, (int32_t)0x8E33A9DA, (int32_t)0xC5665FA9,
+    (int32_t)0x8E61D32E, (int32_t)0xC50D1149, (int32_t)0x8E904298, (int32_t)0xC4B3E746,
+    (int32_t)0x8EBEF7FB, (int32_t)0xC45AE1D7, (int32_t)0x8EEDF33B, (int32_t)0xC4020133,
+    (int32_t)0x8F1D343A, (int32_t)0xC3A94590, (int32_t)0x8F4CBADB, (int32_t)0xC350AF26,
+    (int32_t)0x8F7C8701, (int32_t)0xC2F83E2A, (int32_t)0x8FAC988F, (int32_t)0xC29FF2D4,
+    (int32_t)0x8FDCEF66, (int32_t)0xC247CD5A, (int32_t)0x900D8B69, (int32_t)0xC1EFCDF3,
+    (int32_t)0x903E6C7B, (int32_t)0xC197F4D4, (int32_t)0x906F927C, (int32_t)0xC1404233,
+    (int32_t)0x90A0FD4E, (int32_t)0xC0E8B648, (int32_t)0x90D2ACD4, (int32_t)0xC0915148,
+    (int32_t)0x9104A0EE, (int32_t)0xC03A1368, (int32_t)0x9136D97D, (int32_t)0xBFE2FCDF,
+    (int32_t)0x91695663, (int32_t)0xBF8C0DE3, (int32_t)0x919C1781, (int32_t)0xBF3546A8,
+    (int32_t)0x91CF1CB6, (int32_t)0xBEDEA765, (int32_t)0x920265E4, (int32_t)0xBE88304F,
+    (int32_t)0x9235F2EC, (int32_t)0xBE31E19B, (int32_t)0x9269C3AC, (int32_t)0xBDDBBB7F,
+    (int32_t)0x929DD806, (int32_t)0xBD85BE30, (int32_t)0x92D22FD9, (int32_t)0xBD2FE9E2,
+    (int32_t)0x9306CB04, (int32_t)0xBCDA3ECB, (int32_t)0x933BA968, (int32_t)0xBC84BD1F,
+    (int32_t)0x9370CAE4, (int32_t)0xBC2F6513, (int32_t)0x93A62F57, (int32_t)0xBBDA36DD,
+    (int32_t)0x93DBD6A0, (int32_t)0xBB8532B0, (int32_t)0x9411C09E, (int32_t)0xBB3058C0,
+    (int32_t)0x9447ED2F, (int32_t)0xBADBA943, (int32_t)0x947E5C33, (int32_t)0xBA87246D,
+    (int32_t)0x94B50D87, (int32_t)0xBA32CA71, (int32_t)0x94EC010B, (int32_t)0xB9DE9B83,
+    (int32_t)0x9523369C, (int32_t)0xB98A97D8, (int32_t)0x955AAE17, (int32_t)0xB936BFA4,
+    (int32_t)0x9592675C, (int32_t)0xB8E31319, (int32_t)0x95CA6247, (int32_t)0xB88F926D,
+    (int32_t)0x96029EB6, (int32_t)0xB83C3DD1, (int32_t)0x963B1C86, (int32_t)0xB7E9157A,
+    (int32_t)0x9673DB94, (int32_t)0xB796199B, (int32_t)0x96ACDBBE, (int32_t)0xB7434A67,
+    (int32_t)0x96E61CE0, (int32_t)0xB6F0A812, (int32_t)0x971F9ED7, (int32_t)0xB69E32CD,
+    (int32_t)0x9759617F, (int32_t)0xB64BEACD, (int32_t)0x979364B5, (int32_t)0xB5F9D043,
+    (int32_t)0x97CDA855, (int32_t)0xB5A7E362, (int32_t)0x98082C3B, (int32_t)0xB556245E,
+    (int32_t)0x9842F043, (int32_t)0xB5049368, (int32_t)0x987DF449, (int32_t)0xB4B330B3,
+    (int32_t)0x98B93828, (int32_t)0xB461FC70, (int32_t)0x98F4BBBC, (int32_t)0xB410F6D3,
+    (int32_t)0x99307EE0, (int32_t)0xB3C0200C, (int32_t)0x996C816F, (int32_t)0xB36F784F,
+    (int32_t)0x99A8C345, (int32_t)0xB31EFFCC, (int32_t)0x99E5443B, (int32_t)0xB2CEB6B5,
+    (int32_t)0x9A22042D, (int32_t)0xB27E9D3C, (int32_t)0x9A5F02F5, (int32_t)0xB22EB392,
+    (int32_t)0x9A9C406E, (int32_t)0xB1DEF9E9, (int32_t)0x9AD9BC71, (int32_t)0xB18F7071,
+    (int32_t)0x9B1776DA, (int32_t)0xB140175B, (int32_t)0x9B556F81, (int32_t)0xB0F0EEDA,
+    (int32_t)0x9B93A641, (int32_t)0xB0A1F71D, (int32_t)0x9BD21AF3, (int32_t)0xB0533055,
+    (int32_t)0x9C10CD70, (int32_t)0xB0049AB3, (int32_t)0x9C4FBD93, (int32_t)0xAFB63667,
+    (int32_t)0x9C8EEB34, (int32_t)0xAF6803A2, (int32_t)0x9CCE562C, (int32_t)0xAF1A0293,
+    (int32_t)0x9D0DFE54, (int32_t)0xAECC336C, (int32_t)0x9D4DE385, (int32_t)0xAE7E965B,
+    (int32_t)0x9D8E0597, (int32_t)0xAE312B92, (int32_t)0x9DCE6463, (int32_t)0xADE3F33E,
+    (int32_t)0x9E0EFFC1, (int32_t)0xAD96ED92, (int32_t)0x9E4FD78A, (int32_t)0xAD4A1ABA,
+    (int32_t)0x9E90EB94, (int32_t)0xACFD7AE8, (int32_t)0x9ED23BB9, (int32_t)0xACB10E4B,
+    (int32_t)0x9F13C7D0, (int32_t)0xAC64D510, (int32_t)0x9F558FB0, (int32_t)0xAC18CF69,
+    (int32_t)0x9F979331, (int32_t)0xABCCFD83, (int32_t)0x9FD9D22A, (int32_t)0xAB815F8D,
+    (int32_t)0xA01C4C73, (int32_t)0xAB35F5B5, (int32_t)0xA05F01E1, (int32_t)0xAAEAC02C,
+    (int32_t)0xA0A1F24D, (int32_t)0xAA9FBF1E, (int32_t)0xA0E51D8C, (int32_t)0xAA54F2BA,
+    (int32_t)0xA1288376, (int32_t)0xAA0A5B2E, (int32_t)0xA16C23E1, (int32_t)0xA9BFF8A8,
+    (int32_t)0xA1AFFEA3, (int32_t)0xA975CB57, (int32_t)0xA1F41392, (int32_t)0xA92BD367,
+    (int32_t)0xA2386284, (int32_t)0xA8E21106, (int32_t)0xA27CEB4F, (int32_t)0xA8988463,
+    (int32_t)0xA2C1ADC9, (int32_t)0xA84F2DAA, (int32_t)0xA306A9C8, (int32_t)0xA8060D08,
+    (int32_t)0xA34BDF20, (int32_t)0xA7BD22AC, (int32_t)0xA3914DA8, (int32_t)0xA7746EC0,
+    (int32_t)0xA3D6F534, (int32_t)0xA72BF174, (int32_t)0xA41CD599, (int32_t)0xA6E3AAF2,
+    (int32_t)0xA462EEAC, (int32_t)0xA69B9B68, (int32_t)0xA4A94043, (int32_t)0xA653C303,
+    (int32_t)0xA4EFCA31, (int32_t)0xA60C21EE, (int32_t)0xA5368C4B, (int32_t)0xA5C4B855,
+    (int32_t)0xA57D8666, (int32_t)0xA57D8666, (int32_t)0xA5C4B855, (int32_t)0xA5368C4B,
+    (int32_t)0xA60C21EE, (int32_t)0xA4EFCA31, (int32_t)0xA653C303, (int32_t)0xA4A94043,
+    (int32_t)0xA69B9B68, (int32_t)0xA462EEAC, (int32_t)0xA6E3AAF2, (int32_t)0xA41CD599,
+    (int32_t)0xA72BF174, (int32_t)0xA3D6F534, (int32_t)0xA7746EC0, (int32_t)0xA3914DA8,
+    (int32_t)0xA7BD22AC, (int32_t)0xA34BDF20, (int32_t)0xA8060D08, (int32_t)0xA306A9C8,
+    (int32_t)0xA84F2DAA, (int32_t)0xA2C1ADC9, (int32_t)0xA8988463, (int32_t)0xA27CEB4F,
+    (int32_t)0xA8E21106, (int32_t)0xA2386284, (int32_t)0xA92BD367, (int32_t)0xA1F41392,
+    (int32_t)0xA975CB57, (int32_t)0xA1AFFEA3, (int32_t)0xA9BFF8A8, (int32_t)0xA16C23E1,
+    (int32_t)0xAA0A5B2E, (int32_t)0xA1288376, (int32_t)0xAA54F2BA, (int32_t)0xA0E51D8C,
+    (int32_t)0xAA9FBF1E, (int32_t)0xA0A1F24D, (int32_t)0xAAEAC02C, (int32_t)0xA05F01E1,
+    (int32_t)0xAB35F5B5, (int32_t)0xA01C4C73, (int32_t)0xAB815F8D, (int32_t)0x9FD9D22A,
+    (int32_t)0xABCCFD83, (int32_t)0x9F979331, (int32_t)0xAC18CF69, (int32_t)0x9F558FB0,
+    (int32_t)0xAC64D510, (int32_t)0x9F13C7D0, (int32_t)0xACB10E4B, (int32_t)0x9ED23BB9,
+    (int32_t)0xACFD7AE8, (int32_t)0x9E90EB94, (int32_t)0xAD4A1ABA, (int32_t)0x9E4FD78A,
+    (int32_t)0xAD96ED92, (int32_t)0x9E0EFFC1, (int32_t)0xADE3F33E, (int32_t)0x9DCE6463,
+    (int32_t)0xAE312B92, (int32_t)0x9D8E0597, (int32_t)0xAE7E965B, (int32_t)0x9D4DE385,
+    (int32_t)0xAECC336C, (int32_t)0x9D0DFE54, (int32_t)0xAF1A0293, (int32_t)0x9CCE562C,
+    (int32_t)0xAF6803A2, (int32_t)0x9C8EEB34, (int32_t)0xAFB63667, (int32_t)0x9C4FBD93,
+    (int32_t)0xB0049AB3, (int32_t)0x9C10CD70, (int32_t)0xB0533055, (int32_t)0x9BD21AF3,
+    (int32_t)0xB0A1F71D, (int32_t)0x9B93A641, (int32_t)0xB0F0EEDA, (int32_t)0x9B556F81,
+    (int32_t)0xB140175B, (int32_t)0x9B1776DA, (int32_t)0xB18F7071, (int32_t)0x9AD9BC71,
+    (int32_t)0xB1DEF9E9, (int32_t)0x9A9C406E, (int32_t)0xB22EB392, (int32_t)0x9A5F02F5,
+    (int32_t)0xB27E9D3C, (int32_t)0x9A22042D, (int32_t)0xB2CEB6B5, (int32_t)0x99E5443B,
+    (int32_t)0xB31EFFCC, (int32_t)0x99A8C345, (int32_t)0xB36F784F, (int32_t)0x996C816F,
+    (int32_t)0xB3C0200C, (int32_t)0x99307EE0, (int32_t)0xB410F6D3, (int32_t)0x98F4BBBC,
+    (int32_t)0xB461FC70, (int32_t)0x98B93828, (int32_t)0xB4B330B3, (int32_t)0x987DF449,
+    (int32_t)0xB5049368, (int32_t)0x9842F043, (int32_t)0xB556245E, (int32_t)0x98082C3B,
+    (int32_t)0xB5A7E362, (int32_t)0x97CDA855, (int32_t)0xB5F9D043, (int32_t)0x979364B5,
+    (int32_t)0xB64BEACD, (int32_t)0x9759617F, (int32_t)0xB69E32CD, (int32_t)0x971F9ED7,
+    (int32_t)0xB6F0A812, (int32_t)0x96E61CE0, (int32_t)0xB7434A67, (int32_t)0x96ACDBBE,
+    (int32_t)0xB796199B, (int32_t)0x9673DB94, (int32_t)0xB7E9157A, (int32_t)0x963B1C86,
+    (int32_t)0xB83C3DD1, (int32_t)0x96029EB6, (int32_t)0xB88F926D, (int32_t)0x95CA6247,
+    (int32_t)0xB8E31319, (int32_t)0x9592675C, (int32_t)0xB936BFA4, (int32_t)0x955AAE17,
+    (int32_t)0xB98A97D8, (int32_t)0x9523369C, (int32_t)0xB9DE9B83, (int32_t)0x94EC010B,
+    (int32_t)0xBA32CA71, (int32_t)0x94B50D87, (int32_t)0xBA87246D, (int32_t)0x947E5C33,
+    (int32_t)0xBADBA943, (int32_t)0x9447ED2F, (int32_t)0xBB3058C0, (int32_t)0x9411C09E,
+    (int32_t)0xBB8532B0, (int32_t)0x93DBD6A0, (int32_t)0xBBDA36DD, (int32_t)0x93A62F57,
+    (int32_t)0xBC2F6513, (int32_t)0x9370CAE4, (int32_t)0xBC84BD1F, (int32_t)0x933BA968,
+    (int32_t)0xBCDA3ECB, (int32_t)0x9306CB04, (int32_t)0xBD2FE9E2, (int32_t)0x92D22FD9,
+    (int32_t)0xBD85BE30, (int32_t)0x929DD806, (int32_t)0xBDDBBB7F, (int32_t)0x9269C3AC,
+    (int32_t)0xBE31E19B, (int32_t)0x9235F2EC, (int32_t)0xBE88304F, (int32_t)0x920265E4,
+    (int32_t)0xBEDEA765, (int32_t)0x91CF1CB6, (int32_t)0xBF3546A8, (int32_t)0x919C1781,
+    (int32_t)0xBF8C0DE3, (int32_t)0x91695663, (int32_t)0xBFE2FCDF, (int32_t)0x9136D97D,
+    (int32_t)0xC03A1368, (int32_t)0x9104A0EE, (int32_t)0xC0915148, (int32_t)0x90D2ACD4,
+    (int32_t)0xC0E8B648, (int32_t)0x90A0FD4E, (int32_t)0xC1404233, (int32_t)0x906F927C,
+    (int32_t)0xC197F4D4, (int32_t)0x903E6C7B, (int32_t)0xC1EFCDF3, (int32_t)0x900D8B69,
+    (int32_t)0xC247CD5A, (int32_t)0x8FDCEF66, (int32_t)0xC29FF2D4, (int32_t)0x8FAC988F,
+    (int32_t)0xC2F83E2A, (int32_t)0x8F7C8701, (int32_t)0xC350AF26, (int32_t)0x8F4CBADB,
+    (int32_t)0xC3A94590, (int32_t)0x8F1D343A, (int32_t)0xC4020133, (int32_t)0x8EEDF33B,
+    (int32_t)0xC45AE1D7, (int32_t)0x8EBEF7FB, (int32_t)0xC4B3E746, (int32_t)0x8E904298,
+    (int32_t)0xC50D1149, (int32_t)0x8E61D32E, (int32_t)0xC5665FA9, (int32_t)0x8E33A9DA,
+    (int32_t)0xC5BFD22E, (int32_t)0x8E05C6B7, (int32_t)0xC61968A2, (int32_t)0x8DD829E4,
+    (int32_t)0xC67322CE, (int32_t)0x8DAAD37B, (int32_t)0xC6CD0079, (int32_t)0x8D7DC399,
+    (int32_t)0xC727016D, (int32_t)0x8D50FA59, (int32_t)0xC7812572, (int32_t)0x8D2477D8,
+    (int32_t)0xC7DB6C50, (int32_t)0x8CF83C30, (int32_t)0xC835D5D0, (int32_t)0x8CCC477D,
+    (int32_t)0xC89061BA, (int32_t)0x8CA099DA, (int32_t)0xC8EB0FD6, (int32_t)0x8C753362,
+    (int32_t)0xC945DFEC, (int32_t)0x8C4A142F, (int32_t)0xC9A0D1C5, (int32_t)0x8C1F3C5D,
+    (int32_t)0xC9FBE527, (int32_t)0x8BF4AC05, (int32_t)0xCA5719DB, (int32_t)0x8BCA6343,
+    (int32_t)0xCAB26FA9, (int32_t)0x8BA0622F, (int32_t)0xCB0DE658, (int32_t)0x8B76A8E4,
+    (int32_t)0xCB697DB0, (int32_t)0x8B4D377C, (int32_t)0xCBC53579, (int32_t)0x8B240E11,
+    (int32_t)0xCC210D79, (int32_t)0x8AFB2CBB, (int32_t)0xCC7D0578, (int32_t)0x8AD29394,
+    (int32_t)0xCCD91D3D, (int32_t)0x8AAA42B4, (int32_t)0xCD355491, (int32_t)0x8A823A36,
+    (int32_t)0xCD91AB39, (int32_t)0x8A5A7A31, (int32_t)0xCDEE20FC, (int32_t)0x8A3302BE,
+    (int32_t)0xCE4AB5A2, (int32_t)0x8A0BD3F5, (int32_t)0xCEA768F2, (int32_t)0x89E4EDEF,
+    (int32_t)0xCF043AB3, (int32_t)0x89BE50C3, (int32_t)0xCF612AAA, (int32_t)0x8997FC8A,
+    (int32_t)0xCFBE389F, (int32_t)0x8971F15A, (int32_t)0xD01B6459, (int32_t)0x894C2F4C,
+    (int32_t)0xD078AD9E, (int32_t)0x8926B677, (int32_t)0xD0D61434, (int32_t)0x890186F2,
+    (int32_t)0xD13397E2, (int32_t)0x88DCA0D3, (int32_t)0xD191386E, (int32_t)0x88B80432,
+    (int32_t)0xD1EEF59E, (int32_t)0x8893B125, (int32_t)0xD24CCF39, (int32_t)0x886FA7C2,
+    (int32_t)0xD2AAC504, (int32_t)0x884BE821, (int32_t)0xD308D6C7, (int32_t)0x88287256,
+    (int32_t)0xD3670446, (int32_t)0x88054677, (int32_t)0xD3C54D47, (int32_t)0x87E2649B,
+    (int32_t)0xD423B191, (int32_t)0x87BFCCD7, (int32_t)0xD48230E9, (int32_t)0x879D7F41,
+    (int32_t)0xD4E0CB15, (int32_t)0x877B7BEC, (int32_t)0xD53F7FDA, (int32_t)0x8759C2EF,
+    (int32_t)0xD59E4EFF, (int32_t)0x8738545E, (int32_t)0xD5FD3848, (int32_t)0x8717304E,
+    (int32_t)0xD65C3B7B, (int32_t)0x86F656D3, (int32_t)0xD6BB585E, (int32_t)0x86D5C802,
+    (int32_t)0xD71A8EB5, (int32_t)0x86B583EE, (int32_t)0xD779DE47, (int32_t)0x86958AAC,
+    (int32_t)0xD7D946D8, (int32_t)0x8675DC4F, (int32_t)0xD838C82D, (int32_t)0x865678EB,
+    (int32_t)0xD898620C, (int32_t)0x86376092, (int32_t)0xD8F81439, (int32_t)0x86189359,
+    (int32_t)0xD957DE7A, (int32_t)0x85FA1153, (int32_t)0xD9B7C094, (int32_t)0x85DBDA91,
+    (int32_t)0xDA17BA4A, (int32_t)0x85BDEF28, (int32_t)0xDA77CB63, (int32_t)0x85A04F28,
+    (int32_t)0xDAD7F3A2, (int32_t)0x8582FAA5, (int32_t)0xDB3832CD, (int32_t)0x8565F1B0,
+    (int32_t)0xDB9888A8, (int32_t)0x8549345C, (int32_t)0xDBF8F4F8, (int32_t)0x852CC2BB,
+    (int32_t)0xDC597781, (int32_t)0x85109CDD, (int32_t)0xDCBA1008, (int32_t)0x84F4C2D4,
+    (int32_t)0xDD1ABE51, (int32_t)0x84D934B1, (int32_t)0xDD7B8220, (int32_t)0x84BDF286,
+    (int32_t)0xDDDC5B3B, (int32_t)0x84A2FC62, (int32_t)0xDE3D4964, (int32_t)0x84885258,
+    (int32_t)0xDE9E4C60, (int32_t)0x846DF477, (int32_t)0xDEFF63F4, (int32_t)0x8453E2CF,
+    (int32_t)0xDF608FE4, (int32_t)0x843A1D70, (int32_t)0xDFC1CFF3, (int32_t)0x8420A46C,
+    (int32_t)0xE02323E5, (int32_t)0x840777D0, (int32_t)0xE0848B7F, (int32_t)0x83EE97AD,
+    (int32_t)0xE0E60685, (int32_t)0x83D60412, (int32_t)0xE14794BA, (int32_t)0x83BDBD0E,
+    (int32_t)0xE1A935E2, (int32_t)0x83A5C2B0, (int32_t)0xE20AE9C1, (int32_t)0x838E1507,
+    (int32_t)0xE26CB01B, (int32_t)0x8376B422, (int32_t)0xE2CE88B3, (int32_t)0x835FA00F,
+    (int32_t)0xE330734D, (int32_t)0x8348D8DC, (int32_t)0xE3926FAD, (int32_t)0x83325E97,
+    (int32_t)0xE3F47D96, (int32_t)0x831C314E, (int32_t)0xE4569CCB, (int32_t)0x83065110,
+    (int32_t)0xE4B8CD11, (int32_t)0x82F0BDE8, (int32_t)0xE51B0E2A, (int32_t)0x82DB77E5,
+    (int32_t)0xE57D5FDA, (int32_t)0x82C67F14, (int32_t)0xE5DFC1E5, (int32_t)0x82B1D381,
+    (int32_t)0xE642340D, (int32_t)0x829D753A, (int32_t)0xE6A4B616, (int32_t)0x8289644B,
+    (int32_t)0xE70747C4, (int32_t)0x8275A0C0, (int32_t)0xE769E8D8, (int32_t)0x82622AA6,
+    (int32_t)0xE7CC9917, (int32_t)0x824F0208, (int32_t)0xE82F5844, (int32_t)0x823C26F3,
+    (int32_t)0xE8922622, (int32_t)0x82299971, (int32_t)0xE8F50273, (int32_t)0x82175990,
+    (int32_t)0xE957ECFB, (int32_t)0x82056758, (int32_t)0xE9BAE57D, (int32_t)0x81F3C2D7,
+    (int32_t)0xEA1DEBBB, (int32_t)0x81E26C16, (int32_t)0xEA80FF7A, (int32_t)0x81D16321,
+    (int32_t)0xEAE4207A, (int32_t)0x81C0A801, (int32_t)0xEB474E81, (int32_t)0x81B03AC2,
+    (int32_t)0xEBAA894F, (int32_t)0x81A01B6D, (int32_t)0xEC0DD0A8, (int32_t)0x81904A0C,
+    (int32_t)0xEC71244F, (int32_t)0x8180C6A9, (int32_t)0xECD48407, (int32_t)0x8171914E,
+    (int32_t)0xED37EF91, (int32_t)0x8162AA04, (int32_t)0xED9B66B2, (int32_t)0x815410D4,
+    (int32_t)0xEDFEE92B, (int32_t)0x8145C5C7, (int32_t)0xEE6276BF, (int32_t)0x8137C8E6,
+    (int32_t)0xEEC60F31, (int32_t)0x812A1A3A, (int32_t)0xEF29B243, (int32_t)0x811CB9CA,
+    (int32_t)0xEF8D5FB8, (int32_t)0x810FA7A0, (int32_t)0xEFF11753, (int32_t)0x8102E3C4,
+    (int32_t)0xF054D8D5, (int32_t)0x80F66E3C, (int32_t)0xF0B8A401, (int32_t)0x80EA4712,
+    (int32_t)0xF11C789A, (int32_t)0x80DE6E4C, (int32_t)0xF1805662, (int32_t)0x80D2E3F2,
+    (int32_t)0xF1E43D1C, (int32_t)0x80C7A80A, (int32_t)0xF2482C8A, (int32_t)0x80BCBA9D,
+    (int32_t)0xF2AC246E, (int32_t)0x80B21BAF, (int32_t)0xF310248A, (int32_t)0x80A7CB49,
+    (int32_t)0xF3742CA2, (int32_t)0x809DC971, (int32_t)0xF3D83C77, (int32_t)0x8094162C,
+    (int32_t)0xF43C53CB, (int32_t)0x808AB180, (int32_t)0xF4A07261, (int32_t)0x80819B74,
+    (int32_t)0xF50497FB, (int32_t)0x8078D40D, (int32_t)0xF568C45B, (int32_t)0x80705B50,
+    (int32_t)0xF5CCF743, (int32_t)0x80683143, (int32_t)0xF6313077, (int32_t)0x806055EB,
+    (int32_t)0xF6956FB7, (int32_t)0x8058C94C, (int32_t)0xF6F9B4C6, (int32_t)0x80518B6B,
+    (int32_t)0xF75DFF66, (int32_t)0x804A9C4D, (int32_t)0xF7C24F59, (int32_t)0x8043FBF6,
+    (int32_t)0xF826A462, (int32_t)0x803DAA6A, (int32_t)0xF88AFE42, (int32_t)0x8037A7AC,
+    (int32_t)0xF8EF5CBB, (int32_t)0x8031F3C2, (int32_t)0xF953BF91, (int32_t)0x802C8EAD,
+    (int32_t)0xF9B82684, (int32_t)0x80277872, (int32_t)0xFA1C9157, (int32_t)0x8022B114,
+    (int32_t)0xFA80FFCB, (int32_t)0x801E3895, (int32_t)0xFAE571A4, (int32_t)0x801A0EF8,
+    (int32_t)0xFB49E6A3, (int32_t)0x80163440, (int32_t)0xFBAE5E89, (int32_t)0x8012A86F,
+    (int32_t)0xFC12D91A, (int32_t)0x800F6B88, (int32_t)0xFC775616, (int32_t)0x800C7D8C,
+    (int32_t)0xFCDBD541, (int32_t)0x8009DE7E, (int32_t)0xFD40565C, (int32_t)0x80078E5E,
+    (int32_t)0xFDA4D929, (int32_t)0x80058D2F, (int32_t)0xFE095D69, (int32_t)0x8003DAF1,
+    (int32_t)0xFE6DE2E0, (int32_t)0x800277A6, (int32_t)0xFED2694F, (int32_t)0x8001634E,
+    (int32_t)0xFF36F078, (int32_t)0x80009DEA, (int32_t)0xFF9B781D, (int32_t)0x8000277A
+};
+
+/**
+  @par
+  Example code for q31 Twiddle factors Generation::
+  @par
+  <pre>for (i = 0; i< 3N/4; i++)
+  {
+     twiddleCoefq31[2*i]   = cos(i * 2*PI/(float)N);
+     twiddleCoefq31[2*i+1] = sin(i * 2*PI/(float)N);
+  } </pre>
+  @par
+  where N = 4096, PI = 3.14159265358979
+  @par
+  Cos and Sin values are interleaved fashion
+  @par
+  Convert Floating point to q31(Fixed point 1.31):
+        round(twiddleCoefq31(i) * pow(2, 31))
+ */
+const int32_t twiddleCoef_4096_q32[6144] = {
+    (int32_t)0x7FFFFFFF, (int32_t)0x00000000, (int32_t)0x7FFFF621, (int32_t)0x003243F5,
+    (int32_t)0x7FFFD886, (int32_t)0x006487E3, (int32_t)0x7FFFA72C, (int32_t)0x0096CBC1,
+    (int32_t)0x7FFF6216, (int32_t)0x00C90F88, (int32_t)0x7FFF0943, (int32_t)0x00FB5330,
+    (int32_t)0x7FFE9CB2, (int32_t)0x012D96B1, (int32_t)0x7FFE1C65, (int32_t)0x015FDA03,
+    (int32_t)0x7FFD885A, (int32_t)0x01921D20, (int32_t)0x7FFCE093, (int32_t)0x01C45FFE,
+    (int32_t)0x7FFC250F, (int32_t)0x01F6A297, (int32_t)0x7FFB55CE, (int32_t)0x0228E4E2,
+    (int32_t)0x7FFA72D1, (int32_t)0x025B26D7, (int32_t)0x7FF97C18, (int32_t)0x028D6870,
+    (int32_t)0x7FF871A2, (int32_t)0x02BFA9A4, (int32_t)0x7FF75370, (int32_t)0x02F1EA6C,
+    (int32_t)0x7FF62182, (int32_t)0x03242ABF, (int32_t)0x7FF4DBD9, (int32_t)0x03566A96,
+    (int32_t)0x7FF38274, (int32_t)0x0388A9EA, (int32_t)0x7FF21553, (int32_t)0x03BAE8B2,
+    (int32_t)0x7FF09478, (int32_t)0x03ED26E6, (int32_t)0x7FEEFFE1, (int32_t)0x041F6480,
+    (int32_t)0x7FED5791, (int32_t)0x0451A177, (int32_t)0x7FEB9B85, (int32_t)0x0483DDC3,
+    (int32_t)0x7FE9CBC0, (int32_t)0x04B6195D, (int32_t)0x7FE7E841, (int32_t)0x04E8543E,
+    (int32_t)0x7FE5F108, (int32_t)0x051A8E5C, (int32_t)0x7FE3E616, (int32_t)0x054CC7B1,
+    (int32_t)0x7FE1C76B, (int32_t)0x057F0035, (int32_t)0x7FDF9508, (int32_t)0x05B137DF,
+    (int32_t)0x7FDD4EEC, (int32_t)0x05E36EA9, (int32_t)0x7FDAF519, (int32_t)0x0615A48B,
+    (int32_t)0x7FD8878E, (int32_t)0x0647D97C, (int32_t)0x7FD6064C, (int32_t)0x067A0D76,
+    (int32_t)0x7FD37153, (int32_t)0x06AC406F, (int32_t)0x7FD0C8A3, (int32_t)0x06DE7262,
+    (int32_t)0x7FCE0C3E, (int32_t)0x0710A345, (int32_t)0x7FCB3C23, (int32_t)0x0742D311,
+    (int32_t)0x7FC85854, (int32_t)0x077501BE, (int32_t)0x7FC560CF, (int32_t)0x07A72F45,
+    (int32_t)0x7FC25596, (int32_t)0x07D95B9E, (int32_t)0x7FBF36AA, (int32_t)0x080B86C2,
+    (int32_t)0x7FBC040A, (int32_t)0x083DB0A7, (int32_t)0x7FB8BDB8, (int32_t)0x086FD947,
+    (int32_t)0x7FB563B3, (int32_t)0x08A2009A, (int32_t)0x7FB1F5FC, (int32_t)0x08D42699,
+    (int32_t)0x7FAE7495, (int32_t)0x09064B3A, (int32_t)0x7FAADF7C, (int32_t)0x09386E78,
+    (int32_t)0x7FA736B4, (int32_t)0x096A9049, (int32_t)0x7FA37A3C, (int32_t)0x099CB0A7,
+    (int32_t)0x7F9FAA15, (int32_t)0x09CECF89, (int32_t)0x7F9BC640, (int32_t)0x0A00ECE8,
+    (int32_t)0x7F97CEBD, (int32_t)0x0A3308BD, (int32_t)0x7F93C38C, (int32_t)0x0A6522FE,
+    (int32_t)0x7F8FA4B0, (int32_t)0x0A973BA5, (int32_t)0x7F8B7227, (int32_t)0x0AC952AA,
+    (int32_t)0x7F872BF3, (int32_t)0x0AFB6805, (int32_t)0x7F82D214, (int32_t)0x0B2D7BAF,
+    (int32_t)0x7F7E648C, (int32_t)0x0B5F8D9F, (int32_t)0x7F79E35A, (int32_t)0x0B919DCF,
+    (int32_t)0x7F754E80, (int32_t)0x0BC3AC35, (int32_t)0x7F70A5FE, (int32_t)0x0BF5B8CB,
+    (int32_t)0x7F6BE9D4, (int32_t)0x0C27C389, (int32_t)0x7F671A05, (int32_t)0x0C59CC68,
+    (int32_t)0x7F62368F, (int32_t)0x0C8BD35E, (int32_t)0x7F5D3F75, (int32_t)0x0CBDD865,
+    (int32_t)0x7F5834B7, (int32_t)0x0CEFDB76, (int32_t)0x7F531655, (int32_t)0x0D21DC87,
+    (int32_t)0x7F4DE451, (int32_t)0x0D53DB92, (int32_t)0x7F489EAA, (int32_t)0x0D85D88F,
+    (int32_t)0x7F434563, (int32_t)0x0DB7D376, (int32_t)0x7F3DD87C, (int32_t)0x0DE9CC40,
+    (int32_t)0x7F3857F6, (int32_t)0x0E1BC2E4, (int32_t)0x7F32C3D1, (int32_t)0x0E4DB75B,
+    (int32_t)0x7F2D1C0E, (int32_t)0x0E7FA99E, (int32_t)0x7F2760AF, (int32_t)0x0EB199A4,
+    (int32_t)0x7F2191B4, (int32_t)0x0EE38766, (int32_t)0x7F1BAF1E, (int32_t)0x0F1572DC,
+    (int32_t)0x7F15B8EE, (int32_t)0x0F475BFF, (int32_t)0x7F0FAF25, (int32_t)0x0F7942C7,
+    (int32_t)0x7F0991C4, (int32_t)0x0FAB272B, (int32_t)0x7F0360CB, (int32_t)0x0FDD0926,
+    (int32_t)0x7EFD1C3C, (int32_t)0x100EE8AD, (int32_t)0x7EF6C418, (int32_t)0x1040C5BB,
+    (int32_t)0x7EF05860, (int32_t)0x1072A048, (int32_t)0x7EE9D914, (int32_t)0x10A4784B,
+    (int32_t)0x7EE34636, (int32_t)0x10D64DBD, (int32_t)0x7EDC9FC6, (int32_t)0x11082096,
+    (int32_t)0x7ED5E5C6, (int32_t)0x1139F0CF, (int32_t)0x7ECF1837, (int32_t)0x116BBE60,
+    (int32_t)0x7EC8371A, (int32_t)0x119D8941, (int32_t)0x7EC14270, (int32_t)0x11CF516A,
+    (int32_t)0x7EBA3A39, (int32_t)0x120116D5, (int32_t)0x7EB31E78, (int32_t)0x1232D979,
+    (int32_t)0x7EABEF2C, (int32_t)0x1264994E, (int32_t)0x7EA4AC58, (int32_t)0x1296564D,
+    (int32_t)0x7E9D55FC, (int32_t)0x12C8106F, (int32_t)0x7E95EC1A, (int32_t)0x12F9C7AA,
+    (int32_t)0x7E8E6EB2, (int32_t)0x132B7BF9, (int32_t)0x7E86DDC6, (int32_t)0x135D2D53,
+    (int32_t)0x7E7F3957, (int32_t)0x138EDBB1, (int32_t)0x7E778166, (int32_t)0x13C0870A,
+    (int32_t)0x7E6FB5F4, (int32_t)0x13F22F58, (int32_t)0x7E67D703, (int32_t)0x1423D492,
+    (int32_t)0x7E5FE493, (int32_t)0x145576B1, (int32_t)0x7E57DEA7, (int32_t)0x148715AE,
+    (int32_t)0x7E4FC53E, (int32_t)0x14B8B17F, (int32_t)0x7E47985B, (int32_t)0x14EA4A1F,
+    (int32_t)0x7E3F57FF, (int32_t)0x151BDF86, (int32_t)0x7E37042A, (int32_t)0x154D71AA,
+    (int32_t)0x7E2E9CDF, (int32_t)0x157F0086, (int32_t)0x7E26221F, (int32_t)0x15B08C12,
+    (int32_t)0x7E1D93EA, (int32_t)0x15E21445, (int32_t)0x7E14F242, (int32_t)0x16139918,
+    (int32_t)0x7E0C3D29, (int32_t)0x16451A83, (int32_t)0x7E0374A0, (int32_t)0x1676987F,
+    (int32_t)0x7DFA98A8, (int32_t)0x16A81305, (int32_t)0x7DF1A942, (int32_t)0x16D98A0C,
+    (int32_t)0x7DE8A670, (int32_t)0x170AFD8D, (int32_t)0x7DDF9034, (int32_t)0x173C6D80,
+    (int32_t)0x7DD6668F, (int32_t)0x176DD9DE, (int32_t)0x7DCD2981, (int32_t)0x179F429F,
+    (int32_t)0x7DC3D90D, (int32_t)0x17D0A7BC, (int32_t)0x7DBA7534, (int32_t)0x1802092C,
+    (int32_t)0x7DB0FDF8, (int32_t)0x183366E9, (int32_t)0x7DA77359, (int32_t)0x1864C0EA,
+    (int32_t)0x7D9DD55A, (int32_t)0x18961728, (int32_t)0x7D9423FC, (int32_t)0x18C7699B,
+    (int32_t)0x7D8A5F40, (int32_t)0x18F8B83C, (int32_t)0x7D808728, (int32_t)0x192A0304,
+    (int32_t)0x7D769BB5, (int32_t)0x195B49EA, (int32_t)0x7D6C9CE9, (int32_t)0x198C8CE7,
+    (int32_t)0x7D628AC6, (int32_t)0x19BDCBF3, (int32_t)0x7D58654D, (int32_t)0x19EF0707,
+    (int32_t)0x7D4E2C7F, (int32_t)0x1A203E1B, (int32_t)0x7D43E05E, (int32_t)0x1A517128,
+    (int32_t)0x7D3980EC, (int32_t)0x1A82A026, (int32_t)0x7D2F0E2B, (int32_t)0x1AB3CB0D,
+    (int32_t)0x7D24881B, (int32_t)0x1AE4F1D6, (int32_t)0x7D19EEBF, (int32_t)0x1B161479,
+    (int32_t)0x7D0F4218, (int32_t)0x1B4732EF, (int32_t)0x7D048228, (int32_t)0x1B784D30,
+    (int32_t)0x7CF9AEF0, (int32_t)0x1BA96335, (int32_t)0x7CEEC873, (int32_t)0x1BDA74F6,
+    (int32_t)0x7CE3CEB2, (int32_t)0x1C0B826A, (int32_t)0x7CD8C1AE, (int32_t)0x1C3C8B8C,
+    (int32_t)0x7CCDA169, (int32_t)0x1C6D9053, (int32_t)0x7CC26DE5, (int32_t)0x1C9E90B8,
+    (int32_t)0x7CB72724, (int32_t)0x1CCF8CB3, (int32_t)0x7CABCD28, (int32_t)0x1D00843D,
+    (int32_t)0x7CA05FF1, (int32_t)0x1D31774D, (int32_t)0x7C94DF83, (int32_t)0x1D6265DD,
+    (int32_t)0x7C894BDE, (int32_t)0x1D934FE5, (int32_t)0x7C7DA505, (int32_t)0x1DC4355E,
+    (int32_t)0x7C71EAF9, (int32_t)0x1DF5163F, (int32_t)0x7C661DBC, (int32_t)0x1E25F282,
+    (int32_t)0x7C5A3D50, (int32_t)0x1E56CA1E, (int32_t)0x7C4E49B7, (int32_t)0x1E879D0D,
+    (int32_t)0x7C4242F2, (int32_t)0x1EB86B46, (int32_t)0x7C362904, (int32_t)0x1EE934C3,
+    (int32_t)0x7C29FBEE, (int32_t)0x1F19F97B, (int32_t)0x7C1DBBB3, (int32_t)0x1F4AB968,
+    (int32_t)0x7C116853, (int32_t)0x1F7B7481, (int32_t)0x7C0501D2, (int32_t)0x1FAC2ABF,
+    (int32_t)0x7BF88830, (int32_t)0x1FDCDC1B, (int32_t)0x7BEBFB70, (int32_t)0x200D888D,
+    (int32_t)0x7BDF5B94, (int32_t)0x203E300D, (int32_t)0x7BD2A89E, (int32_t)0x206ED295,
+    (int32_t)0x7BC5E290, (int32_t)0x209F701C, (int32_t)0x7BB9096B, (int32_t)0x20D0089C,
+    (int32_t)0x7BAC1D31, (int32_t)0x21009C0C, (int32_t)0x7B9F1DE6, (int32_t)0x21312A65,
+    (int32_t)0x7B920B89, (int32_t)0x2161B3A0, (int32_t)0x7B84E61F, (int32_t)0x219237B5,
+    (int32_t)0x7B77ADA8, (int32_t)0x21C2B69C, (int32_t)0x7B6A6227, (int32_t)0x21F3304F,
+    (int32_t)0x7B5D039E, (int32_t)0x2223A4C5, (int32_t)0x7B4F920E, (int32_t)0x225413F8,
+    (int32_t)0x7B420D7A, (int32_t)0x22847DE0, (int32_t)0x7B3475E5, (int32_t)0x22B4E274,
+    (int32_t)0x7B26CB4F, (int32_t)0x22E541AF, (int32_t)0x7B190DBC, (int32_t)0x23159B88,
+    (int32_t)0x7B0B3D2C, (int32_t)0x2345EFF8, (int32_t)0x7AFD59A4, (int32_t)0x23763EF7,
+    (int32_t)0x7AEF6323, (int32_t)0x23A6887F, (int32_t)0x7AE159AE, (int32_t)0x23D6CC87,
+    (int32_t)0x7AD33D45, (int32_t)0x24070B08, (int32_t)0x7AC50DEC, (int32_t)0x243743FA,
+    (int32_t)0x7AB6CBA4, (int32_t)0x24677758, (int32_t)0x7AA8766F, (int32_t)0x2497A517,
+    (int32_t)0x7A9A0E50, (int32_t)0x24C7CD33, (int32_t)0x7A8B9348, (int32_t)0x24F7EFA2,
+    (int32_t)0x7A7D055B, (int32_t)0x25280C5E, (int32_t)0x7A6E648A, (int32_t)0x2558235F,
+    (int32_t)0x7A5FB0D8, (int32_t)0x2588349D, (int32_t)0x7A50EA47, (int32_t)0x25B84012,
+    (int32_t)0x7A4210D8, (int32_t)0x25E845B6, (int32_t)0x7A332490, (int32_t)0x26184581,
+    (int32_t)0x7A24256F, (int32_t)0x26483F6C, (int32_t)0x7A151378, (int32_t)0x26783370,
+    (int32_t)0x7A05EEAD, (int32_t)0x26A82186, (int32_t)0x79F6B711, (int32_t)0x26D809A5,
+    (int32_t)0x79E76CA7, (int32_t)0x2707EBC7, (int32_t)0x79D80F6F, (int32_t)0x2737C7E3,
+    (int32_t)0x79C89F6E, (int32_t)0x27679DF4, (int32_t)0x79B91CA4, (int32_t)0x27976DF1,
+    (int32_t)0x79A98715, (int32_t)0x27C737D3, (int32_t)0x7999DEC4, (int32_t)0x27F6FB92,
+    (int32_t)0x798A23B1, (int32_t)0x2826B928, (int32_t)0x797A55E0, (int32_t)0x2856708D,
+    (int32_t)0x796A7554, (int32_t)0x288621B9, (int32_t)0x795A820E, (int32_t)0x28B5CCA5,
+    (int32_t)0x794A7C12, (int32_t)0x28E5714B, (int32_t)0x793A6361, (int32_t)0x29150FA1,
+    (int32_t)0x792A37FE, (int32_t)0x2944A7A2, (int32_t)0x7919F9EC, (int32_t)0x29743946,
+    (int32_t)0x7909A92D, (int32_t)0x29A3C485, (int32_t)0x78F945C3, (int32_t)0x29D34958,
+    (int32_t)0x78E8CFB2, (int32_t)0x2A02C7B8, (int32_t)0x78D846FB, (int32_t)0x2A323F9E,
+    (int32_t)0x78C7ABA2, (int32_t)0x2A61B101, (int32_t)0x78B6FDA8, (int32_t)0x2A911BDC,
+    (int32_t)0x78A63D11, (int32_t)0x2AC08026, (int32_t)0x789569DF, (int32_t)0x2AEFDDD8,
+    (int32_t)0x78848414, (int32_t)0x2B1F34EB, (int32_t)0x78738BB3, (int32_t)0x2B4E8558,
+    (int32_t)0x786280BF, (int32_t)0x2B7DCF17, (int32_t)0x7851633B, (int32_t)0x2BAD1221,
+    (int32_t)0x78403329, (int32_t)0x2BDC4E6F, (int32_t)0x782EF08B, (int32_t)0x2C0B83FA,
+    (int32_t)0x781D9B65, (int32_t)0x2C3AB2B9, (int32_t)0x780C33B8, (int32_t)0x2C69DAA6,
+    (int32_t)0x77FAB989, (int32_t)0x2C98FBBA, (int32_t)0x77E92CD9, (int32_t)0x2CC815EE,
+    (int32_t)0x77D78DAA, (int32_t)0x2CF72939, (int32_t)0x77C5DC01, (int32_t)0x2D263596,
+    (int32_t)0x77B417DF, (int32_t)0x2D553AFC, (int32_t)0x77A24148, (int32_t)0x2D843964,
+    (int32_t)0x7790583E, (int32_t)0x2DB330C7, (int32_t)0x777E5CC3, (int32_t)0x2DE2211E,
+    (int32_t)0x776C4EDB, (int32_t)0x2E110A62, (int32_t)0x775A2E89, (int32_t)0x2E3FEC8B,
+    (int32_t)0x7747FBCE, (int32_t)0x2E6EC792, (int32_t)0x7735B6AF, (int32_t)0x2E9D9B70,
+    (int32_t)0x77235F2D, (int32_t)0x2ECC681E, (int32_t)0x7710F54C, (int32_t)0x2EFB2D95,
+    (int32_t)0x76FE790E, (int32_t)0x2F29EBCC, (int32_t)0x76EBEA77, (int32_t)0x2F58A2BE,
+    (int32_t)0x76D94989, (int32_t)0x2F875262, (int32_t)0x76C69647, (int32_t)0x2FB5FAB2,
+    (int32_t)0x76B3D0B4, (int32_t)0x2FE49BA7, (int32_t)0x76A0F8D2, (int32_t)0x30133539,
+    (int32_t)0x768E0EA6, (int32_t)0x3041C761, (int32_t)0x767B1231, (int32_t)0x30705217,
+    (int32_t)0x76680376, (int32_t)0x309ED556, (int32_t)0x7654E279, (int32_t)0x30CD5115,
+    (int32_t)0x7641AF3D, (int32_t)0x30FBC54D, (int32_t)0x762E69C4, (int32_t)0x312A31F8,
+    (int32_t)0x761B1211, (int32_t)0x3158970E, (int32_t)0x7607A828, (int32_t)0x3186F487,
+    (int32_t)0x75F42C0B, (int32_t)0x31B54A5E, (int32_t)0x75E09DBD, (int32_t)0x31E39889,
+    (int32_t)0x75CCFD42, (int32_t)0x3211DF04, (int32_t)0x75B94A9C, (int32_t)0x32401DC6,
+    (int32_t)0x75A585CF, (int32_t)0x326E54C7, (int32_t)0x7591AEDD, (int32_t)0x329C8402,
+    (int32_t)0x757DC5CA, (int32_t)0x32CAAB6F, (int32_t)0x7569CA99, (int32_t)0x32F8CB07,
+    (int32_t)0x7555BD4C, (int32_t)0x3326E2C3, (int32_t)0x75419DE7, (int32_t)0x3354F29B,
+    (int32_t)0x752D6C6C, (int32_t)0x3382FA88, (int32_t)0x751928E0, (int32_t)0x33B0FA84,
+    (int32_t)0x7504D345, (int32_t)0x33DEF287, (int32_t)0x74F06B9E, (int32_t)0x340CE28B,
+    (int32_t)0x74DBF1EF, (int32_t)0x343ACA87, (int32_t)0x74C7663A, (int32_t)0x3468AA76,
+    (int32_t)0x74B2C884, (int32_t)0x34968250, (int32_t)0x749E18CD, (int32_t)0x34C4520D,
+    (int32_t)0x7489571C, (int32_t)0x34F219A8, (int32_t)0x74748371, (int32_t)0x351FD918,
+    (int32_t)0x745F9DD1, (int32_t)0x354D9057, (int32_t)0x744AA63F, (int32_t)0x357B3F5D,
+    (int32_t)0x74359CBD, (int32_t)0x35A8E625, (int32_t)0x74208150, (int32_t)0x35D684A6,
+    (int32_t)0x740B53FB, (int32_t)0x36041AD9, (int32_t)0x73F614C0, (int32_t)0x3631A8B8,
+    (int32_t)0x73E0C3A3, (int32_t)0x365F2E3B, (int32_t)0x73CB60A8, (int32_t)0x368CAB5C,
+    (int32_t)0x73B5EBD1, (int32_t)0x36BA2014, (int32_t)0x73A06522, (int32_t)0x36E78C5B,
+    (int32_t)0x738ACC9E, (int32_t)0x3714F02A, (int32_t)0x73752249, (int32_t)0x37424B7B,
+    (int32_t)0x735F6626, (int32_t)0x376F9E46, (int32_t)0x73499838, (int32_t)0x379CE885,
+    (int32_t)0x7333B883, (int32_t)0x37CA2A30, (int32_t)0x731DC70A, (int32_t)0x37F76341,
+    (int32_t)0x7307C3D0, (int32_t)0x382493B0, (int32_t)0x72F1AED9, (int32_t)0x3851BB77,
+    (int32_t)0x72DB8828, (int32_t)0x387EDA8E, (int32_t)0x72C54FC1, (int32_t)0x38ABF0EF,
+    (int32_t)0x72AF05A7, (int32_t)0x38D8FE93, (int32_t)0x7298A9DD, (int32_t)0x39060373,
+    (int32_t)0x72823C67, (int32_t)0x3932FF87, (int32_t)0x726BBD48, (int32_t)0x395FF2C9,
+    (int32_t)0x72552C85, (int32_t)0x398CDD32, (int32_t)0x723E8A20, (int32_t)0x39B9BEBC,
+    (int32_t)0x7227D61C, (int32_t)0x39E6975E, (int32_t)0x7211107E, (int32_t)0x3A136712,
+    (int32_t)0x71FA3949, (int32_t)0x3A402DD2, (int32_t)0x71E35080, (int32_t)0x3A6CEB96,
+    (int32_t)0x71CC5626, (int32_t)0x3A99A057, (int32_t)0x71B54A41, (int32_t)0x3AC64C0F,
+    (int32_t)0x719E2CD2, (int32_t)0x3AF2EEB7, (int32_t)0x7186FDDE, (int32_t)0x3B1F8848,
+    (int32_t)0x716FBD68, (int32_t)0x3B4C18BA, (int32_t)0x71586B74, (int32_t)0x3B78A007,
+    (int32_t)0x71410805, (int32_t)0x3BA51E29, (int32_t)0x7129931F, (int32_t)0x3BD19318,
+    (int32_t)0x71120CC5, (int32_t)0x3BFDFECD, (int32_t)0x70FA74FC, (int32_t)0x3C2A6142,
+    (int32_t)0x70E2CBC6, (int32_t)0x3C56BA70, (int32_t)0x70CB1128, (int32_t)0x3C830A50,
+    (int32_t)0x70B34525, (int32_t)0x3CAF50DA, (int32_t)0x709B67C0, (int32_t)0x3CDB8E09,
+    (int32_t)0x708378FF, (int32_t)0x3D07C1D6, (int32_t)0x706B78E3, (int32_t)0x3D33EC39,
+    (int32_t)0x70536771, (int32_t)0x3D600D2C, (int32_t)0x703B44AD, (int32_t)0x3D8C24A8,
+    (int32_t)0x7023109A, (int32_t)0x3DB832A6, (int32_t)0x700ACB3C, (int32_t)0x3DE4371F,
+    (int32_t)0x6FF27497, (int32_t)0x3E10320D, (int32_t)0x6FDA0CAE, (int32_t)0x3E3C2369,
+    (int32_t)0x6FC19385, (int32_t)0x3E680B2C, (int32_t)0x6FA90921, (int32_t)0x3E93E950,
+    (int32_t)0x6F906D84, (int32_t)0x3EBFBDCD, (int32_t)0x6F77C0B3, (int32_t)0x3EEB889C,
+    (int32_t)0x6F5F02B2, (int32_t)0x3F1749B8, (int32_t)0x6F463383, (int32_t)0x3F430119,
+    (int32_t)0x6F2D532C, (int32_t)0x3F6EAEB8, (int32_t)0x6F1461B0, (int32_t)0x3F9A5290,
+    (int32_t)0x6EFB5F12, (int32_t)0x3FC5EC98, (int32_t)0x6EE24B57, (int32_t)0x3FF17CCA,
+    (int32_t)0x6EC92683, (int32_t)0x401D0321, (int32_t)0x6EAFF099, (int32_t)0x40487F94,
+    (int32_t)0x6E96A99D, (int32_t)0x4073F21D, (int32_t)0x6E7D5193, (int32_t)0x409F5AB6,
+    (int32_t)0x6E63E87F, (int32_t)0x40CAB958, (int32_t)0x6E4A6E66, (int32_t)0x40F60DFB,
+    (int32_t)0x6E30E34A, (int32_t)0x4121589B, (int32_t)0x6E174730, (int32_t)0x414C992F,
+    (int32_t)0x6DFD9A1C, (int32_t)0x4177CFB1, (int32_t)0x6DE3DC11, (int32_t)0x41A2FC1A,
+    (int32_t)0x6DCA0D14, (int32_t)0x41CE1E65, (int32_t)0x6DB02D29, (int32_t)0x41F93689,
+    (int32_t)0x6D963C54, (int32_t)0x42244481, (int32_t)0x6D7C3A98, (int32_t)0x424F4845,
+    (int32_t)0x6D6227FA, (int32_t)0x427A41D0, (int32_t)0x6D48047E, (int32_t)0x42A5311B,
+    (int32_t)0x6D2DD027, (int32_t)0x42D0161E, (int32_t)0x6D138AFB, (int32_t)0x42FAF0D4,
+    (int32_t)0x6CF934FC, (int32_t)0x4325C135, (int32_t)0x6CDECE2F, (int32_t)0x4350873C,
+    (int32_t)0x6CC45698, (int32_t)0x437B42E1, (int32_t)0x6CA9CE3B, (int32_t)0x43A5F41E,
+    (int32_t)0x6C8F351C, (int32_t)0x43D09AED, (int32_t)0x6C748B3F, (int32_t)0x43FB3746,
+    (int32_t)0x6C59D0A9, (int32_t)0x4425C923, (int32_t)0x6C3F055D, (int32_t)0x4450507E,
+    (int32_t)0x6C242960, (int32_t)0x447ACD50, (int32_t)0x6C093CB6, (int32_t)0x44A53F93,
+    (int32_t)0x6BEE3F62, (int32_t)0x44CFA740, (int32_t)0x6BD3316A, (int32_t)0x44FA0450,
+    (int32_t)0x6BB812D1, (int32_t)0x452456BD, (int32_t)0x6B9CE39B, (int32_t)0x454E9E80,
+    (int32_t)0x6B81A3CD, (int32_t)0x4578DB93, (int32_t)0x6B66536B, (int32_t)0x45A30DF0,
+    (int32_t)0x6B4AF279, (int32_t)0x45CD358F, (int32_t)0x6B2F80FB, (int32_t)0x45F7526B,
+    (int32_t)0x6B13FEF5, (int32_t)0x4621647D, (int32_t)0x6AF86C6C, (int32_t)0x464B6BBE,
+    (int32_t)0x6ADCC964, (int32_t)0x46756828, (int32_t)0x6AC115E2, (int32_t)0x469F59B4,
+    (int32_t)0x6AA551E9, (int32_t)0x46C9405C, (int32_t)0x6A897D7D, (int32_t)0x46F31C1A,
+    (int32_t)0x6A6D98A4, (int32_t)0x471CECE7, (int32_t)0x6A51A361, (int32_t)0x4746B2BC,
+    (int32_t)0x6A359DB9, (int32_t)0x47706D93, (int32_t)0x6A1987B0, (int32_t)0x479A1D67,
+    (int32_t)0x69FD614A, (int32_t)0x47C3C22F, (int32_t)0x69E12A8C, (int32_t)0x47ED5BE6,
+    (int32_t)0x69C4E37A, (int32_t)0x4816EA86, (int32_t)0x69A88C19, (int32_t)0x48406E08,
+    (int32_t)0x698C246C, (int32_t)0x4869E665, (int32_t)0x696FAC78, (int32_t)0x48935397,
+    (int32_t)0x69532442, (int32_t)0x48BCB599, (int32_t)0x69368BCE, (int32_t)0x48E60C62,
+    (int32_t)0x6919E320, (int32_t)0x490F57EE, (int32_t)0x68FD2A3D, (int32_t)0x49389836,
+    (int32_t)0x68E06129, (int32_t)0x4961CD33, (int32_t)0x68C387E9, (int32_t)0x498AF6DF,
+    (int32_t)0x68A69E81, (int32_t)0x49B41533, (int32_t)0x6889A4F6, (int32_t)0x49DD282A,
+    (int32_t)0x686C9B4B, (int32_t)0x4A062FBD, (int32_t)0x684F8186, (int32_t)0x4A2F2BE6,
+    (int32_t)0x683257AB, (int32_t)0x4A581C9E, (int32_t)0x68151DBE, (int32_t)0x4A8101DE,
+    (int32_t)0x67F7D3C5, (int32_t)0x4AA9DBA2, (int32_t)0x67DA79C3, (int32_t)0x4AD2A9E2,
+    (int32_t)0x67BD0FBD, (int32_t)0x4AFB6C98, (int32_t)0x679F95B7, (int32_t)0x4B2423BE,
+    (int32_t)0x67820BB7, (int32_t)0x4B4CCF4D, (int32_t)0x676471C0, (int32_t)0x4B756F40,
+    (int32_t)0x6746C7D8, (int32_t)0x4B9E0390, (int32_t)0x67290E02, (int32_t)0x4BC68C36,
+    (int32_t)0x670B4444, (int32_t)0x4BEF092D, (int32_t)0x66ED6AA1, (int32_t)0x4C177A6E,
+    (int32_t)0x66CF8120, (int32_t)0x4C3FDFF4, (int32_t)0x66B187C3, (int32_t)0x4C6839B7,
+    (int32_t)0x66937E91, (int32_t)0x4C9087B1, (int32_t)0x6675658C, (int32_t)0x4CB8C9DD,
+    (int32_t)0x66573CBB, (int32_t)0x4CE10034, (int32_t)0x66390422, (int32_t)0x4D092AB0,
+    (int32_t)0x661ABBC5, (int32_t)0x4D31494B, (int32_t)0x65FC63A9, (int32_t)0x4D595BFE,
+    (int32_t)0x65DDFBD3, (int32_t)0x4D8162C4, (int32_t)0x65BF8447, (int32_t)0x4DA95D96,
+    (int32_t)0x65A0FD0B, (int32_t)0x4DD14C6E, (int32_t)0x65826622, (int32_t)0x4DF92F46,
+    (int32_t)0x6563BF92, (int32_t)0x4E210617, (int32_t)0x6545095F, (int32_t)0x4E48D0DD,
+    (int32_t)0x6526438F, (int32_t)0x4E708F8F, (int32_t)0x65076E25, (int32_t)0x4E984229,
+    (int32_t)0x64E88926, (int32_t)0x4EBFE8A5, (int32_t)0x64C99498, (int32_t)0x4EE782FB,
+    (int32_t)0x64AA907F, (int32_t)0x4F0F1126, (int32_t)0x648B7CE0, (int32_t)0x4F369320,
+    (int32_t)0x646C59BF, (int32_t)0x4F5E08E3, (int32_t)0x644D2722, (int32_t)0x4F857269,
+    (int32_t)0x642DE50D, (int32_t)0x4FACCFAB, (int32_t)0x640E9386, (int32_t)0x4FD420A4,
+    (int32_t)0x63EF3290, (int32_t)0x4FFB654D, (int32_t)0x63CFC231, (int32_t)0x50229DA1,
+    (int32_t)0x63B0426D, (int32_t)0x5049C999, (int32_t)0x6390B34A, (int32_t)0x5070E92F,
+    (int32_t)0x637114CC, (int32_t)0x5097FC5E, (int32_t)0x635166F9, (int32_t)0x50BF031F,
+    (int32_t)0x6331A9D4, (int32_t)0x50E5FD6D, (int32_t)0x6311DD64, (int32_t)0x510CEB40,
+    (int32_t)0x62F201AC, (int32_t)0x5133CC94, (int32_t)0x62D216B3, (int32_t)0x515AA162,
+    (int32_t)0x62B21C7B, (int32_t)0x518169A5, (int32_t)0x6292130C, (int32_t)0x51A82555,
+    (int32_t)0x6271FA69, (int32_t)0x51CED46E, (int32_t)0x6251D298, (int32_t)0x51F576EA,
+    (int32_t)0x62319B9D, (int32_t)0x521C0CC2, (int32_t)0x6211557E, (int32_t)0x524295F0,
+    (int32_t)0x61F1003F, (int32_t)0x5269126E, (int32_t)0x61D09BE5, (int32_t)0x528F8238,
+    (int32_t)0x61B02876, (int32_t)0x52B5E546, (int32_t)0x618FA5F7, (int32_t)0x52DC3B92,
+    (int32_t)0x616F146C, (int32_t)0x53028518, (int32_t)0x614E73DA, (int32_t)0x5328C1D0,
+    (int32_t)0x612DC447, (int32_t)0x534EF1B5, (int32_t)0x610D05B7, (int32_t)0x537514C2,
+    (int32_t)0x60EC3830, (int32_t)0x539B2AF0, (int32_t)0x60CB5BB7, (int32_t)0x53C13439,
+    (int32_t)0x60AA7050, (int32_t)0x53E73097, (int32_t)0x60897601, (int32_t)0x540D2005,
+    (int32_t)0x60686CCF, (int32_t)0x5433027D, (int32_t)0x604754BF, (int32_t)0x5458D7F9,
+    (int32_t)0x60262DD6, (int32_t)0x547EA073, (int32_t)0x6004F819, (int32_t)0x54A45BE6,
+    (int32_t)0x5FE3B38D, (int32_t)0x54CA0A4B, (int32_t)0x5FC26038, (int32_t)0x54EFAB9C,
+    (int32_t)0x5FA0FE1F, (int32_t)0x55153FD4, (int32_t)0x5F7F8D46, (int32_t)0x553AC6EE,
+    (int32_t)0x5F5E0DB3, (int32_t)0x556040E2, (int32_t)0x5F3C7F6B, (int32_t)0x5585ADAD,
+    (int32_t)0x5F1AE274, (int32_t)0x55AB0D46, (int32_t)0x5EF936D1, (int32_t)0x55D05FAA,
+    (int32_t)0x5ED77C8A, (int32_t)0x55F5A4D2, (int32_t)0x5EB5B3A2, (int32_t)0x561ADCB9,
+    (int32_t)0x5E93DC1F, (int32_t)0x56400758, (int32_t)0x5E71F606, (int32_t)0x566524AA,
+    (int32_t)0x5E50015D, (int32_t)0x568A34A9, (int32_t)0x5E2DFE29, (int32_t)0x56AF3750,
+    (int32_t)0x5E0BEC6E, (int32_t)0x56D42C99, (int32_t)0x5DE9CC33, (int32_t)0x56F9147E,
+    (int32_t)0x5DC79D7C, (int32_t)0x571DEEFA, (int32_t)0x5DA5604F, (int32_t)0x5742BC06,
+    (int32_t)0x5D8314B1, (int32_t)0x57677B9D, (int32_t)0x5D60BAA7, (int32_t)0x578C2DBA,
+    (int32_t)0x5D3E5237, (int32_t)0x57B0D256, (int32_t)0x5D1BDB65, (int32_t)0x57D5696D,
+    (int32_t)0x5CF95638, (int32_t)0x57F9F2F8, (int32_t)0x5CD6C2B5, (int32_t)0x581E6EF1,
+    (int32_t)0x5CB420E0, (int32_t)0x5842DD54, (int32_t)0x5C9170BF, (int32_t)0x58673E1B,
+    (int32_t)0x5C6EB258, (int32_t)0x588B9140, (int32_t)0x5C4BE5B0, (int32_t)0x58AFD6BD,
+    (int32_t)0x5C290ACC, (int32_t)0x58D40E8C, (int32_t)0x5C0621B2, (int32_t)0x58F838A9,
+    (int32_t)0x5BE32A67, (int32_t)0x591C550E, (int32_t)0x5BC024F0, (int32_t)0x594063B5,
+    (int32_t)0x5B9D1154, (int32_t)0x59646498, (int32_t)0x5B79EF96, (int32_t)0x598857B2,
+    (int32_t)0x5B56BFBD, (int32_t)0x59AC3CFD, (int32_t)0x5B3381CE, (int32_t)0x59D01475,
+    (int32_t)0x5B1035CF, (int32_t)0x59F3DE12, (int32_t)0x5AECDBC5, (int32_t)0x5A1799D1,
+    (int32_t)0x5AC973B5, (int32_t)0x5A3B47AB, (int32_t)0x5AA5FDA5, (int32_t)0x5A5EE79A,
+    (int32_t)0x5A82799A, (int32_t)0x5A82799A, (int32_t)0x5A5EE79A, (int32_t)0x5AA5FDA5,
+    (int32_t)0x5A3B47AB, (int32_t)0x5AC973B5, (int32_t)0x5A1799D1, (int32_t)0x5AECDBC5,
+    (int32_t)0x59F3DE12, (int32_t)0x5B1035CF, (int32_t)0x59D01475, (int32_t)0x5B3381CE,
+    (int32_t)0x59AC3CFD, (int32_t)0x5B56BFBD, (int32_t)0x598857B2, (int32_t)0x5B79EF96,
+    (int32_t)0x59646498, (int32_t)0x5B9D1154, (int32_t)0x594063B5, (int32_t)0x5BC024F0,
+    (int32_t)0x591C550E, (int32_t)0x5BE32A67, (int32_t)0x58F838A9, (int32_t)0x5C0621B2,
+    (int32_t)0x58D40E8C, (int32_t)0x5C290ACC, (int32_t)0x58AFD6BD, (int32_t)0x5C4BE5B0,
+    (int32_t)0x588B9140, (int32_t)0x5C6EB258, (int32_t)0x58673E1B, (int32_t)0x5C9170BF,
+    (int32_t)0x5842DD54, (int32_t)0x5CB420E0, (int32_t)0x581E6EF1, (int32_t)0x5CD6C2B5,
+    (int32_t)0x57F9F2F8, (int32_t)0x5CF95638, (int32_t)0x57D5696D, (int32_t)0x5D1BDB65,
+    (int32_t)0x57B0D256, (int32_t)0x5D3E5237, (int32_t)0x578C2DBA, (int32_t)0x5D60BAA7,
+    (int32_t)0x57677B9D, (int32_t)0x5D8314B1, (int32_t)0x5742BC06, (int32_t)0x5DA5604F,
+    (int32_t)0x571DEEFA, (int32_t)0x5DC79D7C, (int32_t)0x56F9147E, (int32_t)0x5DE9CC33,
+    (int32_t)0x56D42C99, (int32_t)0x5E0BEC6E, (int32_t)0x56AF3750, (int32_t)0x5E2DFE29,
+    (int32_t)0x568A34A9, (int32_t)0x5E50015D, (int32_t)0x566524AA, (int32_t)0x5E71F606,
+    (int32_t)0x56400758, (int32_t)0x5E93DC1F, (int32_t)0x561ADCB9, (int32_t)0x5EB5B3A2,
+    (int32_t)0x55F5A4D2, (int32_t)0x5ED77C8A, (int32_t)0x55D05FAA, (int32_t)0x5EF936D1,
+    (int32_t)0x55AB0D46, (int32_t)0x5F1AE274, (int32_t)0x5585ADAD, (int32_t)0x5F3C7F6B,
+    (int32_t)0x556040E2, (int32_t)0x5F5E0DB3, (int32_t)0x553AC6EE, (int32_t)0x5F7F8D46,
+    (int32_t)0x55153FD4, (int32_t)0x5FA0FE1F, (int32_t)0x54EFAB9C, (int32_t)0x5FC26038,
+    (int32_t)0x54CA0A4B, (int32_t)0x5FE3B38D, (int32_t)0x54A45BE6, (int32_t)0x6004F819,
+    (int32_t)0x547EA073, (int32_t)0x60262DD6, (int32_t)0x5458D7F9, (int32_t)0x604754BF,
+    (int32_t)0x5433027D, (int32_t)0x60686CCF, (int32_t)0x540D2005, (int32_t)0x60897601,
+    (int32_t)0x53E73097, (int32_t)0x60AA7050, (int32_t)0x53C13439, (int32_t)0x60CB5BB7,
+    (int32_t)0x539B2AF0, (int32_t)0x60EC3830, (int32_t)0x537514C2, (int32_t)0x610D05B7,
+    (int32_t)0x534EF1B5, (int32_t)0x612DC447, (int32_t)0x5328C1D0, (int32_t)0x614E73DA,
+    (int32_t)0x53028518, (int32_t)0x616F146C, (int32_t)0x52DC3B92, (int32_t)0x618FA5F7,
+    (int32_t)0x52B5E546, (int32_t)0x61B02876, (int32_t)0x528F8238, (int32_t)0x61D09BE5,
+    (int32_t)0x5269126E, (int32_t)0x61F1003F, (int32_t)0x524295F0, (int32_t)0x6211557E,
+    (int32_t)0x521C0CC2, (int32_t)0x62319B9D, (int32_t)0x51F576EA, (int32_t)0x6251D298,
+    (int32_t)0x51CED46E, (int32_t)0x6271FA69, (int32_t)0x51A82555, (int32_t)0x6292130C,
+    (int32_t)0x518169A5, (int32_t)0x62B21C7B, (int32_t)0x515AA162, (int32_t)0x62D216B3,
+    (int32_t)0x5133CC94, (int32_t)0x62F201AC, (int32_t)0x510CEB40, (int32_t)0x6311DD64,
+    (int32_t)0x50E5FD6D, (int32_t)0x6331A9D4, (int32_t)0x50BF031F, (int32_t)0x635166F9,
+    (int32_t)0x5097FC5E, (int32_t)0x637114CC, (int32_t)0x5070E92F, (int32_t)0x6390B34A,
+    (int32_t)0x5049C999, (int32_t)0x63B0426D, (int32_t)0x50229DA1, (int32_t)0x63CFC231,
+    (int32_t)0x4FFB654D, (int32_t)0x63EF3290, (int32_t)0x4FD420A4, (int32_t)0x640E9386,
+    (int32_t)0x4FACCFAB, (int32_t)0x642DE50D, (int32_t)0x4F857269, (int32_t)0x644D2722,
+    (int32_t)0x4F5E08E3, (int32_t)0x646C59BF, (int32_t)0x4F369320, (int32_t)0x648B7CE0,
+    (int32_t)0x4F0F1126, (int32_t)0x64AA907F, (int32_t)0x4EE782FB, (int32_t)0x64C99498,
+    (int32_t)0x4EBFE8A5, (int32_t)0x64E88926, (int32_t)0x4E984229, (int32_t)0x65076E25,
+    (int32_t)0x4E708F8F, (int32_t)0x6526438F, (int32_t)0x4E48D0DD, (int32_t)0x6545095F,
+    (int32_t)0x4E210617, (int32_t)0x6563BF92, (int32_t)0x4DF92F46, (int32_t)0x65826622,
+    (int32_t)0x4DD14C6E, (int32_t)0x65A0FD0B, (int32_t)0x4DA95D96, (int32_t)0x65BF8447,
+    (int32_t)0x4D8162C4, (int32_t)0x65DDFBD3, (int32_t)0x4D595BFE, (int32_t)0x65FC63A9,
+    (int32_t)0x4D31494B, (int32_t)0x661ABBC5, (int32_t)0x4D092AB0, (int32_t)0x66390422,
+    (int32_t)0x4CE10034, (int32_t)0x66573CBB, (int32_t)0x4CB8C9DD, (int32_t)0x6675658C,
+    (int32_t)0x4C9087B1, (int32_t)0x66937E91, (int32_t)0x4C6839B7, (int32_t)0x66B187C3,
+    (int32_t)0x4C3FDFF4, (int32_t)0x66CF8120, (int32_t)0x4C177A6E, (int32_t)0x66ED6AA1,
+    (int32_t)0x4BEF092D, (int32_t)0x670B4444, (int32_t)0x4BC68C36, (int32_t)0x67290E02,
+    (int32_t)0x4B9E0390, (int32_t)0x6746C7D8, (int32_t)0x4B756F40, (int32_t)0x676471C0,
+    (int32_t)0x4B4CCF4D, (int32_t)0x67820BB7, (int32_t)0x4B2423BE, (int32_t)0x679F95B7,
+    (int32_t)0x4AFB6C98, (int32_t)0x67BD0FBD, (int32_t)0x4AD2A9E2, (int32_t)0x67DA79C3,
+    (int32_t)0x4AA9DBA2, (int32_t)0x67F7D3C5, (int32_t)0x4A8101DE, (int32_t)0x68151DBE,
+    (int32_t)0x4A581C9E, (int32_t)0x683257AB, (int32_t)0x4A2F2BE6, (int32_t)0x684F8186,
+    (int32_t)0x4A062FBD, (int32_t)0x686C9B4B, (int32_t)0x49DD282A, (int32_t)0x6889A4F6,
+    (int32_t)0x49B41533, (int32_t)0x68A69E81, (int32_t)0x498AF6DF, (int32_t)0x68C387E9,
+    (int32_t)0x4961CD33, (int32_t)0x68E06129, (int32_t)0x49389836, (int32_t)0x68FD2A3D,
+    (int32_t)0x490F57EE, (int32_t)0x6919E320, (int32_t)0x48E60C62, (int32_t)0x69368BCE,
+    (int32_t)0x48BCB599, (int32_t)0x69532442, (int32_t)0x48935397, (int32_t)0x696FAC78,
+    (int32_t)0x4869E665, (int32_t)0x698C246C, (int32_t)0x48406E08, (int32_t)0x69A88C19,
+    (int32_t)0x4816EA86, (int32_t)0x69C4E37A, (int32_t)0x47ED5BE6, (int32_t)0x69E12A8C,
+    (int32_t)0x47C3C22F, (int32_t)0x69FD614A, (int32_t)0x479A1D67, (int32_t)0x6A1987B0,
+    (int32_t)0x47706D93, (int32_t)0x6A359DB9, (int32_t)0x4746B2BC, (int32_t)0x6A51A361,
+    (int32_t)0x471CECE7, (int32_t)0x6A6D98A4, (int32_t)0x46F31C1A, (int32_t)0x6A897D7D,
+    (int32_t)0x46C9405C, (int32_t)0x6AA551E9, (int32_t)0x469F59B4, (int32_t)0x6AC115E2,
+    (int32_t)0x46756828, (int32_t)0x6ADCC964, (int32_t)0x464B6BBE, (int32_t)0x6AF86C6C,
+    (int32_t)0x4621647D, (int32_t)0x6B13FEF5, (int32_t)0x45F7526B, (int32_t)0x6B2F80FB,
+    (int32_t)0x45CD358F, (int32_t)0x6B4AF279, (int32_t)0x45A30DF0, (int32_t)0x6B66536B,
+    (int32_t)0x4578DB93, (int32_t)0x6B81A3CD, (int32_t)0x454E9E80, (int32_t)0x6B9CE39B,
+    (int32_t)0x452456BD, (int32_t)0x6BB812D1, (int32_t)0x44FA0450, (int32_t)0x6BD3316A,
+    (int32_t)0x44CFA740, (int32_t)0x6BEE3F62, (int32_t)0x44A53F93, (int32_t)0x6C093CB6,
+    (int32_t)0x447ACD50, (int32_t)0x6C242960, (int32_t)0x4450507E, (int32_t)0x6C3F055D,
+    (int32_t)0x4425C923, (int32_t)0x6C59D0A9, (int32_t)0x43FB3746, (int32_t)0x6C748B3F,
+    (int32_t)0x43D09AED, (int32_t)0x6C8F351C, (int32_t)0x43A5F41E, (int32_t)0x6CA9CE3B,
+    (int32_t)0x437B42E1, (int32_t)0x6CC45698, (int32_t)0x4350873C, (int32_t)0x6CDECE2F,
+    (int32_t)0x4325C135, (int32_t)0x6CF934FC, (int32_t)0x42FAF0D4, (int32_t)0x6D138AFB,
+    (int32_t)0x42D0161E, (int32_t)0x6D2DD027, (int32_t)0x42A5311B, (int32_t)0x6D48047E,
+    (int32_t)0x427A41D0, (int32_t)0x6D6227FA, (int32_t)0x424F4845, (int32_t)0x6D7C3A98,
+    (int32_t)0x42244481, (int32_t)0x6D963C54, (int32_t)0x41F93689, (int32_t)0x6DB02D29,
+    (int32_t)0x41CE1E65, (int32_t)0x6DCA0D14, (int32_t)0x41A2FC1A, (int32_t)0x6DE3DC11,
+    (int32_t)0x4177CFB1, (int32_t)0x6DFD9A1C, (int32_t)0x414C992F, (int32_t)0x6E174730,
+    (int32_t)0x4121589B, (int32_t)0x6E30E34A, (int32_t)0x40F60DFB, (int32_t)0x6E4A6E66,
+    (int32_t)0x40CAB958, (int32_t)0x6E63E87F, (int32_t)0x409F5AB6, (int32_t)0x6E7D5193,
+    (int32_t)0x4073F21D, (int32_t)0x6E96A99D, (int32_t)0x40487F94, (int32_t)0x6EAFF099,
+    (int32_t)0x401D0321, (int32_t)0x6EC92683, (int32_t)0x3FF17CCA, (int32_t)0x6EE24B57,
+    (int32_t)0x3FC5EC98, (int32_t)0x6EFB5F12, (int32_t)0x3F9A5290, (int32_t)0x6F1461B0,
+    (int32_t)0x3F6EAEB8, (int32_t)0x6F2D532C, (int32_t)0x3F430119, (int32_t)0x6F463383,
+    (int32_t)0x3F1749B8, (int32_t)0x6F5F02B2, (int32_t)0x3EEB889C, (int32_t)0x6F77C0B3,
+    (int32_t)0x3EBFBDCD, (int32_t)0x6F906D84, (int32_t)0x3E93E950, (int32_t)0x6FA90921,
+    (int32_t)0x3E680B2C, (int32_t)0x6FC19385, (int32_t)0x3E3C2369, (int32_t)0x6FDA0CAE,
+    (int32_t)0x3E10320D, (int32_t)0x6FF27497, (int32_t)0x3DE4371F, (int32_t)0x700ACB3C,
+    (int32_t)0x3DB832A6, (int32_t)0x7023109A, (int32_t)0x3D8C24A8, (int32_t)0x703B44AD,
+    (int32_t)0x3D600D2C, (int32_t)0x70536771, (int32_t)0x3D33EC39, (int32_t)0x706B78E3,
+    (int32_t)0x3D07C1D6, (int32_t)0x708378FF, (int32_t)0x3CDB8E09, (int32_t)0x709B67C0,
+    (int32_t)0x3CAF50DA, (int32_t)0x70B34525, (int32_t)0x3C830A50, (int32_t)0x70CB1128,
+    (int32_t)0x3C56BA70, (int32_t)0x70E2CBC6, (int32_t)0x3C2A6142, (int32_t)0x70FA74FC,
+    (int32_t)0x3BFDFECD, (int32_t)0x71120CC5, (int32_t)0x3BD19318, (int32_t)0x7129931F,
+    (int32_t)0x3BA51E29, (int32_t)0x71410805, (int32_t)0x3B78A007, (int32_t)0x71586B74,
+    (int32_t)0x3B4C18BA, (int32_t)0x716FBD68, (int32_t)0x3B1F8848, (int32_t)0x7186FDDE,
+    (int32_t)0x3AF2EEB7, (int32_t)0x719E2CD2, (int32_t)0x3AC64C0F, (int32_t)0x71B54A41,
+    (int32_t)0x3A99A057, (int32_t)0x71CC5626, (int32_t)0x3A6CEB96, (int32_t)0x71E35080,
+    (int32_t)0x3A402DD2, (int32_t)0x71FA3949, (int32_t)0x3A136712, (int32_t)0x7211107E,
+    (int32_t)0x39E6975E, (int32_t)0x7227D61C, (int32_t)0x39B9BEBC, (int32_t)0x723E8A20,
+    (int32_t)0x398CDD32, (int32_t)0x72552C85, (int32_t)0x395FF2C9, (int32_t)0x726BBD48,
+    (int32_t)0x3932FF87, (int32_t)0x72823C67, (int32_t)0x39060373, (int32_t)0x7298A9DD,
+    (int32_t)0x38D8FE93, (int32_t)0x72AF05A7, (int32_t)0x38ABF0EF, (int32_t)0x72C54FC1,
+    (int32_t)0x387EDA8E, (int32_t)0x72DB8828, (int32_t)0x3851BB77, (int32_t)0x72F1AED9,
+    (int32_t)0x382493B0, (int32_t)0x7307C3D0, (int32_t)0x37F76341, (int32_t)0x731DC70A,
+    (int32_t)0x37CA2A30, (int32_t)0x7333B883, (int32_t)0x379CE885, (int32_t)0x73499838,
+    (int32_t)0x376F9E46, (int32_t)0x735F6626, (int32_t)0x37424B7B, (int32_t)0x73752249,
+    (int32_t)0x3714F02A, (int32_t)0x738ACC9E, (int32_t)0x36E78C5B, (int32_t)0x73A06522,
+    (int32_t)0x36BA2014, (int32_t)0x73B5EBD1, (int32_t)0x368CAB5C, (int32_t)0x73CB60A8,
+    (int32_t)0x365F2E3B, (int32_t)0x73E0C3A3, (int32_t)0x3631A8B8, (int32_t)0x73F614C0,
+    (int32_t)0x36041AD9, (int32_t)0x740B53FB, (int32_t)0x35D684A6, (int32_t)0x74208150,
+    (int32_t)0x35A8E625, (int32_t)0x74359CBD, (int32_t)0x357B3F5D, (int32_t)0x744AA63F,
+    (int32_t)0x354D9057, (int32_t)0x745F9DD1, (int32_t)0x351FD918, (int32_t)0x74748371,
+    (int32_t)0x34F219A8, (int32_t)0x7489571C, (int32_t)0x34C4520D, (int32_t)0x749E18CD,
+    (int32_t)0x34968250, (int32_t)0x74B2C884, (int32_t)0x3468AA76, (int32_t)0x74C7663A,
+    (int32_t)0x343ACA87, (int32_t)0x74DBF1EF, (int32_t)0x340CE28B, (int32_t)0x74F06B9E,
+    (int32_t)0x33DEF287, (int32_t)0x7504D345, (int32_t)0x33B0FA84, (int32_t)0x751928E0,
+    (int32_t)0x3382FA88, (int32_t)0x752D6C6C, (int32_t)0x3354F29B, (int32_t)0x75419DE7,
+    (int32_t)0x3326E2C3, (int32_t)0x7555BD4C, (int32_t)0x32F8CB07, (int32_t)0x7569CA99,
+    (int32_t)0x32CAAB6F, (int32_t)0x757DC5CA, (int32_t)0x329C8402, (int32_t)0x7591AEDD,
+    (int32_t)0x326E54C7, (int32_t)0x75A585CF, (int32_t)0x32401DC6, (int32_t)0x75B94A9C,
+    (int32_t)0x3211DF04, (int32_t)0x75CCFD42, (int32_t)0x31E39889, (int32_t)0x75E09DBD,
+    (int32_t)0x31B54A5E, (int32_t)0x75F42C0B, (int32_t)0x3186F487, (int32_t)0x7607A828,
+    (int32_t)0x3158970E, (int32_t)0x761B1211, (int32_t)0x312A31F8, (int32_t)0x762E69C4,
+    (int32_t)0x30FBC54D, (int32_t)0x7641AF3D, (int32_t)0x30CD5115, (int32_t)0x7654E279,
+    (int32_t)0x309ED556, (int32_t)0x76680376, (int32_t)0x30705217, (int32_t)0x767B1231,
+    (int32_t)0x3041C761, (int32_t)0x768E0EA6, (int32_t)0x30133539, (int32_t)0x76A0F8D2,
+    (int32_t)0x2FE49BA7, (int32_t)0x76B3D0B4, (int32_t)0x2FB5FAB2, (int32_t)0x76C69647,
+    (int32_t)0x2F875262, (int32_t)0x76D94989, (int32_t)0x2F58A2BE, (int32_t)0x76EBEA77,
+    (int32_t)0x2F29EBCC, (int32_t)0x76FE790E, (int32_t)0x2EFB2D95, (int32_t)0x7710F54C,
+    (int32_t)0x2ECC681E, (int32_t)0x77235F2D, (int32_t)0x2E9D9B70, (int32_t)0x7735B6AF,
+    (int32_t)0x2E6EC792, (int32_t)0x7747FBCE, (int32_t)0x2E3FEC8B, (int32_t)0x775A2E89,
+    (int32_t)0x2E110A62, (int32_t)0x776C4EDB, (int32_t)0x2DE2211E, (int32_t)0x777E5CC3,
+    (int32_t)0x2DB330C7, (int32_t)0x7790583E, (int32_t)0x2D843964, (int32_t)0x77A24148,
+    (int32_t)0x2D553AFC, (int32_t)0x77B417DF, (int32_t)0x2D263596, (int32_t)0x77C5DC01,
+    (int32_t)0x2CF72939, (int32_t)0x77D78DAA, (int32_t)0x2CC815EE, (int32_t)0x77E92CD9,
+    (int32_t)0x2C98FBBA, (int32_t)0x77FAB989, (int32_t)0x2C69DAA6, (int32_t)0x780C33B8,
+    (int32_t)0x2C3AB2B9, (int32_t)0x781D9B65, (int32_t)0x2C0B83FA, (int32_t)0x782EF08B,
+    (int32_t)0x2BDC4E6F, (int32_t)0x78403329, (int32_t)0x2BAD1221, (int32_t)0x7851633B,
+    (int32_t)0x2B7DCF17, (int32_t)0x786280BF, (int32_t)0x2B4E8558, (int32_t)0x78738BB3,
+    (int32_t)0x2B1F34EB, (int32_t)0x78848414, (int32_t)0x2AEFDDD8, (int32_t)0x789569DF,
+    (int32_t)0x2AC08026, (int32_t)0x78A63D11, (int32_t)0x2A911BDC, (int32_t)0x78B6FDA8,
+    (int32_t)0x2A61B101, (int32_t)0x78C7ABA2, (int32_t)0x2A323F9E, (int32_t)0x78D846FB,
+    (int32_t)0x2A02C7B8, (int32_t)0x78E8CFB2, (int32_t)0x29D34958, (int32_t)0x78F945C3,
+    (int32_t)0x29A3C485, (int32_t)0x7909A92D, (int32_t)0x29743946, (int32_t)0x7919F9EC,
+    (int32_t)0x2944A7A2, (int32_t)0x792A37FE, (int32_t)0x29150FA1, (int32_t)0x793A6361,
+    (int32_t)0x28E5714B, (int32_t)0x794A7C12, (int32_t)0x28B5CCA5, (int32_t)0x795A820E,
+    (int32_t)0x288621B9, (int32_t)0x796A7554, (int32_t)0x2856708D, (int32_t)0x797A55E0,
+    (int32_t)0x2826B928, (int32_t)0x798A23B1, (int32_t)0x27F6FB92, (int32_t)0x7999DEC4,
+    (int32_t)0x27C737D3, (int32_t)0x79A98715, (int32_t)0x27976DF1, (int32_t)0x79B91CA4,
+    (int32_t)0x27679DF4, (int32_t)0x79C89F6E, (int32_t)0x2737C7E3, (int32_t)0x79D80F6F,
+    (int32_t)0x2707EBC7, (int32_t)0x79E76CA7, (int32_t)0x26D809A5, (int32_t)0x79F6B711,
+    (int32_t)0x26A82186, (int32_t)0x7A05EEAD, (int32_t)0x26783370, (int32_t)0x7A151378,
+    (int32_t)0x26483F6C, (int32_t)0x7A24256F, (int32_t)0x26184581, (int32_t)0x7A332490,
+    (int32_t)0x25E845B6, (int32_t)0x7A4210D8, (int32_t)0x25B84012, (int32_t)0x7A50EA47,
+    (int32_t)0x2588349D, (int32_t)0x7A5FB0D8, (int32_t)0x2558235F, (int32_t)0x7A6E648A,
+    (int32_t)0x25280C5E, (int32_t)0x7A7D055B, (int32_t)0x24F7EFA2, (int32_t)0x7A8B9348,
+    (int32_t)0x24C7CD33, (int32_t)0x7A9A0E50, (int32_t)0x2497A517, (int32_t)0x7AA8766F,
+    (int32_t)0x24677758, (int32_t)0x7AB6CBA4, (int32_t)0x243743FA, (int32_t)0x7AC50DEC,
+    (int32_t)0x24070B08, (int32_t)0x7AD33D45, (int32_t)0x23D6CC87, (int32_t)0x7AE159AE,
+    (int32_t)0x23A6887F, (int32_t)0x7AEF6323, (int32_t)0x23763EF7, (int32_t)0x7AFD59A4,
+    (int32_t)0x2345EFF8, (int32_t)0x7B0B3D2C, (int32_t)0x23159B88, (int32_t)0x7B190DBC,
+    (int32_t)0x22E541AF, (int32_t)0x7B26CB4F, (int32_t)0x22B4E274, (int32_t)0x7B3475E5,
+    (int32_t)0x22847DE0, (int32_t)0x7B420D7A, (int32_t)0x225413F8, (int32_t)0x7B4F920E,
+    (int32_t)0x2223A4C5, (int32_t)0x7B5D039E, (int32_t)0x21F3304F, (int32_t)0x7B6A6227,
+    (int32_t)0x21C2B69C, (int32_t)0x7B77ADA8, (int32_t)0x219237B5, (int32_t)0x7B84E61F,
+    (int32_t)0x2161B3A0, (int32_t)0x7B920B89, (int32_t)0x21312A65, (int32_t)0x7B9F1DE6,
+    (int32_t)0x21009C0C, (int32_t)0x7BAC1D31, (int32_t)0x20D0089C, (int32_t)0x7BB9096B,
+    (int32_t)0x209F701C, (int32_t)0x7BC5E290, (int32_t)0x206ED295, (int32_t)0x7BD2A89E,
+    (int32_t)0x203E300D, (int32_t)0x7BDF5B94, (int32_t)0x200D888D, (int32_t)0x7BEBFB70,
+    (int32_t)0x1FDCDC1B, (int32_t)0x7BF88830, (int32_t)0x1FAC2ABF, (int32_t)0x7C0501D2,
+    (int32_t)0x1F7B7481, (int32_t)0x7C116853, (int32_t)0x1F4AB968, (int32_t)0x7C1DBBB3,
+    (int32_t)0x1F19F97B, (int32_t)0x7C29FBEE, (int32_t)0x1EE934C3, (int32_t)0x7C362904,
+    (int32_t)0x1EB86B46, (int32_t)0x7C4242F2, (int32_t)0x1E879D0D, (int32_t)0x7C4E49B7,
+    (int32_t)0x1E56CA1E, (int32_t)0x7C5A3D50, (int32_t)0x1E25F282, (int32_t)0x7C661DBC,
+    (int32_t)0x1DF5163F, (int32_t)0x7C71EAF9, (int32_t)0x1DC4355E, (int32_t)0x7C7DA505,
+    (int32_t)0x1D934FE5, (int32_t)0x7C894BDE, (int32_t)0x1D6265DD, (int32_t)0x7C94DF83,
+    (int32_t)0x1D31774D, (int32_t)0x7CA05FF1, (int32_t)0x1D00843D, (int32_t)0x7CABCD28,
+    (int32_t)0x1CCF8CB3, (int32_t)0x7CB72724, (int32_t)0x1C9E90B8, (int32_t)0x7CC26DE5,
+    (int32_t)0x1C6D9053, (int32_t)0x7CCDA169, (int32_t)0x1C3C8B8C, (int32_t)0x7CD8C1AE,
+    (int32_t)0x1C0B826A, (int32_t)0x7CE3CEB2, (int32_t)0x1BDA74F6, (int32_t)0x7CEEC873,
+    (int32_t)0x1BA96335, (int32_t)0x7CF9AEF0, (int32_t)0x1B784D30, (int32_t)0x7D048228,
+    (int32_t)0x1B4732EF, (int32_t)0x7D0F4218, (int32_t)0x1B161479, (int32_t)0x7D19EEBF,
+    (int32_t)0x1AE4F1D6, (int32_t)0x7D24881B, (int32_t)0x1AB3CB0D, (int32_t)0x7D2F0E2B,
+    (int32_t)0x1A82A026, (int32_t)0x7D3980EC, (int32_t)0x1A517128, (int32_t)0x7D43E05E,
+    (int32_t)0x1A203E1B, (int32_t)0x7D4E2C7F, (int32_t)0x19EF0707, (int32_t)0x7D58654D,
+    (int32_t)0x19BDCBF3, (int32_t)0x7D628AC6, (int32_t)0x198C8CE7, (int32_t)0x7D6C9CE9,
+    (int32_t)0x195B49EA, (int32_t)0x7D769BB5, (int32_t)0x192A0304, (int32_t)0x7D808728,
+    (int32_t)0x18F8B83C, (int32_t)0x7D8A5F40, (int32_t)0x18C7699B, (int32_t)0x7D9423FC,
+    (int32_t)0x18961728, (int32_t)0x7D9DD55A, (int32_t)0x1864C0EA, (int32_t)0x7DA77359,
+    (int32_t)0x183366E9, (int32_t)0x7DB0FDF8, (int32_t)0x1802092C, (int32_t)0x7DBA7534,
+    (int32_t)0x17D0A7BC, (int32_t)0x7DC3D90D, (int32_t)0x179F429F, (int32_t)0x7DCD2981,
+    (int32_t)0x176DD9DE, (int32_t)0x7DD6668F, (int32_t)0x173C6D80, (int32_t)0x7DDF9034,
+    (int32_t)0x170AFD8D, (int32_t)0x7DE8A670, (int32_t)0x16D98A0C, (int32_t)0x7DF1A942,
+    (int32_t)0x16A81305, (int32_t)0x7DFA98A8, (int32_t)0x1676987F, (int32_t)0x7E0374A0,
+    (int32_t)0x16451A83, (int32_t)0x7E0C3D29, (int32_t)0x16139918, (int32_t)0x7E14F242,
+    (int32_t)0x15E21445, (int32_t)0x7E1D93EA, (int32_t)0x15B08C12, (int32_t)0x7E26221F,
+    (int32_t)0x157F0086, (int32_t)0x7E2E9CDF, (int32_t)0x154D71AA, (int32_t)0x7E37042A,
+    (int32_t)0x151BDF86, (int32_t)0x7E3F57FF, (int32_t)0x14EA4A1F, (int32_t)0x7E47985B,
+    (int32_t)0x14B8B17F, (int32_t)0x7E4FC53E, (int32_t)0x148715AE, (int32_t)0x7E57DEA7,
+    (int32_t)0x145576B1, (int32_t)0x7E5FE493, (int32_t)0x1423D492, (int32_t)0x7E67D703,
+    (int32_t)0x13F22F58, (int32_t)0x7E6FB5F4, (int32_t)0x13C0870A, (int32_t)0x7E778166,
+    (int32_t)0x138EDBB1, (int32_t)0x7E7F3957, (int32_t)0x135D2D53, (int32_t)0x7E86DDC6,
+    (int32_t)0x132B7BF9, (int32_t)0x7E8E6EB2, (int32_t)0x12F9C7AA, (int32_t)0x7E95EC1A,
+    (int32_t)0x12C8106F, (int32_t)0x7E9D55FC, (int32_t)0x1296564D, (int32_t)0x7EA4AC58,
+    (int32_t)0x1264994E, (int32_t)0x7EABEF2C, (int32_t)0x1232D979, (int32_t)0x7EB31E78,
+    (int32_t)0x120116D5, (int32_t)0x7EBA3A39, (int32_t)0x11CF516A, (int32_t)0x7EC14270,
+    (int32_t)0x119D8941, (int32_t)0x7EC8371A, (int32_t)0x116BBE60, (int32_t)0x7ECF1837,
+    (int32_t)0x1139F0CF, (int32_t)0x7ED5E5C6, (int32_t)0x11082096, (int32_t)0x7EDC9FC6,
+    (int32_t)0x10D64DBD, (int32_t)0x7EE34636, (int32_t)0x10A4784B, (int32_t)0x7EE9D914,
+    (int32_t)0x1072A048, (int32_t)0x7EF05860, (int32_t)0x1040C5BB, (int32_t)0x7EF6C418,
+    (int32_t)0x100EE8AD, (int32_t)0x7EFD1C3C, (int32_t)0x0FDD0926, (int32_t)0x7F0360CB,
+    (int32_t)0x0FAB272B, (int32_t)0x7F0991C4, (int32_t)0x0F7942C7, (int32_t)0x7F0FAF25,
+    (int32_t)0x0F475BFF, (int32_t)0x7F15B8EE, (int32_t)0x0F1572DC, (int32_t)0x7F1BAF1E,
+    (int32_t)0x0EE38766, (int32_t)0x7F2191B4, (int32_t)0x0EB199A4, (int32_t)0x7F2760AF,
+    (int32_t)0x0E7FA99E, (int32_t)0x7F2D1C0E, (int32_t)0x0E4DB75B, (int32_t)0x7F32C3D1,
+    (int32_t)0x0E1BC2E4, (int32_t)0x7F3857F6, (int32_t)0x0DE9CC40, (int32_t)0x7F3DD87C,
+    (int32_t)0x0DB7D376, (int32_t)0x7F434563, (int32_t)0x0D85D88F, (int32_t)0x7F489EAA,
+    (int32_t)0x0D53DB92, (int32_t)0x7F4DE451, (int32_t)0x0D21DC87, (int32_t)0x7F531655,
+    (int32_t)0x0CEFDB76, (int32_t)0x7F5834B7, (int32_t)0x0CBDD865, (int32_t)0x7F5D3F75,
+    (int32_t)0x0C8BD35E, (int32_t)0x7F62368F, (int32_t)0x0C59CC68, (int32_t)0x7F671A05,
+    (int32_t)0x0C27C389, (int32_t)0x7F6BE9D4, (int32_t)0x0BF5B8CB, (int32_t)0x7F70A5FE,
+    (int32_t)0x0BC3AC35, (int32_t)0x7F754E80, (int32_t)0x0B919DCF, (int32_t)0x7F79E35A,
+    (int32_t)0x0B5F8D9F, (int32_t)0x7F7E648C, (int32_t)0x0B2D7BAF, (int32_t)0x7F82D214,
+    (int32_t)0x0AFB6805, (int32_t)0x7F872BF3, (int32_t)0x0AC952AA, (int32_t)0x7F8B7227,
+    (int32_t)0x0A973BA5, (int32_t)0x7F8FA4B0, (int32_t)0x0A6522FE, (int32_t)0x7F93C38C,
+    (int32_t)0x0A3308BD, (int32_t)0x7F97CEBD, (int32_t)0x0A00ECE8, (int32_t)0x7F9BC640,
+    (int32_t)0x09CECF89, (int32_t)0x7F9FAA15, (int32_t)0x099CB0A7, (int32_t)0x7FA37A3C,
+    (int32_t)0x096A9049, (int32_t)0x7FA736B4, (int32_t)0x09386E78, (int32_t)0x7FAADF7C,
+    (int32_t)0x09064B3A, (int32_t)0x7FAE7495, (int32_t)0x08D42699, (int32_t)0x7FB1F5FC,
+    (int32_t)0x08A2009A, (int32_t)0x7FB563B3, (int32_t)0x086FD947, (int32_t)0x7FB8BDB8,
+    (int32_t)0x083DB0A7, (int32_t)0x7FBC040A, (int32_t)0x080B86C2, (int32_t)0x7FBF36AA,
+    (int32_t)0x07D95B9E, (int32_t)0x7FC25596, (int32_t)0x07A72F45, (int32_t)0x7FC560CF,
+    (int32_t)0x077501BE, (int32_t)0x7FC85854, (int32_t)0x0742D311, (int32_t)0x7FCB3C23,
+    (int32_t)0x0710A345, (int32_t)0x7FCE0C3E, (int32_t)0x06DE7262, (int32_t)0x7FD0C8A3,
+    (int32_t)0x06AC406F, (int32_t)0x7FD37153, (int32_t)0x067A0D76, (int32_t)0x7FD6064C,
+    (int32_t)0x0647D97C, (int32_t)0x7FD8878E, (int32_t)0x0615A48B, (int32_t)0x7FDAF519,
+    (int32_t)0x05E36EA9, (int32_t)0x7FDD4EEC, (int32_t)0x05B137DF, (int32_t)0x7FDF9508,
+    (int32_t)0x057F0035, (int32_t)0x7FE1C76B, (int32_t)0x054CC7B1, (int32_t)0x7FE3E616,
+    (int32_t)0x051A8E5C, (int32_t)0x7FE5F108, (int32_t)0x04E8543E, (int32_t)0x7FE7E841,
+    (int32_t)0x04B6195D, (int32_t)0x7FE9CBC0, (int32_t)0x0483DDC3, (int32_t)0x7FEB9B85,
+    (int32_t)0x0451A177, (int32_t)0x7FED5791, (int32_t)0x041F6480, (int32_t)0x7FEEFFE1,
+    (int32_t)0x03ED26E6, (int32_t)0x7FF09478, (int32_t)0x03BAE8B2, (int32_t)0x7FF21553,
+    (int32_t)0x0388A9EA, (int32_t)0x7FF38274, (int32_t)0x03566A96, (int32_t)0x7FF4DBD9,
+    (int32_t)0x03242ABF, (int32_t)0x7FF62182, (int32_t)0x02F1EA6C, (int32_t)0x7FF75370,
+    (int32_t)0x02BFA9A4, (int32_t)0x7FF871A2, (int32_t)0x028D6870, (int32_t)0x7FF97C18,
+    (int32_t)0x025B26D7, (int32_t)0x7FFA72D1, (int32_t)0x0228E4E2, (int32_t)0x7FFB55CE,
+    (int32_t)0x01F6A297, (int32_t)0x7FFC250F, (int32_t)0x01C45FFE, (int32_t)0x7FFCE093,
+    (int32_t)0x01921D20, (int32_t)0x7FFD885A, (int32_t)0x015FDA03, (int32_t)0x7FFE1C65,
+    (int32_t)0x012D96B1, (int32_t)0x7FFE9CB2, (int32_t)0x00FB5330, (int32_t)0x7FFF0943,
+    (int32_t)0x00C90F88, (int32_t)0x7FFF6216, (int32_t)0x0096CBC1, (int32_t)0x7FFFA72C,
+    (int32_t)0x006487E3, (int32_t)0x7FFFD886, (int32_t)0x003243F5, (int32_t)0x7FFFF621,
+    (int32_t)0x00000000, (int32_t)0x7FFFFFFF, (int32_t)0xFFCDBC0B, (int32_t)0x7FFFF621,
+    (int32_t)0xFF9B781D, (int32_t)0x7FFFD886, (int32_t)0xFF69343F, (int32_t)0x7FFFA72C,
+    (int32_t)0xFF36F078, (int32_t)0x7FFF6216, (int32_t)0xFF04ACD0, (int32_t)0x7FFF0943,
+    (int32_t)0xFED2694F, (int32_t)0x7FFE9CB2, (int32_t)0xFEA025FD, (int32_t)0x7FFE1C65,
+    (int32_t)0xFE6DE2E0, (int32_t)0x7FFD885A, (int32_t)0xFE3BA002, (int32_t)0x7FFCE093,
+    (int32_t)0xFE095D69, (int32_t)0x7FFC250F, (int32_t)0xFDD71B1E, (int32_t)0x7FFB55CE,
+    (int32_t)0xFDA4D929, (int32_t)0x7FFA72D1, (int32_t)0xFD729790, (int32_t)0x7FF97C18,
+    (int32_t)0xFD40565C, (int32_t)0x7FF871A2, (int32_t)0xFD0E1594, (int32_t)0x7FF75370,
+    (int32_t)0xFCDBD541, (int32_t)0x7FF62182, (int32_t)0xFCA9956A, (int32_t)0x7FF4DBD9,
+    (int32_t)0xFC775616, (int32_t)0x7FF38274, (int32_t)0xFC45174E, (int32_t)0x7FF21553,
+    (int32_t)0xFC12D91A, (int32_t)0x7FF09478, (int32_t)0xFBE09B80, (int32_t)0x7FEEFFE1,
+    (int32_t)0xFBAE5E89, (int32_t)0x7FED5791, (int32_t)0xFB7C223D, (int32_t)0x7FEB9B85,
+    (int32_t)0xFB49E6A3, (int32_t)0x7FE9CBC0, (int32_t)0xFB17ABC2, (int32_t)0x7FE7E841,
+    (int32_t)0xFAE571A4, (int32_t)0x7FE5F108, (int32_t)0xFAB3384F, (int32_t)0x7FE3E616,
+    (int32_t)0xFA80FFCB, (int32_t)0x7FE1C76B, (int32_t)0xFA4EC821, (int32_t)0x7FDF9508,
+    (int32_t)0xFA1C9157, (int32_t)0x7FDD4EEC, (int32_t)0xF9EA5B75, (int32_t)0x7FDAF519,
+    (int32_t)0xF9B82684, (int32_t)0x7FD8878E, (int32_t)0xF985F28A, (int32_t)0x7FD6064C,
+    (int32_t)0xF953BF91, (int32_t)0x7FD37153, (int32_t)0xF9218D9E, (int32_t)0x7FD0C8A3,
+    (int32_t)0xF8EF5CBB, (int32_t)0x7FCE0C3E, (int32_t)0xF8BD2CEF, (int32_t)0x7FCB3C23,
+    (int32_t)0xF88AFE42, (int32_t)0x7FC85854, (int32_t)0xF858D0BB, (int32_t)0x7FC560CF,
+    (int32_t)0xF826A462, (int32_t)0x7FC25596, (int32_t)0xF7F4793E, (int32_t)0x7FBF36AA,
+    (int32_t)0xF7C24F59, (int32_t)0x7FBC040A, (int32_t)0xF79026B9, (int32_t)0x7FB8BDB8,
+    (int32_t)0xF75DFF66, (int32_t)0x7FB563B3, (int32_t)0xF72BD967, (int32_t)0x7FB1F5FC,
+    (int32_t)0xF6F9B4C6, (int32_t)0x7FAE7495, (int32_t)0xF6C79188, (int32_t)0x7FAADF7C,
+    (int32_t)0xF6956FB7, (int32_t)0x7FA736B4, (int32_t)0xF6634F59, (int32_t)0x7FA37A3C,
+    (int32_t)0xF6313077, (int32_t)0x7F9FAA15, (int32_t)0xF5FF1318, (int32_t)0x7F9BC640,
+    (int32_t)0xF5CCF743, (int32_t)0x7F97CEBD, (int32_t)0xF59ADD02, (int32_t)0x7F93C38C,
+    (int32_t)0xF568C45B, (int32_t)0x7F8FA4B0, (int32_t)0xF536AD56, (int32_t)0x7F8B7227,
+    (int32_t)0xF50497FB, (int32_t)0x7F872BF3, (int32_t)0xF4D28451, (int32_t)0x7F82D214,
+    (int32_t)0xF4A07261, (int32_t)0x7F7E648C, (int32_t)0xF46E6231, (int32_t)0x7F79E35A,
+    (int32_t)0xF43C53CB, (int32_t)0x7F754E80, (int32_t)0xF40A4735, (int32_t)0x7F70A5FE,
+    (int32_t)0xF3D83C77, (int32_t)0x7F6BE9D4, (int32_t)0xF3A63398, (int32_t)0x7F671A05,
+    (int32_t)0xF3742CA2, (int32_t)0x7F62368F, (int32_t)0xF342279B, (int32_t)0x7F5D3F75,
+    (int32_t)0xF310248A, (int32_t)0x7F5834B7, (int32_t)0xF2DE2379, (int32_t)0x7F531655,
+    (int32_t)0xF2AC246E, (int32_t)0x7F4DE451, (int32_t)0xF27A2771, (int32_t)0x7F489EAA,
+    (int32_t)0xF2482C8A, (int32_t)0x7F434563, (int32_t)0xF21633C0, (int32_t)0x7F3DD87C,
+    (int32_t)0xF1E43D1C, (int32_t)0x7F3857F6, (int32_t)0xF1B248A5, (int32_t)0x7F32C3D1,
+    (int32_t)0xF1805662, (int32_t)0x7F2D1C0E, (int32_t)0xF14E665C, (int32_t)0x7F2760AF,
+    (int32_t)0xF11C789A, (int32_t)0x7F2191B4, (int32_t)0xF0EA8D24, (int32_t)0x7F1BAF1E,
+    (int32_t)0xF0B8A401, (int32_t)0x7F15B8EE, (int32_t)0xF086BD39, (int32_t)0x7F0FAF25,
+    (int32_t)0xF054D8D5, (int32_t)0x7F0991C4, (int32_t)0xF022F6DA, (int32_t)0x7F0360CB,
+    (int32_t)0xEFF11753, (int32_t)0x7EFD1C3C, (int32_t)0xEFBF3A45, (int32_t)0x7EF6C418,
+    (int32_t)0xEF8D5FB8, (int32_t)0x7EF05860, (int32_t)0xEF5B87B5, (int32_t)0x7EE9D914,
+    (int32_t)0xEF29B243, (int32_t)0x7EE34636, (int32_t)0xEEF7DF6A, (int32_t)0x7EDC9FC6,
+    (int32_t)0xEEC60F31, (int32_t)0x7ED5E5C6, (int32_t)0xEE9441A0, (int32_t)0x7ECF1837,
+    (int32_t)0xEE6276BF, (int32_t)0x7EC8371A, (int32_t)0xEE30AE96, (int32_t)0x7EC14270,
+    (int32_t)0xEDFEE92B, (int32_t)0x7EBA3A39, (int32_t)0xEDCD2687, (int32_t)0x7EB31E78,
+    (int32_t)0xED9B66B2, (int32_t)0x7EABEF2C, (int32_t)0xED69A9B3, (int32_t)0x7EA4AC58,
+    (int32_t)0xED37EF91, (int32_t)0x7E9D55FC, (int32_t)0xED063856, (int32_t)0x7E95EC1A,
+    (int32_t)0xECD48407, (int32_t)0x7E8E6EB2, (int32_t)0xECA2D2AD, (int32_t)0x7E86DDC6,
+    (int32_t)0xEC71244F, (int32_t)0x7E7F3957, (int32_t)0xEC3F78F6, (int32_t)0x7E778166,
+    (int32_t)0xEC0DD0A8, (int32_t)0x7E6FB5F4, (int32_t)0xEBDC2B6E, (int32_t)0x7E67D703,
+    (int32_t)0xEBAA894F, (int32_t)0x7E5FE493, (int32_t)0xEB78EA52, (int32_t)0x7E57DEA7,
+    (int32_t)0xEB474E81, (int32_t)0x7E4FC53E, (int32_t)0xEB15B5E1, (int32_t)0x7E47985B,
+    (int32_t)0xEAE4207A, (int32_t)0x7E3F57FF, (int32_t)0xEAB28E56, (int32_t)0x7E37042A,
+    (int32_t)0xEA80FF7A, (int32_t)0x7E2E9CDF, (int32_t)0xEA4F73EE, (int32_t)0x7E26221F,
+    (int32_t)0xEA1DEBBB, (int32_t)0x7E1D93EA, (int32_t)0xE9EC66E8, (int32_t)0x7E14F242,
+    (int32_t)0xE9BAE57D, (int32_t)0x7E0C3D29, (int32_t)0xE9896781, (int32_t)0x7E0374A0,
+    (int32_t)0xE957ECFB, (int32_t)0x7DFA98A8, (int32_t)0xE92675F4, (int32_t)0x7DF1A942,
+    (int32_t)0xE8F50273, (int32_t)0x7DE8A670, (int32_t)0xE8C39280, (int32_t)0x7DDF9034,
+    (int32_t)0xE8922622, (int32_t)0x7DD6668F, (int32_t)0xE860BD61, (int32_t)0x7DCD2981,
+    (int32_t)0xE82F5844, (int32_t)0x7DC3D90D, (int32_t)0xE7FDF6D4, (int32_t)0x7DBA7534,
+    (int32_t)0xE7CC9917, (int32_t)0x7DB0FDF8, (int32_t)0xE79B3F16, (int32_t)0x7DA77359,
+    (int32_t)0xE769E8D8, (int32_t)0x7D9DD55A, (int32_t)0xE7389665, (int32_t)0x7D9423FC,
+    (int32_t)0xE70747C4, (int32_t)0x7D8A5F40, (int32_t)0xE6D5FCFC, (int32_t)0x7D808728,
+    (int32_t)0xE6A4B616, (int32_t)0x7D769BB5, (int32_t)0xE6737319, (int32_t)0x7D6C9CE9,
+    (int32_t)0xE642340D, (int32_t)0x7D628AC6, (int32_t)0xE610F8F9, (int32_t)0x7D58654D,
+    (int32_t)0xE5DFC1E5, (int32_t)0x7D4E2C7F, (int32_t)0xE5AE8ED8, (int32_t)0x7D43E05E,
+    (int32_t)0xE57D5FDA, (int32_t)0x7D3980EC, (int32_t)0xE54C34F3, (int32_t)0x7D2F0E2B,
+    (int32_t)0xE51B0E2A, (int32_t)0x7D24881B, (int32_t)0xE4E9EB87, (int32_t)0x7D19EEBF,
+    (int32_t)0xE4B8CD11, (int32_t)0x7D0F4218, (int32_t)0xE487B2D0, (int32_t)0x7D048228,
+    (int32_t)0xE4569CCB, (int32_t)0x7CF9AEF0, (int32_t)0xE4258B0A, (int32_t)0x7CEEC873,
+    (int32_t)0xE3F47D96, (int32_t)0x7CE3CEB2, (int32_t)0xE3C37474, (int32_t)0x7CD8C1AE,
+    (int32_t)0xE3926FAD, (int32_t)0x7CCDA169, (int32_t)0xE3616F48, (int32_t)0x7CC26DE5,
+    (int32_t)0xE330734D, (int32_t)0x7CB72724, (int32_t)0xE2FF7BC3, (int32_t)0x7CABCD28,
+    (int32_t)0xE2CE88B3, (int32_t)0x7CA05FF1, (int32_t)0xE29D9A23, (int32_t)0x7C94DF83,
+    (int32_t)0xE26CB01B, (int32_t)0x7C894BDE, (int32_t)0xE23BCAA2, (int32_t)0x7C7DA505,
+    (int32_t)0xE20AE9C1, (int32_t)0x7C71EAF9, (int32_t)0xE1DA0D7E, (int32_t)0x7C661DBC,
+    (int32_t)0xE1A935E2, (int32_t)0x7C5A3D50, (int32_t)0xE17862F3, (int32_t)0x7C4E49B7,
+    (int32_t)0xE14794BA, (int32_t)0x7C4242F2, (int32_t)0xE116CB3D, (int32_t)0x7C362904,
+    (int32_t)0xE0E60685, (int32_t)0x7C29FBEE, (int32_t)0xE0B54698, (int32_t)0x7C1DBBB3,
+    (int32_t)0xE0848B7F, (int32_t)0x7C116853, (int32_t)0xE053D541, (int32_t)0x7C0501D2,
+    (int32_t)0xE02323E5, (int32_t)0x7BF88830, (int32_t)0xDFF27773, (int32_t)0x7BEBFB70,
+    (int32_t)0xDFC1CFF3, (int32_t)0x7BDF5B94, (int32_t)0xDF912D6B, (int32_t)0x7BD2A89E,
+    (int32_t)0xDF608FE4, (int32_t)0x7BC5E290, (int32_t)0xDF2FF764, (int32_t)0x7BB9096B,
+    (int32_t)0xDEFF63F4, (int32_t)0x7BAC1D31, (int32_t)0xDECED59B, (int32_t)0x7B9F1DE6,
+    (int32_t)0xDE9E4C60, (int32_t)0x7B920B89, (int32_t)0xDE6DC84B, (int32_t)0x7B84E61F,
+    (int32_t)0xDE3D4964, (int32_t)0x7B77ADA8, (int32_t)0xDE0CCFB1, (int32_t)0x7B6A6227,
+    (int32_t)0xDDDC5B3B, (int32_t)0x7B5D039E, (int32_t)0xDDABEC08, (int32_t)0x7B4F920E,
+    (int32_t)0xDD7B8220, (int32_t)0x7B420D7A, (int32_t)0xDD4B1D8C, (int32_t)0x7B3475E5,
+    (int32_t)0xDD1ABE51, (int32_t)0x7B26CB4F, (int32_t)0xDCEA6478, (int32_t)0x7B190DBC,
+    (int32_t)0xDCBA1008, (int32_t)0x7B0B3D2C, (int32_t)0xDC89C109, (int32_t)0x7AFD59A4,
+    (int32_t)0xDC597781, (int32_t)0x7AEF6323, (int32_t)0xDC293379, (int32_t)0x7AE159AE,
+    (int32_t)0xDBF8F4F8, (int32_t)0x7AD33D45, (int32_t)0xDBC8BC06, (int32_t)0x7AC50DEC,
+    (int32_t)0xDB9888A8, (int32_t)0x7AB6CBA4, (int32_t)0xDB685AE9, (int32_t)0x7AA8766F,
+    (int32_t)0xDB3832CD, (int32_t)0x7A9A0E50, (int32_t)0xDB08105E, (int32_t)0x7A8B9348,
+    (int32_t)0xDAD7F3A2, (int32_t)0x7A7D055B, (int32_t)0xDAA7DCA1, (int32_t)0x7A6E648A,
+    (int32_t)0xDA77CB63, (int32_t)0x7A5FB0D8, (int32_t)0xDA47BFEE, (int32_t)0x7A50EA47,
+    (int32_t)0xDA17BA4A, (int32_t)0x7A4210D8, (int32_t)0xD9E7BA7F, (int32_t)0x7A332490,
+    (int32_t)0xD9B7C094, (int32_t)0x7A24256F, (int32_t)0xD987CC90, (int32_t)0x7A151378,
+    (int32_t)0xD957DE7A, (int32_t)0x7A05EEAD, (int32_t)0xD927F65B, (int32_t)0x79F6B711,
+    (int32_t)0xD8F81439, (int32_t)0x79E76CA7, (int32_t)0xD8C8381D, (int32_t)0x79D80F6F,
+    (int32_t)0xD898620C, (int32_t)0x79C89F6E, (int32_t)0xD868920F, (int32_t)0x79B91CA4,
+    (int32_t)0xD838C82D, (int32_t)0x79A98715, (int32_t)0xD809046E, (int32_t)0x7999DEC4,
+    (int32_t)0xD7D946D8, (int32_t)0x798A23B1, (int32_t)0xD7A98F73, (int32_t)0x797A55E0,
+    (int32_t)0xD779DE47, (int32_t)0x796A7554, (int32_t)0xD74A335B, (int32_t)0x795A820E,
+    (int32_t)0xD71A8EB5, (int32_t)0x794A7C12, (int32_t)0xD6EAF05F, (int32_t)0x793A6361,
+    (int32_t)0xD6BB585E, (int32_t)0x792A37FE, (int32_t)0xD68BC6BA, (int32_t)0x7919F9EC,
+    (int32_t)0xD65C3B7B, (int32_t)0x7909A92D, (int32_t)0xD62CB6A8, (int32_t)0x78F945C3,
+    (int32_t)0xD5FD3848, (int32_t)0x78E8CFB2, (int32_t)0xD5CDC062, (int32_t)0x78D846FB,
+    (int32_t)0xD59E4EFF, (int32_t)0x78C7ABA2, (int32_t)0xD56EE424, (int32_t)0x78B6FDA8,
+    (int32_t)0xD53F7FDA, (int32_t)0x78A63D11, (int32_t)0xD5102228, (int32_t)0x789569DF,
+    (int32_t)0xD4E0CB15, (int32_t)0x78848414, (int32_t)0xD4B17AA8, (int32_t)0x78738BB3,
+    (int32_t)0xD48230E9, (int32_t)0x786280BF, (int32_t)0xD452EDDF, (int32_t)0x7851633B,
+    (int32_t)0xD423B191, (int32_t)0x78403329, (int32_t)0xD3F47C06, (int32_t)0x782EF08B,
+    (int32_t)0xD3C54D47, (int32_t)0x781D9B65, (int32_t)0xD396255A, (int32_t)0x780C33B8,
+    (int32_t)0xD3670446, (int32_t)0x77FAB989, (int32_t)0xD337EA12, (int32_t)0x77E92CD9,
+    (int32_t)0xD308D6C7, (int32_t)0x77D78DAA, (int32_t)0xD2D9CA6A, (int32_t)0x77C5DC01,
+    (int32_t)0xD2AAC504, (int32_t)0x77B417DF, (int32_t)0xD27BC69C, (int32_t)0x77A24148,
+    (int32_t)0xD24CCF39, (int32_t)0x7790583E, (int32_t)0xD21DDEE2, (int32_t)0x777E5CC3,
+    (int32_t)0xD1EEF59E, (int32_t)0x776C4EDB, (int32_t)0xD1C01375, (int32_t)0x775A2E89,
+    (int32_t)0xD191386E, (int32_t)0x7747FBCE, (int32_t)0xD1626490, (int32_t)0x7735B6AF,
+    (int32_t)0xD13397E2, (int32_t)0x77235F2D, (int32_t)0xD104D26B, (int32_t)0x7710F54C,
+    (int32_t)0xD0D61434, (int32_t)0x76FE790E, (int32_t)0xD0A75D42, (int32_t)0x76EBEA77,
+    (int32_t)0xD078AD9E, (int32_t)0x76D94989, (int32_t)0xD04A054E, (int32_t)0x76C69647,
+    (int32_t)0xD01B6459, (int32_t)0x76B3D0B4, (int32_t)0xCFECCAC7, (int32_t)0x76A0F8D2,
+    (int32_t)0xCFBE389F, (int32_t)0x768E0EA6, (int32_t)0xCF8FADE9, (int32_t)0x767B1231,
+    (int32_t)0xCF612AAA, (int32_t)0x76680376, (int32_t)0xCF32AEEB, (int32_t)0x7654E279,
+    (int32_t)0xCF043AB3, (int32_t)0x7641AF3D, (int32_t)0xCED5CE08, (int32_t)0x762E69C4,
+    (int32_t)0xCEA768F2, (int32_t)0x761B1211, (int32_t)0xCE790B79, (int32_t)0x7607A828,
+    (int32_t)0xCE4AB5A2, (int32_t)0x75F42C0B, (int32_t)0xCE1C6777, (int32_t)0x75E09DBD,
+    (int32_t)0xCDEE20FC, (int32_t)0x75CCFD42, (int32_t)0xCDBFE23A, (int32_t)0x75B94A9C,
+    (int32_t)0xCD91AB39, (int32_t)0x75A585CF, (int32_t)0xCD637BFE, (int32_t)0x7591AEDD,
+    (int32_t)0xCD355491, (int32_t)0x757DC5CA, (int32_t)0xCD0734F9, (int32_t)0x7569CA99,
+    (int32_t)0xCCD91D3D, (int32_t)0x7555BD4C, (int32_t)0xCCAB0D65, (int32_t)0x75419DE7,
+    (int32_t)0xCC7D0578, (int32_t)0x752D6C6C, (int32_t)0xCC4F057C, (int32_t)0x751928E0,
+    (int32_t)0xCC210D79, (int32_t)0x7504D345, (int32_t)0xCBF31D75, (int32_t)0x74F06B9E,
+    (int32_t)0xCBC53579, (int32_t)0x74DBF1EF, (int32_t)0xCB97558A, (int32_t)0x74C7663A,
+    (int32_t)0xCB697DB0, (int32_t)0x74B2C884, (int32_t)0xCB3BADF3, (int32_t)0x749E18CD,
+    (int32_t)0xCB0DE658, (int32_t)0x7489571C, (int32_t)0xCAE026E8, (int32_t)0x74748371,
+    (int32_t)0xCAB26FA9, (int32_t)0x745F9DD1, (int32_t)0xCA84C0A3, (int32_t)0x744AA63F,
+    (int32_t)0xCA5719DB, (int32_t)0x74359CBD, (int32_t)0xCA297B5A, (int32_t)0x74208150,
+    (int32_t)0xC9FBE527, (int32_t)0x740B53FB, (int32_t)0xC9CE5748, (int32_t)0x73F614C0,
+    (int32_t)0xC9A0D1C5, (int32_t)0x73E0C3A3, (int32_t)0xC97354A4, (int32_t)0x73CB60A8,
+    (int32_t)0xC945DFEC, (int32_t)0x73B5EBD1, (int32_t)0xC91873A5, (int32_t)0x73A06522,
+    (int32_t)0xC8EB0FD6, (int32_t)0x738ACC9E, (int32_t)0xC8BDB485, (int32_t)0x73752249,
+    (int32_t)0xC89061BA, (int32_t)0x735F6626, (int32_t)0xC863177B, (int32_t)0x73499838,
+    (int32_t)0xC835D5D0, (int32_t)0x7333B883, (int32_t)0xC8089CBF, (int32_t)0x731DC70A,
+    (int32_t)0xC7DB6C50, (int32_t)0x7307C3D0, (int32_t)0xC7AE4489, (int32_t)0x72F1AED9,
+    (int32_t)0xC7812572, (int32_t)0x72DB8828, (int32_t)0xC7540F11, (int32_t)0x72C54FC1,
+    (int32_t)0xC727016D, (int32_t)0x72AF05A7, (int32_t)0xC6F9FC8D, (int32_t)0x7298A9DD,
+    (int32_t)0xC6CD0079, (int32_t)0x72823C67, (int32_t)0xC6A00D37, (int32_t)0x726BBD48,
+    (int32_t)0xC67322CE, (int32_t)0x72552C85, (int32_t)0xC6464144, (int32_t)0x723E8A20,
+    (int32_t)0xC61968A2, (int32_t)0x7227D61C, (int32_t)0xC5EC98EE, (int32_t)0x7211107E,
+    (int32_t)0xC5BFD22E, (int32_t)0x71FA3949, (int32_t)0xC593146A, (int32_t)0x71E35080,
+    (int32_t)0xC5665FA9, (int32_t)0x71CC5626, (int32_t)0xC539B3F1, (int32_t)0x71B54A41,
+    (int32_t)0xC50D1149, (int32_t)0x719E2CD2, (int32_t)0xC4E077B8, (int32_t)0x7186FDDE,
+    (int32_t)0xC4B3E746, (int32_t)0x716FBD68, (int32_t)0xC4875FF9, (int32_t)0x71586B74,
+    (int32_t)0xC45AE1D7, (int32_t)0x71410805, (int32_t)0xC42E6CE8, (int32_t)0x7129931F,
+    (int32_t)0xC4020133, (int32_t)0x71120CC5, (int32_t)0xC3D59EBE, (int32_t)0x70FA74FC,
+    (int32_t)0xC3A94590, (int32_t)0x70E2CBC6, (int32_t)0xC37CF5B0, (int32_t)0x70CB1128,
+    (int32_t)0xC350AF26, (int32_t)0x70B34525, (int32_t)0xC32471F7, (int32_t)0x709B67C0,
+    (int32_t)0xC2F83E2A, (int32_t)0x708378FF, (int32_t)0xC2CC13C7, (int32_t)0x706B78E3,
+    (int32_t)0xC29FF2D4, (int32_t)0x70536771, (int32_t)0xC273DB58, (int32_t)0x703B44AD,
+    (int32_t)0xC247CD5A, (int32_t)0x7023109A, (int32_t)0xC21BC8E1, (int32_t)0x700ACB3C,
+    (int32_t)0xC1EFCDF3, (int32_t)0x6FF27497, (int32_t)0xC1C3DC97, (int32_t)0x6FDA0CAE,
+    (int32_t)0xC197F4D4, (int32_t)0x6FC19385, (int32_t)0xC16C16B0, (int32_t)0x6FA90921,
+    (int32_t)0xC1404233, (int32_t)0x6F906D84, (int32_t)0xC1147764, (int32_t)0x6F77C0B3,
+    (int32_t)0xC0E8B648, (int32_t)0x6F5F02B2, (int32_t)0xC0BCFEE7, (int32_t)0x6F463383,
+    (int32_t)0xC0915148, (int32_t)0x6F2D532C, (int32_t)0xC065AD70, (int32_t)0x6F1461B0,
+    (int32_t)0xC03A1368, (int32_t)0x6EFB5F12, (int32_t)0xC00E8336, (int32_t)0x6EE24B57,
+    (int32_t)0xBFE2FCDF, (int32_t)0x6EC92683, (int32_t)0xBFB7806C, (int32_t)0x6EAFF099,
+    (int32_t)0xBF8C0DE3, (int32_t)0x6E96A99D, (int32_t)0xBF60A54A, (int32_t)0x6E7D5193,
+    (int32_t)0xBF3546A8, (int32_t)0x6E63E87F, (int32_t)0xBF09F205, (int32_t)0x6E4A6E66,
+    (int32_t)0xBEDEA765, (int32_t)0x6E30E34A, (int32_t)0xBEB366D1, (int32_t)0x6E174730,
+    (int32_t)0xBE88304F, (int32_t)0x6DFD9A1C, (int32_t)0xBE5D03E6, (int32_t)0x6DE3DC11,
+    (int32_t)0xBE31E19B, (int32_t)0x6DCA0D14, (int32_t)0xBE06C977, (int32_t)0x6DB02D29,
+    (int32_t)0xBDDBBB7F, (int32_t)0x6D963C54, (int32_t)0xBDB0B7BB, (int32_t)0x6D7C3A98,
+    (int32_t)0xBD85BE30, (int32_t)0x6D6227FA, (int32_t)0xBD5ACEE5, (int32_t)0x6D48047E,
+    (int32_t)0xBD2FE9E2, (int32_t)0x6D2DD027, (int32_t)0xBD050F2C, (int32_t)0x6D138AFB,
+    (int32_t)0xBCDA3ECB, (int32_t)0x6CF934FC, (int32_t)0xBCAF78C4, (int32_t)0x6CDECE2F,
+    (int32_t)0xBC84BD1F, (int32_t)0x6CC45698, (int32_t)0xBC5A0BE2, (int32_t)0x6CA9CE3B,
+    (int32_t)0xBC2F6513, (int32_t)0x6C8F351C, (int32_t)0xBC04C8BA, (int32_t)0x6C748B3F,
+    (int32_t)0xBBDA36DD, (int32_t)0x6C59D0A9, (int32_t)0xBBAFAF82, (int32_t)0x6C3F055D,
+    (int32_t)0xBB8532B0, (int32_t)0x6C242960, (int32_t)0xBB5AC06D, (int32_t)0x6C093CB6,
+    (int32_t)0xBB3058C0, (int32_t)0x6BEE3F62, (int32_t)0xBB05FBB0, (int32_t)0x6BD3316A,
+    (int32_t)0xBADBA943, (int32_t)0x6BB812D1, (int32_t)0xBAB16180, (int32_t)0x6B9CE39B,
+    (int32_t)0xBA87246D, (int32_t)0x6B81A3CD, (int32_t)0xBA5CF210, (int32_t)0x6B66536B,
+    (int32_t)0xBA32CA71, (int32_t)0x6B4AF279, (int32_t)0xBA08AD95, (int32_t)0x6B2F80FB,
+    (int32_t)0xB9DE9B83, (int32_t)0x6B13FEF5, (int32_t)0xB9B49442, (int32_t)0x6AF86C6C,
+    (int32_t)0xB98A97D8, (int32_t)0x6ADCC964, (int32_t)0xB960A64C, (int32_t)0x6AC115E2,
+    (int32_t)0xB936BFA4, (int32_t)0x6AA551E9, (int32_t)0xB90CE3E6, (int32_t)0x6A897D7D,
+    (int32_t)0xB8E31319, (int32_t)0x6A6D98A4, (int32_t)0xB8B94D44, (int32_t)0x6A51A361,
+    (int32_t)0xB88F926D, (int32_t)0x6A359DB9, (int32_t)0xB865E299, (int32_t)0x6A1987B0,
+    (int32_t)0xB83C3DD1, (int32_t)0x69FD614A, (int32_t)0xB812A41A, (int32_t)0x69E12A8C,
+    (int32_t)0xB7E9157A, (int32_t)0x69C4E37A, (int32_t)0xB7BF91F8, (int32_t)0x69A88C19,
+    (int32_t)0xB796199B, (int32_t)0x698C246C, (int32_t)0xB76CAC69, (int32_t)0x696FAC78,
+    (int32_t)0xB7434A67, (int32_t)0x69532442, (int32_t)0xB719F39E, (int32_t)0x69368BCE,
+    (int32_t)0xB6F0A812, (int32_t)0x6919E320, (int32_t)0xB6C767CA, (int32_t)0x68FD2A3D,
+    (int32_t)0xB69E32CD, (int32_t)0x68E06129, (int32_t)0xB6750921, (int32_t)0x68C387E9,
+    (int32_t)0xB64BEACD, (int32_t)0x68A69E81, (int32_t)0xB622D7D6, (int32_t)0x6889A4F6,
+    (int32_t)0xB5F9D043, (int32_t)0x686C9B4B, (int32_t)0xB5D0D41A, (int32_t)0x684F8186,
+    (int32_t)0xB5A7E362, (int32_t)0x683257AB, (int32_t)0xB57EFE22, (int32_t)0x68151DBE,
+    (int32_t)0xB556245E, (int32_t)0x67F7D3C5, (int32_t)0xB52D561E, (int32_t)0x67DA79C3,
+    (int32_t)0xB5049368, (int32_t)0x67BD0FBD, (int32_t)0xB4DBDC42, (int32_t)0x679F95B7,
+    (int32_t)0xB4B330B3, (int32_t)0x67820BB7, (int32_t)0xB48A90C0, (int32_t)0x676471C0,
+    (int32_t)0xB461FC70, (int32_t)0x6746C7D8, (int32_t)0xB43973CA, (int32_t)0x67290E02,
+    (int32_t)0xB410F6D3, (int32_t)0x670B4444, (int32_t)0xB3E88592, (int32_t)0x66ED6AA1,
+    (int32_t)0xB3C0200C, (int32_t)0x66CF8120, (int32_t)0xB397C649, (int32_t)0x66B187C3,
+    (int32_t)0xB36F784F, (int32_t)0x66937E91, (int32_t)0xB3473623, (int32_t)0x6675658C,
+    (int32_t)0xB31EFFCC, (int32_t)0x66573CBB, (int32_t)0xB2F6D550, (int32_t)0x66390422,
+    (int32_t)0xB2CEB6B5, (int32_t)0x661ABBC5, (int32_t)0xB2A6A402, (int32_t)0x65FC63A9,
+    (int32_t)0xB27E9D3C, (int32_t)0x65DDFBD3, (int32_t)0xB256A26A, (int32_t)0x65BF8447,
+    (int32_t)0xB22EB392, (int32_t)0x65A0FD0B, (int32_t)0xB206D0BA, (int32_t)0x65826622,
+    (int32_t)0xB1DEF9E9, (int32_t)0x6563BF92, (int32_t)0xB1B72F23, (int32_t)0x6545095F,
+    (int32_t)0xB18F7071, (int32_t)0x6526438F, (int32_t)0xB167BDD7, (int32_t)0x65076E25,
+    (int32_t)0xB140175B, (int32_t)0x64E88926, (int32_t)0xB1187D05, (int32_t)0x64C99498,
+    (int32_t)0xB0F0EEDA, (int32_t)0x64AA907F, (int32_t)0xB0C96CE0, (int32_t)0x648B7CE0,
+    (int32_t)0xB0A1F71D, (int32_t)0x646C59BF, (int32_t)0xB07A8D97, (int32_t)0x644D2722,
+    (int32_t)0xB0533055, (int32_t)0x642DE50D, (int32_t)0xB02BDF5C, (int32_t)0x640E9386,
+    (int32_t)0xB0049AB3, (int32_t)0x63EF3290, (int32_t)0xAFDD625F, (int32_t)0x63CFC231,
+    (int32_t)0xAFB63667, (int32_t)0x63B0426D, (int32_t)0xAF8F16D1, (int32_t)0x6390B34A,
+    (int32_t)0xAF6803A2, (int32_t)0x637114CC, (int32_t)0xAF40FCE1, (int32_t)0x635166F9,
+    (int32_t)0xAF1A0293, (int32_t)0x6331A9D4, (int32_t)0xAEF314C0, (int32_t)0x6311DD64,
+    (int32_t)0xAECC336C, (int32_t)0x62F201AC, (int32_t)0xAEA55E9E, (int32_t)0x62D216B3,
+    (int32_t)0xAE7E965B, (int32_t)0x62B21C7B, (int32_t)0xAE57DAAB, (int32_t)0x6292130C,
+    (int32_t)0xAE312B92, (int32_t)0x6271FA69, (int32_t)0xAE0A8916, (int32_t)0x6251D298,
+    (int32_t)0xADE3F33E, (int32_t)0x62319B9D, (int32_t)0xADBD6A10, (int32_t)0x6211557E,
+    (int32_t)0xAD96ED92, (int32_t)0x61F1003F, (int32_t)0xAD707DC8, (int32_t)0x61D09BE5,
+    (int32_t)0xAD4A1ABA, (int32_t)0x61B02876, (int32_t)0xAD23C46E, (int32_t)0x618FA5F7,
+    (int32_t)0xACFD7AE8, (int32_t)0x616F146C, (int32_t)0xACD73E30, (int32_t)0x614E73DA,
+    (int32_t)0xACB10E4B, (int32_t)0x612DC447, (int32_t)0xAC8AEB3E, (int32_t)0x610D05B7,
+    (int32_t)0xAC64D510, (int32_t)0x60EC3830, (int32_t)0xAC3ECBC7, (int32_t)0x60CB5BB7,
+    (int32_t)0xAC18CF69, (int32_t)0x60AA7050, (int32_t)0xABF2DFFB, (int32_t)0x60897601,
+    (int32_t)0xABCCFD83, (int32_t)0x60686CCF, (int32_t)0xABA72807, (int32_t)0x604754BF,
+    (int32_t)0xAB815F8D, (int32_t)0x60262DD6, (int32_t)0xAB5BA41A, (int32_t)0x6004F819,
+    (int32_t)0xAB35F5B5, (int32_t)0x5FE3B38D, (int32_t)0xAB105464, (int32_t)0x5FC26038,
+    (int32_t)0xAAEAC02C, (int32_t)0x5FA0FE1F, (int32_t)0xAAC53912, (int32_t)0x5F7F8D46,
+    (int32_t)0xAA9FBF1E, (int32_t)0x5F5E0DB3, (int32_t)0xAA7A5253, (int32_t)0x5F3C7F6B,
+    (int32_t)0xAA54F2BA, (int32_t)0x5F1AE274, (int32_t)0xAA2FA056, (int32_t)0x5EF936D1,
+    (int32_t)0xAA0A5B2E, (int32_t)0x5ED77C8A, (int32_t)0xA9E52347, (int32_t)0x5EB5B3A2,
+    (int32_t)0xA9BFF8A8, (int32_t)0x5E93DC1F, (int32_t)0xA99ADB56, (int32_t)0x5E71F606,
+    (int32_t)0xA975CB57, (int32_t)0x5E50015D, (int32_t)0xA950C8B0, (int32_t)0x5E2DFE29,
+    (int32_t)0xA92BD367, (int32_t)0x5E0BEC6E, (int32_t)0xA906EB82, (int32_t)0x5DE9CC33,
+    (int32_t)0xA8E21106, (int32_t)0x5DC79D7C, (int32_t)0xA8BD43FA, (int32_t)0x5DA5604F,
+    (int32_t)0xA8988463, (int32_t)0x5D8314B1, (int32_t)0xA873D246, (int32_t)0x5D60BAA7,
+    (int32_t)0xA84F2DAA, (int32_t)0x5D3E5237, (int32_t)0xA82A9693, (int32_t)0x5D1BDB65,
+    (int32_t)0xA8060D08, (int32_t)0x5CF95638, (int32_t)0xA7E1910F, (int32_t)0x5CD6C2B5,
+    (int32_t)0xA7BD22AC, (int32_t)0x5CB420E0, (int32_t)0xA798C1E5, (int32_t)0x5C9170BF,
+    (int32_t)0xA7746EC0, (int32_t)0x5C6EB258, (int32_t)0xA7502943, (int32_t)0x5C4BE5B0,
+    (int32_t)0xA72BF174, (int32_t)0x5C290ACC, (int32_t)0xA707C757, (int32_t)0x5C0621B2,
+    (int32_t)0xA6E3AAF2, (int32_t)0x5BE32A67, (int32_t)0xA6BF9C4B, (int32_t)0x5BC024F0,
+    (int32_t)0xA69B9B68, (int32_t)0x5B9D1154, (int32_t)0xA677A84E, (int32_t)0x5B79EF96,
+    (int32_t)0xA653C303, (int32_t)0x5B56BFBD, (int32_t)0xA62FEB8B, (int32_t)0x5B3381CE,
+    (int32_t)0xA60C21EE, (int32_t)0x5B1035CF, (int32_t)0xA5E8662F, (int32_t)0x5AECDBC5,
+    (int32_t)0xA5C4B855, (int32_t)0x5AC973B5, (int32_t)0xA5A11866, (int32_t)0x5AA5FDA5,
+    (int32_t)0xA57D8666, (int32_t)0x5A82799A, (int32_t)0xA55A025B, (int32_t)0x5A5EE79A,
+    (int32_t)0xA5368C4B, (int32_t)0x5A3B47AB, (int32_t)0xA513243B, (int32_t)0x5A1799D1,
+    (int32_t)0xA4EFCA31, (int32_t)0x59F3DE12, (int32_t)0xA4CC7E32, (int32_t)0x59D01475,
+    (int32_t)0xA4A94043, (int32_t)0x59AC3CFD, (int32_t)0xA486106A, (int32_t)0x598857B2,
+    (int32_t)0xA462EEAC, (int32_t)0x59646498, (int32_t)0xA43FDB10, (int32_t)0x594063B5,
+    (int32_t)0xA41CD599, (int32_t)0x591C550E, (int32_t)0xA3F9DE4E, (int32_t)0x58F838A9,
+    (int32_t)0xA3D6F534, (int32_t)0x58D40E8C, (int32_t)0xA3B41A50, (int32_t)0x58AFD6BD,
+    (int32_t)0xA3914DA8, (int32_t)0x588B9140, (int32_t)0xA36E8F41, (int32_t)0x58673E1B,
+    (int32_t)0xA34BDF20, (int32_t)0x5842DD54, (int32_t)0xA3293D4B, (int32_t)0x581E6EF1,
+    (int32_t)0xA306A9C8, (int32_t)0x57F9F2F8, (int32_t)0xA2E4249B, (int32_t)0x57D5696D,
+    (int32_t)0xA2C1ADC9, (int32_t)0x57B0D256, (int32_t)0xA29F4559, (int32_t)0x578C2DBA,
+    (int32_t)0xA27CEB4F, (int32_t)0x57677B9D, (int32_t)0xA25A9FB1, (int32_t)0x5742BC06,
+    (int32_t)0xA2386284, (int32_t)0x571DEEFA, (int32_t)0xA21633CD, (int32_t)0x56F9147E,
+    (int32_t)0xA1F41392, (int32_t)0x56D42C99, (int32_t)0xA1D201D7, (int32_t)0x56AF3750,
+    (int32_t)0xA1AFFEA3, (int32_t)0x568A34A9, (int32_t)0xA18E09FA, (int32_t)0x566524AA,
+    (int32_t)0xA16C23E1, (int32_t)0x56400758, (int32_t)0xA14A4C5E, (int32_t)0x561ADCB9,
+    (int32_t)0xA1288376, (int32_t)0x55F5A4D2, (int32_t)0xA106C92F, (int32_t)0x55D05FAA,
+    (int32_t)0xA0E51D8C, (int32_t)0x55AB0D46, (int32_t)0xA0C38095, (int32_t)0x5585ADAD,
+    (int32_t)0xA0A1F24D, (int32_t)0x556040E2, (int32_t)0xA08072BA, (int32_t)0x553AC6EE,
+    (int32_t)0xA05F01E1, (int32_t)0x55153FD4, (int32_t)0xA03D9FC8, (int32_t)0x54EFAB9C,
+    (int32_t)0xA01C4C73, (int32_t)0x54CA0A4B, (int32_t)0x9FFB07E7, (int32_t)0x54A45BE6,
+    (int32_t)0x9FD9D22A, (int32_t)0x547EA073, (int32_t)0x9FB8AB41, (int32_t)0x5458D7F9,
+    (int32_t)0x9F979331, (int32_t)0x5433027D, (int32_t)0x9F7689FF, (int32_t)0x540D2005,
+    (int32_t)0x9F558FB0, (int32_t)0x53E73097, (int32_t)0x9F34A449, (int32_t)0x53C13439,
+    (int32_t)0x9F13C7D0, (int32_t)0x539B2AF0, (int32_t)0x9EF2FA49, (int32_t)0x537514C2,
+    (int32_t)0x9ED23BB9, (int32_t)0x534EF1B5, (int32_t)0x9EB18C26, (int32_t)0x5328C1D0,
+    (int32_t)0x9E90EB94, (int32_t)0x53028518, (int32_t)0x9E705A09, (int32_t)0x52DC3B92,
+    (int32_t)0x9E4FD78A, (int32_t)0x52B5E546, (int32_t)0x9E2F641B, (int32_t)0x528F8238,
+    (int32_t)0x9E0EFFC1, (int32_t)0x5269126E, (int32_t)0x9DEEAA82, (int32_t)0x524295F0,
+    (int32_t)0x9DCE6463, (int32_t)0x521C0CC2, (int32_t)0x9DAE2D68, (int32_t)0x51F576EA,
+    (int32_t)0x9D8E0597, (int32_t)0x51CED46E, (int32_t)0x9D6DECF4, (int32_t)0x51A82555,
+    (int32_t)0x9D4DE385, (int32_t)0x518169A5, (int32_t)0x9D2DE94D, (int32_t)0x515AA162,
+    (int32_t)0x9D0DFE54, (int32_t)0x5133CC94, (int32_t)0x9CEE229C, (int32_t)0x510CEB40,
+    (int32_t)0x9CCE562C, (int32_t)0x50E5FD6D, (int32_t)0x9CAE9907, (int32_t)0x50BF031F,
+    (int32_t)0x9C8EEB34, (int32_t)0x5097FC5E, (int32_t)0x9C6F4CB6, (int32_t)0x5070E92F,
+    (int32_t)0x9C4FBD93, (int32_t)0x5049C999, (int32_t)0x9C303DCF, (int32_t)0x50229DA1,
+    (int32_t)0x9C10CD70, (int32_t)0x4FFB654D, (int32_t)0x9BF16C7A, (int32_t)0x4FD420A4,
+    (int32_t)0x9BD21AF3, (int32_t)0x4FACCFAB, (int32_t)0x9BB2D8DE, (int32_t)0x4F857269,
+    (int32_t)0x9B93A641, (int32_t)0x4F5E08E3, (int32_t)0x9B748320, (int32_t)0x4F369320,
+    (int32_t)0x9B556F81, (int32_t)0x4F0F1126, (int32_t)0x9B366B68, (int32_t)0x4EE782FB,
+    (int32_t)0x9B1776DA, (int32_t)0x4EBFE8A5, (int32_t)0x9AF891DB, (int32_t)0x4E984229,
+    (int32_t)0x9AD9BC71, (int32_t)0x4E708F8F, (int32_t)0x9ABAF6A1, (int32_t)0x4E48D0DD,
+    (int32_t)0x9A9C406E, (int32_t)0x4E210617, (int32_t)0x9A7D99DE, (int32_t)0x4DF92F46,
+    (int32_t)0x9A5F02F5, (int32_t)0x4DD14C6E, (int32_t)0x9A407BB9, (int32_t)0x4DA95D96,
+    (int32_t)0x9A22042D, (int32_t)0x4D8162C4, (int32_t)0x9A039C57, (int32_t)0x4D595BFE,
+    (int32_t)0x99E5443B, (int32_t)0x4D31494B, (int32_t)0x99C6FBDE, (int32_t)0x4D092AB0,
+    (int32_t)0x99A8C345, (int32_t)0x4CE10034, (int32_t)0x998A9A74, (int32_t)0x4CB8C9DD,
+    (int32_t)0x996C816F, (int32_t)0x4C9087B1, (int32_t)0x994E783D, (int32_t)0x4C6839B7,
+    (int32_t)0x99307EE0, (int32_t)0x4C3FDFF4, (int32_t)0x9912955F, (int32_t)0x4C177A6E,
+    (int32_t)0x98F4BBBC, (int32_t)0x4BEF092D, (int32_t)0x98D6F1FE, (int32_t)0x4BC68C36,
+    (int32_t)0x98B93828, (int32_t)0x4B9E0390, (int32_t)0x989B8E40, (int32_t)0x4B756F40,
+    (int32_t)0x987DF449, (int32_t)0x4B4CCF4D, (int32_t)0x98606A49, (int32_t)0x4B2423BE,
+    (int32_t)0x9842F043, (int32_t)0x4AFB6C98, (int32_t)0x9825863D, (int32_t)0x4AD2A9E2,
+    (int32_t)0x98082C3B, (int32_t)0x4AA9DBA2, (int32_t)0x97EAE242, (int32_t)0x4A8101DE,
+    (int32_t)0x97CDA855, (int32_t)0x4A581C9E, (int32_t)0x97B07E7A, (int32_t)0x4A2F2BE6,
+    (int32_t)0x979364B5, (int32_t)0x4A062FBD, (int32_t)0x97765B0A, (int32_t)0x49DD282A,
+    (int32_t)0x9759617F, (int32_t)0x49B41533, (int32_t)0x973C7817, (int32_t)0x498AF6DF,
+    (int32_t)0x971F9ED7, (int32_t)0x4961CD33, (int32_t)0x9702D5C3, (int32_t)0x49389836,
+    (int32_t)0x96E61CE0, (int32_t)0x490F57EE, (int32_t)0x96C97432, (int32_t)0x48E60C62,
+    (int32_t)0x96ACDBBE, (int32_t)0x48BCB599, (int32_t)0x96905388, (int32_t)0x48935397,
+    (int32_t)0x9673DB94, (int32_t)0x4869E665, (int32_t)0x965773E7, (int32_t)0x48406E08,
+    (int32_t)0x963B1C86, (int32_t)0x4816EA86, (int32_t)0x961ED574, (int32_t)0x47ED5BE6,
+    (int32_t)0x96029EB6, (int32_t)0x47C3C22F, (int32_t)0x95E67850, (int32_t)0x479A1D67,
+    (int32_t)0x95CA6247, (int32_t)0x47706D93, (int32_t)0x95AE5C9F, (int32_t)0x4746B2BC,
+    (int32_t)0x9592675C, (int32_t)0x471CECE7, (int32_t)0x95768283, (int32_t)0x46F31C1A,
+    (int32_t)0x955AAE17, (int32_t)0x46C9405C, (int32_t)0x953EEA1E, (int32_t)0x469F59B4,
+    (int32_t)0x9523369C, (int32_t)0x46756828, (int32_t)0x95079394, (int32_t)0x464B6BBE,
+    (int32_t)0x94EC010B, (int32_t)0x4621647D, (int32_t)0x94D07F05, (int32_t)0x45F7526B,
+    (int32_t)0x94B50D87, (int32_t)0x45CD358F, (int32_t)0x9499AC95, (int32_t)0x45A30DF0,
+    (int32_t)0x947E5C33, (int32_t)0x4578DB93, (int32_t)0x94631C65, (int32_t)0x454E9E80,
+    (int32_t)0x9447ED2F, (int32_t)0x452456BD, (int32_t)0x942CCE96, (int32_t)0x44FA0450,
+    (int32_t)0x9411C09E, (int32_t)0x44CFA740, (int32_t)0x93F6C34A, (int32_t)0x44A53F93,
+    (int32_t)0x93DBD6A0, (int32_t)0x447ACD50, (int32_t)0x93C0FAA3, (int32_t)0x4450507E,
+    (int32_t)0x93A62F57, (int32_t)0x4425C923, (int32_t)0x938B74C1, (int32_t)0x43FB3746,
+    (int32_t)0x9370CAE4, (int32_t)0x43D09AED, (int32_t)0x935631C5, (int32_t)0x43A5F41E,
+    (int32_t)0x933BA968, (int32_t)0x437B42E1, (int32_t)0x932131D1, (int32_t)0x4350873C,
+    (int32_t)0x9306CB04, (int32_t)0x4325C135, (int32_t)0x92EC7505, (int32_t)0x42FAF0D4,
+    (int32_t)0x92D22FD9, (int32_t)0x42D0161E, (int32_t)0x92B7FB82, (int32_t)0x42A5311B,
+    (int32_t)0x929DD806, (int32_t)0x427A41D0, (int32_t)0x9283C568, (int32_t)0x424F4845,
+    (int32_t)0x9269C3AC, (int32_t)0x42244481, (int32_t)0x924FD2D7, (int32_t)0x41F93689,
+    (int32_t)0x9235F2EC, (int32_t)0x41CE1E65, (int32_t)0x921C23EF, (int32_t)0x41A2FC1A,
+    (int32_t)0x920265E4, (int32_t)0x4177CFB1, (int32_t)0x91E8B8D0, (int32_t)0x414C992F,
+    (int32_t)0x91CF1CB6, (int32_t)0x4121589B, (int32_t)0x91B5919A, (int32_t)0x40F60DFB,
+    (int32_t)0x919C1781, (int32_t)0x40CAB958, (int32_t)0x9182AE6D, (int32_t)0x409F5AB6,
+    (int32_t)0x91695663, (int32_t)0x4073F21D, (int32_t)0x91500F67, (int32_t)0x40487F94,
+    (int32_t)0x9136D97D, (int32_t)0x401D0321, (int32_t)0x911DB4A9, (int32_t)0x3FF17CCA,
+    (int32_t)0x9104A0EE, (int32_t)0x3FC5EC98, (int32_t)0x90EB9E50, (int32_t)0x3F9A5290,
+    (int32_t)0x90D2ACD4, (int32_t)0x3F6EAEB8, (int32_t)0x90B9CC7D, (int32_t)0x3F430119,
+    (int32_t)0x90A0FD4E, (int32_t)0x3F1749B8, (int32_t)0x90883F4D, (int32_t)0x3EEB889C,
+    (int32_t)0x906F927C, (int32_t)0x3EBFBDCD, (int32_t)0x9056F6DF, (int32_t)0x3E93E950,
+    (int32_t)0x903E6C7B, (int32_t)0x3E680B2C, (int32_t)0x9025F352, (int32_t)0x3E3C2369,
+    (int32_t)0x900D8B69, (int32_t)0x3E10320D, (int32_t)0x8FF534C4, (int32_t)0x3DE4371F,
+    (int32_t)0x8FDCEF66, (int32_t)0x3DB832A6, (int32_t)0x8FC4BB53, (int32_t)0x3D8C24A8,
+    (int32_t)0x8FAC988F, (int32_t)0x3D600D2C, (int32_t)0x8F94871D, (int32_t)0x3D33EC39,
+    (int32_t)0x8F7C8701, (int32_t)0x3D07C1D6, (int32_t)0x8F649840, (int32_t)0x3CDB8E09,
+    (int32_t)0x8F4CBADB, (int32_t)0x3CAF50DA, (int32_t)0x8F34EED8, (int32_t)0x3C830A50,
+    (int32_t)0x8F1D343A, (int32_t)0x3C56BA70, (int32_t)0x8F058B04, (int32_t)0x3C2A6142,
+    (int32_t)0x8EEDF33B, (int32_t)0x3BFDFECD, (int32_t)0x8ED66CE1, (int32_t)0x3BD19318,
+    (int32_t)0x8EBEF7FB, (int32_t)0x3BA51E29, (int32_t)0x8EA7948C, (int32_t)0x3B78A007,
+    (int32_t)0x8E904298, (int32_t)0x3B4C18BA, (int32_t)0x8E790222, (int32_t)0x3B1F8848,
+    (int32_t)0x8E61D32E, (int32_t)0x3AF2EEB7, (int32_t)0x8E4AB5BF, (int32_t)0x3AC64C0F,
+    (int32_t)0x8E33A9DA, (int32_t)0x3A99A057, (int32_t)0x8E1CAF80, (int32_t)0x3A6CEB96,
+    (int32_t)0x8E05C6B7, (int32_t)0x3A402DD2, (int32_t)0x8DEEEF82, (int32_t)0x3A136712,
+    (int32_t)0x8DD829E4, (int32_t)0x39E6975E, (int32_t)0x8DC175E0, (int32_t)0x39B9BEBC,
+    (int32_t)0x8DAAD37B, (int32_t)0x398CDD32, (int32_t)0x8D9442B8, (int32_t)0x395FF2C9,
+    (int32_t)0x8D7DC399, (int32_t)0x3932FF87, (int32_t)0x8D675623, (int32_t)0x39060373,
+    (int32_t)0x8D50FA59, (int32_t)0x38D8FE93, (int32_t)0x8D3AB03F, (int32_t)0x38ABF0EF,
+    (int32_t)0x8D2477D8, (int32_t)0x387EDA8E, (int32_t)0x8D0E5127, (int32_t)0x3851BB77,
+    (int32_t)0x8CF83C30, (int32_t)0x382493B0, (int32_t)0x8CE238F6, (int32_t)0x37F76341,
+    (int32_t)0x8CCC477D, (int32_t)0x37CA2A30, (int32_t)0x8CB667C8, (int32_t)0x379CE885,
+    (int32_t)0x8CA099DA, (int32_t)0x376F9E46, (int32_t)0x8C8ADDB7, (int32_t)0x37424B7B,
+    (int32_t)0x8C753362, (int32_t)0x3714F02A, (int32_t)0x8C5F9ADE, (int32_t)0x36E78C5B,
+    (int32_t)0x8C4A142F, (int32_t)0x36BA2014, (int32_t)0x8C349F58, (int32_t)0x368CAB5C,
+    (int32_t)0x8C1F3C5D, (int32_t)0x365F2E3B, (int32_t)0x8C09EB40, (int32_t)0x3631A8B8,
+    (int32_t)0x8BF4AC05, (int32_t)0x36041AD9, (int32_t)0x8BDF7EB0, (int32_t)0x35D684A6,
+    (int32_t)0x8BCA6343, (int32_t)0x35A8E625, (int32_t)0x8BB559C1, (int32_t)0x357B3F5D,
+    (int32_t)0x8BA0622F, (int32_t)0x354D9057, (int32_t)0x8B8B7C8F, (int32_t)0x351FD918,
+    (int32_t)0x8B76A8E4, (int32_t)0x34F219A8, (int32_t)0x8B61E733, (int32_t)0x34C4520D,
+    (int32_t)0x8B4D377C, (int32_t)0x34968250, (int32_t)0x8B3899C6, (int32_t)0x3468AA76,
+    (int32_t)0x8B240E11, (int32_t)0x343ACA87, (int32_t)0x8B0F9462, (int32_t)0x340CE28B,
+    (int32_t)0x8AFB2CBB, (int32_t)0x33DEF287, (int32_t)0x8AE6D720, (int32_t)0x33B0FA84,
+    (int32_t)0x8AD29394, (int32_t)0x3382FA88, (int32_t)0x8ABE6219, (int32_t)0x3354F29B,
+    (int32_t)0x8AAA42B4, (int32_t)0x3326E2C3, (int32_t)0x8A963567, (int32_t)0x32F8CB07,
+    (int32_t)0x8A823A36, (int32_t)0x32CAAB6F, (int32_t)0x8A6E5123, (int32_t)0x329C8402,
+    (int32_t)0x8A5A7A31, (int32_t)0x326E54C7, (int32_t)0x8A46B564, (int32_t)0x32401DC6,
+    (int32_t)0x8A3302BE, (int32_t)0x3211DF04, (int32_t)0x8A1F6243, (int32_t)0x31E39889,
+    (int32_t)0x8A0BD3F5, (int32_t)0x31B54A5E, (int32_t)0x89F857D8, (int32_t)0x3186F487,
+    (int32_t)0x89E4EDEF, (int32_t)0x3158970E, (int32_t)0x89D1963C, (int32_t)0x312A31F8,
+    (int32_t)0x89BE50C3, (int32_t)0x30FBC54D, (int32_t)0x89AB1D87, (int32_t)0x30CD5115,
+    (int32_t)0x8997FC8A, (int32_t)0x309ED556, (int32_t)0x8984EDCF, (int32_t)0x30705217,
+    (int32_t)0x8971F15A, (int32_t)0x3041C761, (int32_t)0x895F072E, (int32_t)0x30133539,
+    (int32_t)0x894C2F4C, (int32_t)0x2FE49BA7, (int32_t)0x893969B9, (int32_t)0x2FB5FAB2,
+    (int32_t)0x8926B677, (int32_t)0x2F875262, (int32_t)0x89141589, (int32_t)0x2F58A2BE,
+    (int32_t)0x890186F2, (int32_t)0x2F29EBCC, (int32_t)0x88EF0AB4, (int32_t)0x2EFB2D95,
+    (int32_t)0x88DCA0D3, (int32_t)0x2ECC681E, (int32_t)0x88CA4951, (int32_t)0x2E9D9B70,
+    (int32_t)0x88B80432, (int32_t)0x2E6EC792, (int32_t)0x88A5D177, (int32_t)0x2E3FEC8B,
+    (int32_t)0x8893B125, (int32_t)0x2E110A62, (int32_t)0x8881A33D, (int32_t)0x2DE2211E,
+    (int32_t)0x886FA7C2, (int32_t)0x2DB330C7, (int32_t)0x885DBEB8, (int32_t)0x2D843964,
+    (int32_t)0x884BE821, (int32_t)0x2D553AFC, (int32_t)0x883A23FF, (int32_t)0x2D263596,
+    (int32_t)0x88287256, (int32_t)0x2CF72939, (int32_t)0x8816D327, (int32_t)0x2CC815EE,
+    (int32_t)0x88054677, (int32_t)0x2C98FBBA, (int32_t)0x87F3CC48, (int32_t)0x2C69DAA6,
+    (int32_t)0x87E2649B, (int32_t)0x2C3AB2B9, (int32_t)0x87D10F75, (int32_t)0x2C0B83FA,
+    (int32_t)0x87BFCCD7, (int32_t)0x2BDC4E6F, (int32_t)0x87AE9CC5, (int32_t)0x2BAD1221,
+    (int32_t)0x879D7F41, (int32_t)0x2B7DCF17, (int32_t)0x878C744D, (int32_t)0x2B4E8558,
+    (int32_t)0x877B7BEC, (int32_t)0x2B1F34EB, (int32_t)0x876A9621, (int32_t)0x2AEFDDD8,
+    (int32_t)0x8759C2EF, (int32_t)0x2AC08026, (int32_t)0x87490258, (int32_t)0x2A911BDC,
+    (int32_t)0x8738545E, (int32_t)0x2A61B101, (int32_t)0x8727B905, (int32_t)0x2A323F9E,
+    (int32_t)0x8717304E, (int32_t)0x2A02C7B8, (int32_t)0x8706BA3D, (int32_t)0x29D34958,
+    (int32_t)0x86F656D3, (int32_t)0x29A3C485, (int32_t)0x86E60614, (int32_t)0x29743946,
+    (int32_t)0x86D5C802, (int32_t)0x2944A7A2, (int32_t)0x86C59C9F, (int32_t)0x29150FA1,
+    (int32_t)0x86B583EE, (int32_t)0x28E5714B, (int32_t)0x86A57DF2, (int32_t)0x28B5CCA5,
+    (int32_t)0x86958AAC, (int32_t)0x288621B9, (int32_t)0x8685AA20, (int32_t)0x2856708D,
+    (int32_t)0x8675DC4F, (int32_t)0x2826B928, (int32_t)0x8666213C, (int32_t)0x27F6FB92,
+    (int32_t)0x865678EB, (int32_t)0x27C737D3, (int32_t)0x8646E35C, (int32_t)0x27976DF1,
+    (int32_t)0x86376092, (int32_t)0x27679DF4, (int32_t)0x8627F091, (int32_t)0x2737C7E3,
+    (int32_t)0x86189359, (int32_t)0x2707EBC7, (int32_t)0x860948EF, (int32_t)0x26D809A5,
+    (int32_t)0x85FA1153, (int32_t)0x26A82186, (int32_t)0x85EAEC88, (int32_t)0x26783370,
+    (int32_t)0x85DBDA91, (int32_t)0x26483F6C, (int32_t)0x85CCDB70, (int32_t)0x26184581,
+    (int32_t)0x85BDEF28, (int32_t)0x25E845B6, (int32_t)0x85AF15B9, (int32_t)0x25B84012,
+    (int32_t)0x85A04F28, (int32_t)0x2588349D, (int32_t)0x85919B76, (int32_t)0x2558235F,
+    (int32_t)0x8582FAA5, (int32_t)0x25280C5E, (int32_t)0x85746CB8, (int32_t)0x24F7EFA2,
+    (int32_t)0x8565F1B0, (int32_t)0x24C7CD33, (int32_t)0x85578991, (int32_t)0x2497A517,
+    (int32_t)0x8549345C, (int32_t)0x24677758, (int32_t)0x853AF214, (int32_t)0x243743FA,
+    (int32_t)0x852CC2BB, (int32_t)0x24070B08, (int32_t)0x851EA652, (int32_t)0x23D6CC87,
+    (int32_t)0x85109CDD, (int32_t)0x23A6887F, (int32_t)0x8502A65C, (int32_t)0x23763EF7,
+    (int32_t)0x84F4C2D4, (int32_t)0x2345EFF8, (int32_t)0x84E6F244, (int32_t)0x23159B88,
+    (int32_t)0x84D934B1, (int32_t)0x22E541AF, (int32_t)0x84CB8A1B, (int32_t)0x22B4E274,
+    (int32_t)0x84BDF286, (int32_t)0x22847DE0, (int32_t)0x84B06DF2, (int32_t)0x225413F8,
+    (int32_t)0x84A2FC62, (int32_t)0x2223A4C5, (int32_t)0x84959DD9, (int32_t)0x21F3304F,
+    (int32_t)0x84885258, (int32_t)0x21C2B69C, (int32_t)0x847B19E1, (int32_t)0x219237B5,
+    (int32_t)0x846DF477, (int32_t)0x2161B3A0, (int32_t)0x8460E21A, (int32_t)0x21312A65,
+    (int32_t)0x8453E2CF, (int32_t)0x21009C0C, (int32_t)0x8446F695, (int32_t)0x20D0089C,
+    (int32_t)0x843A1D70, (int32_t)0x209F701C, (int32_t)0x842D5762, (int32_t)0x206ED295,
+    (int32_t)0x8420A46C, (int32_t)0x203E300D, (int32_t)0x84140490, (int32_t)0x200D888D,
+    (int32_t)0x840777D0, (int32_t)0x1FDCDC1B, (int32_t)0x83FAFE2E, (int32_t)0x1FAC2ABF,
+    (int32_t)0x83EE97AD, (int32_t)0x1F7B7481, (int32_t)0x83E2444D, (int32_t)0x1F4AB968,
+    (int32_t)0x83D60412, (int32_t)0x1F19F97B, (int32_t)0x83C9D6FC, (int32_t)0x1EE934C3,
+    (int32_t)0x83BDBD0E, (int32_t)0x1EB86B46, (int32_t)0x83B1B649, (int32_t)0x1E879D0D,
+    (int32_t)0x83A5C2B0, (int32_t)0x1E56CA1E, (int32_t)0x8399E244, (int32_t)0x1E25F282,
+    (int32_t)0x838E1507, (int32_t)0x1DF5163F, (int32_t)0x83825AFB, (int32_t)0x1DC4355E,
+    (int32_t)0x8376B422, (int32_t)0x1D934FE5, (int32_t)0x836B207D, (int32_t)0x1D6265DD,
+    (int32_t)0x835FA00F, (int32_t)0x1D31774D, (int32_t)0x835432D8, (int32_t)0x1D00843D,
+    (int32_t)0x8348D8DC, (int32_t)0x1CCF8CB3, (int32_t)0x833D921B, (int32_t)0x1C9E90B8,
+    (int32_t)0x83325E97, (int32_t)0x1C6D9053, (int32_t)0x83273E52, (int32_t)0x1C3C8B8C,
+    (int32_t)0x831C314E, (int32_t)0x1C0B826A, (int32_t)0x8311378D, (int32_t)0x1BDA74F6,
+    (int32_t)0x83065110, (int32_t)0x1BA96335, (int32_t)0x82FB7DD8, (int32_t)0x1B784D30,
+    (int32_t)0x82F0BDE8, (int32_t)0x1B4732EF, (int32_t)0x82E61141, (int32_t)0x1B161479,
+    (int32_t)0x82DB77E5, (int32_t)0x1AE4F1D6, (int32_t)0x82D0F1D5, (int32_t)0x1AB3CB0D,
+    (int32_t)0x82C67F14, (int32_t)0x1A82A026, (int32_t)0x82BC1FA2, (int32_t)0x1A517128,
+    (int32_t)0x82B1D381, (int32_t)0x1A203E1B, (int32_t)0x82A79AB3, (int32_t)0x19EF0707,
+    (int32_t)0x829D753A, (int32_t)0x19BDCBF3, (int32_t)0x82936317, (int32_t)0x198C8CE7,
+    (int32_t)0x8289644B, (int32_t)0x195B49EA, (int32_t)0x827F78D8, (int32_t)0x192A0304,
+    (int32_t)0x8275A0C0, (int32_t)0x18F8B83C, (int32_t)0x826BDC04, (int32_t)0x18C7699B,
+    (int32_t)0x82622AA6, (int32_t)0x18961728, (int32_t)0x82588CA7, (int32_t)0x1864C0EA,
+    (int32_t)0x824F0208, (int32_t)0x183366E9, (int32_t)0x82458ACC, (int32_t)0x1802092C,
+    (int32_t)0x823C26F3, (int32_t)0x17D0A7BC, (int32_t)0x8232D67F, (int32_t)0x179F429F,
+    (int32_t)0x82299971, (int32_t)0x176DD9DE, (int32_t)0x82206FCC, (int32_t)0x173C6D80,
+    (int32_t)0x82175990, (int32_t)0x170AFD8D, (int32_t)0x820E56BE, (int32_t)0x16D98A0C,
+    (int32_t)0x82056758, (int32_t)0x16A81305, (int32_t)0x81FC8B60, (int32_t)0x1676987F,
+    (int32_t)0x81F3C2D7, (int32_t)0x16451A83, (int32_t)0x81EB0DBE, (int32_t)0x16139918,
+    (int32_t)0x81E26C16, (int32_t)0x15E21445, (int32_t)0x81D9DDE1, (int32_t)0x15B08C12,
+    (int32_t)0x81D16321, (int32_t)0x157F0086, (int32_t)0x81C8FBD6, (int32_t)0x154D71AA,
+    (int32_t)0x81C0A801, (int32_t)0x151BDF86, (int32_t)0x81B867A5, (int32_t)0x14EA4A1F,
+    (int32_t)0x81B03AC2, (int32_t)0x14B8B17F, (int32_t)0x81A82159, (int32_t)0x148715AE,
+    (int32_t)0x81A01B6D, (int32_t)0x145576B1, (int32_t)0x819828FD, (int32_t)0x1423D492,
+    (int32_t)0x81904A0C, (int32_t)0x13F22F58, (int32_t)0x81887E9A, (int32_t)0x13C0870A,
+    (int32_t)0x8180C6A9, (int32_t)0x138EDBB1, (int32_t)0x8179223A, (int32_t)0x135D2D53,
+    (int32_t)0x8171914E, (int32_t)0x132B7BF9, (int32_t)0x816A13E6, (int32_t)0x12F9C7AA,
+    (int32_t)0x8162AA04, (int32_t)0x12C8106F, (int32_t)0x815B53A8, (int32_t)0x1296564D,
+    (int32_t)0x815410D4, (int32_t)0x1264994E, (int32_t)0x814CE188, (int32_t)0x1232D979,
+    (int32_t)0x8145C5C7, (int32_t)0x120116D5, (int32_t)0x813EBD90, (int32_t)0x11CF516A,
+    (int32_t)0x8137C8E6, (int32_t)0x119D8941, (int32_t)0x8130E7C9, (int32_t)0x116BBE60,
+    (int32_t)0x812A1A3A, (int32_t)0x1139F0CF, (int32_t)0x8123603A, (int32_t)0x11082096,
+    (int32_t)0x811CB9CA, (int32_t)0x10D64DBD, (int32_t)0x811626EC, (int32_t)0x10A4784B,
+    (int32_t)0x810FA7A0, (int32_t)0x1072A048, (int32_t)0x81093BE8, (int32_t)0x1040C5BB,
+    (int32_t)0x8102E3C4, (int32_t)0x100EE8AD, (int32_t)0x80FC9F35, (int32_t)0x0FDD0926,
+    (int32_t)0x80F66E3C, (int32_t)0x0FAB272B, (int32_t)0x80F050DB, (int32_t)0x0F7942C7,
+    (int32_t)0x80EA4712, (int32_t)0x0F475BFF, (int32_t)0x80E450E2, (int32_t)0x0F1572DC,
+    (int32_t)0x80DE6E4C, (int32_t)0x0EE38766, (int32_t)0x80D89F51, (int32_t)0x0EB199A4,
+    (int32_t)0x80D2E3F2, (int32_t)0x0E7FA99E, (int32_t)0x80CD3C2F, (int32_t)0x0E4DB75B,
+    (int32_t)0x80C7A80A, (int32_t)0x0E1BC2E4, (int32_t)0x80C22784, (int32_t)0x0DE9CC40,
+    (int32_t)0x80BCBA9D, (int32_t)0x0DB7D376, (int32_t)0x80B76156, (int32_t)0x0D85D88F,
+    (int32_t)0x80B21BAF, (int32_t)0x0D53DB92, (int32_t)0x80ACE9AB, (int32_t)0x0D21DC87,
+    (int32_t)0x80A7CB49, (int32_t)0x0CEFDB76, (int32_t)0x80A2C08B, (int32_t)0x0CBDD865,
+    (int32_t)0x809DC971, (int32_t)0x0C8BD35E, (int32_t)0x8098E5FB, (int32_t)0x0C59CC68,
+    (int32_t)0x8094162C, (int32_t)0x0C27C389, (int32_t)0x808F5A02, (int32_t)0x0BF5B8CB,
+    (int32_t)0x808AB180, (int32_t)0x0BC3AC35, (int32_t)0x80861CA6, (int32_t)0x0B919DCF,
+    (int32_t)0x80819B74, (int32_t)0x0B5F8D9F, (int32_t)0x807D2DEC, (int32_t)0x0B2D7BAF,
+    (int32_t)0x8078D40D, (int32_t)0x0AFB6805, (int32_t)0x80748DD9, (int32_t)0x0AC952AA,
+    (int32_t)0x80705B50, (int32_t)0x0A973BA5, (int32_t)0x806C3C74, (int32_t)0x0A6522FE,
+    (int32_t)0x80683143, (int32_t)0x0A3308BD, (int32_t)0x806439C0, (int32_t)0x0A00ECE8,
+    (int32_t)0x806055EB, (int32_t)0x09CECF89, (int32_t)0x805C85C4, (int32_t)0x099CB0A7,
+    (int32_t)0x8058C94C, (int32_t)0x096A9049, (int32_t)0x80552084, (int32_t)0x09386E78,
+    (int32_t)0x80518B6B, (int32_t)0x09064B3A, (int32_t)0x804E0A04, (int32_t)0x08D42699,
+    (int32_t)0x804A9C4D, (int32_t)0x08A2009A, (int32_t)0x80474248, (int32_t)0x086FD947,
+    (int32_t)0x8043FBF6, (int32_t)0x083DB0A7, (int32_t)0x8040C956, (int32_t)0x080B86C2,
+    (int32_t)0x803DAA6A, (int32_t)0x07D95B9E, (int32_t)0x803A9F31, (int32_t)0x07A72F45,
+    (int32_t)0x8037A7AC, (int32_t)0x077501BE, (int32_t)0x8034C3DD, (int32_t)0x0742D311,
+    (int32_t)0x8031F3C2, (int32_t)0x0710A345, (int32_t)0x802F375D, (int32_t)0x06DE7262,
+    (int32_t)0x802C8EAD, (int32_t)0x06AC406F, (int32_t)0x8029F9B4, (int32_t)0x067A0D76,
+    (int32_t)0x80277872, (int32_t)0x0647D97C, (int32_t)0x80250AE7, (int32_t)0x0615A48B,
+    (int32_t)0x8022B114, (int32_t)0x05E36EA9, (int32_t)0x80206AF8, (int32_t)0x05B137DF,
+    (int32_t)0x801E3895, (int32_t)0x057F0035, (int32_t)0x801C19EA, (int32_t)0x054CC7B1,
+    (int32_t)0x801A0EF8, (int32_t)0x051A8E5C, (int32_t)0x801817BF, (int32_t)0x04E8543E,
+    (int32_t)0x80163440, (int32_t)0x04B6195D, (int32_t)0x8014647B, (int32_t)0x0483DDC3,
+    (int32_t)0x8012A86F, (int32_t)0x0451A177, (int32_t)0x8011001F, (int32_t)0x041F6480,
+    (int32_t)0x800F6B88, (int32_t)0x03ED26E6, (int32_t)0x800DEAAD, (int32_t)0x03BAE8B2,
+    (int32_t)0x800C7D8C, (int32_t)0x0388A9EA, (int32_t)0x800B2427, (int32_t)0x03566A96,
+    (int32_t)0x8009DE7E, (int32_t)0x03242ABF, (int32_t)0x8008AC90, (int32_t)0x02F1EA6C,
+    (int32_t)0x80078E5E, (int32_t)0x02BFA9A4, (int32_t)0x800683E8, (int32_t)0x028D6870,
+    (int32_t)0x80058D2F, (int32_t)0x025B26D7, (int32_t)0x8004AA32, (int32_t)0x0228E4E2,
+    (int32_t)0x8003DAF1, (int32_t)0x01F6A297, (int32_t)0x80031F6D, (int32_t)0x01C45FFE,
+    (int32_t)0x800277A6, (int32_t)0x01921D20, (int32_t)0x8001E39B, (int32_t)0x015FDA03,
+    (int32_t)0x8001634E, (int32_t)0x012D96B1, (int32_t)0x8000F6BD, (int32_t)0x00FB5330,
+    (int32_t)0x80009DEA, (int32_t)0x00C90F88, (int32_t)0x800058D4, (int32_t)0x0096CBC1,
+    (int32_t)0x8000277A, (int32_t)0x006487E3, (int32_t)0x800009DF, (int32_t)0x003243F5,
+    (int32_t)0x80000000, (int32_t)0x00000000, (int32_t)0x800009DF, (int32_t)0xFFCDBC0B,
+    (int32_t)0x8000277A, (int32_t)0xFF9B781D, (int32_t)0x800058D4, (int32_t)0xFF69343F,
+    (int32_t)0x80009DEA, (int32_t)0xFF36F078, (int32_t)0x8000F6BD, (int32_t)0xFF04ACD0,
+    (int32_t)0x8001634E, (int32_t)0xFED2694F, (int32_t)0x8001E39B, (int32_t)0xFEA025FD,
+    (int32_t)0x800277A6, (int32_t)0xFE6DE2E0, (int32_t)0x80031F6D, (int32_t)0xFE3BA002,
+    (int32_t)0x8003DAF1, (int32_t)0xFE095D69, (int32_t)0x8004AA32, (int32_t)0xFDD71B1E,
+    (int32_t)0x80058D2F, (int32_t)0xFDA4D929, (int32_t)0x800683E8, (int32_t)0xFD729790,
+    (int32_t)0x80078E5E, (int32_t)0xFD40565C, (int32_t)0x8008AC90, (int32_t)0xFD0E1594,
+    (int32_t)0x8009DE7E, (int32_t)0xFCDBD541, (int32_t)0x800B2427, (int32_t)0xFCA9956A,
+    (int32_t)0x800C7D8C, (int32_t)0xFC775616, (int32_t)0x800DEAAD, (int32_t)0xFC45174E,
+    (int32_t)0x800F6B88, (int32_t)0xFC12D91A, (int32_t)0x8011001F, (int32_t)0xFBE09B80,
+    (int32_t)0x8012A86F, (int32_t)0xFBAE5E89, (int32_t)0x8014647B, (int32_t)0xFB7C223D,
+    (int32_t)0x80163440, (int32_t)0xFB49E6A3, (int32_t)0x801817BF, (int32_t)0xFB17ABC2,
+    (int32_t)0x801A0EF8, (int32_t)0xFAE571A4, (int32_t)0x801C19EA, (int32_t)0xFAB3384F,
+    (int32_t)0x801E3895, (int32_t)0xFA80FFCB, (int32_t)0x80206AF8, (int32_t)0xFA4EC821,
+    (int32_t)0x8022B114, (int32_t)0xFA1C9157, (int32_t)0x80250AE7, (int32_t)0xF9EA5B75,
+    (int32_t)0x80277872, (int32_t)0xF9B82684, (int32_t)0x8029F9B4, (int32_t)0xF985F28A,
+    (int32_t)0x802C8EAD, (int32_t)0xF953BF91, (int32_t)0x802F375D, (int32_t)0xF9218D9E,
+    (int32_t)0x8031F3C2, (int32_t)0xF8EF5CBB, (int32_t)0x8034C3DD, (int32_t)0xF8BD2CEF,
+    (int32_t)0x8037A7AC, (int32_t)0xF88AFE42, (int32_t)0x803A9F31, (int32_t)0xF858D0BB,
+    (int32_t)0x803DAA6A, (int32_t)0xF826A462, (int32_t)0x8040C956, (int32_t)0xF7F4793E,
+    (int32_t)0x8043FBF6, (int32_t)0xF7C24F59, (int32_t)0x80474248, (int32_t)0xF79026B9,
+    (int32_t)0x804A9C4D, (int32_t)0xF75DFF66, (int32_t)0x804E0A04, (int32_t)0xF72BD967,
+    (int32_t)0x80518B6B, (int32_t)0xF6F9B4C6, (int32_t)0x80552084, (int32_t)0xF6C79188,
+    (int32_t)0x8058C94C, (int32_t)0xF6956FB7, (int32_t)0x805C85C4, (int32_t)0xF6634F59,
+    (int32_t)0x806055EB, (int32_t)0xF6313077, (int32_t)0x806439C0, (int32_t)0xF5FF1318,
+    (int32_t)0x80683143, (int32_t)0xF5CCF743, (int32_t)0x806C3C74, (int32_t)0xF59ADD02,
+    (int32_t)0x80705B50, (int32_t)0xF568C45B, (int32_t)0x80748DD9, (int32_t)0xF536AD56,
+    (int32_t)0x8078D40D, (int32_t)0xF50497FB, (int32_t)0x807D2DEC, (int32_t)0xF4D28451,
+    (int32_t)0x80819B74, (int32_t)0xF4A07261, (int32_t)0x80861CA6, (int32_t)0xF46E6231,
+    (int32_t)0x808AB180, (int32_t)0xF43C53CB, (int32_t)0x808F5A02, (int32_t)0xF40A4735,
+    (int32_t)0x8094162C, (int32_t)0xF3D83C77, (int32_t)0x8098E5FB, (int32_t)0xF3A63398,
+    (int32_t)0x809DC971, (int32_t)0xF3742CA2, (int32_t)0x80A2C08B, (int32_t)0xF342279B,
+    (int32_t)0x80A7CB49, (int32_t)0xF310248A, (int32_t)0x80ACE9AB, (int32_t)0xF2DE2379,
+    (int32_t)0x80B21BAF, (int32_t)0xF2AC246E, (int32_t)0x80B76156, (int32_t)0xF27A2771,
+    (int32_t)0x80BCBA9D, (int32_t)0xF2482C8A, (int32_t)0x80C22784, (int32_t)0xF21633C0,
+    (int32_t)0x80C7A80A, (int32_t)0xF1E43D1C, (int32_t)0x80CD3C2F, (int32_t)0xF1B248A5,
+    (int32_t)0x80D2E3F2, (int32_t)0xF1805662, (int32_t)0x80D89F51, (int32_t)0xF14E665C,
+    (int32_t)0x80DE6E4C, (int32_t)0xF11C789A, (int32_t)0x80E450E2, (int32_t)0xF0EA8D24,
+    (int32_t)0x80EA4712, (int32_t)0xF0B8A401, (int32_t)0x80F050DB, (int32_t)0xF086BD39,
+    (int32_t)0x80F66E3C, (int32_t)0xF054D8D5, (int32_t)0x80FC9F35, (int32_t)0xF022F6DA,
+    (int32_t)0x8102E3C4, (int32_t)0xEFF11753, (int32_t)0x81093BE8, (int32_t)0xEFBF3A45,
+    (int32_t)0x810FA7A0, (int32_t)0xEF8D5FB8, (int32_t)0x811626EC, (int32_t)0xEF5B87B5,
+    (int32_t)0x811CB9CA, (int32_t)0xEF29B243, (int32_t)0x8123603A, (int32_t)0xEEF7DF6A,
+    (int32_t)0x812A1A3A, (int32_t)0xEEC60F31, (int32_t)0x8130E7C9, (int32_t)0xEE9441A0,
+    (int32_t)0x8137C8E6, (int32_t)0xEE6276BF, (int32_t)0x813EBD90, (int32_t)0xEE30AE96,
+    (int32_t)0x8145C5C7, (int32_t)0xEDFEE92B, (int32_t)0x814CE188, (int32_t)0xEDCD2687,
+    (int32_t)0x815410D4, (int32_t)0xED9B66B2, (int32_t)0x815B53A8, (int32_t)0xED69A9B3,
+    (int32_t)0x8162AA04, (int32_t)0xED37EF91, (int32_t)0x816A13E6, (int32_t)0xED063856,
+    (int32_t)0x8171914E, (int32_t)0xECD48407, (int32_t)0x8179223A, (int32_t)0xECA2D2AD,
+    (int32_t)0x8180C6A9, (int32_t)0xEC71244F, (int32_t)0x81887E9A, (int32_t)0xEC3F78F6,
+    (int32_t)0x81904A0C, (int32_t)0xEC0DD0A8, (int32_t)0x819828FD, (int32_t)0xEBDC2B6E,
+    (int32_t)0x81A01B6D, (int32_t)0xEBAA894F, (int32_t)0x81A82159, (int32_t)0xEB78EA52,
+    (int32_t)0x81B03AC2, (int32_t)0xEB474E81, (int32_t)0x81B867A5, (int32_t)0xEB15B5E1,
+    (int32_t)0x81C0A801, (int32_t)0xEAE4207A, (int32_t)0x81C8FBD6, (int32_t)0xEAB28E56,
+    (int32_t)0x81D16321, (int32_t)0xEA80FF7A, (int32_t)0x81D9DDE1, (int32_t)0xEA4F73EE,
+    (int32_t)0x81E26C16, (int32_t)0xEA1DEBBB, (int32_t)0x81EB0DBE, (int32_t)0xE9EC66E8,
+    (int32_t)0x81F3C2D7, (int32_t)0xE9BAE57D, (int32_t)0x81FC8B60, (int32_t)0xE9896781,
+    (int32_t)0x82056758, (int32_t)0xE957ECFB, (int32_t)0x820E56BE, (int32_t)0xE92675F4,
+    (int32_t)0x82175990, (int32_t)0xE8F50273, (int32_t)0x82206FCC, (int32_t)0xE8C39280,
+    (int32_t)0x82299971, (int32_t)0xE8922622, (int32_t)0x8232D67F, (int32_t)0xE860BD61,
+    (int32_t)0x823C26F3, (int32_t)0xE82F5844, (int32_t)0x82458ACC, (int32_t)0xE7FDF6D4,
+    (int32_t)0x824F0208, (int32_t)0xE7CC9917, (int32_t)0x82588CA7, (int32_t)0xE79B3F16,
+    (int32_t)0x82622AA6, (int32_t)0xE769E8D8, (int32_t)0x826BDC04, (int32_t)0xE7389665,
+    (int32_t)0x8275A0C0, (int32_t)0xE70747C4, (int32_t)0x827F78D8, (int32_t)0xE6D5FCFC,
+    (int32_t)0x8289644B, (int32_t)0xE6A4B616, (int32_t)0x82936317, (int32_t)0xE6737319,
+    (int32_t)0x829D753A, (int32_t)0xE642340D, (int32_t)0x82A79AB3, (int32_t)0xE610F8F9,
+    (int32_t)0x82B1D381, (int32_t)0xE5DFC1E5, (int32_t)0x82BC1FA2, (int32_t)0xE5AE8ED8,
+    (int32_t)0x82C67F14, (int32_t)0xE57D5FDA, (int32_t)0x82D0F1D5, (int32_t)0xE54C34F3,
+    (int32_t)0x82DB77E5, (int32_t)0xE51B0E2A, (int32_t)0x82E61141, (int32_t)0xE4E9EB87,
+    (int32_t)0x82F0BDE8, (int32_t)0xE4B8CD11, (int32_t)0x82FB7DD8, (int32_t)0xE487B2D0,
+    (int32_t)0x83065110, (int32_t)0xE4569CCB, (int32_t)0x8311378D, (int32_t)0xE4258B0A,
+    (int32_t)0x831C314E, (int32_t)0xE3F47D96, (int32_t)0x83273E52, (int32_t)0xE3C37474,
+    (int32_t)0x83325E97, (int32_t)0xE3926FAD, (int32_t)0x833D921B, (int32_t)0xE3616F48,
+    (int32_t)0x8348D8DC, (int32_t)0xE330734D, (int32_t)0x835432D8, (int32_t)0xE2FF7BC3,
+    (int32_t)0x835FA00F, (int32_t)0xE2CE88B3, (int32_t)0x836B207D, (int32_t)0xE29D9A23,
+    (int32_t)0x8376B422, (int32_t)0xE26CB01B, (int32_t)0x83825AFB, (int32_t)0xE23BCAA2,
+    (int32_t)0x838E1507, (int32_t)0xE20AE9C1, (int32_t)0x8399E244, (int32_t)0xE1DA0D7E,
+    (int32_t)0x83A5C2B0, (int32_t)0xE1A935E2, (int32_t)0x83B1B649, (int32_t)0xE17862F3,
+    (int32_t)0x83BDBD0E, (int32_t)0xE14794BA, (int32_t)0x83C9D6FC, (int32_t)0xE116CB3D,
+    (int32_t)0x83D60412, (int32_t)0xE0E60685, (int32_t)0x83E2444D, (int32_t)0xE0B54698,
+    (int32_t)0x83EE97AD, (int32_t)0xE0848B7F, (int32_t)0x83FAFE2E, (int32_t)0xE053D541,
+    (int32_t)0x840777D0, (int32_t)0xE02323E5, (int32_t)0x84140490, (int32_t)0xDFF27773,
+    (int32_t)0x8420A46C, (int32_t)0xDFC1CFF3, (int32_t)0x842D5762, (int32_t)0xDF912D6B,
+    (int32_t)0x843A1D70, (int32_t)0xDF608FE4, (int32_t)0x8446F695, (int32_t)0xDF2FF764,
+    (int32_t)0x8453E2CF, (int32_t)0xDEFF63F4, (int32_t)0x8460E21A, (int32_t)0xDECED59B,
+    (int32_t)0x846DF477, (int32_t)0xDE9E4C60, (int32_t)0x847B19E1, (int32_t)0xDE6DC84B,
+    (int32_t)0x84885258, (int32_t)0xDE3D4964, (int32_t)0x84959DD9, (int32_t)0xDE0CCFB1,
+    (int32_t)0x84A2FC62, (int32_t)0xDDDC5B3B, (int32_t)0x84B06DF2, (int32_t)0xDDABEC08,
+    (int32_t)0x84BDF286, (int32_t)0xDD7B8220, (int32_t)0x84CB8A1B, (int32_t)0xDD4B1D8C,
+    (int32_t)0x84D934B1, (int32_t)0xDD1ABE51, (int32_t)0x84E6F244, (int32_t)0xDCEA6478,
+    (int32_t)0x84F4C2D4, (int32_t)0xDCBA1008, (int32_t)0x8502A65C, (int32_t)0xDC89C109,
+    (int32_t)0x85109CDD, (int32_t)0xDC597781, (int32_t)0x851EA652, (int32_t)0xDC293379,
+    (int32_t)0x852CC2BB, (int32_t)0xDBF8F4F8, (int32_t)0x853AF214, (int32_t)0xDBC8BC06,
+    (int32_t)0x8549345C, (int32_t)0xDB9888A8, (int32_t)0x85578991, (int32_t)0xDB685AE9,
+    (int32_t)0x8565F1B0, (int32_t)0xDB3832CD, (int32_t)0x85746CB8, (int32_t)0xDB08105E,
+    (int32_t)0x8582FAA5, (int32_t)0xDAD7F3A2, (int32_t)0x85919B76, (int32_t)0xDAA7DCA1,
+    (int32_t)0x85A04F28, (int32_t)0xDA77CB63, (int32_t)0x85AF15B9, (int32_t)0xDA47BFEE,
+    (int32_t)0x85BDEF28, (int32_t)0xDA17BA4A, (int32_t)0x85CCDB70, (int32_t)0xD9E7BA7F,
+    (int32_t)0x85DBDA91, (int32_t)0xD9B7C094, (int32_t)0x85EAEC88, (int32_t)0xD987CC90,
+    (int32_t)0x85FA1153, (int32_t)0xD957DE7A, (int32_t)0x860948EF, (int32_t)0xD927F65B,
+    (int32_t)0x86189359, (int32_t)0xD8F81439, (int32_t)0x8627F091, (int32_t)0xD8C8381D,
+    (int32_t)0x86376092, (int32_t)0xD898620C, (int32_t)0x8646E35C, (int32_t)0xD868920F,
+    (int32_t)0x865678EB, (int32_t)0xD838C82D, (int32_t)0x8666213C, (int32_t)0xD809046E,
+    (int32_t)0x8675DC4F, (int32_t)0xD7D946D8, (int32_t)0x8685AA20, (int32_t)0xD7A98F73,
+    (int32_t)0x86958AAC, (int32_t)0xD779DE47, (int32_t)0x86A57DF2, (int32_t)0xD74A335B,
+    (int32_t)0x86B583EE, (int32_t)0xD71A8EB5, (int32_t)0x86C59C9F, (int32_t)0xD6EAF05F,
+    (int32_t)0x86D5C802, (int32_t)0xD6BB585E, (int32_t)0x86E60614, (int32_t)0xD68BC6BA,
+    (int32_t)0x86F656D3, (int32_t)0xD65C3B7B, (int32_t)0x8706BA3D, (int32_t)0xD62CB6A8,
+    (int32_t)0x8717304E, (int32_t)0xD5FD3848, (int32_t)0x8727B905, (int32_t)0xD5CDC062,
+    (int32_t)0x8738545E, (int32_t)0xD59E4EFF, (int32_t)0x87490258, (int32_t)0xD56EE424,
+    (int32_t)0x8759C2EF, (int32_t)0xD53F7FDA, (int32_t)0x876A9621, (int32_t)0xD5102228,
+    (int32_t)0x877B7BEC, (int32_t)0xD4E0CB15, (int32_t)0x878C744D, (int32_t)0xD4B17AA8,
+    (int32_t)0x879D7F41, (int32_t)0xD48230E9, (int32_t)0x87AE9CC5, (int32_t)0xD452EDDF,
+    (int32_t)0x87BFCCD7, (int32_t)0xD423B191, (int32_t)0x87D10F75, (int32_t)0xD3F47C06,
+    (int32_t)0x87E2649B, (int32_t)0xD3C54D47, (int32_t)0x87F3CC48, (int32_t)0xD396255A,
+    (int32_t)0x88054677, (int32_t)0xD3670446, (int32_t)0x8816D327, (int32_t)0xD337EA12,
+    (int32_t)0x88287256, (int32_t)0xD308D6C7, (int32_t)0x883A23FF, (int32_t)0xD2D9CA6A,
+    (int32_t)0x884BE821, (int32_t)0xD2AAC504, (int32_t)0x885DBEB8, (int32_t)0xD27BC69C,
+    (int32_t)0x886FA7C2, (int32_t)0xD24CCF39, (int32_t)0x8881A33D, (int32_t)0xD21DDEE2,
+    (int32_t)0x8893B125, (int32_t)0xD1EEF59E, (int32_t)0x88A5D177, (int32_t)0xD1C01375,
+    (int32_t)0x88B80432, (int32_t)0xD191386E, (int32_t)0x88CA4951, (int32_t)0xD1626490,
+    (int32_t)0x88DCA0D3, (int32_t)0xD13397E2, (int32_t)0x88EF0AB4, (int32_t)0xD104D26B,
+    (int32_t)0x890186F2, (int32_t)0xD0D61434, (int32_t)0x89141589, (int32_t)0xD0A75D42,
+    (int32_t)0x8926B677, (int32_t)0xD078AD9E, (int32_t)0x893969B9, (int32_t)0xD04A054E,
+    (int32_t)0x894C2F4C, (int32_t)0xD01B6459, (int32_t)0x895F072E, (int32_t)0xCFECCAC7,
+    (int32_t)0x8971F15A, (int32_t)0xCFBE389F, (int32_t)0x8984EDCF, (int32_t)0xCF8FADE9,
+    (int32_t)0x8997FC8A, (int32_t)0xCF612AAA, (int32_t)0x89AB1D87, (int32_t)0xCF32AEEB,
+    (int32_t)0x89BE50C3, (int32_t)0xCF043AB3, (int32_t)0x89D1963C, (int32_t)0xCED5CE08,
+    (int32_t)0x89E4EDEF, (int32_t)0xCEA768F2, (int32_t)0x89F857D8, (int32_t)0xCE790B79,
+    (int32_t)0x8A0BD3F5, (int32_t)0xCE4AB5A2, (int32_t)0x8A1F6243, (int32_t)0xCE1C6777,
+    (int32_t)0x8A3302BE, (int32_t)0xCDEE20FC, (int32_t)0x8A46B564, (int32_t)0xCDBFE23A,
+    (int32_t)0x8A5A7A31, (int32_t)0xCD91AB39, (int32_t)0x8A6E5123, (int32_t)0xCD637BFE,
+    (int32_t)0x8A823A36, (int32_t)0xCD355491, (int32_t)0x8A963567, (int32_t)0xCD0734F9,
+    (int32_t)0x8AAA42B4, (int32_t)0xCCD91D3D, (int32_t)0x8ABE6219, (int32_t)0xCCAB0D65,
+    (int32_t)0x8AD29394, (int32_t)0xCC7D0578, (int32_t)0x8AE6D720, (int32_t)0xCC4F057C,
+    (int32_t)0x8AFB2CBB, (int32_t)0xCC210D79, (int32_t)0x8B0F9462, (int32_t)0xCBF31D75,
+    (int32_t)0x8B240E11, (int32_t)0xCBC53579, (int32_t)0x8B3899C6, (int32_t)0xCB97558A,
+    (int32_t)0x8B4D377C, (int32_t)0xCB697DB0, (int32_t)0x8B61E733, (int32_t)0xCB3BADF3,
+    (int32_t)0x8B76A8E4, (int32_t)0xCB0DE658, (int32_t)0x8B8B7C8F, (int32_t)0xCAE026E8,
+    (int32_t)0x8BA0622F, (int32_t)0xCAB26FA9, (int32_t)0x8BB559C1, (int32_t)0xCA84C0A3,
+    (int32_t)0x8BCA6343, (int32_t)0xCA5719DB, (int32_t)0x8BDF7EB0, (int32_t)0xCA297B5A,
+    (int32_t)0x8BF4AC05, (int32_t)0xC9FBE527, (int32_t)0x8C09EB40, (int32_t)0xC9CE5748,
+    (int32_t)0x8C1F3C5D, (int32_t)0xC9A0D1C5, (int32_t)0x8C349F58, (int32_t)0xC97354A4,
+    (int32_t)0x8C4A142F, (int32_t)0xC945DFEC, (int32_t)0x8C5F9ADE, (int32_t)0xC91873A5,
+    (int32_t)0x8C753362, (int32_t)0xC8EB0FD6, (int32_t)0x8C8ADDB7, (int32_t)0xC8BDB485,
+    (int32_t)0x8CA099DA, (int32_t)0xC89061BA, (int32_t)0x8CB667C8, (int32_t)0xC863177B,
+    (int32_t)0x8CCC477D, (int32_t)0xC835D5D0, (int32_t)0x8CE238F6, (int32_t)0xC8089CBF,
+    (int32_t)0x8CF83C30, (int32_t)0xC7DB6C50, (int32_t)0x8D0E5127, (int32_t)0xC7AE4489,
+    (int32_t)0x8D2477D8, (int32_t)0xC7812572, (int32_t)0x8D3AB03F, (int32_t)0xC7540F11,
+    (int32_t)0x8D50FA59, (int32_t)0xC727016D, (int32_t)0x8D675623, (int32_t)0xC6F9FC8D,
+    (int32_t)0x8D7DC399, (int32_t)0xC6CD0079, (int32_t)0x8D9442B8, (int32_t)0xC6A00D37,
+    (int32_t)0x8DAAD37B, (int32_t)0xC67322CE, (int32_t)0x8DC175E0, (int32_t)0xC6464144,
+    (int32_t)0x8DD829E4, (int32_t)0xC61968A2, (int32_t)0x8DEEEF82, (int32_t)0xC5EC98EE,
+    (int32_t)0x8E05C6B7, (int32_t)0xC5BFD22E, (int32_t)0x8E1CAF80, (int32_t)0xC593146A,
+    (int32_t)0x8E33A9DA, (int32_t)0xC5665FA9, (int32_t)0x8E4AB5BF, (int32_t)0xC539B3F1,
+    (int32_t)0x8E61D32E, (int32_t)0xC50D1149, (int32_t)0x8E790222, (int32_t)0xC4E077B8,
+    (int32_t)0x8E904298, (int32_t)0xC4B3E746, (int32_t)0x8EA7948C, (int32_t)0xC4875FF9,
+    (int32_t)0x8EBEF7FB, (int32_t)0xC45AE1D7, (int32_t)0x8ED66CE1, (int32_t)0xC42E6CE8,
+    (int32_t)0x8EEDF33B, (int32_t)0xC4020133, (int32_t)0x8F058B04, (int32_t)0xC3D59EBE,
+    (int32_t)0x8F1D343A, (int32_t)0xC3A94590, (int32_t)0x8F34EED8, (int32_t)0xC37CF5B0,
+    (int32_t)0x8F4CBADB, (int32_t)0xC350AF26, (int32_t)0x8F649840, (int32_t)0xC32471F7,
+    (int32_t)0x8F7C8701, (int32_t)0xC2F83E2A, (int32_t)0x8F94871D, (int32_t)0xC2CC13C7,
+    (int32_t)0x8FAC988F, (int32_t)0xC29FF2D4, (int32_t)0x8FC4BB53, (int32_t)0xC273DB58,
+    (int32_t)0x8FDCEF66, (int32_t)0xC247CD5A, (int32_t)0x8FF534C4, (int32_t)0xC21BC8E1,
+    (int32_t)0x900D8B69, (int32_t)0xC1EFCDF3, (int32_t)0x9025F352, (int32_t)0xC1C3DC97,
+    (int32_t)0x903E6C7B, (int32_t)0xC197F4D4, (int32_t)0x9056F6DF, (int32_t)0xC16C16B0,
+    (int32_t)0x906F927C, (int32_t)0xC1404233, (int32_t)0x90883F4D, (int32_t)0xC1147764,
+    (int32_t)0x90A0FD4E, (int32_t)0xC0E8B648, (int32_t)0x90B9CC7D, (int32_t)0xC0BCFEE7,
+    (int32_t)0x90D2ACD4, (int32_t)0xC0915148, (int32_t)0x90EB9E50, (int32_t)0xC065AD70,
+    (int32_t)0x9104A0EE, (int32_t)0xC03A1368, (int32_t)0x911DB4A9, (int32_t)0xC00E8336,
+    (int32_t)0x9136D97D, (int32_t)0xBFE2FCDF, (int32_t)0x91500F67, (int32_t)0xBFB7806C,
+    (int32_t)0x91695663, (int32_t)0xBF8C0DE3, (int32_t)0x9182AE6D, (int32_t)0xBF60A54A,
+    (int32_t)0x919C1781, (int32_t)0xBF3546A8, (int32_t)0x91B5919A, (int32_t)0xBF09F205,
+    (int32_t)0x91CF1CB6, (int32_t)0xBEDEA765, (int32_t)0x91E8B8D0, (int32_t)0xBEB366D1,
+    (int32_t)0x920265E4, (int32_t)0xBE88304F, (int32_t)0x921C23EF, (int32_t)0xBE5D03E6,
+    (int32_t)0x9235F2EC, (int32_t)0xBE31E19B, (int32_t)0x924FD2D7, (int32_t)0xBE06C977,
+    (int32_t)0x9269C3AC, (int32_t)0xBDDBBB7F, (int32_t)0x9283C568, (int32_t)0xBDB0B7BB,
+    (int32_t)0x929DD806, (int32_t)0xBD85BE30, (int32_t)0x92B7FB82, (int32_t)0xBD5ACEE5,
+    (int32_t)0x92D22FD9, (int32_t)0xBD2FE9E2, (int32_t)0x92EC7505, (int32_t)0xBD050F2C,
+    (int32_t)0x9306CB04, (int32_t)0xBCDA3ECB, (int32_t)0x932131D1, (int32_t)0xBCAF78C4,
+    (int32_t)0x933BA968, (int32_t)0xBC84BD1F, (int32_t)0x935631C5, (int32_t)0xBC5A0BE2,
+    (int32_t)0x9370CAE4, (int32_t)0xBC2F6513, (int32_t)0x938B74C1, (int32_t)0xBC04C8BA,
+    (int32_t)0x93A62F57, (int32_t)0xBBDA36DD, (int32_t)0x93C0FAA3, (int32_t)0xBBAFAF82,
+    (int32_t)0x93DBD6A0, (int32_t)0xBB8532B0, (int32_t)0x93F6C34A, (int32_t)0xBB5AC06D,
+    (int32_t)0x9411C09E, (int32_t)0xBB3058C0, (int32_t)0x942CCE96, (int32_t)0xBB05FBB0,
+    (int32_t)0x9447ED2F, (int32_t)0xBADBA943, (int32_t)0x94631C65, (int32_t)0xBAB16180,
+    (int32_t)0x947E5C33, (int32_t)0xBA87246D, (int32_t)0x9499AC95, (int32_t)0xBA5CF210,
+    (int32_t)0x94B50D87, (int32_t)0xBA32CA71, (int32_t)0x94D07F05, (int32_t)0xBA08AD95,
+    (int32_t)0x94EC010B, (int32_t)0xB9DE9B83, (int32_t)0x95079394, (int32_t)0xB9B49442,
+    (int32_t)0x9523369C, (int32_t)0xB98A97D8, (int32_t)0x953EEA1E, (int32_t)0xB960A64C,
+    (int32_t)0x955AAE17, (int32_t)0xB936BFA4, (int32_t)0x95768283, (int32_t)0xB90CE3E6,
+    (int32_t)0x9592675C, (int32_t)0xB8E31319, (int32_t)0x95AE5C9F, (int32_t)0xB8B94D44,
+    (int32_t)0x95CA6247, (int32_t)0xB88F926D, (int32_t)0x95E67850, (int32_t)0xB865E299,
+    (int32_t)0x96029EB6, (int32_t)0xB83C3DD1, (int32_t)0x961ED574, (int32_t)0xB812A41A,
+    (int32_t)0x963B1C86, (int32_t)0xB7E9157A, (int32_t)0x965773E7, (int32_t)0xB7BF91F8,
+    (int32_t)0x9673DB94, (int32_t)0xB796199B, (int32_t)0x96905388, (int32_t)0xB76CAC69,
+    (int32_t)0x96ACDBBE, (int32_t)0xB7434A67, (int32_t)0x96C97432, (int32_t)0xB719F39E,
+    (int32_t)0x96E61CE0, (int32_t)0xB6F0A812, (int32_t)0x9702D5C3, (int32_t)0xB6C767CA,
+    (int32_t)0x971F9ED7, (int32_t)0xB69E32CD, (int32_t)0x973C7817, (int32_t)0xB6750921,
+    (int32_t)0x9759617F, (int32_t)0xB64BEACD, (int32_t)0x97765B0A, (int32_t)0xB622D7D6,
+    (int32_t)0x979364B5, (int32_t)0xB5F9D043, (int32_t)0x97B07E7A, (int32_t)0xB5D0D41A,
+    (int32_t)0x97CDA855, (int32_t)0xB5A7E362, (int32_t)0x97EAE242, (int32_t)0xB57EFE22,
+    (int32_t)0x98082C3B, (int32_t)0xB556245E, (int32_t)0x9825863D, (int32_t)0xB52D561E,
+    (int32_t)0x9842F043, (int32_t)0xB5049368, (int32_t)0x98606A49, (int32_t)0xB4DBDC42,
+    (int32_t)0x987DF449, (int32_t)0xB4B330B3, (int32_t)0x989B8E40, (int32_t)0xB48A90C0,
+    (int32_t)0x98B93828, (int32_t)0xB461FC70, (int32_t)0x98D6F1FE, (int32_t)0xB43973CA,
+    (int32_t)0x98F4BBBC, (int32_t)0xB410F6D3, (int32_t)0x9912955F, (int32_t)0xB3E88592,
+    (int32_t)0x99307EE0, (int32_t)0xB3C0200C, (int32_t)0x994E783D, (int32_t)0xB397C649,
+    (int32_t)0x996C816F, (int32_t)0xB36F784F, (int32_t)0x998A9A74, (int32_t)0xB3473623,
+    (int32_t)0x99A8C345, (int32_t)0xB31EFFCC, (int32_t)0x99C6FBDE, (int32_t)0xB2F6D550,
+    (int32_t)0x99E5443B, (int32_t)0xB2CEB6B5, (int32_t)0x9A039C57, (int32_t)0xB2A6A402,
+    (int32_t)0x9A22042D, (int32_t)0xB27E9D3C, (int32_t)0x9A407BB9, (int32_t)0xB256A26A,
+    (int32_t)0x9A5F02F5, (int32_t)0xB22EB392, (int32_t)0x9A7D99DE, (int32_t)0xB206D0BA,
+    (int32_t)0x9A9C406E, (int32_t)0xB1DEF9E9, (int32_t)0x9ABAF6A1, (int32_t)0xB1B72F23,
+    (int32_t)0x9AD9BC71, (int32_t)0xB18F7071, (int32_t)0x9AF891DB, (int32_t)0xB167BDD7,
+    (int32_t)0x9B1776DA, (int32_t)0xB140175B, (int32_t)0x9B366B68, (int32_t)0xB1187D05,
+    (int32_t)0x9B556F81, (int32_t)0xB0F0EEDA, (int32_t)0x9B748320, (int32_t)0xB0C96CE0,
+    (int32_t)0x9B93A641, (int32_t)0xB0A1F71D, (int32_t)0x9BB2D8DE, (int32_t)0xB07A8D97,
+    (int32_t)0x9BD21AF3, (int32_t)0xB0533055, (int32_t)0x9BF16C7A, (int32_t)0xB02BDF5C,
+    (int32_t)0x9C10CD70, (int32_t)0xB0049AB3, (int32_t)0x9C303DCF, (int32_t)0xAFDD625F,
+    (int32_t)0x9C4FBD93, (int32_t)0xAFB63667, (int32_t)0x9C6F4CB6, (int32_t)0xAF8F16D1,
+    (int32_t)0x9C8EEB34, (int32_t)0xAF6803A2, (int32_t)0x9CAE9907, (int32_t)0xAF40FCE1,
+    (int32_t)0x9CCE562C, (int32_t)0xAF1A0293, (int32_t)0x9CEE229C, (int32_t)0xAEF314C0,
+    (int32_t)0x9D0DFE54, (int32_t)0xAECC336C, (int32_t)0x9D2DE94D, (int32_t)0xAEA55E9E,
+    (int32_t)0x9D4DE385, (int32_t)0xAE7E965B, (int32_t)0x9D6DECF4, (int32_t)0xAE57DAAB,
+    (int32_t)0x9D8E0597, (int32_t)0xAE312B92, (int32_t)0x9DAE2D68, (int32_t)0xAE0A8916,
+    (int32_t)0x9DCE6463, (int32_t)0xADE3F33E, (int32_t)0x9DEEAA82, (int32_t)0xADBD6A10,
+    (int32_t)0x9E0EFFC1, (int32_t)0xAD96ED92, (int32_t)0x9E2F641B, (int32_t)0xAD707DC8,
+    (int32_t)0x9E4FD78A, (int32_t)0xAD4A1ABA, (int32_t)0x9E705A09, (int32_t)0xAD23C46E,
+    (int32_t)0x9E90EB94, (int32_t)0xACFD7AE8, (int32_t)0x9EB18C26, (int32_t)0xACD73E30,
+    (int32_t)0x9ED23BB9, (int32_t)0xACB10E4B, (int32_t)0x9EF2FA49, (int32_t)0xAC8AEB3E,
+    (int32_t)0x9F13C7D0, (int32_t)0xAC64D510, (int32_t)0x9F34A449, (int32_t)0xAC3ECBC7,
+    (int32_t)0x9F558FB0, (int32_t)0xAC18CF69, (int32_t)0x9F7689FF, (int32_t)0xABF2DFFB,
+    (int32_t)0x9F979331, (int32_t)0xABCCFD83, (int32_t)0x9FB8AB41, (int32_t)0xABA72807,
+    (int32_t)0x9FD9D22A, (int32_t)0xAB815F8D, (int32_t)0x9FFB07E7, (int32_t)0xAB5BA41A,
+    (int32_t)0xA01C4C73, (int32_t)0xAB35F5B5, (int32_t)0xA03D9FC8, (int32_t)0xAB105464,
+    (int32_t)0xA05F01E1, (int32_t)0xAAEAC02C, (int32_t)0xA08072BA, (int32_t)0xAAC53912,
+    (int32_t)0xA0A1F24D, (int32_t)0xAA9FBF1E, (int32_t)0xA0C38095, (int32_t)0xAA7A5253,
+    (int32_t)0xA0E51D8C, (int32_t)0xAA54F2BA, (int32_t)0xA106C92F, (int32_t)0xAA2FA056,
+    (int32_t)0xA1288376, (int32_t)0xAA0A5B2E, (int32_t)0xA14A4C5E, (int32_t)0xA9E52347,
+    (int32_t)0xA16C23E1, (int32_t)0xA9BFF8A8, (int32_t)0xA18E09FA, (int32_t)0xA99ADB56,
+    (int32_t)0xA1AFFEA3, (int32_t)0xA975CB57, (int32_t)0xA1D201D7, (int32_t)0xA950C8B0,
+    (int32_t)0xA1F41392, (int32_t)0xA92BD367, (int32_t)0xA21633CD, (int32_t)0xA906EB82,
+    (int32_t)0xA2386284, (int32_t)0xA8E21106, (int32_t)0xA25A9FB1, (int32_t)0xA8BD43FA,
+    (int32_t)0xA27CEB4F, (int32_t)0xA8988463, (int32_t)0xA29F4559, (int32_t)0xA873D246,
+    (int32_t)0xA2C1ADC9, (int32_t)0xA84F2DAA, (int32_t)0xA2E4249B, (int32_t)0xA82A9693,
+    (int32_t)0xA306A9C8, (int32_t)0xA8060D08, (int32_t)0xA3293D4B, (int32_t)0xA7E1910F,
+    (int32_t)0xA34BDF20, (int32_t)0xA7BD22AC, (int32_t)0xA36E8F41, (int32_t)0xA798C1E5,
+    (int32_t)0xA3914DA8, (int32_t)0xA7746EC0, (int32_t)0xA3B41A50, (int32_t)0xA7502943,
+    (int32_t)0xA3D6F534, (int32_t)0xA72BF174, (int32_t)0xA3F9DE4E, (int32_t)0xA707C757,
+    (int32_t)0xA41CD599, (int32_t)0xA6E3AAF2, (int32_t)0xA43FDB10, (int32_t)0xA6BF9C4B,
+    (int32_t)0xA462EEAC, (int32_t)0xA69B9B68, (int32_t)0xA486106A, (int32_t)0xA677A84E,
+    (int32_t)0xA4A94043, (int32_t)0xA653C303, (int32_t)0xA4CC7E32, (int32_t)0xA62FEB8B,
+    (int32_t)0xA4EFCA31, (int32_t)0xA60C21EE, (int32_t)0xA513243B, (int32_t)0xA5E8662F,
+    (int32_t)0xA5368C4B, (int32_t)0xA5C4B855, (int32_t)0xA55A025B, (int32_t)0xA5A11866,
+    (int32_t)0xA57D8666, (int32_t)0xA57D8666, (int32_t)0xA5A11866, (int32_t)0xA55A025B,
+    (int32_t)0xA5C4B855, (int32_t)0xA5368C4B, (int32_t)0xA5E8662F, (int32_t)0xA513243B,
+    (int32_t)0xA60C21EE, (int32_t)0xA4EFCA31, (int32_t)0xA62FEB8B, (int32_t)0xA4CC7E32,
+    (int32_t)0xA653C303, (int32_t)0xA4A94043, (int32_t)0xA677A84E, (int32_t)0xA486106A,
+    (int32_t)0xA69B9B68, (int32_t)0xA462EEAC, (int32_t)0xA6BF9C4B, (int32_t)0xA43FDB10,
+    (int32_t)0xA6E3AAF2, (int32_t)0xA41CD599, (int32_t)0xA707C757, (int32_t)0xA3F9DE4E,
+    (int32_t)0xA72BF174, (int32_t)0xA3D6F534, (int32_t)0xA7502943, (int32_t)0xA3B41A50,
+    (int32_t)0xA7746EC0, (int32_t)0xA3914DA8, (int32_t)0xA798C1E5, (int32_t)0xA36E8F41,
+    (int32_t)0xA7BD22AC, (int32_t)0xA34BDF20, (int32_t)0xA7E1910F, (int32_t)0xA3293D4B,
+    (int32_t)0xA8060D08, (int32_t)0xA306A9C8, (int32_t)0xA82A9693, (int32_t)0xA2E4249B,
+    (int32_t)0xA84F2DAA, (int32_t)0xA2C1ADC9, (int32_t)0xA873D246, (int32_t)0xA29F4559,
+    (int32_t)0xA8988463, (int32_t)0xA27CEB4F, (int32_t)0xA8BD43FA, (int32_t)0xA25A9FB1,
+    (int32_t)0xA8E21106, (int32_t)0xA2386284, (int32_t)0xA906EB82, (int32_t)0xA21633CD,
+    (int32_t)0xA92BD367, (int32_t)0xA1F41392, (int32_t)0xA950C8B0, (int32_t)0xA1D201D7,
+    (int32_t)0xA975CB57, (int32_t)0xA1AFFEA3, (int32_t)0xA99ADB56, (int32_t)0xA18E09FA,
+    (int32_t)0xA9BFF8A8, (int32_t)0xA16C23E1, (int32_t)0xA9E52347, (int32_t)0xA14A4C5E,
+    (int32_t)0xAA0A5B2E, (int32_t)0xA1288376, (int32_t)0xAA2FA056, (int32_t)0xA106C92F,
+    (int32_t)0xAA54F2BA, (int32_t)0xA0E51D8C, (int32_t)0xAA7A5253, (int32_t)0xA0C38095,
+    (int32_t)0xAA9FBF1E, (int32_t)0xA0A1F24D, (int32_t)0xAAC53912, (int32_t)0xA08072BA,
+    (int32_t)0xAAEAC02C, (int32_t)0xA05F01E1, (int32_t)0xAB105464, (int32_t)0xA03D9FC8,
+    (int32_t)0xAB35F5B5, (int32_t)0xA01C4C73, (int32_t)0xAB5BA41A, (int32_t)0x9FFB07E7,
+    (int32_t)0xAB815F8D, (int32_t)0x9FD9D22A, (int32_t)0xABA72807, (int32_t)0x9FB8AB41,
+    (int32_t)0xABCCFD83, (int32_t)0x9F979331, (int32_t)0xABF2DFFB, (int32_t)0x9F7689FF,
+    (int32_t)0xAC18CF69, (int32_t)0x9F558FB0, (int32_t)0xAC3ECBC7, (int32_t)0x9F34A449,
+    (int32_t)0xAC64D510, (int32_t)0x9F13C7D0, (int32_t)0xAC8AEB3E, (int32_t)0x9EF2FA49,
+    (int32_t)0xACB10E4B, (int32_t)0x9ED23BB9, (int32_t)0xACD73E30, (int32_t)0x9EB18C26,
+    (int32_t)0xACFD7AE8, (int32_t)0x9E90EB94, (int32_t)0xAD23C46E, (int32_t)0x9E705A09,
+    (int32_t)0xAD4A1ABA, (int32_t)0x9E4FD78A, (int32_t)0xAD707DC8, (int32_t)0x9E2F641B,
+    (int32_t)0xAD96ED92, (int32_t)0x9E0EFFC1, (int32_t)0xADBD6A10, (int32_t)0x9DEEAA82,
+    (int32_t)0xADE3F33E, (int32_t)0x9DCE6463, (int32_t)0xAE0A8916, (int32_t)0x9DAE2D68,
+    (int32_t)0xAE312B92, (int32_t)0x9D8E0597, (int32_t)0xAE57DAAB, (int32_t)0x9D6DECF4,
+    (int32_t)0xAE7E965B, (int32_t)0x9D4DE385, (int32_t)0xAEA55E9E, (int32_t)0x9D2DE94D,
+    (int32_t)0xAECC336C, (int32_t)0x9D0DFE54, (int32_t)0xAEF314C0, (int32_t)0x9CEE229C,
+    (int32_t)0xAF1A0293, (int32_t)0x9CCE562C, (int32_t)0xAF40FCE1, (int32_t)0x9CAE9907,
+    (int32_t)0xAF6803A2, (int32_t)0x9C8EEB34, (int32_t)0xAF8F16D1, (int32_t)0x9C6F4CB6,
+    (int32_t)0xAFB63667, (int32_t)0x9C4FBD93, (int32_t)0xAFDD625F, (int32_t)0x9C303DCF,
+    (int32_t)0xB0049AB3, (int32_t)0x9C10CD70, (int32_t)0xB02BDF5C, (int32_t)0x9BF16C7A,
+    (int32_t)0xB0533055, (int32_t)0x9BD21AF3, (int32_t)0xB07A8D97, (int32_t)0x9BB2D8DE,
+    (int32_t)0xB0A1F71D, (int32_t)0x9B93A641, (int32_t)0xB0C96CE0, (int32_t)0x9B748320,
+    (int32_t)0xB0F0EEDA, (int32_t)0x9B556F81, (int32_t)0xB1187D05, (int32_t)0x9B366B68,
+    (int32_t)0xB140175B, (int32_t)0x9B1776DA, (int32_t)0xB167BDD7, (int32_t)0x9AF891DB,
+    (int32_t)0xB18F7071, (int32_t)0x9AD9BC71, (int32_t)0xB1B72F23, (int32_t)0x9ABAF6A1,
+    (int32_t)0xB1DEF9E9, (int32_t)0x9A9C406E, (int32_t)0xB206D0BA, (int32_t)0x9A7D99DE,
+    (int32_t)0xB22EB392, (int32_t)0x9A5F02F5, (int32_t)0xB256A26A, (int32_t)0x9A407BB9,
+    (int32_t)0xB27E9D3C, (int32_t)0x9A22042D, (int32_t)0xB2A6A402, (int32_t)0x9A039C57,
+    (int32_t)0xB2CEB6B5, (int32_t)0x99E5443B, (int32_t)0xB2F6D550, (int32_t)0x99C6FBDE,
+    (int32_t)0xB31EFFCC, (int32_t)0x99A8C345, (int32_t)0xB3473623, (int32_t)0x998A9A74,
+    (int32_t)0xB36F784F, (int32_t)0x996C816F, (int32_t)0xB397C649, (int32_t)0x994E783D,
+    (int32_t)0xB3C0200C, (int32_t)0x99307EE0, (int32_t)0xB3E88592, (int32_t)0x9912955F,
+    (int32_t)0xB410F6D3, (int32_t)0x98F4BBBC, (int32_t)0xB43973CA, (int32_t)0x98D6F1FE,
+    (int32_t)0xB461FC70, (int32_t)0x98B93828, (int32_t)0xB48A90C0, (int32_t)0x989B8E40,
+    (int32_t)0xB4B330B3, (int32_t)0x987DF449, (int32_t)0xB4DBDC42, (int32_t)0x98606A49,
+    (int32_t)0xB5049368, (int32_t)0x9842F043, (int32_t)0xB52D561E, (int32_t)0x9825863D,
+    (int32_t)0xB556245E, (int32_t)0x98082C3B, (int32_t)0xB57EFE22, (int32_t)0x97EAE242,
+    (int32_t)0xB5A7E362, (int32_t)0x97CDA855, (int32_t)0xB5D0D41A, (int32_t)0x97B07E7A,
+    (int32_t)0xB5F9D043, (int32_t)0x979364B5, (int32_t)0xB622D7D6, (int32_t)0x97765B0A,
+    (int32_t)0xB64BEACD, (int32_t)0x9759617F, (int32_t)0xB6750921, (int32_t)0x973C7817,
+    (int32_t)0xB69E32CD, (int32_t)0x971F9ED7, (int32_t)0xB6C767CA, (int32_t)0x9702D5C3,
+    (int32_t)0xB6F0A812, (int32_t)0x96E61CE0, (int32_t)0xB719F39E, (int32_t)0x96C97432,
+    (int32_t)0xB7434A67, (int32_t)0x96ACDBBE, (int32_t)0xB76CAC69, (int32_t)0x96905388,
+    (int32_t)0xB796199B, (int32_t)0x9673DB94, (int32_t)0xB7BF91F8, (int32_t)0x965773E7,
+    (int32_t)0xB7E9157A, (int32_t)0x963B1C86, (int32_t)0xB812A41A, (int32_t)0x961ED574,
+    (int32_t)0xB83C3DD1, (int32_t)0x96029EB6, (int32_t)0xB865E299, (int32_t)0x95E67850,
+    (int32_t)0xB88F926D, (int32_t)0x95CA6247, (int32_t)0xB8B94D44, (int32_t)0x95AE5C9F,
+    (int32_t)0xB8E31319, (int32_t)0x9592675C, (int32_t)0xB90CE3E6, (int32_t)0x95768283,
+    (int32_t)0xB936BFA4, (int32_t)0x955AAE17, (int32_t)0xB960A64C, (int32_t)0x953EEA1E,
+    (int32_t)0xB98A97D8, (int32_t)0x9523369C, (int32_t)0xB9B49442, (int32_t)0x95079394,
+    (int32_t)0xB9DE9B83, (int32_t)0x94EC010B, (int32_t)0xBA08AD95, (int32_t)0x94D07F05,
+    (int32_t)0xBA32CA71, (int32_t)0x94B50D87, (int32_t)0xBA5CF210, (int32_t)0x9499AC95,
+    (int32_t)0xBA87246D, (int32_t)0x947E5C33, (int32_t)0xBAB16180, (int32_t)0x94631C65,
+    (int32_t)0xBADBA943, (int32_t)0x9447ED2F, (int32_t)0xBB05FBB0, (int32_t)0x942CCE96,
+    (int32_t)0xBB3058C0, (int32_t)0x9411C09E, (int32_t)0xBB5AC06D, (int32_t)0x93F6C34A,
+    (int32_t)0xBB8532B0, (int32_t)0x93DBD6A0, (int32_t)0xBBAFAF82, (int32_t)0x93C0FAA3,
+    (int32_t)0xBBDA36DD, (int32_t)0x93A62F57, (int32_t)0xBC04C8BA, (int32_t)0x938B74C1,
+    (int32_t)0xBC2F6513, (int32_t)0x9370CAE4, (int32_t)0xBC5A0BE2, (int32_t)0x935631C5,
+    (int32_t)0xBC84BD1F, (int32_t)0x933BA968, (int32_t)0xBCAF78C4, (int32_t)0x932131D1,
+    (int32_t)0xBCDA3ECB, (int32_t)0x9306CB04, (int32_t)0xBD050F2C, (int32_t)0x92EC7505,
+    (int32_t)0xBD2FE9E2, (int32_t)0x92D22FD9, (int32_t)0xBD5ACEE5, (int32_t)0x92B7FB82,
+    (int32_t)0xBD85BE30, (int32_t)0x929DD806, (int32_t)0xBDB0B7BB, (int32_t)0x9283C568,
+    (int32_t)0xBDDBBB7F, (int32_t)0x9269C3AC, (int32_t)0xBE06C977, (int32_t)0x924FD2D7,
+    (int32_t)0xBE31E19B, (int32_t)0x9235F2EC, (int32_t)0xBE5D03E6, (int32_t)0x921C23EF,
+    (int32_t)0xBE88304F, (int32_t)0x920265E4, (int32_t)0xBEB366D1, (int32_t)0x91E8B8D0,
+    (int32_t)0xBEDEA765, (int32_t)0x91CF1CB6, (int32_t)0xBF09F205, (int32_t)0x91B5919A,
+    (int32_t)0xBF3546A8, (int32_t)0x919C1781, (int32_t)0xBF60A54A, (int32_t)0x9182AE6D,
+    (int32_t)0xBF8C0DE3, (int32_t)0x91695663, (int32_t)0xBFB7806C, (int32_t)0x91500F67,
+    (int32_t)0xBFE2FCDF, (int32_t)0x9136D97D, (int32_t)0xC00E8336, (int32_t)0x911DB4A9,
+    (int32_t)0xC03A1368, (int32_t)0x9104A0EE, (int32_t)0xC065AD70, (int32_t)0x90EB9E50,
+    (int32_t)0xC0915148, (int32_t)0x90D2ACD4, (int32_t)0xC0BCFEE7, (int32_t)0x90B9CC7D,
+    (int32_t)0xC0E8B648, (int32_t)0x90A0FD4E, (int32_t)0xC1147764, (int32_t)0x90883F4D,
+    (int32_t)0xC1404233, (int32_t)0x906F927C, (int32_t)0xC16C16B0, (int32_t)0x9056F6DF,
+    (int32_t)0xC197F4D4, (int32_t)0x903E6C7B, (int32_t)0xC1C3DC97, (int32_t)0x9025F352,
+    (int32_t)0xC1EFCDF3, (int32_t)0x900D8B69, (int32_t)0xC21BC8E1, (int32_t)0x8FF534C4,
+    (int32_t)0xC247CD5A, (int32_t)0x8FDCEF66, (int32_t)0xC273DB58, (int32_t)0x8FC4BB53,
+    (int32_t)0xC29FF2D4, (int32_t)0x8FAC988F, (int32_t)0xC2CC13C7, (int32_t)0x8F94871D,
+    (int32_t)0xC2F83E2A, (int32_t)0x8F7C8701, (int32_t)0xC32471F7, (int32_t)0x8F649840,
+    (int32_t)0xC350AF26, (int32_t)0x8F4CBADB, (int32_t)0xC37CF5B0, (int32_t)0x8F34EED8,
+    (int32_t)0xC3A94590, (int32_t)0x8F1D343A, (int32_t)0xC3D59EBE, (int32_t)0x8F058B04,
+    (int32_t)0xC4020133, (int32_t)0x8EEDF33B, (int32_t)0xC42E6CE8, (int32_t)0x8ED66CE1,
+    (int32_t)0xC45AE1D7, (int32_t)0x8EBEF7FB, (int32_t)0xC4875FF9, (int32_t)0x8EA7948C,
+    (int32_t)0xC4B3E746, (int32_t)0x8E904298, (int32_t)0xC4E077B8, (int32_t)0x8E790222,
+    (int32_t)0xC50D1149, (int32_t)0x8E61D32E, (int32_t)0xC539B3F1, (int32_t)0x8E4AB5BF,
+    (int32_t)0xC5665FA9, (int32_t)0x8E33A9DA, (int32_t)0xC593146A, (int32_t)0x8E1CAF80,
+    (int32_t)0xC5BFD22E, (int32_t)0x8E05C6B7, (int32_t)0xC5EC98EE, (int32_t)0x8DEEEF82,
+    (int32_t)0xC61968A2, (int32_t)0x8DD829E4, (int32_t)0xC6464144, (int32_t)0x8DC175E0,
+    (int32_t)0xC67322CE, (int32_t)0x8DAAD37B, (int32_t)0xC6A00D37, (int32_t)0x8D9442B8,
+    (int32_t)0xC6CD0079, (int32_t)0x8D7DC399, (int32_t)0xC6F9FC8D, (int32_t)0x8D675623,
+    (int32_t)0xC727016D, (int32_t)0x8D50FA59, (int32_t)0xC7540F11, (int32_t)0x8D3AB03F,
+    (int32_t)0xC7812572, (int32_t)0x8D2477D8, (int32_t)0xC7AE4489, (int32_t)0x8D0E5127,
+    (int32_t)0xC7DB6C50, (int32_t)0x8CF83C30, (int32_t)0xC8089CBF, (int32_t)0x8CE238F6,
+    (int32_t)0xC835D5D0, (int32_t)0x8CCC477D, (int32_t)0xC863177B, (int32_t)0x8CB667C8,
+    (int32_t)0xC89061BA, (int32_t)0x8CA099DA, (int32_t)0xC8BDB485, (int32_t)0x8C8ADDB7,
+    (int32_t)0xC8EB0FD6, (int32_t)0x8C753362, (int32_t)0xC91873A5, (int32_t)0x8C5F9ADE,
+    (int32_t)0xC945DFEC, (int32_t)0x8C4A142F, (int32_t)0xC97354A4, (int32_t)0x8C349F58,
+    (int32_t)0xC9A0D1C5, (int32_t)0x8C1F3C5D, (int32_t)0xC9CE5748, (int32_t)0x8C09EB40,
+    (int32_t)0xC9FBE527, (int32_t)0x8BF4AC05, (int32_t)0xCA297B5A, (int32_t)0x8BDF7EB0,
+    (int32_t)0xCA5719DB, (int32_t)0x8BCA6343, (int32_t)0xCA84C0A3, (int32_t)0x8BB559C1,
+    (int32_t)0xCAB26FA9, (int32_t)0x8BA0622F, (int32_t)0xCAE026E8, (int32_t)0x8B8B7C8F,
+    (int32_t)0xCB0DE658, (int32_t)0x8B76A8E4, (int32_t)0xCB3BADF3, (int32_t)0x8B61E733,
+    (int32_t)0xCB697DB0, (int32_t)0x8B4D377C, (int32_t)0xCB97558A, (int32_t)0x8B3899C6,
+    (int32_t)0xCBC53579, (int32_t)0x8B240E11, (int32_t)0xCBF31D75, (int32_t)0x8B0F9462,
+    (int32_t)0xCC210D79, (int32_t)0x8AFB2CBB, (int32_t)0xCC4F057C, (int32_t)0x8AE6D720,
+    (int32_t)0xCC7D0578, (int32_t)0x8AD29394, (int32_t)0xCCAB0D65, (int32_t)0x8ABE6219,
+    (int32_t)0xCCD91D3D, (int32_t)0x8AAA42B4, (int32_t)0xCD0734F9, (int32_t)0x8A963567,
+    (int32_t)0xCD355491, (int32_t)0x8A823A36, (int32_t)0xCD637BFE, (int32_t)0x8A6E5123,
+    (int32_t)0xCD91AB39, (int32_t)0x8A5A7A31, (int32_t)0xCDBFE23A, (int32_t)0x8A46B564,
+    (int32_t)0xCDEE20FC, (int32_t)0x8A3302BE, (int32_t)0xCE1C6777, (int32_t)0x8A1F6243,
+    (int32_t)0xCE4AB5A2, (int32_t)0x8A0BD3F5, (int32_t)0xCE790B79, (int32_t)0x89F857D8,
+    (int32_t)0xCEA768F2, (int32_t)0x89E4EDEF, (int32_t)0xCED5CE08, (int32_t)0x89D1963C,
+    (int32_t)0xCF043AB3, (int32_t)0x89BE50C3, (int32_t)0xCF32AEEB, (int32_t)0x89AB1D87,
+    (int32_t)0xCF612AAA, (int32_t)0x8997FC8A, (int32_t)0xCF8FADE9, (int32_t)0x8984EDCF,
+    (int32_t)0xCFBE389F, (int32_t)0x8971F15A, (int32_t)0xCFECCAC7, (int32_t)0x895F072E,
+    (int32_t)0xD01B6459, (int32_t)0x894C2F4C, (int32_t)0xD04A054E, (int32_t)0x893969B9,
+    (int32_t)0xD078AD9E, (int32_t)0x8926B677, (int32_t)0xD0A75D42, (int32_t)0x89141589,
+    (int32_t)0xD0D61434, (int32_t)0x890186F2, (int32_t)0xD104D26B, (int32_t)0x88EF0AB4,
+    (int32_t)0xD13397E2, (int32_t)0x88DCA0D3, (int32_t)0xD1626490, (int32_t)0x88CA4951,
+    (int32_t)0xD191386E, (int32_t)0x88B80432, (int32_t)0xD1C01375, (int32_t)0x88A5D177,
+    (int32_t)0xD1EEF59E, (int32_t)0x8893B125, (int32_t)0xD21DDEE2, (int32_t)0x8881A33D,
+    (int32_t)0xD24CCF39, (int32_t)0x886FA7C2, (int32_t)0xD27BC69C, (int32_t)0x885DBEB8,
+    (int32_t)0xD2AAC504, (int32_t)0x884BE821, (int32_t)0xD2D9CA6A, (int32_t)0x883A23FF,
+    (int32_t)0xD308D6C7, (int32_t)0x88287256, (int32_t)0xD337EA12, (int32_t)0x8816D327,
+    (int32_t)0xD3670446, (int32_t)0x88054677, (int32_t)0xD396255A, (int32_t)0x87F3CC48,
+    (int32_t)0xD3C54D47, (int32_t)0x87E2649B, (int32_t)0xD3F47C06, (int32_t)0x87D10F75,
+    (int32_t)0xD423B191, (int32_t)0x87BFCCD7, (int32_t)0xD452EDDF, (int32_t)0x87AE9CC5,
+    (int32_t)0xD48230E9, (int32_t)0x879D7F41, (int32_t)0xD4B17AA8, (int32_t)0x878C744D,
+    (int32_t)0xD4E0CB15, (int32_t)0x877B7BEC, (int32_t)0xD5102228, (int32_t)0x876A9621,
+    (int32_t)0xD53F7FDA, (int32_t)0x8759C2EF, (int32_t)0xD56EE424, (int32_t)0x87490258,
+    (int32_t)0xD59E4EFF, (int32_t)0x8738545E, (int32_t)0xD5CDC062, (int32_t)0x8727B905,
+    (int32_t)0xD5FD3848, (int32_t)0x8717304E, (int32_t)0xD62CB6A8, (int32_t)0x8706BA3D,
+    (int32_t)0xD65C3B7B, (int32_t)0x86F656D3, (int32_t)0xD68BC6BA, (int32_t)0x86E60614,
+    (int32_t)0xD6BB585E, (int32_t)0x86D5C802, (int32_t)0xD6EAF05F, (int32_t)0x86C59C9F,
+    (int32_t)0xD71A8EB5, (int32_t)0x86B583EE, (int32_t)0xD74A335B, (int32_t)0x86A57DF2,
+    (int32_t)0xD779DE47, (int32_t)0x86958AAC, (int32_t)0xD7A98F73, (int32_t)0x8685AA20,
+    (int32_t)0xD7D946D8, (int32_t)0x8675DC4F, (int32_t)0xD809046E, (int32_t)0x8666213C,
+    (int32_t)0xD838C82D, (int32_t)0x865678EB, (int32_t)0xD868920F, (int32_t)0x8646E35C,
+    (int32_t)0xD898620C, (int32_t)0x86376092, (int32_t)0xD8C8381D, (int32_t)0x8627F091,
+    (int32_t)0xD8F81439, (int32_t)0x86189359, (int32_t)0xD927F65B, (int32_t)0x860948EF,
+    (int32_t)0xD957DE7A, (int32_t)0x85FA1153, (int32_t)0xD987CC90, (int32_t)0x85EAEC88,
+    (int32_t)0xD9B7C094, (int32_t)0x85DBDA91, (int32_t)0xD9E7BA7F, (int32_t)0x85CCDB70,
+    (int32_t)0xDA17BA4A, (int32_t)0x85BDEF28, (int32_t)0xDA47BFEE, (int32_t)0x85AF15B9,
+    (int32_t)0xDA77CB63, (int32_t)0x85A04F28, (int32_t)0xDAA7DCA1, (int32_t)0x85919B76,
+    (int32_t)0xDAD7F3A2, (int32_t)0x8582FAA5, (int32_t)0xDB08105E, (int32_t)0x85746CB8,
+    (int32_t)0xDB3832CD, (int32_t)0x8565F1B0, (int32_t)0xDB685AE9, (int32_t)0x85578991,
+    (int32_t)0xDB9888A8, (int32_t)0x8549345C, (int32_t)0xDBC8BC06, (int32_t)0x853AF214,
+    (int32_t)0xDBF8F4F8, (int32_t)0x852CC2BB, (int32_t)0xDC293379, (int32_t)0x851EA652,
+    (int32_t)0xDC597781, (int32_t)0x85109CDD, (int32_t)0xDC89C109, (int32_t)0x8502A65C,
+    (int32_t)0xDCBA1008, (int32_t)0x84F4C2D4, (int32_t)0xDCEA6478, (int32_t)0x84E6F244,
+    (int32_t)0xDD1ABE51, (int32_t)0x84D934B1, (int32_t)0xDD4B1D8C, (int32_t)0x84CB8A1B,
+    (int32_t)0xDD7B8220, (int32_t)0x84BDF286, (int32_t)0xDDABEC08, (int32_t)0x84B06DF2,
+    (int32_t)0xDDDC5B3B, (int32_t)0x84A2FC62, (int32_t)0xDE0CCFB1, (int32_t)0x84959DD9,
+    (int32_t)0xDE3D4964, (int32_t)0x84885258, (int32_t)0xDE6DC84B, (int32_t)0x847B19E1,
+    (int32_t)0xDE9E4C60, (int32_t)0x846DF477, (int32_t)0xDECED59B, (int32_t)0x8460E21A,
+    (int32_t)0xDEFF63F4, (int32_t)0x8453E2CF, (int32_t)0xDF2FF764, (int32_t)0x8446F695,
+    (int32_t)0xDF608FE4, (int32_t)0x843A1D70, (int32_t)0xDF912D6B, (int32_t)0x842D5762,
+    (int32_t)0xDFC1CFF3, (int32_t)0x8420A46C, (int32_t)0xDFF27773, (int32_t)0x84140490,
+    (int32_t)0xE02323E5, (int32_t)0x840777D0, (int32_t)0xE053D541, (int32_t)0x83FAFE2E,
+    (int32_t)0xE0848B7F, (int32_t)0x83EE97AD, (int32_t)0xE0B54698, (int32_t)0x83E2444D,
+    (int32_t)0xE0E60685, (int32_t)0x83D60412, (int32_t)0xE116CB3D, (int32_t)0x83C9D6FC,
+    (int32_t)0xE14794BA, (int32_t)0x83BDBD0E, (int32_t)0xE17862F3, (int32_t)0x83B1B649,
+    (int32_t)0xE1A935E2, (int32_t)0x83A5C2B0, (int32_t)0xE1DA0D7E, (int32_t)0x8399E244,
+    (int32_t)0xE20AE9C1, (int32_t)0x838E1507, (int32_t)0xE23BCAA2, (int32_t)0x83825AFB,
+    (int32_t)0xE26CB01B, (int32_t)0x8376B422, (int32_t)0xE29D9A23, (int32_t)0x836B207D,
+    (int32_t)0xE2CE88B3, (int32_t)0x835FA00F, (int32_t)0xE2FF7BC3, (int32_t)0x835432D8,
+    (int32_t)0xE330734D, (int32_t)0x8348D8DC, (int32_t)0xE3616F48, (int32_t)0x833D921B,
+    (int32_t)0xE3926FAD, (int32_t)0x83325E97, (int32_t)0xE3C37474, (int32_t)0x83273E52,
+    (int32_t)0xE3F47D96, (int32_t)0x831C314E, (int32_t)0xE4258B0A, (int32_t)0x8311378D,
+    (int32_t)0xE4569CCB, (int32_t)0x83065110, (int32_t)0xE487B2D0, (int32_t)0x82FB7DD8,
+    (int32_t)0xE4B8CD11, (int32_t)0x82F0BDE8, (int32_t)0xE4E9EB87, (int32_t)0x82E61141,
+    (int32_t)0xE51B0E2A, (int32_t)0x82DB77E5, (int32_t)0xE54C34F3, (int32_t)0x82D0F1D5,
+    (int32_t)0xE57D5FDA, (int32_t)0x82C67F14, (int32_t)0xE5AE8ED8, (int32_t)0x82BC1FA2,
+    (int32_t)0xE5DFC1E5, (int32_t)0x82B1D381, (int32_t)0xE610F8F9, (int32_t)0x82A79AB3,
+    (int32_t)0xE642340D, (int32_t)0x829D753A, (int32_t)0xE6737319, (int32_t)0x82936317,
+    (int32_t)0xE6A4B616, (int32_t)0x8289644B, (int32_t)0xE6D5FCFC, (int32_t)0x827F78D8,
+    (int32_t)0xE70747C4, (int32_t)0x8275A0C0, (int32_t)0xE7389665, (int32_t)0x826BDC04,
+    (int32_t)0xE769E8D8, (int32_t)0x82622AA6, (int32_t)0xE79B3F16, (int32_t)0x82588CA7,
+    (int32_t)0xE7CC9917, (int32_t)0x824F0208, (int32_t)0xE7FDF6D4, (int32_t)0x82458ACC,
+    (int32_t)0xE82F5844, (int32_t)0x823C26F3, (int32_t)0xE860BD61, (int32_t)0x8232D67F,
+    (int32_t)0xE8922622, (int32_t)0x82299971, (int32_t)0xE8C39280, (int32_t)0x82206FCC,
+    (int32_t)0xE8F50273, (int32_t)0x82175990, (int32_t)0xE92675F4, (int32_t)0x820E56BE,
+    (int32_t)0xE957ECFB, (int32_t)0x82056758, (int32_t)0xE9896781, (int32_t)0x81FC8B60,
+    (int32_t)0xE9BAE57D, (int32_t)0x81F3C2D7, (int32_t)0xE9EC66E8, (int32_t)0x81EB0DBE,
+    (int32_t)0xEA1DEBBB, (int32_t)0x81E26C16, (int32_t)0xEA4F73EE, (int32_t)0x81D9DDE1,
+    (int32_t)0xEA80FF7A, (int32_t)0x81D16321, (int32_t)0xEAB28E56, (int32_t)0x81C8FBD6,
+    (int32_t)0xEAE4207A, (int32_t)0x81C0A801, (int32_t)0xEB15B5E1, (int32_t)0x81B867A5,
+    (int32_t)0xEB474E81, (int32_t)0x81B03AC2, (int32_t)0xEB78EA52, (int32_t)0x81A82159,
+    (int32_t)0xEBAA894F, (int32_t)0x81A01B6D, (int32_t)0xEBDC2B6E, (int32_t)0x819828FD,
+    (int32_t)0xEC0DD0A8, (int32_t)0x81904A0C, (int32_t)0xEC3F78F6, (int32_t)0x81887E9A,
+    (int32_t)0xEC71244F, (int32_t)0x8180C6A9, (int32_t)0xECA2D2AD, (int32_t)0x8179223A,
+    (int32_t)0xECD48407, (int32_t)0x8171914E, (int32_t)0xED063856, (int32_t)0x816A13E6,
+    (int32_t)0xED37EF91, (int32_t)0x8162AA04, (int32_t)0xED69A9B3, (int32_t)0x815B53A8,
+    (int32_t)0xED9B66B2, (int32_t)0x815410D4, (int32_t)0xEDCD2687, (int32_t)0x814CE188,
+    (int32_t)0xEDFEE92B, (int32_t)0x8145C5C7, (int32_t)0xEE30AE96, (int32_t)0x813EBD90,
+    (int32_t)0xEE6276BF, (int32_t)0x8137C8E6, (int32_t)0xEE9441A0, (int32_t)0x8130E7C9,
+    (int32_t)0xEEC60F31, (int32_t)0x812A1A3A, (int32_t)0xEEF7DF6A, (int32_t)0x8123603A,
+    (int32_t)0xEF29B243, (int32_t)0x811CB9CA, (int32_t)0xEF5B87B5, (int32_t)0x811626EC,
+    (int32_t)0xEF8D5FB8, (int32_t)0x810FA7A0, (int32_t)0xEFBF3A45, (int32_t)0x81093BE8,
+    (int32_t)0xEFF11753, (int32_t)0x8102E3C4, (int32_t)0xF022F6DA, (int32_t)0x80FC9F35,
+    (int32_t)0xF054D8D5, (int32_t)0x80F66E3C, (int32_t)0xF086BD39, (int32_t)0x80F050DB,
+    (int32_t)0xF0B8A401, (int32_t)0x80EA4712, (int32_t)0xF0EA8D24, (int32_t)0x80E450E2,
+    (int32_t)0xF11C789A, (int32_t)0x80DE6E4C, (int32_t)0xF14E665C, (int32_t)0x80D89F51,
+    (int32_t)0xF1805662, (int32_t)0x80D2E3F2, (int32_t)0xF1B248A5, (int32_t)0x80CD3C2F,
+    (int32_t)0xF1E43D1C, (int32_t)0x80C7A80A, (int32_t)0xF21633C0, (int32_t)0x80C22784,
+    (int32_t)0xF2482C8A, (int32_t)0x80BCBA9D, (int32_t)0xF27A2771, (int32_t)0x80B76156,
+    (int32_t)0xF2AC246E, (int32_t)0x80B21BAF, (int32_t)0xF2DE2379, (int32_t)0x80ACE9AB,
+    (int32_t)0xF310248A, (int32_t)0x80A7CB49, (int32_t)0xF342279B, (int32_t)0x80A2C08B,
+    (int32_t)0xF3742CA2, (int32_t)0x809DC971, (int32_t)0xF3A63398, (int32_t)0x8098E5FB,
+    (int32_t)0xF3D83C77, (int32_t)0x8094162C, (int32_t)0xF40A4735, (int32_t)0x808F5A02,
+    (int32_t)0xF43C53CB, (int32_t)0x808AB180, (int32_t)0xF46E6231, (int32_t)0x80861CA6,
+    (int32_t)0xF4A07261, (int32_t)0x80819B74, (int32_t)0xF4D28451, (int32_t)0x807D2DEC,
+    (int32_t)0xF50497FB, (int32_t)0x8078D40D, (int32_t)0xF536AD56, (int32_t)0x80748DD9,
+    (int32_t)0xF568C45B, (int32_t)0x80705B50, (int32_t)0xF59ADD02, (int32_t)0x806C3C74,
+    (int32_t)0xF5CCF743, (int32_t)0x80683143, (int32_t)0xF5FF1318, (int32_t)0x806439C0,
+    (int32_t)0xF6313077, (int32_t)0x806055EB, (int32_t)0xF6634F59, (int32_t)0x805C85C4,
+    (int32_t)0xF6956FB7, (int32_t)0x8058C94C, (int32_t)0xF6C79188, (int32_t)0x80552084,
+    (int32_t)0xF6F9B4C6, (int32_t)0x80518B6B, (int32_t)0xF72BD967, (int32_t)0x804E0A04,
+    (int32_t)0xF75DFF66, (int32_t)0x804A9C4D, (int32_t)0xF79026B9, (int32_t)0x80474248,
+    (int32_t)0xF7C24F59, (int32_t)0x8043FBF6, (int32_t)0xF7F4793E, (int32_t)0x8040C956,
+    (int32_t)0xF826A462, (int32_t)0x803DAA6A, (int32_t)0xF858D0BB, (int32_t)0x803A9F31,
+    (int32_t)0xF88AFE42, (int32_t)0x8037A7AC, (int32_t)0xF8BD2CEF, (int32_t)0x8034C3DD,
+    (int32_t)0xF8EF5CBB, (int32_t)0x8031F3C2, (int32_t)0xF9218D9E, (int32_t)0x802F375D,
+    (int32_t)0xF953BF91, (int32_t)0x802C8EAD, (int32_t)0xF985F28A, (int32_t)0x8029F9B4,
+    (int32_t)0xF9B82684, (int32_t)0x80277872, (int32_t)0xF9EA5B75, (int32_t)0x80250AE7,
+    (int32_t)0xFA1C9157, (int32_t)0x8022B114, (int32_t)0xFA4EC821, (int32_t)0x80206AF8,
+    (int32_t)0xFA80FFCB, (int32_t)0x801E3895, (int32_t)0xFAB3384F, (int32_t)0x801C19EA,
+    (int32_t)0xFAE571A4, (int32_t)0x801A0EF8, (int32_t)0xFB17ABC2, (int32_t)0x801817BF,
+    (int32_t)0xFB49E6A3, (int32_t)0x80163440, (int32_t)0xFB7C223D, (int32_t)0x8014647B,
+    (int32_t)0xFBAE5E89, (int32_t)0x8012A86F, (int32_t)0xFBE09B80, (int32_t)0x8011001F,
+    (int32_t)0xFC12D91A, (int32_t)0x800F6B88, (int32_t)0xFC45174E, (int32_t)0x800DEAAD,
+    (int32_t)0xFC775616, (int32_t)0x800C7D8C, (int32_t)0xFCA9956A, (int32_t)0x800B2427,
+    (int32_t)0xFCDBD541, (int32_t)0x8009DE7E, (int32_t)0xFD0E1594, (int32_t)0x8008AC90,
+    (int32_t)0xFD40565C, (int32_t)0x80078E5E, (int32_t)0xFD729790, (int32_t)0x800683E8,
+    (int32_t)0xFDA4D929, (int32_t)0x80058D2F, (int32_t)0xFDD71B1E, (int32_t)0x8004AA32,
+    (int32_t)0xFE095D69, (int32_t)0x8003DAF1, (int32_t)0xFE3BA002, (int32_t)0x80031F6D,
+    (int32_t)0xFE6DE2E0, (int32_t)0x800277A6, (int32_t)0xFEA025FD, (int32_t)0x8001E39B,
+    (int32_t)0xFED2694F, (int32_t)0x8001634E, (int32_t)0xFF04ACD0, (int32_t)0x8000F6BD,
+    (int32_t)0xFF36F078, (int32_t)0x80009DEA, (int32_t)0xFF69343F, (int32_t)0x800058D4,
+    (int32_t)0xFF9B781D, (int32_t)0x8000277A, (int32_t)0xFFCDBC0B, (int32_t)0x800009DF
+};
+
 const uint16_t plpBitRevIndexTable_fixed_16[PLPBITREVINDEXTABLE_FIXED_16_TABLE_LENGTH] = {
     /* radix 4, size 12 */
     8, 64, 16, 32, 24, 96, 40, 80, 56, 112, 88, 104
@@ -4454,3 +7700,1888 @@ const int16_t sinTable_q16[FAST_MATH_TABLE_SIZE + 1] = {
     -7962,  -7571,  -7180,  -6787,  -6393,  -5998,  -5602,  -5205,  -4808,  -4410,  -4011,  -3612,
     -3212,  -2811,  -2411,  -2009,  -1608,  -1206,  -804,   -402,   0
 };
+
+/**
+  @par
+  Twiddle factors of the mixed-radix FFT, generated with:
+  @par
+  <pre>for (i = 0; i < N; i++)
+  {
+     twiddleCoef[2*i]   = cos(i * 2*PI/(float)N);
+     twiddleCoef[2*i+1] = sin(i * 2*PI/(float)N);
+  } </pre>
+  @par
+  where N = 10, PI = 3.14159265358979
+ */
+const float32_t twiddleCoef_mixed_10_f32[20] = {
+    1.00000000f, 0.00000000f, 0.80901699f, 0.58778525f, 0.30901699f, 0.95105652f,
+    -0.30901699f, 0.95105652f, -0.80901699f, 0.58778525f, -1.00000000f, 0.00000000f,
+    -0.80901699f, -0.58778525f, -0.30901699f, -0.95105652f, 0.30901699f, -0.95105652f,
+    0.80901699f, -0.58778525f
+};
+
+/**
+  @par
+  Twiddle factors of the mixed-radix FFT, generated with:
+  @par
+  <pre>for (i = 0; i < N; i++)
+  {
+     twiddleCoef[2*i]   = cos(i * 2*PI/(float)N);
+     twiddleCoef[2*i+1] = sin(i * 2*PI/(float)N);
+  } </pre>
+  @par
+  where N = 12, PI = 3.14159265358979
+ */
+const float32_t twiddleCoef_mixed_12_f32[24] = {
+    1.00000000f, 0.00000000f, 0.86602540f, 0.50000000f, 0.50000000f, 0.86602540f,
+    0.00000000f, 1.00000000f, -0.50000000f, 0.86602540f, -0.86602540f, 0.50000000f,
+    -1.00000000f, 0.00000000f, -0.86602540f, -0.50000000f, -0.50000000f, -0.86602540f,
+    0.00000000f, -1.00000000f, 0.50000000f, -0.86602540f, 0.86602540f, -0.50000000f
+};
+
+/**
+  @par
+  Twiddle factors of the mixed-radix FFT, generated with:
+  @par
+  <pre>for (i = 0; i < N; i++)
+  {
+     twiddleCoef[2*i]   = cos(i * 2*PI/(float)N);
+     twiddleCoef[2*i+1] = sin(i * 2*PI/(float)N);
+  } </pre>
+  @par
+  where N = 16, PI = 3.14159265358979
+ */
+const float32_t twiddleCoef_mixed_16_f32[32] = {
+    1.00000000f, 0.00000000f, 0.92387953f, 0.38268343f, 0.70710678f, 0.70710678f,
+    0.38268343f, 0.92387953f, 0.00000000f, 1.00000000f, -0.38268343f, 0.92387953f,
+    -0.70710678f, 0.70710678f, -0.92387953f, 0.38268343f, -1.00000000f, 0.00000000f,
+    -0.92387953f, -0.38268343f, -0.70710678f, -0.70710678f, -0.38268343f, -0.92387953f,
+    0.00000000f, -1.00000000f, 0.38268343f, -0.92387953f, 0.70710678f, -0.70710678f,
+    0.92387953f, -0.38268343f
+};
+
+/**
+  @par
+  Twiddle factors of the mixed-radix FFT, generated with:
+  @par
+  <pre>for (i = 0; i < N; i++)
+  {
+     twiddleCoef[2*i]   = cos(i * 2*PI/(float)N);
+     twiddleCoef[2*i+1] = sin(i * 2*PI/(float)N);
+  } </pre>
+  @par
+  where N = 20, PI = 3.14159265358979
+ */
+const float32_t twiddleCoef_mixed_20_f32[40] = {
+    1.00000000f, 0.00000000f, 0.95105652f, 0.30901699f, 0.80901699f, 0.58778525f,
+    0.58778525f, 0.80901699f, 0.30901699f, 0.95105652f, 0.00000000f, 1.00000000f,
+    -0.30901699f, 0.95105652f, -0.58778525f, 0.80901699f, -0.80901699f, 0.58778525f,
+    -0.95105652f, 0.30901699f, -1.00000000f, 0.00000000f, -0.95105652f, -0.30901699f,
+    -0.80901699f, -0.58778525f, -0.58778525f, -0.80901699f, -0.30901699f, -0.95105652f,
+    0.00000000f, -1.00000000f, 0.30901699f, -0.95105652f, 0.58778525f, -0.80901699f,
+    0.80901699f, -0.58778525f, 0.95105652f, -0.30901699f
+};
+
+/**
+  @par
+  Twiddle factors of the mixed-radix FFT, generated with:
+  @par
+  <pre>for (i = 0; i < N; i++)
+  {
+     twiddleCoef[2*i]   = cos(i * 2*PI/(float)N);
+     twiddleCoef[2*i+1] = sin(i * 2*PI/(float)N);
+  } </pre>
+  @par
+  where N = 64, PI = 3.14159265358979
+ */
+const float32_t twiddleCoef_mixed_64_f32[128] = {
+    1.00000000f, 0.00000000f, 0.99518473f, 0.09801714f, 0.98078528f, 0.19509032f,
+    0.95694034f, 0.29028468f, 0.92387953f, 0.38268343f, 0.88192126f, 0.47139674f,
+    0.83146961f, 0.55557023f, 0.77301045f, 0.63439328f, 0.70710678f, 0.70710678f,
+    0.63439328f, 0.77301045f, 0.55557023f, 0.83146961f, 0.47139674f, 0.88192126f,
+    0.38268343f, 0.92387953f, 0.29028468f, 0.95694034f, 0.19509032f, 0.98078528f,
+    0.09801714f, 0.99518473f, 0.00000000f, 1.00000000f, -0.09801714f, 0.99518473f,
+    -0.19509032f, 0.98078528f, -0.29028468f, 0.95694034f, -0.38268343f, 0.92387953f,
+    -0.47139674f, 0.88192126f, -0.55557023f, 0.83146961f, -0.63439328f, 0.77301045f,
+    -0.70710678f, 0.70710678f, -0.77301045f, 0.63439328f, -0.83146961f, 0.55557023f,
+    -0.88192126f, 0.47139674f, -0.92387953f, 0.38268343f, -0.95694034f, 0.29028468f,
+    -0.98078528f, 0.19509032f, -0.99518473f, 0.09801714f, -1.00000000f, 0.00000000f,
+    -0.99518473f, -0.09801714f, -0.98078528f, -0.19509032f, -0.95694034f, -0.29028468f,
+    -0.92387953f, -0.38268343f, -0.88192126f, -0.47139674f, -0.83146961f, -0.55557023f,
+    -0.77301045f, -0.63439328f, -0.70710678f, -0.70710678f, -0.63439328f, -0.77301045f,
+    -0.55557023f, -0.83146961f, -0.47139674f, -0.88192126f, -0.38268343f, -0.92387953f,
+    -0.29028468f, -0.95694034f, -0.19509032f, -0.98078528f, -0.09801714f, -0.99518473f,
+    0.00000000f, -1.00000000f, 0.09801714f, -0.99518473f, 0.19509032f, -0.98078528f,
+    0.29028468f, -0.95694034f, 0.38268343f, -0.92387953f, 0.47139674f, -0.88192126f,
+    0.55557023f, -0.83146961f, 0.63439328f, -0.77301045f, 0.70710678f, -0.70710678f,
+    0.77301045f, -0.63439328f, 0.83146961f, -0.55557023f, 0.88192126f, -0.47139674f,
+    0.92387953f, -0.38268343f, 0.95694034f, -0.29028468f, 0.98078528f, -0.19509032f,
+    0.99518473f, -0.09801714f
+};
+
+/**
+  @par
+  Twiddle factors of the mixed-radix FFT, generated with:
+  @par
+  <pre>for (i = 0; i < N; i++)
+  {
+     twiddleCoef[2*i]   = cos(i * 2*PI/(float)N);
+     twiddleCoef[2*i+1] = sin(i * 2*PI/(float)N);
+  } </pre>
+  @par
+  where N = 128, PI = 3.14159265358979
+ */
+const float32_t twiddleCoef_mixed_128_f32[256] = {
+    1.00000000f, 0.00000000f, 0.99879546f, 0.04906767f, 0.99518473f, 0.09801714f,
+    0.98917651f, 0.14673047f, 0.98078528f, 0.19509032f, 0.97003125f, 0.24298018f,
+    0.95694034f, 0.29028468f, 0.94154407f, 0.33688985f, 0.92387953f, 0.38268343f,
+    0.90398929f, 0.42755509f, 0.88192126f, 0.47139674f, 0.85772861f, 0.51410274f,
+    0.83146961f, 0.55557023f, 0.80320753f, 0.59569930f, 0.77301045f, 0.63439328f,
+    0.74095113f, 0.67155895f, 0.70710678f, 0.70710678f, 0.67155895f, 0.74095113f,
+    0.63439328f, 0.77301045f, 0.59569930f, 0.80320753f, 0.55557023f, 0.83146961f,
+    0.51410274f, 0.85772861f, 0.47139674f, 0.88192126f, 0.42755509f, 0.90398929f,
+    0.38268343f, 0.92387953f, 0.33688985f, 0.94154407f, 0.29028468f, 0.95694034f,
+    0.24298018f, 0.97003125f, 0.19509032f, 0.98078528f, 0.14673047f, 0.98917651f,
+    0.09801714f, 0.99518473f, 0.04906767f, 0.99879546f, 0.00000000f, 1.00000000f,
+    -0.04906767f, 0.99879546f, -0.09801714f, 0.99518473f, -0.14673047f, 0.98917651f,
+    -0.19509032f, 0.98078528f, -0.24298018f, 0.97003125f, -0.29028468f, 0.95694034f,
+    -0.33688985f, 0.94154407f, -0.38268343f, 0.92387953f, -0.42755509f, 0.90398929f,
+    -0.47139674f, 0.88192126f, -0.51410274f, 0.85772861f, -0.55557023f, 0.83146961f,
+    -0.59569930f, 0.80320753f, -0.63439328f, 0.77301045f, -0.67155895f, 0.74095113f,
+    -0.70710678f, 0.70710678f, -0.74095113f, 0.67155895f, -0.77301045f, 0.63439328f,
+    -0.80320753f, 0.59569930f, -0.83146961f, 0.55557023f, -0.85772861f, 0.51410274f,
+    -0.88192126f, 0.47139674f, -0.90398929f, 0.42755509f, -0.92387953f, 0.38268343f,
+    -0.94154407f, 0.33688985f, -0.95694034f, 0.29028468f, -0.97003125f, 0.24298018f,
+    -0.98078528f, 0.19509032f, -0.98917651f, 0.14673047f, -0.99518473f, 0.09801714f,
+    -0.99879546f, 0.04906767f, -1.00000000f, 0.00000000f, -0.99879546f, -0.04906767f,
+    -0.99518473f, -0.09801714f, -0.98917651f, -0.14673047f, -0.98078528f, -0.19509032f,
+    -0.97003125f, -0.24298018f, -0.95694034f, -0.29028468f, -0.94154407f, -0.33688985f,
+    -0.92387953f, -0.38268343f, -0.90398929f, -0.42755509f, -0.88192126f, -0.47139674f,
+    -0.85772861f, -0.51410274f, -0.83146961f, -0.55557023f, -0.80320753f, -0.59569930f,
+    -0.77301045f, -0.63439328f, -0.74095113f, -0.67155895f, -0.70710678f, -0.70710678f,
+    -0.67155895f, -0.74095113f, -0.63439328f, -0.77301045f, -0.59569930f, -0.80320753f,
+    -0.55557023f, -0.83146961f, -0.51410274f, -0.85772861f, -0.47139674f, -0.88192126f,
+    -0.42755509f, -0.90398929f, -0.38268343f, -0.92387953f, -0.33688985f, -0.94154407f,
+    -0.29028468f, -0.95694034f, -0.24298018f, -0.97003125f, -0.19509032f, -0.98078528f,
+    -0.14673047f, -0.98917651f, -0.09801714f, -0.99518473f, -0.04906767f, -0.99879546f,
+    0.00000000f, -1.00000000f, 0.04906767f, -0.99879546f, 0.09801714f, -0.99518473f,
+    0.14673047f, -0.98917651f, 0.19509032f, -0.98078528f, 0.24298018f, -0.97003125f,
+    0.29028468f, -0.95694034f, 0.33688985f, -0.94154407f, 0.38268343f, -0.92387953f,
+    0.42755509f, -0.90398929f, 0.47139674f, -0.88192126f, 0.51410274f, -0.85772861f,
+    0.55557023f, -0.83146961f, 0.59569930f, -0.80320753f, 0.63439328f, -0.77301045f,
+    0.67155895f, -0.74095113f, 0.70710678f, -0.70710678f, 0.74095113f, -0.67155895f,
+    0.77301045f, -0.63439328f, 0.80320753f, -0.59569930f, 0.83146961f, -0.55557023f,
+    0.85772861f, -0.51410274f, 0.88192126f, -0.47139674f, 0.90398929f, -0.42755509f,
+    0.92387953f, -0.38268343f, 0.94154407f, -0.33688985f, 0.95694034f, -0.29028468f,
+    0.97003125f, -0.24298018f, 0.98078528f, -0.19509032f, 0.98917651f, -0.14673047f,
+    0.99518473f, -0.09801714f, 0.99879546f, -0.04906767f
+};
+
+/**
+  @par
+  Twiddle factors of the mixed-radix FFT, generated with:
+  @par
+  <pre>for (i = 0; i < N; i++)
+  {
+     twiddleCoef[2*i]   = cos(i * 2*PI/(float)N);
+     twiddleCoef[2*i+1] = sin(i * 2*PI/(float)N);
+  } </pre>
+  @par
+  where N = 256, PI = 3.14159265358979
+ */
+const float32_t twiddleCoef_mixed_256_f32[512] = {
+    1.00000000f, 0.00000000f, 0.99969882f, 0.02454123f, 0.99879546f, 0.04906767f,
+    0.99729046f, 0.07356456f, 0.99518473f, 0.09801714f, 0.99247953f, 0.12241068f,
+    0.98917651f, 0.14673047f, 0.98527764f, 0.17096189f, 0.98078528f, 0.19509032f,
+    0.97570213f, 0.21910124f, 0.97003125f, 0.24298018f, 0.96377607f, 0.26671276f,
+    0.95694034f, 0.29028468f, 0.94952818f, 0.31368174f, 0.94154407f, 0.33688985f,
+    0.93299280f, 0.35989504f, 0.92387953f, 0.38268343f, 0.91420976f, 0.40524131f,
+    0.90398929f, 0.42755509f, 0.89322430f, 0.44961133f, 0.88192126f, 0.47139674f,
+    0.87008699f, 0.49289819f, 0.85772861f, 0.51410274f, 0.84485357f, 0.53499762f,
+    0.83146961f, 0.55557023f, 0.81758481f, 0.57580819f, 0.80320753f, 0.59569930f,
+    0.78834643f, 0.61523159f, 0.77301045f, 0.63439328f, 0.75720885f, 0.65317284f,
+    0.74095113f, 0.67155895f, 0.72424708f, 0.68954054f, 0.70710678f, 0.70710678f,
+    0.68954054f, 0.72424708f, 0.67155895f, 0.74095113f, 0.65317284f, 0.75720885f,
+    0.63439328f, 0.77301045f, 0.61523159f, 0.78834643f, 0.59569930f, 0.80320753f,
+    0.57580819f, 0.81758481f, 0.55557023f, 0.83146961f, 0.53499762f, 0.84485357f,
+    0.51410274f, 0.85772861f, 0.49289819f, 0.87008699f, 0.47139674f, 0.88192126f,
+    0.44961133f, 0.89322430f, 0.42755509f, 0.90398929f, 0.40524131f, 0.91420976f,
+    0.38268343f, 0.92387953f, 0.35989504f, 0.93299280f, 0.33688985f, 0.94154407f,
+    0.31368174f, 0.94952818f, 0.29028468f, 0.95694034f, 0.26671276f, 0.96377607f,
+    0.24298018f, 0.97003125f, 0.21910124f, 0.97570213f, 0.19509032f, 0.98078528f,
+    0.17096189f, 0.98527764f, 0.14673047f, 0.98917651f, 0.12241068f, 0.99247953f,
+    0.09801714f, 0.99518473f, 0.07356456f, 0.99729046f, 0.04906767f, 0.99879546f,
+    0.02454123f, 0.99969882f, 0.00000000f, 1.00000000f, -0.02454123f, 0.99969882f,
+    -0.04906767f, 0.99879546f, -0.07356456f, 0.99729046f, -0.09801714f, 0.99518473f,
+    -0.12241068f, 0.99247953f, -0.14673047f, 0.98917651f, -0.17096189f, 0.98527764f,
+    -0.19509032f, 0.98078528f, -0.21910124f, 0.97570213f, -0.24298018f, 0.97003125f,
+    -0.26671276f, 0.96377607f, -0.29028468f, 0.95694034f, -0.31368174f, 0.94952818f,
+    -0.33688985f, 0.94154407f, -0.35989504f, 0.93299280f, -0.38268343f, 0.92387953f,
+    -0.40524131f, 0.91420976f, -0.42755509f, 0.90398929f, -0.44961133f, 0.89322430f,
+    -0.47139674f, 0.88192126f, -0.49289819f, 0.87008699f, -0.51410274f, 0.85772861f,
+    -0.53499762f, 0.84485357f, -0.55557023f, 0.83146961f, -0.57580819f, 0.81758481f,
+    -0.59569930f, 0.80320753f, -0.61523159f, 0.78834643f, -0.63439328f, 0.77301045f,
+    -0.65317284f, 0.75720885f, -0.67155895f, 0.74095113f, -0.68954054f, 0.72424708f,
+    -0.70710678f, 0.70710678f, -0.72424708f, 0.68954054f, -0.74095113f, 0.67155895f,
+    -0.75720885f, 0.65317284f, -0.77301045f, 0.63439328f, -0.78834643f, 0.61523159f,
+    -0.80320753f, 0.59569930f, -0.81758481f, 0.57580819f, -0.83146961f, 0.55557023f,
+    -0.84485357f, 0.53499762f, -0.85772861f, 0.51410274f, -0.87008699f, 0.49289819f,
+    -0.88192126f, 0.47139674f, -0.89322430f, 0.44961133f, -0.90398929f, 0.42755509f,
+    -0.91420976f, 0.40524131f, -0.92387953f, 0.38268343f, -0.93299280f, 0.35989504f,
+    -0.94154407f, 0.33688985f, -0.94952818f, 0.31368174f, -0.95694034f, 0.29028468f,
+    -0.96377607f, 0.26671276f, -0.97003125f, 0.24298018f, -0.97570213f, 0.21910124f,
+    -0.98078528f, 0.19509032f, -0.98527764f, 0.17096189f, -0.98917651f, 0.14673047f,
+    -0.99247953f, 0.12241068f, -0.99518473f, 0.09801714f, -0.99729046f, 0.07356456f,
+    -0.99879546f, 0.04906767f, -0.99969882f, 0.02454123f, -1.00000000f, 0.00000000f,
+    -0.99969882f, -0.02454123f, -0.99879546f, -0.04906767f, -0.99729046f, -0.07356456f,
+    -0.99518473f, -0.09801714f, -0.99247953f, -0.12241068f, -0.98917651f, -0.14673047f,
+    -0.98527764f, -0.17096189f, -0.98078528f, -0.19509032f, -0.97570213f, -0.21910124f,
+    -0.97003125f, -0.24298018f, -0.96377607f, -0.26671276f, -0.95694034f, -0.29028468f,
+    -0.94952818f, -0.31368174f, -0.94154407f, -0.33688985f, -0.93299280f, -0.35989504f,
+    -0.92387953f, -0.38268343f, -0.91420976f, -0.40524131f, -0.90398929f, -0.42755509f,
+    -0.89322430f, -0.44961133f, -0.88192126f, -0.47139674f, -0.87008699f, -0.49289819f,
+    -0.85772861f, -0.51410274f, -0.84485357f, -0.53499762f, -0.83146961f, -0.55557023f,
+    -0.81758481f, -0.57580819f, -0.80320753f, -0.59569930f, -0.78834643f, -0.61523159f,
+    -0.77301045f, -0.63439328f, -0.75720885f, -0.65317284f, -0.74095113f, -0.67155895f,
+    -0.72424708f, -0.68954054f, -0.70710678f, -0.70710678f, -0.68954054f, -0.72424708f,
+    -0.67155895f, -0.74095113f, -0.65317284f, -0.75720885f, -0.63439328f, -0.77301045f,
+    -0.61523159f, -0.78834643f, -0.59569930f, -0.80320753f, -0.57580819f, -0.81758481f,
+    -0.55557023f, -0.83146961f, -0.53499762f, -0.84485357f, -0.51410274f, -0.85772861f,
+    -0.49289819f, -0.87008699f, -0.47139674f, -0.88192126f, -0.44961133f, -0.89322430f,
+    -0.42755509f, -0.90398929f, -0.40524131f, -0.91420976f, -0.38268343f, -0.92387953f,
+    -0.35989504f, -0.93299280f, -0.33688985f, -0.94154407f, -0.31368174f, -0.94952818f,
+    -0.29028468f, -0.95694034f, -0.26671276f, -0.96377607f, -0.24298018f, -0.97003125f,
+    -0.21910124f, -0.97570213f, -0.19509032f, -0.98078528f, -0.17096189f, -0.98527764f,
+    -0.14673047f, -0.98917651f, -0.12241068f, -0.99247953f, -0.09801714f, -0.99518473f,
+    -0.07356456f, -0.99729046f, -0.04906767f, -0.99879546f, -0.02454123f, -0.99969882f,
+    0.00000000f, -1.00000000f, 0.02454123f, -0.99969882f, 0.04906767f, -0.99879546f,
+    0.07356456f, -0.99729046f, 0.09801714f, -0.99518473f, 0.12241068f, -0.99247953f,
+    0.14673047f, -0.98917651f, 0.17096189f, -0.98527764f, 0.19509032f, -0.98078528f,
+    0.21910124f, -0.97570213f, 0.24298018f, -0.97003125f, 0.26671276f, -0.96377607f,
+    0.29028468f, -0.95694034f, 0.31368174f, -0.94952818f, 0.33688985f, -0.94154407f,
+    0.35989504f, -0.93299280f, 0.38268343f, -0.92387953f, 0.40524131f, -0.91420976f,
+    0.42755509f, -0.90398929f, 0.44961133f, -0.89322430f, 0.47139674f, -0.88192126f,
+    0.49289819f, -0.87008699f, 0.51410274f, -0.85772861f, 0.53499762f, -0.84485357f,
+    0.55557023f, -0.83146961f, 0.57580819f, -0.81758481f, 0.59569930f, -0.80320753f,
+    0.61523159f, -0.78834643f, 0.63439328f, -0.77301045f, 0.65317284f, -0.75720885f,
+    0.67155895f, -0.74095113f, 0.68954054f, -0.72424708f, 0.70710678f, -0.70710678f,
+    0.72424708f, -0.68954054f, 0.74095113f, -0.67155895f, 0.75720885f, -0.65317284f,
+    0.77301045f, -0.63439328f, 0.78834643f, -0.61523159f, 0.80320753f, -0.59569930f,
+    0.81758481f, -0.57580819f, 0.83146961f, -0.55557023f, 0.84485357f, -0.53499762f,
+    0.85772861f, -0.51410274f, 0.87008699f, -0.49289819f, 0.88192126f, -0.47139674f,
+    0.89322430f, -0.44961133f, 0.90398929f, -0.42755509f, 0.91420976f, -0.40524131f,
+    0.92387953f, -0.38268343f, 0.93299280f, -0.35989504f, 0.94154407f, -0.33688985f,
+    0.94952818f, -0.31368174f, 0.95694034f, -0.29028468f, 0.96377607f, -0.26671276f,
+    0.97003125f, -0.24298018f, 0.97570213f, -0.21910124f, 0.98078528f, -0.19509032f,
+    0.98527764f, -0.17096189f, 0.98917651f, -0.14673047f, 0.99247953f, -0.12241068f,
+    0.99518473f, -0.09801714f, 0.99729046f, -0.07356456f, 0.99879546f, -0.04906767f,
+    0.99969882f, -0.02454123f
+};
+
+/**
+  @par
+  Twiddle factors of the mixed-radix FFT, generated with:
+  @par
+  <pre>for (i = 0; i < N; i++)
+  {
+     twiddleCoef[2*i]   = cos(i * 2*PI/(float)N);
+     twiddleCoef[2*i+1] = sin(i * 2*PI/(float)N);
+  } </pre>
+  @par
+  where N = 10, PI = 3.14159265358979
+  @par
+  Convert Floating point to q15(Fixed point 1.15), saturated to [-32767, 32767]:
+        round(twiddleCoefq15(i) * pow(2, 15))
+ */
+const int16_t twiddleCoef_mixed_10_q16[20] = {
+    (int16_t)0x7FFF, (int16_t)0x0000, (int16_t)0x678E, (int16_t)0x4B3D, (int16_t)0x278E,
+    (int16_t)0x79BC, (int16_t)0xD872, (int16_t)0x79BC, (int16_t)0x9872, (int16_t)0x4B3D,
+    (int16_t)0x8001, (int16_t)0x0000, (int16_t)0x9872, (int16_t)0xB4C3, (int16_t)0xD872,
+    (int16_t)0x8644, (int16_t)0x278E, (int16_t)0x8644, (int16_t)0x678E, (int16_t)0xB4C3
+};
+
+/**
+  @par
+  Twiddle factors of the mixed-radix FFT, generated with:
+  @par
+  <pre>for (i = 0; i < N; i++)
+  {
+     twiddleCoef[2*i]   = cos(i * 2*PI/(float)N);
+     twiddleCoef[2*i+1] = sin(i * 2*PI/(float)N);
+  } </pre>
+  @par
+  where N = 12, PI = 3.14159265358979
+  @par
+  Convert Floating point to q15(Fixed point 1.15), saturated to [-32767, 32767]:
+        round(twiddleCoefq15(i) * pow(2, 15))
+ */
+const int16_t twiddleCoef_mixed_12_q16[24] = {
+    (int16_t)0x7FFF, (int16_t)0x0000, (int16_t)0x6EDA, (int16_t)0x4000, (int16_t)0x4000,
+    (int16_t)0x6EDA, (int16_t)0x0000, (int16_t)0x7FFF, (int16_t)0xC000, (int16_t)0x6EDA,
+    (int16_t)0x9126, (int16_t)0x4000, (int16_t)0x8001, (int16_t)0x0000, (int16_t)0x9126,
+    (int16_t)0xC000, (int16_t)0xC000, (int16_t)0x9126, (int16_t)0x0000, (int16_t)0x8001,
+    (int16_t)0x4000, (int16_t)0x9126, (int16_t)0x6EDA, (int16_t)0xC000
+};
+
+/**
+  @par
+  Twiddle factors of the mixed-radix FFT, generated with:
+  @par
+  <pre>for (i = 0; i < N; i++)
+  {
+     twiddleCoef[2*i]   = cos(i * 2*PI/(float)N);
+     twiddleCoef[2*i+1] = sin(i * 2*PI/(float)N);
+  } </pre>
+  @par
+  where N = 16, PI = 3.14159265358979
+  @par
+  Convert Floating point to q15(Fixed point 1.15), saturated to [-32767, 32767]:
+        round(twiddleCoefq15(i) * pow(2, 15))
+ */
+const int16_t twiddleCoef_mixed_16_q16[32] = {
+    (int16_t)0x7FFF, (int16_t)0x0000, (int16_t)0x7642, (int16_t)0x30FC, (int16_t)0x5A82,
+    (int16_t)0x5A82, (int16_t)0x30FC, (int16_t)0x7642, (int16_t)0x0000, (int16_t)0x7FFF,
+    (int16_t)0xCF04, (int16_t)0x7642, (int16_t)0xA57E, (int16_t)0x5A82, (int16_t)0x89BE,
+    (int16_t)0x30FC, (int16_t)0x8001, (int16_t)0x0000, (int16_t)0x89BE, (int16_t)0xCF04,
+    (int16_t)0xA57E, (int16_t)0xA57E, (int16_t)0xCF04, (int16_t)0x89BE, (int16_t)0x0000,
+    (int16_t)0x8001, (int16_t)0x30FC, (int16_t)0x89BE, (int16_t)0x5A82, (int16_t)0xA57E,
+    (int16_t)0x7642, (int16_t)0xCF04
+};
+
+/**
+  @par
+  Twiddle factors of the mixed-radix FFT, generated with:
+  @par
+  <pre>for (i = 0; i < N; i++)
+  {
+     twiddleCoef[2*i]   = cos(i * 2*PI/(float)N);
+     twiddleCoef[2*i+1] = sin(i * 2*PI/(float)N);
+  } </pre>
+  @par
+  where N = 20, PI = 3.14159265358979
+  @par
+  Convert Floating point to q15(Fixed point 1.15), saturated to [-32767, 32767]:
+        round(twiddleCoefq15(i) * pow(2, 15))
+ */
+const int16_t twiddleCoef_mixed_20_q16[40] = {
+    (int16_t)0x7FFF, (int16_t)0x0000, (int16_t)0x79BC, (int16_t)0x278E, (int16_t)0x678E,
+    (int16_t)0x4B3D, (int16_t)0x4B3D, (int16_t)0x678E, (int16_t)0x278E, (int16_t)0x79BC,
+    (int16_t)0x0000, (int16_t)0x7FFF, (int16_t)0xD872, (int16_t)0x79BC, (int16_t)0xB4C3,
+    (int16_t)0x678E, (int16_t)0x9872, (int16_t)0x4B3D, (int16_t)0x8644, (int16_t)0x278E,
+    (int16_t)0x8001, (int16_t)0x0000, (int16_t)0x8644, (int16_t)0xD872, (int16_t)0x9872,
+    (int16_t)0xB4C3, (int16_t)0xB4C3, (int16_t)0x9872, (int16_t)0xD872, (int16_t)0x8644,
+    (int16_t)0x0000, (int16_t)0x8001, (int16_t)0x278E, (int16_t)0x8644, (int16_t)0x4B3D,
+    (int16_t)0x9872, (int16_t)0x678E, (int16_t)0xB4C3, (int16_t)0x79BC, (int16_t)0xD872
+};
+
+/**
+  @par
+  Twiddle factors of the mixed-radix FFT, generated with:
+  @par
+  <pre>for (i = 0; i < N; i++)
+  {
+     twiddleCoef[2*i]   = cos(i * 2*PI/(float)N);
+     twiddleCoef[2*i+1] = sin(i * 2*PI/(float)N);
+  } </pre>
+  @par
+  where N = 64, PI = 3.14159265358979
+  @par
+  Convert Floating point to q15(Fixed point 1.15), saturated to [-32767, 32767]:
+        round(twiddleCoefq15(i) * pow(2, 15))
+ */
+const int16_t twiddleCoef_mixed_64_q16[128] = {
+    (int16_t)0x7FFF, (int16_t)0x0000, (int16_t)0x7F62, (int16_t)0x0C8C, (int16_t)0x7D8A,
+    (int16_t)0x18F9, (int16_t)0x7A7D, (int16_t)0x2528, (int16_t)0x7642, (int16_t)0x30FC,
+    (int16_t)0x70E3, (int16_t)0x3C57, (int16_t)0x6A6E, (int16_t)0x471D, (int16_t)0x62F2,
+    (int16_t)0x5134, (int16_t)0x5A82, (int16_t)0x5A82, (int16_t)0x5134, (int16_t)0x62F2,
+    (int16_t)0x471D, (int16_t)0x6A6E, (int16_t)0x3C57, (int16_t)0x70E3, (int16_t)0x30FC,
+    (int16_t)0x7642, (int16_t)0x2528, (int16_t)0x7A7D, (int16_t)0x18F9, (int16_t)0x7D8A,
+    (int16_t)0x0C8C, (int16_t)0x7F62, (int16_t)0x0000, (int16_t)0x7FFF, (int16_t)0xF374,
+    (int16_t)0x7F62, (int16_t)0xE707, (int16_t)0x7D8A, (int16_t)0xDAD8, (int16_t)0x7A7D,
+    (int16_t)0xCF04, (int16_t)0x7642, (int16_t)0xC3A9, (int16_t)0x70E3, (int16_t)0xB8E3,
+    (int16_t)0x6A6E, (int16_t)0xAECC, (int16_t)0x62F2, (int16_t)0xA57E, (int16_t)0x5A82,
+    (int16_t)0x9D0E, (int16_t)0x5134, (int16_t)0x9592, (int16_t)0x471D, (int16_t)0x8F1D,
+    (int16_t)0x3C57, (int16_t)0x89BE, (int16_t)0x30FC, (int16_t)0x8583, (int16_t)0x2528,
+    (int16_t)0x8276, (int16_t)0x18F9, (int16_t)0x809E, (int16_t)0x0C8C, (int16_t)0x8001,
+    (int16_t)0x0000, (int16_t)0x809E, (int16_t)0xF374, (int16_t)0x8276, (int16_t)0xE707,
+    (int16_t)0x8583, (int16_t)0xDAD8, (int16_t)0x89BE, (int16_t)0xCF04, (int16_t)0x8F1D,
+    (int16_t)0xC3A9, (int16_t)0x9592, (int16_t)0xB8E3, (int16_t)0x9D0E, (int16_t)0xAECC,
+    (int16_t)0xA57E, (int16_t)0xA57E, (int16_t)0xAECC, (int16_t)0x9D0E, (int16_t)0xB8E3,
+    (int16_t)0x9592, (int16_t)0xC3A9, (int16_t)0x8F1D, (int16_t)0xCF04, (int16_t)0x89BE,
+    (int16_t)0xDAD8, (int16_t)0x8583, (int16_t)0xE707, (int16_t)0x8276, (int16_t)0xF374,
+    (int16_t)0x809E, (int16_t)0x0000, (int16_t)0x8001, (int16_t)0x0C8C, (int16_t)0x809E,
+    (int16_t)0x18F9, (int16_t)0x8276, (int16_t)0x2528, (int16_t)0x8583, (int16_t)0x30FC,
+    (int16_t)0x89BE, (int16_t)0x3C57, (int16_t)0x8F1D, (int16_t)0x471D, (int16_t)0x9592,
+    (int16_t)0x5134, (int16_t)0x9D0E, (int16_t)0x5A82, (int16_t)0xA57E, (int16_t)0x62F2,
+    (int16_t)0xAECC, (int16_t)0x6A6E, (int16_t)0xB8E3, (int16_t)0x70E3, (int16_t)0xC3A9,
+    (int16_t)0x7642, (int16_t)0xCF04, (int16_t)0x7A7D, (int16_t)0xDAD8, (int16_t)0x7D8A,
+    (int16_t)0xE707, (int16_t)0x7F62, (int16_t)0xF374
+};
+
+/**
+  @par
+  Twiddle factors of the mixed-radix FFT, generated with:
+  @par
+  <pre>for (i = 0; i < N; i++)
+  {
+     twiddleCoef[2*i]   = cos(i * 2*PI/(float)N);
+     twiddleCoef[2*i+1] = sin(i * 2*PI/(float)N);
+  } </pre>
+  @par
+  where N = 128, PI = 3.14159265358979
+  @par
+  Convert Floating point to q15(Fixed point 1.15), saturated to [-32767, 32767]:
+        round(twiddleCoefq15(i) * pow(2, 15))
+ */
+const int16_t twiddleCoef_mixed_128_q16[256] = {
+    (int16_t)0x7FFF, (int16_t)0x0000, (int16_t)0x7FD9, (int16_t)0x0648, (int16_t)0x7F62,
+    (int16_t)0x0C8C, (int16_t)0x7E9D, (int16_t)0x12C8, (int16_t)0x7D8A, (int16_t)0x18F9,
+    (int16_t)0x7C2A, (int16_t)0x1F1A, (int16_t)0x7A7D, (int16_t)0x2528, (int16_t)0x7885,
+    (int16_t)0x2B1F, (int16_t)0x7642, (int16_t)0x30FC, (int16_t)0x73B6, (int16_t)0x36BA,
+    (int16_t)0x70E3, (int16_t)0x3C57, (int16_t)0x6DCA, (int16_t)0x41CE, (int16_t)0x6A6E,
+    (int16_t)0x471D, (int16_t)0x66D0, (int16_t)0x4C40, (int16_t)0x62F2, (int16_t)0x5134,
+    (int16_t)0x5ED7, (int16_t)0x55F6, (int16_t)0x5A82, (int16_t)0x5A82, (int16_t)0x55F6,
+    (int16_t)0x5ED7, (int16_t)0x5134, (int16_t)0x62F2, (int16_t)0x4C40, (int16_t)0x66D0,
+    (int16_t)0x471D, (int16_t)0x6A6E, (int16_t)0x41CE, (int16_t)0x6DCA, (int16_t)0x3C57,
+    (int16_t)0x70E3, (int16_t)0x36BA, (int16_t)0x73B6, (int16_t)0x30FC, (int16_t)0x7642,
+    (int16_t)0x2B1F, (int16_t)0x7885, (int16_t)0x2528, (int16_t)0x7A7D, (int16_t)0x1F1A,
+    (int16_t)0x7C2A, (int16_t)0x18F9, (int16_t)0x7D8A, (int16_t)0x12C8, (int16_t)0x7E9D,
+    (int16_t)0x0C8C, (int16_t)0x7F62, (int16_t)0x0648, (int16_t)0x7FD9, (int16_t)0x0000,
+    (int16_t)0x7FFF, (int16_t)0xF9B8, (int16_t)0x7FD9, (int16_t)0xF374, (int16_t)0x7F62,
+    (int16_t)0xED38, (int16_t)0x7E9D, (int16_t)0xE707, (int16_t)0x7D8A, (int16_t)0xE0E6,
+    (int16_t)0x7C2A, (int16_t)0xDAD8, (int16_t)0x7A7D, (int16_t)0xD4E1, (int16_t)0x7885,
+    (int16_t)0xCF04, (int16_t)0x7642, (int16_t)0xC946, (int16_t)0x73B6, (int16_t)0xC3A9,
+    (int16_t)0x70E3, (int16_t)0xBE32, (int16_t)0x6DCA, (int16_t)0xB8E3, (int16_t)0x6A6E,
+    (int16_t)0xB3C0, (int16_t)0x66D0, (int16_t)0xAECC, (int16_t)0x62F2, (int16_t)0xAA0A,
+    (int16_t)0x5ED7, (int16_t)0xA57E, (int16_t)0x5A82, (int16_t)0xA129, (int16_t)0x55F6,
+    (int16_t)0x9D0E, (int16_t)0x5134, (int16_t)0x9930, (int16_t)0x4C40, (int16_t)0x9592,
+    (int16_t)0x471D, (int16_t)0x9236, (int16_t)0x41CE, (int16_t)0x8F1D, (int16_t)0x3C57,
+    (int16_t)0x8C4A, (int16_t)0x36BA, (int16_t)0x89BE, (int16_t)0x30FC, (int16_t)0x877B,
+    (int16_t)0x2B1F, (int16_t)0x8583, (int16_t)0x2528, (int16_t)0x83D6, (int16_t)0x1F1A,
+    (int16_t)0x8276, (int16_t)0x18F9, (int16_t)0x8163, (int16_t)0x12C8, (int16_t)0x809E,
+    (int16_t)0x0C8C, (int16_t)0x8027, (int16_t)0x0648, (int16_t)0x8001, (int16_t)0x0000,
+    (int16_t)0x8027, (int16_t)0xF9B8, (int16_t)0x809E, (int16_t)0xF374, (int16_t)0x8163,
+    (int16_t)0xED38, (int16_t)0x8276, (int16_t)0xE707, (int16_t)0x83D6, (int16_t)0xE0E6,
+    (int16_t)0x8583, (int16_t)0xDAD8, (int16_t)0x877B, (int16_t)0xD4E1, (int16_t)0x89BE,
+    (int16_t)0xCF04, (int16_t)0x8C4A, (int16_t)0xC946, (int16_t)0x8F1D, (int16_t)0xC3A9,
+    (int16_t)0x9236, (int16_t)0xBE32, (int16_t)0x9592, (int16_t)0xB8E3, (int16_t)0x9930,
+    (int16_t)0xB3C0, (int16_t)0x9D0E, (int16_t)0xAECC, (int16_t)0xA129, (int16_t)0xAA0A,
+    (int16_t)0xA57E, (int16_t)0xA57E, (int16_t)0xAA0A, (int16_t)0xA129, (int16_t)0xAECC,
+    (int16_t)0x9D0E, (int16_t)0xB3C0, (int16_t)0x9930, (int16_t)0xB8E3, (int16_t)0x9592,
+    (int16_t)0xBE32, (int16_t)0x9236, (int16_t)0xC3A9, (int16_t)0x8F1D, (int16_t)0xC946,
+    (int16_t)0x8C4A, (int16_t)0xCF04, (int16_t)0x89BE, (int16_t)0xD4E1, (int16_t)0x877B,
+    (int16_t)0xDAD8, (int16_t)0x8583, (int16_t)0xE0E6, (int16_t)0x83D6, (int16_t)0xE707,
+    (int16_t)0x8276, (int16_t)0xED38, (int16_t)0x8163, (int16_t)0xF374, (int16_t)0x809E,
+    (int16_t)0xF9B8, (int16_t)0x8027, (int16_t)0x0000, (int16_t)0x8001, (int16_t)0x0648,
+    (int16_t)0x8027, (int16_t)0x0C8C, (int16_t)0x809E, (int16_t)0x12C8, (int16_t)0x8163,
+    (int16_t)0x18F9, (int16_t)0x8276, (int16_t)0x1F1A, (int16_t)0x83D6, (int16_t)0x2528,
+    (int16_t)0x8583, (int16_t)0x2B1F, (int16_t)0x877B, (int16_t)0x30FC, (int16_t)0x89BE,
+    (int16_t)0x36BA, (int16_t)0x8C4A, (int16_t)0x3C57, (int16_t)0x8F1D, (int16_t)0x41CE,
+    (int16_t)0x9236, (int16_t)0x471D, (int16_t)0x9592, (int16_t)0x4C40, (int16_t)0x9930,
+    (int16_t)0x5134, (int16_t)0x9D0E, (int16_t)0x55F6, (int16_t)0xA129, (int16_t)0x5A82,
+    (int16_t)0xA57E, (int16_t)0x5ED7, (int16_t)0xAA0A, (int16_t)0x62F2, (int16_t)0xAECC,
+    (int16_t)0x66D0, (int16_t)0xB3C0, (int16_t)0x6A6E, (int16_t)0xB8E3, (int16_t)0x6DCA,
+    (int16_t)0xBE32, (int16_t)0x70E3, (int16_t)0xC3A9, (int16_t)0x73B6, (int16_t)0xC946,
+    (int16_t)0x7642, (int16_t)0xCF04, (int16_t)0x7885, (int16_t)0xD4E1, (int16_t)0x7A7D,
+    (int16_t)0xDAD8, (int16_t)0x7C2A, (int16_t)0xE0E6, (int16_t)0x7D8A, (int16_t)0xE707,
+    (int16_t)0x7E9D, (int16_t)0xED38, (int16_t)0x7F62, (int16_t)0xF374, (int16_t)0x7FD9,
+    (int16_t)0xF9B8
+};
+
+/**
+  @par
+  Twiddle factors of the mixed-radix FFT, generated with:
+  @par
+  <pre>for (i = 0; i < N; i++)
+  {
+     twiddleCoef[2*i]   = cos(i * 2*PI/(float)N);
+     twiddleCoef[2*i+1] = sin(i * 2*PI/(float)N);
+  } </pre>
+  @par
+  where N = 256, PI = 3.14159265358979
+  @par
+  Convert Floating point to q15(Fixed point 1.15), saturated to [-32767, 32767]:
+        round(twiddleCoefq15(i) * pow(2, 15))
+ */
+const int16_t twiddleCoef_mixed_256_q16[512] = {
+    (int16_t)0x7FFF, (int16_t)0x0000, (int16_t)0x7FF6, (int16_t)0x0324, (int16_t)0x7FD9,
+    (int16_t)0x0648, (int16_t)0x7FA7, (int16_t)0x096B, (int16_t)0x7F62, (int16_t)0x0C8C,
+    (int16_t)0x7F0A, (int16_t)0x0FAB, (int16_t)0x7E9D, (int16_t)0x12C8, (int16_t)0x7E1E,
+    (int16_t)0x15E2, (int16_t)0x7D8A, (int16_t)0x18F9, (int16_t)0x7CE4, (int16_t)0x1C0C,
+    (int16_t)0x7C2A, (int16_t)0x1F1A, (int16_t)0x7B5D, (int16_t)0x2224, (int16_t)0x7A7D,
+    (int16_t)0x2528, (int16_t)0x798A, (int16_t)0x2827, (int16_t)0x7885, (int16_t)0x2B1F,
+    (int16_t)0x776C, (int16_t)0x2E11, (int16_t)0x7642, (int16_t)0x30FC, (int16_t)0x7505,
+    (int16_t)0x33DF, (int16_t)0x73B6, (int16_t)0x36BA, (int16_t)0x7255, (int16_t)0x398D,
+    (int16_t)0x70E3, (int16_t)0x3C57, (int16_t)0x6F5F, (int16_t)0x3F17, (int16_t)0x6DCA,
+    (int16_t)0x41CE, (int16_t)0x6C24, (int16_t)0x447B, (int16_t)0x6A6E, (int16_t)0x471D,
+    (int16_t)0x68A7, (int16_t)0x49B4, (int16_t)0x66D0, (int16_t)0x4C40, (int16_t)0x64E9,
+    (int16_t)0x4EC0, (int16_t)0x62F2, (int16_t)0x5134, (int16_t)0x60EC, (int16_t)0x539B,
+    (int16_t)0x5ED7, (int16_t)0x55F6, (int16_t)0x5CB4, (int16_t)0x5843, (int16_t)0x5A82,
+    (int16_t)0x5A82, (int16_t)0x5843, (int16_t)0x5CB4, (int16_t)0x55F6, (int16_t)0x5ED7,
+    (int16_t)0x539B, (int16_t)0x60EC, (int16_t)0x5134, (int16_t)0x62F2, (int16_t)0x4EC0,
+    (int16_t)0x64E9, (int16_t)0x4C40, (int16_t)0x66D0, (int16_t)0x49B4, (int16_t)0x68A7,
+    (int16_t)0x471D, (int16_t)0x6A6E, (int16_t)0x447B, (int16_t)0x6C24, (int16_t)0x41CE,
+    (int16_t)0x6DCA, (int16_t)0x3F17, (int16_t)0x6F5F, (int16_t)0x3C57, (int16_t)0x70E3,
+    (int16_t)0x398D, (int16_t)0x7255, (int16_t)0x36BA, (int16_t)0x73B6, (int16_t)0x33DF,
+    (int16_t)0x7505, (int16_t)0x30FC, (int16_t)0x7642, (int16_t)0x2E11, (int16_t)0x776C,
+    (int16_t)0x2B1F, (int16_t)0x7885, (int16_t)0x2827, (int16_t)0x798A, (int16_t)0x2528,
+    (int16_t)0x7A7D, (int16_t)0x2224, (int16_t)0x7B5D, (int16_t)0x1F1A, (int16_t)0x7C2A,
+    (int16_t)0x1C0C, (int16_t)0x7CE4, (int16_t)0x18F9, (int16_t)0x7D8A, (int16_t)0x15E2,
+    (int16_t)0x7E1E, (int16_t)0x12C8, (int16_t)0x7E9D, (int16_t)0x0FAB, (int16_t)0x7F0A,
+    (int16_t)0x0C8C, (int16_t)0x7F62, (int16_t)0x096B, (int16_t)0x7FA7, (int16_t)0x0648,
+    (int16_t)0x7FD9, (int16_t)0x0324, (int16_t)0x7FF6, (int16_t)0x0000, (int16_t)0x7FFF,
+    (int16_t)0xFCDC, (int16_t)0x7FF6, (int16_t)0xF9B8, (int16_t)0x7FD9, (int16_t)0xF695,
+    (int16_t)0x7FA7, (int16_t)0xF374, (int16_t)0x7F62, (int16_t)0xF055, (int16_t)0x7F0A,
+    (int16_t)0xED38, (int16_t)0x7E9D, (int16_t)0xEA1E, (int16_t)0x7E1E, (int16_t)0xE707,
+    (int16_t)0x7D8A, (int16_t)0xE3F4, (int16_t)0x7CE4, (int16_t)0xE0E6, (int16_t)0x7C2A,
+    (int16_t)0xDDDC, (int16_t)0x7B5D, (int16_t)0xDAD8, (int16_t)0x7A7D, (int16_t)0xD7D9,
+    (int16_t)0x798A, (int16_t)0xD4E1, (int16_t)0x7885, (int16_t)0xD1EF, (int16_t)0x776C,
+    (int16_t)0xCF04, (int16_t)0x7642, (int16_t)0xCC21, (int16_t)0x7505, (int16_t)0xC946,
+    (int16_t)0x73B6, (int16_t)0xC673, (int16_t)0x7255, (int16_t)0xC3A9, (int16_t)0x70E3,
+    (int16_t)0xC0E9, (int16_t)0x6F5F, (int16_t)0xBE32, (int16_t)0x6DCA, (int16_t)0xBB85,
+    (int16_t)0x6C24, (int16_t)0xB8E3, (int16_t)0x6A6E, (int16_t)0xB64C, (int16_t)0x68A7,
+    (int16_t)0xB3C0, (int16_t)0x66D0, (int16_t)0xB140, (int16_t)0x64E9, (int16_t)0xAECC,
+    (int16_t)0x62F2, (int16_t)0xAC65, (int16_t)0x60EC, (int16_t)0xAA0A, (int16_t)0x5ED7,
+    (int16_t)0xA7BD, (int16_t)0x5CB4, (int16_t)0xA57E, (int16_t)0x5A82, (int16_t)0xA34C,
+    (int16_t)0x5843, (int16_t)0xA129, (int16_t)0x55F6, (int16_t)0x9F14, (int16_t)0x539B,
+    (int16_t)0x9D0E, (int16_t)0x5134, (int16_t)0x9B17, (int16_t)0x4EC0, (int16_t)0x9930,
+    (int16_t)0x4C40, (int16_t)0x9759, (int16_t)0x49B4, (int16_t)0x9592, (int16_t)0x471D,
+    (int16_t)0x93DC, (int16_t)0x447B, (int16_t)0x9236, (int16_t)0x41CE, (int16_t)0x90A1,
+    (int16_t)0x3F17, (int16_t)0x8F1D, (int16_t)0x3C57, (int16_t)0x8DAB, (int16_t)0x398D,
+    (int16_t)0x8C4A, (int16_t)0x36BA, (int16_t)0x8AFB, (int16_t)0x33DF, (int16_t)0x89BE,
+    (int16_t)0x30FC, (int16_t)0x8894, (int16_t)0x2E11, (int16_t)0x877B, (int16_t)0x2B1F,
+    (int16_t)0x8676, (int16_t)0x2827, (int16_t)0x8583, (int16_t)0x2528, (int16_t)0x84A3,
+    (int16_t)0x2224, (int16_t)0x83D6, (int16_t)0x1F1A, (int16_t)0x831C, (int16_t)0x1C0C,
+    (int16_t)0x8276, (int16_t)0x18F9, (int16_t)0x81E2, (int16_t)0x15E2, (int16_t)0x8163,
+    (int16_t)0x12C8, (int16_t)0x80F6, (int16_t)0x0FAB, (int16_t)0x809E, (int16_t)0x0C8C,
+    (int16_t)0x8059, (int16_t)0x096B, (int16_t)0x8027, (int16_t)0x0648, (int16_t)0x800A,
+    (int16_t)0x0324, (int16_t)0x8001, (int16_t)0x0000, (int16_t)0x800A, (int16_t)0xFCDC,
+    (int16_t)0x8027, (int16_t)0xF9B8, (int16_t)0x8059, (int16_t)0xF695, (int16_t)0x809E,
+    (int16_t)0xF374, (int16_t)0x80F6, (int16_t)0xF055, (int16_t)0x8163, (int16_t)0xED38,
+    (int16_t)0x81E2, (int16_t)0xEA1E, (int16_t)0x8276, (int16_t)0xE707, (int16_t)0x831C,
+    (int16_t)0xE3F4, (int16_t)0x83D6, (int16_t)0xE0E6, (int16_t)0x84A3, (int16_t)0xDDDC,
+    (int16_t)0x8583, (int16_t)0xDAD8, (int16_t)0x8676, (int16_t)0xD7D9, (int16_t)0x877B,
+    (int16_t)0xD4E1, (int16_t)0x8894, (int16_t)0xD1EF, (int16_t)0x89BE, (int16_t)0xCF04,
+    (int16_t)0x8AFB, (int16_t)0xCC21, (int16_t)0x8C4A, (int16_t)0xC946, (int16_t)0x8DAB,
+    (int16_t)0xC673, (int16_t)0x8F1D, (int16_t)0xC3A9, (int16_t)0x90A1, (int16_t)0xC0E9,
+    (int16_t)0x9236, (int16_t)0xBE32, (int16_t)0x93DC, (int16_t)0xBB85, (int16_t)0x9592,
+    (int16_t)0xB8E3, (int16_t)0x9759, (int16_t)0xB64C, (int16_t)0x9930, (int16_t)0xB3C0,
+    (int16_t)0x9B17, (int16_t)0xB140, (int16_t)0x9D0E, (int16_t)0xAECC, (int16_t)0x9F14,
+    (int16_t)0xAC65, (int16_t)0xA129, (int16_t)0xAA0A, (int16_t)0xA34C, (int16_t)0xA7BD,
+    (int16_t)0xA57E, (int16_t)0xA57E, (int16_t)0xA7BD, (int16_t)0xA34C, (int16_t)0xAA0A,
+    (int16_t)0xA129, (int16_t)0xAC65, (int16_t)0x9F14, (int16_t)0xAECC, (int16_t)0x9D0E,
+    (int16_t)0xB140, (int16_t)0x9B17, (int16_t)0xB3C0, (int16_t)0x9930, (int16_t)0xB64C,
+    (int16_t)0x9759, (int16_t)0xB8E3, (int16_t)0x9592, (int16_t)0xBB85, (int16_t)0x93DC,
+    (int16_t)0xBE32, (int16_t)0x9236, (int16_t)0xC0E9, (int16_t)0x90A1, (int16_t)0xC3A9,
+    (int16_t)0x8F1D, (int16_t)0xC673, (int16_t)0x8DAB, (int16_t)0xC946, (int16_t)0x8C4A,
+    (int16_t)0xCC21, (int16_t)0x8AFB, (int16_t)0xCF04, (int16_t)0x89BE, (int16_t)0xD1EF,
+    (int16_t)0x8894, (int16_t)0xD4E1, (int16_t)0x877B, (int16_t)0xD7D9, (int16_t)0x8676,
+    (int16_t)0xDAD8, (int16_t)0x8583, (int16_t)0xDDDC, (int16_t)0x84A3, (int16_t)0xE0E6,
+    (int16_t)0x83D6, (int16_t)0xE3F4, (int16_t)0x831C, (int16_t)0xE707, (int16_t)0x8276,
+    (int16_t)0xEA1E, (int16_t)0x81E2, (int16_t)0xED38, (int16_t)0x8163, (int16_t)0xF055,
+    (int16_t)0x80F6, (int16_t)0xF374, (int16_t)0x809E, (int16_t)0xF695, (int16_t)0x8059,
+    (int16_t)0xF9B8, (int16_t)0x8027, (int16_t)0xFCDC, (int16_t)0x800A, (int16_t)0x0000,
+    (int16_t)0x8001, (int16_t)0x0324, (int16_t)0x800A, (int16_t)0x0648, (int16_t)0x8027,
+    (int16_t)0x096B, (int16_t)0x8059, (int16_t)0x0C8C, (int16_t)0x809E, (int16_t)0x0FAB,
+    (int16_t)0x80F6, (int16_t)0x12C8, (int16_t)0x8163, (int16_t)0x15E2, (int16_t)0x81E2,
+    (int16_t)0x18F9, (int16_t)0x8276, (int16_t)0x1C0C, (int16_t)0x831C, (int16_t)0x1F1A,
+    (int16_t)0x83D6, (int16_t)0x2224, (int16_t)0x84A3, (int16_t)0x2528, (int16_t)0x8583,
+    (int16_t)0x2827, (int16_t)0x8676, (int16_t)0x2B1F, (int16_t)0x877B, (int16_t)0x2E11,
+    (int16_t)0x8894, (int16_t)0x30FC, (int16_t)0x89BE, (int16_t)0x33DF, (int16_t)0x8AFB,
+    (int16_t)0x36BA, (int16_t)0x8C4A, (int16_t)0x398D, (int16_t)0x8DAB, (int16_t)0x3C57,
+    (int16_t)0x8F1D, (int16_t)0x3F17, (int16_t)0x90A1, (int16_t)0x41CE, (int16_t)0x9236,
+    (int16_t)0x447B, (int16_t)0x93DC, (int16_t)0x471D, (int16_t)0x9592, (int16_t)0x49B4,
+    (int16_t)0x9759, (int16_t)0x4C40, (int16_t)0x9930, (int16_t)0x4EC0, (int16_t)0x9B17,
+    (int16_t)0x5134, (int16_t)0x9D0E, (int16_t)0x539B, (int16_t)0x9F14, (int16_t)0x55F6,
+    (int16_t)0xA129, (int16_t)0x5843, (int16_t)0xA34C, (int16_t)0x5A82, (int16_t)0xA57E,
+    (int16_t)0x5CB4, (int16_t)0xA7BD, (int16_t)0x5ED7, (int16_t)0xAA0A, (int16_t)0x60EC,
+    (int16_t)0xAC65, (int16_t)0x62F2, (int16_t)0xAECC, (int16_t)0x64E9, (int16_t)0xB140,
+    (int16_t)0x66D0, (int16_t)0xB3C0, (int16_t)0x68A7, (int16_t)0xB64C, (int16_t)0x6A6E,
+    (int16_t)0xB8E3, (int16_t)0x6C24, (int16_t)0xBB85, (int16_t)0x6DCA, (int16_t)0xBE32,
+    (int16_t)0x6F5F, (int16_t)0xC0E9, (int16_t)0x70E3, (int16_t)0xC3A9, (int16_t)0x7255,
+    (int16_t)0xC673, (int16_t)0x73B6, (int16_t)0xC946, (int16_t)0x7505, (int16_t)0xCC21,
+    (int16_t)0x7642, (int16_t)0xCF04, (int16_t)0x776C, (int16_t)0xD1EF, (int16_t)0x7885,
+    (int16_t)0xD4E1, (int16_t)0x798A, (int16_t)0xD7D9, (int16_t)0x7A7D, (int16_t)0xDAD8,
+    (int16_t)0x7B5D, (int16_t)0xDDDC, (int16_t)0x7C2A, (int16_t)0xE0E6, (int16_t)0x7CE4,
+    (int16_t)0xE3F4, (int16_t)0x7D8A, (int16_t)0xE707, (int16_t)0x7E1E, (int16_t)0xEA1E,
+    (int16_t)0x7E9D, (int16_t)0xED38, (int16_t)0x7F0A, (int16_t)0xF055, (int16_t)0x7F62,
+    (int16_t)0xF374, (int16_t)0x7FA7, (int16_t)0xF695, (int16_t)0x7FD9, (int16_t)0xF9B8,
+    (int16_t)0x7FF6, (int16_t)0xFCDC
+};
+
+/**
+  @par
+  Post and split twiddle factors of the DCT-II, generated with:
+  @par
+  <pre>for (i = 0; i <= N/2; i++)
+  {
+     twiddleCoef[2*i]         = cos(i * PI/(float)(2*N));
+     twiddleCoef[2*i+1]       = sin(i * PI/(float)(2*N));
+     twiddleCoef[N+2+2*i]     = cos(i * 2*PI/(float)N);
+     twiddleCoef[N+2+2*i+1]   = sin(i * 2*PI/(float)N);
+  } </pre>
+  @par
+  where N = 20, PI = 3.14159265358979
+ */
+const float32_t twiddleCoef_dct2_20_f32[44] = {
+    1.00000000f, 0.00000000f, 0.99691733f, 0.07845910f, 0.98768834f, 0.15643447f,
+    0.97236992f, 0.23344536f, 0.95105652f, 0.30901699f, 0.92387953f, 0.38268343f,
+    0.89100652f, 0.45399050f, 0.85264016f, 0.52249856f, 0.80901699f, 0.58778525f,
+    0.76040597f, 0.64944805f, 0.70710678f, 0.70710678f, 1.00000000f, 0.00000000f,
+    0.95105652f, 0.30901699f, 0.80901699f, 0.58778525f, 0.58778525f, 0.80901699f,
+    0.30901699f, 0.95105652f, 0.00000000f, 1.00000000f, -0.30901699f, 0.95105652f,
+    -0.58778525f, 0.80901699f, -0.80901699f, 0.58778525f, -0.95105652f, 0.30901699f,
+    -1.00000000f, 0.00000000f
+};
+
+/**
+  @par
+  Post and split twiddle factors of the DCT-II, generated with:
+  @par
+  <pre>for (i = 0; i <= N/2; i++)
+  {
+     twiddleCoef[2*i]         = cos(i * PI/(float)(2*N));
+     twiddleCoef[2*i+1]       = sin(i * PI/(float)(2*N));
+     twiddleCoef[N+2+2*i]     = cos(i * 2*PI/(float)N);
+     twiddleCoef[N+2+2*i+1]   = sin(i * 2*PI/(float)N);
+  } </pre>
+  @par
+  where N = 24, PI = 3.14159265358979
+ */
+const float32_t twiddleCoef_dct2_24_f32[52] = {
+    1.00000000f, 0.00000000f, 0.99785892f, 0.06540313f, 0.99144486f, 0.13052619f,
+    0.98078528f, 0.19509032f, 0.96592583f, 0.25881905f, 0.94693013f, 0.32143947f,
+    0.92387953f, 0.38268343f, 0.89687274f, 0.44228869f, 0.86602540f, 0.50000000f,
+    0.83146961f, 0.55557023f, 0.79335334f, 0.60876143f, 0.75183981f, 0.65934582f,
+    0.70710678f, 0.70710678f, 1.00000000f, 0.00000000f, 0.96592583f, 0.25881905f,
+    0.86602540f, 0.50000000f, 0.70710678f, 0.70710678f, 0.50000000f, 0.86602540f,
+    0.25881905f, 0.96592583f, 0.00000000f, 1.00000000f, -0.25881905f, 0.96592583f,
+    -0.50000000f, 0.86602540f, -0.70710678f, 0.70710678f, -0.86602540f, 0.50000000f,
+    -0.96592583f, 0.25881905f, -1.00000000f, 0.00000000f
+};
+
+/**
+  @par
+  Post and split twiddle factors of the DCT-II, generated with:
+  @par
+  <pre>for (i = 0; i <= N/2; i++)
+  {
+     twiddleCoef[2*i]         = cos(i * PI/(float)(2*N));
+     twiddleCoef[2*i+1]       = sin(i * PI/(float)(2*N));
+     twiddleCoef[N+2+2*i]     = cos(i * 2*PI/(float)N);
+     twiddleCoef[N+2+2*i+1]   = sin(i * 2*PI/(float)N);
+  } </pre>
+  @par
+  where N = 32, PI = 3.14159265358979
+ */
+const float32_t twiddleCoef_dct2_32_f32[68] = {
+    1.00000000f, 0.00000000f, 0.99879546f, 0.04906767f, 0.99518473f, 0.09801714f,
+    0.98917651f, 0.14673047f, 0.98078528f, 0.19509032f, 0.97003125f, 0.24298018f,
+    0.95694034f, 0.29028468f, 0.94154407f, 0.33688985f, 0.92387953f, 0.38268343f,
+    0.90398929f, 0.42755509f, 0.88192126f, 0.47139674f, 0.85772861f, 0.51410274f,
+    0.83146961f, 0.55557023f, 0.80320753f, 0.59569930f, 0.77301045f, 0.63439328f,
+    0.74095113f, 0.67155895f, 0.70710678f, 0.70710678f, 1.00000000f, 0.00000000f,
+    0.98078528f, 0.19509032f, 0.92387953f, 0.38268343f, 0.83146961f, 0.55557023f,
+    0.70710678f, 0.70710678f, 0.55557023f, 0.83146961f, 0.38268343f, 0.92387953f,
+    0.19509032f, 0.98078528f, 0.00000000f, 1.00000000f, -0.19509032f, 0.98078528f,
+    -0.38268343f, 0.92387953f, -0.55557023f, 0.83146961f, -0.70710678f, 0.70710678f,
+    -0.83146961f, 0.55557023f, -0.92387953f, 0.38268343f, -0.98078528f, 0.19509032f,
+    -1.00000000f, 0.00000000f
+};
+
+/**
+  @par
+  Post and split twiddle factors of the DCT-II, generated with:
+  @par
+  <pre>for (i = 0; i <= N/2; i++)
+  {
+     twiddleCoef[2*i]         = cos(i * PI/(float)(2*N));
+     twiddleCoef[2*i+1]       = sin(i * PI/(float)(2*N));
+     twiddleCoef[N+2+2*i]     = cos(i * 2*PI/(float)N);
+     twiddleCoef[N+2+2*i+1]   = sin(i * 2*PI/(float)N);
+  } </pre>
+  @par
+  where N = 40, PI = 3.14159265358979
+ */
+const float32_t twiddleCoef_dct2_40_f32[84] = {
+    1.00000000f, 0.00000000f, 0.99922904f, 0.03925982f, 0.99691733f, 0.07845910f,
+    0.99306846f, 0.11753740f, 0.98768834f, 0.15643447f, 0.98078528f, 0.19509032f,
+    0.97236992f, 0.23344536f, 0.96245524f, 0.27144045f, 0.95105652f, 0.30901699f,
+    0.93819134f, 0.34611706f, 0.92387953f, 0.38268343f, 0.90814317f, 0.41865974f,
+    0.89100652f, 0.45399050f, 0.87249601f, 0.48862124f, 0.85264016f, 0.52249856f,
+    0.83146961f, 0.55557023f, 0.80901699f, 0.58778525f, 0.78531693f, 0.61909395f,
+    0.76040597f, 0.64944805f, 0.73432251f, 0.67880075f, 0.70710678f, 0.70710678f,
+    1.00000000f, 0.00000000f, 0.98768834f, 0.15643447f, 0.95105652f, 0.30901699f,
+    0.89100652f, 0.45399050f, 0.80901699f, 0.58778525f, 0.70710678f, 0.70710678f,
+    0.58778525f, 0.80901699f, 0.45399050f, 0.89100652f, 0.30901699f, 0.95105652f,
+    0.15643447f, 0.98768834f, 0.00000000f, 1.00000000f, -0.15643447f, 0.98768834f,
+    -0.30901699f, 0.95105652f, -0.45399050f, 0.89100652f, -0.58778525f, 0.80901699f,
+    -0.70710678f, 0.70710678f, -0.80901699f, 0.58778525f, -0.89100652f, 0.45399050f,
+    -0.95105652f, 0.30901699f, -0.98768834f, 0.15643447f, -1.00000000f, 0.00000000f
+};
+
+/**
+  @par
+  Post and split twiddle factors of the DCT-II, generated with:
+  @par
+  <pre>for (i = 0; i <= N/2; i++)
+  {
+     twiddleCoef[2*i]         = cos(i * PI/(float)(2*N));
+     twiddleCoef[2*i+1]       = sin(i * PI/(float)(2*N));
+     twiddleCoef[N+2+2*i]     = cos(i * 2*PI/(float)N);
+     twiddleCoef[N+2+2*i+1]   = sin(i * 2*PI/(float)N);
+  } </pre>
+  @par
+  where N = 20, PI = 3.14159265358979
+  @par
+  Convert Floating point to q15(Fixed point 1.15), saturated to [-32767, 32767]:
+        round(twiddleCoefq15(i) * pow(2, 15))
+ */
+const int16_t twiddleCoef_dct2_20_q16[44] = {
+    (int16_t)0x7FFF, (int16_t)0x0000, (int16_t)0x7F9B, (int16_t)0x0A0B, (int16_t)0x7E6D,
+    (int16_t)0x1406, (int16_t)0x7C77, (int16_t)0x1DE2, (int16_t)0x79BC, (int16_t)0x278E,
+    (int16_t)0x7642, (int16_t)0x30FC, (int16_t)0x720D, (int16_t)0x3A1C, (int16_t)0x6D23,
+    (int16_t)0x42E1, (int16_t)0x678E, (int16_t)0x4B3D, (int16_t)0x6155, (int16_t)0x5321,
+    (int16_t)0x5A82, (int16_t)0x5A82, (int16_t)0x7FFF, (int16_t)0x0000, (int16_t)0x79BC,
+    (int16_t)0x278E, (int16_t)0x678E, (int16_t)0x4B3D, (int16_t)0x4B3D, (int16_t)0x678E,
+    (int16_t)0x278E, (int16_t)0x79BC, (int16_t)0x0000, (int16_t)0x7FFF, (int16_t)0xD872,
+    (int16_t)0x79BC, (int16_t)0xB4C3, (int16_t)0x678E, (int16_t)0x9872, (int16_t)0x4B3D,
+    (int16_t)0x8644, (int16_t)0x278E, (int16_t)0x8001, (int16_t)0x0000
+};
+
+/**
+  @par
+  Post and split twiddle factors of the DCT-II, generated with:
+  @par
+  <pre>for (i = 0; i <= N/2; i++)
+  {
+     twiddleCoef[2*i]         = cos(i * PI/(float)(2*N));
+     twiddleCoef[2*i+1]       = sin(i * PI/(float)(2*N));
+     twiddleCoef[N+2+2*i]     = cos(i * 2*PI/(float)N);
+     twiddleCoef[N+2+2*i+1]   = sin(i * 2*PI/(float)N);
+  } </pre>
+  @par
+  where N = 24, PI = 3.14159265358979
+  @par
+  Convert Floating point to q15(Fixed point 1.15), saturated to [-32767, 32767]:
+        round(twiddleCoefq15(i) * pow(2, 15))
+ */
+const int16_t twiddleCoef_dct2_24_q16[52] = {
+    (int16_t)0x7FFF, (int16_t)0x0000, (int16_t)0x7FBA, (int16_t)0x085F, (int16_t)0x7EE8,
+    (int16_t)0x10B5, (int16_t)0x7D8A, (int16_t)0x18F9, (int16_t)0x7BA3, (int16_t)0x2121,
+    (int16_t)0x7935, (int16_t)0x2925, (int16_t)0x7642, (int16_t)0x30FC, (int16_t)0x72CD,
+    (int16_t)0x389D, (int16_t)0x6EDA, (int16_t)0x4000, (int16_t)0x6A6E, (int16_t)0x471D,
+    (int16_t)0x658D, (int16_t)0x4DEC, (int16_t)0x603C, (int16_t)0x5465, (int16_t)0x5A82,
+    (int16_t)0x5A82, (int16_t)0x7FFF, (int16_t)0x0000, (int16_t)0x7BA3, (int16_t)0x2121,
+    (int16_t)0x6EDA, (int16_t)0x4000, (int16_t)0x5A82, (int16_t)0x5A82, (int16_t)0x4000,
+    (int16_t)0x6EDA, (int16_t)0x2121, (int16_t)0x7BA3, (int16_t)0x0000, (int16_t)0x7FFF,
+    (int16_t)0xDEDF, (int16_t)0x7BA3, (int16_t)0xC000, (int16_t)0x6EDA, (int16_t)0xA57E,
+    (int16_t)0x5A82, (int16_t)0x9126, (int16_t)0x4000, (int16_t)0x845D, (int16_t)0x2121,
+    (int16_t)0x8001, (int16_t)0x0000
+};
+
+/**
+  @par
+  Post and split twiddle factors of the DCT-II, generated with:
+  @par
+  <pre>for (i = 0; i <= N/2; i++)
+  {
+     twiddleCoef[2*i]         = cos(i * PI/(float)(2*N));
+     twiddleCoef[2*i+1]       = sin(i * PI/(float)(2*N));
+     twiddleCoef[N+2+2*i]     = cos(i * 2*PI/(float)N);
+     twiddleCoef[N+2+2*i+1]   = sin(i * 2*PI/(float)N);
+  } </pre>
+  @par
+  where N = 32, PI = 3.14159265358979
+  @par
+  Convert Floating point to q15(Fixed point 1.15), saturated to [-32767, 32767]:
+        round(twiddleCoefq15(i) * pow(2, 15))
+ */
+const int16_t twiddleCoef_dct2_32_q16[68] = {
+    (int16_t)0x7FFF, (int16_t)0x0000, (int16_t)0x7FD9, (int16_t)0x0648, (int16_t)0x7F62,
+    (int16_t)0x0C8C, (int16_t)0x7E9D, (int16_t)0x12C8, (int16_t)0x7D8A, (int16_t)0x18F9,
+    (int16_t)0x7C2A, (int16_t)0x1F1A, (int16_t)0x7A7D, (int16_t)0x2528, (int16_t)0x7885,
+    (int16_t)0x2B1F, (int16_t)0x7642, (int16_t)0x30FC, (int16_t)0x73B6, (int16_t)0x36BA,
+    (int16_t)0x70E3, (int16_t)0x3C57, (int16_t)0x6DCA, (int16_t)0x41CE, (int16_t)0x6A6E,
+    (int16_t)0x471D, (int16_t)0x66D0, (int16_t)0x4C40, (int16_t)0x62F2, (int16_t)0x5134,
+    (int16_t)0x5ED7, (int16_t)0x55F6, (int16_t)0x5A82, (int16_t)0x5A82, (int16_t)0x7FFF,
+    (int16_t)0x0000, (int16_t)0x7D8A, (int16_t)0x18F9, (int16_t)0x7642, (int16_t)0x30FC,
+    (int16_t)0x6A6E, (int16_t)0x471D, (int16_t)0x5A82, (int16_t)0x5A82, (int16_t)0x471D,
+    (int16_t)0x6A6E, (int16_t)0x30FC, (int16_t)0x7642, (int16_t)0x18F9, (int16_t)0x7D8A,
+    (int16_t)0x0000, (int16_t)0x7FFF, (int16_t)0xE707, (int16_t)0x7D8A, (int16_t)0xCF04,
+    (int16_t)0x7642, (int16_t)0xB8E3, (int16_t)0x6A6E, (int16_t)0xA57E, (int16_t)0x5A82,
+    (int16_t)0x9592, (int16_t)0x471D, (int16_t)0x89BE, (int16_t)0x30FC, (int16_t)0x8276,
+    (int16_t)0x18F9, (int16_t)0x8001, (int16_t)0x0000
+};
+
+/**
+  @par
+  Post and split twiddle factors of the DCT-II, generated with:
+  @par
+  <pre>for (i = 0; i <= N/2; i++)
+  {
+     twiddleCoef[2*i]         = cos(i * PI/(float)(2*N));
+     twiddleCoef[2*i+1]       = sin(i * PI/(float)(2*N));
+     twiddleCoef[N+2+2*i]     = cos(i * 2*PI/(float)N);
+     twiddleCoef[N+2+2*i+1]   = sin(i * 2*PI/(float)N);
+  } </pre>
+  @par
+  where N = 40, PI = 3.14159265358979
+  @par
+  Convert Floating point to q15(Fixed point 1.15), saturated to [-32767, 32767]:
+        round(twiddleCoefq15(i) * pow(2, 15))
+ */
+const int16_t twiddleCoef_dct2_40_q16[84] = {
+    (int16_t)0x7FFF, (int16_t)0x0000, (int16_t)0x7FE7, (int16_t)0x0506, (int16_t)0x7F9B,
+    (int16_t)0x0A0B, (int16_t)0x7F1D, (int16_t)0x0F0B, (int16_t)0x7E6D, (int16_t)0x1406,
+    (int16_t)0x7D8A, (int16_t)0x18F9, (int16_t)0x7C77, (int16_t)0x1DE2, (int16_t)0x7B32,
+    (int16_t)0x22BF, (int16_t)0x79BC, (int16_t)0x278E, (int16_t)0x7817, (int16_t)0x2C4E,
+    (int16_t)0x7642, (int16_t)0x30FC, (int16_t)0x743E, (int16_t)0x3597, (int16_t)0x720D,
+    (int16_t)0x3A1C, (int16_t)0x6FAE, (int16_t)0x3E8B, (int16_t)0x6D23, (int16_t)0x42E1,
+    (int16_t)0x6A6E, (int16_t)0x471D, (int16_t)0x678E, (int16_t)0x4B3D, (int16_t)0x6485,
+    (int16_t)0x4F3E, (int16_t)0x6155, (int16_t)0x5321, (int16_t)0x5DFE, (int16_t)0x56E3,
+    (int16_t)0x5A82, (int16_t)0x5A82, (int16_t)0x7FFF, (int16_t)0x0000, (int16_t)0x7E6D,
+    (int16_t)0x1406, (int16_t)0x79BC, (int16_t)0x278E, (int16_t)0x720D, (int16_t)0x3A1C,
+    (int16_t)0x678E, (int16_t)0x4B3D, (int16_t)0x5A82, (int16_t)0x5A82, (int16_t)0x4B3D,
+    (int16_t)0x678E, (int16_t)0x3A1C, (int16_t)0x720D, (int16_t)0x278E, (int16_t)0x79BC,
+    (int16_t)0x1406, (int16_t)0x7E6D, (int16_t)0x0000, (int16_t)0x7FFF, (int16_t)0xEBFA,
+    (int16_t)0x7E6D, (int16_t)0xD872, (int16_t)0x79BC, (int16_t)0xC5E4, (int16_t)0x720D,
+    (int16_t)0xB4C3, (int16_t)0x678E, (int16_t)0xA57E, (int16_t)0x5A82, (int16_t)0x9872,
+    (int16_t)0x4B3D, (int16_t)0x8DF3, (int16_t)0x3A1C, (int16_t)0x8644, (int16_t)0x278E,
+    (int16_t)0x8193, (int16_t)0x1406, (int16_t)0x8001, (int16_t)0x0000
+};
+
+/**
+  @par
+  Pre and post twiddle factors of the DCT-IV and MDCT, generated with:
+  @par
+  <pre>for (i = 0; i < N/2; i++)
+  {
+     twiddleCoef[2*i]       = cos((4*i+1) * PI/(float)(4*N));
+     twiddleCoef[2*i+1]     = sin((4*i+1) * PI/(float)(4*N));
+     twiddleCoef[N+2*i]     = cos(i * PI/(float)N);
+     twiddleCoef[N+2*i+1]   = sin(i * PI/(float)N);
+  } </pre>
+  @par
+  where N = 128, PI = 3.14159265358979
+ */
+const float32_t twiddleCoef_dct4_128_f32[256] = {
+    0.99998118f, 0.00613588f, 0.99952942f, 0.03067480f, 0.99847558f, 0.05519524f,
+    0.99682030f, 0.07968244f, 0.99456457f, 0.10412163f, 0.99170975f, 0.12849811f,
+    0.98825757f, 0.15279719f, 0.98421009f, 0.17700422f, 0.97956977f, 0.20110463f,
+    0.97433938f, 0.22508391f, 0.96852209f, 0.24892761f, 0.96212140f, 0.27262136f,
+    0.95514117f, 0.29615089f, 0.94758559f, 0.31950203f, 0.93945922f, 0.34266072f,
+    0.93076696f, 0.36561300f, 0.92151404f, 0.38834505f, 0.91170603f, 0.41084317f,
+    0.90134885f, 0.43309382f, 0.89044872f, 0.45508359f, 0.87901223f, 0.47679923f,
+    0.86704625f, 0.49822767f, 0.85455799f, 0.51935599f, 0.84155498f, 0.54017147f,
+    0.82804505f, 0.56066158f, 0.81403633f, 0.58081396f, 0.79953727f, 0.60061648f,
+    0.78455660f, 0.62005721f, 0.76910334f, 0.63912444f, 0.75318680f, 0.65780669f,
+    0.73681657f, 0.67609270f, 0.72000251f, 0.69397146f, 0.70275474f, 0.71143220f,
+    0.68508367f, 0.72846439f, 0.66699992f, 0.74505779f, 0.64851440f, 0.76120239f,
+    0.62963824f, 0.77688847f, 0.61038281f, 0.79210658f, 0.59075970f, 0.80684755f,
+    0.57078075f, 0.82110251f, 0.55045797f, 0.83486287f, 0.52980362f, 0.84812034f,
+    0.50883014f, 0.86086694f, 0.48755016f, 0.87309498f, 0.46597650f, 0.88479710f,
+    0.44412214f, 0.89596625f, 0.42200027f, 0.90659570f, 0.39962420f, 0.91667906f,
+    0.37700741f, 0.92621024f, 0.35416353f, 0.93518351f, 0.33110631f, 0.94359346f,
+    0.30784964f, 0.95143502f, 0.28440754f, 0.95870347f, 0.26079412f, 0.96539444f,
+    0.23702361f, 0.97150389f, 0.21311032f, 0.97702814f, 0.18906866f, 0.98196387f,
+    0.16491312f, 0.98630810f, 0.14065824f, 0.99005821f, 0.11631863f, 0.99321195f,
+    0.09190896f, 0.99576741f, 0.06744392f, 0.99772307f, 0.04293826f, 0.99907773f,
+    0.01840673f, 0.99983058f, 1.00000000f, 0.00000000f, 0.99969882f, 0.02454123f,
+    0.99879546f, 0.04906767f, 0.99729046f, 0.07356456f, 0.99518473f, 0.09801714f,
+    0.99247953f, 0.12241068f, 0.98917651f, 0.14673047f, 0.98527764f, 0.17096189f,
+    0.98078528f, 0.19509032f, 0.97570213f, 0.21910124f, 0.97003125f, 0.24298018f,
+    0.96377607f, 0.26671276f, 0.95694034f, 0.29028468f, 0.94952818f, 0.31368174f,
+    0.94154407f, 0.33688985f, 0.93299280f, 0.35989504f, 0.92387953f, 0.38268343f,
+    0.91420976f, 0.40524131f, 0.90398929f, 0.42755509f, 0.89322430f, 0.44961133f,
+    0.88192126f, 0.47139674f, 0.87008699f, 0.49289819f, 0.85772861f, 0.51410274f,
+    0.84485357f, 0.53499762f, 0.83146961f, 0.55557023f, 0.81758481f, 0.57580819f,
+    0.80320753f, 0.59569930f, 0.78834643f, 0.61523159f, 0.77301045f, 0.63439328f,
+    0.75720885f, 0.65317284f, 0.74095113f, 0.67155895f, 0.72424708f, 0.68954054f,
+    0.70710678f, 0.70710678f, 0.68954054f, 0.72424708f, 0.67155895f, 0.74095113f,
+    0.65317284f, 0.75720885f, 0.63439328f, 0.77301045f, 0.61523159f, 0.78834643f,
+    0.59569930f, 0.80320753f, 0.57580819f, 0.81758481f, 0.55557023f, 0.83146961f,
+    0.53499762f, 0.84485357f, 0.51410274f, 0.85772861f, 0.49289819f, 0.87008699f,
+    0.47139674f, 0.88192126f, 0.44961133f, 0.89322430f, 0.42755509f, 0.90398929f,
+    0.40524131f, 0.91420976f, 0.38268343f, 0.92387953f, 0.35989504f, 0.93299280f,
+    0.33688985f, 0.94154407f, 0.31368174f, 0.94952818f, 0.29028468f, 0.95694034f,
+    0.26671276f, 0.96377607f, 0.24298018f, 0.97003125f, 0.21910124f, 0.97570213f,
+    0.19509032f, 0.98078528f, 0.17096189f, 0.98527764f, 0.14673047f, 0.98917651f,
+    0.12241068f, 0.99247953f, 0.09801714f, 0.99518473f, 0.07356456f, 0.99729046f,
+    0.04906767f, 0.99879546f, 0.02454123f, 0.99969882f
+};
+
+/**
+  @par
+  Pre and post twiddle factors of the DCT-IV and MDCT, generated with:
+  @par
+  <pre>for (i = 0; i < N/2; i++)
+  {
+     twiddleCoef[2*i]       = cos((4*i+1) * PI/(float)(4*N));
+     twiddleCoef[2*i+1]     = sin((4*i+1) * PI/(float)(4*N));
+     twiddleCoef[N+2*i]     = cos(i * PI/(float)N);
+     twiddleCoef[N+2*i+1]   = sin(i * PI/(float)N);
+  } </pre>
+  @par
+  where N = 256, PI = 3.14159265358979
+ */
+const float32_t twiddleCoef_dct4_256_f32[512] = {
+    0.99999529f, 0.00306796f, 0.99988235f, 0.01533921f, 0.99961882f, 0.02760815f,
+    0.99920476f, 0.03987293f, 0.99864022f, 0.05213170f, 0.99792529f, 0.06438263f,
+    0.99706007f, 0.07662386f, 0.99604470f, 0.08885355f, 0.99487933f, 0.10106986f,
+    0.99356414f, 0.11327095f, 0.99209931f, 0.12545498f, 0.99048508f, 0.13762012f,
+    0.98872169f, 0.14976453f, 0.98680940f, 0.16188639f, 0.98474850f, 0.17398387f,
+    0.98253930f, 0.18605515f, 0.98018214f, 0.19809841f, 0.97767736f, 0.21011184f,
+    0.97502535f, 0.22209362f, 0.97222650f, 0.23404196f, 0.96928124f, 0.24595505f,
+    0.96619000f, 0.25783110f, 0.96295327f, 0.26966833f, 0.95957151f, 0.28146494f,
+    0.95604525f, 0.29321916f, 0.95237501f, 0.30492923f, 0.94856135f, 0.31659338f,
+    0.94460484f, 0.32820984f, 0.94050607f, 0.33977688f, 0.93626567f, 0.35129276f,
+    0.93188427f, 0.36275572f, 0.92736253f, 0.37416406f, 0.92270113f, 0.38551605f,
+    0.91790078f, 0.39680999f, 0.91296219f, 0.40804416f, 0.90788612f, 0.41921689f,
+    0.90267332f, 0.43032648f, 0.89732458f, 0.44137127f, 0.89184071f, 0.45234959f,
+    0.88622253f, 0.46325978f, 0.88047089f, 0.47410021f, 0.87458665f, 0.48486925f,
+    0.86857071f, 0.49556526f, 0.86242396f, 0.50618665f, 0.85614733f, 0.51673180f,
+    0.84974177f, 0.52719913f, 0.84320824f, 0.53758708f, 0.83654773f, 0.54789406f,
+    0.82976123f, 0.55811853f, 0.82284978f, 0.56825895f, 0.81581441f, 0.57831380f,
+    0.80865618f, 0.58828155f, 0.80137617f, 0.59816071f, 0.79397548f, 0.60794978f,
+    0.78645521f, 0.61764731f, 0.77881651f, 0.62725182f, 0.77106052f, 0.63676186f,
+    0.76318842f, 0.64617601f, 0.75520138f, 0.65549285f, 0.74710061f, 0.66471098f,
+    0.73888732f, 0.67382900f, 0.73056277f, 0.68284555f, 0.72212819f, 0.69175926f,
+    0.71358487f, 0.70056879f, 0.70493408f, 0.70927283f, 0.69617713f, 0.71787005f,
+    0.68731534f, 0.72635916f, 0.67835004f, 0.73473888f, 0.66928259f, 0.74300795f,
+    0.66011434f, 0.75116513f, 0.65084668f, 0.75920919f, 0.64148101f, 0.76713891f,
+    0.63201874f, 0.77495311f, 0.62246128f, 0.78265060f, 0.61281008f, 0.79023022f,
+    0.60306660f, 0.79769084f, 0.59323230f, 0.80503133f, 0.58330865f, 0.81225059f,
+    0.57329717f, 0.81934752f, 0.56319934f, 0.82632106f, 0.55301671f, 0.83317016f,
+    0.54275078f, 0.83989379f, 0.53240313f, 0.84649094f, 0.52197529f, 0.85296060f,
+    0.51146885f, 0.85930182f, 0.50088538f, 0.86551362f, 0.49022648f, 0.87159509f,
+    0.47949376f, 0.87754529f, 0.46868882f, 0.88336334f, 0.45781330f, 0.88904836f,
+    0.44686884f, 0.89459949f, 0.43585708f, 0.90001589f, 0.42477968f, 0.90529676f,
+    0.41363831f, 0.91044129f, 0.40243465f, 0.91544872f, 0.39117038f, 0.92031828f,
+    0.37984721f, 0.92504924f, 0.36846683f, 0.92964090f, 0.35703096f, 0.93409255f,
+    0.34554132f, 0.93840353f, 0.33399965f, 0.94257320f, 0.32240768f, 0.94660091f,
+    0.31076715f, 0.95048607f, 0.29907983f, 0.95422810f, 0.28734746f, 0.95782641f,
+    0.27557182f, 0.96128049f, 0.26375468f, 0.96458979f, 0.25189782f, 0.96775384f,
+    0.24000302f, 0.97077214f, 0.22807208f, 0.97364425f, 0.21610680f, 0.97636973f,
+    0.20410897f, 0.97894818f, 0.19208040f, 0.98137919f, 0.18002290f, 0.98366242f,
+    0.16793829f, 0.98579751f, 0.15582840f, 0.98778414f, 0.14369503f, 0.98962202f,
+    0.13154003f, 0.99131086f, 0.11936521f, 0.99285041f, 0.10717242f, 0.99424045f,
+    0.09496350f, 0.99548076f, 0.08274026f, 0.99657115f, 0.07050457f, 0.99751146f,
+    0.05825826f, 0.99830154f, 0.04600318f, 0.99894129f, 0.03374117f, 0.99943060f,
+    0.02147408f, 0.99976941f, 0.00920375f, 0.99995764f, 1.00000000f, 0.00000000f,
+    0.99992470f, 0.01227154f, 0.99969882f, 0.02454123f, 0.99932238f, 0.03680722f,
+    0.99879546f, 0.04906767f, 0.99811811f, 0.06132074f, 0.99729046f, 0.07356456f,
+    0.99631261f, 0.08579731f, 0.99518473f, 0.09801714f, 0.99390697f, 0.11022221f,
+    0.99247953f, 0.12241068f, 0.99090264f, 0.13458071f, 0.98917651f, 0.14673047f,
+    0.98730142f, 0.15885814f, 0.98527764f, 0.17096189f, 0.98310549f, 0.18303989f,
+    0.98078528f, 0.19509032f, 0.97831737f, 0.20711138f, 0.97570213f, 0.21910124f,
+    0.97293995f, 0.23105811f, 0.97003125f, 0.24298018f, 0.96697647f, 0.25486566f,
+    0.96377607f, 0.26671276f, 0.96043052f, 0.27851969f, 0.95694034f, 0.29028468f,
+    0.95330604f, 0.30200595f, 0.94952818f, 0.31368174f, 0.94560733f, 0.32531029f,
+    0.94154407f, 0.33688985f, 0.93733901f, 0.34841868f, 0.93299280f, 0.35989504f,
+    0.92850608f, 0.37131719f, 0.92387953f, 0.38268343f, 0.91911385f, 0.39399204f,
+    0.91420976f, 0.40524131f, 0.90916798f, 0.41642956f, 0.90398929f, 0.42755509f,
+    0.89867447f, 0.43861624f, 0.89322430f, 0.44961133f, 0.88763962f, 0.46053871f,
+    0.88192126f, 0.47139674f, 0.87607009f, 0.48218377f, 0.87008699f, 0.49289819f,
+    0.86397286f, 0.50353838f, 0.85772861f, 0.51410274f, 0.85135519f, 0.52458968f,
+    0.84485357f, 0.53499762f, 0.83822471f, 0.54532499f, 0.83146961f, 0.55557023f,
+    0.82458930f, 0.56573181f, 0.81758481f, 0.57580819f, 0.81045720f, 0.58579786f,
+    0.80320753f, 0.59569930f, 0.79583690f, 0.60551104f, 0.78834643f, 0.61523159f,
+    0.78073723f, 0.62485949f, 0.77301045f, 0.63439328f, 0.76516727f, 0.64383154f,
+    0.75720885f, 0.65317284f, 0.74913639f, 0.66241578f, 0.74095113f, 0.67155895f,
+    0.73265427f, 0.68060100f, 0.72424708f, 0.68954054f, 0.71573083f, 0.69837625f,
+    0.70710678f, 0.70710678f, 0.69837625f, 0.71573083f, 0.68954054f, 0.72424708f,
+    0.68060100f, 0.73265427f, 0.67155895f, 0.74095113f, 0.66241578f, 0.74913639f,
+    0.65317284f, 0.75720885f, 0.64383154f, 0.76516727f, 0.63439328f, 0.77301045f,
+    0.62485949f, 0.78073723f, 0.61523159f, 0.78834643f, 0.60551104f, 0.79583690f,
+    0.59569930f, 0.80320753f, 0.58579786f, 0.81045720f, 0.57580819f, 0.81758481f,
+    0.56573181f, 0.82458930f, 0.55557023f, 0.83146961f, 0.54532499f, 0.83822471f,
+    0.53499762f, 0.84485357f, 0.52458968f, 0.85135519f, 0.51410274f, 0.85772861f,
+    0.50353838f, 0.86397286f, 0.49289819f, 0.87008699f, 0.48218377f, 0.87607009f,
+    0.47139674f, 0.88192126f, 0.46053871f, 0.88763962f, 0.44961133f, 0.89322430f,
+    0.43861624f, 0.89867447f, 0.42755509f, 0.90398929f, 0.41642956f, 0.90916798f,
+    0.40524131f, 0.91420976f, 0.39399204f, 0.91911385f, 0.38268343f, 0.92387953f,
+    0.37131719f, 0.92850608f, 0.35989504f, 0.93299280f, 0.34841868f, 0.93733901f,
+    0.33688985f, 0.94154407f, 0.32531029f, 0.94560733f, 0.31368174f, 0.94952818f,
+    0.30200595f, 0.95330604f, 0.29028468f, 0.95694034f, 0.27851969f, 0.96043052f,
+    0.26671276f, 0.96377607f, 0.25486566f, 0.96697647f, 0.24298018f, 0.97003125f,
+    0.23105811f, 0.97293995f, 0.21910124f, 0.97570213f, 0.20711138f, 0.97831737f,
+    0.19509032f, 0.98078528f, 0.18303989f, 0.98310549f, 0.17096189f, 0.98527764f,
+    0.15885814f, 0.98730142f, 0.14673047f, 0.98917651f, 0.13458071f, 0.99090264f,
+    0.12241068f, 0.99247953f, 0.11022221f, 0.99390697f, 0.09801714f, 0.99518473f,
+    0.08579731f, 0.99631261f, 0.07356456f, 0.99729046f, 0.06132074f, 0.99811811f,
+    0.04906767f, 0.99879546f, 0.03680722f, 0.99932238f, 0.02454123f, 0.99969882f,
+    0.01227154f, 0.99992470f
+};
+
+/**
+  @par
+  Pre and post twiddle factors of the DCT-IV and MDCT, generated with:
+  @par
+  <pre>for (i = 0; i < N/2; i++)
+  {
+     twiddleCoef[2*i]       = cos((4*i+1) * PI/(float)(4*N));
+     twiddleCoef[2*i+1]     = sin((4*i+1) * PI/(float)(4*N));
+     twiddleCoef[N+2*i]     = cos(i * PI/(float)N);
+     twiddleCoef[N+2*i+1]   = sin(i * PI/(float)N);
+  } </pre>
+  @par
+  where N = 512, PI = 3.14159265358979
+ */
+const float32_t twiddleCoef_dct4_512_f32[1024] = {
+    0.99999882f, 0.00153398f, 0.99997059f, 0.00766983f, 0.99990470f, 0.01380539f,
+    0.99980117f, 0.01994043f, 0.99966000f, 0.02607472f, 0.99948119f, 0.03220803f,
+    0.99926475f, 0.03834012f, 0.99901069f, 0.04447077f, 0.99871901f, 0.05059975f,
+    0.99838974f, 0.05672682f, 0.99802287f, 0.06285176f, 0.99761844f, 0.06897433f,
+    0.99717644f, 0.07509430f, 0.99669690f, 0.08121145f, 0.99617983f, 0.08732554f,
+    0.99562526f, 0.09343634f, 0.99503320f, 0.09954362f, 0.99440368f, 0.10564715f,
+    0.99373672f, 0.11174671f, 0.99303235f, 0.11784206f, 0.99229059f, 0.12393298f,
+    0.99151147f, 0.13001922f, 0.99069503f, 0.13610058f, 0.98984128f, 0.14217680f,
+    0.98895026f, 0.14824768f, 0.98802202f, 0.15431297f, 0.98705657f, 0.16037246f,
+    0.98605396f, 0.16642590f, 0.98501423f, 0.17247308f, 0.98393741f, 0.17851377f,
+    0.98282355f, 0.18454774f, 0.98167269f, 0.19057475f, 0.98048486f, 0.19659460f,
+    0.97926012f, 0.20260704f, 0.97799851f, 0.20861185f, 0.97670009f, 0.21460881f,
+    0.97536489f, 0.22059769f, 0.97399296f, 0.22657826f, 0.97258437f, 0.23255031f,
+    0.97113916f, 0.23851359f, 0.96965739f, 0.24446790f, 0.96813910f, 0.25041301f,
+    0.96658437f, 0.25634868f, 0.96499325f, 0.26227471f, 0.96336580f, 0.26819086f,
+    0.96170208f, 0.27409691f, 0.96000215f, 0.27999264f, 0.95826607f, 0.28587783f,
+    0.95649392f, 0.29175226f, 0.95468575f, 0.29761571f, 0.95284165f, 0.30346795f,
+    0.95096167f, 0.30930876f, 0.94904588f, 0.31513793f, 0.94709437f, 0.32095523f,
+    0.94510719f, 0.32676045f, 0.94308444f, 0.33255337f, 0.94102618f, 0.33833377f,
+    0.93893248f, 0.34410143f, 0.93680344f, 0.34985613f, 0.93463913f, 0.35559766f,
+    0.93243963f, 0.36132581f, 0.93020502f, 0.36704035f, 0.92793539f, 0.37274107f,
+    0.92563083f, 0.37842775f, 0.92329142f, 0.38410020f, 0.92091724f, 0.38975817f,
+    0.91850839f, 0.39540148f, 0.91606497f, 0.40102990f, 0.91358705f, 0.40664322f,
+    0.91107473f, 0.41224123f, 0.90852812f, 0.41782372f, 0.90594730f, 0.42339047f,
+    0.90333237f, 0.42894129f, 0.90068343f, 0.43447596f, 0.89800058f, 0.43999427f,
+    0.89528392f, 0.44549602f, 0.89253356f, 0.45098099f, 0.88974959f, 0.45644898f,
+    0.88693212f, 0.46189979f, 0.88408126f, 0.46733321f, 0.88119711f, 0.47274903f,
+    0.87827979f, 0.47814706f, 0.87532940f, 0.48352708f, 0.87234606f, 0.48888890f,
+    0.86932987f, 0.49423231f, 0.86628095f, 0.49955711f, 0.86319942f, 0.50486311f,
+    0.86008539f, 0.51015010f, 0.85693898f, 0.51541788f, 0.85376030f, 0.52066625f,
+    0.85054948f, 0.52589503f, 0.84730664f, 0.53110400f, 0.84403190f, 0.53629298f,
+    0.84072537f, 0.54146177f, 0.83738720f, 0.54661017f, 0.83401750f, 0.55173799f,
+    0.83061640f, 0.55684504f, 0.82718403f, 0.56193112f, 0.82372051f, 0.56699605f,
+    0.82022598f, 0.57203963f, 0.81670057f, 0.57706167f, 0.81314441f, 0.58206199f,
+    0.80955764f, 0.58704039f, 0.80594039f, 0.59199669f, 0.80229280f, 0.59693071f,
+    0.79861499f, 0.60184225f, 0.79490713f, 0.60673113f, 0.79116933f, 0.61159716f,
+    0.78740175f, 0.61644017f, 0.78360452f, 0.62125998f, 0.77977779f, 0.62605639f,
+    0.77592170f, 0.63082923f, 0.77203640f, 0.63557832f, 0.76812203f, 0.64030348f,
+    0.76417874f, 0.64500454f, 0.76020668f, 0.64968131f, 0.75620600f, 0.65433362f,
+    0.75217685f, 0.65896129f, 0.74811938f, 0.66356416f, 0.74403374f, 0.66814204f,
+    0.73992010f, 0.67269477f, 0.73577859f, 0.67722217f, 0.73160938f, 0.68172407f,
+    0.72741263f, 0.68620031f, 0.72318849f, 0.69065071f, 0.71893712f, 0.69507511f,
+    0.71465869f, 0.69947334f, 0.71035335f, 0.70384524f, 0.70602126f, 0.70819064f,
+    0.70166259f, 0.71250937f, 0.69727751f, 0.71680128f, 0.69286617f, 0.72106620f,
+    0.68842875f, 0.72530397f, 0.68396541f, 0.72951444f, 0.67947632f, 0.73369744f,
+    0.67496165f, 0.73785281f, 0.67042156f, 0.74198041f, 0.66585623f, 0.74608007f,
+    0.66126584f, 0.75015165f, 0.65665055f, 0.75419498f, 0.65201053f, 0.75820991f,
+    0.64734597f, 0.76219630f, 0.64265703f, 0.76615399f, 0.63794390f, 0.77008284f,
+    0.63320676f, 0.77398269f, 0.62844577f, 0.77785340f, 0.62366112f, 0.78169483f,
+    0.61885299f, 0.78550683f, 0.61402156f, 0.78928925f, 0.60916701f, 0.79304196f,
+    0.60428953f, 0.79676481f, 0.59938930f, 0.80045766f, 0.59446650f, 0.80412038f,
+    0.58952132f, 0.80775282f, 0.58455394f, 0.81135485f, 0.57956456f, 0.81492633f,
+    0.57455336f, 0.81846713f, 0.56952052f, 0.82197712f, 0.56446624f, 0.82545615f,
+    0.55939071f, 0.82890411f, 0.55429412f, 0.83232087f, 0.54917666f, 0.83570628f,
+    0.54403853f, 0.83906024f, 0.53887991f, 0.84238260f, 0.53370100f, 0.84567325f,
+    0.52850200f, 0.84893206f, 0.52328310f, 0.85215890f, 0.51804450f, 0.85535366f,
+    0.51278640f, 0.85851622f, 0.50750899f, 0.86164646f, 0.50221247f, 0.86474426f,
+    0.49689705f, 0.86780950f, 0.49156292f, 0.87084206f, 0.48621028f, 0.87384184f,
+    0.48083933f, 0.87680872f, 0.47545028f, 0.87974259f, 0.47004333f, 0.88264334f,
+    0.46461869f, 0.88551086f, 0.45917655f, 0.88834503f, 0.45371712f, 0.89114576f,
+    0.44824061f, 0.89391295f, 0.44274723f, 0.89664647f, 0.43723717f, 0.89934624f,
+    0.43171066f, 0.90201214f, 0.42616789f, 0.90464409f, 0.42060907f, 0.90724198f,
+    0.41503442f, 0.90980571f, 0.40944415f, 0.91233518f, 0.40383846f, 0.91483031f,
+    0.39821756f, 0.91729100f, 0.39258167f, 0.91971715f, 0.38693101f, 0.92210867f,
+    0.38126577f, 0.92446547f, 0.37558618f, 0.92678747f, 0.36989245f, 0.92907458f,
+    0.36418479f, 0.93132671f, 0.35846342f, 0.93354377f, 0.35272856f, 0.93572569f,
+    0.34698041f, 0.93787238f, 0.34121920f, 0.93998375f, 0.33544515f, 0.94205974f,
+    0.32965846f, 0.94410026f, 0.32385937f, 0.94610523f, 0.31804808f, 0.94807459f,
+    0.31222481f, 0.95000825f, 0.30638980f, 0.95190614f, 0.30054324f, 0.95376819f,
+    0.29468537f, 0.95559433f, 0.28881641f, 0.95738450f, 0.28293657f, 0.95913862f,
+    0.27704608f, 0.96085663f, 0.27114516f, 0.96253847f, 0.26523403f, 0.96418406f,
+    0.25931292f, 0.96579336f, 0.25338204f, 0.96736629f, 0.24744162f, 0.96890280f,
+    0.24149189f, 0.97040284f, 0.23553306f, 0.97186634f, 0.22956537f, 0.97329325f,
+    0.22358903f, 0.97468351f, 0.21760427f, 0.97603708f, 0.21161133f, 0.97735390f,
+    0.20561041f, 0.97863392f, 0.19960176f, 0.97987710f, 0.19358559f, 0.98108339f,
+    0.18756213f, 0.98225274f, 0.18153161f, 0.98338511f, 0.17549425f, 0.98448046f,
+    0.16945029f, 0.98553874f, 0.16339995f, 0.98655991f, 0.15734346f, 0.98754394f,
+    0.15128104f, 0.98849079f, 0.14521292f, 0.98940043f, 0.13913934f, 0.99027281f,
+    0.13306053f, 0.99110791f, 0.12697670f, 0.99190570f, 0.12088809f, 0.99266614f,
+    0.11479493f, 0.99338921f, 0.10869744f, 0.99407488f, 0.10259587f, 0.99472312f,
+    0.09649043f, 0.99533391f, 0.09038136f, 0.99590723f, 0.08426889f, 0.99644305f,
+    0.07815324f, 0.99694136f, 0.07203465f, 0.99740213f, 0.06591335f, 0.99782535f,
+    0.05978957f, 0.99821100f, 0.05366354f, 0.99855907f, 0.04753548f, 0.99886955f,
+    0.04140564f, 0.99914242f, 0.03527424f, 0.99937767f, 0.02914151f, 0.99957530f,
+    0.02300768f, 0.99973529f, 0.01687299f, 0.99985764f, 0.01073766f, 0.99994235f,
+    0.00460193f, 0.99998941f, 1.00000000f, 0.00000000f, 0.99998118f, 0.00613588f,
+    0.99992470f, 0.01227154f, 0.99983058f, 0.01840673f, 0.99969882f, 0.02454123f,
+    0.99952942f, 0.03067480f, 0.99932238f, 0.03680722f, 0.99907773f, 0.04293826f,
+    0.99879546f, 0.04906767f, 0.99847558f, 0.05519524f, 0.99811811f, 0.06132074f,
+    0.99772307f, 0.06744392f, 0.99729046f, 0.07356456f, 0.99682030f, 0.07968244f,
+    0.99631261f, 0.08579731f, 0.99576741f, 0.09190896f, 0.99518473f, 0.09801714f,
+    0.99456457f, 0.10412163f, 0.99390697f, 0.11022221f, 0.99321195f, 0.11631863f,
+    0.99247953f, 0.12241068f, 0.99170975f, 0.12849811f, 0.99090264f, 0.13458071f,
+    0.99005821f, 0.14065824f, 0.98917651f, 0.14673047f, 0.98825757f, 0.15279719f,
+    0.98730142f, 0.15885814f, 0.98630810f, 0.16491312f, 0.98527764f, 0.17096189f,
+    0.98421009f, 0.17700422f, 0.98310549f, 0.18303989f, 0.98196387f, 0.18906866f,
+    0.98078528f, 0.19509032f, 0.97956977f, 0.20110463f, 0.97831737f, 0.20711138f,
+    0.97702814f, 0.21311032f, 0.97570213f, 0.21910124f, 0.97433938f, 0.22508391f,
+    0.97293995f, 0.23105811f, 0.97150389f, 0.23702361f, 0.97003125f, 0.24298018f,
+    0.96852209f, 0.24892761f, 0.96697647f, 0.25486566f, 0.96539444f, 0.26079412f,
+    0.96377607f, 0.26671276f, 0.96212140f, 0.27262136f, 0.96043052f, 0.27851969f,
+    0.95870347f, 0.28440754f, 0.95694034f, 0.29028468f, 0.95514117f, 0.29615089f,
+    0.95330604f, 0.30200595f, 0.95143502f, 0.30784964f, 0.94952818f, 0.31368174f,
+    0.94758559f, 0.31950203f, 0.94560733f, 0.32531029f, 0.94359346f, 0.33110631f,
+    0.94154407f, 0.33688985f, 0.93945922f, 0.34266072f, 0.93733901f, 0.34841868f,
+    0.93518351f, 0.35416353f, 0.93299280f, 0.35989504f, 0.93076696f, 0.36561300f,
+    0.92850608f, 0.37131719f, 0.92621024f, 0.37700741f, 0.92387953f, 0.38268343f,
+    0.92151404f, 0.38834505f, 0.91911385f, 0.39399204f, 0.91667906f, 0.39962420f,
+    0.91420976f, 0.40524131f, 0.91170603f, 0.41084317f, 0.90916798f, 0.41642956f,
+    0.90659570f, 0.42200027f, 0.90398929f, 0.42755509f, 0.90134885f, 0.43309382f,
+    0.89867447f, 0.43861624f, 0.89596625f, 0.44412214f, 0.89322430f, 0.44961133f,
+    0.89044872f, 0.45508359f, 0.88763962f, 0.46053871f, 0.88479710f, 0.46597650f,
+    0.88192126f, 0.47139674f, 0.87901223f, 0.47679923f, 0.87607009f, 0.48218377f,
+    0.87309498f, 0.48755016f, 0.87008699f, 0.49289819f, 0.86704625f, 0.49822767f,
+    0.86397286f, 0.50353838f, 0.86086694f, 0.50883014f, 0.85772861f, 0.51410274f,
+    0.85455799f, 0.51935599f, 0.85135519f, 0.52458968f, 0.84812034f, 0.52980362f,
+    0.84485357f, 0.53499762f, 0.84155498f, 0.54017147f, 0.83822471f, 0.54532499f,
+    0.83486287f, 0.55045797f, 0.83146961f, 0.55557023f, 0.82804505f, 0.56066158f,
+    0.82458930f, 0.56573181f, 0.82110251f, 0.57078075f, 0.81758481f, 0.57580819f,
+    0.81403633f, 0.58081396f, 0.81045720f, 0.58579786f, 0.80684755f, 0.59075970f,
+    0.80320753f, 0.59569930f, 0.79953727f, 0.60061648f, 0.79583690f, 0.60551104f,
+    0.79210658f, 0.61038281f, 0.78834643f, 0.61523159f, 0.78455660f, 0.62005721f,
+    0.78073723f, 0.62485949f, 0.77688847f, 0.62963824f, 0.77301045f, 0.63439328f,
+    0.76910334f, 0.63912444f, 0.76516727f, 0.64383154f, 0.76120239f, 0.64851440f,
+    0.75720885f, 0.65317284f, 0.75318680f, 0.65780669f, 0.74913639f, 0.66241578f,
+    0.74505779f, 0.66699992f, 0.74095113f, 0.67155895f, 0.73681657f, 0.67609270f,
+    0.73265427f, 0.68060100f, 0.72846439f, 0.68508367f, 0.72424708f, 0.68954054f,
+    0.72000251f, 0.69397146f, 0.71573083f, 0.69837625f, 0.71143220f, 0.70275474f,
+    0.70710678f, 0.70710678f, 0.70275474f, 0.71143220f, 0.69837625f, 0.71573083f,
+    0.69397146f, 0.72000251f, 0.68954054f, 0.72424708f, 0.68508367f, 0.72846439f,
+    0.68060100f, 0.73265427f, 0.67609270f, 0.73681657f, 0.67155895f, 0.74095113f,
+    0.66699992f, 0.74505779f, 0.66241578f, 0.74913639f, 0.65780669f, 0.75318680f,
+    0.65317284f, 0.75720885f, 0.64851440f, 0.76120239f, 0.64383154f, 0.76516727f,
+    0.63912444f, 0.76910334f, 0.63439328f, 0.77301045f, 0.62963824f, 0.77688847f,
+    0.62485949f, 0.78073723f, 0.62005721f, 0.78455660f, 0.61523159f, 0.78834643f,
+    0.61038281f, 0.79210658f, 0.60551104f, 0.79583690f, 0.60061648f, 0.79953727f,
+    0.59569930f, 0.80320753f, 0.59075970f, 0.80684755f, 0.58579786f, 0.81045720f,
+    0.58081396f, 0.81403633f, 0.57580819f, 0.81758481f, 0.57078075f, 0.82110251f,
+    0.56573181f, 0.82458930f, 0.56066158f, 0.82804505f, 0.55557023f, 0.83146961f,
+    0.55045797f, 0.83486287f, 0.54532499f, 0.83822471f, 0.54017147f, 0.84155498f,
+    0.53499762f, 0.84485357f, 0.52980362f, 0.84812034f, 0.52458968f, 0.85135519f,
+    0.51935599f, 0.85455799f, 0.51410274f, 0.85772861f, 0.50883014f, 0.86086694f,
+    0.50353838f, 0.86397286f, 0.49822767f, 0.86704625f, 0.49289819f, 0.87008699f,
+    0.48755016f, 0.87309498f, 0.48218377f, 0.87607009f, 0.47679923f, 0.87901223f,
+    0.47139674f, 0.88192126f, 0.46597650f, 0.88479710f, 0.46053871f, 0.88763962f,
+    0.45508359f, 0.89044872f, 0.44961133f, 0.89322430f, 0.44412214f, 0.89596625f,
+    0.43861624f, 0.89867447f, 0.43309382f, 0.90134885f, 0.42755509f, 0.90398929f,
+    0.42200027f, 0.90659570f, 0.41642956f, 0.90916798f, 0.41084317f, 0.91170603f,
+    0.40524131f, 0.91420976f, 0.39962420f, 0.91667906f, 0.39399204f, 0.91911385f,
+    0.38834505f, 0.92151404f, 0.38268343f, 0.92387953f, 0.37700741f, 0.92621024f,
+    0.37131719f, 0.92850608f, 0.36561300f, 0.93076696f, 0.35989504f, 0.93299280f,
+    0.35416353f, 0.93518351f, 0.34841868f, 0.93733901f, 0.34266072f, 0.93945922f,
+    0.33688985f, 0.94154407f, 0.33110631f, 0.94359346f, 0.32531029f, 0.94560733f,
+    0.31950203f, 0.94758559f, 0.31368174f, 0.94952818f, 0.30784964f, 0.95143502f,
+    0.30200595f, 0.95330604f, 0.29615089f, 0.95514117f, 0.29028468f, 0.95694034f,
+    0.28440754f, 0.95870347f, 0.27851969f, 0.96043052f, 0.27262136f, 0.96212140f,
+    0.26671276f, 0.96377607f, 0.26079412f, 0.96539444f, 0.25486566f, 0.96697647f,
+    0.24892761f, 0.96852209f, 0.24298018f, 0.97003125f, 0.23702361f, 0.97150389f,
+    0.23105811f, 0.97293995f, 0.22508391f, 0.97433938f, 0.21910124f, 0.97570213f,
+    0.21311032f, 0.97702814f, 0.20711138f, 0.97831737f, 0.20110463f, 0.97956977f,
+    0.19509032f, 0.98078528f, 0.18906866f, 0.98196387f, 0.18303989f, 0.98310549f,
+    0.17700422f, 0.98421009f, 0.17096189f, 0.98527764f, 0.16491312f, 0.98630810f,
+    0.15885814f, 0.98730142f, 0.15279719f, 0.98825757f, 0.14673047f, 0.98917651f,
+    0.14065824f, 0.99005821f, 0.13458071f, 0.99090264f, 0.12849811f, 0.99170975f,
+    0.12241068f, 0.99247953f, 0.11631863f, 0.99321195f, 0.11022221f, 0.99390697f,
+    0.10412163f, 0.99456457f, 0.09801714f, 0.99518473f, 0.09190896f, 0.99576741f,
+    0.08579731f, 0.99631261f, 0.07968244f, 0.99682030f, 0.07356456f, 0.99729046f,
+    0.06744392f, 0.99772307f, 0.06132074f, 0.99811811f, 0.05519524f, 0.99847558f,
+    0.04906767f, 0.99879546f, 0.04293826f, 0.99907773f, 0.03680722f, 0.99932238f,
+    0.03067480f, 0.99952942f, 0.02454123f, 0.99969882f, 0.01840673f, 0.99983058f,
+    0.01227154f, 0.99992470f, 0.00613588f, 0.99998118f
+};
+
+/**
+  @par
+  Pre and post twiddle factors of the DCT-IV and MDCT, generated with:
+  @par
+  <pre>for (i = 0; i < N/2; i++)
+  {
+     twiddleCoef[2*i]       = cos((4*i+1) * PI/(float)(4*N));
+     twiddleCoef[2*i+1]     = sin((4*i+1) * PI/(float)(4*N));
+     twiddleCoef[N+2*i]     = cos(i * PI/(float)N);
+     twiddleCoef[N+2*i+1]   = sin(i * PI/(float)N);
+  } </pre>
+  @par
+  where N = 128, PI = 3.14159265358979
+  @par
+  Convert Floating point to q15(Fixed point 1.15), saturated to [-32767, 32767]:
+        round(twiddleCoefq15(i) * pow(2, 15))
+ */
+const int16_t twiddleCoef_dct4_128_q16[256] = {
+    (int16_t)0x7FFF, (int16_t)0x00C9, (int16_t)0x7FF1, (int16_t)0x03ED, (int16_t)0x7FCE,
+    (int16_t)0x0711, (int16_t)0x7F98, (int16_t)0x0A33, (int16_t)0x7F4E, (int16_t)0x0D54,
+    (int16_t)0x7EF0, (int16_t)0x1073, (int16_t)0x7E7F, (int16_t)0x138F, (int16_t)0x7DFB,
+    (int16_t)0x16A8, (int16_t)0x7D63, (int16_t)0x19BE, (int16_t)0x7CB7, (int16_t)0x1CD0,
+    (int16_t)0x7BF9, (int16_t)0x1FDD, (int16_t)0x7B27, (int16_t)0x22E5, (int16_t)0x7A42,
+    (int16_t)0x25E8, (int16_t)0x794A, (int16_t)0x28E5, (int16_t)0x7840, (int16_t)0x2BDC,
+    (int16_t)0x7723, (int16_t)0x2ECC, (int16_t)0x75F4, (int16_t)0x31B5, (int16_t)0x74B3,
+    (int16_t)0x3497, (int16_t)0x735F, (int16_t)0x3770, (int16_t)0x71FA, (int16_t)0x3A40,
+    (int16_t)0x7083, (int16_t)0x3D08, (int16_t)0x6EFB, (int16_t)0x3FC6, (int16_t)0x6D62,
+    (int16_t)0x427A, (int16_t)0x6BB8, (int16_t)0x4524, (int16_t)0x69FD, (int16_t)0x47C4,
+    (int16_t)0x6832, (int16_t)0x4A58, (int16_t)0x6657, (int16_t)0x4CE1, (int16_t)0x646C,
+    (int16_t)0x4F5E, (int16_t)0x6272, (int16_t)0x51CF, (int16_t)0x6068, (int16_t)0x5433,
+    (int16_t)0x5E50, (int16_t)0x568A, (int16_t)0x5C29, (int16_t)0x58D4, (int16_t)0x59F4,
+    (int16_t)0x5B10, (int16_t)0x57B1, (int16_t)0x5D3E, (int16_t)0x5560, (int16_t)0x5F5E,
+    (int16_t)0x5303, (int16_t)0x616F, (int16_t)0x5098, (int16_t)0x6371, (int16_t)0x4E21,
+    (int16_t)0x6564, (int16_t)0x4B9E, (int16_t)0x6747, (int16_t)0x490F, (int16_t)0x691A,
+    (int16_t)0x4675, (int16_t)0x6ADD, (int16_t)0x43D1, (int16_t)0x6C8F, (int16_t)0x4121,
+    (int16_t)0x6E31, (int16_t)0x3E68, (int16_t)0x6FC2, (int16_t)0x3BA5, (int16_t)0x7141,
+    (int16_t)0x38D9, (int16_t)0x72AF, (int16_t)0x3604, (int16_t)0x740B, (int16_t)0x3327,
+    (int16_t)0x7556, (int16_t)0x3042, (int16_t)0x768E, (int16_t)0x2D55, (int16_t)0x77B4,
+    (int16_t)0x2A62, (int16_t)0x78C8, (int16_t)0x2768, (int16_t)0x79C9, (int16_t)0x2467,
+    (int16_t)0x7AB7, (int16_t)0x2162, (int16_t)0x7B92, (int16_t)0x1E57, (int16_t)0x7C5A,
+    (int16_t)0x1B47, (int16_t)0x7D0F, (int16_t)0x1833, (int16_t)0x7DB1, (int16_t)0x151C,
+    (int16_t)0x7E3F, (int16_t)0x1201, (int16_t)0x7EBA, (int16_t)0x0EE4, (int16_t)0x7F22,
+    (int16_t)0x0BC4, (int16_t)0x7F75, (int16_t)0x08A2, (int16_t)0x7FB5, (int16_t)0x057F,
+    (int16_t)0x7FE2, (int16_t)0x025B, (int16_t)0x7FFA, (int16_t)0x7FFF, (int16_t)0x0000,
+    (int16_t)0x7FF6, (int16_t)0x0324, (int16_t)0x7FD9, (int16_t)0x0648, (int16_t)0x7FA7,
+    (int16_t)0x096B, (int16_t)0x7F62, (int16_t)0x0C8C, (int16_t)0x7F0A, (int16_t)0x0FAB,
+    (int16_t)0x7E9D, (int16_t)0x12C8, (int16_t)0x7E1E, (int16_t)0x15E2, (int16_t)0x7D8A,
+    (int16_t)0x18F9, (int16_t)0x7CE4, (int16_t)0x1C0C, (int16_t)0x7C2A, (int16_t)0x1F1A,
+    (int16_t)0x7B5D, (int16_t)0x2224, (int16_t)0x7A7D, (int16_t)0x2528, (int16_t)0x798A,
+    (int16_t)0x2827, (int16_t)0x7885, (int16_t)0x2B1F, (int16_t)0x776C, (int16_t)0x2E11,
+    (int16_t)0x7642, (int16_t)0x30FC, (int16_t)0x7505, (int16_t)0x33DF, (int16_t)0x73B6,
+    (int16_t)0x36BA, (int16_t)0x7255, (int16_t)0x398D, (int16_t)0x70E3, (int16_t)0x3C57,
+    (int16_t)0x6F5F, (int16_t)0x3F17, (int16_t)0x6DCA, (int16_t)0x41CE, (int16_t)0x6C24,
+    (int16_t)0x447B, (int16_t)0x6A6E, (int16_t)0x471D, (int16_t)0x68A7, (int16_t)0x49B4,
+    (int16_t)0x66D0, (int16_t)0x4C40, (int16_t)0x64E9, (int16_t)0x4EC0, (int16_t)0x62F2,
+    (int16_t)0x5134, (int16_t)0x60EC, (int16_t)0x539B, (int16_t)0x5ED7, (int16_t)0x55F6,
+    (int16_t)0x5CB4, (int16_t)0x5843, (int16_t)0x5A82, (int16_t)0x5A82, (int16_t)0x5843,
+    (int16_t)0x5CB4, (int16_t)0x55F6, (int16_t)0x5ED7, (int16_t)0x539B, (int16_t)0x60EC,
+    (int16_t)0x5134, (int16_t)0x62F2, (int16_t)0x4EC0, (int16_t)0x64E9, (int16_t)0x4C40,
+    (int16_t)0x66D0, (int16_t)0x49B4, (int16_t)0x68A7, (int16_t)0x471D, (int16_t)0x6A6E,
+    (int16_t)0x447B, (int16_t)0x6C24, (int16_t)0x41CE, (int16_t)0x6DCA, (int16_t)0x3F17,
+    (int16_t)0x6F5F, (int16_t)0x3C57, (int16_t)0x70E3, (int16_t)0x398D, (int16_t)0x7255,
+    (int16_t)0x36BA, (int16_t)0x73B6, (int16_t)0x33DF, (int16_t)0x7505, (int16_t)0x30FC,
+    (int16_t)0x7642, (int16_t)0x2E11, (int16_t)0x776C, (int16_t)0x2B1F, (int16_t)0x7885,
+    (int16_t)0x2827, (int16_t)0x798A, (int16_t)0x2528, (int16_t)0x7A7D, (int16_t)0x2224,
+    (int16_t)0x7B5D, (int16_t)0x1F1A, (int16_t)0x7C2A, (int16_t)0x1C0C, (int16_t)0x7CE4,
+    (int16_t)0x18F9, (int16_t)0x7D8A, (int16_t)0x15E2, (int16_t)0x7E1E, (int16_t)0x12C8,
+    (int16_t)0x7E9D, (int16_t)0x0FAB, (int16_t)0x7F0A, (int16_t)0x0C8C, (int16_t)0x7F62,
+    (int16_t)0x096B, (int16_t)0x7FA7, (int16_t)0x0648, (int16_t)0x7FD9, (int16_t)0x0324,
+    (int16_t)0x7FF6
+};
+
+/**
+  @par
+  Pre and post twiddle factors of the DCT-IV and MDCT, generated with:
+  @par
+  <pre>for (i = 0; i < N/2; i++)
+  {
+     twiddleCoef[2*i]       = cos((4*i+1) * PI/(float)(4*N));
+     twiddleCoef[2*i+1]     = sin((4*i+1) * PI/(float)(4*N));
+     twiddleCoef[N+2*i]     = cos(i * PI/(float)N);
+     twiddleCoef[N+2*i+1]   = sin(i * PI/(float)N);
+  } </pre>
+  @par
+  where N = 256, PI = 3.14159265358979
+  @par
+  Convert Floating point to q15(Fixed point 1.15), saturated to [-32767, 32767]:
+        round(twiddleCoefq15(i) * pow(2, 15))
+ */
+const int16_t twiddleCoef_dct4_256_q16[512] = {
+    (int16_t)0x7FFF, (int16_t)0x0065, (int16_t)0x7FFC, (int16_t)0x01F7, (int16_t)0x7FF4,
+    (int16_t)0x0389, (int16_t)0x7FE6, (int16_t)0x051B, (int16_t)0x7FD3, (int16_t)0x06AC,
+    (int16_t)0x7FBC, (int16_t)0x083E, (int16_t)0x7FA0, (int16_t)0x09CF, (int16_t)0x7F7E,
+    (int16_t)0x0B60, (int16_t)0x7F58, (int16_t)0x0CF0, (int16_t)0x7F2D, (int16_t)0x0E80,
+    (int16_t)0x7EFD, (int16_t)0x100F, (int16_t)0x7EC8, (int16_t)0x119E, (int16_t)0x7E8E,
+    (int16_t)0x132B, (int16_t)0x7E50, (int16_t)0x14B9, (int16_t)0x7E0C, (int16_t)0x1645,
+    (int16_t)0x7DC4, (int16_t)0x17D1, (int16_t)0x7D77, (int16_t)0x195B, (int16_t)0x7D25,
+    (int16_t)0x1AE5, (int16_t)0x7CCE, (int16_t)0x1C6E, (int16_t)0x7C72, (int16_t)0x1DF5,
+    (int16_t)0x7C11, (int16_t)0x1F7B, (int16_t)0x7BAC, (int16_t)0x2101, (int16_t)0x7B42,
+    (int16_t)0x2284, (int16_t)0x7AD3, (int16_t)0x2407, (int16_t)0x7A60, (int16_t)0x2588,
+    (int16_t)0x79E7, (int16_t)0x2708, (int16_t)0x796A, (int16_t)0x2886, (int16_t)0x78E9,
+    (int16_t)0x2A03, (int16_t)0x7863, (int16_t)0x2B7E, (int16_t)0x77D8, (int16_t)0x2CF7,
+    (int16_t)0x7748, (int16_t)0x2E6F, (int16_t)0x76B4, (int16_t)0x2FE5, (int16_t)0x761B,
+    (int16_t)0x3159, (int16_t)0x757E, (int16_t)0x32CB, (int16_t)0x74DC, (int16_t)0x343B,
+    (int16_t)0x7436, (int16_t)0x35A9, (int16_t)0x738B, (int16_t)0x3715, (int16_t)0x72DC,
+    (int16_t)0x387F, (int16_t)0x7228, (int16_t)0x39E7, (int16_t)0x7170, (int16_t)0x3B4C,
+    (int16_t)0x70B3, (int16_t)0x3CAF, (int16_t)0x6FF2, (int16_t)0x3E10, (int16_t)0x6F2D,
+    (int16_t)0x3F6F, (int16_t)0x6E64, (int16_t)0x40CB, (int16_t)0x6D96, (int16_t)0x4224,
+    (int16_t)0x6CC4, (int16_t)0x437B, (int16_t)0x6BEE, (int16_t)0x44D0, (int16_t)0x6B14,
+    (int16_t)0x4621, (int16_t)0x6A36, (int16_t)0x4770, (int16_t)0x6953, (int16_t)0x48BD,
+    (int16_t)0x686D, (int16_t)0x4A06, (int16_t)0x6782, (int16_t)0x4B4D, (int16_t)0x6693,
+    (int16_t)0x4C91, (int16_t)0x65A1, (int16_t)0x4DD1, (int16_t)0x64AB, (int16_t)0x4F0F,
+    (int16_t)0x63B0, (int16_t)0x504A, (int16_t)0x62B2, (int16_t)0x5181, (int16_t)0x61B0,
+    (int16_t)0x52B6, (int16_t)0x60AA, (int16_t)0x53E7, (int16_t)0x5FA1, (int16_t)0x5515,
+    (int16_t)0x5E94, (int16_t)0x5640, (int16_t)0x5D83, (int16_t)0x5767, (int16_t)0x5C6F,
+    (int16_t)0x588C, (int16_t)0x5B57, (int16_t)0x59AC, (int16_t)0x5A3B, (int16_t)0x5AC9,
+    (int16_t)0x591C, (int16_t)0x5BE3, (int16_t)0x57FA, (int16_t)0x5CF9, (int16_t)0x56D4,
+    (int16_t)0x5E0C, (int16_t)0x55AB, (int16_t)0x5F1B, (int16_t)0x547F, (int16_t)0x6026,
+    (int16_t)0x534F, (int16_t)0x612E, (int16_t)0x521C, (int16_t)0x6232, (int16_t)0x50E6,
+    (int16_t)0x6332, (int16_t)0x4FAD, (int16_t)0x642E, (int16_t)0x4E71, (int16_t)0x6526,
+    (int16_t)0x4D31, (int16_t)0x661B, (int16_t)0x4BEF, (int16_t)0x670B, (int16_t)0x4AAA,
+    (int16_t)0x67F8, (int16_t)0x4962, (int16_t)0x68E0, (int16_t)0x4817, (int16_t)0x69C5,
+    (int16_t)0x46C9, (int16_t)0x6AA5, (int16_t)0x4579, (int16_t)0x6B82, (int16_t)0x4426,
+    (int16_t)0x6C5A, (int16_t)0x42D0, (int16_t)0x6D2E, (int16_t)0x4178, (int16_t)0x6DFE,
+    (int16_t)0x401D, (int16_t)0x6EC9, (int16_t)0x3EC0, (int16_t)0x6F90, (int16_t)0x3D60,
+    (int16_t)0x7053, (int16_t)0x3BFE, (int16_t)0x7112, (int16_t)0x3A9A, (int16_t)0x71CC,
+    (int16_t)0x3933, (int16_t)0x7282, (int16_t)0x37CA, (int16_t)0x7334, (int16_t)0x365F,
+    (int16_t)0x73E1, (int16_t)0x34F2, (int16_t)0x7489, (int16_t)0x3383, (int16_t)0x752D,
+    (int16_t)0x3212, (int16_t)0x75CD, (int16_t)0x309F, (int16_t)0x7668, (int16_t)0x2F2A,
+    (int16_t)0x76FE, (int16_t)0x2DB3, (int16_t)0x7790, (int16_t)0x2C3B, (int16_t)0x781E,
+    (int16_t)0x2AC1, (int16_t)0x78A6, (int16_t)0x2945, (int16_t)0x792A, (int16_t)0x27C7,
+    (int16_t)0x79AA, (int16_t)0x2648, (int16_t)0x7A24, (int16_t)0x24C8, (int16_t)0x7A9A,
+    (int16_t)0x2346, (int16_t)0x7B0B, (int16_t)0x21C3, (int16_t)0x7B78, (int16_t)0x203E,
+    (int16_t)0x7BDF, (int16_t)0x1EB8, (int16_t)0x7C42, (int16_t)0x1D31, (int16_t)0x7CA0,
+    (int16_t)0x1BA9, (int16_t)0x7CFA, (int16_t)0x1A20, (int16_t)0x7D4E, (int16_t)0x1896,
+    (int16_t)0x7D9E, (int16_t)0x170B, (int16_t)0x7DE9, (int16_t)0x157F, (int16_t)0x7E2F,
+    (int16_t)0x13F2, (int16_t)0x7E70, (int16_t)0x1265, (int16_t)0x7EAC, (int16_t)0x10D6,
+    (int16_t)0x7EE3, (int16_t)0x0F47, (int16_t)0x7F16, (int16_t)0x0DB8, (int16_t)0x7F43,
+    (int16_t)0x0C28, (int16_t)0x7F6C, (int16_t)0x0A97, (int16_t)0x7F90, (int16_t)0x0906,
+    (int16_t)0x7FAE, (int16_t)0x0775, (int16_t)0x7FC8, (int16_t)0x05E3, (int16_t)0x7FDD,
+    (int16_t)0x0452, (int16_t)0x7FED, (int16_t)0x02C0, (int16_t)0x7FF8, (int16_t)0x012E,
+    (int16_t)0x7FFF, (int16_t)0x7FFF, (int16_t)0x0000, (int16_t)0x7FFE, (int16_t)0x0192,
+    (int16_t)0x7FF6, (int16_t)0x0324, (int16_t)0x7FEA, (int16_t)0x04B6, (int16_t)0x7FD9,
+    (int16_t)0x0648, (int16_t)0x7FC2, (int16_t)0x07D9, (int16_t)0x7FA7, (int16_t)0x096B,
+    (int16_t)0x7F87, (int16_t)0x0AFB, (int16_t)0x7F62, (int16_t)0x0C8C, (int16_t)0x7F38,
+    (int16_t)0x0E1C, (int16_t)0x7F0A, (int16_t)0x0FAB, (int16_t)0x7ED6, (int16_t)0x113A,
+    (int16_t)0x7E9D, (int16_t)0x12C8, (int16_t)0x7E60, (int16_t)0x1455, (int16_t)0x7E1E,
+    (int16_t)0x15E2, (int16_t)0x7DD6, (int16_t)0x176E, (int16_t)0x7D8A, (int16_t)0x18F9,
+    (int16_t)0x7D3A, (int16_t)0x1A83, (int16_t)0x7CE4, (int16_t)0x1C0C, (int16_t)0x7C89,
+    (int16_t)0x1D93, (int16_t)0x7C2A, (int16_t)0x1F1A, (int16_t)0x7BC6, (int16_t)0x209F,
+    (int16_t)0x7B5D, (int16_t)0x2224, (int16_t)0x7AEF, (int16_t)0x23A7, (int16_t)0x7A7D,
+    (int16_t)0x2528, (int16_t)0x7A06, (int16_t)0x26A8, (int16_t)0x798A, (int16_t)0x2827,
+    (int16_t)0x790A, (int16_t)0x29A4, (int16_t)0x7885, (int16_t)0x2B1F, (int16_t)0x77FB,
+    (int16_t)0x2C99, (int16_t)0x776C, (int16_t)0x2E11, (int16_t)0x76D9, (int16_t)0x2F87,
+    (int16_t)0x7642, (int16_t)0x30FC, (int16_t)0x75A6, (int16_t)0x326E, (int16_t)0x7505,
+    (int16_t)0x33DF, (int16_t)0x7460, (int16_t)0x354E, (int16_t)0x73B6, (int16_t)0x36BA,
+    (int16_t)0x7308, (int16_t)0x3825, (int16_t)0x7255, (int16_t)0x398D, (int16_t)0x719E,
+    (int16_t)0x3AF3, (int16_t)0x70E3, (int16_t)0x3C57, (int16_t)0x7023, (int16_t)0x3DB8,
+    (int16_t)0x6F5F, (int16_t)0x3F17, (int16_t)0x6E97, (int16_t)0x4074, (int16_t)0x6DCA,
+    (int16_t)0x41CE, (int16_t)0x6CF9, (int16_t)0x4326, (int16_t)0x6C24, (int16_t)0x447B,
+    (int16_t)0x6B4B, (int16_t)0x45CD, (int16_t)0x6A6E, (int16_t)0x471D, (int16_t)0x698C,
+    (int16_t)0x486A, (int16_t)0x68A7, (int16_t)0x49B4, (int16_t)0x67BD, (int16_t)0x4AFB,
+    (int16_t)0x66D0, (int16_t)0x4C40, (int16_t)0x65DE, (int16_t)0x4D81, (int16_t)0x64E9,
+    (int16_t)0x4EC0, (int16_t)0x63EF, (int16_t)0x4FFB, (int16_t)0x62F2, (int16_t)0x5134,
+    (int16_t)0x61F1, (int16_t)0x5269, (int16_t)0x60EC, (int16_t)0x539B, (int16_t)0x5FE4,
+    (int16_t)0x54CA, (int16_t)0x5ED7, (int16_t)0x55F6, (int16_t)0x5DC8, (int16_t)0x571E,
+    (int16_t)0x5CB4, (int16_t)0x5843, (int16_t)0x5B9D, (int16_t)0x5964, (int16_t)0x5A82,
+    (int16_t)0x5A82, (int16_t)0x5964, (int16_t)0x5B9D, (int16_t)0x5843, (int16_t)0x5CB4,
+    (int16_t)0x571E, (int16_t)0x5DC8, (int16_t)0x55F6, (int16_t)0x5ED7, (int16_t)0x54CA,
+    (int16_t)0x5FE4, (int16_t)0x539B, (int16_t)0x60EC, (int16_t)0x5269, (int16_t)0x61F1,
+    (int16_t)0x5134, (int16_t)0x62F2, (int16_t)0x4FFB, (int16_t)0x63EF, (int16_t)0x4EC0,
+    (int16_t)0x64E9, (int16_t)0x4D81, (int16_t)0x65DE, (int16_t)0x4C40, (int16_t)0x66D0,
+    (int16_t)0x4AFB, (int16_t)0x67BD, (int16_t)0x49B4, (int16_t)0x68A7, (int16_t)0x486A,
+    (int16_t)0x698C, (int16_t)0x471D, (int16_t)0x6A6E, (int16_t)0x45CD, (int16_t)0x6B4B,
+    (int16_t)0x447B, (int16_t)0x6C24, (int16_t)0x4326, (int16_t)0x6CF9, (int16_t)0x41CE,
+    (int16_t)0x6DCA, (int16_t)0x4074, (int16_t)0x6E97, (int16_t)0x3F17, (int16_t)0x6F5F,
+    (int16_t)0x3DB8, (int16_t)0x7023, (int16_t)0x3C57, (int16_t)0x70E3, (int16_t)0x3AF3,
+    (int16_t)0x719E, (int16_t)0x398D, (int16_t)0x7255, (int16_t)0x3825, (int16_t)0x7308,
+    (int16_t)0x36BA, (int16_t)0x73B6, (int16_t)0x354E, (int16_t)0x7460, (int16_t)0x33DF,
+    (int16_t)0x7505, (int16_t)0x326E, (int16_t)0x75A6, (int16_t)0x30FC, (int16_t)0x7642,
+    (int16_t)0x2F87, (int16_t)0x76D9, (int16_t)0x2E11, (int16_t)0x776C, (int16_t)0x2C99,
+    (int16_t)0x77FB, (int16_t)0x2B1F, (int16_t)0x7885, (int16_t)0x29A4, (int16_t)0x790A,
+    (int16_t)0x2827, (int16_t)0x798A, (int16_t)0x26A8, (int16_t)0x7A06, (int16_t)0x2528,
+    (int16_t)0x7A7D, (int16_t)0x23A7, (int16_t)0x7AEF, (int16_t)0x2224, (int16_t)0x7B5D,
+    (int16_t)0x209F, (int16_t)0x7BC6, (int16_t)0x1F1A, (int16_t)0x7C2A, (int16_t)0x1D93,
+    (int16_t)0x7C89, (int16_t)0x1C0C, (int16_t)0x7CE4, (int16_t)0x1A83, (int16_t)0x7D3A,
+    (int16_t)0x18F9, (int16_t)0x7D8A, (int16_t)0x176E, (int16_t)0x7DD6, (int16_t)0x15E2,
+    (int16_t)0x7E1E, (int16_t)0x1455, (int16_t)0x7E60, (int16_t)0x12C8, (int16_t)0x7E9D,
+    (int16_t)0x113A, (int16_t)0x7ED6, (int16_t)0x0FAB, (int16_t)0x7F0A, (int16_t)0x0E1C,
+    (int16_t)0x7F38, (int16_t)0x0C8C, (int16_t)0x7F62, (int16_t)0x0AFB, (int16_t)0x7F87,
+    (int16_t)0x096B, (int16_t)0x7FA7, (int16_t)0x07D9, (int16_t)0x7FC2, (int16_t)0x0648,
+    (int16_t)0x7FD9, (int16_t)0x04B6, (int16_t)0x7FEA, (int16_t)0x0324, (int16_t)0x7FF6,
+    (int16_t)0x0192, (int16_t)0x7FFE
+};
+
+/**
+  @par
+  Pre and post twiddle factors of the DCT-IV and MDCT, generated with:
+  @par
+  <pre>for (i = 0; i < N/2; i++)
+  {
+     twiddleCoef[2*i]       = cos((4*i+1) * PI/(float)(4*N));
+     twiddleCoef[2*i+1]     = sin((4*i+1) * PI/(float)(4*N));
+     twiddleCoef[N+2*i]     = cos(i * PI/(float)N);
+     twiddleCoef[N+2*i+1]   = sin(i * PI/(float)N);
+  } </pre>
+  @par
+  where N = 512, PI = 3.14159265358979
+  @par
+  Convert Floating point to q15(Fixed point 1.15), saturated to [-32767, 32767]:
+        round(twiddleCoefq15(i) * pow(2, 15))
+ */
+const int16_t twiddleCoef_dct4_512_q16[1024] = {
+    (int16_t)0x7FFF, (int16_t)0x0032, (int16_t)0x7FFF, (int16_t)0x00FB, (int16_t)0x7FFD,
+    (int16_t)0x01C4, (int16_t)0x7FF9, (int16_t)0x028D, (int16_t)0x7FF5, (int16_t)0x0356,
+    (int16_t)0x7FEF, (int16_t)0x041F, (int16_t)0x7FE8, (int16_t)0x04E8, (int16_t)0x7FE0,
+    (int16_t)0x05B1, (int16_t)0x7FD6, (int16_t)0x067A, (int16_t)0x7FCB, (int16_t)0x0743,
+    (int16_t)0x7FBF, (int16_t)0x080C, (int16_t)0x7FB2, (int16_t)0x08D4, (int16_t)0x7FA3,
+    (int16_t)0x099D, (int16_t)0x7F94, (int16_t)0x0A65, (int16_t)0x7F83, (int16_t)0x0B2D,
+    (int16_t)0x7F71, (int16_t)0x0BF6, (int16_t)0x7F5D, (int16_t)0x0CBE, (int16_t)0x7F49,
+    (int16_t)0x0D86, (int16_t)0x7F33, (int16_t)0x0E4E, (int16_t)0x7F1C, (int16_t)0x0F15,
+    (int16_t)0x7F03, (int16_t)0x0FDD, (int16_t)0x7EEA, (int16_t)0x10A4, (int16_t)0x7ECF,
+    (int16_t)0x116C, (int16_t)0x7EB3, (int16_t)0x1233, (int16_t)0x7E96, (int16_t)0x12FA,
+    (int16_t)0x7E78, (int16_t)0x13C1, (int16_t)0x7E58, (int16_t)0x1487, (int16_t)0x7E37,
+    (int16_t)0x154D, (int16_t)0x7E15, (int16_t)0x1614, (int16_t)0x7DF2, (int16_t)0x16DA,
+    (int16_t)0x7DCD, (int16_t)0x179F, (int16_t)0x7DA7, (int16_t)0x1865, (int16_t)0x7D81,
+    (int16_t)0x192A, (int16_t)0x7D58, (int16_t)0x19EF, (int16_t)0x7D2F, (int16_t)0x1AB4,
+    (int16_t)0x7D05, (int16_t)0x1B78, (int16_t)0x7CD9, (int16_t)0x1C3D, (int16_t)0x7CAC,
+    (int16_t)0x1D01, (int16_t)0x7C7E, (int16_t)0x1DC4, (int16_t)0x7C4E, (int16_t)0x1E88,
+    (int16_t)0x7C1E, (int16_t)0x1F4B, (int16_t)0x7BEC, (int16_t)0x200E, (int16_t)0x7BB9,
+    (int16_t)0x20D0, (int16_t)0x7B85, (int16_t)0x2192, (int16_t)0x7B50, (int16_t)0x2254,
+    (int16_t)0x7B19, (int16_t)0x2316, (int16_t)0x7AE1, (int16_t)0x23D7, (int16_t)0x7AA8,
+    (int16_t)0x2498, (int16_t)0x7A6E, (int16_t)0x2558, (int16_t)0x7A33, (int16_t)0x2618,
+    (int16_t)0x79F7, (int16_t)0x26D8, (int16_t)0x79B9, (int16_t)0x2797, (int16_t)0x797A,
+    (int16_t)0x2856, (int16_t)0x793A, (int16_t)0x2915, (int16_t)0x78F9, (int16_t)0x29D3,
+    (int16_t)0x78B7, (int16_t)0x2A91, (int16_t)0x7874, (int16_t)0x2B4F, (int16_t)0x782F,
+    (int16_t)0x2C0C, (int16_t)0x77E9, (int16_t)0x2CC8, (int16_t)0x77A2, (int16_t)0x2D84,
+    (int16_t)0x775A, (int16_t)0x2E40, (int16_t)0x7711, (int16_t)0x2EFB, (int16_t)0x76C7,
+    (int16_t)0x2FB6, (int16_t)0x767B, (int16_t)0x3070, (int16_t)0x762E, (int16_t)0x312A,
+    (int16_t)0x75E1, (int16_t)0x31E4, (int16_t)0x7592, (int16_t)0x329D, (int16_t)0x7542,
+    (int16_t)0x3355, (int16_t)0x74F0, (int16_t)0x340D, (int16_t)0x749E, (int16_t)0x34C4,
+    (int16_t)0x744B, (int16_t)0x357B, (int16_t)0x73F6, (int16_t)0x3632, (int16_t)0x73A0,
+    (int16_t)0x36E8, (int16_t)0x734A, (int16_t)0x379D, (int16_t)0x72F2, (int16_t)0x3852,
+    (int16_t)0x7299, (int16_t)0x3906, (int16_t)0x723F, (int16_t)0x39BA, (int16_t)0x71E3,
+    (int16_t)0x3A6D, (int16_t)0x7187, (int16_t)0x3B20, (int16_t)0x712A, (int16_t)0x3BD2,
+    (int16_t)0x70CB, (int16_t)0x3C83, (int16_t)0x706B, (int16_t)0x3D34, (int16_t)0x700B,
+    (int16_t)0x3DE4, (int16_t)0x6FA9, (int16_t)0x3E94, (int16_t)0x6F46, (int16_t)0x3F43,
+    (int16_t)0x6EE2, (int16_t)0x3FF1, (int16_t)0x6E7D, (int16_t)0x409F, (int16_t)0x6E17,
+    (int16_t)0x414D, (int16_t)0x6DB0, (int16_t)0x41F9, (int16_t)0x6D48, (int16_t)0x42A5,
+    (int16_t)0x6CDF, (int16_t)0x4351, (int16_t)0x6C75, (int16_t)0x43FB, (int16_t)0x6C09,
+    (int16_t)0x44A5, (int16_t)0x6B9D, (int16_t)0x454F, (int16_t)0x6B30, (int16_t)0x45F7,
+    (int16_t)0x6AC1, (int16_t)0x469F, (int16_t)0x6A52, (int16_t)0x4747, (int16_t)0x69E1,
+    (int16_t)0x47ED, (int16_t)0x6970, (int16_t)0x4893, (int16_t)0x68FD, (int16_t)0x4939,
+    (int16_t)0x688A, (int16_t)0x49DD, (int16_t)0x6815, (int16_t)0x4A81, (int16_t)0x67A0,
+    (int16_t)0x4B24, (int16_t)0x6729, (int16_t)0x4BC7, (int16_t)0x66B2, (int16_t)0x4C68,
+    (int16_t)0x6639, (int16_t)0x4D09, (int16_t)0x65C0, (int16_t)0x4DA9, (int16_t)0x6545,
+    (int16_t)0x4E49, (int16_t)0x64CA, (int16_t)0x4EE8, (int16_t)0x644D, (int16_t)0x4F85,
+    (int16_t)0x63D0, (int16_t)0x5023, (int16_t)0x6351, (int16_t)0x50BF, (int16_t)0x62D2,
+    (int16_t)0x515B, (int16_t)0x6252, (int16_t)0x51F5, (int16_t)0x61D1, (int16_t)0x5290,
+    (int16_t)0x614E, (int16_t)0x5329, (int16_t)0x60CB, (int16_t)0x53C1, (int16_t)0x6047,
+    (int16_t)0x5459, (int16_t)0x5FC2, (int16_t)0x54F0, (int16_t)0x5F3C, (int16_t)0x5586,
+    (int16_t)0x5EB6, (int16_t)0x561B, (int16_t)0x5E2E, (int16_t)0x56AF, (int16_t)0x5DA5,
+    (int16_t)0x5743, (int16_t)0x5D1C, (int16_t)0x57D5, (int16_t)0x5C91, (int16_t)0x5867,
+    (int16_t)0x5C06, (int16_t)0x58F8, (int16_t)0x5B7A, (int16_t)0x5988, (int16_t)0x5AED,
+    (int16_t)0x5A18, (int16_t)0x5A5F, (int16_t)0x5AA6, (int16_t)0x59D0, (int16_t)0x5B34,
+    (int16_t)0x5940, (int16_t)0x5BC0, (int16_t)0x58B0, (int16_t)0x5C4C, (int16_t)0x581E,
+    (int16_t)0x5CD7, (int16_t)0x578C, (int16_t)0x5D61, (int16_t)0x56F9, (int16_t)0x5DEA,
+    (int16_t)0x5665, (int16_t)0x5E72, (int16_t)0x55D0, (int16_t)0x5EF9, (int16_t)0x553B,
+    (int16_t)0x5F80, (int16_t)0x54A4, (int16_t)0x6005, (int16_t)0x540D, (int16_t)0x6089,
+    (int16_t)0x5375, (int16_t)0x610D, (int16_t)0x52DC, (int16_t)0x6190, (int16_t)0x5243,
+    (int16_t)0x6211, (int16_t)0x51A8, (int16_t)0x6292, (int16_t)0x510D, (int16_t)0x6312,
+    (int16_t)0x5071, (int16_t)0x6391, (int16_t)0x4FD4, (int16_t)0x640F, (int16_t)0x4F37,
+    (int16_t)0x648B, (int16_t)0x4E98, (int16_t)0x6507, (int16_t)0x4DF9, (int16_t)0x6582,
+    (int16_t)0x4D59, (int16_t)0x65FC, (int16_t)0x4CB9, (int16_t)0x6675, (int16_t)0x4C17,
+    (int16_t)0x66ED, (int16_t)0x4B75, (int16_t)0x6764, (int16_t)0x4AD3, (int16_t)0x67DA,
+    (int16_t)0x4A2F, (int16_t)0x6850, (int16_t)0x498B, (int16_t)0x68C4, (int16_t)0x48E6,
+    (int16_t)0x6937, (int16_t)0x4840, (int16_t)0x69A9, (int16_t)0x479A, (int16_t)0x6A1A,
+    (int16_t)0x46F3, (int16_t)0x6A89, (int16_t)0x464B, (int16_t)0x6AF8, (int16_t)0x45A3,
+    (int16_t)0x6B66, (int16_t)0x44FA, (int16_t)0x6BD3, (int16_t)0x4450, (int16_t)0x6C3F,
+    (int16_t)0x43A6, (int16_t)0x6CAA, (int16_t)0x42FB, (int16_t)0x6D14, (int16_t)0x424F,
+    (int16_t)0x6D7C, (int16_t)0x41A3, (int16_t)0x6DE4, (int16_t)0x40F6, (int16_t)0x6E4A,
+    (int16_t)0x4048, (int16_t)0x6EB0, (int16_t)0x3F9A, (int16_t)0x6F14, (int16_t)0x3EEC,
+    (int16_t)0x6F78, (int16_t)0x3E3C, (int16_t)0x6FDA, (int16_t)0x3D8C, (int16_t)0x703B,
+    (int16_t)0x3CDC, (int16_t)0x709B, (int16_t)0x3C2A, (int16_t)0x70FA, (int16_t)0x3B79,
+    (int16_t)0x7158, (int16_t)0x3AC6, (int16_t)0x71B5, (int16_t)0x3A13, (int16_t)0x7211,
+    (int16_t)0x3960, (int16_t)0x726C, (int16_t)0x38AC, (int16_t)0x72C5, (int16_t)0x37F7,
+    (int16_t)0x731E, (int16_t)0x3742, (int16_t)0x7375, (int16_t)0x368D, (int16_t)0x73CB,
+    (int16_t)0x35D7, (int16_t)0x7421, (int16_t)0x3520, (int16_t)0x7475, (int16_t)0x3469,
+    (int16_t)0x74C7, (int16_t)0x33B1, (int16_t)0x7519, (int16_t)0x32F9, (int16_t)0x756A,
+    (int16_t)0x3240, (int16_t)0x75B9, (int16_t)0x3187, (int16_t)0x7608, (int16_t)0x30CD,
+    (int16_t)0x7655, (int16_t)0x3013, (int16_t)0x76A1, (int16_t)0x2F59, (int16_t)0x76EC,
+    (int16_t)0x2E9E, (int16_t)0x7736, (int16_t)0x2DE2, (int16_t)0x777E, (int16_t)0x2D26,
+    (int16_t)0x77C6, (int16_t)0x2C6A, (int16_t)0x780C, (int16_t)0x2BAD, (int16_t)0x7851,
+    (int16_t)0x2AF0, (int16_t)0x7895, (int16_t)0x2A32, (int16_t)0x78D8, (int16_t)0x2974,
+    (int16_t)0x791A, (int16_t)0x28B6, (int16_t)0x795B, (int16_t)0x27F7, (int16_t)0x799A,
+    (int16_t)0x2738, (int16_t)0x79D8, (int16_t)0x2678, (int16_t)0x7A15, (int16_t)0x25B8,
+    (int16_t)0x7A51, (int16_t)0x24F8, (int16_t)0x7A8C, (int16_t)0x2437, (int16_t)0x7AC5,
+    (int16_t)0x2376, (int16_t)0x7AFD, (int16_t)0x22B5, (int16_t)0x7B34, (int16_t)0x21F3,
+    (int16_t)0x7B6A, (int16_t)0x2131, (int16_t)0x7B9F, (int16_t)0x206F, (int16_t)0x7BD3,
+    (int16_t)0x1FAC, (int16_t)0x7C05, (int16_t)0x1EE9, (int16_t)0x7C36, (int16_t)0x1E26,
+    (int16_t)0x7C66, (int16_t)0x1D62, (int16_t)0x7C95, (int16_t)0x1C9F, (int16_t)0x7CC2,
+    (int16_t)0x1BDA, (int16_t)0x7CEF, (int16_t)0x1B16, (int16_t)0x7D1A, (int16_t)0x1A51,
+    (int16_t)0x7D44, (int16_t)0x198D, (int16_t)0x7D6D, (int16_t)0x18C7, (int16_t)0x7D94,
+    (int16_t)0x1802, (int16_t)0x7DBA, (int16_t)0x173C, (int16_t)0x7DE0, (int16_t)0x1677,
+    (int16_t)0x7E03, (int16_t)0x15B1, (int16_t)0x7E26, (int16_t)0x14EA, (int16_t)0x7E48,
+    (int16_t)0x1424, (int16_t)0x7E68, (int16_t)0x135D, (int16_t)0x7E87, (int16_t)0x1296,
+    (int16_t)0x7EA5, (int16_t)0x11CF, (int16_t)0x7EC1, (int16_t)0x1108, (int16_t)0x7EDD,
+    (int16_t)0x1041, (int16_t)0x7EF7, (int16_t)0x0F79, (int16_t)0x7F10, (int16_t)0x0EB2,
+    (int16_t)0x7F27, (int16_t)0x0DEA, (int16_t)0x7F3E, (int16_t)0x0D22, (int16_t)0x7F53,
+    (int16_t)0x0C5A, (int16_t)0x7F67, (int16_t)0x0B92, (int16_t)0x7F7A, (int16_t)0x0AC9,
+    (int16_t)0x7F8B, (int16_t)0x0A01, (int16_t)0x7F9C, (int16_t)0x0938, (int16_t)0x7FAB,
+    (int16_t)0x0870, (int16_t)0x7FB9, (int16_t)0x07A7, (int16_t)0x7FC5, (int16_t)0x06DE,
+    (int16_t)0x7FD1, (int16_t)0x0616, (int16_t)0x7FDB, (int16_t)0x054D, (int16_t)0x7FE4,
+    (int16_t)0x0484, (int16_t)0x7FEC, (int16_t)0x03BB, (int16_t)0x7FF2, (int16_t)0x02F2,
+    (int16_t)0x7FF7, (int16_t)0x0229, (int16_t)0x7FFB, (int16_t)0x0160, (int16_t)0x7FFE,
+    (int16_t)0x0097, (int16_t)0x7FFF, (int16_t)0x7FFF, (int16_t)0x0000, (int16_t)0x7FFF,
+    (int16_t)0x00C9, (int16_t)0x7FFE, (int16_t)0x0192, (int16_t)0x7FFA, (int16_t)0x025B,
+    (int16_t)0x7FF6, (int16_t)0x0324, (int16_t)0x7FF1, (int16_t)0x03ED, (int16_t)0x7FEA,
+    (int16_t)0x04B6, (int16_t)0x7FE2, (int16_t)0x057F, (int16_t)0x7FD9, (int16_t)0x0648,
+    (int16_t)0x7FCE, (int16_t)0x0711, (int16_t)0x7FC2, (int16_t)0x07D9, (int16_t)0x7FB5,
+    (int16_t)0x08A2, (int16_t)0x7FA7, (int16_t)0x096B, (int16_t)0x7F98, (int16_t)0x0A33,
+    (int16_t)0x7F87, (int16_t)0x0AFB, (int16_t)0x7F75, (int16_t)0x0BC4, (int16_t)0x7F62,
+    (int16_t)0x0C8C, (int16_t)0x7F4E, (int16_t)0x0D54, (int16_t)0x7F38, (int16_t)0x0E1C,
+    (int16_t)0x7F22, (int16_t)0x0EE4, (int16_t)0x7F0A, (int16_t)0x0FAB, (int16_t)0x7EF0,
+    (int16_t)0x1073, (int16_t)0x7ED6, (int16_t)0x113A, (int16_t)0x7EBA, (int16_t)0x1201,
+    (int16_t)0x7E9D, (int16_t)0x12C8, (int16_t)0x7E7F, (int16_t)0x138F, (int16_t)0x7E60,
+    (int16_t)0x1455, (int16_t)0x7E3F, (int16_t)0x151C, (int16_t)0x7E1E, (int16_t)0x15E2,
+    (int16_t)0x7DFB, (int16_t)0x16A8, (int16_t)0x7DD6, (int16_t)0x176E, (int16_t)0x7DB1,
+    (int16_t)0x1833, (int16_t)0x7D8A, (int16_t)0x18F9, (int16_t)0x7D63, (int16_t)0x19BE,
+    (int16_t)0x7D3A, (int16_t)0x1A83, (int16_t)0x7D0F, (int16_t)0x1B47, (int16_t)0x7CE4,
+    (int16_t)0x1C0C, (int16_t)0x7CB7, (int16_t)0x1CD0, (int16_t)0x7C89, (int16_t)0x1D93,
+    (int16_t)0x7C5A, (int16_t)0x1E57, (int16_t)0x7C2A, (int16_t)0x1F1A, (int16_t)0x7BF9,
+    (int16_t)0x1FDD, (int16_t)0x7BC6, (int16_t)0x209F, (int16_t)0x7B92, (int16_t)0x2162,
+    (int16_t)0x7B5D, (int16_t)0x2224, (int16_t)0x7B27, (int16_t)0x22E5, (int16_t)0x7AEF,
+    (int16_t)0x23A7, (int16_t)0x7AB7, (int16_t)0x2467, (int16_t)0x7A7D, (int16_t)0x2528,
+    (int16_t)0x7A42, (int16_t)0x25E8, (int16_t)0x7A06, (int16_t)0x26A8, (int16_t)0x79C9,
+    (int16_t)0x2768, (int16_t)0x798A, (int16_t)0x2827, (int16_t)0x794A, (int16_t)0x28E5,
+    (int16_t)0x790A, (int16_t)0x29A4, (int16_t)0x78C8, (int16_t)0x2A62, (int16_t)0x7885,
+    (int16_t)0x2B1F, (int16_t)0x7840, (int16_t)0x2BDC, (int16_t)0x77FB, (int16_t)0x2C99,
+    (int16_t)0x77B4, (int16_t)0x2D55, (int16_t)0x776C, (int16_t)0x2E11, (int16_t)0x7723,
+    (int16_t)0x2ECC, (int16_t)0x76D9, (int16_t)0x2F87, (int16_t)0x768E, (int16_t)0x3042,
+    (int16_t)0x7642, (int16_t)0x30FC, (int16_t)0x75F4, (int16_t)0x31B5, (int16_t)0x75A6,
+    (int16_t)0x326E, (int16_t)0x7556, (int16_t)0x3327, (int16_t)0x7505, (int16_t)0x33DF,
+    (int16_t)0x74B3, (int16_t)0x3497, (int16_t)0x7460, (int16_t)0x354E, (int16_t)0x740B,
+    (int16_t)0x3604, (int16_t)0x73B6, (int16_t)0x36BA, (int16_t)0x735F, (int16_t)0x3770,
+    (int16_t)0x7308, (int16_t)0x3825, (int16_t)0x72AF, (int16_t)0x38D9, (int16_t)0x7255,
+    (int16_t)0x398D, (int16_t)0x71FA, (int16_t)0x3A40, (int16_t)0x719E, (int16_t)0x3AF3,
+    (int16_t)0x7141, (int16_t)0x3BA5, (int16_t)0x70E3, (int16_t)0x3C57, (int16_t)0x7083,
+    (int16_t)0x3D08, (int16_t)0x7023, (int16_t)0x3DB8, (int16_t)0x6FC2, (int16_t)0x3E68,
+    (int16_t)0x6F5F, (int16_t)0x3F17, (int16_t)0x6EFB, (int16_t)0x3FC6, (int16_t)0x6E97,
+    (int16_t)0x4074, (int16_t)0x6E31, (int16_t)0x4121, (int16_t)0x6DCA, (int16_t)0x41CE,
+    (int16_t)0x6D62, (int16_t)0x427A, (int16_t)0x6CF9, (int16_t)0x4326, (int16_t)0x6C8F,
+    (int16_t)0x43D1, (int16_t)0x6C24, (int16_t)0x447B, (int16_t)0x6BB8, (int16_t)0x4524,
+    (int16_t)0x6B4B, (int16_t)0x45CD, (int16_t)0x6ADD, (int16_t)0x4675, (int16_t)0x6A6E,
+    (int16_t)0x471D, (int16_t)0x69FD, (int16_t)0x47C4, (int16_t)0x698C, (int16_t)0x486A,
+    (int16_t)0x691A, (int16_t)0x490F, (int16_t)0x68A7, (int16_t)0x49B4, (int16_t)0x6832,
+    (int16_t)0x4A58, (int16_t)0x67BD, (int16_t)0x4AFB, (int16_t)0x6747, (int16_t)0x4B9E,
+    (int16_t)0x66D0, (int16_t)0x4C40, (int16_t)0x6657, (int16_t)0x4CE1, (int16_t)0x65DE,
+    (int16_t)0x4D81, (int16_t)0x6564, (int16_t)0x4E21, (int16_t)0x64E9, (int16_t)0x4EC0,
+    (int16_t)0x646C, (int16_t)0x4F5E, (int16_t)0x63EF, (int16_t)0x4FFB, (int16_t)0x6371,
+    (int16_t)0x5098, (int16_t)0x62F2, (int16_t)0x5134, (int16_t)0x6272, (int16_t)0x51CF,
+    (int16_t)0x61F1, (int16_t)0x5269, (int16_t)0x616F, (int16_t)0x5303, (int16_t)0x60EC,
+    (int16_t)0x539B, (int16_t)0x6068, (int16_t)0x5433, (int16_t)0x5FE4, (int16_t)0x54CA,
+    (int16_t)0x5F5E, (int16_t)0x5560, (int16_t)0x5ED7, (int16_t)0x55F6, (int16_t)0x5E50,
+    (int16_t)0x568A, (int16_t)0x5DC8, (int16_t)0x571E, (int16_t)0x5D3E, (int16_t)0x57B1,
+    (int16_t)0x5CB4, (int16_t)0x5843, (int16_t)0x5C29, (int16_t)0x58D4, (int16_t)0x5B9D,
+    (int16_t)0x5964, (int16_t)0x5B10, (int16_t)0x59F4, (int16_t)0x5A82, (int16_t)0x5A82,
+    (int16_t)0x59F4, (int16_t)0x5B10, (int16_t)0x5964, (int16_t)0x5B9D, (int16_t)0x58D4,
+    (int16_t)0x5C29, (int16_t)0x5843, (int16_t)0x5CB4, (int16_t)0x57B1, (int16_t)0x5D3E,
+    (int16_t)0x571E, (int16_t)0x5DC8, (int16_t)0x568A, (int16_t)0x5E50, (int16_t)0x55F6,
+    (int16_t)0x5ED7, (int16_t)0x5560, (int16_t)0x5F5E, (int16_t)0x54CA, (int16_t)0x5FE4,
+    (int16_t)0x5433, (int16_t)0x6068, (int16_t)0x539B, (int16_t)0x60EC, (int16_t)0x5303,
+    (int16_t)0x616F, (int16_t)0x5269, (int16_t)0x61F1, (int16_t)0x51CF, (int16_t)0x6272,
+    (int16_t)0x5134, (int16_t)0x62F2, (int16_t)0x5098, (int16_t)0x6371, (int16_t)0x4FFB,
+    (int16_t)0x63EF, (int16_t)0x4F5E, (int16_t)0x646C, (int16_t)0x4EC0, (int16_t)0x64E9,
+    (int16_t)0x4E21, (int16_t)0x6564, (int16_t)0x4D81, (int16_t)0x65DE, (int16_t)0x4CE1,
+    (int16_t)0x6657, (int16_t)0x4C40, (int16_t)0x66D0, (int16_t)0x4B9E, (int16_t)0x6747,
+    (int16_t)0x4AFB, (int16_t)0x67BD, (int16_t)0x4A58, (int16_t)0x6832, (int16_t)0x49B4,
+    (int16_t)0x68A7, (int16_t)0x490F, (int16_t)0x691A, (int16_t)0x486A, (int16_t)0x698C,
+    (int16_t)0x47C4, (int16_t)0x69FD, (int16_t)0x471D, (int16_t)0x6A6E, (int16_t)0x4675,
+    (int16_t)0x6ADD, (int16_t)0x45CD, (int16_t)0x6B4B, (int16_t)0x4524, (int16_t)0x6BB8,
+    (int16_t)0x447B, (int16_t)0x6C24, (int16_t)0x43D1, (int16_t)0x6C8F, (int16_t)0x4326,
+    (int16_t)0x6CF9, (int16_t)0x427A, (int16_t)0x6D62, (int16_t)0x41CE, (int16_t)0x6DCA,
+    (int16_t)0x4121, (int16_t)0x6E31, (int16_t)0x4074, (int16_t)0x6E97, (int16_t)0x3FC6,
+    (int16_t)0x6EFB, (int16_t)0x3F17, (int16_t)0x6F5F, (int16_t)0x3E68, (int16_t)0x6FC2,
+    (int16_t)0x3DB8, (int16_t)0x7023, (int16_t)0x3D08, (int16_t)0x7083, (int16_t)0x3C57,
+    (int16_t)0x70E3, (int16_t)0x3BA5, (int16_t)0x7141, (int16_t)0x3AF3, (int16_t)0x719E,
+    (int16_t)0x3A40, (int16_t)0x71FA, (int16_t)0x398D, (int16_t)0x7255, (int16_t)0x38D9,
+    (int16_t)0x72AF, (int16_t)0x3825, (int16_t)0x7308, (int16_t)0x3770, (int16_t)0x735F,
+    (int16_t)0x36BA, (int16_t)0x73B6, (int16_t)0x3604, (int16_t)0x740B, (int16_t)0x354E,
+    (int16_t)0x7460, (int16_t)0x3497, (int16_t)0x74B3, (int16_t)0x33DF, (int16_t)0x7505,
+    (int16_t)0x3327, (int16_t)0x7556, (int16_t)0x326E, (int16_t)0x75A6, (int16_t)0x31B5,
+    (int16_t)0x75F4, (int16_t)0x30FC, (int16_t)0x7642, (int16_t)0x3042, (int16_t)0x768E,
+    (int16_t)0x2F87, (int16_t)0x76D9, (int16_t)0x2ECC, (int16_t)0x7723, (int16_t)0x2E11,
+    (int16_t)0x776C, (int16_t)0x2D55, (int16_t)0x77B4, (int16_t)0x2C99, (int16_t)0x77FB,
+    (int16_t)0x2BDC, (int16_t)0x7840, (int16_t)0x2B1F, (int16_t)0x7885, (int16_t)0x2A62,
+    (int16_t)0x78C8, (int16_t)0x29A4, (int16_t)0x790A, (int16_t)0x28E5, (int16_t)0x794A,
+    (int16_t)0x2827, (int16_t)0x798A, (int16_t)0x2768, (int16_t)0x79C9, (int16_t)0x26A8,
+    (int16_t)0x7A06, (int16_t)0x25E8, (int16_t)0x7A42, (int16_t)0x2528, (int16_t)0x7A7D,
+    (int16_t)0x2467, (int16_t)0x7AB7, (int16_t)0x23A7, (int16_t)0x7AEF, (int16_t)0x22E5,
+    (int16_t)0x7B27, (int16_t)0x2224, (int16_t)0x7B5D, (int16_t)0x2162, (int16_t)0x7B92,
+    (int16_t)0x209F, (int16_t)0x7BC6, (int16_t)0x1FDD, (int16_t)0x7BF9, (int16_t)0x1F1A,
+    (int16_t)0x7C2A, (int16_t)0x1E57, (int16_t)0x7C5A, (int16_t)0x1D93, (int16_t)0x7C89,
+    (int16_t)0x1CD0, (int16_t)0x7CB7, (int16_t)0x1C0C, (int16_t)0x7CE4, (int16_t)0x1B47,
+    (int16_t)0x7D0F, (int16_t)0x1A83, (int16_t)0x7D3A, (int16_t)0x19BE, (int16_t)0x7D63,
+    (int16_t)0x18F9, (int16_t)0x7D8A, (int16_t)0x1833, (int16_t)0x7DB1, (int16_t)0x176E,
+    (int16_t)0x7DD6, (int16_t)0x16A8, (int16_t)0x7DFB, (int16_t)0x15E2, (int16_t)0x7E1E,
+    (int16_t)0x151C, (int16_t)0x7E3F, (int16_t)0x1455, (int16_t)0x7E60, (int16_t)0x138F,
+    (int16_t)0x7E7F, (int16_t)0x12C8, (int16_t)0x7E9D, (int16_t)0x1201, (int16_t)0x7EBA,
+    (int16_t)0x113A, (int16_t)0x7ED6, (int16_t)0x1073, (int16_t)0x7EF0, (int16_t)0x0FAB,
+    (int16_t)0x7F0A, (int16_t)0x0EE4, (int16_t)0x7F22, (int16_t)0x0E1C, (int16_t)0x7F38,
+    (int16_t)0x0D54, (int16_t)0x7F4E, (int16_t)0x0C8C, (int16_t)0x7F62, (int16_t)0x0BC4,
+    (int16_t)0x7F75, (int16_t)0x0AFB, (int16_t)0x7F87, (int16_t)0x0A33, (int16_t)0x7F98,
+    (int16_t)0x096B, (int16_t)0x7FA7, (int16_t)0x08A2, (int16_t)0x7FB5, (int16_t)0x07D9,
+    (int16_t)0x7FC2, (int16_t)0x0711, (int16_t)0x7FCE, (int16_t)0x0648, (int16_t)0x7FD9,
+    (int16_t)0x057F, (int16_t)0x7FE2, (int16_t)0x04B6, (int16_t)0x7FEA, (int16_t)0x03ED,
+    (int16_t)0x7FF1, (int16_t)0x0324, (int16_t)0x7FF6, (int16_t)0x025B, (int16_t)0x7FFA,
+    (int16_t)0x0192, (int16_t)0x7FFE, (int16_t)0x00C9, (int16_t)0x7FFF
+};
+
+/**
+  @par
+  Sparse triangular mel filterbank of the MFCC, first FFT bin of each band.
+  Band b covers the FFT bins melBandStart[b] .. melBandEnd[b], its weights follow the ones of
+  band b-1 in melWeights.
+  Generated with the HTK mel scale mel(f) = 2595 log10(1 + f/700) and 40 triangles, whose edges
+  are equally spaced on the mel scale between 20 Hz and 8000 Hz:
+  @par
+  <pre>for (b = 0; b < 40; b++)
+     for (k = melBandStart[b]; k <= melBandEnd[b]; k++)
+        melWeights[i++] = f(k) <= f[b+1] ? (f(k) - f[b]) / (f[b+1] - f[b])
+                                         : (f[b+2] - f(k)) / (f[b+2] - f[b+1]); </pre>
+  @par
+  where f(k) = k * 16000 / 512 is the frequency of bin k and f[i] the i-th triangle edge.
+ */
+const uint16_t melBandStart_512_40[40] = {
+    1, 3, 4, 6, 7, 9, 11, 13, 16, 18, 20, 23,
+    26, 29, 32, 35, 39, 43, 47, 51, 56, 61, 66, 71,
+    77, 83, 90, 97, 104, 112, 121, 130, 139, 149, 160, 171,
+    184, 196, 210, 225
+};
+
+/**
+  @par
+  Sparse triangular mel filterbank of the MFCC, last FFT bin of each band.
+  Band b covers the FFT bins melBandStart[b] .. melBandEnd[b], its weights follow the ones of
+  band b-1 in melWeights.
+  Generated with the HTK mel scale mel(f) = 2595 log10(1 + f/700) and 40 triangles, whose edges
+  are equally spaced on the mel scale between 20 Hz and 8000 Hz:
+  @par
+  <pre>for (b = 0; b < 40; b++)
+     for (k = melBandStart[b]; k <= melBandEnd[b]; k++)
+        melWeights[i++] = f(k) <= f[b+1] ? (f(k) - f[b]) / (f[b+1] - f[b])
+                                         : (f[b+2] - f(k)) / (f[b+2] - f[b+1]); </pre>
+  @par
+  where f(k) = k * 16000 / 512 is the frequency of bin k and f[i] the i-th triangle edge.
+ */
+const uint16_t melBandEnd_512_40[40] = {
+    3, 5, 6, 8, 10, 12, 15, 17, 19, 22, 25, 28,
+    31, 34, 38, 42, 46, 50, 55, 60, 65, 70, 76, 82,
+    89, 96, 103, 111, 120, 129, 138, 148, 159, 170, 183, 195,
+    209, 224, 239, 255
+};
+
+/**
+  @par
+  Sparse triangular mel filterbank of the MFCC, weights.
+  Band b covers the FFT bins melBandStart[b] .. melBandEnd[b], its weights follow the ones of
+  band b-1 in melWeights.
+  Generated with the HTK mel scale mel(f) = 2595 log10(1 + f/700) and 40 triangles, whose edges
+  are equally spaced on the mel scale between 20 Hz and 8000 Hz:
+  @par
+  <pre>for (b = 0; b < 40; b++)
+     for (k = melBandStart[b]; k <= melBandEnd[b]; k++)
+        melWeights[i++] = f(k) <= f[b+1] ? (f(k) - f[b]) / (f[b+1] - f[b])
+                                         : (f[b+2] - f(k)) / (f[b+2] - f[b+1]); </pre>
+  @par
+  where f(k) = k * 16000 / 512 is the frequency of bin k and f[i] the i-th triangle edge.
+ */
+const float32_t melWeights_512_40_f32[492] = {
+    0.24935710f, 0.94201572f, 0.40275003f, 0.59724997f, 0.76562133f, 0.15224128f,
+    0.23437867f, 0.84775872f, 0.56605286f, 0.43394714f, 0.98949951f, 0.44632417f,
+    0.01050049f, 0.55367583f, 0.90885978f, 0.39771345f, 0.09114022f, 0.60228655f,
+    0.89325583f, 0.41224989f, 0.10674417f, 0.58775011f, 0.93529822f, 0.48265539f,
+    0.03001256f, 0.06470178f, 0.51734461f, 0.96998744f, 0.60229065f, 0.17633846f,
+    0.39770935f, 0.82366154f, 0.76510507f, 0.36426968f, 0.23489493f, 0.63573032f,
+    0.96559044f, 0.58839082f, 0.21119120f, 0.03440956f, 0.41160918f, 0.78880880f,
+    0.84378047f, 0.48882289f, 0.13386531f, 0.15621953f, 0.51117711f, 0.86613469f,
+    0.79194471f, 0.45791765f, 0.12389059f, 0.20805529f, 0.54208235f, 0.87610941f,
+    0.80225449f, 0.48792375f, 0.17359301f, 0.19774551f, 0.51207625f, 0.82640699f,
+    0.86756104f, 0.57176521f, 0.27596937f, 0.13243896f, 0.42823479f, 0.72403063f,
+    0.98134263f, 0.70298876f, 0.42463490f, 0.14628103f, 0.01865737f, 0.29701124f,
+    0.57536510f, 0.85371897f, 0.87571501f, 0.61377463f, 0.35183424f, 0.08989386f,
+    0.12428499f, 0.38622537f, 0.64816576f, 0.91010614f, 0.83809842f, 0.59160367f,
+    0.34510893f, 0.09861419f, 0.16190158f, 0.40839633f, 0.65489107f, 0.90138581f,
+    0.86083941f, 0.62887954f, 0.39691967f, 0.16495980f, 0.13916059f, 0.37112046f,
+    0.60308033f, 0.83504020f, 0.93695067f, 0.71866860f, 0.50038653f, 0.28210446f,
+    0.06382239f, 0.06304933f, 0.28133140f, 0.49961347f, 0.71789554f, 0.93617761f,
+    0.85464823f, 0.64923744f, 0.44382664f, 0.23841585f, 0.03300506f, 0.14535177f,
+    0.35076256f, 0.55617336f, 0.76158415f, 0.96699494f, 0.83776038f, 0.64446189f,
+    0.45116340f, 0.25786491f, 0.06456642f, 0.16223962f, 0.35553811f, 0.54883660f,
+    0.74213509f, 0.93543358f, 0.87885877f, 0.69695837f, 0.51505797f, 0.33315756f,
+    0.15125716f, 0.12114123f, 0.30304163f, 0.48494203f, 0.66684244f, 0.84874284f,
+    0.97116367f, 0.79998925f, 0.62881483f, 0.45764041f, 0.28646599f, 0.11529157f,
+    0.02883633f, 0.20001075f, 0.37118517f, 0.54235959f, 0.71353401f, 0.88470843f,
+    0.94741235f, 0.78633145f, 0.62525054f, 0.46416963f, 0.30308873f, 0.14200782f,
+    0.05258765f, 0.21366855f, 0.37474946f, 0.53583037f, 0.69691127f, 0.85799218f,
+    0.98205158f, 0.83046901f, 0.67888644f, 0.52730387f, 0.37572130f, 0.22413873f,
+    0.07255616f, 0.01794842f, 0.16953099f, 0.32111356f, 0.47269613f, 0.62427870f,
+    0.77586127f, 0.92744384f, 0.92563348f, 0.78298916f, 0.64034485f, 0.49770053f,
+    0.35505622f, 0.21241190f, 0.06976759f, 0.07436652f, 0.21701084f, 0.35965515f,
+    0.50229947f, 0.64494378f, 0.78758810f, 0.93023241f, 0.93142054f, 0.79718742f,
+    0.66295431f, 0.52872119f, 0.39448808f, 0.26025496f, 0.12602185f, 0.06857946f,
+    0.20281258f, 0.33704569f, 0.47127881f, 0.60551192f, 0.73974504f, 0.87397815f,
+    0.99227292f, 0.86595503f, 0.73963714f, 0.61331924f, 0.48700135f, 0.36068346f,
+    0.23436557f, 0.10804767f, 0.00772708f, 0.13404497f, 0.26036286f, 0.38668076f,
+    0.51299865f, 0.63931654f, 0.76563443f, 0.89195233f, 0.98280711f, 0.86393771f,
+    0.74506831f, 0.62619891f, 0.50732951f, 0.38846011f, 0.26959071f, 0.15072131f,
+    0.03185191f, 0.01719289f, 0.13606229f, 0.25493169f, 0.37380109f, 0.49267049f,
+    0.61153989f, 0.73040929f, 0.84927869f, 0.96814809f, 0.91811360f, 0.80625348f,
+    0.69439337f, 0.58253325f, 0.47067313f, 0.35881301f, 0.24695289f, 0.13509278f,
+    0.02323266f, 0.08188640f, 0.19374652f, 0.30560663f, 0.41746675f, 0.52932687f,
+    0.64118699f, 0.75304711f, 0.86490722f, 0.97676734f, 0.91659857f, 0.81133442f,
+    0.70607028f, 0.60080613f, 0.49554198f, 0.39027784f, 0.28501369f, 0.17974954f,
+    0.07448540f, 0.08340143f, 0.18866558f, 0.29392972f, 0.39919387f, 0.50445802f,
+    0.60972216f, 0.71498631f, 0.82025046f, 0.92551460f, 0.97103616f, 0.87197904f,
+    0.77292193f, 0.67386481f, 0.57480770f, 0.47575058f, 0.37669347f, 0.27763635f,
+    0.17857924f, 0.07952212f, 0.02896384f, 0.12802096f, 0.22707807f, 0.32613519f,
+    0.42519230f, 0.52424942f, 0.62330653f, 0.72236365f, 0.82142076f, 0.92047788f,
+    0.98161691f, 0.88840083f, 0.79518474f, 0.70196865f, 0.60875256f, 0.51553647f,
+    0.42232038f, 0.32910429f, 0.23588821f, 0.14267212f, 0.04945603f, 0.01838309f,
+    0.11159917f, 0.20481526f, 0.29803135f, 0.39124744f, 0.48446353f, 0.57767962f,
+    0.67089571f, 0.76411179f, 0.85732788f, 0.95054397f, 0.95882031f, 0.87110082f,
+    0.78338134f, 0.69566185f, 0.60794236f, 0.52022288f, 0.43250339f, 0.34478391f,
+    0.25706442f, 0.16934494f, 0.08162545f, 0.04117969f, 0.12889918f, 0.21661866f,
+    0.30433815f, 0.39205764f, 0.47977712f, 0.56749661f, 0.65521609f, 0.74293558f,
+    0.83065506f, 0.91837455f, 0.99426531f, 0.91171831f, 0.82917131f, 0.74662432f,
+    0.66407732f, 0.58153032f, 0.49898333f, 0.41643633f, 0.33388933f, 0.25134233f,
+    0.16879534f, 0.08624834f, 0.00370134f, 0.00573469f, 0.08828169f, 0.17082869f,
+    0.25337568f, 0.33592268f, 0.41846968f, 0.50101667f, 0.58356367f, 0.66611067f,
+    0.74865767f, 0.83120466f, 0.91375166f, 0.99629866f, 0.92580358f, 0.84812407f,
+    0.77044456f, 0.69276505f, 0.61508554f, 0.53740603f, 0.45972652f, 0.38204701f,
+    0.30436750f, 0.22668799f, 0.14900848f, 0.07132897f, 0.07419642f, 0.15187593f,
+    0.22955544f, 0.30723495f, 0.38491446f, 0.46259397f, 0.54027348f, 0.61795299f,
+    0.69563250f, 0.77331201f, 0.85099152f, 0.92867103f, 0.99402392f, 0.92092488f,
+    0.84782584f, 0.77472680f, 0.70162776f, 0.62852872f, 0.55542968f, 0.48233064f,
+    0.40923160f, 0.33613255f, 0.26303351f, 0.18993447f, 0.11683543f, 0.04373639f,
+    0.00597608f, 0.07907512f, 0.15217416f, 0.22527320f, 0.29837224f, 0.37147128f,
+    0.44457032f, 0.51766936f, 0.59076840f, 0.66386745f, 0.73696649f, 0.81006553f,
+    0.88316457f, 0.95626361f, 0.97236875f, 0.90358009f, 0.83479142f, 0.76600276f,
+    0.69721409f, 0.62842543f, 0.55963676f, 0.49084810f, 0.42205943f, 0.35327077f,
+    0.28448210f, 0.21569344f, 0.14690477f, 0.07811611f, 0.00932744f, 0.02763125f,
+    0.09641991f, 0.16520858f, 0.23399724f, 0.30278591f, 0.37157457f, 0.44036324f,
+    0.50915190f, 0.57794057f, 0.64672923f, 0.71551790f, 0.78430656f, 0.85309523f,
+    0.92188389f, 0.99067256f, 0.94404498f, 0.87931253f, 0.81458007f, 0.74984762f,
+    0.68511516f, 0.62038271f, 0.55565025f, 0.49091780f, 0.42618534f, 0.36145288f,
+    0.29672043f, 0.23198797f, 0.16725552f, 0.10252306f, 0.03779061f, 0.05595502f,
+    0.12068747f, 0.18541993f, 0.25015238f, 0.31488484f, 0.37961729f, 0.44434975f,
+    0.50908220f, 0.57381466f, 0.63854712f, 0.70327957f, 0.76801203f, 0.83274448f,
+    0.89747694f, 0.96220939f, 0.97464681f, 0.91373138f, 0.85281596f, 0.79190053f,
+    0.73098511f, 0.67006968f, 0.60915426f, 0.54823883f, 0.48732341f, 0.42640798f,
+    0.36549255f, 0.30457713f, 0.24366170f, 0.18274628f, 0.12183085f, 0.06091543f
+};
+
+/**
+  @par
+  Sparse triangular mel filterbank of the MFCC, weights.
+  Band b covers the FFT bins melBandStart[b] .. melBandEnd[b], its weights follow the ones of
+  band b-1 in melWeights.
+  Generated with the HTK mel scale mel(f) = 2595 log10(1 + f/700) and 40 triangles, whose edges
+  are equally spaced on the mel scale between 20 Hz and 8000 Hz:
+  @par
+  <pre>for (b = 0; b < 40; b++)
+     for (k = melBandStart[b]; k <= melBandEnd[b]; k++)
+        melWeights[i++] = f(k) <= f[b+1] ? (f(k) - f[b]) / (f[b+1] - f[b])
+                                         : (f[b+2] - f(k)) / (f[b+2] - f[b+1]); </pre>
+  @par
+  where f(k) = k * 16000 / 512 is the frequency of bin k and f[i] the i-th triangle edge.
+  @par
+  Convert Floating point to q15(Fixed point 1.15), saturated to [-32767, 32767]:
+        round(melWeightsq15(i) * pow(2, 15))
+ */
+const int16_t melWeights_512_40_q16[492] = {
+    (int16_t)0x1FEB, (int16_t)0x7894, (int16_t)0x338D, (int16_t)0x4C73, (int16_t)0x6200,
+    (int16_t)0x137D, (int16_t)0x1E00, (int16_t)0x6C83, (int16_t)0x4874, (int16_t)0x378C,
+    (int16_t)0x7EA8, (int16_t)0x3921, (int16_t)0x0158, (int16_t)0x46DF, (int16_t)0x7456,
+    (int16_t)0x32E8, (int16_t)0x0BAA, (int16_t)0x4D18, (int16_t)0x7256, (int16_t)0x34C5,
+    (int16_t)0x0DAA, (int16_t)0x4B3B, (int16_t)0x77B8, (int16_t)0x3DC8, (int16_t)0x03D7,
+    (int16_t)0x0848, (int16_t)0x4238, (int16_t)0x7C29, (int16_t)0x4D18, (int16_t)0x1692,
+    (int16_t)0x32E8, (int16_t)0x696E, (int16_t)0x61EF, (int16_t)0x2EA0, (int16_t)0x1E11,
+    (int16_t)0x5160, (int16_t)0x7B98, (int16_t)0x4B50, (int16_t)0x1B08, (int16_t)0x0468,
+    (int16_t)0x34B0, (int16_t)0x64F8, (int16_t)0x6C01, (int16_t)0x3E92, (int16_t)0x1122,
+    (int16_t)0x13FF, (int16_t)0x416E, (int16_t)0x6EDE, (int16_t)0x655E, (int16_t)0x3A9D,
+    (int16_t)0x0FDC, (int16_t)0x1AA2, (int16_t)0x4563, (int16_t)0x7024, (int16_t)0x66B0,
+    (int16_t)0x3E74, (int16_t)0x1638, (int16_t)0x1950, (int16_t)0x418C, (int16_t)0x69C8,
+    (int16_t)0x6F0C, (int16_t)0x4930, (int16_t)0x2353, (int16_t)0x10F4, (int16_t)0x36D0,
+    (int16_t)0x5CAD, (int16_t)0x7D9D, (int16_t)0x59FC, (int16_t)0x365A, (int16_t)0x12B9,
+    (int16_t)0x0263, (int16_t)0x2604, (int16_t)0x49A6, (int16_t)0x6D47, (int16_t)0x7017,
+    (int16_t)0x4E90, (int16_t)0x2D09, (int16_t)0x0B82, (int16_t)0x0FE9, (int16_t)0x3170,
+    (int16_t)0x52F7, (int16_t)0x747E, (int16_t)0x6B47, (int16_t)0x4BBA, (int16_t)0x2C2D,
+    (int16_t)0x0C9F, (int16_t)0x14B9, (int16_t)0x3446, (int16_t)0x53D3, (int16_t)0x7361,
+    (int16_t)0x6E30, (int16_t)0x507F, (int16_t)0x32CE, (int16_t)0x151D, (int16_t)0x11D0,
+    (int16_t)0x2F81, (int16_t)0x4D32, (int16_t)0x6AE3, (int16_t)0x77EE, (int16_t)0x5BFD,
+    (int16_t)0x400D, (int16_t)0x241C, (int16_t)0x082B, (int16_t)0x0812, (int16_t)0x2403,
+    (int16_t)0x3FF3, (int16_t)0x5BE4, (int16_t)0x77D5, (int16_t)0x6D65, (int16_t)0x531A,
+    (int16_t)0x38CF, (int16_t)0x1E84, (int16_t)0x043A, (int16_t)0x129B, (int16_t)0x2CE6,
+    (int16_t)0x4731, (int16_t)0x617C, (int16_t)0x7BC6, (int16_t)0x6B3C, (int16_t)0x527E,
+    (int16_t)0x39C0, (int16_t)0x2102, (int16_t)0x0844, (int16_t)0x14C4, (int16_t)0x2D82,
+    (int16_t)0x4640, (int16_t)0x5EFE, (int16_t)0x77BC, (int16_t)0x707E, (int16_t)0x5936,
+    (int16_t)0x41ED, (int16_t)0x2AA5, (int16_t)0x135C, (int16_t)0x0F82, (int16_t)0x26CA,
+    (int16_t)0x3E13, (int16_t)0x555B, (int16_t)0x6CA4, (int16_t)0x7C4F, (int16_t)0x6666,
+    (int16_t)0x507D, (int16_t)0x3A94, (int16_t)0x24AB, (int16_t)0x0EC2, (int16_t)0x03B1,
+    (int16_t)0x199A, (int16_t)0x2F83, (int16_t)0x456C, (int16_t)0x5B55, (int16_t)0x713E,
+    (int16_t)0x7945, (int16_t)0x64A7, (int16_t)0x5008, (int16_t)0x3B6A, (int16_t)0x26CC,
+    (int16_t)0x122D, (int16_t)0x06BB, (int16_t)0x1B59, (int16_t)0x2FF8, (int16_t)0x4496,
+    (int16_t)0x5934, (int16_t)0x6DD3, (int16_t)0x7DB4, (int16_t)0x6A4D, (int16_t)0x56E6,
+    (int16_t)0x437F, (int16_t)0x3018, (int16_t)0x1CB1, (int16_t)0x094A, (int16_t)0x024C,
+    (int16_t)0x15B3, (int16_t)0x291A, (int16_t)0x3C81, (int16_t)0x4FE8, (int16_t)0x634F,
+    (int16_t)0x76B6, (int16_t)0x767B, (int16_t)0x6439, (int16_t)0x51F7, (int16_t)0x3FB5,
+    (int16_t)0x2D72, (int16_t)0x1B30, (int16_t)0x08EE, (int16_t)0x0985, (int16_t)0x1BC7,
+    (int16_t)0x2E09, (int16_t)0x404B, (int16_t)0x528E, (int16_t)0x64D0, (int16_t)0x7712,
+    (int16_t)0x7739, (int16_t)0x660A, (int16_t)0x54DC, (int16_t)0x43AD, (int16_t)0x327F,
+    (int16_t)0x2150, (int16_t)0x1021, (int16_t)0x08C7, (int16_t)0x19F6, (int16_t)0x2B24,
+    (int16_t)0x3C53, (int16_t)0x4D81, (int16_t)0x5EB0, (int16_t)0x6FDF, (int16_t)0x7F03,
+    (int16_t)0x6ED8, (int16_t)0x5EAC, (int16_t)0x4E81, (int16_t)0x3E56, (int16_t)0x2E2B,
+    (int16_t)0x1E00, (int16_t)0x0DD5, (int16_t)0x00FD, (int16_t)0x1128, (int16_t)0x2154,
+    (int16_t)0x317F, (int16_t)0x41AA, (int16_t)0x51D5, (int16_t)0x6200, (int16_t)0x722B,
+    (int16_t)0x7DCD, (int16_t)0x6E96, (int16_t)0x5F5E, (int16_t)0x5027, (int16_t)0x40F0,
+    (int16_t)0x31B9, (int16_t)0x2282, (int16_t)0x134B, (int16_t)0x0414, (int16_t)0x0233,
+    (int16_t)0x116A, (int16_t)0x20A2, (int16_t)0x2FD9, (int16_t)0x3F10, (int16_t)0x4E47,
+    (int16_t)0x5D7E, (int16_t)0x6CB5, (int16_t)0x7BEC, (int16_t)0x7585, (int16_t)0x6733,
+    (int16_t)0x58E2, (int16_t)0x4A90, (int16_t)0x3C3F, (int16_t)0x2DEE, (int16_t)0x1F9C,
+    (int16_t)0x114B, (int16_t)0x02F9, (int16_t)0x0A7B, (int16_t)0x18CD, (int16_t)0x271E,
+    (int16_t)0x3570, (int16_t)0x43C1, (int16_t)0x5212, (int16_t)0x6064, (int16_t)0x6EB5,
+    (int16_t)0x7D07, (int16_t)0x7553, (int16_t)0x67DA, (int16_t)0x5A61, (int16_t)0x4CE7,
+    (int16_t)0x3F6E, (int16_t)0x31F5, (int16_t)0x247B, (int16_t)0x1702, (int16_t)0x0989,
+    (int16_t)0x0AAD, (int16_t)0x1826, (int16_t)0x259F, (int16_t)0x3319, (int16_t)0x4092,
+    (int16_t)0x4E0B, (int16_t)0x5B85, (int16_t)0x68FE, (int16_t)0x7677, (int16_t)0x7C4B,
+    (int16_t)0x6F9D, (int16_t)0x62EF, (int16_t)0x5641, (int16_t)0x4993, (int16_t)0x3CE5,
+    (int16_t)0x3037, (int16_t)0x238A, (int16_t)0x16DC, (int16_t)0x0A2E, (int16_t)0x03B5,
+    (int16_t)0x1063, (int16_t)0x1D11, (int16_t)0x29BF, (int16_t)0x366D, (int16_t)0x431B,
+    (int16_t)0x4FC9, (int16_t)0x5C76, (int16_t)0x6924, (int16_t)0x75D2, (int16_t)0x7DA6,
+    (int16_t)0x71B7, (int16_t)0x65C9, (int16_t)0x59DA, (int16_t)0x4DEC, (int16_t)0x41FD,
+    (int16_t)0x360F, (int16_t)0x2A20, (int16_t)0x1E32, (int16_t)0x1243, (int16_t)0x0655,
+    (int16_t)0x025A, (int16_t)0x0E49, (int16_t)0x1A37, (int16_t)0x2626, (int16_t)0x3214,
+    (int16_t)0x3E03, (int16_t)0x49F1, (int16_t)0x55E0, (int16_t)0x61CE, (int16_t)0x6DBD,
+    (int16_t)0x79AB, (int16_t)0x7ABB, (int16_t)0x6F80, (int16_t)0x6446, (int16_t)0x590B,
+    (int16_t)0x4DD1, (int16_t)0x4297, (int16_t)0x375C, (int16_t)0x2C22, (int16_t)0x20E7,
+    (int16_t)0x15AD, (int16_t)0x0A73, (int16_t)0x0545, (int16_t)0x1080, (int16_t)0x1BBA,
+    (int16_t)0x26F5, (int16_t)0x322F, (int16_t)0x3D69, (int16_t)0x48A4, (int16_t)0x53DE,
+    (int16_t)0x5F19, (int16_t)0x6A53, (int16_t)0x758D, (int16_t)0x7F44, (int16_t)0x74B3,
+    (int16_t)0x6A22, (int16_t)0x5F91, (int16_t)0x5500, (int16_t)0x4A70, (int16_t)0x3FDF,
+    (int16_t)0x354E, (int16_t)0x2ABD, (int16_t)0x202C, (int16_t)0x159B, (int16_t)0x0B0A,
+    (int16_t)0x0079, (int16_t)0x00BC, (int16_t)0x0B4D, (int16_t)0x15DE, (int16_t)0x206F,
+    (int16_t)0x2B00, (int16_t)0x3590, (int16_t)0x4021, (int16_t)0x4AB2, (int16_t)0x5543,
+    (int16_t)0x5FD4, (int16_t)0x6A65, (int16_t)0x74F6, (int16_t)0x7F87, (int16_t)0x7681,
+    (int16_t)0x6C8F, (int16_t)0x629E, (int16_t)0x58AD, (int16_t)0x4EBB, (int16_t)0x44CA,
+    (int16_t)0x3AD8, (int16_t)0x30E7, (int16_t)0x26F6, (int16_t)0x1D04, (int16_t)0x1313,
+    (int16_t)0x0921, (int16_t)0x097F, (int16_t)0x1371, (int16_t)0x1D62, (int16_t)0x2753,
+    (int16_t)0x3145, (int16_t)0x3B36, (int16_t)0x4528, (int16_t)0x4F19, (int16_t)0x590A,
+    (int16_t)0x62FC, (int16_t)0x6CED, (int16_t)0x76DF, (int16_t)0x7F3C, (int16_t)0x75E1,
+    (int16_t)0x6C86, (int16_t)0x632A, (int16_t)0x59CF, (int16_t)0x5074, (int16_t)0x4718,
+    (int16_t)0x3DBD, (int16_t)0x3462, (int16_t)0x2B06, (int16_t)0x21AB, (int16_t)0x1850,
+    (int16_t)0x0EF4, (int16_t)0x0599, (int16_t)0x00C4, (int16_t)0x0A1F, (int16_t)0x137A,
+    (int16_t)0x1CD6, (int16_t)0x2631, (int16_t)0x2F8C, (int16_t)0x38E8, (int16_t)0x4243,
+    (int16_t)0x4B9E, (int16_t)0x54FA, (int16_t)0x5E55, (int16_t)0x67B0, (int16_t)0x710C,
+    (int16_t)0x7A67, (int16_t)0x7C77, (int16_t)0x73A9, (int16_t)0x6ADA, (int16_t)0x620C,
+    (int16_t)0x593E, (int16_t)0x5070, (int16_t)0x47A2, (int16_t)0x3ED4, (int16_t)0x3606,
+    (int16_t)0x2D38, (int16_t)0x246A, (int16_t)0x1B9C, (int16_t)0x12CE, (int16_t)0x0A00,
+    (int16_t)0x0132, (int16_t)0x0389, (int16_t)0x0C57, (int16_t)0x1526, (int16_t)0x1DF4,
+    (int16_t)0x26C2, (int16_t)0x2F90, (int16_t)0x385E, (int16_t)0x412C, (int16_t)0x49FA,
+    (int16_t)0x52C8, (int16_t)0x5B96, (int16_t)0x6464, (int16_t)0x6D32, (int16_t)0x7600,
+    (int16_t)0x7ECE, (int16_t)0x78D6, (int16_t)0x708D, (int16_t)0x6844, (int16_t)0x5FFB,
+    (int16_t)0x57B2, (int16_t)0x4F69, (int16_t)0x4720, (int16_t)0x3ED6, (int16_t)0x368D,
+    (int16_t)0x2E44, (int16_t)0x25FB, (int16_t)0x1DB2, (int16_t)0x1569, (int16_t)0x0D1F,
+    (int16_t)0x04D6, (int16_t)0x072A, (int16_t)0x0F73, (int16_t)0x17BC, (int16_t)0x2005,
+    (int16_t)0x284E, (int16_t)0x3097, (int16_t)0x38E0, (int16_t)0x412A, (int16_t)0x4973,
+    (int16_t)0x51BC, (int16_t)0x5A05, (int16_t)0x624E, (int16_t)0x6A97, (int16_t)0x72E1,
+    (int16_t)0x7B2A, (int16_t)0x7CC1, (int16_t)0x74F5, (int16_t)0x6D29, (int16_t)0x655D,
+    (int16_t)0x5D91, (int16_t)0x55C5, (int16_t)0x4DF9, (int16_t)0x462D, (int16_t)0x3E61,
+    (int16_t)0x3695, (int16_t)0x2EC8, (int16_t)0x26FC, (int16_t)0x1F30, (int16_t)0x1764,
+    (int16_t)0x0F98, (int16_t)0x07CC
+};
@@ -64,5 +64,196 @@ const plp_cfft_instance_q16 plp_cfft_sR_q16_len4096 = {
     PLPBITREVINDEXTABLE_FIXED_4096_TABLE_LENGTH
 };
 
+const plp_cfft_instance_q32 plp_cfft_sR_q32_len16 = { 16, twiddleCoef_16_q32,
+                                                      plpBitRevIndexTable_fixed_16,
+                                                      PLPBITREVINDEXTABLE_FIXED_16_TABLE_LENGTH };
+
+const plp_cfft_instance_q32 plp_cfft_sR_q32_len32 = { 32, twiddleCoef_32_q32,
+                                                      plpBitRevIndexTable_fixed_32,
+                                                      PLPBITREVINDEXTABLE_FIXED_32_TABLE_LENGTH };
+
+const plp_cfft_instance_q32 plp_cfft_sR_q32_len64 = { 64, twiddleCoef_64_q32,
+                                                      plpBitRevIndexTable_fixed_64,
+                                                      PLPBITREVINDEXTABLE_FIXED_64_TABLE_LENGTH };
+
+const plp_cfft_instance_q32 plp_cfft_sR_q32_len128 = { 128, twiddleCoef_128_q32,
+                                                       plpBitRevIndexTable_fixed_128,
+                                                       PLPBITREVINDEXTABLE_FIXED_128_TABLE_LENGTH };
+
+const plp_cfft_instance_q32 plp_cfft_sR_q32_len256 = { 256, twiddleCoef_256_q32,
+                                                       plpBitRevIndexTable_fixed_256,
+                                                       PLPBITREVINDEXTABLE_FIXED_256_TABLE_LENGTH };
+
+const plp_cfft_instance_q32 plp_cfft_sR_q32_len512 = { 512, twiddleCoef_512_q32,
+                                                       plpBitRevIndexTable_fixed_512,
+                                                       PLPBITREVINDEXTABLE_FIXED_512_TABLE_LENGTH };
+
+const plp_cfft_instance_q32 plp_cfft_sR_q32_len1024 = {
+    1024, twiddleCoef_1024_q32, plpBitRevIndexTable_fixed_1024,
+    PLPBITREVINDEXTABLE_FIXED_1024_TABLE_LENGTH
+};
+
+const plp_cfft_instance_q32 plp_cfft_sR_q32_len2048 = {
+    2048, twiddleCoef_2048_q32, plpBitRevIndexTable_fixed_2048,
+    PLPBITREVINDEXTABLE_FIXED_2048_TABLE_LENGTH
+};
+
+const plp_cfft_instance_q32 plp_cfft_sR_q32_len4096 = {
+    4096, twiddleCoef_4096_q32, plpBitRevIndexTable_fixed_4096,
+    PLPBITREVINDEXTABLE_FIXED_4096_TABLE_LENGTH
+};
+
+const plp_rfft_instance_q16 plp_rfft_sR_q16_len32 = { 32, &plp_cfft_sR_q16_len16,
+                                                      twiddleCoef_32_q16 };
+
+const plp_rfft_instance_q16 plp_rfft_sR_q16_len64 = { 64, &plp_cfft_sR_q16_len32,
+                                                      twiddleCoef_64_q16 };
+
+const plp_rfft_instance_q16 plp_rfft_sR_q16_len128 = { 128, &plp_cfft_sR_q16_len64,
+                                                       twiddleCoef_128_q16 };
+
+const plp_rfft_instance_q16 plp_rfft_sR_q16_len256 = { 256, &plp_cfft_sR_q16_len128,
+                                                       twiddleCoef_256_q16 };
+
+const plp_rfft_instance_q16 plp_rfft_sR_q16_len512 = { 512, &plp_cfft_sR_q16_len256,
+                                                       twiddleCoef_512_q16 };
+
+const plp_rfft_instance_q16 plp_rfft_sR_q16_len1024 = { 1024, &plp_cfft_sR_q16_len512,
+                                                        twiddleCoef_1024_q16 };
+
+const plp_rfft_instance_q16 plp_rfft_sR_q16_len2048 = { 2048, &plp_cfft_sR_q16_len1024,
+                                                        twiddleCoef_2048_q16 };
+
+const plp_rfft_instance_q16 plp_rfft_sR_q16_len4096 = { 4096, &plp_cfft_sR_q16_len2048,
+                                                        twiddleCoef_4096_q16 };
+
+const plp_rfft_instance_q32 plp_rfft_sR_q32_len32 = { 32, &plp_cfft_sR_q32_len16,
+                                                      twiddleCoef_32_q32 };
+
+const plp_rfft_instance_q32 plp_rfft_sR_q32_len64 = { 64, &plp_cfft_sR_q32_len32,
+                                                      twiddleCoef_64_q32 };
+
+const plp_rfft_instance_q32 plp_rfft_sR_q32_len128 = { 128, &plp_cfft_sR_q32_len64,
+                                                       twiddleCoef_128_q32 };
+
+const plp_rfft_instance_q32 plp_rfft_sR_q32_len256 = { 256, &plp_cfft_sR_q32_len128,
+                                                       twiddleCoef_256_q32 };
+
+const plp_rfft_instance_q32 plp_rfft_sR_q32_len512 = { 512, &plp_cfft_sR_q32_len256,
+                                                       twiddleCoef_512_q32 };
+
+const plp_rfft_instance_q32 plp_rfft_sR_q32_len1024 = { 1024, &plp_cfft_sR_q32_len512,
+                                                        twiddleCoef_1024_q32 };
+
+const plp_rfft_instance_q32 plp_rfft_sR_q32_len2048 = { 2048, &plp_cfft_sR_q32_len1024,
+                                                        twiddleCoef_2048_q32 };
+
+const plp_rfft_instance_q32 plp_rfft_sR_q32_len4096 = { 4096, &plp_cfft_sR_q32_len2048,
+                                                        twiddleCoef_4096_q32 };
+
 const plp_rfft_instance_f32 plp_rfft_sR_f32_len2048 = { 2048, 0, (float32_t *)twiddleCoef_rfft_2048,
-                                                        (uint16_t *)bit_rev_radix2_LUT };
\ No newline at end of file
+                                                        NULL };
+
+const plp_cfft_mixed_instance_f32 plp_cfft_mixed_sR_f32_len10 = { 10, 2, { 2, 5 },
+                                                                  twiddleCoef_mixed_10_f32 };
+
+const plp_cfft_mixed_instance_f32 plp_cfft_mixed_sR_f32_len12 = { 12, 2, { 4, 3 },
+                                                                  twiddleCoef_mixed_12_f32 };
+
+const plp_cfft_mixed_instance_f32 plp_cfft_mixed_sR_f32_len16 = { 16, 2, { 4, 4 },
+                                                                  twiddleCoef_mixed_16_f32 };
+
+const plp_cfft_mixed_instance_f32 plp_cfft_mixed_sR_f32_len20 = { 20, 2, { 4, 5 },
+                                                                  twiddleCoef_mixed_20_f32 };
+
+const plp_cfft_mixed_instance_f32 plp_cfft_mixed_sR_f32_len64 = { 64, 3, { 4, 4, 4 },
+                                                                  twiddleCoef_mixed_64_f32 };
+
+const plp_cfft_mixed_instance_f32 plp_cfft_mixed_sR_f32_len128 = { 128, 4, { 4, 4, 4, 2 },
+                                                                   twiddleCoef_mixed_128_f32 };
+
+const plp_cfft_mixed_instance_f32 plp_cfft_mixed_sR_f32_len256 = { 256, 4, { 4, 4, 4, 4 },
+                                                                   twiddleCoef_mixed_256_f32 };
+
+const plp_cfft_mixed_instance_q16 plp_cfft_mixed_sR_q16_len10 = { 10, 2, { 2, 5 },
+                                                                  twiddleCoef_mixed_10_q16 };
+
+const plp_cfft_mixed_instance_q16 plp_cfft_mixed_sR_q16_len12 = { 12, 2, { 4, 3 },
+                                                                  twiddleCoef_mixed_12_q16 };
+
+const plp_cfft_mixed_instance_q16 plp_cfft_mixed_sR_q16_len16 = { 16, 2, { 4, 4 },
+                                                                  twiddleCoef_mixed_16_q16 };
+
+const plp_cfft_mixed_instance_q16 plp_cfft_mixed_sR_q16_len20 = { 20, 2, { 4, 5 },
+                                                                  twiddleCoef_mixed_20_q16 };
+
+const plp_cfft_mixed_instance_q16 plp_cfft_mixed_sR_q16_len64 = { 64, 3, { 4, 4, 4 },
+                                                                  twiddleCoef_mixed_64_q16 };
+
+const plp_cfft_mixed_instance_q16 plp_cfft_mixed_sR_q16_len128 = { 128, 4, { 4, 4, 4, 2 },
+                                                                   twiddleCoef_mixed_128_q16 };
+
+const plp_cfft_mixed_instance_q16 plp_cfft_mixed_sR_q16_len256 = { 256, 4, { 4, 4, 4, 4 },
+                                                                   twiddleCoef_mixed_256_q16 };
+
+const plp_dct2_instance_f32 plp_dct2_sR_f32_len20 = { 20, &plp_cfft_mixed_sR_f32_len10,
+                                                      twiddleCoef_dct2_20_f32 };
+
+const plp_dct2_instance_f32 plp_dct2_sR_f32_len24 = { 24, &plp_cfft_mixed_sR_f32_len12,
+                                                      twiddleCoef_dct2_24_f32 };
+
+const plp_dct2_instance_f32 plp_dct2_sR_f32_len32 = { 32, &plp_cfft_mixed_sR_f32_len16,
+                                                      twiddleCoef_dct2_32_f32 };
+
+const plp_dct2_instance_f32 plp_dct2_sR_f32_len40 = { 40, &plp_cfft_mixed_sR_f32_len20,
+                                                      twiddleCoef_dct2_40_f32 };
+
+const plp_dct2_instance_q16 plp_dct2_sR_q16_len20 = { 20, &plp_cfft_mixed_sR_q16_len10,
+                                                      twiddleCoef_dct2_20_q16 };
+
+const plp_dct2_instance_q16 plp_dct2_sR_q16_len24 = { 24, &plp_cfft_mixed_sR_q16_len12,
+                                                      twiddleCoef_dct2_24_q16 };
+
+const plp_dct2_instance_q16 plp_dct2_sR_q16_len32 = { 32, &plp_cfft_mixed_sR_q16_len16,
+                                                      twiddleCoef_dct2_32_q16 };
+
+const plp_dct2_instance_q16 plp_dct2_sR_q16_len40 = { 40, &plp_cfft_mixed_sR_q16_len20,
+                                                      twiddleCoef_dct2_40_q16 };
+
+const plp_dct4_instance_f32 plp_dct4_sR_f32_len128 = { 128, &plp_cfft_mixed_sR_f32_len64,
+                                                       twiddleCoef_dct4_128_f32 };
+
+const plp_dct4_instance_f32 plp_dct4_sR_f32_len256 = { 256, &plp_cfft_mixed_sR_f32_len128,
+                                                       twiddleCoef_dct4_256_f32 };
+
+const plp_dct4_instance_f32 plp_dct4_sR_f32_len512 = { 512, &plp_cfft_mixed_sR_f32_len256,
+                                                       twiddleCoef_dct4_512_f32 };
+
+const plp_dct4_instance_q16 plp_dct4_sR_q16_len128 = { 128, &plp_cfft_mixed_sR_q16_len64,
+                                                       twiddleCoef_dct4_128_q16 };
+
+const plp_dct4_instance_q16 plp_dct4_sR_q16_len256 = { 256, &plp_cfft_mixed_sR_q16_len128,
+                                                       twiddleCoef_dct4_256_q16 };
+
+const plp_dct4_instance_q16 plp_dct4_sR_q16_len512 = { 512, &plp_cfft_mixed_sR_q16_len256,
+                                                       twiddleCoef_dct4_512_q16 };
+
+const plp_mdct_instance_f32 plp_mdct_sR_f32_len128 = { 128, &plp_dct4_sR_f32_len128 };
+
+const plp_mdct_instance_f32 plp_mdct_sR_f32_len256 = { 256, &plp_dct4_sR_f32_len256 };
+
+const plp_mdct_instance_f32 plp_mdct_sR_f32_len512 = { 512, &plp_dct4_sR_f32_len512 };
+
+const plp_mdct_instance_q16 plp_mdct_sR_q16_len128 = { 128, &plp_dct4_sR_q16_len128 };
+
+const plp_mdct_instance_q16 plp_mdct_sR_q16_len256 = { 256, &plp_dct4_sR_q16_len256 };
+
+const plp_mdct_instance_q16 plp_mdct_sR_q16_len512 = { 512, &plp_dct4_sR_q16_len512 };
+
+const plp_mfcc_instance_f32 plp_mfcc_sR_f32_len512 = { 40, 13, melBandStart_512_40,
+                                                       melBandEnd_512_40, melWeights_512_40_f32,
+                                                       &plp_dct2_sR_f32_len40 };
+
+const plp_mfcc_instance_q16 plp_mfcc_sR_q16_len512 = { 40, 13, melBandStart_512_40,
+                                                       melBandEnd_512_40, melWeights_512_40_q16,
+                                                       &plp_dct2_sR_q16_len40 };
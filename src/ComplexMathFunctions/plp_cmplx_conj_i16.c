@@ -74,6 +74,8 @@ void plp_cmplx_conj_i16(const int16_t *__restrict__ pSrc,
                         int16_t *__restrict__ pDst,
                         uint32_t numSamples) {
 
+    PLP_PROFILE_FUNC();
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         plp_cmplx_conj_i16_rv32im(pSrc, pDst, numSamples);
         return;
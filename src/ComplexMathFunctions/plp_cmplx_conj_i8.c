@@ -69,6 +69,8 @@ void plp_cmplx_conj_i8(const int8_t *__restrict__ pSrc,
                        int8_t *__restrict__ pDst,
                        uint32_t numSamples) {
 
+    PLP_PROFILE_FUNC();
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         plp_cmplx_conj_i8_rv32im(pSrc, pDst, numSamples);
         return;
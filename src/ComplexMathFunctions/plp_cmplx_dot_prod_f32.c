@@ -82,6 +82,8 @@ void plp_cmplx_dot_prod_f32(const float32_t *__restrict__ pSrcA,
                             float32_t *__restrict__ realResult,
                             float32_t *__restrict__ imagResult) {
 
+    PLP_PROFILE_FUNC();
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         printf("error: FC doesn't have FPU\n");
         return;
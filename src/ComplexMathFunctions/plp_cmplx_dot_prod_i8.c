@@ -82,6 +82,8 @@ void plp_cmplx_dot_prod_i8(const int8_t *__restrict__ pSrcA,
                            int8_t *__restrict__ realResult,
                            int8_t *__restrict__ imagResult) {
 
+    PLP_PROFILE_FUNC();
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         plp_cmplx_dot_prod_i8_rv32im(pSrcA, pSrcB, numSamples, realResult, imagResult);
     } else {
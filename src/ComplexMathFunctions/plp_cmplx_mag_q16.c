@@ -43,6 +43,8 @@ void plp_cmplx_mag_q16(const int16_t *pSrc,
                        int16_t *pRes,
                        uint32_t numSamples) {
 
+    PLP_PROFILE_FUNC();
+
     // Initial implementation, needs improvement
     int16_t real, cmplx, sqr;
     for (int i = 0; i < numSamples; i++) {
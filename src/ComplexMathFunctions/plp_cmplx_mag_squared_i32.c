@@ -76,6 +76,8 @@ void plp_cmplx_mag_squared_i32(const int32_t *__restrict__ pSrc,
                                int32_t *__restrict__ pDst,
                                uint32_t numSamples) {
 
+    PLP_PROFILE_FUNC();
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         plp_cmplx_mag_squared_i32_rv32im(pSrc, pDst, numSamples);
     } else {
@@ -78,6 +78,8 @@ void plp_cmplx_mag_squared_q32(const int32_t *__restrict__ pSrc,
                                uint32_t deciPoint,
                                uint32_t numSamples) {
 
+    PLP_PROFILE_FUNC();
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         plp_cmplx_mag_squared_q32_rv32im(pSrc, pDst, deciPoint, numSamples);
     } else {
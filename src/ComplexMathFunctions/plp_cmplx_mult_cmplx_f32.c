@@ -72,6 +72,8 @@ void plp_cmplx_mult_cmplx_f32(const float32_t *__restrict__ pSrcA,
                               float32_t *__restrict__ pDst,
                               uint32_t numSamples) {
 
+    PLP_PROFILE_FUNC();
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         printf("error: FC doesn't have FPU\n");
         return;
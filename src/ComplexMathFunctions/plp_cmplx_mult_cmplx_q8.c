@@ -79,6 +79,8 @@ void plp_cmplx_mult_cmplx_q8(const int8_t *__restrict__ pSrcA,
                              uint32_t deciPoint,
                              uint32_t numSamples) {
 
+    PLP_PROFILE_FUNC();
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         plp_cmplx_mult_cmplx_q8_rv32im(pSrcA, pSrcB, pDst, deciPoint, numSamples);
     } else {
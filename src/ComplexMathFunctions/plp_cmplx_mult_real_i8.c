@@ -78,6 +78,8 @@ void plp_cmplx_mult_real_i8(const int8_t *__restrict__ pSrcCmplx,
                             int8_t *__restrict__ pDst,
                             uint32_t numSamples) {
 
+    PLP_PROFILE_FUNC();
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         plp_cmplx_mult_real_i8_rv32im(pSrcCmplx, pSrcReal, pDst, numSamples);
     } else {
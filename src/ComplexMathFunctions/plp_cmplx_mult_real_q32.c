@@ -80,6 +80,8 @@ void plp_cmplx_mult_real_q32(const int32_t *__restrict__ pSrcCmplx,
                              uint32_t deciPoint,
                              uint32_t numSamples) {
 
+    PLP_PROFILE_FUNC();
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         plp_cmplx_mult_real_q32_rv32im(pSrcCmplx, pSrcReal, pDst, deciPoint, numSamples);
     } else {
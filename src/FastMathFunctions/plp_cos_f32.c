@@ -44,6 +44,8 @@
 
 float32_t plp_cos_f32(float32_t x) {
 
+    PLP_PROFILE_FUNC();
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         return 0.f;
     } else {
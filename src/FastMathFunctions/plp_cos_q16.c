@@ -45,6 +45,8 @@
 
 int16_t plp_cos_q16(int16_t x) {
 
+    PLP_PROFILE_FUNC();
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         return plp_cos_q16s_rv32im(x);
     } else {
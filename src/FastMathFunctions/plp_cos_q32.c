@@ -45,6 +45,8 @@
 
 int32_t plp_cos_q32(int32_t x) {
 
+    PLP_PROFILE_FUNC();
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         return plp_cos_q32s_rv32im(x);
     } else {
@@ -57,6 +57,8 @@
 
 void plp_sqrt_f32(const float *__restrict__ pSrc, float *__restrict__ pRes) {
 
+    PLP_PROFILE_FUNC();
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         *pRes = 0.f;
     } else {
@@ -59,6 +59,8 @@ void plp_sqrt_q16(const int16_t *__restrict__ pSrc,
                   const uint32_t fracBits,
                   int16_t *__restrict__ pRes) {
 
+    PLP_PROFILE_FUNC();
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         plp_sqrt_q16s_rv32im(pSrc, fracBits, pRes);
     } else {
@@ -59,10 +59,6 @@ void plp_conv_parallel_OLA(uint32_t nPE,
     uint32_t resultsLen =
         resultsoffset * (nPE - 1) + (srcALen - (srcAoffset * (nPE - 1))) + srcBLen - 1;
 
-    uint32_t cycles = nPE;
-    uint32_t remainingcycles = cycles;
-    uint32_t participants = nPE >> (1);
-
     plp_conv_tree_add_instance S = { .addOffset = srcAoffset,
                                      .addLengthfirst = resultsoffset,
                                      .addLengthsecond =
@@ -70,21 +66,10 @@ void plp_conv_parallel_OLA(uint32_t nPE,
                                      .numVectors = nPE,
                                      .pRes = resultsBuffer,
                                      .blockOffset = resultsoffset,
-                                     .coresPerVector = 2 * ((nPE) / ((S.numVectors >> 1) << 1)) };
-
-    while (remainingcycles > 1U) {
-
-        rt_team_fork((S.coresPerVector * (S.numVectors >> 1)), plp_conv_parallel_OLA_kernel,
-                     (void *)&S);
+                                     .coresPerVector = 2 * (nPE / ((nPE >> 1) << 1)) };
 
-        S.numVectors = S.numVectors - participants;
-        S.blockOffset *= 2;
-        S.addLengthfirst = S.addLengthfirst + S.addOffset;
-        S.addOffset *= 2;
-        remainingcycles = (remainingcycles + 1) >> 1;
-        participants = S.numVectors >> 1;
-        S.coresPerVector = ((2 * nPE) / ((S.numVectors >> 1) << 1));
-    }
+    /* one fork for the whole adder tree, the rounds are separated by barriers in the kernel */
+    rt_team_fork(nPE, plp_conv_parallel_OLA_kernel, (void *)&S);
 }
 
 /**
@@ -41,18 +41,16 @@
 */
 
 /**
-   @brief Helper function for parallelized overlap-adding of partial convolution results
-   @param[in] task_args  Holds the plp_conv_tree_add_instance that describes the vector parameters
+   @brief One round of the adder tree, as computed by one of the cores the round is split over
+   @param[in] S       Vector parameters of the round
+   @param[in] coreId  Index of the core within the round
+   @param[in] tail    0 to add the overlapping parts, 1 to copy the rest of the second vector
    @return none
 */
 
-void plp_conv_parallel_OLA_kernel(void *task_args) {
-
-    /* printf("Hello Core %i\n", rt_core_id()); */
-
-    plp_conv_tree_add_instance *S = (plp_conv_tree_add_instance *)task_args;
-
-    const uint8_t coreId = rt_core_id();
+static void plp_conv_parallel_OLA_step(const plp_conv_tree_add_instance *S,
+                                       uint32_t coreId,
+                                       uint32_t tail) {
 
     const uint8_t coresPerVector = S->coresPerVector;
     const uint32_t addOffset = S->addOffset;
@@ -65,29 +63,34 @@ void plp_conv_parallel_OLA_kernel(void *task_args) {
     uint32_t addLength = (addLengthfirst >= addLengthsecond + addOffset)
                              ? addLengthsecond
                              : addLengthfirst - addOffset;
-    uint32_t blockOffset = S->blockOffset; /* (addLengthsecond == addLengthfirst) ? S->blockOffset :
-                                              2*(S->blockOffset) - addLengthsecond; */
+    uint32_t blockOffset = S->blockOffset;
     int32_t *pRes = (S->pRes + 2 * (coreId / coresPerVector) * blockOffset);
 
     uint32_t stepSize = (addLength + coresPerVector - 1) / coresPerVector;
     uint8_t shardId = coreId % coresPerVector;
     uint32_t sharedLength = (addLengthsecond - addLength + coresPerVector - 1) / coresPerVector;
 
-#if defined(PLP_MATH_LOOPUNROLL)
-    uint32_t k;
-    int32_t temp1, temp2, temp3, temp4;
-    int32_t *_pRes = (pRes + (shardId * stepSize) + addOffset);
-    const int32_t *pIn1 = (pRes + (shardId * stepSize) + addOffset);
-    const int32_t *pIn2 = (pRes + (shardId * stepSize) + blockOffset);
-    const int32_t *pIn3 = (pRes + (shardId * sharedLength) + blockOffset + addLength);
-    int32_t *_pRes2 = (pRes + (shardId * sharedLength) + addLength + addOffset);
-#endif
+    /* the last shard of a vector takes whatever is left, no shard runs past the end */
+    uint32_t addEnd = (shardId != coresPerVector - 1) ? (shardId + 1) * stepSize : addLength;
+    uint32_t tailEnd = (shardId != coresPerVector - 1) ? (shardId + 1) * sharedLength
+                                                        : addLengthsecond - addLength;
+    uint32_t addBegin, tailBegin;
 
-    if (shardId != coresPerVector - 1) {
+    addEnd = (addEnd < addLength) ? addEnd : addLength;
+    addBegin = (shardId * stepSize < addEnd) ? shardId * stepSize : addEnd;
+    tailEnd = (tailEnd < addLengthsecond - addLength) ? tailEnd : addLengthsecond - addLength;
+    tailBegin = (shardId * sharedLength < tailEnd) ? shardId * sharedLength : tailEnd;
+
+    if (!tail) {
 
 #if defined(PLP_MATH_LOOPUNROLL)
+        uint32_t k;
+        int32_t temp1, temp2, temp3, temp4;
+        int32_t *_pRes = (pRes + addBegin + addOffset);
+        const int32_t *pIn1 = (pRes + addBegin + addOffset);
+        const int32_t *pIn2 = (pRes + addBegin + blockOffset);
 
-        k = stepSize >> 1U;
+        k = (addEnd - addBegin) >> 1U;
 
         while (k) {
             temp1 = *pIn1++;
@@ -101,122 +104,110 @@ void plp_conv_parallel_OLA_kernel(void *task_args) {
             k--;
         }
 
-        k = (stepSize) % 0x2U;
+        k = (addEnd - addBegin) % 0x2U;
 
         if (k) {
             *_pRes = *pIn1 + *pIn2;
         }
-
-        if (addLength < addLengthsecond && sharedLength > 0) {
-
-            k = sharedLength >> 1U;
-
-            while (k) {
-                temp1 = *pIn3++;
-                temp2 = *pIn3++;
-
-                *_pRes2++ = temp1;
-                *_pRes2++ = temp2;
-
-                k--;
-            }
-
-            k = sharedLength % 0x2U;
-
-            if (k) {
-                *_pRes2 = *pIn3;
-            }
-        }
-
 #else
-
-        for (uint32_t i = shardId * stepSize; i < (shardId + 1) * stepSize; i++) {
+        for (uint32_t i = addBegin; i < addEnd; i++) {
             pRes[i + addOffset] += pRes[i + blockOffset];
         }
-
-        if (addLength < addLengthsecond && sharedLength > 0) {
-            for (uint32_t i = shardId * sharedLength; i < (shardId + 1) * sharedLength; i++) {
-                pRes[i + addLength + addOffset] = pRes[i + blockOffset + addLength];
-            }
-        }
 #endif // if defined(PLP_MATH_LOOPUNROLL)
 
-    } else {
+    } else if (tailBegin < tailEnd) {
 
 #if defined(PLP_MATH_LOOPUNROLL)
+        uint32_t k;
+        int32_t temp1, temp2;
+        const int32_t *pIn3 = (pRes + tailBegin + blockOffset + addLength);
+        int32_t *_pRes2 = (pRes + tailBegin + addLength + addOffset);
 
-        k = (addLength - shardId * stepSize) >> 1U;
+        k = (tailEnd - tailBegin) >> 1U;
 
         while (k) {
-            temp1 = *pIn1++;
-            temp2 = *pIn1++;
-            temp3 = *pIn2++;
-            temp4 = *pIn2++;
+            temp1 = *pIn3++;
+            temp2 = *pIn3++;
 
-            *_pRes++ = temp1 + temp3;
-            *_pRes++ = temp2 + temp4;
+            *_pRes2++ = temp1;
+            *_pRes2++ = temp2;
 
             k--;
         }
 
-        k = (addLength - shardId * stepSize) % 0x2U;
+        k = (tailEnd - tailBegin) % 0x2U;
 
         if (k) {
-            *_pRes = *pIn1 + *pIn2;
+            *_pRes2 = *pIn3;
+        }
+#else
+        for (uint32_t i = tailBegin; i < tailEnd; i++) {
+            pRes[i + addLength + addOffset] = pRes[i + blockOffset + addLength];
         }
+#endif // if defined(PLP_MATH_LOOPUNROLL)
+    }
+}
+
+/**
+   @brief Helper function for parallelized overlap-adding of partial convolution results
+   @param[in] task_args  Holds the plp_conv_tree_add_instance that describes the first round of
+                         the adder tree. Its numVectors is the number of cores of the team.
+   @return none
 
-        if (addLength < addLengthsecond) {
+   @par
+   Every core of the team runs all rounds of the tree, separated by barriers. Cores that have no
+   work in a round only take part in its barriers. Each core advances its own copy of the round
+   parameters, so the shared instance is never written.
+*/
 
-            k = ((addLengthsecond - addLength) - shardId * sharedLength) >> 1U;
+void plp_conv_parallel_OLA_kernel(void *task_args) {
 
-            while (k) {
-                temp1 = *pIn3++;
-                temp2 = *pIn3++;
+    plp_conv_tree_add_instance S = *(plp_conv_tree_add_instance *)task_args;
 
-                *_pRes2++ = temp1;
-                *_pRes2++ = temp2;
+    const uint32_t coreId = rt_core_id();
+    const uint32_t nPE = S.numVectors;
 
-                k--;
-            }
+    uint32_t remainingcycles = nPE;
+    uint32_t participants = nPE >> 1;
+    uint32_t lengthSecond, addLength;
 
-            k = ((addLengthsecond - addLength) - shardId * sharedLength) % 0x2U;
+    while (remainingcycles > 1U) {
 
-            if (k) {
-                *_pRes2 = *pIn3;
-            }
-        }
+        uint32_t active = coreId < S.coresPerVector * participants;
 
-        if (coreId == (numVectors >> 1) * coresPerVector - 1) {
-            if (addLength >= addLengthsecond) {
-                S->addLengthsecond = addLengthfirst;
-            } else {
-                S->addLengthsecond = addLengthfirst + addLengthsecond - addLength;
-            }
+        if (active) {
+            plp_conv_parallel_OLA_step(&S, coreId, 0);
         }
 
-#else
-        for (uint32_t i = shardId * stepSize; i < addLength; i++) {
-            pRes[i + addOffset] += pRes[i + blockOffset];
-        }
+        /* the tail overwrites samples other shards may still be adding from */
+        rt_team_barrier();
 
-        if (addLength < addLengthsecond) {
-            for (uint32_t i = shardId * sharedLength; i < (addLengthsecond - addLength); i++) {
-                pRes[i + addLength + addOffset] = pRes[i + blockOffset + addLength];
-            }
+        if (active) {
+            plp_conv_parallel_OLA_step(&S, coreId, 1);
         }
 
-        if (coreId == (numVectors >> 1) * coresPerVector - 1) {
-            if (addLength >= addLengthsecond) {
-                S->addLengthsecond = addLengthfirst;
-            } else {
-                S->addLengthsecond = addLengthfirst + addLengthsecond - addLength;
-            }
+        rt_team_barrier();
+
+        /* length of the last vector, as added by the last core of the round */
+        lengthSecond = (S.numVectors % 2) ? S.addLengthfirst : S.addLengthsecond;
+        addLength = (S.addLengthfirst >= lengthSecond + S.addOffset) ? lengthSecond
+                                                                     : S.addLengthfirst - S.addOffset;
+        if (addLength < lengthSecond) {
+            S.addLengthsecond = S.addLengthfirst + lengthSecond - addLength;
+        } else {
+            S.addLengthsecond = S.addLengthfirst;
         }
 
-#endif // if defined(PLP_MATH_LOOPUNROLL)
+        S.numVectors = S.numVectors - participants;
+        S.blockOffset *= 2;
+        S.addLengthfirst = S.addLengthfirst + S.addOffset;
+        S.addOffset *= 2;
+        remainingcycles = (remainingcycles + 1) >> 1;
+        participants = S.numVectors >> 1;
+        if (participants > 0) { // no division by zero after the last round
+            S.coresPerVector = ((2 * nPE) / (participants << 1));
+        }
     }
-    rt_team_barrier();
-    return;
 }
 
 /**
@@ -62,12 +62,24 @@ void plp_conv_i32_parallel(const int32_t *pSrcA,
                            const uint8_t nPE,
                            int32_t *pRes) {
 
+    PLP_PROFILE_FUNC();
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         printf("parallel processing supported only for cluster side\n");
         return;
     } else {
 
-        if (nPE == 1) {
+#if defined(PLP_CONV_SEQUENTIALADDING)
+        uint32_t variant = PLP_DISPATCH_SEQUENTIAL;
+#else
+        uint32_t variant = PLP_DISPATCH_OLA;
+#endif
+        uint32_t numPE = nPE;
+
+        plp_dispatch_select(PLP_DISPATCH_CONV_I32, (srcALen >= srcBLen) ? srcALen : srcBLen,
+                            &numPE, &variant);
+
+        if (numPE == 1) {
             plp_conv_i32(pSrcA, srcALen, pSrcB, srcBLen, pRes);
             return;
         }
@@ -90,17 +102,17 @@ void plp_conv_i32_parallel(const int32_t *pSrcA,
             pIn1Len = srcALen;
         }
 
-        uint32_t srcAoffset = ((pIn1Len + nPE - 1) / nPE);
+        uint32_t srcAoffset = ((pIn1Len + numPE - 1) / numPE);
         uint32_t resultsoffset = srcAoffset + pIn2Len - 1;
         uint32_t resultsLen =
-            resultsoffset * (nPE - 1) + (pIn1Len - (srcAoffset * (nPE - 1))) + pIn2Len - 1;
-        int32_t *resBuf;
+            resultsoffset * (numPE - 1) + (pIn1Len - (srcAoffset * (numPE - 1))) + pIn2Len - 1;
+        int32_t *resBuf = NULL;
 
-        if (nPE > 1) {
-            resultsBuffer =
-                (int32_t *)rt_alloc(RT_ALLOC_CL_DATA, sizeof(int32_t) * resultsoffset * nPE);
+        if (numPE > 1) {
+            resultsBuffer = (int32_t *)plp_scratch_alloc(RT_ALLOC_CL_DATA,
+                                                         sizeof(int32_t) * resultsoffset * numPE);
             resBuf = resultsBuffer;
-            for (uint32_t i = resultsLen; i < resultsoffset * nPE; i++) {
+            for (uint32_t i = resultsLen; i < resultsoffset * numPE; i++) {
                 resultsBuffer[i] = 0;
             }
             // printf("Address of resultsBuffer: 0x%x, End: 0x%x\n", resultsBuffer, resultsBuffer +
@@ -114,73 +126,96 @@ void plp_conv_i32_parallel(const int32_t *pSrcA,
                                     .pSrcA = pIn1,
                                     .pSrcB = pIn2,
                                     .pRes = resultsBuffer,
-                                    .nPE = nPE };
-
-        rt_team_fork(nPE, plp_conv_i32p_xpulpv2, (void *)&S);
+                                    .nPE = numPE };
 
-        if (nPE > 1) {
+        rt_team_fork(numPE, plp_conv_i32p_xpulpv2, (void *)&S);
 
-            /* Sequential overlap-adding */
+        if (numPE > 1) {
 
-#if defined(PLP_CONV_SEQUENTIALADDING)
+            if (variant == PLP_DISPATCH_SEQUENTIAL) {
 
-            for (uint32_t i = 0; i < resultsoffset; i++) {
-                pRes[i] = resultsBuffer[i];
-            }
+                /* Sequential overlap-adding */
+                for (uint32_t i = 0; i < resultsoffset; i++) {
+                    pRes[i] = resultsBuffer[i];
+                }
 
-            for (uint32_t i = resultsoffset; i < srcALen + srcBLen - 1; i++) {
-                pRes[i] = 0;
-            }
+                for (uint32_t i = resultsoffset; i < srcALen + srcBLen - 1; i++) {
+                    pRes[i] = 0;
+                }
 
-            for (int32_t i = 1; i < nPE - 1; i++) {
-                for (uint32_t j = 0; j < resultsoffset; j++) {
-                    pRes[i * srcAoffset + j] += resultsBuffer[j + i * resultsoffset];
+                for (int32_t i = 1; i < numPE - 1; i++) {
+                    for (uint32_t j = 0; j < resultsoffset; j++) {
+                        pRes[i * srcAoffset + j] += resultsBuffer[j + i * resultsoffset];
+                    }
                 }
-            }
 
-            for (uint32_t j = 0; j < resultsLen - resultsoffset * (nPE - 1); j++) {
-                pRes[(nPE - 1) * srcAoffset + j] += resultsBuffer[(nPE - 1) * resultsoffset + j];
-            }
+                for (uint32_t j = 0; j < resultsLen - resultsoffset * (numPE - 1); j++) {
+                    pRes[(numPE - 1) * srcAoffset + j] +=
+                        resultsBuffer[(numPE - 1) * resultsoffset + j];
+                }
 
-#else
+            } else {
 
-            /* Parallel overlap-adding */
-            plp_conv_parallel_OLA(nPE, pIn1Len, pIn2Len, resultsBuffer);
+                /* Parallel overlap-adding */
+                plp_conv_parallel_OLA(numPE, pIn1Len, pIn2Len, resultsBuffer);
 
 #if defined(PLP_MATH_LOOPUNROLL)
 
-            uint32_t k = (srcALen + srcBLen - 1) >> 1U;
-            int32_t temp1, temp2;
+                uint32_t k = (srcALen + srcBLen - 1) >> 1U;
+                int32_t temp1, temp2;
 
-            while (k) {
-                temp1 = *resultsBuffer++;
-                temp2 = *resultsBuffer++;
+                while (k) {
+                    temp1 = *resultsBuffer++;
+                    temp2 = *resultsBuffer++;
 
-                *pRes++ = temp1;
-                *pRes++ = temp2;
+                    *pRes++ = temp1;
+                    *pRes++ = temp2;
 
-                k--;
-            }
+                    k--;
+                }
 
-            k = (srcALen + srcBLen - 1) % 0x2U;
+                k = (srcALen + srcBLen - 1) % 0x2U;
 
-            if (k) {
-                *pRes++ = *resultsBuffer++;
-            }
+                if (k) {
+                    *pRes++ = *resultsBuffer++;
+                }
 
 #else
-            for (uint32_t i = 0; i < srcALen + srcBLen - 1; i++) {
-                pRes[i] = resultsBuffer[i];
-            }
-#endif
-            rt_free(RT_ALLOC_CL_DATA, resBuf, sizeof(int32_t) * resultsoffset * nPE);
-
+                for (uint32_t i = 0; i < srcALen + srcBLen - 1; i++) {
+                    pRes[i] = resultsBuffer[i];
+                }
 #endif
+            }
+            plp_scratch_free(RT_ALLOC_CL_DATA, resBuf, sizeof(int32_t) * resultsoffset * numPE);
         }
         return;
     }
 }
 
+/**
+   @brief Worst-case scratch memory of plp_conv_i32_parallel.
+   @param[in]  srcALen   Length of the first input vector
+   @param[in]  srcBLen   Length of the second input vector
+   @param[in]  nPE       Number of cores to compute on
+   @return     number of bytes which plp_conv_i32_parallel takes from the scratch arena
+*/
+uint32_t plp_conv_i32_parallel_scratch_size(const uint32_t srcALen,
+                                            const uint32_t srcBLen,
+                                            const uint8_t nPE) {
+
+    if (nPE <= 1) {
+        return 0;
+    }
+
+    uint32_t in1Len = (srcALen >= srcBLen) ? srcBLen : srcALen;
+    uint32_t in2Len = (srcALen >= srcBLen) ? srcALen : srcBLen;
+
+    uint32_t srcAoffset = ((in1Len + nPE - 1) / nPE);
+    uint32_t resultsoffset = srcAoffset + in2Len - 1;
+
+    return PLP_SCRATCH_ALIGN(sizeof(int32_t) * resultsoffset * nPE);
+}
+
 /**
    @} end of BasicConvolution group
 */
@@ -57,6 +57,8 @@ void plp_conv_i8(const int8_t *pSrcA,
                  const uint32_t srcBLen,
                  int32_t *pRes) {
 
+    PLP_PROFILE_FUNC();
+
     uint32_t in1Len, in2Len;
     const int8_t *pIn1;
     const int8_t *pIn2;
@@ -87,7 +89,7 @@ void plp_conv_i8(const int8_t *pSrcA,
 
     if (rt_cluster_id() == ARCHI_FC_CID) {
 
-        _pRes1_8 = rt_alloc(RT_ALLOC_FC_DATA, sizeof(int32_t) * (resultsoffset));
+        _pRes1_8 = plp_scratch_alloc(RT_ALLOC_FC_DATA, sizeof(int32_t) * (resultsoffset));
 
         int32_t *pOut = pRes;
         int32_t *_pRes = _pRes1_8;
@@ -142,9 +144,11 @@ void plp_conv_i8(const int8_t *pSrcA,
             *pOut++ += *_pRes++;
         }
 
+        plp_scratch_free(RT_ALLOC_FC_DATA, _pRes1_8, sizeof(int32_t) * (resultsoffset));
+
     } else {
 
-        _pRes1_8 = rt_alloc(RT_ALLOC_CL_DATA, sizeof(int32_t) * (resultsoffset));
+        _pRes1_8 = plp_scratch_alloc(RT_ALLOC_CL_DATA, sizeof(int32_t) * (resultsoffset));
 
         int32_t *pOut = pRes;
         int32_t *_pRes = _pRes1_8;
@@ -198,8 +202,28 @@ void plp_conv_i8(const int8_t *pSrcA,
         if (k) {
             *pOut++ += *_pRes++;
         }
+
+        plp_scratch_free(RT_ALLOC_CL_DATA, _pRes1_8, sizeof(int32_t) * (resultsoffset));
     }
-    rt_free(RT_ALLOC_CL_DATA, _pRes1_8, sizeof(int32_t) * (resultsoffset));
+}
+
+/**
+   @brief Worst-case scratch memory of plp_conv_i8.
+   @param[in]  srcALen   Length of the first input vector
+   @param[in]  srcBLen   Length of the second input vector
+   @return     number of bytes which plp_conv_i8 takes from the scratch arena
+*/
+uint32_t plp_conv_i8_scratch_size(const uint32_t srcALen, const uint32_t srcBLen) {
+
+    uint32_t in1Len = (srcALen >= srcBLen) ? srcALen : srcBLen;
+    uint32_t in2Len = (srcALen >= srcBLen) ? srcBLen : srcALen;
+
+    uint32_t nPE = (OLARATIO8 / (in1Len / in2Len));
+    nPE = nPE > 0 ? nPE : 1;
+    uint32_t src2Offset = ((in2Len + nPE - 1) / nPE);
+    uint32_t resultsoffset = src2Offset + in1Len - 1;
+
+    return PLP_SCRATCH_ALIGN(sizeof(int32_t) * (resultsoffset));
 }
 
 /**
@@ -55,6 +55,8 @@ void plp_conv_valid_i16(const int16_t *pSrcA,
                         const uint32_t srcBLen,
                         int32_t *pRes) {
 
+    PLP_PROFILE_FUNC();
+
     uint32_t in1Len, in2Len;
     const int16_t *pIn1;
     const int16_t *pIn2;
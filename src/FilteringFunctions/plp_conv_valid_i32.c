@@ -54,6 +54,8 @@ void plp_conv_valid_i32(const int32_t *pSrcA,
                         const uint32_t srcBLen,
                         int32_t *pRes) {
 
+    PLP_PROFILE_FUNC();
+
     uint32_t in1Len, in2Len;
     const int32_t *pIn1;
     const int32_t *pIn2;
@@ -56,6 +56,8 @@ void plp_conv_valid_rep_i8(const int8_t *pSrcA,
                            const uint32_t srcBLen,
                            int32_t *pRes) {
 
+    PLP_PROFILE_FUNC();
+
     uint32_t in1Len, in2Len;
     const int8_t *pIn1;
     const int8_t *pIn2;
@@ -88,10 +90,15 @@ void plp_conv_valid_rep_i8(const int8_t *pSrcA,
         uint32_t len_align = ((in1Len + 3) >> 2) << 2; // compute aligned memory size
         uint32_t mem_size = len_align << 2;            // memory size for all 4 replications
 
-        int8_t *p_1_loc = rt_alloc(RT_ALLOC_CL_DATA, sizeof(int8_t) * mem_size);
-        int8_t *p_2_loc = rt_alloc(RT_ALLOC_CL_DATA, sizeof(int8_t) * in2Len);
+        int8_t *p_1_loc = plp_scratch_alloc(RT_ALLOC_CL_DATA, sizeof(int8_t) * mem_size);
+        if (p_1_loc == NULL) {
+            printf("Error: insufficient L1 memory!\n");
+            return;
+        }
 
-        if (p_1_loc == NULL || p_2_loc == NULL) {
+        int8_t *p_2_loc = plp_scratch_alloc(RT_ALLOC_CL_DATA, sizeof(int8_t) * in2Len);
+        if (p_2_loc == NULL) {
+            plp_scratch_free(RT_ALLOC_CL_DATA, p_1_loc, sizeof(int8_t) * mem_size);
             printf("Error: insufficient L1 memory!\n");
             return;
         }
@@ -113,11 +120,28 @@ void plp_conv_valid_rep_i8(const int8_t *pSrcA,
 
         plp_conv_valid_rep_i8s_xpulpv2(p_1_loc, in1Len, len_align, p_2_loc, in2Len, pRes);
 
-        rt_free(RT_ALLOC_CL_DATA, p_1_loc, sizeof(int8_t) * mem_size);
-        rt_free(RT_ALLOC_CL_DATA, p_2_loc, sizeof(int8_t) * in2Len);
+        plp_scratch_free(RT_ALLOC_CL_DATA, p_2_loc, sizeof(int8_t) * in2Len);
+        plp_scratch_free(RT_ALLOC_CL_DATA, p_1_loc, sizeof(int8_t) * mem_size);
     }
 }
 
+/**
+ * @brief Worst-case scratch memory of plp_conv_valid_rep_i8.
+ * @param[in]  srcALen Length of the first input vector
+ * @param[in]  srcBLen Length of the second input vector
+ * @return     number of bytes which plp_conv_valid_rep_i8 takes from the scratch arena
+ */
+uint32_t plp_conv_valid_rep_i8_scratch_size(const uint32_t srcALen, const uint32_t srcBLen) {
+
+    uint32_t in1Len = (srcALen >= srcBLen) ? srcALen : srcBLen;
+    uint32_t in2Len = (srcALen >= srcBLen) ? srcBLen : srcALen;
+
+    uint32_t len_align = ((in1Len + 3) >> 2) << 2;
+    uint32_t mem_size = len_align << 2;
+
+    return PLP_SCRATCH_ALIGN(sizeof(int8_t) * mem_size) + PLP_SCRATCH_ALIGN(sizeof(int8_t) * in2Len);
+}
+
 /**
  * @} end of BasicConvolution group
  */
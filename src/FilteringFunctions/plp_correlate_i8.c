@@ -61,6 +61,8 @@ void plp_correlate_i8(const int8_t *pSrcA,
                       const uint32_t srcBLen,
                       int32_t *__restrict__ pRes) {
 
+    PLP_PROFILE_FUNC();
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         plp_correlate_i8s_rv32im(pSrcA, srcALen, pSrcB, srcBLen, pRes);
     } else {
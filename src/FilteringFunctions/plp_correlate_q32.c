@@ -62,6 +62,8 @@ void plp_correlate_q32(const int32_t *pSrcA,
                        uint32_t fracBits,
                        int32_t *__restrict__ pRes) {
 
+    PLP_PROFILE_FUNC();
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         plp_correlate_q32s_rv32im(pSrcA, srcALen, pSrcB, srcBLen, fracBits, pRes);
     } else {
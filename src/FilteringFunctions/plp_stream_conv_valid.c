@@ -0,0 +1,79 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_stream_conv_valid.c
+ * Description:  Streaming adapters of the valid convolution
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_const_structs.h"
+
+/**
+  @ingroup Stream
+ */
+
+/**
+  @defgroup StreamFiltering Streaming Adapters of the Filtering Functions
+  PLP_STREAM_WINDOW operations for plp_stream which filter a long signal with a short FIR filter,
+  using the single-core XPULPV2 kernels of the valid convolution. The arguments are a
+  plp_stream_conv_args with the coefficients, the halo of the stream is numCoeffs - 1. The output
+  is the valid part of the convolution, with 32-bit elements.
+ */
+
+/**
+  @addtogroup StreamFiltering
+  @{
+ */
+
+static void plp_stream_conv_valid_i32_kernel(
+    const void *pSrcA, const void *pSrcB, uint32_t len, void *pDst, const void *args) {
+    const plp_stream_conv_args *conv = (const plp_stream_conv_args *)args;
+    plp_conv_valid_i32s_xpulpv2((const int32_t *)pSrcA, len + conv->numCoeffs - 1,
+                                (const int32_t *)conv->pCoeffs, conv->numCoeffs, (int32_t *)pDst);
+}
+
+static void plp_stream_conv_valid_i16_kernel(
+    const void *pSrcA, const void *pSrcB, uint32_t len, void *pDst, const void *args) {
+    const plp_stream_conv_args *conv = (const plp_stream_conv_args *)args;
+    plp_conv_valid_i16s_xpulpv2((const int16_t *)pSrcA, len + conv->numCoeffs - 1,
+                                (const int16_t *)conv->pCoeffs, conv->numCoeffs, (int32_t *)pDst);
+}
+
+static void plp_stream_conv_valid_i8_kernel(
+    const void *pSrcA, const void *pSrcB, uint32_t len, void *pDst, const void *args) {
+    const plp_stream_conv_args *conv = (const plp_stream_conv_args *)args;
+    plp_conv_valid_i8s_xpulpv2((const int8_t *)pSrcA, len + conv->numCoeffs - 1,
+                                (const int8_t *)conv->pCoeffs, conv->numCoeffs, (int32_t *)pDst);
+}
+
+const plp_stream_op plp_stream_conv_valid_i32 = { plp_stream_conv_valid_i32_kernel, NULL,
+                                                  PLP_STREAM_WINDOW, 4, 4 };
+const plp_stream_op plp_stream_conv_valid_i16 = { plp_stream_conv_valid_i16_kernel, NULL,
+                                                  PLP_STREAM_WINDOW, 2, 4 };
+const plp_stream_op plp_stream_conv_valid_i8 = { plp_stream_conv_valid_i8_kernel, NULL,
+                                                 PLP_STREAM_WINDOW, 1, 4 };
+
+/**
+  @} end of StreamFiltering group
+ */
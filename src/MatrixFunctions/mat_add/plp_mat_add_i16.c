@@ -81,6 +81,8 @@ void plp_mat_add_i16(const int16_t *__restrict__ pSrcA,
                      uint32_t N,
                      int16_t *__restrict__ pDst) {
 
+    PLP_PROFILE_FUNC();
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         plp_mat_add_i16s_rv32im(pSrcA, pSrcB, M, N, pDst);
     } else {
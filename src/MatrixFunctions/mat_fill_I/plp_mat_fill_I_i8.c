@@ -48,6 +48,8 @@
 
 void plp_mat_fill_I_i8(uint32_t N, int8_t *__restrict__ pDst) {
 
+    PLP_PROFILE_FUNC();
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         plp_mat_fill_I_i8s_rv32im(N, pDst);
     } else {
@@ -53,6 +53,8 @@ void plp_mat_fill_I_q32_parallel(uint32_t N,
                                  uint32_t nPE,
                                  int32_t *__restrict__ pDst) {
 
+    PLP_PROFILE_FUNC();
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         printf("parallel processing supported only for cluster side\n");
         return;
@@ -76,6 +76,8 @@
 
 int plp_mat_inv_f32(float *__restrict__ pSrc, uint32_t N, float *__restrict__ pDst) {
 
+    PLP_PROFILE_FUNC();
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         printf("Floating point is supported only for cluster side\n");
         return 2;
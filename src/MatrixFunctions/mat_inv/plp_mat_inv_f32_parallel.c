@@ -56,6 +56,8 @@ int plp_mat_inv_f32_parallel(float *__restrict__ pSrc,
                              uint32_t nPE,
                              float *__restrict__ pDst) {
 
+    PLP_PROFILE_FUNC();
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         printf("parallel and floating-point processing supported only for cluster side\n");
         return 2;
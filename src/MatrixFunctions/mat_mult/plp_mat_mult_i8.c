@@ -57,6 +57,8 @@ void plp_mat_mult_i8(const int8_t *__restrict__ pSrcA,
                      uint32_t O,
                      int32_t *__restrict__ pDstC) {
 
+    PLP_PROFILE_FUNC();
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         plp_mat_mult_i8s_rv32im(pSrcA, pSrcB, M, N, O, pDstC);
     } else {
@@ -48,7 +48,11 @@
   @param[in]  O     Width of matrix SrcB and DstC
   @param[out] pDstC Points to the output matrix of shape MxO
   @return     none
- */
+
+  @par Blocking
+  Uses the kernel plp_mat_mult_cmplx_stride_f32s_xpulpv2, which computes blocks of 2x2 output
+  elements.
+*/
 
 void plp_mat_mult_cmplx_f32s_xpulpv2(const float *__restrict__ pSrcA,
                                      const float *__restrict__ pSrcB,
@@ -57,32 +61,7 @@ void plp_mat_mult_cmplx_f32s_xpulpv2(const float *__restrict__ pSrcA,
                                      uint32_t O,
                                      float *__restrict__ pDstC) {
 
-#define BASIC_VERSION // if used don't forget to also use the undefine at end of file
-#ifdef BASIC_VERSION
-
-    for (int m = 0; m < M; m++) {
-        for (int o = 0; o < O; o++) {
-            float sum_re = 0;
-            float sum_im = 0;
-            for (int n = 0; n < N; n++) {
-                float a_re = (float)pSrcA[(m * N + n) * 2 + 0];
-                float a_im = (float)pSrcA[(m * N + n) * 2 + 1];
-                float b_re = (float)pSrcB[(n * O + o) * 2 + 0];
-                float b_im = (float)pSrcB[(n * O + o) * 2 + 1];
-                sum_re += a_re * b_re - a_im * b_im;
-                sum_im += a_re * b_im + a_im * b_re;
-            }
-            pDstC[(m * O + o) * 2 + 0] = sum_re;
-            pDstC[(m * O + o) * 2 + 1] = sum_im;
-        }
-    }
-
-#else
-
-    // TODO: Hackathon
-
-#endif
-#undef BASIC_VERSION
+    plp_mat_mult_cmplx_stride_f32s_xpulpv2(pSrcA, pSrcB, M, N, O, N, O, O, pDstC);
 }
 
 /**
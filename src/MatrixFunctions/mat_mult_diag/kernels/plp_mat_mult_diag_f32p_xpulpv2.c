@@ -0,0 +1,133 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_diag_f32p_xpulpv2.c
+ * Description:  parallel 32-bit floating-point diagonal scaled matrix multiplication for XPULPV2
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatMultStruct
+ */
+
+/**
+  @addtogroup MatMultStructKernels
+  @{
+ */
+
+/* one row of C = diag(pDiagRow) * A * B * diag(pDiagCol), pDiagRow points to the scaling factor of
+   this row. The scaling is applied to the accumulators before the store. */
+static inline void diag_row(const float *__restrict__ pRow,
+                            const float *__restrict__ pSrcB,
+                            uint32_t N,
+                            uint32_t O,
+                            const float *__restrict__ pDiagRow,
+                            const float *__restrict__ pDiagCol,
+                            float *__restrict__ pDst) {
+    uint32_t j, o;
+    float dRow = pDiagRow != NULL ? *pDiagRow : 1.0f;
+
+    /* blocks of four columns */
+    for (o = 0; o + 3 < O; o += 4) {
+        const float *pB = pSrcB + o;
+        float sum0 = 0;
+        float sum1 = 0;
+        float sum2 = 0;
+        float sum3 = 0;
+        for (j = 0; j < N; j++) {
+            float a = pRow[j];
+            sum0 += a * pB[0];
+            sum1 += a * pB[1];
+            sum2 += a * pB[2];
+            sum3 += a * pB[3];
+            pB += O;
+        }
+        if (pDiagCol != NULL) {
+            sum0 *= pDiagCol[o + 0];
+            sum1 *= pDiagCol[o + 1];
+            sum2 *= pDiagCol[o + 2];
+            sum3 *= pDiagCol[o + 3];
+        }
+        pDst[o + 0] = sum0 * dRow;
+        pDst[o + 1] = sum1 * dRow;
+        pDst[o + 2] = sum2 * dRow;
+        pDst[o + 3] = sum3 * dRow;
+    }
+
+    /* remaining columns */
+    for (; o < O; o++) {
+        float sum = 0;
+        for (j = 0; j < N; j++) {
+            sum += pRow[j] * pSrcB[j * O + o];
+        }
+        if (pDiagCol != NULL) {
+            sum *= pDiagCol[o];
+        }
+        pDst[o] = sum * dRow;
+    }
+}
+
+/**
+  @brief      Parallel diagonal scaled matrix multiplication of 32-bit floats kernel for XPULPV2
+              extension
+  @param[in]  args  pointer to plp_mat_mult_diag_instance_f32 struct initialized by
+                    plp_mat_mult_diag_f32_parallel
+  @return     none
+
+  @par Blocking
+  Four columns of C are computed at once, such that every value of A is loaded once for
+  four multiply-accumulates.
+
+  @par Parallelization
+  Every core computes every nPE-th row.
+ */
+
+void plp_mat_mult_diag_f32p_xpulpv2(void *args) {
+
+    int core_id = rt_core_id();
+
+    plp_mat_mult_diag_instance_f32 *a = (plp_mat_mult_diag_instance_f32 *)args;
+
+    const float *__restrict__ pSrcA = a->pSrcA;
+    const float *__restrict__ pSrcB = a->pSrcB;
+    const float *__restrict__ pDiagRow = a->pDiagRow;
+    const float *__restrict__ pDiagCol = a->pDiagCol;
+    uint32_t M = a->M;
+    uint32_t N = a->N;
+    uint32_t O = a->O;
+    uint32_t nPE = a->nPE;
+    float *__restrict__ pDstC = a->pDstC;
+
+    uint32_t m;
+
+    for (m = core_id; m < M; m += nPE) {
+        diag_row(pSrcA + m * N, pSrcB, N, O, pDiagRow != NULL ? pDiagRow + m : NULL, pDiagCol,
+                 pDstC + m * O);
+    }
+}
+
+/**
+  @} end of MatMultStructKernels group
+ */
@@ -0,0 +1,128 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_diag_f32s_xpulpv2.c
+ * Description:  32-bit floating-point diagonal scaled matrix multiplication for XPULPV2
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatMultStruct
+ */
+
+/**
+  @addtogroup MatMultStructKernels
+  @{
+ */
+
+/* one row of C = diag(pDiagRow) * A * B * diag(pDiagCol), pDiagRow points to the scaling factor of
+   this row. The scaling is applied to the accumulators before the store. */
+static inline void diag_row(const float *__restrict__ pRow,
+                            const float *__restrict__ pSrcB,
+                            uint32_t N,
+                            uint32_t O,
+                            const float *__restrict__ pDiagRow,
+                            const float *__restrict__ pDiagCol,
+                            float *__restrict__ pDst) {
+    uint32_t j, o;
+    float dRow = pDiagRow != NULL ? *pDiagRow : 1.0f;
+
+    /* blocks of four columns */
+    for (o = 0; o + 3 < O; o += 4) {
+        const float *pB = pSrcB + o;
+        float sum0 = 0;
+        float sum1 = 0;
+        float sum2 = 0;
+        float sum3 = 0;
+        for (j = 0; j < N; j++) {
+            float a = pRow[j];
+            sum0 += a * pB[0];
+            sum1 += a * pB[1];
+            sum2 += a * pB[2];
+            sum3 += a * pB[3];
+            pB += O;
+        }
+        if (pDiagCol != NULL) {
+            sum0 *= pDiagCol[o + 0];
+            sum1 *= pDiagCol[o + 1];
+            sum2 *= pDiagCol[o + 2];
+            sum3 *= pDiagCol[o + 3];
+        }
+        pDst[o + 0] = sum0 * dRow;
+        pDst[o + 1] = sum1 * dRow;
+        pDst[o + 2] = sum2 * dRow;
+        pDst[o + 3] = sum3 * dRow;
+    }
+
+    /* remaining columns */
+    for (; o < O; o++) {
+        float sum = 0;
+        for (j = 0; j < N; j++) {
+            sum += pRow[j] * pSrcB[j * O + o];
+        }
+        if (pDiagCol != NULL) {
+            sum *= pDiagCol[o];
+        }
+        pDst[o] = sum * dRow;
+    }
+}
+
+/**
+  @brief      Diagonal scaled matrix multiplication of 32-bit floats kernel for XPULPV2 extension
+  @param[in]  pSrcA    Points to the first input matrix of shape MxN
+  @param[in]  pSrcB    Points to the second input matrix of shape NxO
+  @param[in]  pDiagRow Points to the M row factors, or NULL to skip the row scaling
+  @param[in]  pDiagCol Points to the O column factors, or NULL to skip the column scaling
+  @param[in]  M        Height of A and C
+  @param[in]  N        Width of A, height of B
+  @param[in]  O        Width of B and C
+  @param[out] pDstC    Points to the output matrix of shape MxO
+  @return     none
+
+  @par Blocking
+  Four columns of C are computed at once, such that every value of A is loaded once for
+  four multiply-accumulates.
+ */
+
+void plp_mat_mult_diag_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                                    const float *__restrict__ pSrcB,
+                                    const float *__restrict__ pDiagRow,
+                                    const float *__restrict__ pDiagCol,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    float *__restrict__ pDstC) {
+
+    uint32_t m;
+
+    for (m = 0; m < M; m++) {
+        diag_row(pSrcA + m * N, pSrcB, N, O, pDiagRow != NULL ? pDiagRow + m : NULL, pDiagCol,
+                 pDstC + m * O);
+    }
+}
+
+/**
+  @} end of MatMultStructKernels group
+ */
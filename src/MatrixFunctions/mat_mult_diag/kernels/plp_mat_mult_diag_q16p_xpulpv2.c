@@ -0,0 +1,148 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_diag_q16p_xpulpv2.c
+ * Description:  parallel 16-bit fix-point diagonal scaled matrix multiplication for XPULPV2
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatMultStruct
+ */
+
+/**
+  @addtogroup MatMultStructKernels
+  @{
+ */
+
+/* truncates the sum to 16 bits like plp_mat_mult_q16, then applies the row and the column factor */
+static inline int16_t diag_scale(int32_t sum,
+                                 const int16_t *__restrict__ pDiagRow,
+                                 const int16_t *__restrict__ pDiagCol,
+                                 uint32_t o,
+                                 uint32_t shift) {
+    int32_t value = (int16_t)sum;
+    if (pDiagRow != NULL) {
+        value = (int16_t)(__ROUNDNORM_REG(value * *pDiagRow, shift));
+    }
+    if (pDiagCol != NULL) {
+        value = (int16_t)(__ROUNDNORM_REG(value * pDiagCol[o], shift));
+    }
+    return (int16_t)value;
+}
+
+/* one row of C = diag(pDiagRow) * A * B * diag(pDiagCol), pDiagRow points to the scaling factor of
+   this row */
+static inline void diag_row(const int16_t *__restrict__ pRow,
+                            const int16_t *__restrict__ pSrcB,
+                            uint32_t N,
+                            uint32_t O,
+                            const int16_t *__restrict__ pDiagRow,
+                            const int16_t *__restrict__ pDiagCol,
+                            uint32_t shift,
+                            int16_t *__restrict__ pDst) {
+    uint32_t j, o;
+
+    /* blocks of four columns */
+    for (o = 0; o + 3 < O; o += 4) {
+        const int16_t *pB = pSrcB + o;
+        int32_t sum0 = 0;
+        int32_t sum1 = 0;
+        int32_t sum2 = 0;
+        int32_t sum3 = 0;
+        for (j = 0; j < N; j++) {
+            int32_t a = (int32_t)pRow[j];
+            sum0 += __ROUNDNORM_REG(a * pB[0], shift);
+            sum1 += __ROUNDNORM_REG(a * pB[1], shift);
+            sum2 += __ROUNDNORM_REG(a * pB[2], shift);
+            sum3 += __ROUNDNORM_REG(a * pB[3], shift);
+            pB += O;
+        }
+        pDst[o + 0] = diag_scale(sum0, pDiagRow, pDiagCol, o + 0, shift);
+        pDst[o + 1] = diag_scale(sum1, pDiagRow, pDiagCol, o + 1, shift);
+        pDst[o + 2] = diag_scale(sum2, pDiagRow, pDiagCol, o + 2, shift);
+        pDst[o + 3] = diag_scale(sum3, pDiagRow, pDiagCol, o + 3, shift);
+    }
+
+    /* remaining columns */
+    for (; o < O; o++) {
+        int32_t sum = 0;
+        for (j = 0; j < N; j++) {
+            sum += __ROUNDNORM_REG((int32_t)pRow[j] * pSrcB[j * O + o], shift);
+        }
+        pDst[o] = diag_scale(sum, pDiagRow, pDiagCol, o, shift);
+    }
+}
+
+/**
+  @brief      Parallel diagonal scaled matrix multiplication of 16-bit fix-point numbers kernel for
+              XPULPV2 extension
+  @param[in]  args  pointer to plp_mat_mult_diag_instance_q16 struct initialized by
+                    plp_mat_mult_diag_q16_parallel
+  @return     none
+
+  @par Blocking
+  Four columns of C are computed at once, such that every value of A is loaded once for
+  four multiply-accumulates.
+
+  @par Parallelization
+  Every core computes every nPE-th row.
+
+  @par Fix-Point and Shifting
+  The product A * B is computed like in plp_mat_mult_q16: every product is shifted
+  by `shift` to the right with rounding and the sum is truncated to 16 bits. It is
+  then multiplied with the row and the column factor, each followed by a rounding
+  shift by `shift`. The factors therefore have `shift` bits after the binary point,
+  and `1 << shift` does not change the value.
+ */
+
+void plp_mat_mult_diag_q16p_xpulpv2(void *args) {
+
+    int core_id = rt_core_id();
+
+    plp_mat_mult_diag_instance_q16 *a = (plp_mat_mult_diag_instance_q16 *)args;
+
+    const int16_t *__restrict__ pSrcA = a->pSrcA;
+    const int16_t *__restrict__ pSrcB = a->pSrcB;
+    const int16_t *__restrict__ pDiagRow = a->pDiagRow;
+    const int16_t *__restrict__ pDiagCol = a->pDiagCol;
+    uint32_t M = a->M;
+    uint32_t N = a->N;
+    uint32_t O = a->O;
+    uint32_t shift = a->shift;
+    uint32_t nPE = a->nPE;
+    int16_t *__restrict__ pDstC = a->pDstC;
+
+    uint32_t m;
+
+    for (m = core_id; m < M; m += nPE) {
+        diag_row(pSrcA + m * N, pSrcB, N, O, pDiagRow != NULL ? pDiagRow + m : NULL, pDiagCol,
+                 shift, pDstC + m * O);
+    }
+}
+
+/**
+  @} end of MatMultStructKernels group
+ */
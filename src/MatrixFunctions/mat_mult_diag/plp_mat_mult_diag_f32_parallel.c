@@ -0,0 +1,80 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_diag_f32_parallel.c
+ * Description:  parallel 32-bit floating-point diagonal scaled matrix multiplication glue code
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatMultStruct
+  @{
+ */
+
+/**
+  @brief      Glue code for parallel diagonal scaled matrix multiplication of 32-bit floats
+  @param[in]  pSrcA    Points to the first input matrix of shape MxN
+  @param[in]  pSrcB    Points to the second input matrix of shape NxO
+  @param[in]  pDiagRow Points to the M row factors, or NULL to skip the row scaling
+  @param[in]  pDiagCol Points to the O column factors, or NULL to skip the column scaling
+  @param[in]  M        Height of A and C
+  @param[in]  N        Width of A, height of B
+  @param[in]  O        Width of B and C
+  @param[in]  nPE      Number of cores to use for computation
+  @param[out] pDstC    Points to the output matrix of shape MxO
+  @return     none
+ */
+
+void plp_mat_mult_diag_f32_parallel(const float *__restrict__ pSrcA,
+                                    const float *__restrict__ pSrcB,
+                                    const float *__restrict__ pDiagRow,
+                                    const float *__restrict__ pDiagCol,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    uint32_t nPE,
+                                    float *__restrict__ pDstC) {
+
+    PLP_PROFILE_FUNC();
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_mat_mult_diag_instance_f32 args = {
+            .pSrcA = pSrcA, .pSrcB = pSrcB, .pDiagRow = pDiagRow, .pDiagCol = pDiagCol, .M = M,
+            .N = N, .O = O, .nPE = nPE, .pDstC = pDstC
+        };
+        rt_team_fork(nPE, plp_mat_mult_diag_f32p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of MatMultStruct group
+ */
@@ -0,0 +1,82 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_diag_q16.c
+ * Description:  16-bit fix-point diagonal scaled matrix multiplication glue code
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatMultStruct
+  @{
+ */
+
+/**
+  @brief      Glue code for diagonal scaled matrix multiplication of 16-bit fix-point numbers
+  @param[in]  pSrcA    Points to the first input matrix of shape MxN
+  @param[in]  pSrcB    Points to the second input matrix of shape NxO
+  @param[in]  pDiagRow Points to the M row factors, or NULL to skip the row scaling
+  @param[in]  pDiagCol Points to the O column factors, or NULL to skip the column scaling
+  @param[in]  M        Height of A and C
+  @param[in]  N        Width of A, height of B
+  @param[in]  O        Width of B and C
+  @param[in]  shift    Amount to shift the result of each multiplication
+  @param[out] pDstC    Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point and Shifting
+  The product A * B is computed like in plp_mat_mult_q16: every product is shifted
+  by `shift` to the right with rounding and the sum is truncated to 16 bits. It is
+  then multiplied with the row and the column factor, each followed by a rounding
+  shift by `shift`. The factors therefore have `shift` bits after the binary point,
+  and `1 << shift` does not change the value.
+ */
+
+void plp_mat_mult_diag_q16(const int16_t *__restrict__ pSrcA,
+                           const int16_t *__restrict__ pSrcB,
+                           const int16_t *__restrict__ pDiagRow,
+                           const int16_t *__restrict__ pDiagCol,
+                           uint32_t M,
+                           uint32_t N,
+                           uint32_t O,
+                           uint32_t shift,
+                           int16_t *__restrict__ pDstC) {
+
+    PLP_PROFILE_FUNC();
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_mat_mult_diag_q16s_rv32im(pSrcA, pSrcB, pDiagRow, pDiagCol, M, N, O, shift, pDstC);
+    } else {
+        plp_mat_mult_diag_q16s_xpulpv2(pSrcA, pSrcB, pDiagRow, pDiagCol, M, N, O, shift, pDstC);
+    }
+}
+
+/**
+  @} end of MatMultStruct group
+ */
@@ -0,0 +1,83 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_i4i8s_rv32im.c
+ * Description:  4-bit x 8-bit matrix multiplication for RV32IM
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatMultMixed
+ */
+
+/**
+  @addtogroup MatMultMixedKernels
+  @{
+ */
+
+/**
+  @brief      Matrix multiplication of 4-bit integer weights and 8-bit integer activations kernel
+              for RV32IM extension
+  @param[in]  pSrcA Points to the 4-bit weights A of shape MxN, packed two per byte
+  @param[in]  pSrcB Points to the activations B of shape NxO
+  @param[in]  M     Height of A and C, number of output channels
+  @param[in]  N     Width of A, height of B
+  @param[in]  O     Width of B and C
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+ */
+
+void plp_mat_mult_i4i8s_rv32im(const int8_t *__restrict__ pSrcA,
+                               const int8_t *__restrict__ pSrcB,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t O,
+                               int32_t *__restrict__ pDstC) {
+
+    uint32_t m, n, o;
+
+    /* every row of A starts with a new byte */
+    uint32_t rowBytes = (N + 1) / 2;
+
+    for (m = 0; m < M; m++) {
+        const int8_t *pRow = pSrcA + m * rowBytes;
+        for (o = 0; o < O; o++) {
+            int32_t sum = 0;
+            for (n = 0; n + 1 < N; n += 2) {
+                uint32_t byte = (uint8_t)pRow[n / 2];
+                sum += ((int8_t)(byte << 4) >> 4) * pSrcB[n * O + o];
+                sum += ((int8_t)byte >> 4) * pSrcB[(n + 1) * O + o];
+            }
+            if (n < N) {
+                sum += ((int8_t)((uint8_t)pRow[n / 2] << 4) >> 4) * pSrcB[n * O + o];
+            }
+            pDstC[m * O + o] = sum;
+        }
+    }
+}
+
+/**
+  @} end of MatMultMixedKernels group
+ */
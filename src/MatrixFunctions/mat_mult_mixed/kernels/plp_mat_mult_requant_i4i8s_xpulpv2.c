@@ -0,0 +1,364 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_requant_i4i8s_xpulpv2.c
+ * Description:  4-bit x 8-bit requantized matrix multiplication for XPULPV2
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatMultMixed
+ */
+
+/**
+  @addtogroup MatMultMixedKernels
+  @{
+ */
+
+RT_CL_DATA static v4s nibbleShift = { 4, 4, 4, 4 };
+RT_CL_DATA static v4s nibbleHigh = { -16, -16, -16, -16 }; // 0xf0 in every byte
+
+/* per-channel requantization: rounding shift of sum * mult + bias, saturated to 8 bits */
+static inline int8_t requant(int32_t sum,
+                             int32_t mult,
+                             int32_t bias,
+                             uint32_t shift) {
+    return (int8_t)__CLIP(__ROUNDNORM_REG(sum * mult + bias, shift), 7);
+}
+
+/* A word of A holds eight 4-bit weights. Shifting every byte left by four gives the weights
+   of the even columns, masking every byte with 0xf0 gives the weights of the odd columns,
+   both multiplied by 16. The SIMD sums are therefore divided by 16 at the end. */
+
+/* 2 rows of C, starting at the row pA of A and the row pDst of C, pMult and pBias point to
+   the factors of the first row */
+static inline void mult_rows2(const int8_t *__restrict__ pA,
+                              const int8_t *__restrict__ pSrcB,
+                              uint32_t N,
+                              uint32_t O,
+                              const int32_t *__restrict__ pMult,
+                              const int32_t *__restrict__ pBias,
+                              uint32_t shift,
+                              int8_t *__restrict__ pDst) {
+    const int8_t *pA0 = pA;
+    const int8_t *pA1 = pA0 + (N + 1) / 2;
+    uint32_t n, o;
+
+    for (o = 0; o + 3 < O; o += 4) {
+        int32_t sum00 = 0;
+        int32_t sum01 = 0;
+        int32_t sum02 = 0;
+        int32_t sum03 = 0;
+        int32_t sum10 = 0;
+        int32_t sum11 = 0;
+        int32_t sum12 = 0;
+        int32_t sum13 = 0;
+        for (n = 0; n + 7 < N; n += 8) {
+            v4s w0 = *((v4s *)&pA0[n / 2]);
+            v4s w1 = *((v4s *)&pA1[n / 2]);
+            v4s even0 = __SLL4(w0, nibbleShift);
+            v4s odd0 = __AND4(w0, nibbleHigh);
+            v4s even1 = __SLL4(w1, nibbleShift);
+            v4s odd1 = __AND4(w1, nibbleHigh);
+
+            /* rows n to n + 7 of B in the columns o to o + 3, transposed into the even and the
+               odd rows of every column */
+            v4s b0 = *((v4s *)&pSrcB[n * O + o]);
+            v4s b1 = *((v4s *)&pSrcB[(n + 1) * O + o]);
+            v4s b2 = *((v4s *)&pSrcB[(n + 2) * O + o]);
+            v4s b3 = *((v4s *)&pSrcB[(n + 3) * O + o]);
+            v4s b4 = *((v4s *)&pSrcB[(n + 4) * O + o]);
+            v4s b5 = *((v4s *)&pSrcB[(n + 5) * O + o]);
+            v4s b6 = *((v4s *)&pSrcB[(n + 6) * O + o]);
+            v4s b7 = *((v4s *)&pSrcB[(n + 7) * O + o]);
+            v4s e0 = __builtin_shuffle(b0, b2, (v4s){ 0, 4, 1, 5 });
+            v4s e1 = __builtin_shuffle(b4, b6, (v4s){ 0, 4, 1, 5 });
+            v4s e2 = __builtin_shuffle(b0, b2, (v4s){ 2, 6, 3, 7 });
+            v4s e3 = __builtin_shuffle(b4, b6, (v4s){ 2, 6, 3, 7 });
+            v4s o0 = __builtin_shuffle(b1, b3, (v4s){ 0, 4, 1, 5 });
+            v4s o1 = __builtin_shuffle(b5, b7, (v4s){ 0, 4, 1, 5 });
+            v4s o2 = __builtin_shuffle(b1, b3, (v4s){ 2, 6, 3, 7 });
+            v4s o3 = __builtin_shuffle(b5, b7, (v4s){ 2, 6, 3, 7 });
+            v4s bEven0 = __builtin_shuffle(e0, e1, (v4s){ 0, 1, 4, 5 });
+            v4s bEven1 = __builtin_shuffle(e0, e1, (v4s){ 2, 3, 6, 7 });
+            v4s bEven2 = __builtin_shuffle(e2, e3, (v4s){ 0, 1, 4, 5 });
+            v4s bEven3 = __builtin_shuffle(e2, e3, (v4s){ 2, 3, 6, 7 });
+            v4s bOdd0 = __builtin_shuffle(o0, o1, (v4s){ 0, 1, 4, 5 });
+            v4s bOdd1 = __builtin_shuffle(o0, o1, (v4s){ 2, 3, 6, 7 });
+            v4s bOdd2 = __builtin_shuffle(o2, o3, (v4s){ 0, 1, 4, 5 });
+            v4s bOdd3 = __builtin_shuffle(o2, o3, (v4s){ 2, 3, 6, 7 });
+
+            sum00 = __SUMDOTP4(even0, bEven0, sum00);
+            sum00 = __SUMDOTP4(odd0, bOdd0, sum00);
+            sum01 = __SUMDOTP4(even0, bEven1, sum01);
+            sum01 = __SUMDOTP4(odd0, bOdd1, sum01);
+            sum02 = __SUMDOTP4(even0, bEven2, sum02);
+            sum02 = __SUMDOTP4(odd0, bOdd2, sum02);
+            sum03 = __SUMDOTP4(even0, bEven3, sum03);
+            sum03 = __SUMDOTP4(odd0, bOdd3, sum03);
+            sum10 = __SUMDOTP4(even1, bEven0, sum10);
+            sum10 = __SUMDOTP4(odd1, bOdd0, sum10);
+            sum11 = __SUMDOTP4(even1, bEven1, sum11);
+            sum11 = __SUMDOTP4(odd1, bOdd1, sum11);
+            sum12 = __SUMDOTP4(even1, bEven2, sum12);
+            sum12 = __SUMDOTP4(odd1, bOdd2, sum12);
+            sum13 = __SUMDOTP4(even1, bEven3, sum13);
+            sum13 = __SUMDOTP4(odd1, bOdd3, sum13);
+        }
+        sum00 = sum00 >> 4;
+        sum01 = sum01 >> 4;
+        sum02 = sum02 >> 4;
+        sum03 = sum03 >> 4;
+        sum10 = sum10 >> 4;
+        sum11 = sum11 >> 4;
+        sum12 = sum12 >> 4;
+        sum13 = sum13 >> 4;
+
+        /* remaining values of N */
+        for (; n + 1 < N; n += 2) {
+            int32_t a00 = __BITEXTRACT(pA0[n / 2], 4, 0);
+            int32_t a01 = __BITEXTRACT(pA0[n / 2], 4, 4);
+            int32_t a10 = __BITEXTRACT(pA1[n / 2], 4, 0);
+            int32_t a11 = __BITEXTRACT(pA1[n / 2], 4, 4);
+            const int8_t *pB = &pSrcB[n * O + o];
+            sum00 += a00 * pB[0] + a01 * pB[O];
+            sum01 += a00 * pB[1] + a01 * pB[O + 1];
+            sum02 += a00 * pB[2] + a01 * pB[O + 2];
+            sum03 += a00 * pB[3] + a01 * pB[O + 3];
+            sum10 += a10 * pB[0] + a11 * pB[O];
+            sum11 += a10 * pB[1] + a11 * pB[O + 1];
+            sum12 += a10 * pB[2] + a11 * pB[O + 2];
+            sum13 += a10 * pB[3] + a11 * pB[O + 3];
+        }
+        if (n < N) {
+            int32_t a00 = __BITEXTRACT(pA0[n / 2], 4, 0);
+            int32_t a10 = __BITEXTRACT(pA1[n / 2], 4, 0);
+            const int8_t *pB = &pSrcB[n * O + o];
+            sum00 += a00 * pB[0];
+            sum01 += a00 * pB[1];
+            sum02 += a00 * pB[2];
+            sum03 += a00 * pB[3];
+            sum10 += a10 * pB[0];
+            sum11 += a10 * pB[1];
+            sum12 += a10 * pB[2];
+            sum13 += a10 * pB[3];
+        }
+
+        pDst[o] = requant(sum00, pMult[0], pBias[0], shift);
+        pDst[o + 1] = requant(sum01, pMult[0], pBias[0], shift);
+        pDst[o + 2] = requant(sum02, pMult[0], pBias[0], shift);
+        pDst[o + 3] = requant(sum03, pMult[0], pBias[0], shift);
+        pDst[O + o] = requant(sum10, pMult[1], pBias[1], shift);
+        pDst[O + o + 1] = requant(sum11, pMult[1], pBias[1], shift);
+        pDst[O + o + 2] = requant(sum12, pMult[1], pBias[1], shift);
+        pDst[O + o + 3] = requant(sum13, pMult[1], pBias[1], shift);
+    }
+
+    /* remaining columns */
+    for (; o < O; o++) {
+        int32_t sum0 = 0;
+        int32_t sum1 = 0;
+        for (n = 0; n + 1 < N; n += 2) {
+            int32_t b0 = pSrcB[n * O + o];
+            int32_t b1 = pSrcB[(n + 1) * O + o];
+            int32_t w0 = pA0[n / 2];
+            int32_t w1 = pA1[n / 2];
+            sum0 += __BITEXTRACT(w0, 4, 0) * b0 + __BITEXTRACT(w0, 4, 4) * b1;
+            sum1 += __BITEXTRACT(w1, 4, 0) * b0 + __BITEXTRACT(w1, 4, 4) * b1;
+        }
+        if (n < N) {
+            int32_t b0 = pSrcB[n * O + o];
+            sum0 += __BITEXTRACT(pA0[n / 2], 4, 0) * b0;
+            sum1 += __BITEXTRACT(pA1[n / 2], 4, 0) * b0;
+        }
+        pDst[o] = requant(sum0, pMult[0], pBias[0], shift);
+        pDst[O + o] = requant(sum1, pMult[1], pBias[1], shift);
+    }
+}
+
+/* one row of C, starting at the row pA of A and the row pDst of C, pMult and pBias point to
+   the factors of the first row */
+static inline void mult_rows1(const int8_t *__restrict__ pA,
+                              const int8_t *__restrict__ pSrcB,
+                              uint32_t N,
+                              uint32_t O,
+                              const int32_t *__restrict__ pMult,
+                              const int32_t *__restrict__ pBias,
+                              uint32_t shift,
+                              int8_t *__restrict__ pDst) {
+    const int8_t *pA0 = pA;
+    uint32_t n, o;
+
+    for (o = 0; o + 3 < O; o += 4) {
+        int32_t sum00 = 0;
+        int32_t sum01 = 0;
+        int32_t sum02 = 0;
+        int32_t sum03 = 0;
+        for (n = 0; n + 7 < N; n += 8) {
+            v4s w0 = *((v4s *)&pA0[n / 2]);
+            v4s even0 = __SLL4(w0, nibbleShift);
+            v4s odd0 = __AND4(w0, nibbleHigh);
+
+            /* rows n to n + 7 of B in the columns o to o + 3, transposed into the even and the
+               odd rows of every column */
+            v4s b0 = *((v4s *)&pSrcB[n * O + o]);
+            v4s b1 = *((v4s *)&pSrcB[(n + 1) * O + o]);
+            v4s b2 = *((v4s *)&pSrcB[(n + 2) * O + o]);
+            v4s b3 = *((v4s *)&pSrcB[(n + 3) * O + o]);
+            v4s b4 = *((v4s *)&pSrcB[(n + 4) * O + o]);
+            v4s b5 = *((v4s *)&pSrcB[(n + 5) * O + o]);
+            v4s b6 = *((v4s *)&pSrcB[(n + 6) * O + o]);
+            v4s b7 = *((v4s *)&pSrcB[(n + 7) * O + o]);
+            v4s e0 = __builtin_shuffle(b0, b2, (v4s){ 0, 4, 1, 5 });
+            v4s e1 = __builtin_shuffle(b4, b6, (v4s){ 0, 4, 1, 5 });
+            v4s e2 = __builtin_shuffle(b0, b2, (v4s){ 2, 6, 3, 7 });
+            v4s e3 = __builtin_shuffle(b4, b6, (v4s){ 2, 6, 3, 7 });
+            v4s o0 = __builtin_shuffle(b1, b3, (v4s){ 0, 4, 1, 5 });
+            v4s o1 = __builtin_shuffle(b5, b7, (v4s){ 0, 4, 1, 5 });
+            v4s o2 = __builtin_shuffle(b1, b3, (v4s){ 2, 6, 3, 7 });
+            v4s o3 = __builtin_shuffle(b5, b7, (v4s){ 2, 6, 3, 7 });
+            v4s bEven0 = __builtin_shuffle(e0, e1, (v4s){ 0, 1, 4, 5 });
+            v4s bEven1 = __builtin_shuffle(e0, e1, (v4s){ 2, 3, 6, 7 });
+            v4s bEven2 = __builtin_shuffle(e2, e3, (v4s){ 0, 1, 4, 5 });
+            v4s bEven3 = __builtin_shuffle(e2, e3, (v4s){ 2, 3, 6, 7 });
+            v4s bOdd0 = __builtin_shuffle(o0, o1, (v4s){ 0, 1, 4, 5 });
+            v4s bOdd1 = __builtin_shuffle(o0, o1, (v4s){ 2, 3, 6, 7 });
+            v4s bOdd2 = __builtin_shuffle(o2, o3, (v4s){ 0, 1, 4, 5 });
+            v4s bOdd3 = __builtin_shuffle(o2, o3, (v4s){ 2, 3, 6, 7 });
+
+            sum00 = __SUMDOTP4(even0, bEven0, sum00);
+            sum00 = __SUMDOTP4(odd0, bOdd0, sum00);
+            sum01 = __SUMDOTP4(even0, bEven1, sum01);
+            sum01 = __SUMDOTP4(odd0, bOdd1, sum01);
+            sum02 = __SUMDOTP4(even0, bEven2, sum02);
+            sum02 = __SUMDOTP4(odd0, bOdd2, sum02);
+            sum03 = __SUMDOTP4(even0, bEven3, sum03);
+            sum03 = __SUMDOTP4(odd0, bOdd3, sum03);
+        }
+        sum00 = sum00 >> 4;
+        sum01 = sum01 >> 4;
+        sum02 = sum02 >> 4;
+        sum03 = sum03 >> 4;
+
+        /* remaining values of N */
+        for (; n + 1 < N; n += 2) {
+            int32_t a00 = __BITEXTRACT(pA0[n / 2], 4, 0);
+            int32_t a01 = __BITEXTRACT(pA0[n / 2], 4, 4);
+            const int8_t *pB = &pSrcB[n * O + o];
+            sum00 += a00 * pB[0] + a01 * pB[O];
+            sum01 += a00 * pB[1] + a01 * pB[O + 1];
+            sum02 += a00 * pB[2] + a01 * pB[O + 2];
+            sum03 += a00 * pB[3] + a01 * pB[O + 3];
+        }
+        if (n < N) {
+            int32_t a00 = __BITEXTRACT(pA0[n / 2], 4, 0);
+            const int8_t *pB = &pSrcB[n * O + o];
+            sum00 += a00 * pB[0];
+            sum01 += a00 * pB[1];
+            sum02 += a00 * pB[2];
+            sum03 += a00 * pB[3];
+        }
+
+        pDst[o] = requant(sum00, pMult[0], pBias[0], shift);
+        pDst[o + 1] = requant(sum01, pMult[0], pBias[0], shift);
+        pDst[o + 2] = requant(sum02, pMult[0], pBias[0], shift);
+        pDst[o + 3] = requant(sum03, pMult[0], pBias[0], shift);
+    }
+
+    /* remaining columns */
+    for (; o < O; o++) {
+        int32_t sum0 = 0;
+        for (n = 0; n + 1 < N; n += 2) {
+            int32_t b0 = pSrcB[n * O + o];
+            int32_t b1 = pSrcB[(n + 1) * O + o];
+            int32_t w0 = pA0[n / 2];
+            sum0 += __BITEXTRACT(w0, 4, 0) * b0 + __BITEXTRACT(w0, 4, 4) * b1;
+        }
+        if (n < N) {
+            int32_t b0 = pSrcB[n * O + o];
+            sum0 += __BITEXTRACT(pA0[n / 2], 4, 0) * b0;
+        }
+        pDst[o] = requant(sum0, pMult[0], pBias[0], shift);
+    }
+}
+
+/**
+  @brief      Requantized matrix multiplication of 4-bit integer weights and 8-bit integer
+              activations kernel for XPULPV2 extension
+  @param[in]  pSrcA Points to the 4-bit weights A of shape MxN, packed two per byte
+  @param[in]  pSrcB Points to the activations B of shape NxO
+  @param[in]  M     Height of A and C, number of output channels
+  @param[in]  N     Width of A, height of B
+  @param[in]  O     Width of B and C
+  @param[in]  pMult Points to the M multipliers, one per output channel
+  @param[in]  pBias Points to the M biases, added after the multiplication
+  @param[in]  shift Amount to shift the requantized values to the right, at least 1
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Exploiting SIMD instructions
+  Eight 4-bit weights are loaded with one word and unpacked with two SIMD instructions: __SLL4 gives
+  the weights of the even columns, __AND4 the weights of the odd columns, both multiplied by 16. The
+  activations are shuffled into their even and odd values and multiplied with __SUMDOTP4 into 32-bit
+  accumulators, which are divided by 16 at the end. Two rows and four columns of C are computed at
+  once.
+
+  @par Overflow
+  The SIMD accumulators hold 16 times the sum, they can only overflow for N of 131072 or more.
+
+  @par Requantization
+  Every output of the output channel m (row m of A) is requantized to 8 bits:
+  `round((sum * pMult[m] + pBias[m]) / 2^shift)`, saturated. `sum * pMult[m] + pBias[m]`
+  must fit into 32 bits.
+ */
+
+void plp_mat_mult_requant_i4i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                        const int8_t *__restrict__ pSrcB,
+                                        uint32_t M,
+                                        uint32_t N,
+                                        uint32_t O,
+                                        const int32_t *__restrict__ pMult,
+                                        const int32_t *__restrict__ pBias,
+                                        uint32_t shift,
+                                        int8_t *__restrict__ pDstC) {
+
+    uint32_t m;
+
+    /* blocks of 2 rows */
+    for (m = 0; m + 1 < M; m += 2) {
+        mult_rows2(pSrcA + m * ((N + 1) / 2), pSrcB, N, O, pMult + m, pBias + m, shift,
+                   pDstC + m * O);
+    }
+
+    /* remaining rows */
+    for (; m < M; m++) {
+        mult_rows1(pSrcA + m * ((N + 1) / 2), pSrcB, N, O, pMult + m, pBias + m, shift,
+                   pDstC + m * O);
+    }
+}
+
+/**
+  @} end of MatMultMixedKernels group
+ */
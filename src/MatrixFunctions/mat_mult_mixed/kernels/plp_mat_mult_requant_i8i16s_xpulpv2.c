@@ -0,0 +1,294 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_requant_i8i16s_xpulpv2.c
+ * Description:  8-bit x 16-bit requantized matrix multiplication for XPULPV2
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatMultMixed
+ */
+
+/**
+  @addtogroup MatMultMixedKernels
+  @{
+ */
+
+/* per-channel requantization: rounding shift of sum * mult + bias, saturated to 16 bits */
+static inline int16_t requant(int32_t sum,
+                              int32_t mult,
+                              int32_t bias,
+                              uint32_t shift) {
+    return (int16_t)__CLIP(__ROUNDNORM_REG(sum * mult + bias, shift), 15);
+}
+
+/* The 16-bit activations are split into their high byte (signed) and their low byte
+   (unsigned), such that four 8-bit weights are multiplied with one __SUMDOTP4 and one
+   __SUMDOTPUS4, and the sum is high * 256 + low. */
+
+/* 4 rows of C, starting at the row pA of A and the row pDst of C, pMult and pBias point to
+   the factors of the first row */
+static inline void mult_rows4(const int8_t *__restrict__ pA,
+                              const int16_t *__restrict__ pSrcB,
+                              uint32_t N,
+                              uint32_t O,
+                              const int32_t *__restrict__ pMult,
+                              const int32_t *__restrict__ pBias,
+                              uint32_t shift,
+                              int16_t *__restrict__ pDst) {
+    const int8_t *pA0 = pA;
+    const int8_t *pA1 = pA0 + N;
+    const int8_t *pA2 = pA1 + N;
+    const int8_t *pA3 = pA2 + N;
+    uint32_t n, o;
+
+    for (o = 0; o + 1 < O; o += 2) {
+        int32_t high00 = 0;
+        int32_t high01 = 0;
+        int32_t high10 = 0;
+        int32_t high11 = 0;
+        int32_t high20 = 0;
+        int32_t high21 = 0;
+        int32_t high30 = 0;
+        int32_t high31 = 0;
+        int32_t low00 = 0;
+        int32_t low01 = 0;
+        int32_t low10 = 0;
+        int32_t low11 = 0;
+        int32_t low20 = 0;
+        int32_t low21 = 0;
+        int32_t low30 = 0;
+        int32_t low31 = 0;
+        for (n = 0; n + 3 < N; n += 4) {
+            v4s a0 = *((v4s *)&pA0[n]);
+            v4s a1 = *((v4s *)&pA1[n]);
+            v4s a2 = *((v4s *)&pA2[n]);
+            v4s a3 = *((v4s *)&pA3[n]);
+
+            /* rows n to n + 3 of B in the columns o and o + 1, as bytes */
+            v4s b0 = *((v4s *)&pSrcB[n * O + o]);
+            v4s b1 = *((v4s *)&pSrcB[(n + 1) * O + o]);
+            v4s b2 = *((v4s *)&pSrcB[(n + 2) * O + o]);
+            v4s b3 = *((v4s *)&pSrcB[(n + 3) * O + o]);
+            v4s t0 = __builtin_shuffle(b0, b1, (v4s){ 1, 5, 3, 7 });
+            v4s t1 = __builtin_shuffle(b2, b3, (v4s){ 1, 5, 3, 7 });
+            v4s t2 = __builtin_shuffle(b0, b1, (v4s){ 0, 4, 2, 6 });
+            v4s t3 = __builtin_shuffle(b2, b3, (v4s){ 0, 4, 2, 6 });
+            v4s high0 = __builtin_shuffle(t0, t1, (v4s){ 0, 1, 4, 5 });
+            v4s high1 = __builtin_shuffle(t0, t1, (v4s){ 2, 3, 6, 7 });
+            v4u low0 = (v4u)__builtin_shuffle(t2, t3, (v4s){ 0, 1, 4, 5 });
+            v4u low1 = (v4u)__builtin_shuffle(t2, t3, (v4s){ 2, 3, 6, 7 });
+
+            high00 = __SUMDOTP4(a0, high0, high00);
+            low00 = __SUMDOTPUS4(low0, a0, low00);
+            high01 = __SUMDOTP4(a0, high1, high01);
+            low01 = __SUMDOTPUS4(low1, a0, low01);
+            high10 = __SUMDOTP4(a1, high0, high10);
+            low10 = __SUMDOTPUS4(low0, a1, low10);
+            high11 = __SUMDOTP4(a1, high1, high11);
+            low11 = __SUMDOTPUS4(low1, a1, low11);
+            high20 = __SUMDOTP4(a2, high0, high20);
+            low20 = __SUMDOTPUS4(low0, a2, low20);
+            high21 = __SUMDOTP4(a2, high1, high21);
+            low21 = __SUMDOTPUS4(low1, a2, low21);
+            high30 = __SUMDOTP4(a3, high0, high30);
+            low30 = __SUMDOTPUS4(low0, a3, low30);
+            high31 = __SUMDOTP4(a3, high1, high31);
+            low31 = __SUMDOTPUS4(low1, a3, low31);
+        }
+
+        int32_t sum00 = high00 * 256 + low00;
+        int32_t sum01 = high01 * 256 + low01;
+        int32_t sum10 = high10 * 256 + low10;
+        int32_t sum11 = high11 * 256 + low11;
+        int32_t sum20 = high20 * 256 + low20;
+        int32_t sum21 = high21 * 256 + low21;
+        int32_t sum30 = high30 * 256 + low30;
+        int32_t sum31 = high31 * 256 + low31;
+
+        /* remaining values of N */
+        for (; n < N; n++) {
+            int32_t b0 = pSrcB[n * O + o];
+            int32_t b1 = pSrcB[n * O + o + 1];
+            sum00 += pA0[n] * b0;
+            sum01 += pA0[n] * b1;
+            sum10 += pA1[n] * b0;
+            sum11 += pA1[n] * b1;
+            sum20 += pA2[n] * b0;
+            sum21 += pA2[n] * b1;
+            sum30 += pA3[n] * b0;
+            sum31 += pA3[n] * b1;
+        }
+
+        pDst[o] = requant(sum00, pMult[0], pBias[0], shift);
+        pDst[o + 1] = requant(sum01, pMult[0], pBias[0], shift);
+        pDst[O + o] = requant(sum10, pMult[1], pBias[1], shift);
+        pDst[O + o + 1] = requant(sum11, pMult[1], pBias[1], shift);
+        pDst[2 * O + o] = requant(sum20, pMult[2], pBias[2], shift);
+        pDst[2 * O + o + 1] = requant(sum21, pMult[2], pBias[2], shift);
+        pDst[3 * O + o] = requant(sum30, pMult[3], pBias[3], shift);
+        pDst[3 * O + o + 1] = requant(sum31, pMult[3], pBias[3], shift);
+    }
+
+    /* remaining column */
+    for (; o < O; o++) {
+        int32_t sum0 = 0;
+        int32_t sum1 = 0;
+        int32_t sum2 = 0;
+        int32_t sum3 = 0;
+        for (n = 0; n < N; n++) {
+            int32_t b = pSrcB[n * O + o];
+            sum0 += pA0[n] * b;
+            sum1 += pA1[n] * b;
+            sum2 += pA2[n] * b;
+            sum3 += pA3[n] * b;
+        }
+        pDst[o] = requant(sum0, pMult[0], pBias[0], shift);
+        pDst[O + o] = requant(sum1, pMult[1], pBias[1], shift);
+        pDst[2 * O + o] = requant(sum2, pMult[2], pBias[2], shift);
+        pDst[3 * O + o] = requant(sum3, pMult[3], pBias[3], shift);
+    }
+}
+
+/* one row of C, starting at the row pA of A and the row pDst of C, pMult and pBias point to
+   the factors of the first row */
+static inline void mult_rows1(const int8_t *__restrict__ pA,
+                              const int16_t *__restrict__ pSrcB,
+                              uint32_t N,
+                              uint32_t O,
+                              const int32_t *__restrict__ pMult,
+                              const int32_t *__restrict__ pBias,
+                              uint32_t shift,
+                              int16_t *__restrict__ pDst) {
+    const int8_t *pA0 = pA;
+    uint32_t n, o;
+
+    for (o = 0; o + 1 < O; o += 2) {
+        int32_t high00 = 0;
+        int32_t high01 = 0;
+        int32_t low00 = 0;
+        int32_t low01 = 0;
+        for (n = 0; n + 3 < N; n += 4) {
+            v4s a0 = *((v4s *)&pA0[n]);
+
+            /* rows n to n + 3 of B in the columns o and o + 1, as bytes */
+            v4s b0 = *((v4s *)&pSrcB[n * O + o]);
+            v4s b1 = *((v4s *)&pSrcB[(n + 1) * O + o]);
+            v4s b2 = *((v4s *)&pSrcB[(n + 2) * O + o]);
+            v4s b3 = *((v4s *)&pSrcB[(n + 3) * O + o]);
+            v4s t0 = __builtin_shuffle(b0, b1, (v4s){ 1, 5, 3, 7 });
+            v4s t1 = __builtin_shuffle(b2, b3, (v4s){ 1, 5, 3, 7 });
+            v4s t2 = __builtin_shuffle(b0, b1, (v4s){ 0, 4, 2, 6 });
+            v4s t3 = __builtin_shuffle(b2, b3, (v4s){ 0, 4, 2, 6 });
+            v4s high0 = __builtin_shuffle(t0, t1, (v4s){ 0, 1, 4, 5 });
+            v4s high1 = __builtin_shuffle(t0, t1, (v4s){ 2, 3, 6, 7 });
+            v4u low0 = (v4u)__builtin_shuffle(t2, t3, (v4s){ 0, 1, 4, 5 });
+            v4u low1 = (v4u)__builtin_shuffle(t2, t3, (v4s){ 2, 3, 6, 7 });
+
+            high00 = __SUMDOTP4(a0, high0, high00);
+            low00 = __SUMDOTPUS4(low0, a0, low00);
+            high01 = __SUMDOTP4(a0, high1, high01);
+            low01 = __SUMDOTPUS4(low1, a0, low01);
+        }
+
+        int32_t sum00 = high00 * 256 + low00;
+        int32_t sum01 = high01 * 256 + low01;
+
+        /* remaining values of N */
+        for (; n < N; n++) {
+            int32_t b0 = pSrcB[n * O + o];
+            int32_t b1 = pSrcB[n * O + o + 1];
+            sum00 += pA0[n] * b0;
+            sum01 += pA0[n] * b1;
+        }
+
+        pDst[o] = requant(sum00, pMult[0], pBias[0], shift);
+        pDst[o + 1] = requant(sum01, pMult[0], pBias[0], shift);
+    }
+
+    /* remaining column */
+    for (; o < O; o++) {
+        int32_t sum0 = 0;
+        for (n = 0; n < N; n++) {
+            int32_t b = pSrcB[n * O + o];
+            sum0 += pA0[n] * b;
+        }
+        pDst[o] = requant(sum0, pMult[0], pBias[0], shift);
+    }
+}
+
+/**
+  @brief      Requantized matrix multiplication of 8-bit integer weights and 16-bit integer
+              activations kernel for XPULPV2 extension
+  @param[in]  pSrcA Points to the weights A of shape MxN
+  @param[in]  pSrcB Points to the activations B of shape NxO
+  @param[in]  M     Height of A and C, number of output channels
+  @param[in]  N     Width of A, height of B
+  @param[in]  O     Width of B and C
+  @param[in]  pMult Points to the M multipliers, one per output channel
+  @param[in]  pBias Points to the M biases, added after the multiplication
+  @param[in]  shift Amount to shift the requantized values to the right, at least 1
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 16-bit activations are split with shuffles into their high bytes and their low bytes. Four
+  8-bit weights are then multiplied with one __SUMDOTP4 (high bytes) and one __SUMDOTPUS4 (low
+  bytes, unsigned) into 32-bit accumulators, without widening the weights. Four rows and two columns
+  of C are computed at once.
+
+  @par Requantization
+  Every output of the output channel m (row m of A) is requantized to 16 bits:
+  `round((sum * pMult[m] + pBias[m]) / 2^shift)`, saturated. `sum * pMult[m] + pBias[m]`
+  must fit into 32 bits.
+ */
+
+void plp_mat_mult_requant_i8i16s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                         const int16_t *__restrict__ pSrcB,
+                                         uint32_t M,
+                                         uint32_t N,
+                                         uint32_t O,
+                                         const int32_t *__restrict__ pMult,
+                                         const int32_t *__restrict__ pBias,
+                                         uint32_t shift,
+                                         int16_t *__restrict__ pDstC) {
+
+    uint32_t m;
+
+    /* blocks of 4 rows */
+    for (m = 0; m + 3 < M; m += 4) {
+        mult_rows4(pSrcA + m * N, pSrcB, N, O, pMult + m, pBias + m, shift, pDstC + m * O);
+    }
+
+    /* remaining rows */
+    for (; m < M; m++) {
+        mult_rows1(pSrcA + m * N, pSrcB, N, O, pMult + m, pBias + m, shift, pDstC + m * O);
+    }
+}
+
+/**
+  @} end of MatMultMixedKernels group
+ */
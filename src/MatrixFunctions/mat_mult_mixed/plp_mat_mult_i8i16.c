@@ -0,0 +1,115 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_i8i16.c
+ * Description:  8-bit x 16-bit integer matrix multiplication glue code
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatMultMixed Mixed-Precision Matrix Multiplication
+  This module contains the glue code for matrix-matrix and matrix-vector products of quantized
+  weights A with activations of a wider type, without widening the weights in memory. The kernel
+  codes (kernels) are in the Module @ref MatMultMixedKernels.
+
+  - i8i16: 8-bit weights, 16-bit activations
+  - i4i8: 4-bit weights, packed two per byte, 8-bit activations
+
+  The products are accumulated with 32 bits. plp_mat_mult and plp_mat_vec store the 32-bit sums.
+  plp_mat_mult_requant and plp_mat_vec_requant requantize every output channel m (row m of A) to the
+  type of the activations:
+
+      C[m, o] = clip(round((sum_n A[m, n] * B[n, o] * pMult[m] + pBias[m]) / 2^shift))
+
+  The 4-bit weights are packed row by row, two per byte, the first one in the low nibble. Every row
+  starts with a new byte:
+
+      A[m, n] = pSrcA[m * ((N + 1) / 2) + n / 2], low nibble for even n, high for odd n
+
+  Memory of the weights of a 256x256 layer, and multiply-accumulates per instruction in the inner
+  loops (loads, shuffles, unpacking and dot products), against widening weights and activations to
+  16 bits:
+
+  weights             | bytes  | of i16 | MAC/instr GEMM | MAC/instr GEMV
+  ------------------- | ------ | ------ | -------------- | --------------
+  i16 (widened)       | 131072 | 100 %  | 1.00           | 0.89
+  i8, i16 activations | 65536  | 50 %   | 1.00           | 1.00
+  i4, i8 activations  | 32768  | 25 %   | 1.39           | 1.33
+
+  The widened GEMM is plp_mat_mult_i16 (four rows, two columns), the widened GEMV is a 16-bit dot
+  product over four rows. The i4i8 versions also halve the memory of the activations.
+
+  The naming scheme of the functions follows the following pattern (for example
+  `plp_mat_mult_i8i16`):
+
+      plp_<function name>_<weight type><activation type>[_parallel]
+
+  name          | description
+  ------------- | ---------------------------------------------------------------
+  function_name | {`mat_mult`, `mat_mult_requant`, `mat_vec`, `mat_vec_requant`}
+  weight type   | {i8, i4} 8-bit or 4-bit integers
+  activ. type   | {i16, i8} 16-bit or 8-bit integers
+ */
+
+/**
+  @addtogroup MatMultMixed
+  @{
+ */
+
+/**
+  @brief      Glue code for matrix multiplication of 8-bit integer weights and 16-bit integer
+              activations
+  @param[in]  pSrcA Points to the weights A of shape MxN
+  @param[in]  pSrcB Points to the activations B of shape NxO
+  @param[in]  M     Height of A and C, number of output channels
+  @param[in]  N     Width of A, height of B
+  @param[in]  O     Width of B and C
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+ */
+
+void plp_mat_mult_i8i16(const int8_t *__restrict__ pSrcA,
+                        const int16_t *__restrict__ pSrcB,
+                        uint32_t M,
+                        uint32_t N,
+                        uint32_t O,
+                        int32_t *__restrict__ pDstC) {
+
+    PLP_PROFILE_FUNC();
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_mat_mult_i8i16s_rv32im(pSrcA, pSrcB, M, N, O, pDstC);
+    } else {
+        plp_mat_mult_i8i16s_xpulpv2(pSrcA, pSrcB, M, N, O, pDstC);
+    }
+}
+
+/**
+  @} end of MatMultMixed group
+ */
@@ -0,0 +1,140 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_sym_q16p_xpulpv2.c
+ * Description:  parallel 16-bit fix-point symmetric matrix multiplication for XPULPV2
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatMultStruct
+ */
+
+/**
+  @addtogroup MatMultStructKernels
+  @{
+ */
+
+/* row i of C. A[i, j] is read from row i of the packed lower triangle for j <= i, and from column i
+   for j > i. Going down column i, the index grows by j + 1. */
+static inline void sym_row(const int16_t *__restrict__ pSrcA,
+                           const int16_t *__restrict__ pSrcB,
+                           uint32_t N,
+                           uint32_t O,
+                           uint32_t i,
+                           uint32_t shift,
+                           int16_t *__restrict__ pDst) {
+    uint32_t first = i * (i + 1) / 2; // index of A[i, 0]
+    uint32_t j, k, o;
+
+    /* blocks of four columns */
+    for (o = 0; o + 3 < O; o += 4) {
+        const int16_t *pB = pSrcB + o;
+        int32_t sum0 = 0;
+        int32_t sum1 = 0;
+        int32_t sum2 = 0;
+        int32_t sum3 = 0;
+        for (j = 0, k = first; j <= i; j++, k++) {
+            int32_t a = (int32_t)pSrcA[k];
+            sum0 += __ROUNDNORM_REG(a * pB[0], shift);
+            sum1 += __ROUNDNORM_REG(a * pB[1], shift);
+            sum2 += __ROUNDNORM_REG(a * pB[2], shift);
+            sum3 += __ROUNDNORM_REG(a * pB[3], shift);
+            pB += O;
+        }
+        for (k = first + 2 * i + 1; j < N; j++) {
+            int32_t a = (int32_t)pSrcA[k];
+            sum0 += __ROUNDNORM_REG(a * pB[0], shift);
+            sum1 += __ROUNDNORM_REG(a * pB[1], shift);
+            sum2 += __ROUNDNORM_REG(a * pB[2], shift);
+            sum3 += __ROUNDNORM_REG(a * pB[3], shift);
+            pB += O;
+            k += j + 1;
+        }
+        pDst[o + 0] = (int16_t)sum0;
+        pDst[o + 1] = (int16_t)sum1;
+        pDst[o + 2] = (int16_t)sum2;
+        pDst[o + 3] = (int16_t)sum3;
+    }
+
+    /* remaining columns */
+    for (; o < O; o++) {
+        int32_t sum = 0;
+        for (j = 0, k = first; j <= i; j++, k++) {
+            sum += __ROUNDNORM_REG((int32_t)pSrcA[k] * pSrcB[j * O + o], shift);
+        }
+        for (k = first + 2 * i + 1; j < N; j++) {
+            sum += __ROUNDNORM_REG((int32_t)pSrcA[k] * pSrcB[j * O + o], shift);
+            k += j + 1;
+        }
+        pDst[o] = (int16_t)sum;
+    }
+}
+
+/**
+  @brief      Parallel symmetric matrix multiplication of 16-bit fix-point numbers kernel for
+              XPULPV2 extension
+  @param[in]  args  pointer to plp_mat_mult_sym_instance_q16 struct initialized by
+                    plp_mat_mult_sym_q16_parallel
+  @return     none
+
+  @par Blocking
+  Four columns of C are computed at once, such that every value of A is loaded once for
+  four multiply-accumulates.
+
+  @par Parallelization
+  Every core computes every nPE-th row.
+
+  @par Fix-Point and Shifting
+  Every product is shifted by `shift` to the right with rounding and the sum is stored
+  with 16 bits, exactly like in plp_mat_mult_q16. If A is represented as `pSrcA * 2^-x`
+  and B as `pSrcB * 2^-y`, C is represented as `pDstC * 2^-(x + y - shift)`. Set `shift`
+  such that no overflow occurs.
+ */
+
+void plp_mat_mult_sym_q16p_xpulpv2(void *args) {
+
+    int core_id = rt_core_id();
+
+    plp_mat_mult_sym_instance_q16 *a = (plp_mat_mult_sym_instance_q16 *)args;
+
+    const int16_t *__restrict__ pSrcA = a->pSrcA;
+    const int16_t *__restrict__ pSrcB = a->pSrcB;
+    uint32_t N = a->N;
+    uint32_t O = a->O;
+    uint32_t shift = a->shift;
+    uint32_t nPE = a->nPE;
+    int16_t *__restrict__ pDstC = a->pDstC;
+
+    uint32_t i;
+
+    for (i = core_id; i < N; i += nPE) {
+        sym_row(pSrcA, pSrcB, N, O, i, shift, pDstC + i * O);
+    }
+}
+
+/**
+  @} end of MatMultStructKernels group
+ */
@@ -0,0 +1,120 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_sym_f32.c
+ * Description:  32-bit floating-point symmetric matrix multiplication glue code
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatMultStruct Structured Matrix Multiplication
+  This module contains the glue code for products with structured matrices, which store and read
+  only the values that define the matrix instead of calling plp_mat_mult on a full copy. The kernel
+  codes (kernels) are in the Module @ref MatMultStructKernels.
+
+  - plp_mat_mult_sym: `C = A * B` with a symmetric matrix A (e.g. a covariance matrix).
+    Only the lower triangle of A is stored, packed row by row. A[i, j] with j > i is read
+    from column i of the lower triangle.
+  - plp_mat_mult_tri: `C = A * B` with a lower or upper triangular matrix A (e.g. a
+    Cholesky or QR factor), packed row by row. Only the triangle is multiplied, which
+    halves the multiply-accumulates.
+  - plp_mat_solve_tri: solves `A * X = B` by forward (lower) or backward (upper)
+    substitution, with A packed like in plp_mat_mult_tri.
+  - plp_mat_vec_toeplitz: `y = T * x` with a Toeplitz matrix T (e.g. an autocorrelation
+    matrix), which is constant along its diagonals and stored with its M + N - 1 values.
+  - plp_mat_mult_diag: `C = diag(pDiagRow) * A * B * diag(pDiagCol)`, the row and the
+    column scaling are applied to the accumulators, without a scaled copy of A or B and
+    without a second pass over C.
+
+  The packed layouts of an NxN matrix:
+
+      lower triangle: A[i, j] = pSrcA[i * (i + 1) / 2 + j]              for j <= i
+      upper triangle: A[i, j] = pSrcA[i * (2 * N - i + 1) / 2 + j - i]  for j >= i
+      Toeplitz:       T[m, n] = pSrcT[m - n + N - 1]
+
+  Memory of the structured operand for N = 64 (M = N for Toeplitz):
+
+  matrix                 | values     | f32 bytes | q16 bytes | of dense
+  ---------------------- | ---------- | --------- | --------- | --------
+  dense (plp_mat_mult)   | N * N      | 16384     | 8192      | 100 %
+  symmetric / triangular | N(N + 1)/2 | 8320      | 4160      | 50.8 %
+  Toeplitz               | 2N - 1     | 508       | 254       | 3.1 %
+  diagonal scaling       | N          | 256       | 128       | 1.6 %
+
+  The 16-bit fix-point versions round every product like plp_mat_mult_q16, so they give the same
+  result as the dense product. There is no fix-point triangular solve, since it needs a division per
+  value.
+
+  The naming scheme of the functions follows the following pattern (for example
+  `plp_mat_mult_sym_f32`):
+
+      plp_<function name>_<data type><precision>[_parallel]
+
+  name          | description
+  ------------- | ---------------------------------------------------------------
+  function_name | {`mat_mult_sym`, `mat_mult_tri`, `mat_solve_tri`, `mat_vec_toeplitz`,
+                | `mat_mult_diag`}
+  data type     | {f, q} respectively for floats, fix-point numbers
+  precision     | {32, 16} bits
+ */
+
+/**
+  @addtogroup MatMultStruct
+  @{
+ */
+
+/**
+  @brief      Glue code for symmetric matrix multiplication of 32-bit floats
+  @param[in]  pSrcA Points to the lower triangle of the symmetric NxN matrix A, packed row by row
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  N     Height and width of A, height of B
+  @param[in]  O     Width of B and C
+  @param[out] pDstC Points to the output matrix of shape NxO
+  @return     none
+ */
+
+void plp_mat_mult_sym_f32(const float *__restrict__ pSrcA,
+                          const float *__restrict__ pSrcB,
+                          uint32_t N,
+                          uint32_t O,
+                          float *__restrict__ pDstC) {
+
+    PLP_PROFILE_FUNC();
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return;
+    } else {
+        plp_mat_mult_sym_f32s_xpulpv2(pSrcA, pSrcB, N, O, pDstC);
+    }
+}
+
+/**
+  @} end of MatMultStruct group
+ */
@@ -59,6 +59,8 @@ void plp_mat_mult_trans_i8_parallel(const int8_t *__restrict__ pSrcA,
                                     uint32_t nPE,
                                     int32_t *__restrict__ pDstC) {
 
+    PLP_PROFILE_FUNC();
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         printf("parallel processing supported only for cluster side\n");
         return;
@@ -70,6 +70,8 @@ void plp_mat_mult_trans_q16_parallel(const int16_t *__restrict__ pSrcA,
                                      uint32_t nPE,
                                      int16_t *__restrict__ pDstC) {
 
+    PLP_PROFILE_FUNC();
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         printf("parallel processing supported only for cluster side\n");
         return;
@@ -45,48 +45,28 @@
   @param[in]  args  pointer to plp_mat_mat_mult_trans_cmplx_instance_f32 struct initialized by
                     plp_mat_mult_trans_cmplx_f32_parallel
   @return     none
+
+  @par Blocking
+  Uses the kernel plp_mat_mult_trans_cmplx_stride_f32p_xpulpv2, which computes blocks of 2x2 output
+  elements.
 */
 
 void plp_mat_mult_trans_cmplx_f32p_xpulpv2(void *args) {
 
-    int core_id = rt_core_id();
-
     plp_mat_mult_cmplx_instance_f32 *a = (plp_mat_mult_cmplx_instance_f32 *)args;
 
-    const float *__restrict__ pSrcA = a->pSrcA;
-    const float *__restrict__ pSrcB = a->pSrcB;
-    uint32_t M = a->M;
-    uint32_t N = a->N;
-    uint32_t O = a->O;
-    uint32_t nPE = a->nPE;
-    float *__restrict__ pDstC = a->pDstC;
-
-#define BASIC_VERSION // if used don't forget to also use the undefine at end of file
-#ifdef BASIC_VERSION
-
-    for (int m = core_id; m < M; m += nPE) {
-        for (int o = 0; o < O; o++) {
-            float sum_re = 0;
-            float sum_im = 0;
-            for (int n = 0; n < N; n++) {
-                float a_re = (float)pSrcA[(m * N + n) * 2 + 0];
-                float a_im = (float)pSrcA[(m * N + n) * 2 + 1];
-                float b_re = (float)pSrcB[(o * N + n) * 2 + 0];
-                float b_im = (float)pSrcB[(o * N + n) * 2 + 1];
-                sum_re += a_re * b_re - a_im * b_im;
-                sum_im += a_re * b_im + a_im * b_re;
-            }
-            pDstC[(m * O + o) * 2 + 0] = sum_re;
-            pDstC[(m * O + o) * 2 + 1] = sum_im;
-        }
-    }
-
-#else
-
-    // TODO: Hackathon
+    plp_mat_mult_cmplx_stride_instance_f32 strideArgs = { .pSrcA = a->pSrcA,
+                                                          .pSrcB = a->pSrcB,
+                                                          .M = a->M,
+                                                          .N = a->N,
+                                                          .O = a->O,
+                                                          .strideA = a->N,
+                                                          .strideB = a->N,
+                                                          .strideC = a->O,
+                                                          .nPE = a->nPE,
+                                                          .pDstC = a->pDstC };
 
-#endif
-#undef BASIC_VERSION
+    plp_mat_mult_trans_cmplx_stride_f32p_xpulpv2((void *)&strideArgs);
 }
 
 /**
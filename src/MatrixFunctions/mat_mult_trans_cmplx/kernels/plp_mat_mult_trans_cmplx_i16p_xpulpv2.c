@@ -45,51 +45,27 @@
                     plp_mat_mult_trans_cmplx_i16_parallel
   @return     none
 
-  @par Exploiting SIMD instructions
-  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+  @par Blocking
+  Uses the kernel plp_mat_mult_trans_cmplx_stride_i16p_xpulpv2, which computes blocks of 2x2 output
+  elements.
 */
 
 void plp_mat_mult_trans_cmplx_i16p_xpulpv2(void *args) {
 
-    int core_id = rt_core_id();
-
     plp_mat_mult_cmplx_instance_i16 *a = (plp_mat_mult_cmplx_instance_i16 *)args;
 
-    const int16_t *__restrict__ pSrcA = a->pSrcA;
-    const int16_t *__restrict__ pSrcB = a->pSrcB;
-    uint32_t M = a->M;
-    uint32_t N = a->N;
-    uint32_t O = a->O;
-    uint32_t nPE = a->nPE;
-    int32_t *__restrict__ pDstC = a->pDstC;
-
-#define BASIC_VERSION // if used don't forget to also use the undefine at end of file
-#ifdef BASIC_VERSION
-
-    for (int m = core_id; m < M; m += nPE) {
-        for (int o = 0; o < O; o++) {
-            int32_t sum_re = 0;
-            int32_t sum_im = 0;
-            for (int n = 0; n < N; n++) {
-                int32_t a_re = (int32_t)pSrcA[(m * N + n) * 2 + 0];
-                int32_t a_im = (int32_t)pSrcA[(m * N + n) * 2 + 1];
-                int32_t b_re = (int32_t)pSrcB[(o * N + n) * 2 + 0];
-                int32_t b_im = (int32_t)pSrcB[(o * N + n) * 2 + 1];
-                sum_re += a_re * b_re - a_im * b_im;
-                sum_im += a_re * b_im + a_im * b_re;
-            }
-            pDstC[(m * O + o) * 2 + 0] = sum_re;
-            pDstC[(m * O + o) * 2 + 1] = sum_im;
-        }
-    }
-
-#else
-
-    // TODO: Hackathon
+    plp_mat_mult_cmplx_stride_instance_i16 strideArgs = { .pSrcA = a->pSrcA,
+                                                          .pSrcB = a->pSrcB,
+                                                          .M = a->M,
+                                                          .N = a->N,
+                                                          .O = a->O,
+                                                          .strideA = a->N,
+                                                          .strideB = a->N,
+                                                          .strideC = a->O,
+                                                          .nPE = a->nPE,
+                                                          .pDstC = a->pDstC };
 
-#endif
-#undef BASIC_VERSION
+    plp_mat_mult_trans_cmplx_stride_i16p_xpulpv2((void *)&strideArgs);
 }
 
 /**
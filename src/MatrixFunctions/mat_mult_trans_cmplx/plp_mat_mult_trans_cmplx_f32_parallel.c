@@ -60,6 +60,8 @@ void plp_mat_mult_trans_cmplx_f32_parallel(const float *__restrict__ pSrcA,
                                            uint32_t nPE,
                                            float *__restrict__ pDstC) {
 
+    PLP_PROFILE_FUNC();
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         printf("parallel and floating-point processing supported only for cluster side\n");
         return;
@@ -93,6 +93,8 @@ void plp_mat_mult_trans_cmplx_i16(const int16_t *__restrict__ pSrcA,
                                   uint32_t O,
                                   int32_t *__restrict__ pDstC) {
 
+    PLP_PROFILE_FUNC();
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         plp_mat_mult_trans_cmplx_i16s_rv32im(pSrcA, pSrcB, M, N, O, pDstC);
     } else {
@@ -0,0 +1,147 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_trans_conj_cmplx_f32p_xpulpv2.c
+ * Description:  parallel 32-bit floating-point complex matrix conjugate transpose matrix
+ * multiplication for XPULPV2
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatMultTransConjCmplx
+ */
+
+/**
+  @addtogroup MatMultTransConjCmplxKernels
+  @{
+ */
+
+static inline void dot_prod_1x1(const float *pA, const float *pB, uint32_t N, uint32_t incB,
+                                float *pC) {
+    float re = 0;
+    float im = 0;
+    for (uint32_t n = 0; n < N; n++) {
+        re += pA[0] * pB[0] + pA[1] * pB[1];
+        im += pA[1] * pB[0] - pA[0] * pB[1];
+        pA += 2;
+        pB += incB * 2;
+    }
+    pC[0] = re;
+    pC[1] = im;
+}
+
+/**
+  @brief      Parallel matrix conjugate transpose matrix multiplication for complex 32-bit floats on
+              XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_f32 struct initialized by
+                    plp_mat_mult_trans_conj_cmplx_f32_parallel
+  @return     none
+
+  @par Blocking
+  The kernel computes blocks of 2x2 output elements, such that every loaded complex value is used
+  twice. This halves the loads per complex multiply-accumulate.
+
+  @par Parallelization
+  Every core computes every nPE-th block of two rows. The columns of a remaining odd row are split
+  over the cores.
+ */
+
+void plp_mat_mult_trans_conj_cmplx_f32p_xpulpv2(void *args) {
+
+    int core_id = rt_core_id();
+
+    plp_mat_mult_cmplx_instance_f32 *a = (plp_mat_mult_cmplx_instance_f32 *)args;
+
+    const float *__restrict__ pSrcA = a->pSrcA;
+    const float *__restrict__ pSrcB = a->pSrcB;
+    uint32_t M = a->M;
+    uint32_t N = a->N;
+    uint32_t O = a->O;
+    uint32_t nPE = a->nPE;
+    float *__restrict__ pDstC = a->pDstC;
+
+    uint32_t m, n, o;
+
+    /* every nPE-th block of two rows */
+    for (m = core_id * 2; m + 1 < M; m += nPE * 2) {
+        const float *pA0 = pSrcA + m * N * 2;
+        const float *pA1 = pA0 + N * 2;
+        float *pC0 = pDstC + m * O * 2;
+        float *pC1 = pC0 + O * 2;
+        /* blocks of two columns */
+        for (o = 0; o + 1 < O; o += 2) {
+            const float *pB0 = pSrcB + o * N * 2;
+            const float *pB1 = pB0 + N * 2;
+            float re00 = 0;
+            float im00 = 0;
+            float re01 = 0;
+            float im01 = 0;
+            float re10 = 0;
+            float im10 = 0;
+            float re11 = 0;
+            float im11 = 0;
+            for (n = 0; n < N; n++) {
+                const float *pX0 = pA0 + n * 2;
+                const float *pX1 = pA1 + n * 2;
+                const float *pY0 = pB0 + n * 2;
+                const float *pY1 = pB1 + n * 2;
+                re00 += pX0[0] * pY0[0] + pX0[1] * pY0[1];
+                im00 += pX0[1] * pY0[0] - pX0[0] * pY0[1];
+                re01 += pX0[0] * pY1[0] + pX0[1] * pY1[1];
+                im01 += pX0[1] * pY1[0] - pX0[0] * pY1[1];
+                re10 += pX1[0] * pY0[0] + pX1[1] * pY0[1];
+                im10 += pX1[1] * pY0[0] - pX1[0] * pY0[1];
+                re11 += pX1[0] * pY1[0] + pX1[1] * pY1[1];
+                im11 += pX1[1] * pY1[0] - pX1[0] * pY1[1];
+            }
+            pC0[o * 2 + 0] = re00;
+            pC0[o * 2 + 1] = im00;
+            pC0[(o + 1) * 2 + 0] = re01;
+            pC0[(o + 1) * 2 + 1] = im01;
+            pC1[o * 2 + 0] = re10;
+            pC1[o * 2 + 1] = im10;
+            pC1[(o + 1) * 2 + 0] = re11;
+            pC1[(o + 1) * 2 + 1] = im11;
+        }
+        /* remaining column */
+        if (o < O) {
+            dot_prod_1x1(pA0, pSrcB + o * N * 2, N, 1, pC0 + o * 2);
+            dot_prod_1x1(pA1, pSrcB + o * N * 2, N, 1, pC1 + o * 2);
+        }
+    }
+
+    /* remaining row */
+    if (M & 1U) {
+        const float *pA0 = pSrcA + (M - 1) * N * 2;
+        float *pC0 = pDstC + (M - 1) * O * 2;
+        for (o = core_id; o < O; o += nPE) {
+            dot_prod_1x1(pA0, pSrcB + o * N * 2, N, 1, pC0 + o * 2);
+        }
+    }
+}
+
+/**
+   @} end of MatMultTransConjCmplxKernels group
+*/
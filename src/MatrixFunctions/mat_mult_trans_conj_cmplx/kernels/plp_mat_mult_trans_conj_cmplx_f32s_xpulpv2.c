@@ -0,0 +1,139 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_trans_conj_cmplx_f32s_xpulpv2.c
+ * Description:  32-bit floating-point complex matrix conjugate transpose matrix multiplication for
+ * XPULPV2
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatMultTransConjCmplx
+ */
+
+/**
+  @addtogroup MatMultTransConjCmplxKernels
+  @{
+ */
+
+static inline void dot_prod_1x1(const float *pA, const float *pB, uint32_t N, uint32_t incB,
+                                float *pC) {
+    float re = 0;
+    float im = 0;
+    for (uint32_t n = 0; n < N; n++) {
+        re += pA[0] * pB[0] + pA[1] * pB[1];
+        im += pA[1] * pB[0] - pA[0] * pB[1];
+        pA += 2;
+        pB += incB * 2;
+    }
+    pC[0] = re;
+    pC[1] = im;
+}
+
+/**
+  @brief      Matrix conjugate transpose matrix multiplication for complex 32-bit floats on XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Blocking
+  The kernel computes blocks of 2x2 output elements, such that every loaded complex value is used
+  twice. This halves the loads per complex multiply-accumulate.
+ */
+
+void plp_mat_mult_trans_conj_cmplx_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                                                const float *__restrict__ pSrcB,
+                                                uint32_t M,
+                                                uint32_t N,
+                                                uint32_t O,
+                                                float *__restrict__ pDstC) {
+
+    uint32_t m, n, o;
+
+    /* blocks of two rows */
+    for (m = 0; m + 1 < M; m += 2) {
+        const float *pA0 = pSrcA + m * N * 2;
+        const float *pA1 = pA0 + N * 2;
+        float *pC0 = pDstC + m * O * 2;
+        float *pC1 = pC0 + O * 2;
+        /* blocks of two columns */
+        for (o = 0; o + 1 < O; o += 2) {
+            const float *pB0 = pSrcB + o * N * 2;
+            const float *pB1 = pB0 + N * 2;
+            float re00 = 0;
+            float im00 = 0;
+            float re01 = 0;
+            float im01 = 0;
+            float re10 = 0;
+            float im10 = 0;
+            float re11 = 0;
+            float im11 = 0;
+            for (n = 0; n < N; n++) {
+                const float *pX0 = pA0 + n * 2;
+                const float *pX1 = pA1 + n * 2;
+                const float *pY0 = pB0 + n * 2;
+                const float *pY1 = pB1 + n * 2;
+                re00 += pX0[0] * pY0[0] + pX0[1] * pY0[1];
+                im00 += pX0[1] * pY0[0] - pX0[0] * pY0[1];
+                re01 += pX0[0] * pY1[0] + pX0[1] * pY1[1];
+                im01 += pX0[1] * pY1[0] - pX0[0] * pY1[1];
+                re10 += pX1[0] * pY0[0] + pX1[1] * pY0[1];
+                im10 += pX1[1] * pY0[0] - pX1[0] * pY0[1];
+                re11 += pX1[0] * pY1[0] + pX1[1] * pY1[1];
+                im11 += pX1[1] * pY1[0] - pX1[0] * pY1[1];
+            }
+            pC0[o * 2 + 0] = re00;
+            pC0[o * 2 + 1] = im00;
+            pC0[(o + 1) * 2 + 0] = re01;
+            pC0[(o + 1) * 2 + 1] = im01;
+            pC1[o * 2 + 0] = re10;
+            pC1[o * 2 + 1] = im10;
+            pC1[(o + 1) * 2 + 0] = re11;
+            pC1[(o + 1) * 2 + 1] = im11;
+        }
+        /* remaining column */
+        if (o < O) {
+            dot_prod_1x1(pA0, pSrcB + o * N * 2, N, 1, pC0 + o * 2);
+            dot_prod_1x1(pA1, pSrcB + o * N * 2, N, 1, pC1 + o * 2);
+        }
+    }
+
+    /* remaining row */
+    if (m < M) {
+        const float *pA0 = pSrcA + m * N * 2;
+        float *pC0 = pDstC + m * O * 2;
+        for (o = 0; o < O; o++) {
+            dot_prod_1x1(pA0, pSrcB + o * N * 2, N, 1, pC0 + o * 2);
+        }
+    }
+}
+
+/**
+   @} end of MatMultTransConjCmplxKernels group
+*/
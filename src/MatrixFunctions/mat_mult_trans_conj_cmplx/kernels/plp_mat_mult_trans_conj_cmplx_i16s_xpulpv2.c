@@ -0,0 +1,163 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_trans_conj_cmplx_i16s_xpulpv2.c
+ * Description:  16-bit integer complex matrix conjugate transpose matrix multiplication for XPULPV2
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatMultTransConjCmplx
+ */
+
+/**
+  @addtogroup MatMultTransConjCmplxKernels
+  @{
+ */
+
+#define conjmask                                                                                   \
+    (v2s) { -1, 0 }
+#define swapmask                                                                                   \
+    (v2s) { 1, 0 }
+#define immask                                                                                     \
+    (v2s) { 0, 1 }
+
+static inline void dot_prod_1x1(const v2s *pA, const v2s *pB, uint32_t N, uint32_t incB,
+                                int32_t *pC) {
+    int32_t re = 0;
+    int32_t im = 0;
+    int32_t corr = 0;
+    for (uint32_t n = 0; n < N; n++) {
+        v2s a0 = pA[n];
+        v2s b0 = *pB;
+        v2s a0c = __EXOR2(a0, conjmask);
+        v2s b0s = __builtin_shuffle(b0, swapmask);
+        re = __SUMDOTP2(a0, b0, re);
+        im = __SUMDOTP2(a0c, b0s, im);
+        corr = __SUMDOTP2(b0, immask, corr);
+        pB += incB;
+    }
+    pC[0] = re;
+    pC[1] = im + corr;
+}
+
+/**
+  @brief      Matrix conjugate transpose matrix multiplication for complex 16-bit integers on
+              XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Exploiting SIMD instructions
+  Every complex value is packed into one 32 bit vector {re, im}. The real part of a * conj(b) is the
+  dot product of a and b. For the imaginary part, the real part of a is inverted (~re = -re - 1,
+  which cannot overflow) and the dot product with the swapped b yields the imaginary part minus the
+  imaginary part of b. The imaginary parts of b are accumulated with one more dot product per
+  column. The kernel computes blocks of 2x2 output elements, such that every loaded vector is used
+  twice. The inner loop takes 18 instructions for 4 complex multiply-accumulates.
+ */
+
+void plp_mat_mult_trans_conj_cmplx_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                                const int16_t *__restrict__ pSrcB,
+                                                uint32_t M,
+                                                uint32_t N,
+                                                uint32_t O,
+                                                int32_t *__restrict__ pDstC) {
+
+    uint32_t m, n, o;
+
+    /* blocks of two rows */
+    for (m = 0; m + 1 < M; m += 2) {
+        const v2s *pA0 = (const v2s *)pSrcA + m * N;
+        const v2s *pA1 = pA0 + N;
+        int32_t *pC0 = pDstC + m * O * 2;
+        int32_t *pC1 = pC0 + O * 2;
+        /* blocks of two columns */
+        for (o = 0; o + 1 < O; o += 2) {
+            const v2s *pB0 = (const v2s *)pSrcB + o * N;
+            const v2s *pB1 = pB0 + N;
+            int32_t re00 = 0;
+            int32_t im00 = 0;
+            int32_t re01 = 0;
+            int32_t im01 = 0;
+            int32_t re10 = 0;
+            int32_t im10 = 0;
+            int32_t re11 = 0;
+            int32_t im11 = 0;
+            int32_t corr0 = 0;
+            int32_t corr1 = 0;
+            for (n = 0; n < N; n++) {
+                v2s a0 = pA0[n];
+                v2s a1 = pA1[n];
+                v2s b0 = pB0[n];
+                v2s b1 = pB1[n];
+                v2s a0c = __EXOR2(a0, conjmask);
+                v2s a1c = __EXOR2(a1, conjmask);
+                v2s b0s = __builtin_shuffle(b0, swapmask);
+                v2s b1s = __builtin_shuffle(b1, swapmask);
+                re00 = __SUMDOTP2(a0, b0, re00);
+                im00 = __SUMDOTP2(a0c, b0s, im00);
+                re01 = __SUMDOTP2(a0, b1, re01);
+                im01 = __SUMDOTP2(a0c, b1s, im01);
+                re10 = __SUMDOTP2(a1, b0, re10);
+                im10 = __SUMDOTP2(a1c, b0s, im10);
+                re11 = __SUMDOTP2(a1, b1, re11);
+                im11 = __SUMDOTP2(a1c, b1s, im11);
+                corr0 = __SUMDOTP2(b0, immask, corr0);
+                corr1 = __SUMDOTP2(b1, immask, corr1);
+            }
+            pC0[o * 2 + 0] = re00;
+            pC0[o * 2 + 1] = im00 + corr0;
+            pC0[(o + 1) * 2 + 0] = re01;
+            pC0[(o + 1) * 2 + 1] = im01 + corr1;
+            pC1[o * 2 + 0] = re10;
+            pC1[o * 2 + 1] = im10 + corr0;
+            pC1[(o + 1) * 2 + 0] = re11;
+            pC1[(o + 1) * 2 + 1] = im11 + corr1;
+        }
+        /* remaining column */
+        if (o < O) {
+            dot_prod_1x1(pA0, (const v2s *)pSrcB + o * N, N, 1, pC0 + o * 2);
+            dot_prod_1x1(pA1, (const v2s *)pSrcB + o * N, N, 1, pC1 + o * 2);
+        }
+    }
+
+    /* remaining row */
+    if (m < M) {
+        const v2s *pA0 = (const v2s *)pSrcA + m * N;
+        int32_t *pC0 = pDstC + m * O * 2;
+        for (o = 0; o < O; o++) {
+            dot_prod_1x1(pA0, (const v2s *)pSrcB + o * N, N, 1, pC0 + o * 2);
+        }
+    }
+}
+
+/**
+   @} end of MatMultTransConjCmplxKernels group
+*/
@@ -0,0 +1,184 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_trans_conj_cmplx_i8p_xpulpv2.c
+ * Description:  parallel 8-bit integer complex matrix conjugate transpose matrix multiplication for
+ * XPULPV2
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatMultTransConjCmplx
+ */
+
+/**
+  @addtogroup MatMultTransConjCmplxKernels
+  @{
+ */
+
+#define conjmask                                                                                   \
+    (v4s) { -1, 0, -1, 0 }
+#define swapmask                                                                                   \
+    (v4s) { 1, 0, 3, 2 }
+#define immask                                                                                     \
+    (v4s) { 0, 1, 0, 1 }
+
+static inline void dot_prod_1x1(const int8_t *pA, const int8_t *pB, uint32_t N, uint32_t incB,
+                                int32_t *pC) {
+    int32_t re = 0;
+    int32_t im = 0;
+    for (uint32_t n = 0; n < N; n++) {
+        re += pA[0] * pB[0] + pA[1] * pB[1];
+        im += pA[1] * pB[0] - pA[0] * pB[1];
+        pA += 2;
+        pB += incB * 2;
+    }
+    pC[0] = re;
+    pC[1] = im;
+}
+
+/**
+  @brief      Parallel matrix conjugate transpose matrix multiplication for complex 8-bit integers
+              on XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_i8 struct initialized by
+                    plp_mat_mult_trans_conj_cmplx_i8_parallel
+  @return     none
+
+  @par Exploiting SIMD instructions
+  Two complex values are packed into one 32 bit vector {re0, im0, re1, im1}, such that every dot
+  product accumulates two complex products. The real part of a * conj(b) is the dot product of a and
+  b. For the imaginary part, the real part of a is inverted (~re = -re - 1, which cannot overflow)
+  and the dot product with the swapped b yields the imaginary part minus the imaginary part of b.
+  The imaginary parts of b are accumulated with one more dot product per column. The kernel computes
+  blocks of 2x2 output elements, such that every loaded vector is used twice. The inner loop takes
+  18 instructions for 8 complex multiply-accumulates. Rows starting at word boundaries (even
+  strides) avoid misaligned loads.
+
+  @par Parallelization
+  Every core computes every nPE-th block of two rows. The columns of a remaining odd row are split
+  over the cores.
+ */
+
+void plp_mat_mult_trans_conj_cmplx_i8p_xpulpv2(void *args) {
+
+    int core_id = rt_core_id();
+
+    plp_mat_mult_cmplx_instance_i8 *a = (plp_mat_mult_cmplx_instance_i8 *)args;
+
+    const int8_t *__restrict__ pSrcA = a->pSrcA;
+    const int8_t *__restrict__ pSrcB = a->pSrcB;
+    uint32_t M = a->M;
+    uint32_t N = a->N;
+    uint32_t O = a->O;
+    uint32_t nPE = a->nPE;
+    int32_t *__restrict__ pDstC = a->pDstC;
+
+    uint32_t m, n, o;
+
+    /* every nPE-th block of two rows */
+    for (m = core_id * 2; m + 1 < M; m += nPE * 2) {
+        const int8_t *pA0 = pSrcA + m * N * 2;
+        const int8_t *pA1 = pA0 + N * 2;
+        int32_t *pC0 = pDstC + m * O * 2;
+        int32_t *pC1 = pC0 + O * 2;
+        /* blocks of two columns */
+        for (o = 0; o + 1 < O; o += 2) {
+            const int8_t *pB0 = pSrcB + o * N * 2;
+            const int8_t *pB1 = pB0 + N * 2;
+            int32_t re00 = 0;
+            int32_t im00 = 0;
+            int32_t re01 = 0;
+            int32_t im01 = 0;
+            int32_t re10 = 0;
+            int32_t im10 = 0;
+            int32_t re11 = 0;
+            int32_t im11 = 0;
+            int32_t corr0 = 0;
+            int32_t corr1 = 0;
+            /* two complex values of each row and column at once */
+            for (n = 0; n + 1 < N; n += 2) {
+                v4s a0 = *((v4s *)(pA0 + n * 2)); // {a0[n], a0[n + 1]}
+                v4s a1 = *((v4s *)(pA1 + n * 2)); // {a1[n], a1[n + 1]}
+                v4s b0 = *((v4s *)(pB0 + n * 2)); // {b0[n], b0[n + 1]}
+                v4s b1 = *((v4s *)(pB1 + n * 2)); // {b1[n], b1[n + 1]}
+                v4s a0c = __EXOR4(a0, conjmask);
+                v4s a1c = __EXOR4(a1, conjmask);
+                v4s b0s = __builtin_shuffle(b0, swapmask);
+                v4s b1s = __builtin_shuffle(b1, swapmask);
+                re00 = __SUMDOTP4(a0, b0, re00);
+                im00 = __SUMDOTP4(a0c, b0s, im00);
+                re01 = __SUMDOTP4(a0, b1, re01);
+                im01 = __SUMDOTP4(a0c, b1s, im01);
+                re10 = __SUMDOTP4(a1, b0, re10);
+                im10 = __SUMDOTP4(a1c, b0s, im10);
+                re11 = __SUMDOTP4(a1, b1, re11);
+                im11 = __SUMDOTP4(a1c, b1s, im11);
+                corr0 = __SUMDOTP4(b0, immask, corr0);
+                corr1 = __SUMDOTP4(b1, immask, corr1);
+            }
+            /* remaining complex value */
+            if (n < N) {
+                const int8_t *pX0 = pA0 + n * 2;
+                const int8_t *pX1 = pA1 + n * 2;
+                const int8_t *pY0 = pB0 + n * 2;
+                const int8_t *pY1 = pB1 + n * 2;
+                re00 += pX0[0] * pY0[0] + pX0[1] * pY0[1];
+                im00 += pX0[1] * pY0[0] - pX0[0] * pY0[1];
+                re01 += pX0[0] * pY1[0] + pX0[1] * pY1[1];
+                im01 += pX0[1] * pY1[0] - pX0[0] * pY1[1];
+                re10 += pX1[0] * pY0[0] + pX1[1] * pY0[1];
+                im10 += pX1[1] * pY0[0] - pX1[0] * pY0[1];
+                re11 += pX1[0] * pY1[0] + pX1[1] * pY1[1];
+                im11 += pX1[1] * pY1[0] - pX1[0] * pY1[1];
+            }
+            pC0[o * 2 + 0] = re00;
+            pC0[o * 2 + 1] = im00 + corr0;
+            pC0[(o + 1) * 2 + 0] = re01;
+            pC0[(o + 1) * 2 + 1] = im01 + corr1;
+            pC1[o * 2 + 0] = re10;
+            pC1[o * 2 + 1] = im10 + corr0;
+            pC1[(o + 1) * 2 + 0] = re11;
+            pC1[(o + 1) * 2 + 1] = im11 + corr1;
+        }
+        /* remaining column */
+        if (o < O) {
+            dot_prod_1x1(pA0, pSrcB + o * N * 2, N, 1, pC0 + o * 2);
+            dot_prod_1x1(pA1, pSrcB + o * N * 2, N, 1, pC1 + o * 2);
+        }
+    }
+
+    /* remaining row */
+    if (M & 1U) {
+        const int8_t *pA0 = pSrcA + (M - 1) * N * 2;
+        int32_t *pC0 = pDstC + (M - 1) * O * 2;
+        for (o = core_id; o < O; o += nPE) {
+            dot_prod_1x1(pA0, pSrcB + o * N * 2, N, 1, pC0 + o * 2);
+        }
+    }
+}
+
+/**
+   @} end of MatMultTransConjCmplxKernels group
+*/
@@ -0,0 +1,79 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_trans_conj_cmplx_i8s_rv32im.c
+ * Description:  8-bit integer complex matrix conjugate transpose matrix multiplication kernel for
+ * RV32IM
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatMultTransConjCmplx
+ */
+
+/**
+  @addtogroup MatMultTransConjCmplxKernels
+  @{
+ */
+
+/**
+  @brief      Matrix conjugate transpose matrix multiplication for complex 8-bit integers on RV32IM
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+ */
+
+void plp_mat_mult_trans_conj_cmplx_i8s_rv32im(const int8_t *__restrict__ pSrcA,
+                                              const int8_t *__restrict__ pSrcB,
+                                              uint32_t M,
+                                              uint32_t N,
+                                              uint32_t O,
+                                              int32_t *__restrict__ pDstC) {
+
+    for (int m = 0; m < M; m++) {
+        for (int o = 0; o < O; o++) {
+            int32_t sum_re = 0;
+            int32_t sum_im = 0;
+            for (int n = 0; n < N; n++) {
+                int32_t a_re = (int32_t)pSrcA[(m * N + n) * 2 + 0];
+                int32_t a_im = (int32_t)pSrcA[(m * N + n) * 2 + 1];
+                int32_t b_re = (int32_t)pSrcB[(o * N + n) * 2 + 0];
+                int32_t b_im = (int32_t)pSrcB[(o * N + n) * 2 + 1];
+                sum_re += a_re * b_re + a_im * b_im;
+                sum_im += a_im * b_re - a_re * b_im;
+            }
+            pDstC[(m * O + o) * 2 + 0] = sum_re;
+            pDstC[(m * O + o) * 2 + 1] = sum_im;
+        }
+    }
+}
+
+/**
+   @} end of MatMultTransConjCmplxKernels group
+*/
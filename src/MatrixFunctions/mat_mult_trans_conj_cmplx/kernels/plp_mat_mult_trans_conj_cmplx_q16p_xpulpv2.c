@@ -0,0 +1,174 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_trans_conj_cmplx_q16p_xpulpv2.c
+ * Description:  parallel 16-bit fix-point complex matrix conjugate transpose matrix multiplication
+ * for XPULPV2
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatMultTransConjCmplx
+ */
+
+/**
+  @addtogroup MatMultTransConjCmplxKernels
+  @{
+ */
+
+#define conjmask                                                                                   \
+    (v2s) { -1, 0 }
+#define swapmask                                                                                   \
+    (v2s) { 1, 0 }
+
+static inline void dot_prod_1x1(const v2s *pA, const v2s *pB, uint32_t N, uint32_t incB,
+                                uint32_t shift, int16_t *pC) {
+    int32_t re = 0;
+    int32_t im = 0;
+    for (uint32_t n = 0; n < N; n++) {
+        v2s a0 = pA[n];
+        v2s b0 = *pB;
+        v2s a0c = __EXOR2(a0, conjmask);
+        v2s b0s = __builtin_shuffle(b0, swapmask);
+        re += __ROUNDNORM_REG(__DOTP2(a0, b0), shift);
+        im += __ADDROUNDNORM_REG(__DOTP2(a0c, b0s), b0[1], shift);
+        pB += incB;
+    }
+    pC[0] = (int16_t)re;
+    pC[1] = (int16_t)im;
+}
+
+/**
+  @brief      Parallel matrix conjugate transpose matrix multiplication for complex 16-bit fix-point
+              on XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_q16 struct initialized by
+                    plp_mat_mult_trans_conj_cmplx_q16_parallel
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`. The output matrix is also
+  stored with the same number of bits as the inputs. Set the `shift` parameter such that no overflow
+  occurrs.
+
+  @par Exploiting SIMD instructions
+  Every complex value is packed into one 32 bit vector {re, im}. The real part of a * conj(b) is the
+  dot product of a and b. For the imaginary part, the real part of a is inverted (~re = -re - 1,
+  which cannot overflow) and the dot product with the swapped b yields the imaginary part minus the
+  imaginary part of b. The imaginary part of b is added back with __ADDROUNDNORM_REG, such that
+  every product is rounded and shifted before it is accumulated, as on RV32IM. The kernel computes
+  blocks of 2x2 output elements, such that every loaded vector is used twice. The inner loop takes
+  34 instructions for 4 complex multiply-accumulates.
+
+  @par Parallelization
+  Every core computes every nPE-th block of two rows. The columns of a remaining odd row are split
+  over the cores.
+ */
+
+void plp_mat_mult_trans_conj_cmplx_q16p_xpulpv2(void *args) {
+
+    int core_id = rt_core_id();
+
+    plp_mat_mult_cmplx_instance_q16 *a = (plp_mat_mult_cmplx_instance_q16 *)args;
+
+    const int16_t *__restrict__ pSrcA = a->pSrcA;
+    const int16_t *__restrict__ pSrcB = a->pSrcB;
+    uint32_t M = a->M;
+    uint32_t N = a->N;
+    uint32_t O = a->O;
+    uint32_t shift = a->shift;
+    uint32_t nPE = a->nPE;
+    int16_t *__restrict__ pDstC = a->pDstC;
+
+    uint32_t m, n, o;
+
+    /* every nPE-th block of two rows */
+    for (m = core_id * 2; m + 1 < M; m += nPE * 2) {
+        const v2s *pA0 = (const v2s *)pSrcA + m * N;
+        const v2s *pA1 = pA0 + N;
+        int16_t *pC0 = pDstC + m * O * 2;
+        int16_t *pC1 = pC0 + O * 2;
+        /* blocks of two columns */
+        for (o = 0; o + 1 < O; o += 2) {
+            const v2s *pB0 = (const v2s *)pSrcB + o * N;
+            const v2s *pB1 = pB0 + N;
+            int32_t re00 = 0;
+            int32_t im00 = 0;
+            int32_t re01 = 0;
+            int32_t im01 = 0;
+            int32_t re10 = 0;
+            int32_t im10 = 0;
+            int32_t re11 = 0;
+            int32_t im11 = 0;
+            for (n = 0; n < N; n++) {
+                v2s a0 = pA0[n];
+                v2s a1 = pA1[n];
+                v2s b0 = pB0[n];
+                v2s b1 = pB1[n];
+                v2s a0c = __EXOR2(a0, conjmask);
+                v2s a1c = __EXOR2(a1, conjmask);
+                v2s b0s = __builtin_shuffle(b0, swapmask);
+                v2s b1s = __builtin_shuffle(b1, swapmask);
+                re00 += __ROUNDNORM_REG(__DOTP2(a0, b0), shift);
+                im00 += __ADDROUNDNORM_REG(__DOTP2(a0c, b0s), b0[1], shift);
+                re01 += __ROUNDNORM_REG(__DOTP2(a0, b1), shift);
+                im01 += __ADDROUNDNORM_REG(__DOTP2(a0c, b1s), b1[1], shift);
+                re10 += __ROUNDNORM_REG(__DOTP2(a1, b0), shift);
+                im10 += __ADDROUNDNORM_REG(__DOTP2(a1c, b0s), b0[1], shift);
+                re11 += __ROUNDNORM_REG(__DOTP2(a1, b1), shift);
+                im11 += __ADDROUNDNORM_REG(__DOTP2(a1c, b1s), b1[1], shift);
+            }
+            pC0[o * 2 + 0] = (int16_t)re00;
+            pC0[o * 2 + 1] = (int16_t)im00;
+            pC0[(o + 1) * 2 + 0] = (int16_t)re01;
+            pC0[(o + 1) * 2 + 1] = (int16_t)im01;
+            pC1[o * 2 + 0] = (int16_t)re10;
+            pC1[o * 2 + 1] = (int16_t)im10;
+            pC1[(o + 1) * 2 + 0] = (int16_t)re11;
+            pC1[(o + 1) * 2 + 1] = (int16_t)im11;
+        }
+        /* remaining column */
+        if (o < O) {
+            dot_prod_1x1(pA0, (const v2s *)pSrcB + o * N, N, 1, shift, pC0 + o * 2);
+            dot_prod_1x1(pA1, (const v2s *)pSrcB + o * N, N, 1, shift, pC1 + o * 2);
+        }
+    }
+
+    /* remaining row */
+    if (M & 1U) {
+        const v2s *pA0 = (const v2s *)pSrcA + (M - 1) * N;
+        int16_t *pC0 = pDstC + (M - 1) * O * 2;
+        for (o = core_id; o < O; o += nPE) {
+            dot_prod_1x1(pA0, (const v2s *)pSrcB + o * N, N, 1, shift, pC0 + o * 2);
+        }
+    }
+}
+
+/**
+   @} end of MatMultTransConjCmplxKernels group
+*/
@@ -0,0 +1,105 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_trans_conj_cmplx_i16.c
+ * Description:  16-bit integer complex matrix conjugate transpose matrix multiplication glue code
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatMultTransConjCmplx Complex Matrix Conjugate Transpose Matrix Multiplication
+  This module contains the glue code for the multiplication of a complex matrix with the conjugate
+  transpose of another complex matrix. The kernel codes (kernels) are in the Module
+  @ref MatMultTransConjCmplxKernels.
+
+  The second matrix is stored with shape OxN and accessed row wise, like in @ref MatMultTransCmplx,
+  but all its values are conjugated. This computes `C = A * B^H`, as it is needed for covariance
+  matrices or for applying the weights of a beamformer.
+
+      pDst[m,o] = pSrcA[m,0]*conj(pSrcB[o,0]) + ... + pSrcA[m,N-1]*conj(pSrcB[o,N-1])
+
+  These functions assume both source matrices (`pSrcA` and `pSrcB`) and the output matrix (`pDstC`)
+  to be complex, with real and imaginary part of each element stored next to each other. The
+  dimensionality (`M`, `N`, `O`) counts the number of complex elements in each dimension, such that
+  a complex matrix X with shape MxN has size `M * N * 2`:
+
+      Re(X[m, n]): pX[(m * N + n) * 2]
+      Im(X[m, n]): pX[(m * N + n) * 2 + 1]
+
+  There are functions for 16- and 8-bit integers, 16-bit fix-point and 32-bit floats. The integer
+  functions exploit SIMD instructions.
+
+  The naming scheme of the functions follows the following pattern (for example
+  `plp_mat_mult_trans_conj_cmplx_i16`):
+
+      plp_<function name>_<data type><precision>[_parallel]
+
+  name          | description
+  ------------- | ---------------------------------------------------------
+  function_name | `mat_mult_trans_conj_cmplx`
+  data type     | {f, i, q} respectively for floats, integers, fix points
+  precision     | {32, 16, 8} bits
+ */
+
+/**
+  @addtogroup MatMultTransConjCmplx
+  @{
+ */
+
+/**
+  @brief      Glue code of matrix conjugate transpose matrix multiplication for complex 16-bit
+              integers
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+ */
+
+void plp_mat_mult_trans_conj_cmplx_i16(const int16_t *__restrict__ pSrcA,
+                                       const int16_t *__restrict__ pSrcB,
+                                       uint32_t M,
+                                       uint32_t N,
+                                       uint32_t O,
+                                       int32_t *__restrict__ pDstC) {
+
+    PLP_PROFILE_FUNC();
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_mat_mult_trans_conj_cmplx_i16s_rv32im(pSrcA, pSrcB, M, N, O, pDstC);
+    } else {
+        plp_mat_mult_trans_conj_cmplx_i16s_xpulpv2(pSrcA, pSrcB, M, N, O, pDstC);
+    }
+}
+
+/**
+  @} end of MatMultTransConjCmplx group
+ */
@@ -0,0 +1,125 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_tri_f32p_xpulpv2.c
+ * Description:  parallel 32-bit floating-point triangular matrix multiplication for XPULPV2
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatMultStruct
+ */
+
+/**
+  @addtogroup MatMultStructKernels
+  @{
+ */
+
+/* pDst[o] = pRow[0] * pSrcB[0, o] + ... + pRow[len - 1] * pSrcB[len - 1, o] */
+static inline void row_mult(const float *__restrict__ pRow,
+                            const float *__restrict__ pSrcB,
+                            uint32_t len,
+                            uint32_t O,
+                            float *__restrict__ pDst) {
+    uint32_t j, o;
+
+    /* blocks of four columns, every value of the row is loaded once per block */
+    for (o = 0; o + 3 < O; o += 4) {
+        const float *pB = pSrcB + o;
+        float sum0 = 0;
+        float sum1 = 0;
+        float sum2 = 0;
+        float sum3 = 0;
+        for (j = 0; j < len; j++) {
+            float a = pRow[j];
+            sum0 += a * pB[0];
+            sum1 += a * pB[1];
+            sum2 += a * pB[2];
+            sum3 += a * pB[3];
+            pB += O;
+        }
+        pDst[o + 0] = sum0;
+        pDst[o + 1] = sum1;
+        pDst[o + 2] = sum2;
+        pDst[o + 3] = sum3;
+    }
+
+    /* remaining columns */
+    for (; o < O; o++) {
+        float sum = 0;
+        for (j = 0; j < len; j++) {
+            sum += pRow[j] * pSrcB[j * O + o];
+        }
+        pDst[o] = sum;
+    }
+}
+
+/**
+  @brief      Parallel triangular matrix multiplication of 32-bit floats kernel for XPULPV2
+              extension
+  @param[in]  args  pointer to plp_mat_mult_tri_instance_f32 struct initialized by
+                    plp_mat_mult_tri_f32_parallel
+  @return     none
+
+  @par Blocking
+  Four columns of C are computed at once, such that every value of A is loaded once for
+  four multiply-accumulates.
+
+  @par Parallelization
+  Every core computes every nPE-th row. The rows of a triangle have different
+  lengths, and interleaving them gives every core about the same number of short
+  and long rows.
+ */
+
+void plp_mat_mult_tri_f32p_xpulpv2(void *args) {
+
+    int core_id = rt_core_id();
+
+    plp_mat_mult_tri_instance_f32 *a = (plp_mat_mult_tri_instance_f32 *)args;
+
+    const float *__restrict__ pSrcA = a->pSrcA;
+    const float *__restrict__ pSrcB = a->pSrcB;
+    uint32_t N = a->N;
+    uint32_t O = a->O;
+    uint8_t upperFlag = a->upperFlag;
+    uint32_t nPE = a->nPE;
+    float *__restrict__ pDstC = a->pDstC;
+
+    uint32_t i;
+
+    for (i = core_id; i < N; i += nPE) {
+        if (upperFlag) {
+            /* A[i, i..N-1] */
+            row_mult(pSrcA + i * (2 * N - i + 1) / 2, pSrcB + i * O, N - i, O, pDstC + i * O);
+        } else {
+            /* A[i, 0..i] */
+            row_mult(pSrcA + i * (i + 1) / 2, pSrcB, i + 1, O, pDstC + i * O);
+        }
+    }
+}
+
+/**
+  @} end of MatMultStructKernels group
+ */
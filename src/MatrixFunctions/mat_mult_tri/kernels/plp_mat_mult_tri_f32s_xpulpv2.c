@@ -0,0 +1,116 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_tri_f32s_xpulpv2.c
+ * Description:  32-bit floating-point triangular matrix multiplication for XPULPV2
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatMultStruct
+ */
+
+/**
+  @addtogroup MatMultStructKernels
+  @{
+ */
+
+/* pDst[o] = pRow[0] * pSrcB[0, o] + ... + pRow[len - 1] * pSrcB[len - 1, o] */
+static inline void row_mult(const float *__restrict__ pRow,
+                            const float *__restrict__ pSrcB,
+                            uint32_t len,
+                            uint32_t O,
+                            float *__restrict__ pDst) {
+    uint32_t j, o;
+
+    /* blocks of four columns, every value of the row is loaded once per block */
+    for (o = 0; o + 3 < O; o += 4) {
+        const float *pB = pSrcB + o;
+        float sum0 = 0;
+        float sum1 = 0;
+        float sum2 = 0;
+        float sum3 = 0;
+        for (j = 0; j < len; j++) {
+            float a = pRow[j];
+            sum0 += a * pB[0];
+            sum1 += a * pB[1];
+            sum2 += a * pB[2];
+            sum3 += a * pB[3];
+            pB += O;
+        }
+        pDst[o + 0] = sum0;
+        pDst[o + 1] = sum1;
+        pDst[o + 2] = sum2;
+        pDst[o + 3] = sum3;
+    }
+
+    /* remaining columns */
+    for (; o < O; o++) {
+        float sum = 0;
+        for (j = 0; j < len; j++) {
+            sum += pRow[j] * pSrcB[j * O + o];
+        }
+        pDst[o] = sum;
+    }
+}
+
+/**
+  @brief      Triangular matrix multiplication of 32-bit floats kernel for XPULPV2 extension
+  @param[in]  pSrcA     Points to the triangle of the NxN matrix A, packed row by row
+  @param[in]  pSrcB     Points to the second input matrix of shape NxO
+  @param[in]  N         Height and width of A, height of B
+  @param[in]  O         Width of B and C
+  @param[in]  upperFlag 0: A is lower triangular, 1: A is upper triangular
+  @param[out] pDstC     Points to the output matrix of shape NxO
+  @return     none
+
+  @par Blocking
+  Four columns of C are computed at once, such that every value of A is loaded once for
+  four multiply-accumulates.
+ */
+
+void plp_mat_mult_tri_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                                   const float *__restrict__ pSrcB,
+                                   uint32_t N,
+                                   uint32_t O,
+                                   uint8_t upperFlag,
+                                   float *__restrict__ pDstC) {
+
+    uint32_t i;
+
+    for (i = 0; i < N; i++) {
+        if (upperFlag) {
+            /* A[i, i..N-1] */
+            row_mult(pSrcA + i * (2 * N - i + 1) / 2, pSrcB + i * O, N - i, O, pDstC + i * O);
+        } else {
+            /* A[i, 0..i] */
+            row_mult(pSrcA + i * (i + 1) / 2, pSrcB, i + 1, O, pDstC + i * O);
+        }
+    }
+}
+
+/**
+  @} end of MatMultStructKernels group
+ */
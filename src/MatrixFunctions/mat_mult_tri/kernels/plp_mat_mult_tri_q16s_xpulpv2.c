@@ -0,0 +1,127 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_tri_q16s_xpulpv2.c
+ * Description:  16-bit fix-point triangular matrix multiplication for XPULPV2
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatMultStruct
+ */
+
+/**
+  @addtogroup MatMultStructKernels
+  @{
+ */
+
+/* pDst[o] = pRow[0] * pSrcB[0, o] + ... + pRow[len - 1] * pSrcB[len - 1, o] */
+static inline void row_mult(const int16_t *__restrict__ pRow,
+                            const int16_t *__restrict__ pSrcB,
+                            uint32_t len,
+                            uint32_t O,
+                            uint32_t shift,
+                            int16_t *__restrict__ pDst) {
+    uint32_t j, o;
+
+    /* blocks of four columns, every value of the row is loaded once per block */
+    for (o = 0; o + 3 < O; o += 4) {
+        const int16_t *pB = pSrcB + o;
+        int32_t sum0 = 0;
+        int32_t sum1 = 0;
+        int32_t sum2 = 0;
+        int32_t sum3 = 0;
+        for (j = 0; j < len; j++) {
+            int32_t a = (int32_t)pRow[j];
+            sum0 += __ROUNDNORM_REG(a * pB[0], shift);
+            sum1 += __ROUNDNORM_REG(a * pB[1], shift);
+            sum2 += __ROUNDNORM_REG(a * pB[2], shift);
+            sum3 += __ROUNDNORM_REG(a * pB[3], shift);
+            pB += O;
+        }
+        pDst[o + 0] = (int16_t)sum0;
+        pDst[o + 1] = (int16_t)sum1;
+        pDst[o + 2] = (int16_t)sum2;
+        pDst[o + 3] = (int16_t)sum3;
+    }
+
+    /* remaining columns */
+    for (; o < O; o++) {
+        int32_t sum = 0;
+        for (j = 0; j < len; j++) {
+            sum += __ROUNDNORM_REG((int32_t)pRow[j] * pSrcB[j * O + o], shift);
+        }
+        pDst[o] = (int16_t)sum;
+    }
+}
+
+/**
+  @brief      Triangular matrix multiplication of 16-bit fix-point numbers kernel for XPULPV2
+              extension
+  @param[in]  pSrcA     Points to the triangle of the NxN matrix A, packed row by row
+  @param[in]  pSrcB     Points to the second input matrix of shape NxO
+  @param[in]  N         Height and width of A, height of B
+  @param[in]  O         Width of B and C
+  @param[in]  upperFlag 0: A is lower triangular, 1: A is upper triangular
+  @param[in]  shift     Amount to shift the result of each multiplication
+  @param[out] pDstC     Points to the output matrix of shape NxO
+  @return     none
+
+  @par Blocking
+  Four columns of C are computed at once, such that every value of A is loaded once for
+  four multiply-accumulates.
+
+  @par Fix-Point and Shifting
+  Every product is shifted by `shift` to the right with rounding and the sum is stored
+  with 16 bits, exactly like in plp_mat_mult_q16. If A is represented as `pSrcA * 2^-x`
+  and B as `pSrcB * 2^-y`, C is represented as `pDstC * 2^-(x + y - shift)`. Set `shift`
+  such that no overflow occurs.
+ */
+
+void plp_mat_mult_tri_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                   const int16_t *__restrict__ pSrcB,
+                                   uint32_t N,
+                                   uint32_t O,
+                                   uint8_t upperFlag,
+                                   uint32_t shift,
+                                   int16_t *__restrict__ pDstC) {
+
+    uint32_t i;
+
+    for (i = 0; i < N; i++) {
+        if (upperFlag) {
+            /* A[i, i..N-1] */
+            row_mult(pSrcA + i * (2 * N - i + 1) / 2, pSrcB + i * O, N - i, O, shift,
+                     pDstC + i * O);
+        } else {
+            /* A[i, 0..i] */
+            row_mult(pSrcA + i * (i + 1) / 2, pSrcB, i + 1, O, shift, pDstC + i * O);
+        }
+    }
+}
+
+/**
+  @} end of MatMultStructKernels group
+ */
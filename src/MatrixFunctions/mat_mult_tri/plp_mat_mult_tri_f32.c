@@ -0,0 +1,70 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_tri_f32.c
+ * Description:  32-bit floating-point triangular matrix multiplication glue code
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatMultStruct
+  @{
+ */
+
+/**
+  @brief      Glue code for triangular matrix multiplication of 32-bit floats
+  @param[in]  pSrcA     Points to the triangle of the NxN matrix A, packed row by row
+  @param[in]  pSrcB     Points to the second input matrix of shape NxO
+  @param[in]  N         Height and width of A, height of B
+  @param[in]  O         Width of B and C
+  @param[in]  upperFlag 0: A is lower triangular, 1: A is upper triangular
+  @param[out] pDstC     Points to the output matrix of shape NxO
+  @return     none
+ */
+
+void plp_mat_mult_tri_f32(const float *__restrict__ pSrcA,
+                          const float *__restrict__ pSrcB,
+                          uint32_t N,
+                          uint32_t O,
+                          uint8_t upperFlag,
+                          float *__restrict__ pDstC) {
+
+    PLP_PROFILE_FUNC();
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return;
+    } else {
+        plp_mat_mult_tri_f32s_xpulpv2(pSrcA, pSrcB, N, O, upperFlag, pDstC);
+    }
+}
+
+/**
+  @} end of MatMultStruct group
+ */
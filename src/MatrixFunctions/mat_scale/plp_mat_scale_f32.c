@@ -55,6 +55,8 @@ void plp_mat_scale_f32(const float *__restrict__ pSrc,
                        float scaleFactor,
                        float *__restrict__ pDst) {
 
+    PLP_PROFILE_FUNC();
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         printf("Floating point is supported only for cluster side\n");
         return;
@@ -82,6 +82,8 @@ void plp_mat_scale_i16(const int16_t *__restrict__ pSrc,
                        int32_t shift,
                        int16_t *__restrict__ pDst) {
 
+    PLP_PROFILE_FUNC();
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         plp_mat_scale_i16s_rv32im(pSrc, M, N, scaleFactor, shift, pDst);
     } else {
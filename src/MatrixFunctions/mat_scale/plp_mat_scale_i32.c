@@ -57,6 +57,8 @@ void plp_mat_scale_i32(const int32_t *__restrict__ pSrc,
                        int32_t shift,
                        int32_t *__restrict__ pDst) {
 
+    PLP_PROFILE_FUNC();
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         plp_mat_scale_i32s_rv32im(pSrc, M, N, scaleFactor, shift, pDst);
     } else {
@@ -0,0 +1,161 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_solve_tri_f32s_xpulpv2.c
+ * Description:  32-bit floating-point triangular solve for XPULPV2
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatMultStruct
+ */
+
+/**
+  @addtogroup MatMultStructKernels
+  @{
+ */
+
+/* solves the columns o to o + 3. The rows are solved from the top (lower triangle) or from the
+   bottom (upper triangle), such that row i only needs the already solved rows of X. */
+static inline void solve_cols4(const float *pSrcA,
+                               const float *pSrcB,
+                               uint32_t N,
+                               uint32_t O,
+                               uint8_t upperFlag,
+                               uint32_t o,
+                               float *pDstX) {
+    uint32_t r, i, j, len;
+
+    for (r = 0; r < N; r++) {
+        const float *pRow; // off-diagonal values of row i
+        const float *pX;   // rows of X they are multiplied with
+        float diag;
+        if (upperFlag) {
+            i = N - 1 - r;
+            pRow = pSrcA + i * (2 * N - i + 1) / 2;
+            diag = *pRow++;
+            pX = pDstX + (i + 1) * O + o;
+            len = N - 1 - i;
+        } else {
+            i = r;
+            pRow = pSrcA + i * (i + 1) / 2;
+            diag = pRow[i];
+            pX = pDstX + o;
+            len = i;
+        }
+        float sum0 = pSrcB[i * O + o];
+        float sum1 = pSrcB[i * O + o + 1];
+        float sum2 = pSrcB[i * O + o + 2];
+        float sum3 = pSrcB[i * O + o + 3];
+        for (j = 0; j < len; j++) {
+            float a = pRow[j];
+            sum0 -= a * pX[0];
+            sum1 -= a * pX[1];
+            sum2 -= a * pX[2];
+            sum3 -= a * pX[3];
+            pX += O;
+        }
+        float inv = 1.0f / diag;
+        pDstX[i * O + o] = sum0 * inv;
+        pDstX[i * O + o + 1] = sum1 * inv;
+        pDstX[i * O + o + 2] = sum2 * inv;
+        pDstX[i * O + o + 3] = sum3 * inv;
+    }
+}
+
+/* solves the column o */
+static inline void solve_col(const float *pSrcA,
+                             const float *pSrcB,
+                             uint32_t N,
+                             uint32_t O,
+                             uint8_t upperFlag,
+                             uint32_t o,
+                             float *pDstX) {
+    uint32_t r, i, j, len;
+
+    for (r = 0; r < N; r++) {
+        const float *pRow;
+        const float *pX;
+        float diag;
+        if (upperFlag) {
+            i = N - 1 - r;
+            pRow = pSrcA + i * (2 * N - i + 1) / 2;
+            diag = *pRow++;
+            pX = pDstX + (i + 1) * O + o;
+            len = N - 1 - i;
+        } else {
+            i = r;
+            pRow = pSrcA + i * (i + 1) / 2;
+            diag = pRow[i];
+            pX = pDstX + o;
+            len = i;
+        }
+        float sum = pSrcB[i * O + o];
+        for (j = 0; j < len; j++) {
+            sum -= pRow[j] * pX[0];
+            pX += O;
+        }
+        pDstX[i * O + o] = sum / diag;
+    }
+}
+
+/**
+  @brief      Triangular solve of 32-bit floats kernel for XPULPV2 extension
+  @param[in]  pSrcA     Points to the triangle of the NxN matrix A, packed row by row
+  @param[in]  pSrcB     Points to the right-hand sides B of shape NxO
+  @param[in]  N         Height and width of A, height of B
+  @param[in]  O         Number of right-hand sides, width of B and X
+  @param[in]  upperFlag 0: A is lower triangular, 1: A is upper triangular
+  @param[out] pDstX     Points to the solution X of shape NxO, may be equal to pSrcB
+  @return     none
+
+  The diagonal values of A must not be zero, plp_mat_solve_tri_f32 checks them.
+
+  @par Blocking
+  Four columns of X are solved at once, such that every value of A is loaded once for
+  four multiply-accumulates. The division by the diagonal value is replaced by one
+  reciprocal per row and block.
+ */
+
+void plp_mat_solve_tri_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                                    const float *pSrcB,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    uint8_t upperFlag,
+                                    float *pDstX) {
+
+    uint32_t o;
+
+    for (o = 0; o + 3 < O; o += 4) {
+        solve_cols4(pSrcA, pSrcB, N, O, upperFlag, o, pDstX);
+    }
+    for (; o < O; o++) {
+        solve_col(pSrcA, pSrcB, N, O, upperFlag, o, pDstX);
+    }
+}
+
+/**
+  @} end of MatMultStructKernels group
+ */
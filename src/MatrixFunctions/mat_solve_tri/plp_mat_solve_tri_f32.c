@@ -0,0 +1,81 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_solve_tri_f32.c
+ * Description:  32-bit floating-point triangular solve glue code
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatMultStruct
+  @{
+ */
+
+/**
+  @brief      Glue code for triangular solve of 32-bit floats
+  @param[in]  pSrcA     Points to the triangle of the NxN matrix A, packed row by row
+  @param[in]  pSrcB     Points to the right-hand sides B of shape NxO
+  @param[in]  N         Height and width of A, height of B
+  @param[in]  O         Number of right-hand sides, width of B and X
+  @param[in]  upperFlag 0: A is lower triangular, 1: A is upper triangular
+  @param[out] pDstX     Points to the solution X of shape NxO, may be equal to pSrcB
+  @return     0: Success, 1: A diagonal value of A is zero, 2: operation not supported
+ */
+
+int plp_mat_solve_tri_f32(const float *__restrict__ pSrcA,
+                          const float *pSrcB,
+                          uint32_t N,
+                          uint32_t O,
+                          uint8_t upperFlag,
+                          float *pDstX) {
+
+    PLP_PROFILE_FUNC();
+
+    uint32_t i;
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return 2;
+    } else {
+        for (i = 0; i < N; i++) {
+            float diag = upperFlag ? pSrcA[i * (2 * N - i + 1) / 2] : pSrcA[i * (i + 3) / 2];
+            if (diag == 0.0f) {
+                return 1;
+            }
+        }
+
+        plp_mat_solve_tri_f32s_xpulpv2(pSrcA, pSrcB, N, O, upperFlag, pDstX);
+    }
+
+    return 0;
+}
+
+/**
+  @} end of MatMultStruct group
+ */
@@ -55,6 +55,8 @@ void plp_mat_sub_i32(const int32_t *__restrict__ pSrcA,
                      uint32_t N,
                      int32_t *__restrict__ pDst) {
 
+    PLP_PROFILE_FUNC();
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         plp_mat_sub_i32s_rv32im(pSrcA, pSrcB, M, N, pDst);
     } else {
@@ -57,6 +57,8 @@ void plp_mat_sub_i8_parallel(const int8_t *__restrict__ pSrcA,
                              uint32_t nPE,
                              int8_t *__restrict__ pDst) {
 
+    PLP_PROFILE_FUNC();
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         printf("parallel processing supported only for cluster side\n");
         return;
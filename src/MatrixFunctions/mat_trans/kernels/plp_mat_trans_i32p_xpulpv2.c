@@ -44,35 +44,24 @@
   @param[in]  args  pointer to plp_mat_trans_instance_i32 struct initialized by
                     plp_mat_trans_i32_parallel
   @return     none
+
+  @par Tiling
+  Uses the kernel plp_mat_trans_stride_i32p_xpulpv2, which transposes tiles of four rows.
  */
 
 void plp_mat_trans_i32p_xpulpv2(void *args) {
 
-    int core_id = rt_core_id();
-
     plp_mat_trans_instance_i32 *a = (plp_mat_trans_instance_i32 *)args;
 
-    const int32_t *__restrict__ pSrc = a->pSrc;
-    uint32_t M = a->M;
-    uint32_t N = a->N;
-    uint32_t nPE = a->nPE;
-    int32_t *__restrict__ pDst = a->pDst;
-
-#define BASIC_VERSION // if used don't forget to also use the undefine at end of file
-#ifdef BASIC_VERSION
-
-    for (int m = core_id; m < M; m += nPE) {
-        for (int n = 0; n < N; n++) {
-            pDst[n * M + m] = pSrc[m * N + n];
-        }
-    }
-
-#else
-
-    // TODO: Hackathon
+    plp_mat_trans_stride_instance_i32 strideArgs = { .pSrc = a->pSrc,
+                                                     .M = a->M,
+                                                     .N = a->N,
+                                                     .strideSrc = a->N,
+                                                     .strideDst = a->M,
+                                                     .nPE = a->nPE,
+                                                     .pDst = a->pDst };
 
-#endif
-#undef BASIC_VERSION
+    plp_mat_trans_stride_i32p_xpulpv2((void *)&strideArgs);
 }
 
 /**
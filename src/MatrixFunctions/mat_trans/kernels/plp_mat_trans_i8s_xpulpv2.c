@@ -46,6 +46,9 @@
   @param[in]  N    Width of the input matrix and height of the output matrix
   @param[out] pDst Points to the output matrix of shape NxM
   @return     none
+
+  @par Tiling
+  Uses the kernel plp_mat_trans_stride_i8s_xpulpv2, which transposes tiles of 4x4 elements.
  */
 
 void plp_mat_trans_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
@@ -53,21 +56,7 @@ void plp_mat_trans_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
                                uint32_t N,
                                int8_t *__restrict__ pDst) {
 
-#define BASIC_VERSION // if used don't forget to also use the undefine at end of file
-#ifdef BASIC_VERSION
-
-    for (int m = 0; m < M; m++) {
-        for (int n = 0; n < N; n++) {
-            pDst[n * M + m] = pSrc[m * N + n];
-        }
-    }
-
-#else
-
-    // TODO: Hackathon
-
-#endif
-#undef BASIC_VERSION
+    plp_mat_trans_stride_i8s_xpulpv2(pSrc, M, N, N, M, pDst);
 }
 /**
    @} end of MatTransKernels group
@@ -0,0 +1,102 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_trans_in_place_i16s_xpulpv2.c
+ * Description:  16-bit integer in-place matrix transpose kernel for XPULPV2
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatTrans
+ */
+
+/**
+  @addtogroup MatTransKernels
+  @{
+ */
+
+#define shufflemask_lo                                                                             \
+    (v2s) { 0, 2 }
+#define shufflemask_hi                                                                             \
+    (v2s) { 1, 3 }
+
+/**
+  @brief         In-place transpose of a square 16-bit integer matrix kernel for XPULPV2 extension.
+  @param[in,out] pSrcDst Points to the square matrix of shape NxN, which is transposed in place
+  @param[in]     N       Width and height of the matrix
+  @return        none
+
+  @par Exploiting SIMD instructions
+  The matrix is split into tiles of 2x2 elements, which are loaded and stored as packed words. The
+  tiles on the diagonal are transposed in registers, all other tiles are swapped with the transpose
+  of their mirrored tile. No second buffer is needed.
+ */
+
+void plp_mat_trans_in_place_i16s_xpulpv2(int16_t *__restrict__ pSrcDst, uint32_t N) {
+
+    uint32_t N2 = N & ~1U;
+    uint32_t i, j;
+
+    /* tile rows of 2x2 elements */
+    for (i = 0; i < N2; i += 2) {
+        int16_t *pA = pSrcDst + i * N;
+        int16_t *pB = pA + N;
+
+        /* tile on the diagonal */
+        v2s va = *((v2s *)(pA + i));
+        v2s vb = *((v2s *)(pB + i));
+        *((v2s *)(pA + i)) = __builtin_shuffle(va, vb, shufflemask_lo);
+        *((v2s *)(pB + i)) = __builtin_shuffle(va, vb, shufflemask_hi);
+
+        /* swap the tile (i, j) with the transpose of the tile (j, i) */
+        for (j = i + 2; j < N2; j += 2) {
+            int16_t *pC = pSrcDst + j * N + i;
+            int16_t *pD = pC + N;
+            va = *((v2s *)(pA + j));
+            vb = *((v2s *)(pB + j));
+            v2s vc = *((v2s *)pC);
+            v2s vd = *((v2s *)pD);
+            *((v2s *)(pA + j)) = __builtin_shuffle(vc, vd, shufflemask_lo);
+            *((v2s *)(pB + j)) = __builtin_shuffle(vc, vd, shufflemask_hi);
+            *((v2s *)pC) = __builtin_shuffle(va, vb, shufflemask_lo);
+            *((v2s *)pD) = __builtin_shuffle(va, vb, shufflemask_hi);
+        }
+
+        /* remaining column, the last element on the diagonal stays in place */
+        if (N2 < N) {
+            int16_t *pC = pSrcDst + N2 * N + i;
+            int16_t tmp = pA[N2];
+            pA[N2] = pC[0];
+            pC[0] = tmp;
+            tmp = pB[N2];
+            pB[N2] = pC[1];
+            pC[1] = tmp;
+        }
+    }
+}
+
+/**
+   @} end of MatTransKernels group
+*/
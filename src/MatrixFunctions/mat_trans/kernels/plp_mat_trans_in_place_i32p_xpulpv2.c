@@ -0,0 +1,76 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_trans_in_place_i32p_xpulpv2.c
+ * Description:  32-bit integer parallel in-place matrix transpose kernel for XPULPV2
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatTrans
+ */
+
+/**
+  @addtogroup MatTransKernels
+  @{
+ */
+
+/**
+  @brief         Parallel in-place transpose of a square 32-bit integer matrix kernel for XPULPV2
+                 extension.
+  @param[in]     args  pointer to plp_mat_trans_in_place_instance_i32 struct initialized by
+                       plp_mat_trans_in_place_i32_parallel
+  @return        none
+
+  Every core takes every nPE-th row and swaps it with the mirrored column. The pairs of
+  mirrored elements are disjoint, so the cores need no synchronization.
+ */
+
+void plp_mat_trans_in_place_i32p_xpulpv2(void *args) {
+
+    int core_id = rt_core_id();
+
+    plp_mat_trans_in_place_instance_i32 *a = (plp_mat_trans_in_place_instance_i32 *)args;
+
+    int32_t *__restrict__ pSrcDst = a->pSrcDst;
+    uint32_t N = a->N;
+    uint32_t nPE = a->nPE;
+
+    for (uint32_t i = core_id; i < N; i += nPE) {
+        int32_t *pRow = pSrcDst + i * N + i + 1;
+        int32_t *pCol = pRow + N - 1;
+        for (uint32_t j = i + 1; j < N; j++) {
+            int32_t va = *pRow;
+            int32_t vb = *pCol;
+            *pRow++ = vb;
+            *pCol = va;
+            pCol += N;
+        }
+    }
+}
+
+/**
+   @} end of MatTransKernels group
+*/
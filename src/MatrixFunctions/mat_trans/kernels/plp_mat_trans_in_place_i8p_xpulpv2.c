@@ -0,0 +1,148 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_trans_in_place_i8p_xpulpv2.c
+ * Description:  8-bit integer parallel in-place matrix transpose kernel for XPULPV2
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatTrans
+ */
+
+/**
+  @addtogroup MatTransKernels
+  @{
+ */
+
+#define shufflemask_lo                                                                             \
+    (v4s) { 0, 4, 1, 5 }
+#define shufflemask_hi                                                                             \
+    (v4s) { 2, 6, 3, 7 }
+#define shufflemask_even                                                                           \
+    (v4s) { 0, 1, 4, 5 }
+#define shufflemask_odd                                                                            \
+    (v4s) { 2, 3, 6, 7 }
+
+/* loads the four words a, b, c, d and stores their 4x4 transpose to the rows pW, pX, pY, pZ */
+#define TRANSPOSE_WORDS(a, b, c, d, pW, pX, pY, pZ)                                                \
+    do {                                                                                           \
+        v4s abLo = __builtin_shuffle(a, b, shufflemask_lo);                                        \
+        v4s abHi = __builtin_shuffle(a, b, shufflemask_hi);                                        \
+        v4s cdLo = __builtin_shuffle(c, d, shufflemask_lo);                                        \
+        v4s cdHi = __builtin_shuffle(c, d, shufflemask_hi);                                        \
+        *((v4s *)(pW)) = __builtin_shuffle(abLo, cdLo, shufflemask_even);                          \
+        *((v4s *)(pX)) = __builtin_shuffle(abLo, cdLo, shufflemask_odd);                           \
+        *((v4s *)(pY)) = __builtin_shuffle(abHi, cdHi, shufflemask_even);                          \
+        *((v4s *)(pZ)) = __builtin_shuffle(abHi, cdHi, shufflemask_odd);                           \
+    } while (0)
+
+/* transposes the tile in the rows pA, pB, pC, pD into the rows pW, pX, pY, pZ */
+#define TRANSPOSE_TILE(pA, pB, pC, pD, pW, pX, pY, pZ)                                             \
+    do {                                                                                           \
+        v4s _a = *((v4s *)(pA));                                                                   \
+        v4s _b = *((v4s *)(pB));                                                                   \
+        v4s _c = *((v4s *)(pC));                                                                   \
+        v4s _d = *((v4s *)(pD));                                                                   \
+        TRANSPOSE_WORDS(_a, _b, _c, _d, pW, pX, pY, pZ);                                           \
+    } while (0)
+
+/**
+  @brief         Parallel in-place transpose of a square 8-bit integer matrix kernel for XPULPV2
+                 extension.
+  @param[in]     args  pointer to plp_mat_trans_in_place_instance_i8 struct initialized by
+                       plp_mat_trans_in_place_i8_parallel
+  @return        none
+
+  @par Exploiting SIMD instructions
+  The matrix is split into tiles of 4x4 elements, which are loaded and stored as packed words. The
+  tiles on the diagonal are transposed in registers, all other tiles are swapped with the transpose
+  of their mirrored tile. No second buffer is needed.
+
+  Every core takes every nPE-th tile row and swaps it with the mirrored column. The pairs of
+  mirrored elements are disjoint, so the cores need no synchronization.
+ */
+
+void plp_mat_trans_in_place_i8p_xpulpv2(void *args) {
+
+    int core_id = rt_core_id();
+
+    plp_mat_trans_in_place_instance_i8 *a = (plp_mat_trans_in_place_instance_i8 *)args;
+
+    int8_t *__restrict__ pSrcDst = a->pSrcDst;
+    uint32_t N = a->N;
+    uint32_t nPE = a->nPE;
+
+    uint32_t N4 = N & ~3U;
+    uint32_t i, j, k;
+
+    /* every nPE-th tile row of 4x4 elements */
+    for (i = core_id * 4; i < N4; i += nPE * 4) {
+        int8_t *pA = pSrcDst + i * N;
+        int8_t *pB = pA + N;
+        int8_t *pC = pB + N;
+        int8_t *pD = pC + N;
+
+        /* tile on the diagonal */
+        TRANSPOSE_TILE(pA + i, pB + i, pC + i, pD + i, pA + i, pB + i, pC + i, pD + i);
+
+        /* swap the tile (i, j) with the transpose of the tile (j, i) */
+        for (j = i + 4; j < N4; j += 4) {
+            int8_t *pE = pSrcDst + j * N + i;
+            int8_t *pF = pE + N;
+            int8_t *pG = pF + N;
+            int8_t *pH = pG + N;
+            v4s ve = *((v4s *)pE);
+            v4s vf = *((v4s *)pF);
+            v4s vg = *((v4s *)pG);
+            v4s vh = *((v4s *)pH);
+            TRANSPOSE_TILE(pA + j, pB + j, pC + j, pD + j, pE, pF, pG, pH);
+            TRANSPOSE_WORDS(ve, vf, vg, vh, pA + j, pB + j, pC + j, pD + j);
+        }
+
+        /* remaining columns */
+        for (j = N4; j < N; j++) {
+            int8_t *pE = pSrcDst + j * N + i;
+            for (k = 0; k < 4; k++) {
+                int8_t tmp = pSrcDst[(i + k) * N + j];
+                pSrcDst[(i + k) * N + j] = pE[k];
+                pE[k] = tmp;
+            }
+        }
+    }
+
+    /* square of the remaining rows and columns */
+    for (i = N4 + core_id; i < N; i += nPE) {
+        for (j = i + 1; j < N; j++) {
+            int8_t tmp = pSrcDst[i * N + j];
+            pSrcDst[i * N + j] = pSrcDst[j * N + i];
+            pSrcDst[j * N + i] = tmp;
+        }
+    }
+}
+
+/**
+   @} end of MatTransKernels group
+*/
@@ -69,6 +69,8 @@ void plp_mat_trans_i16(const int16_t *__restrict__ pSrc,
                        uint32_t N,
                        int16_t *__restrict__ pDst) {
 
+    PLP_PROFILE_FUNC();
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         plp_mat_trans_i16s_rv32im(pSrc, M, N, pDst);
     } else {
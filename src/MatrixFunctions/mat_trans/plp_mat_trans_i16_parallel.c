@@ -55,6 +55,8 @@ void plp_mat_trans_i16_parallel(const int16_t *__restrict__ pSrc,
                                 uint32_t nPE,
                                 int16_t *__restrict__ pDst) {
 
+    PLP_PROFILE_FUNC();
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         printf("parallel processing supported only for cluster side\n");
         return;
@@ -53,6 +53,8 @@ void plp_mat_trans_i32(const int32_t *__restrict__ pSrc,
                        uint32_t N,
                        int32_t *__restrict__ pDst) {
 
+    PLP_PROFILE_FUNC();
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         plp_mat_trans_i32s_rv32im(pSrc, M, N, pDst);
     } else {
@@ -0,0 +1,201 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_vec_i4i8p_xpulpv2.c
+ * Description:  parallel 4-bit x 8-bit matrix-vector multiplication for XPULPV2
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatMultMixed
+ */
+
+/**
+  @addtogroup MatMultMixedKernels
+  @{
+ */
+
+RT_CL_DATA static v4s nibbleShift = { 4, 4, 4, 4 };
+RT_CL_DATA static v4s nibbleHigh = { -16, -16, -16, -16 }; // 0xf0 in every byte
+
+/* A word of A holds eight 4-bit weights. Shifting every byte left by four gives the weights
+   of the even columns, masking every byte with 0xf0 gives the weights of the odd columns,
+   both multiplied by 16. The SIMD sums are therefore divided by 16 at the end. */
+
+/* 4 values of y, starting at the row pA of A and the value pDst of y */
+static inline void vec_rows4(const int8_t *__restrict__ pA,
+                             const int8_t *__restrict__ pSrcX,
+                             uint32_t N,
+                             int32_t *__restrict__ pDst) {
+    const int8_t *pA0 = pA;
+    const int8_t *pA1 = pA0 + (N + 1) / 2;
+    const int8_t *pA2 = pA1 + (N + 1) / 2;
+    const int8_t *pA3 = pA2 + (N + 1) / 2;
+    uint32_t n;
+
+    int32_t sum0 = 0;
+    int32_t sum1 = 0;
+    int32_t sum2 = 0;
+    int32_t sum3 = 0;
+
+    for (n = 0; n + 7 < N; n += 8) {
+        v4s x0 = *((v4s *)&pSrcX[n]);
+        v4s x1 = *((v4s *)&pSrcX[n + 4]);
+        v4s xEven = __builtin_shuffle(x0, x1, (v4s){ 0, 2, 4, 6 });
+        v4s xOdd = __builtin_shuffle(x0, x1, (v4s){ 1, 3, 5, 7 });
+
+        v4s w0 = *((v4s *)&pA0[n / 2]);
+        v4s w1 = *((v4s *)&pA1[n / 2]);
+        v4s w2 = *((v4s *)&pA2[n / 2]);
+        v4s w3 = *((v4s *)&pA3[n / 2]);
+        sum0 = __SUMDOTP4(__SLL4(w0, nibbleShift), xEven, sum0);
+        sum0 = __SUMDOTP4(__AND4(w0, nibbleHigh), xOdd, sum0);
+        sum1 = __SUMDOTP4(__SLL4(w1, nibbleShift), xEven, sum1);
+        sum1 = __SUMDOTP4(__AND4(w1, nibbleHigh), xOdd, sum1);
+        sum2 = __SUMDOTP4(__SLL4(w2, nibbleShift), xEven, sum2);
+        sum2 = __SUMDOTP4(__AND4(w2, nibbleHigh), xOdd, sum2);
+        sum3 = __SUMDOTP4(__SLL4(w3, nibbleShift), xEven, sum3);
+        sum3 = __SUMDOTP4(__AND4(w3, nibbleHigh), xOdd, sum3);
+    }
+    sum0 = sum0 >> 4;
+    sum1 = sum1 >> 4;
+    sum2 = sum2 >> 4;
+    sum3 = sum3 >> 4;
+
+    /* remaining values of N */
+    for (; n + 1 < N; n += 2) {
+        int32_t x0 = pSrcX[n];
+        int32_t x1 = pSrcX[n + 1];
+        int32_t w0 = pA0[n / 2];
+        int32_t w1 = pA1[n / 2];
+        int32_t w2 = pA2[n / 2];
+        int32_t w3 = pA3[n / 2];
+        sum0 += __BITEXTRACT(w0, 4, 0) * x0 + __BITEXTRACT(w0, 4, 4) * x1;
+        sum1 += __BITEXTRACT(w1, 4, 0) * x0 + __BITEXTRACT(w1, 4, 4) * x1;
+        sum2 += __BITEXTRACT(w2, 4, 0) * x0 + __BITEXTRACT(w2, 4, 4) * x1;
+        sum3 += __BITEXTRACT(w3, 4, 0) * x0 + __BITEXTRACT(w3, 4, 4) * x1;
+    }
+    if (n < N) {
+        int32_t x0 = pSrcX[n];
+        sum0 += __BITEXTRACT(pA0[n / 2], 4, 0) * x0;
+        sum1 += __BITEXTRACT(pA1[n / 2], 4, 0) * x0;
+        sum2 += __BITEXTRACT(pA2[n / 2], 4, 0) * x0;
+        sum3 += __BITEXTRACT(pA3[n / 2], 4, 0) * x0;
+    }
+
+    pDst[0] = sum0;
+    pDst[1] = sum1;
+    pDst[2] = sum2;
+    pDst[3] = sum3;
+}
+
+/* one value of y, starting at the row pA of A and the value pDst of y */
+static inline void vec_rows1(const int8_t *__restrict__ pA,
+                             const int8_t *__restrict__ pSrcX,
+                             uint32_t N,
+                             int32_t *__restrict__ pDst) {
+    const int8_t *pA0 = pA;
+    uint32_t n;
+
+    int32_t sum0 = 0;
+
+    for (n = 0; n + 7 < N; n += 8) {
+        v4s x0 = *((v4s *)&pSrcX[n]);
+        v4s x1 = *((v4s *)&pSrcX[n + 4]);
+        v4s xEven = __builtin_shuffle(x0, x1, (v4s){ 0, 2, 4, 6 });
+        v4s xOdd = __builtin_shuffle(x0, x1, (v4s){ 1, 3, 5, 7 });
+
+        v4s w0 = *((v4s *)&pA0[n / 2]);
+        sum0 = __SUMDOTP4(__SLL4(w0, nibbleShift), xEven, sum0);
+        sum0 = __SUMDOTP4(__AND4(w0, nibbleHigh), xOdd, sum0);
+    }
+    sum0 = sum0 >> 4;
+
+    /* remaining values of N */
+    for (; n + 1 < N; n += 2) {
+        int32_t x0 = pSrcX[n];
+        int32_t x1 = pSrcX[n + 1];
+        int32_t w0 = pA0[n / 2];
+        sum0 += __BITEXTRACT(w0, 4, 0) * x0 + __BITEXTRACT(w0, 4, 4) * x1;
+    }
+    if (n < N) {
+        int32_t x0 = pSrcX[n];
+        sum0 += __BITEXTRACT(pA0[n / 2], 4, 0) * x0;
+    }
+
+    pDst[0] = sum0;
+}
+
+/**
+  @brief      Parallel matrix-vector multiplication of 4-bit integer weights and 8-bit integer
+              activations kernel for XPULPV2 extension
+  @param[in]  args  pointer to plp_mat_vec_instance_i4i8 struct initialized by
+                    plp_mat_vec_i4i8_parallel
+  @return     none
+
+  @par Exploiting SIMD instructions
+  Eight 4-bit weights are loaded with one word and unpacked with two SIMD instructions: __SLL4 gives
+  the weights of the even columns, __AND4 the weights of the odd columns, both multiplied by 16. The
+  activations are shuffled into their even and odd values and multiplied with __SUMDOTP4 into 32-bit
+  accumulators, which are divided by 16 at the end. Four values of y are computed at once, such that
+  every shuffle of x is used four times.
+
+  @par Overflow
+  The SIMD accumulators hold 16 times the sum, they can only overflow for N of 131072 or more.
+
+  @par Parallelization
+  Every core computes every nPE-th block of 4 rows, and the remaining rows are split
+  over the cores.
+ */
+
+void plp_mat_vec_i4i8p_xpulpv2(void *args) {
+
+    int core_id = rt_core_id();
+
+    plp_mat_vec_instance_i4i8 *a = (plp_mat_vec_instance_i4i8 *)args;
+
+    const int8_t *__restrict__ pSrcA = a->pSrcA;
+    const int8_t *__restrict__ pSrcX = a->pSrcX;
+    uint32_t M = a->M;
+    uint32_t N = a->N;
+    uint32_t nPE = a->nPE;
+    int32_t *__restrict__ pDstY = a->pDstY;
+
+    uint32_t m;
+
+    /* blocks of 4 rows, interleaved over the cores */
+    for (m = core_id * 4; m + 3 < M; m += nPE * 4) {
+        vec_rows4(pSrcA + m * ((N + 1) / 2), pSrcX, N, pDstY + m);
+    }
+
+    /* remaining rows */
+    for (m = (M & ~3U) + core_id; m < M; m += nPE) {
+        vec_rows1(pSrcA + m * ((N + 1) / 2), pSrcX, N, pDstY + m);
+    }
+}
+
+/**
+  @} end of MatMultMixedKernels group
+ */
@@ -0,0 +1,183 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_vec_i8i16p_xpulpv2.c
+ * Description:  parallel 8-bit x 16-bit matrix-vector multiplication for XPULPV2
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatMultMixed
+ */
+
+/**
+  @addtogroup MatMultMixedKernels
+  @{
+ */
+
+/* The 16-bit activations are split into their high byte (signed) and their low byte
+   (unsigned), such that four 8-bit weights are multiplied with one __SUMDOTP4 and one
+   __SUMDOTPUS4, and the sum is high * 256 + low. */
+
+/* 4 values of y, starting at the row pA of A and the value pDst of y */
+static inline void vec_rows4(const int8_t *__restrict__ pA,
+                             const int16_t *__restrict__ pSrcX,
+                             uint32_t N,
+                             int32_t *__restrict__ pDst) {
+    const int8_t *pA0 = pA;
+    const int8_t *pA1 = pA0 + N;
+    const int8_t *pA2 = pA1 + N;
+    const int8_t *pA3 = pA2 + N;
+    uint32_t n;
+
+    int32_t high0 = 0;
+    int32_t high1 = 0;
+    int32_t high2 = 0;
+    int32_t high3 = 0;
+    int32_t low0 = 0;
+    int32_t low1 = 0;
+    int32_t low2 = 0;
+    int32_t low3 = 0;
+
+    for (n = 0; n + 3 < N; n += 4) {
+        v4s x0 = *((v4s *)&pSrcX[n]);
+        v4s x1 = *((v4s *)&pSrcX[n + 2]);
+        v4s high = __builtin_shuffle(x0, x1, (v4s){ 1, 3, 5, 7 });
+        v4u low = (v4u)__builtin_shuffle(x0, x1, (v4s){ 0, 2, 4, 6 });
+
+        v4s a0 = *((v4s *)&pA0[n]);
+        v4s a1 = *((v4s *)&pA1[n]);
+        v4s a2 = *((v4s *)&pA2[n]);
+        v4s a3 = *((v4s *)&pA3[n]);
+        high0 = __SUMDOTP4(a0, high, high0);
+        low0 = __SUMDOTPUS4(low, a0, low0);
+        high1 = __SUMDOTP4(a1, high, high1);
+        low1 = __SUMDOTPUS4(low, a1, low1);
+        high2 = __SUMDOTP4(a2, high, high2);
+        low2 = __SUMDOTPUS4(low, a2, low2);
+        high3 = __SUMDOTP4(a3, high, high3);
+        low3 = __SUMDOTPUS4(low, a3, low3);
+    }
+
+    int32_t sum0 = high0 * 256 + low0;
+    int32_t sum1 = high1 * 256 + low1;
+    int32_t sum2 = high2 * 256 + low2;
+    int32_t sum3 = high3 * 256 + low3;
+
+    /* remaining values of N */
+    for (; n < N; n++) {
+        int32_t x = pSrcX[n];
+        sum0 += pA0[n] * x;
+        sum1 += pA1[n] * x;
+        sum2 += pA2[n] * x;
+        sum3 += pA3[n] * x;
+    }
+
+    pDst[0] = sum0;
+    pDst[1] = sum1;
+    pDst[2] = sum2;
+    pDst[3] = sum3;
+}
+
+/* one value of y, starting at the row pA of A and the value pDst of y */
+static inline void vec_rows1(const int8_t *__restrict__ pA,
+                             const int16_t *__restrict__ pSrcX,
+                             uint32_t N,
+                             int32_t *__restrict__ pDst) {
+    const int8_t *pA0 = pA;
+    uint32_t n;
+
+    int32_t high0 = 0;
+    int32_t low0 = 0;
+
+    for (n = 0; n + 3 < N; n += 4) {
+        v4s x0 = *((v4s *)&pSrcX[n]);
+        v4s x1 = *((v4s *)&pSrcX[n + 2]);
+        v4s high = __builtin_shuffle(x0, x1, (v4s){ 1, 3, 5, 7 });
+        v4u low = (v4u)__builtin_shuffle(x0, x1, (v4s){ 0, 2, 4, 6 });
+
+        v4s a0 = *((v4s *)&pA0[n]);
+        high0 = __SUMDOTP4(a0, high, high0);
+        low0 = __SUMDOTPUS4(low, a0, low0);
+    }
+
+    int32_t sum0 = high0 * 256 + low0;
+
+    /* remaining values of N */
+    for (; n < N; n++) {
+        int32_t x = pSrcX[n];
+        sum0 += pA0[n] * x;
+    }
+
+    pDst[0] = sum0;
+}
+
+/**
+  @brief      Parallel matrix-vector multiplication of 8-bit integer weights and 16-bit integer
+              activations kernel for XPULPV2 extension
+  @param[in]  args  pointer to plp_mat_vec_instance_i8i16 struct initialized by
+                    plp_mat_vec_i8i16_parallel
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 16-bit activations are split with shuffles into their high bytes and their low bytes. Four
+  8-bit weights are then multiplied with one __SUMDOTP4 (high bytes) and one __SUMDOTPUS4 (low
+  bytes, unsigned) into 32-bit accumulators, without widening the weights. Four values of y are
+  computed at once, such that every split of x is used four times.
+
+  @par Parallelization
+  Every core computes every nPE-th block of 4 rows, and the remaining rows are split
+  over the cores.
+ */
+
+void plp_mat_vec_i8i16p_xpulpv2(void *args) {
+
+    int core_id = rt_core_id();
+
+    plp_mat_vec_instance_i8i16 *a = (plp_mat_vec_instance_i8i16 *)args;
+
+    const int8_t *__restrict__ pSrcA = a->pSrcA;
+    const int16_t *__restrict__ pSrcX = a->pSrcX;
+    uint32_t M = a->M;
+    uint32_t N = a->N;
+    uint32_t nPE = a->nPE;
+    int32_t *__restrict__ pDstY = a->pDstY;
+
+    uint32_t m;
+
+    /* blocks of 4 rows, interleaved over the cores */
+    for (m = core_id * 4; m + 3 < M; m += nPE * 4) {
+        vec_rows4(pSrcA + m * N, pSrcX, N, pDstY + m);
+    }
+
+    /* remaining rows */
+    for (m = (M & ~3U) + core_id; m < M; m += nPE) {
+        vec_rows1(pSrcA + m * N, pSrcX, N, pDstY + m);
+    }
+}
+
+/**
+  @} end of MatMultMixedKernels group
+ */
@@ -0,0 +1,71 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_vec_i8i16s_rv32im.c
+ * Description:  8-bit x 16-bit matrix-vector multiplication for RV32IM
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatMultMixed
+ */
+
+/**
+  @addtogroup MatMultMixedKernels
+  @{
+ */
+
+/**
+  @brief      Matrix-vector multiplication of 8-bit integer weights and 16-bit integer activations
+              kernel for RV32IM extension
+  @param[in]  pSrcA Points to the weights A of shape MxN
+  @param[in]  pSrcX Points to the activation vector x of length N
+  @param[in]  M     Height of A, number of output channels
+  @param[in]  N     Width of A, length of x
+  @param[out] pDstY Points to the output vector of length M
+  @return     none
+ */
+
+void plp_mat_vec_i8i16s_rv32im(const int8_t *__restrict__ pSrcA,
+                               const int16_t *__restrict__ pSrcX,
+                               uint32_t M,
+                               uint32_t N,
+                               int32_t *__restrict__ pDstY) {
+
+    uint32_t m, n;
+
+    for (m = 0; m < M; m++) {
+        const int8_t *pRow = pSrcA + m * N;
+        int32_t sum = 0;
+        for (n = 0; n < N; n++) {
+            sum += pRow[n] * pSrcX[n];
+        }
+        pDstY[m] = sum;
+    }
+}
+
+/**
+  @} end of MatMultMixedKernels group
+ */
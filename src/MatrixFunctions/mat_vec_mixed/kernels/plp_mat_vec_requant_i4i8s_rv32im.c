@@ -0,0 +1,104 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_vec_requant_i4i8s_rv32im.c
+ * Description:  4-bit x 8-bit requantized matrix-vector multiplication for RV32IM
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatMultMixed
+ */
+
+/**
+  @addtogroup MatMultMixedKernels
+  @{
+ */
+
+/* per-channel requantization: rounding shift of sum * mult + bias, saturated to 8 bits */
+static inline int8_t requant(int32_t sum,
+                             int32_t mult,
+                             int32_t bias,
+                             uint32_t shift) {
+    int32_t value = (sum * mult + bias + (1 << (shift - 1))) >> shift;
+    if (value > 127) {
+        value = 127;
+    } else if (value < -128) {
+        value = -128;
+    }
+    return (int8_t)value;
+}
+
+/**
+  @brief      Requantized matrix-vector multiplication of 4-bit integer weights and 8-bit integer
+              activations kernel for RV32IM extension
+  @param[in]  pSrcA Points to the 4-bit weights A of shape MxN, packed two per byte
+  @param[in]  pSrcX Points to the activation vector x of length N
+  @param[in]  M     Height of A, number of output channels
+  @param[in]  N     Width of A, length of x
+  @param[in]  pMult Points to the M multipliers, one per output channel
+  @param[in]  pBias Points to the M biases, added after the multiplication
+  @param[in]  shift Amount to shift the requantized values to the right, at least 1
+  @param[out] pDstY Points to the output vector of length M
+  @return     none
+
+  @par Requantization
+  Every output of the output channel m (row m of A) is requantized to 8 bits:
+  `round((sum * pMult[m] + pBias[m]) / 2^shift)`, saturated. `sum * pMult[m] + pBias[m]`
+  must fit into 32 bits.
+ */
+
+void plp_mat_vec_requant_i4i8s_rv32im(const int8_t *__restrict__ pSrcA,
+                                      const int8_t *__restrict__ pSrcX,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      const int32_t *__restrict__ pMult,
+                                      const int32_t *__restrict__ pBias,
+                                      uint32_t shift,
+                                      int8_t *__restrict__ pDstY) {
+
+    uint32_t m, n;
+
+    /* every row of A starts with a new byte */
+    uint32_t rowBytes = (N + 1) / 2;
+
+    for (m = 0; m < M; m++) {
+        const int8_t *pRow = pSrcA + m * rowBytes;
+        int32_t sum = 0;
+        for (n = 0; n + 1 < N; n += 2) {
+            uint32_t byte = (uint8_t)pRow[n / 2];
+            sum += ((int8_t)(byte << 4) >> 4) * pSrcX[n];
+            sum += ((int8_t)byte >> 4) * pSrcX[(n + 1)];
+        }
+        if (n < N) {
+            sum += ((int8_t)((uint8_t)pRow[n / 2] << 4) >> 4) * pSrcX[n];
+        }
+        pDstY[m] = requant(sum, pMult[m], pBias[m], shift);
+    }
+}
+
+/**
+  @} end of MatMultMixedKernels group
+ */
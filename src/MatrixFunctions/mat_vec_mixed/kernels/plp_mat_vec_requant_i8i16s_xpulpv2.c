@@ -0,0 +1,202 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_vec_requant_i8i16s_xpulpv2.c
+ * Description:  8-bit x 16-bit requantized matrix-vector multiplication for XPULPV2
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatMultMixed
+ */
+
+/**
+  @addtogroup MatMultMixedKernels
+  @{
+ */
+
+/* per-channel requantization: rounding shift of sum * mult + bias, saturated to 16 bits */
+static inline int16_t requant(int32_t sum,
+                              int32_t mult,
+                              int32_t bias,
+                              uint32_t shift) {
+    return (int16_t)__CLIP(__ROUNDNORM_REG(sum * mult + bias, shift), 15);
+}
+
+/* The 16-bit activations are split into their high byte (signed) and their low byte
+   (unsigned), such that four 8-bit weights are multiplied with one __SUMDOTP4 and one
+   __SUMDOTPUS4, and the sum is high * 256 + low. */
+
+/* 4 values of y, starting at the row pA of A and the value pDst of y, pMult and pBias point
+   to the factors of the first row */
+static inline void vec_rows4(const int8_t *__restrict__ pA,
+                             const int16_t *__restrict__ pSrcX,
+                             uint32_t N,
+                             const int32_t *__restrict__ pMult,
+                             const int32_t *__restrict__ pBias,
+                             uint32_t shift,
+                             int16_t *__restrict__ pDst) {
+    const int8_t *pA0 = pA;
+    const int8_t *pA1 = pA0 + N;
+    const int8_t *pA2 = pA1 + N;
+    const int8_t *pA3 = pA2 + N;
+    uint32_t n;
+
+    int32_t high0 = 0;
+    int32_t high1 = 0;
+    int32_t high2 = 0;
+    int32_t high3 = 0;
+    int32_t low0 = 0;
+    int32_t low1 = 0;
+    int32_t low2 = 0;
+    int32_t low3 = 0;
+
+    for (n = 0; n + 3 < N; n += 4) {
+        v4s x0 = *((v4s *)&pSrcX[n]);
+        v4s x1 = *((v4s *)&pSrcX[n + 2]);
+        v4s high = __builtin_shuffle(x0, x1, (v4s){ 1, 3, 5, 7 });
+        v4u low = (v4u)__builtin_shuffle(x0, x1, (v4s){ 0, 2, 4, 6 });
+
+        v4s a0 = *((v4s *)&pA0[n]);
+        v4s a1 = *((v4s *)&pA1[n]);
+        v4s a2 = *((v4s *)&pA2[n]);
+        v4s a3 = *((v4s *)&pA3[n]);
+        high0 = __SUMDOTP4(a0, high, high0);
+        low0 = __SUMDOTPUS4(low, a0, low0);
+        high1 = __SUMDOTP4(a1, high, high1);
+        low1 = __SUMDOTPUS4(low, a1, low1);
+        high2 = __SUMDOTP4(a2, high, high2);
+        low2 = __SUMDOTPUS4(low, a2, low2);
+        high3 = __SUMDOTP4(a3, high, high3);
+        low3 = __SUMDOTPUS4(low, a3, low3);
+    }
+
+    int32_t sum0 = high0 * 256 + low0;
+    int32_t sum1 = high1 * 256 + low1;
+    int32_t sum2 = high2 * 256 + low2;
+    int32_t sum3 = high3 * 256 + low3;
+
+    /* remaining values of N */
+    for (; n < N; n++) {
+        int32_t x = pSrcX[n];
+        sum0 += pA0[n] * x;
+        sum1 += pA1[n] * x;
+        sum2 += pA2[n] * x;
+        sum3 += pA3[n] * x;
+    }
+
+    pDst[0] = requant(sum0, pMult[0], pBias[0], shift);
+    pDst[1] = requant(sum1, pMult[1], pBias[1], shift);
+    pDst[2] = requant(sum2, pMult[2], pBias[2], shift);
+    pDst[3] = requant(sum3, pMult[3], pBias[3], shift);
+}
+
+/* one value of y, starting at the row pA of A and the value pDst of y, pMult and pBias point
+   to the factors of the first row */
+static inline void vec_rows1(const int8_t *__restrict__ pA,
+                             const int16_t *__restrict__ pSrcX,
+                             uint32_t N,
+                             const int32_t *__restrict__ pMult,
+                             const int32_t *__restrict__ pBias,
+                             uint32_t shift,
+                             int16_t *__restrict__ pDst) {
+    const int8_t *pA0 = pA;
+    uint32_t n;
+
+    int32_t high0 = 0;
+    int32_t low0 = 0;
+
+    for (n = 0; n + 3 < N; n += 4) {
+        v4s x0 = *((v4s *)&pSrcX[n]);
+        v4s x1 = *((v4s *)&pSrcX[n + 2]);
+        v4s high = __builtin_shuffle(x0, x1, (v4s){ 1, 3, 5, 7 });
+        v4u low = (v4u)__builtin_shuffle(x0, x1, (v4s){ 0, 2, 4, 6 });
+
+        v4s a0 = *((v4s *)&pA0[n]);
+        high0 = __SUMDOTP4(a0, high, high0);
+        low0 = __SUMDOTPUS4(low, a0, low0);
+    }
+
+    int32_t sum0 = high0 * 256 + low0;
+
+    /* remaining values of N */
+    for (; n < N; n++) {
+        int32_t x = pSrcX[n];
+        sum0 += pA0[n] * x;
+    }
+
+    pDst[0] = requant(sum0, pMult[0], pBias[0], shift);
+}
+
+/**
+  @brief      Requantized matrix-vector multiplication of 8-bit integer weights and 16-bit integer
+              activations kernel for XPULPV2 extension
+  @param[in]  pSrcA Points to the weights A of shape MxN
+  @param[in]  pSrcX Points to the activation vector x of length N
+  @param[in]  M     Height of A, number of output channels
+  @param[in]  N     Width of A, length of x
+  @param[in]  pMult Points to the M multipliers, one per output channel
+  @param[in]  pBias Points to the M biases, added after the multiplication
+  @param[in]  shift Amount to shift the requantized values to the right, at least 1
+  @param[out] pDstY Points to the output vector of length M
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 16-bit activations are split with shuffles into their high bytes and their low bytes. Four
+  8-bit weights are then multiplied with one __SUMDOTP4 (high bytes) and one __SUMDOTPUS4 (low
+  bytes, unsigned) into 32-bit accumulators, without widening the weights. Four values of y are
+  computed at once, such that every split of x is used four times.
+
+  @par Requantization
+  Every output of the output channel m (row m of A) is requantized to 16 bits:
+  `round((sum * pMult[m] + pBias[m]) / 2^shift)`, saturated. `sum * pMult[m] + pBias[m]`
+  must fit into 32 bits.
+ */
+
+void plp_mat_vec_requant_i8i16s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                        const int16_t *__restrict__ pSrcX,
+                                        uint32_t M,
+                                        uint32_t N,
+                                        const int32_t *__restrict__ pMult,
+                                        const int32_t *__restrict__ pBias,
+                                        uint32_t shift,
+                                        int16_t *__restrict__ pDstY) {
+
+    uint32_t m;
+
+    /* blocks of 4 rows */
+    for (m = 0; m + 3 < M; m += 4) {
+        vec_rows4(pSrcA + m * N, pSrcX, N, pMult + m, pBias + m, shift, pDstY + m);
+    }
+
+    /* remaining rows */
+    for (; m < M; m++) {
+        vec_rows1(pSrcA + m * N, pSrcX, N, pMult + m, pBias + m, shift, pDstY + m);
+    }
+}
+
+/**
+  @} end of MatMultMixedKernels group
+ */
@@ -0,0 +1,131 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_vec_toeplitz_f32p_xpulpv2.c
+ * Description:  parallel 32-bit floating-point Toeplitz matrix-vector multiplication for XPULPV2
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatMultStruct
+ */
+
+/**
+  @addtogroup MatMultStructKernels
+  @{
+ */
+
+/* rows m0 to m1 - 1 of y. T[m, n] = pSrcT[m - n + N - 1], so the values of four consecutive rows
+   in column n are pSrcT[k - n] to pSrcT[k - n + 3] with k = m + N - 1. Going to the next column,
+   the window moves down by one value, which is the only one that needs to be loaded. */
+static inline void toeplitz_rows(const float *__restrict__ pSrcT,
+                                 const float *__restrict__ pSrcX,
+                                 uint32_t N,
+                                 uint32_t m0,
+                                 uint32_t m1,
+                                 float *__restrict__ pDstY) {
+    uint32_t m, n;
+
+    /* blocks of four rows */
+    for (m = m0; m + 3 < m1; m += 4) {
+        uint32_t k = m + N - 1; // index of T[m, 0]
+        float t1 = pSrcT[k + 1];
+        float t2 = pSrcT[k + 2];
+        float t3 = pSrcT[k + 3];
+        float sum0 = 0;
+        float sum1 = 0;
+        float sum2 = 0;
+        float sum3 = 0;
+        for (n = 0; n < N; n++) {
+            float t0 = pSrcT[k - n];
+            float x = pSrcX[n];
+            sum0 += t0 * x;
+            sum1 += t1 * x;
+            sum2 += t2 * x;
+            sum3 += t3 * x;
+            t3 = t2;
+            t2 = t1;
+            t1 = t0;
+        }
+        pDstY[m + 0] = sum0;
+        pDstY[m + 1] = sum1;
+        pDstY[m + 2] = sum2;
+        pDstY[m + 3] = sum3;
+    }
+
+    /* remaining rows */
+    for (; m < m1; m++) {
+        uint32_t k = m + N - 1;
+        float sum = 0;
+        for (n = 0; n < N; n++) {
+            sum += pSrcT[k - n] * pSrcX[n];
+        }
+        pDstY[m] = sum;
+    }
+}
+
+/**
+  @brief      Parallel Toeplitz matrix-vector multiplication of 32-bit floats kernel for XPULPV2
+              extension
+  @param[in]  args  pointer to plp_mat_vec_toeplitz_instance_f32 struct initialized by
+                    plp_mat_vec_toeplitz_f32_parallel
+  @return     none
+
+  @par Blocking
+  Four rows are computed at once. The values of the four rows in one column are a
+  window of pSrcT, which moves by one value per column, so every column needs one load
+  of the Toeplitz values and one of x for four multiply-accumulates.
+
+  @par Parallelization
+  Every core computes a contiguous range of rows, a multiple of four, such that the
+  window of the Toeplitz values can be used for the whole range.
+ */
+
+void plp_mat_vec_toeplitz_f32p_xpulpv2(void *args) {
+
+    int core_id = rt_core_id();
+
+    plp_mat_vec_toeplitz_instance_f32 *a = (plp_mat_vec_toeplitz_instance_f32 *)args;
+
+    const float *__restrict__ pSrcT = a->pSrcT;
+    const float *__restrict__ pSrcX = a->pSrcX;
+    uint32_t M = a->M;
+    uint32_t N = a->N;
+    uint32_t nPE = a->nPE;
+    float *__restrict__ pDstY = a->pDstY;
+
+    /* contiguous rows per core, a multiple of four */
+    uint32_t chunk = ((M + nPE - 1) / nPE + 3) & ~3U;
+    uint32_t m0 = core_id * chunk;
+    uint32_t m1 = m0 + chunk < M ? m0 + chunk : M;
+
+    if (m0 < M) {
+        toeplitz_rows(pSrcT, pSrcX, N, m0, m1, pDstY);
+    }
+}
+
+/**
+  @} end of MatMultStructKernels group
+ */
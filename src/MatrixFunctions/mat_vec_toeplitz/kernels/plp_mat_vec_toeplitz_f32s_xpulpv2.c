@@ -0,0 +1,115 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_vec_toeplitz_f32s_xpulpv2.c
+ * Description:  32-bit floating-point Toeplitz matrix-vector multiplication for XPULPV2
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatMultStruct
+ */
+
+/**
+  @addtogroup MatMultStructKernels
+  @{
+ */
+
+/* rows m0 to m1 - 1 of y. T[m, n] = pSrcT[m - n + N - 1], so the values of four consecutive rows
+   in column n are pSrcT[k - n] to pSrcT[k - n + 3] with k = m + N - 1. Going to the next column,
+   the window moves down by one value, which is the only one that needs to be loaded. */
+static inline void toeplitz_rows(const float *__restrict__ pSrcT,
+                                 const float *__restrict__ pSrcX,
+                                 uint32_t N,
+                                 uint32_t m0,
+                                 uint32_t m1,
+                                 float *__restrict__ pDstY) {
+    uint32_t m, n;
+
+    /* blocks of four rows */
+    for (m = m0; m + 3 < m1; m += 4) {
+        uint32_t k = m + N - 1; // index of T[m, 0]
+        float t1 = pSrcT[k + 1];
+        float t2 = pSrcT[k + 2];
+        float t3 = pSrcT[k + 3];
+        float sum0 = 0;
+        float sum1 = 0;
+        float sum2 = 0;
+        float sum3 = 0;
+        for (n = 0; n < N; n++) {
+            float t0 = pSrcT[k - n];
+            float x = pSrcX[n];
+            sum0 += t0 * x;
+            sum1 += t1 * x;
+            sum2 += t2 * x;
+            sum3 += t3 * x;
+            t3 = t2;
+            t2 = t1;
+            t1 = t0;
+        }
+        pDstY[m + 0] = sum0;
+        pDstY[m + 1] = sum1;
+        pDstY[m + 2] = sum2;
+        pDstY[m + 3] = sum3;
+    }
+
+    /* remaining rows */
+    for (; m < m1; m++) {
+        uint32_t k = m + N - 1;
+        float sum = 0;
+        for (n = 0; n < N; n++) {
+            sum += pSrcT[k - n] * pSrcX[n];
+        }
+        pDstY[m] = sum;
+    }
+}
+
+/**
+  @brief      Toeplitz matrix-vector multiplication of 32-bit floats kernel for XPULPV2 extension
+  @param[in]  pSrcT Points to the M + N - 1 values of the diagonals, T[m, n] = pSrcT[m - n + N - 1]
+  @param[in]  pSrcX Points to the input vector of length N
+  @param[in]  M     Height of the Toeplitz matrix
+  @param[in]  N     Width of the Toeplitz matrix
+  @param[out] pDstY Points to the output vector of length M
+  @return     none
+
+  @par Blocking
+  Four rows are computed at once. The values of the four rows in one column are a
+  window of pSrcT, which moves by one value per column, so every column needs one load
+  of the Toeplitz values and one of x for four multiply-accumulates.
+ */
+
+void plp_mat_vec_toeplitz_f32s_xpulpv2(const float *__restrict__ pSrcT,
+                                       const float *__restrict__ pSrcX,
+                                       uint32_t M,
+                                       uint32_t N,
+                                       float *__restrict__ pDstY) {
+
+    toeplitz_rows(pSrcT, pSrcX, N, 0, M, pDstY);
+}
+
+/**
+  @} end of MatMultStructKernels group
+ */
@@ -0,0 +1,127 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_vec_toeplitz_q16s_rv32im.c
+ * Description:  16-bit fix-point Toeplitz matrix-vector multiplication for RV32IM
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatMultStruct
+ */
+
+/**
+  @addtogroup MatMultStructKernels
+  @{
+ */
+
+/* rows m0 to m1 - 1 of y. T[m, n] = pSrcT[m - n + N - 1], so the values of four consecutive rows
+   in column n are pSrcT[k - n] to pSrcT[k - n + 3] with k = m + N - 1. Going to the next column,
+   the window moves down by one value, which is the only one that needs to be loaded. */
+static inline void toeplitz_rows(const int16_t *__restrict__ pSrcT,
+                                 const int16_t *__restrict__ pSrcX,
+                                 uint32_t N,
+                                 uint32_t m0,
+                                 uint32_t m1,
+                                 uint32_t shift,
+                                 int16_t *__restrict__ pDstY) {
+    int32_t round = 1 << (shift - 1);
+
+    uint32_t m, n;
+
+    /* blocks of four rows */
+    for (m = m0; m + 3 < m1; m += 4) {
+        uint32_t k = m + N - 1; // index of T[m, 0]
+        int32_t t1 = (int32_t)pSrcT[k + 1];
+        int32_t t2 = (int32_t)pSrcT[k + 2];
+        int32_t t3 = (int32_t)pSrcT[k + 3];
+        int32_t sum0 = 0;
+        int32_t sum1 = 0;
+        int32_t sum2 = 0;
+        int32_t sum3 = 0;
+        for (n = 0; n < N; n++) {
+            int32_t t0 = (int32_t)pSrcT[k - n];
+            int32_t x = (int32_t)pSrcX[n];
+            sum0 += (t0 * x + round) >> shift;
+            sum1 += (t1 * x + round) >> shift;
+            sum2 += (t2 * x + round) >> shift;
+            sum3 += (t3 * x + round) >> shift;
+            t3 = t2;
+            t2 = t1;
+            t1 = t0;
+        }
+        pDstY[m + 0] = (int16_t)sum0;
+        pDstY[m + 1] = (int16_t)sum1;
+        pDstY[m + 2] = (int16_t)sum2;
+        pDstY[m + 3] = (int16_t)sum3;
+    }
+
+    /* remaining rows */
+    for (; m < m1; m++) {
+        uint32_t k = m + N - 1;
+        int32_t sum = 0;
+        for (n = 0; n < N; n++) {
+            sum += ((int32_t)pSrcT[k - n] * pSrcX[n] + round) >> shift;
+        }
+        pDstY[m] = (int16_t)sum;
+    }
+}
+
+/**
+  @brief      Toeplitz matrix-vector multiplication of 16-bit fix-point numbers kernel for RV32IM
+              extension
+  @param[in]  pSrcT Points to the M + N - 1 values of the diagonals, T[m, n] = pSrcT[m - n + N - 1]
+  @param[in]  pSrcX Points to the input vector of length N
+  @param[in]  M     Height of the Toeplitz matrix
+  @param[in]  N     Width of the Toeplitz matrix
+  @param[in]  shift Amount to shift the result of each multiplication
+  @param[out] pDstY Points to the output vector of length M
+  @return     none
+
+  @par Blocking
+  Four rows are computed at once. The values of the four rows in one column are a
+  window of pSrcT, which moves by one value per column, so every column needs one load
+  of the Toeplitz values and one of x for four multiply-accumulates.
+
+  @par Fix-Point and Shifting
+  Every product is shifted by `shift` to the right with rounding and the sum is stored
+  with 16 bits, exactly like in plp_mat_mult_q16. If A is represented as `pSrcA * 2^-x`
+  and B as `pSrcB * 2^-y`, C is represented as `pDstC * 2^-(x + y - shift)`. Set `shift`
+  such that no overflow occurs.
+ */
+
+void plp_mat_vec_toeplitz_q16s_rv32im(const int16_t *__restrict__ pSrcT,
+                                      const int16_t *__restrict__ pSrcX,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t shift,
+                                      int16_t *__restrict__ pDstY) {
+
+    toeplitz_rows(pSrcT, pSrcX, N, 0, M, shift, pDstY);
+}
+
+/**
+  @} end of MatMultStructKernels group
+ */
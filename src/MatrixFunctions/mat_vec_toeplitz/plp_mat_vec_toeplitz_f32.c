@@ -0,0 +1,68 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_vec_toeplitz_f32.c
+ * Description:  32-bit floating-point Toeplitz matrix-vector multiplication glue code
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatMultStruct
+  @{
+ */
+
+/**
+  @brief      Glue code for Toeplitz matrix-vector multiplication of 32-bit floats
+  @param[in]  pSrcT Points to the M + N - 1 values of the diagonals, T[m, n] = pSrcT[m - n + N - 1]
+  @param[in]  pSrcX Points to the input vector of length N
+  @param[in]  M     Height of the Toeplitz matrix
+  @param[in]  N     Width of the Toeplitz matrix
+  @param[out] pDstY Points to the output vector of length M
+  @return     none
+ */
+
+void plp_mat_vec_toeplitz_f32(const float *__restrict__ pSrcT,
+                              const float *__restrict__ pSrcX,
+                              uint32_t M,
+                              uint32_t N,
+                              float *__restrict__ pDstY) {
+
+    PLP_PROFILE_FUNC();
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return;
+    } else {
+        plp_mat_vec_toeplitz_f32s_xpulpv2(pSrcT, pSrcX, M, N, pDstY);
+    }
+}
+
+/**
+  @} end of MatMultStruct group
+ */
@@ -0,0 +1,124 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_spmat_bcsr_from_dense_i16.c
+ * Description:  16-bit integer dense to BCSR matrix conversion
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup SparseMatrix
+  @{
+ */
+
+/**
+  @brief      Conversion of a dense 16-bit integer matrix to the BCSR format
+  @param[in]  pSrc      Points to the dense input matrix of shape MxN
+  @param[in]  M         Height of the matrix, a multiple of blkRows
+  @param[in]  N         Width of the matrix, a multiple of 4
+  @param[in]  blkRows   Number of rows of a block, 1 or 4
+  @param[in]  maxBlocks Number of blocks pValues and pColIdx can hold
+  @param[out] pValues   Points to the buffer for the values of the blocks
+  @param[out] pColIdx   Points to the buffer for the block columns
+  @param[out] pRowPtr   Points to the buffer for the M / blkRows + 1 row pointers
+  @param[out] pDst      Points to the sparse matrix, which refers to the buffers
+  @return     0: Success, 1: Unsupported shape or more than maxBlocks nonzero blocks
+
+  pValues must hold blkRows * 4 values per block. For a supported shape, pRowPtr is
+  always filled completely, so after a failure pRowPtr[M / blkRows] is the number of
+  nonzero blocks.
+ */
+
+int plp_spmat_bcsr_from_dense_i16(const int16_t *__restrict__ pSrc,
+                                  uint32_t M,
+                                  uint32_t N,
+                                  uint32_t blkRows,
+                                  uint32_t maxBlocks,
+                                  int16_t *__restrict__ pValues,
+                                  uint16_t *__restrict__ pColIdx,
+                                  uint32_t *__restrict__ pRowPtr,
+                                  plp_spmat_bcsr_i16 *pDst) {
+
+    PLP_PROFILE_FUNC();
+
+    uint32_t r; // loop counter for the block rows
+    uint32_t c; // loop counter for the block columns
+    uint32_t i; // loop counter for the rows of a block
+    uint32_t k; // loop counter for the columns of a block
+    uint32_t numBlocks = 0;
+    uint32_t numBlkRows;
+
+    if ((blkRows != 1 && blkRows != 4) || (M % blkRows) != 0 || (N % 4) != 0 || N / 4 > 65536) {
+        return 1;
+    }
+
+    numBlkRows = M / blkRows;
+
+    for (r = 0; r < numBlkRows; r++) {
+        pRowPtr[r] = numBlocks;
+        for (c = 0; c < N / 4; c++) {
+            const int16_t *pBlk = &pSrc[r * blkRows * N + c * 4];
+            uint32_t nonzero = 0;
+            for (i = 0; i < blkRows; i++) {
+                for (k = 0; k < 4; k++) {
+                    nonzero |= (pBlk[i * N + k] != 0);
+                }
+            }
+            if (nonzero) {
+                if (numBlocks < maxBlocks) {
+                    for (i = 0; i < blkRows; i++) {
+                        for (k = 0; k < 4; k++) {
+                            pValues[(numBlocks * blkRows + i) * 4 + k] = pBlk[i * N + k];
+                        }
+                    }
+                    pColIdx[numBlocks] = c;
+                }
+                numBlocks++;
+            }
+        }
+    }
+    pRowPtr[numBlkRows] = numBlocks;
+
+    if (numBlocks > maxBlocks) {
+        return 1;
+    }
+
+    pDst->M = M;
+    pDst->N = N;
+    pDst->blkRows = blkRows;
+    pDst->pValues = pValues;
+    pDst->pColIdx = pColIdx;
+    pDst->pRowPtr = pRowPtr;
+
+    return 0;
+}
+
+/**
+  @} end of SparseMatrix group
+ */
@@ -0,0 +1,105 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_spmat_csr_from_dense_i16.c
+ * Description:  16-bit integer dense to CSR matrix conversion
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup SparseMatrix
+  @{
+ */
+
+/**
+  @brief      Conversion of a dense 16-bit integer matrix to the CSR format
+  @param[in]  pSrc    Points to the dense input matrix of shape MxN
+  @param[in]  M       Height of the matrix
+  @param[in]  N       Width of the matrix, at most 65536
+  @param[in]  maxNnz  Number of values pValues and pColIdx can hold
+  @param[out] pValues Points to the buffer for the nonzero values
+  @param[out] pColIdx Points to the buffer for the column indices
+  @param[out] pRowPtr Points to the buffer for the M + 1 row pointers
+  @param[out] pDst    Points to the sparse matrix, which refers to the buffers
+  @return     0: Success, 1: N is too large or there are more than maxNnz nonzero values
+
+  pRowPtr is always filled completely, so after a failure pRowPtr[M] is the
+  number of nonzero values, i.e. the size the buffers need.
+ */
+
+int plp_spmat_csr_from_dense_i16(const int16_t *__restrict__ pSrc,
+                                 uint32_t M,
+                                 uint32_t N,
+                                 uint32_t maxNnz,
+                                 int16_t *__restrict__ pValues,
+                                 uint16_t *__restrict__ pColIdx,
+                                 uint32_t *__restrict__ pRowPtr,
+                                 plp_spmat_csr_i16 *pDst) {
+
+    PLP_PROFILE_FUNC();
+
+    uint32_t m; // loop counter for the rows
+    uint32_t n; // loop counter for the columns
+    uint32_t nnz = 0;
+
+    if (N > 65536) {
+        return 1;
+    }
+
+    for (m = 0; m < M; m++) {
+        pRowPtr[m] = nnz;
+        for (n = 0; n < N; n++) {
+            int16_t value = pSrc[m * N + n];
+            if (value != 0) {
+                if (nnz < maxNnz) {
+                    pValues[nnz] = value;
+                    pColIdx[nnz] = n;
+                }
+                nnz++;
+            }
+        }
+    }
+    pRowPtr[M] = nnz;
+
+    if (nnz > maxNnz) {
+        return 1;
+    }
+
+    pDst->M = M;
+    pDst->N = N;
+    pDst->pValues = pValues;
+    pDst->pColIdx = pColIdx;
+    pDst->pRowPtr = pRowPtr;
+
+    return 0;
+}
+
+/**
+  @} end of SparseMatrix group
+ */
@@ -0,0 +1,80 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_spmat_row_split.c
+ * Description:  Balanced split of sparse matrix rows over the cores
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup SparseMatrix
+  @{
+ */
+
+/**
+  @brief      Split of the rows of a sparse matrix into parts with the same amount of work
+  @param[in]  pRowPtr Points to the M + 1 row pointers of a CSR or BCSR matrix
+  @param[in]  M       Number of (block) rows
+  @param[in]  nPE     Number of parts, i.e. cores
+  @param[in]  k       Index of the part, 0 to nPE
+  @return     First row of part k. Part k has the rows plp_spmat_row_split(.., k) to
+              plp_spmat_row_split(.., k + 1) - 1, part nPE starts at row M.
+
+  The work of a row is its number of nonzero values (or blocks) plus one for the row
+  itself. The parts are found with a binary search on pRowPtr, such that every core
+  can compute its own rows at the start of a parallel kernel.
+ */
+
+uint32_t plp_spmat_row_split(const uint32_t *__restrict__ pRowPtr,
+                             uint32_t M,
+                             uint32_t nPE,
+                             uint32_t k) {
+
+    uint32_t total = pRowPtr[M] - pRowPtr[0] + M; // work of all rows
+    // total * k / nPE without overflow
+    uint32_t target = (total / nPE) * k + ((total % nPE) * k) / nPE;
+    uint32_t lo = 0;
+    uint32_t hi = M;
+
+    // smallest row m where the work of the rows 0 .. m - 1 reaches the target
+    while (lo < hi) {
+        uint32_t mid = (lo + hi) / 2;
+        if (pRowPtr[mid] - pRowPtr[0] + mid < target) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    return lo;
+}
+
+/**
+  @} end of SparseMatrix group
+ */
@@ -0,0 +1,215 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_spmm_bcsr_i16p_xpulpv2.c
+ * Description:  parallel 16-bit integer BCSR sparse matrix-matrix multiplication for XPULPV2
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup SpMM
+ */
+
+/**
+  @addtogroup SpMMKernels
+  @{
+ */
+
+/**
+  @brief      Parallel sparse matrix-dense matrix multiplication for 16-bit integers in BCSR format
+              kernel for XPULPV2 extension
+  @param[in]  args  pointer to plp_spmat_bcsr_mult_instance_i16 struct initialized by
+                    plp_spmm_bcsr_i16_parallel
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The four rows of B selected by a block are loaded for two columns of C and transposed
+  with four shuffles. Every row of the block then takes two __SUMDOTP2 per column, and for
+  blocks of 4x4 values the transposed columns are used for all four rows.
+
+  @par Parallelization
+  The block rows are split with plp_spmat_row_split, such that every core gets about the
+  same number of blocks instead of the same number of rows.
+ */
+
+void plp_spmm_bcsr_i16p_xpulpv2(void *args) {
+
+    plp_spmat_bcsr_mult_instance_i16 *a = (plp_spmat_bcsr_mult_instance_i16 *)args;
+    const plp_spmat_bcsr_i16 *pSrcA = a->pSrcA;
+    const int16_t *__restrict__ pSrcB = a->pSrcB;
+    uint32_t O = a->O;
+    uint32_t nPE = a->nPE;
+    int32_t *__restrict__ pDstC = a->pDstC;
+    const int16_t *pVal = pSrcA->pValues;
+    const uint16_t *pCol = pSrcA->pColIdx;
+    const uint32_t *pRowPtr = pSrcA->pRowPtr;
+    uint32_t blkRows = pSrcA->blkRows;
+    uint32_t numBlkRows = pSrcA->M / blkRows;
+    uint32_t core_id = rt_core_id();
+    uint32_t rStart = plp_spmat_row_split(pRowPtr, numBlkRows, nPE, core_id);
+    uint32_t rEnd = plp_spmat_row_split(pRowPtr, numBlkRows, nPE, core_id + 1);
+
+    uint32_t r; // loop counter for the block rows
+    uint32_t b; // loop counter for the blocks
+    uint32_t i; // loop counter for the rows of a block
+    uint32_t k; // loop counter for the columns of a block
+    uint32_t o; // loop counter for the columns of B and C
+    uint32_t oEnd = O - O % 2; // columns in blocks of 2
+
+    if (blkRows == 1) {
+        for (r = rStart; r < rEnd; r++) {
+            int32_t *pC = &pDstC[r * O];
+
+            for (o = 0; o < oEnd; o += 2) {
+                int32_t sum00 = 0;
+                int32_t sum01 = 0;
+
+                for (b = pRowPtr[r]; b < pRowPtr[r + 1]; b++) {
+                    const int16_t *pA = &pVal[b * 4];
+                    const int16_t *pB = &pSrcB[pCol[b] * 4 * O + o];
+                    v2s temp0 = *((v2s *)&pB[0]); // b00 b01
+                    v2s temp1 = *((v2s *)&pB[O]); // b10 b11
+                    v2s temp2 = *((v2s *)&pB[2 * O]); // b20 b21
+                    v2s temp3 = *((v2s *)&pB[3 * O]); // b30 b31
+
+                    v2s bVec0 = __builtin_shuffle(temp0, temp1, (v2s){ 0, 2 }); // b00 b10
+                    v2s bVec1 = __builtin_shuffle(temp0, temp1, (v2s){ 1, 3 }); // b01 b11
+                    v2s bVec2 = __builtin_shuffle(temp2, temp3, (v2s){ 0, 2 }); // b20 b30
+                    v2s bVec3 = __builtin_shuffle(temp2, temp3, (v2s){ 1, 3 }); // b21 b31
+
+                    v2s aVec00 = *((v2s *)&pA[0]);
+                    v2s aVec01 = *((v2s *)&pA[2]);
+                    sum00 = __SUMDOTP2(aVec00, bVec0, sum00);
+                    sum00 = __SUMDOTP2(aVec01, bVec2, sum00);
+                    sum01 = __SUMDOTP2(aVec00, bVec1, sum01);
+                    sum01 = __SUMDOTP2(aVec01, bVec3, sum01);
+                }
+
+                pC[o] = sum00;
+                pC[o + 1] = sum01;
+            }
+
+            // remaining columns
+            for (o = oEnd; o < O; o++) {
+                for (i = 0; i < blkRows; i++) {
+                    int32_t sum = 0;
+                    for (b = pRowPtr[r]; b < pRowPtr[r + 1]; b++) {
+                        const int16_t *pA = &pVal[(b * blkRows + i) * 4];
+                        const int16_t *pB = &pSrcB[pCol[b] * 4 * O + o];
+                        for (k = 0; k < 4; k++) {
+                            sum += pA[k] * pB[k * O];
+                        }
+                    }
+                    pC[i * O + o] = sum;
+                }
+            }
+        }
+    } else {
+        // the transposed columns of B are used for the four rows of the block
+        for (r = rStart; r < rEnd; r++) {
+            int32_t *pC = &pDstC[r * 4 * O];
+
+            for (o = 0; o < oEnd; o += 2) {
+                int32_t sum00 = 0;
+                int32_t sum01 = 0;
+                int32_t sum10 = 0;
+                int32_t sum11 = 0;
+                int32_t sum20 = 0;
+                int32_t sum21 = 0;
+                int32_t sum30 = 0;
+                int32_t sum31 = 0;
+
+                for (b = pRowPtr[r]; b < pRowPtr[r + 1]; b++) {
+                    const int16_t *pA = &pVal[b * 16];
+                    const int16_t *pB = &pSrcB[pCol[b] * 4 * O + o];
+                    v2s temp0 = *((v2s *)&pB[0]); // b00 b01
+                    v2s temp1 = *((v2s *)&pB[O]); // b10 b11
+                    v2s temp2 = *((v2s *)&pB[2 * O]); // b20 b21
+                    v2s temp3 = *((v2s *)&pB[3 * O]); // b30 b31
+
+                    v2s bVec0 = __builtin_shuffle(temp0, temp1, (v2s){ 0, 2 }); // b00 b10
+                    v2s bVec1 = __builtin_shuffle(temp0, temp1, (v2s){ 1, 3 }); // b01 b11
+                    v2s bVec2 = __builtin_shuffle(temp2, temp3, (v2s){ 0, 2 }); // b20 b30
+                    v2s bVec3 = __builtin_shuffle(temp2, temp3, (v2s){ 1, 3 }); // b21 b31
+
+                    v2s aVec00 = *((v2s *)&pA[0]);
+                    v2s aVec01 = *((v2s *)&pA[2]);
+                    sum00 = __SUMDOTP2(aVec00, bVec0, sum00);
+                    sum00 = __SUMDOTP2(aVec01, bVec2, sum00);
+                    sum01 = __SUMDOTP2(aVec00, bVec1, sum01);
+                    sum01 = __SUMDOTP2(aVec01, bVec3, sum01);
+                    v2s aVec10 = *((v2s *)&pA[4]);
+                    v2s aVec11 = *((v2s *)&pA[6]);
+                    sum10 = __SUMDOTP2(aVec10, bVec0, sum10);
+                    sum10 = __SUMDOTP2(aVec11, bVec2, sum10);
+                    sum11 = __SUMDOTP2(aVec10, bVec1, sum11);
+                    sum11 = __SUMDOTP2(aVec11, bVec3, sum11);
+                    v2s aVec20 = *((v2s *)&pA[8]);
+                    v2s aVec21 = *((v2s *)&pA[10]);
+                    sum20 = __SUMDOTP2(aVec20, bVec0, sum20);
+                    sum20 = __SUMDOTP2(aVec21, bVec2, sum20);
+                    sum21 = __SUMDOTP2(aVec20, bVec1, sum21);
+                    sum21 = __SUMDOTP2(aVec21, bVec3, sum21);
+                    v2s aVec30 = *((v2s *)&pA[12]);
+                    v2s aVec31 = *((v2s *)&pA[14]);
+                    sum30 = __SUMDOTP2(aVec30, bVec0, sum30);
+                    sum30 = __SUMDOTP2(aVec31, bVec2, sum30);
+                    sum31 = __SUMDOTP2(aVec30, bVec1, sum31);
+                    sum31 = __SUMDOTP2(aVec31, bVec3, sum31);
+                }
+
+                pC[o] = sum00;
+                pC[o + 1] = sum01;
+                pC[O + o] = sum10;
+                pC[O + o + 1] = sum11;
+                pC[2 * O + o] = sum20;
+                pC[2 * O + o + 1] = sum21;
+                pC[3 * O + o] = sum30;
+                pC[3 * O + o + 1] = sum31;
+            }
+
+            // remaining columns
+            for (o = oEnd; o < O; o++) {
+                for (i = 0; i < blkRows; i++) {
+                    int32_t sum = 0;
+                    for (b = pRowPtr[r]; b < pRowPtr[r + 1]; b++) {
+                        const int16_t *pA = &pVal[(b * blkRows + i) * 4];
+                        const int16_t *pB = &pSrcB[pCol[b] * 4 * O + o];
+                        for (k = 0; k < 4; k++) {
+                            sum += pA[k] * pB[k * O];
+                        }
+                    }
+                    pC[i * O + o] = sum;
+                }
+            }
+        }
+    }
+
+    rt_team_barrier();
+}
+
+/**
+  @} end of SpMMKernels group
+ */
@@ -0,0 +1,245 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_spmm_bcsr_i8p_xpulpv2.c
+ * Description:  parallel 8-bit integer BCSR sparse matrix-matrix multiplication for XPULPV2
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup SpMM
+ */
+
+/**
+  @addtogroup SpMMKernels
+  @{
+ */
+
+RT_CL_DATA static v4s mask0 = { 0, 1, 4, 5 };
+RT_CL_DATA static v4s mask1 = { 2, 3, 6, 7 };
+RT_CL_DATA static v4s mask2 = { 0, 2, 4, 6 };
+RT_CL_DATA static v4s mask3 = { 1, 3, 5, 7 };
+
+/**
+  @brief      Parallel sparse matrix-dense matrix multiplication for 8-bit integers in BCSR format
+              kernel for XPULPV2 extension
+  @param[in]  args  pointer to plp_spmat_bcsr_mult_instance_i8 struct initialized by
+                    plp_spmm_bcsr_i8_parallel
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The four rows of B selected by a block are loaded for four columns of C and transposed
+  with eight shuffles. Every row of the block then takes one __SUMDOTP4 per column, and
+  for blocks of 4x4 values the transposed columns are used for all four rows.
+
+  @par Parallelization
+  The block rows are split with plp_spmat_row_split, such that every core gets about the
+  same number of blocks instead of the same number of rows.
+ */
+
+void plp_spmm_bcsr_i8p_xpulpv2(void *args) {
+
+    plp_spmat_bcsr_mult_instance_i8 *a = (plp_spmat_bcsr_mult_instance_i8 *)args;
+    const plp_spmat_bcsr_i8 *pSrcA = a->pSrcA;
+    const int8_t *__restrict__ pSrcB = a->pSrcB;
+    uint32_t O = a->O;
+    uint32_t nPE = a->nPE;
+    int32_t *__restrict__ pDstC = a->pDstC;
+    const int8_t *pVal = pSrcA->pValues;
+    const uint16_t *pCol = pSrcA->pColIdx;
+    const uint32_t *pRowPtr = pSrcA->pRowPtr;
+    uint32_t blkRows = pSrcA->blkRows;
+    uint32_t numBlkRows = pSrcA->M / blkRows;
+    uint32_t core_id = rt_core_id();
+    uint32_t rStart = plp_spmat_row_split(pRowPtr, numBlkRows, nPE, core_id);
+    uint32_t rEnd = plp_spmat_row_split(pRowPtr, numBlkRows, nPE, core_id + 1);
+
+    uint32_t r; // loop counter for the block rows
+    uint32_t b; // loop counter for the blocks
+    uint32_t i; // loop counter for the rows of a block
+    uint32_t k; // loop counter for the columns of a block
+    uint32_t o; // loop counter for the columns of B and C
+    uint32_t oEnd = O - O % 4; // columns in blocks of 4
+
+    if (blkRows == 1) {
+        for (r = rStart; r < rEnd; r++) {
+            int32_t *pC = &pDstC[r * O];
+
+            for (o = 0; o < oEnd; o += 4) {
+                int32_t sum00 = 0;
+                int32_t sum01 = 0;
+                int32_t sum02 = 0;
+                int32_t sum03 = 0;
+
+                for (b = pRowPtr[r]; b < pRowPtr[r + 1]; b++) {
+                    const int8_t *pA = &pVal[b * 4];
+                    const int8_t *pB = &pSrcB[pCol[b] * 4 * O + o];
+                    v4s temp0 = *((v4s *)&pB[0]);
+                    v4s temp1 = *((v4s *)&pB[O]);
+                    v4s temp2 = *((v4s *)&pB[2 * O]);
+                    v4s temp3 = *((v4s *)&pB[3 * O]);
+
+                    v4s temp4 = __builtin_shuffle(temp0, temp1, mask0); // b00 b01 b10 b11
+                    v4s temp5 = __builtin_shuffle(temp2, temp3, mask0); // b20 b21 b30 b31
+                    v4s temp6 = __builtin_shuffle(temp0, temp1, mask1); // b02 b03 b12 b13
+                    v4s temp7 = __builtin_shuffle(temp2, temp3, mask1); // b22 b23 b32 b33
+
+                    v4s bVec0 = __builtin_shuffle(temp4, temp5, mask2); // b00 b10 b20 b30
+                    v4s bVec1 = __builtin_shuffle(temp4, temp5, mask3); // b01 b11 b21 b31
+                    v4s bVec2 = __builtin_shuffle(temp6, temp7, mask2); // b02 b12 b22 b32
+                    v4s bVec3 = __builtin_shuffle(temp6, temp7, mask3); // b03 b13 b23 b33
+
+                    v4s aVec0 = *((v4s *)&pA[0]);
+                    sum00 = __SUMDOTP4(aVec0, bVec0, sum00);
+                    sum01 = __SUMDOTP4(aVec0, bVec1, sum01);
+                    sum02 = __SUMDOTP4(aVec0, bVec2, sum02);
+                    sum03 = __SUMDOTP4(aVec0, bVec3, sum03);
+                }
+
+                pC[o] = sum00;
+                pC[o + 1] = sum01;
+                pC[o + 2] = sum02;
+                pC[o + 3] = sum03;
+            }
+
+            // remaining columns
+            for (o = oEnd; o < O; o++) {
+                for (i = 0; i < blkRows; i++) {
+                    int32_t sum = 0;
+                    for (b = pRowPtr[r]; b < pRowPtr[r + 1]; b++) {
+                        const int8_t *pA = &pVal[(b * blkRows + i) * 4];
+                        const int8_t *pB = &pSrcB[pCol[b] * 4 * O + o];
+                        for (k = 0; k < 4; k++) {
+                            sum += pA[k] * pB[k * O];
+                        }
+                    }
+                    pC[i * O + o] = sum;
+                }
+            }
+        }
+    } else {
+        // the transposed columns of B are used for the four rows of the block
+        for (r = rStart; r < rEnd; r++) {
+            int32_t *pC = &pDstC[r * 4 * O];
+
+            for (o = 0; o < oEnd; o += 4) {
+                int32_t sum00 = 0;
+                int32_t sum01 = 0;
+                int32_t sum02 = 0;
+                int32_t sum03 = 0;
+                int32_t sum10 = 0;
+                int32_t sum11 = 0;
+                int32_t sum12 = 0;
+                int32_t sum13 = 0;
+                int32_t sum20 = 0;
+                int32_t sum21 = 0;
+                int32_t sum22 = 0;
+                int32_t sum23 = 0;
+                int32_t sum30 = 0;
+                int32_t sum31 = 0;
+                int32_t sum32 = 0;
+                int32_t sum33 = 0;
+
+                for (b = pRowPtr[r]; b < pRowPtr[r + 1]; b++) {
+                    const int8_t *pA = &pVal[b * 16];
+                    const int8_t *pB = &pSrcB[pCol[b] * 4 * O + o];
+                    v4s temp0 = *((v4s *)&pB[0]);
+                    v4s temp1 = *((v4s *)&pB[O]);
+                    v4s temp2 = *((v4s *)&pB[2 * O]);
+                    v4s temp3 = *((v4s *)&pB[3 * O]);
+
+                    v4s temp4 = __builtin_shuffle(temp0, temp1, mask0); // b00 b01 b10 b11
+                    v4s temp5 = __builtin_shuffle(temp2, temp3, mask0); // b20 b21 b30 b31
+                    v4s temp6 = __builtin_shuffle(temp0, temp1, mask1); // b02 b03 b12 b13
+                    v4s temp7 = __builtin_shuffle(temp2, temp3, mask1); // b22 b23 b32 b33
+
+                    v4s bVec0 = __builtin_shuffle(temp4, temp5, mask2); // b00 b10 b20 b30
+                    v4s bVec1 = __builtin_shuffle(temp4, temp5, mask3); // b01 b11 b21 b31
+                    v4s bVec2 = __builtin_shuffle(temp6, temp7, mask2); // b02 b12 b22 b32
+                    v4s bVec3 = __builtin_shuffle(temp6, temp7, mask3); // b03 b13 b23 b33
+
+                    v4s aVec0 = *((v4s *)&pA[0]);
+                    sum00 = __SUMDOTP4(aVec0, bVec0, sum00);
+                    sum01 = __SUMDOTP4(aVec0, bVec1, sum01);
+                    sum02 = __SUMDOTP4(aVec0, bVec2, sum02);
+                    sum03 = __SUMDOTP4(aVec0, bVec3, sum03);
+                    v4s aVec1 = *((v4s *)&pA[4]);
+                    sum10 = __SUMDOTP4(aVec1, bVec0, sum10);
+                    sum11 = __SUMDOTP4(aVec1, bVec1, sum11);
+                    sum12 = __SUMDOTP4(aVec1, bVec2, sum12);
+                    sum13 = __SUMDOTP4(aVec1, bVec3, sum13);
+                    v4s aVec2 = *((v4s *)&pA[8]);
+                    sum20 = __SUMDOTP4(aVec2, bVec0, sum20);
+                    sum21 = __SUMDOTP4(aVec2, bVec1, sum21);
+                    sum22 = __SUMDOTP4(aVec2, bVec2, sum22);
+                    sum23 = __SUMDOTP4(aVec2, bVec3, sum23);
+                    v4s aVec3 = *((v4s *)&pA[12]);
+                    sum30 = __SUMDOTP4(aVec3, bVec0, sum30);
+                    sum31 = __SUMDOTP4(aVec3, bVec1, sum31);
+                    sum32 = __SUMDOTP4(aVec3, bVec2, sum32);
+                    sum33 = __SUMDOTP4(aVec3, bVec3, sum33);
+                }
+
+                pC[o] = sum00;
+                pC[o + 1] = sum01;
+                pC[o + 2] = sum02;
+                pC[o + 3] = sum03;
+                pC[O + o] = sum10;
+                pC[O + o + 1] = sum11;
+                pC[O + o + 2] = sum12;
+                pC[O + o + 3] = sum13;
+                pC[2 * O + o] = sum20;
+                pC[2 * O + o + 1] = sum21;
+                pC[2 * O + o + 2] = sum22;
+                pC[2 * O + o + 3] = sum23;
+                pC[3 * O + o] = sum30;
+                pC[3 * O + o + 1] = sum31;
+                pC[3 * O + o + 2] = sum32;
+                pC[3 * O + o + 3] = sum33;
+            }
+
+            // remaining columns
+            for (o = oEnd; o < O; o++) {
+                for (i = 0; i < blkRows; i++) {
+                    int32_t sum = 0;
+                    for (b = pRowPtr[r]; b < pRowPtr[r + 1]; b++) {
+                        const int8_t *pA = &pVal[(b * blkRows + i) * 4];
+                        const int8_t *pB = &pSrcB[pCol[b] * 4 * O + o];
+                        for (k = 0; k < 4; k++) {
+                            sum += pA[k] * pB[k * O];
+                        }
+                    }
+                    pC[i * O + o] = sum;
+                }
+            }
+        }
+    }
+
+    rt_team_barrier();
+}
+
+/**
+  @} end of SpMMKernels group
+ */
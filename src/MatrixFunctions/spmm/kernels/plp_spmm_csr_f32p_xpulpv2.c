@@ -0,0 +1,118 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_spmm_csr_f32p_xpulpv2.c
+ * Description:  parallel 32-bit floating-point CSR sparse matrix-matrix multiplication for XPULPV2
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup SpMM
+ */
+
+/**
+  @addtogroup SpMMKernels
+  @{
+ */
+
+/**
+  @brief      Parallel sparse matrix-dense matrix multiplication for 32-bit floats in CSR format
+              kernel for XPULPV2 extension
+  @param[in]  args  pointer to plp_spmat_csr_mult_instance_f32 struct initialized by
+                    plp_spmm_csr_f32_parallel
+  @return     none
+
+  @par Blocking
+  Four columns of C are computed at once, such that the value and the column index
+  of every nonzero value are loaded once for four multiply-accumulates.
+
+  @par Parallelization
+  The rows are split with plp_spmat_row_split, such that every core gets about the same
+  number of nonzero values instead of the same number of rows.
+ */
+
+void plp_spmm_csr_f32p_xpulpv2(void *args) {
+
+    plp_spmat_csr_mult_instance_f32 *a = (plp_spmat_csr_mult_instance_f32 *)args;
+    const plp_spmat_csr_f32 *pSrcA = a->pSrcA;
+    const float *__restrict__ pSrcB = a->pSrcB;
+    uint32_t O = a->O;
+    uint32_t nPE = a->nPE;
+    float *__restrict__ pDstC = a->pDstC;
+    const float *pVal = pSrcA->pValues;
+    const uint16_t *pCol = pSrcA->pColIdx;
+    const uint32_t *pRowPtr = pSrcA->pRowPtr;
+    uint32_t M = pSrcA->M;
+    uint32_t core_id = rt_core_id();
+    uint32_t mStart = plp_spmat_row_split(pRowPtr, M, nPE, core_id);
+    uint32_t mEnd = plp_spmat_row_split(pRowPtr, M, nPE, core_id + 1);
+
+    uint32_t m; // loop counter for the rows of A and C
+    uint32_t j; // loop counter for the nonzero values
+    uint32_t o; // loop counter for the columns of B and C
+    uint32_t oEnd = O - O % 4; // columns in blocks of 4
+
+    for (m = mStart; m < mEnd; m++) {
+        uint32_t jStart = pRowPtr[m];
+        uint32_t jEnd = pRowPtr[m + 1];
+        float *pC = &pDstC[m * O];
+
+        for (o = 0; o < oEnd; o += 4) {
+            float sum0 = 0.0f;
+            float sum1 = 0.0f;
+            float sum2 = 0.0f;
+            float sum3 = 0.0f;
+
+            for (j = jStart; j < jEnd; j++) {
+                const float *pB = &pSrcB[pCol[j] * O + o];
+                float a = pVal[j];
+                sum0 += a * pB[0];
+                sum1 += a * pB[1];
+                sum2 += a * pB[2];
+                sum3 += a * pB[3];
+            }
+
+            pC[o] = sum0;
+            pC[o + 1] = sum1;
+            pC[o + 2] = sum2;
+            pC[o + 3] = sum3;
+        }
+
+        // remaining columns
+        for (o = oEnd; o < O; o++) {
+            float sum = 0.0f;
+            for (j = jStart; j < jEnd; j++) {
+                sum += pVal[j] * pSrcB[pCol[j] * O + o];
+            }
+            pC[o] = sum;
+        }
+    }
+
+    rt_team_barrier();
+}
+
+/**
+  @} end of SpMMKernels group
+ */
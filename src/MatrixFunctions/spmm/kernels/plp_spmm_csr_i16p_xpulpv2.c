@@ -0,0 +1,140 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_spmm_csr_i16p_xpulpv2.c
+ * Description:  parallel 16-bit integer CSR sparse matrix-matrix multiplication for XPULPV2
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup SpMM
+ */
+
+/**
+  @addtogroup SpMMKernels
+  @{
+ */
+
+/**
+  @brief      Parallel sparse matrix-dense matrix multiplication for 16-bit integers in CSR format
+              kernel for XPULPV2 extension
+  @param[in]  args  pointer to plp_spmat_csr_mult_instance_i16 struct initialized by
+                    plp_spmm_csr_i16_parallel
+  @return     none
+
+  @par Exploiting SIMD instructions
+  Two consecutive nonzero values of a row are loaded as one vector. The rows of B they
+  select are loaded for four columns of C and transposed with four shuffles, such that
+  every __SUMDOTP2 computes two multiply-accumulates of one output.
+
+  @par Parallelization
+  The rows are split with plp_spmat_row_split, such that every core gets about the same
+  number of nonzero values instead of the same number of rows.
+ */
+
+void plp_spmm_csr_i16p_xpulpv2(void *args) {
+
+    plp_spmat_csr_mult_instance_i16 *a = (plp_spmat_csr_mult_instance_i16 *)args;
+    const plp_spmat_csr_i16 *pSrcA = a->pSrcA;
+    const int16_t *__restrict__ pSrcB = a->pSrcB;
+    uint32_t O = a->O;
+    uint32_t nPE = a->nPE;
+    int32_t *__restrict__ pDstC = a->pDstC;
+    const int16_t *pVal = pSrcA->pValues;
+    const uint16_t *pCol = pSrcA->pColIdx;
+    const uint32_t *pRowPtr = pSrcA->pRowPtr;
+    uint32_t M = pSrcA->M;
+    uint32_t core_id = rt_core_id();
+    uint32_t mStart = plp_spmat_row_split(pRowPtr, M, nPE, core_id);
+    uint32_t mEnd = plp_spmat_row_split(pRowPtr, M, nPE, core_id + 1);
+
+    uint32_t m; // loop counter for the rows of A and C
+    uint32_t j; // loop counter for the nonzero values
+    uint32_t o; // loop counter for the columns of B and C
+    uint32_t oEnd = O - O % 4; // columns in blocks of 4
+
+    for (m = mStart; m < mEnd; m++) {
+        uint32_t jStart = pRowPtr[m];
+        uint32_t jEnd = pRowPtr[m + 1];
+        int32_t *pC = &pDstC[m * O];
+
+        for (o = 0; o < oEnd; o += 4) {
+            int32_t sum0 = 0;
+            int32_t sum1 = 0;
+            int32_t sum2 = 0;
+            int32_t sum3 = 0;
+
+            // two nonzero values and the two rows of B they select, transposed to columns
+            for (j = jStart; j + 1 < jEnd; j += 2) {
+                v2s aVec = *((v2s *)&pVal[j]);
+
+                const int16_t *pB0 = &pSrcB[pCol[j] * O + o];
+                const int16_t *pB1 = &pSrcB[pCol[j + 1] * O + o];
+                v2s temp0 = *((v2s *)&pB0[0]); // b00 b01
+                v2s temp1 = *((v2s *)&pB0[2]); // b02 b03
+                v2s temp2 = *((v2s *)&pB1[0]); // b10 b11
+                v2s temp3 = *((v2s *)&pB1[2]); // b12 b13
+
+                v2s bVec0 = __builtin_shuffle(temp0, temp2, (v2s){ 0, 2 }); // b00 b10
+                v2s bVec1 = __builtin_shuffle(temp0, temp2, (v2s){ 1, 3 }); // b01 b11
+                v2s bVec2 = __builtin_shuffle(temp1, temp3, (v2s){ 0, 2 }); // b02 b12
+                v2s bVec3 = __builtin_shuffle(temp1, temp3, (v2s){ 1, 3 }); // b03 b13
+
+                sum0 = __SUMDOTP2(aVec, bVec0, sum0);
+                sum1 = __SUMDOTP2(aVec, bVec1, sum1);
+                sum2 = __SUMDOTP2(aVec, bVec2, sum2);
+                sum3 = __SUMDOTP2(aVec, bVec3, sum3);
+            }
+            if (j < jEnd) {
+                const int16_t *pB = &pSrcB[pCol[j] * O + o];
+                int32_t a = pVal[j];
+                sum0 += a * pB[0];
+                sum1 += a * pB[1];
+                sum2 += a * pB[2];
+                sum3 += a * pB[3];
+            }
+
+            pC[o] = sum0;
+            pC[o + 1] = sum1;
+            pC[o + 2] = sum2;
+            pC[o + 3] = sum3;
+        }
+
+        // remaining columns
+        for (o = oEnd; o < O; o++) {
+            int32_t sum = 0;
+            for (j = jStart; j < jEnd; j++) {
+                sum += pVal[j] * pSrcB[pCol[j] * O + o];
+            }
+            pC[o] = sum;
+        }
+    }
+
+    rt_team_barrier();
+}
+
+/**
+  @} end of SpMMKernels group
+ */
@@ -0,0 +1,138 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_spmm_csr_i8s_xpulpv2.c
+ * Description:  8-bit integer CSR sparse matrix-matrix multiplication for XPULPV2
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup SpMM
+ */
+
+/**
+  @addtogroup SpMMKernels
+  @{
+ */
+
+RT_CL_DATA static v4s mask0 = { 0, 1, 4, 5 };
+RT_CL_DATA static v4s mask1 = { 2, 3, 6, 7 };
+RT_CL_DATA static v4s mask2 = { 0, 2, 4, 6 };
+RT_CL_DATA static v4s mask3 = { 1, 3, 5, 7 };
+
+/**
+  @brief      Sparse matrix-dense matrix multiplication for 8-bit integers in CSR format kernel for
+              XPULPV2 extension
+  @param[in]  pSrcA Points to the sparse matrix of shape MxN
+  @param[in]  pSrcB Points to the dense matrix of shape NxO
+  @param[in]  O     Width of the matrices SrcB and DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Exploiting SIMD instructions
+  Four consecutive nonzero values of a row are loaded as one vector. The rows of B
+  they select are loaded for four columns of C and transposed with eight shuffles,
+  such that every __SUMDOTP4 computes four multiply-accumulates of one output.
+ */
+
+void plp_spmm_csr_i8s_xpulpv2(const plp_spmat_csr_i8 *__restrict__ pSrcA,
+                              const int8_t *__restrict__ pSrcB,
+                              uint32_t O,
+                              int32_t *__restrict__ pDstC) {
+
+    const int8_t *pVal = pSrcA->pValues;
+    const uint16_t *pCol = pSrcA->pColIdx;
+    const uint32_t *pRowPtr = pSrcA->pRowPtr;
+    uint32_t M = pSrcA->M;
+
+    uint32_t m; // loop counter for the rows of A and C
+    uint32_t j; // loop counter for the nonzero values
+    uint32_t o; // loop counter for the columns of B and C
+    uint32_t oEnd = O - O % 4; // columns in blocks of 4
+
+    for (m = 0; m < M; m++) {
+        uint32_t jStart = pRowPtr[m];
+        uint32_t jEnd = pRowPtr[m + 1];
+        int32_t *pC = &pDstC[m * O];
+
+        for (o = 0; o < oEnd; o += 4) {
+            int32_t sum0 = 0;
+            int32_t sum1 = 0;
+            int32_t sum2 = 0;
+            int32_t sum3 = 0;
+
+            // four nonzero values and the four rows of B they select, transposed to columns
+            for (j = jStart; j + 3 < jEnd; j += 4) {
+                v4s aVec = *((v4s *)&pVal[j]);
+
+                v4s temp0 = *((v4s *)&pSrcB[pCol[j] * O + o]);
+                v4s temp1 = *((v4s *)&pSrcB[pCol[j + 1] * O + o]);
+                v4s temp2 = *((v4s *)&pSrcB[pCol[j + 2] * O + o]);
+                v4s temp3 = *((v4s *)&pSrcB[pCol[j + 3] * O + o]);
+
+                v4s temp4 = __builtin_shuffle(temp0, temp1, mask0); // b00 b01 b10 b11
+                v4s temp5 = __builtin_shuffle(temp2, temp3, mask0); // b20 b21 b30 b31
+                v4s temp6 = __builtin_shuffle(temp0, temp1, mask1); // b02 b03 b12 b13
+                v4s temp7 = __builtin_shuffle(temp2, temp3, mask1); // b22 b23 b32 b33
+
+                v4s bVec0 = __builtin_shuffle(temp4, temp5, mask2); // b00 b10 b20 b30
+                v4s bVec1 = __builtin_shuffle(temp4, temp5, mask3); // b01 b11 b21 b31
+                v4s bVec2 = __builtin_shuffle(temp6, temp7, mask2); // b02 b12 b22 b32
+                v4s bVec3 = __builtin_shuffle(temp6, temp7, mask3); // b03 b13 b23 b33
+
+                sum0 = __SUMDOTP4(aVec, bVec0, sum0);
+                sum1 = __SUMDOTP4(aVec, bVec1, sum1);
+                sum2 = __SUMDOTP4(aVec, bVec2, sum2);
+                sum3 = __SUMDOTP4(aVec, bVec3, sum3);
+            }
+            for (; j < jEnd; j++) {
+                const int8_t *pB = &pSrcB[pCol[j] * O + o];
+                int32_t a = pVal[j];
+                sum0 += a * pB[0];
+                sum1 += a * pB[1];
+                sum2 += a * pB[2];
+                sum3 += a * pB[3];
+            }
+
+            pC[o] = sum0;
+            pC[o + 1] = sum1;
+            pC[o + 2] = sum2;
+            pC[o + 3] = sum3;
+        }
+
+        // remaining columns
+        for (o = oEnd; o < O; o++) {
+            int32_t sum = 0;
+            for (j = jStart; j < jEnd; j++) {
+                sum += pVal[j] * pSrcB[pCol[j] * O + o];
+            }
+            pC[o] = sum;
+        }
+    }
+}
+
+/**
+  @} end of SpMMKernels group
+ */
@@ -0,0 +1,79 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_spmm_bcsr_i8_parallel.c
+ * Description:  parallel 8-bit integer BCSR sparse matrix-matrix multiplication glue code
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup SpMM
+  @{
+ */
+
+/**
+  @brief      Glue code of parallel sparse matrix-dense matrix multiplication for 8-bit integers in
+              BCSR format
+  @param[in]  pSrcA Points to the sparse matrix of shape MxN
+  @param[in]  pSrcB Points to the dense matrix of shape NxO
+  @param[in]  O     Width of the matrices SrcB and DstC
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Parallelization
+  The block rows are split with plp_spmat_row_split, such that every core gets about the
+  same number of blocks instead of the same number of rows.
+ */
+
+void plp_spmm_bcsr_i8_parallel(const plp_spmat_bcsr_i8 *__restrict__ pSrcA,
+                               const int8_t *__restrict__ pSrcB,
+                               uint32_t O,
+                               uint32_t nPE,
+                               int32_t *__restrict__ pDstC) {
+
+    PLP_PROFILE_FUNC();
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_spmat_bcsr_mult_instance_i8 args = { .pSrcA = pSrcA,
+                                                 .pSrcB = pSrcB,
+                                                 .O = O,
+                                                 .nPE = nPE,
+                                                 .pDstC = pDstC };
+
+        rt_team_fork(nPE, plp_spmm_bcsr_i8p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of SpMM group
+ */
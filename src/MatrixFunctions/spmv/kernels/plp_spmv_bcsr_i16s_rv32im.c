@@ -0,0 +1,81 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_spmv_bcsr_i16s_rv32im.c
+ * Description:  16-bit integer BCSR sparse matrix-vector multiplication for RV32IM
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup SpMV
+ */
+
+/**
+  @addtogroup SpMVKernels
+  @{
+ */
+
+/**
+  @brief      Sparse matrix-vector multiplication for 16-bit integers in BCSR format kernel for
+              RV32IM extension
+  @param[in]  pSrcA Points to the sparse matrix of shape MxN
+  @param[in]  pSrcX Points to the input vector of length N
+  @param[out] pDstY Points to the output vector of length M
+  @return     none
+ */
+
+void plp_spmv_bcsr_i16s_rv32im(const plp_spmat_bcsr_i16 *__restrict__ pSrcA,
+                               const int16_t *__restrict__ pSrcX,
+                               int32_t *__restrict__ pDstY) {
+
+    const int16_t *pVal = pSrcA->pValues;
+    const uint16_t *pCol = pSrcA->pColIdx;
+    const uint32_t *pRowPtr = pSrcA->pRowPtr;
+    uint32_t blkRows = pSrcA->blkRows;
+    uint32_t numBlkRows = pSrcA->M / blkRows;
+
+    uint32_t r; // loop counter for the block rows
+    uint32_t b; // loop counter for the blocks
+    uint32_t i; // loop counter for the rows of a block
+    uint32_t k; // loop counter for the columns of a block
+
+    for (r = 0; r < numBlkRows; r++) {
+        for (i = 0; i < blkRows; i++) {
+            int32_t sum = 0;
+            for (b = pRowPtr[r]; b < pRowPtr[r + 1]; b++) {
+                const int16_t *pA = &pVal[(b * blkRows + i) * 4];
+                const int16_t *pX = &pSrcX[pCol[b] * 4];
+                for (k = 0; k < 4; k++) {
+                    sum += pA[k] * pX[k];
+                }
+            }
+            pDstY[r * blkRows + i] = sum;
+        }
+    }
+}
+
+/**
+  @} end of SpMVKernels group
+ */
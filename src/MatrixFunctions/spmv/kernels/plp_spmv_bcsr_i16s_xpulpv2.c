@@ -0,0 +1,108 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_spmv_bcsr_i16s_xpulpv2.c
+ * Description:  16-bit integer BCSR sparse matrix-vector multiplication for XPULPV2
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup SpMV
+ */
+
+/**
+  @addtogroup SpMVKernels
+  @{
+ */
+
+/**
+  @brief      Sparse matrix-vector multiplication for 16-bit integers in BCSR format kernel for
+              XPULPV2 extension
+  @param[in]  pSrcA Points to the sparse matrix of shape MxN
+  @param[in]  pSrcX Points to the input vector of length N
+  @param[out] pDstY Points to the output vector of length M
+  @return     none
+
+  @par Exploiting SIMD instructions
+  Every row of a block is multiplied with two __SUMDOTP2. For blocks of 4x4 values, the
+  loaded part of x is used for all four rows.
+ */
+
+void plp_spmv_bcsr_i16s_xpulpv2(const plp_spmat_bcsr_i16 *__restrict__ pSrcA,
+                                const int16_t *__restrict__ pSrcX,
+                                int32_t *__restrict__ pDstY) {
+
+    const int16_t *pVal = pSrcA->pValues;
+    const uint16_t *pCol = pSrcA->pColIdx;
+    const uint32_t *pRowPtr = pSrcA->pRowPtr;
+    uint32_t blkRows = pSrcA->blkRows;
+    uint32_t numBlkRows = pSrcA->M / blkRows;
+
+    uint32_t r; // loop counter for the block rows
+    uint32_t b; // loop counter for the blocks
+
+    if (blkRows == 1) {
+        for (r = 0; r < numBlkRows; r++) {
+            int32_t sum0 = 0;
+            for (b = pRowPtr[r]; b < pRowPtr[r + 1]; b++) {
+                const int16_t *pA = &pVal[b * 4];
+                v2s xVec0 = *((v2s *)&pSrcX[pCol[b] * 4]);
+                v2s xVec1 = *((v2s *)&pSrcX[pCol[b] * 4 + 2]);
+                sum0 = __SUMDOTP2(*((v2s *)&pA[0]), xVec0, sum0);
+                sum0 = __SUMDOTP2(*((v2s *)&pA[2]), xVec1, sum0);
+            }
+            pDstY[r] = sum0;
+        }
+    } else {
+        // the loaded part of x is used for the four rows of the block
+        for (r = 0; r < numBlkRows; r++) {
+            int32_t sum0 = 0;
+            int32_t sum1 = 0;
+            int32_t sum2 = 0;
+            int32_t sum3 = 0;
+            for (b = pRowPtr[r]; b < pRowPtr[r + 1]; b++) {
+                const int16_t *pA = &pVal[b * 16];
+                v2s xVec0 = *((v2s *)&pSrcX[pCol[b] * 4]);
+                v2s xVec1 = *((v2s *)&pSrcX[pCol[b] * 4 + 2]);
+                sum0 = __SUMDOTP2(*((v2s *)&pA[0]), xVec0, sum0);
+                sum0 = __SUMDOTP2(*((v2s *)&pA[2]), xVec1, sum0);
+                sum1 = __SUMDOTP2(*((v2s *)&pA[4]), xVec0, sum1);
+                sum1 = __SUMDOTP2(*((v2s *)&pA[6]), xVec1, sum1);
+                sum2 = __SUMDOTP2(*((v2s *)&pA[8]), xVec0, sum2);
+                sum2 = __SUMDOTP2(*((v2s *)&pA[10]), xVec1, sum2);
+                sum3 = __SUMDOTP2(*((v2s *)&pA[12]), xVec0, sum3);
+                sum3 = __SUMDOTP2(*((v2s *)&pA[14]), xVec1, sum3);
+            }
+            pDstY[r * 4] = sum0;
+            pDstY[r * 4 + 1] = sum1;
+            pDstY[r * 4 + 2] = sum2;
+            pDstY[r * 4 + 3] = sum3;
+        }
+    }
+}
+
+/**
+  @} end of SpMVKernels group
+ */
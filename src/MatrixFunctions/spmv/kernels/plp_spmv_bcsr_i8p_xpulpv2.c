@@ -0,0 +1,112 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_spmv_bcsr_i8p_xpulpv2.c
+ * Description:  parallel 8-bit integer BCSR sparse matrix-vector multiplication for XPULPV2
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup SpMV
+ */
+
+/**
+  @addtogroup SpMVKernels
+  @{
+ */
+
+/**
+  @brief      Parallel sparse matrix-vector multiplication for 8-bit integers in BCSR format kernel
+              for XPULPV2 extension
+  @param[in]  args  pointer to plp_spmat_bcsr_mult_instance_i8 struct initialized by
+                    plp_spmv_bcsr_i8_parallel
+  @return     none
+
+  @par Exploiting SIMD instructions
+  Every row of a block is multiplied with one __SUMDOTP4. For blocks of 4x4 values,
+  the loaded part of x is used for all four rows.
+
+  @par Parallelization
+  The block rows are split with plp_spmat_row_split, such that every core gets about the
+  same number of blocks instead of the same number of rows.
+ */
+
+void plp_spmv_bcsr_i8p_xpulpv2(void *args) {
+
+    plp_spmat_bcsr_mult_instance_i8 *a = (plp_spmat_bcsr_mult_instance_i8 *)args;
+    const plp_spmat_bcsr_i8 *pSrcA = a->pSrcA;
+    const int8_t *__restrict__ pSrcX = a->pSrcB;
+    uint32_t nPE = a->nPE;
+    int32_t *__restrict__ pDstY = a->pDstC;
+    const int8_t *pVal = pSrcA->pValues;
+    const uint16_t *pCol = pSrcA->pColIdx;
+    const uint32_t *pRowPtr = pSrcA->pRowPtr;
+    uint32_t blkRows = pSrcA->blkRows;
+    uint32_t numBlkRows = pSrcA->M / blkRows;
+    uint32_t core_id = rt_core_id();
+    uint32_t rStart = plp_spmat_row_split(pRowPtr, numBlkRows, nPE, core_id);
+    uint32_t rEnd = plp_spmat_row_split(pRowPtr, numBlkRows, nPE, core_id + 1);
+
+    uint32_t r; // loop counter for the block rows
+    uint32_t b; // loop counter for the blocks
+
+    if (blkRows == 1) {
+        for (r = rStart; r < rEnd; r++) {
+            int32_t sum0 = 0;
+            for (b = pRowPtr[r]; b < pRowPtr[r + 1]; b++) {
+                const int8_t *pA = &pVal[b * 4];
+                v4s xVec = *((v4s *)&pSrcX[pCol[b] * 4]);
+                sum0 = __SUMDOTP4(*((v4s *)&pA[0]), xVec, sum0);
+            }
+            pDstY[r] = sum0;
+        }
+    } else {
+        // the loaded part of x is used for the four rows of the block
+        for (r = rStart; r < rEnd; r++) {
+            int32_t sum0 = 0;
+            int32_t sum1 = 0;
+            int32_t sum2 = 0;
+            int32_t sum3 = 0;
+            for (b = pRowPtr[r]; b < pRowPtr[r + 1]; b++) {
+                const int8_t *pA = &pVal[b * 16];
+                v4s xVec = *((v4s *)&pSrcX[pCol[b] * 4]);
+                sum0 = __SUMDOTP4(*((v4s *)&pA[0]), xVec, sum0);
+                sum1 = __SUMDOTP4(*((v4s *)&pA[4]), xVec, sum1);
+                sum2 = __SUMDOTP4(*((v4s *)&pA[8]), xVec, sum2);
+                sum3 = __SUMDOTP4(*((v4s *)&pA[12]), xVec, sum3);
+            }
+            pDstY[r * 4] = sum0;
+            pDstY[r * 4 + 1] = sum1;
+            pDstY[r * 4 + 2] = sum2;
+            pDstY[r * 4 + 3] = sum3;
+        }
+    }
+
+    rt_team_barrier();
+}
+
+/**
+  @} end of SpMVKernels group
+ */
@@ -0,0 +1,94 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_spmv_csr_f32p_xpulpv2.c
+ * Description:  parallel 32-bit floating-point CSR sparse matrix-vector multiplication for XPULPV2
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup SpMV
+ */
+
+/**
+  @addtogroup SpMVKernels
+  @{
+ */
+
+/**
+  @brief      Parallel sparse matrix-vector multiplication for 32-bit floats in CSR format kernel
+              for XPULPV2 extension
+  @param[in]  args  pointer to plp_spmat_csr_mult_instance_f32 struct initialized by
+                    plp_spmv_csr_f32_parallel
+  @return     none
+
+  @par Loop unrolling
+  Two nonzero values are processed per iteration with independent accumulators, such
+  that the gathered loads of the vector do not stall the multiply-accumulate.
+
+  @par Parallelization
+  The rows are split with plp_spmat_row_split, such that every core gets about the same
+  number of nonzero values instead of the same number of rows.
+ */
+
+void plp_spmv_csr_f32p_xpulpv2(void *args) {
+
+    plp_spmat_csr_mult_instance_f32 *a = (plp_spmat_csr_mult_instance_f32 *)args;
+    const plp_spmat_csr_f32 *pSrcA = a->pSrcA;
+    const float *__restrict__ pSrcX = a->pSrcB;
+    uint32_t nPE = a->nPE;
+    float *__restrict__ pDstY = a->pDstC;
+    const float *pVal = pSrcA->pValues;
+    const uint16_t *pCol = pSrcA->pColIdx;
+    const uint32_t *pRowPtr = pSrcA->pRowPtr;
+    uint32_t M = pSrcA->M;
+    uint32_t core_id = rt_core_id();
+    uint32_t mStart = plp_spmat_row_split(pRowPtr, M, nPE, core_id);
+    uint32_t mEnd = plp_spmat_row_split(pRowPtr, M, nPE, core_id + 1);
+
+    uint32_t m; // loop counter for the rows
+    uint32_t j; // loop counter for the nonzero values
+
+    for (m = mStart; m < mEnd; m++) {
+        uint32_t jEnd = pRowPtr[m + 1];
+        float sum0 = 0.0f;
+        float sum1 = 0.0f;
+        // two independent accumulators hide the latency of the gathered loads
+        for (j = pRowPtr[m]; j + 1 < jEnd; j += 2) {
+            sum0 += pVal[j] * pSrcX[pCol[j]];
+            sum1 += pVal[j + 1] * pSrcX[pCol[j + 1]];
+        }
+        if (j < jEnd) {
+            sum0 += pVal[j] * pSrcX[pCol[j]];
+        }
+        pDstY[m] = sum0 + sum1;
+    }
+
+    rt_team_barrier();
+}
+
+/**
+  @} end of SpMVKernels group
+ */
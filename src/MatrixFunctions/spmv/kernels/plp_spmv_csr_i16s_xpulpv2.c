@@ -0,0 +1,83 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_spmv_csr_i16s_xpulpv2.c
+ * Description:  16-bit integer CSR sparse matrix-vector multiplication for XPULPV2
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup SpMV
+ */
+
+/**
+  @addtogroup SpMVKernels
+  @{
+ */
+
+/**
+  @brief      Sparse matrix-vector multiplication for 16-bit integers in CSR format kernel for
+              XPULPV2 extension
+  @param[in]  pSrcA Points to the sparse matrix of shape MxN
+  @param[in]  pSrcX Points to the input vector of length N
+  @param[out] pDstY Points to the output vector of length M
+  @return     none
+
+  @par Loop unrolling
+  Two nonzero values are processed per iteration with independent accumulators, such
+  that the gathered loads of the vector do not stall the multiply-accumulate.
+ */
+
+void plp_spmv_csr_i16s_xpulpv2(const plp_spmat_csr_i16 *__restrict__ pSrcA,
+                               const int16_t *__restrict__ pSrcX,
+                               int32_t *__restrict__ pDstY) {
+
+    const int16_t *pVal = pSrcA->pValues;
+    const uint16_t *pCol = pSrcA->pColIdx;
+    const uint32_t *pRowPtr = pSrcA->pRowPtr;
+    uint32_t M = pSrcA->M;
+
+    uint32_t m; // loop counter for the rows
+    uint32_t j; // loop counter for the nonzero values
+
+    for (m = 0; m < M; m++) {
+        uint32_t jEnd = pRowPtr[m + 1];
+        int32_t sum0 = 0;
+        int32_t sum1 = 0;
+        // two independent accumulators hide the latency of the gathered loads
+        for (j = pRowPtr[m]; j + 1 < jEnd; j += 2) {
+            sum0 += pVal[j] * pSrcX[pCol[j]];
+            sum1 += pVal[j + 1] * pSrcX[pCol[j + 1]];
+        }
+        if (j < jEnd) {
+            sum0 += pVal[j] * pSrcX[pCol[j]];
+        }
+        pDstY[m] = sum0 + sum1;
+    }
+}
+
+/**
+  @} end of SpMVKernels group
+ */
@@ -0,0 +1,93 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_spmv_csr_i8.c
+ * Description:  8-bit integer CSR sparse matrix-vector multiplication glue code
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup SpMV Sparse Matrix-Vector Multiplication
+  This module contains the glue code for the sparse matrix-vector multiplication. It computes
+  `y = A * x` for a sparse matrix A, e.g. a pruned fully connected layer or the adjacency matrix of
+  a graph filter. The kernel codes (kernels) are in the Module @ref SpMVKernels.
+
+      pDstY[m] = sum over the nonzero values A[m, n] of A[m, n] * pSrcX[n]
+
+  The sparse matrix is stored in the CSR or BCSR format of @ref SparseMatrix. Only the nonzero
+  values (or blocks) are processed, so the work is proportional to the number of nonzero values
+  instead of M * N. The parallel versions split the rows by the number of nonzero values with
+  plp_spmat_row_split, which keeps the cores busy for matrices with an uneven distribution of the
+  nonzero values.
+
+  There are functions for 8- and 16-bit integers with 32 bit results and 32-bit floats in CSR
+  format, and for 8- and 16-bit integers in BCSR format.
+
+  The naming scheme of the functions follows the following pattern (for example
+  `plp_spmv_csr_i8`):
+
+      plp_<function name>_<format>_<data type><precision>[_parallel]
+
+  name          | description
+  ------------- | ---------------------------------------------------------
+  function_name | `spmv`
+  format        | {csr, bcsr}
+  data type     | {f, i} respectively for floats, integers
+  precision     | {32, 16, 8} bits
+ */
+
+/**
+  @addtogroup SpMV
+  @{
+ */
+
+/**
+  @brief      Glue code of sparse matrix-vector multiplication for 8-bit integers in CSR format
+  @param[in]  pSrcA Points to the sparse matrix of shape MxN
+  @param[in]  pSrcX Points to the input vector of length N
+  @param[out] pDstY Points to the output vector of length M
+  @return     none
+ */
+
+void plp_spmv_csr_i8(const plp_spmat_csr_i8 *__restrict__ pSrcA,
+                     const int8_t *__restrict__ pSrcX,
+                     int32_t *__restrict__ pDstY) {
+
+    PLP_PROFILE_FUNC();
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_spmv_csr_i8s_rv32im(pSrcA, pSrcX, pDstY);
+    } else {
+        plp_spmv_csr_i8s_xpulpv2(pSrcA, pSrcX, pDstY);
+    }
+}
+
+/**
+  @} end of SpMV group
+ */
@@ -62,6 +62,8 @@ void plp_mat_add_stride_f32(const float *__restrict__ pSrcA,
                             uint32_t strideY,
                             float *__restrict__ pDst) {
 
+    PLP_PROFILE_FUNC();
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         printf("Floating point is supported only for cluster side\n");
         return;
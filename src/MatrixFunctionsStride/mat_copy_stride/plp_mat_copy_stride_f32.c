@@ -57,6 +57,8 @@ void plp_mat_copy_stride_f32(const float *__restrict__ pSrc,
                              uint32_t strideDst,
                              float *__restrict__ pDst) {
 
+    PLP_PROFILE_FUNC();
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         printf("Floating point is supported only for cluster side\n");
         return;
@@ -80,6 +80,8 @@ void plp_mat_copy_stride_i16(const int16_t *__restrict__ pSrc,
                              uint32_t strideDst,
                              int16_t *__restrict__ pDst) {
 
+    PLP_PROFILE_FUNC();
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         plp_mat_copy_stride_i16s_rv32im(pSrc, M, N, strideSrc, strideDst, pDst);
     } else {
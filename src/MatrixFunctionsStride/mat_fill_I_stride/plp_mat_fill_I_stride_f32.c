@@ -49,6 +49,8 @@
 
 void plp_mat_fill_I_stride_f32(uint32_t N, uint32_t stride, float *__restrict__ pDst) {
 
+    PLP_PROFILE_FUNC();
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         printf("Floating point is supported only for cluster side\n");
         return;
@@ -53,6 +53,8 @@ void plp_mat_fill_I_stride_i8_parallel(uint32_t N,
                                        uint32_t nPE,
                                        int8_t *__restrict__ pDst) {
 
+    PLP_PROFILE_FUNC();
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         printf("parallel processing supported only for cluster side\n");
         return;
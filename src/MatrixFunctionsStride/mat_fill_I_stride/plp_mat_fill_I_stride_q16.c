@@ -56,6 +56,8 @@ void plp_mat_fill_I_stride_q16(uint32_t N,
                                int32_t fracBits,
                                int16_t *__restrict__ pDst) {
 
+    PLP_PROFILE_FUNC();
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         plp_mat_fill_I_stride_q16s_rv32im(N, stride, fracBits, pDst);
     } else {
@@ -72,6 +72,8 @@
 void plp_mat_fill_stride_i16(
     uint32_t M, uint32_t N, uint32_t stride, int16_t value, int16_t *__restrict__ pDst) {
 
+    PLP_PROFILE_FUNC();
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         plp_mat_fill_stride_i16s_rv32im(M, N, stride, value, pDst);
     } else {
@@ -40,11 +40,33 @@
   @{
  */
 
+static inline void dot_prod_1x1(const float *pA, const float *pB, uint32_t N, uint32_t incB,
+                                float *pC) {
+    float re = 0;
+    float im = 0;
+    for (uint32_t n = 0; n < N; n++) {
+        re += pA[0] * pB[0] - pA[1] * pB[1];
+        im += pA[0] * pB[1] + pA[1] * pB[0];
+        pA += 2;
+        pB += incB * 2;
+    }
+    pC[0] = re;
+    pC[1] = im;
+}
+
 /**
   @brief      parallel strided matrix matrix multiplication for complex 32-bit floats on XpulpV2
   @param[in]  args    pointer to plp_mat_mat_mult_cmplx_instance_f32 struct initialized by
                     plp_mat_mult_cmplx_stride_f32_parallel
   @return     none
+
+  @par Blocking
+  The kernel computes blocks of 2x2 output elements, such that every loaded complex value is used
+  twice. This halves the loads per complex multiply-accumulate.
+
+  @par Parallelization
+  Every core computes every nPE-th block of two rows. The columns of a remaining odd row are split
+  over the cores.
 */
 
 void plp_mat_mult_cmplx_stride_f32p_xpulpv2(void *args) {
@@ -64,32 +86,64 @@ void plp_mat_mult_cmplx_stride_f32p_xpulpv2(void *args) {
     uint32_t nPE = a->nPE;
     float *__restrict__ pDstC = a->pDstC;
 
-#define BASIC_VERSION // if used don't forget to also use the undefine at end of file
-#ifdef BASIC_VERSION
+    uint32_t m, n, o;
 
-    for (int m = core_id; m < M; m += nPE) {
-        for (int o = 0; o < O; o++) {
-            float sum_re = 0;
-            float sum_im = 0;
-            for (int n = 0; n < N; n++) {
-                float a_re = (float)pSrcA[(m * strideA + n) * 2 + 0];
-                float a_im = (float)pSrcA[(m * strideA + n) * 2 + 1];
-                float b_re = (float)pSrcB[(n * strideB + o) * 2 + 0];
-                float b_im = (float)pSrcB[(n * strideB + o) * 2 + 1];
-                sum_re += a_re * b_re - a_im * b_im;
-                sum_im += a_re * b_im + a_im * b_re;
+    /* every nPE-th block of two rows */
+    for (m = core_id * 2; m + 1 < M; m += nPE * 2) {
+        const float *pA0 = pSrcA + m * strideA * 2;
+        const float *pA1 = pA0 + strideA * 2;
+        float *pC0 = pDstC + m * strideC * 2;
+        float *pC1 = pC0 + strideC * 2;
+        /* blocks of two columns */
+        for (o = 0; o + 1 < O; o += 2) {
+            const float *pB = pSrcB + o * 2;
+            float re00 = 0;
+            float im00 = 0;
+            float re01 = 0;
+            float im01 = 0;
+            float re10 = 0;
+            float im10 = 0;
+            float re11 = 0;
+            float im11 = 0;
+            for (n = 0; n < N; n++) {
+                const float *pX0 = pA0 + n * 2;
+                const float *pX1 = pA1 + n * 2;
+                const float *pY0 = pB;
+                const float *pY1 = pB + 2;
+                re00 += pX0[0] * pY0[0] - pX0[1] * pY0[1];
+                im00 += pX0[0] * pY0[1] + pX0[1] * pY0[0];
+                re01 += pX0[0] * pY1[0] - pX0[1] * pY1[1];
+                im01 += pX0[0] * pY1[1] + pX0[1] * pY1[0];
+                re10 += pX1[0] * pY0[0] - pX1[1] * pY0[1];
+                im10 += pX1[0] * pY0[1] + pX1[1] * pY0[0];
+                re11 += pX1[0] * pY1[0] - pX1[1] * pY1[1];
+                im11 += pX1[0] * pY1[1] + pX1[1] * pY1[0];
+                pB += strideB * 2;
             }
-            pDstC[(m * strideC + o) * 2 + 0] = sum_re;
-            pDstC[(m * strideC + o) * 2 + 1] = sum_im;
+            pC0[o * 2 + 0] = re00;
+            pC0[o * 2 + 1] = im00;
+            pC0[(o + 1) * 2 + 0] = re01;
+            pC0[(o + 1) * 2 + 1] = im01;
+            pC1[o * 2 + 0] = re10;
+            pC1[o * 2 + 1] = im10;
+            pC1[(o + 1) * 2 + 0] = re11;
+            pC1[(o + 1) * 2 + 1] = im11;
+        }
+        /* remaining column */
+        if (o < O) {
+            dot_prod_1x1(pA0, pSrcB + o * 2, N, strideB, pC0 + o * 2);
+            dot_prod_1x1(pA1, pSrcB + o * 2, N, strideB, pC1 + o * 2);
         }
     }
 
-#else
-
-    // TODO: Hackathon
-
-#endif
-#undef BASIC_VERSION
+    /* remaining row */
+    if (M & 1U) {
+        const float *pA0 = pSrcA + (M - 1) * strideA * 2;
+        float *pC0 = pDstC + (M - 1) * strideC * 2;
+        for (o = core_id; o < O; o += nPE) {
+            dot_prod_1x1(pA0, pSrcB + o * 2, N, strideB, pC0 + o * 2);
+        }
+    }
 }
 
 /**
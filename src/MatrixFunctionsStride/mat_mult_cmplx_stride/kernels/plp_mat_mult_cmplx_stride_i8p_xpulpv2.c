@@ -39,6 +39,31 @@
   @{
  */
 
+#define conjmask                                                                                   \
+    (v4s) { 0, -1, 0, -1 }
+#define swapmask                                                                                   \
+    (v4s) { 1, 0, 3, 2 }
+#define immask                                                                                     \
+    (v4s) { 0, 1, 0, 1 }
+#define shufflemask_lo                                                                             \
+    (v4s) { 0, 1, 4, 5 }
+#define shufflemask_hi                                                                             \
+    (v4s) { 2, 3, 6, 7 }
+
+static inline void dot_prod_1x1(const int8_t *pA, const int8_t *pB, uint32_t N, uint32_t incB,
+                                int32_t *pC) {
+    int32_t re = 0;
+    int32_t im = 0;
+    for (uint32_t n = 0; n < N; n++) {
+        re += pA[0] * pB[0] - pA[1] * pB[1];
+        im += pA[0] * pB[1] + pA[1] * pB[0];
+        pA += 2;
+        pB += incB * 2;
+    }
+    pC[0] = re;
+    pC[1] = im;
+}
+
 /**
   @brief      parallel strided matrix matrix multiplication for complex 8-bit integers on XpulpV2
   @param[in]  args    pointer to plp_mat_mat_mult_cmplx_instance_i8 struct initialized by
@@ -46,8 +71,19 @@
   @return     none
 
   @par Exploiting SIMD instructions
-  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+  Two complex values are packed into one 32 bit vector {re0, im0, re1, im1}, such that every dot
+  product accumulates two complex products. The columns of B are gathered with two shuffles from the
+  rows n and n + 1. The imaginary part of a * b is the dot product of a and the swapped b. For the
+  real part, the imaginary part of a is inverted (~im = -im - 1, which cannot overflow) and the dot
+  product with b yields the real part minus the imaginary part of b. The imaginary parts of b are
+  accumulated with one more dot product per column. The kernel computes blocks of 2x2 output
+  elements, such that every loaded vector is used twice. The inner loop takes 20 instructions for 8
+  complex multiply-accumulates. Rows starting at word boundaries (even strides) avoid misaligned
+  loads.
+
+  @par Parallelization
+  Every core computes every nPE-th block of two rows. The columns of a remaining odd row are split
+  over the cores.
 */
 
 void plp_mat_mult_cmplx_stride_i8p_xpulpv2(void *args) {
@@ -67,32 +103,90 @@ void plp_mat_mult_cmplx_stride_i8p_xpulpv2(void *args) {
     uint32_t nPE = a->nPE;
     int32_t *__restrict__ pDstC = a->pDstC;
 
-#define BASIC_VERSION // if used don't forget to also use the undefine at end of file
-#ifdef BASIC_VERSION
-
-    for (int m = core_id; m < M; m += nPE) {
-        for (int o = 0; o < O; o++) {
-            int32_t sum_re = 0;
-            int32_t sum_im = 0;
-            for (int n = 0; n < N; n++) {
-                int32_t a_re = (int32_t)pSrcA[(m * strideA + n) * 2 + 0];
-                int32_t a_im = (int32_t)pSrcA[(m * strideA + n) * 2 + 1];
-                int32_t b_re = (int32_t)pSrcB[(n * strideB + o) * 2 + 0];
-                int32_t b_im = (int32_t)pSrcB[(n * strideB + o) * 2 + 1];
-                sum_re += a_re * b_re - a_im * b_im;
-                sum_im += a_re * b_im + a_im * b_re;
+    uint32_t m, n, o;
+
+    /* every nPE-th block of two rows */
+    for (m = core_id * 2; m + 1 < M; m += nPE * 2) {
+        const int8_t *pA0 = pSrcA + m * strideA * 2;
+        const int8_t *pA1 = pA0 + strideA * 2;
+        int32_t *pC0 = pDstC + m * strideC * 2;
+        int32_t *pC1 = pC0 + strideC * 2;
+        /* blocks of two columns */
+        for (o = 0; o + 1 < O; o += 2) {
+            const int8_t *pB = pSrcB + o * 2;
+            int32_t re00 = 0;
+            int32_t im00 = 0;
+            int32_t re01 = 0;
+            int32_t im01 = 0;
+            int32_t re10 = 0;
+            int32_t im10 = 0;
+            int32_t re11 = 0;
+            int32_t im11 = 0;
+            int32_t corr0 = 0;
+            int32_t corr1 = 0;
+            /* two complex values of each row and column at once */
+            for (n = 0; n + 1 < N; n += 2) {
+                v4s a0 = *((v4s *)(pA0 + n * 2)); // {a0[n], a0[n + 1]}
+                v4s a1 = *((v4s *)(pA1 + n * 2)); // {a1[n], a1[n + 1]}
+                v4s x0 = *((v4s *)pB); // {b[n, o], b[n, o + 1]}
+                v4s x1 = *((v4s *)(pB + strideB * 2)); // {b[n + 1, o], b[n + 1, o + 1]}
+                v4s b0 = __builtin_shuffle(x0, x1, shufflemask_lo); // {b[n, o], b[n + 1, o]}
+                v4s b1 = __builtin_shuffle(x0, x1, shufflemask_hi); // {b[n, o + 1], b[n + 1, o+1]}
+                v4s a0c = __EXOR4(a0, conjmask);
+                v4s a1c = __EXOR4(a1, conjmask);
+                v4s b0s = __builtin_shuffle(b0, swapmask);
+                v4s b1s = __builtin_shuffle(b1, swapmask);
+                re00 = __SUMDOTP4(a0c, b0, re00);
+                im00 = __SUMDOTP4(a0, b0s, im00);
+                re01 = __SUMDOTP4(a0c, b1, re01);
+                im01 = __SUMDOTP4(a0, b1s, im01);
+                re10 = __SUMDOTP4(a1c, b0, re10);
+                im10 = __SUMDOTP4(a1, b0s, im10);
+                re11 = __SUMDOTP4(a1c, b1, re11);
+                im11 = __SUMDOTP4(a1, b1s, im11);
+                corr0 = __SUMDOTP4(b0, immask, corr0);
+                corr1 = __SUMDOTP4(b1, immask, corr1);
+                pB += strideB * 4;
             }
-            pDstC[(m * strideC + o) * 2 + 0] = sum_re;
-            pDstC[(m * strideC + o) * 2 + 1] = sum_im;
+            /* remaining complex value */
+            if (n < N) {
+                const int8_t *pX0 = pA0 + n * 2;
+                const int8_t *pX1 = pA1 + n * 2;
+                const int8_t *pY0 = pB;
+                const int8_t *pY1 = pB + 2;
+                re00 += pX0[0] * pY0[0] - pX0[1] * pY0[1];
+                im00 += pX0[0] * pY0[1] + pX0[1] * pY0[0];
+                re01 += pX0[0] * pY1[0] - pX0[1] * pY1[1];
+                im01 += pX0[0] * pY1[1] + pX0[1] * pY1[0];
+                re10 += pX1[0] * pY0[0] - pX1[1] * pY0[1];
+                im10 += pX1[0] * pY0[1] + pX1[1] * pY0[0];
+                re11 += pX1[0] * pY1[0] - pX1[1] * pY1[1];
+                im11 += pX1[0] * pY1[1] + pX1[1] * pY1[0];
+            }
+            pC0[o * 2 + 0] = re00 + corr0;
+            pC0[o * 2 + 1] = im00;
+            pC0[(o + 1) * 2 + 0] = re01 + corr1;
+            pC0[(o + 1) * 2 + 1] = im01;
+            pC1[o * 2 + 0] = re10 + corr0;
+            pC1[o * 2 + 1] = im10;
+            pC1[(o + 1) * 2 + 0] = re11 + corr1;
+            pC1[(o + 1) * 2 + 1] = im11;
+        }
+        /* remaining column */
+        if (o < O) {
+            dot_prod_1x1(pA0, pSrcB + o * 2, N, strideB, pC0 + o * 2);
+            dot_prod_1x1(pA1, pSrcB + o * 2, N, strideB, pC1 + o * 2);
         }
     }
 
-#else
-
-    // TODO: Hackathon
-
-#endif
-#undef BASIC_VERSION
+    /* remaining row */
+    if (M & 1U) {
+        const int8_t *pA0 = pSrcA + (M - 1) * strideA * 2;
+        int32_t *pC0 = pDstC + (M - 1) * strideC * 2;
+        for (o = core_id; o < O; o += nPE) {
+            dot_prod_1x1(pA0, pSrcB + o * 2, N, strideB, pC0 + o * 2);
+        }
+    }
 }
 
 /**
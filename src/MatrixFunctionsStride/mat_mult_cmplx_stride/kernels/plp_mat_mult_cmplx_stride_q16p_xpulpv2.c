@@ -39,6 +39,28 @@
   @{
  */
 
+#define conjmask                                                                                   \
+    (v2s) { 0, -1 }
+#define swapmask                                                                                   \
+    (v2s) { 1, 0 }
+
+static inline void dot_prod_1x1(const v2s *pA, const v2s *pB, uint32_t N, uint32_t incB,
+                                uint32_t shift, int16_t *pC) {
+    int32_t re = 0;
+    int32_t im = 0;
+    for (uint32_t n = 0; n < N; n++) {
+        v2s a0 = pA[n];
+        v2s b0 = *pB;
+        v2s a0c = __EXOR2(a0, conjmask);
+        v2s b0s = __builtin_shuffle(b0, swapmask);
+        re += __ADDROUNDNORM_REG(__DOTP2(a0c, b0), b0[1], shift);
+        im += __ROUNDNORM_REG(__DOTP2(a0, b0s), shift);
+        pB += incB;
+    }
+    pC[0] = (int16_t)re;
+    pC[1] = (int16_t)im;
+}
+
 /**
   @brief      parallel strided matrix matrix multiplication for complex 16-bit fix-point on XpulpV2
   @param[in]  args    pointer to plp_mat_mat_mult_cmplx_instance_q16 struct initialized by
@@ -55,8 +77,17 @@
   occurrs.
 
   @par Exploiting SIMD instructions
-  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+  Every complex value is packed into one 32 bit vector {re, im}. The imaginary part of a * b is the
+  dot product of a and the swapped b. For the real part, the imaginary part of a is inverted (~im =
+  -im - 1, which cannot overflow) and the dot product with b yields the real part minus the
+  imaginary part of b. The imaginary part of b is added back with __ADDROUNDNORM_REG, such that
+  every product is rounded and shifted before it is accumulated, as on RV32IM. The kernel computes
+  blocks of 2x2 output elements, such that every loaded vector is used twice. The inner loop takes
+  34 instructions for 4 complex multiply-accumulates.
+
+  @par Parallelization
+  Every core computes every nPE-th block of two rows. The columns of a remaining odd row are split
+  over the cores.
 */
 
 void plp_mat_mult_cmplx_stride_q16p_xpulpv2(void *args) {
@@ -77,32 +108,68 @@ void plp_mat_mult_cmplx_stride_q16p_xpulpv2(void *args) {
     uint32_t nPE = a->nPE;
     int16_t *__restrict__ pDstC = a->pDstC;
 
-#define BASIC_VERSION // if used don't forget to also use the undefine at end of file
-#ifdef BASIC_VERSION
-
-    for (int m = core_id; m < M; m += nPE) {
-        for (int o = 0; o < O; o++) {
-            int32_t sum_re = 0;
-            int32_t sum_im = 0;
-            for (int n = 0; n < N; n++) {
-                int32_t a_re = (int32_t)pSrcA[(m * strideA + n) * 2 + 0];
-                int32_t a_im = (int32_t)pSrcA[(m * strideA + n) * 2 + 1];
-                int32_t b_re = (int32_t)pSrcB[(n * strideB + o) * 2 + 0];
-                int32_t b_im = (int32_t)pSrcB[(n * strideB + o) * 2 + 1];
-                sum_re += __ROUNDNORM_REG(a_re * b_re - a_im * b_im, shift);
-                sum_im += __ROUNDNORM_REG(a_re * b_im + a_im * b_re, shift);
+    uint32_t m, n, o;
+
+    /* every nPE-th block of two rows */
+    for (m = core_id * 2; m + 1 < M; m += nPE * 2) {
+        const v2s *pA0 = (const v2s *)pSrcA + m * strideA;
+        const v2s *pA1 = pA0 + strideA;
+        int16_t *pC0 = pDstC + m * strideC * 2;
+        int16_t *pC1 = pC0 + strideC * 2;
+        /* blocks of two columns */
+        for (o = 0; o + 1 < O; o += 2) {
+            const v2s *pB = (const v2s *)pSrcB + o;
+            int32_t re00 = 0;
+            int32_t im00 = 0;
+            int32_t re01 = 0;
+            int32_t im01 = 0;
+            int32_t re10 = 0;
+            int32_t im10 = 0;
+            int32_t re11 = 0;
+            int32_t im11 = 0;
+            for (n = 0; n < N; n++) {
+                v2s a0 = pA0[n];
+                v2s a1 = pA1[n];
+                v2s b0 = pB[0];
+                v2s b1 = pB[1];
+                v2s a0c = __EXOR2(a0, conjmask);
+                v2s a1c = __EXOR2(a1, conjmask);
+                v2s b0s = __builtin_shuffle(b0, swapmask);
+                v2s b1s = __builtin_shuffle(b1, swapmask);
+                re00 += __ADDROUNDNORM_REG(__DOTP2(a0c, b0), b0[1], shift);
+                im00 += __ROUNDNORM_REG(__DOTP2(a0, b0s), shift);
+                re01 += __ADDROUNDNORM_REG(__DOTP2(a0c, b1), b1[1], shift);
+                im01 += __ROUNDNORM_REG(__DOTP2(a0, b1s), shift);
+                re10 += __ADDROUNDNORM_REG(__DOTP2(a1c, b0), b0[1], shift);
+                im10 += __ROUNDNORM_REG(__DOTP2(a1, b0s), shift);
+                re11 += __ADDROUNDNORM_REG(__DOTP2(a1c, b1), b1[1], shift);
+                im11 += __ROUNDNORM_REG(__DOTP2(a1, b1s), shift);
+                pB += strideB;
             }
-            pDstC[(m * strideC + o) * 2 + 0] = (int16_t)sum_re;
-            pDstC[(m * strideC + o) * 2 + 1] = (int16_t)sum_im;
+            pC0[o * 2 + 0] = (int16_t)re00;
+            pC0[o * 2 + 1] = (int16_t)im00;
+            pC0[(o + 1) * 2 + 0] = (int16_t)re01;
+            pC0[(o + 1) * 2 + 1] = (int16_t)im01;
+            pC1[o * 2 + 0] = (int16_t)re10;
+            pC1[o * 2 + 1] = (int16_t)im10;
+            pC1[(o + 1) * 2 + 0] = (int16_t)re11;
+            pC1[(o + 1) * 2 + 1] = (int16_t)im11;
+        }
+        /* remaining column */
+        if (o < O) {
+            dot_prod_1x1(pA0, (const v2s *)pSrcB + o, N, strideB, shift, pC0 + o * 2);
+            dot_prod_1x1(pA1, (const v2s *)pSrcB + o, N, strideB, shift, pC1 + o * 2);
         }
     }
 
-#else
-
-    // TODO: Hackathon
-
-#endif
-#undef BASIC_VERSION
+    /* remaining row */
+    if (M & 1U) {
+        const v2s *pA0 = (const v2s *)pSrcA + (M - 1) * strideA;
+        int16_t *pC0 = pDstC + (M - 1) * strideC * 2;
+        for (o = core_id; o < O; o += nPE) {
+            dot_prod_1x1(pA0, (const v2s *)pSrcB + o, N, strideB, shift, pC0 + o * 2);
+        }
+    }
 }
 
 /**
@@ -71,6 +71,8 @@ void plp_mat_mult_stride_q32(const int32_t *__restrict__ pSrcA,
                              uint32_t shift,
                              int32_t *__restrict__ pDstC) {
 
+    PLP_PROFILE_FUNC();
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         plp_mat_mult_stride_q32s_rv32im(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, shift,
                                         pDstC);
@@ -63,6 +63,8 @@ void plp_mat_mult_trans_stride_f32(const float *__restrict__ pSrcA,
                                    uint32_t strideC,
                                    float *__restrict__ pDstC) {
 
+    PLP_PROFILE_FUNC();
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         printf("Floating point is supported only for cluster side\n");
         return;
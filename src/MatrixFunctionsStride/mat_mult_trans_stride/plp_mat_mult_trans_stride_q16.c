@@ -74,6 +74,8 @@ void plp_mat_mult_trans_stride_q16(const int16_t *__restrict__ pSrcA,
                                    uint32_t shift,
                                    int16_t *__restrict__ pDstC) {
 
+    PLP_PROFILE_FUNC();
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         plp_mat_mult_trans_stride_q16s_rv32im(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC,
                                               shift, pDstC);
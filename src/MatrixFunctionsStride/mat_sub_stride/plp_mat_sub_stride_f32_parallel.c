@@ -63,6 +63,8 @@ void plp_mat_sub_stride_f32_parallel(const float *__restrict__ pSrcA,
                                      uint32_t nPE,
                                      float *__restrict__ pDst) {
 
+    PLP_PROFILE_FUNC();
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         printf("parallel and floating-point processing supported only for cluster side\n");
         return;
@@ -90,6 +90,8 @@ void plp_mat_sub_stride_i16(const int16_t *__restrict__ pSrcA,
                             uint32_t strideY,
                             int16_t *__restrict__ pDst) {
 
+    PLP_PROFILE_FUNC();
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         plp_mat_sub_stride_i16s_rv32im(pSrcA, pSrcB, M, N, strideA, strideB, strideY, pDst);
     } else {
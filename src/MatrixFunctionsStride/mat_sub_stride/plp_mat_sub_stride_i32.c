@@ -61,6 +61,8 @@ void plp_mat_sub_stride_i32(const int32_t *__restrict__ pSrcA,
                             uint32_t strideY,
                             int32_t *__restrict__ pDst) {
 
+    PLP_PROFILE_FUNC();
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         plp_mat_sub_stride_i32s_rv32im(pSrcA, pSrcB, M, N, strideA, strideB, strideY, pDst);
     } else {
@@ -0,0 +1,109 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_trans_stride_i16p_xpulpv2.c
+ * Description:  16-bit integer parallel strided matrix transpose kernel for XPULPV2
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatTransStride
+ */
+
+/**
+  @addtogroup MatTransStrideKernels
+  @{
+ */
+
+#define shufflemask_lo                                                                             \
+    (v2s) { 0, 2 }
+#define shufflemask_hi                                                                             \
+    (v2s) { 1, 3 }
+
+/**
+  @brief      Transpose an MxN strided 16-bit integer matrix on XpulpV2 in parallel
+  @param[in]  args  pointer to plp_mat_trans_stride_instance_i16 struct initialized by
+                    plp_mat_trans_stride_i16_parallel
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The input matrix is split into tiles of 2x2 elements. The two rows of a tile are loaded as two
+  packed words, transposed in registers with two shuffles and stored as two packed words. All
+  accesses to the memory are words instead of single elements.
+
+  Every core transposes every nPE-th tile row, such that the cores write to neighbouring words of
+  the output rows, which are in different banks of the TCDM.
+ */
+
+void plp_mat_trans_stride_i16p_xpulpv2(void *args) {
+
+    int core_id = rt_core_id();
+
+    plp_mat_trans_stride_instance_i16 *a = (plp_mat_trans_stride_instance_i16 *)args;
+
+    const int16_t *__restrict__ pSrc = a->pSrc;
+    uint32_t M = a->M;
+    uint32_t N = a->N;
+    uint32_t strideSrc = a->strideSrc;
+    uint32_t strideDst = a->strideDst;
+    uint32_t nPE = a->nPE;
+    int16_t *__restrict__ pDst = a->pDst;
+
+    uint32_t m, n;
+
+    /* every nPE-th row of tiles of 2x2 elements */
+    for (m = core_id * 2; m + 1 < M; m += nPE * 2) {
+        const int16_t *pA = pSrc + m * strideSrc;
+        const int16_t *pB = pA + strideSrc;
+        int16_t *pY = pDst + m;
+        for (n = 0; n + 1 < N; n += 2) {
+            v2s va = *((v2s *)(pA + n)); // {a0, a1}
+            v2s vb = *((v2s *)(pB + n)); // {b0, b1}
+            *((v2s *)pY) = __builtin_shuffle(va, vb, shufflemask_lo); // {a0, b0}
+            *((v2s *)(pY + strideDst)) = __builtin_shuffle(va, vb, shufflemask_hi); // {a1, b1}
+            pY += 2 * strideDst;
+        }
+        /* remaining column */
+        if (n < N) {
+            pY[0] = pA[n];
+            pY[1] = pB[n];
+        }
+    }
+
+    /* remaining row */
+    if ((M & 1U) && (uint32_t)core_id == nPE - 1) {
+        m = M - 1;
+        const int16_t *pA = pSrc + m * strideSrc;
+        int16_t *pY = pDst + m;
+        for (n = 0; n < N; n++) {
+            *pY = *pA++;
+            pY += strideDst;
+        }
+    }
+}
+
+/**
+   @} end of MatTransStrideKernels group
+*/
@@ -0,0 +1,102 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_trans_stride_i16s_xpulpv2.c
+ * Description:  16-bit integer strided matrix transpose kernel for XPULPV2
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatTransStride
+ */
+
+/**
+  @addtogroup MatTransStrideKernels
+  @{
+ */
+
+#define shufflemask_lo                                                                             \
+    (v2s) { 0, 2 }
+#define shufflemask_hi                                                                             \
+    (v2s) { 1, 3 }
+
+/**
+  @brief      Transpose an MxN strided 16-bit integer matrix on XpulpV2
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  strideSrc Stride of the input matrix (elements between each row)
+  @param[in]  strideDst Stride of the output matrix (elements between each row)
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The input matrix is split into tiles of 2x2 elements. The two rows of a tile are loaded as two
+  packed words, transposed in registers with two shuffles and stored as two packed words. All
+  accesses to the memory are words instead of single elements.
+ */
+
+void plp_mat_trans_stride_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                                       uint32_t M,
+                                       uint32_t N,
+                                       uint32_t strideSrc,
+                                       uint32_t strideDst,
+                                       int16_t *__restrict__ pDst) {
+
+    uint32_t m, n;
+
+    /* tiles of 2x2 elements */
+    for (m = 0; m + 1 < M; m += 2) {
+        const int16_t *pA = pSrc + m * strideSrc;
+        const int16_t *pB = pA + strideSrc;
+        int16_t *pY = pDst + m;
+        for (n = 0; n + 1 < N; n += 2) {
+            v2s va = *((v2s *)(pA + n)); // {a0, a1}
+            v2s vb = *((v2s *)(pB + n)); // {b0, b1}
+            *((v2s *)pY) = __builtin_shuffle(va, vb, shufflemask_lo); // {a0, b0}
+            *((v2s *)(pY + strideDst)) = __builtin_shuffle(va, vb, shufflemask_hi); // {a1, b1}
+            pY += 2 * strideDst;
+        }
+        /* remaining column */
+        if (n < N) {
+            pY[0] = pA[n];
+            pY[1] = pB[n];
+        }
+    }
+
+    /* remaining row */
+    if (m < M) {
+        const int16_t *pA = pSrc + m * strideSrc;
+        int16_t *pY = pDst + m;
+        for (n = 0; n < N; n++) {
+            *pY = *pA++;
+            pY += strideDst;
+        }
+    }
+}
+
+/**
+   @} end of MatTransStrideKernels group
+*/
@@ -0,0 +1,104 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_trans_stride_i32p_xpulpv2.c
+ * Description:  32-bit integer parallel strided matrix transpose kernel for XPULPV2
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatTransStride
+ */
+
+/**
+  @addtogroup MatTransStrideKernels
+  @{
+ */
+
+/**
+  @brief      Transpose an MxN strided 32-bit integer matrix on XpulpV2 in parallel
+  @param[in]  args  pointer to plp_mat_trans_stride_instance_i32 struct initialized by
+                    plp_mat_trans_stride_i32_parallel
+  @return     none
+
+  @par Tiling
+  Four rows of the input matrix are transposed at once. Every column of this tile is loaded into
+  registers and stored as four consecutive words of the output matrix, instead of four single
+  elements which are strideDst apart.
+
+  Every core transposes every nPE-th tile row, such that the cores write to neighbouring words of
+  the output rows, which are in different banks of the TCDM.
+ */
+
+void plp_mat_trans_stride_i32p_xpulpv2(void *args) {
+
+    int core_id = rt_core_id();
+
+    plp_mat_trans_stride_instance_i32 *a = (plp_mat_trans_stride_instance_i32 *)args;
+
+    const int32_t *__restrict__ pSrc = a->pSrc;
+    uint32_t M = a->M;
+    uint32_t N = a->N;
+    uint32_t strideSrc = a->strideSrc;
+    uint32_t strideDst = a->strideDst;
+    uint32_t nPE = a->nPE;
+    int32_t *__restrict__ pDst = a->pDst;
+
+    uint32_t m, n;
+
+    /* every nPE-th row of tiles of four rows */
+    for (m = core_id * 4; m + 3 < M; m += nPE * 4) {
+        const int32_t *pA = pSrc + m * strideSrc;
+        const int32_t *pB = pA + strideSrc;
+        const int32_t *pC = pB + strideSrc;
+        const int32_t *pD = pC + strideSrc;
+        int32_t *pY = pDst + m;
+        for (n = 0; n < N; n++) {
+            int32_t va = *pA++;
+            int32_t vb = *pB++;
+            int32_t vc = *pC++;
+            int32_t vd = *pD++;
+            pY[0] = va;
+            pY[1] = vb;
+            pY[2] = vc;
+            pY[3] = vd;
+            pY += strideDst;
+        }
+    }
+
+    /* remaining rows */
+    for (m = (M & ~3U) + core_id; m < M; m += nPE) {
+        const int32_t *pA = pSrc + m * strideSrc;
+        int32_t *pY = pDst + m;
+        for (n = 0; n < N; n++) {
+            *pY = *pA++;
+            pY += strideDst;
+        }
+    }
+}
+
+/**
+   @} end of MatTransStrideKernels group
+*/
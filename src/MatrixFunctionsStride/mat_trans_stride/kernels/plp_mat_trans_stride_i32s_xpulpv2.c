@@ -0,0 +1,98 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_trans_stride_i32s_xpulpv2.c
+ * Description:  32-bit integer strided matrix transpose kernel for XPULPV2
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatTransStride
+ */
+
+/**
+  @addtogroup MatTransStrideKernels
+  @{
+ */
+
+/**
+  @brief      Transpose an MxN strided 32-bit integer matrix on XpulpV2
+  @param[in]  pSrc      Points to the input matrix of shape MxN
+  @param[in]  M         Height of the input matrix and width of the output matrix
+  @param[in]  N         Width of the input matrix and height of the output matrix
+  @param[in]  strideSrc Stride of the input matrix (elements between each row)
+  @param[in]  strideDst Stride of the output matrix (elements between each row)
+  @param[out] pDst      Points to the output matrix of shape NxM
+  @return     none
+
+  @par Tiling
+  Four rows of the input matrix are transposed at once. Every column of this tile is loaded into
+  registers and stored as four consecutive words of the output matrix, instead of four single
+  elements which are strideDst apart.
+ */
+
+void plp_mat_trans_stride_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                                       uint32_t M,
+                                       uint32_t N,
+                                       uint32_t strideSrc,
+                                       uint32_t strideDst,
+                                       int32_t *__restrict__ pDst) {
+
+    uint32_t m, n;
+
+    /* tiles of four rows */
+    for (m = 0; m + 3 < M; m += 4) {
+        const int32_t *pA = pSrc + m * strideSrc;
+        const int32_t *pB = pA + strideSrc;
+        const int32_t *pC = pB + strideSrc;
+        const int32_t *pD = pC + strideSrc;
+        int32_t *pY = pDst + m;
+        for (n = 0; n < N; n++) {
+            int32_t va = *pA++;
+            int32_t vb = *pB++;
+            int32_t vc = *pC++;
+            int32_t vd = *pD++;
+            pY[0] = va;
+            pY[1] = vb;
+            pY[2] = vc;
+            pY[3] = vd;
+            pY += strideDst;
+        }
+    }
+
+    /* remaining rows */
+    for (; m < M; m++) {
+        const int32_t *pA = pSrc + m * strideSrc;
+        int32_t *pY = pDst + m;
+        for (n = 0; n < N; n++) {
+            *pY = *pA++;
+            pY += strideDst;
+        }
+    }
+}
+
+/**
+   @} end of MatTransStrideKernels group
+*/
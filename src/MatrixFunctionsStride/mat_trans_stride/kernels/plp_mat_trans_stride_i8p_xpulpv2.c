@@ -0,0 +1,128 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_trans_stride_i8p_xpulpv2.c
+ * Description:  8-bit integer parallel strided matrix transpose kernel for XPULPV2
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatTransStride
+ */
+
+/**
+  @addtogroup MatTransStrideKernels
+  @{
+ */
+
+#define shufflemask_lo                                                                             \
+    (v4s) { 0, 4, 1, 5 }
+#define shufflemask_hi                                                                             \
+    (v4s) { 2, 6, 3, 7 }
+#define shufflemask_even                                                                           \
+    (v4s) { 0, 1, 4, 5 }
+#define shufflemask_odd                                                                            \
+    (v4s) { 2, 3, 6, 7 }
+
+/**
+  @brief      Transpose an MxN strided 8-bit integer matrix on XpulpV2 in parallel
+  @param[in]  args  pointer to plp_mat_trans_stride_instance_i8 struct initialized by
+                    plp_mat_trans_stride_i8_parallel
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The input matrix is split into tiles of 4x4 elements. The four rows of a tile are loaded as four
+  packed words, transposed in registers with eight shuffles and stored as four packed words. All
+  accesses to the memory are words instead of single elements.
+
+  Every core transposes every nPE-th tile row, such that the cores write to neighbouring words of
+  the output rows, which are in different banks of the TCDM.
+ */
+
+void plp_mat_trans_stride_i8p_xpulpv2(void *args) {
+
+    int core_id = rt_core_id();
+
+    plp_mat_trans_stride_instance_i8 *a = (plp_mat_trans_stride_instance_i8 *)args;
+
+    const int8_t *__restrict__ pSrc = a->pSrc;
+    uint32_t M = a->M;
+    uint32_t N = a->N;
+    uint32_t strideSrc = a->strideSrc;
+    uint32_t strideDst = a->strideDst;
+    uint32_t nPE = a->nPE;
+    int8_t *__restrict__ pDst = a->pDst;
+
+    uint32_t m, n;
+
+    /* every nPE-th row of tiles of 4x4 elements */
+    for (m = core_id * 4; m + 3 < M; m += nPE * 4) {
+        const int8_t *pA = pSrc + m * strideSrc;
+        const int8_t *pB = pA + strideSrc;
+        const int8_t *pC = pB + strideSrc;
+        const int8_t *pD = pC + strideSrc;
+        int8_t *pY = pDst + m;
+        for (n = 0; n + 3 < N; n += 4) {
+            v4s va = *((v4s *)(pA + n));
+            v4s vb = *((v4s *)(pB + n));
+            v4s vc = *((v4s *)(pC + n));
+            v4s vd = *((v4s *)(pD + n));
+            v4s abLo = __builtin_shuffle(va, vb, shufflemask_lo); // {a0, b0, a1, b1}
+            v4s abHi = __builtin_shuffle(va, vb, shufflemask_hi); // {a2, b2, a3, b3}
+            v4s cdLo = __builtin_shuffle(vc, vd, shufflemask_lo); // {c0, d0, c1, d1}
+            v4s cdHi = __builtin_shuffle(vc, vd, shufflemask_hi); // {c2, d2, c3, d3}
+            *((v4s *)pY) = __builtin_shuffle(abLo, cdLo, shufflemask_even); // {a0, b0, c0, d0}
+            pY += strideDst;
+            *((v4s *)pY) = __builtin_shuffle(abLo, cdLo, shufflemask_odd); // {a1, b1, c1, d1}
+            pY += strideDst;
+            *((v4s *)pY) = __builtin_shuffle(abHi, cdHi, shufflemask_even); // {a2, b2, c2, d2}
+            pY += strideDst;
+            *((v4s *)pY) = __builtin_shuffle(abHi, cdHi, shufflemask_odd); // {a3, b3, c3, d3}
+            pY += strideDst;
+        }
+        /* remaining columns */
+        for (; n < N; n++) {
+            pY[0] = pA[n];
+            pY[1] = pB[n];
+            pY[2] = pC[n];
+            pY[3] = pD[n];
+            pY += strideDst;
+        }
+    }
+
+    /* remaining rows */
+    for (m = (M & ~3U) + core_id; m < M; m += nPE) {
+        const int8_t *pA = pSrc + m * strideSrc;
+        int8_t *pY = pDst + m;
+        for (n = 0; n < N; n++) {
+            *pY = *pA++;
+            pY += strideDst;
+        }
+    }
+}
+
+/**
+   @} end of MatTransStrideKernels group
+*/
@@ -53,6 +53,8 @@
 
 void plp_max_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes) {
 
+    PLP_PROFILE_FUNC();
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         *pRes = -1;
     } else {
@@ -73,6 +73,8 @@ void plp_power_i32(const int32_t *__restrict__ pSrc,
                    uint32_t blockSize,
                    int32_t *__restrict__ pRes) {
 
+    PLP_PROFILE_FUNC();
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         plp_power_i32s_rv32im(pSrc, blockSize, pRes);
     } else {
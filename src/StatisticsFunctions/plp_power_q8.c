@@ -74,6 +74,8 @@ void plp_power_q8(const int8_t *__restrict__ pSrc,
                   uint32_t fracBits,
                   int32_t *__restrict__ pRes) {
 
+    PLP_PROFILE_FUNC();
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         plp_power_q8s_rv32im(pSrc, blockSize, fracBits, pRes);
     } else {
@@ -55,6 +55,8 @@ void plp_std_q8(const int8_t *__restrict__ pSrc,
                 uint32_t fracBits,
                 int8_t *__restrict__ pRes) {
 
+    PLP_PROFILE_FUNC();
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         plp_std_q8s_rv32im(pSrc, blockSize, fracBits, pRes);
     } else {
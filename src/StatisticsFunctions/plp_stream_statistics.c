@@ -0,0 +1,150 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_stream_statistics.c
+ * Description:  Streaming adapters of the statistics functions
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_const_structs.h"
+
+/**
+  @ingroup Stream
+ */
+
+/**
+  @defgroup StreamStatistics Streaming Adapters of the Statistics Functions
+  PLP_STREAM_REDUCE operations for plp_stream which compute a tile with the single-core XPULPV2
+  kernels of the statistics functions. max and min return a value of the input type, power
+  returns the 32-bit sum of squares.
+ */
+
+/**
+  @addtogroup StreamStatistics
+  @{
+ */
+
+static void plp_stream_max_i32_combine(void *pRes, const void *pPartial) {
+    if (*(const int32_t *)pPartial > *(int32_t *)pRes) {
+        *(int32_t *)pRes = *(const int32_t *)pPartial;
+    }
+}
+
+static void plp_stream_max_i16_combine(void *pRes, const void *pPartial) {
+    if (*(const int16_t *)pPartial > *(int16_t *)pRes) {
+        *(int16_t *)pRes = *(const int16_t *)pPartial;
+    }
+}
+
+static void plp_stream_max_i8_combine(void *pRes, const void *pPartial) {
+    if (*(const int8_t *)pPartial > *(int8_t *)pRes) {
+        *(int8_t *)pRes = *(const int8_t *)pPartial;
+    }
+}
+
+static void plp_stream_min_i32_combine(void *pRes, const void *pPartial) {
+    if (*(const int32_t *)pPartial < *(int32_t *)pRes) {
+        *(int32_t *)pRes = *(const int32_t *)pPartial;
+    }
+}
+
+static void plp_stream_min_i16_combine(void *pRes, const void *pPartial) {
+    if (*(const int16_t *)pPartial < *(int16_t *)pRes) {
+        *(int16_t *)pRes = *(const int16_t *)pPartial;
+    }
+}
+
+static void plp_stream_min_i8_combine(void *pRes, const void *pPartial) {
+    if (*(const int8_t *)pPartial < *(int8_t *)pRes) {
+        *(int8_t *)pRes = *(const int8_t *)pPartial;
+    }
+}
+
+static void plp_stream_max_i32_kernel(
+    const void *pSrcA, const void *pSrcB, uint32_t len, void *pDst, const void *args) {
+    plp_max_i32s_xpulpv2((const int32_t *)pSrcA, len, (int32_t *)pDst);
+}
+
+static void plp_stream_max_i16_kernel(
+    const void *pSrcA, const void *pSrcB, uint32_t len, void *pDst, const void *args) {
+    plp_max_i16s_xpulpv2((const int16_t *)pSrcA, len, (int16_t *)pDst);
+}
+
+static void plp_stream_max_i8_kernel(
+    const void *pSrcA, const void *pSrcB, uint32_t len, void *pDst, const void *args) {
+    plp_max_i8s_xpulpv2((const int8_t *)pSrcA, len, (int8_t *)pDst);
+}
+
+static void plp_stream_min_i32_kernel(
+    const void *pSrcA, const void *pSrcB, uint32_t len, void *pDst, const void *args) {
+    plp_min_i32s_xpulpv2((const int32_t *)pSrcA, len, (int32_t *)pDst);
+}
+
+static void plp_stream_min_i16_kernel(
+    const void *pSrcA, const void *pSrcB, uint32_t len, void *pDst, const void *args) {
+    plp_min_i16s_xpulpv2((const int16_t *)pSrcA, len, (int16_t *)pDst);
+}
+
+static void plp_stream_min_i8_kernel(
+    const void *pSrcA, const void *pSrcB, uint32_t len, void *pDst, const void *args) {
+    plp_min_i8s_xpulpv2((const int8_t *)pSrcA, len, (int8_t *)pDst);
+}
+
+static void plp_stream_power_i32_kernel(
+    const void *pSrcA, const void *pSrcB, uint32_t len, void *pDst, const void *args) {
+    plp_power_i32s_xpulpv2((const int32_t *)pSrcA, len, (int32_t *)pDst);
+}
+
+static void plp_stream_power_i16_kernel(
+    const void *pSrcA, const void *pSrcB, uint32_t len, void *pDst, const void *args) {
+    plp_power_i16s_xpulpv2((const int16_t *)pSrcA, len, (int32_t *)pDst);
+}
+
+static void plp_stream_power_i8_kernel(
+    const void *pSrcA, const void *pSrcB, uint32_t len, void *pDst, const void *args) {
+    plp_power_i8s_xpulpv2((const int8_t *)pSrcA, len, (int32_t *)pDst);
+}
+
+const plp_stream_op plp_stream_max_i32 = { plp_stream_max_i32_kernel, plp_stream_max_i32_combine,
+                                           PLP_STREAM_REDUCE, 4, 4 };
+const plp_stream_op plp_stream_max_i16 = { plp_stream_max_i16_kernel, plp_stream_max_i16_combine,
+                                           PLP_STREAM_REDUCE, 2, 2 };
+const plp_stream_op plp_stream_max_i8 = { plp_stream_max_i8_kernel, plp_stream_max_i8_combine,
+                                          PLP_STREAM_REDUCE, 1, 1 };
+const plp_stream_op plp_stream_min_i32 = { plp_stream_min_i32_kernel, plp_stream_min_i32_combine,
+                                           PLP_STREAM_REDUCE, 4, 4 };
+const plp_stream_op plp_stream_min_i16 = { plp_stream_min_i16_kernel, plp_stream_min_i16_combine,
+                                           PLP_STREAM_REDUCE, 2, 2 };
+const plp_stream_op plp_stream_min_i8 = { plp_stream_min_i8_kernel, plp_stream_min_i8_combine,
+                                          PLP_STREAM_REDUCE, 1, 1 };
+const plp_stream_op plp_stream_power_i32 = { plp_stream_power_i32_kernel, plp_stream_sum_i32,
+                                             PLP_STREAM_REDUCE, 4, 4 };
+const plp_stream_op plp_stream_power_i16 = { plp_stream_power_i16_kernel, plp_stream_sum_i32,
+                                             PLP_STREAM_REDUCE, 2, 4 };
+const plp_stream_op plp_stream_power_i8 = { plp_stream_power_i8_kernel, plp_stream_sum_i32,
+                                            PLP_STREAM_REDUCE, 1, 4 };
+
+/**
+  @} end of StreamStatistics group
+ */
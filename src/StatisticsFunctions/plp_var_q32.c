@@ -55,6 +55,8 @@ void plp_var_q32(const int32_t *__restrict__ pSrc,
                  uint32_t fracBits,
                  int32_t *__restrict__ pRes) {
 
+    PLP_PROFILE_FUNC();
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         plp_var_q32s_rv32im(pSrc, blockSize, fracBits, pRes);
     } else {
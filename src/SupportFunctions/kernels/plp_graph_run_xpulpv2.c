@@ -0,0 +1,182 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_graph_run_xpulpv2.c
+ * Description:  Parallel execution of the processing graph for XPULPV2
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/**
+  @ingroup Graph
+ */
+
+/**
+  @defgroup GraphKernels Processing Graph Kernels
+ */
+
+/**
+  @addtogroup GraphKernels
+  @{
+ */
+
+static void plp_graph_chain(const plp_graph_arg *A, uint32_t first, uint32_t last) {
+
+    const plp_graph_node *pNodes = A->G->pNodes;
+    const plp_graph_node *pTail = &pNodes[last];
+    uint32_t core_id = rt_core_id();
+    uint32_t nPE = A->nPE;
+    uint32_t len = pNodes[first].len;
+    uint32_t reduce = (pTail->pOp->kind == PLP_STREAM_REDUCE);
+
+    uint8_t *pPartial = reduce ? A->pPartial + PLP_STREAM_PARTIAL_SIZE * core_id : NULL;
+    uint8_t *pBlock[2];
+    int32_t tmp[2];
+    uint32_t idx, k;
+
+    /* the word after the partial result is set once the core has a result */
+    if (reduce) {
+        *(uint32_t *)(pPartial + 8) = 0;
+    }
+
+    /* chunks of a multiple of 4 elements keep the SIMD kernels aligned */
+    uint32_t chunk = (((len + nPE - 1) / nPE) + 3) & ~3U;
+    uint32_t start = core_id * chunk;
+
+    if (start >= len) {
+        return;
+    }
+
+    uint32_t end = (len - start < chunk) ? len : start + chunk;
+
+    /* a single node is computed at once, a fused chain block by block */
+    uint32_t blockLen = (last > first) ? PLP_GRAPH_FUSE_BLOCK : chunk;
+
+    pBlock[0] = A->pBlocks + core_id * A->blockSize;
+    pBlock[1] = pBlock[0] + A->blockSize / 2;
+
+    for (idx = start; idx < end; idx += blockLen) {
+        uint32_t n = (end - idx < blockLen) ? end - idx : blockLen;
+        uint32_t prevBuf = PLP_GRAPH_NONE;
+        void *pPrev = NULL;
+
+        for (k = first; k <= last; k++) {
+            const plp_graph_node *pNode = &pNodes[k];
+            const plp_stream_op *pOp = pNode->pOp;
+            const void *pA;
+            const void *pB = NULL;
+            void *pDst;
+
+            pA = (pNode->srcA == prevBuf) ? pPrev
+                                          : (uint8_t *)A->ppData[pNode->srcA] + idx * pOp->srcSize;
+            if (pNode->srcB != PLP_GRAPH_NONE) {
+                pB = (pNode->srcB == prevBuf)
+                         ? pPrev
+                         : (uint8_t *)A->ppData[pNode->srcB] + idx * pOp->srcSize;
+            }
+
+            if (k < last) {
+                pDst = pBlock[(k - first) & 1];
+                pOp->kernel(pA, pB, n, pDst, pNode->args);
+            } else if (!reduce) {
+                pDst = (uint8_t *)A->ppData[pNode->dst] + idx * pOp->dstSize;
+                pOp->kernel(pA, pB, n, pDst, pNode->args);
+            } else if (!*(uint32_t *)(pPartial + 8)) {
+                pDst = pPartial;
+                pOp->kernel(pA, pB, n, pDst, pNode->args);
+                *(uint32_t *)(pPartial + 8) = 1;
+            } else {
+                pDst = tmp;
+                pOp->kernel(pA, pB, n, pDst, pNode->args);
+                pOp->combine(pPartial, tmp);
+            }
+
+            prevBuf = pNode->dst;
+            pPrev = pDst;
+        }
+    }
+}
+
+/**
+  @brief         Executes the nodes of a processing graph, called by every core of the team. Each
+                 core computes its chunk of an operation node or of a fused chain, and the cores
+                 are separated by rt_team_barrier after each node or chain.
+  @param[in]     args  points to the plp_graph_arg
+  @return        none
+*/
+
+void plp_graph_run_xpulpv2(void *args) {
+
+    plp_graph_arg *A = (plp_graph_arg *)args;
+    const plp_graph_instance *G = A->G;
+    uint32_t core_id = rt_core_id();
+    uint32_t i = 0;
+
+    while (i < G->numNodes) {
+        const plp_graph_node *pNode = &G->pNodes[i];
+
+        if (pNode->pOp == NULL) {
+            if (!pNode->masterOnly || core_id == 0) {
+                pNode->kernel(pNode->args);
+            }
+            i++;
+        } else {
+            uint32_t last = i;
+            while (G->pNodes[last].fused) {
+                last++;
+            }
+
+            plp_graph_chain(A, i, last);
+
+            const plp_graph_node *pTail = &G->pNodes[last];
+            if (pTail->pOp->kind == PLP_STREAM_REDUCE) {
+                rt_team_barrier();
+
+                /* core 0 always has a part of the elements */
+                if (core_id == 0) {
+                    uint8_t *pRes = (uint8_t *)A->ppData[pTail->dst];
+                    uint32_t k;
+
+                    for (k = 0; k < pTail->pOp->dstSize; k++) {
+                        pRes[k] = A->pPartial[k];
+                    }
+                    for (k = 1; k < A->nPE; k++) {
+                        uint8_t *pCore = A->pPartial + PLP_STREAM_PARTIAL_SIZE * k;
+                        if (*(uint32_t *)(pCore + 8)) {
+                            pTail->pOp->combine(pRes, pCore);
+                        }
+                    }
+                }
+            }
+            i = last + 1;
+        }
+
+        rt_team_barrier();
+    }
+}
+
+/**
+  @} end of GraphKernels group
+ */
@@ -0,0 +1,94 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_pipeline_xpulpv2.c
+ * Description:  Cluster stage of the fabric controller and cluster pipeline
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/**
+  @ingroup Pipeline
+ */
+
+/**
+  @defgroup PipelineKernels FC/Cluster Pipeline Kernels
+ */
+
+/**
+  @addtogroup PipelineKernels
+  @{
+ */
+
+/**
+  @brief         Consumes the frames of the pipeline on the cluster, called by core 0 of the
+                 cluster. Waits for each frame of the FC stage, computes the cluster stage on it
+                 and releases its descriptor.
+  @param[in]     args  points to the plp_pipeline_arg
+  @return        none
+*/
+
+void plp_pipeline_xpulpv2(void *args) {
+
+    plp_pipeline_arg *A = (plp_pipeline_arg *)args;
+    plp_pipeline_instance *S = A->S;
+    plp_pipeline_stats *pStats = &S->stats;
+    uint32_t tBegin, tEnd, latency;
+    uint32_t n;
+
+    for (n = 0; n < A->numFrames; n++) {
+        /* wait for the FC to publish the frame */
+        if (S->tail == S->head) {
+            pStats->emptyWaits++;
+            while (S->tail == S->head) {
+            }
+        }
+
+        plp_pipeline_frame *pFrame = &S->pFrames[S->head % S->depth];
+
+        tBegin = (uint32_t)rt_time_get_us();
+        S->clusterStage(pFrame, S->clusterArgs);
+        tEnd = (uint32_t)rt_time_get_us();
+
+        latency = tEnd - pFrame->tStart;
+        pStats->busyCluster += tEnd - tBegin;
+        pStats->latencySum += latency;
+        if (latency < pStats->latencyMin) {
+            pStats->latencyMin = latency;
+        }
+        if (latency > pStats->latencyMax) {
+            pStats->latencyMax = latency;
+        }
+        pStats->numFrames++;
+
+        /* the frame must be consumed before its descriptor is released */
+        __asm__ volatile("" : : : "memory");
+        S->head = S->head + 1;
+    }
+}
+
+/**
+  @} end of PipelineKernels group
+ */
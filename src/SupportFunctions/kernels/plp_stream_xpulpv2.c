@@ -0,0 +1,193 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_stream_xpulpv2.c
+ * Description:  Parallel tile pipeline of the streaming layer for XPULPV2
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/**
+  @ingroup Stream
+ */
+
+/**
+  @defgroup StreamKernels Tiled Streaming Kernels
+ */
+
+/**
+  @addtogroup StreamKernels
+  @{
+ */
+
+static void plp_stream_load(const plp_stream_arg *A,
+                            uint32_t tile,
+                            uint32_t inLen,
+                            uint32_t buf,
+                            rt_dma_copy_t *copy) {
+
+    const plp_stream_instance *S = A->S;
+    uint32_t srcSize = S->pOp->srcSize;
+    uint32_t offset = tile * S->tileLen * srcSize;
+
+    rt_dma_memcpy((uintptr_t)((const uint8_t *)S->pSrcA + offset), (uintptr_t)A->pInA[buf],
+                  inLen * srcSize, RT_DMA_DIR_EXT2LOC, 0, copy);
+
+    if (S->pSrcB != NULL) {
+        rt_dma_memcpy((uintptr_t)((const uint8_t *)S->pSrcB + offset),
+                      (uintptr_t)A->pInB[buf], inLen * srcSize, RT_DMA_DIR_EXT2LOC, 1, copy);
+    }
+}
+
+/**
+  @brief         Streams the tiles through L1 and computes them, called by every core of the team.
+                 Core 0 transfers tile t + 1 into L1 and the result of tile t - 1 into L2 while
+                 the team computes tile t.
+  @param[in]     args  points to the plp_stream_arg
+  @return        none
+*/
+
+void plp_stream_xpulpv2(void *args) {
+
+    plp_stream_arg *A = (plp_stream_arg *)args;
+    const plp_stream_instance *S = A->S;
+    const plp_stream_op *pOp = S->pOp;
+    uint32_t core_id = rt_core_id();
+    uint32_t nPE = A->nPE;
+
+    uint32_t srcSize = pOp->srcSize;
+    uint32_t dstSize = pOp->dstSize;
+    uint32_t reduce = (pOp->kind == PLP_STREAM_REDUCE);
+    uint32_t halo = (pOp->kind == PLP_STREAM_WINDOW) ? S->halo : 0;
+    uint32_t tileLen = S->tileLen;
+    uint32_t totalLen = S->srcLen - halo;
+    uint32_t numTiles = (totalLen + tileLen - 1) / tileLen;
+
+    rt_dma_copy_t copyIn[2];
+    rt_dma_copy_t copyOut[2];
+    uint32_t outPending[2] = { 0, 0 };
+
+    uint8_t *pPartial = reduce ? A->pPartial + PLP_STREAM_PARTIAL_SIZE * core_id : NULL;
+    int32_t tmp[2];
+    uint32_t first = 1;
+    uint32_t t, buf;
+
+    /* the word after the partial result is set once the core has a result */
+    if (reduce) {
+        *(uint32_t *)(pPartial + 8) = 0;
+    }
+
+    if (core_id == 0) {
+        uint32_t len = (totalLen < tileLen) ? totalLen : tileLen;
+        plp_stream_load(A, 0, len + halo, 0, &copyIn[0]);
+        rt_dma_wait(&copyIn[0]);
+    }
+
+    for (t = 0; t < numTiles; t++) {
+        buf = t & 1;
+
+        uint32_t start = t * tileLen;
+        uint32_t len = (totalLen - start < tileLen) ? totalLen - start : tileLen;
+
+        if (core_id == 0) {
+            if (t + 1 < numTiles) {
+                uint32_t nextLen = (totalLen - start - len < tileLen) ? totalLen - start - len
+                                                                      : tileLen;
+                plp_stream_load(A, t + 1, nextLen + halo, buf ^ 1, &copyIn[buf ^ 1]);
+            }
+            /* the output buffer of tile t - 2 is reused */
+            if (outPending[buf]) {
+                rt_dma_wait(&copyOut[buf]);
+                outPending[buf] = 0;
+            }
+        }
+
+        rt_team_barrier();
+
+        /* chunks of a multiple of 4 elements keep the SIMD kernels aligned */
+        uint32_t chunk = (((len + nPE - 1) / nPE) + 3) & ~3U;
+        uint32_t first_idx = core_id * chunk;
+
+        if (first_idx < len) {
+            uint32_t n = (len - first_idx < chunk) ? len - first_idx : chunk;
+            const uint8_t *pA = A->pInA[buf] + first_idx * srcSize;
+            const uint8_t *pB = (S->pSrcB != NULL) ? A->pInB[buf] + first_idx * srcSize : NULL;
+
+            if (!reduce) {
+                pOp->kernel(pA, pB, n, A->pOut[buf] + first_idx * dstSize, S->args);
+            } else if (first) {
+                pOp->kernel(pA, pB, n, pPartial, S->args);
+                *(uint32_t *)(pPartial + 8) = 1;
+                first = 0;
+            } else {
+                pOp->kernel(pA, pB, n, tmp, S->args);
+                pOp->combine(pPartial, tmp);
+            }
+        }
+
+        rt_team_barrier();
+
+        if (core_id == 0) {
+            if (!reduce) {
+                rt_dma_memcpy((uintptr_t)((uint8_t *)S->pDst + start * dstSize),
+                              (uintptr_t)A->pOut[buf], len * dstSize, RT_DMA_DIR_LOC2EXT, 0,
+                              &copyOut[buf]);
+                outPending[buf] = 1;
+            }
+            if (t + 1 < numTiles) {
+                rt_dma_wait(&copyIn[buf ^ 1]);
+            }
+        }
+    }
+
+    if (core_id == 0) {
+        if (outPending[0]) {
+            rt_dma_wait(&copyOut[0]);
+        }
+        if (outPending[1]) {
+            rt_dma_wait(&copyOut[1]);
+        }
+
+        if (reduce) {
+            /* core 0 always has a part of the first tile */
+            uint8_t *pRes = (uint8_t *)S->pDst;
+            uint32_t i;
+
+            for (i = 0; i < dstSize; i++) {
+                pRes[i] = A->pPartial[i];
+            }
+            for (i = 1; i < nPE; i++) {
+                uint8_t *pCore = A->pPartial + PLP_STREAM_PARTIAL_SIZE * i;
+                if (*(uint32_t *)(pCore + 8)) {
+                    pOp->combine(pRes, pCore);
+                }
+            }
+        }
+    }
+}
+
+/**
+  @} end of StreamKernels group
+ */
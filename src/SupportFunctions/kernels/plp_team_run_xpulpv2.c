@@ -0,0 +1,71 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_team_run_xpulpv2.c
+ * Description:  Executes a chain of parallel kernels on a persistent team for XPULPV2
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/**
+  @ingroup Team
+ */
+
+/**
+  @defgroup TeamKernels Persistent Team Kernels
+ */
+
+/**
+  @addtogroup TeamKernels
+  @{
+ */
+
+/**
+  @brief         Executes a chain of parallel kernels, called by every core of the team. The
+                 barrier after each step makes the results of a step visible to the next one.
+  @param[in]     args  points to the plp_team_instance
+  @return        none
+*/
+
+void plp_team_run_xpulpv2(void *args) {
+
+    plp_team_instance *S = (plp_team_instance *)args;
+    const plp_team_step *pStep = S->pSteps;
+    uint32_t core_id = rt_core_id();
+    uint32_t i;
+
+    for (i = 0; i < S->numSteps; i++) {
+        if (!pStep->masterOnly || core_id == 0) {
+            pStep->kernel(pStep->args);
+        }
+        pStep++;
+
+        rt_team_barrier();
+    }
+}
+
+/**
+  @} end of TeamKernels group
+ */
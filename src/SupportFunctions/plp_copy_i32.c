@@ -80,6 +80,8 @@
 
 void plp_copy_i32(int32_t *__restrict__ pSrc, int32_t *__restrict__ pDst, uint32_t blockSize) {
 
+    PLP_PROFILE_FUNC();
+
     uint32_t blkCnt; /* Loop counter */
 
     if (rt_cluster_id() == ARCHI_FC_CID) {
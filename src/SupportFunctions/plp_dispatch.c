@@ -0,0 +1,205 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dispatch.c
+ * Description:  Runtime selection of the number of cores and the variant of the glue code
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+typedef struct {
+    const plp_dispatch_entry *pEntries;
+    uint32_t numEntries;
+} plp_dispatch_table;
+
+static plp_dispatch_table plp_dispatch_tables[PLP_DISPATCH_NUM_FUNCS];
+
+/* number of variants which plp_dispatch_tune tries, PLP_DISPATCH_DEFAULT if 1 */
+static const uint8_t plp_dispatch_num_variants[PLP_DISPATCH_NUM_FUNCS] = { 2, 2, 2, 1, 1, 1 };
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @defgroup Dispatch Kernel Dispatch
+  The best way to run a function depends on the size of the problem. For short vectors, the fork
+  of a _parallel function costs more than the additional cores save, and the parallel
+  overlap-adding of the convolution only pays off for long results. A dispatch table selects the
+  number of cores and the variant of a function by the length of the problem. The _parallel glue
+  code uses at most the selected number of cores, and at most the nPE passed by the caller. Without
+  a table, the glue code uses nPE and the variant selected at compile time, e.g. by
+  PLP_CONV_SEQUENTIALADDING.
+  @par
+  The tables are set from a stored profile with plp_dispatch_set, or measured at startup with
+  plp_dispatch_tune. For each length, plp_dispatch_tune runs the function with 1, 2, 4, ... cores
+  and each of its variants, and selects the candidate with the fewest cycles. On a tie, it
+  selects fewer cores.
+  @par
+  Functions and their length:
+  - PLP_DISPATCH_CONV_I32, _I16, _I8: length of the longer input, variants PLP_DISPATCH_OLA and
+    PLP_DISPATCH_SEQUENTIAL
+  - PLP_DISPATCH_DOT_PROD_I32, _Q32, _F32: blockSize
+  @par
+  <pre>static void run_conv(uint32_t len, uint32_t nPE, void *args) {
+    plp_conv_i16_parallel(pSignal, len, pFilter, 32, nPE, pRes);
+}
+
+uint32_t lens[] = { 64, 256, 1024 };
+plp_dispatch_entry entries[3];
+plp_dispatch_tune(PLP_DISPATCH_CONV_I16, lens, 3, 8, run_conv, NULL, entries);</pre>
+ */
+
+/**
+  @addtogroup Dispatch
+  @{
+ */
+
+/**
+  @brief         Sets the dispatch table of a function.
+  @param[in]     func        function, e.g. PLP_DISPATCH_CONV_I16
+  @param[in]     pEntries    points to the entries sorted by maxLen, NULL to remove the table
+  @param[in]     numEntries  number of entries
+  @return        none
+*/
+
+void plp_dispatch_set(uint32_t func, const plp_dispatch_entry *pEntries, uint32_t numEntries) {
+
+    if (func >= PLP_DISPATCH_NUM_FUNCS) {
+        return;
+    }
+
+    plp_dispatch_tables[func].pEntries = pEntries;
+    plp_dispatch_tables[func].numEntries = (pEntries != NULL) ? numEntries : 0;
+}
+
+/**
+  @brief         Selects the number of cores and the variant of a function for a length. Without
+                 a table, both are left unchanged.
+  @param[in]     func      function, e.g. PLP_DISPATCH_CONV_I16
+  @param[in]     len       length of the problem
+  @param[in,out] pNPE      number of cores requested by the caller, reduced to the selected one
+  @param[in,out] pVariant  default variant of the caller, replaced by the selected one, can be NULL
+  @return        none
+*/
+
+void plp_dispatch_select(uint32_t func, uint32_t len, uint32_t *pNPE, uint32_t *pVariant) {
+
+    if (func >= PLP_DISPATCH_NUM_FUNCS || plp_dispatch_tables[func].numEntries == 0) {
+        return;
+    }
+
+    const plp_dispatch_entry *pEntry = plp_dispatch_tables[func].pEntries;
+    const plp_dispatch_entry *pLast = pEntry + plp_dispatch_tables[func].numEntries - 1;
+
+    while (pEntry != pLast && len > pEntry->maxLen) {
+        pEntry++;
+    }
+
+    if (pEntry->nPE > 0 && pEntry->nPE < *pNPE) {
+        *pNPE = pEntry->nPE;
+    }
+    if (pVariant != NULL && pEntry->variant != PLP_DISPATCH_DEFAULT) {
+        *pVariant = pEntry->variant;
+    }
+}
+
+/**
+  @brief         Measures the candidates of a function with rt_perf and sets its dispatch table.
+                 Each candidate runs once to warm up the instruction cache, and once measured.
+  @param[in]     func      function, e.g. PLP_DISPATCH_CONV_I16
+  @param[in]     pLens     points to the lengths to measure, in ascending order
+  @param[in]     numLens   number of lengths
+  @param[in]     maxPE     largest number of cores to try
+  @param[in]     run       calls the function once for a length with nPE cores
+  @param[in]     args      passed to run
+  @param[out]    pEntries  numLens entries of the dispatch table, must stay valid while it is used
+  @return        none
+*/
+
+void plp_dispatch_tune(uint32_t func,
+                       const uint32_t *pLens,
+                       uint32_t numLens,
+                       uint32_t maxPE,
+                       void (*run)(uint32_t len, uint32_t nPE, void *args),
+                       void *args,
+                       plp_dispatch_entry *pEntries) {
+
+    if (func >= PLP_DISPATCH_NUM_FUNCS || numLens == 0 || maxPE == 0) {
+        return;
+    }
+
+    uint32_t numVariants = plp_dispatch_num_variants[func];
+    plp_dispatch_entry candidate;
+    rt_perf_t perf;
+    uint32_t i, nPE, v;
+
+    rt_perf_init(&perf);
+    rt_perf_conf(&perf, (1 << RT_PERF_CYCLES));
+
+    for (i = 0; i < numLens; i++) {
+        uint32_t bestCycles = 0xFFFFFFFF;
+
+        pEntries[i].maxLen = pLens[i];
+        pEntries[i].nPE = 1;
+        pEntries[i].variant = PLP_DISPATCH_DEFAULT;
+
+        /* 1, 2, 4, ... cores, and maxPE if it is not a power of two */
+        nPE = 1;
+        while (1) {
+            for (v = 0; v < numVariants; v++) {
+                candidate.maxLen = 0xFFFFFFFF;
+                candidate.nPE = nPE;
+                candidate.variant = (numVariants > 1) ? v + 1 : PLP_DISPATCH_DEFAULT;
+                plp_dispatch_set(func, &candidate, 1);
+
+                run(pLens[i], maxPE, args);
+
+                rt_perf_reset(&perf);
+                rt_perf_start(&perf);
+                run(pLens[i], maxPE, args);
+                rt_perf_stop(&perf);
+
+                uint32_t cycles = rt_perf_read(RT_PERF_CYCLES);
+                if (cycles < bestCycles) {
+                    bestCycles = cycles;
+                    pEntries[i].nPE = nPE;
+                    pEntries[i].variant = candidate.variant;
+                }
+            }
+
+            if (nPE == maxPE) {
+                break;
+            }
+            nPE = (2 * nPE < maxPE) ? 2 * nPE : maxPE;
+        }
+    }
+
+    plp_dispatch_set(func, pEntries, numLens);
+}
+
+/**
+  @} end of Dispatch group
+ */
@@ -0,0 +1,365 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_graph.c
+ * Description:  Planning and glue code of the declarative processing graph
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @defgroup Graph Processing Graph
+  An application which calls many library functions per frame writes every intermediate result
+  to its own buffer in L1, and forks the team for every call. plp_graph describes such a chain
+  statically: the nodes are calls of library functions, the buffers are the edges between them.
+  @par
+  There are two kinds of nodes:
+  - Operation nodes compute a PLP_STREAM_MAP or PLP_STREAM_REDUCE operation of plp_stream, e.g.
+    plp_stream_abs_i16, on len elements. Each core computes a chunk of the elements.
+  - Kernel nodes call the per-core entry point of a parallel kernel, like a step of plp_team_run.
+    The bind function writes the addresses of the buffers into the argument structure.
+  @par
+  plp_graph_plan fuses a node into the next one if both are operation nodes of the same length,
+  the next one reads the output and no other node uses it. The fused chain is computed in blocks
+  of PLP_GRAPH_FUSE_BLOCK elements, whose intermediate results stay in two small buffers per core.
+  The remaining intermediate buffers are placed in one L1 region. Two buffers share memory if
+  their lifetimes, from the first to the last node which uses them, do not overlap. plp_graph_run
+  takes the region from the scratch arena and executes all nodes inside one fork, separated by
+  rt_team_barrier.
+  @par
+  A graph planned with fuse set to 0 executes every node like the call of the library function,
+  which is the reference to validate the fused graph against.
+  @par
+  <pre>plp_graph_buffer buffers[] = { { 2 * N, pSrc }, { 2 * N, pWindow }, { 4 * N, NULL },
+                               { 4 * N, NULL }, { 4, &peak } };
+plp_graph_node nodes[] = { { &plp_stream_mult_i16, NULL, NULL, NULL, N, 0, 1, 2 },
+                           { &plp_stream_abs_i32, NULL, NULL, NULL, N, 2, PLP_GRAPH_NONE, 3 },
+                           { &plp_stream_max_i32, NULL, NULL, NULL, N, 3, PLP_GRAPH_NONE, 4 } };
+plp_graph_instance G = { nodes, 3, buffers, 5, 1 };
+plp_graph_plan(&G);
+plp_graph_run(&G, 8);</pre>
+ */
+
+/**
+  @addtogroup Graph
+  @{
+ */
+
+static uint32_t plp_graph_uses(const plp_graph_node *pNode, uint32_t buf) {
+    return (pNode->srcA == buf) || (pNode->srcB == buf) || (pNode->dst == buf);
+}
+
+static int plp_graph_check(const plp_graph_instance *G) {
+
+    uint8_t written[PLP_GRAPH_MAX_BUFFERS];
+    uint32_t i;
+
+    if (G->numBuffers > PLP_GRAPH_MAX_BUFFERS) {
+        return 1;
+    }
+
+    for (i = 0; i < G->numBuffers; i++) {
+        written[i] = (G->pBuffers[i].pData != NULL);
+    }
+
+    for (i = 0; i < G->numNodes; i++) {
+        const plp_graph_node *pNode = &G->pNodes[i];
+        const plp_stream_op *pOp = pNode->pOp;
+
+        if ((pNode->srcA != PLP_GRAPH_NONE && pNode->srcA >= G->numBuffers) ||
+            (pNode->srcB != PLP_GRAPH_NONE && pNode->srcB >= G->numBuffers) ||
+            (pNode->dst != PLP_GRAPH_NONE && pNode->dst >= G->numBuffers)) {
+            return 1;
+        }
+
+        /* an intermediate buffer must be written before it is read */
+        if ((pNode->srcA != PLP_GRAPH_NONE && !written[pNode->srcA]) ||
+            (pNode->srcB != PLP_GRAPH_NONE && !written[pNode->srcB])) {
+            return 1;
+        }
+
+        if (pOp != NULL) {
+            if (pOp->kind == PLP_STREAM_WINDOW || pNode->len == 0 ||
+                pNode->srcA == PLP_GRAPH_NONE || pNode->dst == PLP_GRAPH_NONE) {
+                return 1;
+            }
+            if (G->pBuffers[pNode->srcA].size < pNode->len * pOp->srcSize ||
+                (pNode->srcB != PLP_GRAPH_NONE &&
+                 G->pBuffers[pNode->srcB].size < pNode->len * pOp->srcSize)) {
+                return 1;
+            }
+            if (G->pBuffers[pNode->dst].size <
+                ((pOp->kind == PLP_STREAM_MAP) ? pNode->len * pOp->dstSize : pOp->dstSize)) {
+                return 1;
+            }
+        } else if (pNode->kernel == NULL) {
+            return 1;
+        }
+
+        if (pNode->dst != PLP_GRAPH_NONE) {
+            written[pNode->dst] = 1;
+        }
+    }
+
+    return 0;
+}
+
+static uint32_t plp_graph_fusable(const plp_graph_instance *G, uint32_t i) {
+
+    const plp_graph_node *pNode = &G->pNodes[i];
+    const plp_graph_node *pNext = &G->pNodes[i + 1];
+    uint32_t buf = pNode->dst;
+    uint32_t k;
+
+    if (pNode->pOp == NULL || pNext->pOp == NULL || pNode->pOp->kind != PLP_STREAM_MAP ||
+        pNode->len != pNext->len || G->pBuffers[buf].pData != NULL) {
+        return 0;
+    }
+
+    /* the next node consumes the output, which is used by no other node */
+    if ((pNext->srcA != buf && pNext->srcB != buf) || pNext->dst == buf || pNode->srcA == buf ||
+        pNode->srcB == buf) {
+        return 0;
+    }
+
+    for (k = 0; k < G->numNodes; k++) {
+        if (k != i && k != i + 1 && plp_graph_uses(&G->pNodes[k], buf)) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/**
+  @brief         Plans a processing graph. Fuses the chains of operation nodes if G->fuse is set,
+                 computes the lifetime of each intermediate buffer in stages, i.e. fused chains or
+                 single nodes, and places the buffers in L1, the largest first, at the lowest
+                 offset which does not overlap with a placed buffer of an overlapping lifetime.
+  @param[in,out] G  points to the graph, fused, offset and footprint are set
+  @return        0: Success, 1: Invalid graph
+*/
+
+int plp_graph_plan(plp_graph_instance *G) {
+
+    PLP_PROFILE_FUNC();
+
+    uint32_t first[PLP_GRAPH_MAX_BUFFERS];
+    uint32_t last[PLP_GRAPH_MAX_BUFFERS];
+    uint8_t order[PLP_GRAPH_MAX_BUFFERS];
+    uint32_t numPlanned = 0;
+    uint32_t footprint = 0;
+    uint32_t stage = 0;
+    uint32_t i, j;
+
+    if (plp_graph_check(G)) {
+        return 1;
+    }
+
+    for (i = 0; i < G->numBuffers; i++) {
+        first[i] = PLP_GRAPH_UNPLANNED;
+        last[i] = 0;
+        G->pBuffers[i].offset = PLP_GRAPH_UNPLANNED;
+    }
+
+    /* lifetimes in stages, a fused chain is a single stage */
+    for (i = 0; i < G->numNodes; i++) {
+        plp_graph_node *pNode = &G->pNodes[i];
+        uint8_t bufs[3] = { pNode->srcA, pNode->srcB, pNode->dst };
+
+        pNode->fused = (G->fuse && i + 1 < G->numNodes) ? plp_graph_fusable(G, i) : 0;
+
+        for (j = 0; j < 3; j++) {
+            if (bufs[j] != PLP_GRAPH_NONE) {
+                if (first[bufs[j]] == PLP_GRAPH_UNPLANNED) {
+                    first[bufs[j]] = stage;
+                }
+                last[bufs[j]] = stage;
+            }
+        }
+
+        if (!pNode->fused) {
+            stage++;
+        }
+    }
+
+    /* the outputs of fused nodes are never written */
+    for (i = 0; i < G->numNodes; i++) {
+        if (G->pNodes[i].fused) {
+            first[G->pNodes[i].dst] = PLP_GRAPH_UNPLANNED;
+        }
+    }
+
+    /* sort the intermediate buffers by size, the largest first */
+    for (i = 0; i < G->numBuffers; i++) {
+        if (G->pBuffers[i].pData == NULL && first[i] != PLP_GRAPH_UNPLANNED) {
+            j = numPlanned++;
+            while (j > 0 && G->pBuffers[order[j - 1]].size < G->pBuffers[i].size) {
+                order[j] = order[j - 1];
+                j--;
+            }
+            order[j] = i;
+        }
+    }
+
+    for (i = 0; i < numPlanned; i++) {
+        uint32_t b = order[i];
+        uint32_t size = PLP_SCRATCH_ALIGN(G->pBuffers[b].size);
+        uint32_t offset = 0;
+        uint32_t moved = 1;
+
+        while (moved) {
+            moved = 0;
+            for (j = 0; j < i; j++) {
+                uint32_t q = order[j];
+                uint32_t qEnd = G->pBuffers[q].offset + PLP_SCRATCH_ALIGN(G->pBuffers[q].size);
+
+                if (first[b] <= last[q] && first[q] <= last[b] && offset < qEnd &&
+                    G->pBuffers[q].offset < offset + size) {
+                    offset = qEnd;
+                    moved = 1;
+                }
+            }
+        }
+
+        G->pBuffers[b].offset = offset;
+        if (offset + size > footprint) {
+            footprint = offset + size;
+        }
+    }
+
+    G->footprint = footprint;
+
+    return 0;
+}
+
+static uint32_t plp_graph_block_size(const plp_graph_instance *G) {
+
+    uint32_t maxSize = 0;
+    uint32_t i;
+
+    for (i = 0; i < G->numNodes; i++) {
+        if (G->pNodes[i].fused && G->pNodes[i].pOp->dstSize > maxSize) {
+            maxSize = G->pNodes[i].pOp->dstSize;
+        }
+    }
+
+    return PLP_SCRATCH_ALIGN(2 * PLP_GRAPH_FUSE_BLOCK * maxSize);
+}
+
+/**
+  @brief         Scratch memory of plp_graph_run: the planned region, the blocks of the fused
+                 chains and the partial results of the reductions.
+  @param[in]     G    points to the planned graph
+  @param[in]     nPE  number of parallel processing units
+  @return        number of bytes which plp_graph_run takes from the scratch arena
+*/
+
+uint32_t plp_graph_scratch_size(const plp_graph_instance *G, uint32_t nPE) {
+
+    uint32_t size = G->footprint + nPE * plp_graph_block_size(G);
+    uint32_t i;
+
+    for (i = 0; i < G->numNodes; i++) {
+        if (G->pNodes[i].pOp != NULL && G->pNodes[i].pOp->kind == PLP_STREAM_REDUCE) {
+            size += PLP_STREAM_PARTIAL_SIZE * nPE;
+            break;
+        }
+    }
+
+    return size;
+}
+
+/**
+  @brief         Glue code for executing a planned processing graph inside one cluster fork. The
+                 intermediate buffers are taken from the scratch arena, see plp_scratch_set.
+  @param[in]     G    points to the planned graph
+  @param[in]     nPE  number of parallel processing units
+  @return        none
+*/
+
+void plp_graph_run(const plp_graph_instance *G, uint32_t nPE) {
+
+    PLP_PROFILE_FUNC();
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Parallel processing supported only for cluster side\n");
+        return;
+    } else {
+
+        uint32_t size = plp_graph_scratch_size(G, nPE);
+        uint8_t *pBuf = NULL;
+        plp_graph_arg arg;
+        uint32_t i;
+
+        if (size > 0) {
+            pBuf = (uint8_t *)plp_scratch_alloc(RT_ALLOC_CL_DATA, size);
+            if (pBuf == NULL) {
+                printf("Error: insufficient L1 memory!\n");
+                return;
+            }
+        }
+
+        arg.G = G;
+        arg.nPE = nPE;
+        arg.blockSize = plp_graph_block_size(G);
+        arg.pBlocks = (pBuf != NULL) ? pBuf + G->footprint : NULL;
+        arg.pPartial = (pBuf != NULL) ? arg.pBlocks + nPE * arg.blockSize : NULL;
+
+        for (i = 0; i < G->numBuffers; i++) {
+            if (G->pBuffers[i].pData != NULL) {
+                arg.ppData[i] = G->pBuffers[i].pData;
+            } else if (G->pBuffers[i].offset != PLP_GRAPH_UNPLANNED) {
+                arg.ppData[i] = pBuf + G->pBuffers[i].offset;
+            } else {
+                arg.ppData[i] = NULL;
+            }
+        }
+
+        for (i = 0; i < G->numNodes; i++) {
+            const plp_graph_node *pNode = &G->pNodes[i];
+            if (pNode->pOp == NULL && pNode->bind != NULL) {
+                pNode->bind(pNode->args,
+                            (pNode->srcA != PLP_GRAPH_NONE) ? arg.ppData[pNode->srcA] : NULL,
+                            (pNode->srcB != PLP_GRAPH_NONE) ? arg.ppData[pNode->srcB] : NULL,
+                            (pNode->dst != PLP_GRAPH_NONE) ? arg.ppData[pNode->dst] : NULL);
+            }
+        }
+
+        rt_team_fork(nPE, plp_graph_run_xpulpv2, (void *)&arg);
+
+        if (size > 0) {
+            plp_scratch_free(RT_ALLOC_CL_DATA, pBuf, size);
+        }
+    }
+}
+
+/**
+  @} end of Graph group
+ */
@@ -0,0 +1,159 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_pipeline.c
+ * Description:  Software pipeline of a fabric controller and a cluster stage
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @defgroup Pipeline FC/Cluster Pipeline
+  The library runs a function either on the FC, with the rv32im kernels, or on the cluster. A
+  streaming application has stages for both: e.g. the decimation and framing of the input on the
+  FC, and the FFT and the matrix products on the cluster. plp_pipeline_run overlaps them over
+  consecutive frames: while the cluster computes frame n, the FC prepares frame n + 1.
+  @par
+  The stages exchange frame descriptors through a bounded queue of depth entries in L2. With
+  depth 2, each frame buffer is double-buffered. The FC stage waits while the queue is full, the
+  cluster stage waits while it is empty. The cluster is called once for all frames. Core 0 of the
+  cluster consumes the queue and can call the _parallel glue functions.
+  @par
+  The utilization of both stages and the latency of the frames, from the start of the FC stage to
+  the end of the cluster stage, are recorded in the statistics and printed by plp_pipeline_print.
+  @par
+  <pre>plp_pipeline_frame frames[2] = { { bufA }, { bufB } };
+plp_pipeline_instance S = { decimate, &cic, spectrum, &fft, frames, 2 };
+rt_cluster_mount(1, 0, 0, NULL);
+plp_pipeline_run(&S, 100);
+plp_pipeline_print(&S);</pre>
+ */
+
+/**
+  @addtogroup Pipeline
+  @{
+ */
+
+/**
+  @brief         Glue code for the software pipeline of a FC and a cluster stage. Must be called on
+                 the FC with the cluster mounted. The cluster is called asynchronously and
+                 consumes the frames which the FC stage produces.
+  @param[in,out] S          points to the pipeline, the statistics are updated
+  @param[in]     numFrames  number of frames to compute
+  @return        none
+*/
+
+void plp_pipeline_run(plp_pipeline_instance *S, uint32_t numFrames) {
+
+    PLP_PROFILE_FUNC();
+
+    if (rt_cluster_id() != ARCHI_FC_CID) {
+        printf("Pipeline supported only for FC side\n");
+        return;
+    } else {
+
+        plp_pipeline_stats *pStats = &S->stats;
+        plp_pipeline_arg arg = (plp_pipeline_arg){ S, numFrames };
+        rt_cluster_call_t call;
+        rt_event_t *event;
+        uint32_t tBegin, tEnd;
+        uint32_t n;
+
+        *pStats = (plp_pipeline_stats){ 0 };
+        pStats->latencyMin = 0xFFFFFFFFU;
+        S->head = 0;
+        S->tail = 0;
+
+        if (numFrames == 0 || S->depth == 0) {
+            pStats->latencyMin = 0;
+            return;
+        }
+
+        tBegin = (uint32_t)rt_time_get_us();
+
+        event = rt_event_get_blocking(NULL);
+        rt_cluster_call(&call, 0, plp_pipeline_xpulpv2, (void *)&arg, NULL, 0, 0, 0, event);
+
+        for (n = 0; n < numFrames; n++) {
+            /* wait for the cluster to release a descriptor */
+            if (S->tail - S->head == S->depth) {
+                pStats->fullWaits++;
+                while (S->tail - S->head == S->depth) {
+                }
+            }
+
+            plp_pipeline_frame *pFrame = &S->pFrames[S->tail % S->depth];
+
+            pFrame->index = n;
+            pFrame->tStart = (uint32_t)rt_time_get_us();
+            S->fcStage(pFrame, S->fcArgs);
+            tEnd = (uint32_t)rt_time_get_us();
+            pStats->busyFc += tEnd - pFrame->tStart;
+
+            /* the frame must be complete before it is published */
+            __asm__ volatile("" : : : "memory");
+            S->tail = S->tail + 1;
+        }
+
+        rt_event_wait(event);
+
+        pStats->total = (uint32_t)rt_time_get_us() - tBegin;
+    }
+}
+
+/**
+  @brief         Prints the utilization of the stages, i.e. the share of the run in which they
+                 were busy, and the latency of the frames of the last run.
+  @param[in]     S  points to the pipeline
+  @return        none
+*/
+
+void plp_pipeline_print(const plp_pipeline_instance *S) {
+
+    const plp_pipeline_stats *pStats = &S->stats;
+
+    if (pStats->numFrames == 0 || pStats->total == 0) {
+        printf("No frames recorded\n");
+        return;
+    }
+
+    printf("%u frames in %u us, %u us per frame\n", pStats->numFrames, pStats->total,
+           pStats->total / pStats->numFrames);
+    printf("%-8s %10s %6s %8s\n", "stage", "busy [us]", "util", "waits");
+    printf("%-8s %10u %5u%% %8u\n", "fc", pStats->busyFc,
+           (uint32_t)((uint64_t)pStats->busyFc * 100 / pStats->total), pStats->fullWaits);
+    printf("%-8s %10u %5u%% %8u\n", "cluster", pStats->busyCluster,
+           (uint32_t)((uint64_t)pStats->busyCluster * 100 / pStats->total), pStats->emptyWaits);
+    printf("latency [us]: min %u, avg %u, max %u\n", pStats->latencyMin,
+           pStats->latencySum / pStats->numFrames, pStats->latencyMax);
+}
+
+/**
+  @} end of Pipeline group
+ */
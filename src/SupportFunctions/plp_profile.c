@@ -0,0 +1,314 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_profile.c
+ * Description:  Performance counter profile of the glue functions
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @defgroup Profile Profiling
+  In a build with PLP_PROFILE defined, every glue function records its calls. For each function
+  and core, the profile holds the number of calls, the minimum and maximum cycles of a call, and
+  the sums of the cycles, instructions, load stalls, TCDM contentions and instruction cache misses.
+  The counters are inclusive, i.e. the calls of a glue function include the glue functions which
+  it calls. Without PLP_PROFILE, PLP_PROFILE_FUNC expands to nothing and the dump functions print
+  nothing.
+  @par
+  The performance counters of a core are configured with PLP_PROFILE_EVENTS and started at the
+  first profiled call on the core, and then run freely. On cores with fewer hardware counters than
+  events, e.g. with a single counter, PLP_PROFILE_EVENTS must be reduced to the events of
+  interest, the other columns are invalid.
+  @par
+  Every core has its own table of PLP_PROFILE_NUM_ENTRIES entries, one per function which it
+  called. A core only updates its own table, such that the fabric controller and the cluster cores
+  can be profiled at the same time without synchronization. The tables are merged when the profile
+  is printed. If the table of a core is full, the calls of further functions on it are not
+  recorded. Cluster cores beyond PLP_PROFILE_NUM_CORES are not profiled.
+  @par
+  plp_profile_dump prints the average of each function on each core in the CSV format of
+  test/mrWolf/bench.py, such that the output can be viewed and compared with
+  <pre>./bench.py view -b bench_profile.csv
+./bench.py cmp -n bench_profile.csv -o bench_old.csv</pre>
+ */
+
+/**
+  @addtogroup Profile
+  @{
+ */
+
+#if defined(PLP_PROFILE)
+
+typedef struct {
+    const plp_profile_record *pRecord;
+    uint32_t calls;
+    uint32_t cyclesMin;
+    uint32_t cyclesMax;
+    uint64_t cycles;
+    uint64_t instr;
+    uint64_t ldStall;
+    uint64_t tcdmCont;
+    uint64_t imiss;
+} plp_profile_entry;
+
+/* table 0: fabric controller, table 1 + i: cluster core i */
+#define PLP_PROFILE_NUM_TABLES (PLP_PROFILE_NUM_CORES + 1)
+
+static plp_profile_entry plp_profile_tables[PLP_PROFILE_NUM_TABLES][PLP_PROFILE_NUM_ENTRIES];
+static uint32_t plp_profile_numEntries[PLP_PROFILE_NUM_TABLES];
+static uint32_t plp_profile_dropped[PLP_PROFILE_NUM_TABLES];
+static uint8_t plp_profile_started[PLP_PROFILE_NUM_TABLES];
+
+static uint32_t plp_profile_table(void) {
+    return (rt_cluster_id() == ARCHI_FC_CID) ? 0 : 1 + rt_core_id();
+}
+
+static void plp_profile_clear(plp_profile_entry *pEntry) {
+    pEntry->calls = 0;
+    pEntry->cyclesMin = 0xFFFFFFFF;
+    pEntry->cyclesMax = 0;
+    pEntry->cycles = 0;
+    pEntry->instr = 0;
+    pEntry->ldStall = 0;
+    pEntry->tcdmCont = 0;
+    pEntry->imiss = 0;
+}
+
+/**
+  @brief         Starts the performance counters of the core at the first call, and takes their
+                 values at the start of a call.
+  @param[in]     pRecord  points to the profile of the function
+  @return        values of the performance counters
+*/
+
+plp_profile_sample plp_profile_begin(const plp_profile_record *pRecord) {
+
+    plp_profile_sample sample;
+    uint32_t table = plp_profile_table();
+
+    if (table < PLP_PROFILE_NUM_TABLES && !plp_profile_started[table]) {
+        rt_perf_t perf;
+        rt_perf_init(&perf);
+        rt_perf_conf(&perf, PLP_PROFILE_EVENTS);
+        rt_perf_reset(&perf);
+        rt_perf_start(&perf);
+        plp_profile_started[table] = 1;
+    }
+
+    sample.pRecord = pRecord;
+    sample.instr = rt_perf_read(RT_PERF_INSTR);
+    sample.ldStall = rt_perf_read(RT_PERF_LD_STALL);
+    sample.tcdmCont = rt_perf_read(RT_PERF_TCDM_CONT);
+    sample.imiss = rt_perf_read(RT_PERF_IMISS);
+    sample.cycles = rt_perf_read(RT_PERF_CYCLES);
+
+    return sample;
+}
+
+/**
+  @brief         Adds a call to the statistics of the function in the table of the core, called at
+                 every return of a profiled glue function.
+  @param[in]     pSample  points to the values of the performance counters at the start of the call
+  @return        none
+*/
+
+void plp_profile_end(plp_profile_sample *pSample) {
+
+    uint32_t cycles = rt_perf_read(RT_PERF_CYCLES) - pSample->cycles;
+    uint32_t instr = rt_perf_read(RT_PERF_INSTR) - pSample->instr;
+    uint32_t ldStall = rt_perf_read(RT_PERF_LD_STALL) - pSample->ldStall;
+    uint32_t tcdmCont = rt_perf_read(RT_PERF_TCDM_CONT) - pSample->tcdmCont;
+    uint32_t imiss = rt_perf_read(RT_PERF_IMISS) - pSample->imiss;
+
+    uint32_t table = plp_profile_table();
+    plp_profile_entry *pEntry;
+    uint32_t i;
+
+    if (table >= PLP_PROFILE_NUM_TABLES) {
+        return;
+    }
+
+    for (i = 0; i < plp_profile_numEntries[table]; i++) {
+        if (plp_profile_tables[table][i].pRecord == pSample->pRecord) {
+            break;
+        }
+    }
+
+    if (i == plp_profile_numEntries[table]) {
+        if (i == PLP_PROFILE_NUM_ENTRIES) {
+            plp_profile_dropped[table]++;
+            return;
+        }
+        plp_profile_tables[table][i].pRecord = pSample->pRecord;
+        plp_profile_clear(&plp_profile_tables[table][i]);
+        plp_profile_numEntries[table]++;
+    }
+
+    pEntry = &plp_profile_tables[table][i];
+    pEntry->calls++;
+    pEntry->cycles += cycles;
+    pEntry->instr += instr;
+    pEntry->ldStall += ldStall;
+    pEntry->tcdmCont += tcdmCont;
+    pEntry->imiss += imiss;
+    if (cycles < pEntry->cyclesMin) {
+        pEntry->cyclesMin = cycles;
+    }
+    if (cycles > pEntry->cyclesMax) {
+        pEntry->cyclesMax = cycles;
+    }
+}
+
+/* merges the tables: calls print for the entries of each function, in the order of the first
+   call, on all cores */
+static void plp_profile_merge(void (*print)(const plp_profile_entry *pEntry, uint32_t table)) {
+
+    uint32_t t, i, u, k;
+
+    for (t = 0; t < PLP_PROFILE_NUM_TABLES; t++) {
+        for (i = 0; i < plp_profile_numEntries[t]; i++) {
+            const plp_profile_record *pRecord = plp_profile_tables[t][i].pRecord;
+            uint32_t first = 1;
+
+            /* the function was printed with an earlier table */
+            for (u = 0; u < t && first; u++) {
+                for (k = 0; k < plp_profile_numEntries[u]; k++) {
+                    if (plp_profile_tables[u][k].pRecord == pRecord) {
+                        first = 0;
+                        break;
+                    }
+                }
+            }
+            if (!first) {
+                continue;
+            }
+
+            for (u = t; u < PLP_PROFILE_NUM_TABLES; u++) {
+                for (k = 0; k < plp_profile_numEntries[u]; k++) {
+                    if (plp_profile_tables[u][k].pRecord == pRecord &&
+                        plp_profile_tables[u][k].calls > 0) {
+                        print(&plp_profile_tables[u][k], u);
+                    }
+                }
+            }
+        }
+    }
+}
+
+static void plp_profile_dump_entry(const plp_profile_entry *pEntry, uint32_t table) {
+
+    uint32_t cycles = pEntry->cycles / pEntry->calls;
+    uint32_t instr = pEntry->instr / pEntry->calls;
+    uint32_t ipc = (cycles > 0) ? (uint32_t)((uint64_t)instr * 1000 / cycles) : 0;
+
+    printf("%s,%s,core=%d,%u,%u,%u.%03u,%u,%u,%u,0,0.0\n", pEntry->pRecord->name,
+           (table == 0) ? "ibex" : "riscy", (table == 0) ? 0 : (int)table - 1, cycles, instr,
+           ipc / 1000, ipc % 1000, (uint32_t)(pEntry->imiss / pEntry->calls),
+           (uint32_t)(pEntry->ldStall / pEntry->calls),
+           (uint32_t)(pEntry->tcdmCont / pEntry->calls));
+}
+
+static void plp_profile_print_entry(const plp_profile_entry *pEntry, uint32_t table) {
+
+    if (table == 0) {
+        printf("%-32s %4s ", pEntry->pRecord->name, "fc");
+    } else {
+        printf("%-32s %4d ", pEntry->pRecord->name, (int)table - 1);
+    }
+    printf("%8u %10u %10u %10u\n", pEntry->calls, pEntry->cyclesMin,
+           (uint32_t)(pEntry->cycles / pEntry->calls), pEntry->cyclesMax);
+}
+
+/**
+  @brief         Prints the profile of the glue functions as CSV, in the format of the benchmark
+                 files of test/mrWolf/bench.py. Each line holds the average of a function on a
+                 core. The device is ibex for the fabric controller and riscy for the cluster, the
+                 dimension is the core. The number of operations is not known and printed as 0.
+  @return        none
+*/
+
+void plp_profile_dump(void) {
+
+    printf("name,device,dimension,cycles,instructions,ipc,imiss,ld_stall,tcdm_cont,ops,mpc\n");
+    plp_profile_merge(plp_profile_dump_entry);
+}
+
+/**
+  @brief         Prints the number of calls and the minimum, average and maximum cycles of the glue
+                 functions on each core.
+  @return        none
+*/
+
+void plp_profile_print(void) {
+
+    uint32_t dropped = 0;
+    uint32_t t;
+
+    printf("%-32s %4s %8s %10s %10s %10s\n", "function", "core", "calls", "min", "avg", "max");
+    plp_profile_merge(plp_profile_print_entry);
+
+    for (t = 0; t < PLP_PROFILE_NUM_TABLES; t++) {
+        dropped += plp_profile_dropped[t];
+    }
+    if (dropped > 0) {
+        printf("%u calls not recorded, increase PLP_PROFILE_NUM_ENTRIES\n", dropped);
+    }
+}
+
+/**
+  @brief         Clears the statistics of all glue functions.
+  @return        none
+*/
+
+void plp_profile_reset(void) {
+
+    uint32_t t, i;
+
+    for (t = 0; t < PLP_PROFILE_NUM_TABLES; t++) {
+        for (i = 0; i < plp_profile_numEntries[t]; i++) {
+            plp_profile_clear(&plp_profile_tables[t][i]);
+        }
+        plp_profile_dropped[t] = 0;
+    }
+}
+
+#else // PLP_PROFILE
+
+void plp_profile_dump(void) {}
+
+void plp_profile_print(void) {}
+
+void plp_profile_reset(void) {}
+
+#endif // PLP_PROFILE
+
+/**
+  @} end of Profile group
+ */
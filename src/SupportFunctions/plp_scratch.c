@@ -0,0 +1,138 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_scratch.c
+ * Description:  Scratch arena for the temporary buffers of the glue code
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+static plp_scratch_instance *plp_scratch_current = NULL;
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @defgroup Scratch Scratch Arena
+  Some glue functions need temporary buffers, e.g. the partial results of the parallel
+  convolution. By default, they are allocated with rt_alloc and released with rt_free on every
+  call. If the application sets a scratch arena with plp_scratch_set, the temporaries are taken
+  from a caller-provided buffer instead, usually placed in L1. The arena is a stack: an allocation
+  bumps the top by the aligned size, a release resets the top to the start of the released block.
+  Both take constant time and the layout of the temporaries does not depend on the history of the
+  allocator, so the TCDM is not fragmented. If the arena is too small for a request, the request
+  falls back to rt_alloc. peak holds the largest number of bytes used at once, which can be used
+  to size the arena. The worst case of a single call is returned by the _scratch_size function of
+  the glue function, e.g. plp_conv_i16_parallel_scratch_size.
+  @par
+  The arena is not thread-safe. It must only be used by glue code which runs on one core at a
+  time, i.e. not by the fabric controller and the cluster concurrently.
+  @par
+  <pre>RT_L1_DATA uint8_t buffer[4096];
+plp_scratch_instance arena;
+
+plp_scratch_init(&arena, buffer, sizeof(buffer));
+plp_scratch_set(&arena);
+plp_conv_i16_parallel(pSrcA, srcALen, pSrcB, srcBLen, 8, pRes);
+plp_scratch_set(NULL);</pre>
+ */
+
+/**
+  @addtogroup Scratch
+  @{
+ */
+
+/**
+  @brief         Initializes a scratch arena on a caller-provided buffer.
+  @param[out]    S      points to the scratch arena
+  @param[in]     pBuf   points to the buffer, aligned to PLP_SCRATCH_ALIGNMENT bytes
+  @param[in]     size   size of the buffer in bytes
+  @return        none
+*/
+
+void plp_scratch_init(plp_scratch_instance *S, void *pBuf, uint32_t size) {
+    S->pBase = (uint8_t *)pBuf;
+    S->size = size;
+    S->used = 0;
+    S->peak = 0;
+}
+
+/**
+  @brief         Sets the scratch arena used by the glue functions for their temporaries.
+  @param[in]     S   points to an initialized scratch arena, NULL to use rt_alloc again
+  @return        none
+*/
+
+void plp_scratch_set(plp_scratch_instance *S) { plp_scratch_current = S; }
+
+/**
+  @brief         Allocates a temporary buffer from the scratch arena. If no arena is set or the
+                 arena is too small, the buffer is allocated with rt_alloc.
+  @param[in]     flags  memory kind of rt_alloc, used by the fallback
+  @param[in]     size   size of the buffer in bytes
+  @return        pointer to the buffer, NULL if the fallback fails
+*/
+
+void *plp_scratch_alloc(int flags, uint32_t size) {
+
+    plp_scratch_instance *S = plp_scratch_current;
+    uint32_t alignedSize = PLP_SCRATCH_ALIGN(size);
+
+    if (S != NULL && alignedSize <= S->size - S->used) {
+        void *p = S->pBase + S->used;
+        S->used += alignedSize;
+        if (S->used > S->peak) {
+            S->peak = S->used;
+        }
+        return p;
+    }
+
+    return rt_alloc(flags, size);
+}
+
+/**
+  @brief         Releases a buffer of plp_scratch_alloc. The buffers of the arena must be released
+                 in the reverse order of their allocation.
+  @param[in]     flags  memory kind of rt_alloc, used if the buffer was allocated by the fallback
+  @param[in]     p      points to the buffer
+  @param[in]     size   size of the buffer in bytes, as passed to plp_scratch_alloc
+  @return        none
+*/
+
+void plp_scratch_free(int flags, void *p, uint32_t size) {
+
+    plp_scratch_instance *S = plp_scratch_current;
+
+    if (S != NULL && (uint8_t *)p >= S->pBase && (uint8_t *)p < S->pBase + S->size) {
+        S->used = (uint8_t *)p - S->pBase;
+        return;
+    }
+
+    rt_free(flags, p, size);
+}
+
+/**
+  @} end of Scratch group
+ */
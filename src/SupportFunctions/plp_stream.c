@@ -0,0 +1,169 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_stream.c
+ * Description:  Glue code for streaming L2 signals through double-buffered L1 tiles
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @defgroup Stream Tiled Streaming
+  The kernels of the library expect their operands in L1. plp_stream processes a signal which is
+  too large for L1, e.g. a recording in L2, in tiles of tileLen elements. Core 0 of the team
+  drives the cluster DMA in a three stage pipeline: while the cores compute tile t, the DMA
+  transfers tile t + 1 into L1 and the result of tile t - 1 back to L2. Each tile is split among
+  the cores, and the team is forked once for the whole signal.
+  @par
+  The operation is described by a plp_stream_op. There are three kinds of operations:
+  - PLP_STREAM_MAP: element-wise, e.g. plp_stream_add_i16
+  - PLP_STREAM_REDUCE: reduction to a single value, e.g. plp_stream_dot_prod_i16. Each core
+    reduces its part of the tile, the partial results are combined at the end.
+  - PLP_STREAM_WINDOW: each output depends on halo + 1 consecutive inputs, e.g.
+    plp_stream_conv_valid_i16. Consecutive input tiles overlap by halo elements.
+  @par
+  The ping-pong buffers are taken from the scratch arena, see plp_scratch_set. Their size is
+  returned by plp_stream_scratch_size.
+  @par
+  <pre>plp_stream_conv_args conv = { pCoeffs, 32 };
+plp_stream_instance S = { &plp_stream_conv_valid_i16, &conv, pSignalL2, NULL, 131072, 31, 512,
+                          pFilteredL2 };
+plp_stream(&S, 8);</pre>
+ */
+
+/**
+  @addtogroup Stream
+  @{
+ */
+
+/**
+  @brief         Glue code for streaming a signal in L2 through double-buffered L1 tiles.
+  @param[in]     S    points to the streaming instance
+  @param[in]     nPE  number of parallel processing units
+  @return        none
+*/
+
+void plp_stream(const plp_stream_instance *S, uint32_t nPE) {
+
+    PLP_PROFILE_FUNC();
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Parallel processing supported only for cluster side\n");
+        return;
+    } else {
+
+        const plp_stream_op *pOp = S->pOp;
+        uint32_t halo = (pOp->kind == PLP_STREAM_WINDOW) ? S->halo : 0;
+
+        if (S->tileLen == 0 || S->srcLen <= halo) {
+            return;
+        }
+
+        uint32_t inSize = PLP_SCRATCH_ALIGN((S->tileLen + halo) * pOp->srcSize);
+        uint32_t outSize = PLP_SCRATCH_ALIGN(S->tileLen * pOp->dstSize);
+        uint32_t size = plp_stream_scratch_size(S, nPE);
+
+        uint8_t *pBuf = (uint8_t *)plp_scratch_alloc(RT_ALLOC_CL_DATA, size);
+        if (pBuf == NULL) {
+            printf("Error: insufficient L1 memory!\n");
+            return;
+        }
+
+        plp_stream_arg arg;
+        uint8_t *p = pBuf;
+
+        arg.S = S;
+        arg.nPE = nPE;
+        arg.pInA[0] = p;
+        arg.pInA[1] = p + inSize;
+        p += 2 * inSize;
+
+        if (S->pSrcB != NULL) {
+            arg.pInB[0] = p;
+            arg.pInB[1] = p + inSize;
+            p += 2 * inSize;
+        } else {
+            arg.pInB[0] = NULL;
+            arg.pInB[1] = NULL;
+        }
+
+        if (pOp->kind == PLP_STREAM_REDUCE) {
+            arg.pOut[0] = NULL;
+            arg.pOut[1] = NULL;
+            arg.pPartial = p;
+        } else {
+            arg.pOut[0] = p;
+            arg.pOut[1] = p + outSize;
+            arg.pPartial = NULL;
+        }
+
+        rt_team_fork(nPE, plp_stream_xpulpv2, (void *)&arg);
+
+        plp_scratch_free(RT_ALLOC_CL_DATA, pBuf, size);
+    }
+}
+
+/**
+  @brief         Scratch memory of plp_stream: two input buffers per input signal, and two output
+                 buffers or the partial results of the cores.
+  @param[in]     S    points to the streaming instance
+  @param[in]     nPE  number of parallel processing units
+  @return        number of bytes which plp_stream takes from the scratch arena
+*/
+
+uint32_t plp_stream_scratch_size(const plp_stream_instance *S, uint32_t nPE) {
+
+    const plp_stream_op *pOp = S->pOp;
+    uint32_t halo = (pOp->kind == PLP_STREAM_WINDOW) ? S->halo : 0;
+    uint32_t inSize = PLP_SCRATCH_ALIGN((S->tileLen + halo) * pOp->srcSize);
+    uint32_t size = (S->pSrcB != NULL) ? 4 * inSize : 2 * inSize;
+
+    if (pOp->kind == PLP_STREAM_REDUCE) {
+        size += PLP_STREAM_PARTIAL_SIZE * nPE;
+    } else {
+        size += 2 * PLP_SCRATCH_ALIGN(S->tileLen * pOp->dstSize);
+    }
+
+    return size;
+}
+
+/**
+  @brief         Combine function of the PLP_STREAM_REDUCE operations whose result is a 32-bit sum.
+  @param[in,out] pRes      points to the int32_t result
+  @param[in]     pPartial  points to the int32_t partial result of a tile
+  @return        none
+*/
+
+void plp_stream_sum_i32(void *pRes, const void *pPartial) {
+    *(int32_t *)pRes += *(const int32_t *)pPartial;
+}
+
+/**
+  @} end of Stream group
+ */
@@ -0,0 +1,80 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_team_run.c
+ * Description:  Glue code for executing a chain of parallel kernels on a persistent team
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @defgroup Team Persistent Team
+  Every _parallel glue function forks its own team. For a chain of small kernels the fork and join
+  overhead is comparable to the computation. plp_team_run forks the team once and calls the
+  per-core entry points of the chain one after the other, separated by rt_team_barrier. Every
+  parallel kernel with the signature void (void *args), i.e. every p_xpulpv2 kernel which is
+  forked by its glue code, can be a step. The argument structure is the one which the glue code
+  would fork, with the same nPE as the team. Work which the glue code does on the calling core
+  after the fork, like the reduction of plp_dot_prod_f32_parallel, is a masterOnly step.
+  @par
+  <pre>plp_team_step steps[] = { { plp_mat_scale_f32p_xpulpv2, &scaleArgs, 0 },
+                           { plp_mat_add_f32p_xpulpv2, &addArgs, 0 } };
+plp_team_run(steps, 2, 8);</pre>
+ */
+
+/**
+  @addtogroup Team
+  @{
+ */
+
+/**
+  @brief         Glue code for executing a chain of parallel kernels on a persistent team. The
+                 team is forked once, the steps are separated by rt_team_barrier.
+  @param[in]     pSteps    points to the chain of steps
+  @param[in]     numSteps  number of steps
+  @param[in]     nPE       number of parallel processing units
+  @return        none
+*/
+
+void plp_team_run(const plp_team_step *pSteps, uint32_t numSteps, uint32_t nPE) {
+
+    PLP_PROFILE_FUNC();
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_team_instance arg = (plp_team_instance){ pSteps, numSteps, nPE };
+        rt_team_fork(nPE, plp_team_run_xpulpv2, (void *)&arg);
+    }
+}
+
+/**
+  @} end of Team group
+ */
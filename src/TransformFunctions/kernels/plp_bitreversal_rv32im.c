@@ -30,6 +30,9 @@
 
 #include "plp_math.h"
 
+/* HELPER FUNCTIONS */
+static inline uint32_t plp_bitrev_rv32im(uint32_t x, uint32_t shift);
+
 /**
  * @ingroup groupTransforms
  */
@@ -70,6 +73,103 @@ void plp_bitreversal_16s_rv32im(uint16_t *pSrc,
     }
 }
 
+/**
+  @brief         In-place 32 bit reversal function.
+  @param[in,out] pSrc        points to in-place buffer of unknown 32-bit data type
+  @param[in]     bitRevLen   bit reversal table length
+  @param[in]     pBitRevTab  points to bit reversal table
+  @return        none
+*/
+
+void plp_bitreversal_32s_rv32im(uint32_t *pSrc,
+                                const uint16_t bitRevLen,
+                                const uint16_t *pBitRevTab) {
+    uint32_t a, b, i, tmp;
+
+    for (i = 0; i < bitRevLen;) {
+        // the table holds the offsets of 16 bit complex values, i.e. the index of the 32 bit real
+        // part
+        a = pBitRevTab[i] >> 2;
+        b = pBitRevTab[i + 1] >> 2;
+
+        // real
+        tmp = pSrc[a];
+        pSrc[a] = pSrc[b];
+        pSrc[b] = tmp;
+
+        // complex
+        tmp = pSrc[a + 1];
+        pSrc[a + 1] = pSrc[b + 1];
+        pSrc[b + 1] = tmp;
+
+        i += 2;
+    }
+}
+
+/**
+  @brief         In-place 16 bit reversal function without table. The complex value i is swapped
+                 with the complex value bitrev(i).
+  @param[in,out] pSrc        points to in-place buffer of fftLen complex 16-bit values
+  @param[in]     fftLen      length of the FFT, a power of 2
+  @return        none
+*/
+
+void plp_bitreversal_nolut_16s_rv32im(uint16_t *pSrc, uint32_t fftLen) {
+    uint32_t i, j, tmp;
+    uint32_t *pData = (uint32_t *)pSrc; // one complex value is swapped as a 32 bit word
+    uint32_t shift = __builtin_clz(fftLen) + 1;
+
+    for (i = 1; i < fftLen - 1; i++) {
+        j = plp_bitrev_rv32im(i, shift);
+        if (i < j) {
+            tmp = pData[i];
+            pData[i] = pData[j];
+            pData[j] = tmp;
+        }
+    }
+}
+
+/**
+  @brief         In-place 32 bit reversal function without table. The complex value i is swapped
+                 with the complex value bitrev(i).
+  @param[in,out] pSrc        points to in-place buffer of fftLen complex 32-bit values
+  @param[in]     fftLen      length of the FFT, a power of 2
+  @return        none
+*/
+
+void plp_bitreversal_nolut_32s_rv32im(uint32_t *pSrc, uint32_t fftLen) {
+    uint32_t i, j, tmp;
+    uint32_t shift = __builtin_clz(fftLen) + 1;
+
+    for (i = 1; i < fftLen - 1; i++) {
+        j = plp_bitrev_rv32im(i, shift);
+        if (i < j) {
+            // real
+            tmp = pSrc[2 * i];
+            pSrc[2 * i] = pSrc[2 * j];
+            pSrc[2 * j] = tmp;
+
+            // complex
+            tmp = pSrc[2 * i + 1];
+            pSrc[2 * i + 1] = pSrc[2 * j + 1];
+            pSrc[2 * j + 1] = tmp;
+        }
+    }
+}
+
 /**
  * @} end of FFT group
  */
+
+/* Reverses the 32 bits of x with five mask and shift steps, the result is shifted right by shift,
+ * i.e. the 32 - shift low bits of x are reversed. */
+static inline uint32_t plp_bitrev_rv32im(uint32_t x, uint32_t shift) {
+
+    x = ((x >> 1) & 0x55555555) | ((x & 0x55555555) << 1);
+    x = ((x >> 2) & 0x33333333) | ((x & 0x33333333) << 2);
+    x = ((x >> 4) & 0x0F0F0F0F) | ((x & 0x0F0F0F0F) << 4);
+    x = ((x >> 8) & 0x00FF00FF) | ((x & 0x00FF00FF) << 8);
+    x = (x >> 16) | (x << 16);
+
+    return x >> shift;
+}
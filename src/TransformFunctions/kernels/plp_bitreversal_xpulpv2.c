@@ -82,6 +82,226 @@ void plp_bitreversal_16v_xpulpv2(uint16_t *pSrc,
     }
 }
 
+/**
+  @brief         In-place 16 bit reversal function (parallel version). The swaps of the table are
+                 distributed over the cores, the function must be called by all cores of the team.
+  @param[in]     args  points to the plp_bitreversal_parallel_arg
+  @return        none
+*/
+
+void plp_bitreversal_16p_xpulpv2(void *args) {
+
+    plp_bitreversal_parallel_arg *arg = (plp_bitreversal_parallel_arg *)args;
+    uint16_t *pSrc = (uint16_t *)arg->pSrc;
+    const uint16_t bitRevLen = arg->bitRevLen;
+    const uint16_t *pBitRevTab = arg->pBitRevTab;
+    uint32_t nPE = arg->nPE;
+    uint16_t tmp;
+    uint32_t i;
+
+    v2s c;
+
+    for (i = 2 * rt_core_id(); i < bitRevLen; i += 2 * nPE) {
+        c = __SRA2(*(v2s *)&pBitRevTab[i], ((v2s){ 2, 2 }));
+
+        // real
+        tmp = pSrc[c[0]];
+        pSrc[c[0]] = pSrc[c[1]];
+        pSrc[c[1]] = tmp;
+
+        // complex
+        tmp = pSrc[c[0] + 1];
+        pSrc[c[0] + 1] = pSrc[c[1] + 1];
+        pSrc[c[1] + 1] = tmp;
+    }
+
+    rt_team_barrier();
+}
+
+/**
+  @brief         In-place 32 bit reversal function.
+  @param[in,out] pSrc        points to in-place buffer of unknown 32-bit data type
+  @param[in]     bitRevLen   bit reversal table length
+  @param[in]     pBitRevTab  points to bit reversal table
+  @return        none
+*/
+
+void plp_bitreversal_32s_xpulpv2(uint32_t *pSrc,
+                                 const uint16_t bitRevLen,
+                                 const uint16_t *pBitRevTab) {
+    uint32_t i, tmp;
+
+    v2s c;
+
+    for (i = 0; i < bitRevLen;) {
+        // the table holds the offsets of 16 bit complex values, i.e. the index of the 32 bit real
+        // part
+        c = __SRA2(*(v2s *)&pBitRevTab[i], ((v2s){ 2, 2 }));
+
+        // real
+        tmp = pSrc[c[0]];
+        pSrc[c[0]] = pSrc[c[1]];
+        pSrc[c[1]] = tmp;
+
+        // complex
+        tmp = pSrc[c[0] + 1];
+        pSrc[c[0] + 1] = pSrc[c[1] + 1];
+        pSrc[c[1] + 1] = tmp;
+
+        i += 2;
+    }
+}
+
+/**
+  @brief         In-place 32 bit reversal function (parallel version). The swaps of the table are
+                 distributed over the cores, the function must be called by all cores of the team.
+  @param[in]     args  points to the plp_bitreversal_parallel_arg
+  @return        none
+*/
+
+void plp_bitreversal_32p_xpulpv2(void *args) {
+
+    plp_bitreversal_parallel_arg *arg = (plp_bitreversal_parallel_arg *)args;
+    uint32_t *pSrc = (uint32_t *)arg->pSrc;
+    const uint16_t bitRevLen = arg->bitRevLen;
+    const uint16_t *pBitRevTab = arg->pBitRevTab;
+    uint32_t nPE = arg->nPE;
+    uint32_t i, tmp;
+
+    v2s c;
+
+    for (i = 2 * rt_core_id(); i < bitRevLen; i += 2 * nPE) {
+        c = __SRA2(*(v2s *)&pBitRevTab[i], ((v2s){ 2, 2 }));
+
+        // real
+        tmp = pSrc[c[0]];
+        pSrc[c[0]] = pSrc[c[1]];
+        pSrc[c[1]] = tmp;
+
+        // complex
+        tmp = pSrc[c[0] + 1];
+        pSrc[c[0] + 1] = pSrc[c[1] + 1];
+        pSrc[c[1] + 1] = tmp;
+    }
+
+    rt_team_barrier();
+}
+
+/**
+  @brief         In-place 16 bit reversal function without table. The complex value i is swapped
+                 with the complex value bitrev(i), the index is reversed with p.bitrev.
+  @param[in,out] pSrc        points to in-place buffer of fftLen complex 16-bit values
+  @param[in]     fftLen      length of the FFT, a power of 2
+  @return        none
+*/
+
+void plp_bitreversal_nolut_16v_xpulpv2(uint16_t *pSrc, uint32_t fftLen) {
+    uint32_t i, j, tmp;
+    uint32_t *pData = (uint32_t *)pSrc; // one complex value is swapped as a 32 bit word
+    uint32_t shift = 32 - __FL1(fftLen);
+
+    for (i = 1; i < fftLen - 1; i++) {
+        j = __BITREV(i, shift, 0);
+        if (i < j) {
+            tmp = pData[i];
+            pData[i] = pData[j];
+            pData[j] = tmp;
+        }
+    }
+}
+
+/**
+  @brief         In-place 16 bit reversal function without table (parallel version). The indices
+                 are distributed over the cores, the function must be called by all cores of the
+                 team.
+  @param[in]     args  points to the plp_bitreversal_nolut_parallel_arg
+  @return        none
+*/
+
+void plp_bitreversal_nolut_16p_xpulpv2(void *args) {
+
+    plp_bitreversal_nolut_parallel_arg *arg = (plp_bitreversal_nolut_parallel_arg *)args;
+    uint32_t fftLen = arg->fftLen;
+    uint32_t nPE = arg->nPE;
+    uint32_t i, j, tmp;
+    uint32_t *pData = (uint32_t *)arg->pSrc; // one complex value is swapped as a 32 bit word
+    uint32_t shift = 32 - __FL1(fftLen);
+
+    for (i = rt_core_id() + 1; i < fftLen - 1; i += nPE) {
+        j = __BITREV(i, shift, 0);
+        if (i < j) {
+            tmp = pData[i];
+            pData[i] = pData[j];
+            pData[j] = tmp;
+        }
+    }
+
+    rt_team_barrier();
+}
+
+/**
+  @brief         In-place 32 bit reversal function without table. The complex value i is swapped
+                 with the complex value bitrev(i), the index is reversed with p.bitrev.
+  @param[in,out] pSrc        points to in-place buffer of fftLen complex 32-bit values
+  @param[in]     fftLen      length of the FFT, a power of 2
+  @return        none
+*/
+
+void plp_bitreversal_nolut_32s_xpulpv2(uint32_t *pSrc, uint32_t fftLen) {
+    uint32_t i, j, tmp;
+    uint32_t shift = 32 - __FL1(fftLen);
+
+    for (i = 1; i < fftLen - 1; i++) {
+        j = __BITREV(i, shift, 0);
+        if (i < j) {
+            // real
+            tmp = pSrc[2 * i];
+            pSrc[2 * i] = pSrc[2 * j];
+            pSrc[2 * j] = tmp;
+
+            // complex
+            tmp = pSrc[2 * i + 1];
+            pSrc[2 * i + 1] = pSrc[2 * j + 1];
+            pSrc[2 * j + 1] = tmp;
+        }
+    }
+}
+
+/**
+  @brief         In-place 32 bit reversal function without table (parallel version). The indices
+                 are distributed over the cores, the function must be called by all cores of the
+                 team.
+  @param[in]     args  points to the plp_bitreversal_nolut_parallel_arg
+  @return        none
+*/
+
+void plp_bitreversal_nolut_32p_xpulpv2(void *args) {
+
+    plp_bitreversal_nolut_parallel_arg *arg = (plp_bitreversal_nolut_parallel_arg *)args;
+    uint32_t *pSrc = (uint32_t *)arg->pSrc;
+    uint32_t fftLen = arg->fftLen;
+    uint32_t nPE = arg->nPE;
+    uint32_t i, j, tmp;
+    uint32_t shift = 32 - __FL1(fftLen);
+
+    for (i = rt_core_id() + 1; i < fftLen - 1; i += nPE) {
+        j = __BITREV(i, shift, 0);
+        if (i < j) {
+            // real
+            tmp = pSrc[2 * i];
+            pSrc[2 * i] = pSrc[2 * j];
+            pSrc[2 * j] = tmp;
+
+            // complex
+            tmp = pSrc[2 * i + 1];
+            pSrc[2 * i + 1] = pSrc[2 * j + 1];
+            pSrc[2 * j + 1] = tmp;
+        }
+    }
+
+    rt_team_barrier();
+}
+
 /**
  * @} end of FFT group
  */
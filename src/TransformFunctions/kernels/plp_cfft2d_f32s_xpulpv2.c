@@ -0,0 +1,106 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft2d_f32s_xpulpv2.c
+ * Description:  Floating-point 2D complex FFT for XPULPV2
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+#define CFFT2D_TILE 8 // side of the square tiles of the transposes, in complex values
+
+/* HELPER FUNCTIONS */
+static void plp_cfft2d_transpose_f32(const Complex_type_f32 *pSrc,
+                                     uint32_t numRows,
+                                     uint32_t numCols,
+                                     Complex_type_f32 *pDst,
+                                     uint32_t first,
+                                     uint32_t step);
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup fftBatch
+  @{
+ */
+
+/**
+   @brief  Floating-point 2D complex FFT for XPULPV2 extension, computed with the mixed-radix FFT.
+   @param[in]   SRows   points to the mixed-radix CFFT instance of the rows, of length numCols
+   @param[in]   SCols   points to the mixed-radix CFFT instance of the columns, of length numRows
+   @param[in]   pSrc    points to the numRows x numCols complex input matrix
+   @param[in]   pBuf    points to a temporary buffer of 2*numRows*numCols values
+   @param[out]  pDst    points to the numRows x numCols complex output matrix
+   @return      none
+*/
+void plp_cfft2d_f32s_xpulpv2(const plp_cfft_mixed_instance_f32 *SRows,
+                             const plp_cfft_mixed_instance_f32 *SCols,
+                             const float32_t *__restrict__ pSrc,
+                             float32_t *__restrict__ pBuf,
+                             float32_t *__restrict__ pDst) {
+
+    uint32_t numRows = SCols->fftLen;
+    uint32_t numCols = SRows->fftLen;
+
+    // ROWS
+    plp_cfft_batch_f32s_xpulpv2(SRows, pSrc, numRows, numCols, 1, NULL, pBuf);
+
+    // COLUMNS, transformed as the rows of the transposed matrix
+    plp_cfft2d_transpose_f32((Complex_type_f32 *)pBuf, numRows, numCols, (Complex_type_f32 *)pDst,
+                             0, 1);
+    plp_cfft_batch_f32s_xpulpv2(SCols, pDst, numCols, numRows, 1, NULL, pBuf);
+    plp_cfft2d_transpose_f32((Complex_type_f32 *)pBuf, numCols, numRows, (Complex_type_f32 *)pDst,
+                             0, 1);
+}
+
+/**
+   @} end of fftBatch group
+*/
+
+/* Transposes the numRows x numCols complex matrix pSrc to pDst, tile by tile. Only the tile rows
+ * first, first + step, first + 2*step, ... are transposed. */
+static void plp_cfft2d_transpose_f32(const Complex_type_f32 *pSrc,
+                                     uint32_t numRows,
+                                     uint32_t numCols,
+                                     Complex_type_f32 *pDst,
+                                     uint32_t first,
+                                     uint32_t step) {
+
+    uint32_t i, j, i0, j0, iEnd, jEnd;
+
+    for (i0 = first * CFFT2D_TILE; i0 < numRows; i0 += step * CFFT2D_TILE) {
+        iEnd = (i0 + CFFT2D_TILE < numRows) ? i0 + CFFT2D_TILE : numRows;
+        for (j0 = 0; j0 < numCols; j0 += CFFT2D_TILE) {
+            jEnd = (j0 + CFFT2D_TILE < numCols) ? j0 + CFFT2D_TILE : numCols;
+            for (i = i0; i < iEnd; i++) {
+                for (j = j0; j < jEnd; j++) {
+                    pDst[j * numRows + i] = pSrc[i * numCols + j];
+                }
+            }
+        }
+    }
+}
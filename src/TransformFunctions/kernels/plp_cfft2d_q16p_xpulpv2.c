@@ -0,0 +1,114 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft2d_q16p_xpulpv2.c
+ * Description:  Parallel 16-bit fixed point 2D complex FFT for XPULPV2
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+#define CFFT2D_TILE 8 // side of the square tiles of the transposes, in complex values
+
+/* HELPER FUNCTIONS */
+static void plp_cfft2d_transpose_q16(const v2s *pSrc,
+                                     uint32_t numRows,
+                                     uint32_t numCols,
+                                     v2s *pDst,
+                                     uint32_t first,
+                                     uint32_t step);
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup fftBatch
+  @{
+ */
+
+/**
+   @brief  Parallel 16 bit fixed-point 2D complex FFT for XPULPV2 extension. The rows, the tiles
+   of the transposes and the columns are distributed over the cores, with one barrier after each
+   of the four passes.
+   @param[in]   args    points to the plp_cfft2d_parallel_arg_q16 structure
+   @return      none
+*/
+void plp_cfft2d_q16p_xpulpv2(void *args) {
+
+    plp_cfft2d_parallel_arg_q16 *arg = (plp_cfft2d_parallel_arg_q16 *)args;
+    const plp_cfft_instance_q16 *SRows = arg->SRows;
+    const plp_cfft_instance_q16 *SCols = arg->SCols;
+    int16_t *pSrc = arg->pSrc;
+    uint32_t deciPoint = arg->deciPoint;
+    uint32_t nPE = arg->nPE;
+    int16_t *pBuf = arg->pBuf;
+
+    uint32_t core_id = rt_core_id();
+    uint32_t numRows = SCols->fftLen;
+    uint32_t numCols = SRows->fftLen;
+
+    plp_cfft_batch_parallel_arg_q16 rows = { SRows, pSrc, numRows, numCols, 1, 0, 1,
+                                             deciPoint, nPE, NULL };
+    plp_cfft_batch_parallel_arg_q16 cols = { SCols, pBuf, numCols, numRows, 1, 0, 1,
+                                             deciPoint, nPE, NULL };
+
+    // ROWS
+    plp_cfft_batch_q16p_xpulpv2((void *)&rows);
+
+    // COLUMNS, transformed as the rows of the transposed matrix
+    plp_cfft2d_transpose_q16((v2s *)pSrc, numRows, numCols, (v2s *)pBuf, core_id, nPE);
+    rt_team_barrier();
+    plp_cfft_batch_q16p_xpulpv2((void *)&cols);
+    plp_cfft2d_transpose_q16((v2s *)pBuf, numCols, numRows, (v2s *)pSrc, core_id, nPE);
+    rt_team_barrier();
+}
+
+/**
+   @} end of fftBatch group
+*/
+
+/* Transposes the numRows x numCols complex matrix pSrc to pDst, tile by tile. Only the tile rows
+ * first, first + step, first + 2*step, ... are transposed. */
+static void plp_cfft2d_transpose_q16(const v2s *pSrc,
+                                     uint32_t numRows,
+                                     uint32_t numCols,
+                                     v2s *pDst,
+                                     uint32_t first,
+                                     uint32_t step) {
+
+    uint32_t i, j, i0, j0, iEnd, jEnd;
+
+    for (i0 = first * CFFT2D_TILE; i0 < numRows; i0 += step * CFFT2D_TILE) {
+        iEnd = (i0 + CFFT2D_TILE < numRows) ? i0 + CFFT2D_TILE : numRows;
+        for (j0 = 0; j0 < numCols; j0 += CFFT2D_TILE) {
+            jEnd = (j0 + CFFT2D_TILE < numCols) ? j0 + CFFT2D_TILE : numCols;
+            for (i = i0; i < iEnd; i++) {
+                for (j = j0; j < jEnd; j++) {
+                    pDst[j * numRows + i] = pSrc[i * numCols + j];
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,105 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft2d_q16s_rv32im.c
+ * Description:  16-bit fixed point 2D complex FFT for RV32IM
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+#define CFFT2D_TILE 8 // side of the square tiles of the transposes, in complex values
+
+/* HELPER FUNCTIONS */
+static void plp_cfft2d_transpose_q16(const int32_t *pSrc,
+                                     uint32_t numRows,
+                                     uint32_t numCols,
+                                     int32_t *pDst,
+                                     uint32_t first,
+                                     uint32_t step);
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup fftBatch
+  @{
+ */
+
+/**
+   @brief  16 bit fixed-point 2D complex FFT for RV32IM. The output is in natural
+   order and scaled by 1/(numRows*numCols).
+   @param[in]       SRows       points to the CFFT instance of the rows, of length numCols
+   @param[in]       SCols       points to the CFFT instance of the columns, of length numRows
+   @param[in,out]   pSrc        points to the numRows x numCols complex matrix
+   @param[in]       deciPoint   decimal point for right shift
+   @param[in]       pBuf        points to a temporary buffer of 2*numRows*numCols values
+   @return          none
+*/
+void plp_cfft2d_q16s_rv32im(const plp_cfft_instance_q16 *SRows,
+                            const plp_cfft_instance_q16 *SCols,
+                            int16_t *__restrict__ pSrc,
+                            uint32_t deciPoint,
+                            int16_t *__restrict__ pBuf) {
+
+    uint32_t numRows = SCols->fftLen;
+    uint32_t numCols = SRows->fftLen;
+
+    // ROWS
+    plp_cfft_batch_q16s_rv32im(SRows, pSrc, numRows, numCols, 1, 0, 1, deciPoint, NULL);
+
+    // COLUMNS, transformed as the rows of the transposed matrix
+    plp_cfft2d_transpose_q16((int32_t *)pSrc, numRows, numCols, (int32_t *)pBuf, 0, 1);
+    plp_cfft_batch_q16s_rv32im(SCols, pBuf, numCols, numRows, 1, 0, 1, deciPoint, NULL);
+    plp_cfft2d_transpose_q16((int32_t *)pBuf, numCols, numRows, (int32_t *)pSrc, 0, 1);
+}
+
+/**
+   @} end of fftBatch group
+*/
+
+/* Transposes the numRows x numCols complex matrix pSrc to pDst, tile by tile. Only the tile rows
+ * first, first + step, first + 2*step, ... are transposed. */
+static void plp_cfft2d_transpose_q16(const int32_t *pSrc,
+                                     uint32_t numRows,
+                                     uint32_t numCols,
+                                     int32_t *pDst,
+                                     uint32_t first,
+                                     uint32_t step) {
+
+    uint32_t i, j, i0, j0, iEnd, jEnd;
+
+    for (i0 = first * CFFT2D_TILE; i0 < numRows; i0 += step * CFFT2D_TILE) {
+        iEnd = (i0 + CFFT2D_TILE < numRows) ? i0 + CFFT2D_TILE : numRows;
+        for (j0 = 0; j0 < numCols; j0 += CFFT2D_TILE) {
+            jEnd = (j0 + CFFT2D_TILE < numCols) ? j0 + CFFT2D_TILE : numCols;
+            for (i = i0; i < iEnd; i++) {
+                for (j = j0; j < jEnd; j++) {
+                    pDst[j * numRows + i] = pSrc[i * numCols + j];
+                }
+            }
+        }
+    }
+}
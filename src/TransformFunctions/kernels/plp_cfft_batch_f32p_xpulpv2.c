@@ -0,0 +1,111 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_batch_f32p_xpulpv2.c
+ * Description:  Parallel floating-point batched complex FFT for XPULPV2
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/* HELPER FUNCTIONS */
+static void plp_cfft_batch_transform_f32(const plp_cfft_mixed_instance_f32 *S,
+                                         const Complex_type_f32 *pIn,
+                                         Complex_type_f32 *pOut,
+                                         uint32_t sampleStride,
+                                         Complex_type_f32 *pBuf);
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup fftBatch
+  @{
+ */
+
+/**
+   @brief  Parallel floating-point batched complex FFT for XPULPV2 extension. Whole transforms are
+   assigned to the cores, the cores synchronize only at the end.
+   @param[in]   args    points to the plp_cfft_batch_parallel_arg_f32 structure
+   @return      none
+*/
+void plp_cfft_batch_f32p_xpulpv2(void *args) {
+
+    plp_cfft_batch_parallel_arg_f32 *arg = (plp_cfft_batch_parallel_arg_f32 *)args;
+    const plp_cfft_mixed_instance_f32 *S = arg->S;
+    const float32_t *pSrc = arg->pSrc;
+    uint32_t numTransforms = arg->numTransforms;
+    uint32_t transformStride = arg->transformStride;
+    uint32_t sampleStride = arg->sampleStride;
+    uint32_t nPE = arg->nPE;
+    float32_t *pBuf = arg->pBuf;
+    float32_t *pDst = arg->pDst;
+
+    uint32_t t;
+    uint32_t core_id = rt_core_id();
+    Complex_type_f32 *pCoreBuf = (Complex_type_f32 *)pBuf + 2 * core_id * S->fftLen;
+
+    for (t = core_id; t < numTransforms; t += nPE) {
+        plp_cfft_batch_transform_f32(S, (const Complex_type_f32 *)pSrc + t * transformStride,
+                                     (Complex_type_f32 *)pDst + t * transformStride, sampleStride,
+                                     pCoreBuf);
+    }
+
+    rt_team_barrier();
+}
+
+/**
+   @} end of fftBatch group
+*/
+
+/* FFT of the fftLen complex values pIn[0], pIn[sampleStride], ... to pOut[0], pOut[sampleStride],
+ * ... The mixed-radix FFT is out-of-place, strided and in-place transforms use both halves of
+ * pBuf. */
+static void plp_cfft_batch_transform_f32(const plp_cfft_mixed_instance_f32 *S,
+                                         const Complex_type_f32 *pIn,
+                                         Complex_type_f32 *pOut,
+                                         uint32_t sampleStride,
+                                         Complex_type_f32 *pBuf) {
+
+    uint32_t k;
+    uint32_t N = S->fftLen;
+
+    if (sampleStride == 1 && pIn != pOut) {
+        plp_cfft_mixed_f32s_xpulpv2(S, (const float32_t *)pIn, (float32_t *)pOut);
+        return;
+    }
+
+    // GATHER
+    for (k = 0; k < N; k++) {
+        pBuf[k] = pIn[k * sampleStride];
+    }
+
+    plp_cfft_mixed_f32s_xpulpv2(S, (const float32_t *)pBuf, (float32_t *)(pBuf + N));
+
+    // SCATTER
+    for (k = 0; k < N; k++) {
+        pOut[k * sampleStride] = pBuf[N + k];
+    }
+}
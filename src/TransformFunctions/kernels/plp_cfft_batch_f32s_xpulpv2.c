@@ -0,0 +1,111 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_batch_f32s_xpulpv2.c
+ * Description:  Floating-point batched complex FFT for XPULPV2
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/* HELPER FUNCTIONS */
+static void plp_cfft_batch_transform_f32(const plp_cfft_mixed_instance_f32 *S,
+                                         const Complex_type_f32 *pIn,
+                                         Complex_type_f32 *pOut,
+                                         uint32_t sampleStride,
+                                         Complex_type_f32 *pBuf);
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup fftBatch
+  @{
+ */
+
+/**
+   @brief  Floating-point batched complex FFT for XPULPV2 extension, computed with the
+   mixed-radix FFT.
+   @param[in]   S                points to an instance of the floating-point mixed-radix CFFT
+                                 structure
+   @param[in]   pSrc             points to the complex input data of all transforms
+   @param[in]   numTransforms    number of transforms
+   @param[in]   transformStride  distance in complex values between two transforms
+   @param[in]   sampleStride     distance in complex values between two samples of a transform
+   @param[in]   pBuf             points to a temporary buffer of 4*fftLen values
+   @param[out]  pDst             points to the complex output data, with the strides of pSrc.
+                                 May be pSrc for an in-place transform.
+   @return      none
+*/
+void plp_cfft_batch_f32s_xpulpv2(const plp_cfft_mixed_instance_f32 *S,
+                                 const float32_t *pSrc,
+                                 uint32_t numTransforms,
+                                 uint32_t transformStride,
+                                 uint32_t sampleStride,
+                                 float32_t *__restrict__ pBuf,
+                                 float32_t *pDst) {
+
+    uint32_t t;
+
+    for (t = 0; t < numTransforms; t++) {
+        plp_cfft_batch_transform_f32(S, (const Complex_type_f32 *)pSrc + t * transformStride,
+                                     (Complex_type_f32 *)pDst + t * transformStride, sampleStride,
+                                     (Complex_type_f32 *)pBuf);
+    }
+}
+
+/**
+   @} end of fftBatch group
+*/
+
+/* FFT of the fftLen complex values pIn[0], pIn[sampleStride], ... to pOut[0], pOut[sampleStride],
+ * ... The mixed-radix FFT is out-of-place, strided and in-place transforms use both halves of
+ * pBuf. */
+static void plp_cfft_batch_transform_f32(const plp_cfft_mixed_instance_f32 *S,
+                                         const Complex_type_f32 *pIn,
+                                         Complex_type_f32 *pOut,
+                                         uint32_t sampleStride,
+                                         Complex_type_f32 *pBuf) {
+
+    uint32_t k;
+    uint32_t N = S->fftLen;
+
+    if (sampleStride == 1 && pIn != pOut) {
+        plp_cfft_mixed_f32s_xpulpv2(S, (const float32_t *)pIn, (float32_t *)pOut);
+        return;
+    }
+
+    // GATHER
+    for (k = 0; k < N; k++) {
+        pBuf[k] = pIn[k * sampleStride];
+    }
+
+    plp_cfft_mixed_f32s_xpulpv2(S, (const float32_t *)pBuf, (float32_t *)(pBuf + N));
+
+    // SCATTER
+    for (k = 0; k < N; k++) {
+        pOut[k * sampleStride] = pBuf[N + k];
+    }
+}
@@ -0,0 +1,114 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_batch_q16p_xpulpv2.c
+ * Description:  Parallel 16-bit fixed point batched complex FFT for XPULPV2
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/* HELPER FUNCTIONS */
+static void plp_cfft_batch_transform_q16(const plp_cfft_instance_q16 *S,
+                                         v2s *pData,
+                                         uint32_t sampleStride,
+                                         uint8_t ifftFlag,
+                                         uint8_t bitReverseFlag,
+                                         uint32_t deciPoint,
+                                         v2s *pBuf);
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup fftBatch
+  @{
+ */
+
+/**
+   @brief  Parallel 16 bit fixed-point batched complex FFT for XPULPV2 extension. Whole transforms
+   are assigned to the cores, the cores synchronize only at the end.
+   @param[in]   args    points to the plp_cfft_batch_parallel_arg_q16 structure
+   @return      none
+*/
+void plp_cfft_batch_q16p_xpulpv2(void *args) {
+
+    plp_cfft_batch_parallel_arg_q16 *arg = (plp_cfft_batch_parallel_arg_q16 *)args;
+    const plp_cfft_instance_q16 *S = arg->S;
+    int16_t *pSrc = arg->pSrc;
+    uint32_t numTransforms = arg->numTransforms;
+    uint32_t transformStride = arg->transformStride;
+    uint32_t sampleStride = arg->sampleStride;
+    uint8_t ifftFlag = arg->ifftFlag;
+    uint8_t bitReverseFlag = arg->bitReverseFlag;
+    uint32_t deciPoint = arg->deciPoint;
+    uint32_t nPE = arg->nPE;
+    int16_t *pBuf = arg->pBuf;
+
+    uint32_t t;
+    uint32_t core_id = rt_core_id();
+    v2s *pCoreBuf = (v2s *)pBuf + core_id * S->fftLen; // unused if sampleStride is 1
+
+    for (t = core_id; t < numTransforms; t += nPE) {
+        plp_cfft_batch_transform_q16(S, (v2s *)pSrc + t * transformStride, sampleStride, ifftFlag,
+                                     bitReverseFlag, deciPoint, pCoreBuf);
+    }
+
+    rt_team_barrier();
+}
+
+/**
+   @} end of fftBatch group
+*/
+
+/* In-place FFT of the fftLen complex values pData[0], pData[sampleStride], ... */
+static void plp_cfft_batch_transform_q16(const plp_cfft_instance_q16 *S,
+                                         v2s *pData,
+                                         uint32_t sampleStride,
+                                         uint8_t ifftFlag,
+                                         uint8_t bitReverseFlag,
+                                         uint32_t deciPoint,
+                                         v2s *pBuf) {
+
+    uint32_t k;
+    uint32_t N = S->fftLen;
+
+    if (sampleStride == 1) {
+        plp_cfft_q16s_xpulpv2(S, (int16_t *)pData, ifftFlag, bitReverseFlag, deciPoint);
+        return;
+    }
+
+    // GATHER
+    for (k = 0; k < N; k++) {
+        pBuf[k] = pData[k * sampleStride];
+    }
+
+    plp_cfft_q16s_xpulpv2(S, (int16_t *)pBuf, ifftFlag, bitReverseFlag, deciPoint);
+
+    // SCATTER
+    for (k = 0; k < N; k++) {
+        pData[k * sampleStride] = pBuf[k];
+    }
+}
@@ -0,0 +1,114 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_batch_q16s_rv32im.c
+ * Description:  16-bit fixed point batched complex FFT for RV32IM
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/* HELPER FUNCTIONS */
+static void plp_cfft_batch_transform_q16(const plp_cfft_instance_q16 *S,
+                                         int32_t *pData,
+                                         uint32_t sampleStride,
+                                         uint8_t ifftFlag,
+                                         uint8_t bitReverseFlag,
+                                         uint32_t deciPoint,
+                                         int32_t *pBuf);
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup fftBatch
+  @{
+ */
+
+/**
+   @brief  16 bit fixed-point batched complex FFT for RV32IM. Every transform is scaled
+   like the output of plp_cfft_q16.
+   @param[in]       S                points to an instance of the 16bit quantized CFFT structure
+   @param[in,out]   pSrc             points to the complex data of all transforms
+   @param[in]       numTransforms    number of transforms
+   @param[in]       transformStride  distance in complex values between two transforms
+   @param[in]       sampleStride     distance in complex values between two samples of a transform
+   @param[in]       ifftFlag         flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+   @param[in]       bitReverseFlag   flag that enables (bitReverseFlag=1) bit reversal of output
+   @param[in]       deciPoint        decimal point for right shift
+   @param[in]       pBuf             points to a temporary buffer of 2*fftLen values
+   @return          none
+*/
+void plp_cfft_batch_q16s_rv32im(const plp_cfft_instance_q16 *S,
+                                int16_t *__restrict__ pSrc,
+                                uint32_t numTransforms,
+                                uint32_t transformStride,
+                                uint32_t sampleStride,
+                                uint8_t ifftFlag,
+                                uint8_t bitReverseFlag,
+                                uint32_t deciPoint,
+                                int16_t *__restrict__ pBuf) {
+
+    uint32_t t;
+
+    for (t = 0; t < numTransforms; t++) {
+        plp_cfft_batch_transform_q16(S, (int32_t *)pSrc + t * transformStride, sampleStride,
+                                     ifftFlag, bitReverseFlag, deciPoint, (int32_t *)pBuf);
+    }
+}
+
+/**
+   @} end of fftBatch group
+*/
+
+/* In-place FFT of the fftLen complex values pData[0], pData[sampleStride], ... */
+static void plp_cfft_batch_transform_q16(const plp_cfft_instance_q16 *S,
+                                         int32_t *pData,
+                                         uint32_t sampleStride,
+                                         uint8_t ifftFlag,
+                                         uint8_t bitReverseFlag,
+                                         uint32_t deciPoint,
+                                         int32_t *pBuf) {
+
+    uint32_t k;
+    uint32_t N = S->fftLen;
+
+    if (sampleStride == 1) {
+        plp_cfft_q16s_rv32im(S, (int16_t *)pData, ifftFlag, bitReverseFlag, deciPoint);
+        return;
+    }
+
+    // GATHER
+    for (k = 0; k < N; k++) {
+        pBuf[k] = pData[k * sampleStride];
+    }
+
+    plp_cfft_q16s_rv32im(S, (int16_t *)pBuf, ifftFlag, bitReverseFlag, deciPoint);
+
+    // SCATTER
+    for (k = 0; k < N; k++) {
+        pData[k * sampleStride] = pBuf[k];
+    }
+}
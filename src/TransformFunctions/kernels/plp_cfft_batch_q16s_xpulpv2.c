@@ -0,0 +1,134 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_batch_q16s_xpulpv2.c
+ * Description:  16-bit fixed point batched complex FFT for XPULPV2
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/* HELPER FUNCTIONS */
+static void plp_cfft_batch_transform_q16(const plp_cfft_instance_q16 *S,
+                                         v2s *pData,
+                                         uint32_t sampleStride,
+                                         uint8_t ifftFlag,
+                                         uint8_t bitReverseFlag,
+                                         uint32_t deciPoint,
+                                         v2s *pBuf);
+
+/**
+  @ingroup fft
+ */
+
+/**
+  @defgroup fftBatch Batched and 2D FFT
+  The batched complex FFT computes many independent transforms of the same length with a single
+  call. Transform t starts at the complex value t*transformStride of the data and its samples are
+  sampleStride complex values apart: the rows of a numRows x numCols matrix are transformed with
+  transformStride = numCols and sampleStride = 1, its columns with transformStride = 1 and
+  sampleStride = numCols. Contiguous transforms are computed in-place, strided transforms are
+  gathered to a temporary buffer and scattered back after the transform.
+
+  The parallel versions assign whole transforms to the cores, core c computes the transforms c,
+  c+nPE, c+2*nPE, ... with the serial kernel. The cores synchronize only once at the end, which
+  makes a batch of short transforms much faster than a sequence of parallel FFTs with a barrier
+  per stage.
+
+  The 2D FFT of a numRows x numCols matrix is built from two batched passes over contiguous rows:
+  the FFT of the rows, a transpose, the FFT of the rows of the transposed matrix, i.e. the
+  columns, and a transpose back. The transposes are tiled so that both the reads and the writes
+  of a tile stay within a few rows of the source and destination matrices.
+*/
+
+/**
+  @addtogroup fftBatch
+  @{
+ */
+
+/**
+   @brief  16 bit fixed-point batched complex FFT for XPULPV2 extension. Every transform is scaled
+   like the output of plp_cfft_q16.
+   @param[in]       S                points to an instance of the 16bit quantized CFFT structure
+   @param[in,out]   pSrc             points to the complex data of all transforms
+   @param[in]       numTransforms    number of transforms
+   @param[in]       transformStride  distance in complex values between two transforms
+   @param[in]       sampleStride     distance in complex values between two samples of a transform
+   @param[in]       ifftFlag         flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+   @param[in]       bitReverseFlag   flag that enables (bitReverseFlag=1) bit reversal of output
+   @param[in]       deciPoint        decimal point for right shift
+   @param[in]       pBuf             points to a temporary buffer of 2*fftLen values
+   @return          none
+*/
+void plp_cfft_batch_q16s_xpulpv2(const plp_cfft_instance_q16 *S,
+                                 int16_t *__restrict__ pSrc,
+                                 uint32_t numTransforms,
+                                 uint32_t transformStride,
+                                 uint32_t sampleStride,
+                                 uint8_t ifftFlag,
+                                 uint8_t bitReverseFlag,
+                                 uint32_t deciPoint,
+                                 int16_t *__restrict__ pBuf) {
+
+    uint32_t t;
+
+    for (t = 0; t < numTransforms; t++) {
+        plp_cfft_batch_transform_q16(S, (v2s *)pSrc + t * transformStride, sampleStride, ifftFlag,
+                                     bitReverseFlag, deciPoint, (v2s *)pBuf);
+    }
+}
+
+/**
+   @} end of fftBatch group
+*/
+
+/* In-place FFT of the fftLen complex values pData[0], pData[sampleStride], ... */
+static void plp_cfft_batch_transform_q16(const plp_cfft_instance_q16 *S,
+                                         v2s *pData,
+                                         uint32_t sampleStride,
+                                         uint8_t ifftFlag,
+                                         uint8_t bitReverseFlag,
+                                         uint32_t deciPoint,
+                                         v2s *pBuf) {
+
+    uint32_t k;
+    uint32_t N = S->fftLen;
+
+    if (sampleStride == 1) {
+        plp_cfft_q16s_xpulpv2(S, (int16_t *)pData, ifftFlag, bitReverseFlag, deciPoint);
+        return;
+    }
+
+    // GATHER
+    for (k = 0; k < N; k++) {
+        pBuf[k] = pData[k * sampleStride];
+    }
+
+    plp_cfft_q16s_xpulpv2(S, (int16_t *)pBuf, ifftFlag, bitReverseFlag, deciPoint);
+
+    // SCATTER
+    for (k = 0; k < N; k++) {
+        pData[k * sampleStride] = pBuf[k];
+    }
+}
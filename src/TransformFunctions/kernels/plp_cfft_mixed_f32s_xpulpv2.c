@@ -0,0 +1,328 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_mixed_f32s_xpulpv2.c
+ * Description:  Floating-point mixed-radix FFT on complex input data
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/* HELPER FUNCTIONS */
+static inline Complex_type_f32 complex_mul_conj(Complex_type_f32 A, Complex_type_f32 W);
+static void plp_cfft_mixed_digitrev_f32(const plp_cfft_mixed_instance_f32 *S,
+                                        const Complex_type_f32 *pIn,
+                                        Complex_type_f32 *pOut,
+                                        uint32_t start,
+                                        uint32_t end);
+static void plp_cfft_mixed_stage_f32(Complex_type_f32 *pOut,
+                                     const Complex_type_f32 *pTw,
+                                     uint32_t radix,
+                                     uint32_t fstride,
+                                     uint32_t m,
+                                     uint32_t first,
+                                     uint32_t step,
+                                     uint32_t distribute_groups);
+static inline void plp_cfft_mixed_bfly2_f32(Complex_type_f32 *F,
+                                            uint32_t m,
+                                            const Complex_type_f32 *pTw,
+                                            uint32_t tw);
+static inline void plp_cfft_mixed_bfly3_f32(Complex_type_f32 *F,
+                                            uint32_t m,
+                                            const Complex_type_f32 *pTw,
+                                            uint32_t tw);
+static inline void plp_cfft_mixed_bfly4_f32(Complex_type_f32 *F,
+                                            uint32_t m,
+                                            const Complex_type_f32 *pTw,
+                                            uint32_t tw);
+static inline void plp_cfft_mixed_bfly5_f32(Complex_type_f32 *F,
+                                            uint32_t m,
+                                            const Complex_type_f32 *pTw,
+                                            uint32_t tw);
+
+/**
+  @ingroup fft
+ */
+
+/**
+  @defgroup fftMixed Mixed-radix FFT
+  The mixed-radix complex FFT supports every length which is a product of the factors 2, 3, 4
+  and 5, e.g. 480, 960 or 1536. The factorization of the length (the plan) and the twiddle
+  factors are computed once by plp_cfft_mixed_init_f32 or plp_cfft_mixed_init_q16.
+
+  The transform is computed out-of-place: the input is first copied to the output buffer in
+  digit-reversed order, then the decimation-in-time stages are computed in-place on the output
+  buffer, starting with the last factor of the plan. Every stage has specialized radix-2, 3, 4
+  and 5 butterflies. The parallel versions split the butterflies of each stage over the cores
+  and synchronize once per stage.
+*/
+
+/**
+  @addtogroup fftMixed
+  @{
+ */
+
+/**
+   @brief  Floating-point mixed-radix complex FFT for XPULPV2 extension.
+   @param[in]   S       points to an instance of the floating-point mixed-radix CFFT structure
+   @param[in]   pSrc    points to the input buffer (complex data)
+   @param[out]  pDst    points to the output buffer (complex data)
+   @return      none
+*/
+void plp_cfft_mixed_f32s_xpulpv2(const plp_cfft_mixed_instance_f32 *S,
+                                 const float32_t *__restrict__ pSrc,
+                                 float32_t *__restrict__ pDst) {
+
+    int i;
+    uint32_t m = 1;
+    uint32_t fstride = S->fftLen;
+    Complex_type_f32 *pOut = (Complex_type_f32 *)pDst;
+    const Complex_type_f32 *pTw = (const Complex_type_f32 *)S->pTwiddle;
+
+    plp_cfft_mixed_digitrev_f32(S, (const Complex_type_f32 *)pSrc, pOut, 0, S->fftLen);
+
+    // the stages are computed from the last to the first factor of the plan
+    for (i = S->numStages - 1; i >= 0; i--) {
+        fstride /= S->factors[i];
+        plp_cfft_mixed_stage_f32(pOut, pTw, S->factors[i], fstride, m, 0, 1, 0);
+        m *= S->factors[i];
+    }
+}
+
+/**
+   @} end of fftMixed group
+*/
+
+/* multiplication with the conjugate of the twiddle factor W = cos + j sin */
+static inline Complex_type_f32 complex_mul_conj(Complex_type_f32 A, Complex_type_f32 W) {
+
+    Complex_type_f32 result;
+    result.re = A.re * W.re + A.im * W.im;
+    result.im = A.im * W.re - A.re * W.im;
+    return result;
+}
+
+/*
+ * Copies the input elements to the output positions start to end-1 in digit-reversed order. The
+ * output position has the digits q_0 ... q_(S-1) with respect to the factors of the plan (q_0 is
+ * the most significant one), the input index is q_0 + q_1 p_0 + q_2 p_0 p_1 + ...
+ */
+static void plp_cfft_mixed_digitrev_f32(const plp_cfft_mixed_instance_f32 *S,
+                                        const Complex_type_f32 *pIn,
+                                        Complex_type_f32 *pOut,
+                                        uint32_t start,
+                                        uint32_t end) {
+
+    int i;
+    uint32_t pos, rem, idx = 0;
+    uint32_t numStages = S->numStages;
+    uint32_t digit[PLP_CFFT_MIXED_MAX_STAGES];
+    uint32_t stride[PLP_CFFT_MIXED_MAX_STAGES];
+
+    stride[0] = 1;
+    for (i = 1; i < numStages; i++) {
+        stride[i] = stride[i - 1] * S->factors[i - 1];
+    }
+
+    rem = start;
+    for (i = numStages - 1; i >= 0; i--) {
+        digit[i] = rem % S->factors[i];
+        rem = rem / S->factors[i];
+        idx += digit[i] * stride[i];
+    }
+
+    for (pos = start; pos < end; pos++) {
+        pOut[pos] = pIn[idx];
+
+        // increment the digits, the last one is the least significant
+        i = numStages - 1;
+        digit[i]++;
+        idx += stride[i];
+        while (digit[i] == S->factors[i] && i > 0) {
+            digit[i] = 0;
+            idx -= S->factors[i] * stride[i];
+            i--;
+            digit[i]++;
+            idx += stride[i];
+        }
+    }
+}
+
+/*
+ * Butterflies of one stage. The stage consists of fstride groups of radix*m elements, the
+ * butterfly u of a group combines the elements u + q*m, q = 0 ... radix-1, after multiplying them
+ * with the twiddle factors W^(q*u*fstride). Either the groups (distribute_groups = 1) or the
+ * butterflies within a group are distributed over the cores, starting at first with step.
+ */
+static void plp_cfft_mixed_stage_f32(Complex_type_f32 *pOut,
+                                     const Complex_type_f32 *pTw,
+                                     uint32_t radix,
+                                     uint32_t fstride,
+                                     uint32_t m,
+                                     uint32_t first,
+                                     uint32_t step,
+                                     uint32_t distribute_groups) {
+
+    uint32_t b, u;
+    uint32_t b_first = distribute_groups ? first : 0;
+    uint32_t b_step = distribute_groups ? step : 1;
+    uint32_t u_first = distribute_groups ? 0 : first;
+    uint32_t u_step = distribute_groups ? 1 : step;
+
+    switch (radix) {
+    case 2:
+        for (b = b_first; b < fstride; b += b_step) {
+            for (u = u_first; u < m; u += u_step) {
+                plp_cfft_mixed_bfly2_f32(pOut + b * 2 * m + u, m, pTw, u * fstride);
+            }
+        }
+        break;
+    case 3:
+        for (b = b_first; b < fstride; b += b_step) {
+            for (u = u_first; u < m; u += u_step) {
+                plp_cfft_mixed_bfly3_f32(pOut + b * 3 * m + u, m, pTw, u * fstride);
+            }
+        }
+        break;
+    case 4:
+        for (b = b_first; b < fstride; b += b_step) {
+            for (u = u_first; u < m; u += u_step) {
+                plp_cfft_mixed_bfly4_f32(pOut + b * 4 * m + u, m, pTw, u * fstride);
+            }
+        }
+        break;
+    case 5:
+        for (b = b_first; b < fstride; b += b_step) {
+            for (u = u_first; u < m; u += u_step) {
+                plp_cfft_mixed_bfly5_f32(pOut + b * 5 * m + u, m, pTw, u * fstride);
+            }
+        }
+        break;
+    }
+}
+
+static inline void plp_cfft_mixed_bfly2_f32(Complex_type_f32 *F,
+                                            uint32_t m,
+                                            const Complex_type_f32 *pTw,
+                                            uint32_t tw) {
+
+    Complex_type_f32 t0, t1;
+
+    t0 = F[0];
+    t1 = complex_mul_conj(F[m], pTw[tw]);
+
+    F[0] = (Complex_type_f32){ t0.re + t1.re, t0.im + t1.im };
+    F[m] = (Complex_type_f32){ t0.re - t1.re, t0.im - t1.im };
+}
+
+static inline void plp_cfft_mixed_bfly3_f32(Complex_type_f32 *F,
+                                            uint32_t m,
+                                            const Complex_type_f32 *pTw,
+                                            uint32_t tw) {
+
+    Complex_type_f32 t0, t1, t2;
+    Complex_type_f32 s0, s1, s2;
+
+    /* sin of 2*pi/3, the cosine is -1/2 */
+    const float32_t s60 = 0.86602540f;
+
+    t0 = F[0];
+    t1 = complex_mul_conj(F[m], pTw[tw]);
+    t2 = complex_mul_conj(F[2 * m], pTw[2 * tw]);
+
+    s0 = (Complex_type_f32){ t1.re + t2.re, t1.im + t2.im };
+    s1 = (Complex_type_f32){ s60 * (t1.re - t2.re), s60 * (t1.im - t2.im) };
+    s2 = (Complex_type_f32){ t0.re - 0.5f * s0.re, t0.im - 0.5f * s0.im };
+
+    // y1 = s2 - j s1, y2 = s2 + j s1
+    F[0] = (Complex_type_f32){ t0.re + s0.re, t0.im + s0.im };
+    F[m] = (Complex_type_f32){ s2.re + s1.im, s2.im - s1.re };
+    F[2 * m] = (Complex_type_f32){ s2.re - s1.im, s2.im + s1.re };
+}
+
+static inline void plp_cfft_mixed_bfly4_f32(Complex_type_f32 *F,
+                                            uint32_t m,
+                                            const Complex_type_f32 *pTw,
+                                            uint32_t tw) {
+
+    Complex_type_f32 t0, t1, t2, t3;
+    Complex_type_f32 s0, s1, s2, s3;
+
+    t0 = F[0];
+    t1 = complex_mul_conj(F[m], pTw[tw]);
+    t2 = complex_mul_conj(F[2 * m], pTw[2 * tw]);
+    t3 = complex_mul_conj(F[3 * m], pTw[3 * tw]);
+
+    s0 = (Complex_type_f32){ t0.re + t2.re, t0.im + t2.im };
+    s1 = (Complex_type_f32){ t0.re - t2.re, t0.im - t2.im };
+    s2 = (Complex_type_f32){ t1.re + t3.re, t1.im + t3.im };
+    s3 = (Complex_type_f32){ t1.re - t3.re, t1.im - t3.im };
+
+    // y1 = s1 - j s3, y3 = s1 + j s3
+    F[0] = (Complex_type_f32){ s0.re + s2.re, s0.im + s2.im };
+    F[m] = (Complex_type_f32){ s1.re + s3.im, s1.im - s3.re };
+    F[2 * m] = (Complex_type_f32){ s0.re - s2.re, s0.im - s2.im };
+    F[3 * m] = (Complex_type_f32){ s1.re - s3.im, s1.im + s3.re };
+}
+
+static inline void plp_cfft_mixed_bfly5_f32(Complex_type_f32 *F,
+                                            uint32_t m,
+                                            const Complex_type_f32 *pTw,
+                                            uint32_t tw) {
+
+    Complex_type_f32 t0, t1, t2, t3, t4;
+    Complex_type_f32 s0, s1, s2, s3;
+
+    /* cos and sin of 2*pi/5 and 4*pi/5 */
+    const float32_t c72 = 0.30901699f;
+    const float32_t s72 = 0.95105652f;
+    const float32_t c144 = -0.80901699f;
+    const float32_t s144 = 0.58778525f;
+
+    t0 = F[0];
+    t1 = complex_mul_conj(F[m], pTw[tw]);
+    t2 = complex_mul_conj(F[2 * m], pTw[2 * tw]);
+    t3 = complex_mul_conj(F[3 * m], pTw[3 * tw]);
+    t4 = complex_mul_conj(F[4 * m], pTw[4 * tw]);
+
+    s0 = (Complex_type_f32){ t1.re + t4.re, t1.im + t4.im };
+    s1 = (Complex_type_f32){ t1.re - t4.re, t1.im - t4.im };
+    s2 = (Complex_type_f32){ t2.re + t3.re, t2.im + t3.im };
+    s3 = (Complex_type_f32){ t2.re - t3.re, t2.im - t3.im };
+
+    F[0] = (Complex_type_f32){ t0.re + s0.re + s2.re, t0.im + s0.im + s2.im };
+
+    // y1 = r1 - j i1, y4 = r1 + j i1
+    t1 = (Complex_type_f32){ t0.re + c72 * s0.re + c144 * s2.re,
+                             t0.im + c72 * s0.im + c144 * s2.im };
+    t4 = (Complex_type_f32){ s72 * s1.re + s144 * s3.re, s72 * s1.im + s144 * s3.im };
+    F[m] = (Complex_type_f32){ t1.re + t4.im, t1.im - t4.re };
+    F[4 * m] = (Complex_type_f32){ t1.re - t4.im, t1.im + t4.re };
+
+    // y2 = r2 - j i2, y3 = r2 + j i2
+    t2 = (Complex_type_f32){ t0.re + c144 * s0.re + c72 * s2.re,
+                             t0.im + c144 * s0.im + c72 * s2.im };
+    t3 = (Complex_type_f32){ s144 * s1.re - s72 * s3.re, s144 * s1.im - s72 * s3.im };
+    F[2 * m] = (Complex_type_f32){ t2.re + t3.im, t2.im - t3.re };
+    F[3 * m] = (Complex_type_f32){ t2.re - t3.im, t2.im + t3.re };
+}
@@ -0,0 +1,303 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_mixed_q16p_xpulpv2.c
+ * Description:  Parallel 16-bit fixed point mixed-radix FFT on complex input data
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/* HELPER FUNCTIONS */
+static inline v2s complex_mul_conj_q16(v2s A, v2s W);
+static inline v2s scale_q16(v2s A, int16_t c);
+static void plp_cfft_mixed_digitrev_q16(const plp_cfft_mixed_instance_q16 *S,
+                                        const v2s *pIn,
+                                        v2s *pOut,
+                                        uint32_t start,
+                                        uint32_t end);
+static void plp_cfft_mixed_stage_q16(v2s *pOut,
+                                     const v2s *pTw,
+                                     uint32_t radix,
+                                     uint32_t fstride,
+                                     uint32_t m,
+                                     uint32_t first,
+                                     uint32_t step,
+                                     uint32_t distribute_groups);
+static inline void plp_cfft_mixed_bfly2_q16(v2s *F, uint32_t m, const v2s *pTw, uint32_t tw);
+static inline void plp_cfft_mixed_bfly3_q16(v2s *F, uint32_t m, const v2s *pTw, uint32_t tw);
+static inline void plp_cfft_mixed_bfly4_q16(v2s *F, uint32_t m, const v2s *pTw, uint32_t tw);
+static inline void plp_cfft_mixed_bfly5_q16(v2s *F, uint32_t m, const v2s *pTw, uint32_t tw);
+
+/* Q1.15 constants: 1/3, 1/5, sin(2*pi/3), cos and sin of 2*pi/5 and 4*pi/5 */
+#define MIXED_Q16_INV3 10923
+#define MIXED_Q16_INV5 6554
+#define MIXED_Q16_S60 28378
+#define MIXED_Q16_C72 10126
+#define MIXED_Q16_S72 31164
+#define MIXED_Q16_C144 -26510
+#define MIXED_Q16_S144 19261
+
+/**
+  @ingroup fftMixed
+ */
+
+/**
+  @addtogroup fftMixed
+  @{
+ */
+
+/**
+   @brief  Parallel 16 bit fixed-point mixed-radix complex FFT for XPULPV2 extension. The output
+   is identical to the one of plp_cfft_mixed_q16s_xpulpv2.
+   @param[in]   args    points to the plp_cfft_mixed_parallel_arg_q16 structure
+   @return      none
+*/
+void plp_cfft_mixed_q16p_xpulpv2(void *args) {
+
+    plp_cfft_mixed_parallel_arg_q16 *arg = (plp_cfft_mixed_parallel_arg_q16 *)args;
+    const plp_cfft_mixed_instance_q16 *S = arg->S;
+    uint32_t nPE = arg->nPE;
+    uint32_t core_id = rt_core_id();
+
+    int i;
+    uint32_t m = 1;
+    uint32_t fstride = S->fftLen;
+    uint32_t chunk = (S->fftLen + nPE - 1) / nPE;
+    uint32_t start = core_id * chunk;
+    uint32_t end = (start + chunk < S->fftLen) ? start + chunk : S->fftLen;
+    v2s *pOut = (v2s *)arg->pDst;
+    const v2s *pTw = (const v2s *)S->pTwiddle;
+
+    if (start < end) {
+        plp_cfft_mixed_digitrev_q16(S, (const v2s *)arg->pSrc, pOut, start, end);
+    }
+
+    rt_team_barrier();
+
+    // the stages are computed from the last to the first factor of the plan, the butterflies
+    // within a group are distributed over the cores as long as there are enough of them
+    for (i = S->numStages - 1; i >= 0; i--) {
+        fstride /= S->factors[i];
+        plp_cfft_mixed_stage_q16(pOut, pTw, S->factors[i], fstride, m, core_id, nPE, m < nPE);
+        m *= S->factors[i];
+
+        rt_team_barrier();
+    }
+}
+
+/**
+   @} end of fftMixed group
+*/
+
+/* multiplication with the conjugate of the Q1.15 twiddle factor W = cos + j sin */
+static inline v2s complex_mul_conj_q16(v2s A, v2s W) {
+    return __PACK2(__DOTP2(A, W) >> 15, __DOTP2(A, __PACK2(-W[1], W[0])) >> 15);
+}
+
+/* multiplication of both parts with the Q1.15 constant c */
+static inline v2s scale_q16(v2s A, int16_t c) {
+    return __PACK2(((int32_t)A[0] * c) >> 15, ((int32_t)A[1] * c) >> 15);
+}
+
+/*
+ * Copies the input elements to the output positions start to end-1 in digit-reversed order. The
+ * output position has the digits q_0 ... q_(S-1) with respect to the factors of the plan (q_0 is
+ * the most significant one), the input index is q_0 + q_1 p_0 + q_2 p_0 p_1 + ...
+ */
+static void plp_cfft_mixed_digitrev_q16(const plp_cfft_mixed_instance_q16 *S,
+                                        const v2s *pIn,
+                                        v2s *pOut,
+                                        uint32_t start,
+                                        uint32_t end) {
+
+    int i;
+    uint32_t pos, rem, idx = 0;
+    uint32_t numStages = S->numStages;
+    uint32_t digit[PLP_CFFT_MIXED_MAX_STAGES];
+    uint32_t stride[PLP_CFFT_MIXED_MAX_STAGES];
+
+    stride[0] = 1;
+    for (i = 1; i < numStages; i++) {
+        stride[i] = stride[i - 1] * S->factors[i - 1];
+    }
+
+    rem = start;
+    for (i = numStages - 1; i >= 0; i--) {
+        digit[i] = rem % S->factors[i];
+        rem = rem / S->factors[i];
+        idx += digit[i] * stride[i];
+    }
+
+    for (pos = start; pos < end; pos++) {
+        pOut[pos] = pIn[idx];
+
+        // increment the digits, the last one is the least significant
+        i = numStages - 1;
+        digit[i]++;
+        idx += stride[i];
+        while (digit[i] == S->factors[i] && i > 0) {
+            digit[i] = 0;
+            idx -= S->factors[i] * stride[i];
+            i--;
+            digit[i]++;
+            idx += stride[i];
+        }
+    }
+}
+
+/*
+ * Butterflies of one stage. The stage consists of fstride groups of radix*m elements, the
+ * butterfly u of a group combines the elements u + q*m, q = 0 ... radix-1, after multiplying them
+ * with the twiddle factors W^(q*u*fstride). Either the groups (distribute_groups = 1) or the
+ * butterflies within a group are distributed over the cores, starting at first with step.
+ */
+static void plp_cfft_mixed_stage_q16(v2s *pOut,
+                                     const v2s *pTw,
+                                     uint32_t radix,
+                                     uint32_t fstride,
+                                     uint32_t m,
+                                     uint32_t first,
+                                     uint32_t step,
+                                     uint32_t distribute_groups) {
+
+    uint32_t b, u;
+    uint32_t b_first = distribute_groups ? first : 0;
+    uint32_t b_step = distribute_groups ? step : 1;
+    uint32_t u_first = distribute_groups ? 0 : first;
+    uint32_t u_step = distribute_groups ? 1 : step;
+
+    switch (radix) {
+    case 2:
+        for (b = b_first; b < fstride; b += b_step) {
+            for (u = u_first; u < m; u += u_step) {
+                plp_cfft_mixed_bfly2_q16(pOut + b * 2 * m + u, m, pTw, u * fstride);
+            }
+        }
+        break;
+    case 3:
+        for (b = b_first; b < fstride; b += b_step) {
+            for (u = u_first; u < m; u += u_step) {
+                plp_cfft_mixed_bfly3_q16(pOut + b * 3 * m + u, m, pTw, u * fstride);
+            }
+        }
+        break;
+    case 4:
+        for (b = b_first; b < fstride; b += b_step) {
+            for (u = u_first; u < m; u += u_step) {
+                plp_cfft_mixed_bfly4_q16(pOut + b * 4 * m + u, m, pTw, u * fstride);
+            }
+        }
+        break;
+    case 5:
+        for (b = b_first; b < fstride; b += b_step) {
+            for (u = u_first; u < m; u += u_step) {
+                plp_cfft_mixed_bfly5_q16(pOut + b * 5 * m + u, m, pTw, u * fstride);
+            }
+        }
+        break;
+    }
+}
+
+static inline void plp_cfft_mixed_bfly2_q16(v2s *F, uint32_t m, const v2s *pTw, uint32_t tw) {
+
+    v2s t0, t1;
+
+    t0 = __SRA2(F[0], ((v2s){ 1, 1 }));
+    t1 = complex_mul_conj_q16(__SRA2(F[m], ((v2s){ 1, 1 })), pTw[tw]);
+
+    F[0] = __ADD2(t0, t1);
+    F[m] = __SUB2(t0, t1);
+}
+
+static inline void plp_cfft_mixed_bfly3_q16(v2s *F, uint32_t m, const v2s *pTw, uint32_t tw) {
+
+    v2s t0, t1, t2;
+    v2s s0, s1, s2;
+
+    t0 = scale_q16(F[0], MIXED_Q16_INV3);
+    t1 = complex_mul_conj_q16(scale_q16(F[m], MIXED_Q16_INV3), pTw[tw]);
+    t2 = complex_mul_conj_q16(scale_q16(F[2 * m], MIXED_Q16_INV3), pTw[2 * tw]);
+
+    s0 = __ADD2(t1, t2);
+    s1 = scale_q16(__SUB2(t1, t2), MIXED_Q16_S60);
+    s2 = __SUB2(t0, __SRA2(s0, ((v2s){ 1, 1 })));
+
+    // y1 = s2 - j s1, y2 = s2 + j s1
+    F[0] = __ADD2(t0, s0);
+    F[m] = __ADD2(s2, __PACK2(s1[1], -s1[0]));
+    F[2 * m] = __ADD2(s2, __PACK2(-s1[1], s1[0]));
+}
+
+static inline void plp_cfft_mixed_bfly4_q16(v2s *F, uint32_t m, const v2s *pTw, uint32_t tw) {
+
+    v2s t0, t1, t2, t3;
+    v2s s0, s1, s2, s3;
+
+    t0 = __SRA2(F[0], ((v2s){ 2, 2 }));
+    t1 = complex_mul_conj_q16(__SRA2(F[m], ((v2s){ 2, 2 })), pTw[tw]);
+    t2 = complex_mul_conj_q16(__SRA2(F[2 * m], ((v2s){ 2, 2 })), pTw[2 * tw]);
+    t3 = complex_mul_conj_q16(__SRA2(F[3 * m], ((v2s){ 2, 2 })), pTw[3 * tw]);
+
+    s0 = __ADD2(t0, t2);
+    s1 = __SUB2(t0, t2);
+    s2 = __ADD2(t1, t3);
+    s3 = __SUB2(t1, t3);
+
+    // y1 = s1 - j s3, y3 = s1 + j s3
+    F[0] = __ADD2(s0, s2);
+    F[m] = __ADD2(s1, __PACK2(s3[1], -s3[0]));
+    F[2 * m] = __SUB2(s0, s2);
+    F[3 * m] = __ADD2(s1, __PACK2(-s3[1], s3[0]));
+}
+
+static inline void plp_cfft_mixed_bfly5_q16(v2s *F, uint32_t m, const v2s *pTw, uint32_t tw) {
+
+    v2s t0, t1, t2, t3, t4;
+    v2s s0, s1, s2, s3;
+
+    t0 = scale_q16(F[0], MIXED_Q16_INV5);
+    t1 = complex_mul_conj_q16(scale_q16(F[m], MIXED_Q16_INV5), pTw[tw]);
+    t2 = complex_mul_conj_q16(scale_q16(F[2 * m], MIXED_Q16_INV5), pTw[2 * tw]);
+    t3 = complex_mul_conj_q16(scale_q16(F[3 * m], MIXED_Q16_INV5), pTw[3 * tw]);
+    t4 = complex_mul_conj_q16(scale_q16(F[4 * m], MIXED_Q16_INV5), pTw[4 * tw]);
+
+    s0 = __ADD2(t1, t4);
+    s1 = __SUB2(t1, t4);
+    s2 = __ADD2(t2, t3);
+    s3 = __SUB2(t2, t3);
+
+    F[0] = __ADD2(t0, __ADD2(s0, s2));
+
+    // y1 = r1 - j i1, y4 = r1 + j i1
+    t1 = __ADD2(t0, __ADD2(scale_q16(s0, MIXED_Q16_C72), scale_q16(s2, MIXED_Q16_C144)));
+    t4 = __ADD2(scale_q16(s1, MIXED_Q16_S72), scale_q16(s3, MIXED_Q16_S144));
+    F[m] = __ADD2(t1, __PACK2(t4[1], -t4[0]));
+    F[4 * m] = __ADD2(t1, __PACK2(-t4[1], t4[0]));
+
+    // y2 = r2 - j i2, y3 = r2 + j i2
+    t2 = __ADD2(t0, __ADD2(scale_q16(s0, MIXED_Q16_C144), scale_q16(s2, MIXED_Q16_C72)));
+    t3 = __SUB2(scale_q16(s1, MIXED_Q16_S144), scale_q16(s3, MIXED_Q16_S72));
+    F[2 * m] = __ADD2(t2, __PACK2(t3[1], -t3[0]));
+    F[3 * m] = __ADD2(t2, __PACK2(-t3[1], t3[0]));
+}
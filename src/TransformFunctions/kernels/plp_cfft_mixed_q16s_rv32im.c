@@ -0,0 +1,384 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_mixed_q16s_rv32im.c
+ * Description:  16-bit fixed point mixed-radix FFT on complex input data
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/* HELPER FUNCTIONS */
+static inline void complex_mul_conj_q16(const int16_t *A, const int16_t *W, int16_t *R);
+static inline void scale_q16(const int16_t *A, int16_t c, int16_t *R);
+static void plp_cfft_mixed_digitrev_q16(const plp_cfft_mixed_instance_q16 *S,
+                                        const int16_t *pIn,
+                                        int16_t *pOut,
+                                        uint32_t start,
+                                        uint32_t end);
+static void plp_cfft_mixed_stage_q16(int16_t *pOut,
+                                     const int16_t *pTw,
+                                     uint32_t radix,
+                                     uint32_t fstride,
+                                     uint32_t m,
+                                     uint32_t first,
+                                     uint32_t step,
+                                     uint32_t distribute_groups);
+static inline void plp_cfft_mixed_bfly2_q16(int16_t *F,
+                                            uint32_t m,
+                                            const int16_t *pTw,
+                                            uint32_t tw);
+static inline void plp_cfft_mixed_bfly3_q16(int16_t *F,
+                                            uint32_t m,
+                                            const int16_t *pTw,
+                                            uint32_t tw);
+static inline void plp_cfft_mixed_bfly4_q16(int16_t *F,
+                                            uint32_t m,
+                                            const int16_t *pTw,
+                                            uint32_t tw);
+static inline void plp_cfft_mixed_bfly5_q16(int16_t *F,
+                                            uint32_t m,
+                                            const int16_t *pTw,
+                                            uint32_t tw);
+
+/* Q1.15 constants: 1/3, 1/5, sin(2*pi/3), cos and sin of 2*pi/5 and 4*pi/5 */
+#define MIXED_Q16_INV3 10923
+#define MIXED_Q16_INV5 6554
+#define MIXED_Q16_S60 28378
+#define MIXED_Q16_C72 10126
+#define MIXED_Q16_S72 31164
+#define MIXED_Q16_C144 -26510
+#define MIXED_Q16_S144 19261
+
+/**
+  @ingroup fftMixed
+ */
+
+/**
+  @addtogroup fftMixed
+  @{
+ */
+
+/**
+   @brief  16 bit fixed-point mixed-radix complex FFT for RV32IM. The inputs of every
+   stage are scaled by 1/radix, so the output is scaled by 1/N.
+   @param[in]   S           points to an instance of the 16bit mixed-radix CFFT structure
+   @param[in]   pSrc        points to the input buffer (complex data)
+   @param[in]   deciPoint   decimal point for right shift
+   @param[out]  pDst        points to the output buffer (complex data)
+   @return      none
+*/
+void plp_cfft_mixed_q16s_rv32im(const plp_cfft_mixed_instance_q16 *S,
+                                const int16_t *__restrict__ pSrc,
+                                uint32_t deciPoint,
+                                int16_t *__restrict__ pDst) {
+
+    int i;
+    uint32_t m = 1;
+    uint32_t fstride = S->fftLen;
+    int16_t *pOut = pDst;
+    const int16_t *pTw = S->pTwiddle;
+
+    plp_cfft_mixed_digitrev_q16(S, pSrc, pOut, 0, S->fftLen);
+
+    // the stages are computed from the last to the first factor of the plan
+    for (i = S->numStages - 1; i >= 0; i--) {
+        fstride /= S->factors[i];
+        plp_cfft_mixed_stage_q16(pOut, pTw, S->factors[i], fstride, m, 0, 1, 0);
+        m *= S->factors[i];
+    }
+}
+
+/**
+   @} end of fftMixed group
+*/
+
+/* multiplication with the conjugate of the Q1.15 twiddle factor W = cos + j sin */
+static inline void complex_mul_conj_q16(const int16_t *A, const int16_t *W, int16_t *R) {
+    int32_t re = (int32_t)A[0] * W[0] + (int32_t)A[1] * W[1];
+    int32_t im = (int32_t)A[1] * W[0] - (int32_t)A[0] * W[1];
+    R[0] = re >> 15;
+    R[1] = im >> 15;
+}
+
+/* multiplication of both parts with the Q1.15 constant c */
+static inline void scale_q16(const int16_t *A, int16_t c, int16_t *R) {
+    R[0] = ((int32_t)A[0] * c) >> 15;
+    R[1] = ((int32_t)A[1] * c) >> 15;
+}
+
+/*
+ * Copies the input elements to the output positions start to end-1 in digit-reversed order. The
+ * output position has the digits q_0 ... q_(S-1) with respect to the factors of the plan (q_0 is
+ * the most significant one), the input index is q_0 + q_1 p_0 + q_2 p_0 p_1 + ...
+ */
+static void plp_cfft_mixed_digitrev_q16(const plp_cfft_mixed_instance_q16 *S,
+                                        const int16_t *pIn,
+                                        int16_t *pOut,
+                                        uint32_t start,
+                                        uint32_t end) {
+
+    int i;
+    uint32_t pos, rem, idx = 0;
+    uint32_t numStages = S->numStages;
+    uint32_t digit[PLP_CFFT_MIXED_MAX_STAGES];
+    uint32_t stride[PLP_CFFT_MIXED_MAX_STAGES];
+
+    stride[0] = 1;
+    for (i = 1; i < numStages; i++) {
+        stride[i] = stride[i - 1] * S->factors[i - 1];
+    }
+
+    rem = start;
+    for (i = numStages - 1; i >= 0; i--) {
+        digit[i] = rem % S->factors[i];
+        rem = rem / S->factors[i];
+        idx += digit[i] * stride[i];
+    }
+
+    for (pos = start; pos < end; pos++) {
+        pOut[2 * pos] = pIn[2 * idx];
+        pOut[2 * pos + 1] = pIn[2 * idx + 1];
+
+        // increment the digits, the last one is the least significant
+        i = numStages - 1;
+        digit[i]++;
+        idx += stride[i];
+        while (digit[i] == S->factors[i] && i > 0) {
+            digit[i] = 0;
+            idx -= S->factors[i] * stride[i];
+            i--;
+            digit[i]++;
+            idx += stride[i];
+        }
+    }
+}
+
+/*
+ * Butterflies of one stage. The stage consists of fstride groups of radix*m elements, the
+ * butterfly u of a group combines the elements u + q*m, q = 0 ... radix-1, after multiplying them
+ * with the twiddle factors W^(q*u*fstride). Either the groups (distribute_groups = 1) or the
+ * butterflies within a group are distributed over the cores, starting at first with step.
+ */
+static void plp_cfft_mixed_stage_q16(int16_t *pOut,
+                                     const int16_t *pTw,
+                                     uint32_t radix,
+                                     uint32_t fstride,
+                                     uint32_t m,
+                                     uint32_t first,
+                                     uint32_t step,
+                                     uint32_t distribute_groups) {
+
+    uint32_t b, u;
+    uint32_t b_first = distribute_groups ? first : 0;
+    uint32_t b_step = distribute_groups ? step : 1;
+    uint32_t u_first = distribute_groups ? 0 : first;
+    uint32_t u_step = distribute_groups ? 1 : step;
+
+    switch (radix) {
+    case 2:
+        for (b = b_first; b < fstride; b += b_step) {
+            for (u = u_first; u < m; u += u_step) {
+                plp_cfft_mixed_bfly2_q16(pOut + 2 * (b * 2 * m + u), m, pTw, u * fstride);
+            }
+        }
+        break;
+    case 3:
+        for (b = b_first; b < fstride; b += b_step) {
+            for (u = u_first; u < m; u += u_step) {
+                plp_cfft_mixed_bfly3_q16(pOut + 2 * (b * 3 * m + u), m, pTw, u * fstride);
+            }
+        }
+        break;
+    case 4:
+        for (b = b_first; b < fstride; b += b_step) {
+            for (u = u_first; u < m; u += u_step) {
+                plp_cfft_mixed_bfly4_q16(pOut + 2 * (b * 4 * m + u), m, pTw, u * fstride);
+            }
+        }
+        break;
+    case 5:
+        for (b = b_first; b < fstride; b += b_step) {
+            for (u = u_first; u < m; u += u_step) {
+                plp_cfft_mixed_bfly5_q16(pOut + 2 * (b * 5 * m + u), m, pTw, u * fstride);
+            }
+        }
+        break;
+    }
+}
+
+/* the elements are complex, i.e. element q*m is at F[2*q*m] */
+static inline void plp_cfft_mixed_bfly2_q16(int16_t *F,
+                                            uint32_t m,
+                                            const int16_t *pTw,
+                                            uint32_t tw) {
+
+    int16_t t0[2], t1[2], a[2];
+
+    t0[0] = F[0] >> 1;
+    t0[1] = F[1] >> 1;
+    a[0] = F[2 * m] >> 1;
+    a[1] = F[2 * m + 1] >> 1;
+    complex_mul_conj_q16(a, &pTw[2 * tw], t1);
+
+    F[0] = t0[0] + t1[0];
+    F[1] = t0[1] + t1[1];
+    F[2 * m] = t0[0] - t1[0];
+    F[2 * m + 1] = t0[1] - t1[1];
+}
+
+static inline void plp_cfft_mixed_bfly3_q16(int16_t *F,
+                                            uint32_t m,
+                                            const int16_t *pTw,
+                                            uint32_t tw) {
+
+    int16_t t0[2], t1[2], t2[2], a[2];
+    int16_t s0[2], s1[2], s2[2];
+
+    scale_q16(&F[0], MIXED_Q16_INV3, t0);
+    scale_q16(&F[2 * m], MIXED_Q16_INV3, a);
+    complex_mul_conj_q16(a, &pTw[2 * tw], t1);
+    scale_q16(&F[4 * m], MIXED_Q16_INV3, a);
+    complex_mul_conj_q16(a, &pTw[4 * tw], t2);
+
+    s0[0] = t1[0] + t2[0];
+    s0[1] = t1[1] + t2[1];
+    a[0] = t1[0] - t2[0];
+    a[1] = t1[1] - t2[1];
+    scale_q16(a, MIXED_Q16_S60, s1);
+    s2[0] = t0[0] - (s0[0] >> 1);
+    s2[1] = t0[1] - (s0[1] >> 1);
+
+    // y1 = s2 - j s1, y2 = s2 + j s1
+    F[0] = t0[0] + s0[0];
+    F[1] = t0[1] + s0[1];
+    F[2 * m] = s2[0] + s1[1];
+    F[2 * m + 1] = s2[1] - s1[0];
+    F[4 * m] = s2[0] - s1[1];
+    F[4 * m + 1] = s2[1] + s1[0];
+}
+
+static inline void plp_cfft_mixed_bfly4_q16(int16_t *F,
+                                            uint32_t m,
+                                            const int16_t *pTw,
+                                            uint32_t tw) {
+
+    int16_t t0[2], t1[2], t2[2], t3[2], a[2];
+    int16_t s0[2], s1[2], s2[2], s3[2];
+
+    t0[0] = F[0] >> 2;
+    t0[1] = F[1] >> 2;
+    a[0] = F[2 * m] >> 2;
+    a[1] = F[2 * m + 1] >> 2;
+    complex_mul_conj_q16(a, &pTw[2 * tw], t1);
+    a[0] = F[4 * m] >> 2;
+    a[1] = F[4 * m + 1] >> 2;
+    complex_mul_conj_q16(a, &pTw[4 * tw], t2);
+    a[0] = F[6 * m] >> 2;
+    a[1] = F[6 * m + 1] >> 2;
+    complex_mul_conj_q16(a, &pTw[6 * tw], t3);
+
+    s0[0] = t0[0] + t2[0];
+    s0[1] = t0[1] + t2[1];
+    s1[0] = t0[0] - t2[0];
+    s1[1] = t0[1] - t2[1];
+    s2[0] = t1[0] + t3[0];
+    s2[1] = t1[1] + t3[1];
+    s3[0] = t1[0] - t3[0];
+    s3[1] = t1[1] - t3[1];
+
+    // y1 = s1 - j s3, y3 = s1 + j s3
+    F[0] = s0[0] + s2[0];
+    F[1] = s0[1] + s2[1];
+    F[2 * m] = s1[0] + s3[1];
+    F[2 * m + 1] = s1[1] - s3[0];
+    F[4 * m] = s0[0] - s2[0];
+    F[4 * m + 1] = s0[1] - s2[1];
+    F[6 * m] = s1[0] - s3[1];
+    F[6 * m + 1] = s1[1] + s3[0];
+}
+
+static inline void plp_cfft_mixed_bfly5_q16(int16_t *F,
+                                            uint32_t m,
+                                            const int16_t *pTw,
+                                            uint32_t tw) {
+
+    int16_t t0[2], t1[2], t2[2], t3[2], t4[2], a[2], b[2];
+    int16_t s0[2], s1[2], s2[2], s3[2];
+
+    scale_q16(&F[0], MIXED_Q16_INV5, t0);
+    scale_q16(&F[2 * m], MIXED_Q16_INV5, a);
+    complex_mul_conj_q16(a, &pTw[2 * tw], t1);
+    scale_q16(&F[4 * m], MIXED_Q16_INV5, a);
+    complex_mul_conj_q16(a, &pTw[4 * tw], t2);
+    scale_q16(&F[6 * m], MIXED_Q16_INV5, a);
+    complex_mul_conj_q16(a, &pTw[6 * tw], t3);
+    scale_q16(&F[8 * m], MIXED_Q16_INV5, a);
+    complex_mul_conj_q16(a, &pTw[8 * tw], t4);
+
+    s0[0] = t1[0] + t4[0];
+    s0[1] = t1[1] + t4[1];
+    s1[0] = t1[0] - t4[0];
+    s1[1] = t1[1] - t4[1];
+    s2[0] = t2[0] + t3[0];
+    s2[1] = t2[1] + t3[1];
+    s3[0] = t2[0] - t3[0];
+    s3[1] = t2[1] - t3[1];
+
+    a[0] = s0[0] + s2[0];
+    a[1] = s0[1] + s2[1];
+    F[0] = t0[0] + a[0];
+    F[1] = t0[1] + a[1];
+
+    // y1 = r1 - j i1, y4 = r1 + j i1
+    scale_q16(s0, MIXED_Q16_C72, a);
+    scale_q16(s2, MIXED_Q16_C144, b);
+    a[0] = a[0] + b[0];
+    a[1] = a[1] + b[1];
+    t1[0] = t0[0] + a[0];
+    t1[1] = t0[1] + a[1];
+    scale_q16(s1, MIXED_Q16_S72, a);
+    scale_q16(s3, MIXED_Q16_S144, b);
+    t4[0] = a[0] + b[0];
+    t4[1] = a[1] + b[1];
+    F[2 * m] = t1[0] + t4[1];
+    F[2 * m + 1] = t1[1] - t4[0];
+    F[8 * m] = t1[0] - t4[1];
+    F[8 * m + 1] = t1[1] + t4[0];
+
+    // y2 = r2 - j i2, y3 = r2 + j i2
+    scale_q16(s0, MIXED_Q16_C144, a);
+    scale_q16(s2, MIXED_Q16_C72, b);
+    a[0] = a[0] + b[0];
+    a[1] = a[1] + b[1];
+    t2[0] = t0[0] + a[0];
+    t2[1] = t0[1] + a[1];
+    scale_q16(s1, MIXED_Q16_S144, a);
+    scale_q16(s3, MIXED_Q16_S72, b);
+    t3[0] = a[0] - b[0];
+    t3[1] = a[1] - b[1];
+    F[4 * m] = t2[0] + t3[1];
+    F[4 * m + 1] = t2[1] - t3[0];
+    F[6 * m] = t2[0] - t3[1];
+    F[6 * m + 1] = t2[1] + t3[0];
+}
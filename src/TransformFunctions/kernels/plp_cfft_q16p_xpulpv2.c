@@ -0,0 +1,373 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_q16p_xpulpv2.c
+ * Description:  Parallel 16-bit fixed point Fast Fourier Transform on Complex Input Data
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Notice: project inspired by ARM CMSIS DSP and parts of source code
+ * ported and adopted for RISC-V PULP platform from ARM CMSIS DSP
+ * released under Copyright (C) 2010-2019 ARM Limited or its affiliates
+ * with Apache-2.0.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+static void plp_cfft_radix4by2_q16p(int16_t *pSrc,
+                                    uint32_t fftLen,
+                                    const int16_t *pCoef,
+                                    uint32_t nPE);
+
+static void plp_radix4_butterfly_q16p(int16_t *pSrc16,
+                                      uint32_t fftLen,
+                                      int16_t *pCoef16,
+                                      uint32_t twidCoefModifier,
+                                      uint32_t nPE);
+
+static inline void radix4_butterfly_first_q16(int16_t *pSrc16,
+                                              uint32_t i0,
+                                              uint32_t n2,
+                                              uint32_t ic,
+                                              int16_t *pCoef16);
+
+static inline void radix4_butterfly_middle_q16(int16_t *pSrc16,
+                                               uint32_t i0,
+                                               uint32_t n2,
+                                               uint32_t ic,
+                                               int16_t *pCoef16);
+
+static inline void radix4_butterfly_last_q16(int16_t *pSrc16, uint32_t i0);
+
+/**
+ * @brief      Parallel quantized 16 bit complex fast fourier transform for XPULPV2. The
+ * butterflies of each stage are distributed over the cores, the output is identical to the one of
+ * plp_cfft_q16s_xpulpv2.
+ * @param[in]  args  points to the plp_cfft_parallel_arg_q16 structure
+ */
+
+void plp_cfft_q16p_xpulpv2(void *args) {
+
+    plp_cfft_parallel_arg_q16 *arg = (plp_cfft_parallel_arg_q16 *)args;
+    const plp_cfft_instance_q16 *S = arg->S;
+    int16_t *p1 = arg->p1;
+    uint32_t nPE = arg->nPE;
+
+    uint32_t L = S->fftLen;
+
+    if (arg->ifftFlag == 0) {
+        switch (L) {
+        case 16:
+        case 64:
+        case 256:
+        case 1024:
+        case 4096:
+            plp_radix4_butterfly_q16p(p1, L, (int16_t *)S->pTwiddle, 1, nPE);
+            break;
+        case 32:
+        case 128:
+        case 512:
+        case 2048:
+            plp_cfft_radix4by2_q16p(p1, L, (int16_t *)S->pTwiddle, nPE);
+            break;
+        }
+    }
+
+    if (arg->bitReverseFlag) {
+        plp_bitreversal_nolut_parallel_arg bitrev = { p1, L, nPE };
+        plp_bitreversal_nolut_16p_xpulpv2(&bitrev);
+    }
+}
+
+/**
+ * @} end of FFT group
+ */
+
+void plp_cfft_radix4by2_q16p(int16_t *pSrc,
+                             uint32_t fftLen,
+                             const int16_t *pCoef,
+                             uint32_t nPE) {
+
+    uint32_t i, l;
+    uint32_t n2;
+    int16_t testa, testb;
+    v2s CoSi;
+    v2s a, b, t;
+
+    n2 = fftLen >> 1;
+
+    for (i = rt_core_id(); i < n2; i += nPE) {
+        CoSi = *(v2s *)&pCoef[i * 2];
+
+        l = i + n2;
+
+        a = __SRA2(*(v2s *)&pSrc[2 * i], ((v2s){ 1, 1 }));
+        b = __SRA2(*(v2s *)&pSrc[2 * l], ((v2s){ 1, 1 }));
+        t = __SUB2(a, b);
+        *((v2s *)&pSrc[i * 2]) = __SRA2(__ADD2(a, b), ((v2s){ 1, 1 }));
+
+        testa = (int16_t)(__DOTP2(t, CoSi) >> 16);
+        testb = (int16_t)(__DOTP2(t, __PACK2(-CoSi[1], CoSi[0])) >> 16);
+
+        *((v2s *)&pSrc[l * 2]) = __PACK2(testa, testb);
+    }
+
+    rt_team_barrier();
+
+    // first col
+    plp_radix4_butterfly_q16p(pSrc, n2, (int16_t *)pCoef, 2U, nPE);
+    // second col
+    plp_radix4_butterfly_q16p(pSrc + fftLen, n2, (int16_t *)pCoef, 2U, nPE);
+
+    for (i = rt_core_id(); i < fftLen; i += nPE) {
+        *((v2s *)&pSrc[2 * i]) = __SLL2(*(v2s *)&pSrc[2 * i], ((v2s){ 1, 1 }));
+    }
+
+    rt_team_barrier();
+}
+
+/*
+ * The stages are the same as in plp_cfft_q16s_xpulpv2. Each stage has fftLen/4 butterflies,
+ * butterfly b of a stage with distance n2 processes the group j = b % n2 of block b / n2. Both
+ * are powers of two, hence i0 = 4 * (b - j) + j. The cores synchronize after every stage.
+ */
+
+void plp_radix4_butterfly_q16p(int16_t *pSrc16,
+                               uint32_t fftLen,
+                               int16_t *pCoef16,
+                               uint32_t twidCoefModifier,
+                               uint32_t nPE) {
+
+    uint32_t n2, b, j, k;
+    uint32_t core_id = rt_core_id();
+    uint32_t nButterflies = fftLen >> 2U;
+
+    /* first stage, the input is down scaled by 4 to avoid overflow */
+    n2 = fftLen >> 2U;
+
+    for (b = core_id; b < nButterflies; b += nPE) {
+        radix4_butterfly_first_q16(pSrc16, b, n2, b * twidCoefModifier, pCoef16);
+    }
+
+    rt_team_barrier();
+
+    /* middle stages */
+    twidCoefModifier <<= 2U;
+
+    for (k = fftLen / 4U; k > 4U; k >>= 2U) {
+        n2 >>= 2U;
+
+        for (b = core_id; b < nButterflies; b += nPE) {
+            j = b & (n2 - 1U);
+            radix4_butterfly_middle_q16(pSrc16, ((b - j) << 2U) + j, n2, j * twidCoefModifier,
+                                        pCoef16);
+        }
+
+        twidCoefModifier <<= 2U;
+
+        rt_team_barrier();
+    }
+
+    /* last stage, the twiddle factors are all 1 */
+    for (b = core_id; b < nButterflies; b += nPE) {
+        radix4_butterfly_last_q16(pSrc16, b << 2U);
+    }
+
+    rt_team_barrier();
+}
+
+static inline void radix4_butterfly_first_q16(int16_t *pSrc16,
+                                              uint32_t i0,
+                                              uint32_t n2,
+                                              uint32_t ic,
+                                              int16_t *pCoef16) {
+    v2s R, S, T, U, V;
+    v2s CoSi1, CoSi2, CoSi3;
+    uint32_t i1, i2, i3;
+
+    i1 = i0 + n2;
+    i2 = i1 + n2;
+    i3 = i2 + n2;
+
+    /* input is down scale by 4 to avoid overflow */
+    T = __SRA2(*(v2s *)&pSrc16[i0 * 2U], ((v2s){ 2, 2 }));
+    S = __SRA2(*(v2s *)&pSrc16[i2 * 2U], ((v2s){ 2, 2 }));
+
+    /* R = (ya + yc), S = (ya - yc) */
+    R = __ADD2(T, S);
+    S = __SUB2(T, S);
+
+    T = __SRA2(*(v2s *)&pSrc16[i1 * 2U], ((v2s){ 2, 2 }));
+    U = __SRA2(*(v2s *)&pSrc16[i3 * 2U], ((v2s){ 2, 2 }));
+
+    /* V = (yb + yd) */
+    V = __ADD2(T, U);
+
+    /* ya' = ya + yb + yc + yd */
+    *((v2s *)&pSrc16[i0 * 2U]) = __ADD2(__SRA2(R, ((v2s){ 1, 1 })), __SRA2(V, ((v2s){ 1, 1 })));
+
+    /* R = (ya + yc) - (yb + yd) */
+    R = __SUB2(R, V);
+
+    CoSi2 = *(v2s *)&pCoef16[2U * ic * 2U];
+
+    /* xc' = (xa-xb+xc-xd)* co2 + (ya-yb+yc-yd)* (si2) */
+    /* yc' = (ya-yb+yc-yd)* co2 - (xa-xb+xc-xd)* (si2) */
+    *((v2s *)&pSrc16[i1 * 2U]) =
+        __PACK2((int16_t)(__DOTP2(CoSi2, R) >> 16U),
+                (int16_t)(__DOTP2(__PACK2(-CoSi2[1], CoSi2[0]), R) >> 16U));
+
+    /* T = yb - yd */
+    T = __SUB2(T, U);
+
+    R = __ADD2(S, __PACK2(-T[1], T[0]));
+    S = __ADD2(S, __PACK2(T[1], -T[0]));
+
+    CoSi1 = *(v2s *)&pCoef16[ic * 2U];
+
+    /* xb' = (xa+yb-xc-yd)* co1 + (ya-xb-yc+xd)* (si1) */
+    /* yb' = (ya-xb-yc+xd)* co1 - (xa+yb-xc-yd)* (si1) */
+    *((v2s *)&pSrc16[i2 * 2U]) =
+        __PACK2((int16_t)(__DOTP2(CoSi1, S) >> 16U),
+                (int16_t)(__DOTP2(__PACK2(-CoSi1[1], CoSi1[0]), S) >> 16U));
+
+    CoSi3 = *(v2s *)&pCoef16[3U * (ic * 2U)];
+
+    /* xd' = (xa-yb-xc+yd)* Co3 + (ya+xb-yc-xd)* (si3) */
+    /* yd' = (ya+xb-yc-xd)* Co3 - (xa-yb-xc+yd)* (si3) */
+    *((v2s *)&pSrc16[i3 * 2U]) =
+        __PACK2((int16_t)(__DOTP2(CoSi3, R) >> 16U),
+                (int16_t)(__DOTP2(__PACK2(-CoSi3[1], CoSi3[0]), R) >> 16U));
+}
+
+static inline void radix4_butterfly_middle_q16(int16_t *pSrc16,
+                                               uint32_t i0,
+                                               uint32_t n2,
+                                               uint32_t ic,
+                                               int16_t *pCoef16) {
+    v2s R, S, T, U, V;
+    v2s CoSi1, CoSi2, CoSi3;
+    uint32_t i1, i2, i3;
+
+    CoSi1 = *(v2s *)&pCoef16[ic * 2U];
+    CoSi2 = *(v2s *)&pCoef16[2U * (ic * 2U)];
+    CoSi3 = *(v2s *)&pCoef16[3U * (ic * 2U)];
+
+    i1 = i0 + n2;
+    i2 = i1 + n2;
+    i3 = i2 + n2;
+
+    T = *(v2s *)&pSrc16[i0 * 2U];
+    S = *(v2s *)&pSrc16[i2 * 2U];
+
+    /* R = (ya + yc), S = (ya - yc) */
+    R = __ADD2(T, S);
+    S = __SUB2(T, S);
+
+    T = *(v2s *)&pSrc16[i1 * 2U];
+    U = *(v2s *)&pSrc16[i3 * 2U];
+
+    /* V = (yb + yd) */
+    V = __ADD2(T, U);
+
+    /* xa' = xa + xb + xc + xd */
+    /* ya' = ya + yb + yc + yd */
+    *((v2s *)&pSrc16[i0 * 2U]) = __SRA2(
+        __ADD2(__SRA2(R, ((v2s){ 1, 1 })), __SRA2(V, ((v2s){ 1, 1 }))), ((v2s){ 1, 1 }));
+
+    /* R = (ya + yc) - (yb + yd) */
+    R = __SUB2(__SRA2(R, ((v2s){ 1, 1 })), __SRA2(V, ((v2s){ 1, 1 })));
+
+    /* xc' = (xa-xb+xc-xd)* co2 + (ya-yb+yc-yd)* (si2) */
+    /* yc' = (ya-yb+yc-yd)* co2 - (xa-xb+xc-xd)* (si2) */
+    *((v2s *)&pSrc16[i1 * 2U]) =
+        __PACK2((int16_t)(__DOTP2(CoSi2, R) >> 16U),
+                (int16_t)(__DOTP2(__PACK2(-CoSi2[1], CoSi2[0]), R) >> 16U));
+
+    /* T = yb - yd */
+    T = __SRA2(__SUB2(T, U), ((v2s){ 1, 1 }));
+
+    R = __ADD2(__SRA2(S, ((v2s){ 1, 1 })), __PACK2(-T[1], T[0]));
+    S = __ADD2(__SRA2(S, ((v2s){ 1, 1 })), __PACK2(T[1], -T[0]));
+
+    /* xb' = (xa+yb-xc-yd)* co1 + (ya-xb-yc+xd)* (si1) */
+    /* yb' = (ya-xb-yc+xd)* co1 - (xa+yb-xc-yd)* (si1) */
+    *((v2s *)&pSrc16[i2 * 2U]) =
+        __PACK2((int16_t)(__DOTP2(CoSi1, S) >> 16U),
+                (int16_t)(__DOTP2(__PACK2(-CoSi1[1], CoSi1[0]), S) >> 16U));
+
+    /* xd' = (xa-yb-xc+yd)* Co3 + (ya+xb-yc-xd)* (si3) */
+    /* yd' = (ya+xb-yc-xd)* Co3 - (xa-yb-xc+yd)* (si3) */
+    *((v2s *)&pSrc16[i3 * 2U]) =
+        __PACK2((int16_t)(__DOTP2(CoSi3, R) >> 16U),
+                (int16_t)(__DOTP2(__PACK2(-CoSi3[1], CoSi3[0]), R) >> 16U));
+}
+
+static inline void radix4_butterfly_last_q16(int16_t *pSrc16, uint32_t i0) {
+    v2s R, S, T, U;
+    uint32_t i1, i2, i3;
+
+    i1 = i0 + 1U;
+    i2 = i1 + 1U;
+    i3 = i2 + 1U;
+
+    T = *(v2s *)&pSrc16[i0 * 2U];
+    S = *(v2s *)&pSrc16[i2 * 2U];
+
+    /* R = (ya + yc), S = (ya - yc) */
+    R = __ADD2(T, S);
+    S = __SUB2(T, S);
+
+    T = *(v2s *)&pSrc16[i1 * 2U];
+    U = *(v2s *)&pSrc16[i3 * 2U];
+
+    /* xa' = xa + xb + xc + xd */
+    /* ya' = ya + yb + yc + yd */
+    *((v2s *)&pSrc16[i0 * 2U]) =
+        __ADD2(__SRA2(R, ((v2s){ 1, 1 })), __SRA2(__ADD2(T, U), ((v2s){ 1, 1 })));
+
+    /* xc' = (xa-xb+xc-xd) */
+    /* yc' = (ya-yb+yc-yd) */
+    *((v2s *)&pSrc16[i1 * 2U]) =
+        __SUB2(__SRA2(R, ((v2s){ 1, 1 })), __SRA2(__ADD2(T, U), ((v2s){ 1, 1 })));
+
+    /* T = (yb - yd) */
+    T = __SRA2(__SUB2(T, U), ((v2s){ 1, 1 }));
+    S = __SRA2(S, ((v2s){ 1, 1 }));
+
+    /* xb' = (xa+yb-xc-yd) */
+    /* yb' = (ya-xb-yc+xd) */
+    *((v2s *)&pSrc16[i2 * 2U]) = __ADD2(S, __PACK2(T[1], -T[0]));
+
+    /* xd' = (xa-yb-xc+yd) */
+    /* yd' = (ya+xb-yc-xd) */
+    *((v2s *)&pSrc16[i3 * 2U]) = __ADD2(S, __PACK2(-T[1], T[0]));
+}
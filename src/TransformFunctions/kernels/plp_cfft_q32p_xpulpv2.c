@@ -0,0 +1,313 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_q32p_xpulpv2.c
+ * Description:  Parallel 32-bit fixed point Fast Fourier Transform on Complex Input Data
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Notice: project inspired by ARM CMSIS DSP and parts of source code
+ * ported and adopted for RISC-V PULP platform from ARM CMSIS DSP
+ * released under Copyright (C) 2010-2019 ARM Limited or its affiliates
+ * with Apache-2.0.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+static void plp_cfft_radix4by2_q32p(int32_t *pSrc,
+                                    uint32_t fftLen,
+                                    const int32_t *pCoef,
+                                    uint32_t nPE);
+
+static void plp_radix4_butterfly_q32p(int32_t *pSrc,
+                                      uint32_t fftLen,
+                                      const int32_t *pCoef,
+                                      uint32_t twidCoefModifier,
+                                      uint32_t nPE);
+
+static inline void radix4_butterfly_q32(int32_t *pSrc,
+                                        uint32_t i0,
+                                        uint32_t n2,
+                                        uint32_t ia1,
+                                        const int32_t *pCoef,
+                                        uint32_t firstStage);
+
+/* upper 32 bits of the 64 bit product, i.e. a single mulh instruction */
+#define MULH_Q32(a, b) ((int32_t)(((int64_t)(a) * (b)) >> 32))
+
+/**
+ * @brief      Parallel quantized 32 bit complex fast fourier transform for XPULPV2. The
+ * butterflies of each stage are distributed over the cores, the output is identical to the one of
+ * plp_cfft_q32s_rv32im.
+ * @param[in]  args  points to the plp_cfft_parallel_arg_q32 structure
+ */
+
+void plp_cfft_q32p_xpulpv2(void *args) {
+
+    plp_cfft_parallel_arg_q32 *arg = (plp_cfft_parallel_arg_q32 *)args;
+    const plp_cfft_instance_q32 *S = arg->S;
+    int32_t *p1 = arg->p1;
+    uint32_t nPE = arg->nPE;
+
+    uint32_t L = S->fftLen;
+
+    if (arg->ifftFlag == 0) {
+        switch (L) {
+        case 16:
+        case 64:
+        case 256:
+        case 1024:
+        case 4096:
+            plp_radix4_butterfly_q32p(p1, L, S->pTwiddle, 1, nPE);
+            break;
+        case 32:
+        case 128:
+        case 512:
+        case 2048:
+            plp_cfft_radix4by2_q32p(p1, L, S->pTwiddle, nPE);
+            break;
+        }
+    }
+
+    if (arg->bitReverseFlag) {
+        plp_bitreversal_nolut_parallel_arg bitrev = { p1, L, nPE };
+        plp_bitreversal_nolut_32p_xpulpv2(&bitrev);
+    }
+}
+
+/**
+ * @} end of FFT group
+ */
+
+void plp_cfft_radix4by2_q32p(int32_t *pSrc,
+                             uint32_t fftLen,
+                             const int32_t *pCoef,
+                             uint32_t nPE) {
+
+    uint32_t i, l;
+    uint32_t n2;
+    int32_t xt, yt, cosVal, sinVal;
+
+    n2 = fftLen >> 1;
+
+    for (i = rt_core_id(); i < n2; i += nPE) {
+        cosVal = pCoef[2 * i];
+        sinVal = pCoef[2 * i + 1];
+
+        l = i + n2;
+
+        xt = (pSrc[2 * i] >> 2) - (pSrc[2 * l] >> 2);
+        pSrc[2 * i] = (pSrc[2 * i] >> 2) + (pSrc[2 * l] >> 2);
+
+        yt = (pSrc[2 * i + 1] >> 2) - (pSrc[2 * l + 1] >> 2);
+        pSrc[2 * i + 1] = (pSrc[2 * l + 1] >> 2) + (pSrc[2 * i + 1] >> 2);
+
+        pSrc[2 * l] = (MULH_Q32(xt, cosVal) + MULH_Q32(yt, sinVal)) << 1;
+        pSrc[2 * l + 1] = (MULH_Q32(yt, cosVal) - MULH_Q32(xt, sinVal)) << 1;
+    }
+
+    rt_team_barrier();
+
+    // first col
+    plp_radix4_butterfly_q32p(pSrc, n2, pCoef, 2U, nPE);
+    // second col
+    plp_radix4_butterfly_q32p(pSrc + fftLen, n2, pCoef, 2U, nPE);
+
+    for (i = rt_core_id(); i < fftLen; i += nPE) {
+        pSrc[2 * i] = pSrc[2 * i] << 1;
+        pSrc[2 * i + 1] = pSrc[2 * i + 1] << 1;
+    }
+
+    rt_team_barrier();
+}
+
+/*
+ * The stages are the same as in plp_cfft_q32s_rv32im. Each stage has fftLen/4 butterflies,
+ * butterfly b of a stage with distance n2 processes the group j = b % n2 of block b / n2. Both
+ * are powers of two, hence i0 = 4 * (b - j) + j. The cores synchronize after every stage.
+ */
+
+void plp_radix4_butterfly_q32p(int32_t *pSrc,
+                               uint32_t fftLen,
+                               const int32_t *pCoef,
+                               uint32_t twidCoefModifier,
+                               uint32_t nPE) {
+
+    uint32_t n2, b, j, k;
+    uint32_t core_id = rt_core_id();
+    uint32_t nButterflies = fftLen >> 2U;
+
+    /* first stage, provides 4 guard bits for the input */
+    n2 = fftLen >> 2U;
+
+    for (b = core_id; b < nButterflies; b += nPE) {
+        radix4_butterfly_q32(pSrc, b, n2, b * twidCoefModifier, pCoef, 1);
+    }
+
+    rt_team_barrier();
+
+    /* middle stages, each stage scales down by 4 */
+    twidCoefModifier <<= 2U;
+
+    for (k = fftLen / 4U; k > 4U; k >>= 2U) {
+        n2 >>= 2U;
+
+        for (b = core_id; b < nButterflies; b += nPE) {
+            j = b & (n2 - 1U);
+            radix4_butterfly_q32(pSrc, ((b - j) << 2U) + j, n2, j * twidCoefModifier, pCoef, 0);
+        }
+
+        twidCoefModifier <<= 2U;
+
+        rt_team_barrier();
+    }
+
+    /* last stage, the twiddle factors are all 1 */
+    for (b = core_id; b < nButterflies; b += nPE) {
+        int32_t *ptr = pSrc + 8U * b;
+
+        int32_t xa = ptr[0];
+        int32_t ya = ptr[1];
+        int32_t xb = ptr[2];
+        int32_t yb = ptr[3];
+        int32_t xc = ptr[4];
+        int32_t yc = ptr[5];
+        int32_t xd = ptr[6];
+        int32_t yd = ptr[7];
+
+        ptr[0] = xa + xb + xc + xd;
+        ptr[1] = ya + yb + yc + yd;
+        ptr[2] = xa - xb + xc - xd;
+        ptr[3] = ya - yb + yc - yd;
+        ptr[4] = xa + yb - xc - yd;
+        ptr[5] = ya - xb - yc + xd;
+        ptr[6] = xa - yb - xc + yd;
+        ptr[7] = ya + xb - yc - xd;
+    }
+
+    rt_team_barrier();
+}
+
+/* radix-4 butterfly of the first or of a middle stage, see plp_cfft_q32s_rv32im. The first stage
+ * scales the input down by 16, the middle stages scale the output down by 4. */
+static inline void radix4_butterfly_q32(int32_t *pSrc,
+                                        uint32_t i0,
+                                        uint32_t n2,
+                                        uint32_t ia1,
+                                        const int32_t *pCoef,
+                                        uint32_t firstStage) {
+
+    int32_t t1, t2, r1, r2, s1, s2, co1, co2, co3, si1, si2, si3;
+    int32_t xa, xb, xc, xd;
+    int32_t ya, yb, yc, yd;
+    uint32_t i1, i2, i3, ia2, ia3;
+    uint32_t inShift = firstStage ? 4U : 0U;
+
+    i1 = i0 + n2;
+    i2 = i1 + n2;
+    i3 = i2 + n2;
+
+    ia2 = ia1 + ia1;
+    ia3 = ia2 + ia1;
+    co1 = pCoef[ia1 * 2U];
+    si1 = pCoef[ia1 * 2U + 1U];
+    co2 = pCoef[ia2 * 2U];
+    si2 = pCoef[ia2 * 2U + 1U];
+    co3 = pCoef[ia3 * 2U];
+    si3 = pCoef[ia3 * 2U + 1U];
+
+    xa = pSrc[2U * i0] >> inShift;
+    ya = pSrc[2U * i0 + 1U] >> inShift;
+    xb = pSrc[2U * i1] >> inShift;
+    yb = pSrc[2U * i1 + 1U] >> inShift;
+    xc = pSrc[2U * i2] >> inShift;
+    yc = pSrc[2U * i2 + 1U] >> inShift;
+    xd = pSrc[2U * i3] >> inShift;
+    yd = pSrc[2U * i3 + 1U] >> inShift;
+
+    r1 = xa + xc;
+    r2 = xa - xc;
+    t1 = xb + xd;
+    s1 = ya + yc;
+    s2 = ya - yc;
+    t2 = yb + yd;
+
+    /* xa' = xa + xb + xc + xd */
+    /* ya' = ya + yb + yc + yd */
+    if (firstStage) {
+        pSrc[2U * i0] = r1 + t1;
+        pSrc[2U * i0 + 1U] = s1 + t2;
+    } else {
+        pSrc[2U * i0] = (r1 + t1) >> 2U;
+        pSrc[2U * i0 + 1U] = (s1 + t2) >> 2U;
+    }
+
+    r1 = r1 - t1;
+    s1 = s1 - t2;
+    t1 = yb - yd;
+    t2 = xb - xd;
+
+    /* xc' = (xa-xb+xc-xd)co2 + (ya-yb+yc-yd)(si2) */
+    /* yc' = (ya-yb+yc-yd)co2 - (xa-xb+xc-xd)(si2) */
+    xc = MULH_Q32(r1, co2) + MULH_Q32(s1, si2);
+    yc = MULH_Q32(s1, co2) - MULH_Q32(r1, si2);
+
+    r1 = r2 + t1;
+    r2 = r2 - t1;
+    s1 = s2 - t2;
+    s2 = s2 + t2;
+
+    /* xb' = (xa+yb-xc-yd)co1 + (ya-xb-yc+xd)(si1) */
+    /* yb' = (ya-xb-yc+xd)co1 - (xa+yb-xc-yd)(si1) */
+    xb = MULH_Q32(r1, co1) + MULH_Q32(s1, si1);
+    yb = MULH_Q32(s1, co1) - MULH_Q32(r1, si1);
+
+    /* xd' = (xa-yb-xc+yd)co3 + (ya+xb-yc-xd)(si3) */
+    /* yd' = (ya+xb-yc-xd)co3 - (xa-yb-xc+yd)(si3) */
+    xd = MULH_Q32(r2, co3) + MULH_Q32(s2, si3);
+    yd = MULH_Q32(s2, co3) - MULH_Q32(r2, si3);
+
+    if (firstStage) {
+        pSrc[2U * i1] = xc << 1U;
+        pSrc[2U * i1 + 1U] = yc << 1U;
+        pSrc[2U * i2] = xb << 1U;
+        pSrc[2U * i2 + 1U] = yb << 1U;
+        pSrc[2U * i3] = xd << 1U;
+        pSrc[2U * i3 + 1U] = yd << 1U;
+    } else {
+        pSrc[2U * i1] = xc >> 1U;
+        pSrc[2U * i1 + 1U] = yc >> 1U;
+        pSrc[2U * i2] = xb >> 1U;
+        pSrc[2U * i2 + 1U] = yb >> 1U;
+        pSrc[2U * i3] = xd >> 1U;
+        pSrc[2U * i3 + 1U] = yd >> 1U;
+    }
+}
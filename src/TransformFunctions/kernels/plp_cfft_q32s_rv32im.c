@@ -0,0 +1,373 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_q32s_rv32im.c
+ * Description:  32-bit fixed point Fast Fourier Transform on Complex Input Data
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Notice: project inspired by ARM CMSIS DSP and parts of source code
+ * ported and adopted for RISC-V PULP platform from ARM CMSIS DSP
+ * released under Copyright (C) 2010-2019 ARM Limited or its affiliates
+ * with Apache-2.0.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+static void plp_cfft_radix4by2_q32(int32_t *pSrc, uint32_t fftLen, const int32_t *pCoef);
+
+static void plp_radix4_butterfly_q32(int32_t *pSrc,
+                                     uint32_t fftLen,
+                                     const int32_t *pCoef,
+                                     uint32_t twidCoefModifier);
+
+/* upper 32 bits of the 64 bit product, i.e. a single mulh instruction */
+#define MULH_Q32(a, b) ((int32_t)(((int64_t)(a) * (b)) >> 32))
+
+void plp_cfft_q32s_rv32im(const plp_cfft_instance_q32 *S,
+                          int32_t *p1,
+                          uint8_t ifftFlag,
+                          uint8_t bitReverseFlag,
+                          uint32_t deciPoint) {
+
+    uint32_t L = S->fftLen;
+
+    if (ifftFlag == 0) {
+        switch (L) {
+        case 16:
+        case 64:
+        case 256:
+        case 1024:
+        case 4096:
+            plp_radix4_butterfly_q32(p1, L, S->pTwiddle, 1);
+            break;
+        case 32:
+        case 128:
+        case 512:
+        case 2048:
+            plp_cfft_radix4by2_q32(p1, L, S->pTwiddle);
+            break;
+        }
+    }
+
+    if (bitReverseFlag)
+        plp_bitreversal_nolut_32s_rv32im((uint32_t *)p1, L);
+}
+
+void plp_cfft_radix4by2_q32(int32_t *pSrc, uint32_t fftLen, const int32_t *pCoef) {
+
+    uint32_t i, l;
+    uint32_t n2;
+    int32_t xt, yt, cosVal, sinVal;
+    int32_t p0, p1, p2, p3;
+
+    n2 = fftLen >> 1;
+
+    for (i = 0; i < n2; i++) {
+        cosVal = pCoef[2 * i];
+        sinVal = pCoef[2 * i + 1];
+
+        l = i + n2;
+
+        xt = (pSrc[2 * i] >> 2) - (pSrc[2 * l] >> 2);
+        pSrc[2 * i] = (pSrc[2 * i] >> 2) + (pSrc[2 * l] >> 2);
+
+        yt = (pSrc[2 * i + 1] >> 2) - (pSrc[2 * l + 1] >> 2);
+        pSrc[2 * i + 1] = (pSrc[2 * l + 1] >> 2) + (pSrc[2 * i + 1] >> 2);
+
+        pSrc[2 * l] = (MULH_Q32(xt, cosVal) + MULH_Q32(yt, sinVal)) << 1;
+        pSrc[2 * l + 1] = (MULH_Q32(yt, cosVal) - MULH_Q32(xt, sinVal)) << 1;
+    }
+
+    // first col
+    plp_radix4_butterfly_q32(pSrc, n2, pCoef, 2U);
+    // second col
+    plp_radix4_butterfly_q32(pSrc + fftLen, n2, pCoef, 2U);
+
+    for (i = 0; i < n2; i++) {
+        p0 = pSrc[4 * i + 0];
+        p1 = pSrc[4 * i + 1];
+        p2 = pSrc[4 * i + 2];
+        p3 = pSrc[4 * i + 3];
+
+        pSrc[4 * i + 0] = p0 << 1;
+        pSrc[4 * i + 1] = p1 << 1;
+        pSrc[4 * i + 2] = p2 << 1;
+        pSrc[4 * i + 3] = p3 << 1;
+    }
+}
+
+/*
+ * Radix-4 FFT algorithm used is :
+ *
+ * The real and imaginary output values for the radix-4 butterfly are
+ * xa' = xa + xb + xc + xd
+ * ya' = ya + yb + yc + yd
+ * xb' = (xa+yb-xc-yd)* co1 + (ya-xb-yc+xd)* (si1)
+ * yb' = (ya-xb-yc+xd)* co1 - (xa+yb-xc-yd)* (si1)
+ * xc' = (xa-xb+xc-xd)* co2 + (ya-yb+yc-yd)* (si2)
+ * yc' = (ya-yb+yc-yd)* co2 - (xa-xb+xc-xd)* (si2)
+ * xd' = (xa-yb-xc+yd)* co3 + (ya+xb-yc-xd)* (si3)
+ * yd' = (ya+xb-yc-xd)* co3 - (xa-yb-xc+yd)* (si3)
+ *
+ * The input is scaled down by 16 in the first stage and by 4 in every following stage, except
+ * the last one. The products with the twiddle factors are computed with mulh, which keeps the
+ * upper 32 bits of the Q1.31 x Q1.31 product, i.e. an additional scaling of 1/2.
+ */
+
+/**
+ * @brief  Core function for the Q31 CFFT butterfly process.
+ * @param[in, out] *pSrc            points to the in-place buffer of Q31 data type.
+ * @param[in]      fftLen           length of the FFT.
+ * @param[in]      *pCoef           points to twiddle coefficient buffer.
+ * @param[in]      twidCoefModifier twiddle coefficient modifier that supports different size FFTs
+ * with the same twiddle factor table.
+ * @return none.
+ */
+
+void plp_radix4_butterfly_q32(int32_t *pSrc,
+                              uint32_t fftLen,
+                              const int32_t *pCoef,
+                              uint32_t twidCoefModifier) {
+
+    uint32_t n1, n2, ia1, ia2, ia3, i0, i1, i2, i3, j, k;
+    int32_t t1, t2, r1, r2, s1, s2, co1, co2, co3, si1, si2, si3;
+    int32_t xa, xb, xc, xd;
+    int32_t ya, yb, yc, yd;
+
+    /* start of first stage process */
+    n2 = fftLen;
+    n1 = n2;
+    n2 >>= 2U;
+    ia1 = 0U;
+
+    for (i0 = 0; i0 < n2; i0++) {
+        i1 = i0 + n2;
+        i2 = i1 + n2;
+        i3 = i2 + n2;
+
+        /* input is in 1.31(q31) format and provide 4 guard bits for the input */
+        xa = pSrc[2U * i0] >> 4U;
+        ya = pSrc[2U * i0 + 1U] >> 4U;
+        xb = pSrc[2U * i1] >> 4U;
+        yb = pSrc[2U * i1 + 1U] >> 4U;
+        xc = pSrc[2U * i2] >> 4U;
+        yc = pSrc[2U * i2 + 1U] >> 4U;
+        xd = pSrc[2U * i3] >> 4U;
+        yd = pSrc[2U * i3 + 1U] >> 4U;
+
+        /* xa + xc, xa - xc, ya + yc, ya - yc */
+        r1 = xa + xc;
+        r2 = xa - xc;
+        s1 = ya + yc;
+        s2 = ya - yc;
+
+        /* (xb + xd), (yb + yd) */
+        t1 = xb + xd;
+        t2 = yb + yd;
+
+        /* xa' = xa + xb + xc + xd */
+        /* ya' = ya + yb + yc + yd */
+        pSrc[2U * i0] = r1 + t1;
+        pSrc[2U * i0 + 1U] = s1 + t2;
+
+        /* (xa + xc) - (xb + xd), (ya + yc) - (yb + yd) */
+        r1 = r1 - t1;
+        s1 = s1 - t2;
+
+        /* (yb - yd), (xb - xd) */
+        t1 = yb - yd;
+        t2 = xb - xd;
+
+        ia2 = 2U * ia1;
+        co2 = pCoef[ia2 * 2U];
+        si2 = pCoef[ia2 * 2U + 1U];
+
+        /* xc' = (xa-xb+xc-xd)co2 + (ya-yb+yc-yd)(si2) */
+        /* yc' = (ya-yb+yc-yd)co2 - (xa-xb+xc-xd)(si2) */
+        pSrc[2U * i1] = (MULH_Q32(r1, co2) + MULH_Q32(s1, si2)) << 1U;
+        pSrc[2U * i1 + 1U] = (MULH_Q32(s1, co2) - MULH_Q32(r1, si2)) << 1U;
+
+        /* (xa - xc) + (yb - yd), (xa - xc) - (yb - yd) */
+        r1 = r2 + t1;
+        r2 = r2 - t1;
+
+        /* (ya - yc) - (xb - xd), (ya - yc) + (xb - xd) */
+        s1 = s2 - t2;
+        s2 = s2 + t2;
+
+        co1 = pCoef[ia1 * 2U];
+        si1 = pCoef[ia1 * 2U + 1U];
+
+        /* xb' = (xa+yb-xc-yd)co1 + (ya-xb-yc+xd)(si1) */
+        /* yb' = (ya-xb-yc+xd)co1 - (xa+yb-xc-yd)(si1) */
+        pSrc[2U * i2] = (MULH_Q32(r1, co1) + MULH_Q32(s1, si1)) << 1U;
+        pSrc[2U * i2 + 1U] = (MULH_Q32(s1, co1) - MULH_Q32(r1, si1)) << 1U;
+
+        ia3 = 3U * ia1;
+        co3 = pCoef[ia3 * 2U];
+        si3 = pCoef[ia3 * 2U + 1U];
+
+        /* xd' = (xa-yb-xc+yd)co3 + (ya+xb-yc-xd)(si3) */
+        /* yd' = (ya+xb-yc-xd)co3 - (xa-yb-xc+yd)(si3) */
+        pSrc[2U * i3] = (MULH_Q32(r2, co3) + MULH_Q32(s2, si3)) << 1U;
+        pSrc[2U * i3 + 1U] = (MULH_Q32(s2, co3) - MULH_Q32(r2, si3)) << 1U;
+
+        /*  Twiddle coefficients index modifier */
+        ia1 = ia1 + twidCoefModifier;
+    }
+    /* data is in 5.27(q27) format */
+
+    /* end of first stage process */
+
+    /* start of middle stage process */
+
+    /*  Twiddle coefficients index modifier */
+    twidCoefModifier <<= 2U;
+
+    for (k = fftLen / 4U; k > 4U; k >>= 2U) {
+        /*  Initializations for the middle stage */
+        n1 = n2;
+        n2 >>= 2U;
+        ia1 = 0U;
+
+        for (j = 0U; j <= (n2 - 1U); j++) {
+            /*  index calculation for the coefficients */
+            ia2 = ia1 + ia1;
+            ia3 = ia2 + ia1;
+            co1 = pCoef[ia1 * 2U];
+            si1 = pCoef[ia1 * 2U + 1U];
+            co2 = pCoef[ia2 * 2U];
+            si2 = pCoef[ia2 * 2U + 1U];
+            co3 = pCoef[ia3 * 2U];
+            si3 = pCoef[ia3 * 2U + 1U];
+
+            /*  Twiddle coefficients index modifier */
+            ia1 = ia1 + twidCoefModifier;
+
+            for (i0 = j; i0 < fftLen; i0 += n1) {
+                i1 = i0 + n2;
+                i2 = i1 + n2;
+                i3 = i2 + n2;
+
+                xa = pSrc[2U * i0];
+                ya = pSrc[2U * i0 + 1U];
+                xb = pSrc[2U * i1];
+                yb = pSrc[2U * i1 + 1U];
+                xc = pSrc[2U * i2];
+                yc = pSrc[2U * i2 + 1U];
+                xd = pSrc[2U * i3];
+                yd = pSrc[2U * i3 + 1U];
+
+                r1 = xa + xc;
+                r2 = xa - xc;
+                t1 = xb + xd;
+                s1 = ya + yc;
+                s2 = ya - yc;
+                t2 = yb + yd;
+
+                /* xa' = xa + xb + xc + xd */
+                /* ya' = ya + yb + yc + yd */
+                pSrc[2U * i0] = (r1 + t1) >> 2U;
+                pSrc[2U * i0 + 1U] = (s1 + t2) >> 2U;
+
+                r1 = r1 - t1;
+                s1 = s1 - t2;
+                t1 = yb - yd;
+                t2 = xb - xd;
+
+                /* xc' = (xa-xb+xc-xd)co2 + (ya-yb+yc-yd)(si2) */
+                /* yc' = (ya-yb+yc-yd)co2 - (xa-xb+xc-xd)(si2) */
+                pSrc[2U * i1] = (MULH_Q32(r1, co2) + MULH_Q32(s1, si2)) >> 1U;
+                pSrc[2U * i1 + 1U] = (MULH_Q32(s1, co2) - MULH_Q32(r1, si2)) >> 1U;
+
+                r1 = r2 + t1;
+                r2 = r2 - t1;
+                s1 = s2 - t2;
+                s2 = s2 + t2;
+
+                /* xb' = (xa+yb-xc-yd)co1 + (ya-xb-yc+xd)(si1) */
+                /* yb' = (ya-xb-yc+xd)co1 - (xa+yb-xc-yd)(si1) */
+                pSrc[2U * i2] = (MULH_Q32(r1, co1) + MULH_Q32(s1, si1)) >> 1U;
+                pSrc[2U * i2 + 1U] = (MULH_Q32(s1, co1) - MULH_Q32(r1, si1)) >> 1U;
+
+                /* xd' = (xa-yb-xc+yd)co3 + (ya+xb-yc-xd)(si3) */
+                /* yd' = (ya+xb-yc-xd)co3 - (xa-yb-xc+yd)(si3) */
+                pSrc[2U * i3] = (MULH_Q32(r2, co3) + MULH_Q32(s2, si3)) >> 1U;
+                pSrc[2U * i3 + 1U] = (MULH_Q32(s2, co3) - MULH_Q32(r2, si3)) >> 1U;
+            }
+        }
+        /*  Twiddle coefficients index modifier */
+        twidCoefModifier <<= 2U;
+    }
+    /* end of middle stage process */
+
+    /* start of last stage process, the twiddle factors are all 1 */
+    for (i0 = 0U; i0 < fftLen; i0 += 4U) {
+        xa = pSrc[2U * i0];
+        ya = pSrc[2U * i0 + 1U];
+        xb = pSrc[2U * i0 + 2U];
+        yb = pSrc[2U * i0 + 3U];
+        xc = pSrc[2U * i0 + 4U];
+        yc = pSrc[2U * i0 + 5U];
+        xd = pSrc[2U * i0 + 6U];
+        yd = pSrc[2U * i0 + 7U];
+
+        /* xa' = xa + xb + xc + xd */
+        /* ya' = ya + yb + yc + yd */
+        pSrc[2U * i0] = xa + xb + xc + xd;
+        pSrc[2U * i0 + 1U] = ya + yb + yc + yd;
+
+        /* xc' = (xa-xb+xc-xd) */
+        /* yc' = (ya-yb+yc-yd) */
+        pSrc[2U * i0 + 2U] = xa - xb + xc - xd;
+        pSrc[2U * i0 + 3U] = ya - yb + yc - yd;
+
+        /* xb' = (xa+yb-xc-yd) */
+        /* yb' = (ya-xb-yc+xd) */
+        pSrc[2U * i0 + 4U] = xa + yb - xc - yd;
+        pSrc[2U * i0 + 5U] = ya - xb - yc + xd;
+
+        /* xd' = (xa-yb-xc+yd) */
+        /* yd' = (ya+xb-yc-xd) */
+        pSrc[2U * i0 + 6U] = xa - yb - xc + yd;
+        pSrc[2U * i0 + 7U] = ya + xb - yc - xd;
+    }
+
+    /* output is in 11.21(q21) format for the 1024 point */
+    /* output is in 9.23(q23) format for the 256 point */
+    /* output is in 7.25(q25) format for the 64 point */
+    /* output is in 5.27(q27) format for the 16 point */
+}
+
+/**
+ * @} end of FFT group
+ */
@@ -0,0 +1,176 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_csd_welch_f32p_xpulpv2.c
+ * Description:  Parallel floating-point Welch cross-spectral density for XPULPV2
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+#include "plp_rfft_f32_butterflies.h"
+
+/* HELPER FUNCTIONS */
+static void plp_csd_welch_frame_f32(const plp_rfft_instance_f32 *S,
+                                    const float32_t *pWin,
+                                    const float32_t *pSrcA,
+                                    const float32_t *pSrcB,
+                                    Complex_type_f32 *pBuf,
+                                    Complex_type_f32 *pAcc);
+static inline void process_split(Complex_type_f32 A,
+                                 Complex_type_f32 B,
+                                 Complex_type_f32 tw,
+                                 Complex_type_f32 *outA,
+                                 Complex_type_f32 *outB);
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup welch
+  @{
+ */
+
+/**
+   @brief  Parallel floating-point Welch cross-spectral density for XPULPV2. The frames are
+   distributed over the cores, each core accumulates its frames in its own buffer. The partial
+   sums are added at the end.
+   @param[in]   args    points to the plp_csd_welch_parallel_arg_f32 structure
+   @return      none
+*/
+void plp_csd_welch_f32p_xpulpv2(void *args) {
+
+    plp_csd_welch_parallel_arg_f32 *arg = (plp_csd_welch_parallel_arg_f32 *)args;
+    const plp_welch_instance_f32 *S = arg->S;
+    const float32_t *pSrcA = arg->pSrcA;
+    const float32_t *pSrcB = arg->pSrcB;
+    uint32_t numFrames = arg->numFrames;
+    uint32_t nPE = arg->nPE;
+    float32_t *pBuf = arg->pBuf;
+    float32_t *pDst = arg->pDst;
+
+    uint32_t f, k, c;
+    uint32_t core_id = rt_core_id();
+
+    uint32_t N = S->pRfft->FFTLength;
+    uint32_t hop = S->hopLen;
+    uint32_t numVals = N + 2; // N/2+1 complex values
+    float32_t scale = S->scale / (float32_t)numFrames;
+    float32_t *pPartial = pBuf + 2 * nPE * N; // accumulators of the cores 1 .. nPE-1
+    float32_t *pAcc = (core_id == 0) ? pDst : pPartial + (core_id - 1) * numVals;
+    float32_t sum;
+
+    for (k = 0; k < numVals; k++) {
+        pAcc[k] = 0.0f;
+    }
+
+    for (f = core_id; f < numFrames; f += nPE) {
+        plp_csd_welch_frame_f32(S->pRfft, S->pWindow, pSrcA + f * hop, pSrcB + f * hop,
+                                (Complex_type_f32 *)(pBuf + 2 * core_id * N),
+                                (Complex_type_f32 *)pAcc);
+    }
+
+    rt_team_barrier();
+
+    // MERGE, the partial sums of the cores are added value by value
+    for (k = core_id; k < numVals; k += nPE) {
+        sum = pDst[k];
+        for (c = 1; c < nPE; c++) {
+            sum += pPartial[(c - 1) * numVals + k];
+        }
+        pDst[k] = scale * sum;
+    }
+
+    rt_team_barrier();
+}
+
+/**
+   @} end of welch group
+*/
+
+/* Accumulates the cross spectrum X[k] conj(Y[k]) of one windowed frame of both inputs to pAcc.
+ * pBuf holds the packed FFTs of both frames. */
+static void plp_csd_welch_frame_f32(const plp_rfft_instance_f32 *S,
+                                    const float32_t *pWin,
+                                    const float32_t *pSrcA,
+                                    const float32_t *pSrcB,
+                                    Complex_type_f32 *pBuf,
+                                    Complex_type_f32 *pAcc) {
+
+    int k, ia, ib;
+    int nfft = S->FFTLength >> 1;
+    int log2FFTLen = 31 - __builtin_clz(nfft);
+    const Complex_type_f32 *_tw_ptr = (const Complex_type_f32 *)S->pTwiddleFactors;
+    Complex_type_f32 *pBufB = pBuf + nfft;
+    Complex_type_f32 xa, xb, ya, yb;
+
+    process_windowed_fft(pWin, NULL, 0, pSrcA, pBuf, nfft, _tw_ptr);
+    process_windowed_fft(pWin, NULL, 0, pSrcB, pBufB, nfft, _tw_ptr);
+
+    // SPLIT STAGE, reads the packed FFTs in bit-reversed order and accumulates the cross spectrum
+    Complex_type_f32 x0 = pBuf[0];
+    Complex_type_f32 y0 = pBufB[0];
+    pAcc[0].re += (x0.re + x0.im) * (y0.re + y0.im);
+    pAcc[nfft].re += (x0.re - x0.im) * (y0.re - y0.im);
+
+    for (k = 1; k <= (nfft >> 1); k++) {
+        ia = bit_rev_half(k, log2FFTLen);
+        ib = bit_rev_half(nfft - k, log2FFTLen);
+        process_split(pBuf[ia], pBuf[ib], _tw_ptr[k], &xa, &xb);
+        process_split(pBufB[ia], pBufB[ib], _tw_ptr[k], &ya, &yb);
+
+        // X[k] conj(Y[k])
+        pAcc[k].re += xa.re * ya.re + xa.im * ya.im;
+        pAcc[k].im += xa.im * ya.re - xa.re * ya.im;
+
+        // X[N/2-k] conj(Y[N/2-k]) = conj(xb conj(yb)), X[N/4] is accumulated only once
+        if (k < nfft - k) {
+            pAcc[nfft - k].re += xb.re * yb.re + xb.im * yb.im;
+            pAcc[nfft - k].im += xb.re * yb.im - xb.im * yb.re;
+        }
+    } // k
+}
+
+/* Split stage of the real FFT, X[k] is written to outA and conj(X[N/2-k]) to outB */
+static inline void process_split(Complex_type_f32 A,
+                                 Complex_type_f32 B,
+                                 Complex_type_f32 tw,
+                                 Complex_type_f32 *outA,
+                                 Complex_type_f32 *outB) {
+
+    Complex_type_f32 even, odd, t;
+
+    // even = (A + conj(B)) / 2, odd = (A - conj(B)) / 2j
+    even.re = 0.5f * (A.re + B.re);
+    even.im = 0.5f * (A.im - B.im);
+    odd.re = 0.5f * (A.im + B.im);
+    odd.im = 0.5f * (B.re - A.re);
+
+    t = complex_mul(tw, odd);
+
+    outA->re = even.re + t.re;
+    outA->im = even.im + t.im;
+    outB->re = even.re - t.re;
+    outB->im = even.im - t.im;
+}
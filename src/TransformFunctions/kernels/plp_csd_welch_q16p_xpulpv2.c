@@ -0,0 +1,203 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_csd_welch_q16p_xpulpv2.c
+ * Description:  Parallel 16-bit fixed point Welch cross-spectral density for XPULPV2
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/* HELPER FUNCTIONS */
+static void plp_csd_welch_frame_q16(const plp_rfft_instance_q16 *S,
+                                    const int16_t *pWin,
+                                    const int16_t *pSrcA,
+                                    const int16_t *pSrcB,
+                                    uint32_t deciPoint,
+                                    uint32_t shift,
+                                    v2s *pBuf,
+                                    int32_t *pAcc);
+static void plp_welch_fft_q16(const plp_rfft_instance_q16 *S,
+                              const int16_t *pWin,
+                              const int16_t *pSrc,
+                              uint32_t deciPoint,
+                              v2s *pBuf);
+static inline int16_t plp_welch_load_q16(const int16_t *pWin, const int16_t *pSrc, int i);
+static inline void plp_welch_split_q16(v2s A, v2s B, v2s CoSi, v2s *outA, v2s *outB);
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup welch
+  @{
+ */
+
+/**
+   @brief  Parallel 16 bit fixed-point Welch cross-spectral density for XPULPV2. The frames are
+   distributed over the cores, each core accumulates its frames in its own buffer. The partial
+   sums are added at the end, the output is identical to the one of the serial version.
+   @param[in]   args    points to the plp_csd_welch_parallel_arg_q16 structure
+   @return      none
+*/
+void plp_csd_welch_q16p_xpulpv2(void *args) {
+
+    plp_csd_welch_parallel_arg_q16 *arg = (plp_csd_welch_parallel_arg_q16 *)args;
+    const plp_welch_instance_q16 *S = arg->S;
+    const int16_t *pSrcA = arg->pSrcA;
+    const int16_t *pSrcB = arg->pSrcB;
+    uint32_t numFrames = arg->numFrames;
+    uint32_t deciPoint = arg->deciPoint;
+    uint32_t nPE = arg->nPE;
+    int16_t *pBuf = arg->pBuf;
+    int32_t *pDst = arg->pDst;
+
+    uint32_t f, k, c;
+    uint32_t core_id = rt_core_id();
+
+    uint32_t N = S->pRfft->fftLenReal;
+    uint32_t hop = S->hopLen;
+    uint32_t numVals = N + 2; // N/2+1 complex values
+    int32_t *pPartial = (int32_t *)(pBuf + 2 * nPE * N); // accumulators of the cores 1 .. nPE-1
+    int32_t *pAcc = (core_id == 0) ? pDst : pPartial + (core_id - 1) * numVals;
+    int32_t sum;
+
+    // every frame is shifted right by ceil(log2(numFrames)), the sum can not overflow
+    uint32_t shift = (numFrames > 1) ? 32 - __builtin_clz(numFrames - 1) : 0;
+    uint32_t mult = ((1u << (shift + 15)) + numFrames / 2) / numFrames; // 2^shift/numFrames in Q15
+
+    for (k = 0; k < numVals; k++) {
+        pAcc[k] = 0;
+    }
+
+    for (f = core_id; f < numFrames; f += nPE) {
+        plp_csd_welch_frame_q16(S->pRfft, S->pWindow, pSrcA + f * hop, pSrcB + f * hop,
+                                deciPoint, shift, (v2s *)(pBuf + 2 * core_id * N), pAcc);
+    }
+
+    rt_team_barrier();
+
+    // MERGE, the partial sums of the cores are added value by value
+    for (k = core_id; k < numVals; k += nPE) {
+        sum = pDst[k];
+        for (c = 1; c < nPE; c++) {
+            sum += pPartial[(c - 1) * numVals + k];
+        }
+        pDst[k] = (int32_t)(((int64_t)sum * mult) >> 15);
+    }
+
+    rt_team_barrier();
+}
+
+/**
+   @} end of welch group
+*/
+
+/* Accumulates the Q2.30 cross spectrum X[k] conj(Y[k]) of one windowed frame of both inputs,
+ * shifted right by shift, to pAcc. pBuf holds the packed FFTs of both frames. */
+static void plp_csd_welch_frame_q16(const plp_rfft_instance_q16 *S,
+                                    const int16_t *pWin,
+                                    const int16_t *pSrcA,
+                                    const int16_t *pSrcB,
+                                    uint32_t deciPoint,
+                                    uint32_t shift,
+                                    v2s *pBuf,
+                                    int32_t *pAcc) {
+
+    uint32_t k;
+    uint32_t nfft = S->fftLenReal >> 1;
+    const v2s *pCoef = (const v2s *)S->pTwiddleRFFT;
+    v2s *pBufB = pBuf + nfft;
+    v2s x0, y0, xa, xb, ya, yb;
+
+    plp_welch_fft_q16(S, pWin, pSrcA, deciPoint, pBuf);
+    plp_welch_fft_q16(S, pWin, pSrcB, deciPoint, pBufB);
+
+    // SPLIT STAGE, accumulates the cross spectrum
+    x0 = __SRA2(pBuf[0], ((v2s){ 1, 1 }));
+    y0 = __SRA2(pBufB[0], ((v2s){ 1, 1 }));
+    pAcc[0] += ((int32_t)(int16_t)(x0[0] + x0[1]) * (int16_t)(y0[0] + y0[1])) >> shift;
+    pAcc[2 * nfft] += ((int32_t)(int16_t)(x0[0] - x0[1]) * (int16_t)(y0[0] - y0[1])) >> shift;
+
+    for (k = 1; k <= (nfft >> 1); k++) {
+        plp_welch_split_q16(pBuf[k], pBuf[nfft - k], pCoef[k], &xa, &xb);
+        plp_welch_split_q16(pBufB[k], pBufB[nfft - k], pCoef[k], &ya, &yb);
+
+        // X[k] conj(Y[k])
+        pAcc[2 * k] += __DOTP2(xa, ya) >> shift;
+        pAcc[2 * k + 1] += __DOTP2(xa, __PACK2(-ya[1], ya[0])) >> shift;
+
+        // X[N/2-k] conj(Y[N/2-k]) = conj(xb conj(yb)), X[N/4] is accumulated only once
+        if (k < nfft - k) {
+            pAcc[2 * (nfft - k)] += __DOTP2(xb, yb) >> shift;
+            pAcc[2 * (nfft - k) + 1] += __DOTP2(xb, __PACK2(yb[1], -yb[0])) >> shift;
+        }
+    }
+}
+
+/* Windowed FFT of the frame pSrc[0 .. N-1], read as N/2 complex values, in natural order */
+static void plp_welch_fft_q16(const plp_rfft_instance_q16 *S,
+                              const int16_t *pWin,
+                              const int16_t *pSrc,
+                              uint32_t deciPoint,
+                              v2s *pBuf) {
+
+    uint32_t k;
+    uint32_t nfft = S->fftLenReal >> 1; // length of the packed complex FFT
+
+    // PACKING, loads and windows the frame
+    for (k = 0; k < nfft; k++) {
+        pBuf[k] = __PACK2(plp_welch_load_q16(pWin, pSrc, 2 * k),
+                          plp_welch_load_q16(pWin, pSrc, 2 * k + 1));
+    }
+
+    plp_cfft_q16s_xpulpv2(S->pCfft, (int16_t *)pBuf, 0, 1, deciPoint);
+}
+
+static inline int16_t plp_welch_load_q16(const int16_t *pWin, const int16_t *pSrc, int i) {
+
+    return (int16_t)(((int32_t)pSrc[i] * pWin[i]) >> 15);
+}
+
+/* Split stage of plp_rfft_q16s_xpulpv2, the inputs are halved before the sums. X[k] is written to
+ * outA and conj(X[N/2-k]) to outB. */
+static inline void plp_welch_split_q16(v2s A, v2s B, v2s CoSi, v2s *outA, v2s *outB) {
+    v2s a, b, e, o, t;
+
+    a = __SRA2(A, ((v2s){ 1, 1 }));
+    b = __SRA2(B, ((v2s){ 1, 1 }));
+
+    /* e = a + conj(b), o = (a - conj(b)) / j */
+    e = __PACK2(a[0] + b[0], a[1] - b[1]);
+    o = __PACK2(a[1] + b[1], b[0] - a[0]);
+
+    t = __PACK2((int16_t)(__DOTP2(CoSi, o) >> 16),
+                (int16_t)(__DOTP2(__PACK2(-CoSi[1], CoSi[0]), o) >> 16));
+
+    e = __SRA2(e, ((v2s){ 1, 1 }));
+
+    *outA = __ADD2(e, t);
+    *outB = __SUB2(e, t);
+}
@@ -0,0 +1,203 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_csd_welch_q16s_rv32im.c
+ * Description:  16-bit fixed point Welch cross-spectral density for RV32IM
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/* HELPER FUNCTIONS */
+static void plp_csd_welch_frame_q16(const plp_rfft_instance_q16 *S,
+                                    const int16_t *pWin,
+                                    const int16_t *pSrcA,
+                                    const int16_t *pSrcB,
+                                    uint32_t deciPoint,
+                                    uint32_t shift,
+                                    int16_t *pBuf,
+                                    int32_t *pAcc);
+static void plp_welch_fft_q16(const plp_rfft_instance_q16 *S,
+                              const int16_t *pWin,
+                              const int16_t *pSrc,
+                              uint32_t deciPoint,
+                              int16_t *pBuf);
+static inline int16_t plp_welch_load_q16(const int16_t *pWin, const int16_t *pSrc, int i);
+static inline void plp_welch_split_q16(const int16_t *A,
+                                       const int16_t *B,
+                                       const int16_t *CoSi,
+                                       int16_t *outA,
+                                       int16_t *outB);
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup welch
+  @{
+ */
+
+/**
+   @brief  16 bit fixed-point Welch cross-spectral density for RV32IM. The output is in Q2.30.
+   @param[in]   S          points to an instance of the 16 bit fixed-point Welch structure
+   @param[in]   pSrcA      points to the first input buffer of (numFrames-1)*hopLen+N values
+   @param[in]   pSrcB      points to the second input buffer of (numFrames-1)*hopLen+N values
+   @param[in]   numFrames  number of averaged frames
+   @param[in]   deciPoint  decimal point for right shift
+   @param[in]   pBuf       points to a temporary buffer of 2*N values
+   @param[out]  pDst       points to the output buffer of N/2+1 complex values
+   @return      none
+*/
+void plp_csd_welch_q16s_rv32im(const plp_welch_instance_q16 *S,
+                               const int16_t *__restrict__ pSrcA,
+                               const int16_t *__restrict__ pSrcB,
+                               uint32_t numFrames,
+                               uint32_t deciPoint,
+                               int16_t *__restrict__ pBuf,
+                               int32_t *__restrict__ pDst) {
+
+    uint32_t f, k;
+    uint32_t N = S->pRfft->fftLenReal;
+    uint32_t hop = S->hopLen;
+    uint32_t numVals = N + 2; // N/2+1 complex values;
+
+    // every frame is shifted right by ceil(log2(numFrames)), the sum can not overflow
+    uint32_t shift = (numFrames > 1) ? 32 - __builtin_clz(numFrames - 1) : 0;
+    uint32_t mult = ((1u << (shift + 15)) + numFrames / 2) / numFrames; // 2^shift/numFrames in Q15
+
+    for (k = 0; k < numVals; k++) {
+        pDst[k] = 0;
+    }
+
+    for (f = 0; f < numFrames; f++) {
+        plp_csd_welch_frame_q16(S->pRfft, S->pWindow, pSrcA + f * hop, pSrcB + f * hop,
+                                deciPoint, shift, pBuf, pDst);
+    }
+
+    for (k = 0; k < numVals; k++) {
+        pDst[k] = (int32_t)(((int64_t)pDst[k] * mult) >> 15);
+    }
+}
+
+/**
+   @} end of welch group
+*/
+
+/* Accumulates the Q2.30 cross spectrum X[k] conj(Y[k]) of one windowed frame of both inputs,
+ * shifted right by shift, to pAcc. pBuf holds the packed FFTs of both frames. */
+static void plp_csd_welch_frame_q16(const plp_rfft_instance_q16 *S,
+                                    const int16_t *pWin,
+                                    const int16_t *pSrcA,
+                                    const int16_t *pSrcB,
+                                    uint32_t deciPoint,
+                                    uint32_t shift,
+                                    int16_t *pBuf,
+                                    int32_t *pAcc) {
+
+    uint32_t k;
+    uint32_t nfft = S->fftLenReal >> 1;
+    const int16_t *pCoef = S->pTwiddleRFFT;
+    int16_t *pBufB = pBuf + 2 * nfft;
+    int16_t xre, xim, yre, yim;
+    int16_t xa[2], xb[2], ya[2], yb[2];
+
+    plp_welch_fft_q16(S, pWin, pSrcA, deciPoint, pBuf);
+    plp_welch_fft_q16(S, pWin, pSrcB, deciPoint, pBufB);
+
+    // SPLIT STAGE, accumulates the cross spectrum
+    xre = pBuf[0] >> 1;
+    xim = pBuf[1] >> 1;
+    yre = pBufB[0] >> 1;
+    yim = pBufB[1] >> 1;
+    pAcc[0] += ((int32_t)(int16_t)(xre + xim) * (int16_t)(yre + yim)) >> shift;
+    pAcc[2 * nfft] += ((int32_t)(int16_t)(xre - xim) * (int16_t)(yre - yim)) >> shift;
+
+    for (k = 1; k <= (nfft >> 1); k++) {
+        plp_welch_split_q16(&pBuf[2 * k], &pBuf[2 * (nfft - k)], &pCoef[2 * k], xa, xb);
+        plp_welch_split_q16(&pBufB[2 * k], &pBufB[2 * (nfft - k)], &pCoef[2 * k], ya, yb);
+
+        // X[k] conj(Y[k])
+        pAcc[2 * k] += ((int32_t)xa[0] * ya[0] + (int32_t)xa[1] * ya[1]) >> shift;
+        pAcc[2 * k + 1] += ((int32_t)xa[1] * ya[0] - (int32_t)xa[0] * ya[1]) >> shift;
+
+        // X[N/2-k] conj(Y[N/2-k]) = conj(xb conj(yb)), X[N/4] is accumulated only once
+        if (k < nfft - k) {
+            pAcc[2 * (nfft - k)] += ((int32_t)xb[0] * yb[0] + (int32_t)xb[1] * yb[1]) >> shift;
+            pAcc[2 * (nfft - k) + 1] +=
+                ((int32_t)xb[0] * yb[1] - (int32_t)xb[1] * yb[0]) >> shift;
+        }
+    }
+}
+
+/* Windowed FFT of the frame pSrc[0 .. N-1], read as N/2 complex values, in natural order */
+static void plp_welch_fft_q16(const plp_rfft_instance_q16 *S,
+                              const int16_t *pWin,
+                              const int16_t *pSrc,
+                              uint32_t deciPoint,
+                              int16_t *pBuf) {
+
+    uint32_t k;
+
+    // PACKING, loads and windows the frame
+    for (k = 0; k < S->fftLenReal; k++) {
+        pBuf[k] = plp_welch_load_q16(pWin, pSrc, k);
+    }
+
+    plp_cfft_q16s_rv32im(S->pCfft, pBuf, 0, 1, deciPoint);
+}
+
+static inline int16_t plp_welch_load_q16(const int16_t *pWin, const int16_t *pSrc, int i) {
+
+    return (int16_t)(((int32_t)pSrc[i] * pWin[i]) >> 15);
+}
+
+/* Split stage of plp_rfft_q16s_rv32im, the inputs are halved before the sums. X[k] is written to
+ * outA and conj(X[N/2-k]) to outB. */
+static inline void plp_welch_split_q16(const int16_t *A,
+                                       const int16_t *B,
+                                       const int16_t *CoSi,
+                                       int16_t *outA,
+                                       int16_t *outB) {
+    int16_t xe, ye, xo, yo, xt, yt;
+    int16_t cosVal = CoSi[0];
+    int16_t sinVal = CoSi[1];
+
+    /* e = a + conj(b), o = (a - conj(b)) / j */
+    xe = (A[0] >> 1) + (B[0] >> 1);
+    ye = (A[1] >> 1) - (B[1] >> 1);
+    xo = (A[1] >> 1) + (B[1] >> 1);
+    yo = (B[0] >> 1) - (A[0] >> 1);
+
+    xt = (int16_t)((((int32_t)xo * cosVal) + ((int32_t)yo * sinVal)) >> 16);
+    yt = (int16_t)((((int32_t)yo * cosVal) - ((int32_t)xo * sinVal)) >> 16);
+
+    xe = xe >> 1;
+    ye = ye >> 1;
+
+    outA[0] = xe + xt;
+    outA[1] = ye + yt;
+    outB[0] = xe - xt;
+    outB[1] = ye - yt;
+}
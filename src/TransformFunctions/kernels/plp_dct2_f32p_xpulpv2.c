@@ -0,0 +1,133 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dct2_f32p_xpulpv2.c
+ * Description:  Parallel floating-point DCT-II
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/* HELPER FUNCTIONS */
+static inline Complex_type_f32 complex_mul_conj(Complex_type_f32 A, Complex_type_f32 W);
+static inline void plp_dct2_post_f32(const Complex_type_f32 *pU,
+                                     const Complex_type_f32 *pPost,
+                                     const Complex_type_f32 *pSplit,
+                                     uint32_t N,
+                                     uint32_t k,
+                                     float32_t *pDst);
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup dct
+  @{
+ */
+
+/**
+   @brief  Parallel Floating-point DCT-II for XPULPV2. The pre and post
+   twiddling and the FFT are distributed over the cores, the output is identical to the one of
+   the serial version.
+   @param[in]   args    points to the plp_dct2_parallel_arg_f32 structure
+   @return      none
+*/
+void plp_dct2_f32p_xpulpv2(void *args) {
+
+    plp_dct2_parallel_arg_f32 *arg = (plp_dct2_parallel_arg_f32 *)args;
+    const plp_dct2_instance_f32 *S = arg->S;
+    const float32_t *pSrc = arg->pSrc;
+    float32_t *pBuf = arg->pBuf;
+    float32_t *pDst = arg->pDst;
+    uint32_t nPE = arg->nPE;
+    uint32_t core_id = rt_core_id();
+
+    uint32_t n, k;
+    uint32_t N = S->N;
+    uint32_t M = N >> 1;
+    const Complex_type_f32 *pU = (const Complex_type_f32 *)pBuf;
+    const Complex_type_f32 *pPost = (const Complex_type_f32 *)S->pTwiddle;
+    const Complex_type_f32 *pSplit = pPost + M + 1;
+
+    // even samples in ascending and odd samples in descending order, read as N/2 complex values
+    for (n = core_id; n < M; n += nPE) {
+        pDst[n] = pSrc[2 * n];
+        pDst[N - 1 - n] = pSrc[2 * n + 1];
+    }
+
+    rt_team_barrier();
+
+    plp_cfft_mixed_parallel_arg_f32 cfft_arg =
+        (plp_cfft_mixed_parallel_arg_f32){ S->pCfft, pDst, nPE, pBuf };
+    plp_cfft_mixed_f32p_xpulpv2((void *)&cfft_arg);
+
+    for (k = core_id; k <= M; k += nPE) {
+        plp_dct2_post_f32(pU, pPost, pSplit, N, k, pDst);
+    }
+
+    rt_team_barrier();
+}
+
+/**
+   @} end of dct group
+*/
+
+/* multiplication with the conjugate of the twiddle factor W = cos + j sin */
+static inline Complex_type_f32 complex_mul_conj(Complex_type_f32 A, Complex_type_f32 W) {
+
+    Complex_type_f32 result;
+    result.re = A.re * W.re + A.im * W.im;
+    result.im = A.im * W.re - A.re * W.im;
+    return result;
+}
+
+/*
+ * Computes X[k] and X[N-k] from the outputs k and N/2-k of the N/2 point FFT of the packed
+ * sequence. V = (A - j W^k B) / 2 is the k-th output of the N point real FFT, with A = U[k] +
+ * conj(U[N/2-k]) and B = U[k] - conj(U[N/2-k]), then X[k] = Re(V exp(-j pi k / (2N))) and X[N-k]
+ * = -Im(V exp(-j pi k / (2N))).
+ */
+static inline void plp_dct2_post_f32(const Complex_type_f32 *pU,
+                                     const Complex_type_f32 *pPost,
+                                     const Complex_type_f32 *pSplit,
+                                     uint32_t N,
+                                     uint32_t k,
+                                     float32_t *pDst) {
+
+    uint32_t M = N >> 1;
+    Complex_type_f32 a = pU[(k == M) ? 0 : k];
+    Complex_type_f32 b = pU[(k == 0) ? 0 : M - k];
+    Complex_type_f32 A, B, C, V;
+
+    A = (Complex_type_f32){ a.re + b.re, a.im - b.im };
+    B = (Complex_type_f32){ a.re - b.re, a.im + b.im };
+    C = complex_mul_conj(B, pSplit[k]);
+    V = (Complex_type_f32){ 0.5f * (A.re + C.im), 0.5f * (A.im - C.re) };
+
+    pDst[k] = V.re * pPost[k].re + V.im * pPost[k].im;
+    if ((k != 0) && (k != M)) {
+        pDst[N - k] = V.re * pPost[k].im - V.im * pPost[k].re;
+    }
+}
@@ -0,0 +1,148 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dct2_f32s_xpulpv2.c
+ * Description:  floating-point DCT-II
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/* HELPER FUNCTIONS */
+static inline Complex_type_f32 complex_mul_conj(Complex_type_f32 A, Complex_type_f32 W);
+static inline void plp_dct2_post_f32(const Complex_type_f32 *pU,
+                                     const Complex_type_f32 *pPost,
+                                     const Complex_type_f32 *pSplit,
+                                     uint32_t N,
+                                     uint32_t k,
+                                     float32_t *pDst);
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup dct DCT and MDCT
+  The DCT-II, DCT-IV and MDCT are computed with the mixed-radix complex FFT of half the length,
+  with pre and post twiddling. The instances in plp_const_structs.h contain the FFT plan and the
+  twiddle factors for the supported lengths.
+
+  The DCT-II of length N is defined as X[k] = sum_n x[n] cos(pi (n + 1/2) k / N). The even samples
+  in ascending order followed by the odd samples in descending order are read as N/2 complex
+  values, transformed with the N/2 point FFT and split into the N point real FFT, which is
+  rotated by exp(-j pi k / (2N)).
+
+  The DCT-IV of length N is defined as X[k] = sum_n x[n] cos(pi (n + 1/2) (k + 1/2) / N). The
+  complex sequence (x[2n] + j x[N-1-2n]) exp(-j pi (4n+1) / (4N)) is transformed with the N/2 point
+  FFT, the result is rotated by exp(-j pi k / N). The real parts are the even outputs, the
+  negated imaginary parts the odd outputs in descending order.
+
+  The MDCT maps 2N input samples to N coefficients X[k] = sum_n x[n] cos(pi (n + 1/2 + N/2)
+  (k + 1/2) / N). With the quarters a, b, c and d of the input, it is the DCT-IV of the folded
+  sequence (-c_r - d, a - b_r), where _r denotes the reversal. No windowing is applied.
+
+  All functions need a temporary buffer of N values, the input, output and temporary buffers
+  must not overlap. The 16 bit fixed-point versions scale the output by 1/N (DCT-II, DCT-IV) or
+  1/(2N) (MDCT).
+*/
+
+/**
+  @addtogroup dct
+  @{
+ */
+
+/**
+   @brief  Floating-point DCT-II for XPULPV2 extension.
+   @param[in]   S           points to an instance of the floating-point DCT-II structure
+   @param[in]   pSrc        points to the input buffer of N values
+   @param[in]   pBuf        points to a temporary buffer of N values
+   @param[out]  pDst        points to the output buffer of N values
+   @return      none
+*/
+void plp_dct2_f32s_xpulpv2(const plp_dct2_instance_f32 *S,
+                           const float32_t *__restrict__ pSrc,
+                           float32_t *__restrict__ pBuf,
+                           float32_t *__restrict__ pDst) {
+
+    uint32_t n, k;
+    uint32_t N = S->N;
+    uint32_t M = N >> 1;
+    const Complex_type_f32 *pU = (const Complex_type_f32 *)pBuf;
+    const Complex_type_f32 *pPost = (const Complex_type_f32 *)S->pTwiddle;
+    const Complex_type_f32 *pSplit = pPost + M + 1;
+
+    // even samples in ascending and odd samples in descending order, read as N/2 complex values
+    for (n = 0; n < M; n++) {
+        pDst[n] = pSrc[2 * n];
+        pDst[N - 1 - n] = pSrc[2 * n + 1];
+    }
+
+    plp_cfft_mixed_f32s_xpulpv2(S->pCfft, pDst, pBuf);
+
+    for (k = 0; k <= M; k++) {
+        plp_dct2_post_f32(pU, pPost, pSplit, N, k, pDst);
+    }
+}
+
+/**
+   @} end of dct group
+*/
+
+/* multiplication with the conjugate of the twiddle factor W = cos + j sin */
+static inline Complex_type_f32 complex_mul_conj(Complex_type_f32 A, Complex_type_f32 W) {
+
+    Complex_type_f32 result;
+    result.re = A.re * W.re + A.im * W.im;
+    result.im = A.im * W.re - A.re * W.im;
+    return result;
+}
+
+/*
+ * Computes X[k] and X[N-k] from the outputs k and N/2-k of the N/2 point FFT of the packed
+ * sequence. V = (A - j W^k B) / 2 is the k-th output of the N point real FFT, with A = U[k] +
+ * conj(U[N/2-k]) and B = U[k] - conj(U[N/2-k]), then X[k] = Re(V exp(-j pi k / (2N))) and X[N-k]
+ * = -Im(V exp(-j pi k / (2N))).
+ */
+static inline void plp_dct2_post_f32(const Complex_type_f32 *pU,
+                                     const Complex_type_f32 *pPost,
+                                     const Complex_type_f32 *pSplit,
+                                     uint32_t N,
+                                     uint32_t k,
+                                     float32_t *pDst) {
+
+    uint32_t M = N >> 1;
+    Complex_type_f32 a = pU[(k == M) ? 0 : k];
+    Complex_type_f32 b = pU[(k == 0) ? 0 : M - k];
+    Complex_type_f32 A, B, C, V;
+
+    A = (Complex_type_f32){ a.re + b.re, a.im - b.im };
+    B = (Complex_type_f32){ a.re - b.re, a.im + b.im };
+    C = complex_mul_conj(B, pSplit[k]);
+    V = (Complex_type_f32){ 0.5f * (A.re + C.im), 0.5f * (A.im - C.re) };
+
+    pDst[k] = V.re * pPost[k].re + V.im * pPost[k].im;
+    if ((k != 0) && (k != M)) {
+        pDst[N - k] = V.re * pPost[k].im - V.im * pPost[k].re;
+    }
+}
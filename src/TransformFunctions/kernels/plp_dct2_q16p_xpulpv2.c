@@ -0,0 +1,123 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dct2_q16p_xpulpv2.c
+ * Description:  Parallel 16-bit fixed point DCT-II
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/* HELPER FUNCTIONS */
+static inline void plp_dct2_post_q16(const v2s *pU,
+                                     const v2s *pPost,
+                                     const v2s *pSplit,
+                                     uint32_t N,
+                                     uint32_t k,
+                                     int16_t *pDst);
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup dct
+  @{
+ */
+
+/**
+   @brief  Parallel 16 bit fixed-point DCT-II for XPULPV2. The pre and post
+   twiddling and the FFT are distributed over the cores, the output is identical to the one of
+   the serial version.
+   @param[in]   args    points to the plp_dct2_parallel_arg_q16 structure
+   @return      none
+*/
+void plp_dct2_q16p_xpulpv2(void *args) {
+
+    plp_dct2_parallel_arg_q16 *arg = (plp_dct2_parallel_arg_q16 *)args;
+    const plp_dct2_instance_q16 *S = arg->S;
+    const int16_t *pSrc = arg->pSrc;
+    int16_t *pBuf = arg->pBuf;
+    int16_t *pDst = arg->pDst;
+    uint32_t nPE = arg->nPE;
+    uint32_t core_id = rt_core_id();
+
+    uint32_t n, k;
+    uint32_t N = S->N;
+    uint32_t M = N >> 1;
+    const v2s *pU = (const v2s *)pBuf;
+    const v2s *pPost = (const v2s *)S->pTwiddle;
+    const v2s *pSplit = pPost + M + 1;
+
+    // even samples in ascending and odd samples in descending order, read as N/2 complex values
+    for (n = core_id; n < M; n += nPE) {
+        pDst[n] = pSrc[2 * n];
+        pDst[N - 1 - n] = pSrc[2 * n + 1];
+    }
+
+    rt_team_barrier();
+
+    plp_cfft_mixed_parallel_arg_q16 cfft_arg =
+        (plp_cfft_mixed_parallel_arg_q16){ S->pCfft, pDst, arg->deciPoint, nPE, pBuf };
+    plp_cfft_mixed_q16p_xpulpv2((void *)&cfft_arg);
+
+    for (k = core_id; k <= M; k += nPE) {
+        plp_dct2_post_q16(pU, pPost, pSplit, N, k, pDst);
+    }
+
+    rt_team_barrier();
+}
+
+/**
+   @} end of dct group
+*/
+
+/*
+ * Computes X[k] and X[N-k] from the outputs k and N/2-k of the N/2 point FFT of the packed
+ * sequence, see plp_dct2_f32s_xpulpv2. The FFT output is scaled by 2/N, the inputs are halved
+ * before the sums and V is halved, so the output is scaled by 1/N.
+ */
+static inline void plp_dct2_post_q16(const v2s *pU,
+                                     const v2s *pPost,
+                                     const v2s *pSplit,
+                                     uint32_t N,
+                                     uint32_t k,
+                                     int16_t *pDst) {
+
+    uint32_t M = N >> 1;
+    v2s a = __SRA2(pU[(k == M) ? 0 : k], ((v2s){ 1, 1 }));
+    v2s b = __SRA2(pU[(k == 0) ? 0 : M - k], ((v2s){ 1, 1 }));
+    v2s W = pSplit[k];
+    v2s B, C, V;
+
+    B = __PACK2(a[0] - b[0], a[1] + b[1]);
+    C = __PACK2(__DOTP2(B, W) >> 15, __DOTP2(B, __PACK2(-W[1], W[0])) >> 15);
+    V = __PACK2((a[0] + b[0] + C[1]) >> 1, (a[1] - b[1] - C[0]) >> 1);
+
+    W = pPost[k];
+    pDst[k] = (int16_t)(__DOTP2(V, W) >> 15);
+    if ((k != 0) && (k != M)) {
+        pDst[N - k] = (int16_t)(__DOTP2(V, __PACK2(W[1], -W[0])) >> 15);
+    }
+}
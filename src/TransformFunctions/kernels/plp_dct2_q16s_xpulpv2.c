@@ -0,0 +1,115 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dct2_q16s_xpulpv2.c
+ * Description:  16-bit fixed point DCT-II
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/* HELPER FUNCTIONS */
+static inline void plp_dct2_post_q16(const v2s *pU,
+                                     const v2s *pPost,
+                                     const v2s *pSplit,
+                                     uint32_t N,
+                                     uint32_t k,
+                                     int16_t *pDst);
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup dct
+  @{
+ */
+
+/**
+   @brief  16 bit fixed-point DCT-II for XPULPV2 extension. The output is scaled by 1/N.
+   @param[in]   S           points to an instance of the 16bit DCT-II structure
+   @param[in]   pSrc        points to the input buffer of N values
+   @param[in]   deciPoint   decimal point for right shift
+   @param[in]   pBuf        points to a temporary buffer of N values
+   @param[out]  pDst        points to the output buffer of N values
+   @return      none
+*/
+void plp_dct2_q16s_xpulpv2(const plp_dct2_instance_q16 *S,
+                           const int16_t *__restrict__ pSrc,
+                           uint32_t deciPoint,
+                           int16_t *__restrict__ pBuf,
+                           int16_t *__restrict__ pDst) {
+
+    uint32_t n, k;
+    uint32_t N = S->N;
+    uint32_t M = N >> 1;
+    const v2s *pU = (const v2s *)pBuf;
+    const v2s *pPost = (const v2s *)S->pTwiddle;
+    const v2s *pSplit = pPost + M + 1;
+
+    // even samples in ascending and odd samples in descending order, read as N/2 complex values
+    for (n = 0; n < M; n++) {
+        pDst[n] = pSrc[2 * n];
+        pDst[N - 1 - n] = pSrc[2 * n + 1];
+    }
+
+    plp_cfft_mixed_q16s_xpulpv2(S->pCfft, pDst, deciPoint, pBuf);
+
+    for (k = 0; k <= M; k++) {
+        plp_dct2_post_q16(pU, pPost, pSplit, N, k, pDst);
+    }
+}
+
+/**
+   @} end of dct group
+*/
+
+/*
+ * Computes X[k] and X[N-k] from the outputs k and N/2-k of the N/2 point FFT of the packed
+ * sequence, see plp_dct2_f32s_xpulpv2. The FFT output is scaled by 2/N, the inputs are halved
+ * before the sums and V is halved, so the output is scaled by 1/N.
+ */
+static inline void plp_dct2_post_q16(const v2s *pU,
+                                     const v2s *pPost,
+                                     const v2s *pSplit,
+                                     uint32_t N,
+                                     uint32_t k,
+                                     int16_t *pDst) {
+
+    uint32_t M = N >> 1;
+    v2s a = __SRA2(pU[(k == M) ? 0 : k], ((v2s){ 1, 1 }));
+    v2s b = __SRA2(pU[(k == 0) ? 0 : M - k], ((v2s){ 1, 1 }));
+    v2s W = pSplit[k];
+    v2s B, C, V;
+
+    B = __PACK2(a[0] - b[0], a[1] + b[1]);
+    C = __PACK2(__DOTP2(B, W) >> 15, __DOTP2(B, __PACK2(-W[1], W[0])) >> 15);
+    V = __PACK2((a[0] + b[0] + C[1]) >> 1, (a[1] - b[1] - C[0]) >> 1);
+
+    W = pPost[k];
+    pDst[k] = (int16_t)(__DOTP2(V, W) >> 15);
+    if ((k != 0) && (k != M)) {
+        pDst[N - k] = (int16_t)(__DOTP2(V, __PACK2(W[1], -W[0])) >> 15);
+    }
+}
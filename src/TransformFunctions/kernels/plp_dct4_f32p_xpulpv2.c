@@ -0,0 +1,114 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dct4_f32p_xpulpv2.c
+ * Description:  Parallel floating-point DCT-IV
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/* HELPER FUNCTIONS */
+static inline Complex_type_f32 complex_mul_conj(Complex_type_f32 A, Complex_type_f32 W);
+static inline void plp_dct4_post_f32(Complex_type_f32 Z,
+                                     Complex_type_f32 W,
+                                     uint32_t N,
+                                     uint32_t k,
+                                     float32_t *pDst);
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup dct
+  @{
+ */
+
+/**
+   @brief  Parallel Floating-point DCT-IV for XPULPV2. The pre and post
+   twiddling and the FFT are distributed over the cores, the output is identical to the one of
+   the serial version.
+   @param[in]   args    points to the plp_dct4_parallel_arg_f32 structure
+   @return      none
+*/
+void plp_dct4_f32p_xpulpv2(void *args) {
+
+    plp_dct4_parallel_arg_f32 *arg = (plp_dct4_parallel_arg_f32 *)args;
+    const plp_dct4_instance_f32 *S = arg->S;
+    const float32_t *pSrc = arg->pSrc;
+    float32_t *pBuf = arg->pBuf;
+    float32_t *pDst = arg->pDst;
+    uint32_t nPE = arg->nPE;
+    uint32_t core_id = rt_core_id();
+
+    uint32_t n, k;
+    uint32_t N = S->N;
+    uint32_t M = N >> 1;
+    Complex_type_f32 *pZ = (Complex_type_f32 *)pDst;
+    const Complex_type_f32 *pU = (const Complex_type_f32 *)pBuf;
+    const Complex_type_f32 *pPre = (const Complex_type_f32 *)S->pTwiddle;
+    const Complex_type_f32 *pPost = pPre + M;
+
+    // pre twiddling of the complex sequence x[2n] + j x[N-1-2n]
+    for (n = core_id; n < M; n += nPE) {
+        pZ[n] = complex_mul_conj((Complex_type_f32){ pSrc[2 * n], pSrc[N - 1 - 2 * n] }, pPre[n]);
+    }
+
+    rt_team_barrier();
+
+    plp_cfft_mixed_parallel_arg_f32 cfft_arg =
+        (plp_cfft_mixed_parallel_arg_f32){ S->pCfft, pDst, nPE, pBuf };
+    plp_cfft_mixed_f32p_xpulpv2((void *)&cfft_arg);
+
+    // post twiddling, the real parts are the even and the imaginary parts the odd outputs
+    for (k = core_id; k < M; k += nPE) {
+        plp_dct4_post_f32(pU[k], pPost[k], N, k, pDst);
+    }
+
+    rt_team_barrier();
+}
+
+/**
+   @} end of dct group
+*/
+
+/* multiplication with the conjugate of the twiddle factor W = cos + j sin */
+static inline Complex_type_f32 complex_mul_conj(Complex_type_f32 A, Complex_type_f32 W) {
+
+    Complex_type_f32 result;
+    result.re = A.re * W.re + A.im * W.im;
+    result.im = A.im * W.re - A.re * W.im;
+    return result;
+}
+
+/* y = Z[k] exp(-j pi k / N), then X[2k] = Re(y) and X[N-1-2k] = -Im(y) */
+static inline void plp_dct4_post_f32(Complex_type_f32 Z,
+                                     Complex_type_f32 W,
+                                     uint32_t N,
+                                     uint32_t k,
+                                     float32_t *pDst) {
+    pDst[2 * k] = Z.re * W.re + Z.im * W.im;
+    pDst[N - 1 - 2 * k] = Z.re * W.im - Z.im * W.re;
+}
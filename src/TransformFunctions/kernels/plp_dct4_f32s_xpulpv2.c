@@ -0,0 +1,104 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dct4_f32s_xpulpv2.c
+ * Description:  floating-point DCT-IV
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/* HELPER FUNCTIONS */
+static inline Complex_type_f32 complex_mul_conj(Complex_type_f32 A, Complex_type_f32 W);
+static inline void plp_dct4_post_f32(Complex_type_f32 Z,
+                                     Complex_type_f32 W,
+                                     uint32_t N,
+                                     uint32_t k,
+                                     float32_t *pDst);
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup dct
+  @{
+ */
+
+/**
+   @brief  Floating-point DCT-IV for XPULPV2 extension.
+   @param[in]   S           points to an instance of the floating-point DCT-IV structure
+   @param[in]   pSrc        points to the input buffer of N values
+   @param[in]   pBuf        points to a temporary buffer of N values
+   @param[out]  pDst        points to the output buffer of N values
+   @return      none
+*/
+void plp_dct4_f32s_xpulpv2(const plp_dct4_instance_f32 *S,
+                           const float32_t *__restrict__ pSrc,
+                           float32_t *__restrict__ pBuf,
+                           float32_t *__restrict__ pDst) {
+
+    uint32_t n, k;
+    uint32_t N = S->N;
+    uint32_t M = N >> 1;
+    Complex_type_f32 *pZ = (Complex_type_f32 *)pDst;
+    const Complex_type_f32 *pU = (const Complex_type_f32 *)pBuf;
+    const Complex_type_f32 *pPre = (const Complex_type_f32 *)S->pTwiddle;
+    const Complex_type_f32 *pPost = pPre + M;
+
+    // pre twiddling of the complex sequence x[2n] + j x[N-1-2n]
+    for (n = 0; n < M; n++) {
+        pZ[n] = complex_mul_conj((Complex_type_f32){ pSrc[2 * n], pSrc[N - 1 - 2 * n] }, pPre[n]);
+    }
+
+    plp_cfft_mixed_f32s_xpulpv2(S->pCfft, pDst, pBuf);
+
+    // post twiddling, the real parts are the even and the imaginary parts the odd outputs
+    for (k = 0; k < M; k++) {
+        plp_dct4_post_f32(pU[k], pPost[k], N, k, pDst);
+    }
+}
+
+/**
+   @} end of dct group
+*/
+
+/* multiplication with the conjugate of the twiddle factor W = cos + j sin */
+static inline Complex_type_f32 complex_mul_conj(Complex_type_f32 A, Complex_type_f32 W) {
+
+    Complex_type_f32 result;
+    result.re = A.re * W.re + A.im * W.im;
+    result.im = A.im * W.re - A.re * W.im;
+    return result;
+}
+
+/* y = Z[k] exp(-j pi k / N), then X[2k] = Re(y) and X[N-1-2k] = -Im(y) */
+static inline void plp_dct4_post_f32(Complex_type_f32 Z,
+                                     Complex_type_f32 W,
+                                     uint32_t N,
+                                     uint32_t k,
+                                     float32_t *pDst) {
+    pDst[2 * k] = Z.re * W.re + Z.im * W.im;
+    pDst[N - 1 - 2 * k] = Z.re * W.im - Z.im * W.re;
+}
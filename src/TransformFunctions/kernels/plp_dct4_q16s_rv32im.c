@@ -0,0 +1,111 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dct4_q16s_rv32im.c
+ * Description:  16-bit fixed point DCT-IV
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/* HELPER FUNCTIONS */
+static inline void plp_dct4_pre_q16(int32_t re, int32_t im, const int16_t *pW, int16_t *pZ);
+static inline void plp_dct4_post_q16(const int16_t *pZ,
+                                     const int16_t *pW,
+                                     uint32_t N,
+                                     uint32_t k,
+                                     int16_t *pDst);
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup dct
+  @{
+ */
+
+/**
+   @brief  16 bit fixed-point DCT-IV for RV32IM extension. The output is scaled by 1/N.
+   @param[in]   S           points to an instance of the 16bit DCT-IV structure
+   @param[in]   pSrc        points to the input buffer of N values
+   @param[in]   deciPoint   decimal point for right shift
+   @param[in]   pBuf        points to a temporary buffer of N values
+   @param[out]  pDst        points to the output buffer of N values
+   @return      none
+*/
+void plp_dct4_q16s_rv32im(const plp_dct4_instance_q16 *S,
+                          const int16_t *__restrict__ pSrc,
+                          uint32_t deciPoint,
+                          int16_t *__restrict__ pBuf,
+                          int16_t *__restrict__ pDst) {
+
+    uint32_t n, k;
+    uint32_t N = S->N;
+    uint32_t M = N >> 1;
+    const int16_t *pPre = S->pTwiddle;
+    const int16_t *pPost = pPre + 2 * M;
+
+    // pre twiddling of the complex sequence x[2n] + j x[N-1-2n]
+    for (n = 0; n < M; n++) {
+        plp_dct4_pre_q16(pSrc[2 * n], pSrc[N - 1 - 2 * n], &pPre[2 * n], &pDst[2 * n]);
+    }
+
+    plp_cfft_mixed_q16s_rv32im(S->pCfft, pDst, deciPoint, pBuf);
+
+    // post twiddling, the real parts are the even and the imaginary parts the odd outputs
+    for (k = 0; k < M; k++) {
+        plp_dct4_post_q16(pBuf, pPost, N, k, pDst);
+    }
+}
+
+/**
+   @} end of dct group
+*/
+
+/* z[n] = (x[2n] + j x[N-1-2n]) exp(-j pi (4n+1) / (4N)) / 2 */
+static inline void plp_dct4_pre_q16(int32_t re, int32_t im, const int16_t *pW, int16_t *pZ) {
+
+    int32_t cosVal = pW[0];
+    int32_t sinVal = pW[1];
+
+    pZ[0] = (int16_t)((re * cosVal + im * sinVal) >> 16);
+    pZ[1] = (int16_t)((im * cosVal - re * sinVal) >> 16);
+}
+
+/* y = Z[k] exp(-j pi k / N), then X[2k] = Re(y) and X[N-1-2k] = -Im(y) */
+static inline void plp_dct4_post_q16(const int16_t *pZ,
+                                     const int16_t *pW,
+                                     uint32_t N,
+                                     uint32_t k,
+                                     int16_t *pDst) {
+
+    int32_t re = pZ[2 * k];
+    int32_t im = pZ[2 * k + 1];
+    int32_t cosVal = pW[2 * k];
+    int32_t sinVal = pW[2 * k + 1];
+
+    pDst[2 * k] = (int16_t)((re * cosVal + im * sinVal) >> 15);
+    pDst[N - 1 - 2 * k] = (int16_t)((re * sinVal - im * cosVal) >> 15);
+}
@@ -0,0 +1,123 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mdct_q16p_xpulpv2.c
+ * Description:  Parallel 16-bit fixed point MDCT
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/* HELPER FUNCTIONS */
+static inline int32_t plp_mdct_fold_q16(const int16_t *pSrc, uint32_t N, uint32_t j);
+static inline void plp_mdct_pre_q16(int32_t re, int32_t im, const int16_t *pW, int16_t *pZ);
+static inline void plp_dct4_post_q16(v2s Z, v2s W, uint32_t N, uint32_t k, int16_t *pDst);
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup dct
+  @{
+ */
+
+/**
+   @brief  Parallel 16 bit fixed-point MDCT for XPULPV2. The pre and post
+   twiddling and the FFT are distributed over the cores, the output is identical to the one of
+   the serial version.
+   @param[in]   args    points to the plp_mdct_parallel_arg_q16 structure
+   @return      none
+*/
+void plp_mdct_q16p_xpulpv2(void *args) {
+
+    plp_mdct_parallel_arg_q16 *arg = (plp_mdct_parallel_arg_q16 *)args;
+    const plp_mdct_instance_q16 *S = arg->S;
+    const int16_t *pSrc = arg->pSrc;
+    int16_t *pBuf = arg->pBuf;
+    int16_t *pDst = arg->pDst;
+    uint32_t nPE = arg->nPE;
+    uint32_t core_id = rt_core_id();
+
+    uint32_t n, k;
+    uint32_t N = S->N;
+    uint32_t M = N >> 1;
+    const v2s *pU = (const v2s *)pBuf;
+    const int16_t *pPre = S->pDct4->pTwiddle;
+    const v2s *pPost = (const v2s *)pPre + M;
+
+    // folding of the 2N input samples and pre twiddling, like for the DCT-IV
+    for (n = core_id; n < M; n += nPE) {
+        plp_mdct_pre_q16(plp_mdct_fold_q16(pSrc, N, 2 * n),
+                         plp_mdct_fold_q16(pSrc, N, N - 1 - 2 * n), &pPre[2 * n], &pDst[2 * n]);
+    }
+
+    rt_team_barrier();
+
+    plp_cfft_mixed_parallel_arg_q16 cfft_arg =
+        (plp_cfft_mixed_parallel_arg_q16){ S->pDct4->pCfft, pDst, arg->deciPoint, nPE, pBuf };
+    plp_cfft_mixed_q16p_xpulpv2((void *)&cfft_arg);
+
+    // post twiddling, the real parts are the even and the imaginary parts the odd outputs
+    for (k = core_id; k < M; k += nPE) {
+        plp_dct4_post_q16(pU[k], pPost[k], N, k, pDst);
+    }
+
+    rt_team_barrier();
+}
+
+/**
+   @} end of dct group
+*/
+
+/*
+ * Element j of the N point sequence (-c_r - d, a - b_r) / 2, where a, b, c and d are the quarters
+ * of the 2N input samples and _r denotes the reversal. The DCT-IV of this sequence is the MDCT.
+ */
+static inline int32_t plp_mdct_fold_q16(const int16_t *pSrc, uint32_t N, uint32_t j) {
+
+    uint32_t H = N >> 1;
+
+    if (j < H) {
+        return (-(int32_t)pSrc[3 * H - 1 - j] - (int32_t)pSrc[3 * H + j]) >> 1;
+    } else {
+        return ((int32_t)pSrc[j - H] - (int32_t)pSrc[N - 1 - j + H]) >> 1;
+    }
+}
+
+/* z[n] = (u[2n] + j u[N-1-2n]) exp(-j pi (4n+1) / (4N)) / 2, the folded u is already halved */
+static inline void plp_mdct_pre_q16(int32_t re, int32_t im, const int16_t *pW, int16_t *pZ) {
+
+    int32_t cosVal = pW[0];
+    int32_t sinVal = pW[1];
+
+    pZ[0] = (int16_t)((re * cosVal + im * sinVal) >> 16);
+    pZ[1] = (int16_t)((im * cosVal - re * sinVal) >> 16);
+}
+
+/* y = Z[k] exp(-j pi k / N), then X[2k] = Re(y) and X[N-1-2k] = -Im(y) */
+static inline void plp_dct4_post_q16(v2s Z, v2s W, uint32_t N, uint32_t k, int16_t *pDst) {
+    pDst[2 * k] = (int16_t)(__DOTP2(Z, W) >> 15);
+    pDst[N - 1 - 2 * k] = (int16_t)(__DOTP2(Z, __PACK2(W[1], -W[0])) >> 15);
+}
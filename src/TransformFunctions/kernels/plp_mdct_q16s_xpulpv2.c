@@ -0,0 +1,115 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mdct_q16s_xpulpv2.c
+ * Description:  16-bit fixed point MDCT
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/* HELPER FUNCTIONS */
+static inline int32_t plp_mdct_fold_q16(const int16_t *pSrc, uint32_t N, uint32_t j);
+static inline void plp_mdct_pre_q16(int32_t re, int32_t im, const int16_t *pW, int16_t *pZ);
+static inline void plp_dct4_post_q16(v2s Z, v2s W, uint32_t N, uint32_t k, int16_t *pDst);
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup dct
+  @{
+ */
+
+/**
+   @brief  16 bit fixed-point MDCT for XPULPV2 extension. The output is scaled by 1/(2N).
+   @param[in]   S           points to an instance of the 16bit MDCT structure
+   @param[in]   pSrc        points to the input buffer of 2N values
+   @param[in]   deciPoint   decimal point for right shift
+   @param[in]   pBuf        points to a temporary buffer of N values
+   @param[out]  pDst        points to the output buffer of N values
+   @return      none
+*/
+void plp_mdct_q16s_xpulpv2(const plp_mdct_instance_q16 *S,
+                           const int16_t *__restrict__ pSrc,
+                           uint32_t deciPoint,
+                           int16_t *__restrict__ pBuf,
+                           int16_t *__restrict__ pDst) {
+
+    uint32_t n, k;
+    uint32_t N = S->N;
+    uint32_t M = N >> 1;
+    const v2s *pU = (const v2s *)pBuf;
+    const int16_t *pPre = S->pDct4->pTwiddle;
+    const v2s *pPost = (const v2s *)pPre + M;
+
+    // folding of the 2N input samples and pre twiddling, like for the DCT-IV
+    for (n = 0; n < M; n++) {
+        plp_mdct_pre_q16(plp_mdct_fold_q16(pSrc, N, 2 * n),
+                         plp_mdct_fold_q16(pSrc, N, N - 1 - 2 * n), &pPre[2 * n], &pDst[2 * n]);
+    }
+
+    plp_cfft_mixed_q16s_xpulpv2(S->pDct4->pCfft, pDst, deciPoint, pBuf);
+
+    // post twiddling, the real parts are the even and the imaginary parts the odd outputs
+    for (k = 0; k < M; k++) {
+        plp_dct4_post_q16(pU[k], pPost[k], N, k, pDst);
+    }
+}
+
+/**
+   @} end of dct group
+*/
+
+/*
+ * Element j of the N point sequence (-c_r - d, a - b_r) / 2, where a, b, c and d are the quarters
+ * of the 2N input samples and _r denotes the reversal. The DCT-IV of this sequence is the MDCT.
+ */
+static inline int32_t plp_mdct_fold_q16(const int16_t *pSrc, uint32_t N, uint32_t j) {
+
+    uint32_t H = N >> 1;
+
+    if (j < H) {
+        return (-(int32_t)pSrc[3 * H - 1 - j] - (int32_t)pSrc[3 * H + j]) >> 1;
+    } else {
+        return ((int32_t)pSrc[j - H] - (int32_t)pSrc[N - 1 - j + H]) >> 1;
+    }
+}
+
+/* z[n] = (u[2n] + j u[N-1-2n]) exp(-j pi (4n+1) / (4N)) / 2, the folded u is already halved */
+static inline void plp_mdct_pre_q16(int32_t re, int32_t im, const int16_t *pW, int16_t *pZ) {
+
+    int32_t cosVal = pW[0];
+    int32_t sinVal = pW[1];
+
+    pZ[0] = (int16_t)((re * cosVal + im * sinVal) >> 16);
+    pZ[1] = (int16_t)((im * cosVal - re * sinVal) >> 16);
+}
+
+/* y = Z[k] exp(-j pi k / N), then X[2k] = Re(y) and X[N-1-2k] = -Im(y) */
+static inline void plp_dct4_post_q16(v2s Z, v2s W, uint32_t N, uint32_t k, int16_t *pDst) {
+    pDst[2 * k] = (int16_t)(__DOTP2(Z, W) >> 15);
+    pDst[N - 1 - 2 * k] = (int16_t)(__DOTP2(Z, __PACK2(W[1], -W[0])) >> 15);
+}
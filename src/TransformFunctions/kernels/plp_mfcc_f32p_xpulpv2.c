@@ -0,0 +1,153 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mfcc_f32p_xpulpv2.c
+ * Description:  Parallel floating-point MFCC for XPULPV2
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/* HELPER FUNCTIONS */
+static void plp_mfcc_frame_f32(const plp_mfcc_instance_f32 *S,
+                               const float32_t *pPow,
+                               float32_t *pScratch,
+                               float32_t *pDst);
+static inline float32_t plp_mfcc_log_f32(float32_t x);
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup mfcc
+  @{
+ */
+
+/**
+   @brief  Parallel floating-point MFCC for XPULPV2. The STFT of nPE frames is computed with
+   plp_stft_f32p_xpulpv2, then every core computes the mel energies and the DCT of one frame.
+   The output is identical to the one of the serial version.
+   @param[in]   args    points to the plp_mfcc_parallel_arg_f32 structure
+   @return      none
+*/
+void plp_mfcc_f32p_xpulpv2(void *args) {
+
+    plp_mfcc_parallel_arg_f32 *arg = (plp_mfcc_parallel_arg_f32 *)args;
+    const plp_mfcc_instance_f32 *S = arg->S;
+    plp_stft_instance_f32 *pStft = arg->pStft;
+    const float32_t *pSrc = arg->pSrc;
+    uint32_t numFrames = arg->numFrames;
+    uint32_t nPE = arg->nPE;
+    float32_t *pBuf = arg->pBuf;
+    float32_t *pDst = arg->pDst;
+
+    uint32_t f, numChunk;
+    uint32_t core_id = rt_core_id();
+
+    uint32_t N = pStft->pRfft->FFTLength;
+    uint32_t hop = pStft->hopLen;
+    uint32_t numOut = (S->pDct) ? S->numCoeffs : S->numBands;
+    float32_t *pPow = pBuf + nPE * N;
+    float32_t *pScratch = pBuf + nPE * (2 * N + 2) + core_id * 3 * S->numBands;
+
+    for (f = 0; f < numFrames; f += nPE) {
+        numChunk = (numFrames - f < nPE) ? numFrames - f : nPE;
+
+        // STFT of numChunk frames, ends with a barrier
+        plp_stft_parallel_arg_f32 stft_arg =
+            (plp_stft_parallel_arg_f32){ pStft, pSrc + f * hop, numChunk, nPE, pBuf, pPow };
+        plp_stft_f32p_xpulpv2((void *)&stft_arg);
+
+        if (core_id < numChunk) {
+            plp_mfcc_frame_f32(S, pPow + core_id * (N / 2 + 1), pScratch,
+                               pDst + (f + core_id) * numOut);
+        }
+
+        // the next STFT overwrites the power spectra
+        rt_team_barrier();
+    }
+}
+
+/**
+   @} end of mfcc group
+*/
+
+/* mel filterbank, logarithm and DCT of one power spectrum */
+static void plp_mfcc_frame_f32(const plp_mfcc_instance_f32 *S,
+                               const float32_t *pPow,
+                               float32_t *pScratch,
+                               float32_t *pDst) {
+
+    uint32_t b, k;
+    uint32_t numBands = S->numBands;
+    const float32_t *pW = S->pWeights;
+    float32_t *pMel = (S->pDct) ? pScratch : pDst;
+    float32_t acc;
+
+    // SPARSE MEL FILTERBANK
+    for (b = 0; b < numBands; b++) {
+        acc = 0.0f;
+        for (k = S->pBandStart[b]; k <= S->pBandEnd[b]; k++) {
+            acc += pPow[k] * (*pW++);
+        }
+        pMel[b] = plp_mfcc_log_f32(acc);
+    }
+
+    // DCT-II, only the first numCoeffs are kept
+    if (S->pDct) {
+        plp_dct2_f32s_xpulpv2(S->pDct, pMel, pScratch + numBands, pScratch + 2 * numBands);
+        for (k = 0; k < S->numCoeffs; k++) {
+            pDst[k] = pScratch[2 * numBands + k];
+        }
+    }
+}
+
+/* ln(x) = e ln(2) + 2 atanh(s), with x = 2^e m, m in [sqrt(1/2), sqrt(2)) and s = (m-1)/(m+1) */
+static inline float32_t plp_mfcc_log_f32(float32_t x) {
+
+    union {
+        float32_t value;
+        int32_t intrep;
+    } number;
+
+    int32_t e;
+    float32_t m, s, s2;
+
+    number.value = x;
+    e = ((number.intrep >> 23) & 0xFF) - 127;
+    number.intrep = (number.intrep & 0x007FFFFF) | 0x3F800000;
+    m = number.value;
+
+    if (m > 1.41421356f) {
+        m = 0.5f * m;
+        e++;
+    }
+
+    s = (m - 1.0f) / (m + 1.0f);
+    s2 = s * s;
+
+    return 0.69314718f * (float32_t)e +
+           2.0f * s * (1.0f + s2 * (1.0f / 3 + s2 * (1.0f / 5 + s2 * (1.0f / 7))));
+}
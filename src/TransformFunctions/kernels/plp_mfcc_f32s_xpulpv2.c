@@ -0,0 +1,170 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mfcc_f32s_xpulpv2.c
+ * Description:  Floating-point MFCC for XPULPV2
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/* HELPER FUNCTIONS */
+static void plp_mfcc_frame_f32(const plp_mfcc_instance_f32 *S,
+                               const float32_t *pPow,
+                               float32_t *pScratch,
+                               float32_t *pDst);
+static inline float32_t plp_mfcc_log_f32(float32_t x);
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup mfcc Mel-Frequency Cepstral Coefficients
+  The MFCC engine computes, for every frame of the STFT (see plp_stft_f32), the log-mel energies
+  \f$L[b] = \ln \sum_k w_b[k] |X[k]|^2\f$ of numBands triangular mel bands and their DCT-II
+  \f$C[j] = \sum_b L[b] \cos(\pi (b + 1/2) j / numBands)\f$, of which the first numCoeffs are
+  written. If the DCT instance is NULL, the log-mel energies are written instead.
+
+  The filterbank is stored sparse: band b only holds the weights of the FFT bins
+  pBandStart[b] .. pBandEnd[b], one after the other in pWeights. For a 40 band filterbank of a 512
+  point FFT this are about 500 instead of 40*257 weights and MACs.
+
+  The logarithm does not use libm. The floating-point version splits the number into exponent and
+  mantissa m in [sqrt(1/2), sqrt(2)) and evaluates ln(m) = 2 atanh((m-1)/(m+1)) with 4 terms of
+  the series, the error is below 1e-7. Energies below the smallest normal number give about -88.
+  The fixed-point versions accumulate the Q2.30 power spectrum with the Q1.15 weights in 64 bit,
+  normalize the sum with count leading zeros and evaluate log2 of the mantissa with a polynomial
+  of degree 4 in Q15. The log-mel energies are in Q5.10, an energy of zero gives ln(2^-45). The
+  cepstral coefficients are computed with plp_dct2_q16 and hence scaled by 1/numBands.
+
+  The DCT uses the numBands point DCT-II, e.g. plp_dct2_sR_f32_len40. plp_mfcc_sR_f32_len512 and
+  plp_mfcc_sR_q16_len512 hold 40 bands between 20 Hz and 8 kHz for a 512 point FFT at 16 kHz and
+  13 coefficients.
+
+  The parallel versions process nPE frames at a time: the STFT of the frames is computed with the
+  parallel STFT, which gives one frame to each core, then every core computes the log-mel
+  energies and the DCT of its frame.
+
+  The temporary buffer pBuf holds 2N+2+3*numBands values per core: the buffer of the FFT (N
+  values), the power spectrum (N/2+1 values, in the fixed-point versions 32 bit each) and the
+  log-mel energies, the buffer and the output of the DCT.
+ */
+
+/**
+  @addtogroup mfcc
+  @{
+ */
+
+/**
+   @brief  Floating-point MFCC for XPULPV2.
+   @param[in]      S          points to an instance of the floating-point MFCC structure
+   @param[in,out]  pStft      points to an instance of the floating-point STFT structure
+   @param[in]      pSrc       points to the input buffer of numFrames*hopLen values
+   @param[in]      numFrames  number of frames
+   @param[in]      pBuf       points to a temporary buffer of 2N+2+3*numBands values
+   @param[out]     pDst       points to the output buffer of numFrames*numCoeffs values
+   @return         none
+*/
+void plp_mfcc_f32s_xpulpv2(const plp_mfcc_instance_f32 *S,
+                           plp_stft_instance_f32 *pStft,
+                           const float32_t *__restrict__ pSrc,
+                           uint32_t numFrames,
+                           float32_t *__restrict__ pBuf,
+                           float32_t *__restrict__ pDst) {
+
+    uint32_t f;
+    uint32_t N = pStft->pRfft->FFTLength;
+    uint32_t hop = pStft->hopLen;
+    uint32_t numOut = (S->pDct) ? S->numCoeffs : S->numBands;
+    float32_t *pPow = pBuf + N;
+    float32_t *pScratch = pBuf + 2 * N + 2;
+
+    for (f = 0; f < numFrames; f++) {
+        plp_stft_f32s_xpulpv2(pStft, pSrc + f * hop, 1, pBuf, pPow);
+        plp_mfcc_frame_f32(S, pPow, pScratch, pDst + f * numOut);
+    }
+}
+
+/**
+   @} end of mfcc group
+*/
+
+/* mel filterbank, logarithm and DCT of one power spectrum */
+static void plp_mfcc_frame_f32(const plp_mfcc_instance_f32 *S,
+                               const float32_t *pPow,
+                               float32_t *pScratch,
+                               float32_t *pDst) {
+
+    uint32_t b, k;
+    uint32_t numBands = S->numBands;
+    const float32_t *pW = S->pWeights;
+    float32_t *pMel = (S->pDct) ? pScratch : pDst;
+    float32_t acc;
+
+    // SPARSE MEL FILTERBANK
+    for (b = 0; b < numBands; b++) {
+        acc = 0.0f;
+        for (k = S->pBandStart[b]; k <= S->pBandEnd[b]; k++) {
+            acc += pPow[k] * (*pW++);
+        }
+        pMel[b] = plp_mfcc_log_f32(acc);
+    }
+
+    // DCT-II, only the first numCoeffs are kept
+    if (S->pDct) {
+        plp_dct2_f32s_xpulpv2(S->pDct, pMel, pScratch + numBands, pScratch + 2 * numBands);
+        for (k = 0; k < S->numCoeffs; k++) {
+            pDst[k] = pScratch[2 * numBands + k];
+        }
+    }
+}
+
+/* ln(x) = e ln(2) + 2 atanh(s), with x = 2^e m, m in [sqrt(1/2), sqrt(2)) and s = (m-1)/(m+1) */
+static inline float32_t plp_mfcc_log_f32(float32_t x) {
+
+    union {
+        float32_t value;
+        int32_t intrep;
+    } number;
+
+    int32_t e;
+    float32_t m, s, s2;
+
+    number.value = x;
+    e = ((number.intrep >> 23) & 0xFF) - 127;
+    number.intrep = (number.intrep & 0x007FFFFF) | 0x3F800000;
+    m = number.value;
+
+    if (m > 1.41421356f) {
+        m = 0.5f * m;
+        e++;
+    }
+
+    s = (m - 1.0f) / (m + 1.0f);
+    s2 = s * s;
+
+    return 0.69314718f * (float32_t)e +
+           2.0f * s * (1.0f + s2 * (1.0f / 3 + s2 * (1.0f / 5 + s2 * (1.0f / 7))));
+}
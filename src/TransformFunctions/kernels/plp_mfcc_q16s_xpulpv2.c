@@ -0,0 +1,148 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mfcc_q16s_xpulpv2.c
+ * Description:  16-bit fixed point MFCC for XPULPV2
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/* HELPER FUNCTIONS */
+static void plp_mfcc_frame_q16(const plp_mfcc_instance_q16 *S,
+                               const int32_t *pPow,
+                               uint32_t deciPoint,
+                               int16_t *pScratch,
+                               int16_t *pDst);
+static inline int16_t plp_mfcc_log_q16(uint64_t x);
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup mfcc
+  @{
+ */
+
+/**
+   @brief  16 bit fixed-point MFCC for XPULPV2. The log-mel energies are in Q5.10, the cepstral
+   coefficients are scaled by 1/numBands.
+   @param[in]      S          points to an instance of the 16 bit fixed-point MFCC structure
+   @param[in,out]  pStft      points to an instance of the 16 bit fixed-point STFT structure
+   @param[in]      pSrc       points to the input buffer of numFrames*hopLen values
+   @param[in]      numFrames  number of frames
+   @param[in]      deciPoint  decimal point for right shift
+   @param[in]      pBuf       points to a temporary buffer of 2N+2+3*numBands values
+   @param[out]     pDst       points to the output buffer of numFrames*numCoeffs values
+   @return         none
+*/
+void plp_mfcc_q16s_xpulpv2(const plp_mfcc_instance_q16 *S,
+                           plp_stft_instance_q16 *pStft,
+                           const int16_t *__restrict__ pSrc,
+                           uint32_t numFrames,
+                           uint32_t deciPoint,
+                           int16_t *__restrict__ pBuf,
+                           int16_t *__restrict__ pDst) {
+
+    uint32_t f;
+    uint32_t N = pStft->pRfft->fftLenReal;
+    uint32_t hop = pStft->hopLen;
+    uint32_t numOut = (S->pDct) ? S->numCoeffs : S->numBands;
+    int32_t *pPow = (int32_t *)(pBuf + N);
+    int16_t *pScratch = pBuf + 2 * N + 2;
+
+    for (f = 0; f < numFrames; f++) {
+        plp_stft_q16s_xpulpv2(pStft, pSrc + f * hop, 1, deciPoint, pBuf, pPow);
+        plp_mfcc_frame_q16(S, pPow, deciPoint, pScratch, pDst + f * numOut);
+    }
+}
+
+/**
+   @} end of mfcc group
+*/
+
+/* mel filterbank, logarithm and DCT of one Q2.30 power spectrum */
+static void plp_mfcc_frame_q16(const plp_mfcc_instance_q16 *S,
+                               const int32_t *pPow,
+                               uint32_t deciPoint,
+                               int16_t *pScratch,
+                               int16_t *pDst) {
+
+    uint32_t b, k;
+    uint32_t numBands = S->numBands;
+    const int16_t *pW = S->pWeights;
+    int16_t *pMel = (S->pDct) ? pScratch : pDst;
+    int64_t acc;
+
+    // SPARSE MEL FILTERBANK, the sum is in Q45
+    for (b = 0; b < numBands; b++) {
+        acc = 0;
+        for (k = S->pBandStart[b]; k <= S->pBandEnd[b]; k++) {
+            acc += (int64_t)pPow[k] * (*pW++);
+        }
+        pMel[b] = plp_mfcc_log_q16((uint64_t)acc);
+    }
+
+    // DCT-II, only the first numCoeffs are kept
+    if (S->pDct) {
+        plp_dct2_q16s_xpulpv2(S->pDct, pMel, deciPoint, pScratch + numBands,
+                              pScratch + 2 * numBands);
+        for (k = 0; k < S->numCoeffs; k++) {
+            pDst[k] = pScratch[2 * numBands + k];
+        }
+    }
+}
+
+/* ln(x / 2^45) in Q5.10. x = 2^e (1 + t) is normalized with count leading zeros, log2(1 + t) is
+ * approximated in Q15 by t (c1 + t (c2 + t (c3 + t c4))), the error is below 4e-4. */
+static inline int16_t plp_mfcc_log_q16(uint64_t x) {
+
+    uint32_t hi = (uint32_t)(x >> 32);
+    uint32_t lo = (uint32_t)x;
+    uint32_t m;
+    int32_t e, t, p;
+
+    if (hi) {
+        e = 63 - __builtin_clz(hi);
+        m = (uint32_t)(x >> (e - 30));
+    } else if (lo) {
+        e = 31 - __builtin_clz(lo);
+        m = (e >= 30) ? (lo >> (e - 30)) : (lo << (30 - e));
+    } else {
+        e = 0;
+        m = 1 << 30;
+    }
+
+    t = (int32_t)(m - (1 << 30)) >> 15; // mantissa - 1 in Q15
+
+    p = -3462;
+    p = 11928 + ((p * t) >> 15);
+    p = -22963 + ((p * t) >> 15);
+    p = 47254 + ((p * t) >> 15);
+    p = (p * t) >> 15;
+
+    // log2 in Q10, times ln(2) in Q15
+    return (int16_t)(((((e - 45) << 10) + (p >> 5)) * 22713) >> 15);
+}
@@ -0,0 +1,160 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_psd_welch_f32p_xpulpv2.c
+ * Description:  Parallel floating-point Welch power spectral density for XPULPV2
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+#include "plp_rfft_f32_butterflies.h"
+
+/* HELPER FUNCTIONS */
+static void plp_psd_welch_frame_f32(const plp_rfft_instance_f32 *S,
+                                    const float32_t *pWin,
+                                    const float32_t *pSrc,
+                                    Complex_type_f32 *pBuf,
+                                    float32_t *pAcc);
+static inline void process_split(Complex_type_f32 A,
+                                 Complex_type_f32 B,
+                                 Complex_type_f32 tw,
+                                 Complex_type_f32 *outA,
+                                 Complex_type_f32 *outB);
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup welch
+  @{
+ */
+
+/**
+   @brief  Parallel floating-point Welch power spectral density for XPULPV2. The frames are
+   distributed over the cores, each core accumulates its frames in its own buffer. The partial
+   sums are added at the end.
+   @param[in]   args    points to the plp_psd_welch_parallel_arg_f32 structure
+   @return      none
+*/
+void plp_psd_welch_f32p_xpulpv2(void *args) {
+
+    plp_psd_welch_parallel_arg_f32 *arg = (plp_psd_welch_parallel_arg_f32 *)args;
+    const plp_welch_instance_f32 *S = arg->S;
+    const float32_t *pSrc = arg->pSrc;
+    uint32_t numFrames = arg->numFrames;
+    uint32_t nPE = arg->nPE;
+    float32_t *pBuf = arg->pBuf;
+    float32_t *pDst = arg->pDst;
+
+    uint32_t f, k, c;
+    uint32_t core_id = rt_core_id();
+
+    uint32_t N = S->pRfft->FFTLength;
+    uint32_t hop = S->hopLen;
+    uint32_t numBins = N / 2 + 1;
+    float32_t scale = S->scale / (float32_t)numFrames;
+    float32_t *pPartial = pBuf + nPE * N; // accumulators of the cores 1 .. nPE-1
+    float32_t *pAcc = (core_id == 0) ? pDst : pPartial + (core_id - 1) * numBins;
+    float32_t sum;
+
+    for (k = 0; k < numBins; k++) {
+        pAcc[k] = 0.0f;
+    }
+
+    for (f = core_id; f < numFrames; f += nPE) {
+        plp_psd_welch_frame_f32(S->pRfft, S->pWindow, pSrc + f * hop,
+                                (Complex_type_f32 *)(pBuf + core_id * N), pAcc);
+    }
+
+    rt_team_barrier();
+
+    // MERGE, the partial sums of the cores are added bin by bin
+    for (k = core_id; k < numBins; k += nPE) {
+        sum = pDst[k];
+        for (c = 1; c < nPE; c++) {
+            sum += pPartial[(c - 1) * numBins + k];
+        }
+        pDst[k] = scale * sum;
+    }
+
+    rt_team_barrier();
+}
+
+/**
+   @} end of welch group
+*/
+
+/* Accumulates the power spectrum of one windowed frame to pAcc */
+static void plp_psd_welch_frame_f32(const plp_rfft_instance_f32 *S,
+                                    const float32_t *pWin,
+                                    const float32_t *pSrc,
+                                    Complex_type_f32 *pBuf,
+                                    float32_t *pAcc) {
+
+    int k;
+    int nfft = S->FFTLength >> 1;
+    int log2FFTLen = 31 - __builtin_clz(nfft);
+    const Complex_type_f32 *_tw_ptr = (const Complex_type_f32 *)S->pTwiddleFactors;
+    Complex_type_f32 xa, xb;
+
+    process_windowed_fft(pWin, NULL, 0, pSrc, pBuf, nfft, _tw_ptr);
+
+    // SPLIT STAGE, reads the packed FFT in bit-reversed order and accumulates the power spectrum
+    Complex_type_f32 z0 = pBuf[0];
+    pAcc[0] += (z0.re + z0.im) * (z0.re + z0.im);
+    pAcc[nfft] += (z0.re - z0.im) * (z0.re - z0.im);
+
+    for (k = 1; k <= (nfft >> 1); k++) {
+        process_split(pBuf[bit_rev_half(k, log2FFTLen)],
+                      pBuf[bit_rev_half(nfft - k, log2FFTLen)], _tw_ptr[k], &xa, &xb);
+        pAcc[k] += xa.re * xa.re + xa.im * xa.im;
+        if (k < nfft - k) { // X[N/4] is accumulated only once
+            pAcc[nfft - k] += xb.re * xb.re + xb.im * xb.im;
+        }
+    } // k
+}
+
+/* Split stage of the real FFT, X[k] is written to outA and conj(X[N/2-k]) to outB */
+static inline void process_split(Complex_type_f32 A,
+                                 Complex_type_f32 B,
+                                 Complex_type_f32 tw,
+                                 Complex_type_f32 *outA,
+                                 Complex_type_f32 *outB) {
+
+    Complex_type_f32 even, odd, t;
+
+    // even = (A + conj(B)) / 2, odd = (A - conj(B)) / 2j
+    even.re = 0.5f * (A.re + B.re);
+    even.im = 0.5f * (A.im - B.im);
+    odd.re = 0.5f * (A.im + B.im);
+    odd.im = 0.5f * (B.re - A.re);
+
+    t = complex_mul(tw, odd);
+
+    outA->re = even.re + t.re;
+    outA->im = even.im + t.im;
+    outB->re = even.re - t.re;
+    outB->im = even.im - t.im;
+}
@@ -0,0 +1,175 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_psd_welch_f32s_xpulpv2.c
+ * Description:  Floating-point Welch power spectral density for XPULPV2
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+#include "plp_rfft_f32_butterflies.h"
+
+/* HELPER FUNCTIONS */
+static void plp_psd_welch_frame_f32(const plp_rfft_instance_f32 *S,
+                                    const float32_t *pWin,
+                                    const float32_t *pSrc,
+                                    Complex_type_f32 *pBuf,
+                                    float32_t *pAcc);
+static inline void process_split(Complex_type_f32 A,
+                                 Complex_type_f32 B,
+                                 Complex_type_f32 tw,
+                                 Complex_type_f32 *outA,
+                                 Complex_type_f32 *outB);
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup welch Welch Spectral Density Estimation
+  Welch's method estimates the power spectral density of a signal by averaging the power spectra
+  of numFrames overlapping, windowed frames:
+  \f[
+      P[k] = \frac{scale}{numFrames} \sum_{m=0}^{numFrames-1} |X_m[k]|^2, \quad
+      X_m[k] = \sum_{n=0}^{N-1} w[n] x[m \cdot hopLen + n] e^{-j 2 \pi k n / N}
+  \f]
+  for k = 0 .. N/2. The cross-spectral density of two signals x and y averages
+  \f$X_m[k] \overline{Y_m[k]}\f$ instead, its N/2+1 complex values are stored interleaved. The
+  window, the overlap (N - hopLen) and the number of averaged frames are free, the input holds
+  (numFrames-1)*hopLen+N samples.
+
+  The spectra are not stored: the frames are transformed with the windowed real FFT of the STFT
+  (see plp_stft_f32) and the split stage of the real FFT directly adds |X_m[k]|^2 or
+  \f$X_m[k] \overline{Y_m[k]}\f$ to the accumulator. The cross spectrum uses the real FFT of both
+  frames.
+
+  The floating-point versions scale the sum by scale/numFrames, with scale = 1/sum(w[n]^2) set by
+  plp_welch_init_f32. The result is the two-sided density for a sampling rate of 1; divide by
+  fs, and double the bins 1 .. N/2-1, for the one-sided density in units^2/Hz.
+
+  The 16 bit fixed-point versions compute the spectrum X_m[k]/N of plp_rfft_q16 and accumulate
+  its power (or cross power) in Q2.30 in 32 bit. To avoid an overflow, every frame is shifted
+  right by ceil(log2(numFrames)) bits before it is added. The result is the average in Q2.30,
+  without the normalization by the window.
+
+  The parallel versions distribute the frames over the cores. Every core accumulates its frames
+  in its own buffer, then the partial sums are added and scaled, each core taking a part of the
+  bins. The accumulator of core 0 is pDst, the ones of the other cores are in pBuf.
+ */
+
+/**
+  @addtogroup welch
+  @{
+ */
+
+/**
+   @brief  Floating-point Welch power spectral density for XPULPV2.
+   @param[in]   S          points to an instance of the floating-point Welch structure
+   @param[in]   pSrc       points to the input buffer of (numFrames-1)*hopLen+N values
+   @param[in]   numFrames  number of averaged frames
+   @param[in]   pBuf       points to a temporary buffer of N values
+   @param[out]  pDst       points to the output buffer of N/2+1 values
+   @return      none
+*/
+void plp_psd_welch_f32s_xpulpv2(const plp_welch_instance_f32 *S,
+                                const float32_t *__restrict__ pSrc,
+                                uint32_t numFrames,
+                                float32_t *__restrict__ pBuf,
+                                float32_t *__restrict__ pDst) {
+
+    uint32_t f, k;
+    uint32_t N = S->pRfft->FFTLength;
+    uint32_t hop = S->hopLen;
+    float32_t scale = S->scale / (float32_t)numFrames;
+
+    for (k = 0; k <= N / 2; k++) {
+        pDst[k] = 0.0f;
+    }
+
+    for (f = 0; f < numFrames; f++) {
+        plp_psd_welch_frame_f32(S->pRfft, S->pWindow, pSrc + f * hop, (Complex_type_f32 *)pBuf,
+                                pDst);
+    }
+
+    for (k = 0; k <= N / 2; k++) {
+        pDst[k] *= scale;
+    }
+}
+
+/**
+   @} end of welch group
+*/
+
+/* Accumulates the power spectrum of one windowed frame to pAcc */
+static void plp_psd_welch_frame_f32(const plp_rfft_instance_f32 *S,
+                                    const float32_t *pWin,
+                                    const float32_t *pSrc,
+                                    Complex_type_f32 *pBuf,
+                                    float32_t *pAcc) {
+
+    int k;
+    int nfft = S->FFTLength >> 1;
+    int log2FFTLen = 31 - __builtin_clz(nfft);
+    const Complex_type_f32 *_tw_ptr = (const Complex_type_f32 *)S->pTwiddleFactors;
+    Complex_type_f32 xa, xb;
+
+    process_windowed_fft(pWin, NULL, 0, pSrc, pBuf, nfft, _tw_ptr);
+
+    // SPLIT STAGE, reads the packed FFT in bit-reversed order and accumulates the power spectrum
+    Complex_type_f32 z0 = pBuf[0];
+    pAcc[0] += (z0.re + z0.im) * (z0.re + z0.im);
+    pAcc[nfft] += (z0.re - z0.im) * (z0.re - z0.im);
+
+    for (k = 1; k <= (nfft >> 1); k++) {
+        process_split(pBuf[bit_rev_half(k, log2FFTLen)],
+                      pBuf[bit_rev_half(nfft - k, log2FFTLen)], _tw_ptr[k], &xa, &xb);
+        pAcc[k] += xa.re * xa.re + xa.im * xa.im;
+        if (k < nfft - k) { // X[N/4] is accumulated only once
+            pAcc[nfft - k] += xb.re * xb.re + xb.im * xb.im;
+        }
+    } // k
+}
+
+/* Split stage of the real FFT, X[k] is written to outA and conj(X[N/2-k]) to outB */
+static inline void process_split(Complex_type_f32 A,
+                                 Complex_type_f32 B,
+                                 Complex_type_f32 tw,
+                                 Complex_type_f32 *outA,
+                                 Complex_type_f32 *outB) {
+
+    Complex_type_f32 even, odd, t;
+
+    // even = (A + conj(B)) / 2, odd = (A - conj(B)) / 2j
+    even.re = 0.5f * (A.re + B.re);
+    even.im = 0.5f * (A.im - B.im);
+    odd.re = 0.5f * (A.im + B.im);
+    odd.im = 0.5f * (B.re - A.re);
+
+    t = complex_mul(tw, odd);
+
+    outA->re = even.re + t.re;
+    outA->im = even.im + t.im;
+    outB->re = even.re - t.re;
+    outB->im = even.im - t.im;
+}
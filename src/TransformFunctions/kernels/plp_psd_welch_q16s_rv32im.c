@@ -0,0 +1,186 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_psd_welch_q16s_rv32im.c
+ * Description:  16-bit fixed point Welch power spectral density for RV32IM
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/* HELPER FUNCTIONS */
+static void plp_psd_welch_frame_q16(const plp_rfft_instance_q16 *S,
+                                    const int16_t *pWin,
+                                    const int16_t *pSrc,
+                                    uint32_t deciPoint,
+                                    uint32_t shift,
+                                    int16_t *pBuf,
+                                    int32_t *pAcc);
+static void plp_welch_fft_q16(const plp_rfft_instance_q16 *S,
+                              const int16_t *pWin,
+                              const int16_t *pSrc,
+                              uint32_t deciPoint,
+                              int16_t *pBuf);
+static inline int16_t plp_welch_load_q16(const int16_t *pWin, const int16_t *pSrc, int i);
+static inline void plp_welch_split_q16(const int16_t *A,
+                                       const int16_t *B,
+                                       const int16_t *CoSi,
+                                       int16_t *outA,
+                                       int16_t *outB);
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup welch
+  @{
+ */
+
+/**
+   @brief  16 bit fixed-point Welch power spectral density for RV32IM. The output is in Q2.30.
+   @param[in]   S          points to an instance of the 16 bit fixed-point Welch structure
+   @param[in]   pSrc       points to the input buffer of (numFrames-1)*hopLen+N values
+   @param[in]   numFrames  number of averaged frames
+   @param[in]   deciPoint  decimal point for right shift
+   @param[in]   pBuf       points to a temporary buffer of N values
+   @param[out]  pDst       points to the output buffer of N/2+1 values
+   @return      none
+*/
+void plp_psd_welch_q16s_rv32im(const plp_welch_instance_q16 *S,
+                               const int16_t *__restrict__ pSrc,
+                               uint32_t numFrames,
+                               uint32_t deciPoint,
+                               int16_t *__restrict__ pBuf,
+                               int32_t *__restrict__ pDst) {
+
+    uint32_t f, k;
+    uint32_t N = S->pRfft->fftLenReal;
+    uint32_t hop = S->hopLen;
+    uint32_t numVals = N / 2 + 1;
+
+    // every frame is shifted right by ceil(log2(numFrames)), the sum can not overflow
+    uint32_t shift = (numFrames > 1) ? 32 - __builtin_clz(numFrames - 1) : 0;
+    uint32_t mult = ((1u << (shift + 15)) + numFrames / 2) / numFrames; // 2^shift/numFrames in Q15
+
+    for (k = 0; k < numVals; k++) {
+        pDst[k] = 0;
+    }
+
+    for (f = 0; f < numFrames; f++) {
+        plp_psd_welch_frame_q16(S->pRfft, S->pWindow, pSrc + f * hop, deciPoint, shift, pBuf,
+                                pDst);
+    }
+
+    for (k = 0; k < numVals; k++) {
+        pDst[k] = (int32_t)(((int64_t)pDst[k] * mult) >> 15);
+    }
+}
+
+/**
+   @} end of welch group
+*/
+
+/* Accumulates the Q2.30 power spectrum of one windowed frame, shifted right by shift, to pAcc */
+static void plp_psd_welch_frame_q16(const plp_rfft_instance_q16 *S,
+                                    const int16_t *pWin,
+                                    const int16_t *pSrc,
+                                    uint32_t deciPoint,
+                                    uint32_t shift,
+                                    int16_t *pBuf,
+                                    int32_t *pAcc) {
+
+    uint32_t k;
+    uint32_t nfft = S->fftLenReal >> 1;
+    const int16_t *pCoef = S->pTwiddleRFFT;
+    int16_t re, im;
+    int16_t xa[2], xb[2];
+
+    plp_welch_fft_q16(S, pWin, pSrc, deciPoint, pBuf);
+
+    // SPLIT STAGE, accumulates the power spectrum
+    re = pBuf[0] >> 1;
+    im = pBuf[1] >> 1;
+    pAcc[0] += ((int32_t)(int16_t)(re + im) * (int16_t)(re + im)) >> shift;
+    pAcc[nfft] += ((int32_t)(int16_t)(re - im) * (int16_t)(re - im)) >> shift;
+
+    for (k = 1; k <= (nfft >> 1); k++) {
+        plp_welch_split_q16(&pBuf[2 * k], &pBuf[2 * (nfft - k)], &pCoef[2 * k], xa, xb);
+        pAcc[k] += ((int32_t)xa[0] * xa[0] + (int32_t)xa[1] * xa[1]) >> shift;
+        if (k < nfft - k) { // X[N/4] is accumulated only once
+            pAcc[nfft - k] += ((int32_t)xb[0] * xb[0] + (int32_t)xb[1] * xb[1]) >> shift;
+        }
+    }
+}
+
+/* Windowed FFT of the frame pSrc[0 .. N-1], read as N/2 complex values, in natural order */
+static void plp_welch_fft_q16(const plp_rfft_instance_q16 *S,
+                              const int16_t *pWin,
+                              const int16_t *pSrc,
+                              uint32_t deciPoint,
+                              int16_t *pBuf) {
+
+    uint32_t k;
+
+    // PACKING, loads and windows the frame
+    for (k = 0; k < S->fftLenReal; k++) {
+        pBuf[k] = plp_welch_load_q16(pWin, pSrc, k);
+    }
+
+    plp_cfft_q16s_rv32im(S->pCfft, pBuf, 0, 1, deciPoint);
+}
+
+static inline int16_t plp_welch_load_q16(const int16_t *pWin, const int16_t *pSrc, int i) {
+
+    return (int16_t)(((int32_t)pSrc[i] * pWin[i]) >> 15);
+}
+
+/* Split stage of plp_rfft_q16s_rv32im, the inputs are halved before the sums. X[k] is written to
+ * outA and conj(X[N/2-k]) to outB. */
+static inline void plp_welch_split_q16(const int16_t *A,
+                                       const int16_t *B,
+                                       const int16_t *CoSi,
+                                       int16_t *outA,
+                                       int16_t *outB) {
+    int16_t xe, ye, xo, yo, xt, yt;
+    int16_t cosVal = CoSi[0];
+    int16_t sinVal = CoSi[1];
+
+    /* e = a + conj(b), o = (a - conj(b)) / j */
+    xe = (A[0] >> 1) + (B[0] >> 1);
+    ye = (A[1] >> 1) - (B[1] >> 1);
+    xo = (A[1] >> 1) + (B[1] >> 1);
+    yo = (B[0] >> 1) - (A[0] >> 1);
+
+    xt = (int16_t)((((int32_t)xo * cosVal) + ((int32_t)yo * sinVal)) >> 16);
+    yt = (int16_t)((((int32_t)yo * cosVal) - ((int32_t)xo * sinVal)) >> 16);
+
+    xe = xe >> 1;
+    ye = ye >> 1;
+
+    outA[0] = xe + xt;
+    outA[1] = ye + yt;
+    outB[0] = xe - xt;
+    outB[1] = ye - yt;
+}
@@ -0,0 +1,324 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_rfft_f32_butterflies.h
+ * Description:  Radix-4/2 butterflies of the floating-point real FFT for XPULPV2
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Private header of the kernels built on the packed N/2-point complex FFT of the real FFT
+ * (plp_rfft_f32, plp_rifft_f32, plp_stft_f32, plp_psd_welch_f32, plp_csd_welch_f32). It is not
+ * installed, the kernels include it by a relative path.
+ *
+ * The twiddle table holds W_N^k, k = 0 .. N/2-1, for the real FFT length N. A butterfly of the
+ * packed FFT with twiddle stride butt reads the entries 2 * d * butt. The radix-4 stages keep the
+ * bit-reversed output order of the radix-2 algorithm, so the split stage reads the packed
+ * spectrum with bit_rev_half.
+ *
+ * The windowed first stage loads frame sample i from pHist[i] for i < histLen and from
+ * pNew[i - histLen] otherwise, i.e. from the history and the new samples of the STFT ring buffer.
+ * A single contiguous frame is passed with pHist = NULL and histLen = 0.
+ */
+
+#ifndef __PLP_RFFT_F32_BUTTERFLIES_H__
+#define __PLP_RFFT_F32_BUTTERFLIES_H__
+
+#include "plp_math.h"
+
+/* bit reversal of the log2FFTLen low bits of index, i.e. for the packed FFT of length
+ * FFTLength/2, computed with a single p.bitrev instead of a lookup table */
+static inline int bit_rev_half(int index, int log2FFTLen) {
+
+    return __BITREV(index, 32 - log2FFTLen, 0);
+}
+
+static inline Complex_type_f32 complex_mul(Complex_type_f32 A, Complex_type_f32 B) {
+
+    Complex_type_f32 result;
+    result.re = A.re * B.re - A.im * B.im;
+    result.im = A.re * B.im + A.im * B.re;
+    return result;
+}
+
+static inline void radix4_core(Complex_type_f32 x0,
+                               Complex_type_f32 x1,
+                               Complex_type_f32 x2,
+                               Complex_type_f32 x3,
+                               Complex_type_f32 *output,
+                               int twiddle_index,
+                               int index,
+                               int distance,
+                               const Complex_type_f32 *twiddle_ptr,
+                               int twiddle_len) {
+
+    Complex_type_f32 s02, d02, s13, d13, r1, r2, r3;
+
+    s02.re = x0.re + x2.re;
+    s02.im = x0.im + x2.im;
+    d02.re = x0.re - x2.re;
+    d02.im = x0.im - x2.im;
+    s13.re = x1.re + x3.re;
+    s13.im = x1.im + x3.im;
+    d13.re = x1.re - x3.re;
+    d13.im = x1.im - x3.im;
+
+    // r1 = s02 - s13, r2 = d02 - j d13, r3 = d02 + j d13
+    r1.re = s02.re - s13.re;
+    r1.im = s02.im - s13.im;
+    r2.re = d02.re + d13.im;
+    r2.im = d02.im - d13.re;
+    r3.re = d02.re - d13.im;
+    r3.im = d02.im + d13.re;
+
+    // the table holds W^0 .. W^(twiddle_len - 1), W^(k + twiddle_len) = -W^k
+    Complex_type_f32 tw1 = twiddle_ptr[twiddle_index];
+    Complex_type_f32 tw2 = twiddle_ptr[2 * twiddle_index];
+    Complex_type_f32 tw3;
+    if (3 * twiddle_index < twiddle_len) {
+        tw3 = twiddle_ptr[3 * twiddle_index];
+    } else {
+        tw3 = twiddle_ptr[3 * twiddle_index - twiddle_len];
+        tw3.re = -tw3.re;
+        tw3.im = -tw3.im;
+    }
+
+    // the outputs are in bit-reversed order, as after two radix-2 stages
+    output[index] = (Complex_type_f32){ s02.re + s13.re, s02.im + s13.im };
+    output[index + distance] = complex_mul(tw2, r1);
+    output[index + 2 * distance] = complex_mul(tw1, r2);
+    output[index + 3 * distance] = complex_mul(tw3, r3);
+}
+
+/* radix-4 butterfly, output may be equal to input */
+static inline void process_butterfly_radix4(const Complex_type_f32 *input,
+                                            Complex_type_f32 *output,
+                                            int twiddle_index,
+                                            int index,
+                                            int distance,
+                                            const Complex_type_f32 *twiddle_ptr,
+                                            int twiddle_len) {
+
+    radix4_core(input[index], input[index + distance], input[index + 2 * distance],
+                input[index + 3 * distance], output, twiddle_index, index, distance, twiddle_ptr,
+                twiddle_len);
+}
+
+static inline Complex_type_f32 load_windowed(const float32_t *pWin,
+                                             const float32_t *pHist,
+                                             int histLen,
+                                             const float32_t *pNew,
+                                             int index) {
+
+    int i = 2 * index;
+    float32_t re = (i < histLen) ? pHist[i] : pNew[i - histLen];
+    float32_t im = (i + 1 < histLen) ? pHist[i + 1] : pNew[i + 1 - histLen];
+
+    return (Complex_type_f32){ re * pWin[i], im * pWin[i + 1] };
+}
+
+/* radix-4 butterfly of the first stage, loads and windows the packed real frame */
+static inline void process_butterfly_first_radix4(const float32_t *pWin,
+                                                  const float32_t *pHist,
+                                                  int histLen,
+                                                  const float32_t *pNew,
+                                                  Complex_type_f32 *output,
+                                                  int twiddle_index,
+                                                  int index,
+                                                  int distance,
+                                                  const Complex_type_f32 *twiddle_ptr,
+                                                  int twiddle_len) {
+
+    radix4_core(load_windowed(pWin, pHist, histLen, pNew, index),
+                load_windowed(pWin, pHist, histLen, pNew, index + distance),
+                load_windowed(pWin, pHist, histLen, pNew, index + 2 * distance),
+                load_windowed(pWin, pHist, histLen, pNew, index + 3 * distance), output,
+                twiddle_index, index, distance, twiddle_ptr, twiddle_len);
+}
+
+static inline void process_butterfly_last_radix4(Complex_type_f32 *input, int index) {
+
+    Complex_type_f32 s02, d02, s13, d13;
+
+    Complex_type_f32 x0 = input[index];
+    Complex_type_f32 x1 = input[index + 1];
+    Complex_type_f32 x2 = input[index + 2];
+    Complex_type_f32 x3 = input[index + 3];
+
+    s02.re = x0.re + x2.re;
+    s02.im = x0.im + x2.im;
+    d02.re = x0.re - x2.re;
+    d02.im = x0.im - x2.im;
+    s13.re = x1.re + x3.re;
+    s13.im = x1.im + x3.im;
+    d13.re = x1.re - x3.re;
+    d13.im = x1.im - x3.im;
+
+    /* In the Last step, twiddle factors are all 1 */
+    input[index] = (Complex_type_f32){ s02.re + s13.re, s02.im + s13.im };
+    input[index + 1] = (Complex_type_f32){ s02.re - s13.re, s02.im - s13.im };
+    input[index + 2] = (Complex_type_f32){ d02.re + d13.im, d02.im - d13.re };
+    input[index + 3] = (Complex_type_f32){ d02.re - d13.im, d02.im + d13.re };
+}
+
+static inline void process_butterfly_last_radix2(Complex_type_f32 *input, int index) {
+
+    Complex_type_f32 r0, r1;
+    float32_t d0 = input[index].re;
+    float32_t d1 = input[index + 1].re;
+    float32_t e0 = input[index].im;
+    float32_t e1 = input[index + 1].im;
+
+    r0.re = d0 + d1;
+    r1.re = d0 - d1;
+    r0.im = e0 + e1;
+    r1.im = e0 - e1;
+
+    /* In the Last step, twiddle factors are all 1 */
+    input[index] = r0;
+    input[index + 1] = r1;
+}
+
+/* In-place radix-4 stages of the packed FFT of length nfft, starting with the butterfly distance
+ * quad and the twiddle stride butt. The last stage is radix-4 if log2(nfft) is even and radix-2
+ * otherwise. */
+static inline void process_stages_radix4(Complex_type_f32 *pBuf,
+                                         int nfft,
+                                         int quad,
+                                         int butt,
+                                         const Complex_type_f32 *twiddle_ptr) {
+
+    int j, d, step;
+
+    // STAGES 2 -> n-1
+    while (quad > 1) {
+        step = quad << 2;
+        for (j = 0; j < nfft; j += step) {
+            for (d = 0; d < quad; d++) {
+                process_butterfly_radix4(pBuf, pBuf, 2 * d * butt, j + d, quad, twiddle_ptr,
+                                         nfft);
+            } // d
+        }     // j
+        quad = quad >> 2;
+        butt = butt << 2;
+    }
+
+    // LAST STAGE, radix-4 if log2(nfft) is even, radix-2 otherwise
+    if (quad == 1) {
+        for (j = 0; j < nfft; j += 4) {
+            process_butterfly_last_radix4(pBuf, j);
+        } // j
+    } else if ((31 - __builtin_clz(nfft)) & 1) {
+        for (j = 0; j < nfft; j += 2) {
+            process_butterfly_last_radix2(pBuf, j);
+        } // j
+    }
+}
+
+/* Same as process_stages_radix4, the butterflies of one stage are interleaved over the cores.
+ * The cores synchronize before every stage and at the end. */
+static inline void process_stages_radix4_parallel(Complex_type_f32 *pBuf,
+                                                  int nfft,
+                                                  int quad,
+                                                  int butt,
+                                                  const Complex_type_f32 *twiddle_ptr,
+                                                  int core_id,
+                                                  int nPE) {
+
+    int j, d;
+
+    // STAGES 2 -> n-1
+    while (quad > 1) {
+        rt_team_barrier();
+        for (j = core_id; j < (nfft >> 2); j += nPE) {
+            d = j & (quad - 1);
+            process_butterfly_radix4(pBuf, pBuf, 2 * d * butt, ((j - d) << 2) + d, quad,
+                                     twiddle_ptr, nfft);
+        } // j
+        quad = quad >> 2;
+        butt = butt << 2;
+    }
+
+    rt_team_barrier();
+
+    // LAST STAGE, radix-4 if log2(nfft) is even, radix-2 otherwise
+    if (quad == 1) {
+        for (j = 4 * core_id; j < nfft; j += 4 * nPE) {
+            process_butterfly_last_radix4(pBuf, j);
+        } // j
+
+        rt_team_barrier();
+    } else if ((31 - __builtin_clz(nfft)) & 1) {
+        for (j = 2 * core_id; j < nfft; j += 2 * nPE) {
+            process_butterfly_last_radix2(pBuf, j);
+        } // j
+
+        rt_team_barrier();
+    }
+}
+
+/* Windowed packed FFT of one real frame of length 2 * nfft into pBuf, in bit-reversed order */
+static inline void process_windowed_fft(const float32_t *pWin,
+                                        const float32_t *pHist,
+                                        int histLen,
+                                        const float32_t *pNew,
+                                        Complex_type_f32 *pBuf,
+                                        int nfft,
+                                        const Complex_type_f32 *twiddle_ptr) {
+
+    int j;
+    int quad = nfft >> 2; // distance of the radix-4 butterflies
+
+    // FIRST STAGE, loads and windows the frame
+    for (j = 0; j < quad; j++) {
+        process_butterfly_first_radix4(pWin, pHist, histLen, pNew, pBuf, 2 * j, j, quad,
+                                       twiddle_ptr, nfft);
+    } // j
+
+    process_stages_radix4(pBuf, nfft, quad >> 2, 4, twiddle_ptr);
+}
+
+/* Same as process_windowed_fft, computed by all cores */
+static inline void process_windowed_fft_parallel(const float32_t *pWin,
+                                                 const float32_t *pHist,
+                                                 int histLen,
+                                                 const float32_t *pNew,
+                                                 Complex_type_f32 *pBuf,
+                                                 int nfft,
+                                                 const Complex_type_f32 *twiddle_ptr,
+                                                 int core_id,
+                                                 int nPE) {
+
+    int j;
+    int quad = nfft >> 2; // distance of the radix-4 butterflies
+
+    // FIRST STAGE, loads and windows the frame
+    for (j = core_id; j < quad; j += nPE) {
+        process_butterfly_first_radix4(pWin, pHist, histLen, pNew, pBuf, 2 * j, j, quad,
+                                       twiddle_ptr, nfft);
+    } // j
+
+    process_stages_radix4_parallel(pBuf, nfft, quad >> 2, 4, twiddle_ptr, core_id, nPE);
+}
+
+#endif // __PLP_RFFT_F32_BUTTERFLIES_H__
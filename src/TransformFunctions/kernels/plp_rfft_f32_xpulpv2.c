@@ -29,24 +29,26 @@
  */
 
 #include "plp_math.h"
+#include "plp_rfft_f32_butterflies.h"
 
 /* HELPER FUNCTIONS */
 
-int bit_rev_radix2(int index, int log2FFTLen);
-static inline Complex_type_f32 complex_mul(Complex_type_f32 A, Complex_type_f32 B);
-static inline Complex_type_f32 complex_mul_real(float32_t A, Complex_type_f32 B);
-static inline void process_butterfly_real_radix2(const float32_t *input,
-                                                 Complex_type_f32 *output,
-                                                 int twiddle_index,
-                                                 int distance,
-                                                 Complex_type_f32 *twiddle_ptr);
+static inline void process_butterfly_first_radix2(const Complex_type_f32 *input,
+                                                  Complex_type_f32 *output,
+                                                  int twiddle_index,
+                                                  int index,
+                                                  int distance,
+                                                  Complex_type_f32 *twiddle_ptr);
 static inline void process_butterfly_radix2(Complex_type_f32 *input,
                                             int twiddle_index,
                                             int index,
                                             int distance,
                                             Complex_type_f32 *twiddle_ptr);
-static inline void
-process_butterfly_last_radix2(Complex_type_f32 *input, Complex_type_f32 *output, int outindex);
+static inline void process_split_radix2(Complex_type_f32 A,
+                                        Complex_type_f32 B,
+                                        Complex_type_f32 tw,
+                                        Complex_type_f32 *outA,
+                                        Complex_type_f32 *outB);
 
 /**
   @ingroup fft
@@ -55,7 +57,22 @@ process_butterfly_last_radix2(Complex_type_f32 *input, Complex_type_f32 *output,
 /**
   @defgroup fftKernels FFT Kernels
   These kernels calculate the FFT transform on the input data.
-  Supported algorithms: radix-2
+  Supported algorithms: radix-2, mixed radix-4/2
+
+  With PLP_MATH_FFT_RADIX4 defined (see plp_math.h), two consecutive radix-2 stages are merged
+  into one radix-4 stage. The merged butterfly needs 3 instead of 4 twiddle multiplications and
+  keeps the bit-reversed output order of the radix-2 algorithm. If log2 of the transform length
+  is odd, the last stage is a radix-2 stage, which needs no multiplications. The parallel
+  versions synchronize once per stage, i.e. the number of barriers is halved.
+
+  The real FFT of length N packs the real input as N/2 complex values
+  \f$z[n] = x[2n] + j x[2n+1]\f$, computes an N/2-point complex radix-2 FFT on it and recovers
+  the N-point spectrum in a split stage:
+  \f$X[k] = E[k] + W_N^k O[k]\f$, with \f$E[k] = (Z[k] + Z^*[N/2-k])/2\f$ and
+  \f$O[k] = (Z[k] - Z^*[N/2-k])/2j\f$.
+  The packed transform is computed in the upper half of the output buffer. The split stage reads
+  it in bit-reversed order and writes the spectrum in natural order, so no separate reordering
+  pass is needed.
 */
 
 /**
@@ -74,172 +91,177 @@ void plp_rfft_f32_xpulpv2(const plp_rfft_instance_f32 *S,
                           const float32_t *__restrict__ pSrc,
                           float32_t *__restrict__ pDst) {
 
-    int k, j, stage, step, d, index;
+    int j, k;
 
-    Complex_type_f32 temp;
-    int dist = S->FFTLength >> 1;
-    int nbutterfly = S->FFTLength >> 1;
-    int butt = 2; // number of butterflies in the same group
+    int nfft = S->FFTLength >> 1; // length of the packed complex FFT
+    int log2FFTLen = 31 - __builtin_clz(nfft);
+    int dist = nfft >> 1;
+    int butt = 1; // twiddle stride of the packed FFT, the table is computed for FFTLength
 
-    const float32_t *_in_ptr_real;
-    Complex_type_f32 *_in_ptr;
+    const Complex_type_f32 *_in_ptr;
+    Complex_type_f32 *_buf_ptr;
     Complex_type_f32 *_out_ptr;
     Complex_type_f32 *_tw_ptr;
 
-    // FIRST STAGE, input is real, stage=1
-    stage = 1;
-
-    _in_ptr_real = pSrc;
-    _in_ptr = (Complex_type_f32 *)pDst;
+    _in_ptr = (const Complex_type_f32 *)pSrc;
+    _out_ptr = (Complex_type_f32 *)pDst;
+    _buf_ptr = _out_ptr + nfft;
     _tw_ptr = (Complex_type_f32 *)S->pTwiddleFactors;
 
-    for (j = 0; j < nbutterfly; j++) {
-        process_butterfly_real_radix2(_in_ptr_real, _in_ptr, j, dist, _tw_ptr);
-        _in_ptr_real++;
-        _in_ptr++;
+#if defined(PLP_MATH_FFT_RADIX4)
+
+    int quad = nfft >> 2; // distance of the radix-4 butterflies
+
+    if (nfft >= 4) {
+        // FIRST STAGE, reads the packed real input and writes to the upper half of pDst
+        for (j = 0; j < quad; j++) {
+            process_butterfly_radix4(_in_ptr, _buf_ptr, 2 * j * butt, j, quad, _tw_ptr, nfft);
+        } // j
+
+        // STAGES 2 -> n
+        process_stages_radix4(_buf_ptr, nfft, quad >> 2, butt << 2, _tw_ptr);
+    } else if (nfft == 2) {
+        process_butterfly_first_radix2(_in_ptr, _buf_ptr, 0, 0, dist, _tw_ptr);
+    } else {
+        // FFTLength 2: the packed FFT of a single complex sample is the sample itself
+        _buf_ptr[0] = _in_ptr[0];
+    }
+
+#else
+
+    int d, step;
+
+    // FIRST STAGE, reads the packed real input and writes to the upper half of pDst
+    for (j = 0; j < dist; j++) {
+        process_butterfly_first_radix2(_in_ptr, _buf_ptr, 2 * j * butt, j, dist, _tw_ptr);
     } // j
 
-    stage = stage + 1;
+    // FFTLength 2: the packed FFT of a single complex sample is the sample itself
+    if (nfft == 1) {
+        _buf_ptr[0] = _in_ptr[0];
+    }
+
     dist = dist >> 1;
+    butt = butt << 1;
 
     // STAGES 2 -> n-1
     while (dist > 1) {
         step = dist << 1;
-        for (j = 0; j < butt; j++) {
-            _in_ptr = (Complex_type_f32 *)pDst;
+        for (j = 0; j < nfft; j += step) {
             for (d = 0; d < dist; d++) {
-                process_butterfly_radix2(_in_ptr, d * butt, j * step, dist, _tw_ptr);
-                _in_ptr++;
+                process_butterfly_radix2(_buf_ptr, 2 * d * butt, j + d, dist, _tw_ptr);
             } // d
         }     // j
-        stage = stage + 1;
         dist = dist >> 1;
         butt = butt << 1;
     }
 
     // LAST STAGE
-    _in_ptr = (Complex_type_f32 *)pDst;
-    index = 0;
-    for (j = 0; j < (S->FFTLength >> 1); j++) {
-        process_butterfly_last_radix2(_in_ptr, (Complex_type_f32 *)pDst, index);
-        _in_ptr += 2;
-        index += 2;
-    } // j
-
-    // ORDER VALUES
-    if (S->bitReverseFlag) {
-        int index1, index2, index3, index4;
-        _out_ptr = (Complex_type_f32 *)pDst;
-        for (j = 0; j < S->FFTLength; j += 4) {
-            if (S->pBitReverseLUT) {
-                unsigned int index12 = *((unsigned int *)(&S->pBitReverseLUT[j]));
-                unsigned int index34 = *((unsigned int *)(&S->pBitReverseLUT[j + 2]));
-                index1 = index12 & 0x0000FFFF;
-                index2 = index12 >> 16;
-                index3 = index34 & 0x0000FFFF;
-                index4 = index34 >> 16;
-            } else {
-                int log2FFTLen = log2(S->FFTLength);
-                index1 = bit_rev_radix2(j, log2FFTLen);
-                index2 = bit_rev_radix2(j + 1, log2FFTLen);
-                index3 = bit_rev_radix2(j + 2, log2FFTLen);
-                index4 = bit_rev_radix2(j + 3, log2FFTLen);
-            }
-            if (index1 > j) {
-                temp = _out_ptr[j];
-                _out_ptr[j] = _out_ptr[index1];
-                _out_ptr[index1] = temp;
-            }
-            if (index2 > j + 1) {
-                temp = _out_ptr[j + 1];
-                _out_ptr[j + 1] = _out_ptr[index2];
-                _out_ptr[index2] = temp;
-            }
-            if (index3 > j + 2) {
-                temp = _out_ptr[j + 2];
-                _out_ptr[j + 2] = _out_ptr[index3];
-                _out_ptr[index3] = temp;
-            }
-            if (index4 > j + 3) {
-                temp = _out_ptr[j + 3];
-                _out_ptr[j + 3] = _out_ptr[index4];
-                _out_ptr[index4] = temp;
-            }
-        }
+    if (nfft > 2) {
+        for (j = 0; j < nfft; j += 2) {
+            process_butterfly_last_radix2(_buf_ptr, j);
+        } // j
     }
+
+#endif
+
+    // SPLIT STAGE, the packed FFT is read in bit-reversed order
+    Complex_type_f32 z0 = _buf_ptr[0];
+    _out_ptr[0] = (Complex_type_f32){ z0.re + z0.im, 0.0f };
+    _out_ptr[nfft] = (Complex_type_f32){ z0.re - z0.im, 0.0f };
+
+    for (k = 1; k <= (nfft >> 1); k++) {
+        process_split_radix2(_buf_ptr[bit_rev_half(k, log2FFTLen)],
+                             _buf_ptr[bit_rev_half(nfft - k, log2FFTLen)], _tw_ptr[k],
+                             &_out_ptr[k], &_out_ptr[nfft - k]);
+    } // k
+
+    // UPPER HALF, conjugate symmetric
+    for (k = 1; k < nfft; k++) {
+        _out_ptr[S->FFTLength - k] = (Complex_type_f32){ _out_ptr[k].re, -_out_ptr[k].im };
+    } // k
 }
 
 /**
-   @brief  Floating-point FFT on real input data for XPULPV2 extension.
-   @param[in]   arg      points to an instance of the floating-point FFT structure
+   @brief  Floating-point FFT on real input data for XPULPV2 extension (parallel version).
+   @param[in]   args     points to a plp_rfft_parallel_arg_f32 structure
    @return      none
 */
-void plp_rfft_f32_xpulpv2_parallel(plp_rfft_parallel_arg_f32 *arg) {
+void plp_rfft_f32_xpulpv2_parallel(void *args) {
 
-    int k, j, stage, step, d, index;
+    int j, k;
 
-    plp_rfft_instance_f32 *S = arg->S;
+    plp_rfft_parallel_arg_f32 *arg = (plp_rfft_parallel_arg_f32 *)args;
+    const plp_rfft_instance_f32 *S = arg->S;
     const float32_t *pSrc = arg->pSrc;
     const uint32_t nPE = arg->nPE;
     float32_t *pDst = arg->pDst;
 
-    Complex_type_f32 temp;
-    int dist = S->FFTLength >> 1;
-    int nbutterfly = S->FFTLength >> 1;
-    int butt = 2; // number of butterflies in the same group
+    int nfft = S->FFTLength >> 1; // length of the packed complex FFT
+    int log2FFTLen = 31 - __builtin_clz(nfft);
+    int dist = nfft >> 1;
+    int butt = 1; // twiddle stride of the packed FFT, the table is computed for FFTLength
 
-    const float32_t *_in_ptr_real;
-    Complex_type_f32 *_in_ptr;
+    const Complex_type_f32 *_in_ptr;
+    Complex_type_f32 *_buf_ptr;
     Complex_type_f32 *_out_ptr;
     Complex_type_f32 *_tw_ptr;
 
     int core_id = rt_core_id();
 
-    // FIRST STAGE, input is real, stage=1
-    stage = 1;
-    _in_ptr_real = &pSrc[core_id];
-    _in_ptr = (Complex_type_f32 *)&pDst[2 * core_id];
+    _in_ptr = (const Complex_type_f32 *)pSrc;
+    _out_ptr = (Complex_type_f32 *)pDst;
+    _buf_ptr = _out_ptr + nfft;
     _tw_ptr = (Complex_type_f32 *)S->pTwiddleFactors;
 
-    for (j = 0; j < nbutterfly / nPE; j++) {
-        process_butterfly_real_radix2(_in_ptr_real, _in_ptr, j * nPE + core_id, dist, _tw_ptr);
-        _in_ptr_real += nPE;
-        _in_ptr += nPE;
-    } // j
-
-    stage = stage + 1;
-    dist = dist >> 1;
+#if defined(PLP_MATH_FFT_RADIX4)
+
+    int quad = nfft >> 2; // distance of the radix-4 butterflies
+
+    if (nfft >= 4) {
+        // FIRST STAGE, reads the packed real input and writes to the upper half of pDst
+        for (j = core_id; j < quad; j += nPE) {
+            process_butterfly_radix4(_in_ptr, _buf_ptr, 2 * j * butt, j, quad, _tw_ptr, nfft);
+        } // j
+
+        // STAGES 2 -> n, the butterflies of one stage are interleaved over the cores
+        process_stages_radix4_parallel(_buf_ptr, nfft, quad >> 2, butt << 2, _tw_ptr, core_id,
+                                       nPE);
+    } else {
+        if (core_id == 0 && nfft == 2) {
+            process_butterfly_first_radix2(_in_ptr, _buf_ptr, 0, 0, dist, _tw_ptr);
+        } else if (core_id == 0) {
+            // FFTLength 2: the packed FFT of a single complex sample is the sample itself
+            _buf_ptr[0] = _in_ptr[0];
+        }
 
-    // STAGES 2 -> n-1
-    while (dist > nPE / 2) {
         rt_team_barrier();
-        step = dist << 1;
-        for (j = 0; j < butt; j++) {
-            _in_ptr = (Complex_type_f32 *)&pDst[2 * core_id];
-            for (d = 0; d < dist / nPE; d++) {
-                process_butterfly_radix2(_in_ptr, (d * nPE + core_id) * butt, j * step, dist,
-                                         _tw_ptr);
-                _in_ptr += nPE;
-            } // d
-        }     // j
-        stage = stage + 1;
-        dist = dist >> 1;
-        butt = butt << 1;
     }
 
+#else
+
+    int d;
+
+    // FIRST STAGE, reads the packed real input and writes to the upper half of pDst
+    for (j = core_id; j < dist; j += nPE) {
+        process_butterfly_first_radix2(_in_ptr, _buf_ptr, 2 * j * butt, j, dist, _tw_ptr);
+    } // j
+
+    // FFTLength 2: the packed FFT of a single complex sample is the sample itself
+    if (nfft == 1 && core_id == 0) {
+        _buf_ptr[0] = _in_ptr[0];
+    }
+
+    dist = dist >> 1;
+    butt = butt << 1;
+
+    // STAGES 2 -> n-1, the butterflies of one stage are interleaved over the cores
     while (dist > 1) {
         rt_team_barrier();
-        step = dist << 1;
-        for (j = 0; j < butt / nPE; j++) {
-            _in_ptr = _in_ptr = (Complex_type_f32 *)pDst;
-            ;
-            for (d = 0; d < dist; d++) {
-                process_butterfly_radix2(_in_ptr, butt * d, (j * nPE + core_id) * step, dist,
-                                         _tw_ptr);
-                _in_ptr++;
-            } // d
-        }     // j
-        stage = stage + 1;
+        for (j = core_id; j < (nfft >> 1); j += nPE) {
+            d = j & (dist - 1);
+            process_butterfly_radix2(_buf_ptr, 2 * d * butt, ((j - d) << 1) + d, dist, _tw_ptr);
+        } // j
         dist = dist >> 1;
         butt = butt << 1;
     }
@@ -247,117 +269,66 @@ void plp_rfft_f32_xpulpv2_parallel(plp_rfft_parallel_arg_f32 *arg) {
     rt_team_barrier();
 
     // LAST STAGE
-    _in_ptr = (Complex_type_f32 *)&pDst[4 * core_id];
-    index = 2 * core_id;
-    for (j = 0; j < S->FFTLength / (2 * nPE); j++) {
-        process_butterfly_last_radix2(_in_ptr, (Complex_type_f32 *)pDst, index);
-        _in_ptr += 2 * nPE;
-        index += 2 * nPE;
-    } // j
-
-    rt_team_barrier();
+    if (nfft > 2) {
+        for (j = 2 * core_id; j < nfft; j += 2 * nPE) {
+            process_butterfly_last_radix2(_buf_ptr, j);
+        } // j
 
-    // ORDER VALUES
-    if (S->bitReverseFlag) {
-
-        int index1, index2, index3, index4;
-        _out_ptr = (Complex_type_f32 *)pDst;
-        for (j = 4 * core_id; j < S->FFTLength; j += nPE * 4) {
-            if (S->pBitReverseLUT) {
-                unsigned int index12 = *((unsigned int *)(&S->pBitReverseLUT[j]));
-                unsigned int index34 = *((unsigned int *)(&S->pBitReverseLUT[j + 2]));
-                index1 = index12 & 0x0000FFFF;
-                index2 = index12 >> 16;
-                index3 = index34 & 0x0000FFFF;
-                index4 = index34 >> 16;
-            } else {
-                int log2FFTLen = log2(S->FFTLength);
-                index1 = bit_rev_radix2(j, log2FFTLen);
-                index2 = bit_rev_radix2(j + 1, log2FFTLen);
-                index3 = bit_rev_radix2(j + 2, log2FFTLen);
-                index4 = bit_rev_radix2(j + 3, log2FFTLen);
-            }
-            if (index1 > j) {
-                temp = _out_ptr[j];
-                _out_ptr[j] = _out_ptr[index1];
-                _out_ptr[index1] = temp;
-            }
-            if (index2 > j + 1) {
-                temp = _out_ptr[j + 1];
-                _out_ptr[j + 1] = _out_ptr[index2];
-                _out_ptr[index2] = temp;
-            }
-            if (index3 > j + 2) {
-                temp = _out_ptr[j + 2];
-                _out_ptr[j + 2] = _out_ptr[index3];
-                _out_ptr[index3] = temp;
-            }
-            if (index4 > j + 3) {
-                temp = _out_ptr[j + 3];
-                _out_ptr[j + 3] = _out_ptr[index4];
-                _out_ptr[index4] = temp;
-            }
-        }
         rt_team_barrier();
     }
-}
 
-/**
-   @} end of fftKernels group
-*/
+#endif
 
-int bit_rev_radix2(int index, int log2FFTLen) {
-
-    unsigned int revNum = 0;
-    unsigned i;
-
-    for (i = 0; i < log2FFTLen; i++) {
-        unsigned int temp = (index & (1 << i));
-        if (temp != 0)
-            revNum |= (1 << ((log2FFTLen - 1) - i));
+    // SPLIT STAGE, the packed FFT is read in bit-reversed order
+    if (core_id == 0) {
+        Complex_type_f32 z0 = _buf_ptr[0];
+        _out_ptr[0] = (Complex_type_f32){ z0.re + z0.im, 0.0f };
+        _out_ptr[nfft] = (Complex_type_f32){ z0.re - z0.im, 0.0f };
     }
 
-    return revNum;
-}
+    for (k = core_id + 1; k <= (nfft >> 1); k += nPE) {
+        process_split_radix2(_buf_ptr[bit_rev_half(k, log2FFTLen)],
+                             _buf_ptr[bit_rev_half(nfft - k, log2FFTLen)], _tw_ptr[k],
+                             &_out_ptr[k], &_out_ptr[nfft - k]);
+    } // k
 
-static inline Complex_type_f32 complex_mul(Complex_type_f32 A, Complex_type_f32 B) {
-
-    Complex_type_f32 result;
-    result.re = A.re * B.re - A.im * B.im;
-    result.im = A.re * B.im + A.im * B.re;
-    return result;
-}
+    rt_team_barrier();
 
-static inline Complex_type_f32 complex_mul_real(float32_t A, Complex_type_f32 B) {
+    // UPPER HALF, conjugate symmetric
+    for (k = core_id + 1; k < nfft; k += nPE) {
+        _out_ptr[S->FFTLength - k] = (Complex_type_f32){ _out_ptr[k].re, -_out_ptr[k].im };
+    } // k
 
-    Complex_type_f32 result;
-    result.re = A * B.re;
-    result.im = A * B.im;
-    return result;
+    rt_team_barrier();
 }
 
-static inline void process_butterfly_real_radix2(const float32_t *input,
-                                                 Complex_type_f32 *output,
-                                                 int twiddle_index,
-                                                 int distance,
-                                                 Complex_type_f32 *twiddle_ptr) {
+/**
+   @} end of fftKernels group
+*/
 
-    int index = 0;
-    float32_t d0 = input[index];
-    float32_t d1 = input[index + distance];
+static inline void process_butterfly_first_radix2(const Complex_type_f32 *input,
+                                                  Complex_type_f32 *output,
+                                                  int twiddle_index,
+                                                  int index,
+                                                  int distance,
+                                                  Complex_type_f32 *twiddle_ptr) {
 
     Complex_type_f32 r0, r1;
 
-    // Re(c1*c2) = c1.re*c2.re - c1.im*c2.im, since c1 is real = c1.re*c2.re
+    float32_t d0 = input[index].re;
+    float32_t d1 = input[index + distance].re;
+    float32_t e0 = input[index].im;
+    float32_t e1 = input[index + distance].im;
+
     r0.re = d0 + d1;
-    r0.im = 0.0f;
     r1.re = d0 - d1;
+    r0.im = e0 + e1;
+    r1.im = e0 - e1;
 
     Complex_type_f32 tw0 = twiddle_ptr[twiddle_index];
 
     output[index] = r0;
-    // printf("%f %f\n", r0.re, r0.im);
-    output[index + distance] = complex_mul_real(r1.re, tw0);
+    output[index + distance] = complex_mul(tw0, r1);
 }
 
 static inline void process_butterfly_radix2(Complex_type_f32 *input,
@@ -389,25 +360,26 @@ static inline void process_butterfly_radix2(Complex_type_f32 *input,
     input[index + distance] = complex_mul(tw0, r1);
 }
 
-static inline void
-process_butterfly_last_radix2(Complex_type_f32 *input, Complex_type_f32 *output, int outindex) {
+static inline void process_split_radix2(Complex_type_f32 A,
+                                        Complex_type_f32 B,
+                                        Complex_type_f32 tw,
+                                        Complex_type_f32 *outA,
+                                        Complex_type_f32 *outB) {
 
-    int index = 0;
-    Complex_type_f32 r0, r1;
-    float32_t d0 = input[index].re;
-    float32_t d1 = input[index + 1].re;
-    float32_t e0 = input[index].im;
-    float32_t e1 = input[index + 1].im;
-    // Re(c1*c2) = c1.re*c2.re - c1.im*c2.im
-    r0.re = d0 + d1;
-    r1.re = d0 - d1;
+    Complex_type_f32 even, odd, t;
 
-    // Im(c1*c2) = c1.re*c2.im + c1.im*c2.re
+    // even = (A + conj(B)) / 2, odd = (A - conj(B)) / 2j
+    even.re = 0.5f * (A.re + B.re);
+    even.im = 0.5f * (A.im - B.im);
+    odd.re = 0.5f * (A.im + B.im);
+    odd.im = 0.5f * (B.re - A.re);
 
-    r0.im = e0 + e1;
-    r1.im = e0 - e1;
+    t = complex_mul(tw, odd);
 
-    /* In the Last step, twiddle factors are all 1 */
-    output[outindex] = r0;
-    output[outindex + 1] = r1;
+    // X[k] = even + W^k odd, X[N/2-k] = conj(even - W^k odd)
+    outA->re = even.re + t.re;
+    outA->im = even.im + t.im;
+    outB->re = even.re - t.re;
+    outB->im = t.im - even.im;
 }
+
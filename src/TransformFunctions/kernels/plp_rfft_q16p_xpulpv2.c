@@ -0,0 +1,124 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_rfft_q16p_xpulpv2.c
+ * Description:  Parallel 16-bit fixed point Fast Fourier Transform on real input data
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+static inline void plp_rfft_split_q16(v2s A, v2s B, v2s CoSi, v2s *outA, v2s *outB);
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief      Parallel quantized 16 bit real fast fourier transform for XPULPV2. The packed
+ * complex FFT is computed with plp_cfft_q16p_xpulpv2, the split stage and the conjugate
+ * symmetric upper half are distributed over the cores. The split stage reads the complex FFT
+ * output at bit reversed indices, so the FFT skips its bit reversal pass. The output is
+ * identical to the one of plp_rfft_q16s_xpulpv2.
+ * @param[in]  args  points to the plp_rfft_parallel_arg_q16 structure
+ */
+
+void plp_rfft_q16p_xpulpv2(void *args) {
+
+    plp_rfft_parallel_arg_q16 *arg = (plp_rfft_parallel_arg_q16 *)args;
+    const plp_rfft_instance_q16 *S = arg->S;
+    uint32_t nPE = arg->nPE;
+    uint32_t core_id = rt_core_id();
+
+    uint32_t k;
+    uint32_t nfft = S->fftLenReal >> 1; // length of the packed complex FFT
+    uint32_t shift = 32 - __FL1(nfft); // reverses log2(nfft) bits
+    uint32_t i, j;
+    const v2s *pIn = (const v2s *)arg->pSrc;
+    v2s *pOut = (v2s *)arg->pDst;
+    v2s *pBuf = pOut + nfft;
+    const v2s *pCoef = (const v2s *)S->pTwiddleRFFT;
+    v2s z0;
+
+    for (k = core_id; k < nfft; k += nPE) {
+        pBuf[k] = pIn[k];
+    }
+
+    rt_team_barrier();
+
+    plp_cfft_parallel_arg_q16 cfft_arg =
+        (plp_cfft_parallel_arg_q16){ S->pCfft, (int16_t *)pBuf, 0, 0, arg->deciPoint, nPE };
+    plp_cfft_q16p_xpulpv2((void *)&cfft_arg);
+
+    // SPLIT STAGE
+    if (core_id == 0) {
+        z0 = __SRA2(pBuf[0], ((v2s){ 1, 1 }));
+        pOut[0] = __PACK2(z0[0] + z0[1], 0);
+        pOut[nfft] = __PACK2(z0[0] - z0[1], 0);
+    }
+
+    for (k = core_id + 1; k <= (nfft >> 1); k += nPE) {
+        i = __BITREV(k, shift, 0);
+        j = __BITREV(nfft - k, shift, 0);
+        plp_rfft_split_q16(pBuf[i], pBuf[j], pCoef[k], &pOut[k], &pOut[nfft - k]);
+    }
+
+    rt_team_barrier();
+
+    // UPPER HALF, conjugate symmetric
+    for (k = core_id + 1; k < nfft; k += nPE) {
+        pOut[2 * nfft - k] = __PACK2(pOut[k][0], -pOut[k][1]);
+    }
+
+    rt_team_barrier();
+}
+
+/**
+ * @} end of FFT group
+ */
+
+/* The inputs are halved before the sums, t is W_N^k O[k] / 2 */
+static inline void plp_rfft_split_q16(v2s A, v2s B, v2s CoSi, v2s *outA, v2s *outB) {
+    v2s a, b, e, o, t;
+
+    a = __SRA2(A, ((v2s){ 1, 1 }));
+    b = __SRA2(B, ((v2s){ 1, 1 }));
+
+    /* e = a + conj(b), o = (a - conj(b)) / j */
+    e = __PACK2(a[0] + b[0], a[1] - b[1]);
+    o = __PACK2(a[1] + b[1], b[0] - a[0]);
+
+    t = __PACK2((int16_t)(__DOTP2(CoSi, o) >> 16),
+                (int16_t)(__DOTP2(__PACK2(-CoSi[1], CoSi[0]), o) >> 16));
+
+    e = __SRA2(e, ((v2s){ 1, 1 }));
+
+    *outA = __ADD2(e, t);
+    t = __SUB2(e, t);
+    *outB = __PACK2(t[0], -t[1]);
+}
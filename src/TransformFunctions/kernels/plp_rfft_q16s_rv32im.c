@@ -0,0 +1,147 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_rfft_q16s_rv32im.c
+ * Description:  16-bit fixed point Fast Fourier Transform on real input data
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+static inline void plp_rfft_split_q16(const int16_t *A,
+                                      const int16_t *B,
+                                      const int16_t *CoSi,
+                                      int16_t *outA,
+                                      int16_t *outB);
+static inline uint32_t plp_bitrev_rv32im(uint32_t x, uint32_t shift);
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief      Quantized 16 bit real fast fourier transform for RV32IM
+ *
+ * The real input is packed as N/2 complex values z[n] = x[2n] + j x[2n+1], which are transformed
+ * in the upper half of pDst with plp_cfft_q16s_rv32im and split into the spectrum of the real
+ * signal: X[k] = E[k] + W_N^k O[k], with E[k] = (Z[k] + Z*[N/2-k])/2 and
+ * O[k] = (Z[k] - Z*[N/2-k])/2j. The split stage scales by 1/2, so the output is X/N like the
+ * output of the complex FFT. The complex FFT output is left in bit reversed order and the
+ * split stage reads it at bit reversed indices, which saves the bit reversal pass.
+ *
+ * @param[in]  S           points to an instance of the 16bit quantized RFFT structure
+ * @param[in]  pSrc        points to the input buffer (real data)
+ * @param[in]  deciPoint   decimal point for right shift
+ * @param[out] pDst        points to the output buffer (complex data)
+ */
+
+void plp_rfft_q16s_rv32im(const plp_rfft_instance_q16 *S,
+                          const int16_t *__restrict__ pSrc,
+                          uint32_t deciPoint,
+                          int16_t *__restrict__ pDst) {
+
+    uint32_t k;
+    uint32_t nfft = S->fftLenReal >> 1; // length of the packed complex FFT
+    uint32_t shift = __builtin_clz(nfft) + 1; // reverses log2(nfft) bits
+    uint32_t i, j;
+    int16_t *pBuf = pDst + 2 * nfft;
+    const int16_t *pCoef = S->pTwiddleRFFT;
+    int16_t re, im;
+
+    for (k = 0; k < 2 * nfft; k++) {
+        pBuf[k] = pSrc[k];
+    }
+
+    plp_cfft_q16s_rv32im(S->pCfft, pBuf, 0, 0, deciPoint);
+
+    // SPLIT STAGE
+    re = pBuf[0] >> 1;
+    im = pBuf[1] >> 1;
+    pDst[0] = re + im;
+    pDst[1] = 0;
+    pDst[2 * nfft] = re - im;
+    pDst[2 * nfft + 1] = 0;
+
+    for (k = 1; k <= (nfft >> 1); k++) {
+        i = plp_bitrev_rv32im(k, shift);
+        j = plp_bitrev_rv32im(nfft - k, shift);
+        plp_rfft_split_q16(&pBuf[2 * i], &pBuf[2 * j], &pCoef[2 * k], &pDst[2 * k],
+                           &pDst[2 * (nfft - k)]);
+    }
+
+    // UPPER HALF, conjugate symmetric
+    for (k = 1; k < nfft; k++) {
+        pDst[2 * (2 * nfft - k)] = pDst[2 * k];
+        pDst[2 * (2 * nfft - k) + 1] = -pDst[2 * k + 1];
+    }
+}
+
+/**
+ * @} end of FFT group
+ */
+
+/* The inputs are halved before the sums, (xt, yt) is W_N^k O[k] / 2 */
+static inline void plp_rfft_split_q16(const int16_t *A,
+                                      const int16_t *B,
+                                      const int16_t *CoSi,
+                                      int16_t *outA,
+                                      int16_t *outB) {
+    int16_t xe, ye, xo, yo, xt, yt;
+    int16_t cosVal = CoSi[0];
+    int16_t sinVal = CoSi[1];
+
+    /* e = a + conj(b), o = (a - conj(b)) / j */
+    xe = (A[0] >> 1) + (B[0] >> 1);
+    ye = (A[1] >> 1) - (B[1] >> 1);
+    xo = (A[1] >> 1) + (B[1] >> 1);
+    yo = (B[0] >> 1) - (A[0] >> 1);
+
+    xt = (int16_t)((((int32_t)xo * cosVal) + ((int32_t)yo * sinVal)) >> 16);
+    yt = (int16_t)((((int32_t)yo * cosVal) - ((int32_t)xo * sinVal)) >> 16);
+
+    xe >>= 1;
+    ye >>= 1;
+
+    outA[0] = xe + xt;
+    outA[1] = ye + yt;
+    outB[0] = xe - xt;
+    outB[1] = yt - ye;
+}
+
+/* Reverses the 32 bits of x with five mask and shift steps, the result is shifted right by shift,
+ * i.e. the 32 - shift low bits of x are reversed. */
+static inline uint32_t plp_bitrev_rv32im(uint32_t x, uint32_t shift) {
+
+    x = ((x >> 1) & 0x55555555) | ((x & 0x55555555) << 1);
+    x = ((x >> 2) & 0x33333333) | ((x & 0x33333333) << 2);
+    x = ((x >> 4) & 0x0F0F0F0F) | ((x & 0x0F0F0F0F) << 4);
+    x = ((x >> 8) & 0x00FF00FF) | ((x & 0x00FF00FF) << 8);
+    x = (x >> 16) | (x << 16);
+
+    return x >> shift;
+}
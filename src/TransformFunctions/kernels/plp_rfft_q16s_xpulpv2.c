@@ -0,0 +1,119 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_rfft_q16s_xpulpv2.c
+ * Description:  16-bit fixed point Fast Fourier Transform on real input data
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+static inline void plp_rfft_split_q16(v2s A, v2s B, v2s CoSi, v2s *outA, v2s *outB);
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief      Quantized 16 bit real fast fourier transform for XPULPV2
+ *
+ * The real input is packed as N/2 complex values z[n] = x[2n] + j x[2n+1], which are transformed
+ * in the upper half of pDst with plp_cfft_q16s_xpulpv2 and split into the spectrum of the real
+ * signal: X[k] = E[k] + W_N^k O[k], with E[k] = (Z[k] + Z*[N/2-k])/2 and
+ * O[k] = (Z[k] - Z*[N/2-k])/2j. The split stage scales by 1/2, so the output is X/N like the
+ * output of the complex FFT. The complex FFT output is left in bit reversed order and the
+ * split stage reads it at bit reversed indices, which saves the bit reversal pass.
+ *
+ * @param[in]  S           points to an instance of the 16bit quantized RFFT structure
+ * @param[in]  pSrc        points to the input buffer (real data)
+ * @param[in]  deciPoint   decimal point for right shift
+ * @param[out] pDst        points to the output buffer (complex data)
+ */
+
+void plp_rfft_q16s_xpulpv2(const plp_rfft_instance_q16 *S,
+                           const int16_t *__restrict__ pSrc,
+                           uint32_t deciPoint,
+                           int16_t *__restrict__ pDst) {
+
+    uint32_t k;
+    uint32_t nfft = S->fftLenReal >> 1; // length of the packed complex FFT
+    uint32_t shift = 32 - __FL1(nfft); // reverses log2(nfft) bits
+    uint32_t i, j;
+    const v2s *pIn = (const v2s *)pSrc;
+    v2s *pOut = (v2s *)pDst;
+    v2s *pBuf = pOut + nfft;
+    const v2s *pCoef = (const v2s *)S->pTwiddleRFFT;
+    v2s z0;
+
+    for (k = 0; k < nfft; k++) {
+        pBuf[k] = pIn[k];
+    }
+
+    plp_cfft_q16s_xpulpv2(S->pCfft, (int16_t *)pBuf, 0, 0, deciPoint);
+
+    // SPLIT STAGE
+    z0 = __SRA2(pBuf[0], ((v2s){ 1, 1 }));
+    pOut[0] = __PACK2(z0[0] + z0[1], 0);
+    pOut[nfft] = __PACK2(z0[0] - z0[1], 0);
+
+    for (k = 1; k <= (nfft >> 1); k++) {
+        i = __BITREV(k, shift, 0);
+        j = __BITREV(nfft - k, shift, 0);
+        plp_rfft_split_q16(pBuf[i], pBuf[j], pCoef[k], &pOut[k], &pOut[nfft - k]);
+    }
+
+    // UPPER HALF, conjugate symmetric
+    for (k = 1; k < nfft; k++) {
+        pOut[2 * nfft - k] = __PACK2(pOut[k][0], -pOut[k][1]);
+    }
+}
+
+/**
+ * @} end of FFT group
+ */
+
+/* The inputs are halved before the sums, t is W_N^k O[k] / 2 */
+static inline void plp_rfft_split_q16(v2s A, v2s B, v2s CoSi, v2s *outA, v2s *outB) {
+    v2s a, b, e, o, t;
+
+    a = __SRA2(A, ((v2s){ 1, 1 }));
+    b = __SRA2(B, ((v2s){ 1, 1 }));
+
+    /* e = a + conj(b), o = (a - conj(b)) / j */
+    e = __PACK2(a[0] + b[0], a[1] - b[1]);
+    o = __PACK2(a[1] + b[1], b[0] - a[0]);
+
+    t = __PACK2((int16_t)(__DOTP2(CoSi, o) >> 16),
+                (int16_t)(__DOTP2(__PACK2(-CoSi[1], CoSi[0]), o) >> 16));
+
+    e = __SRA2(e, ((v2s){ 1, 1 }));
+
+    *outA = __ADD2(e, t);
+    t = __SUB2(e, t);
+    *outB = __PACK2(t[0], -t[1]);
+}
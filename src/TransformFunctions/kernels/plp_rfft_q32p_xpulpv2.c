@@ -0,0 +1,143 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_rfft_q32p_xpulpv2.c
+ * Description:  Parallel 32-bit fixed point Fast Fourier Transform on real input data
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/* upper 32 bits of the 64 bit product, i.e. a single mulh instruction */
+#define MULH_Q32(a, b) ((int32_t)(((int64_t)(a) * (b)) >> 32))
+
+static inline void plp_rfft_split_q32(const int32_t *A,
+                                      const int32_t *B,
+                                      const int32_t *CoSi,
+                                      int32_t *outA,
+                                      int32_t *outB);
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief      Parallel quantized 32 bit real fast fourier transform for XPULPV2. The packed
+ * complex FFT is computed with plp_cfft_q32p_xpulpv2, the split stage and the conjugate
+ * symmetric upper half are distributed over the cores. The split stage reads the complex FFT
+ * output at bit reversed indices, so the FFT skips its bit reversal pass. The output is
+ * identical to the one of plp_rfft_q32s_xpulpv2.
+ * @param[in]  args  points to the plp_rfft_parallel_arg_q32 structure
+ */
+
+void plp_rfft_q32p_xpulpv2(void *args) {
+
+    plp_rfft_parallel_arg_q32 *arg = (plp_rfft_parallel_arg_q32 *)args;
+    const plp_rfft_instance_q32 *S = arg->S;
+    const int32_t *pSrc = arg->pSrc;
+    int32_t *pDst = arg->pDst;
+    uint32_t nPE = arg->nPE;
+    uint32_t core_id = rt_core_id();
+
+    uint32_t k;
+    uint32_t nfft = S->fftLenReal >> 1; // length of the packed complex FFT
+    uint32_t shift = 32 - __FL1(nfft); // reverses log2(nfft) bits
+    uint32_t i, j;
+    int32_t *pBuf = pDst + 2 * nfft;
+    const int32_t *pCoef = S->pTwiddleRFFT;
+    int32_t re, im;
+
+    for (k = core_id; k < 2 * nfft; k += nPE) {
+        pBuf[k] = pSrc[k];
+    }
+
+    rt_team_barrier();
+
+    plp_cfft_parallel_arg_q32 cfft_arg =
+        (plp_cfft_parallel_arg_q32){ S->pCfft, pBuf, 0, 0, arg->deciPoint, nPE };
+    plp_cfft_q32p_xpulpv2((void *)&cfft_arg);
+
+    // SPLIT STAGE
+    if (core_id == 0) {
+        re = pBuf[0] >> 1;
+        im = pBuf[1] >> 1;
+        pDst[0] = re + im;
+        pDst[1] = 0;
+        pDst[2 * nfft] = re - im;
+        pDst[2 * nfft + 1] = 0;
+    }
+
+    for (k = core_id + 1; k <= (nfft >> 1); k += nPE) {
+        i = __BITREV(k, shift, 0);
+        j = __BITREV(nfft - k, shift, 0);
+        plp_rfft_split_q32(&pBuf[2 * i], &pBuf[2 * j], &pCoef[2 * k], &pDst[2 * k],
+                           &pDst[2 * (nfft - k)]);
+    }
+
+    rt_team_barrier();
+
+    // UPPER HALF, conjugate symmetric
+    for (k = core_id + 1; k < nfft; k += nPE) {
+        pDst[2 * (2 * nfft - k)] = pDst[2 * k];
+        pDst[2 * (2 * nfft - k) + 1] = -pDst[2 * k + 1];
+    }
+
+    rt_team_barrier();
+}
+
+/**
+ * @} end of FFT group
+ */
+
+/* The inputs are halved before the sums, (xt, yt) is W_N^k O[k] / 2 */
+static inline void plp_rfft_split_q32(const int32_t *A,
+                                      const int32_t *B,
+                                      const int32_t *CoSi,
+                                      int32_t *outA,
+                                      int32_t *outB) {
+    int32_t xe, ye, xo, yo, xt, yt;
+    int32_t cosVal = CoSi[0];
+    int32_t sinVal = CoSi[1];
+
+    /* e = a + conj(b), o = (a - conj(b)) / j */
+    xe = (A[0] >> 1) + (B[0] >> 1);
+    ye = (A[1] >> 1) - (B[1] >> 1);
+    xo = (A[1] >> 1) + (B[1] >> 1);
+    yo = (B[0] >> 1) - (A[0] >> 1);
+
+    xt = MULH_Q32(xo, cosVal) + MULH_Q32(yo, sinVal);
+    yt = MULH_Q32(yo, cosVal) - MULH_Q32(xo, sinVal);
+
+    xe >>= 1;
+    ye >>= 1;
+
+    outA[0] = xe + xt;
+    outA[1] = ye + yt;
+    outB[0] = xe - xt;
+    outB[1] = yt - ye;
+}
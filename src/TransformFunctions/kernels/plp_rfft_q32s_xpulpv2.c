@@ -0,0 +1,136 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_rfft_q32s_xpulpv2.c
+ * Description:  32-bit fixed point Fast Fourier Transform on real input data
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/* upper 32 bits of the 64 bit product, i.e. a single mulh instruction */
+#define MULH_Q32(a, b) ((int32_t)(((int64_t)(a) * (b)) >> 32))
+
+static inline void plp_rfft_split_q32(const int32_t *A,
+                                      const int32_t *B,
+                                      const int32_t *CoSi,
+                                      int32_t *outA,
+                                      int32_t *outB);
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief      Quantized 32 bit real fast fourier transform for XPULPV2
+ *
+ * The real input is packed as N/2 complex values z[n] = x[2n] + j x[2n+1], which are transformed
+ * in the upper half of pDst with plp_cfft_q32s_rv32im and split into the spectrum of the real
+ * signal: X[k] = E[k] + W_N^k O[k], with E[k] = (Z[k] + Z*[N/2-k])/2 and
+ * O[k] = (Z[k] - Z*[N/2-k])/2j. The split stage scales by 1/2, so the output is X/N like the
+ * output of the complex FFT. The complex FFT output is left in bit reversed order and the
+ * split stage reads it at bit reversed indices, which saves the bit reversal pass.
+ *
+ * @param[in]  S           points to an instance of the 32bit quantized RFFT structure
+ * @param[in]  pSrc        points to the input buffer (real data)
+ * @param[in]  deciPoint   decimal point for right shift
+ * @param[out] pDst        points to the output buffer (complex data)
+ */
+
+void plp_rfft_q32s_xpulpv2(const plp_rfft_instance_q32 *S,
+                          const int32_t *__restrict__ pSrc,
+                          uint32_t deciPoint,
+                          int32_t *__restrict__ pDst) {
+
+    uint32_t k;
+    uint32_t nfft = S->fftLenReal >> 1; // length of the packed complex FFT
+    uint32_t shift = 32 - __FL1(nfft); // reverses log2(nfft) bits
+    uint32_t i, j;
+    int32_t *pBuf = pDst + 2 * nfft;
+    const int32_t *pCoef = S->pTwiddleRFFT;
+    int32_t re, im;
+
+    for (k = 0; k < 2 * nfft; k++) {
+        pBuf[k] = pSrc[k];
+    }
+
+    plp_cfft_q32s_rv32im(S->pCfft, pBuf, 0, 0, deciPoint);
+
+    // SPLIT STAGE
+    re = pBuf[0] >> 1;
+    im = pBuf[1] >> 1;
+    pDst[0] = re + im;
+    pDst[1] = 0;
+    pDst[2 * nfft] = re - im;
+    pDst[2 * nfft + 1] = 0;
+
+    for (k = 1; k <= (nfft >> 1); k++) {
+        i = __BITREV(k, shift, 0);
+        j = __BITREV(nfft - k, shift, 0);
+        plp_rfft_split_q32(&pBuf[2 * i], &pBuf[2 * j], &pCoef[2 * k], &pDst[2 * k],
+                           &pDst[2 * (nfft - k)]);
+    }
+
+    // UPPER HALF, conjugate symmetric
+    for (k = 1; k < nfft; k++) {
+        pDst[2 * (2 * nfft - k)] = pDst[2 * k];
+        pDst[2 * (2 * nfft - k) + 1] = -pDst[2 * k + 1];
+    }
+}
+
+/**
+ * @} end of FFT group
+ */
+
+/* The inputs are halved before the sums, (xt, yt) is W_N^k O[k] / 2 */
+static inline void plp_rfft_split_q32(const int32_t *A,
+                                      const int32_t *B,
+                                      const int32_t *CoSi,
+                                      int32_t *outA,
+                                      int32_t *outB) {
+    int32_t xe, ye, xo, yo, xt, yt;
+    int32_t cosVal = CoSi[0];
+    int32_t sinVal = CoSi[1];
+
+    /* e = a + conj(b), o = (a - conj(b)) / j */
+    xe = (A[0] >> 1) + (B[0] >> 1);
+    ye = (A[1] >> 1) - (B[1] >> 1);
+    xo = (A[1] >> 1) + (B[1] >> 1);
+    yo = (B[0] >> 1) - (A[0] >> 1);
+
+    xt = MULH_Q32(xo, cosVal) + MULH_Q32(yo, sinVal);
+    yt = MULH_Q32(yo, cosVal) - MULH_Q32(xo, sinVal);
+
+    xe >>= 1;
+    ye >>= 1;
+
+    outA[0] = xe + xt;
+    outA[1] = ye + yt;
+    outB[0] = xe - xt;
+    outB[1] = yt - ye;
+}
@@ -0,0 +1,291 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_rifft_f32_xpulpv2.c
+ * Description:  Floating-point inverse FFT with real output data for XPULPV2
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_rfft_f32_butterflies.h"
+
+/* HELPER FUNCTIONS */
+
+static inline void process_butterfly_radix2(Complex_type_f32 *input,
+                                            int twiddle_index,
+                                            int index,
+                                            int distance,
+                                            const Complex_type_f32 *twiddle_ptr);
+static inline void process_merge_radix2(Complex_type_f32 A,
+                                        Complex_type_f32 B,
+                                        Complex_type_f32 tw,
+                                        Complex_type_f32 *outA,
+                                        Complex_type_f32 *outB);
+static inline void process_output_radix2(Complex_type_f32 *input, int index, float32_t scale);
+
+/**
+  @ingroup fftKernels
+ */
+
+/**
+  @addtogroup fftKernels
+  @{
+
+  The inverse real FFT reverses the steps of the real FFT: a merge stage packs the half spectrum
+  \f$X[0 .. N/2]\f$ into \f$Z[k] = E[k] + j O[k]\f$, with \f$E[k] = X[k] + X^*[N/2-k]\f$ and
+  \f$O[k] = (X[k] - X^*[N/2-k]) W_N^{-k}\f$. The inverse N/2-point transform is computed as a
+  forward transform of \f$Z^*\f$, and the final reordering pass conjugates and scales by
+  \f$1/N\f$ and unpacks \f$z[n]\f$ into \f$x[2n]\f$ and \f$x[2n+1]\f$.
+ */
+
+/**
+   @brief  Floating-point inverse FFT with real output data for XPULPV2 extension.
+   @param[in]   S       points to an instance of the floating-point FFT structure
+   @param[in]   pSrc    points to the input buffer (complex data, bins 0 .. N/2 are used)
+   @param[out]  pDst    points to the output buffer (real data)
+   @return      none
+*/
+void plp_rifft_f32_xpulpv2(const plp_rfft_instance_f32 *S,
+                           const float32_t *__restrict__ pSrc,
+                           float32_t *__restrict__ pDst) {
+
+    int j, k, index;
+
+    int nfft = S->FFTLength >> 1; // length of the packed complex FFT
+    int log2FFTLen = 31 - __builtin_clz(nfft);
+    int butt = 1; // twiddle stride of the packed FFT, the table is computed for FFTLength
+    float32_t scale = 1.0f / S->FFTLength;
+
+    const Complex_type_f32 *_in_ptr;
+    Complex_type_f32 *_out_ptr;
+    const Complex_type_f32 *_tw_ptr;
+
+    _in_ptr = (const Complex_type_f32 *)pSrc;
+    _out_ptr = (Complex_type_f32 *)pDst;
+    _tw_ptr = (const Complex_type_f32 *)S->pTwiddleFactors;
+
+    // MERGE STAGE, writes the conjugate of the packed spectrum to pDst
+    float32_t x0 = _in_ptr[0].re;
+    float32_t xn = _in_ptr[nfft].re;
+    _out_ptr[0] = (Complex_type_f32){ x0 + xn, xn - x0 };
+
+    for (k = 1; k <= (nfft >> 1); k++) {
+        process_merge_radix2(_in_ptr[k], _in_ptr[nfft - k], _tw_ptr[k], &_out_ptr[k],
+                             &_out_ptr[nfft - k]);
+    } // k
+
+#if defined(PLP_MATH_FFT_RADIX4)
+
+    // STAGES 1 -> n
+    process_stages_radix4(_out_ptr, nfft, nfft >> 2, butt, _tw_ptr);
+
+#else
+
+    int d, step;
+
+    int dist = nfft >> 1;
+
+    // STAGES 1 -> n-1
+    while (dist > 1) {
+        step = dist << 1;
+        for (j = 0; j < nfft; j += step) {
+            for (d = 0; d < dist; d++) {
+                process_butterfly_radix2(_out_ptr, 2 * d * butt, j + d, dist, _tw_ptr);
+            } // d
+        }     // j
+        dist = dist >> 1;
+        butt = butt << 1;
+    }
+
+    // LAST STAGE, none for FFTLength 2
+    for (j = 0; j + 1 < nfft; j += 2) {
+        process_butterfly_last_radix2(_out_ptr, j);
+    } // j
+
+#endif
+
+    // ORDER VALUES, conjugate and scale
+    for (j = 0; j < nfft; j++) {
+        index = bit_rev_half(j, log2FFTLen);
+        if (index > j) {
+            Complex_type_f32 temp = _out_ptr[j];
+            _out_ptr[j] = _out_ptr[index];
+            _out_ptr[index] = temp;
+            process_output_radix2(_out_ptr, index, scale);
+        }
+        if (index >= j) {
+            process_output_radix2(_out_ptr, j, scale);
+        }
+    } // j
+}
+
+/**
+   @brief  Floating-point inverse FFT with real output data for XPULPV2 extension (parallel
+   version).
+   @param[in]   args     points to a plp_rifft_parallel_arg_f32 structure
+   @return      none
+*/
+void plp_rifft_f32_xpulpv2_parallel(void *args) {
+
+    int j, k, index;
+
+    plp_rifft_parallel_arg_f32 *arg = (plp_rifft_parallel_arg_f32 *)args;
+    const plp_rfft_instance_f32 *S = arg->S;
+    const float32_t *pSrc = arg->pSrc;
+    const uint32_t nPE = arg->nPE;
+    float32_t *pDst = arg->pDst;
+
+    int nfft = S->FFTLength >> 1; // length of the packed complex FFT
+    int log2FFTLen = 31 - __builtin_clz(nfft);
+    int butt = 1; // twiddle stride of the packed FFT, the table is computed for FFTLength
+    float32_t scale = 1.0f / S->FFTLength;
+
+    const Complex_type_f32 *_in_ptr;
+    Complex_type_f32 *_out_ptr;
+    const Complex_type_f32 *_tw_ptr;
+
+    int core_id = rt_core_id();
+
+    _in_ptr = (const Complex_type_f32 *)pSrc;
+    _out_ptr = (Complex_type_f32 *)pDst;
+    _tw_ptr = (const Complex_type_f32 *)S->pTwiddleFactors;
+
+    // MERGE STAGE, writes the conjugate of the packed spectrum to pDst
+    if (core_id == 0) {
+        float32_t x0 = _in_ptr[0].re;
+        float32_t xn = _in_ptr[nfft].re;
+        _out_ptr[0] = (Complex_type_f32){ x0 + xn, xn - x0 };
+    }
+
+    for (k = core_id + 1; k <= (nfft >> 1); k += nPE) {
+        process_merge_radix2(_in_ptr[k], _in_ptr[nfft - k], _tw_ptr[k], &_out_ptr[k],
+                             &_out_ptr[nfft - k]);
+    } // k
+
+#if defined(PLP_MATH_FFT_RADIX4)
+
+    // STAGES 1 -> n, the butterflies of one stage are interleaved over the cores. The cores
+    // synchronize after the last stage.
+    process_stages_radix4_parallel(_out_ptr, nfft, nfft >> 2, butt, _tw_ptr, core_id, nPE);
+
+#else
+
+    int d;
+
+    int dist = nfft >> 1;
+
+    // STAGES 1 -> n-1, the butterflies of one stage are interleaved over the cores
+    while (dist > 1) {
+        rt_team_barrier();
+        for (j = core_id; j < (nfft >> 1); j += nPE) {
+            d = j & (dist - 1);
+            process_butterfly_radix2(_out_ptr, 2 * d * butt, ((j - d) << 1) + d, dist, _tw_ptr);
+        } // j
+        dist = dist >> 1;
+        butt = butt << 1;
+    }
+
+    rt_team_barrier();
+
+    // LAST STAGE, none for FFTLength 2
+    for (j = 2 * core_id; j + 1 < nfft; j += 2 * nPE) {
+        process_butterfly_last_radix2(_out_ptr, j);
+    } // j
+
+    rt_team_barrier();
+
+#endif
+
+    // ORDER VALUES, conjugate and scale. Each pair is handled by the core owning the lower index.
+    for (j = core_id; j < nfft; j += nPE) {
+        index = bit_rev_half(j, log2FFTLen);
+        if (index > j) {
+            Complex_type_f32 temp = _out_ptr[j];
+            _out_ptr[j] = _out_ptr[index];
+            _out_ptr[index] = temp;
+            process_output_radix2(_out_ptr, index, scale);
+        }
+        if (index >= j) {
+            process_output_radix2(_out_ptr, j, scale);
+        }
+    } // j
+
+    rt_team_barrier();
+}
+
+/**
+   @} end of fftKernels group
+*/
+
+static inline void process_butterfly_radix2(Complex_type_f32 *input,
+                                            int twiddle_index,
+                                            int index,
+                                            int distance,
+                                            const Complex_type_f32 *twiddle_ptr) {
+
+    Complex_type_f32 r0, r1;
+
+    float32_t d0 = input[index].re;
+    float32_t d1 = input[index + distance].re;
+    float32_t e0 = input[index].im;
+    float32_t e1 = input[index + distance].im;
+
+    r0.re = d0 + d1;
+    r1.re = d0 - d1;
+    r0.im = e0 + e1;
+    r1.im = e0 - e1;
+
+    Complex_type_f32 tw0 = twiddle_ptr[twiddle_index];
+
+    input[index] = r0;
+    input[index + distance] = complex_mul(tw0, r1);
+}
+
+static inline void process_merge_radix2(Complex_type_f32 A,
+                                        Complex_type_f32 B,
+                                        Complex_type_f32 tw,
+                                        Complex_type_f32 *outA,
+                                        Complex_type_f32 *outB) {
+
+    Complex_type_f32 even, odd, t;
+
+    // even = A + conj(B), odd = (A - conj(B)) * conj(W^k)
+    even.re = A.re + B.re;
+    even.im = A.im - B.im;
+    t.re = A.re - B.re;
+    t.im = A.im + B.im;
+    odd = complex_mul(t, (Complex_type_f32){ tw.re, -tw.im });
+
+    // Z[k] = even + j odd, Z[N/2-k] = conj(even) + j conj(odd), both stored conjugated
+    outA->re = even.re - odd.im;
+    outA->im = -(even.im + odd.re);
+    outB->re = even.re + odd.im;
+    outB->im = even.im - odd.re;
+}
+
+static inline void process_output_radix2(Complex_type_f32 *input, int index, float32_t scale) {
+
+    input[index].re = scale * input[index].re;
+    input[index].im = -scale * input[index].im;
+}
+
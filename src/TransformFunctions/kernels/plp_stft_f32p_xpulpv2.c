@@ -0,0 +1,235 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_stft_f32p_xpulpv2.c
+ * Description:  Parallel floating-point short-time Fourier transform for XPULPV2
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+#include "plp_rfft_f32_butterflies.h"
+
+/* HELPER FUNCTIONS */
+static void plp_stft_frame_f32(const plp_rfft_instance_f32 *S,
+                               const float32_t *pWin,
+                               const float32_t *pHist,
+                               int histLen,
+                               const float32_t *pNew,
+                               Complex_type_f32 *pBuf,
+                               float32_t *pDst);
+static void plp_stft_frame_parallel_f32(const plp_rfft_instance_f32 *S,
+                                        const float32_t *pWin,
+                                        const float32_t *pHist,
+                                        int histLen,
+                                        const float32_t *pNew,
+                                        Complex_type_f32 *pBuf,
+                                        float32_t *pDst,
+                                        int core_id,
+                                        int nPE);
+static inline void process_split_power(Complex_type_f32 A,
+                                       Complex_type_f32 B,
+                                       Complex_type_f32 tw,
+                                       float32_t *outA,
+                                       float32_t *outB);
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup stft
+  @{
+ */
+
+/**
+   @brief  Parallel floating-point STFT for XPULPV2. With at least nPE frames, every core
+   transforms whole frames in its own part of pBuf, otherwise all cores compute one frame after
+   the other. The output is identical to the one of the serial version.
+   @param[in]   args    points to the plp_stft_parallel_arg_f32 structure
+   @return      none
+*/
+void plp_stft_f32p_xpulpv2(void *args) {
+
+    plp_stft_parallel_arg_f32 *arg = (plp_stft_parallel_arg_f32 *)args;
+    plp_stft_instance_f32 *S = arg->S;
+    const float32_t *pSrc = arg->pSrc;
+    uint32_t numFrames = arg->numFrames;
+    uint32_t nPE = arg->nPE;
+    float32_t *pBuf = arg->pBuf;
+    float32_t *pDst = arg->pDst;
+
+    uint32_t f, t, pos;
+    uint32_t core_id = rt_core_id();
+
+    uint32_t N = S->pRfft->FFTLength;
+    uint32_t hop = S->hopLen;
+    uint32_t ovl = N - hop; // length of the history
+    uint32_t total = numFrames * hop;
+    uint32_t numUpdate = (total < ovl) ? total : ovl;
+    uint32_t head = S->statePos;
+    const float32_t *pHist = S->pState + head;
+
+    if (numFrames >= nPE) {
+        // FRAMES DISTRIBUTED OVER THE CORES
+        Complex_type_f32 *pCoreBuf = (Complex_type_f32 *)(pBuf + core_id * N);
+        for (f = core_id; f < numFrames; f += nPE) {
+            uint32_t start = f * hop; // the history starts at 0, the new samples at ovl
+            if (start < ovl) {
+                plp_stft_frame_f32(S->pRfft, S->pWindow, pHist + start, ovl - start, pSrc,
+                                   pCoreBuf, pDst + f * (N / 2 + 1));
+            } else {
+                plp_stft_frame_f32(S->pRfft, S->pWindow, NULL, 0, pSrc + start - ovl, pCoreBuf,
+                                   pDst + f * (N / 2 + 1));
+            }
+        }
+    } else {
+        // ONE FRAME WITH ALL CORES
+        for (f = 0; f < numFrames; f++) {
+            uint32_t start = f * hop;
+            if (start < ovl) {
+                plp_stft_frame_parallel_f32(S->pRfft, S->pWindow, pHist + start, ovl - start,
+                                            pSrc, (Complex_type_f32 *)pBuf,
+                                            pDst + f * (N / 2 + 1), core_id, nPE);
+            } else {
+                plp_stft_frame_parallel_f32(S->pRfft, S->pWindow, NULL, 0, pSrc + start - ovl,
+                                            (Complex_type_f32 *)pBuf, pDst + f * (N / 2 + 1),
+                                            core_id, nPE);
+            }
+        }
+    }
+
+    rt_team_barrier();
+
+    // RING BUFFER, the newest numUpdate samples replace the oldest ones
+    if (ovl > 0) {
+        for (t = core_id; t < numUpdate; t += nPE) {
+            pos = head + t;
+            if (pos >= ovl) {
+                pos -= ovl;
+            }
+            S->pState[pos] = pSrc[total - numUpdate + t];
+            S->pState[pos + ovl] = pSrc[total - numUpdate + t];
+        }
+
+        if (core_id == 0) {
+            S->statePos = (head + numUpdate) % ovl;
+        }
+    }
+
+    rt_team_barrier();
+}
+
+/**
+   @} end of stft group
+*/
+
+/* Windowed radix-4/2 FFT of one frame, the power spectrum is written to pDst. The frame sample i
+ * is pHist[i] for i < histLen and pNew[i - histLen] otherwise. */
+static void plp_stft_frame_f32(const plp_rfft_instance_f32 *S,
+                               const float32_t *pWin,
+                               const float32_t *pHist,
+                               int histLen,
+                               const float32_t *pNew,
+                               Complex_type_f32 *pBuf,
+                               float32_t *pDst) {
+
+    int k;
+
+    int nfft = S->FFTLength >> 1; // length of the packed complex FFT
+    int log2FFTLen = 31 - __builtin_clz(nfft);
+
+    const Complex_type_f32 *_tw_ptr = (const Complex_type_f32 *)S->pTwiddleFactors;
+
+    process_windowed_fft(pWin, pHist, histLen, pNew, pBuf, nfft, _tw_ptr);
+
+    // SPLIT STAGE, reads the packed FFT in bit-reversed order and writes the power spectrum
+    Complex_type_f32 z0 = pBuf[0];
+    pDst[0] = (z0.re + z0.im) * (z0.re + z0.im);
+    pDst[nfft] = (z0.re - z0.im) * (z0.re - z0.im);
+
+    for (k = 1; k <= (nfft >> 1); k++) {
+        process_split_power(pBuf[bit_rev_half(k, log2FFTLen)],
+                            pBuf[bit_rev_half(nfft - k, log2FFTLen)], _tw_ptr[k], &pDst[k],
+                            &pDst[nfft - k]);
+    } // k
+}
+
+/* Same as plp_stft_frame_f32, the butterflies of one stage are interleaved over the cores */
+static void plp_stft_frame_parallel_f32(const plp_rfft_instance_f32 *S,
+                                        const float32_t *pWin,
+                                        const float32_t *pHist,
+                                        int histLen,
+                                        const float32_t *pNew,
+                                        Complex_type_f32 *pBuf,
+                                        float32_t *pDst,
+                                        int core_id,
+                                        int nPE) {
+
+    int k;
+
+    int nfft = S->FFTLength >> 1; // length of the packed complex FFT
+    int log2FFTLen = 31 - __builtin_clz(nfft);
+
+    const Complex_type_f32 *_tw_ptr = (const Complex_type_f32 *)S->pTwiddleFactors;
+
+    process_windowed_fft_parallel(pWin, pHist, histLen, pNew, pBuf, nfft, _tw_ptr, core_id,
+                                  nPE);
+
+    // SPLIT STAGE, reads the packed FFT in bit-reversed order and writes the power spectrum
+    if (core_id == 0) {
+        Complex_type_f32 z0 = pBuf[0];
+        pDst[0] = (z0.re + z0.im) * (z0.re + z0.im);
+        pDst[nfft] = (z0.re - z0.im) * (z0.re - z0.im);
+    }
+
+    for (k = core_id + 1; k <= (nfft >> 1); k += nPE) {
+        process_split_power(pBuf[bit_rev_half(k, log2FFTLen)],
+                            pBuf[bit_rev_half(nfft - k, log2FFTLen)], _tw_ptr[k], &pDst[k],
+                            &pDst[nfft - k]);
+    } // k
+
+    // the next frame overwrites pBuf
+    rt_team_barrier();
+}
+
+static inline void process_split_power(Complex_type_f32 A,
+                                       Complex_type_f32 B,
+                                       Complex_type_f32 tw,
+                                       float32_t *outA,
+                                       float32_t *outB) {
+
+    Complex_type_f32 even, odd, t;
+
+    // even = (A + conj(B)) / 2, odd = (A - conj(B)) / 2j
+    even.re = 0.5f * (A.re + B.re);
+    even.im = 0.5f * (A.im - B.im);
+    odd.re = 0.5f * (A.im + B.im);
+    odd.im = 0.5f * (B.re - A.re);
+
+    t = complex_mul(tw, odd);
+
+    // X[k] = even + W^k odd, X[N/2-k] = conj(even - W^k odd), only the power is needed
+    *outA = (even.re + t.re) * (even.re + t.re) + (even.im + t.im) * (even.im + t.im);
+    *outB = (even.re - t.re) * (even.re - t.re) + (even.im - t.im) * (even.im - t.im);
+}
@@ -0,0 +1,183 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_stft_f32s_xpulpv2.c
+ * Description:  Floating-point short-time Fourier transform for XPULPV2
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+#include "plp_rfft_f32_butterflies.h"
+
+/* HELPER FUNCTIONS */
+static void plp_stft_frame_f32(const plp_rfft_instance_f32 *S,
+                               const float32_t *pWin,
+                               const float32_t *pHist,
+                               int histLen,
+                               const float32_t *pNew,
+                               Complex_type_f32 *pBuf,
+                               float32_t *pDst);
+static inline void process_split_power(Complex_type_f32 A,
+                                       Complex_type_f32 B,
+                                       Complex_type_f32 tw,
+                                       float32_t *outA,
+                                       float32_t *outB);
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup stft Short-Time Fourier Transform
+  The STFT computes the power spectrum \f$|X_m[k]|^2\f$, \f$k = 0 .. N/2\f$, of the frames
+  \f$x_m[n] = w[n] x[mH + n]\f$ of length N with hop length H.
+
+  The input is consumed in blocks of numFrames*H samples. The last N - H samples of the
+  previous blocks are kept in a ring buffer in the instance, so a signal can be streamed block by
+  block, down to one frame per call. The ring buffer is mirrored, i.e. every sample is stored
+  twice at distance N - H, hence the history is always contiguous and a frame consists of at most
+  two segments, the history and the new samples.
+
+  Each frame is transformed with the real FFT algorithm of plp_rfft_f32 (N/2-point packed complex
+  FFT and split stage) resp. plp_rfft_q16, with two fusions that avoid the separate passes of a
+  windowing, FFT and magnitude chain:
+  - the window is applied while the frame is loaded from the two segments, so no windowed copy
+    of the frame is written. The floating-point version loads the frame in its first radix-4
+    stage, the fixed-point versions in the packing pass that copies the input to the buffer of
+    the complex FFT anyway.
+  - the split stage directly writes the power spectrum instead of the complex spectrum. The
+    fixed-point versions write it in Q2.30, computed from the spectrum X[k]/N of plp_rfft_q16.
+
+  The parallel versions either distribute the frames over the cores, each core transforming a
+  whole frame in its own part of the buffer, if there are at least as many frames as cores, or
+  compute one frame after the other with all cores.
+ */
+
+/**
+  @addtogroup stft
+  @{
+ */
+
+/**
+   @brief  Floating-point STFT for XPULPV2.
+   @param[in,out]  S          points to an instance of the floating-point STFT structure
+   @param[in]      pSrc       points to the input buffer of numFrames*hopLen values
+   @param[in]      numFrames  number of frames
+   @param[in]      pBuf       points to a temporary buffer of N values
+   @param[out]     pDst       points to the output buffer of numFrames*(N/2+1) values
+   @return         none
+*/
+void plp_stft_f32s_xpulpv2(plp_stft_instance_f32 *S,
+                           const float32_t *__restrict__ pSrc,
+                           uint32_t numFrames,
+                           float32_t *__restrict__ pBuf,
+                           float32_t *__restrict__ pDst) {
+
+    uint32_t f, t, pos;
+
+    uint32_t N = S->pRfft->FFTLength;
+    uint32_t hop = S->hopLen;
+    uint32_t ovl = N - hop; // length of the history
+    uint32_t total = numFrames * hop;
+    uint32_t numUpdate = (total < ovl) ? total : ovl;
+    const float32_t *pHist = S->pState + S->statePos;
+
+    for (f = 0; f < numFrames; f++) {
+        uint32_t start = f * hop; // the history starts at 0, the new samples at ovl
+        if (start < ovl) {
+            plp_stft_frame_f32(S->pRfft, S->pWindow, pHist + start, ovl - start, pSrc,
+                               (Complex_type_f32 *)pBuf, pDst + f * (N / 2 + 1));
+        } else {
+            plp_stft_frame_f32(S->pRfft, S->pWindow, NULL, 0, pSrc + start - ovl,
+                               (Complex_type_f32 *)pBuf, pDst + f * (N / 2 + 1));
+        }
+    }
+
+    // RING BUFFER, the newest numUpdate samples replace the oldest ones
+    if (ovl > 0) {
+        pos = S->statePos;
+        for (t = 0; t < numUpdate; t++) {
+            S->pState[pos] = pSrc[total - numUpdate + t];
+            S->pState[pos + ovl] = pSrc[total - numUpdate + t];
+            pos = (pos + 1 == ovl) ? 0 : pos + 1;
+        }
+        S->statePos = pos;
+    }
+}
+
+/**
+   @} end of stft group
+*/
+
+/* Windowed radix-4/2 FFT of one frame, the power spectrum is written to pDst. The frame sample i
+ * is pHist[i] for i < histLen and pNew[i - histLen] otherwise. */
+static void plp_stft_frame_f32(const plp_rfft_instance_f32 *S,
+                               const float32_t *pWin,
+                               const float32_t *pHist,
+                               int histLen,
+                               const float32_t *pNew,
+                               Complex_type_f32 *pBuf,
+                               float32_t *pDst) {
+
+    int k;
+
+    int nfft = S->FFTLength >> 1; // length of the packed complex FFT
+    int log2FFTLen = 31 - __builtin_clz(nfft);
+
+    const Complex_type_f32 *_tw_ptr = (const Complex_type_f32 *)S->pTwiddleFactors;
+
+    process_windowed_fft(pWin, pHist, histLen, pNew, pBuf, nfft, _tw_ptr);
+
+    // SPLIT STAGE, reads the packed FFT in bit-reversed order and writes the power spectrum
+    Complex_type_f32 z0 = pBuf[0];
+    pDst[0] = (z0.re + z0.im) * (z0.re + z0.im);
+    pDst[nfft] = (z0.re - z0.im) * (z0.re - z0.im);
+
+    for (k = 1; k <= (nfft >> 1); k++) {
+        process_split_power(pBuf[bit_rev_half(k, log2FFTLen)],
+                            pBuf[bit_rev_half(nfft - k, log2FFTLen)], _tw_ptr[k], &pDst[k],
+                            &pDst[nfft - k]);
+    } // k
+}
+
+static inline void process_split_power(Complex_type_f32 A,
+                                       Complex_type_f32 B,
+                                       Complex_type_f32 tw,
+                                       float32_t *outA,
+                                       float32_t *outB) {
+
+    Complex_type_f32 even, odd, t;
+
+    // even = (A + conj(B)) / 2, odd = (A - conj(B)) / 2j
+    even.re = 0.5f * (A.re + B.re);
+    even.im = 0.5f * (A.im - B.im);
+    odd.re = 0.5f * (A.im + B.im);
+    odd.im = 0.5f * (B.re - A.re);
+
+    t = complex_mul(tw, odd);
+
+    // X[k] = even + W^k odd, X[N/2-k] = conj(even - W^k odd), only the power is needed
+    *outA = (even.re + t.re) * (even.re + t.re) + (even.im + t.im) * (even.im + t.im);
+    *outB = (even.re - t.re) * (even.re - t.re) + (even.im - t.im) * (even.im - t.im);
+}
@@ -0,0 +1,176 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_stft_q16s_xpulpv2.c
+ * Description:  16-bit fixed point short-time Fourier transform for XPULPV2
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/* HELPER FUNCTIONS */
+static void plp_stft_frame_q16(const plp_rfft_instance_q16 *S,
+                               const int16_t *pWin,
+                               const int16_t *pHist,
+                               int histLen,
+                               const int16_t *pNew,
+                               uint32_t deciPoint,
+                               v2s *pBuf,
+                               int32_t *pDst);
+static inline int16_t plp_stft_load_q16(const int16_t *pWin,
+                                        const int16_t *pHist,
+                                        int histLen,
+                                        const int16_t *pNew,
+                                        int i);
+static inline void plp_stft_split_q16(v2s A, v2s B, v2s CoSi, int32_t *outA, int32_t *outB);
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup stft
+  @{
+ */
+
+/**
+   @brief  16 bit fixed-point STFT for XPULPV2. The power spectrum is written in Q2.30.
+   @param[in,out]  S          points to an instance of the 16 bit fixed-point STFT structure
+   @param[in]      pSrc       points to the input buffer of numFrames*hopLen values
+   @param[in]      numFrames  number of frames
+   @param[in]      deciPoint  decimal point for right shift
+   @param[in]      pBuf       points to a temporary buffer of N values
+   @param[out]     pDst       points to the output buffer of numFrames*(N/2+1) values
+   @return         none
+*/
+void plp_stft_q16s_xpulpv2(plp_stft_instance_q16 *S,
+                           const int16_t *__restrict__ pSrc,
+                           uint32_t numFrames,
+                           uint32_t deciPoint,
+                           int16_t *__restrict__ pBuf,
+                           int32_t *__restrict__ pDst) {
+
+    uint32_t f, t, pos;
+
+    uint32_t N = S->pRfft->fftLenReal;
+    uint32_t hop = S->hopLen;
+    uint32_t ovl = N - hop; // length of the history
+    uint32_t total = numFrames * hop;
+    uint32_t numUpdate = (total < ovl) ? total : ovl;
+    const int16_t *pHist = S->pState + S->statePos;
+
+    for (f = 0; f < numFrames; f++) {
+        uint32_t start = f * hop; // the history starts at 0, the new samples at ovl
+        if (start < ovl) {
+            plp_stft_frame_q16(S->pRfft, S->pWindow, pHist + start, ovl - start, pSrc, deciPoint,
+                               (v2s *)pBuf, pDst + f * (N / 2 + 1));
+        } else {
+            plp_stft_frame_q16(S->pRfft, S->pWindow, NULL, 0, pSrc + start - ovl, deciPoint,
+                               (v2s *)pBuf, pDst + f * (N / 2 + 1));
+        }
+    }
+
+    // RING BUFFER, the newest numUpdate samples replace the oldest ones
+    if (ovl > 0) {
+        pos = S->statePos;
+        for (t = 0; t < numUpdate; t++) {
+            S->pState[pos] = pSrc[total - numUpdate + t];
+            S->pState[pos + ovl] = pSrc[total - numUpdate + t];
+            pos = (pos + 1 == ovl) ? 0 : pos + 1;
+        }
+        S->statePos = pos;
+    }
+}
+
+/**
+   @} end of stft group
+*/
+
+/* Windowed real FFT of one frame, the power spectrum is written to pDst. The frame sample i is
+ * pHist[i] for i < histLen and pNew[i - histLen] otherwise. */
+static void plp_stft_frame_q16(const plp_rfft_instance_q16 *S,
+                               const int16_t *pWin,
+                               const int16_t *pHist,
+                               int histLen,
+                               const int16_t *pNew,
+                               uint32_t deciPoint,
+                               v2s *pBuf,
+                               int32_t *pDst) {
+
+    uint32_t k;
+    uint32_t nfft = S->fftLenReal >> 1; // length of the packed complex FFT
+    const v2s *pCoef = (const v2s *)S->pTwiddleRFFT;
+    v2s z0;
+
+    // PACKING, loads and windows the frame
+    for (k = 0; k < nfft; k++) {
+        pBuf[k] = __PACK2(plp_stft_load_q16(pWin, pHist, histLen, pNew, 2 * k),
+                          plp_stft_load_q16(pWin, pHist, histLen, pNew, 2 * k + 1));
+    }
+
+    plp_cfft_q16s_xpulpv2(S->pCfft, (int16_t *)pBuf, 0, 1, deciPoint);
+
+    // SPLIT STAGE, writes the power spectrum
+    z0 = __SRA2(pBuf[0], ((v2s){ 1, 1 }));
+    pDst[0] = (int32_t)(int16_t)(z0[0] + z0[1]) * (int16_t)(z0[0] + z0[1]);
+    pDst[nfft] = (int32_t)(int16_t)(z0[0] - z0[1]) * (int16_t)(z0[0] - z0[1]);
+
+    for (k = 1; k <= (nfft >> 1); k++) {
+        plp_stft_split_q16(pBuf[k], pBuf[nfft - k], pCoef[k], &pDst[k], &pDst[nfft - k]);
+    }
+}
+
+static inline int16_t plp_stft_load_q16(const int16_t *pWin,
+                                        const int16_t *pHist,
+                                        int histLen,
+                                        const int16_t *pNew,
+                                        int i) {
+
+    int16_t x = (i < histLen) ? pHist[i] : pNew[i - histLen];
+
+    return (int16_t)(((int32_t)x * pWin[i]) >> 15);
+}
+
+/* Split stage of plp_rfft_q16s_xpulpv2, the inputs are halved before the sums, t is
+ * W_N^k O[k] / 2. Only the power of X[k] and X[N/2-k] is written. */
+static inline void plp_stft_split_q16(v2s A, v2s B, v2s CoSi, int32_t *outA, int32_t *outB) {
+    v2s a, b, e, o, t, x;
+
+    a = __SRA2(A, ((v2s){ 1, 1 }));
+    b = __SRA2(B, ((v2s){ 1, 1 }));
+
+    /* e = a + conj(b), o = (a - conj(b)) / j */
+    e = __PACK2(a[0] + b[0], a[1] - b[1]);
+    o = __PACK2(a[1] + b[1], b[0] - a[0]);
+
+    t = __PACK2((int16_t)(__DOTP2(CoSi, o) >> 16),
+                (int16_t)(__DOTP2(__PACK2(-CoSi[1], CoSi[0]), o) >> 16));
+
+    e = __SRA2(e, ((v2s){ 1, 1 }));
+
+    x = __ADD2(e, t);
+    *outA = __DOTP2(x, x);
+    x = __SUB2(e, t);
+    *outB = __DOTP2(x, x);
+}
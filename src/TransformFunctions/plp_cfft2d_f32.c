@@ -0,0 +1,68 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft2d_f32.c
+ * Description:  Floating-point 2D complex FFT glue code
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fftBatch
+ * @{
+ */
+
+/**
+ * @brief      Glue code for the floating-point 2D complex FFT
+ * @param[in]     SRows     points to the mixed-radix CFFT instance of the rows (numCols)
+ * @param[in]     SCols     points to the mixed-radix CFFT instance of the columns (numRows)
+ * @param[in]     pSrc      points to the numRows x numCols complex input matrix
+ * @param[in]     pBuf      points to a temporary buffer of 2*numRows*numCols values
+ * @param[out]    pDst      points to the numRows x numCols complex output matrix
+ */
+
+void plp_cfft2d_f32(const plp_cfft_mixed_instance_f32 *SRows,
+                    const plp_cfft_mixed_instance_f32 *SCols,
+                    const float32_t *__restrict__ pSrc,
+                    float32_t *__restrict__ pBuf,
+                    float32_t *__restrict__ pDst) {
+
+    PLP_PROFILE_FUNC();
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("F extension is supported only for cluster side\n");
+        return;
+    } else {
+        plp_cfft2d_f32s_xpulpv2(SRows, SCols, pSrc, pBuf, pDst);
+    }
+}
+
+/**
+ * @} end of fftBatch group
+ */
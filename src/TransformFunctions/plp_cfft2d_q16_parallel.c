@@ -0,0 +1,78 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft2d_q16_parallel.c
+ * Description:  Parallel 16 bit fixed-point 2D complex FFT glue code
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fftBatch
+ * @{
+ */
+
+/**
+ * @brief      Glue code for the parallel 16 bit fixed-point 2D complex FFT
+ * @param[in]     SRows     points to the CFFT instance of the rows, of length numCols
+ * @param[in]     SCols     points to the CFFT instance of the columns, of length numRows
+ * @param[in,out] pSrc      points to the numRows x numCols complex matrix, processed in-place
+ * @param[in]     deciPoint decimal point for right shift
+ * @param[in]     nPE       number of parallel processing units
+ * @param[in]     pBuf      points to a temporary buffer of 2*numRows*numCols values
+ */
+
+void plp_cfft2d_q16_parallel(const plp_cfft_instance_q16 *SRows,
+                             const plp_cfft_instance_q16 *SCols,
+                             int16_t *__restrict__ pSrc,
+                             uint32_t deciPoint,
+                             uint32_t nPE,
+                             int16_t *__restrict__ pBuf) {
+
+    PLP_PROFILE_FUNC();
+
+    if (deciPoint != 15) {
+        printf("Only Q1.15 fixed point supported currently.\n");
+        return;
+    }
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Parallel processing supported only for cluster side\n");
+        return;
+    }
+
+    plp_cfft2d_parallel_arg_q16 arg =
+        (plp_cfft2d_parallel_arg_q16){ SRows, SCols, pSrc, deciPoint, nPE, pBuf };
+
+    rt_team_fork(nPE, plp_cfft2d_q16p_xpulpv2, (void *)&arg);
+}
+
+/**
+ * @} end of fftBatch group
+ */
@@ -0,0 +1,80 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_batch_f32_parallel.c
+ * Description:  Parallel floating-point batched complex FFT glue code
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fftBatch
+ * @{
+ */
+
+/**
+ * @brief      Glue code for the parallel floating-point batched complex FFT
+ * @param[in]     S                points to the floating-point mixed-radix CFFT instance
+ * @param[in]     pSrc             points to the complex input data of all transforms
+ * @param[in]     numTransforms    number of transforms
+ * @param[in]     transformStride  distance in complex values between two transforms
+ * @param[in]     sampleStride     distance in complex values between two samples of a transform
+ * @param[in]     nPE              number of parallel processing units
+ * @param[in]     pBuf             points to a temporary buffer of 4*nPE*fftLen values, unused if
+ *                                 sampleStride is 1 and pDst is not pSrc
+ * @param[out]    pDst             points to the complex output data, with the same strides as pSrc.
+ *                                 May be pSrc for an in-place transform.
+ */
+
+void plp_cfft_batch_f32_parallel(const plp_cfft_mixed_instance_f32 *S,
+                                 const float32_t *pSrc,
+                                 uint32_t numTransforms,
+                                 uint32_t transformStride,
+                                 uint32_t sampleStride,
+                                 uint32_t nPE,
+                                 float32_t *__restrict__ pBuf,
+                                 float32_t *pDst) {
+
+    PLP_PROFILE_FUNC();
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Parallel processing supported only for cluster side\n");
+        return;
+    }
+
+    plp_cfft_batch_parallel_arg_f32 arg = (plp_cfft_batch_parallel_arg_f32){
+        S, pSrc, numTransforms, transformStride, sampleStride, nPE, pBuf, pDst
+    };
+
+    rt_team_fork(nPE, plp_cfft_batch_f32p_xpulpv2, (void *)&arg);
+}
+
+/**
+ * @} end of fftBatch group
+ */
@@ -0,0 +1,83 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_batch_q16.c
+ * Description:  16 bit fixed-point batched complex FFT glue code
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fftBatch
+ * @{
+ */
+
+/**
+ * @brief      Glue code for the 16 bit fixed-point batched complex FFT
+ * @param[in]     S                points to an instance of the 16bit quantized CFFT structure
+ * @param[in,out] pSrc             points to the complex data of all transforms, processed in-place
+ * @param[in]     numTransforms    number of transforms
+ * @param[in]     transformStride  distance in complex values between two transforms
+ * @param[in]     sampleStride     distance in complex values between two samples of a transform
+ * @param[in]     ifftFlag         flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ * @param[in]     bitReverseFlag   flag that enables (bitReverseFlag=1) bit reversal of output
+ * @param[in]     deciPoint        decimal point for right shift
+ * @param[in]     pBuf             points to a temporary buffer of 2*fftLen values, unused if
+ *                                 sampleStride is 1
+ */
+
+void plp_cfft_batch_q16(const plp_cfft_instance_q16 *S,
+                        int16_t *__restrict__ pSrc,
+                        uint32_t numTransforms,
+                        uint32_t transformStride,
+                        uint32_t sampleStride,
+                        uint8_t ifftFlag,
+                        uint8_t bitReverseFlag,
+                        uint32_t deciPoint,
+                        int16_t *__restrict__ pBuf) {
+
+    PLP_PROFILE_FUNC();
+
+    if (deciPoint != 15) {
+        printf("Only Q1.15 fixed point supported currently.\n");
+        return;
+    }
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_cfft_batch_q16s_rv32im(S, pSrc, numTransforms, transformStride, sampleStride, ifftFlag,
+                                   bitReverseFlag, deciPoint, pBuf);
+    } else {
+        plp_cfft_batch_q16s_xpulpv2(S, pSrc, numTransforms, transformStride, sampleStride, ifftFlag,
+                                    bitReverseFlag, deciPoint, pBuf);
+    }
+}
+
+/**
+ * @} end of fftBatch group
+ */
@@ -0,0 +1,65 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_mixed_f32.c
+ * Description:  Floating-point mixed-radix FFT on complex input data glue code
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fftMixed
+ * @{
+ */
+
+/**
+ * @brief      Glue code for the floating-point mixed-radix complex fast fourier transform
+ * @param[in]  S       points to an instance of the floating-point mixed-radix CFFT structure,
+ *                     initialized with plp_cfft_mixed_init_f32
+ * @param[in]  pSrc    points to the input buffer (complex data) of size <code>2*fftLen</code>
+ * @param[out] pDst    points to the output buffer (complex data) of size <code>2*fftLen</code>
+ */
+
+void plp_cfft_mixed_f32(const plp_cfft_mixed_instance_f32 *S,
+                        const float32_t *__restrict__ pSrc,
+                        float32_t *__restrict__ pDst) {
+
+    PLP_PROFILE_FUNC();
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("F extension is supported only for cluster side\n");
+        return;
+    }
+
+    plp_cfft_mixed_f32s_xpulpv2(S, pSrc, pDst);
+}
+
+/**
+ * @} end of fftMixed group
+ */
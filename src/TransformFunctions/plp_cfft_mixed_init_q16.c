@@ -0,0 +1,174 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_mixed_init_q16.c
+ * Description:  Initialization of the 16-bit fixed point mixed-radix FFT
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+static void plp_cfft_mixed_sincos_f32(uint32_t k, uint32_t N, float32_t *pCos, float32_t *pSin);
+static int16_t plp_cfft_mixed_float_to_q16(float32_t x);
+
+/**
+  @ingroup fftMixed
+ */
+
+/**
+  @addtogroup fftMixed
+  @{
+ */
+
+/**
+   @brief  Initialization of the 16-bit fixed-point mixed-radix complex FFT.
+
+   Computes the plan, i.e. the factorization of fftLen into radix-4 stages followed by radix-2, 3
+   and 5 stages, and the fftLen Q1.15 twiddle factors cos(2*pi*k/N), sin(2*pi*k/N), rounded and
+   saturated to [-32767, 32767]. The twiddle factors are computed with integer argument reduction
+   and a polynomial, no tables or libm are needed.
+   This is meant to be called once before the transforms, e.g. on the fabric controller.
+
+   @param[out]  S          points to the instance of the 16-bit mixed-radix CFFT structure
+   @param[in]   fftLen     length of the FFT, must be a product of the factors 2, 3, 4 and 5
+   @param[out]  pTwiddle   points to the twiddle buffer of size <code>2*fftLen</code>, it must be
+                           kept alive as long as the instance is used
+   @return      0: Success, 1: Unsupported length
+*/
+int plp_cfft_mixed_init_q16(plp_cfft_mixed_instance_q16 *S, uint16_t fftLen, int16_t *pTwiddle) {
+
+    PLP_PROFILE_FUNC();
+
+    uint32_t k;
+    uint32_t n = fftLen;
+    float32_t c, s;
+    uint16_t numStages = 0;
+
+    if (fftLen < 2) {
+        return 1;
+    }
+
+    while ((n % 4) == 0) {
+        S->factors[numStages++] = 4;
+        n /= 4;
+    }
+    while ((n % 2) == 0) {
+        S->factors[numStages++] = 2;
+        n /= 2;
+    }
+    while ((n % 3) == 0) {
+        S->factors[numStages++] = 3;
+        n /= 3;
+    }
+    while ((n % 5) == 0) {
+        S->factors[numStages++] = 5;
+        n /= 5;
+    }
+
+    if (n != 1) {
+        return 1;
+    }
+
+    for (k = 0; k < fftLen; k++) {
+        plp_cfft_mixed_sincos_f32(k, fftLen, &c, &s);
+        pTwiddle[2 * k] = plp_cfft_mixed_float_to_q16(c);
+        pTwiddle[2 * k + 1] = plp_cfft_mixed_float_to_q16(s);
+    }
+
+    S->fftLen = fftLen;
+    S->numStages = numStages;
+    S->pTwiddle = pTwiddle;
+
+    return 0;
+}
+
+/**
+   @} end of fftMixed group
+*/
+
+/*
+ * cos(2*pi*k/N) and sin(2*pi*k/N). The angle is reduced exactly to an octant with integer
+ * arithmetic, the remaining angle x <= pi/4 is evaluated with the Taylor series, the truncation
+ * error is below 1e-10.
+ */
+static void plp_cfft_mixed_sincos_f32(uint32_t k, uint32_t N, float32_t *pCos, float32_t *pSin) {
+
+    uint32_t quadrant = (4 * k) / N;
+    uint32_t rem = 4 * k - quadrant * N; // angle within the quadrant is pi/2 * rem / N
+    uint32_t swap = (2 * rem > N);
+    float32_t x, x2, c, s, t;
+
+    if (swap) {
+        rem = N - rem;
+    }
+
+    x = 1.57079633f * (float32_t)rem / (float32_t)N;
+    x2 = x * x;
+
+    c = 1.0f - x2 * (1.0f / 2 -
+                     x2 * (1.0f / 24 -
+                           x2 * (1.0f / 720 - x2 * (1.0f / 40320 - x2 * (1.0f / 3628800)))));
+    s = x * (1.0f - x2 * (1.0f / 6 -
+                          x2 * (1.0f / 120 -
+                                x2 * (1.0f / 5040 -
+                                      x2 * (1.0f / 362880 - x2 * (1.0f / 39916800))))));
+
+    if (swap) {
+        t = c;
+        c = s;
+        s = t;
+    }
+
+    switch (quadrant) {
+    case 0:
+        *pCos = c;
+        *pSin = s;
+        break;
+    case 1:
+        *pCos = -s;
+        *pSin = c;
+        break;
+    case 2:
+        *pCos = -c;
+        *pSin = -s;
+        break;
+    default:
+        *pCos = s;
+        *pSin = -c;
+        break;
+    }
+}
+
+/* rounding and saturation to [-32767, 32767], such that the twiddle factors can be negated */
+static int16_t plp_cfft_mixed_float_to_q16(float32_t x) {
+
+    float32_t y = x * 32768.0f;
+    int32_t r = (int32_t)((y >= 0.0f) ? (y + 0.5f) : (y - 0.5f));
+
+    if (r > 32767) {
+        r = 32767;
+    } else if (r < -32767) {
+        r = -32767;
+    }
+    return (int16_t)r;
+}
@@ -0,0 +1,72 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_mixed_q16.c
+ * Description:  16-bit fixed point mixed-radix FFT on complex input data glue code
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fftMixed
+ * @{
+ */
+
+/**
+ * @brief      Glue code for the quantized 16 bit mixed-radix complex fast fourier transform.
+ *             The output is scaled by 1/fftLen.
+ * @param[in]  S           points to an instance of the 16bit mixed-radix CFFT structure,
+ *                         initialized with plp_cfft_mixed_init_q16
+ * @param[in]  pSrc        points to the input buffer (complex data) of size <code>2*fftLen</code>
+ * @param[in]  deciPoint   decimal point for right shift
+ * @param[out] pDst        points to the output buffer (complex data) of size <code>2*fftLen</code>
+ */
+
+void plp_cfft_mixed_q16(const plp_cfft_mixed_instance_q16 *S,
+                        const int16_t *__restrict__ pSrc,
+                        uint32_t deciPoint,
+                        int16_t *__restrict__ pDst) {
+
+    PLP_PROFILE_FUNC();
+
+    if (deciPoint != 15) {
+        printf("Only Q1.15 fixed point supported currently.\n");
+        return;
+    }
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_cfft_mixed_q16s_rv32im(S, pSrc, deciPoint, pDst);
+    } else {
+        plp_cfft_mixed_q16s_xpulpv2(S, pSrc, deciPoint, pDst);
+    }
+}
+
+/**
+ * @} end of fftMixed group
+ */
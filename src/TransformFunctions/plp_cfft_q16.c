@@ -47,7 +47,8 @@
  * @param[in]     ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
  * transform.
  * @param[in]     bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
- * (bitReverseFlag=0) bit reversal of output.
+ * (bitReverseFlag=0) bit reversal of output. With bitReverseFlag=0 the output is left in
+ * bit-reversed order, consumers that read it through bit-reversed indices save the reversal pass.
  * @param[in]     deciPoint       decimal point for right shift
  */
 
@@ -57,6 +58,8 @@ void plp_cfft_q16(const plp_cfft_instance_q16 *S,
                   uint8_t bitReverseFlag,
                   uint32_t deciPoint) {
 
+    PLP_PROFILE_FUNC();
+
     if (deciPoint != 15) {
         printf("Only Q1.15 fixed point supported currently.\n");
         return;
@@ -0,0 +1,78 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_q32.c
+ * Description:  32-bit fixed point Fast Fourier Transform on Complex Input Data
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief         Glue code for quantized 32 bit complex fast fourier transform
+ * @param[in]     S               points to an instance of the 32bit quantized CFFT structure
+ * @param[in,out] p1              points to the complex data buffer of size <code>2*fftLen</code>.
+ * Processing occurs in-place.
+ * @param[in]     ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ * transform.
+ * @param[in]     bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output. With bitReverseFlag=0 the output is left in
+ * bit-reversed order, consumers that read it through bit-reversed indices save the reversal pass.
+ * @param[in]     deciPoint       decimal point for right shift
+ */
+
+void plp_cfft_q32(const plp_cfft_instance_q32 *S,
+                  int32_t *p1,
+                  uint8_t ifftFlag,
+                  uint8_t bitReverseFlag,
+                  uint32_t deciPoint) {
+
+    PLP_PROFILE_FUNC();
+
+    if (deciPoint != 31) {
+        printf("Only Q1.31 fixed point supported currently.\n");
+        return;
+    }
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_cfft_q32s_rv32im(S, p1, ifftFlag, bitReverseFlag, deciPoint);
+    } else {
+        // the butterflies use no XPULPV2 instructions, only the bit reversal does
+        plp_cfft_q32s_rv32im(S, p1, ifftFlag, 0, deciPoint);
+        if (bitReverseFlag)
+            plp_bitreversal_nolut_32s_xpulpv2((uint32_t *)p1, S->fftLen);
+    }
+}
+
+/**
+ * @} end of FFT group
+ */
@@ -0,0 +1,75 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_csd_welch_f32_parallel.c
+ * Description:  Glue code for the parallel floating-point Welch cross-spectral density
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup welch
+ * @{
+ */
+
+/**
+ * @brief      Glue code for the parallel floating-point Welch cross-spectral density.
+ * @param[in]  S           points to an instance of the floating-point Welch structure
+ * @param[in]  pSrcA       points to the first input buffer of (numFrames-1)*hopLen+N values
+ * @param[in]  pSrcB       points to the second input buffer of (numFrames-1)*hopLen+N values
+ * @param[in]  numFrames   number of averaged frames
+ * @param[in]  nPE         number of parallel processing units
+ * @param[in]  pBuf        points to a temporary buffer of 2*nPE*N + (nPE-1)*(N+2) values
+ * @param[out] pDst        points to the output buffer of N/2+1 complex values
+ */
+
+void plp_csd_welch_f32_parallel(const plp_welch_instance_f32 *S,
+                                const float32_t *__restrict__ pSrcA,
+                                const float32_t *__restrict__ pSrcB,
+                                uint32_t numFrames,
+                                uint32_t nPE,
+                                float32_t *__restrict__ pBuf,
+                                float32_t *__restrict__ pDst) {
+
+    PLP_PROFILE_FUNC();
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Parallel processing supported only for cluster side\n");
+        return;
+    }
+
+    plp_csd_welch_parallel_arg_f32 arg =
+        (plp_csd_welch_parallel_arg_f32){ S, pSrcA, pSrcB, numFrames, nPE, pBuf, pDst };
+
+    rt_team_fork(nPE, plp_csd_welch_f32p_xpulpv2, (void *)&arg);
+}
+
+/**
+ * @} end of welch group
+ */
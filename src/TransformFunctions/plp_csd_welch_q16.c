@@ -0,0 +1,77 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_csd_welch_q16.c
+ * Description:  Glue code for the 16-bit fixed point Welch cross-spectral density
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup welch
+ * @{
+ */
+
+/**
+ * @brief      Glue code for the 16 bit fixed-point Welch cross-spectral density.
+ *             The output is in Q2.30.
+ * @param[in]  S           points to an instance of the 16 bit fixed-point Welch structure
+ * @param[in]  pSrcA       points to the first input buffer of (numFrames-1)*hopLen+N values
+ * @param[in]  pSrcB       points to the second input buffer of (numFrames-1)*hopLen+N values
+ * @param[in]  numFrames   number of averaged frames
+ * @param[in]  deciPoint   decimal point for right shift
+ * @param[in]  pBuf        points to a temporary buffer of 2*N values
+ * @param[out] pDst        points to the output buffer of N/2+1 complex values
+ */
+
+void plp_csd_welch_q16(const plp_welch_instance_q16 *S,
+                       const int16_t *__restrict__ pSrcA,
+                       const int16_t *__restrict__ pSrcB,
+                       uint32_t numFrames,
+                       uint32_t deciPoint,
+                       int16_t *__restrict__ pBuf,
+                       int32_t *__restrict__ pDst) {
+
+    PLP_PROFILE_FUNC();
+
+    if (deciPoint != 15) {
+        printf("Only Q1.15 fixed point supported currently.\n");
+        return;
+    }
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_csd_welch_q16s_rv32im(S, pSrcA, pSrcB, numFrames, deciPoint, pBuf, pDst);
+    } else {
+        plp_csd_welch_q16s_xpulpv2(S, pSrcA, pSrcB, numFrames, deciPoint, pBuf, pDst);
+    }
+}
+
+/**
+ * @} end of welch group
+ */
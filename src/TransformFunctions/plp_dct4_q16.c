@@ -0,0 +1,72 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dct4_q16.c
+ * Description:  Glue code for the 16-bit fixed point DCT-IV
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup dct
+ * @{
+ */
+
+/**
+ * @brief      Glue code for the quantized 16 bit DCT-IV. The output is scaled by 1/N.
+ * @param[in]  S           points to an instance of the 16bit DCT-IV structure
+ * @param[in]  pSrc        points to the input buffer of N values
+ * @param[in]  deciPoint   decimal point for right shift
+ * @param[in]  pBuf        points to a temporary buffer of N values
+ * @param[out] pDst        points to the output buffer of N values
+ */
+
+void plp_dct4_q16(const plp_dct4_instance_q16 *S,
+                  const int16_t *__restrict__ pSrc,
+                  uint32_t deciPoint,
+                  int16_t *__restrict__ pBuf,
+                  int16_t *__restrict__ pDst) {
+
+    PLP_PROFILE_FUNC();
+
+    if (deciPoint != 15) {
+        printf("Only Q1.15 fixed point supported currently.\n");
+        return;
+    }
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_dct4_q16s_rv32im(S, pSrc, deciPoint, pBuf, pDst);
+    } else {
+        plp_dct4_q16s_xpulpv2(S, pSrc, deciPoint, pBuf, pDst);
+    }
+}
+
+/**
+ * @} end of dct group
+ */
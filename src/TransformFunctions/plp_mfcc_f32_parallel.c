@@ -0,0 +1,76 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mfcc_f32_parallel.c
+ * Description:  Glue code for the parallel floating-point MFCC
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup mfcc
+ * @{
+ */
+
+/**
+ * @brief      Glue code for the parallel floating-point MFCC.
+ * @param[in]  S           points to an instance of the floating-point MFCC structure
+ * @param[in,out] pStft    points to an instance of the floating-point STFT structure
+ * @param[in]  pSrc        points to the input buffer of numFrames*hopLen values
+ * @param[in]  numFrames   number of frames
+ * @param[in]  nPE         number of parallel processing units
+ * @param[in]  pBuf        points to a temporary buffer of nPE*(2N+2+3*numBands) values
+ * @param[out] pDst        points to the output buffer of numFrames*numCoeffs values, or
+ *                         numFrames*numBands log-mel energies if S->pDct is NULL
+ */
+
+void plp_mfcc_f32_parallel(const plp_mfcc_instance_f32 *S,
+                           plp_stft_instance_f32 *pStft,
+                           const float32_t *__restrict__ pSrc,
+                           uint32_t numFrames,
+                           uint32_t nPE,
+                           float32_t *__restrict__ pBuf,
+                           float32_t *__restrict__ pDst) {
+
+    PLP_PROFILE_FUNC();
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Parallel processing supported only for cluster side\n");
+        return;
+    }
+
+    plp_mfcc_parallel_arg_f32 arg =
+        (plp_mfcc_parallel_arg_f32){ S, pStft, pSrc, numFrames, nPE, pBuf, pDst };
+
+    rt_team_fork(nPE, plp_mfcc_f32p_xpulpv2, (void *)&arg);
+}
+
+/**
+ * @} end of mfcc group
+ */
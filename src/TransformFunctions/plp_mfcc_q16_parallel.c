@@ -0,0 +1,84 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mfcc_q16_parallel.c
+ * Description:  Glue code for the parallel 16-bit fixed point MFCC
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup mfcc
+ * @{
+ */
+
+/**
+ * @brief      Glue code for the parallel 16 bit fixed-point MFCC. The log-mel energies are in
+ *             Q5.10, the cepstral coefficients are scaled by 1/numBands.
+ * @param[in]  S           points to an instance of the 16 bit fixed-point MFCC structure
+ * @param[in,out] pStft    points to an instance of the 16 bit fixed-point STFT structure
+ * @param[in]  pSrc        points to the input buffer of numFrames*hopLen values
+ * @param[in]  numFrames   number of frames
+ * @param[in]  deciPoint   decimal point for right shift
+ * @param[in]  nPE         number of parallel processing units
+ * @param[in]  pBuf        points to a temporary buffer of nPE*(2N+2+3*numBands) values
+ * @param[out] pDst        points to the output buffer of numFrames*numCoeffs values, or
+ *                         numFrames*numBands log-mel energies if S->pDct is NULL
+ */
+
+void plp_mfcc_q16_parallel(const plp_mfcc_instance_q16 *S,
+                           plp_stft_instance_q16 *pStft,
+                           const int16_t *__restrict__ pSrc,
+                           uint32_t numFrames,
+                           uint32_t deciPoint,
+                           uint32_t nPE,
+                           int16_t *__restrict__ pBuf,
+                           int16_t *__restrict__ pDst) {
+
+    PLP_PROFILE_FUNC();
+
+    if (deciPoint != 15) {
+        printf("Only Q1.15 fixed point supported currently.\n");
+        return;
+    }
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Parallel processing supported only for cluster side\n");
+        return;
+    }
+
+    plp_mfcc_parallel_arg_q16 arg =
+        (plp_mfcc_parallel_arg_q16){ S, pStft, pSrc, numFrames, deciPoint, nPE, pBuf, pDst };
+
+    rt_team_fork(nPE, plp_mfcc_q16p_xpulpv2, (void *)&arg);
+}
+
+/**
+ * @} end of mfcc group
+ */
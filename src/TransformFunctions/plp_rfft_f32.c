@@ -57,6 +57,8 @@ void plp_rfft_f32(const plp_rfft_instance_f32 *S,
                   const float32_t *__restrict__ pSrc,
                   float32_t *__restrict__ pDst) {
 
+    PLP_PROFILE_FUNC();
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         printf("F extension is supported only for cluster side\n");
         return;
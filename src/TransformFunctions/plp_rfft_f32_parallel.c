@@ -59,6 +59,8 @@ void plp_rfft_f32_parallel(const plp_rfft_instance_f32 *S,
                            const uint32_t nPE,
                            float32_t *__restrict__ pDst) {
 
+    PLP_PROFILE_FUNC();
+
     if (rt_cluster_id() == ARCHI_FC_CID) {
         printf("Parallel processing supported only for cluster side\n");
         return;
@@ -66,7 +68,7 @@ void plp_rfft_f32_parallel(const plp_rfft_instance_f32 *S,
 
     plp_rfft_parallel_arg_f32 arg = (plp_rfft_parallel_arg_f32){ S, pSrc, nPE, pDst };
 
-    rt_team_fork(nPE, plp_rfft_f32_xpulpv2_parallel, (void *)&arg);
+    rt_team_fork(nPE, plp_rfft_f32_xpulpv2_parallel, &arg);
 }
 
 /**
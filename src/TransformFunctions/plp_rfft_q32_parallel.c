@@ -0,0 +1,76 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_rfft_q32_parallel.c
+ * Description:  Parallel 32-bit fixed point Fast Fourier Transform on real input data
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief      Glue code for parallel quantized 32 bit real fast fourier transform
+ * @param[in]  S           points to an instance of the 32bit quantized RFFT structure
+ * @param[in]  pSrc        points to the input buffer (real data) of size <code>fftLenReal</code>
+ * @param[in]  deciPoint   decimal point for right shift
+ * @param[in]  nPE         number of parallel processing units
+ * @param[out] pDst        points to the output buffer (complex data) of size
+ *                         <code>2*fftLenReal</code>
+ */
+
+void plp_rfft_q32_parallel(const plp_rfft_instance_q32 *S,
+                           const int32_t *__restrict__ pSrc,
+                           uint32_t deciPoint,
+                           uint32_t nPE,
+                           int32_t *__restrict__ pDst) {
+
+    PLP_PROFILE_FUNC();
+
+    if (deciPoint != 31) {
+        printf("Only Q1.31 fixed point supported currently.\n");
+        return;
+    }
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        printf("Parallel processing supported only for cluster side\n");
+        return;
+    }
+
+    plp_rfft_parallel_arg_q32 arg =
+        (plp_rfft_parallel_arg_q32){ S, pSrc, deciPoint, nPE, pDst };
+
+    rt_team_fork(nPE, plp_rfft_q32p_xpulpv2, (void *)&arg);
+}
+
+/**
+ * @} end of FFT group
+ */
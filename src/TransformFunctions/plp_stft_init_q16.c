@@ -0,0 +1,86 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_stft_init_q16.c
+ * Description:  Initialization of the 16-bit fixed point STFT
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/**
+  @ingroup stft
+ */
+
+/**
+  @addtogroup stft
+  @{
+ */
+
+/**
+   @brief  Initialization of the 16 bit fixed-point STFT.
+
+   Sets up the instance and clears the ring buffer, i.e. the signal before the first sample is
+   assumed to be zero. This is meant to be called once before the transforms, e.g. on the fabric
+   controller.
+
+   @param[out]  S          points to the instance of the 16 bit fixed-point STFT structure
+   @param[in]   pRfft      points to the instance of the real FFT of frame length N
+   @param[in]   pWindow    points to the Q1.15 analysis window of N values
+   @param[in]   hopLen     number of new samples per frame, 0 < hopLen <= N
+   @param[out]  pState     points to the ring buffer of <code>2*(N-hopLen)</code> values, it must
+                           be kept alive as long as the instance is used
+   @return      0: Success, 1: Unsupported hop length
+*/
+int plp_stft_init_q16(plp_stft_instance_q16 *S,
+                      const plp_rfft_instance_q16 *pRfft,
+                      const int16_t *pWindow,
+                      uint16_t hopLen,
+                      int16_t *pState) {
+
+    PLP_PROFILE_FUNC();
+
+    uint32_t k;
+    uint32_t N = pRfft->fftLenReal;
+
+    if ((hopLen == 0) || (hopLen > N)) {
+        return 1;
+    }
+
+    for (k = 0; k < 2 * (N - hopLen); k++) {
+        pState[k] = 0;
+    }
+
+    S->pRfft = pRfft;
+    S->pWindow = pWindow;
+    S->hopLen = hopLen;
+    S->statePos = 0;
+    S->pState = pState;
+
+    return 0;
+}
+
+/**
+   @} end of stft group
+*/
@@ -0,0 +1,75 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_stft_q16.c
+ * Description:  Glue code for the 16-bit fixed point short-time Fourier transform
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup stft
+ * @{
+ */
+
+/**
+ * @brief      Glue code for the 16 bit fixed-point STFT. The power spectrum is written in
+ *             Q2.30.
+ * @param[in,out] S        points to an instance of the 16 bit fixed-point STFT structure
+ * @param[in]  pSrc        points to the input buffer of numFrames*hopLen values
+ * @param[in]  numFrames   number of frames
+ * @param[in]  deciPoint   decimal point for right shift
+ * @param[in]  pBuf        points to a temporary buffer of N values
+ * @param[out] pDst        points to the output buffer of numFrames*(N/2+1) values
+ */
+
+void plp_stft_q16(plp_stft_instance_q16 *S,
+                  const int16_t *__restrict__ pSrc,
+                  uint32_t numFrames,
+                  uint32_t deciPoint,
+                  int16_t *__restrict__ pBuf,
+                  int32_t *__restrict__ pDst) {
+
+    PLP_PROFILE_FUNC();
+
+    if (deciPoint != 15) {
+        printf("Only Q1.15 fixed point supported currently.\n");
+        return;
+    }
+
+    if (rt_cluster_id() == ARCHI_FC_CID) {
+        plp_stft_q16s_rv32im(S, pSrc, numFrames, deciPoint, pBuf, pDst);
+    } else {
+        plp_stft_q16s_xpulpv2(S, pSrc, numFrames, deciPoint, pBuf, pDst);
+    }
+}
+
+/**
+ * @} end of stft group
+ */
@@ -0,0 +1,83 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_welch_init_f32.c
+ * Description:  Initialization of the floating-point Welch estimators
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/**
+  @ingroup welch
+ */
+
+/**
+  @addtogroup welch
+  @{
+ */
+
+/**
+   @brief  Initialization of the floating-point Welch PSD and CSD.
+
+   Sets up the instance and computes the scale 1/sum(w[n]^2) of the averaged spectra. This is
+   meant to be called once before the estimators, e.g. on the fabric controller. The scale can
+   be changed afterwards, e.g. to 2/(fs*sum(w[n]^2)) for the one-sided density in units^2/Hz.
+
+   @param[out]  S          points to the instance of the floating-point Welch structure
+   @param[in]   pRfft      points to the instance of the real FFT of frame length N, N >= 8
+   @param[in]   pWindow    points to the analysis window of N values
+   @param[in]   hopLen     distance of the frames, i.e. N minus the overlap, hopLen > 0
+   @return      0: Success, 1: Unsupported frame or hop length
+*/
+int plp_welch_init_f32(plp_welch_instance_f32 *S,
+                       const plp_rfft_instance_f32 *pRfft,
+                       const float32_t *pWindow,
+                       uint16_t hopLen) {
+
+    PLP_PROFILE_FUNC();
+
+    uint32_t n;
+    uint32_t N = pRfft->FFTLength;
+    float32_t energy = 0.0f;
+
+    if ((hopLen == 0) || (N < 8)) {
+        return 1;
+    }
+
+    for (n = 0; n < N; n++) {
+        energy += pWindow[n] * pWindow[n];
+    }
+
+    S->pRfft = pRfft;
+    S->pWindow = pWindow;
+    S->hopLen = hopLen;
+    S->scale = 1.0f / energy;
+
+    return 0;
+}
+
+/**
+   @} end of welch group
+*/
@@ -0,0 +1,70 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_welch_init_q16.c
+ * Description:  Initialization of the 16-bit fixed point Welch estimators
+ *
+ * $Date:        17. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/**
+  @ingroup welch
+ */
+
+/**
+  @addtogroup welch
+  @{
+ */
+
+/**
+   @brief  Initialization of the 16 bit fixed-point Welch PSD and CSD.
+
+   @param[out]  S          points to the instance of the 16 bit fixed-point Welch structure
+   @param[in]   pRfft      points to the instance of the real FFT of frame length N
+   @param[in]   pWindow    points to the analysis window of N values in Q1.15
+   @param[in]   hopLen     distance of the frames, i.e. N minus the overlap, hopLen > 0
+   @return      0: Success, 1: Unsupported hop length
+*/
+int plp_welch_init_q16(plp_welch_instance_q16 *S,
+                       const plp_rfft_instance_q16 *pRfft,
+                       const int16_t *pWindow,
+                       uint16_t hopLen) {
+
+    PLP_PROFILE_FUNC();
+
+    if (hopLen == 0) {
+        return 1;
+    }
+
+    S->pRfft = pRfft;
+    S->pWindow = pWindow;
+    S->hopLen = hopLen;
+
+    return 0;
+}
+
+/**
+   @} end of welch group
+*/
@@ -2,6 +2,7 @@
 
 import os
 import re
+import sys
 import argparse
 from collections import namedtuple
 
@@ -15,17 +16,35 @@ def main():
     parser_view.add_argument('-b', '--bench-file', type=str, help='Benchmark CSV file to be read. If unspecified, take the most recent.')
     parser_view.add_argument('-f', '--function', type=str, help='Regex to only show the specified function.')
     parser_view.add_argument('-d', '--device', type=str, help='Filter to only show the given device')
+    parser_view.add_argument('-N', '--normalize', action='store_true', help='Divide ops/c by the number of SIMD lanes of the data type.')
 
     parser_cmp = subparsers.add_parser('compare', help='Compare multiple bench files')
     parser_cmp.add_argument('-n', '--new-bench-file', type=str, help='Benchmark CSV file to be read. If unspecified, take the most recent.')
     parser_cmp.add_argument('-o', '--old-bench-file', type=str, help='Benchmark CSV file to compare to.', required=True)
     parser_cmp.add_argument('-f', '--function', type=str, help='Regex to only show the specified function')
     parser_cmp.add_argument('-d', '--device', type=str, help='Filter to only show the given device')
+    parser_cmp.add_argument('-N', '--normalize', action='store_true', help='Divide ops/c by the number of SIMD lanes of the data type.')
 
     parser_score = subparsers.add_parser('score', help='compute a socre based on the imporvement of the benchmark')
     parser_score.add_argument('-n', '--new-bench-file', type=str, help='Benchmark CSV file to be read. If unspecified, take the most recent.')
     parser_score.add_argument('-o', '--old-bench-file', type=str, help='Benchmark CSV file to compare to.', required=True)
 
+    parser_reg = subparsers.add_parser('regress', help='Fail if the cycles of any benchmark increased beyond a threshold')
+    parser_reg.add_argument('-n', '--new-bench-file', type=str, help='Benchmark CSV file to be read. If unspecified, take the most recent.')
+    parser_reg.add_argument('-o', '--old-bench-file', type=str, help='Benchmark CSV file to compare to.', required=True)
+    parser_reg.add_argument('-t', '--threshold', type=float, default=5.0, help='Allowed increase of cycles in percent (default: 5).')
+    parser_reg.add_argument('-c', '--min-cycles', type=int, default=0, help='Ignore increases of at most this many cycles (default: 0).')
+    parser_reg.add_argument('-f', '--function', type=str, help='Regex to only check the specified function')
+    parser_reg.add_argument('-d', '--device', type=str, help='Filter to only check the given device')
+
+    parser_roof = subparsers.add_parser('roofline', help='Classify each benchmark as compute- or memory-bound')
+    parser_roof.add_argument('-b', '--bench-file', type=str, help='Benchmark CSV file to be read. If unspecified, take the most recent.')
+    parser_roof.add_argument('-f', '--function', type=str, help='Regex to only show the specified function.')
+    parser_roof.add_argument('-d', '--device', type=str, help='Filter to only show the given device')
+    parser_roof.add_argument('-w', '--bandwidth', type=float, default=4.0, help='Memory bandwidth in bytes per cycle and core (default: 4).')
+    parser_roof.add_argument('-p', '--cores', type=int, default=8, help='Number of cores used by the _parallel functions (default: 8).')
+    parser_roof.add_argument('-s', '--stall-threshold', type=float, default=10.0, help='Percentage of cycles lost in ld_stall and tcdm_cont above which a benchmark is memory-bound (default: 10).')
+
     args = parser.parse_args()
 
     if args.command == 'view':
@@ -34,6 +53,10 @@ def main():
         compare(args)
     elif args.command == "score":
         score(args)
+    elif args.command == "regress":
+        regress(args)
+    elif args.command == "roofline":
+        roofline(args)
 
 
 def view(args):
@@ -47,6 +70,9 @@ def view(args):
     runs = read_bench(bench_file)
     # filter runs
     runs = filter_runs(runs, args.function, args.device)
+    # normalize the ops per cycle
+    if args.normalize:
+        runs = [normalize_run(r) for r in runs]
     # print remaining runs
     print_runs(runs)
 
@@ -68,6 +94,11 @@ def compare(args):
     new_runs = filter_runs(new_runs, args.function, args.device)
     old_runs = filter_runs(old_runs, args.function, args.device)
 
+    # normalize the ops per cycle
+    if args.normalize:
+        new_runs = [normalize_run(r) for r in new_runs]
+        old_runs = [normalize_run(r) for r in old_runs]
+
     # compare and match
     new_runs, old_runs = match_two_runs(new_runs, old_runs)
 
@@ -103,13 +134,127 @@ def score(args):
 
 def score_fun(run_old, run_new):
     x = 0.0
-    x += clamp((run_old.cycles - run_new.cycles) / run_old.cycles, -1.0, 1.0) * 3
-    x += clamp((run_old.imiss - run_new.imiss) / run_old.imiss, -1.0, 1.0)
-    x += clamp((run_old.ld_stall - run_new.ld_stall) / run_old.ld_stall, -1.0, 1.0)
-    x += clamp((run_old.tcdm_cont - run_new.tcdm_cont) / run_old.tcdm_cont, -1.0, 1.0)
+    x += clamp(relative_decrease(run_old.cycles, run_new.cycles), -1.0, 1.0) * 3
+    x += clamp(relative_decrease(run_old.imiss, run_new.imiss), -1.0, 1.0)
+    x += clamp(relative_decrease(run_old.ld_stall, run_new.ld_stall), -1.0, 1.0)
+    x += clamp(relative_decrease(run_old.tcdm_cont, run_new.tcdm_cont), -1.0, 1.0)
     return x
 
 
+def relative_decrease(old, new):
+    """ returns (old - new) / old, or 0 if the counter is not available (host or simulator) """
+    if old == 0:
+        return 0.0
+    return (old - new) / old
+
+
+def regress(args):
+    """ regression gate: exits with 1 if the cycles of any matched run increased too much """
+    if args.new_bench_file is None:
+        new_bench_file = get_most_recent_bench_filename()
+    else:
+        new_bench_file = args.new_bench_file
+
+    old_bench_file = args.old_bench_file
+
+    new_runs = filter_runs(read_bench(new_bench_file), args.function, args.device)
+    old_runs = filter_runs(read_bench(old_bench_file), args.function, args.device)
+    num_old = len(old_runs)
+
+    new_runs, old_runs = match_two_runs(new_runs, old_runs)
+
+    regressions = [(r_new, r_old) for r_new, r_old in zip(new_runs, old_runs)
+                   if is_regression(r_new, r_old, args.threshold, args.min_cycles)]
+    improvements = [(r_new, r_old) for r_new, r_old in zip(new_runs, old_runs)
+                    if r_new.cycles < r_old.cycles]
+
+    if regressions:
+        print_comparison(*zip(*regressions))
+
+    print("checked:     {} runs ({} without match in the new file)".format(len(new_runs),
+                                                                         num_old - len(old_runs)))
+    print("improved:    {} runs".format(len(improvements)))
+    print("regressions: {} runs (threshold: {}%, {} cycles)".format(len(regressions),
+                                                                    args.threshold,
+                                                                    args.min_cycles))
+
+    if regressions:
+        sys.exit(1)
+
+
+def is_regression(run_new, run_old, threshold, min_cycles):
+    """ returns True if the cycles increased by more than threshold percent and min_cycles """
+    increase = run_new.cycles - run_old.cycles
+    if increase <= min_cycles:
+        return False
+    if run_old.cycles == 0:
+        return True
+    return increase * 100.0 / run_old.cycles > threshold
+
+
+def roofline(args):
+    """ Roofline subcommand """
+    if args.bench_file is None:
+        bench_file = get_most_recent_bench_filename()
+    else:
+        bench_file = args.bench_file
+
+    runs = read_bench(bench_file)
+    runs = filter_runs(runs, args.function, args.device)
+
+    rows = [format_roofline_to_str_list(r, args.bandwidth, args.cores, args.stall_threshold)
+            for r in runs]
+    print_table(ROOFLINE_HEADER, rows, 3)
+
+
+# number of elements processed per instruction by the packed SIMD extension of riscy
+SIMD_LANES = {"8": 4, "16": 2, "32": 1}
+DATA_TYPE_RE = re.compile("_[iqf](8|16|32)(_|$)")
+
+
+def simd_lanes(run):
+    """ returns the number of SIMD lanes of the data type of the run (1 on ibex) """
+    match = DATA_TYPE_RE.search(run.name)
+    if run.device == "ibex" or match is None:
+        return 1
+    return SIMD_LANES[match.group(1)]
+
+
+def num_cores(run, cores):
+    """ returns the number of cores on which the run was executed """
+    return cores if run.name.endswith("_parallel") else 1
+
+
+def normalize_run(run):
+    """ returns the run with ops/c divided by the number of SIMD lanes of its data type """
+    return run._replace(mpc=run.mpc / simd_lanes(run))
+
+
+def roofline_bound(run, bandwidth, cores, stall_threshold):
+    """
+    returns (intensity, roof, stall, bound), where intensity is ops/byte (None if the bytes moved are
+    unknown), roof is the attainable ops/cycle, stall the percentage of cycles lost in ld_stall and
+    tcdm_cont and bound is "compute", "memory" or "-" if neither is known.
+    """
+    peak = simd_lanes(run) * num_cores(run, cores)
+    peak_bandwidth = bandwidth * num_cores(run, cores)
+    stall = (run.ld_stall + run.tcdm_cont) * 100.0 / run.cycles if run.cycles else 0.0
+
+    intensity = run.ops / run.bytes if run.bytes and run.ops else None
+    roof = min(peak, intensity * peak_bandwidth) if intensity is not None else peak
+
+    # the measured stalls override the model, since the counters are zero on host builds
+    if stall > stall_threshold:
+        bound = "memory"
+    elif intensity is not None:
+        bound = "memory" if intensity * peak_bandwidth < peak else "compute"
+    elif run.ld_stall or run.tcdm_cont:
+        bound = "compute"
+    else:
+        bound = "-"
+    return intensity, roof, stall, bound
+
+
 def clamp(x, min_val, max_val):
     if x < min_val:
         return min_val
@@ -128,7 +273,9 @@ def get_most_recent_bench_filename():
 
 
 HEADER = ["name", "device", "dimension", "cycles", "instructions", "ipc", "imiss", "ld_stall",
-          "tcdm_cont", "ops", "mpc"]
+          "tcdm_cont", "ops", "mpc", "bytes"]
+# bench files written before the bytes column was added, and by plp_profile_dump
+HEADER_LEGACY = HEADER[:-1]
 Run = namedtuple("Run", HEADER)
 
 
@@ -138,8 +285,8 @@ def read_bench(bench_file):
         # check the first line
         lines = iter(f.readlines())
         header = next(lines).strip().split(",")
-        assert(header == HEADER)
-        runs = [run_from_csv_line(line) for line in lines]
+        assert(header in [HEADER, HEADER_LEGACY])
+        runs = [run_from_csv_line(line) for line in lines if line.strip()]
     # sort the runs
     runs = sorted(runs, key=run_sort_key)
     return runs
@@ -187,6 +334,8 @@ def match_two_runs(runs_a, runs_b):
 
 TABLE_HEADER = ["function", "device", "dimension", "cycles", "insn", "i/c", "imiss", "ld_stall",
                 "tcdm_cont", "ops", "ops/c"]
+ROOFLINE_HEADER = ["function", "device", "dimension", "ops", "bytes", "ops/B", "ops/c", "roof",
+                   "eff", "stall", "bound"]
 TABLE_HEADER_COMP = ["function", "device", "dimension", "cycles", "", "insn", "", "i/c", "",
                      "imiss", "", "ld_stall", "", "tcdm_cont", "", "ops", "", "ops/c", ""]
 
@@ -238,6 +387,22 @@ def print_comparison(new_runs, old_runs):
     print(hline)
 
 
+def print_table(header, rows, num_left):
+    """ print rows in a table, where the first num_left columns are left aligned """
+    column_width = [len(h) for h in header]
+    for row in rows:
+        column_width = [max(w, len(c)) for w, c in zip(column_width, row)]
+    fmt = "| " + " | ".join(["{:<%d}" % w if i < num_left else "{:>%d}" % w
+                             for i, w in enumerate(column_width)]) + " |"
+    hline = horizontal_line(column_width)
+    print(hline)
+    print(fmt.format(*header))
+    print(hline)
+    for row in rows:
+        print(fmt.format(*row))
+    print(hline)
+
+
 def get_column_width(runs_str, idx, header):
     """ returns the maximum width of the given column """
     return max(max([len(r[idx]) for r in runs_str]), len(header))
@@ -262,7 +427,8 @@ def run_from_csv_line(line):
                ld_stall=int(parts[7].strip()),
                tcdm_cont=int(parts[8].strip()),
                ops=int(parts[9].strip()),
-               mpc=float(parts[10].strip()))
+               mpc=float(parts[10].strip()),
+               bytes=int(parts[11].strip()) if len(parts) > 11 else 0)
 
 
 def format_run_to_str_list(run):
@@ -280,6 +446,22 @@ def format_run_to_str_list(run):
             format_float(run.mpc)]
 
 
+def format_roofline_to_str_list(run, bandwidth, cores, stall_threshold):
+    """ returns a list of strings with the roofline classification of the run """
+    intensity, roof, stall, bound = roofline_bound(run, bandwidth, cores, stall_threshold)
+    return [run.name,
+            run.device,
+            run.dimension,
+            str(run.ops),
+            str(run.bytes) if run.bytes else "-",
+            format_float(intensity) if intensity is not None else "-",
+            format_float(run.mpc),
+            format_float(roof),
+            "{:.1f}%".format(run.mpc * 100.0 / roof) if run.ops else "-",
+            "{:.1f}%".format(stall),
+            bound]
+
+
 def format_comparison_to_str_list(new_run, old_run):
     """ Returns a list of 19 strings """
     return [new_run.name,
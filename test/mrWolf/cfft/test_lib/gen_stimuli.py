@@ -20,17 +20,17 @@ def compute_result(result_parameter, inputs, env, fix_point):
     fix_point: None (if no fixpoint is used) or decimal point
     """
 
-    # Q16:
-    # len=16:    Q1.15 -> Q5.11
-    # len=32:    Q1.15 -> Q6.10
-    # len=64:    Q1.15 -> Q7.9
-    # len=128:   Q1.15 -> Q8.8
-    # len=256:   Q1.15 -> Q9.7
-    # len=512:   Q1.15 -> Q10.6
-    # len=1024:  Q1.15 -> Q11.5
-    # len=2048:  Q1.15 -> Q12.4
-    # len=4096:  Q1.15 -> Q13.3
-    bit_shift_dict = {16:11, 32:10, 64: 9, 128: 8, 256: 7, 512: 6, 1024: 5, 2048: 4, 4096: 3}
+    # The output is scaled by 1/N, i.e. the decimal point moves by log2(N) bits:
+    # len=16:    Q1.15 -> Q5.11    Q1.31 -> Q5.27
+    # len=32:    Q1.15 -> Q6.10    Q1.31 -> Q6.26
+    # len=64:    Q1.15 -> Q7.9     Q1.31 -> Q7.25
+    # len=128:   Q1.15 -> Q8.8     Q1.31 -> Q8.24
+    # len=256:   Q1.15 -> Q9.7     Q1.31 -> Q9.23
+    # len=512:   Q1.15 -> Q10.6    Q1.31 -> Q10.22
+    # len=1024:  Q1.15 -> Q11.5    Q1.31 -> Q11.21
+    # len=2048:  Q1.15 -> Q12.4    Q1.31 -> Q12.20
+    # len=4096:  Q1.15 -> Q13.3    Q1.31 -> Q13.19
+    log2_len_dict = {16: 4, 32: 5, 64: 6, 128: 7, 256: 8, 512: 9, 1024: 10, 2048: 11, 4096: 12}
 
 
     ctype = inputs['p1'].ctype;
@@ -47,17 +47,20 @@ def compute_result(result_parameter, inputs, env, fix_point):
 
     a = inputs['p1'].value.astype(my_type)
     result = np.zeros(len(a), dtype=my_type)
-    complex_a = np.zeros(int(len(a)/2), dtype=np.csingle)
-    complex_result = np.zeros(len(a)>>1, dtype=np.csingle)
+    # double precision, single precision is not accurate enough for Q1.31
+    complex_a = np.zeros(int(len(a)/2), dtype=np.cdouble)
+    complex_result = np.zeros(len(a)>>1, dtype=np.cdouble)
     if fix_point is None or fix_point == 0:
         raise RuntimeError("no fixpoint not implemented")
     else:
+        deci_point = inputs['deciPoint'].value
+        bit_shift = deci_point - log2_len_dict[int(len(a)/2)]
         for i in range(len(a)>>1):
-            complex_a[i] = a[2*i].astype(np.csingle)/(2**(inputs['deciPoint'].value)) + (a[2*i + 1].astype(np.csingle)/(2**(inputs['deciPoint'].value)))*1j
+            complex_a[i] = a[2*i].astype(np.cdouble)/(2**deci_point) + (a[2*i + 1].astype(np.cdouble)/(2**deci_point))*1j
         complex_result = np.fft.fft(complex_a)
         for i in range(int(len(a)/2)):
-            result[2*i] = (np.real(complex_result[i])*(2**(bit_shift_dict[int(len(a)/2)]))).astype(my_type)
-            result[2*i+1] = (np.imag(complex_result[i])*(2**(bit_shift_dict[int(len(a)/2)]))).astype(my_type)
+            result[2*i] = (np.real(complex_result[i])*(2**bit_shift)).astype(my_type)
+            result[2*i+1] = (np.imag(complex_result[i])*(2**bit_shift)).astype(my_type)
 
     return result
 
@@ -0,0 +1,68 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    # numRows x numCols complex matrix, row-major, real and imaginary parts interleaved
+    if result_parameter.ctype == 'int16_t':
+        if fix_point is None or fix_point == 0:
+            raise RuntimeError("no fixpoint not implemented")
+
+        # every 1D FFT scales by 1/N, the output is scaled by 1/(numRows*numCols)
+        a = inputs['pSrc'].value.astype(np.float64)
+        a = (a[0::2] + 1j * a[1::2]).reshape(env['numRows'], env['numCols'])
+        spectrum = np.fft.fft2(a).flatten() / (env['numRows'] * env['numCols'])
+        result = np.zeros(2 * len(spectrum), dtype=np.int16)
+        result[0::2] = np.round(np.real(spectrum)).astype(np.int16)
+        result[1::2] = np.round(np.imag(spectrum)).astype(np.int16)
+    else:
+        raise RuntimeError("Unrecognized result type: %s" % result_parameter.ctype)
+
+    return result
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def q_sat(x):
+    if x > 2**31 - 1:
+        return x - 2**32
+    elif x < -2**31:
+        return x + 2**32
+    else:
+        return x
+
+
+def q_add(a, b):
+    return q_sat(a + b)
+
+
+def q_sub(a, b):
+    return q_sat(a - b)
+
+
+def q_mul(a, b, p):
+    return q_roundnorm(a * b, p)
+
+
+def q_roundnorm(a, p):
+    rounding = 1 << (p - 1)
+    return q_sat((a + rounding) >> p)
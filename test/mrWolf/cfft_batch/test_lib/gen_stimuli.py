@@ -0,0 +1,75 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    # len x numTransforms complex matrix, row-major. The strided version transforms the columns,
+    # the contiguous version transforms the rows of the same data read as numTransforms x len.
+    if result_parameter.ctype == 'float':
+        a = inputs['pSrc'].value.astype(np.float64)
+        a = a[0::2] + 1j * a[1::2]
+        if env['strided']:
+            spectrum = np.fft.fft(a.reshape(env['len'], env['numTransforms']), axis=0).flatten()
+        else:
+            spectrum = np.fft.fft(a.reshape(env['numTransforms'], env['len']), axis=1).flatten()
+        result = np.zeros(2 * len(spectrum), dtype=np.float32)
+        result[0::2] = np.real(spectrum)
+        result[1::2] = np.imag(spectrum)
+
+        # the array which is not pDst keeps its initial value: the input for pSrc, zero for pOut
+        name = result_parameter.general_name()
+        if name == 'pSrc' and not env['inplace']:
+            result = inputs['pSrc'].value.astype(np.float32)
+        elif name == 'pOut' and env['inplace']:
+            result = np.zeros(len(result), dtype=np.float32)
+    else:
+        raise RuntimeError("Unrecognized result type: %s" % result_parameter.ctype)
+
+    return result
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def q_sat(x):
+    if x > 2**31 - 1:
+        return x - 2**32
+    elif x < -2**31:
+        return x + 2**32
+    else:
+        return x
+
+
+def q_add(a, b):
+    return q_sat(a + b)
+
+
+def q_sub(a, b):
+    return q_sat(a - b)
+
+
+def q_mul(a, b, p):
+    return q_roundnorm(a * b, p)
+
+
+def q_roundnorm(a, p):
+    rounding = 1 << (p - 1)
+    return q_sat((a + rounding) >> p)
@@ -0,0 +1,388 @@
+#! /usr/bin/python3
+
+import os
+import re
+import sys
+import json
+import argparse
+import numpy as np
+
+from bench import read_bench, filter_runs, num_cores, print_table, format_float
+
+# name of the sweep variable which holds the number of cores in the scaling mode
+SCALING_VARIABLE = "nPE"
+DEFAULT_MODEL_FILE = "cost_model.json"
+
+
+def main():
+    """ Main Function """
+    parser = argparse.ArgumentParser(prog='cost_model',
+                                     description='Fit and query per-kernel cycle models from the '
+                                                 'benchmark database')
+    subparsers = parser.add_subparsers(dest='command')
+
+    parser_fit = subparsers.add_parser('fit', help='Fit a cost model for every kernel')
+    parser_fit.add_argument('-b', '--bench-files', type=str, nargs='+', help='Benchmark CSV files to be read. If unspecified, take all bench_*.csv files.')
+    parser_fit.add_argument('-o', '--output', type=str, default=DEFAULT_MODEL_FILE, help='Model file to be written (default: {}).'.format(DEFAULT_MODEL_FILE))
+    parser_fit.add_argument('-f', '--function', type=str, help='Regex to only fit the specified function')
+    parser_fit.add_argument('-d', '--device', type=str, help='Filter to only fit the given device')
+    parser_fit.add_argument('-p', '--cores', type=int, default=8, help='Number of cores of the _parallel functions without an nPE dimension (default: 8).')
+    parser_fit.add_argument('-t', '--threshold', type=float, default=10.0, help='Allowed deviation of the fitted runs from the model in percent (default: 10).')
+
+    parser_est = subparsers.add_parser('estimate', help='Estimate the cycles and energy of a processing chain')
+    parser_est.add_argument('chain', type=str, help='YAML file describing the chain')
+    parser_est.add_argument('-m', '--model', type=str, default=DEFAULT_MODEL_FILE, help='Model file to be read (default: {}).'.format(DEFAULT_MODEL_FILE))
+
+    parser_chk = subparsers.add_parser('check', help='Flag kernels whose measured ops/c deviate from the model')
+    parser_chk.add_argument('-b', '--bench-file', type=str, help='Benchmark CSV file to be checked. If unspecified, take the most recent.')
+    parser_chk.add_argument('-m', '--model', type=str, default=DEFAULT_MODEL_FILE, help='Model file to be read (default: {}).'.format(DEFAULT_MODEL_FILE))
+    parser_chk.add_argument('-t', '--threshold', type=float, default=10.0, help='Allowed deviation of ops/c from the model in percent (default: 10).')
+    parser_chk.add_argument('-f', '--function', type=str, help='Regex to only check the specified function')
+    parser_chk.add_argument('-d', '--device', type=str, help='Filter to only check the given device')
+    parser_chk.add_argument('-p', '--cores', type=int, default=8, help='Number of cores of the _parallel functions without an nPE dimension (default: 8).')
+
+    args = parser.parse_args()
+
+    if args.command == 'fit':
+        fit(args)
+    elif args.command == 'estimate':
+        estimate(args)
+    elif args.command == 'check':
+        check(args)
+    else:
+        parser.print_help()
+
+
+def fit(args):
+    """ Fit subcommand """
+    if args.bench_files is None:
+        bench_files = get_all_bench_filenames()
+    else:
+        bench_files = args.bench_files
+
+    runs = []
+    for bench_file in bench_files:
+        runs += read_bench(bench_file)
+    runs = filter_runs(runs, args.function, args.device)
+
+    # group the runs by kernel, later bench files override earlier measurements of the same case
+    groups = {}
+    for run in runs:
+        samples = groups.setdefault(model_key(run.name, run.device), {})
+        samples[run.dimension] = run
+
+    models = {}
+    for key, samples in sorted(groups.items()):
+        model = fit_kernel(list(samples.values()), args.cores)
+        if model is not None:
+            models[key] = model
+
+    with open(args.output, "w") as f:
+        json.dump(models, f, indent=2, sort_keys=True)
+
+    rows = [format_model_to_str_list(m) for m in models.values()]
+    print_table(MODEL_HEADER, rows, 3)
+    print("{} models written to {}".format(len(models), args.output))
+
+    # self-consistency: the model must not flag the runs it was fitted to
+    fitted = [run for samples in groups.values() for run in samples.values()]
+    rows = deviating_runs(fitted, models, args.threshold, args.cores)
+    if rows:
+        print_table(CHECK_HEADER, rows, 3)
+        print("{} fitted runs deviate by more than {}% from their own model".format(
+            len(rows), args.threshold))
+        sys.exit(1)
+
+
+def estimate(args):
+    """ Estimate subcommand """
+    models = read_model(args.model)
+    chain = read_chain(args.chain)
+
+    frequency = chain.get("frequency_mhz")
+    budget = chain.get("budget_cycles")
+    if budget is None and chain.get("budget_us") is not None:
+        if frequency is None:
+            sys.exit("budget_us requires frequency_mhz")
+        budget = chain["budget_us"] * frequency
+    energy_per_cycle = chain.get("energy_pj_per_cycle")
+    device = chain.get("device", "riscy")
+
+    rows = []
+    total_cycles = 0.0
+    total_energy = 0.0
+    for stage in chain["chain"]:
+        kernel = stage["kernel"]
+        model = models.get(model_key(kernel, stage.get("device", device)))
+        if model is None:
+            sys.exit("no model for {} on {}".format(kernel, stage.get("device", device)))
+        dimension = {k: float(v) for k, v in stage.get("dimension", {}).items()}
+        repeat = stage.get("repeat", 1)
+
+        cycles, cores, extrapolated = predict(model, dimension)
+        cycles *= repeat
+        total_cycles += cycles
+        energy = cycles * cores * energy_per_cycle if energy_per_cycle is not None else None
+        if energy is not None:
+            total_energy += energy
+        rows.append([kernel + (" *" if extrapolated else ""),
+                     format_dimension(stage.get("dimension", {})),
+                     str(repeat),
+                     str(cores),
+                     str(int(round(cycles))),
+                     format_energy(energy)])
+
+    rows.append(["total", "", "", "", str(int(round(total_cycles))),
+                 format_energy(total_energy if energy_per_cycle is not None else None)])
+    print_table(ESTIMATE_HEADER, rows, 2)
+    if any(r[0].endswith(" *") for r in rows):
+        print("* outside of the measured range, the estimate is extrapolated")
+
+    if frequency is not None:
+        print("time: {} us at {} MHz".format(format_float(total_cycles / frequency), frequency))
+    if budget is not None:
+        usage = total_cycles * 100.0 / budget
+        print("budget: {} cycles, used {}%".format(int(budget), format_float(usage, 1)))
+        if total_cycles > budget:
+            print("The chain does not fit in the frame budget!")
+            sys.exit(1)
+
+
+def check(args):
+    """ Check subcommand """
+    if args.bench_file is None:
+        bench_file = get_all_bench_filenames()[-1]
+    else:
+        bench_file = args.bench_file
+
+    models = read_model(args.model)
+    runs = read_bench(bench_file)
+    runs = filter_runs(runs, args.function, args.device)
+
+    rows = deviating_runs(runs, models, args.threshold, args.cores)
+    if rows:
+        print_table(CHECK_HEADER, rows, 3)
+        print("{} runs deviate by more than {}% from the model".format(len(rows), args.threshold))
+        sys.exit(1)
+    print("All runs are within {}% of the model".format(args.threshold))
+
+
+def deviating_runs(runs, models, threshold, cores):
+    """ returns the rows of the check table for the runs which deviate from their model """
+    rows = []
+    for run in runs:
+        model = models.get(model_key(run.name, run.device))
+        if model is None or not run.cycles:
+            continue
+        dimension = parse_dimension(run.dimension)
+        dimension.setdefault(SCALING_VARIABLE, num_cores(run, cores))
+        cycles, _, _ = predict(model, dimension)
+        # ops/c scales with the inverse of the cycles, since the ops of a case are fixed
+        deviation = (cycles / run.cycles - 1) * 100.0
+        if abs(deviation) > threshold:
+            rows.append([run.name, run.device, run.dimension, str(run.cycles),
+                         str(int(round(cycles))), format_float(deviation, 1) + "%",
+                         "faster" if deviation > 0 else "slower"])
+    return rows
+
+
+def model_key(name, device):
+    return "{}/{}".format(device, name)
+
+
+def parse_dimension(dimension):
+    """ parses the dimension column of a bench file ("M=4; N=8") to a dict of its numeric values """
+    values = {}
+    for part in dimension.split(";"):
+        if "=" not in part:
+            continue
+        key, value = part.split("=", 1)
+        try:
+            values[key.strip()] = float(value)
+        except ValueError:
+            pass
+    return values
+
+
+def fit_kernel(runs, cores):
+    """
+    Fits the model of a kernel. The work is a monomial of the dimensions, k * prod(d_i^e_i), fitted
+    in log space to the ops of the runs (or the product of the dimensions if the ops are unknown).
+    The cycles are overhead + per_op * work / nPE + per_core * nPE, where the last term is only used
+    if the runs were measured with different core counts. The coefficients are fitted to the
+    relative error (each row weighted by 1 / cycles), such that small cases count as much as large
+    ones, and constrained to be non-negative.
+    """
+    points = []
+    for run in runs:
+        dimension = parse_dimension(run.dimension)
+        n_pe = dimension.pop(SCALING_VARIABLE, num_cores(run, cores))
+        if run.cycles <= 0 or any(v <= 0 for v in dimension.values()):
+            continue
+        points.append((dimension, n_pe, run.ops, run.cycles))
+    if not points:
+        return None
+
+    variables = sorted(set.intersection(*[set(d.keys()) for d, _, _, _ in points]))
+    # variables which do not change within the runs cannot be separated from the coefficient
+    variables = [v for v in variables if len(set(d[v] for d, _, _, _ in points)) > 1]
+
+    x = np.array([[np.log(d[v]) for v in variables] + [1.0] for d, _, _, _ in points])
+    if all(ops > 0 for _, _, ops, _ in points):
+        y = np.log([ops for _, _, ops, _ in points])
+        solution = np.linalg.lstsq(x, y, rcond=None)[0]
+        exponents = {v: float(e) for v, e in zip(variables, solution[:-1])}
+        coef = float(np.exp(solution[-1]))
+    else:
+        exponents = {v: 1.0 for v in variables}
+        coef = 1.0
+
+    name = runs[0].name
+    model = {"name": name,
+             "device": runs[0].device,
+             "ops": {"coef": coef, "exp": exponents},
+             "cores": sorted(set(int(p) for _, p, _, _ in points)),
+             "samples": len(points)}
+
+    work = np.array([work_of(model, d) / p for d, p, _, _ in points])
+    n_pe = np.array([p for _, p, _, _ in points])
+    cycles = np.array([c for _, _, _, c in points], dtype=float)
+
+    columns = [np.ones(len(points)), work]
+    if len(model["cores"]) > 1:
+        columns.append(n_pe)
+    a = np.stack(columns, axis=1)
+    if np.linalg.matrix_rank(a) < a.shape[1]:
+        # a single problem size: the overhead cannot be separated from the work
+        a = a[:, 1:2]
+        solution = np.concatenate([[0.0], nnls(a / cycles[:, None], np.ones(len(points)))])
+    else:
+        solution = nnls(a / cycles[:, None], np.ones(len(points)))
+
+    model["cycles"] = {"overhead": float(solution[0]),
+                       "per_op": float(solution[1]),
+                       "per_core": float(solution[2]) if len(solution) > 2 else 0.0}
+    model["work_range"] = [float(work.min()), float(work.max())]
+
+    predicted = a.dot(solution[-a.shape[1]:])
+    residual = np.sum((cycles - predicted) ** 2)
+    total = np.sum((cycles - cycles.mean()) ** 2)
+    model["r2"] = float(1.0 - residual / total) if total > 0 else 1.0
+    return model
+
+
+def nnls(a, b):
+    """
+    Non-negative least squares, the active set method of Lawson and Hanson: returns x >= 0 which
+    minimizes |a x - b|. The columns are scaled to unit norm, such that one tolerance fits all.
+    """
+    scale = np.linalg.norm(a, axis=0)
+    scale[scale == 0] = 1.0
+    a = a / scale
+    n = a.shape[1]
+    x = np.zeros(n)
+    passive = np.zeros(n, dtype=bool)
+    tol = 1e-10 * max(1.0, np.linalg.norm(b))
+    for _ in range(3 * n):
+        gradient = a.T.dot(b - a.dot(x))
+        if passive.all() or np.max(gradient[~passive]) <= tol:
+            break
+        passive[np.argmax(np.where(passive, -np.inf, gradient))] = True
+        while True:
+            z = np.zeros(n)
+            z[passive] = np.linalg.lstsq(a[:, passive], b, rcond=None)[0]
+            if np.all(z[passive] > 0):
+                x = z
+                break
+            # move towards z until the first coefficient reaches zero, and release it
+            negative = passive & (z <= 0)
+            alpha = np.min(x[negative] / np.maximum(x[negative] - z[negative], 1e-300))
+            x = x + alpha * (z - x)
+            passive &= x > tol
+            if not passive.any():
+                break
+    return x / scale
+
+
+def work_of(model, dimension):
+    """ returns the work (ops) of the kernel for the given dimension """
+    work = model["ops"]["coef"]
+    for var, exp in model["ops"]["exp"].items():
+        if var not in dimension:
+            sys.exit("{} requires the dimension {}".format(model["name"], var))
+        work *= dimension[var] ** exp
+    return work
+
+
+def predict(model, dimension):
+    """ returns (cycles, cores, extrapolated) of the kernel for the given dimension """
+    cores = int(dimension.get(SCALING_VARIABLE, model["cores"][-1]))
+    work = work_of(model, dimension) / cores
+    coef = model["cycles"]
+    cycles = coef["overhead"] + coef["per_op"] * work + coef["per_core"] * cores
+    low, high = model["work_range"]
+    extrapolated = work < low or work > high or cores not in model["cores"]
+    return max(cycles, 0.0), cores, extrapolated
+
+
+def read_model(model_file):
+    if not os.path.isfile(model_file):
+        sys.exit("model file {} not found, run 'cost_model.py fit' first".format(model_file))
+    with open(model_file, "r") as f:
+        return json.load(f)
+
+
+def read_chain(chain_file):
+    try:
+        import yaml
+    except ImportError:
+        sys.exit("reading the chain requires pyyaml")
+    with open(chain_file, "r") as f:
+        chain = yaml.safe_load(f)
+    if not chain or "chain" not in chain:
+        sys.exit("{} does not contain a chain".format(chain_file))
+    return chain
+
+
+def get_all_bench_filenames():
+    """ returns all bench files in the location of this file, sorted from the oldest to the newest """
+    bench_re = re.compile(r"^bench_.*\.csv$")
+    cwd = os.path.dirname(os.path.realpath(__file__))
+    bench_files = sorted([f for f in os.listdir(cwd) if bench_re.search(f)])
+    if not bench_files:
+        sys.exit("no bench files found in {}".format(cwd))
+    return [os.path.join(cwd, f) for f in bench_files]
+
+
+MODEL_HEADER = ["function", "device", "ops", "overhead", "c/op", "c/core", "nPE", "samples", "r2"]
+ESTIMATE_HEADER = ["function", "dimension", "repeat", "nPE", "cycles", "energy [nJ]"]
+CHECK_HEADER = ["function", "device", "dimension", "cycles", "model", "ops/c", ""]
+
+
+def format_model_to_str_list(model):
+    ops = format_float(model["ops"]["coef"], 2)
+    for var, exp in sorted(model["ops"]["exp"].items()):
+        ops += " * {}^{}".format(var, format_float(exp, 2))
+    coef = model["cycles"]
+    return [model["name"],
+            model["device"],
+            ops,
+            format_float(coef["overhead"], 1),
+            format_float(coef["per_op"]),
+            format_float(coef["per_core"], 1),
+            ",".join(str(c) for c in model["cores"]),
+            str(model["samples"]),
+            format_float(model["r2"])]
+
+
+def format_dimension(dimension):
+    return "; ".join("{}={}".format(k, v) for k, v in dimension.items())
+
+
+def format_energy(energy):
+    """ energy is given in pJ, returns nJ """
+    return format_float(energy / 1000.0) if energy is not None else "-"
+
+
+if __name__ == '__main__':
+    main()
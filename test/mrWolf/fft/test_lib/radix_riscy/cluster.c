@@ -0,0 +1,107 @@
+#include "rt/rt_api.h"
+#include "stdio.h"
+#include "plp_math.h"
+
+#include "cluster.h"
+
+// Compares the radix-2 and the mixed radix-4/2 floating-point real FFT. The radix is chosen when
+// compiling the library: build it once with and once without PLP_MATH_FFT_RADIX4 (plp_math.h)
+// and run this benchmark against both builds.
+
+#if defined(PLP_MATH_FFT_RADIX4)
+#define FFT_RADIX 4
+#else
+#define FFT_RADIX 2
+#endif
+
+// number of butterfly stages of the packed complex FFT of length FFTLength/2
+static int fft_stages(int fft_len) {
+  int log2_len = 31 - __builtin_clz(fft_len >> 1);
+#if defined(PLP_MATH_FFT_RADIX4)
+  return (log2_len >> 1) + (log2_len & 1);
+#else
+  return log2_len;
+#endif
+}
+
+static void *alloc_data(int size, int *is_l1) {
+  void *ptr = rt_alloc(RT_ALLOC_CL_DATA, size);
+  *is_l1 = 1;
+  if (ptr == NULL) {
+    ptr = rt_alloc(RT_ALLOC_L2_CL_DATA, size);
+    *is_l1 = 0;
+  }
+  return ptr;
+}
+
+static void free_data(void *ptr, int size, int is_l1) {
+  rt_free(is_l1 ? RT_ALLOC_CL_DATA : RT_ALLOC_L2_CL_DATA, ptr, size);
+}
+
+// This benchmark is a single shot so we can read the value directly out of the
+// HW counter using the function rt_perf_read
+static void do_bench(rt_perf_t *perf, int events, plp_rfft_instance_f32 *S, float32_t *pSrc,
+                     float32_t *pDst, int nPE) {
+
+  // Activate specified events
+  rt_perf_conf(perf, events);
+
+  rt_perf_reset(perf);
+  rt_perf_start(perf);
+
+  if (nPE == 1) {
+    plp_rfft_f32(S, pSrc, pDst);
+  } else {
+    plp_rfft_f32_parallel(S, pSrc, nPE, pDst);
+  }
+
+  rt_perf_stop(perf);
+}
+
+void cluster_entry(void *arg){
+
+  rt_perf_t perf;
+  rt_perf_init(&perf);
+
+  printf("radix,len,cores,cycles,instructions,stages,barriers_est\n");
+
+  for (int len = FFT_LEN_MIN; len <= FFT_LEN_MAX; len <<= 1) {
+
+    int src_l1, dst_l1, tw_l1;
+    float32_t *pSrc = alloc_data(sizeof(float32_t) * len, &src_l1);
+    float32_t *pDst = alloc_data(sizeof(float32_t) * 2 * len, &dst_l1);
+    Complex_type_f32 *pTwiddle = alloc_data(sizeof(Complex_type_f32) * len / 2, &tw_l1);
+
+    for (int k = 0; k < len / 2; k++) {
+      pTwiddle[k].re = cosf(2.0f * M_PI * k / len);
+      pTwiddle[k].im = -sinf(2.0f * M_PI * k / len);
+    }
+    for (int n = 0; n < len; n++) {
+      pSrc[n] = cosf(2.0f * M_PI * 5 * n / len) + 0.5f * sinf(2.0f * M_PI * 17 * n / len);
+    }
+
+    plp_rfft_instance_f32 S;
+    S.FFTLength = len;
+    S.bitReverseFlag = 0;
+    S.pTwiddleFactors = (float32_t *) pTwiddle;
+    S.pBitReverseLUT = NULL;
+
+    for (int nPE = 1; nPE <= NUM_CORES; nPE <<= 1) {
+      do_bench(&perf, (1<<RT_PERF_CYCLES) | (1<<RT_PERF_INSTR), &S, pSrc, pDst, nPE);
+
+      // Estimate, not a measurement: there is no performance counter for barriers and
+      // rt_team_barrier is inlined. The count is read off plp_rfft_f32_xpulpv2_parallel, which
+      // synchronizes once after each butterfly stage, the split and the mirror pass.
+      int stages = fft_stages(len);
+      int barriers_est = nPE == 1 ? 0 : stages + 2;
+
+      printf("%d,%d,%d,%d,%d,%d,%d\n", FFT_RADIX, len, nPE, rt_perf_read(RT_PERF_CYCLES),
+             rt_perf_read(RT_PERF_INSTR), stages, barriers_est);
+    }
+
+    free_data(pTwiddle, sizeof(Complex_type_f32) * len / 2, tw_l1);
+    free_data(pDst, sizeof(float32_t) * 2 * len, dst_l1);
+    free_data(pSrc, sizeof(float32_t) * len, src_l1);
+  }
+
+}
@@ -0,0 +1,10 @@
+#ifndef __INC_CLUSTER_H__
+#define __INC_CLUSTER_H__
+
+void cluster_entry(void *arg);
+
+#define FFT_LEN_MIN 256
+#define FFT_LEN_MAX 4096
+#define NUM_CORES 8
+
+#endif
@@ -0,0 +1,75 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    if "return_value" in result_parameter.name:
+        return 0
+    # the triangle is not an argument, build the same matrix as testset.cfg
+    a = unpack_tri(packed_tri_matrix(env), env['len_n'], env['upper']).astype(np.float64)
+    b = inputs['pSrcB'].value.reshape((env['len_n'], env['len_o'])).astype(np.float64)
+    result = np.linalg.solve(a, b).astype(np.float32).flatten()
+    return result
+
+
+def packed_tri_matrix(env):
+    """ diagonally dominant triangle, packed row by row, testset.cfg builds the same matrix """
+    rng = np.random.RandomState(env['len_n'] * 10 + env['upper'])
+    n = env['len_n']
+    a = rng.uniform(-1.0, 1.0, size=(n, n)) / n
+    a[np.diag_indices(n)] = rng.choice([-1.0, 1.0], size=n) * rng.uniform(1.0, 2.0, size=n)
+    return a[np.triu_indices(n) if env['upper'] else np.tril_indices(n)].astype(np.float32)
+
+
+def unpack_tri(packed, n, upper):
+    """ dense matrix from the packed triangle, row by row """
+    a = np.zeros((n, n), dtype=packed.dtype)
+    a[np.triu_indices(n) if upper else np.tril_indices(n)] = packed
+    return a
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def q_sat(x):
+    if x > 2**31 - 1:
+        return x - 2**32
+    elif x < -2**31:
+        return x + 2**32
+    else:
+        return x
+
+
+def q_add(a, b):
+    return q_sat(a + b)
+
+
+def q_sub(a, b):
+    return q_sat(a - b)
+
+
+def q_mul(a, b, p):
+    return q_roundnorm(a * b, p)
+
+
+def q_roundnorm(a, p):
+    rounding = 1 << (p - 1)
+    return q_sat((a + rounding) >> p)
@@ -0,0 +1,80 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    a = weights(inputs['pSrcA'].value, env['len_m'], env['len_n'], inputs['pSrcX'].ctype)
+    y = np.matmul(a, inputs['pSrcX'].value.astype(np.int64))
+    y = requant(y, inputs['pMult'].value, inputs['pBias'].value, inputs['shift'].value,
+                result_parameter.ctype)
+    dtype = {'int8_t': np.int8, 'int16_t': np.int16, 'int32_t': np.int32}[result_parameter.ctype]
+    result = y.astype(dtype).flatten()
+    return result
+
+
+def weights(packed, m, n, ctype_b):
+    """ dense weights, the i4i8 version unpacks two 4-bit values per byte """
+    if ctype_b == 'int16_t':
+        return packed.astype(np.int64).reshape((m, n))
+    packed = packed.astype(np.uint8).reshape((m, (n + 1) // 2))
+    low = (packed & 0xf).astype(np.int64)
+    high = (packed >> 4).astype(np.int64)
+    a = np.zeros((m, 2 * packed.shape[1]), dtype=np.int64)
+    a[:, 0::2] = low
+    a[:, 1::2] = high
+    a = np.where(a >= 8, a - 16, a)
+    return a[:, :n]
+
+
+def requant(s, mult, bias, shift, ctype):
+    """ rounding shift of s * mult + bias per row, saturated to the output type """
+    bits = 16 if ctype == 'int16_t' else 8
+    v = (s * mult.astype(np.int64) + bias.astype(np.int64) + (1 << (shift - 1))) >> shift
+    return np.clip(v, -(1 << (bits - 1)), (1 << (bits - 1)) - 1)
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def q_sat(x):
+    if x > 2**31 - 1:
+        return x - 2**32
+    elif x < -2**31:
+        return x + 2**32
+    else:
+        return x
+
+
+def q_add(a, b):
+    return q_sat(a + b)
+
+
+def q_sub(a, b):
+    return q_sat(a - b)
+
+
+def q_mul(a, b, p):
+    return q_roundnorm(a * b, p)
+
+
+def q_roundnorm(a, p):
+    rounding = 1 << (p - 1)
+    return q_sat((a + rounding) >> p)
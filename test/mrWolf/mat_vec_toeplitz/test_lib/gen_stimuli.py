@@ -0,0 +1,77 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    m, n = np.meshgrid(np.arange(env['len_m']), np.arange(env['len_n']), indexing='ij')
+    t = inputs['pSrcT'].value[m - n + env['len_n'] - 1]
+    x = inputs['pSrcX'].value.reshape((env['len_n'], 1))
+    y = mat_mult_ref(t, x, fix_point)
+    if result_parameter.ctype == 'int16_t':
+        result = y.astype(np.int16)
+    elif result_parameter.ctype == 'float':
+        result = y.astype(np.float32)
+    else:
+        raise RuntimeError("Unrecognized result type: %s" % result_parameter.ctype)
+    result = result.flatten()
+    return result
+
+
+def mat_mult_ref(a, b, fix_point):
+    """ dense reference, the q16 version rounds each product and truncates the sum to 16 bit """
+    if fix_point is None:
+        return np.matmul(a.astype(np.float64), b.astype(np.float64))
+    a = a.astype(np.int64)
+    b = b.astype(np.int64)
+    rounding = 1 << (fix_point - 1)
+    result = np.zeros((a.shape[0], b.shape[1]), dtype=np.int64)
+    for n in range(a.shape[1]):
+        result += (np.outer(a[:, n], b[n, :]) + rounding) >> fix_point
+    return result.astype(np.int32).astype(np.int16)
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def q_sat(x):
+    if x > 2**31 - 1:
+        return x - 2**32
+    elif x < -2**31:
+        return x + 2**32
+    else:
+        return x
+
+
+def q_add(a, b):
+    return q_sat(a + b)
+
+
+def q_sub(a, b):
+    return q_sat(a - b)
+
+
+def q_mul(a, b, p):
+    return q_roundnorm(a * b, p)
+
+
+def q_roundnorm(a, p):
+    rounding = 1 << (p - 1)
+    return q_sat((a + rounding) >> p)
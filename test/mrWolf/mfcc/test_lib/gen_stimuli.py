@@ -0,0 +1,124 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    # log-mel energies of the Hann windowed frames with hop 160 and their DCT-II. The ring buffer of
+    # the STFT instance starts with zeros.
+    N = env['len']
+    hop = env['hop']
+    numOut = env['numOut']
+    x = np.concatenate((np.zeros(N - hop), inputs['pSrc'].value.astype(np.float64)))
+    w = 0.5 - 0.5 * np.cos(2 * np.pi * np.arange(N) / N)
+    start, end, weights = mel_filterbank(N, 16000, 40, 20.0, 8000.0)
+    dct = np.cos(np.pi * np.outer(np.arange(numOut), np.arange(40) + 0.5) / 40)
+
+    if result_parameter.ctype == 'float':
+        w = w.astype(np.float32).astype(np.float64)
+        weights = weights.astype(np.float32).astype(np.float64)
+        frames = [x[m * hop:m * hop + N] * w for m in range(env['numFrames'])]
+        power = np.abs(np.fft.rfft(frames, axis=1))**2
+        log_mel = np.log(np.array([mel_energies(p, start, end, weights) for p in power]))
+        result = log_mel if numOut == 40 else log_mel.dot(dct.T)
+        result = result.flatten().astype(np.float32)
+    elif result_parameter.ctype == 'int16_t':
+        if fix_point is None or fix_point == 0:
+            raise RuntimeError("no fixpoint not implemented")
+
+        # the power spectrum is in Q2.30, the weights in Q1.15 and the log-mel energies in Q5.10.
+        # The cepstral coefficients are scaled by 1/40.
+        w = np.round(w * 32767).astype(np.int64)
+        weights = np.minimum(np.round(weights * 32768), 32767)
+        frames = [(x[m * hop:m * hop + N].astype(np.int64) * w) >> 15
+                  for m in range(env['numFrames'])]
+        spectrum = np.fft.rfft(np.array(frames, dtype=np.float64), axis=1) / N
+        power = np.round(np.abs(spectrum)**2)
+        mel = np.array([mel_energies(p, start, end, weights) for p in power])
+        log_mel = np.log(np.maximum(mel, 1) / 2.0**45)
+        result = log_mel if numOut == 40 else log_mel.dot(dct.T) / 40
+        result = np.round(result * 1024).flatten().astype(np.int16)
+    else:
+        raise RuntimeError("Unrecognized result type: %s" % result_parameter.ctype)
+
+    return result
+
+
+def mel_filterbank(N, fs, bands, fmin, fmax):
+    """
+    Sparse triangular mel filterbank of plp_mfcc_sR_*_len512 (HTK mel scale), returns the first and
+    last FFT bin of each band and the weights of all bands.
+    """
+    def mel(f):
+        return 2595.0 * np.log10(1.0 + f / 700.0)
+
+    def imel(m):
+        return 700.0 * (10**(m / 2595.0) - 1.0)
+
+    edges = imel(mel(fmin) + np.arange(bands + 2) * (mel(fmax) - mel(fmin)) / (bands + 1))
+    edges[0], edges[-1] = fmin, fmax
+    start, end, weights = [], [], []
+    for b in range(bands):
+        lo, c, hi = edges[b:b + 3]
+        ks = [k for k in range(N // 2 + 1) if lo < k * fs / N < hi]
+        start.append(ks[0])
+        end.append(ks[-1])
+        for k in ks:
+            f = k * fs / N
+            weights.append((f - lo) / (c - lo) if f <= c else (hi - f) / (hi - c))
+    return start, end, np.array(weights)
+
+
+def mel_energies(power, start, end, weights):
+    result = []
+    i = 0
+    for s, e in zip(start, end):
+        result.append(np.dot(power[s:e + 1], weights[i:i + e - s + 1]))
+        i += e - s + 1
+    return np.array(result)
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def q_sat(x):
+    if x > 2**31 - 1:
+        return x - 2**32
+    elif x < -2**31:
+        return x + 2**32
+    else:
+        return x
+
+
+def q_add(a, b):
+    return q_sat(a + b)
+
+
+def q_sub(a, b):
+    return q_sat(a - b)
+
+
+def q_mul(a, b, p):
+    return q_roundnorm(a * b, p)
+
+
+def q_roundnorm(a, p):
+    rounding = 1 << (p - 1)
+    return q_sat((a + rounding) >> p)
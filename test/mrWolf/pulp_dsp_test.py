@@ -3,7 +3,7 @@ import time
 import random
 from plptest import Test as PulpTest, Testset
 from plptest import Shell, Check
-from itertools import product
+from itertools import product, cycle
 from functools import partial
 from collections import OrderedDict
 from copy import deepcopy
@@ -14,6 +14,13 @@ import traceback
 
 GENERATE_STIMULI = "gen_stimuli"
 
+# Scaling mode: set PLP_SCALING=1 to only run the _parallel versions, sweeping the number of cores
+# given in PLP_SCALING_NPE (comma separated, default: 1,2,4,8) on top of the problem sizes.
+SCALING_ENV = "PLP_SCALING"
+SCALING_NPE_ENV = "PLP_SCALING_NPE"
+SCALING_NPE = [1, 2, 4, 8]
+SCALING_VARIABLE = "nPE"
+
 
 class Variable(object):
     """Variable"""
@@ -129,6 +136,10 @@ class Argument(object):
             return np.int16
         if self.ctype == "int32_t":
             return np.int32
+        if self.ctype == "uint16_t":
+            return np.uint16
+        if self.ctype == "uint32_t":
+            return np.uint32
         if self.ctype == "float":
             return np.float32
         raise RuntimeError("Unknown type: %s" % self.ctype)
@@ -161,7 +172,7 @@ class Argument(object):
         """ Interpret the type of self.value and generate the stimuli """
         if callable(self.value):
             self.value = call_dynamic_function(self.value, env, version, device)
-        if self.value == GENERATE_STIMULI:
+        if isinstance(self.value, str) and self.value == GENERATE_STIMULI:
             self.value = call_dynamic_function(gen_stimuli, env, version, device, argument=self)
         if isinstance(self.value, str):
             self.value = env[self.value]
@@ -285,7 +296,7 @@ class ArrayArgument(Argument):
         dtype = self.get_dtype()
         if callable(self.value):
             self.value = call_dynamic_function(self.value, env, version, device)
-        if self.value == GENERATE_STIMULI:
+        if isinstance(self.value, str) and self.value == GENERATE_STIMULI:
             self.value = call_dynamic_function(gen_stimuli, env, version, device, variable=self)
         if isinstance(self.value, str):
             self.value = env[self.value]
@@ -616,6 +627,50 @@ class CustomArgument(Argument):
         return self.value
 
 
+class SetupArgument(CustomArgument):
+    """ Setup Argument
+    With this argument, you can run your own code around the call of the function-under-test, e.g.
+    to set a state of the library which is not passed as an argument (like the scratch arena or the
+    dispatch tables), and to check this state after the call. It is never added to the function
+    signature.
+    """
+    def __init__(self, name, value, setup=None, check=None):
+        """
+        name: Name of the argument (in the initialization)
+        value: Function, which returns the declarations of the argument, like for CustomArgument.
+        setup: Function, which returns the statements to execute before every call of the function,
+               or None. It can use the same arguments as value.
+        check: Function, which returns the statements to execute after the call if the result is
+               checked, or None. On failure, they must set passed = 0 and print a line starting with
+               <Mismatch>. It can use the same arguments as value.
+        """
+        super(SetupArgument, self).__init__(name, value, in_function=False)
+        self.setup = setup
+        self.check = check
+
+    def apply(self, env, var_type, version, use_l1, idx, device):
+        """
+        Prepares the declarations, the setup and the check strings
+        """
+        def arg_name(name):
+            return "t{}__{}".format(idx, name)
+        if self.setup is not None:
+            self.setup = call_dynamic_function(self.setup, env, version, device, use_l1=use_l1,
+                                               arg_name=arg_name)
+        if self.check is not None:
+            self.check = call_dynamic_function(self.check, env, version, device, use_l1=use_l1,
+                                               arg_name=arg_name)
+        return super(SetupArgument, self).apply(env, var_type, version, use_l1, idx, device)
+
+    def do_bench_setup_str(self):
+        """ returns the string for setup in do_bench function """
+        return self.setup
+
+    def check_str(self, target):
+        """ returns the string to check the result """
+        return self.check
+
+
 class AggregatedTestCase(object):
     """ Structure for one testcase in the aggregated tests """
     def __init__(self, idx, arguments, env, n_ops, version, device_name):
@@ -656,6 +711,22 @@ class AggregatedTestCase(object):
 
         return content
 
+    def n_bytes(self):
+        """ returns the number of bytes moved by the function. Every array is read once, outputs are
+        written once and inplace arrays are read and written. Arrays of unknown type count as 32bit
+        """
+        n_bytes = 0
+        for arg in self.arguments:
+            if not isinstance(arg, ArrayArgument):
+                continue
+            try:
+                item_size = np.dtype(arg.get_dtype()).itemsize
+            except RuntimeError:
+                item_size = 4
+            n_access = 2 if isinstance(arg, InplaceArgument) else 1
+            n_bytes += n_access * item_size * arg.length
+        return n_bytes
+
     def get_do_bench_function(self, function_name):
         """ returns the do_bench function for the current test """
         ret_str = ([a.arg_str() + " = " for a in self.arguments if isinstance(a, ReturnValue)] or [""])[0]
@@ -778,17 +849,24 @@ class AggregatedTest(object):
     statically.
     """
     def __init__(self, function_name, version, arg_ret_type, arguments, variables, visible_env,
-                 device_name, use_l1, extended_output=True, n_ops=None):
+                 device_name, use_l1, extended_output=True, n_ops=None, scaling=False, call=None):
         """ Build an aggregated test. This will also apply all arguments for all versions """
         self.function_name = function_name
         self.version = version
         self.device_name = device_name
         self.extended_output = extended_output
         self.visible_env = visible_env
+        self.scaling = scaling
 
         # extend funciton name
         self.function_name += "_" + self.version
 
+        # name of the called function, by default the name of the test
+        if call is None:
+            self.call_name = self.function_name
+        else:
+            self.call_name = call_dynamic_function(call, {}, self.version, self.device_name)
+
         # set use_l1 to false for ibex
         if self.device_name == "ibex":
             use_l1 = False
@@ -949,7 +1027,7 @@ class AggregatedTest(object):
                 ).format(includes=self.get_main_imports(),
                          test_entry=self.get_test_entry_function(),
                          run_tests="\n".join([case.get_run_test_function() for case in self.cases]),
-                         do_benchs="\n".join([case.get_do_bench_function(self.function_name)
+                         do_benchs="\n".join([case.get_do_bench_function(self.call_name)
                                               for case in self.cases]))
             )
 
@@ -1019,7 +1097,7 @@ class AggregatedTest(object):
                 ).format(includes=self.get_main_imports(),
                          test_entry=self.get_test_entry_function(),
                          run_tests="\n".join([case.get_run_test_function() for case in self.cases]),
-                         do_benchs="\n".join([case.get_do_bench_function(self.function_name)
+                         do_benchs="\n".join([case.get_do_bench_function(self.call_name)
                                               for case in self.cases]))
             )
 
@@ -1084,6 +1162,9 @@ def check_output(config, output, test_obj):
         if passed:
             bench_output(result, test_obj, case)
 
+    if passed and test_obj.scaling:
+        scaling_output(cases_result, test_obj)
+
     # clean the directory
     clean()
 
@@ -1134,7 +1215,8 @@ def bench_output(performance, test_obj, test_case):
         # create file and write header
         with open(BENCHMARK_FILE, "w") as f:
             f.write(
-                "name,device,dimension,cycles,instructions,ipc,imiss,ld_stall,tcdm_cont,ops,mpc\n"
+                "name,device,dimension,cycles,instructions,ipc,imiss,ld_stall,tcdm_cont,ops,mpc,"
+                "bytes\n"
             )
 
     # extract relevant fields
@@ -1153,10 +1235,126 @@ def bench_output(performance, test_obj, test_case):
                           str(performance['load_stalls']),
                           str(performance['tcdm_cont']),
                           str(test_case.n_ops),
-                          str(ops_per_cycle)]))
+                          str(ops_per_cycle),
+                          str(test_case.n_bytes())]))
         f.write("\n")
 
 
+SCALING_DIR = os.path.join(os.path.dirname(os.path.realpath(__file__)),
+                           "scaling_{}".format(time.strftime("%Y-%m-%d_%H:%M:%S")))
+
+
+def scaling_npe():
+    """ returns the list of core counts to sweep, or None if the scaling mode is not enabled """
+    if not os.environ.get(SCALING_ENV):
+        return None
+    if os.environ.get(SCALING_NPE_ENV):
+        return [int(n) for n in os.environ[SCALING_NPE_ENV].split(",")]
+    return SCALING_NPE
+
+
+def scaling_curves(performance, test_obj):
+    """
+    returns an OrderedDict, mapping the dimension (without nPE) to a list of tuples
+    (nPE, cycles, speedup, efficiency). The reference is the smallest nPE of each dimension.
+    """
+    dimension_env = [k for k in test_obj.visible_env if k != SCALING_VARIABLE]
+    curves = OrderedDict()
+    for case, result in zip(test_obj.cases, performance):
+        dimension = "; ".join(["%s=%s" % (k, str(case.env[k])) for k in dimension_env])
+        curves.setdefault(dimension, []).append((case.env[SCALING_VARIABLE], result['cycles']))
+
+    for dimension, points in curves.items():
+        points = sorted(points)
+        ref_npe, ref_cycles = points[0]
+        curves[dimension] = [(n_pe, cycles, ref_cycles / cycles,
+                              ref_cycles * ref_npe / (cycles * n_pe))
+                             for n_pe, cycles in points]
+    return curves
+
+
+def scaling_output(performance, test_obj):
+    """ writes the speedup and efficiency table (csv) and plot (svg) of one parallel test """
+    curves = scaling_curves(performance, test_obj)
+    if not os.path.isdir(SCALING_DIR):
+        os.mkdir(SCALING_DIR)
+    base_name = os.path.join(SCALING_DIR, "{}_{}".format(test_obj.function_name,
+                                                         test_obj.device_name))
+
+    with open(base_name + ".csv", "w") as f:
+        f.write("dimension,nPE,cycles,speedup,efficiency\n")
+        for dimension, points in curves.items():
+            for n_pe, cycles, speedup, efficiency in points:
+                f.write(",".join([dimension, str(n_pe), str(cycles), str(speedup),
+                                  str(efficiency)]))
+                f.write("\n")
+
+    with open(base_name + ".svg", "w") as f:
+        f.write(scaling_svg(test_obj.function_name, curves))
+
+    # the fastest core count of every problem size, i.e. the cut-over points of the scheduler
+    for dimension, points in curves.items():
+        best = min(points, key=lambda p: p[1])
+        print("      {}: best nPE={}, speedup={:.2f}, efficiency={:.2f}".format(
+            dimension or "-", best[0], best[2], best[3]))
+
+
+SVG_COLORS = ["#1f77b4", "#ff7f0e", "#2ca02c", "#d62728", "#9467bd", "#8c564b", "#e377c2",
+              "#7f7f7f", "#bcbd22", "#17becf"]
+
+
+def scaling_svg(title, curves):
+    """ returns an svg with the speedup and the efficiency over nPE, one line per dimension """
+    n_pes = sorted(set(p[0] for points in curves.values() for p in points))
+    max_speedup = max([p[2] for points in curves.values() for p in points] + [n_pes[-1] / n_pes[0]])
+    max_efficiency = max([p[3] for points in curves.values() for p in points] + [1.0])
+
+    width, height, margin = 360, 260, 50
+    legend_width = 220
+    panels = [("speedup", 2, max_speedup, [(n, n / n_pes[0]) for n in n_pes]),
+              ("efficiency", 3, max_efficiency, [(n, 1.0) for n in n_pes])]
+
+    def pos(n_pe, value, y_max, panel):
+        x = panel * (width + margin) + margin + n_pes.index(n_pe) * width / max(len(n_pes) - 1, 1)
+        y = margin + height - value / y_max * height
+        return "{:.1f},{:.1f}".format(x, y)
+
+    elements = ['<text x="{}" y="20" font-size="14">{}</text>'.format(margin, title)]
+    for panel, (label, idx, y_max, ideal) in enumerate(panels):
+        x0 = panel * (width + margin) + margin
+        elements.append('<rect x="{}" y="{}" width="{}" height="{}" fill="none" stroke="black"/>'
+                        .format(x0, margin, width, height))
+        elements.append('<text x="{}" y="{}" font-size="12">{}</text>'.format(x0, margin - 6,
+                                                                             label))
+        for n_pe in n_pes:
+            x, y = pos(n_pe, 0, y_max, panel).split(",")
+            elements.append('<text x="{}" y="{}" font-size="10" text-anchor="middle">{}</text>'
+                            .format(x, float(y) + 14, n_pe))
+        for tick in [0.0, 0.5, 1.0]:
+            x, y = pos(n_pes[0], tick * y_max, y_max, panel).split(",")
+            elements.append('<text x="{}" y="{}" font-size="10" text-anchor="end">{:.2f}</text>'
+                            .format(float(x) - 4, y, tick * y_max))
+        elements.append('<polyline fill="none" stroke="gray" stroke-dasharray="4" points="{}"/>'
+                        .format(" ".join([pos(n, v, y_max, panel) for n, v in ideal])))
+        for color, points in zip(cycle(SVG_COLORS), curves.values()):
+            elements.append('<polyline fill="none" stroke="{}" points="{}"/>'.format(
+                color, " ".join([pos(p[0], p[idx], y_max, panel) for p in points])))
+    for i, (color, dimension) in enumerate(zip(cycle(SVG_COLORS), curves.keys())):
+        x0 = 2 * (width + margin) + margin
+        elements.append('<text x="{}" y="{}" font-size="10" fill="{}">{}</text>'
+                        .format(x0, margin + 12 * (i + 1), color, dimension or "-"))
+
+    return dedent(
+        """\
+        <svg xmlns="http://www.w3.org/2000/svg" width="{w}" height="{h}">
+        {elements}
+        </svg>
+        """
+    ).format(w=2 * (width + margin) + margin + legend_width,
+             h=max(height + 2 * margin, margin + 12 * (len(curves) + 2)),
+             elements="\n".join(elements))
+
+
 class Sweep:
     """ Iterator over all variables and returns the environment"""
     def __init__(self, variables, version):
@@ -1246,7 +1444,7 @@ def tolerance_check_str(acq, exp, tolerance, ctype, indent, target):
         # In case of float: add a tiny absolute offset of 0.0001
         return dedent(
             """\
-            {indent}float __tol = ABS({tol:E} * (float){exp} + 0.0001);
+            {indent}float __tol = ABS({tol:E} * (float){exp}) + 0.0001;
             {indent}if (!({acq} >= ({ty})({exp} - __tol) &&
             {indent}      {acq} <= ({ty})({exp} + __tol))) {{\
             """
@@ -1333,8 +1531,25 @@ def tolerance_check_str(acq, exp, tolerance, ctype, indent, target):
 
 
 def generate_test(function_name, arguments, variables, implemented, use_l1=False,
-                  extended_output=True, n_ops=None, arg_ret_type=None):
-    """ Entry-Point of the phase 1 """
+                  extended_output=True, n_ops=None, arg_ret_type=None, call=None):
+    """ Entry-Point of the phase 1
+    call: Function, which maps the version to the name of the called function, if it is not
+          function_name + "_" + version (e.g. for functions with an instance argument like
+          plp_stream). The tests and the benchmarks keep the name function_name + "_" + version.
+    """
+    # in the scaling mode, only the parallel versions are tested, sweeping the number of cores
+    n_pe_values = scaling_npe()
+    if n_pe_values is not None:
+        implemented = {device_name: {v: impl[v] for v in impl if v.endswith('parallel')}
+                       for device_name, impl in implemented.items()}
+    if not any(isinstance(arg, ParallelArgument) for arg in arguments):
+        n_pe_values = None
+    if n_pe_values is not None:
+        variables = variables + [SweepVariable(SCALING_VARIABLE, n_pe_values)]
+        arguments = [ParallelArgument(arg.name, SCALING_VARIABLE, arg.use_l1, arg.in_function)
+                     if isinstance(arg, ParallelArgument) else arg
+                     for arg in arguments]
+
     testsets = [
         Testset(
             name=device_name,
@@ -1348,7 +1563,9 @@ def generate_test(function_name, arguments, variables, implemented, use_l1=False
                                device_name=device_name,
                                use_l1=use_l1,
                                extended_output=extended_output,
-                               n_ops=n_ops).to_plptest()
+                               n_ops=n_ops,
+                               scaling=n_pe_values is not None,
+                               call=call).to_plptest()
                 for v in impl if impl[v]
             ]
         )
@@ -1400,8 +1617,9 @@ def call_dynamic_function(f, env, version, device, arg_name=None, argument=None,
             'use_l1': (argument, "use_l1: bool"),
         })
 
-    # __code__.co_varnames returns the list of argument names of the function
-    arg_list = f.__code__.co_varnames
+    # __code__.co_varnames starts with the co_argcount argument names, followed by the local
+    # variables of the function
+    arg_list = f.__code__.co_varnames[:f.__code__.co_argcount]
 
     if not set(arg_list).issubset(possible_args.keys()):
         valid_options = "\n".join(["{:11} -> {}".format(k, v[1]) for k, v in sorted(
@@ -27,8 +27,13 @@ def compute_result(result_parameter, inputs, env, fix_point):
         # else:
             
     elif result_parameter.ctype == 'float':
+        # the output contains the full spectrum of N complex values, real and imaginary
+        # parts interleaved
         a = inputs['pSrc'].value.astype(np.float32)
-        result = np.array(np.fft.rfft(a), dtype=np.float32)
+        spectrum = np.fft.fft(a)
+        result = np.zeros(2 * len(a), dtype=np.float32)
+        result[0::2] = np.real(spectrum)
+        result[1::2] = np.imag(spectrum)
     else:
         raise RuntimeError("Unrecognized result type: %s" % result_parameter.ctype)
 
@@ -0,0 +1,73 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    # The output contains the full spectrum of N complex values, real and imaginary parts
+    # interleaved. Like for the complex FFT, the output is scaled by 1/N, i.e. the decimal point
+    # moves by log2(N) bits: Q1.15 -> Q(1+log2(N)).(15-log2(N)), Q1.31 -> Q(1+log2(N)).(31-log2(N))
+    if result_parameter.ctype == 'int32_t':
+        my_type = np.int32
+    elif result_parameter.ctype == 'int16_t':
+        my_type = np.int16
+    else:
+        raise RuntimeError("Unrecognized result type: %s" % result_parameter.ctype)
+
+    if fix_point is None or fix_point == 0:
+        raise RuntimeError("no fixpoint not implemented")
+
+    # double precision, single precision is not accurate enough for Q1.31
+    a = inputs['pSrc'].value.astype(np.float64)
+    spectrum = np.fft.fft(a) / len(a)
+    result = np.zeros(2 * len(a), dtype=my_type)
+    result[0::2] = np.real(spectrum).astype(my_type)
+    result[1::2] = np.imag(spectrum).astype(my_type)
+
+    return result
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def q_sat(x):
+    if x > 2**31 - 1:
+        return x - 2**32
+    elif x < -2**31:
+        return x + 2**32
+    else:
+        return x
+
+
+def q_add(a, b):
+    return q_sat(a + b)
+
+
+def q_sub(a, b):
+    return q_sat(a - b)
+
+
+def q_mul(a, b, p):
+    return q_roundnorm(a * b, p)
+
+
+def q_roundnorm(a, p):
+    rounding = 1 << (p - 1)
+    return q_sat((a + rounding) >> p)
@@ -0,0 +1,82 @@
+"""
+Sparse matrices for the tests of the plp_spmat, plp_spmv and plp_spmm functions. testset.cfg and
+gen_stimuli.py both build the matrix from the environment, so that they use the same values.
+
+The matrix of shape len_m x len_n has the given density (percentage of nonzero values, or of nonzero
+blocks of blk_m x blk_n values).
+"""
+
+import numpy as np
+
+SPARSE_CTYPES = {'i8': 'int8_t', 'i16': 'int16_t', 'f32': 'float'}
+
+
+def sparse_mask(env, blk_m=1, blk_n=1):
+    """ nonzero pattern of the sparse matrix, it only depends on the shape and the density """
+    rng = np.random.RandomState(env['len_m'] * 1000 + env['len_n'] * 10 + env['density'])
+    mask = rng.uniform(size=(env['len_m'] // blk_m, env['len_n'] // blk_n)) * 100 < env['density']
+    return np.kron(mask, np.ones((blk_m, blk_n), dtype=np.int32)) != 0
+
+
+def sparse_matrix(env, ctype, blk_m=1, blk_n=1):
+    """ dense copy of the sparse matrix """
+    rng = np.random.RandomState(env['len_m'] * 1000 + env['len_n'] * 10 + env['density'] + 1)
+    shape = (env['len_m'], env['len_n'])
+    if ctype == 'float':
+        values = rng.uniform(-1.0, 1.0, size=shape).astype(np.float32)
+    else:
+        dtype = np.int8 if ctype == 'int8_t' else np.int16
+        values = rng.randint(np.iinfo(dtype).min, np.iinfo(dtype).max + 1, size=shape).astype(dtype)
+    return np.where(sparse_mask(env, blk_m, blk_n), values, 0).astype(values.dtype)
+
+
+def csr_from_dense(a):
+    """ reference CSR format of the dense matrix a: (values, col_idx, row_ptr) """
+    rows, cols = np.nonzero(a)
+    row_ptr = np.searchsorted(rows, np.arange(a.shape[0] + 1))
+    return a[rows, cols], cols.astype(np.uint16), row_ptr.astype(np.uint32)
+
+
+def bcsr_from_dense(a, blk_m):
+    """ reference BCSR format of the dense matrix a, with blocks of blk_m x 4 values. A block is
+    stored if any of its values is nonzero. """
+    blocks = a.reshape(a.shape[0] // blk_m, blk_m, a.shape[1] // 4, 4).swapaxes(1, 2)
+    values, col_idx, row_ptr = csr_from_dense(np.any(blocks != 0, axis=(2, 3)))
+    rows = np.repeat(np.arange(len(row_ptr) - 1), np.diff(row_ptr))
+    return blocks[rows, col_idx].flatten(), col_idx, row_ptr
+
+
+def sparse_struct_code(v, kind, fields, values, col_idx, row_ptr, arg_name):
+    """ C code of the arrays and the plp_spmat_<kind>_<v> struct, pointed to by pSrcA """
+    # an empty matrix still needs arrays with at least one element
+    ctype = SPARSE_CTYPES[v]
+    values = [("%.9ef" if ctype == 'float' else "%d") % x for x in values] or ["0"]
+    col_idx = ["%d" % x for x in col_idx] or ["0"]
+    return """\
+{ty} {values}[{n_values}] = {{ {values_init} }};
+uint16_t {col_idx}[{n_col_idx}] = {{ {col_idx_init} }};
+uint32_t {row_ptr}[{n_row_ptr}] = {{ {row_ptr_init} }};
+plp_spmat_{kind}_{v} {s} = {{ {fields}, {values}, {col_idx}, {row_ptr} }};
+const plp_spmat_{kind}_{v}* {name} = &{s};
+""".format(ty=ctype, v=v, kind=kind, fields=fields, values=arg_name("values"),
+           n_values=len(values), values_init=", ".join(values), col_idx=arg_name("col_idx"),
+           n_col_idx=len(col_idx), col_idx_init=", ".join(col_idx), row_ptr=arg_name("row_ptr"),
+           n_row_ptr=len(row_ptr), row_ptr_init=", ".join("%d" % x for x in row_ptr),
+           s=arg_name("matrix"), name=arg_name("pSrcA"))
+
+
+def csr_struct(env, version, arg_name):
+    """ CustomArgument value of the sparse matrix pSrcA in CSR format """
+    v = version.split("_")[0]
+    values, col_idx, row_ptr = csr_from_dense(sparse_matrix(env, SPARSE_CTYPES[v]))
+    fields = "%d, %d" % (env['len_m'], env['len_n'])
+    return sparse_struct_code(v, 'csr', fields, values, col_idx, row_ptr, arg_name)
+
+
+def bcsr_struct(env, version, arg_name):
+    """ CustomArgument value of the sparse matrix pSrcA in BCSR format, with blk_rows x 4 blocks """
+    v = version.split("_")[0]
+    a = sparse_matrix(env, SPARSE_CTYPES[v], env['blk_rows'], 4)
+    values, col_idx, row_ptr = bcsr_from_dense(a, env['blk_rows'])
+    fields = "%d, %d, %d" % (env['len_m'], env['len_n'], env['blk_rows'])
+    return sparse_struct_code(v, 'bcsr', fields, values, col_idx, row_ptr, arg_name)
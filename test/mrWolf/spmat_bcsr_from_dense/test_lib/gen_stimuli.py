@@ -0,0 +1,45 @@
+#!/usr/bin/env python3
+
+import sys, os
+import numpy as np
+sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../..")))
+from sparse_stimuli import bcsr_from_dense
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    a = inputs['pSrc'].value.reshape((env['len_m'], env['len_n']))
+    values, col_idx, row_ptr = bcsr_from_dense(a, env['blk_rows'])
+    max_blocks = inputs['maxBlocks'].value
+    blk_size = env['blk_rows'] * 4
+
+    # the row pointers are always written, the buffers only hold the first maxBlocks blocks
+    name = result_parameter.general_name()
+    if name == 'return_value':
+        return int(len(col_idx) > max_blocks)
+    elif name == 'pRowPtr':
+        return row_ptr
+    elif name == 'pValues':
+        result = np.zeros(result_parameter.length, dtype=a.dtype)
+        result[:min(len(values), max_blocks * blk_size)] = values[:max_blocks * blk_size]
+    elif name == 'pColIdx':
+        result = np.zeros(result_parameter.length, dtype=np.uint16)
+        result[:min(len(col_idx), max_blocks)] = col_idx[:max_blocks]
+    else:
+        raise RuntimeError("Unrecognized result: %s" % name)
+
+    return result
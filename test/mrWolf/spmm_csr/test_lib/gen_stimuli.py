@@ -0,0 +1,37 @@
+#!/usr/bin/env python3
+
+import sys, os
+import numpy as np
+sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../..")))
+from sparse_stimuli import sparse_matrix
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    # the values of the sparse matrix are not an argument, build the same matrix as testset.cfg
+    a = sparse_matrix(env, inputs['pSrcB'].ctype)
+    if result_parameter.ctype == 'int32_t':
+        b = inputs['pSrcB'].value.astype(np.int32).reshape((env['len_n'], env['len_o']))
+        result = np.matmul(a.astype(np.int32), b).astype(np.int32)
+    elif result_parameter.ctype == 'float':
+        b = inputs['pSrcB'].value.astype(np.float64).reshape((env['len_n'], env['len_o']))
+        result = np.matmul(a.astype(np.float64), b).astype(np.float32)
+    else:
+        raise RuntimeError("Unrecognized result type: %s" % result_parameter.ctype)
+
+    return result.flatten()
+
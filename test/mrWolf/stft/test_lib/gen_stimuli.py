@@ -0,0 +1,77 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    # power spectrum |X_m[k]|^2, k = 0 .. N/2, of the Hann windowed frames with hop N/4. The ring
+    # buffer of the instance starts with zeros.
+    N = env['len']
+    hop = env['hop']
+    x = np.concatenate((np.zeros(N - hop), inputs['pSrc'].value.astype(np.float64)))
+    w = 0.5 - 0.5 * np.cos(2 * np.pi * np.arange(N) / N)
+
+    if result_parameter.ctype == 'float':
+        w = w.astype(np.float32).astype(np.float64)
+        frames = [x[m * hop:m * hop + N] * w for m in range(env['numFrames'])]
+        result = (np.abs(np.fft.rfft(frames, axis=1))**2).flatten().astype(np.float32)
+    elif result_parameter.ctype == 'int32_t':
+        if fix_point is None or fix_point == 0:
+            raise RuntimeError("no fixpoint not implemented")
+
+        # the window is applied in Q1.15, the spectrum is scaled by 1/N, the power is in Q2.30
+        w = np.round(w * 32767).astype(np.int64)
+        frames = [(x[m * hop:m * hop + N].astype(np.int64) * w) >> 15
+                  for m in range(env['numFrames'])]
+        spectrum = np.fft.rfft(np.array(frames, dtype=np.float64), axis=1) / N
+        result = np.round(np.abs(spectrum)**2).flatten().astype(np.int32)
+    else:
+        raise RuntimeError("Unrecognized result type: %s" % result_parameter.ctype)
+
+    return result
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def q_sat(x):
+    if x > 2**31 - 1:
+        return x - 2**32
+    elif x < -2**31:
+        return x + 2**32
+    else:
+        return x
+
+
+def q_add(a, b):
+    return q_sat(a + b)
+
+
+def q_sub(a, b):
+    return q_sat(a - b)
+
+
+def q_mul(a, b, p):
+    return q_roundnorm(a * b, p)
+
+
+def q_roundnorm(a, p):
+    rounding = 1 << (p - 1)
+    return q_sat((a + rounding) >> p)
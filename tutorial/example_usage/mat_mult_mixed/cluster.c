@@ -0,0 +1,152 @@
+#include <stdio.h>
+#include "pulp.h"
+#include "plp_math.h"
+
+// Mixed-precision layer of M output channels and N inputs, once as matrix-matrix product with O
+// activation vectors and once as matrix-vector product (plp_mat_vec). The 8-bit and the packed
+// 4-bit weights are compared to widening weights and activations to 16 bits and calling
+// plp_mat_mult_i16, which also gives the reference results.
+
+#define NPE 8
+#define M 64
+#define N 64
+#define O 16
+
+RT_L1_DATA int8_t matA8[M * N];
+RT_L1_DATA int8_t matA4[M * N / 2];
+RT_L1_DATA int16_t matA16[M * N];
+RT_L1_DATA int16_t actB16[N * O];
+RT_L1_DATA int8_t actB8[N * O];
+RT_L1_DATA int16_t actW16[N * O];
+RT_L1_DATA int32_t matC[M * O];
+RT_L1_DATA int32_t matRef[M * O];
+RT_L1_DATA int16_t matC16[M * O];
+RT_L1_DATA int32_t pMult[M];
+RT_L1_DATA int32_t pBias[M];
+
+static unsigned int seed = 1;
+
+static unsigned int rand_next()
+{
+  seed = seed * 1103515245 + 12345;
+  return (seed >> 16) & 0x7fff;
+}
+
+int check(int32_t *C, int32_t *ref, int n)
+{
+  int i, errors = 0;
+  for(i=0;i<n;i++)
+    if(C[i] != ref[i])
+      errors++;
+  return errors;
+}
+
+void print_row(char *name, unsigned int cycles, int macs, int bytes)
+{
+  printf("%-18s %7d %4d.%02d %8d\n", name, cycles, macs / cycles, (100 * macs / cycles) % 100,
+         bytes);
+}
+
+void cluster_entry(void *arg)
+{
+
+  printf("Cluster entered\n");
+
+  rt_perf_t perf;
+  rt_perf_init(&perf);
+  rt_perf_conf(&perf, (1<<RT_PERF_CYCLES) | (1<<RT_PERF_INSTR));
+
+  int i, m, errors = 0;
+
+  for(i=0;i<M * N;i++)
+    matA8[i] = (int8_t)((int)(rand_next() % 255) - 127);
+  for(i=0;i<M * N / 2;i++)
+    matA4[i] = (int8_t)rand_next();
+  for(i=0;i<N * O;i++) {
+    actB16[i] = (int16_t)((int)(rand_next() % 65535) - 32767);
+    actB8[i] = (int8_t)((int)(rand_next() % 255) - 127);
+    actW16[i] = actB8[i];
+  }
+  for(m=0;m<M;m++) {
+    pMult[m] = 1 + rand_next() % 15;
+    pBias[m] = (int)(rand_next() % 2001) - 1000;
+  }
+
+  printf("%dx%d weights times %dx%d activations on %d cores\n", M, N, N, O, NPE);
+  printf("kernel              cycles MAC/cyc  weights\n");
+
+  // 8-bit weights, 16-bit activations
+  for(i=0;i<M * N;i++)
+    matA16[i] = matA8[i];
+
+  rt_perf_reset(&perf);
+  rt_perf_start(&perf);
+  plp_mat_mult_i16_parallel(matA16, actB16, M, N, O, NPE, matRef);
+  rt_perf_stop(&perf);
+  print_row("i16 widened", rt_perf_read(RT_PERF_CYCLES), M * N * O, M * N * 2);
+
+  rt_perf_reset(&perf);
+  rt_perf_start(&perf);
+  plp_mat_mult_i8i16_parallel(matA8, actB16, M, N, O, NPE, matC);
+  rt_perf_stop(&perf);
+  print_row("i8i16", rt_perf_read(RT_PERF_CYCLES), M * N * O, M * N);
+  errors += check(matC, matRef, M * O);
+
+  rt_perf_reset(&perf);
+  rt_perf_start(&perf);
+  plp_mat_mult_requant_i8i16_parallel(matA8, actB16, M, N, O, pMult, pBias, 16, NPE, matC16);
+  rt_perf_stop(&perf);
+  print_row("i8i16 requant", rt_perf_read(RT_PERF_CYCLES), M * N * O, M * N);
+
+  rt_perf_reset(&perf);
+  rt_perf_start(&perf);
+  plp_mat_vec_i8i16_parallel(matA8, actB16, M, N, NPE, matC);
+  rt_perf_stop(&perf);
+  print_row("i8i16 mat_vec", rt_perf_read(RT_PERF_CYCLES), M * N, M * N);
+  // the first N activations are the vector x
+  for(m=0;m<M;m++) {
+    int32_t sum = 0;
+    for(i=0;i<N;i++)
+      sum += matA16[m * N + i] * actB16[i];
+    errors += matC[m] != sum;
+  }
+
+  // 4-bit weights, 8-bit activations
+  for(m=0;m<M;m++)
+    for(i=0;i<N;i++) {
+      int byte = (uint8_t)matA4[m * N / 2 + i / 2];
+      int w = i & 1 ? byte >> 4 : byte & 15;
+      matA16[m * N + i] = w >= 8 ? w - 16 : w;
+    }
+
+  rt_perf_reset(&perf);
+  rt_perf_start(&perf);
+  plp_mat_mult_i16_parallel(matA16, actW16, M, N, O, NPE, matRef);
+  rt_perf_stop(&perf);
+  print_row("i16 widened", rt_perf_read(RT_PERF_CYCLES), M * N * O, M * N * 2);
+
+  rt_perf_reset(&perf);
+  rt_perf_start(&perf);
+  plp_mat_mult_i4i8_parallel(matA4, actB8, M, N, O, NPE, matC);
+  rt_perf_stop(&perf);
+  print_row("i4i8", rt_perf_read(RT_PERF_CYCLES), M * N * O, M * N / 2);
+  errors += check(matC, matRef, M * O);
+
+  rt_perf_reset(&perf);
+  rt_perf_start(&perf);
+  plp_mat_vec_i4i8_parallel(matA4, actB8, M, N, NPE, matC);
+  rt_perf_stop(&perf);
+  print_row("i4i8 mat_vec", rt_perf_read(RT_PERF_CYCLES), M * N, M * N / 2);
+  // the first N activations are the vector x
+  for(m=0;m<M;m++) {
+    int32_t sum = 0;
+    for(i=0;i<N;i++)
+      sum += matA16[m * N + i] * actB8[i];
+    errors += matC[m] != sum;
+  }
+
+  if(errors)
+    printf("%d results differ\n", errors);
+  else
+    printf("Result correct\n");
+}
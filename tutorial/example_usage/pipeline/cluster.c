@@ -0,0 +1,20 @@
+#include <stdio.h>
+#include "pulp.h"
+#include "plp_math.h"
+#include "cluster.h"
+
+// Cluster stage: copies the frame into L1 and computes its energy on NPE cores.
+
+RT_L1_DATA int32_t frameL1[FRAME_LEN];
+
+void frame_energy(plp_pipeline_frame *pFrame, void *args)
+{
+  int32_t *pEnergy = (int32_t *)args;
+  rt_dma_copy_t copy;
+
+  rt_dma_memcpy((unsigned int)pFrame->pData, (unsigned int)frameL1, sizeof(frameL1),
+                RT_DMA_DIR_EXT2LOC, 0, &copy);
+  rt_dma_wait(&copy);
+
+  plp_dot_prod_i32_parallel(frameL1, frameL1, FRAME_LEN, NPE, &pEnergy[pFrame->index]);
+}
@@ -0,0 +1,4 @@
+#define FRAME_LEN 256
+#define NPE 8
+
+void frame_energy(plp_pipeline_frame *pFrame, void *args);
@@ -0,0 +1,88 @@
+// Copyright 2018 ETH Zurich and University of Bologna.
+// Copyright and related rights are licensed under the Solderpad Hardware
+// License, Version 0.51 (the “License”); you may not use this file except in
+// compliance with the License.  You may obtain a copy of the License at
+// http://solderpad.org/licenses/SHL-0.51. Unless required by applicable law
+// or agreed to in writing, software, hardware and materials distributed under
+// this License is distributed on an “AS IS” BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+#include "pulp.h"
+#include "plp_math.h"
+#include "cluster.h"
+
+// A signal is decimated by 4 on the FC (plp_mean_i32 of each group of 4 samples) and framed.
+// The cluster computes the energy of each frame. The pipeline runs once without overlap (one
+// descriptor) and once double-buffered (two descriptors). Both are checked against a serial
+// reference computed on the FC with plp_mean_i32 and plp_dot_prod_i32.
+
+#define DECIMATION 4
+#define NFRAMES 16
+
+RT_L2_DATA int32_t frames[2][FRAME_LEN];
+RT_L2_DATA int32_t energy[2][NFRAMES];
+RT_L2_DATA int32_t reference[NFRAMES];
+
+int32_t sample(uint32_t n)
+{
+  return (int32_t)((n * 37) % 101) - 50;
+}
+
+// FC stage: decimation and framing
+void decimate(plp_pipeline_frame *pFrame, void *args)
+{
+  int32_t *pOut = (int32_t *)pFrame->pData;
+  int32_t block[DECIMATION];
+  uint32_t i, j;
+
+  for(i=0;i<FRAME_LEN;i++) {
+    uint32_t n = (pFrame->index * FRAME_LEN + i) * DECIMATION;
+    for(j=0;j<DECIMATION;j++)
+      block[j] = sample(n + j);
+    plp_mean_i32(block, DECIMATION, &pOut[i]);
+  }
+}
+
+int main()
+{
+  plp_pipeline_frame desc[2] = { { frames[0] }, { frames[1] } };
+  plp_pipeline_instance S;
+  int i, errors = 0;
+
+  printf("Entering main controller\n");
+
+  rt_cluster_mount(1, 0, 0, NULL);
+
+  // depth 1: the FC and the cluster take turns
+  S = (plp_pipeline_instance){ decimate, NULL, frame_energy, energy[0], desc, 1 };
+  plp_pipeline_run(&S, NFRAMES);
+  printf("Without overlap:\n");
+  plp_pipeline_print(&S);
+
+  // depth 2: the FC decimates frame n + 1 while the cluster computes frame n
+  S = (plp_pipeline_instance){ decimate, NULL, frame_energy, energy[1], desc, 2 };
+  plp_pipeline_run(&S, NFRAMES);
+  printf("Double-buffered:\n");
+  plp_pipeline_print(&S);
+
+  rt_cluster_mount(0, 0, 0, NULL);
+
+  // serial reference: the same stages, one frame after the other on the FC
+  for(i=0;i<NFRAMES;i++) {
+    plp_pipeline_frame frame = { frames[0], i };
+    decimate(&frame, NULL);
+    plp_dot_prod_i32(frames[0], frames[0], FRAME_LEN, &reference[i]);
+  }
+
+  for(i=0;i<NFRAMES;i++)
+    if(energy[0][i] != reference[i] || energy[1][i] != reference[i])
+      errors++;
+
+  if(errors)
+    printf("%d frames differ\n", errors);
+  else
+    printf("Result correct\n");
+
+  return 0;
+}
@@ -0,0 +1,127 @@
+#include <stdio.h>
+#include "pulp.h"
+#include "plp_math.h"
+
+// Dense against sparse matrix multiplication of 8-bit integers at different sparsities. The
+// matrix A is sparse either unstructured (every value is zero with the given probability) or in
+// 4x4 blocks (every 4x4 block is zero with the given probability). The dense product is compared
+// to the CSR and the BCSR product (4x4 blocks), once as matrix-vector (O = 1) and once as
+// matrix-matrix product.
+
+#define NPE 8
+#define M 64
+#define N 64
+#define O 16
+#define NSPARSITIES 5
+
+RT_L1_DATA int8_t matA[M * N];
+RT_L1_DATA int8_t matB[N * O];
+RT_L1_DATA int32_t matC[M * O];
+RT_L1_DATA int32_t matRef[M * O];
+
+RT_L1_DATA int8_t csrValues[M * N];
+RT_L1_DATA uint16_t csrColIdx[M * N];
+RT_L1_DATA uint32_t csrRowPtr[M + 1];
+RT_L1_DATA int8_t bcsrValues[M * N];
+RT_L1_DATA uint16_t bcsrColIdx[M * N / 16];
+RT_L1_DATA uint32_t bcsrRowPtr[M / 4 + 1];
+
+static unsigned int seed = 1;
+
+static unsigned int rand_next()
+{
+  seed = seed * 1103515245 + 12345;
+  return (seed >> 16) & 0x7fff;
+}
+
+// zero probability in percent, blk = 1 for unstructured sparsity, blk = 4 for 4x4 blocks
+void init_sparse(int8_t *A, int sparsity, int blk)
+{
+  int i, j, k, l;
+  for(i=0;i<M;i+=blk) {
+    for(j=0;j<N;j+=blk) {
+      int keep = (int)(rand_next() % 100) >= sparsity;
+      for(k=i;k<i+blk;k++)
+        for(l=j;l<j+blk;l++)
+          A[k * N + l] = keep ? (int8_t)(((int)(rand_next() % 255) - 127) | 1) : 0;
+    }
+  }
+}
+
+int check(int32_t *C, int32_t *ref, int n)
+{
+  int i, errors = 0;
+  for(i=0;i<n;i++)
+    if(C[i] != ref[i])
+      errors++;
+  return errors;
+}
+
+void cluster_entry(void *arg)
+{
+
+  printf("Cluster entered\n");
+
+  rt_perf_t perf;
+  rt_perf_init(&perf);
+  rt_perf_conf(&perf, (1<<RT_PERF_CYCLES) | (1<<RT_PERF_INSTR));
+
+  static const int sparsities[NSPARSITIES] = { 0, 50, 80, 90, 95 };
+  plp_spmat_csr_i8 csr;
+  plp_spmat_bcsr_i8 bcsr;
+  int i, blk, s, o, errors = 0;
+  unsigned int cyclesDense, cyclesCsr, cyclesBcsr;
+
+  for(i=0;i<N * O;i++)
+    matB[i] = (int8_t)((int)(rand_next() % 255) - 127);
+
+  printf("%dx%d times %dx1 and %dx%d on %d cores, cycles\n", M, N, N, N, O, NPE);
+  printf("pattern  zeros  O   dense    CSR   BCSR   CSR bytes  BCSR bytes\n");
+
+  for(blk=1;blk<=4;blk+=3) {
+    for(s=0;s<NSPARSITIES;s++) {
+      init_sparse(matA, sparsities[s], blk);
+      plp_spmat_csr_from_dense_i8(matA, M, N, M * N, csrValues, csrColIdx, csrRowPtr, &csr);
+      plp_spmat_bcsr_from_dense_i8(matA, M, N, 4, M * N / 16, bcsrValues, bcsrColIdx,
+                                   bcsrRowPtr, &bcsr);
+
+      for(o=1;o<=O;o+=O-1) {
+        rt_perf_reset(&perf);
+        rt_perf_start(&perf);
+        plp_mat_mult_i8_parallel(matA, matB, M, N, o, NPE, matRef);
+        rt_perf_stop(&perf);
+        cyclesDense = rt_perf_read(RT_PERF_CYCLES);
+
+        rt_perf_reset(&perf);
+        rt_perf_start(&perf);
+        if(o == 1)
+          plp_spmv_csr_i8_parallel(&csr, matB, NPE, matC);
+        else
+          plp_spmm_csr_i8_parallel(&csr, matB, o, NPE, matC);
+        rt_perf_stop(&perf);
+        cyclesCsr = rt_perf_read(RT_PERF_CYCLES);
+        errors += check(matC, matRef, M * o);
+
+        rt_perf_reset(&perf);
+        rt_perf_start(&perf);
+        if(o == 1)
+          plp_spmv_bcsr_i8_parallel(&bcsr, matB, NPE, matC);
+        else
+          plp_spmm_bcsr_i8_parallel(&bcsr, matB, o, NPE, matC);
+        rt_perf_stop(&perf);
+        cyclesBcsr = rt_perf_read(RT_PERF_CYCLES);
+        errors += check(matC, matRef, M * o);
+
+        // values and indices of the formats, the dense matrix takes M * N bytes
+        printf("%s  %4d%%  %2d  %6d %6d %6d  %10d  %10d\n", blk == 1 ? "unstruct" : "4x4 blks",
+               sparsities[s], o, cyclesDense, cyclesCsr, cyclesBcsr,
+               csrRowPtr[M] * 3 + (M + 1) * 4, bcsrRowPtr[M / 4] * 18 + (M / 4 + 1) * 4);
+      }
+    }
+  }
+
+  if(errors)
+    printf("%d results differ\n", errors);
+  else
+    printf("Result correct\n");
+}
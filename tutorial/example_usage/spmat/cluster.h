@@ -0,0 +1 @@
+void cluster_entry(void *arg);
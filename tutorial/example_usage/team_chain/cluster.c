@@ -0,0 +1,96 @@
+#include <stdio.h>
+#include "pulp.h"
+#include "plp_math.h"
+
+// Chain of NSTEPS small parallel kernels, executed once with one fork per kernel (the _parallel
+// glue functions) and once on a persistent team (plp_team_run).
+
+#define NPE 8
+#define M 16
+#define N 16
+#define NSTEPS 10
+
+RT_L1_DATA float32_t matB[M * N];
+RT_L1_DATA float32_t matX[NSTEPS + 1][M * N];
+RT_L1_DATA float32_t matY[NSTEPS + 1][M * N];
+
+RT_L1_DATA plp_mat_add_instance_f32 addArgs[NSTEPS];
+RT_L1_DATA plp_mat_scale_instance_f32 scaleArgs[NSTEPS];
+RT_L1_DATA plp_team_step steps[NSTEPS];
+
+void init_mat(float32_t *A, int n, float32_t off)
+{
+  int i;
+  for(i=0;i<n;i++)
+    A[i] = (float32_t)(i % 17) * 0.125f + off;
+}
+
+// even steps scale by 0.5, odd steps add B
+void chain_fork(float32_t (*X)[M * N])
+{
+  int s;
+  for(s=0;s<NSTEPS;s++) {
+    if (s % 2 == 0)
+      plp_mat_scale_f32_parallel(X[s], M, N, 0.5f, NPE, X[s + 1]);
+    else
+      plp_mat_add_f32_parallel(X[s], matB, M, N, NPE, X[s + 1]);
+  }
+}
+
+void chain_team(float32_t (*X)[M * N])
+{
+  int s;
+  for(s=0;s<NSTEPS;s++) {
+    if (s % 2 == 0) {
+      scaleArgs[s] = (plp_mat_scale_instance_f32){ X[s], M, N, 0.5f, NPE, X[s + 1] };
+      steps[s] = (plp_team_step){ plp_mat_scale_f32p_xpulpv2, &scaleArgs[s], 0 };
+    } else {
+      addArgs[s] = (plp_mat_add_instance_f32){ X[s], matB, M, N, NPE, X[s + 1] };
+      steps[s] = (plp_team_step){ plp_mat_add_f32p_xpulpv2, &addArgs[s], 0 };
+    }
+  }
+  plp_team_run(steps, NSTEPS, NPE);
+}
+
+void cluster_entry(void *arg)
+{
+
+  printf("Cluster entered\n");
+
+  rt_perf_t perf;
+  rt_perf_init(&perf);
+  rt_perf_conf(&perf, (1<<RT_PERF_CYCLES) | (1<<RT_PERF_INSTR));
+
+  int i, errors = 0;
+  unsigned int cyclesFork, cyclesTeam;
+
+  init_mat(matB, M * N, 1.0f);
+  init_mat(matX[0], M * N, 0.0f);
+  init_mat(matY[0], M * N, 0.0f);
+
+  rt_perf_reset(&perf);
+  rt_perf_start(&perf);
+  chain_fork(matX);
+  rt_perf_stop(&perf);
+  cyclesFork = rt_perf_read(RT_PERF_CYCLES);
+
+  rt_perf_reset(&perf);
+  rt_perf_start(&perf);
+  chain_team(matY);
+  rt_perf_stop(&perf);
+  cyclesTeam = rt_perf_read(RT_PERF_CYCLES);
+
+  for(i=0;i<M * N;i++)
+    if(matX[NSTEPS][i] != matY[NSTEPS][i])
+      errors++;
+
+  if(errors)
+    printf("%d results differ\n", errors);
+  else
+    printf("Result correct\n");
+
+  printf("%d kernels of %dx%d on %d cores\n", NSTEPS, M, N, NPE);
+  printf("One fork per kernel: %d cycles\n", cyclesFork);
+  printf("Persistent team:     %d cycles\n", cyclesTeam);
+  printf("Saved per kernel:    %d cycles\n", ((int)cyclesFork - (int)cyclesTeam) / NSTEPS);
+}